@@ -0,0 +1,229 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#define _POSIX_C_SOURCE 200112
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ceed-auto.h"
+
+//------------------------------------------------------------------------------
+// Wall clock time in seconds
+//------------------------------------------------------------------------------
+static double CeedAutoTime(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9*ts.tv_nsec;
+}
+
+//------------------------------------------------------------------------------
+// Decision table key of an operator
+//
+// Operators share a key when they have the same QFunction source, the same
+//   evaluation mode, dimension, components, nodes, and quadrature points for
+//   each field, and the same number of elements up to a power of two.
+//------------------------------------------------------------------------------
+static int CeedOperatorGetKey_Auto(CeedOperator op, char **key) {
+  int ierr;
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  char *source;
+  ierr = CeedQFunctionGetSourcePath(qf, &source); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields, numelem;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  ierr = CeedOperatorGetNumElements(op, &numelem); CeedChk(ierr);
+  CeedOperatorField *opfields[2];
+  ierr = CeedOperatorGetFields(op, &opfields[0], &opfields[1]); CeedChk(ierr);
+  CeedQFunctionField *qffields[2];
+  ierr = CeedQFunctionGetFields(qf, &qffields[0], &qffields[1]); CeedChk(ierr);
+  CeedInt numfields[2] = {numinputfields, numoutputfields};
+
+  size_t len = (source ? strlen(source) : 0) +
+               64*(numinputfields + numoutputfields) + 32, pos;
+  ierr = CeedMalloc(len, key); CeedChk(ierr);
+  pos = snprintf(*key, len, "%s", source ? source : "-");
+  for (CeedInt j=0; j<2; j++)
+    for (CeedInt i=0; i<numfields[j]; i++) {
+      CeedEvalMode emode;
+      ierr = CeedQFunctionFieldGetEvalMode(qffields[j][i], &emode);
+      CeedChk(ierr);
+      CeedBasis basis;
+      ierr = CeedOperatorFieldGetBasis(opfields[j][i], &basis); CeedChk(ierr);
+      CeedInt dim = 0, ncomp = 0, P = 0, Q = 0;
+      if (basis != CEED_BASIS_COLLOCATED) {
+        bool istensor;
+        ierr = CeedBasisIsTensor(basis, &istensor); CeedChk(ierr);
+        ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+        ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
+        if (istensor) {
+          ierr = CeedBasisGetNumNodes1D(basis, &P); CeedChk(ierr);
+          ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q); CeedChk(ierr);
+        } else {
+          ierr = CeedBasisGetNumNodes(basis, &P); CeedChk(ierr);
+          ierr = CeedBasisGetNumQuadraturePoints(basis, &Q); CeedChk(ierr);
+        }
+      }
+      pos += snprintf(*key + pos, len - pos, "|%d,%d,%d,%d,%d", emode, dim,
+                      ncomp, P, Q);
+    }
+  CeedInt log2elem = 0;
+  while ((numelem >> (log2elem + 1)) > 0)
+    log2elem++;
+  snprintf(*key + pos, len - pos, "|2^%d", log2elem);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Select the candidate Ceed for an operator
+//
+// The decision table is consulted first; otherwise each candidate applies the
+//   operator once to warm up and then CEED_AUTO_NUM_TRIALS times into a scratch
+//   output, and the fastest trial wins. Operators with passive outputs cannot
+//   be applied without side effects, so they use the preferred candidate.
+//------------------------------------------------------------------------------
+static int CeedOperatorSelect_Auto(CeedOperator op, CeedVector in,
+                                   CeedVector out) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Auto *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  CeedOperator_Auto *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  // Decision table
+  char *key;
+  ierr = CeedOperatorGetKey_Auto(op, &key); CeedChk(ierr);
+  CeedInt choice = -1;
+  for (CeedInt i=0; i<data->numentries && choice < 0; i++)
+    if (!strcmp(data->keys[i], key))
+      choice = data->choices[i];
+
+  // Check for passive outputs
+  bool benchmark = choice < 0 && data->numcandidates > 1 &&
+                   out != CEED_VECTOR_NONE;
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+  for (CeedInt i=0; i<numoutputfields && benchmark; i++) {
+    CeedVector vec;
+    ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
+    benchmark = vec == CEED_VECTOR_ACTIVE;
+  }
+
+  if (benchmark) {
+    // Time candidates
+    CeedInt length;
+    ierr = CeedVectorGetLength(out, &length); CeedChk(ierr);
+    CeedVector scratch;
+    ierr = CeedVectorCreate(ceed, length, &scratch); CeedChk(ierr);
+    ierr = CeedVectorSetValue(scratch, 0.0); CeedChk(ierr);
+    CeedOperator *delegates;
+    ierr = CeedCalloc(data->numcandidates, &delegates); CeedChk(ierr);
+    double besttime = -1;
+    for (CeedInt i=0; i<data->numcandidates; i++) {
+      ierr = CeedOperatorCreateDelegate(op, data->candidates[i], &delegates[i]);
+      CeedChk(ierr);
+      ierr = CeedOperatorApplyAdd(delegates[i], in, scratch,
+                                  CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+      for (CeedInt k=0; k<CEED_AUTO_NUM_TRIALS; k++) {
+        double start = CeedAutoTime();
+        ierr = CeedOperatorApplyAdd(delegates[i], in, scratch,
+                                    CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+        double time = CeedAutoTime() - start;
+        if (besttime < 0 || time < besttime) {
+          besttime = time;
+          choice = i;
+        }
+      }
+    }
+    impl->delegate = delegates[choice];
+    for (CeedInt i=0; i<data->numcandidates; i++)
+      if (i != choice) {
+        ierr = CeedOperatorDestroyDelegate(&delegates[i]); CeedChk(ierr);
+      }
+    ierr = CeedFree(&delegates); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&scratch); CeedChk(ierr);
+    ierr = CeedAutoTableAdd(data, key, choice, true); CeedChk(ierr);
+  } else {
+    if (choice < 0)
+      choice = 0;
+    ierr = CeedOperatorCreateDelegate(op, data->candidates[choice],
+                                      &impl->delegate); CeedChk(ierr);
+  }
+  ierr = CeedFree(&key); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Apply and add to output
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Auto(CeedOperator op, CeedVector invec,
+                                     CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  CeedOperator_Auto *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  if (!impl->delegate) {
+    ierr = CeedOperatorSelect_Auto(op, invec, outvec); CeedChk(ierr);
+  }
+  ierr = CeedOperatorApplyAdd(impl->delegate, invec, outvec, request);
+  CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroy_Auto(CeedOperator op) {
+  int ierr;
+  CeedOperator_Auto *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  ierr = CeedOperatorDestroyDelegate(&impl->delegate); CeedChk(ierr);
+  ierr = CeedFree(&impl); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Create
+//------------------------------------------------------------------------------
+int CeedOperatorCreate_Auto(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Auto *impl;
+
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  ierr = CeedOperatorSetData(op, impl); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
+                                CeedOperatorApplyAdd_Auto); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
+                                CeedOperatorDestroy_Auto); CeedChk(ierr);
+
+  return 0;
+}
+//------------------------------------------------------------------------------
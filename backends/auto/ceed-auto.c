@@ -0,0 +1,181 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ceed-auto.h"
+
+// Candidate resources in order of preference, overridden by a comma separated
+//   list in CEED_AUTO_RESOURCES; candidates not built into the library are
+//   skipped
+static const char default_resources[] =
+  "/cpu/self/xsmm/blocked,/cpu/self/avx512/blocked,/cpu/self/avx/blocked,"
+  "/cpu/self/opt/blocked,/cpu/self/opt/serial";
+
+//------------------------------------------------------------------------------
+// Add an entry to the decision table, appending it to the table file
+//------------------------------------------------------------------------------
+int CeedAutoTableAdd(Ceed_Auto *data, const char *key, CeedInt choice,
+                     bool persist) {
+  int ierr;
+  CeedInt n = data->numentries;
+  size_t len = strlen(key);
+
+  ierr = CeedRealloc(n+1, &data->keys); CeedChk(ierr);
+  ierr = CeedRealloc(n+1, &data->choices); CeedChk(ierr);
+  ierr = CeedMalloc(len+1, &data->keys[n]); CeedChk(ierr);
+  memcpy(data->keys[n], key, len+1);
+  data->choices[n] = choice;
+  data->numentries++;
+
+  if (persist && data->tablepath) {
+    const char *resource;
+    ierr = CeedGetResource(data->candidates[choice], &resource); CeedChk(ierr);
+    FILE *file = fopen(data->tablepath, "a");
+    if (file) {
+      fprintf(file, "%s %s\n", resource, key);
+      fclose(file);
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Read the decision table file, if CEED_AUTO_TABLE is set
+//
+// Each line holds the resource of the selected candidate and the operator key,
+//   separated by a space. Entries naming unavailable candidates are ignored,
+//   so the file can be shared between builds.
+//------------------------------------------------------------------------------
+int CeedAutoTableRead(Ceed_Auto *data) {
+  int ierr;
+  const char *path = getenv("CEED_AUTO_TABLE");
+  data->tablepath = path && path[0] ? path : NULL;
+  if (!data->tablepath)
+    return 0;
+
+  FILE *file = fopen(data->tablepath, "r");
+  if (!file)
+    return 0;
+  char line[4096];
+  while (fgets(line, sizeof line, file)) {
+    char *end = strchr(line, '\n'), *key = strchr(line, ' ');
+    if (!end || !key)
+      continue;
+    *end = '\0';
+    *key++ = '\0';
+    for (CeedInt i=0; i<data->numcandidates; i++) {
+      const char *resource;
+      ierr = CeedGetResource(data->candidates[i], &resource); CeedChk(ierr);
+      if (!strcmp(resource, line)) {
+        ierr = CeedAutoTableAdd(data, key, i, false); CeedChk(ierr);
+        break;
+      }
+    }
+  }
+  fclose(file);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+static int CeedDestroy_Auto(Ceed ceed) {
+  int ierr;
+  Ceed_Auto *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  for (CeedInt i=0; i<data->numcandidates; i++) {
+    ierr = CeedDestroy(&data->candidates[i]); CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<data->numentries; i++) {
+    ierr = CeedFree(&data->keys[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&data->candidates); CeedChk(ierr);
+  ierr = CeedFree(&data->keys); CeedChk(ierr);
+  ierr = CeedFree(&data->choices); CeedChk(ierr);
+  ierr = CeedFree(&data); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Init
+//------------------------------------------------------------------------------
+static int CeedInit_Auto(const char *resource, Ceed ceed) {
+  int ierr;
+  if (strcmp(resource, "/cpu/self/auto"))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Auto backend cannot use resource: %s", resource);
+  // LCOV_EXCL_STOP
+  ierr = CeedSetDeterministic(ceed, true); CeedChk(ierr);
+
+  // Create reference CEED that implementation will be dispatched
+  //   through unless overridden
+  Ceed ceedref;
+  CeedInit("/cpu/self/ref/serial", &ceedref);
+  ierr = CeedSetDelegate(ceed, ceedref); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy",
+                                CeedDestroy_Auto); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate",
+                                CeedOperatorCreate_Auto); CeedChk(ierr);
+
+  // Candidate Ceeds
+  Ceed_Auto *data;
+  ierr = CeedCalloc(1, &data); CeedChk(ierr);
+  ierr = CeedSetData(ceed, data); CeedChk(ierr);
+  const char *resources = getenv("CEED_AUTO_RESOURCES");
+  if (!resources || !resources[0])
+    resources = default_resources;
+  size_t len = strlen(resources);
+  char *list;
+  ierr = CeedMalloc(len+1, &list); CeedChk(ierr);
+  memcpy(list, resources, len+1);
+  for (char *candidate = list, *next; candidate; candidate = next) {
+    next = strchr(candidate, ',');
+    if (next)
+      *next++ = '\0';
+    bool isregistered;
+    ierr = CeedIsRegistered(candidate, &isregistered); CeedChk(ierr);
+    if (!isregistered || !strcmp(candidate, resource))
+      continue;
+    ierr = CeedRealloc(data->numcandidates+1, &data->candidates); CeedChk(ierr);
+    ierr = CeedInit(candidate, &data->candidates[data->numcandidates]);
+    CeedChk(ierr);
+    data->numcandidates++;
+  }
+  ierr = CeedFree(&list); CeedChk(ierr);
+  if (!data->numcandidates)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Auto backend found no candidate in: %s",
+                     resources);
+  // LCOV_EXCL_STOP
+
+  // Decision table
+  ierr = CeedAutoTableRead(data); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Register
+//------------------------------------------------------------------------------
+__attribute__((constructor))
+static void Register(void) {
+  CeedRegister("/cpu/self/auto", CeedInit_Auto, 90);
+}
+//------------------------------------------------------------------------------
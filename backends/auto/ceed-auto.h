@@ -0,0 +1,41 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed-backend.h>
+#include <stdbool.h>
+
+// Number of timed applications of each candidate, after one warmup
+#define CEED_AUTO_NUM_TRIALS 3
+
+typedef struct {
+  CeedInt numcandidates;
+  Ceed *candidates;  /// Candidate Ceeds, in order of preference
+  CeedInt numentries;
+  char **keys;       /// Decision table operator keys
+  CeedInt *choices;  /// Decision table candidate indices
+  const char *tablepath; /// File the decision table is persisted to, or NULL
+} Ceed_Auto;
+
+typedef struct {
+  CeedOperator delegate; /// Operator on the selected candidate Ceed
+} CeedOperator_Auto;
+
+CEED_INTERN int CeedAutoTableRead(Ceed_Auto *data);
+
+CEED_INTERN int CeedAutoTableAdd(Ceed_Auto *data, const char *key,
+                                 CeedInt choice, bool persist);
+
+CEED_INTERN int CeedOperatorCreate_Auto(CeedOperator op);
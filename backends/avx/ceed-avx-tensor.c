@@ -16,11 +16,31 @@
 
 #include "ceed-avx.h"
 
+// Four-lane vector type and operations for CeedScalar
+#ifdef CEED_SINGLE_PRECISION
+#  define rtype __m128
+#  define loadu _mm_loadu_ps
+#  define storeu _mm_storeu_ps
+#  define set _mm_set_ps
+#  define set1 _mm_set1_ps
 // c += a * b
-#ifdef __FMA__
-#  define fmadd(c,a,b) (c) = _mm256_fmadd_pd((a), (b), (c))
+#  ifdef __FMA__
+#    define fmadd(c,a,b) (c) = _mm_fmadd_ps((a), (b), (c))
+#  else
+#    define fmadd(c,a,b) (c) += _mm_mul_ps((a), (b))
+#  endif
 #else
-#  define fmadd(c,a,b) (c) += _mm256_mul_pd((a), (b))
+#  define rtype __m256d
+#  define loadu _mm256_loadu_pd
+#  define storeu _mm256_storeu_pd
+#  define set _mm256_set_pd
+#  define set1 _mm256_set1_pd
+// c += a * b
+#  ifdef __FMA__
+#    define fmadd(c,a,b) (c) = _mm256_fmadd_pd((a), (b), (c))
+#  else
+#    define fmadd(c,a,b) (c) += _mm256_mul_pd((a), (b))
+#  endif
 #endif
 
 //------------------------------------------------------------------------------
@@ -39,42 +59,42 @@ static inline int CeedTensorContract_Avx_Blocked(CeedTensorContract contract,
     // Blocks of 4 rows
     for (CeedInt j=0; j<(J/JJ)*JJ; j+=JJ) {
       for (CeedInt c=0; c<(C/CC)*CC; c+=CC) {
-        __m256d vv[JJ][CC/4]; // Output tile to be held in registers
+        rtype vv[JJ][CC/4]; // Output tile to be held in registers
         for (CeedInt jj=0; jj<JJ; jj++)
           for (CeedInt cc=0; cc<CC/4; cc++)
-            vv[jj][cc] = _mm256_loadu_pd(&v[(a*J+j+jj)*C+c+cc*4]);
+            vv[jj][cc] = loadu(&v[(a*J+j+jj)*C+c+cc*4]);
 
         for (CeedInt b=0; b<B; b++) {
           for (CeedInt jj=0; jj<JJ; jj++) { // unroll
-            __m256d tqv = _mm256_set1_pd(t[(j+jj)*tstride0 + b*tstride1]);
+            rtype tqv = set1(t[(j+jj)*tstride0 + b*tstride1]);
             for (CeedInt cc=0; cc<CC/4; cc++) // unroll
-              fmadd(vv[jj][cc], tqv, _mm256_loadu_pd(&u[(a*B+b)*C+c+cc*4]));
+              fmadd(vv[jj][cc], tqv, loadu(&u[(a*B+b)*C+c+cc*4]));
           }
         }
         for (CeedInt jj=0; jj<JJ; jj++)
           for (CeedInt cc=0; cc<CC/4; cc++)
-            _mm256_storeu_pd(&v[(a*J+j+jj)*C+c+cc*4], vv[jj][cc]);
+            storeu(&v[(a*J+j+jj)*C+c+cc*4], vv[jj][cc]);
       }
     }
     // Remainder of rows
     CeedInt j=(J/JJ)*JJ;
     if (j < J) {
       for (CeedInt c=0; c<(C/CC)*CC; c+=CC) {
-        __m256d vv[JJ][CC/4]; // Output tile to be held in registers
+        rtype vv[JJ][CC/4]; // Output tile to be held in registers
         for (CeedInt jj=0; jj<J-j; jj++)
           for (CeedInt cc=0; cc<CC/4; cc++)
-            vv[jj][cc] = _mm256_loadu_pd(&v[(a*J+j+jj)*C+c+cc*4]);
+            vv[jj][cc] = loadu(&v[(a*J+j+jj)*C+c+cc*4]);
 
         for (CeedInt b=0; b<B; b++) {
           for (CeedInt jj=0; jj<J-j; jj++) { // doesn't unroll
-            __m256d tqv = _mm256_set1_pd(t[(j+jj)*tstride0 + b*tstride1]);
+            rtype tqv = set1(t[(j+jj)*tstride0 + b*tstride1]);
             for (CeedInt cc=0; cc<CC/4; cc++) // unroll
-              fmadd(vv[jj][cc], tqv, _mm256_loadu_pd(&u[(a*B+b)*C+c+cc*4]));
+              fmadd(vv[jj][cc], tqv, loadu(&u[(a*B+b)*C+c+cc*4]));
           }
         }
         for (CeedInt jj=0; jj<J-j; jj++)
           for (CeedInt cc=0; cc<CC/4; cc++)
-            _mm256_storeu_pd(&v[(a*J+j+jj)*C+c+cc*4], vv[jj][cc]);
+            storeu(&v[(a*J+j+jj)*C+c+cc*4], vv[jj][cc]);
       }
     }
   }
@@ -99,27 +119,27 @@ static inline int CeedTensorContract_Avx_Remainder(CeedTensorContract contract,
     for (CeedInt c = (C/CC)*CC; c<C; c+=4) {
       // Blocks of 4 rows
       for (CeedInt j=0; j<Jbreak; j+=JJ) {
-        __m256d vv[JJ]; // Output tile to be held in registers
+        rtype vv[JJ]; // Output tile to be held in registers
         for (CeedInt jj=0; jj<JJ; jj++)
-          vv[jj] = _mm256_loadu_pd(&v[(a*J+j+jj)*C+c]);
+          vv[jj] = loadu(&v[(a*J+j+jj)*C+c]);
 
         for (CeedInt b=0; b<B; b++) {
-          __m256d tqu;
+          rtype tqu;
           if (C-c == 1)
-            tqu = _mm256_set_pd(0.0, 0.0, 0.0, u[(a*B+b)*C+c+0]);
+            tqu = set(0.0, 0.0, 0.0, u[(a*B+b)*C+c+0]);
           else if (C-c == 2)
-            tqu = _mm256_set_pd(0.0, 0.0, u[(a*B+b)*C+c+1],
-                                u[(a*B+b)*C+c+0]);
+            tqu = set(0.0, 0.0, u[(a*B+b)*C+c+1],
+                      u[(a*B+b)*C+c+0]);
           else if (C-c == 3)
-            tqu = _mm256_set_pd(0.0, u[(a*B+b)*C+c+2], u[(a*B+b)*C+c+1],
-                                u[(a*B+b)*C+c+0]);
+            tqu = set(0.0, u[(a*B+b)*C+c+2], u[(a*B+b)*C+c+1],
+                      u[(a*B+b)*C+c+0]);
           else
-            tqu = _mm256_loadu_pd(&u[(a*B+b)*C+c]);
+            tqu = loadu(&u[(a*B+b)*C+c]);
           for (CeedInt jj=0; jj<JJ; jj++) // unroll
-            fmadd(vv[jj], tqu, _mm256_set1_pd(t[(j+jj)*tstride0 + b*tstride1]));
+            fmadd(vv[jj], tqu, set1(t[(j+jj)*tstride0 + b*tstride1]));
         }
         for (CeedInt jj=0; jj<JJ; jj++)
-          _mm256_storeu_pd(&v[(a*J+j+jj)*C+c], vv[jj]);
+          storeu(&v[(a*J+j+jj)*C+c], vv[jj]);
       }
     }
     // Remainder of rows, all columns
@@ -148,47 +168,47 @@ static inline int CeedTensorContract_Avx_Single(CeedTensorContract contract,
   // Blocks of 4 rows
   for (CeedInt a=0; a<(A/AA)*AA; a+=AA) {
     for (CeedInt j=0; j<(J/JJ)*JJ; j+=JJ) {
-      __m256d vv[AA][JJ/4]; // Output tile to be held in registers
+      rtype vv[AA][JJ/4]; // Output tile to be held in registers
       for (CeedInt aa=0; aa<AA; aa++)
         for (CeedInt jj=0; jj<JJ/4; jj++)
-          vv[aa][jj] = _mm256_loadu_pd(&v[(a+aa)*J+j+jj*4]);
+          vv[aa][jj] = loadu(&v[(a+aa)*J+j+jj*4]);
 
       for (CeedInt b=0; b<B; b++) {
         for (CeedInt jj=0; jj<JJ/4; jj++) { // unroll
-          __m256d tqv = _mm256_set_pd(t[(j+jj*4+3)*tstride0 + b*tstride1],
-                                      t[(j+jj*4+2)*tstride0 + b*tstride1],
-                                      t[(j+jj*4+1)*tstride0 + b*tstride1],
-                                      t[(j+jj*4+0)*tstride0 + b*tstride1]);
+          rtype tqv = set(t[(j+jj*4+3)*tstride0 + b*tstride1],
+                            t[(j+jj*4+2)*tstride0 + b*tstride1],
+                            t[(j+jj*4+1)*tstride0 + b*tstride1],
+                            t[(j+jj*4+0)*tstride0 + b*tstride1]);
           for (CeedInt aa=0; aa<AA; aa++) // unroll
-            fmadd(vv[aa][jj], tqv, _mm256_set1_pd(u[(a+aa)*B+b]));
+            fmadd(vv[aa][jj], tqv, set1(u[(a+aa)*B+b]));
         }
       }
       for (CeedInt aa=0; aa<AA; aa++)
         for (CeedInt jj=0; jj<JJ/4; jj++)
-          _mm256_storeu_pd(&v[(a+aa)*J+j+jj*4], vv[aa][jj]);
+          storeu(&v[(a+aa)*J+j+jj*4], vv[aa][jj]);
     }
   }
   // Remainder of rows
   CeedInt a=(A/AA)*AA;
   for (CeedInt j=0; j<(J/JJ)*JJ; j+=JJ) {
-    __m256d vv[AA][JJ/4]; // Output tile to be held in registers
+    rtype vv[AA][JJ/4]; // Output tile to be held in registers
     for (CeedInt aa=0; aa<A-a; aa++)
       for (CeedInt jj=0; jj<JJ/4; jj++)
-        vv[aa][jj] = _mm256_loadu_pd(&v[(a+aa)*J+j+jj*4]);
+        vv[aa][jj] = loadu(&v[(a+aa)*J+j+jj*4]);
 
     for (CeedInt b=0; b<B; b++) {
       for (CeedInt jj=0; jj<JJ/4; jj++) { // unroll
-        __m256d tqv = _mm256_set_pd(t[(j+jj*4+3)*tstride0 + b*tstride1],
-                                    t[(j+jj*4+2)*tstride0 + b*tstride1],
-                                    t[(j+jj*4+1)*tstride0 + b*tstride1],
-                                    t[(j+jj*4+0)*tstride0 + b*tstride1]);
+        rtype tqv = set(t[(j+jj*4+3)*tstride0 + b*tstride1],
+                          t[(j+jj*4+2)*tstride0 + b*tstride1],
+                          t[(j+jj*4+1)*tstride0 + b*tstride1],
+                          t[(j+jj*4+0)*tstride0 + b*tstride1]);
         for (CeedInt aa=0; aa<A-a; aa++) // unroll
-          fmadd(vv[aa][jj], tqv, _mm256_set1_pd(u[(a+aa)*B+b]));
+          fmadd(vv[aa][jj], tqv, set1(u[(a+aa)*B+b]));
       }
     }
     for (CeedInt aa=0; aa<A-a; aa++)
       for (CeedInt jj=0; jj<JJ/4; jj++)
-        _mm256_storeu_pd(&v[(a+aa)*J+j+jj*4], vv[aa][jj]);
+        storeu(&v[(a+aa)*J+j+jj*4], vv[aa][jj]);
   }
   // Column remainder
   CeedInt Abreak = A%AA ? (A/AA)*AA : (A/AA-1)*AA;
@@ -196,31 +216,31 @@ static inline int CeedTensorContract_Avx_Single(CeedTensorContract contract,
   for (CeedInt j = (J/JJ)*JJ; j<J; j+=4) {
     // Blocks of 4 rows
     for (CeedInt a=0; a<Abreak; a+=AA) {
-      __m256d vv[AA]; // Output tile to be held in registers
+      rtype vv[AA]; // Output tile to be held in registers
       for (CeedInt aa=0; aa<AA; aa++)
-        vv[aa] = _mm256_loadu_pd(&v[(a+aa)*J+j]);
+        vv[aa] = loadu(&v[(a+aa)*J+j]);
 
       for (CeedInt b=0; b<B; b++) {
-        __m256d tqv;
+        rtype tqv;
         if (J-j == 1)
-          tqv = _mm256_set_pd(0.0, 0.0, 0.0, t[(j+0)*tstride0 + b*tstride1]);
+          tqv = set(0.0, 0.0, 0.0, t[(j+0)*tstride0 + b*tstride1]);
         else if (J-j == 2)
-          tqv = _mm256_set_pd(0.0, 0.0, t[(j+1)*tstride0 + b*tstride1],
-                              t[(j+0)*tstride0 + b*tstride1]);
+          tqv = set(0.0, 0.0, t[(j+1)*tstride0 + b*tstride1],
+                    t[(j+0)*tstride0 + b*tstride1]);
         else if (J-3 == j)
-          tqv = _mm256_set_pd(0.0, t[(j+2)*tstride0 + b*tstride1],
-                              t[(j+1)*tstride0 + b*tstride1],
-                              t[(j+0)*tstride0 + b*tstride1]);
+          tqv = set(0.0, t[(j+2)*tstride0 + b*tstride1],
+                    t[(j+1)*tstride0 + b*tstride1],
+                    t[(j+0)*tstride0 + b*tstride1]);
         else
-          tqv = _mm256_set_pd(t[(j+3)*tstride0 + b*tstride1],
-                              t[(j+2)*tstride0 + b*tstride1],
-                              t[(j+1)*tstride0 + b*tstride1],
-                              t[(j+0)*tstride0 + b*tstride1]);
+          tqv = set(t[(j+3)*tstride0 + b*tstride1],
+                    t[(j+2)*tstride0 + b*tstride1],
+                    t[(j+1)*tstride0 + b*tstride1],
+                    t[(j+0)*tstride0 + b*tstride1]);
         for (CeedInt aa=0; aa<AA; aa++) // unroll
-          fmadd(vv[aa], tqv, _mm256_set1_pd(u[(a+aa)*B+b]));
+          fmadd(vv[aa], tqv, set1(u[(a+aa)*B+b]));
       }
       for (CeedInt aa=0; aa<AA; aa++)
-        _mm256_storeu_pd(&v[(a+aa)*J+j], vv[aa]);
+        storeu(&v[(a+aa)*J+j], vv[aa]);
     }
   }
   // Remainder of rows, all columns
@@ -260,15 +280,12 @@ static int CeedTensorContract_Avx_Single_4_8(CeedTensorContract contract,
 }
 
 //------------------------------------------------------------------------------
-// Tensor Contract Apply
+// Tensor Contract Apply Core
 //------------------------------------------------------------------------------
-static int CeedTensorContractApply_Avx(CeedTensorContract contract, CeedInt A,
-                                       CeedInt B, CeedInt C, CeedInt J,
-                                       const CeedScalar *restrict t,
-                                       CeedTransposeMode tmode,
-                                       const CeedInt Add,
-                                       const CeedScalar *restrict u,
-                                       CeedScalar *restrict v) {
+static inline int CeedTensorContractApply_Avx_Core(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
   const CeedInt blksize = 8;
 
   if (!Add)
@@ -293,6 +310,158 @@ static int CeedTensorContractApply_Avx(CeedTensorContract contract, CeedInt A,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Tensor Contract Apply - Fixed Sizes
+//   Kernels with compile-time B and J for B, J <= CEED_AVX_FIXED_MAX, so the
+//   loops over the basis dimensions are fully unrolled
+//------------------------------------------------------------------------------
+#define CEED_AVX_FIXED_MAX 10
+
+static inline int CeedTensorContract_Avx_Blocked_Fixed(
+  CeedTensorContract contract, CeedInt A, const CeedInt B, CeedInt C,
+  const CeedInt J, const CeedScalar *restrict t, CeedTransposeMode tmode,
+  const CeedScalar *restrict u, CeedScalar *restrict v) {
+  const CeedInt tstride0 = tmode == CEED_TRANSPOSE ? 1 : B;
+  const CeedInt tstride1 = tmode == CEED_TRANSPOSE ? J : 1;
+
+  for (CeedInt a=0; a<A; a++)
+    for (CeedInt c=0; c<(C/4)*4; c+=4) {
+      rtype vv[J]; // Output column held in registers
+      for (CeedInt j=0; j<J; j++)
+        vv[j] = loadu(&v[(a*J+j)*C+c]);
+      for (CeedInt b=0; b<B; b++) {
+        rtype uu = loadu(&u[(a*B+b)*C+c]);
+        for (CeedInt j=0; j<J; j++)
+          fmadd(vv[j], set1(t[j*tstride0 + b*tstride1]), uu);
+      }
+      for (CeedInt j=0; j<J; j++)
+        storeu(&v[(a*J+j)*C+c], vv[j]);
+    }
+  // Remainder of columns
+  if (C % 4)
+    for (CeedInt a=0; a<A; a++)
+      for (CeedInt j=0; j<J; j++)
+        for (CeedInt b=0; b<B; b++) {
+          const CeedScalar tq = t[j*tstride0 + b*tstride1];
+          for (CeedInt c=(C/4)*4; c<C; c++)
+            v[(a*J+j)*C+c] += tq * u[(a*B+b)*C+c];
+        }
+  return 0;
+}
+
+static inline int CeedTensorContract_Avx_Single_Fixed(
+  CeedTensorContract contract, CeedInt A, const CeedInt B, const CeedInt J,
+  const CeedScalar *restrict t, CeedTransposeMode tmode,
+  const CeedScalar *restrict u, CeedScalar *restrict v) {
+  const CeedInt tstride0 = tmode == CEED_TRANSPOSE ? 1 : B;
+  const CeedInt tstride1 = tmode == CEED_TRANSPOSE ? J : 1;
+
+  for (CeedInt a=0; a<A; a++)
+    for (CeedInt j=0; j<J; j++) {
+      CeedScalar vv = v[a*J+j];
+      for (CeedInt b=0; b<B; b++)
+        vv += t[j*tstride0 + b*tstride1] * u[a*B+b];
+      v[a*J+j] = vv;
+    }
+  return 0;
+}
+
+#define CEED_AVX_FIXED(B, J)                                                   \
+static int CeedTensorContractApply_Avx_##B##_##J(CeedTensorContract contract,  \
+    CeedInt A, CeedInt b, CeedInt C, CeedInt j, const CeedScalar *restrict t,  \
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,  \
+    CeedScalar *restrict v) {                                                  \
+  if (!Add)                                                                    \
+    for (CeedInt q=0; q<A*J*C; q++)                                            \
+      v[q] = (CeedScalar) 0.0;                                                 \
+  if (C == 1)                                                                  \
+    return CeedTensorContract_Avx_Single_Fixed(contract, A, B, J, t, tmode,    \
+           u, v);                                                              \
+  return CeedTensorContract_Avx_Blocked_Fixed(contract, A, B, C, J, t, tmode,  \
+         u, v);                                                                \
+}
+#define CEED_AVX_FIXED_J(B)                                                    \
+  CEED_AVX_FIXED(B, 1) CEED_AVX_FIXED(B, 2) CEED_AVX_FIXED(B, 3)               \
+  CEED_AVX_FIXED(B, 4) CEED_AVX_FIXED(B, 5) CEED_AVX_FIXED(B, 6)               \
+  CEED_AVX_FIXED(B, 7) CEED_AVX_FIXED(B, 8) CEED_AVX_FIXED(B, 9)               \
+  CEED_AVX_FIXED(B, 10)
+CEED_AVX_FIXED_J(1) CEED_AVX_FIXED_J(2) CEED_AVX_FIXED_J(3)
+CEED_AVX_FIXED_J(4) CEED_AVX_FIXED_J(5) CEED_AVX_FIXED_J(6)
+CEED_AVX_FIXED_J(7) CEED_AVX_FIXED_J(8) CEED_AVX_FIXED_J(9)
+CEED_AVX_FIXED_J(10)
+
+typedef int (*CeedTensorContractApply_Avx_Kernel)(CeedTensorContract,
+    CeedInt, CeedInt, CeedInt, CeedInt, const CeedScalar *restrict,
+    CeedTransposeMode, const CeedInt, const CeedScalar *restrict,
+    CeedScalar *restrict);
+
+#define CEED_AVX_FIXED_ENTRY(B, J) CeedTensorContractApply_Avx_##B##_##J
+#define CEED_AVX_FIXED_ROW(B)                                                  \
+  { CEED_AVX_FIXED_ENTRY(B, 1), CEED_AVX_FIXED_ENTRY(B, 2),                    \
+    CEED_AVX_FIXED_ENTRY(B, 3), CEED_AVX_FIXED_ENTRY(B, 4),                    \
+    CEED_AVX_FIXED_ENTRY(B, 5), CEED_AVX_FIXED_ENTRY(B, 6),                    \
+    CEED_AVX_FIXED_ENTRY(B, 7), CEED_AVX_FIXED_ENTRY(B, 8),                    \
+    CEED_AVX_FIXED_ENTRY(B, 9), CEED_AVX_FIXED_ENTRY(B, 10) }
+static const CeedTensorContractApply_Avx_Kernel
+CeedTensorContractApply_Avx_Fixed[CEED_AVX_FIXED_MAX][CEED_AVX_FIXED_MAX] = {
+  CEED_AVX_FIXED_ROW(1), CEED_AVX_FIXED_ROW(2), CEED_AVX_FIXED_ROW(3),
+  CEED_AVX_FIXED_ROW(4), CEED_AVX_FIXED_ROW(5), CEED_AVX_FIXED_ROW(6),
+  CEED_AVX_FIXED_ROW(7), CEED_AVX_FIXED_ROW(8), CEED_AVX_FIXED_ROW(9),
+  CEED_AVX_FIXED_ROW(10)
+};
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply
+//------------------------------------------------------------------------------
+static int CeedTensorContractApply_Avx(CeedTensorContract contract, CeedInt A,
+                                       CeedInt B, CeedInt C, CeedInt J,
+                                       const CeedScalar *restrict t,
+                                       CeedTransposeMode tmode,
+                                       const CeedInt Add,
+                                       const CeedScalar *restrict u,
+                                       CeedScalar *restrict v) {
+  // Fixed size kernel, if available
+  if (B <= CEED_AVX_FIXED_MAX && J <= CEED_AVX_FIXED_MAX)
+    return CeedTensorContractApply_Avx_Fixed[B-1][J-1](contract, A, B, C, J, t,
+           tmode, Add, u, v);
+
+  // Generic kernel
+  return CeedTensorContractApply_Avx_Core(contract, A, B, C, J, t, tmode, Add,
+                                          u, v);
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply Full
+//   All dimensions of one component at a time, so the intermediate values stay
+//   in cache, calling the contraction kernel directly
+//------------------------------------------------------------------------------
+static int CeedTensorContractApplyFull_Avx(CeedTensorContract contract,
+    CeedInt dim, CeedInt ncomp, CeedInt P, CeedInt Q, CeedInt nelem,
+    const CeedScalar *const *t, CeedTransposeMode tmode, const CeedInt Add,
+    const CeedScalar *restrict u, CeedScalar *restrict v) {
+  // Kernel chosen once for all contractions, which share B = P and J = Q
+  const CeedTensorContractApply_Avx_Kernel kernel =
+    P <= CEED_AVX_FIXED_MAX && Q <= CEED_AVX_FIXED_MAX ?
+    CeedTensorContractApply_Avx_Fixed[P-1][Q-1] :
+    CeedTensorContractApply_Avx_Core;
+  const CeedInt usize = CeedIntPow(P, dim)*nelem;
+  const CeedInt vsize = CeedIntPow(Q, dim)*nelem;
+  CeedScalar tmp[2][CeedPadLength(nelem*Q*CeedIntPow(P>Q?P:Q, dim-1))]
+  CEED_ALIGNED;
+
+  for (CeedInt c=0; c<ncomp; c++) {
+    CeedInt pre = CeedIntPow(P, dim-1), post = nelem;
+    for (CeedInt d=0; d<dim; d++) {
+      kernel(contract, pre, P, post, Q, t[d], tmode, Add&&(d==dim-1),
+             d==0 ? &u[c*usize] : tmp[d%2],
+             d==dim-1 ? &v[c*vsize] : tmp[(d+1)%2]);
+      pre /= P;
+      post *= Q;
+    }
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Destroy
 //------------------------------------------------------------------------------
@@ -310,6 +479,8 @@ int CeedTensorContractCreate_Avx(CeedBasis basis, CeedTensorContract contract) {
 
   ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
                                 CeedTensorContractApply_Avx); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "ApplyFull",
+                                CeedTensorContractApplyFull_Avx); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Destroy",
                                 CeedTensorContractDestroy_Avx); CeedChk(ierr);
 
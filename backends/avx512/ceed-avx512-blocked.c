@@ -0,0 +1,54 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include "ceed-avx512.h"
+
+//------------------------------------------------------------------------------
+// Backend Init
+//------------------------------------------------------------------------------
+static int CeedInit_Avx512(const char *resource, Ceed ceed) {
+  int ierr;
+  if (strcmp(resource, "/cpu/self") && strcmp(resource, "/cpu/self/avx512")
+      && strcmp(resource, "/cpu/self/avx512/blocked"))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "AVX-512 backend cannot use resource: %s",
+                     resource);
+  // LCOV_EXCL_STOP
+  ierr = CeedSetDeterministic(ceed, true); CeedChk(ierr);
+
+  // Create reference CEED that implementation will be dispatched
+  //   through unless overridden
+  Ceed ceedref;
+  CeedInit("/cpu/self/opt/blocked", &ceedref);
+  ierr = CeedSetDelegate(ceed, ceedref); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate",
+                                CeedTensorContractCreate_Avx512); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Register
+//   Only registered when the CPU supports AVX-512, so "/cpu/self" falls back
+//   to the AVX backends on older CPUs
+//------------------------------------------------------------------------------
+__attribute__((constructor))
+static void Register(void) {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+    CeedRegister("/cpu/self/avx512/blocked", CeedInit_Avx512, 27);
+}
+//------------------------------------------------------------------------------
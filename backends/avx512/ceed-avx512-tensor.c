@@ -0,0 +1,390 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include "ceed-avx512.h"
+
+// Eight-lane (sixteen-lane for single precision) vector type and operations
+//   for CeedScalar; masked loads and stores handle partial vectors
+#ifdef CEED_SINGLE_PRECISION
+#  define rtype __m512
+#  define mtype __mmask16
+#  define itype __m512i
+#  define VLEN 16
+#  define maskz_loadu(m,p) _mm512_maskz_loadu_ps((m), (p))
+#  define mask_storeu(p,m,a) _mm512_mask_storeu_ps((p), (m), (a))
+#  define setzero _mm512_setzero_ps
+#  define set1 _mm512_set1_ps
+#  define loadu _mm512_loadu_ps
+#  define loadidx(p) _mm512_loadu_si512((const void *)(p))
+#  define mask_gather(m,i,p) _mm512_mask_i32gather_ps(setzero(), (m), (i), \
+                                                      (p), sizeof(float))
+// c += a * b
+#  define fmadd(c,a,b) (c) = _mm512_fmadd_ps((a), (b), (c))
+#else
+#  define rtype __m512d
+#  define mtype __mmask8
+#  define itype __m256i
+#  define VLEN 8
+#  define maskz_loadu(m,p) _mm512_maskz_loadu_pd((m), (p))
+#  define mask_storeu(p,m,a) _mm512_mask_storeu_pd((p), (m), (a))
+#  define setzero _mm512_setzero_pd
+#  define set1 _mm512_set1_pd
+#  define loadu _mm512_loadu_pd
+#  define loadidx(p) _mm256_loadu_si256((const __m256i *)(p))
+#  define mask_gather(m,i,p) _mm512_mask_i32gather_pd(setzero(), (m), (i), \
+                                                      (p), sizeof(double))
+// c += a * b
+#  define fmadd(c,a,b) (c) = _mm512_fmadd_pd((a), (b), (c))
+#endif
+
+//------------------------------------------------------------------------------
+// Mask for the first n lanes of a vector
+//------------------------------------------------------------------------------
+static inline mtype CeedMask_Avx512(CeedInt n) {
+  if (n <= 0)
+    return (mtype) 0;
+  return n >= VLEN ? (mtype) -1 : (mtype) ((1u << n) - 1);
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Tile
+//   Accumulates a JJ row by CC vector tile of v in registers, with the last
+//   vector masked; when Add is false the tile starts from zero, so v is never
+//   cleared separately
+//------------------------------------------------------------------------------
+static inline void CeedTensorContract_Avx512_Tile(const CeedInt B,
+    const CeedInt C, const CeedScalar *restrict t, const CeedInt tstride0,
+    const CeedInt tstride1, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v, const CeedInt JJ, const CeedInt CC,
+    const mtype lastmask) {
+  mtype mask[CC];
+  for (CeedInt cc=0; cc<CC; cc++)
+    mask[cc] = cc == CC-1 ? lastmask : CeedMask_Avx512(VLEN);
+
+  rtype vv[JJ][CC]; // Output tile to be held in registers
+  for (CeedInt jj=0; jj<JJ; jj++)
+    for (CeedInt cc=0; cc<CC; cc++)
+      vv[jj][cc] = Add ? maskz_loadu(mask[cc], &v[jj*C+cc*VLEN]) : setzero();
+
+  for (CeedInt b=0; b<B; b++) {
+    rtype uu[CC];
+    for (CeedInt cc=0; cc<CC; cc++) // unroll
+      uu[cc] = maskz_loadu(mask[cc], &u[b*C+cc*VLEN]);
+    for (CeedInt jj=0; jj<JJ; jj++) { // unroll
+      const rtype tqv = set1(t[jj*tstride0 + b*tstride1]);
+      for (CeedInt cc=0; cc<CC; cc++) // unroll
+        fmadd(vv[jj][cc], tqv, uu[cc]);
+    }
+  }
+  for (CeedInt jj=0; jj<JJ; jj++)
+    for (CeedInt cc=0; cc<CC; cc++)
+      mask_storeu(&v[jj*C+cc*VLEN], mask[cc], vv[jj][cc]);
+}
+
+//------------------------------------------------------------------------------
+// Blocked Tensor Contract
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Avx512_Blocked(
+  CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+  const CeedScalar *restrict t, CeedTransposeMode tmode, const CeedInt Add,
+  const CeedScalar *restrict u, CeedScalar *restrict v, const CeedInt JJ,
+  const CeedInt CC) {
+  CeedInt tstride0 = B, tstride1 = 1;
+  if (tmode == CEED_TRANSPOSE) {
+    tstride0 = 1; tstride1 = J;
+  }
+  const CeedInt Jbreak = (J/JJ)*JJ, Cbreak = (C/(CC*VLEN))*CC*VLEN;
+  const mtype full = CeedMask_Avx512(VLEN);
+
+  for (CeedInt a=0; a<A; a++) {
+    const CeedScalar *ua = &u[a*B*C];
+    CeedScalar *va = &v[a*J*C];
+    // Blocks of JJ rows
+    for (CeedInt j=0; j<Jbreak; j+=JJ) {
+      for (CeedInt c=0; c<Cbreak; c+=CC*VLEN)
+        CeedTensorContract_Avx512_Tile(B, C, &t[j*tstride0], tstride0,
+                                       tstride1, Add, &ua[c], &va[j*C+c], JJ,
+                                       CC, full);
+      // Remainder of columns, masked
+      for (CeedInt c=Cbreak; c<C; c+=VLEN)
+        CeedTensorContract_Avx512_Tile(B, C, &t[j*tstride0], tstride0,
+                                       tstride1, Add, &ua[c], &va[j*C+c], JJ,
+                                       1, CeedMask_Avx512(C-c));
+    }
+    // Remainder of rows
+    if (Jbreak < J) {
+      for (CeedInt c=0; c<Cbreak; c+=CC*VLEN)
+        CeedTensorContract_Avx512_Tile(B, C, &t[Jbreak*tstride0], tstride0,
+                                       tstride1, Add, &ua[c], &va[Jbreak*C+c],
+                                       J-Jbreak, CC, full);
+      for (CeedInt c=Cbreak; c<C; c+=VLEN)
+        CeedTensorContract_Avx512_Tile(B, C, &t[Jbreak*tstride0], tstride0,
+                                       tstride1, Add, &ua[c], &va[Jbreak*C+c],
+                                       J-Jbreak, 1, CeedMask_Avx512(C-c));
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Serial Tensor Contract C=1
+//   Vectorized over rows of t, gathered when they are strided in memory
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Avx512_Single(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v, const CeedInt AA) {
+  CeedInt tstride0 = B, tstride1 = 1;
+  if (tmode == CEED_TRANSPOSE) {
+    tstride0 = 1; tstride1 = J;
+  }
+  int idx[VLEN];
+  for (CeedInt l=0; l<VLEN; l++)
+    idx[l] = l*tstride0;
+  const itype vidx = loadidx(idx);
+
+  for (CeedInt j=0; j<J; j+=VLEN) {
+    const mtype mask = CeedMask_Avx512(J-j);
+    for (CeedInt a=0; a<A; a+=AA) {
+      const CeedInt AAA = A-a < AA ? A-a : AA;
+      rtype vv[AA]; // Output tile to be held in registers
+      for (CeedInt aa=0; aa<AAA; aa++)
+        vv[aa] = Add ? maskz_loadu(mask, &v[(a+aa)*J+j]) : setzero();
+
+      for (CeedInt b=0; b<B; b++) {
+        const CeedScalar *tb = &t[j*tstride0 + b*tstride1];
+        const rtype tqv = tstride0 == 1 ? maskz_loadu(mask, tb) :
+                          mask_gather(mask, vidx, tb);
+        for (CeedInt aa=0; aa<AAA; aa++)
+          fmadd(vv[aa], tqv, set1(u[(a+aa)*B+b]));
+      }
+      for (CeedInt aa=0; aa<AAA; aa++)
+        mask_storeu(&v[(a+aa)*J+j], mask, vv[aa]);
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract - Common Sizes
+//   8 rows by 3 vectors uses 24 of the 32 zmm registers for accumulators
+//------------------------------------------------------------------------------
+static int CeedTensorContract_Avx512_Blocked_8_3(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  return CeedTensorContract_Avx512_Blocked(contract, A, B, C, J, t, tmode, Add,
+         u, v, 8, 3);
+}
+static int CeedTensorContract_Avx512_Single_8(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  return CeedTensorContract_Avx512_Single(contract, A, B, C, J, t, tmode, Add,
+                                          u, v, 8);
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply - Fixed Sizes
+//   Kernels with compile-time B and J for B, J <= CEED_AVX512_FIXED_MAX, so the
+//   loops over the basis dimensions are fully unrolled
+//------------------------------------------------------------------------------
+#define CEED_AVX512_FIXED_MAX 10
+
+static inline int CeedTensorContract_Avx512_Blocked_Fixed(
+  CeedTensorContract contract, CeedInt A, const CeedInt B, CeedInt C,
+  const CeedInt J, const CeedScalar *restrict t, CeedTransposeMode tmode,
+  const CeedInt Add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  const CeedInt tstride0 = tmode == CEED_TRANSPOSE ? 1 : B;
+  const CeedInt tstride1 = tmode == CEED_TRANSPOSE ? J : 1;
+
+  for (CeedInt a=0; a<A; a++) {
+    CeedInt c = 0;
+    // Pairs of vectors, the second one masked at the end of the row
+    for (; c+VLEN<C; c+=2*VLEN)
+      CeedTensorContract_Avx512_Tile(B, C, t, tstride0, tstride1, Add,
+                                     &u[a*B*C+c], &v[a*J*C+c], J, 2,
+                                     CeedMask_Avx512(C-c-VLEN));
+    // Remaining single vector, masked
+    if (c < C)
+      CeedTensorContract_Avx512_Tile(B, C, t, tstride0, tstride1, Add,
+                                     &u[a*B*C+c], &v[a*J*C+c], J, 1,
+                                     CeedMask_Avx512(C-c));
+  }
+  return 0;
+}
+
+static inline int CeedTensorContract_Avx512_Single_Fixed(
+  CeedTensorContract contract, CeedInt A, const CeedInt B, const CeedInt J,
+  const CeedScalar *restrict t, CeedTransposeMode tmode, const CeedInt Add,
+  const CeedScalar *restrict u, CeedScalar *restrict v) {
+  const CeedInt tstride0 = tmode == CEED_TRANSPOSE ? 1 : B;
+  const CeedInt tstride1 = tmode == CEED_TRANSPOSE ? J : 1;
+  const CeedInt JV = (J+VLEN-1)/VLEN, AA = 4;
+
+  // Columns of t held in registers for the whole contraction
+  rtype tqv[B][JV];
+  for (CeedInt b=0; b<B; b++) {
+    CeedScalar tb[JV*VLEN];
+    for (CeedInt j=0; j<JV*VLEN; j++)
+      tb[j] = j < J ? t[j*tstride0 + b*tstride1] : 0.0;
+    for (CeedInt jv=0; jv<JV; jv++)
+      tqv[b][jv] = loadu(&tb[jv*VLEN]);
+  }
+  mtype mask[JV];
+  for (CeedInt jv=0; jv<JV; jv++)
+    mask[jv] = CeedMask_Avx512(J-jv*VLEN);
+
+  for (CeedInt a=0; a<A; a+=AA) {
+    const CeedInt AAA = A-a < AA ? A-a : AA;
+    rtype vv[AA][JV]; // Output tile to be held in registers
+    for (CeedInt aa=0; aa<AAA; aa++)
+      for (CeedInt jv=0; jv<JV; jv++)
+        vv[aa][jv] = Add ? maskz_loadu(mask[jv], &v[(a+aa)*J+jv*VLEN]) :
+                     setzero();
+    for (CeedInt b=0; b<B; b++)
+      for (CeedInt aa=0; aa<AAA; aa++) {
+        const rtype uq = set1(u[(a+aa)*B+b]);
+        for (CeedInt jv=0; jv<JV; jv++)
+          fmadd(vv[aa][jv], tqv[b][jv], uq);
+      }
+    for (CeedInt aa=0; aa<AAA; aa++)
+      for (CeedInt jv=0; jv<JV; jv++)
+        mask_storeu(&v[(a+aa)*J+jv*VLEN], mask[jv], vv[aa][jv]);
+  }
+  return 0;
+}
+
+#define CEED_AVX512_FIXED(B, J)                                                \
+static int CeedTensorContractApply_Avx512_##B##_##J(                           \
+    CeedTensorContract contract, CeedInt A, CeedInt b, CeedInt C, CeedInt j,   \
+    const CeedScalar *restrict t, CeedTransposeMode tmode, const CeedInt Add,  \
+    const CeedScalar *restrict u, CeedScalar *restrict v) {                    \
+  if (C == 1)                                                                  \
+    return CeedTensorContract_Avx512_Single_Fixed(contract, A, B, J, t, tmode, \
+           Add, u, v);                                                         \
+  return CeedTensorContract_Avx512_Blocked_Fixed(contract, A, B, C, J, t,      \
+         tmode, Add, u, v);                                                    \
+}
+#define CEED_AVX512_FIXED_J(B)                                                 \
+  CEED_AVX512_FIXED(B, 1) CEED_AVX512_FIXED(B, 2) CEED_AVX512_FIXED(B, 3)      \
+  CEED_AVX512_FIXED(B, 4) CEED_AVX512_FIXED(B, 5) CEED_AVX512_FIXED(B, 6)      \
+  CEED_AVX512_FIXED(B, 7) CEED_AVX512_FIXED(B, 8) CEED_AVX512_FIXED(B, 9)      \
+  CEED_AVX512_FIXED(B, 10)
+CEED_AVX512_FIXED_J(1) CEED_AVX512_FIXED_J(2) CEED_AVX512_FIXED_J(3)
+CEED_AVX512_FIXED_J(4) CEED_AVX512_FIXED_J(5) CEED_AVX512_FIXED_J(6)
+CEED_AVX512_FIXED_J(7) CEED_AVX512_FIXED_J(8) CEED_AVX512_FIXED_J(9)
+CEED_AVX512_FIXED_J(10)
+
+typedef int (*CeedTensorContractApply_Avx512_Kernel)(CeedTensorContract,
+    CeedInt, CeedInt, CeedInt, CeedInt, const CeedScalar *restrict,
+    CeedTransposeMode, const CeedInt, const CeedScalar *restrict,
+    CeedScalar *restrict);
+
+#define CEED_AVX512_FIXED_ENTRY(B, J) CeedTensorContractApply_Avx512_##B##_##J
+#define CEED_AVX512_FIXED_ROW(B)                                               \
+  { CEED_AVX512_FIXED_ENTRY(B, 1), CEED_AVX512_FIXED_ENTRY(B, 2),              \
+    CEED_AVX512_FIXED_ENTRY(B, 3), CEED_AVX512_FIXED_ENTRY(B, 4),              \
+    CEED_AVX512_FIXED_ENTRY(B, 5), CEED_AVX512_FIXED_ENTRY(B, 6),              \
+    CEED_AVX512_FIXED_ENTRY(B, 7), CEED_AVX512_FIXED_ENTRY(B, 8),              \
+    CEED_AVX512_FIXED_ENTRY(B, 9), CEED_AVX512_FIXED_ENTRY(B, 10) }
+static const CeedTensorContractApply_Avx512_Kernel
+CeedTensorContractApply_Avx512_Fixed[CEED_AVX512_FIXED_MAX]
+[CEED_AVX512_FIXED_MAX] = {
+  CEED_AVX512_FIXED_ROW(1), CEED_AVX512_FIXED_ROW(2), CEED_AVX512_FIXED_ROW(3),
+  CEED_AVX512_FIXED_ROW(4), CEED_AVX512_FIXED_ROW(5), CEED_AVX512_FIXED_ROW(6),
+  CEED_AVX512_FIXED_ROW(7), CEED_AVX512_FIXED_ROW(8), CEED_AVX512_FIXED_ROW(9),
+  CEED_AVX512_FIXED_ROW(10)
+};
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply
+//------------------------------------------------------------------------------
+static int CeedTensorContractApply_Avx512(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  // Fixed size kernel, if available
+  if (B <= CEED_AVX512_FIXED_MAX && J <= CEED_AVX512_FIXED_MAX)
+    return CeedTensorContractApply_Avx512_Fixed[B-1][J-1](contract, A, B, C,
+           J, t, tmode, Add, u, v);
+
+  // Generic kernels
+  if (C == 1)
+    return CeedTensorContract_Avx512_Single_8(contract, A, B, C, J, t, tmode,
+           Add, u, v);
+  return CeedTensorContract_Avx512_Blocked_8_3(contract, A, B, C, J, t, tmode,
+         Add, u, v);
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply Full
+//   All dimensions of one component at a time, so the intermediate values stay
+//   in cache, calling the contraction kernel directly
+//------------------------------------------------------------------------------
+static int CeedTensorContractApplyFull_Avx512(CeedTensorContract contract,
+    CeedInt dim, CeedInt ncomp, CeedInt P, CeedInt Q, CeedInt nelem,
+    const CeedScalar *const *t, CeedTransposeMode tmode, const CeedInt Add,
+    const CeedScalar *restrict u, CeedScalar *restrict v) {
+  // Kernel chosen once for all contractions, which share B = P and J = Q
+  const CeedTensorContractApply_Avx512_Kernel kernel =
+    P <= CEED_AVX512_FIXED_MAX && Q <= CEED_AVX512_FIXED_MAX ?
+    CeedTensorContractApply_Avx512_Fixed[P-1][Q-1] :
+    CeedTensorContractApply_Avx512;
+  const CeedInt usize = CeedIntPow(P, dim)*nelem;
+  const CeedInt vsize = CeedIntPow(Q, dim)*nelem;
+  CeedScalar tmp[2][CeedPadLength(nelem*Q*CeedIntPow(P>Q?P:Q, dim-1))]
+  CEED_ALIGNED;
+
+  for (CeedInt c=0; c<ncomp; c++) {
+    CeedInt pre = CeedIntPow(P, dim-1), post = nelem;
+    for (CeedInt d=0; d<dim; d++) {
+      kernel(contract, pre, P, post, Q, t[d], tmode, Add&&(d==dim-1),
+             d==0 ? &u[c*usize] : tmp[d%2],
+             d==dim-1 ? &v[c*vsize] : tmp[(d+1)%2]);
+      pre /= P;
+      post *= Q;
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Destroy
+//------------------------------------------------------------------------------
+static int CeedTensorContractDestroy_Avx512(CeedTensorContract contract) {
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Create
+//------------------------------------------------------------------------------
+int CeedTensorContractCreate_Avx512(CeedBasis basis,
+                                    CeedTensorContract contract) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
+                                CeedTensorContractApply_Avx512); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "ApplyFull",
+                                CeedTensorContractApplyFull_Avx512); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Destroy",
+                                CeedTensorContractDestroy_Avx512); CeedChk(ierr);
+
+  return 0;
+}
+//------------------------------------------------------------------------------
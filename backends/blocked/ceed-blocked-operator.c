@@ -24,7 +24,7 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
     CeedElemRestriction *blkrestr,
     CeedVector *fullevecs, CeedVector *evecs,
     CeedVector *qvecs, CeedInt starte,
-    CeedInt numfields, CeedInt Q) {
+    CeedInt numfields, CeedInt Q, const CeedInt blksize) {
   CeedInt dim, ierr, ncomp, size, P;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
@@ -43,7 +43,6 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
     ierr = CeedQFunctionGetFields(qf, &qffields, NULL);
     CeedChk(ierr);
   }
-  const CeedInt blksize = 8;
 
   // Loop over fields
   for (CeedInt i=0; i<numfields; i++) {
@@ -60,14 +59,36 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
       ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
       ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
 
-      bool strided;
+      bool strided, compressed;
+      CeedInt nsides;
       ierr = CeedElemRestrictionIsStrided(r, &strided); CeedChk(ierr);
+      ierr = CeedElemRestrictionIsCompressed(r, &compressed); CeedChk(ierr);
+      ierr = CeedElemRestrictionGetNumSides(r, &nsides); CeedChk(ierr);
       if (strided) {
         CeedInt strides[3];
         ierr = CeedElemRestrictionGetStrides(r, &strides); CeedChk(ierr);
         ierr = CeedElemRestrictionCreateBlockedStrided(ceed, nelem, elemsize,
                blksize, ncomp, lsize, strides, &blkrestr[i+starte]);
         CeedChk(ierr);
+      } else if (compressed) {
+        const CeedInt *eoffsets, *stencil;
+        ierr = CeedElemRestrictionGetCompressedOffsets(r, &eoffsets, &stencil);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
+        ierr = CeedElemRestrictionCreateBlockedCompressed(ceed, nelem, elemsize,
+               blksize, ncomp, compstride, lsize, eoffsets, stencil,
+               &blkrestr[i+starte]);
+        CeedChk(ierr);
+      } else if (nsides > 1) {
+        const CeedInt *offsets = NULL;
+        ierr = CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
+        ierr = CeedElemRestrictionCreateBlockedTwoSided(ceed, nelem, elemsize,
+               blksize, ncomp/nsides, compstride, lsize, CEED_MEM_HOST,
+               CEED_COPY_VALUES, offsets, &blkrestr[i+starte]);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionRestoreOffsets(r, &offsets); CeedChk(ierr);
       } else {
         const CeedInt *offsets = NULL;
         ierr = CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
@@ -80,6 +101,16 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
                                                 &blkrestr[i+starte]);
         CeedChk(ierr);
         ierr = CeedElemRestrictionRestoreOffsets(r, &offsets); CeedChk(ierr);
+        // Compact offsets carry over when they fit the padded blocks
+        CeedIndexType itype;
+        bool fits;
+        ierr = CeedElemRestrictionGetIndexType(r, &itype); CeedChk(ierr);
+        ierr = CeedElemRestrictionCheckIndexType(blkrestr[i+starte], itype,
+                                                 &fits); CeedChk(ierr);
+        if (itype != CEED_INDEX_INT32 && fits) {
+          ierr = CeedElemRestrictionSetIndexType(blkrestr[i+starte], itype);
+          CeedChk(ierr);
+        }
       }
       ierr = CeedElemRestrictionCreateVector(blkrestr[i+starte], NULL,
                                              &fullevecs[i+starte]);
@@ -120,6 +151,14 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
     case CEED_EVAL_CURL:
       break; // Not implemented
     }
+
+    // Work vectors are accounted to the operator
+    ierr = CeedVectorSetMemoryClass(fullevecs[i+starte], CEED_MEMORY_EVECTOR);
+    CeedChk(ierr);
+    ierr = CeedVectorSetMemoryClass(evecs[i], CEED_MEMORY_EVECTOR);
+    CeedChk(ierr);
+    ierr = CeedVectorSetMemoryClass(qvecs[i], CEED_MEMORY_EVECTOR);
+    CeedChk(ierr);
   }
   return 0;
 }
@@ -158,11 +197,11 @@ static int CeedOperatorSetup_Blocked(CeedOperator op) {
   ierr = CeedCalloc(numinputfields + numoutputfields, &impl->edata);
   CeedChk(ierr);
 
-  ierr = CeedCalloc(16, &impl->inputstate); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->evecsin); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->evecsout); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->qvecsin); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->qvecsout); CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->inputstate); CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->evecsin); CeedChk(ierr);
+  ierr = CeedCalloc(numoutputfields, &impl->evecsout); CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->qvecsin); CeedChk(ierr);
+  ierr = CeedCalloc(numoutputfields, &impl->qvecsout); CeedChk(ierr);
 
   impl->numein = numinputfields; impl->numeout = numoutputfields;
 
@@ -171,13 +210,13 @@ static int CeedOperatorSetup_Blocked(CeedOperator op) {
   ierr = CeedOperatorSetupFields_Blocked(qf, op, 0, impl->blkrestr,
                                          impl->evecs, impl->evecsin,
                                          impl->qvecsin, 0,
-                                         numinputfields, Q);
+                                         numinputfields, Q, impl->blksize);
   CeedChk(ierr);
   // Outfields
   ierr = CeedOperatorSetupFields_Blocked(qf, op, 1, impl->blkrestr,
                                          impl->evecs, impl->evecsout,
                                          impl->qvecsout, numinputfields,
-                                         numoutputfields, Q);
+                                         numoutputfields, Q, impl->blksize);
   CeedChk(ierr);
 
   // Identity QFunctions
@@ -236,6 +275,11 @@ static inline int CeedOperatorSetupInputs_Blocked(CeedInt numinputfields,
                                         vec, impl->evecs[i], request);
         CeedChk(ierr);
         impl->inputstate[i] = state;
+        // Round reduced precision passive inputs
+        CeedStorageType storage;
+        ierr = CeedOperatorFieldGetStorage(opinputfields[i], &storage);
+        CeedChk(ierr);
+        ierr = CeedVectorRoundToStorage(impl->evecs[i], storage); CeedChk(ierr);
       }
       // Get evec
       ierr = CeedVectorGetArrayRead(impl->evecs[i], CEED_MEM_HOST,
@@ -427,7 +471,7 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector invec,
   int ierr;
   CeedOperator_Blocked *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
-  const CeedInt blksize = 8;
+  const CeedInt blksize = impl->blksize;
   CeedInt Q, numinputfields, numoutputfields, numelements, size;
   ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
   ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
@@ -518,14 +562,16 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector invec,
 }
 
 //------------------------------------------------------------------------------
-// Assemble Linear QFunction
+// Assemble Linear QFunction, creating the restriction and vector on build or
+//   refilling the given ones on update
 //------------------------------------------------------------------------------
-static int CeedOperatorLinearAssembleQFunction_Blocked(CeedOperator op,
-    CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+static int CeedOperatorLinearAssembleQFunctionCore_Blocked(CeedOperator op,
+    bool buildobjects, CeedVector *assembled, CeedElemRestriction *rstr,
+    CeedRequest *request) {
   int ierr;
   CeedOperator_Blocked *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
-  const CeedInt blksize = 8;
+  const CeedInt blksize = impl->blksize;
   CeedInt Q, numinputfields, numoutputfields, numelements, size;
   ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
   ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
@@ -602,20 +648,29 @@ static int CeedOperatorLinearAssembleQFunction_Blocked(CeedOperator op,
                      "and outputs");
   // LCOV_EXCL_STOP
 
-  // Setup lvec
-  ierr = CeedVectorCreate(ceed, nblks*blksize*Q*numactivein*numactiveout,
-                          &lvec); CeedChk(ierr);
+  // Setup blocked lvec and restriction, kept for updates
+  CeedInt strides[3] = {1, Q, numactivein *numactiveout*Q};
+  if (!impl->qflvec) {
+    ierr = CeedVectorCreate(ceed, nblks*blksize*Q*numactivein*numactiveout,
+                            &impl->qflvec); CeedChk(ierr);
+    ierr = CeedElemRestrictionCreateBlockedStrided(ceed, numelements, Q,
+           blksize, numactivein*numactiveout,
+           numactivein*numactiveout*numelements*Q, strides, &impl->qfblkrstr);
+    CeedChk(ierr);
+  }
+  lvec = impl->qflvec;
   ierr = CeedVectorGetArray(lvec, CEED_MEM_HOST, &a); CeedChk(ierr);
 
-  // Create output restriction
-  CeedInt strides[3] = {1, Q, numactivein *numactiveout*Q};
-  ierr = CeedElemRestrictionCreateStrided(ceed, numelements, Q,
-                                          numactivein*numactiveout,
-                                          numactivein*numactiveout*numelements*Q,
-                                          strides, rstr); CeedChk(ierr);
-  // Create assembled vector
-  ierr = CeedVectorCreate(ceed, numelements*Q*numactivein*numactiveout,
-                          assembled); CeedChk(ierr);
+  if (buildobjects) {
+    // Create output restriction
+    ierr = CeedElemRestrictionCreateStrided(ceed, numelements, Q,
+                                            numactivein*numactiveout,
+                                            numactivein*numactiveout*numelements*Q,
+                                            strides, rstr); CeedChk(ierr);
+    // Create assembled vector
+    ierr = CeedVectorCreate(ceed, numelements*Q*numactivein*numactiveout,
+                            assembled); CeedChk(ierr);
+  }
 
   // Loop through elements
   for (CeedInt e=0; e<nblks*blksize; e+=blksize) {
@@ -671,24 +726,36 @@ static int CeedOperatorLinearAssembleQFunction_Blocked(CeedOperator op,
   // Output blocked restriction
   ierr = CeedVectorRestoreArray(lvec, &a); CeedChk(ierr);
   ierr = CeedVectorSetValue(*assembled, 0.0); CeedChk(ierr);
-  CeedElemRestriction blkrstr;
-  ierr = CeedElemRestrictionCreateBlockedStrided(ceed, numelements, Q, blksize,
-         numactivein*numactiveout, numactivein*numactiveout*numelements*Q,
-         strides, &blkrstr); CeedChk(ierr);
-  ierr = CeedElemRestrictionApply(blkrstr, CEED_TRANSPOSE, lvec, *assembled,
-                                  request); CeedChk(ierr);
+  ierr = CeedElemRestrictionApply(impl->qfblkrstr, CEED_TRANSPOSE, lvec,
+                                  *assembled, request); CeedChk(ierr);
 
   // Cleanup
   for (CeedInt i=0; i<numactivein; i++) {
     ierr = CeedVectorDestroy(&activein[i]); CeedChk(ierr);
   }
   ierr = CeedFree(&activein); CeedChk(ierr);
-  ierr = CeedVectorDestroy(&lvec); CeedChk(ierr);
-  ierr = CeedElemRestrictionDestroy(&blkrstr); CeedChk(ierr);
 
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunction_Blocked(CeedOperator op,
+    CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+  return CeedOperatorLinearAssembleQFunctionCore_Blocked(op, true, assembled, rstr,
+         request);
+}
+
+//------------------------------------------------------------------------------
+// Update Assembled Linear QFunction
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionUpdate_Blocked(CeedOperator op,
+    CeedVector assembled, CeedElemRestriction rstr, CeedRequest *request) {
+  return CeedOperatorLinearAssembleQFunctionCore_Blocked(op, false, &assembled,
+         &rstr, request);
+}
+
 //------------------------------------------------------------------------------
 // Operator Destroy
 //------------------------------------------------------------------------------
@@ -697,6 +764,9 @@ static int CeedOperatorDestroy_Blocked(CeedOperator op) {
   CeedOperator_Blocked *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
 
+  ierr = CeedVectorDestroy(&impl->qflvec); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&impl->qfblkrstr); CeedChk(ierr);
+
   for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
     ierr = CeedElemRestrictionDestroy(&impl->blkrestr[i]); CeedChk(ierr);
     ierr = CeedVectorDestroy(&impl->evecs[i]); CeedChk(ierr);
@@ -731,14 +801,21 @@ int CeedOperatorCreate_Blocked(CeedOperator op) {
   int ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Blocked *ceedimpl;
+  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
   CeedOperator_Blocked *impl;
 
   ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  impl->blksize = ceedimpl->blksize;
   ierr = CeedOperatorSetData(op, impl); CeedChk(ierr);
 
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction",
                                 CeedOperatorLinearAssembleQFunction_Blocked);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op,
+                                "LinearAssembleQFunctionUpdate",
+                                CeedOperatorLinearAssembleQFunctionUpdate_Blocked);
+  CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
                                 CeedOperatorApplyAdd_Blocked); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
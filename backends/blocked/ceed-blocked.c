@@ -14,8 +14,21 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
+#include <stdlib.h>
 #include "ceed-blocked.h"
 
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+static int CeedDestroy_Blocked(Ceed ceed) {
+  int ierr;
+  Ceed_Blocked *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  ierr = CeedFree(&data); CeedChk(ierr);
+
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Backend Init
 //------------------------------------------------------------------------------
@@ -34,9 +47,23 @@ static int CeedInit_Blocked(const char *resource, Ceed ceed) {
   CeedInit("/cpu/self/ref/serial", &ceedref);
   ierr = CeedSetDelegate(ceed, ceedref); CeedChk(ierr);
 
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy",
+                                CeedDestroy_Blocked); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate",
                                 CeedOperatorCreate_Blocked); CeedChk(ierr);
 
+  // Set blocksize, optionally overridden by CEED_BLOCK_SIZE
+  Ceed_Blocked *data;
+  ierr = CeedCalloc(1, &data); CeedChk(ierr);
+  const char *blksize = getenv("CEED_BLOCK_SIZE");
+  data->blksize = blksize ? strtol(blksize, NULL, 10) : 8;
+  if (data->blksize < 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Blocked backend cannot use blocksize: %s",
+                     blksize);
+  // LCOV_EXCL_STOP
+  ierr = CeedSetData(ceed, data); CeedChk(ierr);
+
   return 0;
 }
 
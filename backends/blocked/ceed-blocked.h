@@ -17,12 +17,17 @@
 #include <ceed-backend.h>
 #include <string.h>
 
+typedef struct {
+  CeedInt blksize;
+} Ceed_Blocked;
+
 typedef struct {
   CeedScalar *colograd1d;
 } CeedBasis_Blocked;
 
 typedef struct {
   bool identityqf;
+  CeedInt blksize;               /// Number of elements per block
   CeedElemRestriction *blkrestr; /// Blocked versions of restrictions
   CeedVector
   *evecs;   /// E-vectors needed to apply operator (input followed by outputs)
@@ -32,6 +37,8 @@ typedef struct {
   CeedVector *evecsout;  /// Output E-vectors needed to apply operator
   CeedVector *qvecsin;   /// Input Q-vectors needed to apply operator
   CeedVector *qvecsout;  /// Output Q-vectors needed to apply operator
+  CeedVector qflvec;     /// Blocked assembled QFunction storage
+  CeedElemRestriction qfblkrstr; /// Blocked restriction of assembled QFunction
   CeedInt    numein;
   CeedInt    numeout;
 } CeedOperator_Blocked;
@@ -18,6 +18,7 @@
 #include "ceed-cuda-gen.h"
 #include <iostream>
 #include <sstream>
+#include <vector>
 #include "../cuda-shared/ceed-cuda-shared.h"
 
 static const char *atomicAdd = QUOTE(
@@ -40,14 +41,137 @@ __device__ double atomicAdd(double *address, double val) {
 }
 );
 
+static const char *copyAsync = QUOTE(
+//------------------------------------------------------------------------------
+// Asynchronous copies to shared memory, for Ampere and newer
+//   Each thread stages the values it reads in a private slot of s_u, with
+//   value k at s_u[k*nthreads], so no __syncthreads is needed
+//------------------------------------------------------------------------------
+inline __device__ void copyAsync(CeedScalar* s, const CeedScalar* g) {
+  asm volatile("cp.async.ca.shared.global [%0], [%1], %2;\n" :: "r"((unsigned int)__cvta_generic_to_shared(s)), "l"(g), "n"(sizeof(CeedScalar)));
+}
+
+inline __device__ void copyAsyncCommit() {
+  asm volatile("cp.async.commit_group;\n" ::);
+}
+
+inline __device__ void copyAsyncWait() {
+  asm volatile("cp.async.wait_group 0;\n" ::);
+}
+
+//------------------------------------------------------------------------------
+// Staged values -> registers
+//------------------------------------------------------------------------------
+template <int SIZE>
+inline __device__ void loadStagedDofs(BackendData& data, const CeedScalar* s_u, CeedScalar* r_u) {
+  const CeedInt nthreads = blockDim.x*blockDim.y*blockDim.z;
+  for (CeedInt k = 0; k < SIZE; ++k)
+    r_u[k] = s_u[k*nthreads];
+}
+
+//------------------------------------------------------------------------------
+// L-vector -> staged E-vector, offsets provided
+//------------------------------------------------------------------------------
+template <int NCOMP, int COMPSTRIDE, int P1d>
+inline __device__ void prefetchDofsOffset1d(BackendData& data, const CeedInt elem, const CeedInt* indices, const CeedScalar* d_u, CeedScalar* s_u) {
+  const CeedInt nthreads = blockDim.x*blockDim.y*blockDim.z;
+  if (data.tidx < P1d) {
+    const CeedInt node = data.tidx;
+    const CeedInt ind = indices[node + elem * P1d];
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      copyAsync(&s_u[comp*nthreads], &d_u[ind + COMPSTRIDE * comp]);
+  }
+}
+
+template <int NCOMP, int COMPSTRIDE, int P1d>
+inline __device__ void prefetchDofsOffset2d(BackendData& data, const CeedInt elem, const CeedInt* indices, const CeedScalar* d_u, CeedScalar* s_u) {
+  const CeedInt nthreads = blockDim.x*blockDim.y*blockDim.z;
+  if (data.tidx < P1d && data.tidy < P1d) {
+    const CeedInt node = data.tidx + data.tidy*P1d;
+    const CeedInt ind = indices[node + elem * P1d*P1d];
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      copyAsync(&s_u[comp*nthreads], &d_u[ind + COMPSTRIDE * comp]);
+  }
+}
+
+template <int NCOMP, int COMPSTRIDE, int P1d>
+inline __device__ void prefetchDofsOffset3d(BackendData& data, const CeedInt elem, const CeedInt* indices, const CeedScalar* d_u, CeedScalar* s_u) {
+  const CeedInt nthreads = blockDim.x*blockDim.y*blockDim.z;
+  if (data.tidx < P1d && data.tidy < P1d)
+    for (CeedInt z = 0; z < P1d; ++z) {
+      const CeedInt node = data.tidx + data.tidy*P1d + z*P1d*P1d;
+      const CeedInt ind = indices[node + elem * P1d*P1d*P1d];
+      for (CeedInt comp = 0; comp < NCOMP; ++comp)
+        copyAsync(&s_u[(z+comp*P1d)*nthreads], &d_u[ind + COMPSTRIDE * comp]);
+    }
+}
+
+template <int NCOMP, int COMPSTRIDE, int P1d>
+inline __device__ void prefetchDofsOffset3dBlock(BackendData& data, const CeedInt elem, const CeedInt* indices, const CeedScalar* d_u, CeedScalar* s_u) {
+  const CeedInt nthreads = blockDim.x*blockDim.y*blockDim.z;
+  if (data.tidx < P1d && data.tidy < P1d && data.tidz < P1d) {
+    const CeedInt node = data.tidx + data.tidy*P1d + data.tidz*P1d*P1d;
+    const CeedInt ind = indices[node + elem * P1d*P1d*P1d];
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      copyAsync(&s_u[comp*nthreads], &d_u[ind + COMPSTRIDE * comp]);
+  }
+}
+
+//------------------------------------------------------------------------------
+// L-vector -> staged E-vector, strided
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int STRIDES_NODE, int STRIDES_COMP, int STRIDES_ELEM>
+inline __device__ void prefetchDofsStrided1d(BackendData& data, const CeedInt elem, const CeedScalar* d_u, CeedScalar* s_u) {
+  const CeedInt nthreads = blockDim.x*blockDim.y*blockDim.z;
+  if (data.tidx < P1d) {
+    const CeedInt node = data.tidx;
+    const CeedInt ind = node * STRIDES_NODE + elem * STRIDES_ELEM;
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      copyAsync(&s_u[comp*nthreads], &d_u[ind + comp * STRIDES_COMP]);
+  }
+}
+
+template <int NCOMP, int P1d, int STRIDES_NODE, int STRIDES_COMP, int STRIDES_ELEM>
+inline __device__ void prefetchDofsStrided2d(BackendData& data, const CeedInt elem, const CeedScalar* d_u, CeedScalar* s_u) {
+  const CeedInt nthreads = blockDim.x*blockDim.y*blockDim.z;
+  if (data.tidx < P1d && data.tidy < P1d) {
+    const CeedInt node = data.tidx + data.tidy*P1d;
+    const CeedInt ind = node * STRIDES_NODE + elem * STRIDES_ELEM;
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      copyAsync(&s_u[comp*nthreads], &d_u[ind + comp * STRIDES_COMP]);
+  }
+}
+
+template <int NCOMP, int P1d, int STRIDES_NODE, int STRIDES_COMP, int STRIDES_ELEM>
+inline __device__ void prefetchDofsStrided3d(BackendData& data, const CeedInt elem, const CeedScalar* d_u, CeedScalar* s_u) {
+  const CeedInt nthreads = blockDim.x*blockDim.y*blockDim.z;
+  if (data.tidx < P1d && data.tidy < P1d)
+    for (CeedInt z = 0; z < P1d; ++z) {
+      const CeedInt node = data.tidx + data.tidy*P1d + z*P1d*P1d;
+      const CeedInt ind = node * STRIDES_NODE + elem * STRIDES_ELEM;
+      for (CeedInt comp = 0; comp < NCOMP; ++comp)
+        copyAsync(&s_u[(z+comp*P1d)*nthreads], &d_u[ind + comp * STRIDES_COMP]);
+    }
+}
+
+template <int NCOMP, int P1d, int STRIDES_NODE, int STRIDES_COMP, int STRIDES_ELEM>
+inline __device__ void prefetchDofsStrided3dBlock(BackendData& data, const CeedInt elem, const CeedScalar* d_u, CeedScalar* s_u) {
+  const CeedInt nthreads = blockDim.x*blockDim.y*blockDim.z;
+  if (data.tidx < P1d && data.tidy < P1d && data.tidz < P1d) {
+    const CeedInt node = data.tidx + data.tidy*P1d + data.tidz*P1d*P1d;
+    const CeedInt ind = node * STRIDES_NODE + elem * STRIDES_ELEM;
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      copyAsync(&s_u[comp*nthreads], &d_u[ind + comp * STRIDES_COMP]);
+  }
+}
+
+);
+
 static const char *deviceFunctions = QUOTE(
 
 //------------------------------------------------------------------------------
 // Typedefs
 //------------------------------------------------------------------------------
-typedef struct { const CeedScalar* in[16]; CeedScalar* out[16]; } CudaFields;
-typedef struct { CeedInt* in[16]; CeedInt* out[16]; } CudaFieldsInt;
-
 typedef struct {
   CeedInt tidx;
   CeedInt tidy;
@@ -597,8 +721,8 @@ inline __device__ void ContractTransposeAddX3d(BackendData& data, const CeedScal
 //------------------------------------------------------------------------------
 template <int NCOMP, int P1d, int Q1d>
 inline __device__ void interp3d(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, CeedScalar *__restrict__ r_V) {
-  CeedScalar r_t1[T1d];
-  CeedScalar r_t2[T1d];
+  CeedScalar r_t1[P1d];
+  CeedScalar r_t2[P1d];
   for (CeedInt comp = 0; comp < NCOMP; comp++) {
     ContractX3d<NCOMP, P1d, Q1d>(data, r_U + comp*P1d, c_B, r_t1);
     ContractY3d<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
@@ -611,8 +735,8 @@ inline __device__ void interp3d(BackendData& data, const CeedScalar *__restrict_
 //------------------------------------------------------------------------------
 template <int NCOMP, int P1d, int Q1d>
 inline __device__ void interpTranspose3d(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, CeedScalar *__restrict__ r_V) {
-  CeedScalar r_t1[T1d];
-  CeedScalar r_t2[T1d];
+  CeedScalar r_t1[P1d];
+  CeedScalar r_t2[P1d];
   for (CeedInt comp = 0; comp < NCOMP; comp++) {
     ContractTransposeZ3d<NCOMP, P1d, Q1d>(data, r_U + comp*Q1d, c_B, r_t1);
     ContractTransposeY3d<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
@@ -625,8 +749,8 @@ inline __device__ void interpTranspose3d(BackendData& data, const CeedScalar *__
 //------------------------------------------------------------------------------
 template <int NCOMP, int P1d, int Q1d>
 inline __device__ void grad3d(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
-  CeedScalar r_t1[T1d];
-  CeedScalar r_t2[T1d];
+  CeedScalar r_t1[P1d];
+  CeedScalar r_t2[P1d];
   for (CeedInt comp = 0; comp < NCOMP; comp++) {
     ContractX3d<NCOMP, P1d, Q1d>(data, r_U + comp*P1d, c_G, r_t1);
     ContractY3d<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
@@ -645,8 +769,8 @@ inline __device__ void grad3d(BackendData& data, const CeedScalar *__restrict__
 //------------------------------------------------------------------------------
 template <int NCOMP, int P1d, int Q1d>
 inline __device__ void gradTranspose3d(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
-  CeedScalar r_t1[T1d];
-  CeedScalar r_t2[T1d];
+  CeedScalar r_t1[P1d];
+  CeedScalar r_t2[P1d];
   for (CeedInt comp = 0; comp < NCOMP; comp++) {
     ContractTransposeZ3d<NCOMP, P1d, Q1d>(data, r_U + comp*Q1d + 0*NCOMP*Q1d, c_B, r_t1);
     ContractTransposeY3d<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
@@ -712,6 +836,271 @@ inline __device__ void gradColloTranspose3d(BackendData& data, const CeedInt q,
   }
 }
 
+//------------------------------------------------------------------------------
+// 3D thread blocks
+//   Elements are laid out on T1d x T1d x T1d threads with data.tidz the z
+//   index, so each thread holds one node or quadrature point as in 2D
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, offsets provided
+//------------------------------------------------------------------------------
+template <int NCOMP, int COMPSTRIDE, int P1d>
+inline __device__ void readDofsOffset3dBlock(BackendData& data, const CeedInt nnodes, const CeedInt elem, const CeedInt* indices, const CeedScalar* d_u, CeedScalar* r_u) {
+  if (data.tidx < P1d && data.tidy < P1d && data.tidz < P1d) {
+    const CeedInt node = data.tidx + data.tidy*P1d + data.tidz*P1d*P1d;
+    const CeedInt ind = indices[node + elem * P1d*P1d*P1d];
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      r_u[comp] = d_u[ind + COMPSTRIDE * comp];
+  }
+}
+
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, strided
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int STRIDES_NODE, int STRIDES_COMP, int STRIDES_ELEM>
+inline __device__ void readDofsStrided3dBlock(BackendData& data, const CeedInt elem, const CeedScalar* d_u, CeedScalar* r_u) {
+  if (data.tidx < P1d && data.tidy < P1d && data.tidz < P1d) {
+    const CeedInt node = data.tidx + data.tidy*P1d + data.tidz*P1d*P1d;
+    const CeedInt ind = node * STRIDES_NODE + elem * STRIDES_ELEM;
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      r_u[comp] = d_u[ind + comp * STRIDES_COMP];
+  }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, offsets provided
+//------------------------------------------------------------------------------
+template <int NCOMP, int COMPSTRIDE, int P1d>
+inline __device__ void writeDofsOffset3dBlock(BackendData& data, const CeedInt nnodes, const CeedInt elem, const CeedInt* indices, const CeedScalar* r_v, CeedScalar* d_v) {
+  if (data.tidx < P1d && data.tidy < P1d && data.tidz < P1d) {
+    const CeedInt node = data.tidx + data.tidy*P1d + data.tidz*P1d*P1d;
+    const CeedInt ind = indices[node + elem * P1d*P1d*P1d];
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      atomicAdd(&d_v[ind + COMPSTRIDE * comp], r_v[comp]);
+  }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, strided
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int STRIDES_NODE, int STRIDES_COMP, int STRIDES_ELEM>
+inline __device__ void writeDofsStrided3dBlock(BackendData& data, const CeedInt elem, const CeedScalar* r_v, CeedScalar* d_v) {
+  if (data.tidx < P1d && data.tidy < P1d && data.tidz < P1d) {
+    const CeedInt node = data.tidx + data.tidy*P1d + data.tidz*P1d*P1d;
+    const CeedInt ind = node * STRIDES_NODE + elem * STRIDES_ELEM;
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      d_v[ind + comp * STRIDES_COMP] += r_v[comp];
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block tensor contract x
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractX3dBlock(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d+data.tidz*T1d*T1d] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < Q1d && data.tidy < P1d && data.tidz < P1d)
+    for (CeedInt i = 0; i < P1d; ++i)
+      *V += B[i + data.tidx*P1d] * data.slice[i + data.tidy*T1d + data.tidz*T1d*T1d]; // Contract x direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block tensor contract y
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractY3dBlock(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d+data.tidz*T1d*T1d] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < Q1d && data.tidy < Q1d && data.tidz < P1d)
+    for (CeedInt i = 0; i < P1d; ++i)
+      *V += B[i + data.tidy*P1d] * data.slice[data.tidx + i*T1d + data.tidz*T1d*T1d]; // Contract y direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block tensor contract z
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractZ3dBlock(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d+data.tidz*T1d*T1d] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < Q1d && data.tidy < Q1d && data.tidz < Q1d)
+    for (CeedInt i = 0; i < P1d; ++i)
+      *V += B[i + data.tidz*P1d] * data.slice[data.tidx + data.tidy*T1d + i*T1d*T1d]; // Contract z direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block transpose tensor contract z
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractTransposeZ3dBlock(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d+data.tidz*T1d*T1d] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < Q1d && data.tidy < Q1d && data.tidz < P1d)
+    for (CeedInt i = 0; i < Q1d; ++i)
+      *V += B[data.tidz + i*P1d] * data.slice[data.tidx + data.tidy*T1d + i*T1d*T1d]; // Contract z direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block transpose tensor contract y
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractTransposeY3dBlock(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d+data.tidz*T1d*T1d] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < Q1d && data.tidy < P1d && data.tidz < P1d)
+    for (CeedInt i = 0; i < Q1d; ++i)
+      *V += B[data.tidy + i*P1d] * data.slice[data.tidx + i*T1d + data.tidz*T1d*T1d]; // Contract y direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block transpose tensor contract x
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractTransposeX3dBlock(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d+data.tidz*T1d*T1d] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < P1d && data.tidy < P1d && data.tidz < P1d)
+    for (CeedInt i = 0; i < Q1d; ++i)
+      *V += B[data.tidx + i*P1d] * data.slice[i + data.tidy*T1d + data.tidz*T1d*T1d]; // Contract x direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block transpose tensor contract and add x
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractTransposeAddX3dBlock(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d+data.tidz*T1d*T1d] = *U;
+  __syncthreads();
+  if (data.tidx < P1d && data.tidy < P1d && data.tidz < P1d)
+    for (CeedInt i = 0; i < Q1d; ++i)
+      *V += B[data.tidx + i*P1d] * data.slice[i + data.tidy*T1d + data.tidz*T1d*T1d]; // Contract x direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block interpolate to quadrature points
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void interp3dBlock(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, CeedScalar *__restrict__ r_V) {
+  CeedScalar r_t1[1];
+  CeedScalar r_t2[1];
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    ContractX3dBlock<NCOMP, P1d, Q1d>(data, r_U + comp, c_B, r_t1);
+    ContractY3dBlock<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractZ3dBlock<NCOMP, P1d, Q1d>(data, r_t2, c_B, r_V + comp);
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block interpolate transpose
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void interpTranspose3dBlock(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, CeedScalar *__restrict__ r_V) {
+  CeedScalar r_t1[1];
+  CeedScalar r_t2[1];
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    ContractTransposeZ3dBlock<NCOMP, P1d, Q1d>(data, r_U + comp, c_B, r_t1);
+    ContractTransposeY3dBlock<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractTransposeX3dBlock<NCOMP, P1d, Q1d>(data, r_t2, c_B, r_V + comp);
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block derivatives at quadrature points
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void grad3dBlock(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
+  CeedScalar r_t1[1];
+  CeedScalar r_t2[1];
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    ContractX3dBlock<NCOMP, P1d, Q1d>(data, r_U + comp, c_G, r_t1);
+    ContractY3dBlock<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractZ3dBlock<NCOMP, P1d, Q1d>(data, r_t2, c_B, r_V + comp + 0*NCOMP);
+    ContractX3dBlock<NCOMP, P1d, Q1d>(data, r_U + comp, c_B, r_t1);
+    ContractY3dBlock<NCOMP, P1d, Q1d>(data, r_t1, c_G, r_t2);
+    ContractZ3dBlock<NCOMP, P1d, Q1d>(data, r_t2, c_B, r_V + comp + 1*NCOMP);
+    ContractX3dBlock<NCOMP, P1d, Q1d>(data, r_U + comp, c_B, r_t1);
+    ContractY3dBlock<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractZ3dBlock<NCOMP, P1d, Q1d>(data, r_t2, c_G, r_V + comp + 2*NCOMP);
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block derivatives transpose
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void gradTranspose3dBlock(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
+  CeedScalar r_t1[1];
+  CeedScalar r_t2[1];
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    ContractTransposeZ3dBlock<NCOMP, P1d, Q1d>(data, r_U + comp + 0*NCOMP, c_B, r_t1);
+    ContractTransposeY3dBlock<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractTransposeX3dBlock<NCOMP, P1d, Q1d>(data, r_t2, c_G, r_V + comp);
+    ContractTransposeZ3dBlock<NCOMP, P1d, Q1d>(data, r_U + comp + 1*NCOMP, c_B, r_t1);
+    ContractTransposeY3dBlock<NCOMP, P1d, Q1d>(data, r_t1, c_G, r_t2);
+    ContractTransposeAddX3dBlock<NCOMP, P1d, Q1d>(data, r_t2, c_B, r_V + comp);
+    ContractTransposeZ3dBlock<NCOMP, P1d, Q1d>(data, r_U + comp + 2*NCOMP, c_G, r_t1);
+    ContractTransposeY3dBlock<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractTransposeAddX3dBlock<NCOMP, P1d, Q1d>(data, r_t2, c_B, r_V + comp);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Non-tensor
+//   Elements use the 1D thread layout, one thread per node or quadrature
+//   point, so restrictions, interpolation, and weights use the 1D functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Non-tensor derivatives at quadrature points
+//------------------------------------------------------------------------------
+template <int NCOMP, int DIM, int P, int Q>
+inline __device__ void gradNonTensor(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    data.slice[data.tidx] = r_U[comp];
+    __syncthreads();
+    for (CeedInt d = 0; d < DIM; d++) {
+      r_V[comp + d*NCOMP] = 0.0;
+      if (data.tidx < Q)
+        for (CeedInt i = 0; i < P; ++i)
+          r_V[comp + d*NCOMP] += c_G[i + data.tidx*P + d*P*Q] * data.slice[i];
+    }
+    __syncthreads();
+  }
+}
+
+//------------------------------------------------------------------------------
+// Non-tensor derivatives transpose
+//------------------------------------------------------------------------------
+template <int NCOMP, int DIM, int P, int Q>
+inline __device__ void gradTransposeNonTensor(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    r_V[comp] = 0.0;
+    for (CeedInt d = 0; d < DIM; d++) {
+      data.slice[data.tidx] = r_U[comp + d*NCOMP];
+      __syncthreads();
+      if (data.tidx < P)
+        for (CeedInt i = 0; i < Q; ++i)
+          r_V[comp] += c_G[data.tidx + i*P + d*P*Q] * data.slice[i];
+      __syncthreads();
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 // 1D quadrature weights
 //------------------------------------------------------------------------------
@@ -740,18 +1129,27 @@ inline __device__ void weight3d(BackendData& data, const CeedScalar *qweight1d,
     w[z] = quad ? pw*qweight1d[z] : 0.0;
 }
 
-);
 //------------------------------------------------------------------------------
-// Build singe operator kernel
+// 3D thread block quadrature weights
 //------------------------------------------------------------------------------
-extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
+template <int Q1d>
+inline __device__ void weight3dBlock(BackendData& data, const CeedScalar *qweight1d, CeedScalar *w) {
+  *w = (data.tidx < Q1d && data.tidy < Q1d && data.tidz < Q1d) ?
+        qweight1d[data.tidx]*qweight1d[data.tidy]*qweight1d[data.tidz] : 0.0;
+}
 
-  using std::ostringstream;
+);
+
+//------------------------------------------------------------------------------
+// Generate operator kernel
+//   With block3d, 3D elements use the 3D thread block functions
+//------------------------------------------------------------------------------
+static int CeedCudaGenOperatorBuildKernel(CeedOperator op,
+    std::ostringstream &code, const std::string &oper, const CeedInt dim,
+    const CeedInt Q1d, bool useCollograd, const bool nonTensor,
+    const bool devicetables, const bool block3d) {
   using std::string;
   int ierr;
-  bool setupdone;
-  ierr = CeedOperatorIsSetupDone(op, &setupdone); CeedChk(ierr);
-  if (setupdone) return 0;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
   CeedOperator_Cuda_gen *data;
@@ -760,10 +1158,7 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
   CeedQFunction_Cuda_gen *qf_data;
   ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
   ierr = CeedQFunctionGetData(qf, &qf_data); CeedChk(ierr);
-  CeedInt Q, P1d, Q1d = 0, numelements, elemsize, numinputfields,
-          numoutputfields, ncomp, dim = 0, lsize;
-  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
-  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  CeedInt P1d, elemsize, numinputfields, numoutputfields, ncomp, lsize;
   ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
   CeedChk(ierr);
   CeedOperatorField *opinputfields, *opoutputfields;
@@ -775,100 +1170,25 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
   CeedEvalMode emode;
   CeedBasis basis;
   CeedBasis_Cuda_shared *basis_data;
+  CeedBasisNonTensor_Cuda *nontensor_data;
   CeedElemRestriction Erestrict;
   CeedElemRestriction_Cuda *restr_data;
+  string qFunctionName(qf_data->qFunctionName);
 
-  ostringstream code;
-  string devFunctions(deviceFunctions);
+  // Non-tensor elements are laid out on threads like 1D elements, and 3D
+  //   thread blocks hold one point per thread, without collocated gradients
+  const string dimname = block3d ? "3dBlock" :
+                         std::to_string(nonTensor ? 1 : dim) + "d";
+  if (block3d) useCollograd = false;
 
-  // Add atomicAdd function for old NVidia architectures
-  struct cudaDeviceProp prop;
-  Ceed_Cuda *ceed_data;
-  ierr = CeedGetData(ceed, &ceed_data); CeedChk(ierr);
-  ierr = cudaGetDeviceProperties(&prop, ceed_data->deviceId);
-  if (prop.major<6){
-    code << atomicAdd;
+  if (!devicetables) {
+    code << "\nextern \"C\" __global__ void CEED_LAUNCH_BOUNDS "<<oper<<"(CeedInt nelem, void* ctx, CudaFieldsInt indices, CudaFields fields, CudaFields B, CudaFields G, CeedScalar* W) {\n";
+  } else {
+    // Field tables in device memory
+    code << "\nextern \"C\" __global__ void CEED_LAUNCH_BOUNDS "<<oper<<"(CeedInt nelem, void* ctx, const CudaFieldsInt *__restrict__ d_indices, const CudaFields *__restrict__ d_fields, const CudaFields *__restrict__ d_B, const CudaFields *__restrict__ d_G, CeedScalar* W) {\n";
+    code << "  const CudaFieldsInt &indices = *d_indices;\n";
+    code << "  const CudaFields &fields = *d_fields, &B = *d_B, &G = *d_G;\n";
   }
-
-  code << devFunctions;
-
-  string qFunction(qf_data->qFunctionSource);
-  string qFunctionName(qf_data->qFunctionName);
-  string oper;
-  oper = "CeedKernel_Cuda_gen_" + qFunctionName;
-
-  code << "\n#define CEED_QFUNCTION(name) inline __device__ int name\n";
-  code << "\n#define CeedPragmaSIMD\n";
-
-  // Find dim and Q1d
-  bool useCollograd = true;
-  data->maxP1d = 0;
-  for (CeedInt i = 0; i < numinputfields; i++) {
-    ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
-    if (basis != CEED_BASIS_COLLOCATED) {
-      ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
-      ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
-      CeedChk(ierr);
-
-      // Check for collocated gradient
-      useCollograd = useCollograd && basis_data->d_collograd1d; 
-
-      // Collect dim and Q1d
-      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
-      bool isTensor;
-      ierr = CeedBasisIsTensor(basis, &isTensor); CeedChk(ierr); 
-      if (isTensor) {
-        ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
-        ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
-        if (P1d>data->maxP1d) data->maxP1d = P1d;
-      } else {
-        // LCOV_EXCL_START
-        return CeedError(ceed, 1, "Backend does not implement operators with non-tensor basis");
-        // LCOV_EXCL_STOP
-        }
-    }
-  }
-  // Check output bases for Q1d, dim as well
-  //   The only imput basis might be CEED_BASIS_COLLOCATED
-  for (CeedInt i = 0; i < numoutputfields; i++) {
-    ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis); CeedChk(ierr);
-
-    if (basis != CEED_BASIS_COLLOCATED) {
-      ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
-      ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
-      CeedChk(ierr);
-
-      // Collect dim and Q1d
-      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
-      bool isTensor;
-      ierr = CeedBasisIsTensor(basis, &isTensor); CeedChk(ierr); 
-      if (isTensor) {
-        ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
-      } else {
-        // LCOV_EXCL_START
-        return CeedError(ceed, 1, "Backend does not implement operators with non-tensor basis");
-        // LCOV_EXCL_STOP
-        }
-
-      // Check for collocated gradient
-      useCollograd = useCollograd && basis_data->d_collograd1d; 
-    }
-  }
-  data->dim = dim;
-  data->Q1d = Q1d;
-
-  // Define CEED_Q_VLA
-  if (dim != 3 || useCollograd) {
-    code << "\n#define CEED_Q_VLA 1\n\n";
-  } else {
-    code << "\n#define CEED_Q_VLA "<<Q1d<<"\n\n";
-  }
-
-  code << qFunction;
-
-  // Setup
-  code << "\n// -----------------------------------------------------------------------------\n";
-  code << "\nextern \"C\" __global__ void "<<oper<<"(CeedInt nelem, void* ctx, CudaFieldsInt indices, CudaFields fields, CudaFields B, CudaFields G, CeedScalar* W) {\n";
   for (CeedInt i = 0; i < numinputfields; i++) {
     ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
     CeedChk(ierr);
@@ -888,9 +1208,16 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
   code << "  BackendData data;\n";
   code << "  data.tidx = threadIdx.x;\n";
   code << "  data.tidy = threadIdx.y;\n";
-  code << "  data.tidz = threadIdx.z;\n";
-  code << "  data.tid  = threadIdx.x + threadIdx.y*blockDim.x + threadIdx.z*blockDim.y*blockDim.x;\n";
-  code << "  data.slice = slice+data.tidz*T1d"<<(dim>1?"*T1d":"")<<";\n";
+  if (block3d) {
+    // Elements are stacked in z, T1d threads each
+    code << "  data.tidz = threadIdx.z%T1d;\n";
+    code << "  data.tid  = threadIdx.x + threadIdx.y*blockDim.x + threadIdx.z*blockDim.y*blockDim.x;\n";
+    code << "  data.slice = slice+(threadIdx.z/T1d)*T1d*T1d*T1d;\n";
+  } else {
+    code << "  data.tidz = threadIdx.z;\n";
+    code << "  data.tid  = threadIdx.x + threadIdx.y*blockDim.x + threadIdx.z*blockDim.y*blockDim.x;\n";
+    code << "  data.slice = slice+data.tidz*T1d"<<(dim>1 && !nonTensor?"*T1d":"")<<";\n";
+  }
 
   code << "\n  // -- Input field constants and basis data --\n";
   //Initialize constants, and matrices B and G
@@ -910,7 +1237,11 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
     if (emode != CEED_EVAL_WEIGHT) {
       ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
       if (basis != CEED_BASIS_COLLOCATED) {
-        ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+        if (nonTensor) {
+          ierr = CeedBasisGetNumNodes(basis, &P1d); CeedChk(ierr);
+        } else {
+          ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+        }
         code << "  const CeedInt P_in_"<<i<<" = "<<P1d<<";\n";
       } else {
         code << "  const CeedInt P_in_"<<i<<" = "<<Q1d<<";\n";
@@ -924,23 +1255,35 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
     case CEED_EVAL_NONE:
       break;
     case CEED_EVAL_INTERP:
-      ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
-      data->B.in[i] = basis_data->d_interp1d;
-      code << "  __shared__ double s_B_in_"<<i<<"["<<P1d*Q1d<<"];\n";
+      if (nonTensor) {
+        ierr = CeedBasisGetData(basis, &nontensor_data); CeedChk(ierr);
+        data->B.in[i] = nontensor_data->d_interp;
+      } else {
+        ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
+        data->B.in[i] = basis_data->d_interp1d;
+      }
+      code << "  __shared__ CeedScalar s_B_in_"<<i<<"["<<P1d*Q1d<<"];\n";
       code << "  loadMatrix<P_in_"<<i<<",Q1d>(data, B.in["<<i<<"], s_B_in_"<<i<<");\n";
       break;
     case CEED_EVAL_GRAD:
+      if (nonTensor) {
+        ierr = CeedBasisGetData(basis, &nontensor_data); CeedChk(ierr);
+        data->G.in[i] = nontensor_data->d_grad;
+        code << "  __shared__ CeedScalar s_G_in_"<<i<<"["<<dim*P1d*Q1d<<"];\n";
+        code << "  loadMatrix<P_in_"<<i<<"*Dim,Q1d>(data, G.in["<<i<<"], s_G_in_"<<i<<");\n";
+        break;
+      }
       ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
       data->B.in[i] = basis_data->d_interp1d;
-      code << "  __shared__ double s_B_in_"<<i<<"["<<P1d*Q1d<<"];\n";
+      code << "  __shared__ CeedScalar s_B_in_"<<i<<"["<<P1d*Q1d<<"];\n";
       code << "  loadMatrix<P_in_"<<i<<",Q1d>(data, B.in["<<i<<"], s_B_in_"<<i<<");\n";
       if (useCollograd) {
         data->G.in[i] = basis_data->d_collograd1d;
-        code << "  __shared__ double s_G_in_"<<i<<"["<<Q1d*Q1d<<"];\n";
+        code << "  __shared__ CeedScalar s_G_in_"<<i<<"["<<Q1d*Q1d<<"];\n";
         code << "  loadMatrix<Q1d,Q1d>(data, G.in["<<i<<"], s_G_in_"<<i<<");\n";
       } else {
         data->G.in[i] = basis_data->d_grad1d;
-        code << "  __shared__ double s_G_in_"<<i<<"["<<P1d*Q1d<<"];\n";
+        code << "  __shared__ CeedScalar s_G_in_"<<i<<"["<<P1d*Q1d<<"];\n";
         code << "  loadMatrix<P_in_"<<i<<",Q1d>(data, G.in["<<i<<"], s_G_in_"<<i<<");\n";
       }
       break;
@@ -969,7 +1312,11 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
     // Set field constants
     ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis); CeedChk(ierr);
     if (basis != CEED_BASIS_COLLOCATED) {
-      ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+      if (nonTensor) {
+        ierr = CeedBasisGetNumNodes(basis, &P1d); CeedChk(ierr);
+      } else {
+        ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+      }
       code << "  const CeedInt P_out_"<<i<<" = "<<P1d<<";\n";
     } else {
       code << "  const CeedInt P_out_"<<i<<" = "<<Q1d<<";\n";
@@ -982,23 +1329,35 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
     case CEED_EVAL_NONE:
       break; // No action
     case CEED_EVAL_INTERP:
-      ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
-      data->B.out[i] = basis_data->d_interp1d;
-      code << "  __shared__ double s_B_out_"<<i<<"["<<P1d*Q1d<<"];\n";
+      if (nonTensor) {
+        ierr = CeedBasisGetData(basis, &nontensor_data); CeedChk(ierr);
+        data->B.out[i] = nontensor_data->d_interp;
+      } else {
+        ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
+        data->B.out[i] = basis_data->d_interp1d;
+      }
+      code << "  __shared__ CeedScalar s_B_out_"<<i<<"["<<P1d*Q1d<<"];\n";
       code << "  loadMatrix<P_out_"<<i<<",Q1d>(data, B.out["<<i<<"], s_B_out_"<<i<<");\n";
       break;
     case CEED_EVAL_GRAD:
+      if (nonTensor) {
+        ierr = CeedBasisGetData(basis, &nontensor_data); CeedChk(ierr);
+        data->G.out[i] = nontensor_data->d_grad;
+        code << "  __shared__ CeedScalar s_G_out_"<<i<<"["<<dim*P1d*Q1d<<"];\n";
+        code << "  loadMatrix<P_out_"<<i<<"*Dim,Q1d>(data, G.out["<<i<<"], s_G_out_"<<i<<");\n";
+        break;
+      }
       ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
       data->B.out[i] = basis_data->d_interp1d;
-      code << "  __shared__ double s_B_out_"<<i<<"["<<P1d*Q1d<<"];\n";
+      code << "  __shared__ CeedScalar s_B_out_"<<i<<"["<<P1d*Q1d<<"];\n";
       code << "  loadMatrix<P_out_"<<i<<",Q1d>(data, B.out["<<i<<"], s_B_out_"<<i<<");\n";
       if (useCollograd) {
         data->G.out[i] = basis_data->d_collograd1d;
-        code << "  __shared__ double s_G_out_"<<i<<"["<<Q1d*Q1d<<"];\n";
+        code << "  __shared__ CeedScalar s_G_out_"<<i<<"["<<Q1d*Q1d<<"];\n";
         code << "  loadMatrix<Q1d,Q1d>(data, G.out["<<i<<"], s_G_out_"<<i<<");\n";
       } else {
         data->G.out[i] = basis_data->d_grad1d;
-        code << "  __shared__ double s_G_out_"<<i<<"["<<P1d*Q1d<<"];\n";
+        code << "  __shared__ CeedScalar s_G_out_"<<i<<"["<<P1d*Q1d<<"];\n";
         code << "  loadMatrix<P_out_"<<i<<",Q1d>(data, G.out["<<i<<"], s_G_out_"<<i<<");\n";
       }
       break;
@@ -1017,9 +1376,117 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
       // LCOV_EXCL_STOP
     }
   }
+  // Input restrictions staged in shared memory, prefetched one element ahead
+  //   with cp.async so the loads overlap the basis actions and QFunction
+  Ceed_Cuda_gen *gen_data;
+  ierr = CeedGetData(ceed, &gen_data); CeedChk(ierr);
+  std::vector<string> prefetch(numinputfields);
+  std::ostringstream stage;
+  CeedInt stageSize = 0;
+  for (CeedInt i = 0; i < numinputfields && gen_data->prefetch; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    if (emode == CEED_EVAL_WEIGHT || (emode == CEED_EVAL_NONE && useCollograd))
+      continue;
+    ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(Erestrict, &ncomp);
+    CeedChk(ierr);
+    ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
+    if (basis != CEED_BASIS_COLLOCATED) {
+      if (nonTensor) {
+        ierr = CeedBasisGetNumNodes(basis, &P1d); CeedChk(ierr);
+      } else {
+        ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+      }
+    } else {
+      P1d = Q1d;
+    }
+    // 3D elements without 3D thread blocks hold a column of nodes per thread
+    const CeedInt size = ncomp*(dimname == "3d" ? P1d : 1);
+
+    bool isStrided;
+    ierr = CeedElemRestrictionIsStrided(Erestrict, &isStrided); CeedChk(ierr);
+    std::ostringstream call;
+    if (!isStrided) {
+      CeedInt compstride;
+      ierr = CeedElemRestrictionGetCompStride(Erestrict, &compstride);
+      CeedChk(ierr);
+      ierr = CeedElemRestrictionGetData(Erestrict, &restr_data); CeedChk(ierr);
+      data->indices.in[i] = restr_data->d_ind;
+      call << "prefetchDofsOffset"<<dimname<<"<ncomp_in_"<<i<<", "<<compstride<<", P_in_"<<i<<">(data, next, indices.in["<<i<<"], d_u"<<i<<", s_u"<<i<<");";
+    } else {
+      bool backendstrides;
+      ierr = CeedElemRestrictionHasBackendStrides(Erestrict, &backendstrides);
+      CeedChk(ierr);
+      CeedInt nelem;
+      ierr = CeedElemRestrictionGetNumElements(Erestrict, &nelem);
+      CeedChk(ierr);
+      CeedInt strides[3] = {1, elemsize*nelem, elemsize};
+      if (!backendstrides) {
+        ierr = CeedElemRestrictionGetStrides(Erestrict, &strides);
+        CeedChk(ierr);
+      }
+      call << "prefetchDofsStrided"<<dimname<<"<ncomp_in_"<<i<<",P_in_"<<i<<","<<strides[0]<<","<<strides[1]<<","<<strides[2]<<">(data, next, d_u"<<i<<", s_u"<<i<<");";
+    }
+    prefetch[i] = call.str();
+    stage << "  CeedScalar* s_u"<<i<<" = slice + (1 + "<<stageSize<<")*blockDim.x*blockDim.y*blockDim.z + data.tid;\n";
+    stage << "  const CeedInt stage_in_"<<i<<" = "<<size<<";\n";
+    stageSize += size;
+  }
+  // Staging must leave room for at least one element per thread block
+  const CeedInt T1d = CeedIntMax(Q1d, data->maxP1d);
+  const CeedInt elemThreads = T1d*(dimname == "1d" ? 1 : T1d)*
+                              (block3d ? T1d : 1);
+  if (elemThreads*(1 + stageSize)*sizeof(CeedScalar) >
+      CEED_CUDA_GEN_MAX_SHARED) {
+    stageSize = 0;
+    for (CeedInt i = 0; i < numinputfields; i++) prefetch[i].clear();
+  }
+  code << (stageSize ? stage.str() : "");
+  if (block3d) data->stageSizeBlock3d = stageSize;
+  else data->stageSize = stageSize;
+
   code << "\n  // -- Element loop --\n";
   code << "  __syncthreads();\n";
-  code << "  for (CeedInt elem = blockIdx.x*blockDim.z + threadIdx.z; elem < nelem; elem += gridDim.x*blockDim.z) {\n";
+  if (block3d) {
+    code << "  const CeedInt elemStart = blockIdx.x*(blockDim.z/T1d) + threadIdx.z/T1d;\n";
+    code << "  const CeedInt elemStride = gridDim.x*(blockDim.z/T1d);\n";
+  } else {
+    code << "  const CeedInt elemStart = blockIdx.x*blockDim.z + threadIdx.z;\n";
+    code << "  const CeedInt elemStride = gridDim.x*blockDim.z;\n";
+  }
+  if (stageSize) {
+    code << "  {\n";
+    code << "    // -- Prefetch inputs of the first element --\n";
+    code << "    const CeedInt next = elemStart;\n";
+    code << "    if (next < nelem) {\n";
+    for (CeedInt i = 0; i < numinputfields; i++)
+      if (!prefetch[i].empty()) code << "      "<<prefetch[i]<<"\n";
+    code << "    }\n";
+    code << "    copyAsyncCommit();\n";
+    code << "  }\n";
+  }
+  code << "  for (CeedInt elem = elemStart; elem < nelem; elem += elemStride) {\n";
+  if (stageSize) {
+    code << "    // -- Staged input restrictions, prefetching the next element --\n";
+    code << "    copyAsyncWait();\n";
+    for (CeedInt i = 0; i < numinputfields; i++) {
+      if (prefetch[i].empty()) continue;
+      code << "    CeedScalar r_u"<<i<<"[ncomp_in_"<<i<<"*P_in_"<<i<<"];\n";
+      code << "    loadStagedDofs<stage_in_"<<i<<">(data, s_u"<<i<<", r_u"<<i<<");\n";
+    }
+    code << "    {\n";
+    code << "      const CeedInt next = elem + elemStride;\n";
+    code << "      if (next < nelem) {\n";
+    for (CeedInt i = 0; i < numinputfields; i++)
+      if (!prefetch[i].empty()) code << "        "<<prefetch[i]<<"\n";
+    code << "      }\n";
+    code << "      copyAsyncCommit();\n";
+    code << "    }\n";
+  }
   // Input basis apply if needed
   // Generate the correct eval mode code for each input
   code << "    // -- Input field restrictions and basis actions --\n";
@@ -1035,8 +1502,8 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
     ierr = CeedElemRestrictionGetNumComponents(Erestrict, &ncomp);
     CeedChk(ierr);
 
-    // Restriction
-    if (emode != CEED_EVAL_WEIGHT &&
+    // Restriction, unless staged
+    if (emode != CEED_EVAL_WEIGHT && prefetch[i].empty() &&
         !((emode == CEED_EVAL_NONE) && useCollograd)) {
       code << "    CeedScalar r_u"<<i<<"[ncomp_in_"<<i<<"*P_in_"<<i<<"];\n";
       
@@ -1051,7 +1518,7 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
         code << "    // CompStride: "<<compstride<<"\n";
         ierr = CeedElemRestrictionGetData(Erestrict, &restr_data); CeedChk(ierr);
         data->indices.in[i] = restr_data->d_ind;
-        code << "    readDofsOffset"<<dim<<"d<ncomp_in_"<<i<<", "<<compstride<<", P_in_"<<i<<">(data, lsize_in_"<<i<<", elem, indices.in["<<i<<"], d_u"<<i<<", r_u"<<i<<");\n";
+        code << "    readDofsOffset"<<dimname<<"<ncomp_in_"<<i<<", "<<compstride<<", P_in_"<<i<<">(data, lsize_in_"<<i<<", elem, indices.in["<<i<<"], d_u"<<i<<", r_u"<<i<<");\n";
       } else {
         bool backendstrides;
         ierr = CeedElemRestrictionHasBackendStrides(Erestrict, &backendstrides);
@@ -1065,7 +1532,7 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
           CeedChk(ierr);
         }
         code << "    // Strides: {"<<strides[0]<<", "<<strides[1]<<", "<<strides[2]<<"}\n";
-        code << "    readDofsStrided"<<dim<<"d<ncomp_in_"<<i<<",P_in_"<<i<<","<<strides[0]<<","<<strides[1]<<","<<strides[2]<<">(data, elem, d_u"<<i<<", r_u"<<i<<");\n";
+        code << "    readDofsStrided"<<dimname<<"<ncomp_in_"<<i<<",P_in_"<<i<<","<<strides[0]<<","<<strides[1]<<","<<strides[2]<<">(data, elem, d_u"<<i<<", r_u"<<i<<");\n";
       }
     }
 
@@ -1079,23 +1546,31 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
       break;
     case CEED_EVAL_INTERP:
       code << "    CeedScalar r_t"<<i<<"[ncomp_in_"<<i<<"*Q1d];\n";
-      code << "    interp"<<dim<<"d<ncomp_in_"<<i<<",P_in_"<<i<<",Q1d>(data, r_u"<<i<<", s_B_in_"<<i<<", r_t"<<i<<");\n";
+      code << "    interp"<<dimname<<"<ncomp_in_"<<i<<",P_in_"<<i<<",Q1d>(data, r_u"<<i<<", s_B_in_"<<i<<", r_t"<<i<<");\n";
       break;
     case CEED_EVAL_GRAD:
       if (useCollograd) {
         code << "    CeedScalar r_t"<<i<<"[ncomp_in_"<<i<<"*Q1d];\n";
-        code << "    interp"<<dim<<"d<ncomp_in_"<<i<<",P_in_"<<i<<",Q1d>(data, r_u"<<i<<", s_B_in_"<<i<<", r_t"<<i<<");\n";
+        code << "    interp"<<dimname<<"<ncomp_in_"<<i<<",P_in_"<<i<<",Q1d>(data, r_u"<<i<<", s_B_in_"<<i<<", r_t"<<i<<");\n";
+      } else if (nonTensor) {
+        code << "    CeedScalar r_t"<<i<<"[ncomp_in_"<<i<<"*Dim];\n";
+        code << "    gradNonTensor<ncomp_in_"<<i<<",Dim,P_in_"<<i<<",Q1d>(data, r_u"<<i<<", s_G_in_"<<i<<", r_t"<<i<<");\n";
       } else {
         code << "    CeedScalar r_t"<<i<<"[ncomp_in_"<<i<<"*Dim*Q1d];\n";
-        code << "    grad"<<dim<<"d<ncomp_in_"<<i<<",P_in_"<<i<<",Q1d>(data, r_u"<<i<<", s_B_in_"<<i<<", s_G_in_"<<i<<", r_t"<<i<<");\n";
+        code << "    grad"<<dimname<<"<ncomp_in_"<<i<<",P_in_"<<i<<",Q1d>(data, r_u"<<i<<", s_B_in_"<<i<<", s_G_in_"<<i<<", r_t"<<i<<");\n";
       }
       break;
     case CEED_EVAL_WEIGHT:
       code << "    CeedScalar r_t"<<i<<"[Q1d];\n";
       ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
-      ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
-      data->W = basis_data->d_qweight1d;
-      code << "    weight"<<dim<<"d<Q1d>(data, W, r_t"<<i<<");\n";
+      if (nonTensor) {
+        ierr = CeedBasisGetData(basis, &nontensor_data); CeedChk(ierr);
+        data->W = nontensor_data->d_qweight;
+      } else {
+        ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
+        data->W = basis_data->d_qweight1d;
+      }
+      code << "    weight"<<dimname<<"<Q1d>(data, W, r_t"<<i<<");\n";
       break; // No action
     case CEED_EVAL_DIV:
       break; // TODO: Not implemented
@@ -1120,6 +1595,8 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
         code << "        r_tt"<<i<<"[j + i*Q1d] = 0.0;\n";
         code << "      }\n";
         code << "    }\n";
+      } else if (nonTensor) {
+        code << "    CeedScalar r_tt"<<i<<"[ncomp_out_"<<i<<"*Dim];\n";
       } else {
         code << "    CeedScalar r_tt"<<i<<"[ncomp_out_"<<i<<"*Dim*Q1d];\n";
       }
@@ -1246,7 +1723,7 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
   }
   code << "\n      // -- Apply QFunction --\n";
   code << "      "<<qFunctionName<<"(ctx, ";
-  if (dim != 3 || useCollograd) {
+  if (dim != 3 || useCollograd || nonTensor || block3d) {
     code << "1";
   } else {
     code << "Q1d";
@@ -1308,14 +1785,16 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
       break; // No action
     case CEED_EVAL_INTERP:
       code << "    CeedScalar r_v"<<i<<"[ncomp_out_"<<i<<"*P_out_"<<i<<"];\n";
-      code << "    interpTranspose"<<dim<<"d<ncomp_out_"<<i<<",P_out_"<<i<<",Q1d>(data, r_tt"<<i<<", s_B_out_"<<i<<", r_v"<<i<<");\n";
+      code << "    interpTranspose"<<dimname<<"<ncomp_out_"<<i<<",P_out_"<<i<<",Q1d>(data, r_tt"<<i<<", s_B_out_"<<i<<", r_v"<<i<<");\n";
       break;
     case CEED_EVAL_GRAD:
       code << "    CeedScalar r_v"<<i<<"[ncomp_out_"<<i<<"*P_out_"<<i<<"];\n";
       if (useCollograd) {
-        code << "    interpTranspose"<<dim<<"d<ncomp_out_"<<i<<",P_out_"<<i<<",Q1d>(data, r_tt"<<i<<", s_B_out_"<<i<<", r_v"<<i<<");\n";
+        code << "    interpTranspose"<<dimname<<"<ncomp_out_"<<i<<",P_out_"<<i<<",Q1d>(data, r_tt"<<i<<", s_B_out_"<<i<<", r_v"<<i<<");\n";
+      } else if (nonTensor) {
+        code << "    gradTransposeNonTensor<ncomp_out_"<<i<<",Dim,P_out_"<<i<<",Q1d>(data, r_tt"<<i<<", s_G_out_"<<i<<", r_v"<<i<<");\n";
       } else {
-        code << "    gradTranspose"<<dim<<"d<ncomp_out_"<<i<<",P_out_"<<i<<",Q1d>(data, r_tt"<<i<<", s_B_out_"<<i<<", s_G_out_"<<i<<", r_v"<<i<<");\n";
+        code << "    gradTranspose"<<dimname<<"<ncomp_out_"<<i<<",P_out_"<<i<<",Q1d>(data, r_tt"<<i<<", s_B_out_"<<i<<", s_G_out_"<<i<<", r_v"<<i<<");\n";
       }
       break;
     // LCOV_EXCL_START
@@ -1344,7 +1823,7 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
       code << "    // CompStride: "<<compstride<<"\n";
       ierr = CeedElemRestrictionGetData(Erestrict, &restr_data); CeedChk(ierr);
       data->indices.out[i] = restr_data->d_ind;
-      code << "    writeDofsOffset"<<dim<<"d<ncomp_out_"<<i<<", "<<compstride<<", P_out_"<<i<<">(data, lsize_out_"<<i<<", elem, indices.out["<<i<<"], r_v"<<i<<", d_v"<<i<<");\n";
+      code << "    writeDofsOffset"<<dimname<<"<ncomp_out_"<<i<<", "<<compstride<<", P_out_"<<i<<">(data, lsize_out_"<<i<<", elem, indices.out["<<i<<"], r_v"<<i<<", d_v"<<i<<");\n";
     } else {
       bool backendstrides;
       ierr = CeedElemRestrictionHasBackendStrides(Erestrict, &backendstrides);
@@ -1358,24 +1837,255 @@ extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
         CeedChk(ierr);
       }
       code << "    // Strides: {"<<strides[0]<<", "<<strides[1]<<", "<<strides[2]<<"}\n";
-      code << "    writeDofsStrided"<<dim<<"d<ncomp_out_"<<i<<",P_out_"<<i<<","<<strides[0]<<","<<strides[1]<<","<<strides[2]<<">(data, elem, r_v"<<i<<", d_v"<<i<<");\n";
+      code << "    writeDofsStrided"<<dimname<<"<ncomp_out_"<<i<<",P_out_"<<i<<","<<strides[0]<<","<<strides[1]<<","<<strides[2]<<">(data, elem, r_v"<<i<<", d_v"<<i<<");\n";
     }
   }
 
   code << "  }\n";
   code << "}\n";
   code << "// -----------------------------------------------------------------------------\n\n";
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Generate single operator kernel and start compiling it in the background
+//------------------------------------------------------------------------------
+extern "C" int CeedCudaGenOperatorPrepare(CeedOperator op) {
+
+  using std::ostringstream;
+  using std::string;
+  int ierr;
+  bool setupdone;
+  ierr = CeedOperatorIsSetupDone(op, &setupdone); CeedChk(ierr);
+  if (setupdone) return 0;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Cuda_gen *data;
+  ierr = CeedOperatorGetData(op, &data); CeedChk(ierr);
+  CeedQFunction qf;
+  CeedQFunction_Cuda_gen *qf_data;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  ierr = CeedQFunctionGetData(qf, &qf_data); CeedChk(ierr);
+  CeedInt Q, P1d, Q1d = 0, numelements, numinputfields, numoutputfields,
+          dim = 0;
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+  CeedQFunctionField *qfinputfields, *qfoutputfields;
+  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
+  CeedChk(ierr);
+  CeedEvalMode emode;
+  CeedBasis basis;
+  CeedBasis_Cuda_shared *basis_data;
+
+  // Field pointer tables, sized for the QFunction fields
+  const CeedInt numinslots = CeedIntMax(numinputfields, 1);
+  const CeedInt numslots = numinslots + CeedIntMax(numoutputfields, 1);
+  ierr = CeedCalloc(4*numslots, &data->tables); CeedChk(ierr);
+  data->tablebytes = numslots * sizeof(void *);
+  data->indices.in = (CeedInt **)data->tables;
+  data->indices.out = data->indices.in + numinslots;
+  data->fields.in = (const CeedScalar **)data->tables + numslots;
+  data->fields.out = (CeedScalar **)data->tables + numslots + numinslots;
+  data->B.in = (const CeedScalar **)data->tables + 2*numslots;
+  data->B.out = (CeedScalar **)data->tables + 2*numslots + numinslots;
+  data->G.in = (const CeedScalar **)data->tables + 3*numslots;
+  data->G.out = (CeedScalar **)data->tables + 3*numslots + numinslots;
+  const bool devicetables = 4*data->tablebytes > CEED_CUDA_MAX_FIELDS_BYTES;
+  if (devicetables) {
+    ierr = CeedCudaMalloc(ceed, &data->d_tables, 4*data->tablebytes);
+    CeedChk(ierr);
+  }
+  ierr = CeedCalloc(numoutputfields, &data->outvecs); CeedChk(ierr);
+
+  ostringstream code;
+  string devFunctions(deviceFunctions);
+
+  // Add atomicAdd function for old NVidia architectures
+  Ceed_Cuda *ceed_data;
+  ierr = CeedGetData(ceed, &ceed_data); CeedChk(ierr);
+  if (ceed_data->arch<60){
+    code << atomicAdd;
+  }
+
+  code << devFunctions;
+
+  // Asynchronous input staging for Ampere and newer
+  Ceed_Cuda_gen *gen_data;
+  ierr = CeedGetData(ceed, &gen_data); CeedChk(ierr);
+  if (gen_data->prefetch) {
+    code << copyAsync;
+  }
+
+  string qFunction(qf_data->qFunctionSource);
+  string qFunctionName(qf_data->qFunctionName);
+  string oper;
+  oper = "CeedKernel_Cuda_gen_" + qFunctionName;
+
+  code << "\n#define CEED_QFUNCTION(name) inline __device__ int name\n";
+  code << "\n#define CeedPragmaSIMD\n";
+  // Chunked QFunctions evaluate one quadrature point per thread
+  code << "#define CEED_CHUNK_WIDTH 1\n";
+  code << "#define CEED_QFUNCTION_CHUNK(name) "
+          "inline __device__ int name ## _chunk(void *, CeedInt, CeedInt, "
+          "CeedInt, const CeedScalar *const *, CeedScalar *const *); "
+          "CEED_QFUNCTION(name)(void *ctx, const CeedInt Q, "
+          "const CeedScalar *const *in, CeedScalar *const *out) { "
+          "for (CeedInt i = 0; i < Q; i++) { "
+          "int ierr = name ## _chunk(ctx, Q, i, 1, in, out); "
+          "if (ierr) return ierr; } return 0; } "
+          "inline __device__ int name ## _chunk\n";
+  code << "#define CeedForLanes(j, nlanes) "
+          "for (CeedInt j = 0; j < 1; j++)\n";
+
+  // Find dim and Q1d
+  //   Non-tensor bases use Q1d and P1d for the number of quadrature points
+  //   and nodes of the element
+  bool useCollograd = true, hasTensor = false, nonTensor = false;
+  data->maxP1d = 0;
+  for (CeedInt i = 0; i < numinputfields; i++) {
+    ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
+    if (basis != CEED_BASIS_COLLOCATED) {
+      ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+      CeedChk(ierr);
+
+      // Collect dim and Q1d
+      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+      bool isTensor;
+      ierr = CeedBasisIsTensor(basis, &isTensor); CeedChk(ierr);
+      if (isTensor) {
+        ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
+        ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+
+        // Check for collocated gradient
+        ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
+        useCollograd = useCollograd && basis_data->d_collograd1d;
+      } else {
+        ierr = CeedBasisGetNumQuadraturePoints(basis, &Q1d); CeedChk(ierr);
+        ierr = CeedBasisGetNumNodes(basis, &P1d); CeedChk(ierr);
+      }
+      if (P1d>data->maxP1d) data->maxP1d = P1d;
+      hasTensor = hasTensor || isTensor;
+      nonTensor = nonTensor || !isTensor;
+    }
+  }
+  // Check output bases for Q1d, dim as well
+  //   The only imput basis might be CEED_BASIS_COLLOCATED
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis); CeedChk(ierr);
+
+    if (basis != CEED_BASIS_COLLOCATED) {
+      ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+      CeedChk(ierr);
+
+      // Collect dim and Q1d
+      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+      bool isTensor;
+      ierr = CeedBasisIsTensor(basis, &isTensor); CeedChk(ierr);
+      if (isTensor) {
+        ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
+        ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+
+        // Check for collocated gradient
+        ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
+        useCollograd = useCollograd && basis_data->d_collograd1d;
+      } else {
+        ierr = CeedBasisGetNumQuadraturePoints(basis, &Q1d); CeedChk(ierr);
+        ierr = CeedBasisGetNumNodes(basis, &P1d); CeedChk(ierr);
+      }
+      if (P1d>data->maxP1d) data->maxP1d = P1d;
+      hasTensor = hasTensor || isTensor;
+      nonTensor = nonTensor || !isTensor;
+    }
+  }
+  if (hasTensor && nonTensor)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Backend does not implement operators mixing tensor and non-tensor bases");
+  // LCOV_EXCL_STOP
+  if (nonTensor) useCollograd = false;
+  // Non-tensor elements are laid out on threads like 1D elements
+  const CeedInt tdim = nonTensor ? 1 : dim;
+  data->dim = tdim;
+  data->Q1d = Q1d;
+
+  // Define CEED_Q_VLA
+  if (dim != 3 || useCollograd || nonTensor) {
+    code << "\n#define CEED_Q_VLA 1\n\n";
+  } else {
+    code << "\n#define CEED_Q_VLA "<<Q1d<<"\n\n";
+  }
+
+  code << qFunction;
+
+  // Setup
+  code << "\n// -----------------------------------------------------------------------------\n";
+  code << "\ntypedef struct { const CeedScalar* in["<<numinslots<<"]; CeedScalar* out["<<numslots-numinslots<<"]; } CudaFields;\n";
+  code << "typedef struct { CeedInt* in["<<numinslots<<"]; CeedInt* out["<<numslots-numinslots<<"]; } CudaFieldsInt;\n";
+  // Launch bounds, if requested with -DCEED_MAX_THREADS_PER_BLOCK in the JIT
+  //   options; the block size is then limited to match when tuning
+  code << "\n#ifdef CEED_MAX_THREADS_PER_BLOCK\n";
+  code << "#define CEED_LAUNCH_BOUNDS __launch_bounds__(CEED_MAX_THREADS_PER_BLOCK)\n";
+  code << "#else\n#define CEED_LAUNCH_BOUNDS\n#endif\n";
+  ierr = CeedCudaGenOperatorBuildKernel(op, code, oper, dim, Q1d, useCollograd,
+                                        nonTensor, devicetables, false);
+  CeedChk(ierr);
+
+  // 3D operators with high order bases also get a kernel on 3D thread blocks,
+  //   tried when tuning the launch configuration
+  //   Both kernels pass one quadrature point at a time to the QFunction
+  const CeedInt T1d = CeedIntMax(Q1d, data->maxP1d);
+  data->hasblock3d = dim == 3 && !nonTensor && useCollograd &&
+                     T1d >= CEED_CUDA_GEN_BLOCK3D_MIN_T1D &&
+                     T1d*T1d*T1d <= CEED_CUDA_GEN_MAX_THREADS &&
+                     !gen_data->elemsPerBlock &&
+                     numelements >= CEED_CUDA_GEN_TUNE_MIN_ELEMS;
+  if (data->hasblock3d) {
+    ierr = CeedCudaGenOperatorBuildKernel(op, code, oper + "_3dBlock", dim, Q1d,
+                                          useCollograd, nonTensor, devicetables,
+                                          true);
+    CeedChk(ierr);
+  }
 
   // View kernel for debugging
   CeedDebug(code.str().c_str());
 
-  ierr = CeedCompileCuda(ceed, code.str().c_str(), &data->module, 1,
-                         "T1d", CeedIntMax(Q1d, data->maxP1d));
-  CeedChk(ierr);
-  ierr = CeedGetKernelCuda(ceed, data->module, oper.c_str(), &data->op);
+  ierr = CeedCompileCudaAsync(ceed, code.str().c_str(), &data->jit, 1,
+                              "T1d", CeedIntMax(Q1d, data->maxP1d));
   CeedChk(ierr);
 
   ierr = CeedOperatorSetSetupDone(op); CeedChk(ierr);
   return 0;
 }
+
+//------------------------------------------------------------------------------
+// Build single operator kernel, waiting for its compilation
+//------------------------------------------------------------------------------
+extern "C" int CeedCudaGenOperatorBuild(CeedOperator op) {
+  int ierr;
+  ierr = CeedCudaGenOperatorPrepare(op); CeedChk(ierr);
+  CeedOperator_Cuda_gen *data;
+  ierr = CeedOperatorGetData(op, &data); CeedChk(ierr);
+  if (!data->jit) return 0;
+
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  ierr = CeedCompileCudaWait(ceed, &data->jit, &data->module); CeedChk(ierr);
+  CeedQFunction qf;
+  CeedQFunction_Cuda_gen *qf_data;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  ierr = CeedQFunctionGetData(qf, &qf_data); CeedChk(ierr);
+  std::string oper = "CeedKernel_Cuda_gen_" +
+                     std::string(qf_data->qFunctionName);
+  ierr = CeedGetKernelCuda(ceed, data->module, oper.c_str(), &data->op);
+  CeedChk(ierr);
+  if (data->hasblock3d) {
+    ierr = CeedGetKernelCuda(ceed, data->module, (oper + "_3dBlock").c_str(),
+                             &data->opblock3d); CeedChk(ierr);
+  }
+  return 0;
+}
 //------------------------------------------------------------------------------
@@ -14,4 +14,5 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
+CEED_INTERN int CeedCudaGenOperatorPrepare(CeedOperator op);
 CEED_INTERN int CeedCudaGenOperatorBuild(CeedOperator op);
\ No newline at end of file
@@ -24,10 +24,214 @@ static int CeedOperatorDestroy_Cuda_gen(CeedOperator op) {
   int ierr;
   CeedOperator_Cuda_gen *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  ierr = CeedCompileCudaWait(ceed, &impl->jit, NULL); CeedChk(ierr);
+  ierr = CeedCudaFree(ceed, impl->d_tables); CeedChk(ierr);
+  ierr = CeedFree(&impl->tables); CeedChk(ierr);
+  ierr = CeedFree(&impl->outvecs); CeedChk(ierr);
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Launch operator kernel with given number of elements per thread block
+//   The 3D thread block kernel stacks elements of thread1d threads in z
+//------------------------------------------------------------------------------
+static int CeedOperatorRunKernel_Cuda_gen(Ceed ceed,
+    CeedOperator_Cuda_gen *data, CeedInt nelem, bool block3d,
+    CeedInt elemsPerBlock, void **opargs) {
+  int ierr;
+  const CeedInt thread1d = CeedIntMax(data->Q1d, data->maxP1d);
+  const CeedInt thread2d = data->dim == 1 ? 1 : thread1d;
+  const CeedInt thread3d = block3d ? elemsPerBlock*thread1d : elemsPerBlock;
+  const CeedInt grid = nelem/elemsPerBlock +
+                       ((nelem/elemsPerBlock*elemsPerBlock<nelem) ? 1 : 0);
+  const CeedInt stageSize = block3d ? data->stageSizeBlock3d : data->stageSize;
+  const CeedInt sharedMem = thread3d*thread1d*thread2d*(1 + stageSize)*
+                            sizeof(CeedScalar);
+  if (data->d_tables) {
+    ierr = CeedCudaCopyFieldsToDevice(ceed, data->tables, 4*data->tablebytes,
+                                      &data->d_tables); CeedChk(ierr);
+  }
+  ierr = CeedRunKernelDimSharedCuda(ceed, block3d ? data->opblock3d : data->op,
+                                    grid, thread1d, thread2d, thread3d,
+                                    sharedMem, opargs);
+  CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Record the resource usage of the operator kernel at its tuned launch size,
+//   reported by CeedOperatorView()
+//------------------------------------------------------------------------------
+static int CeedOperatorSetKernelInfo_Cuda_gen(CeedOperator op,
+    CeedOperator_Cuda_gen *data) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedQFunction qf;
+  CeedQFunction_Cuda_gen *qf_data;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  ierr = CeedQFunctionGetData(qf, &qf_data); CeedChk(ierr);
+
+  const CeedInt thread1d = CeedIntMax(data->Q1d, data->maxP1d);
+  const CeedInt thread2d = data->dim == 1 ? 1 : thread1d;
+  const CeedInt thread3d = data->block3d ? data->elemsPerBlock*thread1d :
+                           data->elemsPerBlock;
+  const CeedInt blockSize = thread1d*thread2d*thread3d;
+  const CeedInt stageSize = data->block3d ? data->stageSizeBlock3d :
+                            data->stageSize;
+  char name[CEED_MAX_KERNEL_NAME];
+  snprintf(name, sizeof(name), "CeedKernel_Cuda_gen_%s%s",
+           qf_data->qFunctionName, data->block3d ? "_3dBlock" : "");
+  CeedKernelInfo info;
+  ierr = CeedGetKernelInfoCuda(ceed, data->block3d ? data->opblock3d : data->op,
+                              name, blockSize,
+                              blockSize*(1 + stageSize)*sizeof(CeedScalar),
+                              &info); CeedChk(ierr);
+  ierr = CeedOperatorSetKernelInfo(op, &info); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Tune number of elements per thread block
+//
+// Each candidate is timed on the operator's own input data, writing to
+//   scratch output arrays so the outputs are not modified. The fastest
+//   candidate is kept for the lifetime of the operator. Operators with a 3D
+//   thread block kernel also time it for each number of elements per block.
+//------------------------------------------------------------------------------
+static int CeedOperatorTuneElemsPerBlock_Cuda_gen(CeedOperator op,
+    CeedVector *outvecs, void **opargs) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Cuda_gen *ceed_data;
+  ierr = CeedGetData(ceed, &ceed_data); CeedChk(ierr);
+  CeedOperator_Cuda_gen *data;
+  ierr = CeedOperatorGetData(op, &data); CeedChk(ierr);
+  const CeedInt dim = data->dim;
+  const CeedInt thread1d = CeedIntMax(data->Q1d, data->maxP1d);
+
+  // Default for small problems or when tuning is not possible
+  CeedInt elemsPerBlock;
+  if (dim == 1) // Includes non-tensor elements, with thread1d up to P or Q
+    elemsPerBlock = CeedIntMax(CeedIntMin(32, 1024/thread1d), 1);
+  else if (dim == 2)
+    elemsPerBlock = thread1d<4? 16 : 2;
+  else
+    elemsPerBlock = thread1d<6? 4 : (thread1d<8? 2 : 1);
+
+  // User override
+  if (ceed_data->elemsPerBlock) {
+    data->elemsPerBlock = ceed_data->elemsPerBlock;
+    return 0;
+  }
+
+  // Limits from register and shared memory usage, and launch bounds
+  int maxThreads;
+  ierr = cuFuncGetAttribute(&maxThreads, CU_FUNC_ATTRIBUTE_MAX_THREADS_PER_BLOCK,
+                            data->op);
+  CeedChk_Cu(ceed, ierr);
+  const CeedInt elemThreads = thread1d*(dim == 1 ? 1 : thread1d);
+  const CeedInt maxElems = CeedIntMin(maxThreads / elemThreads,
+                                      CEED_CUDA_GEN_MAX_SHARED /
+                                      (elemThreads*(1 + data->stageSize)*
+                                       sizeof(CeedScalar)));
+  elemsPerBlock = CeedIntMax(CeedIntMin(elemsPerBlock, maxElems), 1);
+
+  CeedInt nelem;
+  ierr = CeedOperatorGetNumElements(op, &nelem); CeedChk(ierr);
+  if (nelem < CEED_CUDA_GEN_TUNE_MIN_ELEMS) {
+    data->elemsPerBlock = elemsPerBlock;
+    return 0;
+  }
+
+  // Scratch outputs
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedScalar **out, **scratch;
+  ierr = CeedCalloc(numoutputfields, &out); CeedChk(ierr);
+  ierr = CeedCalloc(numoutputfields, &scratch); CeedChk(ierr);
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    out[i] = data->fields.out[i];
+    if (!out[i]) continue;
+    for (CeedInt j = 0; j < i; j++)
+      if (out[j] == out[i]) scratch[i] = scratch[j];
+    if (!scratch[i]) {
+      CeedInt length;
+      ierr = CeedVectorGetLength(outvecs[i], &length); CeedChk(ierr);
+      ierr = CeedCudaMalloc(ceed, (void **)&scratch[i],
+                            length*sizeof(CeedScalar)); CeedChk(ierr);
+    }
+    data->fields.out[i] = scratch[i];
+  }
+
+  // Time candidates
+  cudaEvent_t start, stop;
+  ierr = cudaEventCreate(&start); CeedChk_Cu(ceed, ierr);
+  ierr = cudaEventCreate(&stop); CeedChk_Cu(ceed, ierr);
+  float besttime = -1;
+  bool block3d = false;
+  for (CeedInt b = 0; b < (data->hasblock3d ? 2 : 1); b++) {
+    CeedInt maxBlockElems = maxElems;
+    if (b) {
+      ierr = cuFuncGetAttribute(&maxThreads,
+                                CU_FUNC_ATTRIBUTE_MAX_THREADS_PER_BLOCK,
+                                data->opblock3d);
+      CeedChk_Cu(ceed, ierr);
+      maxBlockElems = CeedIntMin(maxThreads / (elemThreads*thread1d),
+                                 CEED_CUDA_GEN_MAX_SHARED /
+                                 (elemThreads*thread1d*
+                                  (1 + data->stageSizeBlock3d)*
+                                  sizeof(CeedScalar)));
+    }
+    for (CeedInt e = 1; e <= maxBlockElems &&
+         e <= CEED_CUDA_GEN_MAX_ELEMS_PER_BLOCK; e *= 2) {
+      ierr = CeedOperatorRunKernel_Cuda_gen(ceed, data, nelem, b, e, opargs);
+      CeedChk(ierr);
+      ierr = cudaEventRecord(start, 0); CeedChk_Cu(ceed, ierr);
+      for (CeedInt k = 0; k < CEED_CUDA_GEN_TUNE_REPS; k++) {
+        ierr = CeedOperatorRunKernel_Cuda_gen(ceed, data, nelem, b, e, opargs);
+        CeedChk(ierr);
+      }
+      ierr = cudaEventRecord(stop, 0); CeedChk_Cu(ceed, ierr);
+      ierr = cudaEventSynchronize(stop); CeedChk_Cu(ceed, ierr);
+      float time;
+      ierr = cudaEventElapsedTime(&time, start, stop); CeedChk_Cu(ceed, ierr);
+      CeedDebug("%selemsPerBlock %d: %g ms", b ? "3D thread blocks, " : "", e,
+                time/CEED_CUDA_GEN_TUNE_REPS);
+      if (besttime < 0 || time < besttime) {
+        besttime = time;
+        elemsPerBlock = e;
+        block3d = b;
+      }
+    }
+  }
+  ierr = cudaEventDestroy(start); CeedChk_Cu(ceed, ierr);
+  ierr = cudaEventDestroy(stop); CeedChk_Cu(ceed, ierr);
+
+  // Restore outputs
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    bool shared = false;
+    for (CeedInt j = 0; j < i; j++)
+      shared = shared || (scratch[j] == scratch[i]);
+    if (scratch[i] && !shared) {
+      ierr = CeedCudaFree(ceed, scratch[i]); CeedChk(ierr);
+    }
+    data->fields.out[i] = out[i];
+  }
+  ierr = CeedFree(&out); CeedChk(ierr);
+  ierr = CeedFree(&scratch); CeedChk(ierr);
+  data->elemsPerBlock = elemsPerBlock;
+  data->block3d = block3d;
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Apply and add to output
 //------------------------------------------------------------------------------
@@ -53,10 +257,11 @@ static int CeedOperatorApplyAdd_Cuda_gen(CeedOperator op, CeedVector invec,
   ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
   CeedChk(ierr);
   CeedEvalMode emode;
-  CeedVector vec, outvecs[16] = {};
+  CeedVector vec;
 
   //Creation of the operator
   ierr = CeedCudaGenOperatorBuild(op); CeedChk(ierr);
+  CeedVector *outvecs = data->outvecs;
 
   // Input vectors
   for (CeedInt i = 0; i < numinputfields; i++) {
@@ -110,35 +315,22 @@ static int CeedOperatorApplyAdd_Cuda_gen(CeedOperator op, CeedVector invec,
   }
 
   // Apply operator
-  void *opargs[] = {(void *) &nelem, &qf_data->d_c, &data->indices,
-                    &data->fields, &data->B, &data->G, &data->W
+  void *d_tables[4];
+  void *opargs[] = {(void *) &nelem, &qf_data->d_c, data->indices.in,
+                    data->fields.in, data->B.in, data->G.in, &data->W
                    };
-  const CeedInt dim = data->dim;
-  const CeedInt Q1d = data->Q1d;
-  const CeedInt P1d = data->maxP1d;
-  const CeedInt thread1d = CeedIntMax(Q1d, P1d);
-  if (dim==1) {
-    const CeedInt elemsPerBlock = 32;
-    CeedInt grid = nelem/elemsPerBlock + ( (nelem/elemsPerBlock*elemsPerBlock<nelem)
-                                           ? 1 : 0 );
-    CeedInt sharedMem = elemsPerBlock*thread1d*sizeof(CeedScalar);
-    ierr = CeedRunKernelDimSharedCuda(ceed, data->op, grid, thread1d, 1,
-                                      elemsPerBlock, sharedMem, opargs);
-  } else if (dim==2) {
-    const CeedInt elemsPerBlock = thread1d<4? 16 : 2;
-    CeedInt grid = nelem/elemsPerBlock + ( (nelem/elemsPerBlock*elemsPerBlock<nelem)
-                                           ? 1 : 0 );
-    CeedInt sharedMem = elemsPerBlock*thread1d*thread1d*sizeof(CeedScalar);
-    ierr = CeedRunKernelDimSharedCuda(ceed, data->op, grid, thread1d, thread1d,
-                                      elemsPerBlock, sharedMem, opargs);
-  } else if (dim==3) {
-    const CeedInt elemsPerBlock = thread1d<6? 4 : (thread1d<8? 2 : 1);
-    CeedInt grid = nelem/elemsPerBlock + ( (nelem/elemsPerBlock*elemsPerBlock<nelem)
-                                           ? 1 : 0 );
-    CeedInt sharedMem = elemsPerBlock*thread1d*thread1d*sizeof(CeedScalar);
-    ierr = CeedRunKernelDimSharedCuda(ceed, data->op, grid, thread1d, thread1d,
-                                      elemsPerBlock, sharedMem, opargs);
+  if (data->d_tables)
+    for (CeedInt k = 0; k < 4; k++) {
+      d_tables[k] = (char *)data->d_tables + k*data->tablebytes;
+      opargs[2 + k] = &d_tables[k];
+    }
+  if (!data->elemsPerBlock) {
+    ierr = CeedOperatorTuneElemsPerBlock_Cuda_gen(op, outvecs, opargs);
+    CeedChk(ierr);
+    ierr = CeedOperatorSetKernelInfo_Cuda_gen(op, data); CeedChk(ierr);
   }
+  ierr = CeedOperatorRunKernel_Cuda_gen(ceed, data, nelem, data->block3d,
+                                        data->elemsPerBlock, opargs);
   CeedChk(ierr);
 
   // Restore input arrays
@@ -185,18 +377,6 @@ static int CeedOperatorApplyAdd_Cuda_gen(CeedOperator op, CeedVector invec,
   return 0;
 }
 
-//------------------------------------------------------------------------------
-// Create FDM element inverse not supported
-//------------------------------------------------------------------------------
-static int CeedOperatorCreateFDMElementInverse_Cuda(CeedOperator op) {
-  // LCOV_EXCL_START
-  int ierr;
-  Ceed ceed;
-  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-  return CeedError(ceed, 1, "Backend does not implement FDM inverse creation");
-  // LCOV_EXCL_STOP
-}
-
 //------------------------------------------------------------------------------
 // Create operator
 //------------------------------------------------------------------------------
@@ -209,9 +389,8 @@ int CeedOperatorCreate_Cuda_gen(CeedOperator op) {
   ierr = CeedCalloc(1, &impl); CeedChk(ierr);
   ierr = CeedOperatorSetData(op, impl); CeedChk(ierr);
 
-  ierr = CeedSetBackendFunction(ceed, "Operator", op, "CreateFDMElementInverse",
-                                CeedOperatorCreateFDMElementInverse_Cuda);
-  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Prepare",
+                                CeedCudaGenOperatorPrepare); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
                                 CeedOperatorApplyAdd_Cuda_gen); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
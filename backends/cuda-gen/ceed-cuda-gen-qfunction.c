@@ -54,6 +54,16 @@ static int loadCudaFunction(CeedQFunction qf, char *c_src_file) {
   CeedQFunction_Cuda_gen *data;
   ierr = CeedQFunctionGetData(qf, &data); CeedChk(ierr);
 
+  // Use source embedded at build time, if provided
+  const char *code;
+  ierr = CeedQFunctionGetSourceCode(qf, &code); CeedChk(ierr);
+  if (code) {
+    const size_t len = strlen(code) + 1;
+    ierr = CeedMalloc(len, &data->qFunctionSource); CeedChk(ierr);
+    memcpy(data->qFunctionSource, code, len);
+    return 0;
+  }
+
   // Find source file
   char *cuda_file;
   ierr = CeedCalloc(CUDA_MAX_PATH, &cuda_file); CeedChk(ierr);
@@ -91,18 +101,10 @@ static int loadCudaFunction(CeedQFunction qf, char *c_src_file) {
     // LCOV_EXCL_STOP
   }
 
-  // Append typedef and save source string
-  // FIXME: the magic number 16 should be defined somewhere...
-  char *fields_string =
-    "typedef struct { const CeedScalar* inputs[16]; CeedScalar* outputs[16]; } Fields_Cuda_gen;";
-  ierr = CeedMalloc(1 + strlen(fields_string) + strlen(buffer),
-                    &data->qFunctionSource); CeedChk(ierr);
-  memcpy(data->qFunctionSource, fields_string, strlen(fields_string));
-  memcpy(data->qFunctionSource + strlen(fields_string), buffer,
-         strlen(buffer) + 1);
+  // Save source string
+  data->qFunctionSource = buffer;
 
   // Cleanup
-  ierr = CeedFree(&buffer); CeedChk(ierr);
   fclose(fp);
   ierr = CeedFree(&cuda_file); CeedChk(ierr);
   return 0;
@@ -14,6 +14,7 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
+#include <stdlib.h>
 #include <string.h>
 #include <stdarg.h>
 #include "ceed-cuda-gen.h"
@@ -30,21 +31,41 @@ static int CeedInit_Cuda_gen(const char *resource, Ceed ceed) {
   // LCOV_EXCL_STOP
 
   Ceed ceedshared;
-  CeedInit("/gpu/cuda/shared", &ceedshared);
+  char sharedresource[CEED_MAX_RESOURCE_LEN];
+  ierr = CeedCudaDelegateResource(resource, "/gpu/cuda/shared",
+                                   sharedresource); CeedChk(ierr);
+  CeedInit(sharedresource, &ceedshared);
   ierr = CeedSetDelegate(ceed, ceedshared); CeedChk(ierr);
 
   Ceed_Cuda_gen *data;
   ierr = CeedCalloc(1, &data); CeedChk(ierr);
   ierr = CeedSetData(ceed, data); CeedChk(ierr);
   ierr = CeedCudaInit(ceed, resource, nrc); CeedChk(ierr);
+  ierr = CeedCudaShareDevice(ceed, ceedshared); CeedChk(ierr);
 
-  const char fallbackresource[] = "/gpu/cuda/ref";
+  // Elements per thread block are tuned per operator unless set by the user
+  const char *elemsPerBlock = getenv("CEED_GEN_ELEMS_PER_BLOCK");
+  data->elemsPerBlock = elemsPerBlock ? CeedIntMax(atoi(elemsPerBlock), 0) : 0;
+
+  // Inputs are prefetched into shared memory on devices with cp.async
+  const char *prefetch = getenv("CEED_GEN_PREFETCH");
+  data->prefetch = (!prefetch || atoi(prefetch)) && data->base.arch >= 80;
+
+  char fallbackresource[CEED_MAX_RESOURCE_LEN];
+  ierr = CeedCudaDelegateResource(resource, "/gpu/cuda/ref",
+                                   fallbackresource); CeedChk(ierr);
   ierr = CeedSetOperatorFallbackResource(ceed, fallbackresource); CeedChk(ierr);
 
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "QFunctionCreate",
                                 CeedQFunctionCreate_Cuda_gen); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate",
                                 CeedOperatorCreate_Cuda_gen); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "MemoryPoolTrim",
+                                CeedMemoryPoolTrim_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "MemoryPoolGetUsage",
+                                CeedMemoryPoolGetUsage_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "ShareDevice",
+                                CeedCudaShareDevice); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy",
                                 CeedDestroy_Cuda); CeedChk(ierr);
   return 0;
@@ -19,20 +19,41 @@
 #include <cuda_runtime.h>
 #include "../cuda/ceed-cuda.h"
 
-typedef struct { const CeedScalar *in[16]; CeedScalar *out[16]; } CudaFields;
-typedef struct { CeedInt *in[16]; CeedInt *out[16]; } CudaFieldsInt;
+// Operator kernel launch tuning
+#define CEED_CUDA_GEN_MAX_ELEMS_PER_BLOCK 64
+#define CEED_CUDA_GEN_MAX_SHARED (48*1024)
+#define CEED_CUDA_GEN_TUNE_MIN_ELEMS 1024
+#define CEED_CUDA_GEN_TUNE_REPS 3
+#define CEED_CUDA_GEN_MAX_THREADS 1024
+#define CEED_CUDA_GEN_BLOCK3D_MIN_T1D 6
+
+// Pointer tables into one host block, each laid out like the kernel struct of
+//   an input and an output array
+typedef struct { const CeedScalar **in; CeedScalar **out; } CudaFields;
+typedef struct { CeedInt **in; CeedInt **out; } CudaFieldsInt;
 
 typedef struct {
   CeedInt dim;
   CeedInt Q1d;
   CeedInt maxP1d;
+  CeedInt elemsPerBlock; /// Tuned on first apply, unless set by the user
+  CeedCudaJit *jit;   /// Kernel compilation started by Prepare, if pending
   CUmodule module;
   CUfunction op;
+  bool hasblock3d;    /// Module also has a kernel on 3D thread blocks
+  bool block3d;       /// Tuned choice of the 3D thread block kernel
+  CUfunction opblock3d;
+  CeedInt stageSize;  /// Scalars per thread staged by input prefetching
+  CeedInt stageSizeBlock3d; /// Same, for the 3D thread block kernel
   CudaFieldsInt indices;
   CudaFields fields;
   CudaFields B;
   CudaFields G;
   CeedScalar *W;
+  void **tables;     /// Host block holding the indices, fields, B, and G tables
+  size_t tablebytes; /// Bytes of each table
+  void *d_tables;    /// Device copy of the block, if too large for parameters
+  CeedVector *outvecs;
 } CeedOperator_Cuda_gen;
 
 typedef struct {
@@ -43,6 +64,8 @@ typedef struct {
 
 typedef struct {
   Ceed_Cuda base;
+  CeedInt elemsPerBlock; /// User override from CEED_GEN_ELEMS_PER_BLOCK
+  bool prefetch;         /// Stage inputs with cp.async, see CEED_GEN_PREFETCH
 } Ceed_Cuda_gen;
 
 CEED_INTERN int CeedQFunctionCreate_Cuda_gen(CeedQFunction qf);
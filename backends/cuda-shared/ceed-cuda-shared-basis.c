@@ -14,6 +14,7 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
+#include <string.h>
 #include "ceed-cuda-shared.h"
 
 //------------------------------------------------------------------------------
@@ -22,6 +23,16 @@
 // *INDENT-OFF*
 static const char *kernelsShared = QUOTE(
 
+//------------------------------------------------------------------------------
+// Load basis matrix into shared memory, shared by all elements in the block
+//------------------------------------------------------------------------------
+inline __device__ void loadMatrix(const CeedScalar *d_B, CeedScalar *B) {
+  const int tid = threadIdx.x + threadIdx.y*blockDim.x +
+                  threadIdx.z*blockDim.y*blockDim.x;
+  for (int i = tid; i < P1D*Q1D; i += blockDim.x*blockDim.y*blockDim.z)
+    B[i] = d_B[i];
+}
+
 //------------------------------------------------------------------------------
 // Sum input into output
 //------------------------------------------------------------------------------
@@ -702,10 +713,13 @@ __device__ void weight3d(const CeedInt nelem, const CeedScalar *qweight1d,
 // Interp kernel by dim
 //------------------------------------------------------------------------------
 extern "C" __global__ void interp(const CeedInt nelem, const int transpose,
-                                  const CeedScalar *c_B,
+                                  const CeedScalar *d_B,
                                   const CeedScalar *__restrict__ d_U,
                                   CeedScalar *__restrict__ d_V) {
-  extern __shared__ double slice[];
+  extern __shared__ CeedScalar slice[];
+  __shared__ CeedScalar c_B[P1D*Q1D];
+  loadMatrix(d_B, c_B);
+  __syncthreads();
   if (BASIS_DIM == 1) {
     interp1d(nelem, transpose, c_B, d_U, d_V, slice);
   } else if (BASIS_DIM == 2) {
@@ -719,10 +733,15 @@ extern "C" __global__ void interp(const CeedInt nelem, const int transpose,
 // Grad kernel by dim
 //------------------------------------------------------------------------------
 extern "C" __global__ void grad(const CeedInt nelem, const int transpose,
-                                const CeedScalar *c_B, const CeedScalar *c_G,
+                                const CeedScalar *d_B, const CeedScalar *d_G,
                                 const CeedScalar *__restrict__ d_U,
                                 CeedScalar *__restrict__ d_V) {
-  extern __shared__ double slice[];
+  extern __shared__ CeedScalar slice[];
+  __shared__ CeedScalar c_B[P1D*Q1D];
+  __shared__ CeedScalar c_G[P1D*Q1D];
+  loadMatrix(d_B, c_B);
+  loadMatrix(d_G, c_G);
+  __syncthreads();
   if (BASIS_DIM == 1) {
     grad1d(nelem, transpose, c_B, c_G, d_U, d_V, slice);
   } else if (BASIS_DIM == 2) {
@@ -751,13 +770,140 @@ extern "C" __global__ void weight(const CeedInt nelem,
 // *INDENT-ON*
 
 //------------------------------------------------------------------------------
-// Device initalization
+// Tensor core kernels for 3D double precision bases, compiled on sm_80 and
+//   later when CEED_TENSOR_CORES is set
+//
+// Each contraction is a GEMM Out[n][r] = sum_k In[r][k] M[n][k] over the rows
+//   r of the two uncontracted directions, computed by warps in 8x8 tiles with
+//   the fp64 m8n8k4 MMA instruction. Storing the output transposed rotates the
+//   next contracted direction to the fastest index, so three contractions
+//   return the element to its x-fastest layout.
+//------------------------------------------------------------------------------
+// *INDENT-OFF*
+static const char *kernelsSharedTensorCores = QUOTE(
+
+//------------------------------------------------------------------------------
+// Contract the fastest direction of In, M[n][k] = B[n*sn + k*sk]
+//------------------------------------------------------------------------------
+inline __device__ void contractTC(const CeedScalar *In, CeedScalar *Out,
+                                  const int R, const int K, const int N,
+                                  const CeedScalar *B, const int sn,
+                                  const int sk, const bool add) {
+  const int lane = threadIdx.x % 32, g = lane / 4, t = lane % 4;
+  const int tilesN = (N + 7) / 8;
+  for (int tile = threadIdx.x / 32; tile < ((R + 7) / 8)*tilesN;
+       tile += blockDim.x / 32) {
+    const int r = (tile / tilesN)*8 + g;
+    const int nb = (tile % tilesN)*8 + g;
+    const int nc = (tile % tilesN)*8 + 2*t;
+    double c0 = add && r < R && nc < N ? Out[nc*R + r] : 0.0;
+    double c1 = add && r < R && nc + 1 < N ? Out[(nc + 1)*R + r] : 0.0;
+    for (int k0 = 0; k0 < K; k0 += 4) {
+      const int k = k0 + t;
+      const double a = r < R && k < K ? In[r*K + k] : 0.0;
+      const double b = nb < N && k < K ? B[nb*sn + k*sk] : 0.0;
+      double d0, d1;
+      asm volatile("mma.sync.aligned.m8n8k4.row.col.f64.f64.f64.f64 "
+                   "{%0, %1}, {%2}, {%3}, {%4, %5};"
+                   : "=d"(d0), "=d"(d1) : "d"(a), "d"(b), "d"(c0), "d"(c1));
+      c0 = d0;
+      c1 = d1;
+    }
+    if (r < R && nc < N)
+      Out[nc*R + r] = c0;
+    if (r < R && nc + 1 < N)
+      Out[(nc + 1)*R + r] = c1;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Apply the 1D matrices in x, y, z to an element in s_0, result in s_out
+//------------------------------------------------------------------------------
+inline __device__ void contract3dTC(CeedScalar *s_0, CeedScalar *s_1,
+                                    CeedScalar *s_out, const int transpose,
+                                    const CeedScalar *X, const CeedScalar *Y,
+                                    const CeedScalar *Z, const bool add) {
+  const int I = transpose ? Q1D : P1D, O = transpose ? P1D : Q1D;
+  const int sn = transpose ? 1 : P1D, sk = transpose ? P1D : 1;
+  contractTC(s_0, s_1, I*I, I, O, X, sn, sk, false);
+  __syncthreads();
+  contractTC(s_1, s_0, O*I, I, O, Y, sn, sk, false);
+  __syncthreads();
+  contractTC(s_0, s_out, O*O, I, O, Z, sn, sk, add);
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// Copy between global and shared memory
+//------------------------------------------------------------------------------
+inline __device__ void copyTC(const CeedScalar *from, CeedScalar *to,
+                              const int n) {
+  for (int i = threadIdx.x; i < n; i += blockDim.x)
+    to[i] = from[i];
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// Interp kernel, one element per block
+//------------------------------------------------------------------------------
+extern "C" __global__ void interpTC(const CeedInt nelem, const int transpose,
+                                    const CeedScalar *d_B,
+                                    const CeedScalar *__restrict__ d_U,
+                                    CeedScalar *__restrict__ d_V) {
+  __shared__ CeedScalar s_B[P1D*Q1D];
+  __shared__ CeedScalar s_T[2][T1D*T1D*T1D];
+  loadMatrix(d_B, s_B);
+  const int I = transpose ? BASIS_NQPT : BASIS_ELEMSIZE;
+  const int O = transpose ? BASIS_ELEMSIZE : BASIS_NQPT;
+  for (int elem = blockIdx.x; elem < nelem; elem += gridDim.x)
+    for (int comp = 0; comp < BASIS_NCOMP; comp++) {
+      copyTC(d_U + (elem + comp*nelem)*I, s_T[0], I);
+      contract3dTC(s_T[0], s_T[1], s_T[1], transpose, s_B, s_B, s_B, false);
+      copyTC(s_T[1], d_V + (elem + comp*nelem)*O, O);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Grad kernel, one element per block
 //------------------------------------------------------------------------------
-int CeedCudaInitInterp(CeedScalar *d_B, CeedInt P1d, CeedInt Q1d,
-                       CeedScalar **c_B);
-int CeedCudaInitInterpGrad(CeedScalar *d_B, CeedScalar *d_G, CeedInt P1d,
-                           CeedInt Q1d, CeedScalar **c_B_ptr,
-                           CeedScalar **c_G_ptr);
+extern "C" __global__ void gradTC(const CeedInt nelem, const int transpose,
+                                  const CeedScalar *d_B, const CeedScalar *d_G,
+                                  const CeedScalar *__restrict__ d_U,
+                                  CeedScalar *__restrict__ d_V) {
+  __shared__ CeedScalar s_B[P1D*Q1D];
+  __shared__ CeedScalar s_G[P1D*Q1D];
+  __shared__ CeedScalar s_T[3][T1D*T1D*T1D];
+  loadMatrix(d_B, s_B);
+  loadMatrix(d_G, s_G);
+  const int I = transpose ? BASIS_NQPT : BASIS_ELEMSIZE;
+  const int O = transpose ? BASIS_ELEMSIZE : BASIS_NQPT;
+  const int stride = BASIS_NCOMP*nelem*BASIS_NQPT;
+  for (int elem = blockIdx.x; elem < nelem; elem += gridDim.x)
+    for (int comp = 0; comp < BASIS_NCOMP; comp++) {
+      const int offset = elem + comp*nelem;
+      if (!transpose)
+        copyTC(d_U + offset*I, s_T[2], I);
+      for (int dim = 0; dim < 3; dim++) {
+        // Derivative matrix in direction dim, interpolation in the others
+        const CeedScalar *X = dim == 0 ? s_G : s_B;
+        const CeedScalar *Y = dim == 1 ? s_G : s_B;
+        const CeedScalar *Z = dim == 2 ? s_G : s_B;
+        if (transpose) {
+          copyTC(d_U + offset*I + dim*stride, s_T[0], I);
+          contract3dTC(s_T[0], s_T[1], s_T[2], 1, X, Y, Z, dim > 0);
+        } else {
+          copyTC(s_T[2], s_T[0], I);
+          contract3dTC(s_T[0], s_T[1], s_T[1], 0, X, Y, Z, false);
+          copyTC(s_T[1], d_V + offset*O + dim*stride, O);
+        }
+      }
+      if (transpose)
+        copyTC(s_T[2], d_V + offset*O, O);
+    }
+}
+
+);
+// *INDENT-ON*
 
 //------------------------------------------------------------------------------
 // Apply basis
@@ -769,8 +915,6 @@ int CeedBasisApplyTensor_Cuda_shared(CeedBasis basis, const CeedInt nelem,
   int ierr;
   Ceed ceed;
   ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
-  Ceed_Cuda_shared *ceed_Cuda;
-  CeedGetData(ceed, &ceed_Cuda); CeedChk(ierr);
   CeedBasis_Cuda_shared *data;
   CeedBasisGetData(basis, &data); CeedChk(ierr);
   const CeedInt transpose = tmode == CEED_TRANSPOSE;
@@ -790,7 +934,8 @@ int CeedBasisApplyTensor_Cuda_shared(CeedBasis basis, const CeedInt nelem,
   if (tmode == CEED_TRANSPOSE) {
     CeedInt length;
     ierr = CeedVectorGetLength(v, &length); CeedChk(ierr);
-    ierr = cudaMemset(d_v, 0, length * sizeof(CeedScalar)); CeedChk(ierr);
+    ierr = cudaMemsetAsync(d_v, 0, length * sizeof(CeedScalar),
+                           CeedCudaGetStream()); CeedChk(ierr);
   }
 
   // Apply basis operation
@@ -800,12 +945,14 @@ int CeedBasisApplyTensor_Cuda_shared(CeedBasis basis, const CeedInt nelem,
     ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
     ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
     CeedInt thread1d = CeedIntMax(Q1d, P1d);
-    ierr = CeedCudaInitInterp(data->d_interp1d, P1d, Q1d, &data->c_B);
-    CeedChk(ierr);
-    void *interpargs[] = {(void *) &nelem, (void *) &transpose, &data->c_B,
-                          &d_u, &d_v
+    void *interpargs[] = {(void *) &nelem, (void *) &transpose,
+                          &data->d_interp1d, &d_u, &d_v
                          };
-    if (dim == 1) {
+    if (data->interpTC) {
+      ierr = CeedRunKernelCuda(ceed, data->interpTC, nelem,
+                               CEED_CUDA_SHARED_TC_THREADS, interpargs);
+      CeedChk(ierr);
+    } else if (dim == 1) {
       CeedInt elemsPerBlock = 32;
       CeedInt grid = nelem/elemsPerBlock + ( (nelem/elemsPerBlock*elemsPerBlock<nelem)
                                              ? 1 : 0 );
@@ -838,13 +985,14 @@ int CeedBasisApplyTensor_Cuda_shared(CeedBasis basis, const CeedInt nelem,
     ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
     ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
     CeedInt thread1d = CeedIntMax(Q1d, P1d);
-    ierr = CeedCudaInitInterpGrad(data->d_interp1d, data->d_grad1d, P1d,
-                                  Q1d, &data->c_B, &data->c_G);
-    CeedChk(ierr);
-    void *gradargs[] = {(void *) &nelem, (void *) &transpose, &data->c_B,
-                        &data->c_G, &d_u, &d_v
+    void *gradargs[] = {(void *) &nelem, (void *) &transpose,
+                        &data->d_interp1d, &data->d_grad1d, &d_u, &d_v
                        };
-    if (dim == 1) {
+    if (data->gradTC) {
+      ierr = CeedRunKernelCuda(ceed, data->gradTC, nelem,
+                               CEED_CUDA_SHARED_TC_THREADS, gradargs);
+      CeedChk(ierr);
+    } else if (dim == 1) {
       CeedInt elemsPerBlock = 32;
       CeedInt grid = nelem/elemsPerBlock + ( (nelem/elemsPerBlock*elemsPerBlock<nelem)
                                              ? 1 : 0 );
@@ -933,10 +1081,10 @@ static int CeedBasisDestroy_Cuda_shared(CeedBasis basis) {
 
   CeedChk_Cu(ceed, cuModuleUnload(data->module));
 
-  ierr = cudaFree(data->d_qweight1d); CeedChk_Cu(ceed, ierr);
-  ierr = cudaFree(data->d_interp1d); CeedChk_Cu(ceed, ierr);
-  ierr = cudaFree(data->d_grad1d); CeedChk_Cu(ceed, ierr);
-  ierr = cudaFree(data->d_collograd1d); CeedChk_Cu(ceed, ierr);
+  ierr = CeedCudaFree(ceed, data->d_qweight1d); CeedChk(ierr);
+  ierr = CeedCudaFree(ceed, data->d_interp1d); CeedChk(ierr);
+  ierr = CeedCudaFree(ceed, data->d_grad1d); CeedChk(ierr);
+  ierr = CeedCudaFree(ceed, data->d_collograd1d); CeedChk(ierr);
 
   ierr = CeedFree(&data); CeedChk(ierr);
 
@@ -960,18 +1108,22 @@ int CeedBasisCreateTensorH1_Cuda_shared(CeedInt dim, CeedInt P1d, CeedInt Q1d,
 
   // Copy basis data to GPU
   const CeedInt qBytes = Q1d * sizeof(CeedScalar);
-  ierr = cudaMalloc((void **)&data->d_qweight1d, qBytes); CeedChk_Cu(ceed, ierr);
+  ierr = CeedCudaMalloc(ceed, (void **)&data->d_qweight1d, qBytes);
+  CeedChk(ierr);
   ierr = cudaMemcpy(data->d_qweight1d, qweight1d, qBytes,
                     cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
 
   const CeedInt iBytes = qBytes * P1d;
-  ierr = cudaMalloc((void **)&data->d_interp1d, iBytes); CeedChk_Cu(ceed, ierr);
+  ierr = CeedCudaMalloc(ceed, (void **)&data->d_interp1d, iBytes);
+  CeedChk(ierr);
   ierr = cudaMemcpy(data->d_interp1d, interp1d, iBytes,
                     cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
 
-  ierr = cudaMalloc((void **)&data->d_grad1d, iBytes); CeedChk_Cu(ceed, ierr);
+  ierr = CeedCudaMalloc(ceed, (void **)&data->d_grad1d, iBytes); CeedChk(ierr);
   ierr = cudaMemcpy(data->d_grad1d, grad1d, iBytes,
                     cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
+  ierr = CeedBasisTrackMemory(basis, CEED_MEMSPACE_DEVICE, qBytes + 2*iBytes);
+  CeedChk(ierr);
 
   // Compute collocated gradient and copy to GPU
   data->d_collograd1d = NULL;
@@ -979,17 +1131,36 @@ int CeedBasisCreateTensorH1_Cuda_shared(CeedInt dim, CeedInt P1d, CeedInt Q1d,
     CeedScalar *collograd1d;
     ierr = CeedMalloc(Q1d*Q1d, &collograd1d); CeedChk(ierr);
     ierr = CeedBasisGetCollocatedGrad(basis, collograd1d); CeedChk(ierr);
-    ierr = cudaMalloc((void **)&data->d_collograd1d, qBytes * Q1d);
-    CeedChk_Cu(ceed, ierr);
+    ierr = CeedCudaMalloc(ceed, (void **)&data->d_collograd1d, qBytes * Q1d);
+    CeedChk(ierr);
     ierr = cudaMemcpy(data->d_collograd1d, collograd1d, qBytes * Q1d,
                       cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
+    ierr = CeedBasisTrackMemory(basis, CEED_MEMSPACE_DEVICE, qBytes * Q1d);
+    CeedChk(ierr);
     ierr = CeedFree(&collograd1d); CeedChk(ierr);
   }
 
+  // Tensor core kernels for high order 3D bases whose work arrays fit in
+  //   static shared memory
+  Ceed_Cuda *ceed_data;
+  ierr = CeedGetData(ceed, &ceed_data); CeedChk(ierr);
+  const CeedInt T1d = CeedIntMax(Q1d, P1d);
+  const bool tensorcores = ceed_data->tensorcores && dim == 3 && P1d >= 6 &&
+                           (3*T1d*T1d*T1d + 2*P1d*Q1d)*sizeof(CeedScalar) <=
+                           48*1024;
+  char *source = (char *)kernelsShared;
+  if (tensorcores) {
+    const size_t len = strlen(kernelsShared);
+    ierr = CeedMalloc(len + strlen(kernelsSharedTensorCores) + 1, &source);
+    CeedChk(ierr);
+    memcpy(source, kernelsShared, len);
+    strcpy(&source[len], kernelsSharedTensorCores);
+  }
+
   // Compile basis kernels
   CeedInt ncomp;
   ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
-  ierr = CeedCompileCuda(ceed, kernelsShared, &data->module, 8,
+  ierr = CeedCompileCuda(ceed, source, &data->module, 8,
                          "Q1D", Q1d,
                          "P1D", P1d,
                          "T1D", CeedIntMax(Q1d, P1d),
@@ -1006,6 +1177,13 @@ int CeedBasisCreateTensorH1_Cuda_shared(CeedInt dim, CeedInt P1d, CeedInt Q1d,
   CeedChk(ierr);
   ierr = CeedGetKernelCuda(ceed, data->module, "weight", &data->weight);
   CeedChk(ierr);
+  if (tensorcores) {
+    ierr = CeedFree(&source); CeedChk(ierr);
+    ierr = CeedGetKernelCuda(ceed, data->module, "interpTC", &data->interpTC);
+    CeedChk(ierr);
+    ierr = CeedGetKernelCuda(ceed, data->module, "gradTC", &data->gradTC);
+    CeedChk(ierr);
+  }
 
   ierr = CeedBasisSetData(basis, data); CeedChk(ierr);
 
@@ -31,17 +31,27 @@ static int CeedInit_Cuda_shared(const char *resource, Ceed ceed) {
   ierr = CeedSetDeterministic(ceed, true); CeedChk(ierr);
 
   Ceed ceedref;
-  CeedInit("/gpu/cuda/ref", &ceedref);
+  char refresource[CEED_MAX_RESOURCE_LEN];
+  ierr = CeedCudaDelegateResource(resource, "/gpu/cuda/ref", refresource);
+  CeedChk(ierr);
+  CeedInit(refresource, &ceedref);
   ierr = CeedSetDelegate(ceed, ceedref); CeedChk(ierr);
 
   Ceed_Cuda_shared *data;
   ierr = CeedCalloc(1, &data); CeedChk(ierr);
   ierr = CeedSetData(ceed, data); CeedChk(ierr);
   ierr = CeedCudaInit(ceed, resource, nrc); CeedChk(ierr);
+  ierr = CeedCudaShareDevice(ceed, ceedref); CeedChk(ierr);
 
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "BasisCreateTensorH1",
                                 CeedBasisCreateTensorH1_Cuda_shared);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "MemoryPoolTrim",
+                                CeedMemoryPoolTrim_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "MemoryPoolGetUsage",
+                                CeedMemoryPoolGetUsage_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "ShareDevice",
+                                CeedCudaShareDevice); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy",
                                 CeedDestroy_Cuda); CeedChk(ierr);
   CeedChk(ierr);
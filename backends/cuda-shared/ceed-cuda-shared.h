@@ -20,17 +20,20 @@
 #include <cuda_runtime.h>
 #include "../cuda/ceed-cuda.h"
 
+// Threads per block of the tensor core kernels, a multiple of the warp size
+#define CEED_CUDA_SHARED_TC_THREADS 128
+
 typedef struct {
   CUmodule module;
   CUfunction interp;
   CUfunction grad;
   CUfunction weight;
+  CUfunction interpTC; // Tensor core kernels, or NULL when not used
+  CUfunction gradTC;
   CeedScalar *d_interp1d;
   CeedScalar *d_grad1d;
   CeedScalar *d_collograd1d;
   CeedScalar *d_qweight1d;
-  CeedScalar *c_B;
-  CeedScalar *c_G;
 } CeedBasis_Cuda_shared;
 
 typedef struct {
@@ -54,6 +54,13 @@ extern "C" __global__ void interp(const CeedInt nelem, const int transpose,
     for (CeedInt comp = 0; comp < BASIS_NCOMP; ++comp) {
       const CeedScalar *cur_u = u + elem * u_stride + comp * u_comp_stride;
       CeedScalar *cur_v = v + elem * v_stride + comp * v_comp_stride;
+      // Collocated basis, interpolation is the identity
+      if (BASIS_COLLOCATED) {
+        for (CeedInt k = i; k < u_size; k += blockDim.x) {
+          cur_v[k] = cur_u[k];
+        }
+        continue;
+      }
       for (CeedInt k = i; k < u_size; k += blockDim.x) {
         s_buf1[k] = cur_u[k];
       }
@@ -129,6 +136,27 @@ extern "C" __global__ void grad(const CeedInt nelem, const int transpose,
                                   comp * u_comp_stride;
         CeedScalar *cur_v = v + elem * v_stride + dim1 * v_dim_stride + comp *
                             v_comp_stride;
+        // Collocated basis, one 1D derivative along dim1
+        if (BASIS_COLLOCATED) {
+          for (CeedInt d = 0; d <= dim1; d++) {
+            pre /= P;
+            if (d < dim1) post *= Q;
+          }
+          for (CeedInt k = i; k < BASIS_NQPT; k += blockDim.x) {
+            const CeedInt c = k % post;
+            const CeedInt j = (k / post) % Q;
+            const CeedInt a = k / (post * Q);
+            CeedScalar vk = 0;
+            for (CeedInt b = 0; b < P; b++)
+              vk += s_grad1d[j * stride0 + b * stride1] * cur_u[(a * P + b) * post + c];
+
+            if (transpose)
+              cur_v[k] += vk;
+            else
+              cur_v[k] = vk;
+          }
+          continue;
+        }
         for (CeedInt dim2 = 0; dim2 < BASIS_DIM; dim2++) {
           __syncthreads();
           // Update buffers used
@@ -248,8 +276,8 @@ extern "C" __global__ void interp(const CeedInt nelem, const int transpose,
                                   CeedScalar *__restrict__ d_V) {
   const int tid = threadIdx.x;
 
-  const double *U;
-  double V;
+  const CeedScalar *U;
+  CeedScalar V;
   //TODO load B in shared memory if blockDim.z > 1?
 
   for (CeedInt elem = blockIdx.x*blockDim.z + threadIdx.z; elem < nelem;
@@ -283,20 +311,20 @@ extern "C" __global__ void grad(const CeedInt nelem, const int transpose,
                                 CeedScalar *__restrict__ d_V) {
   const int tid = threadIdx.x;
 
-  const double *U;
+  const CeedScalar *U;
   //TODO load G in shared memory if blockDim.z > 1?
 
   for (CeedInt elem = blockIdx.x*blockDim.z + threadIdx.z; elem < nelem;
        elem += gridDim.x*blockDim.z) {
     for (int comp=0; comp<BASIS_NCOMP; comp++) {
       if (!transpose) { // run with Q threads
-        double V[BASIS_DIM];
+        CeedScalar V[BASIS_DIM];
         U = d_U + elem*P + comp*nelem*P;
         for (int dim = 0; dim < BASIS_DIM; dim++)
           V[dim] = 0.0;
 
         for (int i = 0; i < P; ++i) {
-          const double val = U[i];
+          const CeedScalar val = U[i];
           for(int dim = 0; dim < BASIS_DIM; dim++)
             V[dim] += d_G[i + tid*P + dim*P*Q]*val;
         }
@@ -304,7 +332,7 @@ extern "C" __global__ void grad(const CeedInt nelem, const int transpose,
           d_V[elem*Q + comp*nelem*Q + dim*BASIS_NCOMP*nelem*Q + tid] = V[dim];
         }
       } else { // run with P threads
-        double V = 0.0;
+        CeedScalar V = 0.0;
         for (int dim = 0; dim < BASIS_DIM; dim++) {
           U = d_U + elem*Q + comp*nelem*Q +dim*BASIS_NCOMP*nelem*Q;
           for (int i = 0; i < Q; ++i)
@@ -342,8 +370,6 @@ int CeedBasisApply_Cuda(CeedBasis basis, const CeedInt nelem,
   int ierr;
   Ceed ceed;
   ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
-  Ceed_Cuda *ceed_Cuda;
-  ierr = CeedGetData(ceed, &ceed_Cuda); CeedChk(ierr);
   CeedBasis_Cuda *data;
   ierr = CeedBasisGetData(basis, &data); CeedChk(ierr);
   const CeedInt transpose = tmode == CEED_TRANSPOSE;
@@ -361,7 +387,8 @@ int CeedBasisApply_Cuda(CeedBasis basis, const CeedInt nelem,
   if (tmode == CEED_TRANSPOSE) {
     CeedInt length;
     ierr = CeedVectorGetLength(v, &length); CeedChk(ierr);
-    ierr = cudaMemset(d_v, 0, length * sizeof(CeedScalar));
+    ierr = cudaMemsetAsync(d_v, 0, length * sizeof(CeedScalar),
+                           CeedCudaGetStream());
     CeedChk_Cu(ceed,ierr);
   }
 
@@ -430,8 +457,6 @@ int CeedBasisApplyNonTensor_Cuda(CeedBasis basis, const CeedInt nelem,
   int ierr;
   Ceed ceed;
   ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
-  Ceed_Cuda *ceed_Cuda;
-  ierr = CeedGetData(ceed, &ceed_Cuda); CeedChk(ierr);
   CeedBasisNonTensor_Cuda *data;
   ierr = CeedBasisGetData(basis, &data); CeedChk(ierr);
   CeedInt nnodes, nqpt;
@@ -453,7 +478,8 @@ int CeedBasisApplyNonTensor_Cuda(CeedBasis basis, const CeedInt nelem,
   if (tmode == CEED_TRANSPOSE) {
     CeedInt length;
     ierr = CeedVectorGetLength(v, &length); CeedChk(ierr);
-    ierr = cudaMemset(d_v, 0, length * sizeof(CeedScalar));
+    ierr = cudaMemsetAsync(d_v, 0, length * sizeof(CeedScalar),
+                           CeedCudaGetStream());
     CeedChk_Cu(ceed, ierr);
   }
 
@@ -523,9 +549,9 @@ static int CeedBasisDestroy_Cuda(CeedBasis basis) {
 
   CeedChk_Cu(ceed, cuModuleUnload(data->module));
 
-  ierr = cudaFree(data->d_qweight1d); CeedChk_Cu(ceed,ierr);
-  ierr = cudaFree(data->d_interp1d); CeedChk_Cu(ceed,ierr);
-  ierr = cudaFree(data->d_grad1d); CeedChk_Cu(ceed,ierr);
+  ierr = CeedCudaFree(ceed, data->d_qweight1d); CeedChk(ierr);
+  ierr = CeedCudaFree(ceed, data->d_interp1d); CeedChk(ierr);
+  ierr = CeedCudaFree(ceed, data->d_grad1d); CeedChk(ierr);
 
   ierr = CeedFree(&data); CeedChk(ierr);
   return 0;
@@ -544,9 +570,9 @@ static int CeedBasisDestroyNonTensor_Cuda(CeedBasis basis) {
 
   CeedChk_Cu(ceed, cuModuleUnload(data->module));
 
-  ierr = cudaFree(data->d_qweight); CeedChk_Cu(ceed, ierr);
-  ierr = cudaFree(data->d_interp); CeedChk_Cu(ceed, ierr);
-  ierr = cudaFree(data->d_grad); CeedChk_Cu(ceed, ierr);
+  ierr = CeedCudaFree(ceed, data->d_qweight); CeedChk(ierr);
+  ierr = CeedCudaFree(ceed, data->d_interp); CeedChk(ierr);
+  ierr = CeedCudaFree(ceed, data->d_grad); CeedChk(ierr);
 
   ierr = CeedFree(&data); CeedChk(ierr);
   return 0;
@@ -569,23 +595,29 @@ int CeedBasisCreateTensorH1_Cuda(CeedInt dim, CeedInt P1d, CeedInt Q1d,
 
   // Copy data to GPU
   const CeedInt qBytes = Q1d * sizeof(CeedScalar);
-  ierr = cudaMalloc((void **)&data->d_qweight1d, qBytes); CeedChk_Cu(ceed,ierr);
+  ierr = CeedCudaMalloc(ceed, (void **)&data->d_qweight1d, qBytes);
+  CeedChk(ierr);
   ierr = cudaMemcpy(data->d_qweight1d, qweight1d, qBytes,
                     cudaMemcpyHostToDevice); CeedChk_Cu(ceed,ierr);
 
   const CeedInt iBytes = qBytes * P1d;
-  ierr = cudaMalloc((void **)&data->d_interp1d, iBytes); CeedChk_Cu(ceed,ierr);
+  ierr = CeedCudaMalloc(ceed, (void **)&data->d_interp1d, iBytes);
+  CeedChk(ierr);
   ierr = cudaMemcpy(data->d_interp1d, interp1d, iBytes,
                     cudaMemcpyHostToDevice); CeedChk_Cu(ceed,ierr);
 
-  ierr = cudaMalloc((void **)&data->d_grad1d, iBytes); CeedChk_Cu(ceed,ierr);
+  ierr = CeedCudaMalloc(ceed, (void **)&data->d_grad1d, iBytes); CeedChk(ierr);
   ierr = cudaMemcpy(data->d_grad1d, grad1d, iBytes,
                     cudaMemcpyHostToDevice); CeedChk_Cu(ceed,ierr);
+  ierr = CeedBasisTrackMemory(basis, CEED_MEMSPACE_DEVICE, qBytes + 2*iBytes);
+  CeedChk(ierr);
 
   // Complie basis kernels
   CeedInt ncomp;
   ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
-  ierr = CeedCompileCuda(ceed, basiskernels, &data->module, 7,
+  bool collocated;
+  ierr = CeedBasisIsCollocated(basis, &collocated); CeedChk(ierr);
+  ierr = CeedCompileCuda(ceed, basiskernels, &data->module, 8,
                          "BASIS_Q1D", Q1d,
                          "BASIS_P1D", P1d,
                          "BASIS_BUF_LEN", ncomp * CeedIntPow(Q1d > P1d ?
@@ -593,7 +625,8 @@ int CeedBasisCreateTensorH1_Cuda(CeedInt dim, CeedInt P1d, CeedInt Q1d,
                          "BASIS_DIM", dim,
                          "BASIS_NCOMP", ncomp,
                          "BASIS_ELEMSIZE", CeedIntPow(P1d, dim),
-                         "BASIS_NQPT", CeedIntPow(Q1d, dim)
+                         "BASIS_NQPT", CeedIntPow(Q1d, dim),
+                         "BASIS_COLLOCATED", collocated
                         ); CeedChk(ierr);
   ierr = CeedGetKernelCuda(ceed, data->module, "interp", &data->interp);
   CeedChk(ierr);
@@ -625,19 +658,22 @@ int CeedBasisCreateH1_Cuda(CeedElemTopology topo, CeedInt dim, CeedInt nnodes,
 
   // Copy basis data to GPU
   const CeedInt qBytes = nqpts * sizeof(CeedScalar);
-  ierr = cudaMalloc((void **)&data->d_qweight, qBytes); CeedChk_Cu(ceed, ierr);
+  ierr = CeedCudaMalloc(ceed, (void **)&data->d_qweight, qBytes); CeedChk(ierr);
   ierr = cudaMemcpy(data->d_qweight, qweight, qBytes,
                     cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
 
   const CeedInt iBytes = qBytes * nnodes;
-  ierr = cudaMalloc((void **)&data->d_interp, iBytes); CeedChk_Cu(ceed, ierr);
+  ierr = CeedCudaMalloc(ceed, (void **)&data->d_interp, iBytes); CeedChk(ierr);
   ierr = cudaMemcpy(data->d_interp, interp, iBytes,
                     cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
 
   const CeedInt gBytes = qBytes * nnodes * dim;
-  ierr = cudaMalloc((void **)&data->d_grad, gBytes); CeedChk_Cu(ceed, ierr);
+  ierr = CeedCudaMalloc(ceed, (void **)&data->d_grad, gBytes); CeedChk(ierr);
   ierr = cudaMemcpy(data->d_grad, grad, gBytes,
                     cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
+  ierr = CeedBasisTrackMemory(basis, CEED_MEMSPACE_DEVICE,
+                               qBytes + iBytes + gBytes);
+  CeedChk(ierr);
 
   // Compile basis kernels
   CeedInt ncomp;
@@ -18,6 +18,28 @@
 #include <string.h>
 #include <math.h>
 
+//------------------------------------------------------------------------------
+// Destroy composite suboperator streams and outputs
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroySubStreams_Cuda(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Cuda *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  for (CeedInt i = 0; i < impl->numsubstreams; i++) {
+    ierr = cudaStreamDestroy(impl->substreams[i]); CeedChk_Cu(ceed, ierr);
+    ierr = cudaEventDestroy(impl->subevents[i]); CeedChk_Cu(ceed, ierr);
+    ierr = CeedVectorDestroy(&impl->suboutvecs[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->substreams); CeedChk(ierr);
+  ierr = CeedFree(&impl->subevents); CeedChk(ierr);
+  ierr = CeedFree(&impl->suboutvecs); CeedChk(ierr);
+  impl->numsubstreams = 0;
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Destroy operator
 //------------------------------------------------------------------------------
@@ -43,6 +65,19 @@ static int CeedOperatorDestroy_Cuda(CeedOperator op) {
   }
   ierr = CeedFree(&impl->qvecsout); CeedChk(ierr);
 
+  // Reduced precision data
+  if (impl->d_elow) {
+    Ceed ceed;
+    ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+    for (CeedInt i = 0; i < impl->numein; i++) {
+      ierr = CeedCudaFree(ceed, impl->d_elow[i]); CeedChk(ierr);
+    }
+    if (impl->storagemodule)
+      CeedChk_Cu(ceed, cuModuleUnload(impl->storagemodule));
+  }
+  ierr = CeedFree(&impl->d_elow); CeedChk(ierr);
+  ierr = CeedFree(&impl->inputstate); CeedChk(ierr);
+
   // Diag data
   if (impl->diag) {
     Ceed ceed;
@@ -50,17 +85,56 @@ static int CeedOperatorDestroy_Cuda(CeedOperator op) {
     CeedChk_Cu(ceed, cuModuleUnload(impl->diag->module));
     ierr = CeedFree(&impl->diag->h_emodein); CeedChk(ierr);
     ierr = CeedFree(&impl->diag->h_emodeout); CeedChk(ierr);
-    ierr = cudaFree(impl->diag->d_emodein); CeedChk_Cu(ceed, ierr);
-    ierr = cudaFree(impl->diag->d_emodeout); CeedChk_Cu(ceed, ierr);
-    ierr = cudaFree(impl->diag->d_identity); CeedChk_Cu(ceed, ierr);
-    ierr = cudaFree(impl->diag->d_interpin); CeedChk_Cu(ceed, ierr);
-    ierr = cudaFree(impl->diag->d_interpout); CeedChk_Cu(ceed, ierr);
-    ierr = cudaFree(impl->diag->d_gradin); CeedChk_Cu(ceed, ierr);
-    ierr = cudaFree(impl->diag->d_gradout); CeedChk_Cu(ceed, ierr);
+    ierr = CeedCudaFree(ceed, impl->diag->d_emodein); CeedChk(ierr);
+    ierr = CeedCudaFree(ceed, impl->diag->d_emodeout); CeedChk(ierr);
+    ierr = CeedCudaFree(ceed, impl->diag->d_identity); CeedChk(ierr);
+    ierr = CeedCudaFree(ceed, impl->diag->d_interpin); CeedChk(ierr);
+    ierr = CeedCudaFree(ceed, impl->diag->d_interpout); CeedChk(ierr);
+    ierr = CeedCudaFree(ceed, impl->diag->d_gradin); CeedChk(ierr);
+    ierr = CeedCudaFree(ceed, impl->diag->d_gradout); CeedChk(ierr);
     ierr = CeedElemRestrictionDestroy(&impl->diag->pbdiagrstr); CeedChk(ierr);
   }
   ierr = CeedFree(&impl->diag); CeedChk(ierr);
 
+  // Graph data
+  if (impl->graph || impl->graphstream) {
+    Ceed ceed;
+    ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+    if (impl->graph) {
+      ierr = cudaGraphExecDestroy(impl->graph); CeedChk_Cu(ceed, ierr);
+    }
+    if (impl->graphstream) {
+      ierr = cudaStreamDestroy(impl->graphstream); CeedChk_Cu(ceed, ierr);
+    }
+  }
+  ierr = CeedFree(&impl->streamceeds); CeedChk(ierr);
+  ierr = CeedFree(&impl->graphptrs); CeedChk(ierr);
+
+  // Composite data
+  ierr = CeedOperatorDestroySubStreams_Cuda(op); CeedChk(ierr);
+
+  // Streamed data
+  if (impl->numchunks) {
+    Ceed ceed;
+    ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+    for (CeedInt c = 0; c < impl->numchunks; c++) {
+      ierr = CeedOperatorDestroy(&impl->chunkops[c]); CeedChk(ierr);
+    }
+    for (CeedInt k = 0; k < 2*impl->numstreamed; k++) {
+      ierr = CeedVectorDestroy(&impl->stagevecs[k]); CeedChk(ierr);
+    }
+    ierr = cudaStreamDestroy(impl->copystream); CeedChk_Cu(ceed, ierr);
+    for (CeedInt b = 0; b < 2; b++) {
+      ierr = cudaEventDestroy(impl->copied[b]); CeedChk_Cu(ceed, ierr);
+      ierr = cudaEventDestroy(impl->consumed[b]); CeedChk_Cu(ceed, ierr);
+    }
+  }
+  ierr = CeedFree(&impl->chunkops); CeedChk(ierr);
+  ierr = CeedFree(&impl->stagevecs); CeedChk(ierr);
+  ierr = CeedFree(&impl->streamfields); CeedChk(ierr);
+  ierr = CeedFree(&impl->streamstrides); CeedChk(ierr);
+  ierr = CeedFree(&impl->h_streamed); CeedChk(ierr);
+
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
 }
@@ -81,6 +155,7 @@ static int CeedOperatorSetupFields_Cuda(CeedQFunction qf, CeedOperator op,
   CeedOperatorField *opfields;
   CeedQFunctionField *qffields;
   CeedVector fieldvec;
+  CeedStorageType storage;
   bool strided;
   bool skiprestrict;
 
@@ -103,6 +178,7 @@ static int CeedOperatorSetupFields_Cuda(CeedQFunction qf, CeedOperator op,
 
     strided = false;
     skiprestrict = false;
+    storage = CEED_STORAGE_SCALAR;
     if (emode != CEED_EVAL_WEIGHT) {
       ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &Erestrict);
       CeedChk(ierr);
@@ -116,6 +192,8 @@ static int CeedOperatorSetupFields_Cuda(CeedQFunction qf, CeedOperator op,
         // Check for passive input:
         ierr = CeedOperatorFieldGetVector(opfields[i], &fieldvec); CeedChk(ierr);
         if (fieldvec != CEED_VECTOR_ACTIVE) {
+          ierr = CeedOperatorFieldGetStorage(opfields[i], &storage);
+          CeedChk(ierr);
           // Check emode
           if (emode == CEED_EVAL_NONE) {
             // Check for strided restriction
@@ -133,6 +211,9 @@ static int CeedOperatorSetupFields_Cuda(CeedQFunction qf, CeedOperator op,
         // We do not need an E-Vector, but will use the input field vector's data
         // directly in the operator application.
         evecs[i + starte] = NULL;
+      } else if (storage != CEED_STORAGE_SCALAR) {
+        // Reduced precision inputs are kept in d_elow instead of an E-Vector
+        evecs[i + starte] = NULL;
       } else {
         ierr = CeedElemRestrictionCreateVector(Erestrict, NULL,
                                                &evecs[i + starte]);
@@ -169,6 +250,517 @@ static int CeedOperatorSetupFields_Cuda(CeedQFunction qf, CeedOperator op,
     case CEED_EVAL_CURL:
       break; // TODO: Not implemented
     }
+
+    // Work vectors are accounted to the operator
+    ierr = CeedVectorSetMemoryClass(evecs[i + starte], CEED_MEMORY_EVECTOR);
+    CeedChk(ierr);
+    ierr = CeedVectorSetMemoryClass(qvecs[i], CEED_MEMORY_EVECTOR);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Storage conversion kernels
+//------------------------------------------------------------------------------
+// *INDENT-OFF*
+static const char *storagekernels = QUOTE(
+
+extern "C" __global__ void narrowFp32(const CeedInt n,
+    const CeedScalar *__restrict__ u, float *__restrict__ v) {
+  for (CeedInt i = blockIdx.x*blockDim.x + threadIdx.x; i < n;
+       i += blockDim.x*gridDim.x)
+    v[i] = u[i];
+}
+
+extern "C" __global__ void widenFp32(const CeedInt n,
+    const float *__restrict__ u, CeedScalar *__restrict__ v) {
+  for (CeedInt i = blockIdx.x*blockDim.x + threadIdx.x; i < n;
+       i += blockDim.x*gridDim.x)
+    v[i] = u[i];
+}
+
+extern "C" __global__ void narrowBf16(const CeedInt n,
+    const CeedScalar *__restrict__ u, unsigned short *__restrict__ v) {
+  for (CeedInt i = blockIdx.x*blockDim.x + threadIdx.x; i < n;
+       i += blockDim.x*gridDim.x) {
+    const float f = u[i];
+    unsigned int b = __float_as_uint(f);
+    if (isnan(f))
+      b |= 0x00400000; // Keep NaN after truncation
+    else
+      b += 0x7fff + ((b >> 16) & 1); // Round to nearest even
+    v[i] = b >> 16;
+  }
+}
+
+extern "C" __global__ void widenBf16(const CeedInt n,
+    const unsigned short *__restrict__ u, CeedScalar *__restrict__ v) {
+  for (CeedInt i = blockIdx.x*blockDim.x + threadIdx.x; i < n;
+       i += blockDim.x*gridDim.x)
+    v[i] = __uint_as_float(((unsigned int)u[i]) << 16);
+}
+
+);
+// *INDENT-ON*
+
+//------------------------------------------------------------------------------
+// Setup reduced precision inputs
+//
+// Scratch space for the widened values comes from the memory pool for each
+//   apply, so these operators are not captured into CUDA graphs.
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupStorage_Cuda(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Cuda *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedOperatorField *opinputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, NULL); CeedChk(ierr);
+
+  ierr = CeedCalloc(impl->numein, &impl->d_elow); CeedChk(ierr);
+  ierr = CeedCalloc(impl->numein, &impl->inputstate); CeedChk(ierr);
+  for (CeedInt i = 0; i < impl->numein; i++) {
+    CeedStorageType storage;
+    ierr = CeedOperatorFieldGetStorage(opinputfields[i], &storage);
+    CeedChk(ierr);
+    if (storage == CEED_STORAGE_SCALAR)
+      continue;
+
+    // Conversion kernels
+    if (!impl->storagemodule) {
+      ierr = CeedCompileCuda(ceed, storagekernels, &impl->storagemodule, 0);
+      CeedChk(ierr);
+      ierr = CeedGetKernelCuda(ceed, impl->storagemodule, "narrowFp32",
+                               &impl->narrow[CEED_STORAGE_FP32]);
+      CeedChk(ierr);
+      ierr = CeedGetKernelCuda(ceed, impl->storagemodule, "widenFp32",
+                               &impl->widen[CEED_STORAGE_FP32]);
+      CeedChk(ierr);
+      ierr = CeedGetKernelCuda(ceed, impl->storagemodule, "narrowBf16",
+                               &impl->narrow[CEED_STORAGE_BF16]);
+      CeedChk(ierr);
+      ierr = CeedGetKernelCuda(ceed, impl->storagemodule, "widenBf16",
+                               &impl->widen[CEED_STORAGE_BF16]);
+      CeedChk(ierr);
+    }
+
+    // Reduced precision E-vector
+    CeedElemRestriction Erestrict;
+    CeedInt nelem, elemsize, ncomp;
+    size_t bytes;
+    ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumElements(Erestrict, &nelem); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(Erestrict, &ncomp);
+    CeedChk(ierr);
+    ierr = CeedStorageGetSize(storage, &bytes); CeedChk(ierr);
+    ierr = CeedCudaMalloc(ceed, &impl->d_elow[i], nelem*elemsize*ncomp*bytes);
+    CeedChk(ierr);
+    impl->streamcapable = false;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Restrict, narrow, and widen reduced precision inputs
+//
+// The restricted values are narrowed only when the input vector changes. Each
+//   apply widens them into scratch space that is returned to the pool by
+//   CeedOperatorRestoreStorage_Cuda, so only the reduced precision copy
+//   persists between applies.
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyStorage_Cuda(CeedOperator op,
+    CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Cuda *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedOperatorField *opinputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, NULL); CeedChk(ierr);
+  const CeedInt blocksize = 512;
+
+  for (CeedInt i = 0; i < impl->numein; i++) {
+    if (!impl->d_elow[i])
+      continue;
+    CeedStorageType storage;
+    CeedVector vec;
+    CeedElemRestriction Erestrict;
+    CeedInt length;
+    uint64_t state;
+    ierr = CeedOperatorFieldGetStorage(opinputfields[i], &storage);
+    CeedChk(ierr);
+    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
+    CeedChk(ierr);
+    ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
+    if (state != impl->inputstate[i]) {
+      // Restrict and narrow
+      CeedVector evec;
+      const CeedScalar *d_e;
+      ierr = CeedElemRestrictionCreateVector(Erestrict, NULL, &evec);
+      CeedChk(ierr);
+      ierr = CeedElemRestrictionApply(Erestrict, CEED_NOTRANSPOSE, vec, evec,
+                                      request); CeedChk(ierr);
+      ierr = CeedVectorGetLength(evec, &length); CeedChk(ierr);
+      ierr = CeedVectorGetArrayRead(evec, CEED_MEM_DEVICE, &d_e); CeedChk(ierr);
+      void *args[] = {&length, &d_e, &impl->d_elow[i]};
+      ierr = CeedRunKernelCuda(ceed, impl->narrow[storage],
+                               CeedDivUpInt(length, blocksize), blocksize,
+                               args); CeedChk(ierr);
+      ierr = CeedVectorRestoreArrayRead(evec, &d_e); CeedChk(ierr);
+      ierr = CeedVectorDestroy(&evec); CeedChk(ierr);
+      impl->inputstate[i] = state;
+    }
+    // Widen
+    CeedInt nelem, elemsize, ncomp;
+    ierr = CeedElemRestrictionGetNumElements(Erestrict, &nelem); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(Erestrict, &ncomp);
+    CeedChk(ierr);
+    length = nelem*elemsize*ncomp;
+    ierr = CeedCudaMalloc(ceed, (void **)&impl->edata[i],
+                          length*sizeof(CeedScalar)); CeedChk(ierr);
+    void *args[] = {&length, &impl->d_elow[i], &impl->edata[i]};
+    ierr = CeedRunKernelCuda(ceed, impl->widen[storage],
+                             CeedDivUpInt(length, blocksize), blocksize, args);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Return widened reduced precision inputs to the memory pool
+//------------------------------------------------------------------------------
+static int CeedOperatorRestoreStorage_Cuda(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Cuda *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  for (CeedInt i = 0; i < impl->numein; i++) {
+    if (!impl->d_elow[i])
+      continue;
+    ierr = CeedCudaFree(ceed, impl->edata[i]); CeedChk(ierr);
+    impl->edata[i] = NULL;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup launch streams
+//
+// The kernels of an apply can be redirected to another stream, with
+//   CeedCudaSetStream() on the applying thread, to capture them into a CUDA
+//   graph or to run them concurrently with other operators, when they all
+//   launch through CUDA backend Ceeds.
+//------------------------------------------------------------------------------
+static int CeedOperatorAddStreamCeed_Cuda(Ceed ceed, CeedOperator_Cuda *impl) {
+  int ierr;
+  for (CeedInt i = 0; i < impl->numstreamceeds; i++)
+    if (impl->streamceeds[i] == ceed)
+      return 0;
+  const char *resource;
+  ierr = CeedGetResource(ceed, &resource); CeedChk(ierr);
+  if (strncmp(resource, "/gpu/cuda", 9) || strstr(resource, "magma"))
+    impl->streamcapable = false;
+  impl->streamceeds[impl->numstreamceeds++] = ceed;
+  return 0;
+}
+
+static int CeedOperatorSetupStreams_Cuda(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Cuda *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opfields[2];
+  ierr = CeedOperatorGetFields(op, &opfields[0], &opfields[1]); CeedChk(ierr);
+  const CeedInt numfields[2] = {numinputfields, numoutputfields};
+
+  // Collect Ceeds of the QFunction, restrictions, and bases
+  impl->streamcapable = true;
+  ierr = CeedCalloc(2*(numinputfields + numoutputfields) + 2,
+                    &impl->streamceeds); CeedChk(ierr);
+  ierr = CeedOperatorAddStreamCeed_Cuda(ceed, impl); CeedChk(ierr);
+  ierr = CeedQFunctionGetCeed(qf, &ceed); CeedChk(ierr);
+  ierr = CeedOperatorAddStreamCeed_Cuda(ceed, impl); CeedChk(ierr);
+  for (CeedInt k = 0; k < 2; k++)
+    for (CeedInt i = 0; i < numfields[k]; i++) {
+      CeedElemRestriction rstr;
+      ierr = CeedOperatorFieldGetElemRestriction(opfields[k][i], &rstr);
+      CeedChk(ierr);
+      if (rstr != CEED_ELEMRESTRICTION_NONE) {
+        ierr = CeedElemRestrictionGetCeed(rstr, &ceed); CeedChk(ierr);
+        ierr = CeedOperatorAddStreamCeed_Cuda(ceed, impl); CeedChk(ierr);
+      }
+      CeedBasis basis;
+      ierr = CeedOperatorFieldGetBasis(opfields[k][i], &basis); CeedChk(ierr);
+      if (basis != CEED_BASIS_COLLOCATED) {
+        ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
+        ierr = CeedOperatorAddStreamCeed_Cuda(ceed, impl); CeedChk(ierr);
+      }
+    }
+
+  // A QFunction field table in device memory is refilled by each apply, which
+  //   capture and concurrent applies of operators sharing the QFunction can't
+  //   order
+  const CeedInt numslots = CeedIntMax(numinputfields, CEED_CUDA_MIN_FIELD_SLOTS)
+                           + CeedIntMax(numoutputfields, CEED_CUDA_MIN_FIELD_SLOTS);
+  if (numslots*sizeof(CeedScalar *) > CEED_CUDA_MAX_FIELDS_BYTES)
+    impl->streamcapable = false;
+
+  // Captured arrays, followed by scratch space for the current arrays
+  ierr = CeedCalloc(2*(numinputfields + numoutputfields + 1),
+                    &impl->graphptrs); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Check whether a passive input can be streamed by element chunks: its
+//   values must be read at quadrature points without restriction, and each
+//   element must occupy one slab of the L-vector, for all components, or per
+//   component
+//------------------------------------------------------------------------------
+static int CeedOperatorFieldCanStream_Cuda(CeedOperatorField opfield,
+    CeedQFunctionField qffield, CeedInt numelements, bool *canstream,
+    CeedInt (*strides)[3]) {
+  int ierr;
+  CeedEvalMode emode;
+  CeedVector vec;
+  CeedElemRestriction rstr;
+  bool strided, backendstrides;
+
+  *canstream = false;
+  ierr = CeedQFunctionFieldGetEvalMode(qffield, &emode); CeedChk(ierr);
+  ierr = CeedOperatorFieldGetVector(opfield, &vec); CeedChk(ierr);
+  if (emode != CEED_EVAL_NONE || vec == CEED_VECTOR_ACTIVE)
+    return 0;
+  ierr = CeedOperatorFieldGetElemRestriction(opfield, &rstr); CeedChk(ierr);
+  ierr = CeedElemRestrictionIsStrided(rstr, &strided); CeedChk(ierr);
+  if (!strided)
+    return 0;
+  ierr = CeedElemRestrictionHasBackendStrides(rstr, &backendstrides);
+  CeedChk(ierr);
+  if (backendstrides) {
+    ierr = CeedElemRestrictionGetELayout(rstr, strides); CeedChk(ierr);
+  } else {
+    ierr = CeedElemRestrictionGetStrides(rstr, strides); CeedChk(ierr);
+  }
+
+  CeedInt elemsize, ncomp, lsize;
+  ierr = CeedElemRestrictionGetElementSize(rstr, &elemsize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstr, &ncomp); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetLVectorSize(rstr, &lsize); CeedChk(ierr);
+  const CeedInt snode = (*strides)[0], scomp = (*strides)[1],
+                selem = (*strides)[2];
+  if (snode < 0 || scomp < 0 || selem <= 0)
+    return 0;
+  if (ncomp == 1 || scomp*(ncomp - 1) + snode*(elemsize - 1) < selem)
+    // Element outermost
+    *canstream = selem*numelements <= lsize;
+  else if (snode*(elemsize - 1) < selem && selem*numelements <= scomp)
+    // Component outermost
+    *canstream = scomp*(ncomp - 1) + selem*numelements <= lsize;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Number of component rows copied per chunk of a streamed input
+//------------------------------------------------------------------------------
+static int CeedOperatorStreamRows_Cuda(CeedOperatorField opfield,
+                                       const CeedInt strides[3],
+                                       CeedInt *rows) {
+  int ierr;
+  CeedElemRestriction rstr;
+  CeedInt elemsize, ncomp;
+  ierr = CeedOperatorFieldGetElemRestriction(opfield, &rstr); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstr, &elemsize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstr, &ncomp); CeedChk(ierr);
+  *rows = ncomp == 1 || strides[1]*(ncomp - 1) + strides[0]*(elemsize - 1) <
+          strides[2] ? 1 : ncomp;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Set up streamed applies
+//
+// With CEED_STREAM_ELEMS=n, operators on more than n elements keep their
+//   passive inputs read at quadrature points, such as quadrature data, in host
+//   memory. Each apply copies them to the device in chunks of n elements,
+//   double buffered on a copy stream, and applies an operator on the elements
+//   of the chunk while the next chunk is copied. The work vectors of the chunk
+//   operators are returned to the memory pool after each chunk, so the device
+//   memory used is set by the chunk size rather than by the problem size.
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupStreamed_Cuda(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Cuda *ceed_Cuda;
+  ierr = CeedGetData(ceed, &ceed_Cuda); CeedChk(ierr);
+  CeedOperator_Cuda *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numelements, numinputfields, numoutputfields;
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+  CeedQFunctionField *qfinputfields, *qfoutputfields;
+  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
+  CeedChk(ierr);
+
+  const CeedInt chunkelems = ceed_Cuda->streamelems;
+  if (chunkelems <= 0 || numelements <= chunkelems)
+    return 0;
+
+  // Streamed inputs; reduced precision storage is not streamed
+  CeedInt numstreamed = 0, strides[3];
+  for (CeedInt i = 0; i < numinputfields; i++) {
+    CeedStorageType storage;
+    bool canstream;
+    ierr = CeedOperatorFieldGetStorage(opinputfields[i], &storage);
+    CeedChk(ierr);
+    if (storage != CEED_STORAGE_SCALAR)
+      return 0;
+    ierr = CeedOperatorFieldCanStream_Cuda(opinputfields[i], qfinputfields[i],
+                                           numelements, &canstream, &strides);
+    CeedChk(ierr);
+    numstreamed += canstream;
+  }
+  if (!numstreamed)
+    return 0;
+  impl->numstreamed = numstreamed;
+  ierr = CeedCalloc(numstreamed, &impl->streamfields); CeedChk(ierr);
+  ierr = CeedCalloc(numstreamed, &impl->streamstrides); CeedChk(ierr);
+  ierr = CeedCalloc(numstreamed, &impl->h_streamed); CeedChk(ierr);
+  ierr = CeedCalloc(2*numstreamed, &impl->stagevecs); CeedChk(ierr);
+  for (CeedInt i = 0, k = 0; i < numinputfields; i++) {
+    bool canstream;
+    ierr = CeedOperatorFieldCanStream_Cuda(opinputfields[i], qfinputfields[i],
+                                           numelements, &canstream,
+                                           &impl->streamstrides[k]);
+    CeedChk(ierr);
+    if (!canstream)
+      continue;
+    impl->streamfields[k] = i;
+
+    // Two device buffers, allocated now so copies need not wait for them
+    CeedInt rows;
+    ierr = CeedOperatorStreamRows_Cuda(opinputfields[i],
+                                       impl->streamstrides[k], &rows);
+    CeedChk(ierr);
+    for (CeedInt b = 0; b < 2; b++) {
+      CeedVector stage;
+      CeedScalar *array;
+      ierr = CeedVectorCreate(ceed, rows*chunkelems*impl->streamstrides[k][2],
+                              &stage); CeedChk(ierr);
+      ierr = CeedVectorGetArray(stage, CEED_MEM_DEVICE, &array); CeedChk(ierr);
+      ierr = CeedVectorRestoreArray(stage, &array); CeedChk(ierr);
+      impl->stagevecs[2*k + b] = stage;
+    }
+    k++;
+  }
+
+  // Operators on the element chunks
+  impl->chunkelems = chunkelems;
+  impl->numchunks = (numelements + chunkelems - 1) / chunkelems;
+  ierr = CeedCalloc(impl->numchunks, &impl->chunkops); CeedChk(ierr);
+  CeedInt *elems;
+  ierr = CeedMalloc(chunkelems, &elems); CeedChk(ierr);
+  for (CeedInt c = 0; c < impl->numchunks; c++) {
+    const CeedInt e0 = c*chunkelems,
+                  n = CeedIntMin(chunkelems, numelements - e0);
+    CeedOperator chunkop;
+    for (CeedInt e = 0; e < n; e++)
+      elems[e] = e0 + e;
+    ierr = CeedOperatorCreate(ceed, qf, CEED_QFUNCTION_NONE,
+                              CEED_QFUNCTION_NONE, &chunkop); CeedChk(ierr);
+    impl->chunkops[c] = chunkop;
+    for (CeedInt f = 0; f < numinputfields + numoutputfields; f++) {
+      const bool input = f < numinputfields;
+      CeedOperatorField opfield = input ? opinputfields[f] :
+                                  opoutputfields[f - numinputfields];
+      CeedQFunctionField qffield = input ? qfinputfields[f] :
+                                   qfoutputfields[f - numinputfields];
+      char *name;
+      CeedElemRestriction rstr, chunkrstr = CEED_ELEMRESTRICTION_NONE;
+      CeedBasis basis;
+      CeedVector vec;
+      ierr = CeedQFunctionFieldGetName(qffield, &name); CeedChk(ierr);
+      ierr = CeedOperatorFieldGetElemRestriction(opfield, &rstr);
+      CeedChk(ierr);
+      ierr = CeedOperatorFieldGetBasis(opfield, &basis); CeedChk(ierr);
+      ierr = CeedOperatorFieldGetVector(opfield, &vec); CeedChk(ierr);
+
+      CeedInt k = 0;
+      while (k < impl->numstreamed && (!input || impl->streamfields[k] != f))
+        k++;
+      if (k < impl->numstreamed) {
+        // Streamed input, read from the buffer of the chunk
+        CeedInt elemsize, ncomp, rows, length, chunkstrides[3];
+        const CeedInt *s = impl->streamstrides[k];
+        ierr = CeedElemRestrictionGetElementSize(rstr, &elemsize);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionGetNumComponents(rstr, &ncomp); CeedChk(ierr);
+        ierr = CeedOperatorStreamRows_Cuda(opfield, s, &rows); CeedChk(ierr);
+        vec = impl->stagevecs[2*k + c%2];
+        ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+        chunkstrides[0] = s[0];
+        chunkstrides[1] = rows == 1 ? s[1] : n*s[2];
+        chunkstrides[2] = s[2];
+        // Backend strides let the chunk operator read the buffer in place
+        CeedInt layout[3];
+        ierr = CeedElemRestrictionCreateStrided(ceed, n, elemsize, ncomp,
+                                                length, CEED_STRIDES_BACKEND,
+                                                &chunkrstr); CeedChk(ierr);
+        ierr = CeedElemRestrictionGetELayout(chunkrstr, &layout); CeedChk(ierr);
+        if (memcmp(layout, chunkstrides, sizeof(layout))) {
+          ierr = CeedElemRestrictionDestroy(&chunkrstr); CeedChk(ierr);
+          ierr = CeedElemRestrictionCreateStrided(ceed, n, elemsize, ncomp,
+                                                  length, chunkstrides,
+                                                  &chunkrstr); CeedChk(ierr);
+        }
+      } else if (rstr != CEED_ELEMRESTRICTION_NONE) {
+        ierr = CeedElemRestrictionCreateSubset(rstr, n, elems, &chunkrstr);
+        CeedChk(ierr);
+      }
+      ierr = CeedOperatorSetField(chunkop, name, chunkrstr, basis, vec);
+      CeedChk(ierr);
+      if (chunkrstr != CEED_ELEMRESTRICTION_NONE) {
+        ierr = CeedElemRestrictionDestroy(&chunkrstr); CeedChk(ierr);
+      }
+    }
+    CeedOperator_Cuda *chunkimpl;
+    ierr = CeedOperatorGetData(chunkop, &chunkimpl); CeedChk(ierr);
+    chunkimpl->releasework = true;
+  }
+  ierr = CeedFree(&elems); CeedChk(ierr);
+
+  // Copy stream and buffer handoff events
+  ierr = cudaStreamCreateWithFlags(&impl->copystream, cudaStreamNonBlocking);
+  CeedChk_Cu(ceed, ierr);
+  for (CeedInt b = 0; b < 2; b++) {
+    ierr = cudaEventCreateWithFlags(&impl->copied[b], cudaEventDisableTiming);
+    CeedChk_Cu(ceed, ierr);
+    ierr = cudaEventCreateWithFlags(&impl->consumed[b],
+                                    cudaEventDisableTiming);
+    CeedChk_Cu(ceed, ierr);
   }
   return 0;
 }
@@ -201,14 +793,21 @@ static int CeedOperatorSetup_Cuda(CeedOperator op) {
   ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
   CeedChk(ierr);
 
+  // Streamed operators apply by chunks and need no work vectors
+  ierr = CeedOperatorSetupStreamed_Cuda(op); CeedChk(ierr);
+  if (impl->numchunks) {
+    ierr = CeedOperatorSetSetupDone(op); CeedChk(ierr);
+    return 0;
+  }
+
   // Allocate
   ierr = CeedCalloc(numinputfields + numoutputfields, &impl->evecs);
   CeedChk(ierr);
   ierr = CeedCalloc(numinputfields + numoutputfields, &impl->edata);
   CeedChk(ierr);
 
-  ierr = CeedCalloc(16, &impl->qvecsin); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->qvecsout); CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->qvecsin); CeedChk(ierr);
+  ierr = CeedCalloc(numoutputfields, &impl->qvecsout); CeedChk(ierr);
 
   impl->numein = numinputfields; impl->numeout = numoutputfields;
 
@@ -225,6 +824,12 @@ static int CeedOperatorSetup_Cuda(CeedOperator op) {
                                       numinputfields, numoutputfields, Q,
                                       numelements); CeedChk(ierr);
 
+  // Launch streams
+  ierr = CeedOperatorSetupStreams_Cuda(op); CeedChk(ierr);
+
+  // Reduced precision inputs
+  ierr = CeedOperatorSetupStorage_Cuda(op); CeedChk(ierr);
+
   ierr = CeedOperatorSetSetupDone(op); CeedChk(ierr);
   return 0;
 }
@@ -254,6 +859,7 @@ static inline int CeedOperatorSetupInputs_Cuda(CeedInt numinputfields,
     ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
     CeedChk(ierr);
     if (emode == CEED_EVAL_WEIGHT) { // Skip
+    } else if (impl->d_elow[i]) { // Set by CeedOperatorApplyStorage_Cuda
     } else {
       // Get input vector
       ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
@@ -359,6 +965,7 @@ static inline int CeedOperatorRestoreInputs_Cuda(CeedInt numinputfields,
     ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
     CeedChk(ierr);
     if (emode == CEED_EVAL_WEIGHT) { // Skip
+    } else if (impl->d_elow[i]) { // Released by CeedOperatorRestoreStorage_Cuda
     } else {
       if (!impl->evecs[i]) {  // This was a skiprestrict case
         ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
@@ -376,143 +983,489 @@ static inline int CeedOperatorRestoreInputs_Cuda(CeedInt numinputfields,
 }
 
 //------------------------------------------------------------------------------
-// Apply and add to output
+// Work arrays return to the device pool after each apply for chunks of
+//   streamed operators, and for every operator of a Ceed sharing work, so
+//   operators applied one after another reuse the same device memory
+//------------------------------------------------------------------------------
+static int CeedOperatorReleasesWork_Cuda(CeedOperator op, bool *release) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Cuda *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  ierr = CeedIsSharedWork(ceed, release); CeedChk(ierr);
+  *release = *release || impl->releasework;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Apply and add to output, or overwrite the output
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyCore_Cuda(CeedOperator op, CeedVector invec,
+    CeedVector outvec, bool overwrite, CeedRequest *request) {
+  int ierr;
+  CeedOperator_Cuda *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt Q, numelements, elemsize, numinputfields, numoutputfields, size;
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+  CeedQFunctionField *qfinputfields, *qfoutputfields;
+  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
+  CeedChk(ierr);
+  CeedEvalMode emode;
+  CeedVector vec;
+  CeedBasis basis;
+  CeedElemRestriction Erestrict;
+
+  // Input Evecs and Restriction
+  ierr = CeedOperatorApplyStorage_Cuda(op, request); CeedChk(ierr);
+  ierr = CeedOperatorSetupInputs_Cuda(numinputfields, qfinputfields,
+                                      opinputfields, invec, false, impl,
+                                      request); CeedChk(ierr);
+
+  // Input basis apply if needed
+  ierr = CeedOperatorInputBasis_Cuda(numelements, qfinputfields, opinputfields,
+                                     numinputfields, false, impl);
+  CeedChk(ierr);
+
+  // Output pointers, as necessary
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    if (emode == CEED_EVAL_NONE) {
+      // Set the output Q-Vector to use the E-Vector data directly.
+      ierr = CeedVectorGetArray(impl->evecs[i + impl->numein], CEED_MEM_DEVICE,
+                                &impl->edata[i + numinputfields]); CeedChk(ierr);
+      ierr = CeedVectorSetArray(impl->qvecsout[i], CEED_MEM_DEVICE,
+                                CEED_USE_POINTER,
+                                impl->edata[i + numinputfields]);
+      CeedChk(ierr);
+    }
+  }
+
+  // Q function
+  ierr = CeedQFunctionApply(qf, numelements * Q, impl->qvecsin, impl->qvecsout);
+  CeedChk(ierr);
+
+  // Output basis apply if needed
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    // Get elemsize, emode, size
+    ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[i], &Erestrict);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
+    CeedChk(ierr);
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    ierr = CeedQFunctionFieldGetSize(qfoutputfields[i], &size); CeedChk(ierr);
+    // Basis action
+    switch (emode) {
+    case CEED_EVAL_NONE:
+      break;
+    case CEED_EVAL_INTERP:
+      ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
+      CeedChk(ierr);
+      ierr = CeedBasisApply(basis, numelements, CEED_TRANSPOSE,
+                            CEED_EVAL_INTERP, impl->qvecsout[i],
+                            impl->evecs[i + impl->numein]); CeedChk(ierr);
+      break;
+    case CEED_EVAL_GRAD:
+      ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
+      CeedChk(ierr);
+      ierr = CeedBasisApply(basis, numelements, CEED_TRANSPOSE,
+                            CEED_EVAL_GRAD, impl->qvecsout[i],
+                            impl->evecs[i + impl->numein]); CeedChk(ierr);
+      break;
+    // LCOV_EXCL_START
+    case CEED_EVAL_WEIGHT: {
+      Ceed ceed;
+      ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+      return CeedError(ceed, 1,
+                       "CEED_EVAL_WEIGHT cannot be an output evaluation mode");
+      break; // Should not occur
+    }
+    case CEED_EVAL_DIV:
+      break; // TODO: Not implemented
+    case CEED_EVAL_CURL:
+      break; // TODO: Not implemented
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  // Output restriction
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    // Restore evec
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    if (emode == CEED_EVAL_NONE) {
+      ierr = CeedVectorRestoreArray(impl->evecs[i+impl->numein],
+                                    &impl->edata[i + numinputfields]);
+      CeedChk(ierr);
+    }
+    // Get output vector
+    ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
+    // Restrict
+    ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[i], &Erestrict);
+    CeedChk(ierr);
+    // Active
+    if (vec == CEED_VECTOR_ACTIVE)
+      vec = outvec;
+
+    // Overwrite with the first field that writes each vector
+    bool first = overwrite;
+    for (CeedInt j = 0; j < i && first; j++) {
+      CeedVector prevvec;
+      ierr = CeedOperatorFieldGetVector(opoutputfields[j], &prevvec);
+      CeedChk(ierr);
+      first = (prevvec == CEED_VECTOR_ACTIVE ? outvec : prevvec) != vec;
+    }
+    if (first) {
+      ierr = CeedElemRestrictionApplyOverwrite(Erestrict,
+             impl->evecs[i + impl->numein], vec, request); CeedChk(ierr);
+    } else {
+      ierr = CeedElemRestrictionApply(Erestrict, CEED_TRANSPOSE,
+                                      impl->evecs[i + impl->numein], vec,
+                                      request); CeedChk(ierr);
+    }
+  }
+
+  // Restore input arrays
+  ierr = CeedOperatorRestoreInputs_Cuda(numinputfields, qfinputfields,
+                                        opinputfields, false, impl);
+  CeedChk(ierr);
+  ierr = CeedOperatorRestoreStorage_Cuda(op); CeedChk(ierr);
+
+  // Chunks of streamed operators hand their work arrays to the next chunk,
+  //   and operators sharing work to the next operator; the quadrature
+  //   weights are kept
+  bool releasework;
+  ierr = CeedOperatorReleasesWork_Cuda(op, &releasework); CeedChk(ierr);
+  if (releasework) {
+    for (CeedInt i = 0; i < numinputfields + numoutputfields; i++) {
+      if (impl->evecs[i]) {
+        ierr = CeedVectorReleaseDevice_Cuda(impl->evecs[i]); CeedChk(ierr);
+      }
+    }
+    for (CeedInt i = 0; i < numinputfields; i++) {
+      ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+      CeedChk(ierr);
+      if (emode != CEED_EVAL_WEIGHT) {
+        ierr = CeedVectorReleaseDevice_Cuda(impl->qvecsin[i]); CeedChk(ierr);
+      }
+    }
+    for (CeedInt i = 0; i < numoutputfields; i++) {
+      ierr = CeedVectorReleaseDevice_Cuda(impl->qvecsout[i]); CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Get device arrays read or written by an apply
+//
+// This also completes any pending transfers to the device, so a captured graph
+//   can be launched without further synchronization.
+//------------------------------------------------------------------------------
+static int CeedOperatorGetGraphArrays_Cuda(CeedOperator op, CeedVector invec,
+    CeedVector outvec, const void **ptrs) {
+  int ierr;
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+  CeedVector vec;
+
+  for (CeedInt i = 0; i < numinputfields; i++) {
+    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) vec = invec;
+    ptrs[i] = NULL;
+    if (vec != CEED_VECTOR_NONE) {
+      const CeedScalar *array;
+      ierr = CeedVectorGetArrayRead(vec, CEED_MEM_DEVICE, &array);
+      CeedChk(ierr);
+      ptrs[i] = array;
+      ierr = CeedVectorRestoreArrayRead(vec, &array); CeedChk(ierr);
+    }
+  }
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) vec = outvec;
+    CeedScalar *array;
+    ierr = CeedVectorGetArray(vec, CEED_MEM_DEVICE, &array); CeedChk(ierr);
+    ptrs[numinputfields + i] = array;
+    ierr = CeedVectorRestoreArray(vec, &array); CeedChk(ierr);
+  }
+  CeedQFunctionContext ctx;
+  ierr = CeedQFunctionGetInnerContext(qf, &ctx); CeedChk(ierr);
+  ptrs[numinputfields + numoutputfields] = NULL;
+  if (ctx) {
+    void *data;
+    ierr = CeedQFunctionContextGetData(ctx, CEED_MEM_DEVICE, &data);
+    CeedChk(ierr);
+    ptrs[numinputfields + numoutputfields] = data;
+    ierr = CeedQFunctionContextRestoreData(ctx, &data); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Capture apply into a CUDA graph
+//------------------------------------------------------------------------------
+static int CeedOperatorCaptureGraph_Cuda(CeedOperator op, CeedVector invec,
+    CeedVector outvec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Cuda *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  if (!impl->graphstream) {
+    ierr = cudaStreamCreateWithFlags(&impl->graphstream,
+                                     cudaStreamNonBlocking);
+    CeedChk_Cu(ceed, ierr);
+  }
+
+  // Redirect kernel launches to the capture stream
+  cudaStream_t stream = CeedCudaGetStream();
+  CeedCudaSetStream(impl->graphstream);
+  cudaGraph_t graph;
+  ierr = cudaStreamBeginCapture(impl->graphstream,
+                                cudaStreamCaptureModeThreadLocal);
+  CeedChk_Cu(ceed, ierr);
+  int ierrapply = CeedOperatorApplyCore_Cuda(op, invec, outvec, false,
+                  CEED_REQUEST_IMMEDIATE);
+  ierr = cudaStreamEndCapture(impl->graphstream, &graph);
+  CeedCudaSetStream(stream);
+  CeedChk(ierrapply);
+  CeedChk_Cu(ceed, ierr);
+
+  ierr = cudaGraphInstantiate(&impl->graph, graph, NULL, NULL, 0);
+  CeedChk_Cu(ceed, ierr);
+  ierr = cudaGraphDestroy(graph); CeedChk_Cu(ceed, ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Copy chunk c of the streamed inputs to their device buffers
+//------------------------------------------------------------------------------
+static int CeedOperatorCopyChunk_Cuda(CeedOperator op, CeedInt c) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Cuda *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedInt numelements;
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  CeedOperatorField *opinputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, NULL); CeedChk(ierr);
+  const CeedInt e0 = c*impl->chunkelems,
+                n = CeedIntMin(impl->chunkelems, numelements - e0);
+
+  // Wait for the operator of chunk c-2 to be done with the buffers
+  ierr = cudaStreamWaitEvent(impl->copystream, impl->consumed[c%2], 0);
+  CeedChk_Cu(ceed, ierr);
+  for (CeedInt k = 0; k < impl->numstreamed; k++) {
+    const CeedInt *s = impl->streamstrides[k];
+    CeedInt rows;
+    ierr = CeedOperatorStreamRows_Cuda(opinputfields[impl->streamfields[k]],
+                                       s, &rows); CeedChk(ierr);
+    CeedVector stage = impl->stagevecs[2*k + c%2];
+    CeedScalar *d_array;
+    ierr = CeedVectorGetArray(stage, CEED_MEM_DEVICE, &d_array); CeedChk(ierr);
+    const size_t width = n*s[2]*sizeof(CeedScalar);
+    ierr = cudaMemcpy2DAsync(d_array, width, impl->h_streamed[k] + e0*s[2],
+                             rows > 1 ? s[1]*sizeof(CeedScalar) : width,
+                             width, rows, cudaMemcpyHostToDevice,
+                             impl->copystream); CeedChk_Cu(ceed, ierr);
+    ierr = CeedVectorRestoreArray(stage, &d_array); CeedChk(ierr);
+  }
+  ierr = cudaEventRecord(impl->copied[c%2], impl->copystream);
+  CeedChk_Cu(ceed, ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Apply and add to output by element chunks, overlapping the copy of each
+//   chunk of the streamed inputs with the operator on the previous chunk
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddStreamed_Cuda(CeedOperator op,
+    CeedVector invec, CeedVector outvec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Cuda *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedOperatorField *opinputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, NULL); CeedChk(ierr);
+
+  // Streamed inputs live in host memory between applies
+  for (CeedInt k = 0; k < impl->numstreamed; k++) {
+    CeedVector vec;
+    ierr = CeedOperatorFieldGetVector(opinputfields[impl->streamfields[k]],
+                                      &vec); CeedChk(ierr);
+    ierr = CeedVectorEvictDevice_Cuda(vec, &impl->h_streamed[k]);
+    CeedChk(ierr);
+  }
+
+  ierr = CeedOperatorCopyChunk_Cuda(op, 0); CeedChk(ierr);
+  for (CeedInt c = 0; c < impl->numchunks; c++) {
+    if (c + 1 < impl->numchunks) {
+      ierr = CeedOperatorCopyChunk_Cuda(op, c + 1); CeedChk(ierr);
+    }
+    ierr = cudaStreamWaitEvent(CeedCudaGetStream(), impl->copied[c%2], 0);
+    CeedChk_Cu(ceed, ierr);
+    ierr = CeedOperatorApplyAdd(impl->chunkops[c], invec, outvec,
+                                CEED_REQUEST_ORDERED); CeedChk(ierr);
+    ierr = cudaEventRecord(impl->consumed[c%2], CeedCudaGetStream());
+    CeedChk_Cu(ceed, ierr);
+  }
+
+  // The host arrays may be written once the last copy is done
+  ierr = cudaEventSynchronize(impl->copied[(impl->numchunks - 1)%2]);
+  CeedChk_Cu(ceed, ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Apply and add to output
+//
+// With CEED_GRAPHS=1, the second and later applies replay a CUDA graph of the
+//   kernels launched by the apply, captured while the device arrays of the
+//   input, output, and context stay the same.
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Cuda(CeedOperator op, CeedVector invec,
+                                     CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Cuda *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  // Setup
+  ierr = CeedOperatorSetup_Cuda(op); CeedChk(ierr);
+
+  if (impl->numchunks) {
+    ierr = CeedOperatorApplyAddStreamed_Cuda(op, invec, outvec); CeedChk(ierr);
+    ierr = CeedRequestRecord_Cuda(ceed, request); CeedChk(ierr);
+    return 0;
+  }
+
+  // Graphs are not used while profiling, which times each kernel separately,
+  //   or for operators whose work arrays move every apply
+  Ceed_Cuda *ceed_Cuda;
+  ierr = CeedCudaGetSharedData(ceed, &ceed_Cuda); CeedChk(ierr);
+  bool releasework;
+  ierr = CeedOperatorReleasesWork_Cuda(op, &releasework); CeedChk(ierr);
+  bool profiling = false, usegraph = ceed_Cuda->graphs &&
+                                     impl->streamcapable &&
+                                     !releasework && impl->numapplies++;
+  if (usegraph) {
+    ierr = CeedIsProfiling(ceed, &profiling); CeedChk(ierr);
+    usegraph = !profiling;
+  }
+
+  if (!usegraph) {
+    ierr = CeedOperatorApplyCore_Cuda(op, invec, outvec, false, request);
+    CeedChk(ierr);
+  } else {
+    CeedInt numinputfields, numoutputfields;
+    CeedQFunction qf;
+    ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+    ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+    CeedChk(ierr);
+    const CeedInt numptrs = numinputfields + numoutputfields + 1;
+    const void **ptrs = impl->graphptrs + numptrs;
+    ierr = CeedOperatorGetGraphArrays_Cuda(op, invec, outvec, ptrs);
+    CeedChk(ierr);
+
+    // Recapture if any array moved
+    if (impl->graph && memcmp(ptrs, impl->graphptrs, numptrs*sizeof(ptrs[0]))) {
+      ierr = cudaGraphExecDestroy(impl->graph); CeedChk_Cu(ceed, ierr);
+      impl->graph = NULL;
+    }
+    if (!impl->graph) {
+      ierr = CeedOperatorCaptureGraph_Cuda(op, invec, outvec); CeedChk(ierr);
+      memcpy(impl->graphptrs, ptrs, numptrs*sizeof(ptrs[0]));
+    }
+    ierr = cudaGraphLaunch(impl->graph, CeedCudaGetStream());
+    CeedChk_Cu(ceed, ierr);
+  }
+
+  // Completion request
+  ierr = CeedRequestRecord_Cuda(ceed, request); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Apply, overwriting the output
+//
+// The first restriction into each output vector stores instead of adds, so
+//   the output is not zeroed first. Operators replayed from graphs zero the
+//   output and add, keeping the captured graph, as do streamed operators,
+//   whose chunks each add to the output.
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Cuda(CeedOperator op, CeedVector invec,
-                                     CeedVector outvec, CeedRequest *request) {
+static int CeedOperatorApply_Cuda(CeedOperator op, CeedVector invec,
+                                CeedVector outvec, CeedRequest *request) {
   int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
   CeedOperator_Cuda *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
-  CeedQFunction qf;
-  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
-  CeedInt Q, numelements, elemsize, numinputfields, numoutputfields, size;
-  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
-  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
-  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
-  CeedChk(ierr);
-  CeedOperatorField *opinputfields, *opoutputfields;
-  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
-  CeedChk(ierr);
-  CeedQFunctionField *qfinputfields, *qfoutputfields;
-  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
-  CeedChk(ierr);
-  CeedEvalMode emode;
-  CeedVector vec;
-  CeedBasis basis;
-  CeedElemRestriction Erestrict;
 
   // Setup
   ierr = CeedOperatorSetup_Cuda(op); CeedChk(ierr);
 
-  // Input Evecs and Restriction
-  ierr = CeedOperatorSetupInputs_Cuda(numinputfields, qfinputfields,
-                                      opinputfields, invec, false, impl,
-                                      request); CeedChk(ierr);
-
-  // Input basis apply if needed
-  ierr = CeedOperatorInputBasis_Cuda(numelements, qfinputfields, opinputfields,
-                                     numinputfields, false, impl);
-  CeedChk(ierr);
-
-  // Output pointers, as necessary
-  for (CeedInt i = 0; i < numoutputfields; i++) {
-    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
-    CeedChk(ierr);
-    if (emode == CEED_EVAL_NONE) {
-      // Set the output Q-Vector to use the E-Vector data directly.
-      ierr = CeedVectorGetArray(impl->evecs[i + impl->numein], CEED_MEM_DEVICE,
-                                &impl->edata[i + numinputfields]); CeedChk(ierr);
-      ierr = CeedVectorSetArray(impl->qvecsout[i], CEED_MEM_DEVICE,
-                                CEED_USE_POINTER,
-                                impl->edata[i + numinputfields]);
-      CeedChk(ierr);
-    }
-  }
-
-  // Q function
-  ierr = CeedQFunctionApply(qf, numelements * Q, impl->qvecsin, impl->qvecsout);
-  CeedChk(ierr);
-
-  // Output basis apply if needed
-  for (CeedInt i = 0; i < numoutputfields; i++) {
-    // Get elemsize, emode, size
-    ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[i], &Erestrict);
-    CeedChk(ierr);
-    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
-    CeedChk(ierr);
-    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+  Ceed_Cuda *ceed_Cuda;
+  ierr = CeedGetData(ceed, &ceed_Cuda); CeedChk(ierr);
+  bool releasework;
+  ierr = CeedOperatorReleasesWork_Cuda(op, &releasework); CeedChk(ierr);
+  if ((ceed_Cuda->graphs && impl->streamcapable && !releasework) ||
+      impl->numchunks) {
+    CeedQFunction qf;
+    ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+    CeedInt numinputfields, numoutputfields;
+    ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
     CeedChk(ierr);
-    ierr = CeedQFunctionFieldGetSize(qfoutputfields[i], &size); CeedChk(ierr);
-    // Basis action
-    switch (emode) {
-    case CEED_EVAL_NONE:
-      break;
-    case CEED_EVAL_INTERP:
-      ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
-      CeedChk(ierr);
-      ierr = CeedBasisApply(basis, numelements, CEED_TRANSPOSE,
-                            CEED_EVAL_INTERP, impl->qvecsout[i],
-                            impl->evecs[i + impl->numein]); CeedChk(ierr);
-      break;
-    case CEED_EVAL_GRAD:
-      ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
-      CeedChk(ierr);
-      ierr = CeedBasisApply(basis, numelements, CEED_TRANSPOSE,
-                            CEED_EVAL_GRAD, impl->qvecsout[i],
-                            impl->evecs[i + impl->numein]); CeedChk(ierr);
-      break;
-    // LCOV_EXCL_START
-    case CEED_EVAL_WEIGHT: {
-      Ceed ceed;
-      ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-      return CeedError(ceed, 1,
-                       "CEED_EVAL_WEIGHT cannot be an output evaluation mode");
-      break; // Should not occur
-    }
-    case CEED_EVAL_DIV:
-      break; // TODO: Not implemented
-    case CEED_EVAL_CURL:
-      break; // TODO: Not implemented
-      // LCOV_EXCL_STOP
-    }
-  }
-
-  // Output restriction
-  for (CeedInt i = 0; i < numoutputfields; i++) {
-    // Restore evec
-    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedOperatorField *opinputfields, *opoutputfields;
+    ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
     CeedChk(ierr);
-    if (emode == CEED_EVAL_NONE) {
-      ierr = CeedVectorRestoreArray(impl->evecs[i+impl->numein],
-                                    &impl->edata[i + numinputfields]);
-      CeedChk(ierr);
+    for (CeedInt i = 0; i < numoutputfields; i++) {
+      CeedVector vec;
+      ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
+      if (vec == CEED_VECTOR_ACTIVE)
+        vec = outvec;
+      if (vec != CEED_VECTOR_NONE) {
+        ierr = CeedVectorSetValue(vec, 0.0); CeedChk(ierr);
+      }
     }
-    // Get output vector
-    ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
-    // Restrict
-    ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[i], &Erestrict);
-    CeedChk(ierr);
-    // Active
-    if (vec == CEED_VECTOR_ACTIVE)
-      vec = outvec;
-
-    ierr = CeedElemRestrictionApply(Erestrict, CEED_TRANSPOSE,
-                                    impl->evecs[i + impl->numein], vec,
-                                    request); CeedChk(ierr);
+    return CeedOperatorApplyAdd_Cuda(op, invec, outvec, request);
   }
 
-  // Restore input arrays
-  ierr = CeedOperatorRestoreInputs_Cuda(numinputfields, qfinputfields,
-                                        opinputfields, false, impl);
+  ierr = CeedOperatorApplyCore_Cuda(op, invec, outvec, true, request);
   CeedChk(ierr);
+
+  // Completion request
+  ierr = CeedRequestRecord_Cuda(ceed, request); CeedChk(ierr);
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// Assemble Linear QFunction
+// Assemble Linear QFunction, creating the restriction and vector on build or
+//   refilling the given ones on update
 //------------------------------------------------------------------------------
-static int CeedOperatorLinearAssembleQFunction_Cuda(CeedOperator op,
-    CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+static int CeedOperatorLinearAssembleQFunctionCore_Cuda(CeedOperator op,
+    bool buildobjects, CeedVector *assembled, CeedElemRestriction *rstr,
+    CeedRequest *request) {
   int ierr;
   CeedOperator_Cuda *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
@@ -540,6 +1493,11 @@ static int CeedOperatorLinearAssembleQFunction_Cuda(CeedOperator op,
 
   // Setup
   ierr = CeedOperatorSetup_Cuda(op); CeedChk(ierr);
+  if (impl->numchunks)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Assembling streamed operators not supported, "
+                     "unset CEED_STREAM_ELEMS");
+  // LCOV_EXCL_STOP
 
   // Check for identity
   bool identityqf;
@@ -550,6 +1508,7 @@ static int CeedOperatorLinearAssembleQFunction_Cuda(CeedOperator op,
   // LCOV_EXCL_STOP
 
   // Input Evecs and Restriction
+  ierr = CeedOperatorApplyStorage_Cuda(op, request); CeedChk(ierr);
   ierr = CeedOperatorSetupInputs_Cuda(numinputfields, qfinputfields,
                                       opinputfields, NULL, true, impl, request);
   CeedChk(ierr);
@@ -595,15 +1554,17 @@ static int CeedOperatorLinearAssembleQFunction_Cuda(CeedOperator op,
                      "and outputs");
   // LCOV_EXCL_STOP
 
-  // Create output restriction
-  CeedInt strides[3] = {1, numelements*Q, Q}; /* *NOPAD* */
-  ierr = CeedElemRestrictionCreateStrided(ceedparent, numelements, Q,
-                                          numactivein*numactiveout,
-                                          numactivein*numactiveout*numelements*Q,
-                                          strides, rstr); CeedChk(ierr);
-  // Create assembled vector
-  ierr = CeedVectorCreate(ceedparent, numelements*Q*numactivein*numactiveout,
-                          assembled); CeedChk(ierr);
+  if (buildobjects) {
+    // Create output restriction
+    CeedInt strides[3] = {1, numelements*Q, Q}; /* *NOPAD* */
+    ierr = CeedElemRestrictionCreateStrided(ceedparent, numelements, Q,
+                                            numactivein*numactiveout,
+                                            numactivein*numactiveout*numelements*Q,
+                                            strides, rstr); CeedChk(ierr);
+    // Create assembled vector
+    ierr = CeedVectorCreate(ceedparent, numelements*Q*numactivein*numactiveout,
+                            assembled); CeedChk(ierr);
+  }
   ierr = CeedVectorSetValue(*assembled, 0.0); CeedChk(ierr);
   ierr = CeedVectorGetArray(*assembled, CEED_MEM_DEVICE, &a); CeedChk(ierr);
 
@@ -656,6 +1617,7 @@ static int CeedOperatorLinearAssembleQFunction_Cuda(CeedOperator op,
   ierr = CeedOperatorRestoreInputs_Cuda(numinputfields, qfinputfields,
                                         opinputfields, true, impl);
   CeedChk(ierr);
+  ierr = CeedOperatorRestoreStorage_Cuda(op); CeedChk(ierr);
 
   // Restore output
   ierr = CeedVectorRestoreArray(*assembled, &a); CeedChk(ierr);
@@ -669,6 +1631,24 @@ static int CeedOperatorLinearAssembleQFunction_Cuda(CeedOperator op,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunction_Cuda(CeedOperator op,
+    CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+  return CeedOperatorLinearAssembleQFunctionCore_Cuda(op, true, assembled, rstr,
+         request);
+}
+
+//------------------------------------------------------------------------------
+// Update Assembled Linear QFunction
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionUpdate_Cuda(CeedOperator op,
+    CeedVector assembled, CeedElemRestriction rstr, CeedRequest *request) {
+  return CeedOperatorLinearAssembleQFunctionCore_Cuda(op, false, &assembled,
+         &rstr, request);
+}
+
 //------------------------------------------------------------------------------
 // Diagonal assembly kernels
 //------------------------------------------------------------------------------
@@ -1007,38 +1987,41 @@ static inline int CeedOperatorAssembleDiagonalSetup_Cuda(CeedOperator op,
     ierr = CeedCalloc(nqpts*nnodes, &identity); CeedChk(ierr);
     for (CeedInt i=0; i<(nnodes<nqpts?nnodes:nqpts); i++)
       identity[i*nnodes+i] = 1.0;
-    ierr = cudaMalloc((void **)&diag->d_identity, iBytes); CeedChk_Cu(ceed, ierr);
+    ierr = CeedCudaMalloc(ceed, (void **)&diag->d_identity, iBytes);
+    CeedChk(ierr);
     ierr = cudaMemcpy(diag->d_identity, identity, iBytes,
                       cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
   }
 
   // CEED_EVAL_INTERP
   ierr = CeedBasisGetInterp(basisin, &interpin); CeedChk(ierr);
-  ierr = cudaMalloc((void **)&diag->d_interpin, iBytes); CeedChk_Cu(ceed, ierr);
+  ierr = CeedCudaMalloc(ceed, (void **)&diag->d_interpin, iBytes);
+  CeedChk(ierr);
   ierr = cudaMemcpy(diag->d_interpin, interpin, iBytes,
                     cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
   ierr = CeedBasisGetInterp(basisout, &interpout); CeedChk(ierr);
-  ierr = cudaMalloc((void **)&diag->d_interpout, iBytes); CeedChk_Cu(ceed, ierr);
+  ierr = CeedCudaMalloc(ceed, (void **)&diag->d_interpout, iBytes);
+  CeedChk(ierr);
   ierr = cudaMemcpy(diag->d_interpout, interpout, iBytes,
                     cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
 
   // CEED_EVAL_GRAD
   ierr = CeedBasisGetGrad(basisin, &gradin); CeedChk(ierr);
-  ierr = cudaMalloc((void **)&diag->d_gradin, gBytes); CeedChk_Cu(ceed, ierr);
+  ierr = CeedCudaMalloc(ceed, (void **)&diag->d_gradin, gBytes); CeedChk(ierr);
   ierr = cudaMemcpy(diag->d_gradin, gradin, gBytes,
                     cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
   ierr = CeedBasisGetGrad(basisout, &gradout); CeedChk(ierr);
-  ierr = cudaMalloc((void **)&diag->d_gradout, gBytes); CeedChk_Cu(ceed, ierr);
+  ierr = CeedCudaMalloc(ceed, (void **)&diag->d_gradout, gBytes); CeedChk(ierr);
   ierr = cudaMemcpy(diag->d_gradout, gradout, gBytes,
                     cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
 
   // Arrays of emodes
-  ierr = cudaMalloc((void **)&diag->d_emodein, numemodein * eBytes);
-  CeedChk_Cu(ceed, ierr);
+  ierr = CeedCudaMalloc(ceed, (void **)&diag->d_emodein, numemodein * eBytes);
+  CeedChk(ierr);
   ierr = cudaMemcpy(diag->d_emodein, emodein, numemodein * eBytes,
                     cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
-  ierr = cudaMalloc((void **)&diag->d_emodeout, numemodeout * eBytes);
-  CeedChk_Cu(ceed, ierr);
+  ierr = CeedCudaMalloc(ceed, (void **)&diag->d_emodeout, numemodeout * eBytes);
+  CeedChk(ierr);
   ierr = cudaMemcpy(diag->d_emodeout, emodeout, numemodeout * eBytes,
                     cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
 
@@ -1062,7 +2045,8 @@ static inline int CeedOperatorAssembleDiagonalCore_Cuda(CeedOperator op,
   // Assemble QFunction
   CeedVector assembledqf;
   CeedElemRestriction rstr;
-  ierr = CeedOperatorLinearAssembleQFunction(op,  &assembledqf, &rstr, request);
+  ierr = CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembledqf,
+         &rstr, request);
   CeedChk(ierr);
   ierr = CeedElemRestrictionDestroy(&rstr); CeedChk(ierr);
   CeedScalar maxnorm = 0;
@@ -1182,15 +2166,251 @@ static int CeedOperatorLinearAssembleAddPointBlockDiagonal_Cuda(CeedOperator op,
 }
 
 //------------------------------------------------------------------------------
-// Create FDM element inverse not supported
+// FDM element inverse kernels
+//------------------------------------------------------------------------------
+// *INDENT-OFF*
+static const char *fdmkernels = QUOTE(
+
+//------------------------------------------------------------------------------
+// FDM diagonal, one element per block and one node per thread
+//------------------------------------------------------------------------------
+extern "C" __global__ void fdmDiagonal(const CeedInt nelem,
+    const CeedScalar maxnorm, const CeedScalar *__restrict__ qweight,
+    const CeedScalar *__restrict__ lambda,
+    const CeedScalar *__restrict__ assembledqfarray,
+    CeedScalar *__restrict__ qdata) {
+  const CeedScalar qfvaluebound = maxnorm*1e-12;
+
+  for (CeedInt e = blockIdx.x; e < nelem; e += gridDim.x) {
+    // Element average of the assembled QFunction
+    CeedScalar elemavg = 0.;
+    CeedInt count = 0;
+    for (CeedInt i = 0; i < NFIELDS; i++)
+      for (CeedInt q = 0; q < NQPTS; q++) {
+        const CeedScalar qfvalue = assembledqfarray[(i*nelem+e)*NQPTS+q];
+        if (abs(qfvalue) > qfvaluebound) {
+          elemavg += qfvalue / qweight[q];
+          count++;
+        }
+      }
+    if (count)
+      elemavg /= count;
+
+    // Scaled inverse eigenvalues
+    for (CeedInt n = threadIdx.x; n < NNODES; n += blockDim.x) {
+      CeedScalar value = INTERP ? 1. : 0.;
+      if (GRAD)
+        for (CeedInt d = 0, stride = 1; d < DIM; d++, stride *= P1D)
+          value += lambda[(n / stride) % P1D];
+      for (CeedInt c = 0; c < NCOMP; c++)
+        qdata[(e*NCOMP+c)*NNODES+n] = 1. / (elemavg * value);
+    }
+  }
+}
+
+);
+// *INDENT-ON*
+
+//------------------------------------------------------------------------------
+// Create FDM element inverse
+//
+// The 1D mass and Laplacian are diagonalized on the host, as they are only
+//   P1d x P1d. The element averages of the assembled QFunction and the FDM
+//   diagonal are computed on the device, and the inverse is created with the
+//   parent Ceed, so it is applied on the device.
 //------------------------------------------------------------------------------
-static int CeedOperatorCreateFDMElementInverse_Cuda(CeedOperator op) {
-  // LCOV_EXCL_START
+static int CeedOperatorCreateFDMElementInverse_Cuda(CeedOperator op,
+    CeedOperator *fdminv, CeedRequest *request) {
   int ierr;
-  Ceed ceed;
+  Ceed ceed, ceedparent;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-  return CeedError(ceed, 1, "Backend does not implement FDM inverse creation");
+  ierr = CeedGetOperatorFallbackParentCeed(ceed, &ceedparent); CeedChk(ierr);
+  ceedparent = ceedparent ? ceedparent : ceed;
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+
+  // Determine active input basis
+  bool interp = false, grad = false;
+  CeedBasis basis = NULL;
+  CeedElemRestriction rstr = NULL;
+  CeedOperatorField *opfields;
+  CeedQFunctionField *qffields;
+  ierr = CeedOperatorGetFields(op, &opfields, NULL); CeedChk(ierr);
+  ierr = CeedQFunctionGetFields(qf, &qffields, NULL); CeedChk(ierr);
+  CeedInt numinputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, NULL); CeedChk(ierr);
+  for (CeedInt i = 0; i < numinputfields; i++) {
+    CeedVector vec;
+    ierr = CeedOperatorFieldGetVector(opfields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) {
+      CeedEvalMode emode;
+      ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode); CeedChk(ierr);
+      interp = interp || emode == CEED_EVAL_INTERP;
+      grad = grad || emode == CEED_EVAL_GRAD;
+      ierr = CeedOperatorFieldGetBasis(opfields[i], &basis); CeedChk(ierr);
+      ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &rstr);
+      CeedChk(ierr);
+    }
+  }
+  if (!basis)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "No active field set");
+  // LCOV_EXCL_STOP
+  CeedInt P1d, Q1d, elemsize, nqpts, dim, ncomp = 1, nelem = 1;
+  ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes(basis, &elemsize); CeedChk(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints(basis, &nqpts); CeedChk(ierr);
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumElements(rstr, &nelem); CeedChk(ierr);
+
+  // Build and diagonalize 1D Mass and Laplacian
+  bool tensorbasis;
+  ierr = CeedBasisIsTensor(basis, &tensorbasis); CeedChk(ierr);
+  if (!tensorbasis)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "FDMElementInverse only supported for tensor "
+                     "bases");
   // LCOV_EXCL_STOP
+  CeedScalar *work, *mass, *laplace, *x, *x2, *lambda;
+  ierr = CeedMalloc(Q1d*P1d, &work); CeedChk(ierr);
+  ierr = CeedMalloc(P1d*P1d, &mass); CeedChk(ierr);
+  ierr = CeedMalloc(P1d*P1d, &laplace); CeedChk(ierr);
+  ierr = CeedMalloc(P1d*P1d, &x); CeedChk(ierr);
+  ierr = CeedMalloc(P1d*P1d, &x2); CeedChk(ierr);
+  ierr = CeedMalloc(P1d, &lambda); CeedChk(ierr);
+  // -- Mass
+  const CeedScalar *interp1d, *grad1d, *qweight1d;
+  ierr = CeedBasisGetInterp1D(basis, &interp1d); CeedChk(ierr);
+  ierr = CeedBasisGetGrad1D(basis, &grad1d); CeedChk(ierr);
+  ierr = CeedBasisGetQWeights(basis, &qweight1d); CeedChk(ierr);
+  for (CeedInt i = 0; i < Q1d; i++)
+    for (CeedInt j = 0; j < P1d; j++)
+      work[i+j*Q1d] = interp1d[i*P1d+j]*qweight1d[i];
+  ierr = CeedMatrixMultiply(ceed, (const CeedScalar *)work,
+                            (const CeedScalar *)interp1d, mass, P1d, P1d, Q1d);
+  CeedChk(ierr);
+  // -- Laplacian
+  for (CeedInt i = 0; i < Q1d; i++)
+    for (CeedInt j = 0; j < P1d; j++)
+      work[i+j*Q1d] = grad1d[i*P1d+j]*qweight1d[i];
+  ierr = CeedMatrixMultiply(ceed, (const CeedScalar *)work,
+                            (const CeedScalar *)grad1d, laplace, P1d, P1d, Q1d);
+  CeedChk(ierr);
+  // -- Diagonalize
+  ierr = CeedSimultaneousDiagonalization(ceed, laplace, mass, x, lambda, P1d);
+  CeedChk(ierr);
+  ierr = CeedFree(&work); CeedChk(ierr);
+  ierr = CeedFree(&mass); CeedChk(ierr);
+  ierr = CeedFree(&laplace); CeedChk(ierr);
+  for (CeedInt i = 0; i < P1d; i++)
+    for (CeedInt j = 0; j < P1d; j++)
+      x2[i+j*P1d] = x[j+i*P1d];
+  ierr = CeedFree(&x); CeedChk(ierr);
+
+  // Assemble QFunction
+  CeedVector assembled;
+  CeedElemRestriction rstr_qf;
+  ierr = CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled,
+         &rstr_qf, request); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstr_qf); CeedChk(ierr);
+  CeedScalar maxnorm = 0;
+  ierr = CeedVectorNorm(assembled, CEED_NORM_MAX, &maxnorm); CeedChk(ierr);
+
+  // Quadrature weights and 1D eigenvalues
+  CeedVector qweights, lambdavec;
+  ierr = CeedVectorCreate(ceedparent, nqpts, &qweights); CeedChk(ierr);
+  ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT,
+                        CEED_VECTOR_NONE, qweights); CeedChk(ierr);
+  ierr = CeedVectorCreate(ceedparent, P1d, &lambdavec); CeedChk(ierr);
+  ierr = CeedVectorSetArray(lambdavec, CEED_MEM_HOST, CEED_OWN_POINTER, lambda);
+  CeedChk(ierr);
+
+  // Build FDM diagonal
+  const CeedInt nfields = ncomp*ncomp*((interp?1:0) + (grad?dim:0))*
+                          ((interp?1:0) + (grad?dim:0));
+  CUmodule module;
+  CUfunction fdmDiagonal;
+  ierr = CeedCompileCuda(ceed, fdmkernels, &module, 8,
+                         "NFIELDS", nfields,
+                         "NQPTS", nqpts,
+                         "NNODES", elemsize,
+                         "NCOMP", ncomp,
+                         "P1D", P1d,
+                         "DIM", dim,
+                         "INTERP", (CeedInt)interp,
+                         "GRAD", (CeedInt)grad
+                        ); CeedChk(ierr);
+  ierr = CeedGetKernelCuda(ceed, module, "fdmDiagonal", &fdmDiagonal);
+  CeedChk(ierr);
+  CeedVector qdata;
+  const CeedScalar *assembledarray, *qweightsarray, *lambdaarray;
+  CeedScalar *qdataarray;
+  ierr = CeedVectorCreate(ceedparent, nelem*ncomp*elemsize, &qdata);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(assembled, CEED_MEM_DEVICE, &assembledarray);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(qweights, CEED_MEM_DEVICE, &qweightsarray);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(lambdavec, CEED_MEM_DEVICE, &lambdaarray);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArray(qdata, CEED_MEM_DEVICE, &qdataarray); CeedChk(ierr);
+  void *args[] = {(void *) &nelem, &maxnorm, &qweightsarray, &lambdaarray,
+                  &assembledarray, &qdataarray
+                 };
+  ierr = CeedRunKernelCuda(ceed, fdmDiagonal, nelem,
+                           CeedIntMin(elemsize, 1024), args); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(qdata, &qdataarray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(lambdavec, &lambdaarray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(qweights, &qweightsarray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(assembled, &assembledarray); CeedChk(ierr);
+  CeedChk_Cu(ceed, cuModuleUnload(module));
+  ierr = CeedVectorDestroy(&lambdavec); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&qweights); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&assembled); CeedChk(ierr);
+
+  // Setup FDM operator
+  // -- Basis
+  CeedBasis fdm_basis;
+  CeedScalar *graddummy, *qrefdummy, *qweightdummy;
+  ierr = CeedCalloc(P1d*P1d, &graddummy); CeedChk(ierr);
+  ierr = CeedCalloc(P1d, &qrefdummy); CeedChk(ierr);
+  ierr = CeedCalloc(P1d, &qweightdummy); CeedChk(ierr);
+  ierr = CeedBasisCreateTensorH1(ceedparent, dim, ncomp, P1d, P1d, x2,
+                                 graddummy, qrefdummy, qweightdummy,
+                                 &fdm_basis); CeedChk(ierr);
+  ierr = CeedFree(&graddummy); CeedChk(ierr);
+  ierr = CeedFree(&qrefdummy); CeedChk(ierr);
+  ierr = CeedFree(&qweightdummy); CeedChk(ierr);
+  ierr = CeedFree(&x2); CeedChk(ierr);
+
+  // -- Restriction
+  CeedElemRestriction rstr_i;
+  CeedInt strides[3] = {1, elemsize, elemsize*ncomp};
+  ierr = CeedElemRestrictionCreateStrided(ceedparent, nelem, elemsize, ncomp,
+                                          elemsize*nelem*ncomp, strides,
+                                          &rstr_i); CeedChk(ierr);
+  // -- QFunction
+  CeedQFunction mass_qf;
+  ierr = CeedQFunctionCreateInteriorByName(ceedparent, "MassApply", &mass_qf);
+  CeedChk(ierr);
+  // -- Operator
+  ierr = CeedOperatorCreate(ceedparent, mass_qf, NULL, NULL, fdminv);
+  CeedChk(ierr);
+  ierr = CeedOperatorSetField(*fdminv, "u", rstr_i, fdm_basis,
+                              CEED_VECTOR_ACTIVE); CeedChk(ierr);
+  ierr = CeedOperatorSetField(*fdminv, "qdata", rstr_i, CEED_BASIS_COLLOCATED,
+                              qdata); CeedChk(ierr);
+  ierr = CeedOperatorSetField(*fdminv, "v", rstr_i, fdm_basis,
+                              CEED_VECTOR_ACTIVE); CeedChk(ierr);
+
+  // Cleanup
+  ierr = CeedVectorDestroy(&qdata); CeedChk(ierr);
+  ierr = CeedBasisDestroy(&fdm_basis); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstr_i); CeedChk(ierr);
+  ierr = CeedQFunctionDestroy(&mass_qf); CeedChk(ierr);
+  return 0;
 }
 
 //------------------------------------------------------------------------------
@@ -1208,6 +2428,10 @@ int CeedOperatorCreate_Cuda(CeedOperator op) {
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction",
                                 CeedOperatorLinearAssembleQFunction_Cuda);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op,
+                                "LinearAssembleQFunctionUpdate",
+                                CeedOperatorLinearAssembleQFunctionUpdate_Cuda);
+  CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddDiagonal",
                                 CeedOperatorLinearAssembleAddDiagonal_Cuda);
   CeedChk(ierr);
@@ -1218,6 +2442,8 @@ int CeedOperatorCreate_Cuda(CeedOperator op) {
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "CreateFDMElementInverse",
                                 CeedOperatorCreateFDMElementInverse_Cuda);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Apply",
+                                CeedOperatorApply_Cuda); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
                                 CeedOperatorApplyAdd_Cuda); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
@@ -1225,6 +2451,137 @@ int CeedOperatorCreate_Cuda(CeedOperator op) {
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Composite Operator Apply
+//
+// Each suboperator launches its kernels on its own stream, so small
+//   suboperators, such as boundary terms, overlap with the others. All but
+//   the first suboperator add into private copies of the output, which are
+//   summed into the output on the default stream. The streams are blocking,
+//   so they start after and complete before work on the default stream.
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddComposite_Cuda(CeedOperator op,
+    CeedVector invec, CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Cuda *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedInt numsub;
+  ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
+  CeedOperator *suboperators;
+  ierr = CeedOperatorGetSubList(op, &suboperators); CeedChk(ierr);
+
+  // Suboperators run concurrently only when they launch all their kernels
+  //   through CUDA Ceeds and write no passive outputs, which may be shared
+  bool concurrent = numsub > 1, profiling;
+  ierr = CeedIsProfiling(ceed, &profiling); CeedChk(ierr);
+  concurrent = concurrent && !profiling;
+  for (CeedInt i = 0; i < numsub && concurrent; i++) {
+    Ceed subceed;
+    bool iscomposite;
+    ierr = CeedOperatorGetCeed(suboperators[i], &subceed); CeedChk(ierr);
+    ierr = CeedOperatorIsComposite(suboperators[i], &iscomposite);
+    CeedChk(ierr);
+    concurrent = subceed == ceed && !iscomposite;
+    if (!concurrent) break;
+    CeedOperator_Cuda *subimpl;
+    ierr = CeedOperatorSetup_Cuda(suboperators[i]); CeedChk(ierr);
+    ierr = CeedOperatorGetData(suboperators[i], &subimpl); CeedChk(ierr);
+    concurrent = subimpl->streamcapable;
+
+    CeedQFunction qf;
+    ierr = CeedOperatorGetQFunction(suboperators[i], &qf); CeedChk(ierr);
+    CeedInt numinputfields, numoutputfields;
+    ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+    CeedChk(ierr);
+    CeedOperatorField *opinputfields, *opoutputfields;
+    ierr = CeedOperatorGetFields(suboperators[i], &opinputfields,
+                                 &opoutputfields); CeedChk(ierr);
+    for (CeedInt j = 0; j < numoutputfields; j++) {
+      CeedVector vec;
+      ierr = CeedOperatorFieldGetVector(opoutputfields[j], &vec); CeedChk(ierr);
+      concurrent = concurrent && vec == CEED_VECTOR_ACTIVE;
+    }
+  }
+  if (!concurrent) {
+    // Only the last suboperator may return a request
+    for (CeedInt i = 0; i < numsub; i++) {
+      ierr = CeedOperatorApplyAdd(suboperators[i], invec, outvec,
+                                  i < numsub-1 ? CEED_REQUEST_ORDERED : request);
+      CeedChk(ierr);
+    }
+    return 0;
+  }
+
+  // Streams and private outputs
+  if (impl->numsubstreams != numsub) {
+    ierr = CeedOperatorDestroySubStreams_Cuda(op); CeedChk(ierr);
+    ierr = CeedCalloc(numsub, &impl->substreams); CeedChk(ierr);
+    ierr = CeedCalloc(numsub, &impl->suboutvecs); CeedChk(ierr);
+    ierr = CeedCalloc(numsub, &impl->subevents); CeedChk(ierr);
+    for (CeedInt i = 0; i < numsub; i++) {
+      ierr = cudaStreamCreateWithFlags(&impl->substreams[i],
+                                       cudaStreamNonBlocking);
+      CeedChk_Cu(ceed, ierr);
+      ierr = cudaEventCreateWithFlags(&impl->subevents[i],
+                                      cudaEventDisableTiming);
+      CeedChk_Cu(ceed, ierr);
+    }
+    impl->numsubstreams = numsub;
+  }
+  if (outvec != CEED_VECTOR_NONE) {
+    CeedInt length, sublength = -1;
+    ierr = CeedVectorGetLength(outvec, &length); CeedChk(ierr);
+    for (CeedInt i = 1; i < numsub; i++) {
+      if (impl->suboutvecs[i]) {
+        ierr = CeedVectorGetLength(impl->suboutvecs[i], &sublength);
+        CeedChk(ierr);
+      }
+      if (sublength != length) {
+        ierr = CeedVectorDestroy(&impl->suboutvecs[i]); CeedChk(ierr);
+        ierr = CeedVectorCreate(ceed, length, &impl->suboutvecs[i]);
+        CeedChk(ierr);
+      }
+      ierr = CeedVectorSetValue(impl->suboutvecs[i], 0.0); CeedChk(ierr);
+    }
+  }
+
+  // Apply suboperators on their streams, forked from and joined to the
+  //   launch stream of this thread
+  cudaStream_t stream = CeedCudaGetStream();
+  ierr = cudaEventRecord(impl->subevents[0], stream); CeedChk_Cu(ceed, ierr);
+  for (CeedInt i = 0; i < numsub; i++) {
+    ierr = cudaStreamWaitEvent(impl->substreams[i], impl->subevents[0], 0);
+    CeedChk_Cu(ceed, ierr);
+  }
+  for (CeedInt i = 0; i < numsub; i++) {
+    CeedVector subout = outvec;
+    if (i > 0 && outvec != CEED_VECTOR_NONE)
+      subout = impl->suboutvecs[i];
+    CeedCudaSetStream(impl->substreams[i]);
+    int ierrapply = CeedOperatorApplyAdd(suboperators[i], invec, subout,
+                                         CEED_REQUEST_ORDERED);
+    CeedCudaSetStream(stream);
+    CeedChk(ierrapply);
+    ierr = cudaEventRecord(impl->subevents[i], impl->substreams[i]);
+    CeedChk_Cu(ceed, ierr);
+    ierr = cudaStreamWaitEvent(stream, impl->subevents[i], 0);
+    CeedChk_Cu(ceed, ierr);
+  }
+
+  // Sum private outputs
+  if (outvec != CEED_VECTOR_NONE) {
+    for (CeedInt i = 1; i < numsub; i++) {
+      ierr = CeedVectorAXPY(outvec, 1.0, impl->suboutvecs[i]); CeedChk(ierr);
+    }
+  }
+
+  // Completion request
+  ierr = CeedRequestRecord_Cuda(ceed, request); CeedChk(ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Composite Operator Create
 //------------------------------------------------------------------------------
@@ -1232,6 +2589,14 @@ int CeedCompositeOperatorCreate_Cuda(CeedOperator op) {
   int ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Cuda *impl;
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  ierr = CeedOperatorSetData(op, impl); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddComposite",
+                                CeedOperatorApplyAddComposite_Cuda);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
+                                CeedOperatorDestroy_Cuda); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddDiagonal",
                                 CeedOperatorLinearAssembleAddDiagonal_Cuda);
   CeedChk(ierr);
@@ -52,6 +52,21 @@ extern "C" int CeedCudaBuildQFunction(CeedQFunction qf) {
   CeedQFunctionGetCeed(qf, &ceed);
   CeedQFunction_Cuda *data;
   ierr = CeedQFunctionGetData(qf, (void **)&data); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields, size;
+
+  // Field pointer table, sized for the QFunction fields
+  if (!data->fields.inputs) {
+    ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+    CeedChk(ierr);
+    const CeedInt numinslots = CeedIntMax(numinputfields,
+                                          CEED_CUDA_MIN_FIELD_SLOTS);
+    const CeedInt numslots = numinslots + CeedIntMax(numoutputfields,
+                             CEED_CUDA_MIN_FIELD_SLOTS);
+    ierr = CeedCalloc(numslots, &data->fields.inputs); CeedChk(ierr);
+    data->fields.outputs = (CeedScalar **)(data->fields.inputs + numinslots);
+    data->fields.bytes = numslots * sizeof(CeedScalar *);
+  }
+
   // QFunction is built
   if (data->qFunction)
     return 0;
@@ -59,7 +74,6 @@ extern "C" int CeedCudaBuildQFunction(CeedQFunction qf) {
     return CeedError(ceed, 1, "No QFunction source or CUfunction provided.");
 
   // QFunction kernel generation
-  CeedInt numinputfields, numoutputfields, size;
   ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
   CeedQFunctionField *qfinputfields, *qfoutputfields;
   ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
@@ -76,11 +90,30 @@ extern "C" int CeedCudaBuildQFunction(CeedQFunction qf) {
   // Defintions
   code << "\n#define CEED_QFUNCTION(name) inline __device__ int name\n";
   code << "\n#define CeedPragmaSIMD\n";
+  // Chunked QFunctions evaluate one quadrature point per thread
+  code << "#define CEED_CHUNK_WIDTH 1\n";
+  code << "#define CEED_QFUNCTION_CHUNK(name) "
+          "inline __device__ int name ## _chunk(void *, CeedInt, CeedInt, "
+          "CeedInt, const CeedScalar *const *, CeedScalar *const *); "
+          "CEED_QFUNCTION(name)(void *ctx, const CeedInt Q, "
+          "const CeedScalar *const *in, CeedScalar *const *out) { "
+          "for (CeedInt i = 0; i < Q; i++) { "
+          "int ierr = name ## _chunk(ctx, Q, i, 1, in, out); "
+          "if (ierr) return ierr; } return 0; } "
+          "inline __device__ int name ## _chunk\n";
+  code << "#define CeedForLanes(j, nlanes) "
+          "for (CeedInt j = 0; j < 1; j++)\n";
   code << "\n#define CEED_Q_VLA 1\n\n";
-  code << "typedef struct { const CeedScalar* inputs[16]; CeedScalar* outputs[16]; } Fields_Cuda;\n";
+  code << "typedef struct { const CeedScalar* inputs["<<CeedIntMax(numinputfields, CEED_CUDA_MIN_FIELD_SLOTS)<<"]; CeedScalar* outputs["<<CeedIntMax(numoutputfields, CEED_CUDA_MIN_FIELD_SLOTS)<<"]; } Fields_Cuda;\n";
   code << qReadWriteS;
   code << qFunction;
-  code << "extern \"C\" __global__ void " << kernelName << "(void *ctx, CeedInt Q, Fields_Cuda fields) {\n";
+  if (data->fields.bytes <= CEED_CUDA_MAX_FIELDS_BYTES) {
+    code << "extern \"C\" __global__ void " << kernelName << "(void *ctx, CeedInt Q, Fields_Cuda fields) {\n";
+  } else {
+    // Field table in device memory
+    code << "extern \"C\" __global__ void " << kernelName << "(void *ctx, CeedInt Q, const Fields_Cuda *__restrict__ d_fields) {\n";
+    code << "  const Fields_Cuda &fields = *d_fields;\n";
+  }
 
   // Inputs
   for (CeedInt i = 0; i < numinputfields; i++) {
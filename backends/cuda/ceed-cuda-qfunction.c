@@ -59,7 +59,14 @@ static int CeedQFunctionApply_Cuda(CeedQFunction qf, CeedInt Q,
   }
 
   // Run kernel
-  void *args[] = {&data->d_c, (void *) &Q, &data->fields};
+  void *fieldsarg = data->fields.inputs;
+  if (data->fields.bytes > CEED_CUDA_MAX_FIELDS_BYTES) {
+    ierr = CeedCudaCopyFieldsToDevice(ceed, data->fields.inputs,
+                                      data->fields.bytes,
+                                      &data->fields.d_fields); CeedChk(ierr);
+    fieldsarg = &data->fields.d_fields;
+  }
+  void *args[] = {&data->d_c, (void *) &Q, fieldsarg};
   ierr = CeedRunKernelCuda(ceed, data->qFunction, CeedDivUpInt(Q, blocksize),
                            blocksize, args); CeedChk(ierr);
 
@@ -92,6 +99,8 @@ static int CeedQFunctionDestroy_Cuda(CeedQFunction qf) {
   ierr = CeedQFunctionGetCeed(qf, &ceed); CeedChk(ierr);
   if  (data->module)
     CeedChk_Cu(ceed, cuModuleUnload(data->module));
+  ierr = CeedCudaFree(ceed, data->fields.d_fields); CeedChk(ierr);
+  ierr = CeedFree(&data->fields.inputs); CeedChk(ierr);
   ierr = CeedFree(&data); CeedChk(ierr);
   return 0;
 }
@@ -116,6 +125,18 @@ static int CeedCudaLoadQFunction(CeedQFunction qf, char *c_src_file) {
   Ceed ceed;
   CeedQFunctionGetCeed(qf, &ceed);
 
+  // Use source embedded at build time, if provided
+  const char *code;
+  ierr = CeedQFunctionGetSourceCode(qf, &code); CeedChk(ierr);
+  if (code) {
+    CeedQFunction_Cuda *data;
+    ierr = CeedQFunctionGetData(qf, &data); CeedChk(ierr);
+    const size_t len = strlen(code) + 1;
+    ierr = CeedMalloc(len, &data->qFunctionSource); CeedChk(ierr);
+    memcpy(data->qFunctionSource, code, len);
+    return 0;
+  }
+
   // Find source file
   char *cuda_file;
   ierr = CeedCalloc(CUDA_MAX_PATH, &cuda_file); CeedChk(ierr);
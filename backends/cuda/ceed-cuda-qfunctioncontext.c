@@ -59,6 +59,30 @@ static inline int CeedQFunctionContextSyncD2H_Cuda(
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Match the tracked memory usage to the data the context currently owns
+//------------------------------------------------------------------------------
+static int CeedQFunctionContextUpdateMemory_Cuda(
+  const CeedQFunctionContext ctx) {
+  int ierr;
+  CeedQFunctionContext_Cuda *impl;
+  ierr = CeedQFunctionContextGetBackendData(ctx, &impl); CeedChk(ierr);
+
+  const size_t owned[CEED_MEMSPACE_NUM] = {
+    [CEED_MEMSPACE_HOST] = impl->h_data_allocated ? bytes(ctx) : 0,
+    [CEED_MEMSPACE_DEVICE] = impl->d_data_allocated ? bytes(ctx) : 0,
+  };
+  for (int s = 0; s < CEED_MEMSPACE_NUM; s++) {
+    size_t used;
+    ierr = CeedQFunctionContextGetMemoryUsage(ctx, s, &used); CeedChk(ierr);
+    if (used != owned[s]) {
+      ierr = CeedQFunctionContextTrackMemory(ctx, s, (ptrdiff_t)owned[s] -
+                                             (ptrdiff_t)used); CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Set data from host
 //------------------------------------------------------------------------------
@@ -106,20 +130,20 @@ static int CeedQFunctionContextSetDataDevice_Cuda(const CeedQFunctionContext
   switch (cmode) {
   case CEED_COPY_VALUES:
     if (!impl->d_data) {
-      ierr = cudaMalloc((void **)&impl->d_data_allocated, bytes(ctx));
-      CeedChk_Cu(ceed, ierr);
+      ierr = CeedCudaMalloc(ceed, (void **)&impl->d_data_allocated, bytes(ctx));
+      CeedChk(ierr);
       impl->d_data = impl->d_data_allocated;
     }
     ierr = cudaMemcpy(impl->d_data, data, bytes(ctx),
                       cudaMemcpyDeviceToDevice); CeedChk_Cu(ceed, ierr);
     break;
   case CEED_OWN_POINTER:
-    ierr = cudaFree(impl->d_data_allocated); CeedChk_Cu(ceed, ierr);
+    ierr = CeedCudaFree(ceed, impl->d_data_allocated); CeedChk(ierr);
     impl->d_data_allocated = data;
     impl->d_data = data;
     break;
   case CEED_USE_POINTER:
-    ierr = cudaFree(impl->d_data_allocated); CeedChk_Cu(ceed, ierr);
+    ierr = CeedCudaFree(ceed, impl->d_data_allocated); CeedChk(ierr);
     impl->d_data_allocated = NULL;
     impl->d_data = data;
     break;
@@ -142,11 +166,20 @@ static int CeedQFunctionContextSetData_Cuda(const CeedQFunctionContext ctx,
 
   switch (mtype) {
   case CEED_MEM_HOST:
-    return CeedQFunctionContextSetDataHost_Cuda(ctx, cmode, data);
+    ierr = CeedQFunctionContextSetDataHost_Cuda(ctx, cmode, data);
+    CeedChk(ierr);
+    break;
   case CEED_MEM_DEVICE:
-    return CeedQFunctionContextSetDataDevice_Cuda(ctx, cmode, data);
+    ierr = CeedQFunctionContextSetDataDevice_Cuda(ctx, cmode, data);
+    CeedChk(ierr);
+    break;
+  default:
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Only MemType = HOST or DEVICE supported");
+    // LCOV_EXCL_STOP
   }
-  return 1;
+  ierr = CeedQFunctionContextUpdateMemory_Cuda(ctx); CeedChk(ierr);
+  return 0;
 }
 
 //------------------------------------------------------------------------------
@@ -180,8 +213,8 @@ static int CeedQFunctionContextGetData_Cuda(const CeedQFunctionContext ctx,
     break;
   case CEED_MEM_DEVICE:
     if (impl->d_data == NULL) {
-      ierr = cudaMalloc((void **)&impl->d_data_allocated, bytes(ctx));
-      CeedChk_Cu(ceed, ierr);
+      ierr = CeedCudaMalloc(ceed, (void **)&impl->d_data_allocated, bytes(ctx));
+      CeedChk(ierr);
       impl->d_data = impl->d_data_allocated;
     }
     if (impl->memState == CEED_CUDA_HOST_SYNC) {
@@ -190,6 +223,44 @@ static int CeedQFunctionContextGetData_Cuda(const CeedQFunctionContext ctx,
     impl->memState = CEED_CUDA_DEVICE_SYNC;
     *(void **)data = impl->d_data;
     break;
+  case CEED_MEM_UNIFIED:
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "CEED_MEM_UNIFIED is only supported for "
+                     "CeedVector");
+    // LCOV_EXCL_STOP
+  }
+  ierr = CeedQFunctionContextUpdateMemory_Cuda(ctx); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Set a registered field
+//
+// A context on the device is updated there, ordered with the kernels on the
+//   launch stream, so the host copy goes stale without invalidating or copying
+//   the rest of the device data.
+//------------------------------------------------------------------------------
+static int CeedQFunctionContextSetField_Cuda(const CeedQFunctionContext ctx,
+    size_t offset, size_t size, const void *values) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedQFunctionContextGetCeed(ctx, &ceed); CeedChk(ierr);
+  CeedQFunctionContext_Cuda *impl;
+  ierr = CeedQFunctionContextGetBackendData(ctx, &impl); CeedChk(ierr);
+
+  switch (impl->memState) {
+  case CEED_CUDA_HOST_SYNC:
+    memcpy((char *)impl->h_data + offset, values, size);
+    break;
+  case CEED_CUDA_DEVICE_SYNC:
+    ierr = cudaMemcpyAsync((char *)impl->d_data + offset, values, size,
+                         cudaMemcpyHostToDevice, CeedCudaGetStream());
+    CeedChk_Cu(ceed, ierr);
+    break;
+  default:
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "No context data set");
+    // LCOV_EXCL_STOP
   }
   return 0;
 }
@@ -212,7 +283,7 @@ static int CeedQFunctionContextDestroy_Cuda(const CeedQFunctionContext ctx) {
   CeedQFunctionContext_Cuda *impl;
   ierr = CeedQFunctionContextGetBackendData(ctx, &impl); CeedChk(ierr);
 
-  ierr = cudaFree(impl->d_data_allocated); CeedChk_Cu(ceed, ierr);
+  ierr = CeedCudaFree(ceed, impl->d_data_allocated); CeedChk(ierr);
   ierr = CeedFree(&impl->h_data_allocated); CeedChk(ierr);
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
@@ -233,6 +304,8 @@ int CeedQFunctionContextCreate_Cuda(CeedQFunctionContext ctx) {
                                 CeedQFunctionContextGetData_Cuda); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "QFunctionContext", ctx, "RestoreData",
                                 CeedQFunctionContextRestoreData_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "QFunctionContext", ctx, "SetField",
+                                CeedQFunctionContextSetField_Cuda); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "QFunctionContext", ctx, "Destroy",
                                 CeedQFunctionContextDestroy_Cuda); CeedChk(ierr);
   ierr = CeedCalloc(1, &impl); CeedChk(ierr);
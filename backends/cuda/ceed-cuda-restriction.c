@@ -38,6 +38,52 @@ extern "C" __global__ void noTrStrided(const CeedInt nelem,
   }
 }
 
+//------------------------------------------------------------------------------
+// Interlaced node, L-vector -> E-vector, components loaded in 16-byte pairs
+//   after peeling an odd leading component
+//------------------------------------------------------------------------------
+inline __device__ void readNodeVec2(const CeedInt ind,
+                                    const CeedScalar *__restrict__ u,
+                                    CeedScalar *__restrict__ v) {
+  CeedInt comp = 0;
+  if (ind % 2) {
+    v[0] = u[ind];
+    comp = 1;
+  }
+  for (; comp + 1 < RESTRICTION_NCOMP; comp += 2) {
+    const double2 pair = *(const double2 *)(u + ind + comp);
+    v[comp*RESTRICTION_ELEMSIZE*RESTRICTION_NELEM] = pair.x;
+    v[(comp+1)*RESTRICTION_ELEMSIZE*RESTRICTION_NELEM] = pair.y;
+  }
+  if (comp < RESTRICTION_NCOMP)
+    v[comp*RESTRICTION_ELEMSIZE*RESTRICTION_NELEM] = u[ind + comp];
+}
+
+//------------------------------------------------------------------------------
+// Interlaced node, E-vector -> L-vector, components added or stored in 16-byte
+//   pairs after peeling an odd leading component
+//------------------------------------------------------------------------------
+template <bool ADD>
+inline __device__ void writeNodeVec2(const CeedInt ind,
+                                     const CeedScalar *value,
+                                     CeedScalar *__restrict__ v) {
+  CeedInt comp = 0;
+  if (ind % 2) {
+    v[ind] = ADD ? v[ind] + value[0] : value[0];
+    comp = 1;
+  }
+  for (; comp + 1 < RESTRICTION_NCOMP; comp += 2) {
+    double2 pair = make_double2(0., 0.);
+    if (ADD)
+      pair = *(double2 *)(v + ind + comp);
+    pair.x += value[comp];
+    pair.y += value[comp+1];
+    *(double2 *)(v + ind + comp) = pair;
+  }
+  if (comp < RESTRICTION_NCOMP)
+    v[ind + comp] = ADD ? v[ind + comp] + value[comp] : value[comp];
+}
+
 //------------------------------------------------------------------------------
 // L-vector -> E-vector, offsets provided
 //------------------------------------------------------------------------------
@@ -59,6 +105,59 @@ extern "C" __global__ void noTrOffset(const CeedInt nelem,
   }
 }
 
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, offsets provided, interlaced components
+//------------------------------------------------------------------------------
+extern "C" __global__ void noTrOffsetVec2(const CeedInt nelem,
+    const CeedInt *__restrict__ indices,
+    const CeedScalar *__restrict__ u, CeedScalar *__restrict__ v) {
+  for (CeedInt node = blockIdx.x * blockDim.x + threadIdx.x;
+      node < nelem*RESTRICTION_ELEMSIZE;
+      node += blockDim.x * gridDim.x) {
+    const CeedInt locNode = node % RESTRICTION_ELEMSIZE;
+    const CeedInt elem = node / RESTRICTION_ELEMSIZE;
+
+    readNodeVec2(indices[node], u, v + locNode + elem*RESTRICTION_ELEMSIZE);
+  }
+}
+
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, compressed offsets computed from element base offsets
+//------------------------------------------------------------------------------
+extern "C" __global__ void noTrCompressed(const CeedInt nelem,
+    const CeedInt *__restrict__ eoffsets, const CeedInt *__restrict__ stencil,
+    const CeedScalar *__restrict__ u, CeedScalar *__restrict__ v) {
+  for (CeedInt node = blockIdx.x * blockDim.x + threadIdx.x;
+      node < nelem*RESTRICTION_ELEMSIZE;
+      node += blockDim.x * gridDim.x) {
+    const CeedInt locNode = node % RESTRICTION_ELEMSIZE;
+    const CeedInt elem = node / RESTRICTION_ELEMSIZE;
+    const CeedInt ind = eoffsets[elem] + stencil[locNode];
+
+    for (CeedInt comp = 0; comp < RESTRICTION_NCOMP; ++comp)
+      v[locNode + comp*RESTRICTION_ELEMSIZE*RESTRICTION_NELEM +
+        elem*RESTRICTION_ELEMSIZE] =
+          u[ind + comp*RESTRICTION_COMPSTRIDE];
+  }
+}
+
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, compressed offsets, interlaced components
+//------------------------------------------------------------------------------
+extern "C" __global__ void noTrCompressedVec2(const CeedInt nelem,
+    const CeedInt *__restrict__ eoffsets, const CeedInt *__restrict__ stencil,
+    const CeedScalar *__restrict__ u, CeedScalar *__restrict__ v) {
+  for (CeedInt node = blockIdx.x * blockDim.x + threadIdx.x;
+      node < nelem*RESTRICTION_ELEMSIZE;
+      node += blockDim.x * gridDim.x) {
+    const CeedInt locNode = node % RESTRICTION_ELEMSIZE;
+    const CeedInt elem = node / RESTRICTION_ELEMSIZE;
+
+    readNodeVec2(eoffsets[elem] + stencil[locNode], u,
+                 v + locNode + elem*RESTRICTION_ELEMSIZE);
+  }
+}
+
 //------------------------------------------------------------------------------
 // E-vector -> L-vector, strided
 //------------------------------------------------------------------------------
@@ -77,6 +176,70 @@ extern "C" __global__ void trStrided(const CeedInt nelem,
   }
 }
 
+//------------------------------------------------------------------------------
+// Sum of the E-vector entries of an L-vector node
+//------------------------------------------------------------------------------
+inline __device__ void gatherNode(const CeedInt rng1, const CeedInt rngN,
+                                  const CeedInt *__restrict__ tindices,
+                                  const CeedScalar *__restrict__ u,
+                                  CeedScalar *value) {
+  for (CeedInt comp = 0; comp < RESTRICTION_NCOMP; ++comp)
+    value[comp] = 0.0;
+
+  for (CeedInt j = rng1; j < rngN; ++j) {
+    const CeedInt tind = tindices[j];
+    CeedInt locNode = tind % RESTRICTION_ELEMSIZE;
+    CeedInt elem = tind / RESTRICTION_ELEMSIZE;
+
+    for (CeedInt comp = 0; comp < RESTRICTION_NCOMP; ++comp)
+      value[comp] += u[locNode + comp*RESTRICTION_ELEMSIZE*RESTRICTION_NELEM +
+                       elem*RESTRICTION_ELEMSIZE];
+  }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, offsets provided, result added or stored
+//------------------------------------------------------------------------------
+template <bool ADD>
+inline __device__ void transposeOffset(const CeedInt *__restrict__ lvec_indices,
+                                       const CeedInt *__restrict__ tindices,
+                                       const CeedInt *__restrict__ toffsets,
+                                       const CeedScalar *__restrict__ u,
+                                       CeedScalar *__restrict__ v) {
+  CeedScalar value[RESTRICTION_NCOMP];
+
+  for (CeedInt i = blockIdx.x * blockDim.x + threadIdx.x;
+       i < RESTRICTION_NNODES;
+       i += blockDim.x * gridDim.x) {
+    const CeedInt ind = lvec_indices[i];
+    gatherNode(toffsets[i], toffsets[i+1], tindices, u, value);
+
+    for (CeedInt comp = 0; comp < RESTRICTION_NCOMP; ++comp)
+      v[ind + comp*RESTRICTION_COMPSTRIDE] =
+        ADD ? v[ind + comp*RESTRICTION_COMPSTRIDE] + value[comp] : value[comp];
+  }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, offsets provided, interlaced components, result added
+//   or stored
+//------------------------------------------------------------------------------
+template <bool ADD>
+inline __device__ void transposeOffsetVec2(
+    const CeedInt *__restrict__ lvec_indices,
+    const CeedInt *__restrict__ tindices,
+    const CeedInt *__restrict__ toffsets,
+    const CeedScalar *__restrict__ u, CeedScalar *__restrict__ v) {
+  CeedScalar value[RESTRICTION_NCOMP];
+
+  for (CeedInt i = blockIdx.x * blockDim.x + threadIdx.x;
+       i < RESTRICTION_NNODES;
+       i += blockDim.x * gridDim.x) {
+    gatherNode(toffsets[i], toffsets[i+1], tindices, u, value);
+    writeNodeVec2<ADD>(lvec_indices[i], value, v);
+  }
+}
+
 //------------------------------------------------------------------------------
 // E-vector -> L-vector, offsets provided
 //------------------------------------------------------------------------------
@@ -85,30 +248,57 @@ extern "C" __global__ void trOffset(const CeedInt *__restrict__ lvec_indices,
                                     const CeedInt *__restrict__ toffsets,
                                     const CeedScalar *__restrict__ u,
                                     CeedScalar *__restrict__ v) {
-  CeedScalar value[RESTRICTION_NCOMP];
+  transposeOffset<true>(lvec_indices, tindices, toffsets, u, v);
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, offsets provided, L-vector overwritten
+//------------------------------------------------------------------------------
+extern "C" __global__ void trOffsetSet(const CeedInt *__restrict__ lvec_indices,
+                                       const CeedInt *__restrict__ tindices,
+                                       const CeedInt *__restrict__ toffsets,
+                                       const CeedScalar *__restrict__ u,
+                                       CeedScalar *__restrict__ v) {
+  transposeOffset<false>(lvec_indices, tindices, toffsets, u, v);
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, offsets provided, interlaced components
+//------------------------------------------------------------------------------
+extern "C" __global__ void trOffsetVec2(const CeedInt *__restrict__ lvec_indices,
+                                        const CeedInt *__restrict__ tindices,
+                                        const CeedInt *__restrict__ toffsets,
+                                        const CeedScalar *__restrict__ u,
+                                        CeedScalar *__restrict__ v) {
+  transposeOffsetVec2<true>(lvec_indices, tindices, toffsets, u, v);
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, offsets provided, interlaced components, L-vector
+//   overwritten
+//------------------------------------------------------------------------------
+extern "C" __global__ void trOffsetSetVec2(
+    const CeedInt *__restrict__ lvec_indices,
+    const CeedInt *__restrict__ tindices,
+    const CeedInt *__restrict__ toffsets,
+    const CeedScalar *__restrict__ u, CeedScalar *__restrict__ v) {
+  transposeOffsetVec2<false>(lvec_indices, tindices, toffsets, u, v);
+}
 
+//------------------------------------------------------------------------------
+// Multiplicity, the number of E-vector entries of each L-vector node
+//------------------------------------------------------------------------------
+extern "C" __global__ void multiplicityOffset(
+    const CeedInt *__restrict__ lvec_indices,
+    const CeedInt *__restrict__ toffsets, CeedScalar *__restrict__ v) {
   for (CeedInt i = blockIdx.x * blockDim.x + threadIdx.x;
        i < RESTRICTION_NNODES;
        i += blockDim.x * gridDim.x) {
     const CeedInt ind = lvec_indices[i];
-    const CeedInt rng1 = toffsets[i];
-    const CeedInt rngN = toffsets[i+1];
-
-    for (CeedInt comp = 0; comp < RESTRICTION_NCOMP; ++comp)
-      value[comp] = 0.0;
-
-    for (CeedInt j = rng1; j < rngN; ++j) {
-      const CeedInt tind = tindices[j];
-      CeedInt locNode = tind % RESTRICTION_ELEMSIZE;
-      CeedInt elem = tind / RESTRICTION_ELEMSIZE;
-
-      for (CeedInt comp = 0; comp < RESTRICTION_NCOMP; ++comp)
-        value[comp] += u[locNode + comp*RESTRICTION_ELEMSIZE*RESTRICTION_NELEM +
-                         elem*RESTRICTION_ELEMSIZE];
-    }
+    const CeedScalar count = toffsets[i+1] - toffsets[i];
 
     for (CeedInt comp = 0; comp < RESTRICTION_NCOMP; ++comp)
-      v[ind + comp*RESTRICTION_COMPSTRIDE] += value[comp];
+      v[ind + comp*RESTRICTION_COMPSTRIDE] = count;
   }
 }
 
@@ -141,12 +331,23 @@ static int CeedElemRestrictionApply_Cuda(CeedElemRestriction r,
   ierr = CeedVectorGetArrayRead(u, CEED_MEM_DEVICE, &d_u); CeedChk(ierr);
   ierr = CeedVectorGetArray(v, CEED_MEM_DEVICE, &d_v); CeedChk(ierr);
 
+  // Interlaced components move in 16-byte pairs when the L-vector is aligned
+  const CeedScalar *d_l = tmode == CEED_NOTRANSPOSE ? d_u : d_v;
+  const bool vec2 = impl->vec2 && !((uintptr_t)d_l % (2*sizeof(CeedScalar)));
+
   // Restrict
   if (tmode == CEED_NOTRANSPOSE) {
     // L-vector -> E-vector
-    if (impl->d_ind) {
+    if (impl->d_eoffsets) {
+      // -- Compressed offsets
+      kernel = vec2 ? impl->noTrCompressedVec2 : impl->noTrCompressed;
+      void *args[] = {&nelem, &impl->d_eoffsets, &impl->d_stencil, &d_u, &d_v};
+      CeedInt blocksize = elemsize<1024?(elemsize>32?elemsize:32):1024;
+      ierr = CeedRunKernelCuda(ceed, kernel, CeedDivUpInt(nnodes, blocksize),
+                               blocksize, args); CeedChk(ierr);
+    } else if (impl->d_ind) {
       // -- Offsets provided
-      kernel = impl->noTrOffset;
+      kernel = vec2 ? impl->noTrOffsetVec2 : impl->noTrOffset;
       void *args[] = {&nelem, &impl->d_ind, &d_u, &d_v};
       CeedInt blocksize = elemsize<1024?(elemsize>32?elemsize:32):1024;
       ierr = CeedRunKernelCuda(ceed, kernel, CeedDivUpInt(nnodes, blocksize),
@@ -163,7 +364,7 @@ static int CeedElemRestrictionApply_Cuda(CeedElemRestriction r,
     // E-vector -> L-vector
     if (impl->d_ind) {
       // -- Offsets provided
-      kernel = impl->trOffset;
+      kernel = vec2 ? impl->trOffsetVec2 : impl->trOffset;
       void *args[] = {&impl->d_lvec_indices, &impl->d_tindices,
                       &impl->d_toffsets, &d_u, &d_v
                      };
@@ -187,6 +388,77 @@ static int CeedElemRestrictionApply_Cuda(CeedElemRestriction r,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Apply transpose restriction, overwriting the L-vector
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionApplyOverwrite_Cuda(CeedElemRestriction r,
+    CeedVector u, CeedVector v, CeedRequest *request) {
+  int ierr;
+  CeedElemRestriction_Cuda *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+
+  // Every L-vector entry must receive exactly one sum
+  if (!impl->tcovers) {
+    ierr = CeedVectorSetValue(v, 0.0); CeedChk(ierr);
+    return CeedElemRestrictionApply_Cuda(r, CEED_TRANSPOSE, u, v, request);
+  }
+
+  Ceed ceed;
+  ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
+  const CeedInt warpsize  = 32;
+  const CeedInt blocksize = warpsize;
+  const CeedInt nnodes = impl->nnodes;
+
+  // Get vectors
+  const CeedScalar *d_u;
+  CeedScalar *d_v;
+  ierr = CeedVectorGetArrayRead(u, CEED_MEM_DEVICE, &d_u); CeedChk(ierr);
+  ierr = CeedVectorGetArray(v, CEED_MEM_DEVICE, &d_v); CeedChk(ierr);
+
+  // E-vector -> L-vector
+  const bool vec2 = impl->vec2 && !((uintptr_t)d_v % (2*sizeof(CeedScalar)));
+  CUfunction kernel = vec2 ? impl->trOffsetSetVec2 : impl->trOffsetSet;
+  void *args[] = {&impl->d_lvec_indices, &impl->d_tindices,
+                  &impl->d_toffsets, &d_u, &d_v
+                 };
+  ierr = CeedRunKernelCuda(ceed, kernel, CeedDivUpInt(nnodes, blocksize),
+                           blocksize, args); CeedChk(ierr);
+
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
+
+  // Restore arrays
+  ierr = CeedVectorRestoreArrayRead(u, &d_u); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(v, &d_v); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Multiplicity from the row lengths of the transpose offsets
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionGetMultiplicity_Cuda(CeedElemRestriction r,
+    CeedVector mult) {
+  int ierr;
+  CeedElemRestriction_Cuda *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+  Ceed ceed;
+  ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
+
+  // Nodes without element entries keep a zero multiplicity
+  if (!impl->tcovers) {
+    ierr = CeedVectorSetValue(mult, 0.0); CeedChk(ierr);
+  }
+  CeedScalar *d_mult;
+  ierr = CeedVectorGetArray(mult, CEED_MEM_DEVICE, &d_mult); CeedChk(ierr);
+  void *args[] = {&impl->d_lvec_indices, &impl->d_toffsets, &d_mult};
+  const CeedInt blocksize = 32;
+  ierr = CeedRunKernelCuda(ceed, impl->multiplicityOffset,
+                           CeedDivUpInt(impl->nnodes, blocksize), blocksize,
+                           args); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(mult, &d_mult); CeedChk(ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Blocked not supported
 //------------------------------------------------------------------------------
@@ -212,11 +484,35 @@ static int CeedElemRestrictionGetOffsets_Cuda(CeedElemRestriction rstr,
 
   switch (mtype) {
   case CEED_MEM_HOST:
+    // Offsets given in device memory are copied to the host on first use
+    if (!impl->h_ind && impl->d_ind) {
+      Ceed ceed;
+      CeedInt nelem, elemsize;
+      ierr = CeedElemRestrictionGetCeed(rstr, &ceed); CeedChk(ierr);
+      ierr = CeedElemRestrictionGetNumElements(rstr, &nelem); CeedChk(ierr);
+      ierr = CeedElemRestrictionGetElementSize(rstr, &elemsize); CeedChk(ierr);
+      ierr = CeedMalloc(nelem*elemsize, &impl->h_ind_allocated); CeedChk(ierr);
+      ierr = cudaMemcpy(impl->h_ind_allocated, impl->d_ind,
+                        nelem*elemsize*sizeof(CeedInt), cudaMemcpyDeviceToHost);
+      CeedChk_Cu(ceed, ierr);
+      impl->h_ind = impl->h_ind_allocated;
+      ierr = CeedElemRestrictionTrackMemory(rstr, CEED_MEMSPACE_HOST,
+                                            nelem*elemsize*sizeof(CeedInt));
+      CeedChk(ierr);
+    }
     *offsets = impl->h_ind;
     break;
   case CEED_MEM_DEVICE:
     *offsets = impl->d_ind;
     break;
+  case CEED_MEM_UNIFIED: {
+    Ceed ceed;
+    ierr = CeedElemRestrictionGetCeed(rstr, &ceed); CeedChk(ierr);
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "CEED_MEM_UNIFIED is only supported for "
+                     "CeedVector");
+    // LCOV_EXCL_STOP
+  }
   }
   return 0;
 }
@@ -233,103 +529,121 @@ static int CeedElemRestrictionDestroy_Cuda(CeedElemRestriction r) {
   ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
   ierr = cuModuleUnload(impl->module); CeedChk_Cu(ceed, ierr);
   ierr = CeedFree(&impl->h_ind_allocated); CeedChk(ierr);
-  ierr = cudaFree(impl->d_ind_allocated); CeedChk_Cu(ceed, ierr);
-  ierr = cudaFree(impl->d_toffsets); CeedChk_Cu(ceed, ierr);
-  ierr = cudaFree(impl->d_tindices); CeedChk_Cu(ceed, ierr);
-  ierr = cudaFree(impl->d_lvec_indices); CeedChk_Cu(ceed, ierr);
+  ierr = CeedCudaFree(ceed, impl->d_ind_allocated); CeedChk(ierr);
+  if (!impl->sharedtables) {
+    ierr = CeedCudaFree(ceed, impl->d_toffsets); CeedChk(ierr);
+    ierr = CeedCudaFree(ceed, impl->d_tindices); CeedChk(ierr);
+    ierr = CeedCudaFree(ceed, impl->d_lvec_indices); CeedChk(ierr);
+  }
+  ierr = CeedCudaFree(ceed, impl->d_eoffsets); CeedChk(ierr);
+  ierr = CeedCudaFree(ceed, impl->d_stencil); CeedChk(ierr);
 
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Device transpose construction (impl in .cu file)
+//------------------------------------------------------------------------------
+int CeedDeviceRestrictionNodes_Cuda(const CeedInt *d_ind, CeedInt size,
+                                    CeedInt lsize, CeedInt *nodeoffset,
+                                    CeedInt *nnodes);
+int CeedDeviceRestrictionTranspose_Cuda(const CeedInt *d_ind, CeedInt size,
+                                        CeedInt lsize, CeedInt nnodes,
+                                        const CeedInt *nodeoffset,
+                                        CeedInt *cursor, CeedInt *lvecindices,
+                                        CeedInt *toffsets, CeedInt *tindices);
+int CeedDeviceRestrictionCovers_Cuda(const CeedInt *lvecindices,
+                                     CeedInt nnodes, CeedInt ncomp,
+                                     CeedInt compstride, CeedInt lsize,
+                                     CeedInt *hits, bool *covers);
+
 //------------------------------------------------------------------------------
 // Create transpose offsets and indices
+//
+// The tables are built on the device from the device offsets, numbering the
+//   used L-vector nodes with a histogram and scan, scattering the E-vector
+//   indices to their node, and sorting the indices of each node, so no host
+//   copy of the offsets is needed. A view sharing the device offsets of its
+//   source shares the tables as well, they do not depend on ncomp.
 //------------------------------------------------------------------------------
-static int CeedElemRestrictionOffset_Cuda(const CeedElemRestriction r,
-    const CeedInt *indices) {
+static int CeedElemRestrictionOffset_Cuda(const CeedElemRestriction r) {
   int ierr;
   Ceed ceed;
   ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
   CeedElemRestriction_Cuda *impl;
   ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
-  CeedInt nelem, elemsize, lsize, ncomp;
+  CeedInt nelem, elemsize, lsize, ncomp, compstride;
   ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
   ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
   ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
   ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
-
-  // Count nnodes
-  bool *isNode;
-  ierr = CeedCalloc(lsize, &isNode); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
   const CeedInt sizeIndices = nelem * elemsize;
-  for (CeedInt i = 0; i < sizeIndices; i++)
-    isNode[indices[i]] = 1;
-  CeedInt nnodes = 0;
-  for (CeedInt i = 0; i < lsize; i++)
-    nnodes += isNode[i];
-  impl->nnodes = nnodes;
-
-  // L-vector offsets array
-  CeedInt *ind_to_offset, *lvec_indices;
-  ierr = CeedCalloc(lsize, &ind_to_offset); CeedChk(ierr);
-  ierr = CeedCalloc(nnodes, &lvec_indices); CeedChk(ierr);
-  CeedInt j = 0;
-  for (CeedInt i = 0; i < lsize; i++)
-    if (isNode[i]) {
-      lvec_indices[j] = i;
-      ind_to_offset[i] = j++;
-    }
-  ierr = CeedFree(&isNode); CeedChk(ierr);
-
-  // Compute transpose offsets and indices
-  const CeedInt sizeOffsets = nnodes + 1;
-  CeedInt *toffsets;
-  ierr = CeedCalloc(sizeOffsets, &toffsets); CeedChk(ierr);
-  CeedInt *tindices;
-  ierr = CeedMalloc(sizeIndices, &tindices); CeedChk(ierr);
-  // Count node multiplicity
-  for (CeedInt e = 0; e < nelem; ++e)
-    for (CeedInt i = 0; i < elemsize; ++i)
-      ++toffsets[ind_to_offset[indices[elemsize*e + i]] + 1];
-  // Convert to running sum
-  for (CeedInt i = 1; i < sizeOffsets; ++i)
-    toffsets[i] += toffsets[i-1];
-  // List all E-vec indices associated with L-vec node
-  for (CeedInt e = 0; e < nelem; ++e) {
-    for (CeedInt i = 0; i < elemsize; ++i) {
-      const CeedInt lid = elemsize*e + i;
-      const CeedInt gid = indices[lid];
-      tindices[toffsets[ind_to_offset[gid]]++] = lid;
+  CeedInt *d_work;
+  ierr = CeedCudaMalloc(ceed, (void **)&d_work, (lsize + 1)*sizeof(CeedInt));
+  CeedChk(ierr);
+
+  CeedElemRestriction source;
+  CeedElemRestriction_Cuda *simpl = NULL;
+  ierr = CeedElemRestrictionGetViewSource(r, &source); CeedChk(ierr);
+  if (source) {
+    // Restrictions of a batch read only a range of the source offsets
+    CeedInt snelem, selemsize;
+    ierr = CeedElemRestrictionGetNumElements(source, &snelem); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(source, &selemsize);
+    CeedChk(ierr);
+    if (snelem == nelem && selemsize == elemsize) {
+      ierr = CeedElemRestrictionGetData(source, &simpl); CeedChk(ierr);
     }
   }
-  // Reset running sum
-  for (int i = sizeOffsets - 1; i > 0; --i)
-    toffsets[i] = toffsets[i - 1];
-  toffsets[0] = 0;
-
-  // Copy data to device
-  // -- L-vector indices
-  ierr = cudaMalloc((void **)&impl->d_lvec_indices, nnodes*sizeof(CeedInt));
-  CeedChk_Cu(ceed, ierr);
-  ierr = cudaMemcpy(impl->d_lvec_indices, lvec_indices,
-                    nnodes*sizeof(CeedInt), cudaMemcpyHostToDevice);
-  CeedChk_Cu(ceed, ierr);
-  // -- Transpose offsets
-  ierr = cudaMalloc((void **)&impl->d_toffsets, sizeOffsets*sizeof(CeedInt));
-  CeedChk_Cu(ceed, ierr);
-  ierr = cudaMemcpy(impl->d_toffsets, toffsets, sizeOffsets*sizeof(CeedInt),
-                    cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
-  // -- Transpose indices
-  ierr = cudaMalloc((void **)&impl->d_tindices, sizeIndices*sizeof(CeedInt));
-  CeedChk_Cu(ceed, ierr);
-  ierr = cudaMemcpy(impl->d_tindices, tindices, sizeIndices*sizeof(CeedInt),
-                    cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
+  if (simpl && simpl->d_ind == impl->d_ind && simpl->d_toffsets) {
+    // Share transpose offsets and indices
+    impl->sharedtables   = true;
+    impl->nnodes         = simpl->nnodes;
+    impl->d_lvec_indices = simpl->d_lvec_indices;
+    impl->d_toffsets     = simpl->d_toffsets;
+    impl->d_tindices     = simpl->d_tindices;
+  } else {
+    // Number nodes
+    CeedInt nnodes;
+    ierr = CeedDeviceRestrictionNodes_Cuda(impl->d_ind, sizeIndices, lsize,
+                                           d_work, &nnodes);
+    CeedChk_Cu(ceed, ierr);
+    impl->nnodes = nnodes;
+
+    // Compute transpose offsets and indices
+    const CeedInt sizeOffsets = nnodes + 1;
+    CeedInt *d_cursor;
+    ierr = CeedCudaMalloc(ceed, (void **)&impl->d_lvec_indices,
+                          nnodes*sizeof(CeedInt)); CeedChk(ierr);
+    ierr = CeedCudaMalloc(ceed, (void **)&impl->d_toffsets,
+                          sizeOffsets*sizeof(CeedInt)); CeedChk(ierr);
+    ierr = CeedCudaMalloc(ceed, (void **)&impl->d_tindices,
+                          sizeIndices*sizeof(CeedInt)); CeedChk(ierr);
+    ierr = CeedCudaMalloc(ceed, (void **)&d_cursor, nnodes*sizeof(CeedInt));
+    CeedChk(ierr);
+    ierr = CeedDeviceRestrictionTranspose_Cuda(impl->d_ind, sizeIndices,
+           lsize, nnodes, d_work, d_cursor, impl->d_lvec_indices,
+           impl->d_toffsets, impl->d_tindices); CeedChk_Cu(ceed, ierr);
+    ierr = CeedCudaFree(ceed, d_cursor); CeedChk(ierr);
+    ierr = CeedElemRestrictionTrackMemory(r, CEED_MEMSPACE_DEVICE,
+                                          (nnodes + sizeOffsets + sizeIndices)*
+                                          sizeof(CeedInt)); CeedChk(ierr);
+  }
+
+  // The L-vector is overwritten by the transpose when the node components
+  //   tile it without overlap
+  impl->tcovers = impl->nnodes*ncomp == lsize;
+  if (impl->tcovers && ncomp > 1) {
+    ierr = CeedDeviceRestrictionCovers_Cuda(impl->d_lvec_indices,
+                                            impl->nnodes, ncomp, compstride,
+                                            lsize, d_work, &impl->tcovers);
+    CeedChk_Cu(ceed, ierr);
+  }
 
   // Cleanup
-  ierr = CeedFree(&ind_to_offset); CeedChk(ierr);
-  ierr = CeedFree(&lvec_indices); CeedChk(ierr);
-  ierr = CeedFree(&toffsets); CeedChk(ierr);
-  ierr = CeedFree(&tindices); CeedChk(ierr);
+  ierr = CeedCudaFree(ceed, d_work); CeedChk(ierr);
   return 0;
 }
 
@@ -342,6 +656,12 @@ int CeedElemRestrictionCreate_Cuda(CeedMemType mtype, CeedCopyMode cmode,
   int ierr;
   Ceed ceed;
   ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
+  CeedInt nsides;
+  ierr = CeedElemRestrictionGetNumSides(r, &nsides); CeedChk(ierr);
+  if (nsides > 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Two-sided restrictions not supported");
+  // LCOV_EXCL_STOP
   CeedElemRestriction_Cuda *impl;
   ierr = CeedCalloc(1, &impl); CeedChk(ierr);
   CeedInt nelem, ncomp, elemsize;
@@ -372,7 +692,10 @@ int CeedElemRestrictionCreate_Cuda(CeedMemType mtype, CeedCopyMode cmode,
   impl->d_ind_allocated = NULL;
   impl->d_tindices      = NULL;
   impl->d_toffsets      = NULL;
+  impl->d_eoffsets      = NULL;
+  impl->d_stencil       = NULL;
   impl->nnodes = size;
+  impl->vec2 = !isStrided && compstride == 1 && ncomp > 1;
   ierr = CeedElemRestrictionSetData(r, impl); CeedChk(ierr);
   CeedInt layout[3] = {1, elemsize*nelem, elemsize};
   ierr = CeedElemRestrictionSetELayout(r, layout); CeedChk(ierr);
@@ -391,20 +714,22 @@ int CeedElemRestrictionCreate_Cuda(CeedMemType mtype, CeedCopyMode cmode,
       break;
     }
     if (indices != NULL) {
-      ierr = cudaMalloc( (void **)&impl->d_ind, size * sizeof(CeedInt));
-      CeedChk_Cu(ceed, ierr);
+      ierr = CeedCudaMalloc(ceed, (void **)&impl->d_ind,
+                            size * sizeof(CeedInt));
+      CeedChk(ierr);
       impl->d_ind_allocated = impl->d_ind; // We own the device memory
       ierr = cudaMemcpy(impl->d_ind, indices, size * sizeof(CeedInt),
                         cudaMemcpyHostToDevice);
       CeedChk_Cu(ceed, ierr);
-      ierr = CeedElemRestrictionOffset_Cuda(r, indices); CeedChk(ierr);
+      ierr = CeedElemRestrictionOffset_Cuda(r); CeedChk(ierr);
     }
   } else if (mtype == CEED_MEM_DEVICE) {
     switch (cmode) {
     case CEED_COPY_VALUES:
       if (indices != NULL) {
-        ierr = cudaMalloc( (void **)&impl->d_ind, size * sizeof(CeedInt));
-        CeedChk_Cu(ceed, ierr);
+        ierr = CeedCudaMalloc(ceed, (void **)&impl->d_ind,
+                              size * sizeof(CeedInt));
+        CeedChk(ierr);
         impl->d_ind_allocated = impl->d_ind; // We own the device memory
         ierr = cudaMemcpy(impl->d_ind, indices, size * sizeof(CeedInt),
                           cudaMemcpyDeviceToDevice);
@@ -419,7 +744,7 @@ int CeedElemRestrictionCreate_Cuda(CeedMemType mtype, CeedCopyMode cmode,
       impl->d_ind = (CeedInt *)indices;
     }
     if (indices != NULL) {
-      ierr = CeedElemRestrictionOffset_Cuda(r, indices); CeedChk(ierr);
+      ierr = CeedElemRestrictionOffset_Cuda(r); CeedChk(ierr);
     }
   } else {
     // LCOV_EXCL_START
@@ -427,6 +752,36 @@ int CeedElemRestrictionCreate_Cuda(CeedMemType mtype, CeedCopyMode cmode,
     // LCOV_EXCL_STOP
   }
 
+  if (impl->h_ind_allocated) {
+    ierr = CeedElemRestrictionTrackMemory(r, CEED_MEMSPACE_HOST,
+                                          size*sizeof(CeedInt)); CeedChk(ierr);
+  }
+  if (impl->d_ind_allocated) {
+    ierr = CeedElemRestrictionTrackMemory(r, CEED_MEMSPACE_DEVICE,
+                                          size*sizeof(CeedInt)); CeedChk(ierr);
+  }
+
+  // Compressed offsets, the expanded offsets are kept for transpose
+  //   restrictions and for other backends
+  bool isCompressed;
+  ierr = CeedElemRestrictionIsCompressed(r, &isCompressed); CeedChk(ierr);
+  if (isCompressed) {
+    const CeedInt *eoffsets, *stencil;
+    ierr = CeedElemRestrictionGetCompressedOffsets(r, &eoffsets, &stencil);
+    CeedChk(ierr);
+    ierr = CeedCudaMalloc(ceed, (void **)&impl->d_eoffsets,
+                          nelem * sizeof(CeedInt)); CeedChk(ierr);
+    ierr = cudaMemcpy(impl->d_eoffsets, eoffsets, nelem * sizeof(CeedInt),
+                      cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
+    ierr = CeedCudaMalloc(ceed, (void **)&impl->d_stencil,
+                          elemsize * sizeof(CeedInt)); CeedChk(ierr);
+    ierr = cudaMemcpy(impl->d_stencil, stencil, elemsize * sizeof(CeedInt),
+                      cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
+    ierr = CeedElemRestrictionTrackMemory(r, CEED_MEMSPACE_DEVICE,
+                                          (nelem + elemsize)*sizeof(CeedInt));
+    CeedChk(ierr);
+  }
+
   // Compile CUDA kernels
   CeedInt nnodes = impl->nnodes;
   ierr = CeedCompileCuda(ceed, restrictionkernels, &impl->module, 8,
@@ -446,17 +801,40 @@ int CeedElemRestrictionCreate_Cuda(CeedMemType mtype, CeedCopyMode cmode,
   CeedChk(ierr);
   ierr = CeedGetKernelCuda(ceed, impl->module, "trOffset", &impl->trOffset);
   CeedChk(ierr);
+  ierr = CeedGetKernelCuda(ceed, impl->module, "noTrCompressed",
+                           &impl->noTrCompressed); CeedChk(ierr);
+  ierr = CeedGetKernelCuda(ceed, impl->module, "noTrOffsetVec2",
+                           &impl->noTrOffsetVec2); CeedChk(ierr);
+  ierr = CeedGetKernelCuda(ceed, impl->module, "trOffsetVec2",
+                           &impl->trOffsetVec2); CeedChk(ierr);
+  ierr = CeedGetKernelCuda(ceed, impl->module, "trOffsetSet",
+                           &impl->trOffsetSet); CeedChk(ierr);
+  ierr = CeedGetKernelCuda(ceed, impl->module, "trOffsetSetVec2",
+                           &impl->trOffsetSetVec2); CeedChk(ierr);
+  ierr = CeedGetKernelCuda(ceed, impl->module, "noTrCompressedVec2",
+                           &impl->noTrCompressedVec2); CeedChk(ierr);
+  ierr = CeedGetKernelCuda(ceed, impl->module, "multiplicityOffset",
+                           &impl->multiplicityOffset); CeedChk(ierr);
 
   // Register backend functions
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "Apply",
                                 CeedElemRestrictionApply_Cuda);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "ApplyOverwrite",
+                                CeedElemRestrictionApplyOverwrite_Cuda);
+  CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "ApplyBlock",
                                 CeedElemRestrictionApplyBlock_Cuda);
   CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "GetOffsets",
                                 CeedElemRestrictionGetOffsets_Cuda);
   CeedChk(ierr);
+  if (impl->d_toffsets) {
+    ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r,
+                                  "GetMultiplicity",
+                                  CeedElemRestrictionGetMultiplicity_Cuda);
+    CeedChk(ierr);
+  }
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "Destroy",
                                 CeedElemRestrictionDestroy_Cuda);
   CeedChk(ierr);
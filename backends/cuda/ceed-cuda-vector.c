@@ -28,7 +28,257 @@ static inline size_t bytes(const CeedVector vec) {
 }
 
 //------------------------------------------------------------------------------
-// Sync host to device
+// Record completion of an asynchronous transfer on the default stream
+//------------------------------------------------------------------------------
+static inline int CeedVectorRecordTransfer_Cuda(const CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Cuda *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  if (!data->transfer) {
+    ierr = cudaEventCreateWithFlags(&data->transfer, cudaEventDisableTiming);
+    CeedChk_Cu(ceed, ierr);
+  }
+  ierr = cudaEventRecord(data->transfer, 0); CeedChk_Cu(ceed, ierr);
+  data->transferpending = true;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Wait for an asynchronous transfer to complete before host access
+//------------------------------------------------------------------------------
+static inline int CeedVectorWaitTransfer_Cuda(const CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Cuda *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  // Kernels may still access managed memory, so wait for the whole stream
+  if (data->unified) {
+    ierr = CeedVectorRecordTransfer_Cuda(vec); CeedChk(ierr);
+  }
+  if (data->transferpending) {
+    ierr = cudaEventSynchronize(data->transfer); CeedChk_Cu(ceed, ierr);
+    data->transferpending = false;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Allocate the host array in page-locked memory, so transfers run at full
+//   bandwidth without staging, falling back to pageable memory
+//------------------------------------------------------------------------------
+static int CeedVectorHostMalloc_Cuda(const CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Cuda *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  bool used;
+  ierr = CeedAllocatorMalloc(ceed, CEED_MEMSPACE_PINNED, bytes(vec),
+                             &data->h_array_allocated, &used); CeedChk(ierr);
+  if (used) {
+    data->h_array_pinned = true;
+    data->h_array = data->h_array_allocated;
+    return 0;
+  }
+  ierr = cudaMallocHost((void **)&data->h_array_allocated, bytes(vec));
+  data->h_array_pinned = ierr == cudaSuccess;
+  if (!data->h_array_pinned) {
+    CeedInt length;
+    cudaGetLastError();
+    ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+    ierr = CeedMalloc(length, &data->h_array_allocated); CeedChk(ierr);
+  }
+  data->h_array = data->h_array_allocated;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Free the host array allocated by the backend or owned by the vector
+//------------------------------------------------------------------------------
+static int CeedVectorHostFree_Cuda(const CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Cuda *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  ierr = CeedVectorWaitTransfer_Cuda(vec); CeedChk(ierr);
+  if (data->h_array_pinned) {
+    bool used;
+    ierr = CeedAllocatorFree(ceed, CEED_MEMSPACE_PINNED,
+                             &data->h_array_allocated, &used); CeedChk(ierr);
+    if (!used) {
+      ierr = cudaFreeHost(data->h_array_allocated); CeedChk_Cu(ceed, ierr);
+    }
+    data->h_array_allocated = NULL;
+    data->h_array_pinned = false;
+  } else {
+    ierr = CeedFreeHost(ceed, &data->h_array_allocated); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Match the tracked memory usage to the arrays the vector currently owns,
+//   managed memory is accounted to the device
+//------------------------------------------------------------------------------
+static int CeedVectorUpdateMemory_Cuda(const CeedVector vec) {
+  int ierr;
+  CeedVector_Cuda *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  const size_t owned[CEED_MEMSPACE_NUM] = {
+    [CEED_MEMSPACE_HOST] = data->h_array_allocated &&
+                           !data->h_array_pinned ? bytes(vec) : 0,
+    [CEED_MEMSPACE_DEVICE] = data->d_array_allocated ||
+                             data->m_array_allocated ? bytes(vec) : 0,
+    [CEED_MEMSPACE_PINNED] = data->h_array_allocated &&
+                             data->h_array_pinned ? bytes(vec) : 0,
+  };
+  for (int s = 0; s < CEED_MEMSPACE_NUM; s++) {
+    size_t used;
+    ierr = CeedVectorGetMemoryUsage(vec, s, &used); CeedChk(ierr);
+    if (used != owned[s]) {
+      ierr = CeedVectorTrackMemory(vec, s, (ptrdiff_t)owned[s] -
+                                   (ptrdiff_t)used); CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Page-lock a CEED_USE_POINTER host array, if enabled with CEED_HOST_REGISTER
+//------------------------------------------------------------------------------
+static int CeedVectorHostRegister_Cuda(const CeedVector vec,
+                                       CeedScalar *array) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  Ceed_Cuda *ceed_data;
+  ierr = CeedGetData(ceed, &ceed_data); CeedChk(ierr);
+  CeedVector_Cuda *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  if (!array || !ceed_data->hostregister)
+    return 0;
+  ierr = cudaHostRegister(array, bytes(vec), cudaHostRegisterDefault);
+  if (ierr == cudaSuccess)
+    data->h_array_registered = array;
+  else
+    cudaGetLastError(); // Already page-locked or unsupported, use as is
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Release page-locking of a CEED_USE_POINTER host array
+//------------------------------------------------------------------------------
+static int CeedVectorHostUnregister_Cuda(const CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Cuda *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  if (data->h_array_registered) {
+    ierr = CeedVectorWaitTransfer_Cuda(vec); CeedChk(ierr);
+    ierr = cudaHostUnregister(data->h_array_registered); CeedChk_Cu(ceed, ierr);
+    data->h_array_registered = NULL;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Move the vector data to a managed allocation shared by host and device
+//------------------------------------------------------------------------------
+static int CeedVectorSetUnified_Cuda(const CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Cuda *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  if (data->unified)
+    return 0;
+  if ((data->h_array && data->h_array != data->h_array_allocated) ||
+      (data->d_array && data->d_array != data->d_array_allocated))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Cannot move an array set with CEED_USE_POINTER "
+                     "to unified memory");
+  // LCOV_EXCL_STOP
+
+  CeedScalar *m_array;
+  ierr = cudaMallocManaged((void **)&m_array, bytes(vec), cudaMemAttachGlobal);
+  CeedChk_Cu(ceed, ierr);
+  ierr = CeedVectorWaitTransfer_Cuda(vec); CeedChk(ierr);
+  switch (data->memState) {
+  case CEED_CUDA_HOST_SYNC:
+    memcpy(m_array, data->h_array, bytes(vec));
+    break;
+  case CEED_CUDA_DEVICE_SYNC:
+  case CEED_CUDA_BOTH_SYNC:
+    ierr = cudaMemcpy(m_array, data->d_array, bytes(vec),
+                      cudaMemcpyDeviceToDevice); CeedChk_Cu(ceed, ierr);
+    break;
+  case CEED_CUDA_NONE_SYNC:
+    break;
+  }
+  ierr = CeedVectorHostFree_Cuda(vec); CeedChk(ierr);
+  ierr = CeedCudaFree(ceed, data->d_array_allocated); CeedChk(ierr);
+  data->d_array_allocated = NULL;
+  data->m_array_allocated = m_array;
+  data->h_array = m_array;
+  data->d_array = m_array;
+  data->unified = true;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Release the managed allocation, leaving the vector without an array
+//------------------------------------------------------------------------------
+static int CeedVectorUnsetUnified_Cuda(const CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Cuda *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  if (!data->unified)
+    return 0;
+  ierr = CeedVectorWaitTransfer_Cuda(vec); CeedChk(ierr);
+  ierr = cudaFree(data->m_array_allocated); CeedChk_Cu(ceed, ierr);
+  data->m_array_allocated = NULL;
+  data->h_array = NULL;
+  data->d_array = NULL;
+  data->unified = false;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Prefetch managed memory to the host or device
+//------------------------------------------------------------------------------
+static inline int CeedVectorPrefetch_Cuda(const CeedVector vec, int device) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Cuda *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  // Only a hint; pages that are not prefetched migrate on demand
+  ierr = cudaMemPrefetchAsync(data->h_array, bytes(vec), device, 0);
+  if (ierr != cudaSuccess)
+    cudaGetLastError();
+  ierr = CeedVectorRecordTransfer_Cuda(vec); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Sync host to device, asynchronously with respect to the host
 //------------------------------------------------------------------------------
 static inline int CeedVectorSyncH2D_Cuda(const CeedVector vec) {
   int ierr;
@@ -36,14 +286,28 @@ static inline int CeedVectorSyncH2D_Cuda(const CeedVector vec) {
   ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
   CeedVector_Cuda *data;
   ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+  ierr = CeedVectorAuditTransfer(vec, CEED_MEM_DEVICE, bytes(vec));
+  CeedChk(ierr);
+
+  if (data->unified) {
+    Ceed_Cuda *ceed_data;
+    ierr = CeedGetData(ceed, &ceed_data); CeedChk(ierr);
+    return CeedVectorPrefetch_Cuda(vec, ceed_data->deviceId);
+  }
 
-  ierr = cudaMemcpy(data->d_array, data->h_array, bytes(vec),
-                    cudaMemcpyHostToDevice); CeedChk_Cu(ceed, ierr);
+  double start;
+  ierr = CeedProfileStart(ceed, CEED_PROFILE_TRANSFER, &start); CeedChk(ierr);
+  ierr = cudaMemcpyAsync(data->d_array, data->h_array, bytes(vec),
+                         cudaMemcpyHostToDevice, 0); CeedChk_Cu(ceed, ierr);
+  ierr = CeedVectorRecordTransfer_Cuda(vec); CeedChk(ierr);
+  ierr = CeedProfileStop(ceed, CEED_PROFILE_TRANSFER, start, bytes(vec));
+  CeedChk(ierr);
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// Sync device to host
+// Sync device to host; the host array may be used after
+//   CeedVectorWaitTransfer_Cuda()
 //------------------------------------------------------------------------------
 static inline int CeedVectorSyncD2H_Cuda(const CeedVector vec) {
   int ierr;
@@ -51,9 +315,19 @@ static inline int CeedVectorSyncD2H_Cuda(const CeedVector vec) {
   ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
   CeedVector_Cuda *data;
   ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+  ierr = CeedVectorAuditTransfer(vec, CEED_MEM_HOST, bytes(vec));
+  CeedChk(ierr);
 
-  ierr = cudaMemcpy(data->h_array, data->d_array, bytes(vec),
-                    cudaMemcpyDeviceToHost); CeedChk_Cu(ceed, ierr);
+  if (data->unified)
+    return CeedVectorPrefetch_Cuda(vec, cudaCpuDeviceId);
+
+  double start;
+  ierr = CeedProfileStart(ceed, CEED_PROFILE_TRANSFER, &start); CeedChk(ierr);
+  ierr = cudaMemcpyAsync(data->h_array, data->d_array, bytes(vec),
+                         cudaMemcpyDeviceToHost, 0); CeedChk_Cu(ceed, ierr);
+  ierr = CeedVectorRecordTransfer_Cuda(vec); CeedChk(ierr);
+  ierr = CeedProfileStop(ceed, CEED_PROFILE_TRANSFER, start, bytes(vec));
+  CeedChk(ierr);
   return 0;
 }
 
@@ -67,24 +341,30 @@ static int CeedVectorSetArrayHost_Cuda(const CeedVector vec,
   CeedVector_Cuda *data;
   ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
 
+  ierr = CeedVectorWaitTransfer_Cuda(vec); CeedChk(ierr);
   switch (cmode) {
-  case CEED_COPY_VALUES: {
-    CeedInt length;
+  case CEED_COPY_VALUES:
     if(!data->h_array) {
-      ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
-      ierr = CeedMalloc(length, &data->h_array_allocated); CeedChk(ierr);
-      data->h_array = data->h_array_allocated;
+      ierr = CeedVectorHostMalloc_Cuda(vec); CeedChk(ierr);
     }
     if (array)
       memcpy(data->h_array, array, bytes(vec));
-  } break;
+    break;
   case CEED_OWN_POINTER:
-    ierr = CeedFree(&data->h_array_allocated); CeedChk(ierr);
+    ierr = CeedVectorUnsetUnified_Cuda(vec); CeedChk(ierr);
+    ierr = CeedVectorHostUnregister_Cuda(vec); CeedChk(ierr);
+    ierr = CeedVectorHostFree_Cuda(vec); CeedChk(ierr);
     data->h_array_allocated = array;
     data->h_array = array;
     break;
   case CEED_USE_POINTER:
-    ierr = CeedFree(&data->h_array_allocated); CeedChk(ierr);
+    ierr = CeedVectorUnsetUnified_Cuda(vec); CeedChk(ierr);
+    ierr = CeedVectorHostFree_Cuda(vec); CeedChk(ierr);
+    // Keep the registration when the same array is set again
+    if (array != data->h_array_registered) {
+      ierr = CeedVectorHostUnregister_Cuda(vec); CeedChk(ierr);
+      ierr = CeedVectorHostRegister_Cuda(vec, array); CeedChk(ierr);
+    }
     data->h_array = array;
     break;
   }
@@ -106,8 +386,9 @@ static int CeedVectorSetArrayDevice_Cuda(const CeedVector vec,
   switch (cmode) {
   case CEED_COPY_VALUES:
     if (!data->d_array) {
-      ierr = cudaMalloc((void **)&data->d_array_allocated, bytes(vec));
-      CeedChk_Cu(ceed, ierr);
+      ierr = CeedCudaMalloc(ceed, (void **)&data->d_array_allocated,
+                            bytes(vec));
+      CeedChk(ierr);
       data->d_array = data->d_array_allocated;
     }
     if (array) {
@@ -116,12 +397,14 @@ static int CeedVectorSetArrayDevice_Cuda(const CeedVector vec,
     }
     break;
   case CEED_OWN_POINTER:
-    ierr = cudaFree(data->d_array_allocated); CeedChk_Cu(ceed, ierr);
+    ierr = CeedVectorUnsetUnified_Cuda(vec); CeedChk(ierr);
+    ierr = CeedCudaFree(ceed, data->d_array_allocated); CeedChk(ierr);
     data->d_array_allocated = array;
     data->d_array = array;
     break;
   case CEED_USE_POINTER:
-    ierr = cudaFree(data->d_array_allocated); CeedChk_Cu(ceed, ierr);
+    ierr = CeedVectorUnsetUnified_Cuda(vec); CeedChk(ierr);
+    ierr = CeedCudaFree(ceed, data->d_array_allocated); CeedChk(ierr);
     data->d_array_allocated = NULL;
     data->d_array = array;
     break;
@@ -130,6 +413,45 @@ static int CeedVectorSetArrayDevice_Cuda(const CeedVector vec,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Set array from unified memory
+//------------------------------------------------------------------------------
+static int CeedVectorSetArrayUnified_Cuda(const CeedVector vec,
+    const CeedCopyMode cmode, CeedScalar *array) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Cuda *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  switch (cmode) {
+  case CEED_COPY_VALUES:
+    ierr = CeedVectorSetUnified_Cuda(vec); CeedChk(ierr);
+    ierr = CeedVectorWaitTransfer_Cuda(vec); CeedChk(ierr);
+    if (array) {
+      ierr = cudaMemcpy(data->h_array, array, bytes(vec), cudaMemcpyDefault);
+      CeedChk_Cu(ceed, ierr);
+    }
+    break;
+  case CEED_OWN_POINTER:
+  case CEED_USE_POINTER:
+    ierr = CeedVectorUnsetUnified_Cuda(vec); CeedChk(ierr);
+    ierr = CeedVectorHostUnregister_Cuda(vec); CeedChk(ierr);
+    ierr = CeedVectorHostFree_Cuda(vec); CeedChk(ierr);
+    ierr = CeedCudaFree(ceed, data->d_array_allocated); CeedChk(ierr);
+    data->d_array_allocated = NULL;
+    data->m_array_allocated = cmode == CEED_OWN_POINTER ? array : NULL;
+    data->h_array = array;
+    data->d_array = array;
+    data->unified = true;
+    break;
+  }
+  // Unified arrays are shared with host code, so the next device access
+  //   prefetches them
+  data->memState = CEED_CUDA_HOST_SYNC;
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Set the array used by a vector,
 //   freeing any previously allocated array if applicable
@@ -146,11 +468,17 @@ static int CeedVectorSetArray_Cuda(const CeedVector vec,
 
   switch (mtype) {
   case CEED_MEM_HOST:
-    return CeedVectorSetArrayHost_Cuda(vec, cmode, array);
+    ierr = CeedVectorSetArrayHost_Cuda(vec, cmode, array); CeedChk(ierr);
+    break;
   case CEED_MEM_DEVICE:
-    return CeedVectorSetArrayDevice_Cuda(vec, cmode, array);
+    ierr = CeedVectorSetArrayDevice_Cuda(vec, cmode, array); CeedChk(ierr);
+    break;
+  case CEED_MEM_UNIFIED:
+    ierr = CeedVectorSetArrayUnified_Cuda(vec, cmode, array); CeedChk(ierr);
+    break;
   }
-  return 1;
+  ierr = CeedVectorUpdateMemory_Cuda(vec); CeedChk(ierr);
+  return 0;
 }
 
 //------------------------------------------------------------------------------
@@ -159,6 +487,8 @@ static int CeedVectorSetArray_Cuda(const CeedVector vec,
 static int CeedVectorTakeArray_Cuda(CeedVector vec, CeedMemType mtype,
                                     CeedScalar **array) {
   int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
   CeedVector_Cuda *impl;
   ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
 
@@ -167,7 +497,19 @@ static int CeedVectorTakeArray_Cuda(CeedVector vec, CeedMemType mtype,
     if (impl->memState == CEED_CUDA_DEVICE_SYNC) {
       ierr = CeedVectorSyncD2H_Cuda(vec); CeedChk(ierr);
     }
-    (*array) = impl->h_array;
+    ierr = CeedVectorWaitTransfer_Cuda(vec); CeedChk(ierr);
+    ierr = CeedVectorHostUnregister_Cuda(vec); CeedChk(ierr);
+    if (impl->h_array_pinned || impl->unified) {
+      // The caller frees the array with CeedFree, so return pageable memory
+      CeedInt length;
+      ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+      ierr = CeedMalloc(length, array); CeedChk(ierr);
+      memcpy(*array, impl->h_array, bytes(vec));
+      ierr = CeedVectorHostFree_Cuda(vec); CeedChk(ierr);
+      ierr = CeedVectorUnsetUnified_Cuda(vec); CeedChk(ierr);
+    } else {
+      (*array) = impl->h_array;
+    }
     impl->h_array = NULL;
     impl->h_array_allocated = NULL;
     impl->memState = CEED_CUDA_HOST_SYNC;
@@ -176,13 +518,36 @@ static int CeedVectorTakeArray_Cuda(CeedVector vec, CeedMemType mtype,
     if (impl->memState == CEED_CUDA_HOST_SYNC) {
       ierr = CeedVectorSyncH2D_Cuda(vec); CeedChk(ierr);
     }
+    if (impl->unified) {
+      // The caller frees the array with cudaFree, so return a copy
+      CeedScalar *d_array;
+      ierr = CeedCudaMalloc(ceed, (void **)&d_array, bytes(vec)); CeedChk(ierr);
+      ierr = cudaMemcpy(d_array, impl->d_array, bytes(vec),
+                        cudaMemcpyDeviceToDevice); CeedChk_Cu(ceed, ierr);
+      ierr = CeedVectorUnsetUnified_Cuda(vec); CeedChk(ierr);
+      impl->d_array = impl->d_array_allocated = d_array;
+    }
+    // The caller now owns the allocation and frees it with cudaFree
+    ierr = CeedCudaRelease(ceed, impl->d_array_allocated); CeedChk(ierr);
     (*array) = impl->d_array;
     impl->d_array = NULL;
     impl->d_array_allocated = NULL;
     impl->memState = CEED_CUDA_DEVICE_SYNC;
     break;
+  case CEED_MEM_UNIFIED:
+    ierr = CeedVectorSetUnified_Cuda(vec); CeedChk(ierr);
+    ierr = CeedVectorWaitTransfer_Cuda(vec); CeedChk(ierr);
+    // The caller now owns the allocation and frees it with cudaFree
+    (*array) = impl->h_array;
+    impl->m_array_allocated = NULL;
+    impl->h_array = NULL;
+    impl->d_array = NULL;
+    impl->unified = false;
+    impl->memState = CEED_CUDA_HOST_SYNC;
+    break;
   }
 
+  ierr = CeedVectorUpdateMemory_Cuda(vec); CeedChk(ierr);
   return 0;
 }
 
@@ -215,6 +580,7 @@ static int CeedVectorSetValue_Cuda(CeedVector vec, CeedScalar val) {
   ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
 
   // Set value for synced device/host array
+  ierr = CeedVectorWaitTransfer_Cuda(vec); CeedChk(ierr);
   switch(data->memState) {
   case CEED_CUDA_HOST_SYNC:
     ierr = CeedHostSetValue_Cuda(data->h_array, length, val); CeedChk(ierr);
@@ -225,8 +591,9 @@ static int CeedVectorSetValue_Cuda(CeedVector vec, CeedScalar val) {
       Default allocation then happens on the GPU.
     */
     if (data->d_array == NULL) {
-      ierr = cudaMalloc((void **)&data->d_array_allocated, bytes(vec));
-      CeedChk_Cu(ceed, ierr);
+      ierr = CeedCudaMalloc(ceed, (void **)&data->d_array_allocated,
+                            bytes(vec));
+      CeedChk(ierr);
       data->d_array = data->d_array_allocated;
     }
     data->memState = CEED_CUDA_DEVICE_SYNC;
@@ -236,10 +603,64 @@ static int CeedVectorSetValue_Cuda(CeedVector vec, CeedScalar val) {
     ierr = CeedDeviceSetValue_Cuda(data->d_array, length, val); CeedChk(ierr);
     break;
   case CEED_CUDA_BOTH_SYNC:
-    ierr = CeedHostSetValue_Cuda(data->h_array, length, val); CeedChk(ierr);
+    if (!data->unified) {
+      ierr = CeedHostSetValue_Cuda(data->h_array, length, val); CeedChk(ierr);
+    }
     ierr = CeedDeviceSetValue_Cuda(data->d_array, length, val); CeedChk(ierr);
     break;
   }
+  ierr = CeedVectorUpdateMemory_Cuda(vec); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Copy a vector where its values are valid: host values on the host, device
+//   values on the device, or between devices through unified addressing; the
+//   previous values of the copy are dropped without a sync
+//------------------------------------------------------------------------------
+static int CeedVectorCopy_Cuda(CeedVector vec, CeedVector copy) {
+  int ierr;
+  Ceed ceed, vecceed;
+  ierr = CeedVectorGetCeed(copy, &ceed); CeedChk(ierr);
+  ierr = CeedVectorGetCeed(vec, &vecceed); CeedChk(ierr);
+  Ceed_Cuda *ceed_data, *vecceed_data;
+  ierr = CeedGetData(ceed, &ceed_data); CeedChk(ierr);
+  ierr = CeedGetData(vecceed, &vecceed_data); CeedChk(ierr);
+  CeedVector_Cuda *data, *copy_data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+  ierr = CeedVectorGetData(copy, &copy_data); CeedChk(ierr);
+
+  ierr = CeedVectorWaitTransfer_Cuda(copy); CeedChk(ierr);
+  if (data->memState == CEED_CUDA_HOST_SYNC) {
+    if (!copy_data->h_array) {
+      ierr = CeedVectorHostMalloc_Cuda(copy); CeedChk(ierr);
+    }
+    ierr = CeedVectorWaitTransfer_Cuda(vec); CeedChk(ierr);
+    memcpy(copy_data->h_array, data->h_array, bytes(copy));
+    copy_data->memState = CEED_CUDA_HOST_SYNC;
+  } else {
+    if (!copy_data->d_array) {
+      ierr = CeedCudaMalloc(ceed, (void **)&copy_data->d_array_allocated,
+                            bytes(copy));
+      CeedChk(ierr);
+      copy_data->d_array = copy_data->d_array_allocated;
+    }
+    double start;
+    ierr = CeedProfileStart(ceed, CEED_PROFILE_TRANSFER, &start); CeedChk(ierr);
+    if (ceed_data->deviceId != vecceed_data->deviceId) {
+      ierr = cudaMemcpyPeerAsync(copy_data->d_array, ceed_data->deviceId,
+                                 data->d_array, vecceed_data->deviceId,
+                                 bytes(copy), 0); CeedChk_Cu(ceed, ierr);
+    } else {
+      ierr = cudaMemcpyAsync(copy_data->d_array, data->d_array, bytes(copy),
+                             cudaMemcpyDeviceToDevice, 0);
+      CeedChk_Cu(ceed, ierr);
+    }
+    ierr = CeedProfileStop(ceed, CEED_PROFILE_TRANSFER, start, bytes(copy));
+    CeedChk(ierr);
+    copy_data->memState = CEED_CUDA_DEVICE_SYNC;
+  }
+  ierr = CeedVectorUpdateMemory_Cuda(copy); CeedChk(ierr);
   return 0;
 }
 
@@ -261,23 +682,21 @@ static int CeedVectorGetArrayRead_Cuda(const CeedVector vec,
   switch (mtype) {
   case CEED_MEM_HOST:
     if(data->h_array==NULL) {
-      CeedInt length;
-      ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
-      ierr = CeedMalloc(length, &data->h_array_allocated);
-      CeedChk(ierr);
-      data->h_array = data->h_array_allocated;
+      ierr = CeedVectorHostMalloc_Cuda(vec); CeedChk(ierr);
     }
     if(data->memState==CEED_CUDA_DEVICE_SYNC) {
       ierr = CeedVectorSyncD2H_Cuda(vec);
       CeedChk(ierr);
       data->memState = CEED_CUDA_BOTH_SYNC;
     }
+    ierr = CeedVectorWaitTransfer_Cuda(vec); CeedChk(ierr);
     *array = data->h_array;
     break;
   case CEED_MEM_DEVICE:
     if (data->d_array==NULL) {
-      ierr = cudaMalloc((void **)&data->d_array_allocated, bytes(vec));
-      CeedChk_Cu(ceed, ierr);
+      ierr = CeedCudaMalloc(ceed, (void **)&data->d_array_allocated,
+                            bytes(vec));
+      CeedChk(ierr);
       data->d_array = data->d_array_allocated;
     }
     if (data->memState==CEED_CUDA_HOST_SYNC) {
@@ -287,7 +706,13 @@ static int CeedVectorGetArrayRead_Cuda(const CeedVector vec,
     }
     *array = data->d_array;
     break;
+  case CEED_MEM_UNIFIED:
+    ierr = CeedVectorSetUnified_Cuda(vec); CeedChk(ierr);
+    ierr = CeedVectorWaitTransfer_Cuda(vec); CeedChk(ierr);
+    *array = data->h_array;
+    break;
   }
+  ierr = CeedVectorUpdateMemory_Cuda(vec); CeedChk(ierr);
   return 0;
 }
 
@@ -307,22 +732,20 @@ static int CeedVectorGetArray_Cuda(const CeedVector vec,
   switch (mtype) {
   case CEED_MEM_HOST:
     if(data->h_array==NULL) {
-      CeedInt length;
-      ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
-      ierr = CeedMalloc(length, &data->h_array_allocated);
-      CeedChk(ierr);
-      data->h_array = data->h_array_allocated;
+      ierr = CeedVectorHostMalloc_Cuda(vec); CeedChk(ierr);
     }
     if(data->memState==CEED_CUDA_DEVICE_SYNC) {
       ierr = CeedVectorSyncD2H_Cuda(vec); CeedChk(ierr);
     }
+    ierr = CeedVectorWaitTransfer_Cuda(vec); CeedChk(ierr);
     data->memState = CEED_CUDA_HOST_SYNC;
     *array = data->h_array;
     break;
   case CEED_MEM_DEVICE:
     if (data->d_array==NULL) {
-      ierr = cudaMalloc((void **)&data->d_array_allocated, bytes(vec));
-      CeedChk_Cu(ceed, ierr);
+      ierr = CeedCudaMalloc(ceed, (void **)&data->d_array_allocated,
+                            bytes(vec));
+      CeedChk(ierr);
       data->d_array = data->d_array_allocated;
     }
     if (data->memState==CEED_CUDA_HOST_SYNC) {
@@ -331,6 +754,135 @@ static int CeedVectorGetArray_Cuda(const CeedVector vec,
     data->memState = CEED_CUDA_DEVICE_SYNC;
     *array = data->d_array;
     break;
+  case CEED_MEM_UNIFIED:
+    // Pages migrate as the caller touches them
+    ierr = CeedVectorSetUnified_Cuda(vec); CeedChk(ierr);
+    ierr = CeedVectorWaitTransfer_Cuda(vec); CeedChk(ierr);
+    data->memState = CEED_CUDA_HOST_SYNC;
+    *array = data->h_array;
+    break;
+  }
+  ierr = CeedVectorUpdateMemory_Cuda(vec); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Sync array to the requested memory type, leaving the transfer in flight;
+//   host access to the array waits for it to complete
+//------------------------------------------------------------------------------
+static int CeedVectorSyncArray_Cuda(const CeedVector vec,
+                                    const CeedMemType mtype) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Cuda *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  switch (mtype) {
+  case CEED_MEM_HOST:
+    if (data->memState == CEED_CUDA_DEVICE_SYNC) {
+      if (!data->h_array) {
+        ierr = CeedVectorHostMalloc_Cuda(vec); CeedChk(ierr);
+      }
+      ierr = CeedVectorSyncD2H_Cuda(vec); CeedChk(ierr);
+      data->memState = CEED_CUDA_BOTH_SYNC;
+    }
+    break;
+  case CEED_MEM_DEVICE:
+    if (data->memState == CEED_CUDA_HOST_SYNC) {
+      if (!data->d_array) {
+        ierr = CeedCudaMalloc(ceed, (void **)&data->d_array_allocated,
+                              bytes(vec));
+        CeedChk(ierr);
+        data->d_array = data->d_array_allocated;
+      }
+      ierr = CeedVectorSyncH2D_Cuda(vec); CeedChk(ierr);
+      data->memState = CEED_CUDA_BOTH_SYNC;
+    }
+    break;
+  case CEED_MEM_UNIFIED:
+    ierr = CeedVectorSetUnified_Cuda(vec); CeedChk(ierr);
+    break;
+  }
+  ierr = CeedVectorUpdateMemory_Cuda(vec); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Copy a range of a vector into the host array of another vector on a side
+//   stream; the copy waits for the work submitted so far and later work on the
+//   default stream waits for the copy, so the source is not overwritten early
+//------------------------------------------------------------------------------
+static int CeedVectorSnapshot_Cuda(const CeedVector vec, CeedInt offset,
+                                   const CeedVector snapshot,
+                                   CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  Ceed_Cuda *ceed_data;
+  ierr = CeedGetData(ceed, &ceed_data); CeedChk(ierr);
+  CeedVector_Cuda *data, *snap_data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+  ierr = CeedVectorGetData(snapshot, &snap_data); CeedChk(ierr);
+
+  // Host data is copied directly
+  if (data->memState != CEED_CUDA_DEVICE_SYNC || data->unified) {
+    const CeedScalar *array;
+    CeedScalar *snap_array;
+    ierr = CeedVectorGetArrayRead_Cuda(vec, CEED_MEM_HOST, &array);
+    CeedChk(ierr);
+    ierr = CeedVectorGetArray_Cuda(snapshot, CEED_MEM_HOST, &snap_array);
+    CeedChk(ierr);
+    memcpy(snap_array, array + offset, bytes(snapshot));
+    if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+      *request = NULL;
+    return 0;
+  }
+
+  // Page-locked staging array, free of earlier copies
+  if (!snap_data->h_array) {
+    ierr = CeedVectorHostMalloc_Cuda(snapshot); CeedChk(ierr);
+  }
+  ierr = CeedVectorWaitTransfer_Cuda(snapshot); CeedChk(ierr);
+  if (!snap_data->transfer) {
+    ierr = cudaEventCreateWithFlags(&snap_data->transfer,
+                                    cudaEventDisableTiming);
+    CeedChk_Cu(ceed, ierr);
+  }
+  ierr = CeedLock(ceed); CeedChk(ierr);
+  if (!ceed_data->snapstream) {
+    ierr = cudaStreamCreateWithFlags(&ceed_data->snapstream,
+                                     cudaStreamNonBlocking);
+  }
+  int ierrlock = CeedUnlock(ceed); CeedChk(ierrlock);
+  CeedChk_Cu(ceed, ierr);
+
+  // Copy on the side stream, ordered against the per-thread default stream
+  //   both ways
+  ierr = CeedVectorAuditTransfer(vec, CEED_MEM_HOST, bytes(snapshot));
+  CeedChk(ierr);
+  double start;
+  ierr = CeedProfileStart(ceed, CEED_PROFILE_TRANSFER, &start); CeedChk(ierr);
+  ierr = cudaEventRecord(snap_data->transfer, 0); CeedChk_Cu(ceed, ierr);
+  ierr = cudaStreamWaitEvent(ceed_data->snapstream, snap_data->transfer, 0);
+  CeedChk_Cu(ceed, ierr);
+  ierr = cudaMemcpyAsync(snap_data->h_array, data->d_array + offset,
+                         bytes(snapshot), cudaMemcpyDeviceToHost,
+                         ceed_data->snapstream); CeedChk_Cu(ceed, ierr);
+  ierr = cudaEventRecord(snap_data->transfer, ceed_data->snapstream);
+  CeedChk_Cu(ceed, ierr);
+  ierr = cudaStreamWaitEvent(0, snap_data->transfer, 0); CeedChk_Cu(ceed, ierr);
+  snap_data->transferpending = true;
+  snap_data->memState = CEED_CUDA_HOST_SYNC;
+  ierr = CeedProfileStop(ceed, CEED_PROFILE_TRANSFER, start, bytes(snapshot));
+  CeedChk(ierr);
+  ierr = CeedVectorUpdateMemory_Cuda(snapshot); CeedChk(ierr);
+
+  if (request == CEED_REQUEST_IMMEDIATE) {
+    ierr = CeedVectorWaitTransfer_Cuda(snapshot); CeedChk(ierr);
+  } else {
+    ierr = CeedRequestRecordStream_Cuda(ceed, ceed_data->snapstream, request);
+    CeedChk(ierr);
   }
   return 0;
 }
@@ -422,6 +974,7 @@ static int CeedVectorReciprocal_Cuda(CeedVector vec) {
   ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
 
   // Set value for synced device/host array
+  ierr = CeedVectorWaitTransfer_Cuda(vec); CeedChk(ierr);
   switch(data->memState) {
   case CEED_CUDA_HOST_SYNC:
     ierr = CeedHostReciprocal_Cuda(data->h_array, length); CeedChk(ierr);
@@ -431,6 +984,7 @@ static int CeedVectorReciprocal_Cuda(CeedVector vec) {
     break;
   case CEED_CUDA_BOTH_SYNC:
     ierr = CeedDeviceReciprocal_Cuda(data->d_array, length); CeedChk(ierr);
+    data->memState = CEED_CUDA_DEVICE_SYNC;
     ierr = CeedVectorSyncArray(vec, CEED_MEM_HOST); CeedChk(ierr);
     break;
   // LCOV_EXCL_START
@@ -441,6 +995,422 @@ static int CeedVectorReciprocal_Cuda(CeedVector vec) {
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Invert point blocks on device (impl in .cu file)
+//------------------------------------------------------------------------------
+int CeedDevicePointBlockInvert_Cuda(CeedScalar *d_array, CeedInt bsize,
+                                   CeedInt length);
+
+//------------------------------------------------------------------------------
+// Invert the point blocks of a vector in place
+//------------------------------------------------------------------------------
+static int CeedVectorPointBlockInvert_Cuda(CeedVector vec, CeedInt bsize) {
+  int ierr;
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  CeedScalar *d_array;
+  ierr = CeedVectorGetArray(vec, CEED_MEM_DEVICE, &d_array); CeedChk(ierr);
+  ierr = CeedDevicePointBlockInvert_Cuda(d_array, bsize, length); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(vec, &d_array); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute y = alpha x + y on device (impl in .cu file)
+//------------------------------------------------------------------------------
+int CeedDeviceAXPY_Cuda(CeedScalar *y_array, CeedScalar alpha,
+                        const CeedScalar *x_array, CeedInt length);
+
+//------------------------------------------------------------------------------
+// Compute y = alpha x + y
+//------------------------------------------------------------------------------
+static int CeedVectorAXPY_Cuda(CeedVector y, CeedScalar alpha, CeedVector x) {
+  int ierr;
+  CeedInt length;
+  ierr = CeedVectorGetLength(y, &length); CeedChk(ierr);
+
+  CeedScalar *y_array;
+  const CeedScalar *x_array;
+  ierr = CeedVectorGetArray(y, CEED_MEM_DEVICE, &y_array); CeedChk(ierr);
+  if (x != y) {
+    ierr = CeedVectorGetArrayRead(x, CEED_MEM_DEVICE, &x_array); CeedChk(ierr);
+  } else {
+    x_array = y_array;
+  }
+  ierr = CeedDeviceAXPY_Cuda(y_array, alpha, x_array, length); CeedChk(ierr);
+  if (x != y) {
+    ierr = CeedVectorRestoreArrayRead(x, &x_array); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArray(y, &y_array); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute y = alpha x + beta y on device (impl in .cu file)
+//------------------------------------------------------------------------------
+int CeedDeviceAXPBY_Cuda(CeedScalar *y_array, CeedScalar alpha,
+                         CeedScalar beta, const CeedScalar *x_array,
+                         CeedInt length);
+
+//------------------------------------------------------------------------------
+// Compute y = alpha x + beta y
+//------------------------------------------------------------------------------
+static int CeedVectorAXPBY_Cuda(CeedVector y, CeedScalar alpha,
+                                CeedScalar beta, CeedVector x) {
+  int ierr;
+  CeedInt length;
+  ierr = CeedVectorGetLength(y, &length); CeedChk(ierr);
+
+  CeedScalar *y_array;
+  const CeedScalar *x_array;
+  ierr = CeedVectorGetArray(y, CEED_MEM_DEVICE, &y_array); CeedChk(ierr);
+  if (x != y) {
+    ierr = CeedVectorGetArrayRead(x, CEED_MEM_DEVICE, &x_array); CeedChk(ierr);
+  } else {
+    x_array = y_array;
+  }
+  ierr = CeedDeviceAXPBY_Cuda(y_array, alpha, beta, x_array, length);
+  CeedChk(ierr);
+  if (x != y) {
+    ierr = CeedVectorRestoreArrayRead(x, &x_array); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArray(y, &y_array); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute the pointwise product w = x .* y on device (impl in .cu file)
+//------------------------------------------------------------------------------
+int CeedDevicePointwiseMult_Cuda(CeedScalar *w_array, const CeedScalar *x_array,
+                                 const CeedScalar *y_array, CeedInt length);
+
+//------------------------------------------------------------------------------
+// Compute the pointwise product w = x .* y
+//------------------------------------------------------------------------------
+static int CeedVectorPointwiseMult_Cuda(CeedVector w, CeedVector x,
+                                        CeedVector y) {
+  int ierr;
+  CeedInt length;
+  ierr = CeedVectorGetLength(w, &length); CeedChk(ierr);
+
+  CeedScalar *w_array;
+  const CeedScalar *x_array, *y_array;
+  ierr = CeedVectorGetArray(w, CEED_MEM_DEVICE, &w_array); CeedChk(ierr);
+  if (x != w) {
+    ierr = CeedVectorGetArrayRead(x, CEED_MEM_DEVICE, &x_array); CeedChk(ierr);
+  } else {
+    x_array = w_array;
+  }
+  if (y != w && y != x) {
+    ierr = CeedVectorGetArrayRead(y, CEED_MEM_DEVICE, &y_array); CeedChk(ierr);
+  } else {
+    y_array = y == w ? w_array : x_array;
+  }
+  ierr = CeedDevicePointwiseMult_Cuda(w_array, x_array, y_array, length);
+  CeedChk(ierr);
+  if (y != w && y != x) {
+    ierr = CeedVectorRestoreArrayRead(y, &y_array); CeedChk(ierr);
+  }
+  if (x != w) {
+    ierr = CeedVectorRestoreArrayRead(x, &x_array); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArray(w, &w_array); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Chebyshev smoother update on device (impl in .cu file)
+//------------------------------------------------------------------------------
+int CeedDeviceChebyshevUpdate_Cuda(CeedScalar *x_array, CeedScalar *d_array,
+    CeedScalar *r_array, const CeedScalar *w_array,
+    const CeedScalar *dinv_array, CeedScalar alpha, CeedScalar beta,
+    CeedInt length);
+
+//------------------------------------------------------------------------------
+// Update the iterates of a Chebyshev smoother
+//------------------------------------------------------------------------------
+static int CeedVectorChebyshevUpdate_Cuda(CeedVector x, CeedVector d,
+    CeedVector r, CeedVector w, CeedVector dinv, CeedScalar alpha,
+    CeedScalar beta) {
+  int ierr;
+  CeedInt length;
+  ierr = CeedVectorGetLength(x, &length); CeedChk(ierr);
+
+  CeedScalar *x_array, *d_array, *r_array;
+  const CeedScalar *w_array = NULL, *dinv_array;
+  ierr = CeedVectorGetArray(x, CEED_MEM_DEVICE, &x_array); CeedChk(ierr);
+  ierr = CeedVectorGetArray(d, CEED_MEM_DEVICE, &d_array); CeedChk(ierr);
+  ierr = CeedVectorGetArray(r, CEED_MEM_DEVICE, &r_array); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(dinv, CEED_MEM_DEVICE, &dinv_array);
+  CeedChk(ierr);
+  if (w != CEED_VECTOR_NONE) {
+    ierr = CeedVectorGetArrayRead(w, CEED_MEM_DEVICE, &w_array); CeedChk(ierr);
+  }
+  ierr = CeedDeviceChebyshevUpdate_Cuda(x_array, d_array, r_array, w_array,
+                                     dinv_array, alpha, beta, length);
+  CeedChk(ierr);
+  if (w != CEED_VECTOR_NONE) {
+    ierr = CeedVectorRestoreArrayRead(w, &w_array); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArrayRead(dinv, &dinv_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(r, &r_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(d, &d_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(x, &x_array); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute the dot product of two vectors
+//------------------------------------------------------------------------------
+static int CeedVectorDot_Cuda(CeedVector x, CeedVector y, CeedScalar *result) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(x, &ceed); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(x, &length); CeedChk(ierr);
+  cublasHandle_t handle;
+  ierr = CeedCudaGetCublasHandle(ceed, &handle); CeedChk(ierr);
+
+  const CeedScalar *x_array, *y_array;
+  ierr = CeedVectorGetArrayRead(x, CEED_MEM_DEVICE, &x_array); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(y, CEED_MEM_DEVICE, &y_array); CeedChk(ierr);
+  ierr = cublasDdot(handle, length, x_array, 1, y_array, 1, result);
+  CeedChk_Cublas(ceed, ierr);
+  ierr = CeedVectorRestoreArrayRead(y, &y_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(x, &x_array); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Reduce vectors on device (impl in .cu file)
+//------------------------------------------------------------------------------
+CeedInt CeedDeviceReduceWorkSize_Cuda(CeedInt length);
+int CeedDeviceReduce_Cuda(const CeedScalar *x_array, const CeedScalar *y_array,
+                          CeedInt length, CeedScalar *d_work);
+
+//------------------------------------------------------------------------------
+// Reduce x and y on device, copying the requested statistics into out;
+//   nothing waits for the result on the host
+//------------------------------------------------------------------------------
+static int CeedVectorReduce_Cuda(CeedVector x, CeedVector y, CeedInt nout,
+                                 const CeedInt *stats, CeedVector out) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(x, &ceed); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(x, &length); CeedChk(ierr);
+
+  const CeedInt worksize = CeedDeviceReduceWorkSize_Cuda(length);
+  CeedScalar *d_work;
+  ierr = CeedCudaMalloc(ceed, (void **)&d_work, worksize*sizeof(CeedScalar));
+  CeedChk(ierr);
+
+  const CeedScalar *x_array, *y_array;
+  CeedScalar *out_array;
+  ierr = CeedVectorGetArrayRead(x, CEED_MEM_DEVICE, &x_array); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(y, CEED_MEM_DEVICE, &y_array); CeedChk(ierr);
+  ierr = CeedDeviceReduce_Cuda(x_array, y_array, length, d_work); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(y, &y_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(x, &x_array); CeedChk(ierr);
+
+  // The statistics follow the block partials in the workspace
+  const CeedScalar *d_stats = d_work + worksize - 4;
+  ierr = CeedVectorGetArray(out, CEED_MEM_DEVICE, &out_array); CeedChk(ierr);
+  for (CeedInt i = 0; i < nout; i++) {
+    ierr = cudaMemcpyAsync(&out_array[i], &d_stats[stats[i]],
+                           sizeof(CeedScalar), cudaMemcpyDeviceToDevice, 0);
+    CeedChk_Cu(ceed, ierr);
+  }
+  ierr = CeedVectorRestoreArray(out, &out_array); CeedChk(ierr);
+
+  // Later work on the stream is ordered after the copies, so the workspace
+  //   may be reused right away
+  ierr = CeedCudaFree(ceed, d_work); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute several norms of a vector in a single pass, storing them on device
+//------------------------------------------------------------------------------
+static int CeedVectorNorms_Cuda(CeedVector vec, CeedInt nnorms,
+                                const CeedNormType *types, CeedVector norms) {
+  int ierr;
+  CeedInt *stats;
+  ierr = CeedMalloc(nnorms, &stats); CeedChk(ierr);
+  for (CeedInt i = 0; i < nnorms; i++)
+    switch (types[i]) {
+    case CEED_NORM_1:
+      stats[i] = 0;
+      break;
+    case CEED_NORM_2:
+      stats[i] = 3;
+      break;
+    case CEED_NORM_MAX:
+      stats[i] = 2;
+      break;
+    }
+  ierr = CeedVectorReduce_Cuda(vec, vec, nnorms, stats, norms); CeedChk(ierr);
+  ierr = CeedFree(&stats); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute the dot product of two vectors, storing it on device
+//------------------------------------------------------------------------------
+static int CeedVectorDotVector_Cuda(CeedVector x, CeedVector y,
+                                    CeedVector dot) {
+  const CeedInt stats[1] = {1};
+  return CeedVectorReduce_Cuda(x, y, 1, stats, dot);
+}
+
+//------------------------------------------------------------------------------
+// Fused updates and dot products on device (impl in .cu file)
+//------------------------------------------------------------------------------
+CeedInt CeedDeviceMultiBlocks_Cuda(CeedInt length);
+int CeedDeviceMultiAXPBYDot_Cuda(CeedScalar **arrays,
+    const CeedVectorMulti *multi, CeedInt length, CeedScalar *d_work,
+    CeedScalar *dots_array);
+
+//------------------------------------------------------------------------------
+// Apply several updates and dot products in one pass, storing the dot
+//   products on device
+//------------------------------------------------------------------------------
+static int CeedVectorMultiAXPBYDot_Cuda(CeedVector *vecs,
+    const CeedVectorMulti *multi, CeedVector dots) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vecs[0], &ceed); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vecs[0], &length); CeedChk(ierr);
+
+  const CeedInt worksize = (multi->ndot ? multi->ndot : 1) *
+                           CeedDeviceMultiBlocks_Cuda(length);
+  CeedScalar *d_work, *dots_array = NULL;
+  ierr = CeedCudaMalloc(ceed, (void **)&d_work, worksize*sizeof(CeedScalar));
+  CeedChk(ierr);
+  CeedScalar *arrays[CEED_VECTOR_MULTI_MAX];
+  for (CeedInt j = 0; j < multi->nvecs; j++) {
+    if (multi->write[j]) {
+      ierr = CeedVectorGetArray(vecs[j], CEED_MEM_DEVICE, &arrays[j]);
+      CeedChk(ierr);
+    } else {
+      ierr = CeedVectorGetArrayRead(vecs[j], CEED_MEM_DEVICE,
+                                    (const CeedScalar **)&arrays[j]);
+      CeedChk(ierr);
+    }
+  }
+  if (multi->ndot) {
+    ierr = CeedVectorGetArray(dots, CEED_MEM_DEVICE, &dots_array);
+    CeedChk(ierr);
+  }
+  ierr = CeedDeviceMultiAXPBYDot_Cuda(arrays, multi, length, d_work,
+                                      dots_array); CeedChk(ierr);
+  if (multi->ndot) {
+    ierr = CeedVectorRestoreArray(dots, &dots_array); CeedChk(ierr);
+  }
+  for (CeedInt j = 0; j < multi->nvecs; j++) {
+    if (multi->write[j]) {
+      ierr = CeedVectorRestoreArray(vecs[j], &arrays[j]); CeedChk(ierr);
+    } else {
+      ierr = CeedVectorRestoreArrayRead(vecs[j],
+                                        (const CeedScalar **)&arrays[j]);
+      CeedChk(ierr);
+    }
+  }
+
+  // Later work on the stream is ordered after the kernels, so the workspace
+  //   may be freed right away
+  ierr = CeedCudaFree(ceed, d_work); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Reduce segments of a vector on device (impl in .cu file)
+//------------------------------------------------------------------------------
+CeedInt CeedDeviceSegmentBlocks_Cuda(CeedInt seglen);
+int CeedDeviceReduceSegments_Cuda(const CeedScalar *x_array, CeedInt nseg,
+                                  CeedInt seglen, CeedReduceType rtype,
+                                  bool add, CeedScalar *d_work,
+                                  CeedScalar *result_array);
+
+//------------------------------------------------------------------------------
+// Reduce contiguous segments of a vector, storing the results on device
+//------------------------------------------------------------------------------
+static int CeedVectorReduceSegments_Cuda(CeedVector vec, CeedReduceType rtype,
+                                         bool add, CeedVector result) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedInt length, nseg;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+  ierr = CeedVectorGetLength(result, &nseg); CeedChk(ierr);
+  const CeedInt seglen = length / nseg;
+
+  const CeedInt worksize = nseg*CeedDeviceSegmentBlocks_Cuda(seglen);
+  CeedScalar *d_work;
+  ierr = CeedCudaMalloc(ceed, (void **)&d_work, worksize*sizeof(CeedScalar));
+  CeedChk(ierr);
+  const CeedScalar *x_array;
+  CeedScalar *result_array;
+  ierr = CeedVectorGetArrayRead(vec, CEED_MEM_DEVICE, &x_array); CeedChk(ierr);
+  ierr = CeedVectorGetArray(result, CEED_MEM_DEVICE, &result_array);
+  CeedChk(ierr);
+  ierr = CeedDeviceReduceSegments_Cuda(x_array, nseg, seglen, rtype, add,
+                                      d_work, result_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(result, &result_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(vec, &x_array); CeedChk(ierr);
+
+  // Later work on the stream is ordered after the reduction
+  ierr = CeedCudaFree(ceed, d_work); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Move the data to the host and return the device array to the pool, for
+//   passive inputs that streamed operators copy to the device by chunks
+//------------------------------------------------------------------------------
+int CeedVectorEvictDevice_Cuda(CeedVector vec, const CeedScalar **h_array) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Cuda *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  ierr = CeedVectorGetArrayRead_Cuda(vec, CEED_MEM_HOST, h_array);
+  CeedChk(ierr);
+  // Device arrays owned by the user stay in place
+  if (!data->unified && data->d_array_allocated) {
+    ierr = CeedCudaFree(ceed, data->d_array_allocated); CeedChk(ierr);
+    data->d_array_allocated = NULL;
+    data->d_array = NULL;
+    data->memState = CEED_CUDA_HOST_SYNC;
+  }
+  ierr = CeedVectorUpdateMemory_Cuda(vec); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Return the device array to the pool, discarding its values; used for the
+//   work vectors of streamed chunks, which are not read again
+//------------------------------------------------------------------------------
+int CeedVectorReleaseDevice_Cuda(CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Cuda *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  if (data->unified || !data->d_array_allocated)
+    return 0;
+  ierr = CeedCudaFree(ceed, data->d_array_allocated); CeedChk(ierr);
+  data->d_array_allocated = NULL;
+  data->d_array = NULL;
+  data->memState = CEED_CUDA_NONE_SYNC;
+  ierr = CeedVectorUpdateMemory_Cuda(vec); CeedChk(ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Destroy the vector
 //------------------------------------------------------------------------------
@@ -451,8 +1421,13 @@ static int CeedVectorDestroy_Cuda(const CeedVector vec) {
   CeedVector_Cuda *data;
   ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
 
-  ierr = cudaFree(data->d_array_allocated); CeedChk_Cu(ceed, ierr);
-  ierr = CeedFree(&data->h_array_allocated); CeedChk(ierr);
+  ierr = CeedVectorUnsetUnified_Cuda(vec); CeedChk(ierr);
+  ierr = CeedVectorHostUnregister_Cuda(vec); CeedChk(ierr);
+  ierr = CeedVectorHostFree_Cuda(vec); CeedChk(ierr);
+  if (data->transfer) {
+    ierr = cudaEventDestroy(data->transfer); CeedChk_Cu(ceed, ierr);
+  }
+  ierr = CeedCudaFree(ceed, data->d_array_allocated); CeedChk(ierr);
   ierr = CeedFree(&data); CeedChk(ierr);
   return 0;
 }
@@ -472,6 +1447,12 @@ int CeedVectorCreate_Cuda(CeedInt n, CeedVector vec) {
                                 CeedVectorTakeArray_Cuda); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "SetValue",
                                 CeedVectorSetValue_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Copy",
+                                CeedVectorCopy_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "SyncArray",
+                                CeedVectorSyncArray_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Snapshot",
+                                CeedVectorSnapshot_Cuda); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "GetArray",
                                 CeedVectorGetArray_Cuda); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "GetArrayRead",
@@ -484,6 +1465,26 @@ int CeedVectorCreate_Cuda(CeedInt n, CeedVector vec) {
                                 CeedVectorNorm_Cuda); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Reciprocal",
                                 CeedVectorReciprocal_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "PointBlockInvert",
+                                CeedVectorPointBlockInvert_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "AXPY",
+                                CeedVectorAXPY_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "AXPBY",
+                                CeedVectorAXPBY_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "PointwiseMult",
+                                CeedVectorPointwiseMult_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Dot",
+                                CeedVectorDot_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Norms",
+                                CeedVectorNorms_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "ReduceSegments",
+                                CeedVectorReduceSegments_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "DotVector",
+                                CeedVectorDotVector_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "MultiAXPBYDot",
+                                CeedVectorMultiAXPBYDot_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "ChebyshevUpdate",
+                                CeedVectorChebyshevUpdate_Cuda); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Destroy",
                                 CeedVectorDestroy_Cuda); CeedChk(ierr);
 
@@ -14,72 +14,343 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+#include <nvtx3/nvToolsExt.h>
+#ifdef CEED_CUDA_NVML
+#include <nvml.h>
+#endif
 #include "ceed-cuda.h"
 
 //------------------------------------------------------------------------------
-// Compile CUDA kernel
+// JIT cache key, FNV-1a hash of kernel source and compile options
 //------------------------------------------------------------------------------
-int CeedCompileCuda(Ceed ceed, const char *source, CUmodule *module,
-                    const CeedInt numopts, ...) {
+static uint64_t CeedJitHash_Cuda(uint64_t hash, const char *str) {
+  for (const unsigned char *c = (const unsigned char *)str; *c; c++) {
+    hash ^= *c;
+    hash *= 1099511628211ULL;
+  }
+  // Separate consecutive strings
+  hash ^= 0xff;
+  hash *= 1099511628211ULL;
+  return hash;
+}
+
+//------------------------------------------------------------------------------
+// JIT cache file path, if CEED_JIT_CACHE_DIR is set
+//------------------------------------------------------------------------------
+static int CeedJitCachePath_Cuda(const char *source, const char **opts,
+                                 const int numopts, const char *ext,
+                                 char **path) {
+  int ierr;
+  *path = NULL;
+  const char *dir = getenv("CEED_JIT_CACHE_DIR");
+  if (!dir || !dir[0])
+    return 0;
+
+  int major = 0, minor = 0;
+  nvrtcVersion(&major, &minor);
+  char version[32];
+  snprintf(version, sizeof version, "nvrtc-%d.%d", major, minor);
+
+  uint64_t hash = 14695981039346656037ULL;
+  hash = CeedJitHash_Cuda(hash, version);
+  for (int i = 0; i < numopts; i++)
+    hash = CeedJitHash_Cuda(hash, opts[i]);
+  hash = CeedJitHash_Cuda(hash, source);
+
+  size_t pathlen = strlen(dir) + 64;
+  ierr = CeedMalloc(pathlen, path); CeedChk(ierr);
+  snprintf(*path, pathlen, "%s/ceed-cuda-%016llx-%zu.%s", dir,
+           (unsigned long long)hash, strlen(source), ext);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Read cached PTX or cubin, if present
+//------------------------------------------------------------------------------
+static int CeedJitCacheRead_Cuda(const char *path, char **ptx) {
+  int ierr;
+  *ptx = NULL;
+  FILE *file = fopen(path, "rb");
+  if (!file)
+    return 0;
+  long size = -1;
+  if (!fseek(file, 0, SEEK_END))
+    size = ftell(file);
+  if (size > 0 && !fseek(file, 0, SEEK_SET)) {
+    ierr = CeedMalloc(size + 1, ptx); CeedChk(ierr);
+    if (fread(*ptx, 1, size, file) == (size_t)size) {
+      (*ptx)[size] = '\0';
+    } else {
+      ierr = CeedFree(ptx); CeedChk(ierr);
+    }
+  }
+  fclose(file);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Write PTX or cubin to cache, renaming into place so concurrent ranks never see a
+//   partial file
+//------------------------------------------------------------------------------
+static int CeedJitCacheWrite_Cuda(const char *path, const char *ptx,
+                                  size_t ptxsize) {
+  int ierr;
+  size_t tmplen = strlen(path) + 32;
+  char *tmp;
+  ierr = CeedMalloc(tmplen, &tmp); CeedChk(ierr);
+  snprintf(tmp, tmplen, "%s.%ld.tmp", path, (long)getpid());
+  FILE *file = fopen(tmp, "wb");
+  if (file) {
+    bool ok = fwrite(ptx, 1, ptxsize, file) == ptxsize;
+    ok = !fclose(file) && ok;
+    if (!ok || rename(tmp, path))
+      remove(tmp);
+  }
+  ierr = CeedFree(&tmp); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Split options at whitespace in place, storing the start of each option in
+//   opts, if not NULL, and returning the number of options
+//------------------------------------------------------------------------------
+static int CeedCudaSplitOptions(char *buf, char **opts) {
+  int num = 0;
+  for (char *c = buf; *c; ) {
+    while (isspace((unsigned char)*c)) {
+      if (opts) *c = '\0';
+      c++;
+    }
+    if (!*c) break;
+    if (opts) opts[num] = c;
+    num++;
+    while (*c && !isspace((unsigned char)*c)) c++;
+  }
+  return num;
+}
+
+//------------------------------------------------------------------------------
+// Set up runtime compilation of a CUDA kernel, copying the source and options
+//   so the compilation can run on another thread
+//------------------------------------------------------------------------------
+static int CeedCudaJitCreate(Ceed ceed, const char *source,
+                             const CeedInt numopts, va_list args,
+                             CeedCudaJit **jit) {
   int ierr;
   cudaFree(0); // Make sure a Context exists for nvrtc
-  nvrtcProgram prog;
-  CeedChk_Nvrtc(ceed, nvrtcCreateProgram(&prog, source, NULL, 0, NULL, NULL));
+  Ceed_Cuda *ceed_data;
+  ierr = CeedGetData(ceed, &ceed_data); CeedChk(ierr);
+  CeedCudaJit *impl;
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+
+  // Options set by the user with CeedSetJitOptions()
+  const char *jitoptions;
+  ierr = CeedGetJitOptions(ceed, &jitoptions); CeedChk(ierr);
+  int numuseropts = 0;
+  if (jitoptions) {
+    const size_t len = strlen(jitoptions) + 1;
+    ierr = CeedMalloc(len, &impl->useroptsbuf); CeedChk(ierr);
+    memcpy(impl->useroptsbuf, jitoptions, len);
+    numuseropts = CeedCudaSplitOptions(impl->useroptsbuf, NULL);
+  }
 
   // Get kernel specific options, such as kernel constants
   const int optslen = 32;
   const int optsextra = 4;
-  const char *opts[numopts + optsextra];
-  char buf[numopts][optslen];
-  if (numopts > 0) {
-    va_list args;
-    va_start(args, numopts);
-    char *name;
-    int val;
-    for (int i = 0; i < numopts; i++) {
-      name = va_arg(args, char *);
-      val = va_arg(args, int);
-      snprintf(&buf[i][0], optslen,"-D%s=%d", name, val);
-      opts[i] = &buf[i][0];
-    }
-    va_end(args);
+  impl->numopts = numopts + optsextra + numuseropts;
+  ierr = CeedCalloc((numopts + optsextra)*optslen, &impl->optsbuf);
+  CeedChk(ierr);
+  ierr = CeedCalloc(impl->numopts, &impl->opts); CeedChk(ierr);
+  for (int i = 0; i < numopts + optsextra; i++)
+    impl->opts[i] = &impl->optsbuf[i*optslen];
+  if (numuseropts)
+    CeedCudaSplitOptions(impl->useroptsbuf, &impl->opts[numopts + optsextra]);
+  for (int i = 0; i < numopts; i++) {
+    const char *name = va_arg(args, char *);
+    const int val = va_arg(args, int);
+    snprintf(impl->opts[i], optslen, "-D%s=%d", name, val);
   }
 
   // Standard backend options
-  opts[numopts]     = "-DCeedScalar=double";
-  opts[numopts + 1] = "-DCeedInt=int";
-  opts[numopts + 2] = "-default-device";
-  struct cudaDeviceProp prop;
-  Ceed_Cuda *ceed_data;
-  ierr = CeedGetData(ceed, &ceed_data); CeedChk(ierr);
-  ierr = cudaGetDeviceProperties(&prop, ceed_data->deviceId);
-  CeedChk_Cu(ceed, ierr);
-  char buff[optslen];
-  snprintf(buff, optslen,"-arch=compute_%d%d", prop.major, prop.minor);
-  opts[numopts + 3] = buff;
+  snprintf(impl->opts[numopts], optslen, "%s",
+           sizeof(CeedScalar) == sizeof(float) ?
+           "-DCeedScalar=float" : "-DCeedScalar=double");
+  snprintf(impl->opts[numopts + 1], optslen, "-DCeedInt=int");
+  snprintf(impl->opts[numopts + 2], optslen, "-default-device");
+  snprintf(impl->opts[numopts + 3], optslen, "-arch=%s_%d",
+           ceed_data->cubin ? "sm" : "compute", ceed_data->arch);
+  impl->cubin = ceed_data->cubin;
+
+  const size_t sourcelen = strlen(source) + 1;
+  ierr = CeedMalloc(sourcelen, &impl->source); CeedChk(ierr);
+  memcpy(impl->source, source, sourcelen);
+  ierr = CeedJitCachePath_Cuda(impl->source, (const char **)impl->opts,
+                               impl->numopts, impl->cubin ? "cubin" : "ptx",
+                               &impl->path); CeedChk(ierr);
+  *jit = impl;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Destroy runtime compilation data
+//------------------------------------------------------------------------------
+static int CeedCudaJitDestroy(CeedCudaJit **jit) {
+  int ierr;
+  ierr = CeedFree(&(*jit)->source); CeedChk(ierr);
+  ierr = CeedFree(&(*jit)->opts); CeedChk(ierr);
+  ierr = CeedFree(&(*jit)->optsbuf); CeedChk(ierr);
+  ierr = CeedFree(&(*jit)->useroptsbuf); CeedChk(ierr);
+  ierr = CeedFree(&(*jit)->path); CeedChk(ierr);
+  ierr = CeedFree(&(*jit)->image); CeedChk(ierr);
+  ierr = CeedFree(&(*jit)->log); CeedChk(ierr);
+  ierr = CeedFree(jit); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compile a CUDA kernel, or read it from the JIT cache
+//   Only NVRTC and host memory are used, so this can run on another thread
+//   while the host continues; errors are reported by CeedCompileCudaWait
+//------------------------------------------------------------------------------
+static void *CeedCudaJitCompile(void *ptr) {
+  CeedCudaJit *jit = ptr;
+
+  // Check JIT cache
+  if (jit->path) {
+    CeedJitCacheRead_Cuda(jit->path, &jit->image);
+    jit->cachehit = jit->image;
+    if (jit->cachehit)
+      return NULL;
+  }
 
   // Compile kernel
-  nvrtcResult result = nvrtcCompileProgram(prog, numopts + optsextra, opts);
-  if (result != NVRTC_SUCCESS) {
+  nvrtcProgram prog;
+  jit->result = nvrtcCreateProgram(&prog, jit->source, NULL, 0, NULL, NULL);
+  if (jit->result != NVRTC_SUCCESS)
+    return NULL;
+  jit->result = nvrtcCompileProgram(prog, jit->numopts,
+                                    (const char *const *)jit->opts);
+  if (jit->result == NVRTC_SUCCESS) {
+    // Device code is SASS for the device arch if supported, otherwise PTX
+    //   that the driver compiles on load
+#if CUDA_VERSION >= 11020
+    if (jit->cubin) {
+      jit->result = nvrtcGetCUBINSize(prog, &jit->imagesize);
+      if (jit->result == NVRTC_SUCCESS &&
+          !CeedMalloc(jit->imagesize, &jit->image))
+        jit->result = nvrtcGetCUBIN(prog, jit->image);
+    } else
+#endif
+    {
+      jit->result = nvrtcGetPTXSize(prog, &jit->imagesize);
+      if (jit->result == NVRTC_SUCCESS &&
+          !CeedMalloc(jit->imagesize, &jit->image))
+        jit->result = nvrtcGetPTX(prog, jit->image);
+    }
+  } else {
     size_t logsize;
-    CeedChk_Nvrtc(ceed, nvrtcGetProgramLogSize(prog, &logsize));
-    char *log;
-    ierr = CeedMalloc(logsize, &log); CeedChk(ierr);
-    CeedChk_Nvrtc(ceed, nvrtcGetProgramLog(prog, log));
-    return CeedError(ceed, (int)result, "%s\n%s", nvrtcGetErrorString(result), log);
+    if (nvrtcGetProgramLogSize(prog, &logsize) == NVRTC_SUCCESS &&
+        !CeedCalloc(logsize + 1, &jit->log))
+      nvrtcGetProgramLog(prog, jit->log);
+  }
+  nvrtcDestroyProgram(&prog);
+
+  // Store in JIT cache, failure to write only costs a recompile later
+  if (jit->path && jit->result == NVRTC_SUCCESS && jit->image)
+    CeedJitCacheWrite_Cuda(jit->path, jit->image, jit->imagesize);
+  return NULL;
+}
+
+//------------------------------------------------------------------------------
+// Start compiling a CUDA kernel on another thread
+//------------------------------------------------------------------------------
+int CeedCompileCudaAsync(Ceed ceed, const char *source, CeedCudaJit **jit,
+                         const CeedInt numopts, ...) {
+  int ierr;
+  va_list args;
+  va_start(args, numopts);
+  ierr = CeedCudaJitCreate(ceed, source, numopts, args, jit);
+  va_end(args);
+  CeedChk(ierr);
+
+  // Compile right away if no thread can be started
+  (*jit)->async = !pthread_create(&(*jit)->thread, NULL, CeedCudaJitCompile,
+                                  *jit);
+  if (!(*jit)->async)
+    CeedCudaJitCompile(*jit);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Wait for compilation of a CUDA kernel and load the module, or only release
+//   the compiled code if module is NULL
+//------------------------------------------------------------------------------
+int CeedCompileCudaWait(Ceed ceed, CeedCudaJit **jit, CUmodule *module) {
+  int ierr;
+  CeedCudaJit *impl = *jit;
+  if (!impl)
+    return 0;
+  if (impl->async) {
+    // Only the time waiting for the compilation thread is profiled
+    double start;
+    ierr = CeedProfileStart(ceed, CEED_PROFILE_COMPILE, &start); CeedChk(ierr);
+    ierr = pthread_join(impl->thread, NULL);
+    if (ierr)
+      // LCOV_EXCL_START
+      return CeedError(ceed, ierr, "Failed to join kernel compilation thread");
+    // LCOV_EXCL_STOP
+    impl->async = false;
+    ierr = CeedProfileStop(ceed, CEED_PROFILE_COMPILE, start, 0); CeedChk(ierr);
   }
 
-  size_t ptxsize;
-  CeedChk_Nvrtc(ceed, nvrtcGetPTXSize(prog, &ptxsize));
-  char *ptx;
-  ierr = CeedMalloc(ptxsize, &ptx); CeedChk(ierr);
-  CeedChk_Nvrtc(ceed, nvrtcGetPTX(prog, ptx));
-  CeedChk_Nvrtc(ceed, nvrtcDestroyProgram(&prog));
+  Ceed_Cuda *ceed_data;
+  ierr = CeedGetData(ceed, &ceed_data); CeedChk(ierr);
+  if (impl->path) {
+    if (impl->cachehit) {
+      ceed_data->jithits++;
+      CeedDebug("JIT cache hit: %s", impl->path);
+    } else {
+      ceed_data->jitmisses++;
+      CeedDebug("JIT cache miss: %s", impl->path);
+    }
+  }
+  if (impl->result != NVRTC_SUCCESS)
+    // LCOV_EXCL_START
+    return CeedError(ceed, (int)impl->result, "%s\n%s",
+                     nvrtcGetErrorString(impl->result),
+                     impl->log ? impl->log : "");
+  // LCOV_EXCL_STOP
 
-  CeedChk_Cu(ceed, cuModuleLoadData(module, ptx));
-  ierr = CeedFree(&ptx); CeedChk(ierr);
+  if (module)
+    CeedChk_Cu(ceed, cuModuleLoadData(module, impl->image));
+  ierr = CeedCudaJitDestroy(jit); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compile CUDA kernel
+//------------------------------------------------------------------------------
+int CeedCompileCuda(Ceed ceed, const char *source, CUmodule *module,
+                    const CeedInt numopts, ...) {
+  int ierr;
+  CeedCudaJit *jit;
+  double start;
+  ierr = CeedProfileStart(ceed, CEED_PROFILE_COMPILE, &start); CeedChk(ierr);
+  va_list args;
+  va_start(args, numopts);
+  ierr = CeedCudaJitCreate(ceed, source, numopts, args, &jit);
+  va_end(args);
+  CeedChk(ierr);
+  CeedCudaJitCompile(jit);
+  ierr = CeedCompileCudaWait(ceed, &jit, module); CeedChk(ierr);
+  ierr = CeedProfileStop(ceed, CEED_PROFILE_COMPILE, start, 0); CeedChk(ierr);
   return 0;
 }
 
@@ -88,7 +359,57 @@ int CeedCompileCuda(Ceed ceed, const char *source, CUmodule *module,
 //------------------------------------------------------------------------------
 int CeedGetKernelCuda(Ceed ceed, CUmodule module, const char *name,
                       CUfunction *kernel) {
+  int ierr;
   CeedChk_Cu(ceed, cuModuleGetFunction(kernel, module, name));
+
+  // Record the resources of the kernel, reported by CeedView()
+  CeedKernelInfo info;
+  ierr = CeedGetKernelInfoCuda(ceed, *kernel, name, 0, 0, &info);
+  CeedChk(ierr);
+  ierr = CeedAddKernelInfo(ceed, &info); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Get the resource usage of a CUDA kernel; the theoretical occupancy is for
+//   blockSize threads, or for the block size maximizing it when 0
+//------------------------------------------------------------------------------
+int CeedGetKernelInfoCuda(Ceed ceed, CUfunction kernel, const char *name,
+                          int blockSize, size_t dynamicSharedMem,
+                          CeedKernelInfo *info) {
+  int regs, local, shared, maxThreads;
+  CeedChk_Cu(ceed, cuFuncGetAttribute(&regs, CU_FUNC_ATTRIBUTE_NUM_REGS,
+                                      kernel));
+  CeedChk_Cu(ceed, cuFuncGetAttribute(&local,
+                                      CU_FUNC_ATTRIBUTE_LOCAL_SIZE_BYTES,
+                                      kernel));
+  CeedChk_Cu(ceed, cuFuncGetAttribute(&shared,
+                                      CU_FUNC_ATTRIBUTE_SHARED_SIZE_BYTES,
+                                      kernel));
+  CeedChk_Cu(ceed, cuFuncGetAttribute(&maxThreads,
+                                      CU_FUNC_ATTRIBUTE_MAX_THREADS_PER_BLOCK,
+                                      kernel));
+  if (!blockSize) {
+    int minGridSize;
+    CeedChk_Cu(ceed, cuOccupancyMaxPotentialBlockSize(&minGridSize,
+               &blockSize, kernel, NULL, dynamicSharedMem, 0));
+  }
+  int numBlocks, maxThreadsSM;
+  CUdevice device;
+  CeedChk_Cu(ceed, cuOccupancyMaxActiveBlocksPerMultiprocessor(&numBlocks,
+             kernel, blockSize, dynamicSharedMem));
+  CeedChk_Cu(ceed, cuCtxGetDevice(&device));
+  CeedChk_Cu(ceed, cuDeviceGetAttribute(&maxThreadsSM,
+             CU_DEVICE_ATTRIBUTE_MAX_THREADS_PER_MULTIPROCESSOR, device));
+
+  memset(info, 0, sizeof(*info));
+  snprintf(info->name, sizeof(info->name), "%s", name);
+  info->registers = regs;
+  info->localbytes = local;
+  info->sharedbytes = shared + dynamicSharedMem;
+  info->maxthreads = maxThreads;
+  info->blocksize = blockSize;
+  info->occupancy = (double)numBlocks*blockSize/maxThreadsSM;
   return 0;
 }
 
@@ -98,7 +419,7 @@ int CeedGetKernelCuda(Ceed ceed, CUmodule module, const char *name,
 int CeedRunKernelCuda(Ceed ceed, CUfunction kernel, const int gridSize,
                       const int blockSize, void **args) {
   CeedChk_Cu(ceed, cuLaunchKernel(kernel, gridSize, 1, 1, blockSize, 1,
-                                  1, 0, NULL, args, NULL));
+                                  1, 0, CeedCudaGetStream(), args, NULL));
   return 0;
 }
 
@@ -110,7 +431,7 @@ int CeedRunKernelDimCuda(Ceed ceed, CUfunction kernel, const int gridSize,
                          const int blockSizeZ, void **args) {
   CeedChk_Cu(ceed, cuLaunchKernel(kernel, gridSize, 1, 1,
                                   blockSizeX, blockSizeY, blockSizeZ,
-                                  0, NULL, args, NULL));
+                                  0, CeedCudaGetStream(), args, NULL));
   return 0;
 }
 
@@ -123,7 +444,25 @@ int CeedRunKernelDimSharedCuda(Ceed ceed, CUfunction kernel, const int gridSize,
                                void **args) {
   CeedChk_Cu(ceed, cuLaunchKernel(kernel, gridSize, 1, 1,
                                   blockSizeX, blockSizeY, blockSizeZ,
-                                  sharedMemSize, NULL, args, NULL));
+                                  sharedMemSize, CeedCudaGetStream(),
+                                  args, NULL));
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Copy a kernel field pointer table to device memory, for tables too large to
+//   pass by value. The copy is ordered before the kernel on the launch stream;
+//   pageable host memory is staged before the call returns, so the table can
+//   be refilled for the next launch right away.
+//------------------------------------------------------------------------------
+int CeedCudaCopyFieldsToDevice(Ceed ceed, const void *table, size_t bytes,
+                               void **d_table) {
+  int ierr;
+  if (!*d_table) {
+    ierr = CeedCudaMalloc(ceed, d_table, bytes); CeedChk(ierr);
+  }
+  ierr = cudaMemcpyAsync(*d_table, table, bytes, cudaMemcpyHostToDevice,
+                         CeedCudaGetStream()); CeedChk_Cu(ceed, ierr);
   return 0;
 }
 
@@ -135,6 +474,28 @@ static int CeedGetPreferredMemType_Cuda(CeedMemType *type) {
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Resource of a delegate Ceed on the same device
+//------------------------------------------------------------------------------
+int CeedCudaDelegateResource(const char *resource, const char *prefix,
+                             char *delegate) {
+  const char *device = strstr(resource, ":device_id=");
+  snprintf(delegate, CEED_MAX_RESOURCE_LEN, "%s%s", prefix,
+           device ? device : "");
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Make the device of the Ceed current
+//------------------------------------------------------------------------------
+static int CeedSetCurrentDevice_Cuda(Ceed ceed) {
+  int ierr;
+  Ceed_Cuda *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  ierr = cudaSetDevice(data->deviceId); CeedChk_Cu(ceed, ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Device information backend init
 //------------------------------------------------------------------------------
@@ -142,7 +503,9 @@ int CeedCudaInit(Ceed ceed, const char *resource, int nrc) {
   int ierr;
   const int rlen = strlen(resource);
   const bool slash = (rlen>nrc) ? (resource[nrc] == '/') : false;
-  const int deviceID = (slash && rlen > nrc + 1) ? atoi(&resource[nrc + 1]) : 0;
+  const char *device = strstr(resource, ":device_id=");
+  const int deviceID = device ? atoi(&device[11]) :
+                       (slash && rlen > nrc + 1) ? atoi(&resource[nrc + 1]) : 0;
 
   int currentDeviceID;
   ierr = cudaGetDevice(&currentDeviceID); CeedChk_Cu(ceed,ierr);
@@ -150,28 +513,507 @@ int CeedCudaInit(Ceed ceed, const char *resource, int nrc) {
     ierr = cudaSetDevice(deviceID); CeedChk_Cu(ceed,ierr);
   }
 
-  struct cudaDeviceProp deviceProp;
-  ierr = cudaGetDeviceProperties(&deviceProp, deviceID); CeedChk_Cu(ceed,ierr);
-
+  // Individual attributes are much cheaper to query than the full device
+  //   properties, and the device context is only created on first use
+  int major, minor;
   Ceed_Cuda *data;
   ierr = CeedGetData(ceed, &data); CeedChk(ierr);
   data->deviceId = deviceID;
-  data->optblocksize = deviceProp.maxThreadsPerBlock;
+  ierr = cudaDeviceGetAttribute(&data->optblocksize,
+                                cudaDevAttrMaxThreadsPerBlock, deviceID);
+  CeedChk_Cu(ceed,ierr);
+  ierr = cudaDeviceGetAttribute(&major, cudaDevAttrComputeCapabilityMajor,
+                                deviceID); CeedChk_Cu(ceed,ierr);
+  ierr = cudaDeviceGetAttribute(&minor, cudaDevAttrComputeCapabilityMinor,
+                                deviceID); CeedChk_Cu(ceed,ierr);
+  data->arch = 10*major + minor;
+
+  // Compile kernels straight to SASS when NVRTC supports the device arch, so
+  //   the driver does not compile PTX a second time on module load
+  data->cubin = false;
+#if CUDA_VERSION >= 11020
+  int numarchs;
+  if (nvrtcGetNumSupportedArchs(&numarchs) == NVRTC_SUCCESS && numarchs > 0) {
+    int archs[numarchs];
+    if (nvrtcGetSupportedArchs(archs) == NVRTC_SUCCESS)
+      for (int i = 0; i < numarchs; i++)
+        data->cubin = data->cubin || archs[i] == data->arch;
+  }
+#endif
+
+  // Opt-in, since page-locking user arrays is costly and may fail for
+  //   arrays that are short lived or not page aligned
+  const char *hostregister = getenv("CEED_HOST_REGISTER");
+  data->hostregister = hostregister && strcmp(hostregister, "0");
+
+  // Opt-in, since graphs only pay off when the same operator is applied
+  //   repeatedly to the same vectors
+  const char *graphs = getenv("CEED_GRAPHS");
+  data->graphs = graphs && strcmp(graphs, "0");
+
+  // Opt-in, since streaming chunks from host memory is only worth its
+  //   transfers when the passive inputs do not fit in device memory
+  const char *streamelems = getenv("CEED_STREAM_ELEMS");
+  data->streamelems = streamelems ? atoi(streamelems) : 0;
+
+  // Opt-in, since tensor cores only pay off for high order bases, and
+  //   accumulate in a different order than the default kernels
+  const char *tensorcores = getenv("CEED_TENSOR_CORES");
+  data->tensorcores = tensorcores && strcmp(tensorcores, "0") &&
+                      data->arch >= 80 && sizeof(CeedScalar) == sizeof(double);
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// Get CUBLAS handle
+// Share the device state of a Ceed with a delegate or operator fallback
+//
+// The CUDA Ceeds of a delegate chain, such as /gpu/cuda/gen, its
+//   /gpu/cuda/shared delegate, their /gpu/cuda/ref delegate and operator
+//   fallback, all use the cuBLAS handles of the outermost one, so each
+//   handle is only created once. Children from other backends are skipped.
+//------------------------------------------------------------------------------
+int CeedCudaShareDevice(Ceed ceed, Ceed child) {
+  int ierr;
+  const char *resource;
+  ierr = CeedGetResource(child, &resource); CeedChk(ierr);
+  if (strncmp(resource, "/gpu/cuda/ref", 13) &&
+      strncmp(resource, "/gpu/cuda/shared", 16) &&
+      strncmp(resource, "/gpu/cuda/gen", 13))
+    return 0;
+
+  Ceed_Cuda *data;
+  ierr = CeedGetData(child, &data); CeedChk(ierr);
+  data->sharedceed = ceed;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Get the backend data holding the shared cuBLAS handles
+//------------------------------------------------------------------------------
+int CeedCudaGetSharedData(Ceed ceed, Ceed_Cuda **data) {
+  int ierr;
+  ierr = CeedGetData(ceed, data); CeedChk(ierr);
+  while ((*data)->sharedceed) {
+    ierr = CeedGetData((*data)->sharedceed, data); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Launch stream
+//
+// Work is issued on the per-thread default stream, as the backend is built
+//   with CUDA_API_PER_THREAD_DEFAULT_STREAM, so operators applied on several
+//   host threads run concurrently. While an apply is captured as a graph, or
+//   runs on the stream of a composite suboperator, the launches of the
+//   calling thread are redirected to that stream.
+//------------------------------------------------------------------------------
+static __thread cudaStream_t CeedCudaStream = NULL;
+
+cudaStream_t CeedCudaGetStream(void) {
+  return CeedCudaStream;
+}
+
+void CeedCudaSetStream(cudaStream_t stream) {
+  CeedCudaStream = stream;
+}
+
+//------------------------------------------------------------------------------
+// Get the cuBLAS handle of the calling thread, bound to its launch stream
+//
+// cuBLAS handles are not shared between host threads, so each thread creates
+//   its own on first use.
 //------------------------------------------------------------------------------
+static int CeedCudaGetThreadCublasHandle(Ceed ceed, Ceed_Cuda *data,
+    cublasHandle_t *handle) {
+  int ierr;
+  const pthread_t self = pthread_self();
+
+  *handle = NULL;
+  for (CeedInt i = 0; i < data->numcublas && !*handle; i++)
+    if (pthread_equal(data->cublasthreads[i], self))
+      *handle = data->cublashandles[i];
+  if (!*handle) {
+    ierr = cublasCreate(handle); CeedChk_Cublas(ceed, ierr);
+    ierr = CeedRealloc(data->numcublas+1, &data->cublasthreads); CeedChk(ierr);
+    ierr = CeedRealloc(data->numcublas+1, &data->cublashandles); CeedChk(ierr);
+    data->cublasthreads[data->numcublas] = self;
+    data->cublashandles[data->numcublas] = *handle;
+    data->numcublas++;
+  }
+  return 0;
+}
+
 int CeedCudaGetCublasHandle(Ceed ceed, cublasHandle_t *handle) {
+  int ierr;
+  Ceed_Cuda *data;
+  ierr = CeedCudaGetSharedData(ceed, &data); CeedChk(ierr);
+
+  ierr = CeedLock(ceed); CeedChk(ierr);
+  int ierrhandle = CeedCudaGetThreadCublasHandle(ceed, data, handle);
+  ierr = CeedUnlock(ceed); CeedChk(ierr);
+  CeedChk(ierrhandle);
+  cudaStream_t stream = CeedCudaGetStream();
+  ierr = cublasSetStream(*handle, stream ? stream : cudaStreamPerThread);
+  CeedChk_Cublas(ceed, ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Device memory pool
+//
+// Freed device allocations are cached per Ceed and reused for later requests
+//   of similar size, so repeated setup and destruction of operators does not
+//   pay for cudaMalloc and the device synchronization in cudaFree. Each host
+//   thread issues its work on its own stream, so an event records the last
+//   use of a freed block, and the stream that reuses it waits for the event.
+//   The pool is shared by the threads of a Ceed and updated under CeedLock().
+//   When the application sets an allocator with CeedSetAllocator(), device
+//   memory comes from it instead and the pool is not used.
+//------------------------------------------------------------------------------
+static int CeedCudaMallocLocked(Ceed ceed, Ceed_Cuda *data, void **ptr,
+                                size_t bytes) {
+  int ierr;
+  if (!data->poolinuse)
+    data->poolinuse = kh_init(CeedCudaPool);
+
+  // Smallest cached block that fits without wasting more than half of it
+  CeedInt best = -1;
+  for (CeedInt i=0; i<data->poolnumfree; i++) {
+    const size_t size = data->poolfree[i].bytes;
+    if (size >= bytes && size <= 2*bytes &&
+        (best < 0 || size < data->poolfree[best].bytes))
+      best = i;
+  }
+  if (best >= 0) {
+    CeedCudaPoolBlock block = data->poolfree[best];
+    data->poolfree[best] = data->poolfree[--data->poolnumfree];
+    data->poolbytescached -= block.bytes;
+    ierr = cudaStreamWaitEvent(CeedCudaGetStream(), block.freed, 0);
+    CeedChk_Cu(ceed, ierr);
+    ierr = cudaEventDestroy(block.freed); CeedChk_Cu(ceed, ierr);
+    *ptr = block.ptr;
+    bytes = block.bytes;
+  } else {
+    ierr = cudaMalloc(ptr, bytes);
+    if (ierr == cudaErrorMemoryAllocation) {
+      // Return cached blocks to the device and try again
+      cudaGetLastError();
+      ierr = CeedMemoryPoolTrim_Cuda(ceed); CeedChk(ierr);
+      ierr = cudaMalloc(ptr, bytes);
+    }
+    CeedChk_Cu(ceed, ierr);
+  }
+
+  int absent;
+  khint_t k = kh_put(CeedCudaPool, data->poolinuse, (uintptr_t)*ptr, &absent);
+  kh_value(data->poolinuse, k) = bytes;
+  data->poolbytesinuse += bytes;
+  if (data->poolbytesinuse > data->poolhighwater)
+    data->poolhighwater = data->poolbytesinuse;
+  return 0;
+}
+
+int CeedCudaMalloc(Ceed ceed, void **ptr, size_t bytes) {
+  int ierr;
+  Ceed_Cuda *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  *ptr = NULL;
+  if (!bytes)
+    return 0;
+  bool used;
+  ierr = CeedAllocatorMalloc(ceed, CEED_MEMSPACE_DEVICE, bytes, ptr, &used);
+  CeedChk(ierr);
+  if (used)
+    return 0;
+  ierr = CeedLock(ceed); CeedChk(ierr);
+  int ierrmalloc = CeedCudaMallocLocked(ceed, data, ptr, bytes);
+  ierr = CeedUnlock(ceed); CeedChk(ierr);
+  CeedChk(ierrmalloc);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Return device memory to the pool; memory not from the pool, such as arrays
+//   passed in with CEED_OWN_POINTER, is freed directly
+//------------------------------------------------------------------------------
+static int CeedCudaFreeLocked(Ceed ceed, Ceed_Cuda *data, void *ptr) {
+  int ierr;
+  khint_t k = data->poolinuse ? kh_get(CeedCudaPool, data->poolinuse,
+                                       (uintptr_t)ptr) : 0;
+  if (!data->poolinuse || k == kh_end(data->poolinuse)) {
+    ierr = cudaFree(ptr); CeedChk_Cu(ceed, ierr);
+    return 0;
+  }
+
+  const size_t bytes = kh_value(data->poolinuse, k);
+  kh_del(CeedCudaPool, data->poolinuse, k);
+  data->poolbytesinuse -= bytes;
+  if (data->poolnumfree == data->poolmaxfree) {
+    data->poolmaxfree = data->poolmaxfree ? 2*data->poolmaxfree : 16;
+    ierr = CeedRealloc(data->poolmaxfree, &data->poolfree); CeedChk(ierr);
+  }
+  CeedCudaPoolBlock *block = &data->poolfree[data->poolnumfree];
+  ierr = cudaEventCreateWithFlags(&block->freed, cudaEventDisableTiming);
+  CeedChk_Cu(ceed, ierr);
+  ierr = cudaEventRecord(block->freed, CeedCudaGetStream());
+  CeedChk_Cu(ceed, ierr);
+  block->ptr = ptr;
+  block->bytes = bytes;
+  data->poolnumfree++;
+  data->poolbytescached += bytes;
+  return 0;
+}
+
+int CeedCudaFree(Ceed ceed, void *ptr) {
+  int ierr;
+  Ceed_Cuda *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  if (!ptr)
+    return 0;
+  bool used;
+  ierr = CeedAllocatorFree(ceed, CEED_MEMSPACE_DEVICE, NULL, &used);
+  CeedChk(ierr);
+  if (used) {
+    // Work queued on this thread's stream may still use the memory
+    ierr = cudaStreamSynchronize(CeedCudaGetStream()); CeedChk_Cu(ceed, ierr);
+    ierr = CeedAllocatorFree(ceed, CEED_MEMSPACE_DEVICE, &ptr, &used);
+    CeedChk(ierr);
+    return 0;
+  }
+  ierr = CeedLock(ceed); CeedChk(ierr);
+  int ierrfree = CeedCudaFreeLocked(ceed, data, ptr);
+  ierr = CeedUnlock(ceed); CeedChk(ierr);
+  CeedChk(ierrfree);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Remove device memory from the pool without freeing it, when ownership is
+//   is handed to the user by CeedVectorTakeArray
+//------------------------------------------------------------------------------
+int CeedCudaRelease(Ceed ceed, void *ptr) {
+  int ierr;
+  Ceed_Cuda *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  if (!ptr)
+    return 0;
+  ierr = CeedLock(ceed); CeedChk(ierr);
+  if (data->poolinuse) {
+    khint_t k = kh_get(CeedCudaPool, data->poolinuse, (uintptr_t)ptr);
+    if (k != kh_end(data->poolinuse)) {
+      data->poolbytesinuse -= kh_value(data->poolinuse, k);
+      kh_del(CeedCudaPool, data->poolinuse, k);
+    }
+  }
+  ierr = CeedUnlock(ceed); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Free all cached device memory
+//------------------------------------------------------------------------------
+static int CeedMemoryPoolTrimLocked_Cuda(Ceed ceed, Ceed_Cuda *data) {
+  int ierr;
+  for (CeedInt i=0; i<data->poolnumfree; i++) {
+    ierr = cudaFree(data->poolfree[i].ptr); CeedChk_Cu(ceed, ierr);
+    ierr = cudaEventDestroy(data->poolfree[i].freed); CeedChk_Cu(ceed, ierr);
+  }
+  data->poolnumfree = 0;
+  data->poolbytescached = 0;
+  return 0;
+}
+
+int CeedMemoryPoolTrim_Cuda(Ceed ceed) {
   int ierr;
   Ceed_Cuda *data;
   ierr = CeedGetData(ceed, &data); CeedChk(ierr);
 
-  if (!data->cublasHandle) {
-    ierr = cublasCreate(&data->cublasHandle); CeedChk_Cublas(ceed, ierr);
+  ierr = CeedLock(ceed); CeedChk(ierr);
+  int ierrtrim = CeedMemoryPoolTrimLocked_Cuda(ceed, data);
+  ierr = CeedUnlock(ceed); CeedChk(ierr);
+  CeedChk(ierrtrim);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Memory pool usage
+//------------------------------------------------------------------------------
+int CeedMemoryPoolGetUsage_Cuda(Ceed ceed, size_t *inuse, size_t *cached,
+                                size_t *highwater) {
+  int ierr;
+  Ceed_Cuda *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  ierr = CeedLock(ceed); CeedChk(ierr);
+  *inuse = data->poolbytesinuse;
+  *cached = data->poolbytescached;
+  *highwater = data->poolhighwater;
+  ierr = CeedUnlock(ceed); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Request Wait
+//------------------------------------------------------------------------------
+static int CeedRequestWait_Cuda(CeedRequest req) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedRequestGetCeed(req, &ceed); CeedChk(ierr);
+  cudaEvent_t *event;
+  ierr = CeedRequestGetData(req, &event); CeedChk(ierr);
+
+  ierr = cudaEventSynchronize(*event); CeedChk_Cu(ceed, ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Request Destroy
+//------------------------------------------------------------------------------
+static int CeedRequestDestroy_Cuda(CeedRequest req) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedRequestGetCeed(req, &ceed); CeedChk(ierr);
+  cudaEvent_t *event;
+  ierr = CeedRequestGetData(req, &event); CeedChk(ierr);
+
+  ierr = cudaEventDestroy(*event); CeedChk_Cu(ceed, ierr);
+  ierr = CeedFree(&event); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Record an event after the work submitted so far and return it as a request
+//------------------------------------------------------------------------------
+int CeedRequestRecord_Cuda(Ceed ceed, CeedRequest *request) {
+  return CeedRequestRecordStream_Cuda(ceed, 0, request);
+}
+
+//------------------------------------------------------------------------------
+// Record an event after the work submitted so far to a stream and return it as
+//   a request
+//------------------------------------------------------------------------------
+int CeedRequestRecordStream_Cuda(Ceed ceed, cudaStream_t stream,
+                                 CeedRequest *request) {
+  int ierr;
+  if (request == CEED_REQUEST_IMMEDIATE || request == CEED_REQUEST_ORDERED)
+    return 0;
+
+  cudaEvent_t *event;
+  ierr = CeedCalloc(1, &event); CeedChk(ierr);
+  ierr = cudaEventCreateWithFlags(event, cudaEventDisableTiming);
+  CeedChk_Cu(ceed, ierr);
+  ierr = cudaEventRecord(*event, stream); CeedChk_Cu(ceed, ierr);
+
+  ierr = CeedRequestCreate(ceed, request); CeedChk(ierr);
+  ierr = CeedRequestSetData(*request, event); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Request", *request, "Wait",
+                                CeedRequestWait_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Request", *request, "Destroy",
+                                CeedRequestDestroy_Cuda); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Open an NVTX range for a profiled stage
+//------------------------------------------------------------------------------
+static int CeedProfilePush_Cuda(Ceed ceed, const char *name) {
+  int ierr;
+  Ceed_Cuda *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  nvtxRangePushA(name);
+
+  // Pair the device and host clocks when the first stage opens, and again
+  //   every second, as elapsed times between events lose precision
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  const double now = ts.tv_sec + 1e-9*ts.tv_nsec;
+  if (!data->traceorigin) {
+    ierr = cudaEventCreate(&data->traceorigin); CeedChk_Cu(ceed, ierr);
+    ierr = cudaEventCreate(&data->traceend); CeedChk_Cu(ceed, ierr);
+    for (CeedInt i = 0; i < CEED_CUDA_TRACE_DEPTH; i++) {
+      ierr = cudaEventCreate(&data->tracestart[i]); CeedChk_Cu(ceed, ierr);
+    }
   }
-  *handle = data->cublasHandle;
+  if (!data->tracedepth && (!data->traceorigintime ||
+                            now - data->traceorigintime > 1.0)) {
+    ierr = cudaEventRecord(data->traceorigin, 0); CeedChk_Cu(ceed, ierr);
+    ierr = cudaEventSynchronize(data->traceorigin); CeedChk_Cu(ceed, ierr);
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    data->traceorigintime = ts.tv_sec + 1e-9*ts.tv_nsec;
+  }
+  if (data->tracedepth < CEED_CUDA_TRACE_DEPTH) {
+    ierr = cudaEventRecord(data->tracestart[data->tracedepth], 0);
+    CeedChk_Cu(ceed, ierr);
+  }
+  data->tracedepth++;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Complete device work and close the NVTX range for a profiled stage,
+//   reporting when the stage ran on the device
+//------------------------------------------------------------------------------
+static int CeedProfilePop_Cuda(Ceed ceed, double *devstart, double *devend) {
+  int ierr;
+  Ceed_Cuda *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  const CeedInt depth = --data->tracedepth;
+  if (depth < CEED_CUDA_TRACE_DEPTH) {
+    ierr = cudaEventRecord(data->traceend, 0); CeedChk_Cu(ceed, ierr);
+  }
+  ierr = cudaDeviceSynchronize(); CeedChk_Cu(ceed, ierr);
+  if (depth < CEED_CUDA_TRACE_DEPTH) {
+    float start, end;
+    ierr = cudaEventElapsedTime(&start, data->traceorigin,
+                                data->tracestart[depth]);
+    CeedChk_Cu(ceed, ierr);
+    ierr = cudaEventElapsedTime(&end, data->traceorigin, data->traceend);
+    CeedChk_Cu(ceed, ierr);
+    *devstart = data->traceorigintime + 1e-3*start;
+    *devend = data->traceorigintime + 1e-3*end;
+  }
+  nvtxRangePop();
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Read the energy used by the device since the driver was loaded, in joules,
+//   or a negative value if NVML does not report it for this device
+//------------------------------------------------------------------------------
+static int CeedEnergyRead_Cuda(Ceed ceed, double *joules) {
+  *joules = -1.0;
+#ifdef CEED_CUDA_NVML
+  int ierr;
+  Ceed_Cuda *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  // NVML may enumerate devices in another order, so match the PCI bus id
+  if (!data->nvmltried) {
+    char busid[32];
+    data->nvmltried = true;
+    if (nvmlInit() != NVML_SUCCESS)
+      return 0;
+    ierr = cudaDeviceGetPCIBusId(busid, sizeof(busid), data->deviceId);
+    CeedChk_Cu(ceed, ierr);
+    nvmlDevice_t device;
+    if (nvmlDeviceGetHandleByPciBusId(busid, &device) != NVML_SUCCESS) {
+      nvmlShutdown();
+      return 0;
+    }
+    data->nvmldevice = device;
+    data->nvml = true;
+  }
+  unsigned long long millijoules;
+  if (data->nvml &&
+      nvmlDeviceGetTotalEnergyConsumption((nvmlDevice_t)data->nvmldevice,
+                                          &millijoules) == NVML_SUCCESS)
+    *joules = 1e-3*millijoules;
+#endif
   return 0;
 }
 
@@ -182,9 +1024,33 @@ int CeedDestroy_Cuda(Ceed ceed) {
   int ierr;
   Ceed_Cuda *data;
   ierr = CeedGetData(ceed, &data); CeedChk(ierr);
-  if (data->cublasHandle) {
-    ierr = cublasDestroy(data->cublasHandle); CeedChk_Cublas(ceed, ierr);
+  if (data->jithits || data->jitmisses)
+    CeedDebug("JIT cache: %d hits, %d misses", data->jithits, data->jitmisses);
+  for (CeedInt i = 0; i < data->numcublas; i++) {
+    ierr = cublasDestroy(data->cublashandles[i]); CeedChk_Cublas(ceed, ierr);
+  }
+  ierr = CeedFree(&data->cublasthreads); CeedChk(ierr);
+  ierr = CeedFree(&data->cublashandles); CeedChk(ierr);
+  if (data->poolhighwater)
+    CeedDebug("Device memory pool: %zu bytes high-water", data->poolhighwater);
+  if (data->traceorigin) {
+    ierr = cudaEventDestroy(data->traceorigin); CeedChk_Cu(ceed, ierr);
+    ierr = cudaEventDestroy(data->traceend); CeedChk_Cu(ceed, ierr);
+    for (CeedInt i = 0; i < CEED_CUDA_TRACE_DEPTH; i++) {
+      ierr = cudaEventDestroy(data->tracestart[i]); CeedChk_Cu(ceed, ierr);
+    }
+  }
+  if (data->snapstream) {
+    ierr = cudaStreamDestroy(data->snapstream); CeedChk_Cu(ceed, ierr);
   }
+#ifdef CEED_CUDA_NVML
+  if (data->nvml)
+    nvmlShutdown();
+#endif
+  ierr = CeedMemoryPoolTrim_Cuda(ceed); CeedChk(ierr);
+  ierr = CeedFree(&data->poolfree); CeedChk(ierr);
+  if (data->poolinuse)
+    kh_destroy(CeedCudaPool, data->poolinuse);
   ierr = CeedFree(&data); CeedChk(ierr);
   return 0;
 }
@@ -227,6 +1093,20 @@ static int CeedInit_Cuda(const char *resource, Ceed ceed) {
                                 CeedOperatorCreate_Cuda); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "CompositeOperatorCreate",
                                 CeedCompositeOperatorCreate_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "ProfilePush",
+                                CeedProfilePush_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "ProfilePop",
+                                CeedProfilePop_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "EnergyRead",
+                                CeedEnergyRead_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "MemoryPoolTrim",
+                                CeedMemoryPoolTrim_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "MemoryPoolGetUsage",
+                                CeedMemoryPoolGetUsage_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "SetCurrentDevice",
+                                CeedSetCurrentDevice_Cuda); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "ShareDevice",
+                                CeedCudaShareDevice); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy",
                                 CeedDestroy_Cuda); CeedChk(ierr);
   return 0;
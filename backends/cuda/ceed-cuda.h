@@ -17,13 +17,24 @@
 #define _ceed_cuda_h
 
 #include <ceed-backend.h>
+#include <ceed-hash.h>
 #include <nvrtc.h>
 #include <cuda.h>
 #include <cuda_runtime.h>
 #include <cublas_v2.h>
+#include <pthread.h>
 
 #define CUDA_MAX_PATH 256
 
+// Field pointer tables larger than this are copied to device memory rather
+//   than passed by value, as kernel parameters are limited to 4 KB
+#define CEED_CUDA_MAX_FIELDS_BYTES 2048
+// QFunction field tables keep at least the 16 slots per direction that user
+//   kernels set with CeedQFunctionSetCUDAUserFunction() expect
+#define CEED_CUDA_MIN_FIELD_SLOTS 16
+// Nesting depth of profiled stages timed on the device
+#define CEED_CUDA_TRACE_DEPTH 8
+
 #define CeedChk_Nvrtc(ceed, x) \
 do { \
   nvrtcResult result = x; \
@@ -82,6 +93,12 @@ typedef struct {
   CeedScalar *d_array;
   CeedScalar *d_array_allocated;
   CeedCudaSyncState memState;
+  bool h_array_pinned;              // h_array_allocated is page-locked
+  CeedScalar *h_array_registered;   // User array page-locked by the backend
+  cudaEvent_t transfer;            // Completion of the last async transfer
+  bool transferpending;
+  bool unified;                     // h_array and d_array alias managed memory
+  CeedScalar *m_array_allocated;    // Managed allocation owned by the vector
 } CeedVector_Cuda;
 
 typedef struct {
@@ -90,6 +107,16 @@ typedef struct {
   CUfunction noTrOffset;
   CUfunction trStrided;
   CUfunction trOffset;
+  CUfunction noTrCompressed;
+  CUfunction noTrOffsetVec2;
+  CUfunction trOffsetVec2;
+  CUfunction trOffsetSet;
+  CUfunction trOffsetSetVec2;
+  CUfunction noTrCompressedVec2;
+  CUfunction multiplicityOffset;
+  bool vec2;
+  bool tcovers;
+  bool sharedtables;
   CeedInt nnodes;
   CeedInt *h_ind;
   CeedInt *h_ind_allocated;
@@ -98,13 +125,18 @@ typedef struct {
   CeedInt *d_toffsets;
   CeedInt *d_tindices;
   CeedInt *d_lvec_indices;
+  CeedInt *d_eoffsets;
+  CeedInt *d_stencil;
 } CeedElemRestriction_Cuda;
 
-// We use a struct to avoid having to memCpy the array of pointers
-// __global__ copies by value the struct.
+// The inputs and outputs share one host table, laid out like the kernel
+//   struct of two pointer arrays. __global__ copies the table by value, unless
+//   it is too large; then it is copied to d_fields and passed by pointer.
 typedef struct {
-  const CeedScalar *inputs[16];
-  CeedScalar *outputs[16];
+  const CeedScalar **inputs;
+  CeedScalar **outputs;
+  size_t bytes;
+  void *d_fields;
 } Fields_Cuda;
 
 typedef struct {
@@ -165,14 +197,90 @@ typedef struct {
   CeedInt    numein;
   CeedInt    numeout;
   CeedOperatorDiag_Cuda *diag;
+  void **d_elow;          // Reduced precision passive input E-vector data
+  uint64_t *inputstate;   // State counter of reduced precision inputs
+  CUmodule storagemodule;
+  CUfunction narrow[3];   // Kernels by CeedStorageType, CeedScalar to storage
+  CUfunction widen[3];    // Kernels by CeedStorageType, storage to CeedScalar
+  bool streamcapable;     // All kernels launch through CUDA backend Ceeds
+  Ceed *streamceeds;      // Ceeds launching the kernels of an apply
+  CeedInt numstreamceeds;
+  CeedInt numapplies;     // Applies before capture, to compile and allocate
+  cudaStream_t graphstream;
+  cudaGraphExec_t graph;  // Captured apply, replayed while graphptrs match
+  const void **graphptrs; // Device arrays of inputs, outputs, and context
+  CeedInt numsubstreams;   // Composite: one stream per suboperator
+  cudaStream_t *substreams;
+  cudaEvent_t *subevents;  // Composite: fork and join of the substreams
+  CeedVector *suboutvecs;  // Composite: private outputs of suboperators
+  CeedInt numchunks;       // Streamed: element chunks, applied in turn
+  CeedOperator *chunkops;  // Streamed: operators on the element chunks
+  CeedInt chunkelems;      // Streamed: elements per chunk, but the last
+  CeedInt numstreamed;     // Streamed: passive inputs kept in host memory
+  CeedInt *streamfields;   // Streamed: input field of each streamed input
+  CeedInt (*streamstrides)[3]; // Streamed: L-vector strides of the inputs
+  CeedVector *stagevecs;   // Streamed: two device buffers per input
+  const CeedScalar **h_streamed; // Streamed: host arrays of the inputs
+  cudaStream_t copystream; // Streamed: host to device copies of chunks
+  cudaEvent_t copied[2], consumed[2]; // Streamed: buffer handoff
+  bool releasework;        // Chunk: return device work arrays after apply
 } CeedOperator_Cuda;
 
+// Device allocations owned by the memory pool, keyed by address
+KHASH_MAP_INIT_INT64(CeedCudaPool, size_t)
+
+typedef struct {
+  void *ptr;
+  size_t bytes;
+  cudaEvent_t freed; // Last use, on the launch stream of the freeing thread
+} CeedCudaPoolBlock;
+
 typedef struct {
   int optblocksize;
   int deviceId;
-  cublasHandle_t cublasHandle;
+  int arch;          // Compute capability, 10*major + minor
+  bool cubin;        // NVRTC compiles to SASS for arch, else to PTX
+  CeedInt numcublas;     // cuBLAS handles, one per host thread, created on
+  pthread_t *cublasthreads;       //   first use by the thread
+  cublasHandle_t *cublashandles;
+  CeedInt jithits;   // Kernels loaded from CEED_JIT_CACHE_DIR
+  CeedInt jitmisses; // Kernels compiled and added to CEED_JIT_CACHE_DIR
+  khash_t(CeedCudaPool) *poolinuse; // Allocations handed out by the pool
+  CeedCudaPoolBlock *poolfree;      // Freed allocations cached for reuse
+  CeedInt poolnumfree, poolmaxfree;
+  size_t poolbytesinuse, poolbytescached, poolhighwater;
+  bool hostregister; // Page-lock CEED_USE_POINTER arrays, CEED_HOST_REGISTER
+  bool graphs;       // Replay operator applies as CUDA graphs, CEED_GRAPHS
+  CeedInt streamelems; // Elements per streamed chunk, CEED_STREAM_ELEMS
+  bool tensorcores;    // fp64 MMA basis contractions, CEED_TENSOR_CORES
+  Ceed sharedceed;     // CUDA Ceed whose cuBLAS handles are used by this
+                       //   delegate or operator fallback
+  cudaStream_t snapstream; // Device to host copies of CeedVectorSnapshot
+  cudaEvent_t traceorigin; // Device time origin of profiled stages
+  double traceorigintime; // Host time at which traceorigin completed
+  cudaEvent_t tracestart[CEED_CUDA_TRACE_DEPTH], traceend;
+  CeedInt tracedepth;     // Number of open profiled stages
+  bool nvmltried;         // NVML was initialized for the energy of the device
+  bool nvml;
+  void *nvmldevice;       // nvmlDevice_t, when built with NVML
 } Ceed_Cuda;
 
+// Runtime compilation of a kernel, possibly on another thread
+typedef struct {
+  pthread_t thread;
+  bool async;          // Compiling on thread, joined by CeedCompileCudaWait
+  char *source;
+  char **opts, *optsbuf;
+  char *useroptsbuf;   // Options from CeedSetJitOptions(), split in place
+  int numopts;
+  bool cubin;          // Compile to SASS rather than PTX
+  char *path;          // JIT cache file, if CEED_JIT_CACHE_DIR is set
+  bool cachehit;
+  nvrtcResult result;
+  char *image, *log;
+  size_t imagesize;
+} CeedCudaJit;
+
 static inline CeedInt CeedDivUpInt(CeedInt numer, CeedInt denom) {
   return (numer + denom - 1) / denom;
 }
@@ -180,9 +288,22 @@ static inline CeedInt CeedDivUpInt(CeedInt numer, CeedInt denom) {
 CEED_INTERN int CeedCompileCuda(Ceed ceed, const char *source, CUmodule *module,
                                 const CeedInt numopts, ...);
 
+CEED_INTERN int CeedCompileCudaAsync(Ceed ceed, const char *source,
+                                     CeedCudaJit **jit,
+                                     const CeedInt numopts, ...);
+
+CEED_INTERN int CeedCompileCudaWait(Ceed ceed, CeedCudaJit **jit,
+                                    CUmodule *module);
+
 CEED_INTERN int CeedGetKernelCuda(Ceed ceed, CUmodule module, const char *name,
                                   CUfunction *kernel);
 
+// Get the resource usage of a CUDA kernel
+CEED_INTERN int CeedGetKernelInfoCuda(Ceed ceed, CUfunction kernel,
+                                      const char *name, int blockSize,
+                                      size_t dynamicSharedMem,
+                                      CeedKernelInfo *info);
+
 CEED_INTERN int CeedRunKernelCuda(Ceed ceed, CUfunction kernel,
                                   const int gridSize,
                                   const int blockSize, void **args);
@@ -210,14 +331,48 @@ CEED_INTERN int run_kernel_dim_shared(Ceed ceed, CUfunction kernel,
                                       const int sharedMemSize,
                                       void **args);
 
+CEED_INTERN int CeedCudaDelegateResource(const char *resource,
+    const char *prefix, char *delegate);
+
 CEED_INTERN int CeedCudaInit(Ceed ceed, const char *resource, int nrc);
 
+CEED_INTERN int CeedCudaShareDevice(Ceed ceed, Ceed child);
+
+CEED_INTERN int CeedCudaGetSharedData(Ceed ceed, Ceed_Cuda **data);
+
+CEED_INTERN int CeedCudaCopyFieldsToDevice(Ceed ceed, const void *table,
+    size_t bytes, void **d_table);
+
 CEED_INTERN int CeedCudaGetCublasHandle(Ceed ceed, cublasHandle_t *handle);
 
+CEED_INTERN cudaStream_t CeedCudaGetStream(void);
+
+CEED_INTERN void CeedCudaSetStream(cudaStream_t stream);
+
+CEED_INTERN int CeedCudaMalloc(Ceed ceed, void **ptr, size_t bytes);
+
+CEED_INTERN int CeedCudaFree(Ceed ceed, void *ptr);
+
+CEED_INTERN int CeedCudaRelease(Ceed ceed, void *ptr);
+
+CEED_INTERN int CeedMemoryPoolTrim_Cuda(Ceed ceed);
+
+CEED_INTERN int CeedMemoryPoolGetUsage_Cuda(Ceed ceed, size_t *inuse,
+    size_t *cached, size_t *highwater);
+
+CEED_INTERN int CeedRequestRecord_Cuda(Ceed ceed, CeedRequest *request);
+CEED_INTERN int CeedRequestRecordStream_Cuda(Ceed ceed, cudaStream_t stream,
+    CeedRequest *request);
+
 CEED_INTERN int CeedDestroy_Cuda(Ceed ceed);
 
 CEED_INTERN int CeedVectorCreate_Cuda(CeedInt n, CeedVector vec);
 
+CEED_INTERN int CeedVectorEvictDevice_Cuda(CeedVector vec,
+    const CeedScalar **h_array);
+
+CEED_INTERN int CeedVectorReleaseDevice_Cuda(CeedVector vec);
+
 CEED_INTERN int CeedElemRestrictionCreate_Cuda(CeedMemType mtype,
     CeedCopyMode cmode, const CeedInt *indices, CeedElemRestriction r);
 
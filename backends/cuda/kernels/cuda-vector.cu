@@ -14,7 +14,7 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
-#include <ceed.h>
+#include <ceed-backend.h>
 #include <cuda.h>
 
 //------------------------------------------------------------------------------
@@ -67,3 +67,475 @@ extern "C" int CeedDeviceReciprocal_Cuda(CeedScalar* d_array, CeedInt length) {
   rcpValueK<<<gridsize,bsize>>>(d_array, length);
   return 0;
 }
+
+//------------------------------------------------------------------------------
+// Kernel for inverting point blocks, one thread per block
+//------------------------------------------------------------------------------
+__global__ static void pbInvertK(CeedScalar * __restrict__ vec, CeedInt n,
+                                 CeedInt nblocks) {
+  int idx = threadIdx.x + blockDim.x * blockIdx.x;
+  if (idx >= nblocks)
+    return;
+  CeedScalar *A = &vec[idx*n*n];
+  CeedInt piv[16];
+  for (CeedInt k = 0; k < n; k++) {
+    CeedInt p = k;
+    for (CeedInt i = k+1; i < n; i++)
+      if (fabs(A[i*n+k]) > fabs(A[p*n+k]))
+        p = i;
+    piv[k] = p;
+    if (fabs(A[p*n+k]) <= 1E-16) {
+      piv[k] = k;
+      continue;
+    }
+    if (p != k)
+      for (CeedInt j = 0; j < n; j++) {
+        CeedScalar t = A[k*n+j];
+        A[k*n+j] = A[p*n+j];
+        A[p*n+j] = t;
+      }
+    const CeedScalar pivinv = 1./A[k*n+k];
+    A[k*n+k] = 1.;
+    for (CeedInt j = 0; j < n; j++)
+      A[k*n+j] *= pivinv;
+    for (CeedInt i = 0; i < n; i++)
+      if (i != k) {
+        const CeedScalar f = A[i*n+k];
+        A[i*n+k] = 0.;
+        for (CeedInt j = 0; j < n; j++)
+          A[i*n+j] -= f*A[k*n+j];
+      }
+  }
+  for (CeedInt k = n-1; k >= 0; k--)
+    if (piv[k] != k)
+      for (CeedInt i = 0; i < n; i++) {
+        CeedScalar t = A[i*n+k];
+        A[i*n+k] = A[i*n+piv[k]];
+        A[i*n+piv[k]] = t;
+      }
+}
+
+//------------------------------------------------------------------------------
+// Invert point blocks in device memory
+//------------------------------------------------------------------------------
+extern "C" int CeedDevicePointBlockInvert_Cuda(CeedScalar* d_array,
+    CeedInt bsize, CeedInt length) {
+  const int blocksize = 128;
+  const int nblocks = length / (bsize*bsize);
+  int gridsize = nblocks / blocksize;
+
+  if (blocksize * gridsize < nblocks)
+    gridsize += 1;
+  pbInvertK<<<gridsize,blocksize>>>(d_array, bsize, nblocks);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Kernel for axpy
+//------------------------------------------------------------------------------
+__global__ static void axpyK(CeedScalar *y, CeedScalar alpha,
+                             const CeedScalar *x, CeedInt size) {
+  int idx = threadIdx.x + blockDim.x * blockIdx.x;
+  if (idx >= size)
+    return;
+  y[idx] += alpha * x[idx];
+}
+
+//------------------------------------------------------------------------------
+// Compute y = alpha x + y on device
+//------------------------------------------------------------------------------
+extern "C" int CeedDeviceAXPY_Cuda(CeedScalar *y_array, CeedScalar alpha,
+                                   const CeedScalar *x_array, CeedInt length) {
+  const int bsize = 512;
+  const int vecsize = length;
+  int gridsize = vecsize / bsize;
+
+  if (bsize * gridsize < vecsize)
+    gridsize += 1;
+  axpyK<<<gridsize,bsize>>>(y_array, alpha, x_array, length);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Kernel for axpby
+//------------------------------------------------------------------------------
+__global__ static void axpbyK(CeedScalar *y, CeedScalar alpha, CeedScalar beta,
+                              const CeedScalar *x, CeedInt size) {
+  int idx = threadIdx.x + blockDim.x * blockIdx.x;
+  if (idx >= size)
+    return;
+  y[idx] = alpha * x[idx] + beta * y[idx];
+}
+
+//------------------------------------------------------------------------------
+// Compute y = alpha x + beta y on device
+//------------------------------------------------------------------------------
+extern "C" int CeedDeviceAXPBY_Cuda(CeedScalar *y_array, CeedScalar alpha,
+                                    CeedScalar beta, const CeedScalar *x_array,
+                                    CeedInt length) {
+  const int bsize = 512;
+  const int vecsize = length;
+  int gridsize = vecsize / bsize;
+
+  if (bsize * gridsize < vecsize)
+    gridsize += 1;
+  axpbyK<<<gridsize,bsize>>>(y_array, alpha, beta, x_array, length);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Kernel for pointwise multiplication
+//------------------------------------------------------------------------------
+__global__ static void pointwiseMultK(CeedScalar *w, const CeedScalar *x,
+                                      const CeedScalar *y, CeedInt size) {
+  int idx = threadIdx.x + blockDim.x * blockIdx.x;
+  if (idx >= size)
+    return;
+  w[idx] = x[idx] * y[idx];
+}
+
+//------------------------------------------------------------------------------
+// Compute the pointwise product w = x .* y on device
+//------------------------------------------------------------------------------
+extern "C" int CeedDevicePointwiseMult_Cuda(CeedScalar *w_array,
+    const CeedScalar *x_array, const CeedScalar *y_array, CeedInt length) {
+  const int bsize = 512;
+  const int vecsize = length;
+  int gridsize = vecsize / bsize;
+
+  if (bsize * gridsize < vecsize)
+    gridsize += 1;
+  pointwiseMultK<<<gridsize,bsize>>>(w_array, x_array, y_array, length);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Kernel for the Chebyshev smoother update
+//------------------------------------------------------------------------------
+__global__ static void chebyshevUpdateK(CeedScalar *x, CeedScalar *d,
+                                        CeedScalar *r, const CeedScalar *w,
+                                        const CeedScalar *dinv,
+                                        CeedScalar alpha, CeedScalar beta,
+                                        CeedInt size) {
+  int idx = threadIdx.x + blockDim.x * blockIdx.x;
+  if (idx >= size)
+    return;
+  CeedScalar ri = r[idx];
+  if (w) {
+    ri -= dinv[idx] * w[idx];
+    r[idx] = ri;
+  }
+  const CeedScalar di = alpha * d[idx] + beta * ri;
+  d[idx] = di;
+  x[idx] += di;
+}
+
+//------------------------------------------------------------------------------
+// Compute r -= dinv .* w, d = alpha d + beta r, x += d on device
+//------------------------------------------------------------------------------
+extern "C" int CeedDeviceChebyshevUpdate_Cuda(CeedScalar *x_array,
+    CeedScalar *d_array, CeedScalar *r_array, const CeedScalar *w_array,
+    const CeedScalar *dinv_array, CeedScalar alpha, CeedScalar beta,
+    CeedInt length) {
+  const int bsize = 512;
+  const int vecsize = length;
+  int gridsize = vecsize / bsize;
+
+  if (bsize * gridsize < vecsize)
+    gridsize += 1;
+  chebyshevUpdateK<<<gridsize,bsize>>>(x_array, d_array, r_array, w_array,
+                                     dinv_array, alpha, beta, length);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Reductions
+//
+// A single pass over x and y computes, per block, the sum of |x_i|, the sum of
+//   x_i y_i, and the max of |x_i|; a second kernel reduces the block partials
+//   into stats[4] = {sum |x_i|, sum x_i y_i, max |x_i|, sqrt(sum x_i y_i)}.
+//   Norms use y = x. Results stay in device memory.
+//------------------------------------------------------------------------------
+#define REDUCE_BSIZE 256
+#define REDUCE_MAX_BLOCKS 1024
+
+//------------------------------------------------------------------------------
+// Block reduction of the three statistics in shared memory
+//------------------------------------------------------------------------------
+__device__ static void blockReduce(CeedScalar *s_sum, CeedScalar *s_dot,
+                                   CeedScalar *s_max) {
+  const int tid = threadIdx.x;
+  for (int stride = blockDim.x / 2; stride > 0; stride /= 2) {
+    __syncthreads();
+    if (tid < stride) {
+      s_sum[tid] += s_sum[tid + stride];
+      s_dot[tid] += s_dot[tid + stride];
+      s_max[tid] = fmax(s_max[tid], s_max[tid + stride]);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Kernel for per-block partial reductions
+//------------------------------------------------------------------------------
+__global__ static void reduceK(const CeedScalar *__restrict__ x,
+                               const CeedScalar *__restrict__ y, CeedInt size,
+                               CeedScalar *__restrict__ partials) {
+  __shared__ CeedScalar s_sum[REDUCE_BSIZE], s_dot[REDUCE_BSIZE],
+             s_max[REDUCE_BSIZE];
+  CeedScalar sum = 0., dot = 0., max = 0.;
+  for (int i = threadIdx.x + blockDim.x * blockIdx.x; i < size;
+       i += blockDim.x * gridDim.x) {
+    const CeedScalar absx = fabs(x[i]);
+    sum += absx;
+    dot += x[i] * y[i];
+    max = fmax(max, absx);
+  }
+  s_sum[threadIdx.x] = sum;
+  s_dot[threadIdx.x] = dot;
+  s_max[threadIdx.x] = max;
+  blockReduce(s_sum, s_dot, s_max);
+  if (threadIdx.x == 0) {
+    partials[3*blockIdx.x + 0] = s_sum[0];
+    partials[3*blockIdx.x + 1] = s_dot[0];
+    partials[3*blockIdx.x + 2] = s_max[0];
+  }
+}
+
+//------------------------------------------------------------------------------
+// Kernel for reducing block partials into the final statistics
+//------------------------------------------------------------------------------
+__global__ static void reduceFinalK(const CeedScalar *__restrict__ partials,
+                                    CeedInt nblocks,
+                                    CeedScalar *__restrict__ stats) {
+  __shared__ CeedScalar s_sum[REDUCE_BSIZE], s_dot[REDUCE_BSIZE],
+             s_max[REDUCE_BSIZE];
+  CeedScalar sum = 0., dot = 0., max = 0.;
+  for (int i = threadIdx.x; i < nblocks; i += blockDim.x) {
+    sum += partials[3*i + 0];
+    dot += partials[3*i + 1];
+    max = fmax(max, partials[3*i + 2]);
+  }
+  s_sum[threadIdx.x] = sum;
+  s_dot[threadIdx.x] = dot;
+  s_max[threadIdx.x] = max;
+  blockReduce(s_sum, s_dot, s_max);
+  if (threadIdx.x == 0) {
+    stats[0] = s_sum[0];
+    stats[1] = s_dot[0];
+    stats[2] = s_max[0];
+    stats[3] = sqrt(s_dot[0] > 0 ? s_dot[0] : 0);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Size of the device workspace for a reduction, in CeedScalars
+//------------------------------------------------------------------------------
+extern "C" CeedInt CeedDeviceReduceWorkSize_Cuda(CeedInt length) {
+  CeedInt nblocks = (length + REDUCE_BSIZE - 1) / REDUCE_BSIZE;
+  if (nblocks > REDUCE_MAX_BLOCKS)
+    nblocks = REDUCE_MAX_BLOCKS;
+  if (nblocks < 1)
+    nblocks = 1;
+  return 3*nblocks + 4;
+}
+
+//------------------------------------------------------------------------------
+// Reduce x and y on device, storing the statistics after the block partials
+//   at d_work + CeedDeviceReduceWorkSize_Cuda(length) - 4
+//------------------------------------------------------------------------------
+extern "C" int CeedDeviceReduce_Cuda(const CeedScalar *x_array,
+                                     const CeedScalar *y_array, CeedInt length,
+                                     CeedScalar *d_work) {
+  const CeedInt nblocks = (CeedDeviceReduceWorkSize_Cuda(length) - 4) / 3;
+
+  reduceK<<<nblocks,REDUCE_BSIZE>>>(x_array, y_array, length, d_work);
+  reduceFinalK<<<1,REDUCE_BSIZE>>>(d_work, nblocks, d_work + 3*nblocks);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Segmented reductions: each segment is reduced by a row of blocks into block
+//   partials, and a second kernel with one block per segment reduces the
+//   partials into the result, combining with its value when adding
+//------------------------------------------------------------------------------
+#define SEGMENT_MAX_BLOCKS 64
+
+//------------------------------------------------------------------------------
+// Combine two values with a reduction
+//------------------------------------------------------------------------------
+__device__ static CeedScalar reduceOp(CeedReduceType rtype, CeedScalar a,
+                                      CeedScalar b) {
+  switch (rtype) {
+  case CEED_REDUCE_SUM:
+    return a + b;
+  case CEED_REDUCE_MAX:
+    return fmax(a, b);
+  default:
+    return fmin(a, b);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Block reduction of one value per thread in shared memory
+//------------------------------------------------------------------------------
+__device__ static void blockReduceOp(CeedReduceType rtype, CeedScalar *s_val) {
+  const int tid = threadIdx.x;
+  for (int stride = blockDim.x / 2; stride > 0; stride /= 2) {
+    __syncthreads();
+    if (tid < stride)
+      s_val[tid] = reduceOp(rtype, s_val[tid], s_val[tid + stride]);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Kernel for per-block partial reductions of each segment
+//------------------------------------------------------------------------------
+__global__ static void segmentReduceK(const CeedScalar *__restrict__ x,
+                                      CeedInt seglen, CeedReduceType rtype,
+                                      CeedScalar *__restrict__ partials) {
+  __shared__ CeedScalar s_val[REDUCE_BSIZE];
+  const CeedScalar *seg = x + blockIdx.y * seglen;
+  CeedScalar val = rtype == CEED_REDUCE_SUM ? 0. : seg[0];
+  for (int i = threadIdx.x + blockDim.x * blockIdx.x; i < seglen;
+       i += blockDim.x * gridDim.x)
+    val = reduceOp(rtype, val, seg[i]);
+  s_val[threadIdx.x] = val;
+  blockReduceOp(rtype, s_val);
+  if (threadIdx.x == 0)
+    partials[blockIdx.y * gridDim.x + blockIdx.x] = s_val[0];
+}
+
+//------------------------------------------------------------------------------
+// Kernel for reducing the block partials of each segment into the result
+//------------------------------------------------------------------------------
+__global__ static void segmentReduceFinalK(const CeedScalar *__restrict__
+    partials, CeedInt nblocks, CeedReduceType rtype, bool add,
+    CeedScalar *__restrict__ result) {
+  __shared__ CeedScalar s_val[REDUCE_BSIZE];
+  const CeedScalar *part = partials + blockIdx.x * nblocks;
+  CeedScalar val = rtype == CEED_REDUCE_SUM ? 0. : part[0];
+  for (int i = threadIdx.x; i < nblocks; i += blockDim.x)
+    val = reduceOp(rtype, val, part[i]);
+  s_val[threadIdx.x] = val;
+  blockReduceOp(rtype, s_val);
+  if (threadIdx.x == 0)
+    result[blockIdx.x] = add ? reduceOp(rtype, result[blockIdx.x], s_val[0])
+                         : s_val[0];
+}
+
+//------------------------------------------------------------------------------
+// Number of blocks reducing each segment, the size in CeedScalars of the
+//   device workspace of a segmented reduction divided by the segment count
+//------------------------------------------------------------------------------
+extern "C" CeedInt CeedDeviceSegmentBlocks_Cuda(CeedInt seglen) {
+  CeedInt nblocks = (seglen + REDUCE_BSIZE - 1) / REDUCE_BSIZE;
+  if (nblocks > SEGMENT_MAX_BLOCKS)
+    nblocks = SEGMENT_MAX_BLOCKS;
+  if (nblocks < 1)
+    nblocks = 1;
+  return nblocks;
+}
+
+//------------------------------------------------------------------------------
+// Reduce nseg segments of x on device into result
+//------------------------------------------------------------------------------
+extern "C" int CeedDeviceReduceSegments_Cuda(const CeedScalar *x_array,
+    CeedInt nseg, CeedInt seglen, CeedReduceType rtype, bool add,
+    CeedScalar *d_work, CeedScalar *result_array) {
+  const CeedInt nblocks = CeedDeviceSegmentBlocks_Cuda(seglen);
+  const dim3 grid(nblocks, nseg);
+
+  segmentReduceK<<<grid,REDUCE_BSIZE>>>(x_array, seglen, rtype, d_work);
+  segmentReduceFinalK<<<nseg,REDUCE_BSIZE>>>(d_work, nblocks, rtype, add,
+      result_array);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Fused updates and dot products: each thread loads the entries of the
+//   distinct vectors, applies the updates in order, writes back the updated
+//   vectors, and accumulates the dot products, which blocks reduce into
+//   partials[l*gridDim.x + blockIdx.x]
+//------------------------------------------------------------------------------
+typedef struct {
+  CeedScalar *arrays[CEED_VECTOR_MULTI_MAX];
+  CeedVectorMulti multi;
+} MultiArgs;
+
+__global__ static void multiAXPBYDotK(const MultiArgs args, CeedInt size,
+                                      CeedScalar *__restrict__ partials) {
+  __shared__ CeedScalar s_val[REDUCE_BSIZE];
+  const CeedVectorMulti *m = &args.multi;
+  CeedScalar dots[CEED_VECTOR_MULTI_MAX_DOTS];
+  for (int l = 0; l < m->ndot; l++)
+    dots[l] = 0.;
+  for (int i = threadIdx.x + blockDim.x * blockIdx.x; i < size;
+       i += blockDim.x * gridDim.x) {
+    CeedScalar val[CEED_VECTOR_MULTI_MAX];
+    for (int j = 0; j < m->nvecs; j++)
+      val[j] = args.arrays[j][i];
+    for (int k = 0; k < m->nupdate; k++)
+      val[m->y[k]] = m->alpha[k] * val[m->x[k]] + m->beta[k] * val[m->y[k]];
+    for (int j = 0; j < m->nvecs; j++)
+      if (m->write[j])
+        args.arrays[j][i] = val[j];
+    for (int l = 0; l < m->ndot; l++)
+      dots[l] += val[m->u[l]] * val[m->v[l]];
+  }
+  for (int l = 0; l < m->ndot; l++) {
+    __syncthreads();
+    s_val[threadIdx.x] = dots[l];
+    blockReduceOp(CEED_REDUCE_SUM, s_val);
+    if (threadIdx.x == 0)
+      partials[l * gridDim.x + blockIdx.x] = s_val[0];
+  }
+}
+
+//------------------------------------------------------------------------------
+// Kernel for reducing the block partials of each dot product
+//------------------------------------------------------------------------------
+__global__ static void multiDotFinalK(const CeedScalar *__restrict__ partials,
+                                      CeedInt nblocks,
+                                      CeedScalar *__restrict__ dots) {
+  __shared__ CeedScalar s_val[REDUCE_BSIZE];
+  const CeedScalar *part = partials + blockIdx.x * nblocks;
+  CeedScalar val = 0.;
+  for (int i = threadIdx.x; i < nblocks; i += blockDim.x)
+    val += part[i];
+  s_val[threadIdx.x] = val;
+  blockReduceOp(CEED_REDUCE_SUM, s_val);
+  if (threadIdx.x == 0)
+    dots[blockIdx.x] = s_val[0];
+}
+
+//------------------------------------------------------------------------------
+// Number of blocks of a fused update, the size in CeedScalars of the device
+//   workspace divided by the number of dot products
+//------------------------------------------------------------------------------
+extern "C" CeedInt CeedDeviceMultiBlocks_Cuda(CeedInt length) {
+  CeedInt nblocks = (length + REDUCE_BSIZE - 1) / REDUCE_BSIZE;
+  if (nblocks > REDUCE_MAX_BLOCKS)
+    nblocks = REDUCE_MAX_BLOCKS;
+  if (nblocks < 1)
+    nblocks = 1;
+  return nblocks;
+}
+
+//------------------------------------------------------------------------------
+// Apply fused updates and dot products on device
+//------------------------------------------------------------------------------
+extern "C" int CeedDeviceMultiAXPBYDot_Cuda(CeedScalar **arrays,
+    const CeedVectorMulti *multi, CeedInt length, CeedScalar *d_work,
+    CeedScalar *dots_array) {
+  const CeedInt nblocks = CeedDeviceMultiBlocks_Cuda(length);
+  MultiArgs args;
+  for (CeedInt j = 0; j < multi->nvecs; j++)
+    args.arrays[j] = arrays[j];
+  args.multi = *multi;
+
+  multiAXPBYDotK<<<nblocks,REDUCE_BSIZE>>>(args, length, d_work);
+  if (multi->ndot)
+    multiDotFinalK<<<multi->ndot,REDUCE_BSIZE>>>(d_work, nblocks, dots_array);
+  return 0;
+}
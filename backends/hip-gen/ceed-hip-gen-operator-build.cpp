@@ -0,0 +1,1828 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+#define CEED_DEBUG_COLOR 12
+
+#include "ceed-hip-gen.h"
+#include <iostream>
+#include <sstream>
+#include "../hip-shared/ceed-hip-shared.h"
+
+static const char *deviceFunctions = QUOTE(
+
+//------------------------------------------------------------------------------
+// Typedefs
+//------------------------------------------------------------------------------
+typedef struct {
+  CeedInt tidx;
+  CeedInt tidy;
+  CeedInt tidz;
+  CeedInt tid;
+  CeedScalar* slice;
+} BackendData;
+
+//------------------------------------------------------------------------------
+// Load matrices for basis actions
+//------------------------------------------------------------------------------
+template <int P, int Q>
+inline __device__ void loadMatrix(BackendData& data, const CeedScalar* d_B, CeedScalar* B) {
+  for (CeedInt i = data.tid; i < P*Q; i += blockDim.x*blockDim.y*blockDim.z)
+    B[i] = d_B[i];
+}
+
+//------------------------------------------------------------------------------
+// 1D
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, offsets provided
+//------------------------------------------------------------------------------
+template <int NCOMP, int COMPSTRIDE, int P1d>
+inline __device__ void readDofsOffset1d(BackendData& data, const CeedInt nnodes, const CeedInt elem, const CeedInt* indices, const CeedScalar* d_u, CeedScalar* r_u) {
+  if (data.tidx < P1d) {
+    const CeedInt node = data.tidx;
+    const CeedInt ind = indices[node + elem * P1d];
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      r_u[comp] = d_u[ind + COMPSTRIDE * comp];
+  }
+}
+
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, strided
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int STRIDES_NODE, int STRIDES_COMP, int STRIDES_ELEM>
+inline __device__ void readDofsStrided1d(BackendData& data, const CeedInt elem, const CeedScalar* d_u, CeedScalar* r_u) {
+  if (data.tidx < P1d) {
+    const CeedInt node = data.tidx;
+    const CeedInt ind = node * STRIDES_NODE + elem * STRIDES_ELEM;
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      r_u[comp] = d_u[ind + comp * STRIDES_COMP];
+  }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, offsets provided
+//------------------------------------------------------------------------------
+template <int NCOMP, int COMPSTRIDE, int P1d>
+inline __device__ void writeDofsOffset1d(BackendData& data, const CeedInt nnodes, const CeedInt elem, const CeedInt* indices, const CeedScalar* r_v, CeedScalar* d_v) {
+  if (data.tidx < P1d) {
+    const CeedInt node = data.tidx;
+    const CeedInt ind = indices[node + elem * P1d];
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      atomicAdd(&d_v[ind + COMPSTRIDE * comp], r_v[comp]);
+  }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, strided
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int STRIDES_NODE, int STRIDES_COMP, int STRIDES_ELEM>
+inline __device__ void writeDofsStrided1d(BackendData& data, const CeedInt elem, const CeedScalar* r_v, CeedScalar* d_v) {
+  if (data.tidx < P1d) {
+    const CeedInt node = data.tidx;
+    const CeedInt ind = node * STRIDES_NODE + elem * STRIDES_ELEM;
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      d_v[ind + comp * STRIDES_COMP] += r_v[comp];
+  }
+}
+
+//------------------------------------------------------------------------------
+// 1D tensor contraction x
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractX1d(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < Q1d)
+    for (CeedInt i = 0; i < P1d; ++i)
+      *V += B[i + data.tidx*P1d] * data.slice[i]; // Contract x direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 1D transpose tensor contraction x
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractTransposeX1d(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < P1d)
+    for (CeedInt i = 0; i < Q1d; ++i)
+      *V += B[data.tidx + i*P1d] * data.slice[i]; // Contract x direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 1D interpolate to quadrature points
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void interp1d(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, CeedScalar *__restrict__ r_V) {
+  for (CeedInt comp = 0; comp < NCOMP; comp++)
+    ContractX1d<NCOMP, P1d, Q1d>(data, r_U + comp, c_B, r_V + comp);
+}
+
+//------------------------------------------------------------------------------
+// 1D interpolate transpose
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void interpTranspose1d(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, CeedScalar *__restrict__ r_V) {
+  for (CeedInt comp=0; comp<NCOMP; comp++)
+    ContractTransposeX1d<NCOMP, P1d, Q1d>(data, r_U + comp, c_B, r_V + comp);
+}
+
+//------------------------------------------------------------------------------
+// 1D derivatives at quadrature points
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void grad1d(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
+  for (CeedInt comp = 0; comp < NCOMP; comp++)
+    ContractX1d<NCOMP, P1d, Q1d>(data, r_U + comp, c_G, r_V + comp);
+}
+
+//------------------------------------------------------------------------------
+// 1D derivatives transpose
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void gradTranspose1d(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
+  for (CeedInt comp = 0; comp < NCOMP; comp++)
+    ContractTransposeX1d<NCOMP, P1d, Q1d>(data, r_U + comp, c_G, r_V + comp);
+}
+
+//------------------------------------------------------------------------------
+// 2D
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, offsets provided
+//------------------------------------------------------------------------------
+template <int NCOMP, int COMPSTRIDE, int P1d>
+inline __device__ void readDofsOffset2d(BackendData& data, const CeedInt nnodes, const CeedInt elem, const CeedInt* indices, const CeedScalar* d_u, CeedScalar* r_u) {
+  if (data.tidx < P1d && data.tidy < P1d) {
+    const CeedInt node = data.tidx + data.tidy*P1d;
+    const CeedInt ind = indices[node + elem * P1d*P1d];
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      r_u[comp] = d_u[ind + COMPSTRIDE * comp];
+  }
+}
+
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, strided
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int STRIDES_NODE, int STRIDES_COMP, int STRIDES_ELEM>
+inline __device__ void readDofsStrided2d(BackendData& data, const CeedInt elem, const CeedScalar* d_u, CeedScalar* r_u) {
+  if (data.tidx < P1d && data.tidy < P1d) {
+    const CeedInt node = data.tidx + data.tidy*P1d;
+    const CeedInt ind = node * STRIDES_NODE + elem * STRIDES_ELEM;
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      r_u[comp] = d_u[ind + comp * STRIDES_COMP];
+  }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, offsets provided
+//------------------------------------------------------------------------------
+template <int NCOMP, int COMPSTRIDE, int P1d>
+inline __device__ void writeDofsOffset2d(BackendData& data, const CeedInt nnodes, const CeedInt elem, const CeedInt* indices, const CeedScalar* r_v, CeedScalar* d_v) {
+  if (data.tidx < P1d && data.tidy < P1d) {
+    const CeedInt node = data.tidx + data.tidy*P1d;
+    const CeedInt ind = indices[node + elem * P1d*P1d];
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      atomicAdd(&d_v[ind + COMPSTRIDE * comp], r_v[comp]);
+  }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, strided
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int STRIDES_NODE, int STRIDES_COMP, int STRIDES_ELEM>
+inline __device__ void writeDofsStrided2d(BackendData& data, const CeedInt elem, const CeedScalar* r_v, CeedScalar* d_v) {
+  if (data.tidx < P1d && data.tidy < P1d) {
+    const CeedInt node = data.tidx + data.tidy*P1d;
+    const CeedInt ind = node * STRIDES_NODE + elem * STRIDES_ELEM;
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      d_v[ind + comp * STRIDES_COMP] += r_v[comp];
+  }
+}
+
+//------------------------------------------------------------------------------
+// 2D tensor contraction x
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractX2d(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < Q1d && data.tidy < P1d)
+    for (CeedInt i = 0; i < P1d; ++i)
+      *V += B[i + data.tidx*P1d] * data.slice[i + data.tidy*T1d]; // Contract x direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 2D tensor contract y
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractY2d(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < Q1d && data.tidy < Q1d)
+    for (CeedInt i = 0; i < P1d; ++i)
+      *V += B[i + data.tidy*P1d] * data.slice[data.tidx + i*T1d]; // Contract y direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 2D transpose tensor contract y
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractYTranspose2d(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < Q1d && data.tidy < P1d)
+    for (CeedInt i = 0; i < Q1d; ++i)
+      *V += B[data.tidy + i*P1d] * data.slice[data.tidx + i*T1d]; // Contract y direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 2D transpose tensor contract x
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractXTranspose2d(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < P1d && data.tidy < P1d)
+    for (CeedInt i = 0; i < Q1d; ++i)
+      *V += B[data.tidx + i*P1d] * data.slice[i + data.tidy*T1d]; // Contract x direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 2D transpose tensor contract and add x
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractXTransposeAdd2d(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d] = *U;
+  __syncthreads();
+  if (data.tidx < P1d && data.tidy < P1d)
+    for (CeedInt i = 0; i < Q1d; ++i)
+      *V += B[data.tidx + i*P1d] * data.slice[i + data.tidy*T1d]; // Contract x direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 2D interpolate to quadrature points
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void interp2d(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, CeedScalar *__restrict__ r_V) {
+  CeedScalar r_t[1];
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    ContractX2d<NCOMP, P1d, Q1d>(data, r_U + comp, c_B, r_t);
+    ContractY2d<NCOMP, P1d, Q1d>(data, r_t, c_B, r_V + comp);
+  }
+}
+
+//------------------------------------------------------------------------------
+// 2D interpolate transpose
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void interpTranspose2d(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, CeedScalar *__restrict__ r_V) {
+  CeedScalar r_t[1];
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    ContractYTranspose2d<NCOMP, P1d, Q1d>(data, r_U + comp, c_B, r_t);
+    ContractXTranspose2d<NCOMP, P1d, Q1d>(data, r_t, c_B, r_V + comp);
+  }
+}
+
+//------------------------------------------------------------------------------
+// 2D derivatives at quadrature points
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void grad2d(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
+  CeedScalar r_t[1];
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    ContractX2d<NCOMP, P1d, Q1d>(data, r_U + comp, c_G, r_t);
+    ContractY2d<NCOMP, P1d, Q1d>(data, r_t, c_B, r_V + comp + 0*NCOMP);
+    ContractX2d<NCOMP, P1d, Q1d>(data, r_U + comp, c_B, r_t);
+    ContractY2d<NCOMP, P1d, Q1d>(data, r_t, c_G, r_V + comp + 1*NCOMP);
+  }
+}
+
+//------------------------------------------------------------------------------
+// 2D derivatives transpose
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void gradTranspose2d(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
+  CeedScalar r_t[1];
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    ContractYTranspose2d<NCOMP, P1d, Q1d>(data, r_U + comp + 0*NCOMP, c_B, r_t);
+    ContractXTranspose2d<NCOMP, P1d, Q1d>(data, r_t, c_G, r_V + comp);
+    ContractYTranspose2d<NCOMP, P1d, Q1d>(data, r_U + comp + 1*NCOMP, c_G, r_t);
+    ContractXTransposeAdd2d<NCOMP, P1d, Q1d>(data, r_t, c_B, r_V + comp);
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, offsets provided
+//------------------------------------------------------------------------------
+template <int NCOMP, int COMPSTRIDE, int P1d>
+inline __device__ void readDofsOffset3d(BackendData& data, const CeedInt nnodes, const CeedInt elem, const CeedInt* indices, const CeedScalar* d_u, CeedScalar* r_u) {
+  if (data.tidx < P1d && data.tidy < P1d)
+    for (CeedInt z = 0; z < P1d; ++z) {
+      const CeedInt node = data.tidx + data.tidy*P1d + z*P1d*P1d;
+      const CeedInt ind = indices[node + elem * P1d*P1d*P1d];
+      for (CeedInt comp = 0; comp < NCOMP; ++comp)
+        r_u[z+comp*P1d] = d_u[ind + COMPSTRIDE * comp];
+    }
+}
+
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, strided
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int STRIDES_NODE, int STRIDES_COMP, int STRIDES_ELEM>
+inline __device__ void readDofsStrided3d(BackendData& data, const CeedInt elem, const CeedScalar* d_u, CeedScalar* r_u) {
+  if (data.tidx < P1d && data.tidy < P1d)
+    for (CeedInt z = 0; z < P1d; ++z) {
+      const CeedInt node = data.tidx + data.tidy*P1d + z*P1d*P1d;
+      const CeedInt ind = node * STRIDES_NODE + elem * STRIDES_ELEM;
+      for (CeedInt comp = 0; comp < NCOMP; ++comp)
+        r_u[z+comp*P1d] = d_u[ind + comp * STRIDES_COMP];
+    }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> Q-vector, offests provided
+//------------------------------------------------------------------------------
+template <int NCOMP, int COMPSTRIDE, int Q1d>
+inline __device__ void readSliceQuadsOffset3d(BackendData& data, const CeedInt nquads, const CeedInt elem, const CeedInt q, const CeedInt* indices, const CeedScalar* d_u, CeedScalar* r_u) {
+  if (data.tidx < Q1d && data.tidy < Q1d) {
+    const CeedInt node = data.tidx + data.tidy*Q1d + q*Q1d*Q1d;
+    const CeedInt ind = indices[node + elem * Q1d*Q1d*Q1d];;
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      r_u[comp] = d_u[ind + COMPSTRIDE * comp];
+  }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> Q-vector, strided
+//------------------------------------------------------------------------------
+template <int NCOMP, int Q1d, int STRIDES_NODE, int STRIDES_COMP, int STRIDES_ELEM>
+inline __device__ void readSliceQuadsStrided3d(BackendData& data, const CeedInt elem, const CeedInt q, const CeedScalar* d_u, CeedScalar* r_u) {
+  if (data.tidx < Q1d && data.tidy < Q1d) {
+    const CeedInt node = data.tidx + data.tidy*Q1d + q*Q1d*Q1d;
+    const CeedInt ind = node * STRIDES_NODE + elem * STRIDES_ELEM;
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      r_u[comp] = d_u[ind + comp * STRIDES_COMP];
+  }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, offsets provided
+//------------------------------------------------------------------------------
+template <int NCOMP, int COMPSTRIDE, int P1d>
+inline __device__ void writeDofsOffset3d(BackendData& data, const CeedInt nnodes, const CeedInt elem, const CeedInt* indices, const CeedScalar* r_v, CeedScalar* d_v) {
+  if (data.tidx < P1d && data.tidy < P1d)
+    for (CeedInt z = 0; z < P1d; ++z) {
+      const CeedInt node = data.tidx + data.tidy*P1d + z*P1d*P1d;
+      const CeedInt ind = indices[node + elem * P1d*P1d*P1d];
+      for (CeedInt comp = 0; comp < NCOMP; ++comp)
+        atomicAdd(&d_v[ind + COMPSTRIDE * comp], r_v[z+comp*P1d]);
+    }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, strided
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int STRIDES_NODE, int STRIDES_COMP, int STRIDES_ELEM>
+inline __device__ void writeDofsStrided3d(BackendData& data, const CeedInt elem, const CeedScalar* r_v, CeedScalar* d_v) {
+  if (data.tidx < P1d && data.tidy < P1d)
+    for (CeedInt z = 0; z < P1d; ++z) {
+      const CeedInt node = data.tidx + data.tidy*P1d + z*P1d*P1d;
+      const CeedInt ind = node * STRIDES_NODE + elem * STRIDES_ELEM;
+      for (CeedInt comp = 0; comp < NCOMP; ++comp)
+        d_v[ind + comp * STRIDES_COMP] += r_v[z+comp*P1d];
+    }
+}
+
+//------------------------------------------------------------------------------
+// 3D tensor contract x
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractX3d(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  CeedScalar r_B[P1d];
+  for (CeedInt i = 0; i < P1d; ++i)
+    r_B[i] = B[i + data.tidx*P1d];
+
+  for (CeedInt k = 0; k < P1d; ++k) {
+    data.slice[data.tidx+data.tidy*T1d] = U[k];
+    __syncthreads();
+    V[k] = 0.0;
+    if (data.tidx < Q1d && data.tidy < P1d)
+      for (CeedInt i = 0; i < P1d; ++i)
+        V[k] += r_B[i] * data.slice[i + data.tidy*T1d]; // Contract x direction
+    __syncthreads();
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D tensor contract y
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractY3d(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  CeedScalar r_B[P1d];
+  for (CeedInt i = 0; i < P1d; ++i)
+    r_B[i] = B[i + data.tidy*P1d];
+
+  for (CeedInt k = 0; k < P1d; ++k) {
+    data.slice[data.tidx+data.tidy*T1d] = U[k];
+    __syncthreads();
+    V[k] = 0.0;
+    if (data.tidx < Q1d && data.tidy < Q1d)
+      for (CeedInt i = 0; i < P1d; ++i)
+        V[k] += r_B[i] * data.slice[data.tidx + i*T1d]; // Contract y direction
+    __syncthreads();
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D tensor contract z
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractZ3d(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  for (CeedInt k = 0; k < Q1d; ++k) {
+    V[k] = 0.0;
+    if (data.tidx < Q1d && data.tidy < Q1d)
+      for (CeedInt i = 0; i < P1d; ++i)
+        V[k] += B[i + k*P1d] * U[i]; // Contract z direction
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D transpose tensor contract z
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractTransposeZ3d(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  for (CeedInt k = 0; k < P1d; ++k) {
+    V[k] = 0.0;
+    if (data.tidx < Q1d && data.tidy < Q1d)
+      for (CeedInt i = 0; i < Q1d; ++i)
+        V[k] += B[k + i*P1d] * U[i]; // Contract z direction
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D transpose tensor contract y
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractTransposeY3d(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  CeedScalar r_B[Q1d];
+  for (CeedInt i = 0; i < Q1d; ++i)
+    r_B[i] = B[data.tidy + i*P1d];
+
+  for (CeedInt k = 0; k < P1d; ++k) {
+    data.slice[data.tidx+data.tidy*T1d] = U[k];
+    __syncthreads();
+    V[k] = 0.0;
+    if (data.tidx < Q1d && data.tidy < P1d)
+      for (CeedInt i = 0; i < Q1d; ++i)
+        V[k] += r_B[i] * data.slice[data.tidx + i*T1d]; // Contract y direction
+    __syncthreads();
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D transpose tensor contract add y
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractTransposeAddY3d(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  CeedScalar r_B[Q1d];
+  for (CeedInt i = 0; i < Q1d; ++i)
+    r_B[i] = B[data.tidy + i*P1d];
+
+  for (CeedInt k = 0; k < P1d; ++k) {
+    data.slice[data.tidx+data.tidy*T1d] = U[k];
+    __syncthreads();
+    if (data.tidx < Q1d && data.tidy < P1d)
+      for (CeedInt i = 0; i < Q1d; ++i)
+        V[k] += r_B[i] * data.slice[data.tidx + i*T1d]; // Contract y direction
+    __syncthreads();
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D transpose tensor contract x
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractTransposeX3d(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  CeedScalar r_B[Q1d];
+  for (CeedInt i = 0; i < Q1d; ++i)
+    r_B[i] = B[data.tidx + i*P1d];
+
+  for (CeedInt k = 0; k < P1d; ++k) {
+    data.slice[data.tidx+data.tidy*T1d] = U[k];
+    __syncthreads();
+    V[k] = 0.0;
+    if (data.tidx < P1d && data.tidy < P1d)
+      for (CeedInt i = 0; i < Q1d; ++i)
+        V[k] += r_B[i] * data.slice[i + data.tidy*T1d]; // Contract x direction
+    __syncthreads();
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D transpose tensor contract add x
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractTransposeAddX3d(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  CeedScalar r_B[Q1d];
+  for (CeedInt i = 0; i < Q1d; ++i)
+    r_B[i] = B[data.tidx + i*P1d];
+
+  for (CeedInt k = 0; k < P1d; ++k) {
+    data.slice[data.tidx+data.tidy*T1d] = U[k];
+    __syncthreads();
+    if (data.tidx < P1d && data.tidy < P1d)
+      for (CeedInt i = 0; i < Q1d; ++i)
+        V[k] += r_B[i] * data.slice[i + data.tidy*T1d]; // Contract x direction
+    __syncthreads();
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D interpolate to quadrature points
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void interp3d(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, CeedScalar *__restrict__ r_V) {
+  CeedScalar r_t1[P1d];
+  CeedScalar r_t2[P1d];
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    ContractX3d<NCOMP, P1d, Q1d>(data, r_U + comp*P1d, c_B, r_t1);
+    ContractY3d<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractZ3d<NCOMP, P1d, Q1d>(data, r_t2, c_B, r_V + comp*Q1d);
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D interpolate transpose
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void interpTranspose3d(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, CeedScalar *__restrict__ r_V) {
+  CeedScalar r_t1[P1d];
+  CeedScalar r_t2[P1d];
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    ContractTransposeZ3d<NCOMP, P1d, Q1d>(data, r_U + comp*Q1d, c_B, r_t1);
+    ContractTransposeY3d<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractTransposeX3d<NCOMP, P1d, Q1d>(data, r_t2, c_B, r_V + comp*P1d);
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D derivatives at quadrature points
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void grad3d(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
+  CeedScalar r_t1[P1d];
+  CeedScalar r_t2[P1d];
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    ContractX3d<NCOMP, P1d, Q1d>(data, r_U + comp*P1d, c_G, r_t1);
+    ContractY3d<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractZ3d<NCOMP, P1d, Q1d>(data, r_t2, c_B, r_V + comp*Q1d + 0*NCOMP*Q1d);
+    ContractX3d<NCOMP, P1d, Q1d>(data, r_U + comp*P1d, c_B, r_t1);
+    ContractY3d<NCOMP, P1d, Q1d>(data, r_t1, c_G, r_t2);
+    ContractZ3d<NCOMP, P1d, Q1d>(data, r_t2, c_B, r_V + comp*Q1d + 1*NCOMP*Q1d);
+    ContractX3d<NCOMP, P1d, Q1d>(data, r_U + comp*P1d, c_B, r_t1);
+    ContractY3d<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractZ3d<NCOMP, P1d, Q1d>(data, r_t2, c_G, r_V + comp*Q1d + 2*NCOMP*Q1d);
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D derivatives transpose
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void gradTranspose3d(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
+  CeedScalar r_t1[P1d];
+  CeedScalar r_t2[P1d];
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    ContractTransposeZ3d<NCOMP, P1d, Q1d>(data, r_U + comp*Q1d + 0*NCOMP*Q1d, c_B, r_t1);
+    ContractTransposeY3d<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractTransposeX3d<NCOMP, P1d, Q1d>(data, r_t2, c_G, r_V + comp*P1d);
+    ContractTransposeZ3d<NCOMP, P1d, Q1d>(data, r_U + comp*Q1d + 1*NCOMP*Q1d, c_B, r_t1);
+    ContractTransposeY3d<NCOMP, P1d, Q1d>(data, r_t1, c_G, r_t2);
+    ContractTransposeAddX3d<NCOMP,P1d, Q1d>(data, r_t2, c_B, r_V + comp*P1d);
+    ContractTransposeZ3d<NCOMP, P1d, Q1d>(data, r_U + comp*Q1d + 2*NCOMP*Q1d, c_G, r_t1);
+    ContractTransposeY3d<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractTransposeAddX3d<NCOMP, P1d, Q1d>(data, r_t2, c_B, r_V + comp*P1d);
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D collocated derivatives computation
+//------------------------------------------------------------------------------
+template <int NCOMP, int Q1d>
+inline __device__ void gradCollo3d(BackendData& data, const CeedInt q, const CeedScalar *__restrict__ r_U, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
+  if (data.tidx < Q1d && data.tidy < Q1d) {
+    for (CeedInt comp = 0; comp < NCOMP; ++comp) {
+      data.slice[data.tidx + data.tidy*T1d] = r_U[q + comp*Q1d];
+      __syncthreads();
+      // X derivative
+      r_V[comp+0*NCOMP] = 0.0;
+      for (CeedInt i = 0; i < Q1d; ++i)
+        r_V[comp+0*NCOMP] += c_G[i + data.tidx*Q1d] * data.slice[i + data.tidy*T1d]; // Contract x direction (X derivative)
+      // Y derivative
+      r_V[comp+1*NCOMP] = 0.0;
+      for (CeedInt i = 0; i < Q1d; ++i)
+        r_V[comp+1*NCOMP] += c_G[i + data.tidy*Q1d] * data.slice[data.tidx + i*T1d]; // Contract y direction (Y derivative)
+      // Z derivative
+      r_V[comp+2*NCOMP] = 0.0;
+      for (CeedInt i = 0; i < Q1d; ++i)
+        r_V[comp+2*NCOMP] += c_G[i + q*Q1d] * r_U[i + comp*Q1d]; // Contract z direction (Z derivative)
+      __syncthreads();
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D collocated derivatives transpose
+//------------------------------------------------------------------------------
+template <int NCOMP, int Q1d>
+inline __device__ void gradColloTranspose3d(BackendData& data, const CeedInt q, const CeedScalar *__restrict__ r_U, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
+  if (data.tidx < Q1d && data.tidy < Q1d) {
+    for (CeedInt comp = 0; comp < NCOMP; ++comp) {
+      // X derivative
+      data.slice[data.tidx + data.tidy*T1d] = r_U[comp + 0*NCOMP];
+      __syncthreads();
+      for (CeedInt i = 0; i < Q1d; ++i)
+        r_V[q+comp*Q1d] += c_G[data.tidx + i*Q1d] * data.slice[i + data.tidy*T1d]; // Contract x direction (X derivative)
+      __syncthreads();
+      // Y derivative
+      data.slice[data.tidx + data.tidy*T1d] = r_U[comp + 1*NCOMP];
+      __syncthreads();
+      for (CeedInt i = 0; i < Q1d; ++i)
+        r_V[q+comp*Q1d] += c_G[data.tidy + i*Q1d] * data.slice[data.tidx + i*T1d]; // Contract y direction (Y derivative)
+      __syncthreads();
+      // Z derivative
+      for (CeedInt i = 0; i < Q1d; ++i)
+        r_V[i+comp*Q1d] += c_G[i + q*Q1d] * r_U[comp + 2*NCOMP]; // PARTIAL contract z direction (Z derivative)
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D thread blocks
+//   Elements are laid out on T1d x T1d x T1d threads with data.tidz the z
+//   index, so each thread holds one node or quadrature point as in 2D
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, offsets provided
+//------------------------------------------------------------------------------
+template <int NCOMP, int COMPSTRIDE, int P1d>
+inline __device__ void readDofsOffset3dBlock(BackendData& data, const CeedInt nnodes, const CeedInt elem, const CeedInt* indices, const CeedScalar* d_u, CeedScalar* r_u) {
+  if (data.tidx < P1d && data.tidy < P1d && data.tidz < P1d) {
+    const CeedInt node = data.tidx + data.tidy*P1d + data.tidz*P1d*P1d;
+    const CeedInt ind = indices[node + elem * P1d*P1d*P1d];
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      r_u[comp] = d_u[ind + COMPSTRIDE * comp];
+  }
+}
+
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, strided
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int STRIDES_NODE, int STRIDES_COMP, int STRIDES_ELEM>
+inline __device__ void readDofsStrided3dBlock(BackendData& data, const CeedInt elem, const CeedScalar* d_u, CeedScalar* r_u) {
+  if (data.tidx < P1d && data.tidy < P1d && data.tidz < P1d) {
+    const CeedInt node = data.tidx + data.tidy*P1d + data.tidz*P1d*P1d;
+    const CeedInt ind = node * STRIDES_NODE + elem * STRIDES_ELEM;
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      r_u[comp] = d_u[ind + comp * STRIDES_COMP];
+  }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, offsets provided
+//------------------------------------------------------------------------------
+template <int NCOMP, int COMPSTRIDE, int P1d>
+inline __device__ void writeDofsOffset3dBlock(BackendData& data, const CeedInt nnodes, const CeedInt elem, const CeedInt* indices, const CeedScalar* r_v, CeedScalar* d_v) {
+  if (data.tidx < P1d && data.tidy < P1d && data.tidz < P1d) {
+    const CeedInt node = data.tidx + data.tidy*P1d + data.tidz*P1d*P1d;
+    const CeedInt ind = indices[node + elem * P1d*P1d*P1d];
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      atomicAdd(&d_v[ind + COMPSTRIDE * comp], r_v[comp]);
+  }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, strided
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int STRIDES_NODE, int STRIDES_COMP, int STRIDES_ELEM>
+inline __device__ void writeDofsStrided3dBlock(BackendData& data, const CeedInt elem, const CeedScalar* r_v, CeedScalar* d_v) {
+  if (data.tidx < P1d && data.tidy < P1d && data.tidz < P1d) {
+    const CeedInt node = data.tidx + data.tidy*P1d + data.tidz*P1d*P1d;
+    const CeedInt ind = node * STRIDES_NODE + elem * STRIDES_ELEM;
+    for (CeedInt comp = 0; comp < NCOMP; ++comp)
+      d_v[ind + comp * STRIDES_COMP] += r_v[comp];
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block tensor contract x
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractX3dBlock(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d+data.tidz*T1d*T1d] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < Q1d && data.tidy < P1d && data.tidz < P1d)
+    for (CeedInt i = 0; i < P1d; ++i)
+      *V += B[i + data.tidx*P1d] * data.slice[i + data.tidy*T1d + data.tidz*T1d*T1d]; // Contract x direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block tensor contract y
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractY3dBlock(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d+data.tidz*T1d*T1d] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < Q1d && data.tidy < Q1d && data.tidz < P1d)
+    for (CeedInt i = 0; i < P1d; ++i)
+      *V += B[i + data.tidy*P1d] * data.slice[data.tidx + i*T1d + data.tidz*T1d*T1d]; // Contract y direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block tensor contract z
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractZ3dBlock(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d+data.tidz*T1d*T1d] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < Q1d && data.tidy < Q1d && data.tidz < Q1d)
+    for (CeedInt i = 0; i < P1d; ++i)
+      *V += B[i + data.tidz*P1d] * data.slice[data.tidx + data.tidy*T1d + i*T1d*T1d]; // Contract z direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block transpose tensor contract z
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractTransposeZ3dBlock(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d+data.tidz*T1d*T1d] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < Q1d && data.tidy < Q1d && data.tidz < P1d)
+    for (CeedInt i = 0; i < Q1d; ++i)
+      *V += B[data.tidz + i*P1d] * data.slice[data.tidx + data.tidy*T1d + i*T1d*T1d]; // Contract z direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block transpose tensor contract y
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractTransposeY3dBlock(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d+data.tidz*T1d*T1d] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < Q1d && data.tidy < P1d && data.tidz < P1d)
+    for (CeedInt i = 0; i < Q1d; ++i)
+      *V += B[data.tidy + i*P1d] * data.slice[data.tidx + i*T1d + data.tidz*T1d*T1d]; // Contract y direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block transpose tensor contract x
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractTransposeX3dBlock(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d+data.tidz*T1d*T1d] = *U;
+  __syncthreads();
+  *V = 0.0;
+  if (data.tidx < P1d && data.tidy < P1d && data.tidz < P1d)
+    for (CeedInt i = 0; i < Q1d; ++i)
+      *V += B[data.tidx + i*P1d] * data.slice[i + data.tidy*T1d + data.tidz*T1d*T1d]; // Contract x direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block transpose tensor contract and add x
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void ContractTransposeAddX3dBlock(BackendData& data, const CeedScalar *U, const CeedScalar *B, CeedScalar *V) {
+  data.slice[data.tidx+data.tidy*T1d+data.tidz*T1d*T1d] = *U;
+  __syncthreads();
+  if (data.tidx < P1d && data.tidy < P1d && data.tidz < P1d)
+    for (CeedInt i = 0; i < Q1d; ++i)
+      *V += B[data.tidx + i*P1d] * data.slice[i + data.tidy*T1d + data.tidz*T1d*T1d]; // Contract x direction
+  __syncthreads();
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block interpolate to quadrature points
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void interp3dBlock(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, CeedScalar *__restrict__ r_V) {
+  CeedScalar r_t1[1];
+  CeedScalar r_t2[1];
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    ContractX3dBlock<NCOMP, P1d, Q1d>(data, r_U + comp, c_B, r_t1);
+    ContractY3dBlock<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractZ3dBlock<NCOMP, P1d, Q1d>(data, r_t2, c_B, r_V + comp);
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block interpolate transpose
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void interpTranspose3dBlock(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, CeedScalar *__restrict__ r_V) {
+  CeedScalar r_t1[1];
+  CeedScalar r_t2[1];
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    ContractTransposeZ3dBlock<NCOMP, P1d, Q1d>(data, r_U + comp, c_B, r_t1);
+    ContractTransposeY3dBlock<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractTransposeX3dBlock<NCOMP, P1d, Q1d>(data, r_t2, c_B, r_V + comp);
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block derivatives at quadrature points
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void grad3dBlock(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
+  CeedScalar r_t1[1];
+  CeedScalar r_t2[1];
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    ContractX3dBlock<NCOMP, P1d, Q1d>(data, r_U + comp, c_G, r_t1);
+    ContractY3dBlock<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractZ3dBlock<NCOMP, P1d, Q1d>(data, r_t2, c_B, r_V + comp + 0*NCOMP);
+    ContractX3dBlock<NCOMP, P1d, Q1d>(data, r_U + comp, c_B, r_t1);
+    ContractY3dBlock<NCOMP, P1d, Q1d>(data, r_t1, c_G, r_t2);
+    ContractZ3dBlock<NCOMP, P1d, Q1d>(data, r_t2, c_B, r_V + comp + 1*NCOMP);
+    ContractX3dBlock<NCOMP, P1d, Q1d>(data, r_U + comp, c_B, r_t1);
+    ContractY3dBlock<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractZ3dBlock<NCOMP, P1d, Q1d>(data, r_t2, c_G, r_V + comp + 2*NCOMP);
+  }
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block derivatives transpose
+//------------------------------------------------------------------------------
+template <int NCOMP, int P1d, int Q1d>
+inline __device__ void gradTranspose3dBlock(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_B, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
+  CeedScalar r_t1[1];
+  CeedScalar r_t2[1];
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    ContractTransposeZ3dBlock<NCOMP, P1d, Q1d>(data, r_U + comp + 0*NCOMP, c_B, r_t1);
+    ContractTransposeY3dBlock<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractTransposeX3dBlock<NCOMP, P1d, Q1d>(data, r_t2, c_G, r_V + comp);
+    ContractTransposeZ3dBlock<NCOMP, P1d, Q1d>(data, r_U + comp + 1*NCOMP, c_B, r_t1);
+    ContractTransposeY3dBlock<NCOMP, P1d, Q1d>(data, r_t1, c_G, r_t2);
+    ContractTransposeAddX3dBlock<NCOMP, P1d, Q1d>(data, r_t2, c_B, r_V + comp);
+    ContractTransposeZ3dBlock<NCOMP, P1d, Q1d>(data, r_U + comp + 2*NCOMP, c_G, r_t1);
+    ContractTransposeY3dBlock<NCOMP, P1d, Q1d>(data, r_t1, c_B, r_t2);
+    ContractTransposeAddX3dBlock<NCOMP, P1d, Q1d>(data, r_t2, c_B, r_V + comp);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Non-tensor
+//   Elements use the 1D thread layout, one thread per node or quadrature
+//   point, so restrictions, interpolation, and weights use the 1D functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Non-tensor derivatives at quadrature points
+//------------------------------------------------------------------------------
+template <int NCOMP, int DIM, int P, int Q>
+inline __device__ void gradNonTensor(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    data.slice[data.tidx] = r_U[comp];
+    __syncthreads();
+    for (CeedInt d = 0; d < DIM; d++) {
+      r_V[comp + d*NCOMP] = 0.0;
+      if (data.tidx < Q)
+        for (CeedInt i = 0; i < P; ++i)
+          r_V[comp + d*NCOMP] += c_G[i + data.tidx*P + d*P*Q] * data.slice[i];
+    }
+    __syncthreads();
+  }
+}
+
+//------------------------------------------------------------------------------
+// Non-tensor derivatives transpose
+//------------------------------------------------------------------------------
+template <int NCOMP, int DIM, int P, int Q>
+inline __device__ void gradTransposeNonTensor(BackendData& data, const CeedScalar *__restrict__ r_U, const CeedScalar *c_G, CeedScalar *__restrict__ r_V) {
+  for (CeedInt comp = 0; comp < NCOMP; comp++) {
+    r_V[comp] = 0.0;
+    for (CeedInt d = 0; d < DIM; d++) {
+      data.slice[data.tidx] = r_U[comp + d*NCOMP];
+      __syncthreads();
+      if (data.tidx < P)
+        for (CeedInt i = 0; i < Q; ++i)
+          r_V[comp] += c_G[data.tidx + i*P + d*P*Q] * data.slice[i];
+      __syncthreads();
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// 1D quadrature weights
+//------------------------------------------------------------------------------
+template <int Q1d>
+inline __device__ void weight1d(BackendData& data, const CeedScalar *qweight1d, CeedScalar *w) {
+  *w = (data.tidx < Q1d) ? qweight1d[data.tidx] : 0.0;
+}
+
+//------------------------------------------------------------------------------
+// 2D quadrature weights
+//------------------------------------------------------------------------------
+template <int Q1d>
+inline __device__ void weight2d(BackendData& data, const CeedScalar *qweight1d, CeedScalar *w) {
+  *w = (data.tidx < Q1d && data.tidy < Q1d) ?
+        qweight1d[data.tidx]*qweight1d[data.tidy] : 0.0;
+}
+
+//------------------------------------------------------------------------------
+// 3D quadrature weights
+//------------------------------------------------------------------------------
+template <int Q1d>
+inline __device__ void weight3d(BackendData& data, const CeedScalar *qweight1d, CeedScalar *w) {
+  const bool quad = (data.tidx < Q1d && data.tidy < Q1d);
+  const CeedScalar pw = quad ? qweight1d[data.tidx]*qweight1d[data.tidy] : 0.0;
+  for (CeedInt z = 0; z < Q1d; ++z)
+    w[z] = quad ? pw*qweight1d[z] : 0.0;
+}
+
+//------------------------------------------------------------------------------
+// 3D thread block quadrature weights
+//------------------------------------------------------------------------------
+template <int Q1d>
+inline __device__ void weight3dBlock(BackendData& data, const CeedScalar *qweight1d, CeedScalar *w) {
+  *w = (data.tidx < Q1d && data.tidy < Q1d && data.tidz < Q1d) ?
+        qweight1d[data.tidx]*qweight1d[data.tidy]*qweight1d[data.tidz] : 0.0;
+}
+
+);
+
+//------------------------------------------------------------------------------
+// Generate operator kernel
+//   With block3d, 3D elements use the 3D thread block functions
+//------------------------------------------------------------------------------
+static int CeedHipGenOperatorBuildKernel(CeedOperator op,
+    std::ostringstream &code, const std::string &oper, const CeedInt dim,
+    const CeedInt Q1d, bool useCollograd, const bool nonTensor,
+    const bool devicetables, const bool block3d) {
+  using std::string;
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Hip_gen *data;
+  ierr = CeedOperatorGetData(op, &data); CeedChk(ierr);
+  CeedQFunction qf;
+  CeedQFunction_Hip_gen *qf_data;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  ierr = CeedQFunctionGetData(qf, &qf_data); CeedChk(ierr);
+  CeedInt P1d, elemsize, numinputfields, numoutputfields, ncomp, lsize;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+  CeedQFunctionField *qfinputfields, *qfoutputfields;
+  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
+  CeedChk(ierr);
+  CeedEvalMode emode;
+  CeedBasis basis;
+  CeedBasis_Hip_shared *basis_data;
+  CeedBasisNonTensor_Hip *nontensor_data;
+  CeedElemRestriction Erestrict;
+  CeedElemRestriction_Hip *restr_data;
+  string qFunctionName(qf_data->qFunctionName);
+
+  // Non-tensor elements are laid out on threads like 1D elements, and 3D
+  //   thread blocks hold one point per thread, without collocated gradients
+  const string dimname = block3d ? "3dBlock" :
+                         std::to_string(nonTensor ? 1 : dim) + "d";
+  if (block3d) useCollograd = false;
+
+  if (!devicetables) {
+    code << "\nextern \"C\" __global__ void CEED_LAUNCH_BOUNDS "<<oper<<"(CeedInt nelem, void* ctx, HipFieldsInt indices, HipFields fields, HipFields B, HipFields G, CeedScalar* W) {\n";
+  } else {
+    // Field tables in device memory
+    code << "\nextern \"C\" __global__ void CEED_LAUNCH_BOUNDS "<<oper<<"(CeedInt nelem, void* ctx, const HipFieldsInt *__restrict__ d_indices, const HipFields *__restrict__ d_fields, const HipFields *__restrict__ d_B, const HipFields *__restrict__ d_G, CeedScalar* W) {\n";
+    code << "  const HipFieldsInt &indices = *d_indices;\n";
+    code << "  const HipFields &fields = *d_fields, &B = *d_B, &G = *d_G;\n";
+  }
+  for (CeedInt i = 0; i < numinputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    if (emode != CEED_EVAL_WEIGHT) { // Skip CEED_EVAL_WEIGHT
+      code << "  const CeedScalar* d_u" <<i<<" = fields.in["<<i<<"];\n";
+    }
+  }
+
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    code << "  CeedScalar* d_v"<<i<<" = fields.out["<<i<<"];\n";
+  }
+
+  code << "  const CeedInt Dim = "<<dim<<";\n";
+  code << "  const CeedInt Q1d = "<<Q1d<<";\n";
+
+  code << "  extern __shared__ CeedScalar slice[];\n";
+  code << "  BackendData data;\n";
+  code << "  data.tidx = threadIdx.x;\n";
+  code << "  data.tidy = threadIdx.y;\n";
+  if (block3d) {
+    // Elements are stacked in z, T1d threads each
+    code << "  data.tidz = threadIdx.z%T1d;\n";
+    code << "  data.tid  = threadIdx.x + threadIdx.y*blockDim.x + threadIdx.z*blockDim.y*blockDim.x;\n";
+    code << "  data.slice = slice+(threadIdx.z/T1d)*T1d*T1d*T1d;\n";
+  } else {
+    code << "  data.tidz = threadIdx.z;\n";
+    code << "  data.tid  = threadIdx.x + threadIdx.y*blockDim.x + threadIdx.z*blockDim.y*blockDim.x;\n";
+    code << "  data.slice = slice+data.tidz*T1d"<<(dim>1 && !nonTensor?"*T1d":"")<<";\n";
+  }
+
+  code << "\n  // -- Input field constants and basis data --\n";
+  //Initialize constants, and matrices B and G
+  for (CeedInt i = 0; i < numinputfields; i++) {
+    code << "  // ---- Input field "<<i<<" ----\n";
+    // Get elemsize, emode, ncomp
+    ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
+    CeedChk(ierr);
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(Erestrict, &ncomp);
+    CeedChk(ierr);
+
+    // Set field constants
+    if (emode != CEED_EVAL_WEIGHT) {
+      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
+      if (basis != CEED_BASIS_COLLOCATED) {
+        if (nonTensor) {
+          ierr = CeedBasisGetNumNodes(basis, &P1d); CeedChk(ierr);
+        } else {
+          ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+        }
+        code << "  const CeedInt P_in_"<<i<<" = "<<P1d<<";\n";
+      } else {
+        code << "  const CeedInt P_in_"<<i<<" = "<<Q1d<<";\n";
+      }
+      code << "  const CeedInt ncomp_in_"<<i<<" = "<<ncomp<<";\n";
+    }
+
+    // Load basis data
+    code << "  // EvalMode: "<<CeedEvalModes[emode]<<"\n";
+    switch (emode) {
+    case CEED_EVAL_NONE:
+      break;
+    case CEED_EVAL_INTERP:
+      if (nonTensor) {
+        ierr = CeedBasisGetData(basis, &nontensor_data); CeedChk(ierr);
+        data->B.in[i] = nontensor_data->d_interp;
+      } else {
+        ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
+        data->B.in[i] = basis_data->d_interp1d;
+      }
+      code << "  __shared__ CeedScalar s_B_in_"<<i<<"["<<P1d*Q1d<<"];\n";
+      code << "  loadMatrix<P_in_"<<i<<",Q1d>(data, B.in["<<i<<"], s_B_in_"<<i<<");\n";
+      break;
+    case CEED_EVAL_GRAD:
+      if (nonTensor) {
+        ierr = CeedBasisGetData(basis, &nontensor_data); CeedChk(ierr);
+        data->G.in[i] = nontensor_data->d_grad;
+        code << "  __shared__ CeedScalar s_G_in_"<<i<<"["<<dim*P1d*Q1d<<"];\n";
+        code << "  loadMatrix<P_in_"<<i<<"*Dim,Q1d>(data, G.in["<<i<<"], s_G_in_"<<i<<");\n";
+        break;
+      }
+      ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
+      data->B.in[i] = basis_data->d_interp1d;
+      code << "  __shared__ CeedScalar s_B_in_"<<i<<"["<<P1d*Q1d<<"];\n";
+      code << "  loadMatrix<P_in_"<<i<<",Q1d>(data, B.in["<<i<<"], s_B_in_"<<i<<");\n";
+      if (useCollograd) {
+        data->G.in[i] = basis_data->d_collograd1d;
+        code << "  __shared__ CeedScalar s_G_in_"<<i<<"["<<Q1d*Q1d<<"];\n";
+        code << "  loadMatrix<Q1d,Q1d>(data, G.in["<<i<<"], s_G_in_"<<i<<");\n";
+      } else {
+        data->G.in[i] = basis_data->d_grad1d;
+        code << "  __shared__ CeedScalar s_G_in_"<<i<<"["<<P1d*Q1d<<"];\n";
+        code << "  loadMatrix<P_in_"<<i<<",Q1d>(data, G.in["<<i<<"], s_G_in_"<<i<<");\n";
+      }
+      break;
+    case CEED_EVAL_WEIGHT:
+      break; // No action
+    case CEED_EVAL_DIV:
+      break; // TODO: Not implemented
+    case CEED_EVAL_CURL:
+      break; // TODO: Not implemented
+    }
+  }
+
+  code << "\n  // -- Output field constants and basis data --\n";
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    code << "  // ---- Output field "<<i<<" ----\n";
+    // Get elemsize, emode, ncomp
+    ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[i], &Erestrict);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
+    CeedChk(ierr);
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(Erestrict, &ncomp);
+    CeedChk(ierr);
+
+    // Set field constants
+    ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis); CeedChk(ierr);
+    if (basis != CEED_BASIS_COLLOCATED) {
+      if (nonTensor) {
+        ierr = CeedBasisGetNumNodes(basis, &P1d); CeedChk(ierr);
+      } else {
+        ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+      }
+      code << "  const CeedInt P_out_"<<i<<" = "<<P1d<<";\n";
+    } else {
+      code << "  const CeedInt P_out_"<<i<<" = "<<Q1d<<";\n";
+    }
+    code << "  const CeedInt ncomp_out_"<<i<<" = "<<ncomp<<";\n";
+
+    // Load basis data
+    code << "  // EvalMode: "<<CeedEvalModes[emode]<<"\n";
+    switch (emode) {
+    case CEED_EVAL_NONE:
+      break; // No action
+    case CEED_EVAL_INTERP:
+      if (nonTensor) {
+        ierr = CeedBasisGetData(basis, &nontensor_data); CeedChk(ierr);
+        data->B.out[i] = nontensor_data->d_interp;
+      } else {
+        ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
+        data->B.out[i] = basis_data->d_interp1d;
+      }
+      code << "  __shared__ CeedScalar s_B_out_"<<i<<"["<<P1d*Q1d<<"];\n";
+      code << "  loadMatrix<P_out_"<<i<<",Q1d>(data, B.out["<<i<<"], s_B_out_"<<i<<");\n";
+      break;
+    case CEED_EVAL_GRAD:
+      if (nonTensor) {
+        ierr = CeedBasisGetData(basis, &nontensor_data); CeedChk(ierr);
+        data->G.out[i] = nontensor_data->d_grad;
+        code << "  __shared__ CeedScalar s_G_out_"<<i<<"["<<dim*P1d*Q1d<<"];\n";
+        code << "  loadMatrix<P_out_"<<i<<"*Dim,Q1d>(data, G.out["<<i<<"], s_G_out_"<<i<<");\n";
+        break;
+      }
+      ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
+      data->B.out[i] = basis_data->d_interp1d;
+      code << "  __shared__ CeedScalar s_B_out_"<<i<<"["<<P1d*Q1d<<"];\n";
+      code << "  loadMatrix<P_out_"<<i<<",Q1d>(data, B.out["<<i<<"], s_B_out_"<<i<<");\n";
+      if (useCollograd) {
+        data->G.out[i] = basis_data->d_collograd1d;
+        code << "  __shared__ CeedScalar s_G_out_"<<i<<"["<<Q1d*Q1d<<"];\n";
+        code << "  loadMatrix<Q1d,Q1d>(data, G.out["<<i<<"], s_G_out_"<<i<<");\n";
+      } else {
+        data->G.out[i] = basis_data->d_grad1d;
+        code << "  __shared__ CeedScalar s_G_out_"<<i<<"["<<P1d*Q1d<<"];\n";
+        code << "  loadMatrix<P_out_"<<i<<",Q1d>(data, G.out["<<i<<"], s_G_out_"<<i<<");\n";
+      }
+      break;
+    // LCOV_EXCL_START
+    case CEED_EVAL_WEIGHT: {
+      Ceed ceed;
+      ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+      return CeedError(ceed, 1,
+                       "CEED_EVAL_WEIGHT cannot be an output evaluation mode");
+      break; // Should not occur
+    }
+    case CEED_EVAL_DIV:
+      break; // TODO: Not implemented
+    case CEED_EVAL_CURL:
+      break; // TODO: Not implemented
+      // LCOV_EXCL_STOP
+    }
+  }
+  code << "\n  // -- Element loop --\n";
+  code << "  __syncthreads();\n";
+  if (block3d) {
+    code << "  for (CeedInt elem = blockIdx.x*(blockDim.z/T1d) + threadIdx.z/T1d; elem < nelem; elem += gridDim.x*(blockDim.z/T1d)) {\n";
+  } else {
+    code << "  for (CeedInt elem = blockIdx.x*blockDim.z + threadIdx.z; elem < nelem; elem += gridDim.x*blockDim.z) {\n";
+  }
+  // Input basis apply if needed
+  // Generate the correct eval mode code for each input
+  code << "    // -- Input field restrictions and basis actions --\n";
+  for (CeedInt i = 0; i < numinputfields; i++) {
+    code << "    // ---- Input field "<<i<<" ----\n";
+    // Get elemsize, emode, ncomp
+    ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
+    CeedChk(ierr);
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(Erestrict, &ncomp);
+    CeedChk(ierr);
+
+    // Restriction
+    if (emode != CEED_EVAL_WEIGHT &&
+        !((emode == CEED_EVAL_NONE) && useCollograd)) {
+      code << "    CeedScalar r_u"<<i<<"[ncomp_in_"<<i<<"*P_in_"<<i<<"];\n";
+      
+      bool isStrided;
+      ierr = CeedElemRestrictionIsStrided(Erestrict, &isStrided); CeedChk(ierr);
+      if (!isStrided) {
+        ierr = CeedElemRestrictionGetLVectorSize(Erestrict, &lsize);
+        CeedChk(ierr);
+        code << "    const CeedInt lsize_in_"<<i<<" = "<<lsize<<";\n";
+        CeedInt compstride;
+        ierr = CeedElemRestrictionGetCompStride(Erestrict, &compstride); CeedChk(ierr);
+        code << "    // CompStride: "<<compstride<<"\n";
+        ierr = CeedElemRestrictionGetData(Erestrict, &restr_data); CeedChk(ierr);
+        data->indices.in[i] = restr_data->d_ind;
+        code << "    readDofsOffset"<<dimname<<"<ncomp_in_"<<i<<", "<<compstride<<", P_in_"<<i<<">(data, lsize_in_"<<i<<", elem, indices.in["<<i<<"], d_u"<<i<<", r_u"<<i<<");\n";
+      } else {
+        bool backendstrides;
+        ierr = CeedElemRestrictionHasBackendStrides(Erestrict, &backendstrides);
+        CeedChk(ierr);
+        CeedInt nelem;
+        ierr = CeedElemRestrictionGetNumElements(Erestrict, &nelem);
+        CeedChk(ierr);
+        CeedInt strides[3] = {1, elemsize*nelem, elemsize};
+        if (!backendstrides) {
+          ierr = CeedElemRestrictionGetStrides(Erestrict, &strides);
+          CeedChk(ierr);
+        }
+        code << "    // Strides: {"<<strides[0]<<", "<<strides[1]<<", "<<strides[2]<<"}\n";
+        code << "    readDofsStrided"<<dimname<<"<ncomp_in_"<<i<<",P_in_"<<i<<","<<strides[0]<<","<<strides[1]<<","<<strides[2]<<">(data, elem, d_u"<<i<<", r_u"<<i<<");\n";
+      }
+    }
+
+    // Basis action
+    code << "    // EvalMode: "<<CeedEvalModes[emode]<<"\n";
+    switch (emode) {
+    case CEED_EVAL_NONE:
+      if (!useCollograd) {
+        code << "    CeedScalar* r_t"<<i<<" = r_u"<<i<<";\n";
+      }
+      break;
+    case CEED_EVAL_INTERP:
+      code << "    CeedScalar r_t"<<i<<"[ncomp_in_"<<i<<"*Q1d];\n";
+      code << "    interp"<<dimname<<"<ncomp_in_"<<i<<",P_in_"<<i<<",Q1d>(data, r_u"<<i<<", s_B_in_"<<i<<", r_t"<<i<<");\n";
+      break;
+    case CEED_EVAL_GRAD:
+      if (useCollograd) {
+        code << "    CeedScalar r_t"<<i<<"[ncomp_in_"<<i<<"*Q1d];\n";
+        code << "    interp"<<dimname<<"<ncomp_in_"<<i<<",P_in_"<<i<<",Q1d>(data, r_u"<<i<<", s_B_in_"<<i<<", r_t"<<i<<");\n";
+      } else if (nonTensor) {
+        code << "    CeedScalar r_t"<<i<<"[ncomp_in_"<<i<<"*Dim];\n";
+        code << "    gradNonTensor<ncomp_in_"<<i<<",Dim,P_in_"<<i<<",Q1d>(data, r_u"<<i<<", s_G_in_"<<i<<", r_t"<<i<<");\n";
+      } else {
+        code << "    CeedScalar r_t"<<i<<"[ncomp_in_"<<i<<"*Dim*Q1d];\n";
+        code << "    grad"<<dimname<<"<ncomp_in_"<<i<<",P_in_"<<i<<",Q1d>(data, r_u"<<i<<", s_B_in_"<<i<<", s_G_in_"<<i<<", r_t"<<i<<");\n";
+      }
+      break;
+    case CEED_EVAL_WEIGHT:
+      code << "    CeedScalar r_t"<<i<<"[Q1d];\n";
+      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
+      if (nonTensor) {
+        ierr = CeedBasisGetData(basis, &nontensor_data); CeedChk(ierr);
+        data->W = nontensor_data->d_qweight;
+      } else {
+        ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
+        data->W = basis_data->d_qweight1d;
+      }
+      code << "    weight"<<dimname<<"<Q1d>(data, W, r_t"<<i<<");\n";
+      break; // No action
+    case CEED_EVAL_DIV:
+      break; // TODO: Not implemented
+    case CEED_EVAL_CURL:
+      break; // TODO: Not implemented
+    }
+  }
+
+  // Q function
+  code << "\n    // -- Output field setup --\n";
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+      code << "\n    // ---- Output field "<<i<<" ----\n";
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    if (emode==CEED_EVAL_GRAD)
+    {
+      if (useCollograd) {
+        //Accumulator for gradient slices
+        code << "    CeedScalar r_tt"<<i<<"[ncomp_out_"<<i<<"*Q1d];\n";
+        code << "    for (CeedInt i = 0; i < ncomp_out_"<<i<<"; ++i) {\n";
+        code << "      for (CeedInt j = 0; j < Q1d; ++j) {\n";
+        code << "        r_tt"<<i<<"[j + i*Q1d] = 0.0;\n";
+        code << "      }\n";
+        code << "    }\n";
+      } else if (nonTensor) {
+        code << "    CeedScalar r_tt"<<i<<"[ncomp_out_"<<i<<"*Dim];\n";
+      } else {
+        code << "    CeedScalar r_tt"<<i<<"[ncomp_out_"<<i<<"*Dim*Q1d];\n";
+      }
+    }
+    if (emode==CEED_EVAL_NONE || emode==CEED_EVAL_INTERP)
+    {
+      code << "    CeedScalar r_tt"<<i<<"[ncomp_out_"<<i<<"*Q1d];\n";
+    }
+  }
+  // We treat quadrature points per slice in 3d to save registers
+  if (useCollograd) {
+    code << "\n    // Note: Collocated Gradient\n";
+    code << "#pragma unroll\n";
+    code << "    for (CeedInt q=0; q<Q1d; q++) {\n";
+    code << "      // -- Input fields --\n";
+    for (CeedInt i = 0; i < numinputfields; i++) {
+      code << "      // ---- Input field "<<i<<" ----\n";
+      // Get elemsize, emode, ncomp
+      ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+      CeedChk(ierr);
+      // Basis action
+      code << "      // EvalMode: "<<CeedEvalModes[emode]<<"\n";
+      switch (emode) {
+      case CEED_EVAL_NONE:
+        code << "      CeedScalar r_q"<<i<<"[ncomp_in_"<<i<<"];\n";
+
+        bool isStrided;
+        ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict); CeedChk(ierr);
+        ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize); CeedChk(ierr);
+        ierr = CeedElemRestrictionIsStrided(Erestrict, &isStrided); CeedChk(ierr);
+        if (!isStrided) {
+          ierr = CeedElemRestrictionGetLVectorSize(Erestrict, &lsize);
+          CeedChk(ierr);
+          code << "      const CeedInt lsize_in_"<<i<<" = "<<lsize<<";\n";
+          CeedInt compstride;
+          ierr = CeedElemRestrictionGetCompStride(Erestrict, &compstride); CeedChk(ierr);
+          code << "      // CompStride: "<<compstride<<"\n";
+          ierr = CeedElemRestrictionGetData(Erestrict, &restr_data); CeedChk(ierr);
+          data->indices.in[i] = restr_data->d_ind;
+          code << "      readSliceQuadsOffset"<<"3d<ncomp_in_"<<i<<", "<<compstride<<", Q1d>(data, lsize_in_"<<i<<", elem, q, indices.in["<<i<<"], d_u"<<i<<", r_q"<<i<<");\n";
+        } else {
+          bool backendstrides;
+          ierr = CeedElemRestrictionHasBackendStrides(Erestrict, &backendstrides);
+          CeedChk(ierr);
+          CeedInt nelem;
+          ierr = CeedElemRestrictionGetNumElements(Erestrict, &nelem);
+          CeedChk(ierr);
+          CeedInt strides[3] = {1, elemsize*nelem, elemsize};
+          if (!backendstrides) {
+            ierr = CeedElemRestrictionGetStrides(Erestrict, &strides);
+            CeedChk(ierr);
+          }
+          code << "      // Strides: {"<<strides[0]<<", "<<strides[1]<<", "<<strides[2]<<"}\n";
+          code << "      readSliceQuadsStrided"<<"3d<ncomp_in_"<<i<<",Q1d"","<<strides[0]<<","<<strides[1]<<","<<strides[2]<<">(data, elem, q, d_u"<<i<<", r_q"<<i<<");\n";
+        }
+        break;
+      case CEED_EVAL_INTERP:
+        code << "      CeedScalar r_q"<<i<<"[ncomp_in_"<<i<<"];\n";
+        code << "      for (CeedInt j = 0; j < ncomp_in_"<<i<<" ; ++j) {\n";
+        code << "        r_q"<<i<<"[j] = r_t"<<i<<"[q + j*Q1d];\n";
+        code << "      }\n";
+        break;
+      case CEED_EVAL_GRAD:
+        code << "      CeedScalar r_q"<<i<<"[ncomp_in_"<<i<<"*Dim];\n";
+        code << "      gradCollo3d<ncomp_in_"<<i<<",Q1d>(data, q, r_t"<<i<<", s_G_in_"<<i<<", r_q"<<i<<");\n";
+        break;
+      case CEED_EVAL_WEIGHT:
+        code << "      CeedScalar r_q"<<i<<"[1];\n";
+        code << "      r_q"<<i<<"[0] = r_t"<<i<<"[q];\n";
+        break; // No action
+      case CEED_EVAL_DIV:
+        break; // TODO: Not implemented
+      case CEED_EVAL_CURL:
+        break; // TODO: Not implemented
+      }
+    }
+    code << "\n      // -- Output fields --\n";
+    for (CeedInt i = 0; i < numoutputfields; i++) {
+      code << "      // ---- Output field "<<i<<" ----\n";
+      ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+      CeedChk(ierr);
+      // Basis action
+      switch (emode) {
+      case CEED_EVAL_NONE:
+        code << "      CeedScalar r_qq"<<i<<"[ncomp_out_"<<i<<"];\n";
+        break; // No action
+      case CEED_EVAL_INTERP:
+        code << "      CeedScalar r_qq"<<i<<"[ncomp_out_"<<i<<"];\n";
+        break;
+      case CEED_EVAL_GRAD:
+        code << "      CeedScalar r_qq"<<i<<"[ncomp_out_"<<i<<"*Dim];\n";
+        break;
+      case CEED_EVAL_WEIGHT:
+        break; // Should not occur
+      case CEED_EVAL_DIV:
+        break; // TODO: Not implemented
+      case CEED_EVAL_CURL:
+        break; // TODO: Not implemented
+      }
+    }
+  } else {
+    code << "\n      // Note: No Collocated Gradient\n";
+    code << "      // -- Input fields --\n";
+    for (CeedInt i = 0; i < numinputfields; i++) {
+      code << "      // ---- Input field "<<i<<" ----\n";
+      code << "      CeedScalar* r_q"<<i<<" = r_t"<<i<<";\n";
+    }
+    code << "      // -- Output fields --\n";
+    for (CeedInt i = 0; i < numoutputfields; i++) {
+      code << "      // ---- Output field "<<i<<" ----\n";
+      code << "      CeedScalar* r_qq"<<i<<" = r_tt"<<i<<";\n";
+    }
+  }
+  code << "\n      // -- QFunction Inputs and outputs --\n";
+  code << "      CeedScalar* in["<<numinputfields<<"];\n";
+  for (CeedInt i = 0; i < numinputfields; i++) {
+    code << "      // ---- Input field "<<i<<" ----\n";
+    code << "      in["<<i<<"] = r_q"<<i<<";\n";
+  }
+  code << "      CeedScalar* out["<<numoutputfields<<"];\n";
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    code << "      // ---- Output field "<<i<<" ----\n";
+    code << "      out["<<i<<"] = r_qq"<<i<<";\n";
+  }
+  code << "\n      // -- Apply QFunction --\n";
+  code << "      "<<qFunctionName<<"(ctx, ";
+  if (dim != 3 || useCollograd || nonTensor || block3d) {
+    code << "1";
+  } else {
+    code << "Q1d";
+  }
+  code << ", in, out);\n";
+  if (useCollograd) {
+    code << "\n      // Note: Collocated Gradient\n";
+    code << "      // -- Output fields --\n";
+    for (CeedInt i = 0; i < numoutputfields; i++) {
+      code << "      // ---- Output field "<<i<<" ----\n";
+      ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+      CeedChk(ierr);
+      // Basis action
+      code << "      // EvalMode: "<<CeedEvalModes[emode]<<"\n";
+      switch (emode) {
+      case CEED_EVAL_NONE:
+        code << "      for (CeedInt j = 0; j < ncomp_out_"<<i<<" ; ++j) {\n";
+        code << "        r_tt"<<i<<"[q + j*Q1d] = r_qq"<<i<<"[j];\n";
+        code << "      }\n";
+        break; // No action
+      case CEED_EVAL_INTERP:
+        code << "      for (CeedInt j = 0; j < ncomp_out_"<<i<<" ; ++j) {\n";
+        code << "        r_tt"<<i<<"[q + j*Q1d] = r_qq"<<i<<"[j];\n";
+        code << "      }\n";
+        break;
+      case CEED_EVAL_GRAD:
+        code << "      gradColloTranspose3d<ncomp_out_"<<i<<",Q1d>(data, q, r_qq"<<i<<", s_G_out_"<<i<<", r_tt"<<i<<");\n";
+        break;
+      case CEED_EVAL_WEIGHT:
+        break; // Should not occur
+      case CEED_EVAL_DIV:
+        break; // TODO: Not implemented
+      case CEED_EVAL_CURL:
+        break; // TODO: Not implemented
+      }
+    }
+    code << "    }\n";
+  }
+
+  // Output basis apply if needed
+  // Generate the correct eval mode code for each output
+  code << "\n    // -- Output field basis action and restrictions --\n";
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    code << "    // ---- Output field "<<i<<" ----\n";
+    // Get elemsize, emode, ncomp
+    ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[i], &Erestrict);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
+    CeedChk(ierr);
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(Erestrict, &ncomp);
+    CeedChk(ierr);
+    // Basis action
+    code << "    // EvalMode: "<<CeedEvalModes[emode]<<"\n";
+    switch (emode) {
+    case CEED_EVAL_NONE:
+      code << "    CeedScalar* r_v"<<i<<" = r_tt"<<i<<";\n";
+      break; // No action
+    case CEED_EVAL_INTERP:
+      code << "    CeedScalar r_v"<<i<<"[ncomp_out_"<<i<<"*P_out_"<<i<<"];\n";
+      code << "    interpTranspose"<<dimname<<"<ncomp_out_"<<i<<",P_out_"<<i<<",Q1d>(data, r_tt"<<i<<", s_B_out_"<<i<<", r_v"<<i<<");\n";
+      break;
+    case CEED_EVAL_GRAD:
+      code << "    CeedScalar r_v"<<i<<"[ncomp_out_"<<i<<"*P_out_"<<i<<"];\n";
+      if (useCollograd) {
+        code << "    interpTranspose"<<dimname<<"<ncomp_out_"<<i<<",P_out_"<<i<<",Q1d>(data, r_tt"<<i<<", s_B_out_"<<i<<", r_v"<<i<<");\n";
+      } else if (nonTensor) {
+        code << "    gradTransposeNonTensor<ncomp_out_"<<i<<",Dim,P_out_"<<i<<",Q1d>(data, r_tt"<<i<<", s_G_out_"<<i<<", r_v"<<i<<");\n";
+      } else {
+        code << "    gradTranspose"<<dimname<<"<ncomp_out_"<<i<<",P_out_"<<i<<",Q1d>(data, r_tt"<<i<<", s_B_out_"<<i<<", s_G_out_"<<i<<", r_v"<<i<<");\n";
+      }
+      break;
+    // LCOV_EXCL_START
+    case CEED_EVAL_WEIGHT: {
+      Ceed ceed;
+      ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+      return CeedError(ceed, 1,
+                       "CEED_EVAL_WEIGHT cannot be an output evaluation mode");
+      break; // Should not occur
+    }
+    case CEED_EVAL_DIV:
+      break; // TODO: Not implemented
+    case CEED_EVAL_CURL:
+      break; // TODO: Not implemented
+      // LCOV_EXCL_STOP
+    }
+    // Restriction
+      bool isStrided;
+      ierr = CeedElemRestrictionIsStrided(Erestrict, &isStrided); CeedChk(ierr);
+    if (!isStrided) {
+      ierr = CeedElemRestrictionGetLVectorSize(Erestrict, &lsize);
+      CeedChk(ierr);
+      code << "    const CeedInt lsize_out_"<<i<<" = "<<lsize<<";\n";
+      CeedInt compstride;
+      ierr = CeedElemRestrictionGetCompStride(Erestrict, &compstride); CeedChk(ierr);
+      code << "    // CompStride: "<<compstride<<"\n";
+      ierr = CeedElemRestrictionGetData(Erestrict, &restr_data); CeedChk(ierr);
+      data->indices.out[i] = restr_data->d_ind;
+      code << "    writeDofsOffset"<<dimname<<"<ncomp_out_"<<i<<", "<<compstride<<", P_out_"<<i<<">(data, lsize_out_"<<i<<", elem, indices.out["<<i<<"], r_v"<<i<<", d_v"<<i<<");\n";
+    } else {
+      bool backendstrides;
+      ierr = CeedElemRestrictionHasBackendStrides(Erestrict, &backendstrides);
+      CeedChk(ierr);
+      CeedInt nelem;
+      ierr = CeedElemRestrictionGetNumElements(Erestrict, &nelem);
+      CeedChk(ierr);
+      CeedInt strides[3] = {1, elemsize*nelem, elemsize};
+      if (!backendstrides) {
+        ierr = CeedElemRestrictionGetStrides(Erestrict, &strides);
+        CeedChk(ierr);
+      }
+      code << "    // Strides: {"<<strides[0]<<", "<<strides[1]<<", "<<strides[2]<<"}\n";
+      code << "    writeDofsStrided"<<dimname<<"<ncomp_out_"<<i<<",P_out_"<<i<<","<<strides[0]<<","<<strides[1]<<","<<strides[2]<<">(data, elem, r_v"<<i<<", d_v"<<i<<");\n";
+    }
+  }
+
+  code << "  }\n";
+  code << "}\n";
+  code << "// -----------------------------------------------------------------------------\n\n";
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Generate single operator kernel and start compiling it in the background
+//------------------------------------------------------------------------------
+extern "C" int CeedHipGenOperatorPrepare(CeedOperator op) {
+
+  using std::ostringstream;
+  using std::string;
+  int ierr;
+  bool setupdone;
+  ierr = CeedOperatorIsSetupDone(op, &setupdone); CeedChk(ierr);
+  if (setupdone) return 0;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Hip_gen *data;
+  ierr = CeedOperatorGetData(op, &data); CeedChk(ierr);
+  CeedQFunction qf;
+  CeedQFunction_Hip_gen *qf_data;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  ierr = CeedQFunctionGetData(qf, &qf_data); CeedChk(ierr);
+  CeedInt Q, P1d, Q1d = 0, numelements, numinputfields, numoutputfields,
+          dim = 0;
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+  CeedQFunctionField *qfinputfields, *qfoutputfields;
+  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
+  CeedChk(ierr);
+  CeedEvalMode emode;
+  CeedBasis basis;
+  CeedBasis_Hip_shared *basis_data;
+
+  // Field pointer tables, sized for the QFunction fields
+  const CeedInt numinslots = CeedIntMax(numinputfields, 1);
+  const CeedInt numslots = numinslots + CeedIntMax(numoutputfields, 1);
+  ierr = CeedCalloc(4*numslots, &data->tables); CeedChk(ierr);
+  data->tablebytes = numslots * sizeof(void *);
+  data->indices.in = (CeedInt **)data->tables;
+  data->indices.out = data->indices.in + numinslots;
+  data->fields.in = (const CeedScalar **)data->tables + numslots;
+  data->fields.out = (CeedScalar **)data->tables + numslots + numinslots;
+  data->B.in = (const CeedScalar **)data->tables + 2*numslots;
+  data->B.out = (CeedScalar **)data->tables + 2*numslots + numinslots;
+  data->G.in = (const CeedScalar **)data->tables + 3*numslots;
+  data->G.out = (CeedScalar **)data->tables + 3*numslots + numinslots;
+  const bool devicetables = 4*data->tablebytes > CEED_HIP_MAX_FIELDS_BYTES;
+  if (devicetables) {
+    ierr = CeedHipMalloc(ceed, &data->d_tables, 4*data->tablebytes);
+    CeedChk(ierr);
+  }
+  ierr = CeedCalloc(numoutputfields, &data->outvecs); CeedChk(ierr);
+
+  ostringstream code;
+  string devFunctions(deviceFunctions);
+
+  code << devFunctions;
+
+  string qFunction(qf_data->qFunctionSource);
+  string qFunctionName(qf_data->qFunctionName);
+  string oper;
+  oper = "CeedKernel_Hip_gen_" + qFunctionName;
+
+  code << "\n#define CEED_QFUNCTION(name) inline __device__ int name\n";
+  code << "\n#define CeedPragmaSIMD\n";
+  // Chunked QFunctions evaluate one quadrature point per thread
+  code << "#define CEED_CHUNK_WIDTH 1\n";
+  code << "#define CEED_QFUNCTION_CHUNK(name) "
+          "inline __device__ int name ## _chunk(void *, CeedInt, CeedInt, "
+          "CeedInt, const CeedScalar *const *, CeedScalar *const *); "
+          "CEED_QFUNCTION(name)(void *ctx, const CeedInt Q, "
+          "const CeedScalar *const *in, CeedScalar *const *out) { "
+          "for (CeedInt i = 0; i < Q; i++) { "
+          "int ierr = name ## _chunk(ctx, Q, i, 1, in, out); "
+          "if (ierr) return ierr; } return 0; } "
+          "inline __device__ int name ## _chunk\n";
+  code << "#define CeedForLanes(j, nlanes) "
+          "for (CeedInt j = 0; j < 1; j++)\n";
+
+  // Find dim and Q1d
+  //   Non-tensor bases use Q1d and P1d for the number of quadrature points
+  //   and nodes of the element
+  bool useCollograd = true, hasTensor = false, nonTensor = false;
+  data->maxP1d = 0;
+  for (CeedInt i = 0; i < numinputfields; i++) {
+    ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
+    if (basis != CEED_BASIS_COLLOCATED) {
+      ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+      CeedChk(ierr);
+
+      // Collect dim and Q1d
+      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+      bool isTensor;
+      ierr = CeedBasisIsTensor(basis, &isTensor); CeedChk(ierr);
+      if (isTensor) {
+        ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
+        ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+
+        // Check for collocated gradient
+        ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
+        useCollograd = useCollograd && basis_data->d_collograd1d;
+      } else {
+        ierr = CeedBasisGetNumQuadraturePoints(basis, &Q1d); CeedChk(ierr);
+        ierr = CeedBasisGetNumNodes(basis, &P1d); CeedChk(ierr);
+      }
+      if (P1d>data->maxP1d) data->maxP1d = P1d;
+      hasTensor = hasTensor || isTensor;
+      nonTensor = nonTensor || !isTensor;
+    }
+  }
+  // Check output bases for Q1d, dim as well
+  //   The only imput basis might be CEED_BASIS_COLLOCATED
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis); CeedChk(ierr);
+
+    if (basis != CEED_BASIS_COLLOCATED) {
+      ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+      CeedChk(ierr);
+
+      // Collect dim and Q1d
+      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+      bool isTensor;
+      ierr = CeedBasisIsTensor(basis, &isTensor); CeedChk(ierr);
+      if (isTensor) {
+        ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
+        ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+
+        // Check for collocated gradient
+        ierr = CeedBasisGetData(basis, &basis_data); CeedChk(ierr);
+        useCollograd = useCollograd && basis_data->d_collograd1d;
+      } else {
+        ierr = CeedBasisGetNumQuadraturePoints(basis, &Q1d); CeedChk(ierr);
+        ierr = CeedBasisGetNumNodes(basis, &P1d); CeedChk(ierr);
+      }
+      if (P1d>data->maxP1d) data->maxP1d = P1d;
+      hasTensor = hasTensor || isTensor;
+      nonTensor = nonTensor || !isTensor;
+    }
+  }
+  if (hasTensor && nonTensor)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Backend does not implement operators mixing tensor and non-tensor bases");
+  // LCOV_EXCL_STOP
+  if (nonTensor) useCollograd = false;
+  // Non-tensor elements are laid out on threads like 1D elements
+  const CeedInt tdim = nonTensor ? 1 : dim;
+  data->dim = tdim;
+  data->Q1d = Q1d;
+
+  // Define CEED_Q_VLA
+  if (dim != 3 || useCollograd || nonTensor) {
+    code << "\n#define CEED_Q_VLA 1\n\n";
+  } else {
+    code << "\n#define CEED_Q_VLA "<<Q1d<<"\n\n";
+  }
+
+  code << qFunction;
+
+  // Setup
+  code << "\n// -----------------------------------------------------------------------------\n";
+  code << "\ntypedef struct { const CeedScalar* in["<<numinslots<<"]; CeedScalar* out["<<numslots-numinslots<<"]; } HipFields;\n";
+  code << "typedef struct { CeedInt* in["<<numinslots<<"]; CeedInt* out["<<numslots-numinslots<<"]; } HipFieldsInt;\n";
+  // Launch bounds, if requested with -DCEED_MAX_THREADS_PER_BLOCK in the JIT
+  //   options; the block size is then limited to match when tuning
+  code << "\n#ifdef CEED_MAX_THREADS_PER_BLOCK\n";
+  code << "#define CEED_LAUNCH_BOUNDS __launch_bounds__(CEED_MAX_THREADS_PER_BLOCK)\n";
+  code << "#else\n#define CEED_LAUNCH_BOUNDS\n#endif\n";
+  ierr = CeedHipGenOperatorBuildKernel(op, code, oper, dim, Q1d, useCollograd,
+                                        nonTensor, devicetables, false);
+  CeedChk(ierr);
+
+  // 3D operators with high order bases also get a kernel on 3D thread blocks,
+  //   tried when tuning the launch configuration
+  //   Both kernels pass one quadrature point at a time to the QFunction
+  const CeedInt T1d = CeedIntMax(Q1d, data->maxP1d);
+  Ceed_Hip_gen *gen_data;
+  ierr = CeedGetData(ceed, &gen_data); CeedChk(ierr);
+  data->hasblock3d = dim == 3 && !nonTensor && useCollograd &&
+                     T1d >= CEED_HIP_GEN_BLOCK3D_MIN_T1D &&
+                     T1d*T1d*T1d <= CEED_HIP_GEN_MAX_THREADS &&
+                     !gen_data->elemsPerBlock &&
+                     numelements >= CEED_HIP_GEN_TUNE_MIN_ELEMS;
+  if (data->hasblock3d) {
+    ierr = CeedHipGenOperatorBuildKernel(op, code, oper + "_3dBlock", dim, Q1d,
+                                          useCollograd, nonTensor, devicetables,
+                                          true);
+    CeedChk(ierr);
+  }
+
+  // View kernel for debugging
+  CeedDebug(code.str().c_str());
+
+  ierr = CeedCompileHipAsync(ceed, code.str().c_str(), &data->jit, 1,
+                             "T1d", CeedIntMax(Q1d, data->maxP1d));
+  CeedChk(ierr);
+
+  ierr = CeedOperatorSetSetupDone(op); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Build single operator kernel, waiting for its compilation
+//------------------------------------------------------------------------------
+extern "C" int CeedHipGenOperatorBuild(CeedOperator op) {
+  int ierr;
+  ierr = CeedHipGenOperatorPrepare(op); CeedChk(ierr);
+  CeedOperator_Hip_gen *data;
+  ierr = CeedOperatorGetData(op, &data); CeedChk(ierr);
+  if (!data->jit) return 0;
+
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  ierr = CeedCompileHipWait(ceed, &data->jit, &data->module); CeedChk(ierr);
+  CeedQFunction qf;
+  CeedQFunction_Hip_gen *qf_data;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  ierr = CeedQFunctionGetData(qf, &qf_data); CeedChk(ierr);
+  std::string oper = "CeedKernel_Hip_gen_" +
+                     std::string(qf_data->qFunctionName);
+  ierr = CeedGetKernelHip(ceed, data->module, oper.c_str(), &data->op);
+  CeedChk(ierr);
+  if (data->hasblock3d) {
+    ierr = CeedGetKernelHip(ceed, data->module, (oper + "_3dBlock").c_str(),
+                             &data->opblock3d); CeedChk(ierr);
+  }
+  return 0;
+}
+//------------------------------------------------------------------------------
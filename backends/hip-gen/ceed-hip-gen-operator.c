@@ -0,0 +1,392 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include "ceed-hip-gen.h"
+#include "ceed-hip-gen-operator-build.h"
+
+//------------------------------------------------------------------------------
+// Destroy operator
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroy_Hip_gen(CeedOperator op) {
+  int ierr;
+  CeedOperator_Hip_gen *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  ierr = CeedCompileHipWait(ceed, &impl->jit, NULL); CeedChk(ierr);
+  ierr = CeedHipFree(ceed, impl->d_tables); CeedChk(ierr);
+  ierr = CeedFree(&impl->tables); CeedChk(ierr);
+  ierr = CeedFree(&impl->outvecs); CeedChk(ierr);
+  ierr = CeedFree(&impl); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Launch operator kernel with given number of elements per thread block
+//   The 3D thread block kernel stacks elements of thread1d threads in z
+//------------------------------------------------------------------------------
+static int CeedOperatorRunKernel_Hip_gen(Ceed ceed,
+    CeedOperator_Hip_gen *data, CeedInt nelem, bool block3d,
+    CeedInt elemsPerBlock, void **opargs) {
+  int ierr;
+  const CeedInt thread1d = CeedIntMax(data->Q1d, data->maxP1d);
+  const CeedInt thread2d = data->dim == 1 ? 1 : thread1d;
+  const CeedInt thread3d = block3d ? elemsPerBlock*thread1d : elemsPerBlock;
+  const CeedInt grid = nelem/elemsPerBlock +
+                       ((nelem/elemsPerBlock*elemsPerBlock<nelem) ? 1 : 0);
+  const CeedInt sharedMem = thread3d*thread1d*thread2d*sizeof(CeedScalar);
+  if (data->d_tables) {
+    ierr = CeedHipCopyFieldsToDevice(ceed, data->tables, 4*data->tablebytes,
+                                      &data->d_tables); CeedChk(ierr);
+  }
+  ierr = CeedRunKernelDimSharedHip(ceed, block3d ? data->opblock3d : data->op,
+                                   grid, thread1d, thread2d, thread3d,
+                                   sharedMem, opargs);
+  CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Record the resource usage of the operator kernel at its tuned launch size,
+//   reported by CeedOperatorView()
+//------------------------------------------------------------------------------
+static int CeedOperatorSetKernelInfo_Hip_gen(CeedOperator op,
+    CeedOperator_Hip_gen *data) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedQFunction qf;
+  CeedQFunction_Hip_gen *qf_data;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  ierr = CeedQFunctionGetData(qf, &qf_data); CeedChk(ierr);
+
+  const CeedInt thread1d = CeedIntMax(data->Q1d, data->maxP1d);
+  const CeedInt thread2d = data->dim == 1 ? 1 : thread1d;
+  const CeedInt thread3d = data->block3d ? data->elemsPerBlock*thread1d :
+                           data->elemsPerBlock;
+  const CeedInt blockSize = thread1d*thread2d*thread3d;
+  char name[CEED_MAX_KERNEL_NAME];
+  snprintf(name, sizeof(name), "CeedKernel_Hip_gen_%s%s",
+           qf_data->qFunctionName, data->block3d ? "_3dBlock" : "");
+  CeedKernelInfo info;
+  ierr = CeedGetKernelInfoHip(ceed, data->block3d ? data->opblock3d : data->op,
+                             name, blockSize, blockSize*sizeof(CeedScalar),
+                             &info); CeedChk(ierr);
+  ierr = CeedOperatorSetKernelInfo(op, &info); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Tune number of elements per thread block
+//
+// Each candidate is timed on the operator's own input data, writing to
+//   scratch output arrays so the outputs are not modified. The fastest
+//   candidate is kept for the lifetime of the operator. Operators with a 3D
+//   thread block kernel also time it for each number of elements per block.
+//------------------------------------------------------------------------------
+static int CeedOperatorTuneElemsPerBlock_Hip_gen(CeedOperator op,
+    CeedVector *outvecs, void **opargs) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Hip_gen *ceed_data;
+  ierr = CeedGetData(ceed, &ceed_data); CeedChk(ierr);
+  CeedOperator_Hip_gen *data;
+  ierr = CeedOperatorGetData(op, &data); CeedChk(ierr);
+  const CeedInt dim = data->dim;
+  const CeedInt thread1d = CeedIntMax(data->Q1d, data->maxP1d);
+
+  // Default for small problems or when tuning is not possible
+  CeedInt elemsPerBlock;
+  if (dim == 1) // Includes non-tensor elements, with thread1d up to P or Q
+    elemsPerBlock = CeedIntMax(CeedIntMin(32, 1024/thread1d), 1);
+  else if (dim == 2)
+    elemsPerBlock = thread1d<4? 16 : 2;
+  else
+    elemsPerBlock = thread1d<6? 4 : (thread1d<8? 2 : 1);
+
+  // User override
+  if (ceed_data->elemsPerBlock) {
+    data->elemsPerBlock = ceed_data->elemsPerBlock;
+    return 0;
+  }
+
+  // Limits from register and shared memory usage, and launch bounds
+  int maxThreads;
+  ierr = hipFuncGetAttribute(&maxThreads, HIP_FUNC_ATTRIBUTE_MAX_THREADS_PER_BLOCK,
+                             data->op);
+  CeedChk_Hip(ceed, ierr);
+  const CeedInt elemThreads = thread1d*(dim == 1 ? 1 : thread1d);
+  const CeedInt maxElems = CeedIntMin(maxThreads / elemThreads,
+                                      CEED_HIP_GEN_MAX_SHARED /
+                                      (elemThreads*sizeof(CeedScalar)));
+  elemsPerBlock = CeedIntMax(CeedIntMin(elemsPerBlock, maxElems), 1);
+
+  CeedInt nelem;
+  ierr = CeedOperatorGetNumElements(op, &nelem); CeedChk(ierr);
+  if (nelem < CEED_HIP_GEN_TUNE_MIN_ELEMS) {
+    data->elemsPerBlock = elemsPerBlock;
+    return 0;
+  }
+
+  // Scratch outputs
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedScalar **out, **scratch;
+  ierr = CeedCalloc(numoutputfields, &out); CeedChk(ierr);
+  ierr = CeedCalloc(numoutputfields, &scratch); CeedChk(ierr);
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    out[i] = data->fields.out[i];
+    if (!out[i]) continue;
+    for (CeedInt j = 0; j < i; j++)
+      if (out[j] == out[i]) scratch[i] = scratch[j];
+    if (!scratch[i]) {
+      CeedInt length;
+      ierr = CeedVectorGetLength(outvecs[i], &length); CeedChk(ierr);
+      ierr = CeedHipMalloc(ceed, (void **)&scratch[i],
+                           length*sizeof(CeedScalar)); CeedChk(ierr);
+    }
+    data->fields.out[i] = scratch[i];
+  }
+
+  // Time candidates
+  hipEvent_t start, stop;
+  ierr = hipEventCreate(&start); CeedChk_Hip(ceed, ierr);
+  ierr = hipEventCreate(&stop); CeedChk_Hip(ceed, ierr);
+  float besttime = -1;
+  bool block3d = false;
+  for (CeedInt b = 0; b < (data->hasblock3d ? 2 : 1); b++) {
+    CeedInt maxBlockElems = maxElems;
+    if (b) {
+      ierr = hipFuncGetAttribute(&maxThreads,
+                                 HIP_FUNC_ATTRIBUTE_MAX_THREADS_PER_BLOCK,
+                                 data->opblock3d);
+      CeedChk_Hip(ceed, ierr);
+      maxBlockElems = CeedIntMin(maxThreads / (elemThreads*thread1d),
+                                 CEED_HIP_GEN_MAX_SHARED /
+                                 (elemThreads*thread1d*sizeof(CeedScalar)));
+    }
+    for (CeedInt e = 1; e <= maxBlockElems &&
+         e <= CEED_HIP_GEN_MAX_ELEMS_PER_BLOCK; e *= 2) {
+      ierr = CeedOperatorRunKernel_Hip_gen(ceed, data, nelem, b, e, opargs);
+      CeedChk(ierr);
+      ierr = hipEventRecord(start, 0); CeedChk_Hip(ceed, ierr);
+      for (CeedInt k = 0; k < CEED_HIP_GEN_TUNE_REPS; k++) {
+        ierr = CeedOperatorRunKernel_Hip_gen(ceed, data, nelem, b, e, opargs);
+        CeedChk(ierr);
+      }
+      ierr = hipEventRecord(stop, 0); CeedChk_Hip(ceed, ierr);
+      ierr = hipEventSynchronize(stop); CeedChk_Hip(ceed, ierr);
+      float time;
+      ierr = hipEventElapsedTime(&time, start, stop); CeedChk_Hip(ceed, ierr);
+      CeedDebug("%selemsPerBlock %d: %g ms", b ? "3D thread blocks, " : "", e,
+                time/CEED_HIP_GEN_TUNE_REPS);
+      if (besttime < 0 || time < besttime) {
+        besttime = time;
+        elemsPerBlock = e;
+        block3d = b;
+      }
+    }
+  }
+  ierr = hipEventDestroy(start); CeedChk_Hip(ceed, ierr);
+  ierr = hipEventDestroy(stop); CeedChk_Hip(ceed, ierr);
+
+  // Restore outputs
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    bool shared = false;
+    for (CeedInt j = 0; j < i; j++)
+      shared = shared || (scratch[j] == scratch[i]);
+    if (scratch[i] && !shared) {
+      ierr = CeedHipFree(ceed, scratch[i]); CeedChk(ierr);
+    }
+    data->fields.out[i] = out[i];
+  }
+  ierr = CeedFree(&out); CeedChk(ierr);
+  ierr = CeedFree(&scratch); CeedChk(ierr);
+  data->elemsPerBlock = elemsPerBlock;
+  data->block3d = block3d;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Apply and add to output
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Hip_gen(CeedOperator op, CeedVector invec,
+    CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Hip_gen *data;
+  ierr = CeedOperatorGetData(op, &data); CeedChk(ierr);
+  CeedQFunction qf;
+  CeedQFunction_Hip_gen *qf_data;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  ierr = CeedQFunctionGetData(qf, &qf_data); CeedChk(ierr);
+  CeedInt nelem, numinputfields, numoutputfields;
+  ierr = CeedOperatorGetNumElements(op, &nelem); CeedChk(ierr);
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+  CeedQFunctionField *qfinputfields, *qfoutputfields;
+  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
+  CeedChk(ierr);
+  CeedEvalMode emode;
+  CeedVector vec;
+
+  //Creation of the operator
+  ierr = CeedHipGenOperatorBuild(op); CeedChk(ierr);
+  CeedVector *outvecs = data->outvecs;
+
+  // Input vectors
+  for (CeedInt i = 0; i < numinputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    if (emode == CEED_EVAL_WEIGHT) { // Skip
+      data->fields.in[i] = NULL;
+    } else {
+      // Get input vector
+      ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+      if (vec == CEED_VECTOR_ACTIVE) vec = invec;
+      ierr = CeedVectorGetArrayRead(vec, CEED_MEM_DEVICE, &data->fields.in[i]);
+      CeedChk(ierr);
+    }
+  }
+
+  // Output vectors
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    if (emode == CEED_EVAL_WEIGHT) { // Skip
+      data->fields.out[i] = NULL;
+    } else {
+      // Get output vector
+      ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
+      if (vec == CEED_VECTOR_ACTIVE) vec = outvec;
+      outvecs[i] = vec;
+      // Check for multiple output modes
+      CeedInt index = -1;
+      for (CeedInt j = 0; j < i; j++) {
+        if (vec == outvecs[j]) {
+          index = j;
+          break;
+        }
+      }
+      if (index == -1) {
+        ierr = CeedVectorGetArray(vec, CEED_MEM_DEVICE, &data->fields.out[i]);
+        CeedChk(ierr);
+      } else {
+        data->fields.out[i] = data->fields.out[index];
+      }
+    }
+  }
+
+  // Get context data
+  CeedQFunctionContext ctx;
+  ierr = CeedQFunctionGetInnerContext(qf, &ctx); CeedChk(ierr);
+  if (ctx) {
+    ierr = CeedQFunctionContextGetData(ctx, CEED_MEM_DEVICE, &qf_data->d_c);
+    CeedChk(ierr);
+  }
+
+  // Apply operator
+  void *d_tables[4];
+  void *opargs[] = {(void *) &nelem, &qf_data->d_c, data->indices.in,
+                    data->fields.in, data->B.in, data->G.in, &data->W
+                   };
+  if (data->d_tables)
+    for (CeedInt k = 0; k < 4; k++) {
+      d_tables[k] = (char *)data->d_tables + k*data->tablebytes;
+      opargs[2 + k] = &d_tables[k];
+    }
+  if (!data->elemsPerBlock) {
+    ierr = CeedOperatorTuneElemsPerBlock_Hip_gen(op, outvecs, opargs);
+    CeedChk(ierr);
+    ierr = CeedOperatorSetKernelInfo_Hip_gen(op, data); CeedChk(ierr);
+  }
+  ierr = CeedOperatorRunKernel_Hip_gen(ceed, data, nelem, data->block3d,
+                                       data->elemsPerBlock, opargs);
+  CeedChk(ierr);
+
+  // Restore input arrays
+  for (CeedInt i = 0; i < numinputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    if (emode == CEED_EVAL_WEIGHT) { // Skip
+    } else {
+      ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+      if (vec == CEED_VECTOR_ACTIVE) vec = invec;
+      ierr = CeedVectorRestoreArrayRead(vec, &data->fields.in[i]);
+      CeedChk(ierr);
+    }
+  }
+
+  // Restore output arrays
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    if (emode == CEED_EVAL_WEIGHT) { // Skip
+    } else {
+      ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
+      if (vec == CEED_VECTOR_ACTIVE) vec = outvec;
+      // Check for multiple output modes
+      CeedInt index = -1;
+      for (CeedInt j = 0; j < i; j++) {
+        if (vec == outvecs[j]) {
+          index = j;
+          break;
+        }
+      }
+      if (index == -1) {
+        ierr = CeedVectorRestoreArray(vec, &data->fields.out[i]);
+        CeedChk(ierr);
+      }
+    }
+  }
+
+  // Restore context data
+  if (ctx) {
+    ierr = CeedQFunctionContextRestoreData(ctx, &qf_data->d_c);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Create operator
+//------------------------------------------------------------------------------
+int CeedOperatorCreate_Hip_gen(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Hip_gen *impl;
+
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  ierr = CeedOperatorSetData(op, impl); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Prepare",
+                                CeedHipGenOperatorPrepare); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
+                                CeedOperatorApplyAdd_Hip_gen); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
+                                CeedOperatorDestroy_Hip_gen); CeedChk(ierr);
+  return 0;
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,140 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <string.h>
+#include <stdio.h>
+#include "ceed-hip-gen.h"
+
+//------------------------------------------------------------------------------
+// Apply QFunction
+//------------------------------------------------------------------------------
+static int CeedQFunctionApply_Hip_gen(CeedQFunction qf, CeedInt Q,
+                                       CeedVector *U, CeedVector *V) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedQFunctionGetCeed(qf, &ceed); CeedChk(ierr);
+  return CeedError(ceed, 1, "Backend does not implement QFunctionApply");
+}
+
+//------------------------------------------------------------------------------
+// Destroy QFunction
+//------------------------------------------------------------------------------
+static int CeedQFunctionDestroy_Hip_gen(CeedQFunction qf) {
+  int ierr;
+  CeedQFunction_Hip_gen *data;
+  ierr = CeedQFunctionGetData(qf, &data); CeedChk(ierr);
+  Ceed ceed;
+  ierr = CeedQFunctionGetCeed(qf, &ceed); CeedChk(ierr);
+  ierr = hipFree(data->d_c); CeedChk_Hip(ceed, ierr);
+  ierr = CeedFree(&data->qFunctionSource); CeedChk(ierr);
+  ierr = CeedFree(&data); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Load QFunction
+//------------------------------------------------------------------------------
+static int loadHipFunction(CeedQFunction qf, char *c_src_file) {
+  int ierr;
+  Ceed ceed;
+  CeedQFunctionGetCeed(qf, &ceed);
+  CeedQFunction_Hip_gen *data;
+  ierr = CeedQFunctionGetData(qf, &data); CeedChk(ierr);
+
+  // Use source embedded at build time, if provided
+  const char *code;
+  ierr = CeedQFunctionGetSourceCode(qf, &code); CeedChk(ierr);
+  if (code) {
+    const size_t len = strlen(code) + 1;
+    ierr = CeedMalloc(len, &data->qFunctionSource); CeedChk(ierr);
+    memcpy(data->qFunctionSource, code, len);
+    return 0;
+  }
+
+  // Find source file
+  char *hip_file;
+  ierr = CeedCalloc(HIP_MAX_PATH, &hip_file); CeedChk(ierr);
+  memcpy(hip_file, c_src_file, strlen(c_src_file));
+  const char *last_dot = strrchr(hip_file, '.');
+  if (!last_dot)
+    return CeedError(ceed, 1, "Cannot find file's extension!");
+  const size_t hip_path_len = last_dot - hip_file;
+  strncpy(&hip_file[hip_path_len], ".h", 3);
+
+  // Open source file
+  FILE *fp;
+  long lSize;
+  char *buffer;
+  fp = fopen (hip_file, "rb");
+  if (!fp)
+    // LCOV_EXCL_START
+    CeedError(ceed, 1, "Couldn't open the Hip file for the QFunction.");
+  // LCOV_EXCL_STOP
+
+  // Compute size of source file
+  fseek(fp, 0L, SEEK_END);
+  lSize = ftell(fp);
+  rewind(fp);
+
+  // Allocate memory for entire content
+  ierr = CeedCalloc(lSize+1, &buffer); CeedChk(ierr);
+
+  // Copy the file into the buffer
+  if (1 != fread(buffer, lSize, 1, fp)) {
+    // LCOV_EXCL_START
+    fclose(fp);
+    ierr = CeedFree(&buffer); CeedChk(ierr);
+    CeedError(ceed, 1, "Couldn't read the Hip file for the QFunction.");
+    // LCOV_EXCL_STOP
+  }
+
+  // Save source string
+  data->qFunctionSource = buffer;
+
+  // Cleanup
+  fclose(fp);
+  ierr = CeedFree(&hip_file); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Create QFunction
+//------------------------------------------------------------------------------
+int CeedQFunctionCreate_Hip_gen(CeedQFunction qf) {
+  int ierr;
+  Ceed ceed;
+  CeedQFunctionGetCeed(qf, &ceed);
+  CeedQFunction_Hip_gen *data;
+  ierr = CeedCalloc(1, &data); CeedChk(ierr);
+  ierr = CeedQFunctionSetData(qf, data); CeedChk(ierr);
+
+  char *source;
+  ierr = CeedQFunctionGetSourcePath(qf, &source); CeedChk(ierr);
+  const char *funname = strrchr(source, ':') + 1;
+  data->qFunctionName = (char *)funname;
+  const int filenamelen = funname - source;
+  char filename[filenamelen];
+  memcpy(filename, source, filenamelen - 1);
+  filename[filenamelen - 1] = '\0';
+  ierr = loadHipFunction(qf, filename); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "QFunction", qf, "Apply",
+                                CeedQFunctionApply_Hip_gen); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "QFunction", qf, "Destroy",
+                                CeedQFunctionDestroy_Hip_gen); CeedChk(ierr);
+  return 0;
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,72 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed-backend.h>
+#include <hip/hip_runtime.h>
+#include "../hip/ceed-hip.h"
+#include "../hip/ceed-hip-compile.h"
+
+// Operator kernel launch tuning
+#define CEED_HIP_GEN_MAX_ELEMS_PER_BLOCK 64
+#define CEED_HIP_GEN_MAX_SHARED (48*1024)
+#define CEED_HIP_GEN_TUNE_MIN_ELEMS 1024
+#define CEED_HIP_GEN_TUNE_REPS 3
+#define CEED_HIP_GEN_MAX_THREADS 1024
+#define CEED_HIP_GEN_BLOCK3D_MIN_T1D 6
+
+// Pointer tables into one host block, each laid out like the kernel struct of
+//   an input and an output array
+typedef struct { const CeedScalar **in; CeedScalar **out; } HipFields;
+typedef struct { CeedInt **in; CeedInt **out; } HipFieldsInt;
+
+typedef struct {
+  CeedInt dim;
+  CeedInt Q1d;
+  CeedInt maxP1d;
+  CeedInt elemsPerBlock; /// Tuned on first apply, unless set by the user
+  CeedHipJit jit;     /// Kernel compilation started by Prepare, if pending
+  hipModule_t module;
+  hipFunction_t op;
+  bool hasblock3d;    /// Module also has a kernel on 3D thread blocks
+  bool block3d;       /// Tuned choice of the 3D thread block kernel
+  hipFunction_t opblock3d;
+  HipFieldsInt indices;
+  HipFields fields;
+  HipFields B;
+  HipFields G;
+  CeedScalar *W;
+  void **tables;     /// Host block holding the indices, fields, B, and G tables
+  size_t tablebytes; /// Bytes of each table
+  void *d_tables;    /// Device copy of the block, if too large for parameters
+  CeedVector *outvecs;
+} CeedOperator_Hip_gen;
+
+typedef struct {
+  char *qFunctionName;
+  char *qFunctionSource;
+  void *d_c;
+} CeedQFunction_Hip_gen;
+
+typedef struct {
+  Ceed_Hip base;
+  CeedInt elemsPerBlock; /// User override from CEED_GEN_ELEMS_PER_BLOCK
+} Ceed_Hip_gen;
+
+CEED_INTERN int CeedQFunctionCreate_Hip_gen(CeedQFunction qf);
+
+CEED_INTERN int CeedOperatorCreate_Hip_gen(CeedOperator op);
+
+CEED_INTERN int CeedCompositeOperatorCreate_Hip_gen(CeedOperator op);
@@ -55,6 +55,13 @@ extern "C" __global__ void interp(const CeedInt nelem, const int transpose,
     for (CeedInt comp = 0; comp < BASIS_NCOMP; ++comp) {
       const CeedScalar *cur_u = u + elem * u_stride + comp * u_comp_stride;
       CeedScalar *cur_v = v + elem * v_stride + comp * v_comp_stride;
+      // Collocated basis, interpolation is the identity
+      if (BASIS_COLLOCATED) {
+        for (CeedInt k = i; k < u_size; k += blockDim.x) {
+          cur_v[k] = cur_u[k];
+        }
+        continue;
+      }
       for (CeedInt k = i; k < u_size; k += blockDim.x) {
         s_buf1[k] = cur_u[k];
       }
@@ -130,6 +137,27 @@ extern "C" __global__ void grad(const CeedInt nelem, const int transpose,
                                   comp * u_comp_stride;
         CeedScalar *cur_v = v + elem * v_stride + dim1 * v_dim_stride + comp *
                             v_comp_stride;
+        // Collocated basis, one 1D derivative along dim1
+        if (BASIS_COLLOCATED) {
+          for (CeedInt d = 0; d <= dim1; d++) {
+            pre /= P;
+            if (d < dim1) post *= Q;
+          }
+          for (CeedInt k = i; k < BASIS_NQPT; k += blockDim.x) {
+            const CeedInt c = k % post;
+            const CeedInt j = (k / post) % Q;
+            const CeedInt a = k / (post * Q);
+            CeedScalar vk = 0;
+            for (CeedInt b = 0; b < P; b++)
+              vk += s_grad1d[j * stride0 + b * stride1] * cur_u[(a * P + b) * post + c];
+
+            if (transpose)
+              cur_v[k] += vk;
+            else
+              cur_v[k] = vk;
+          }
+          continue;
+        }
         for (CeedInt dim2 = 0; dim2 < BASIS_DIM; dim2++) {
           __syncthreads();
           // Update buffers used
@@ -240,83 +268,6 @@ extern "C" __global__ void weight(const CeedInt nelem,
 //------------------------------------------------------------------------------
 static const char *kernelsNonTensorRef = QUOTE(
 
-//------------------------------------------------------------------------------
-// Interp
-//------------------------------------------------------------------------------
-extern "C" __global__ void interp(const CeedInt nelem, const int transpose,
-                                  const CeedScalar *d_B,
-                                  const CeedScalar *__restrict__ d_U,
-                                  CeedScalar *__restrict__ d_V) {
-  const int tid = threadIdx.x;
-
-  const double *U;
-  double V;
-  //TODO load B in shared memory if blockDim.z > 1?
-
-  for (CeedInt elem = blockIdx.x*blockDim.z + threadIdx.z; elem < nelem;
-       elem += gridDim.x*blockDim.z) {
-    for (int comp = 0; comp < BASIS_NCOMP; comp++) {
-      if (!transpose) { // run with Q threads
-        U = d_U + elem*P + comp*nelem*P;
-        V = 0.0;
-        for (int i = 0; i < P; ++i)
-          V += d_B[i + tid*P]*U[i];
-
-        d_V[elem*Q + comp*nelem*Q + tid] = V;
-      } else { // run with P threads
-        U = d_U + elem*Q + comp*nelem*Q;
-        V = 0.0;
-        for (int i = 0; i < Q; ++i)
-          V += d_B[tid + i*P]*U[i];
-
-        d_V[elem*P + comp*nelem*P + tid] = V;
-      }
-    }
-  }
-}
-
-//------------------------------------------------------------------------------
-// Grad
-//------------------------------------------------------------------------------
-extern "C" __global__ void grad(const CeedInt nelem, const int transpose,
-                                const CeedScalar *d_G,
-                                const CeedScalar *__restrict__ d_U,
-                                CeedScalar *__restrict__ d_V) {
-  const int tid = threadIdx.x;
-
-  const double *U;
-  //TODO load G in shared memory if blockDim.z > 1?
-
-  for (CeedInt elem = blockIdx.x*blockDim.z + threadIdx.z; elem < nelem;
-       elem += gridDim.x*blockDim.z) {
-    for (int comp=0; comp<BASIS_NCOMP; comp++) {
-      if (!transpose) { // run with Q threads
-        double V[BASIS_DIM];
-        U = d_U + elem*P + comp*nelem*P;
-        for (int dim = 0; dim < BASIS_DIM; dim++)
-          V[dim] = 0.0;
-
-        for (int i = 0; i < P; ++i) {
-          const double val = U[i];
-          for(int dim = 0; dim < BASIS_DIM; dim++)
-            V[dim] += d_G[i + tid*P + dim*P*Q]*val;
-        }
-        for (int dim = 0; dim < BASIS_DIM; dim++) {
-          d_V[elem*Q + comp*nelem*Q + dim*BASIS_NCOMP*nelem*Q + tid] = V[dim];
-        }
-      } else { // run with P threads
-        double V = 0.0;
-        for (int dim = 0; dim < BASIS_DIM; dim++) {
-          U = d_U + elem*Q + comp*nelem*Q +dim*BASIS_NCOMP*nelem*Q;
-          for (int i = 0; i < Q; ++i)
-            V += d_G[tid + i*P + dim*P*Q]*U[i];
-        }
-        d_V[elem*P + comp*nelem*P + tid] = V;
-      }
-    }
-  }
-}
-
 //------------------------------------------------------------------------------
 // Weight
 //------------------------------------------------------------------------------
@@ -344,11 +295,12 @@ int CeedBasisApply_Hip(CeedBasis basis, const CeedInt nelem,
   Ceed ceed;
   ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
   Ceed_Hip *ceed_Hip;
-  ierr = CeedGetData(ceed, &ceed_Hip); CeedChk(ierr);
+  ierr = CeedHipGetSharedData(ceed, &ceed_Hip); CeedChk(ierr);
   CeedBasis_Hip *data;
   ierr = CeedBasisGetData(basis, &data); CeedChk(ierr);
   const CeedInt transpose = tmode == CEED_TRANSPOSE;
-  const int maxblocksize = 64;
+  // One wavefront per element
+  const int maxblocksize = ceed_Hip->warpsize;
 
   // Read vectors
   const CeedScalar *d_u;
@@ -362,7 +314,8 @@ int CeedBasisApply_Hip(CeedBasis basis, const CeedInt nelem,
   if (tmode == CEED_TRANSPOSE) {
     CeedInt length;
     ierr = CeedVectorGetLength(v, &length); CeedChk(ierr);
-    ierr = hipMemset(d_v, 0, length * sizeof(CeedScalar));
+    ierr = hipMemsetAsync(d_v, 0, length * sizeof(CeedScalar),
+                          CeedHipGetStream());
     CeedChk_Hip(ceed,ierr);
   }
 
@@ -392,10 +345,8 @@ int CeedBasisApply_Hip(CeedBasis basis, const CeedInt nelem,
   } break;
   case CEED_EVAL_WEIGHT: {
     void *weightargs[] = {(void *) &nelem, (void *) &data->d_qweight1d, &d_v};
-    const int blocksize = 64;
-    int gridsize = nelem/blocksize;
-    if (blocksize * gridsize < nelem)
-      gridsize += 1;
+    const int blocksize = ceed_Hip->optblocksize;
+    const int gridsize = CeedDivUpInt(nelem, blocksize);
 
     ierr = CeedRunKernelHip(ceed, data->weight, gridsize, blocksize,
                             weightargs); CeedChk(ierr);
@@ -431,8 +382,6 @@ int CeedBasisApplyNonTensor_Hip(CeedBasis basis, const CeedInt nelem,
   int ierr;
   Ceed ceed;
   ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
-  Ceed_Hip *ceed_Hip;
-  ierr = CeedGetData(ceed, &ceed_Hip); CeedChk(ierr);
   CeedBasisNonTensor_Hip *data;
   ierr = CeedBasisGetData(basis, &data); CeedChk(ierr);
   CeedInt nnodes, nqpt;
@@ -454,34 +403,51 @@ int CeedBasisApplyNonTensor_Hip(CeedBasis basis, const CeedInt nelem,
   if (tmode == CEED_TRANSPOSE) {
     CeedInt length;
     ierr = CeedVectorGetLength(v, &length); CeedChk(ierr);
-    ierr = hipMemset(d_v, 0, length * sizeof(CeedScalar));
+    ierr = hipMemsetAsync(d_v, 0, length * sizeof(CeedScalar),
+                          CeedHipGetStream());
     CeedChk_Hip(ceed, ierr);
   }
 
   // Apply basis operation
+  //   The element and component columns of the E-vectors are contiguous, so
+  //   interp and grad are GEMMs with the P x Q column major basis matrices
+  hipblasHandle_t handle;
+  ierr = CeedHipGetHipblasHandle(ceed, &handle); CeedChk(ierr);
+  CeedInt ncomp, dim;
+  ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+  const CeedInt ncols = nelem*ncomp;
+  const CeedScalar one = 1.0, zero = 0.0;
   switch (emode) {
   case CEED_EVAL_INTERP: {
-    void *interpargs[] = {(void *) &nelem, (void *) &transpose,
-                          &data->d_interp, &d_u, &d_v
-                         };
     if (!transpose) {
-      ierr = CeedRunKernelDimHip(ceed, data->interp, grid, nqpt, 1,
-                                 elemsPerBlock, interpargs); CeedChk(ierr);
+      ierr = hipblasXgemm(handle, HIPBLAS_OP_T, HIPBLAS_OP_N, nqpt, ncols,
+                          nnodes, &one, data->d_interp, nnodes, d_u, nnodes,
+                          &zero, d_v, nqpt);
     } else {
-      ierr = CeedRunKernelDimHip(ceed, data->interp, grid, nnodes, 1,
-                                 elemsPerBlock, interpargs); CeedChk(ierr);
+      ierr = hipblasXgemm(handle, HIPBLAS_OP_N, HIPBLAS_OP_N, nnodes, ncols,
+                          nqpt, &one, data->d_interp, nnodes, d_u, nqpt,
+                          &zero, d_v, nnodes);
     }
+    CeedChk_Hipblas(ceed, ierr);
   } break;
   case CEED_EVAL_GRAD: {
-    void *gradargs[] = {(void *) &nelem, (void *) &transpose, &data->d_grad,
-                        &d_u, &d_v
-                       };
     if (!transpose) {
-      ierr = CeedRunKernelDimHip(ceed, data->grad, grid, nqpt, 1,
-                                 elemsPerBlock, gradargs); CeedChk(ierr);
+      // One GEMM per dimension, strided in the basis and in v
+      ierr = hipblasXgemmStridedBatched(handle, HIPBLAS_OP_T, HIPBLAS_OP_N,
+                                        nqpt, ncols, nnodes, &one,
+                                        data->d_grad, nnodes, nnodes*nqpt,
+                                        d_u, nnodes, 0, &zero, d_v, nqpt,
+                                        ncols*nqpt, dim);
+      CeedChk_Hipblas(ceed, ierr);
     } else {
-      ierr = CeedRunKernelDimHip(ceed, data->grad, grid, nnodes, 1,
-                                 elemsPerBlock, gradargs); CeedChk(ierr);
+      // Sum over dimensions into the cleared v
+      for (CeedInt d = 0; d < dim; d++) {
+        ierr = hipblasXgemm(handle, HIPBLAS_OP_N, HIPBLAS_OP_N, nnodes, ncols,
+                            nqpt, &one, data->d_grad + d*nnodes*nqpt, nnodes,
+                            d_u + d*ncols*nqpt, nqpt, &one, d_v, nnodes);
+        CeedChk_Hipblas(ceed, ierr);
+      }
     }
   } break;
   case CEED_EVAL_WEIGHT: {
@@ -524,9 +490,9 @@ static int CeedBasisDestroy_Hip(CeedBasis basis) {
 
   CeedChk_Hip(ceed, hipModuleUnload(data->module));
 
-  ierr = hipFree(data->d_qweight1d); CeedChk_Hip(ceed,ierr);
-  ierr = hipFree(data->d_interp1d); CeedChk_Hip(ceed,ierr);
-  ierr = hipFree(data->d_grad1d); CeedChk_Hip(ceed,ierr);
+  ierr = CeedHipFree(ceed, data->d_qweight1d); CeedChk(ierr);
+  ierr = CeedHipFree(ceed, data->d_interp1d); CeedChk(ierr);
+  ierr = CeedHipFree(ceed, data->d_grad1d); CeedChk(ierr);
 
   ierr = CeedFree(&data); CeedChk(ierr);
   return 0;
@@ -545,9 +511,9 @@ static int CeedBasisDestroyNonTensor_Hip(CeedBasis basis) {
 
   CeedChk_Hip(ceed, hipModuleUnload(data->module));
 
-  ierr = hipFree(data->d_qweight); CeedChk_Hip(ceed, ierr);
-  ierr = hipFree(data->d_interp); CeedChk_Hip(ceed, ierr);
-  ierr = hipFree(data->d_grad); CeedChk_Hip(ceed, ierr);
+  ierr = CeedHipFree(ceed, data->d_qweight); CeedChk(ierr);
+  ierr = CeedHipFree(ceed, data->d_interp); CeedChk(ierr);
+  ierr = CeedHipFree(ceed, data->d_grad); CeedChk(ierr);
 
   ierr = CeedFree(&data); CeedChk(ierr);
   return 0;
@@ -570,23 +536,28 @@ int CeedBasisCreateTensorH1_Hip(CeedInt dim, CeedInt P1d, CeedInt Q1d,
 
   // Copy data to GPU
   const CeedInt qBytes = Q1d * sizeof(CeedScalar);
-  ierr = hipMalloc((void **)&data->d_qweight1d, qBytes); CeedChk_Hip(ceed,ierr);
+  ierr = CeedHipMalloc(ceed, (void **)&data->d_qweight1d, qBytes);
+  CeedChk(ierr);
   ierr = hipMemcpy(data->d_qweight1d, qweight1d, qBytes,
                    hipMemcpyHostToDevice); CeedChk_Hip(ceed,ierr);
 
   const CeedInt iBytes = qBytes * P1d;
-  ierr = hipMalloc((void **)&data->d_interp1d, iBytes); CeedChk_Hip(ceed,ierr);
+  ierr = CeedHipMalloc(ceed, (void **)&data->d_interp1d, iBytes); CeedChk(ierr);
   ierr = hipMemcpy(data->d_interp1d, interp1d, iBytes,
                    hipMemcpyHostToDevice); CeedChk_Hip(ceed,ierr);
 
-  ierr = hipMalloc((void **)&data->d_grad1d, iBytes); CeedChk_Hip(ceed,ierr);
+  ierr = CeedHipMalloc(ceed, (void **)&data->d_grad1d, iBytes); CeedChk(ierr);
   ierr = hipMemcpy(data->d_grad1d, grad1d, iBytes,
                    hipMemcpyHostToDevice); CeedChk_Hip(ceed,ierr);
+  ierr = CeedBasisTrackMemory(basis, CEED_MEMSPACE_DEVICE, qBytes + 2*iBytes);
+  CeedChk(ierr);
 
   // Complie basis kernels
   CeedInt ncomp;
   ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
-  ierr = CeedCompileHip(ceed, basiskernels, &data->module, 7,
+  bool collocated;
+  ierr = CeedBasisIsCollocated(basis, &collocated); CeedChk(ierr);
+  ierr = CeedCompileHip(ceed, basiskernels, &data->module, 8,
                         "BASIS_Q1D", Q1d,
                         "BASIS_P1D", P1d,
                         "BASIS_BUF_LEN", ncomp * CeedIntPow(Q1d > P1d ?
@@ -594,7 +565,8 @@ int CeedBasisCreateTensorH1_Hip(CeedInt dim, CeedInt P1d, CeedInt Q1d,
                         "BASIS_DIM", dim,
                         "BASIS_NCOMP", ncomp,
                         "BASIS_ELEMSIZE", CeedIntPow(P1d, dim),
-                        "BASIS_NQPT", CeedIntPow(Q1d, dim)
+                        "BASIS_NQPT", CeedIntPow(Q1d, dim),
+                        "BASIS_COLLOCATED", collocated
                        ); CeedChk(ierr);
   ierr = CeedGetKernelHip(ceed, data->module, "interp", &data->interp);
   CeedChk(ierr);
@@ -626,33 +598,27 @@ int CeedBasisCreateH1_Hip(CeedElemTopology topo, CeedInt dim, CeedInt nnodes,
 
   // Copy basis data to GPU
   const CeedInt qBytes = nqpts * sizeof(CeedScalar);
-  ierr = hipMalloc((void **)&data->d_qweight, qBytes); CeedChk_Hip(ceed, ierr);
+  ierr = CeedHipMalloc(ceed, (void **)&data->d_qweight, qBytes); CeedChk(ierr);
   ierr = hipMemcpy(data->d_qweight, qweight, qBytes,
                    hipMemcpyHostToDevice); CeedChk_Hip(ceed, ierr);
 
   const CeedInt iBytes = qBytes * nnodes;
-  ierr = hipMalloc((void **)&data->d_interp, iBytes); CeedChk_Hip(ceed, ierr);
+  ierr = CeedHipMalloc(ceed, (void **)&data->d_interp, iBytes); CeedChk(ierr);
   ierr = hipMemcpy(data->d_interp, interp, iBytes,
                    hipMemcpyHostToDevice); CeedChk_Hip(ceed, ierr);
 
   const CeedInt gBytes = qBytes * nnodes * dim;
-  ierr = hipMalloc((void **)&data->d_grad, gBytes); CeedChk_Hip(ceed, ierr);
+  ierr = CeedHipMalloc(ceed, (void **)&data->d_grad, gBytes); CeedChk(ierr);
   ierr = hipMemcpy(data->d_grad, grad, gBytes,
                    hipMemcpyHostToDevice); CeedChk_Hip(ceed, ierr);
+  ierr = CeedBasisTrackMemory(basis, CEED_MEMSPACE_DEVICE,
+                               qBytes + iBytes + gBytes);
+  CeedChk(ierr);
 
   // Compile basis kernels
-  CeedInt ncomp;
-  ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
-  ierr = CeedCompileHip(ceed, kernelsNonTensorRef, &data->module, 4,
-                        "Q", nqpts,
-                        "P", nnodes,
-                        "BASIS_DIM", dim,
-                        "BASIS_NCOMP", ncomp
+  ierr = CeedCompileHip(ceed, kernelsNonTensorRef, &data->module, 1,
+                        "Q", nqpts
                        ); CeedChk_Hip(ceed, ierr);
-  ierr = CeedGetKernelHip(ceed, data->module, "interp", &data->interp);
-  CeedChk_Hip(ceed, ierr);
-  ierr = CeedGetKernelHip(ceed, data->module, "grad", &data->grad);
-  CeedChk_Hip(ceed, ierr);
   ierr = CeedGetKernelHip(ceed, data->module, "weight", &data->weight);
   CeedChk_Hip(ceed, ierr);
 
@@ -15,28 +15,102 @@
 // testbed platforms, in support of the nation's exascale computing imperative.
 
 #include <ceed-backend.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <fstream>
+#include <iterator>
+#include <memory>
 #include <sstream>
+#include <system_error>
+#include <thread>
+#include <vector>
 #include <stdarg.h>
+#include <unistd.h>
 #include <hip/hiprtc.h>
 #include "ceed-hip.h"
 #include "ceed-hip-compile.h"
 
-#define CeedChk_hiprtc(ceed, x) \
-do { \
-  hiprtcResult result = static_cast<hiprtcResult>(x); \
-  if (result != HIPRTC_SUCCESS) \
-    return CeedError((ceed), x, hiprtcGetErrorString(result)); \
-} while (0)
+//------------------------------------------------------------------------------
+// JIT cache key, FNV-1a hash of kernel source and compile options
+//------------------------------------------------------------------------------
+static uint64_t CeedJitHash_Hip(uint64_t hash, const std::string &str) {
+  for (const unsigned char c : str) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+  // Separate consecutive strings
+  hash ^= 0xff;
+  hash *= 1099511628211ULL;
+  return hash;
+}
 
 //------------------------------------------------------------------------------
-// Compile HIP kernel
+// JIT cache file path, empty unless CEED_JIT_CACHE_DIR is set
 //------------------------------------------------------------------------------
-int CeedCompileHip(Ceed ceed, const char *source, hipModule_t *module,
-                    const CeedInt numopts, ...) {
+static std::string CeedJitCachePath_Hip(const std::string &source,
+                                        const char **opts, const int numopts) {
+  const char *dir = getenv("CEED_JIT_CACHE_DIR");
+  if (!dir || !dir[0])
+    return std::string();
+
+  uint64_t hash = 14695981039346656037ULL;
+  hash = CeedJitHash_Hip(hash, "hip-" + std::to_string(HIP_VERSION));
+  for (int i = 0; i < numopts; i++)
+    hash = CeedJitHash_Hip(hash, opts[i]);
+  hash = CeedJitHash_Hip(hash, source);
+
+  char name[64];
+  snprintf(name, sizeof name, "/ceed-hip-%016llx-%zu.hsaco",
+           (unsigned long long)hash, source.size());
+  return dir + std::string(name);
+}
+
+//------------------------------------------------------------------------------
+// Query the device attributes that set compile options and launch parameters,
+//   once, when a kernel is first compiled
+//------------------------------------------------------------------------------
+int CeedHipQueryDevice(Ceed ceed) {
   int ierr;
-  hipFree(0); // Make sure a Context exists for hiprtc 
-  hiprtcProgram prog;
+  Ceed_Hip *data;
+  ierr = CeedGetData(ceed, (void **)&data); CeedChk(ierr);
+  if (data->arch)
+    return 0;
+
+  struct hipDeviceProp_t prop;
+  CeedChk_Hip(ceed, hipGetDeviceProperties(&prop, data->deviceId));
+  data->arch = prop.gcnArch;
+  data->warpsize = prop.warpSize;
+  data->numcu = prop.multiProcessorCount;
+  data->maxthreadspercu = prop.maxThreadsPerMultiProcessor;
+  // Four wavefronts per block: 256 threads with the 64-wide wavefronts of
+  //   GCN and CDNA, 128 with the 32-wide wavefronts of RDNA
+  data->optblocksize = CeedIntMin(4*prop.warpSize, prop.maxThreadsPerBlock);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Runtime compilation of a HIP kernel, possibly on another thread
+//------------------------------------------------------------------------------
+struct CeedHipJit_private {
+  std::thread thread;
+  std::string code;
+  std::vector<std::string> opts;
+  std::string path;    // JIT cache file, if CEED_JIT_CACHE_DIR is set
+  bool cachehit = false;
+  hiprtcResult result = HIPRTC_SUCCESS;
+  std::string codeobj, log;
+};
+
+//------------------------------------------------------------------------------
+// Set up runtime compilation of a HIP kernel, copying the source and options
+//   so the compilation can run on another thread
+//------------------------------------------------------------------------------
+static int CeedHipJitCreate(Ceed ceed, const char *source,
+                            const CeedInt numopts, va_list args,
+                            CeedHipJit *jit) {
+  int ierr;
+  hipFree(0); // Make sure a Context exists for hiprtc
 
   // Add hip runtime include to string for generation
   std::ostringstream code;
@@ -44,64 +118,184 @@ int CeedCompileHip(Ceed ceed, const char *source, hipModule_t *module,
 
   // Macro definitions
   // Get kernel specific options, such as kernel constants
-  const int optslen = 32;
-  const int optssize = 2;
-  const char *opts[optssize];
-  if (numopts > 0) {
-    va_list args;
-    va_start(args, numopts);
-    char *name;
-    int val;
-    for (int i = 0; i < numopts; i++) {
-      name = va_arg(args, char *);
-      val = va_arg(args, int);
-      code << "#define " << name << " " << val << "\n";
-    }
-    va_end(args);
+  for (int i = 0; i < numopts; i++) {
+    const char *name = va_arg(args, char *);
+    const int val = va_arg(args, int);
+    code << "#define " << name << " " << val << "\n";
   }
 
   // Standard backend options
-  code << "#define CeedScalar double\n#define CeedInt int\n\n";
- 
-  // Non-macro options     
-  opts[0] = "-default-device";
-  struct hipDeviceProp_t prop;
+  code << "#define CeedScalar " <<
+       (sizeof(CeedScalar) == sizeof(float) ? "float" : "double") <<
+       "\n#define CeedInt int\n\n";
+
+  // Non-macro options
   Ceed_Hip *ceed_data;
   ierr = CeedGetData(ceed, (void **)&ceed_data); CeedChk(ierr);
-  CeedChk_Hip(ceed, hipGetDeviceProperties(&prop, ceed_data->deviceId));
-  char buff[optslen];
-  std::string gfxName = "gfx" + std::to_string(prop.gcnArch);
-  std::string archArg = "--gpu-architecture="  + gfxName;
-  snprintf(buff, optslen, "%s", archArg.c_str());
-  opts[1] = buff;
+  ierr = CeedHipQueryDevice(ceed); CeedChk(ierr);
+  const char *jitoptions;
+  ierr = CeedGetJitOptions(ceed, &jitoptions); CeedChk(ierr);
+  CeedHipJit impl = new CeedHipJit_private;
+  impl->opts.push_back("-default-device");
+  impl->opts.push_back("--gpu-architecture=gfx" +
+                       std::to_string(ceed_data->arch));
+
+  // Options set by the user with CeedSetJitOptions(), split at whitespace
+  if (jitoptions) {
+    std::istringstream useropts(jitoptions);
+    std::string opt;
+    while (useropts >> opt)
+      impl->opts.push_back(opt);
+  }
 
   // Add string source argument provided in call
   code << source;
+  impl->code = code.str();
+
+  std::vector<const char *> opts;
+  for (const std::string &opt : impl->opts)
+    opts.push_back(opt.c_str());
+  impl->path = CeedJitCachePath_Hip(impl->code, opts.data(), opts.size());
+  *jit = impl;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compile a HIP kernel, or read it from the JIT cache
+//   Only hiprtc and host memory are used, so this can run on another thread
+//   while the host continues; errors are reported by CeedCompileHipWait
+//------------------------------------------------------------------------------
+static void CeedHipJitCompile(CeedHipJit jit) {
+  // Check JIT cache
+  if (!jit->path.empty()) {
+    std::ifstream file(jit->path, std::ios::binary);
+    jit->codeobj.assign((std::istreambuf_iterator<char>(file)),
+                        std::istreambuf_iterator<char>());
+    jit->cachehit = file && !jit->codeobj.empty();
+    if (jit->cachehit)
+      return;
+  }
 
   // Create Program
-  CeedChk_hiprtc(ceed, hiprtcCreateProgram(&prog, code.str().c_str(), NULL, 0, NULL, NULL));
+  hiprtcProgram prog;
+  jit->result = hiprtcCreateProgram(&prog, jit->code.c_str(), NULL, 0, NULL,
+                                    NULL);
+  if (jit->result != HIPRTC_SUCCESS)
+    return;
 
   // Compile kernel
-  hiprtcResult result = hiprtcCompileProgram(prog, optssize, opts);
-  if (result != HIPRTC_SUCCESS) {
+  std::vector<const char *> opts;
+  for (const std::string &opt : jit->opts)
+    opts.push_back(opt.c_str());
+  jit->result = hiprtcCompileProgram(prog, opts.size(), opts.data());
+  if (jit->result == HIPRTC_SUCCESS) {
+    size_t codesize;
+    jit->result = hiprtcGetCodeSize(prog, &codesize);
+    if (jit->result == HIPRTC_SUCCESS) {
+      jit->codeobj.resize(codesize);
+      jit->result = hiprtcGetCode(prog, &jit->codeobj[0]);
+    }
+  } else {
     size_t logsize;
-    CeedChk_hiprtc(ceed, hiprtcGetProgramLogSize(prog, &logsize));
-    char *log;
-    ierr = CeedMalloc(logsize, &log); CeedChk(ierr);
-    CeedChk_hiprtc(ceed, hiprtcGetProgramLog(prog, log));
-    return CeedError(ceed, (int)result, "%s\n%s", hiprtcGetErrorString(result), log);
+    if (hiprtcGetProgramLogSize(prog, &logsize) == HIPRTC_SUCCESS) {
+      jit->log.resize(logsize);
+      hiprtcGetProgramLog(prog, &jit->log[0]);
+    }
+  }
+  hiprtcDestroyProgram(&prog);
+
+  // Store in JIT cache, renaming into place so concurrent ranks never see a
+  //   partial file; failure to write only costs a recompile later
+  if (!jit->path.empty() && jit->result == HIPRTC_SUCCESS) {
+    std::string tmp = jit->path + "." + std::to_string((long)getpid()) +
+                      ".tmp";
+    std::ofstream file(tmp, std::ios::binary);
+    file.write(jit->codeobj.data(), jit->codeobj.size());
+    file.close();
+    if (!file || rename(tmp.c_str(), jit->path.c_str()))
+      remove(tmp.c_str());
   }
+}
+
+//------------------------------------------------------------------------------
+// Start compiling a HIP kernel on another thread
+//------------------------------------------------------------------------------
+int CeedCompileHipAsync(Ceed ceed, const char *source, CeedHipJit *jit,
+                        const CeedInt numopts, ...) {
+  int ierr;
+  va_list args;
+  va_start(args, numopts);
+  ierr = CeedHipJitCreate(ceed, source, numopts, args, jit);
+  va_end(args);
+  CeedChk(ierr);
 
-  size_t ptxsize;
-  CeedChk_hiprtc(ceed, hiprtcGetCodeSize(prog, &ptxsize));
-  char *ptx;
-  ierr = CeedMalloc(ptxsize, &ptx); CeedChk(ierr);
-  CeedChk_hiprtc(ceed, hiprtcGetCode(prog, ptx));
-  CeedChk_hiprtc(ceed, hiprtcDestroyProgram(&prog));
+  // Compile right away if no thread can be started
+  try {
+    (*jit)->thread = std::thread(CeedHipJitCompile, *jit);
+  } catch (const std::system_error &) {
+    CeedHipJitCompile(*jit);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Wait for compilation of a HIP kernel and load the module, or only release
+//   the compiled code if module is NULL
+//------------------------------------------------------------------------------
+int CeedCompileHipWait(Ceed ceed, CeedHipJit *jit, hipModule_t *module) {
+  int ierr;
+  CeedHipJit impl = *jit;
+  if (!impl)
+    return 0;
+  if (impl->thread.joinable()) {
+    // Only the time waiting for the compilation thread is profiled
+    double start;
+    ierr = CeedProfileStart(ceed, CEED_PROFILE_COMPILE, &start); CeedChk(ierr);
+    impl->thread.join();
+    ierr = CeedProfileStop(ceed, CEED_PROFILE_COMPILE, start, 0); CeedChk(ierr);
+  }
+  *jit = NULL;
+  std::unique_ptr<CeedHipJit_private> owner(impl);
+
+  Ceed_Hip *ceed_data;
+  ierr = CeedGetData(ceed, (void **)&ceed_data); CeedChk(ierr);
+  if (!impl->path.empty()) {
+    if (impl->cachehit) {
+      ceed_data->jithits++;
+      CeedDebug("JIT cache hit: %s", impl->path.c_str());
+    } else {
+      ceed_data->jitmisses++;
+      CeedDebug("JIT cache miss: %s", impl->path.c_str());
+    }
+  }
+  if (impl->result != HIPRTC_SUCCESS)
+    // LCOV_EXCL_START
+    return CeedError(ceed, (int)impl->result, "%s\n%s",
+                     hiprtcGetErrorString(impl->result), impl->log.c_str());
+  // LCOV_EXCL_STOP
 
-  CeedChk_Hip(ceed, hipModuleLoadData(module, ptx));
-  ierr = CeedFree(&ptx); CeedChk(ierr);
+  if (module)
+    CeedChk_Hip(ceed, hipModuleLoadData(module, impl->codeobj.data()));
+  return 0;
+}
 
+//------------------------------------------------------------------------------
+// Compile HIP kernel
+//------------------------------------------------------------------------------
+int CeedCompileHip(Ceed ceed, const char *source, hipModule_t *module,
+                   const CeedInt numopts, ...) {
+  int ierr;
+  CeedHipJit jit;
+  double start;
+  ierr = CeedProfileStart(ceed, CEED_PROFILE_COMPILE, &start); CeedChk(ierr);
+  va_list args;
+  va_start(args, numopts);
+  ierr = CeedHipJitCreate(ceed, source, numopts, args, &jit);
+  va_end(args);
+  CeedChk(ierr);
+  CeedHipJitCompile(jit);
+  ierr = CeedCompileHipWait(ceed, &jit, module); CeedChk(ierr);
+  ierr = CeedProfileStop(ceed, CEED_PROFILE_COMPILE, start, 0); CeedChk(ierr);
   return 0;
 }
 
@@ -110,8 +304,55 @@ int CeedCompileHip(Ceed ceed, const char *source, hipModule_t *module,
 //------------------------------------------------------------------------------
 int CeedGetKernelHip(Ceed ceed, hipModule_t module, const char *name,
                       hipFunction_t *kernel) {
-
+  int ierr;
   CeedChk_Hip(ceed, hipModuleGetFunction(kernel, module, name));
+
+  // Record the resources of the kernel, reported by CeedView()
+  CeedKernelInfo info;
+  ierr = CeedGetKernelInfoHip(ceed, *kernel, name, 0, 0, &info);
+  CeedChk(ierr);
+  ierr = CeedAddKernelInfo(ceed, &info); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Get the resource usage of a HIP kernel; the theoretical occupancy is for
+//   blockSize threads, or for the block size maximizing it when 0
+//------------------------------------------------------------------------------
+int CeedGetKernelInfoHip(Ceed ceed, hipFunction_t kernel, const char *name,
+                         int blockSize, size_t dynamicSharedMem,
+                         CeedKernelInfo *info) {
+  int regs, local, shared, maxThreads;
+  CeedChk_Hip(ceed, hipFuncGetAttribute(&regs, HIP_FUNC_ATTRIBUTE_NUM_REGS,
+                                        kernel));
+  CeedChk_Hip(ceed, hipFuncGetAttribute(&local,
+                                        HIP_FUNC_ATTRIBUTE_LOCAL_SIZE_BYTES,
+                                        kernel));
+  CeedChk_Hip(ceed, hipFuncGetAttribute(&shared,
+                                        HIP_FUNC_ATTRIBUTE_SHARED_SIZE_BYTES,
+                                        kernel));
+  CeedChk_Hip(ceed, hipFuncGetAttribute(&maxThreads,
+              HIP_FUNC_ATTRIBUTE_MAX_THREADS_PER_BLOCK, kernel));
+  if (!blockSize) {
+    int minGridSize;
+    CeedChk_Hip(ceed, hipModuleOccupancyMaxPotentialBlockSize(&minGridSize,
+                &blockSize, kernel, dynamicSharedMem, 0));
+  }
+  int numBlocks, maxThreadsCU, device;
+  CeedChk_Hip(ceed, hipModuleOccupancyMaxActiveBlocksPerMultiprocessor(
+                &numBlocks, kernel, blockSize, dynamicSharedMem));
+  CeedChk_Hip(ceed, hipGetDevice(&device));
+  CeedChk_Hip(ceed, hipDeviceGetAttribute(&maxThreadsCU,
+              hipDeviceAttributeMaxThreadsPerMultiProcessor, device));
+
+  memset(info, 0, sizeof(*info));
+  snprintf(info->name, sizeof(info->name), "%s", name);
+  info->registers = regs;
+  info->localbytes = local;
+  info->sharedbytes = shared + dynamicSharedMem;
+  info->maxthreads = maxThreads;
+  info->blocksize = blockSize;
+  info->occupancy = (double)numBlocks*blockSize/maxThreadsCU;
   return 0;
 }
 
@@ -121,7 +362,7 @@ int CeedGetKernelHip(Ceed ceed, hipModule_t module, const char *name,
 int CeedRunKernelHip(Ceed ceed, hipFunction_t kernel, const int gridSize,
                       const int blockSize, void **args) {
   CeedChk_Hip(ceed, hipModuleLaunchKernel(kernel, gridSize, 1, 1, blockSize, 1,
-                                  1, 0, NULL, args, NULL));
+                                  1, 0, CeedHipGetStream(), args, NULL));
   return 0;
 }
 
@@ -133,7 +374,7 @@ int CeedRunKernelDimHip(Ceed ceed, hipFunction_t kernel, const int gridSize,
                          const int blockSizeZ, void **args) {
   CeedChk_Hip(ceed, hipModuleLaunchKernel(kernel, gridSize, 1, 1,
                                   blockSizeX, blockSizeY, blockSizeZ,
-                                  0, NULL, args, NULL));
+                                  0, CeedHipGetStream(), args, NULL));
   return 0;
 }
 
@@ -146,6 +387,7 @@ int CeedRunKernelDimSharedHip(Ceed ceed, hipFunction_t kernel, const int gridSiz
                                void **args) {
   CeedChk_Hip(ceed, hipModuleLaunchKernel(kernel, gridSize, 1, 1,
                                   blockSizeX, blockSizeY, blockSizeZ,
-                                  sharedMemSize, NULL, args, NULL));
+                                  sharedMemSize, CeedHipGetStream(),
+                                  args, NULL));
   return 0;
 }
@@ -20,14 +20,31 @@
 
 #include <hip/hip_runtime.h>
 
+// Runtime compilation of a kernel, possibly on another thread
+typedef struct CeedHipJit_private *CeedHipJit;
+
 CEED_INTERN int CeedCompileHip(Ceed ceed, const char *source,
                                hipModule_t *module,
                                const CeedInt numopts, ...);
 
+CEED_INTERN int CeedCompileHipAsync(Ceed ceed, const char *source,
+                                    CeedHipJit *jit,
+                                    const CeedInt numopts, ...);
+
+CEED_INTERN int CeedCompileHipWait(Ceed ceed, CeedHipJit *jit,
+                                   hipModule_t *module);
+
 CEED_INTERN int CeedGetKernelHip(Ceed ceed, hipModule_t module,
                                  const char *name,
                                  hipFunction_t *kernel);
 
+CEED_INTERN int CeedGetKernelInfoHip(Ceed ceed, hipFunction_t kernel,
+                                     const char *name, int blockSize,
+                                     size_t dynamicSharedMem,
+                                     CeedKernelInfo *info);
+
+CEED_INTERN int CeedHipQueryDevice(Ceed ceed);
+
 CEED_INTERN int CeedRunKernelHip(Ceed ceed, hipFunction_t kernel,
                                  const int gridSize,
                                  const int blockSize, void **args);
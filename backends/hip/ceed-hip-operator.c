@@ -19,6 +19,28 @@
 #include <string.h>
 #include <math.h>
 
+//------------------------------------------------------------------------------
+// Destroy composite suboperator streams and outputs
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroySubStreams_Hip(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Hip *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  for (CeedInt i = 0; i < impl->numsubstreams; i++) {
+    ierr = hipStreamDestroy(impl->substreams[i]); CeedChk_Hip(ceed, ierr);
+    ierr = hipEventDestroy(impl->subevents[i]); CeedChk_Hip(ceed, ierr);
+    ierr = CeedVectorDestroy(&impl->suboutvecs[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->substreams); CeedChk(ierr);
+  ierr = CeedFree(&impl->subevents); CeedChk(ierr);
+  ierr = CeedFree(&impl->suboutvecs); CeedChk(ierr);
+  impl->numsubstreams = 0;
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Destroy operator
 //------------------------------------------------------------------------------
@@ -44,6 +66,19 @@ static int CeedOperatorDestroy_Hip(CeedOperator op) {
   }
   ierr = CeedFree(&impl->qvecsout); CeedChk(ierr);
 
+  // Reduced precision data
+  if (impl->d_elow) {
+    Ceed ceed;
+    ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+    for (CeedInt i = 0; i < impl->numein; i++) {
+      ierr = CeedHipFree(ceed, impl->d_elow[i]); CeedChk(ierr);
+    }
+    if (impl->storagemodule)
+      CeedChk_Hip(ceed, hipModuleUnload(impl->storagemodule));
+  }
+  ierr = CeedFree(&impl->d_elow); CeedChk(ierr);
+  ierr = CeedFree(&impl->inputstate); CeedChk(ierr);
+
   // Diag data
   if (impl->diag) {
     Ceed ceed;
@@ -51,17 +86,34 @@ static int CeedOperatorDestroy_Hip(CeedOperator op) {
     CeedChk_Hip(ceed, hipModuleUnload(impl->diag->module));
     ierr = CeedFree(&impl->diag->h_emodein); CeedChk(ierr);
     ierr = CeedFree(&impl->diag->h_emodeout); CeedChk(ierr);
-    ierr = hipFree(impl->diag->d_emodein); CeedChk_Hip(ceed, ierr);
-    ierr = hipFree(impl->diag->d_emodeout); CeedChk_Hip(ceed, ierr);
-    ierr = hipFree(impl->diag->d_identity); CeedChk_Hip(ceed, ierr);
-    ierr = hipFree(impl->diag->d_interpin); CeedChk_Hip(ceed, ierr);
-    ierr = hipFree(impl->diag->d_interpout); CeedChk_Hip(ceed, ierr);
-    ierr = hipFree(impl->diag->d_gradin); CeedChk_Hip(ceed, ierr);
-    ierr = hipFree(impl->diag->d_gradout); CeedChk_Hip(ceed, ierr);
+    ierr = CeedHipFree(ceed, impl->diag->d_emodein); CeedChk(ierr);
+    ierr = CeedHipFree(ceed, impl->diag->d_emodeout); CeedChk(ierr);
+    ierr = CeedHipFree(ceed, impl->diag->d_identity); CeedChk(ierr);
+    ierr = CeedHipFree(ceed, impl->diag->d_interpin); CeedChk(ierr);
+    ierr = CeedHipFree(ceed, impl->diag->d_interpout); CeedChk(ierr);
+    ierr = CeedHipFree(ceed, impl->diag->d_gradin); CeedChk(ierr);
+    ierr = CeedHipFree(ceed, impl->diag->d_gradout); CeedChk(ierr);
     ierr = CeedElemRestrictionDestroy(&impl->diag->pbdiagrstr); CeedChk(ierr);
   }
   ierr = CeedFree(&impl->diag); CeedChk(ierr);
 
+  // Graph data
+  if (impl->graph || impl->graphstream) {
+    Ceed ceed;
+    ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+    if (impl->graph) {
+      ierr = hipGraphExecDestroy(impl->graph); CeedChk_Hip(ceed, ierr);
+    }
+    if (impl->graphstream) {
+      ierr = hipStreamDestroy(impl->graphstream); CeedChk_Hip(ceed, ierr);
+    }
+  }
+  ierr = CeedFree(&impl->streamceeds); CeedChk(ierr);
+  ierr = CeedFree(&impl->graphptrs); CeedChk(ierr);
+
+  // Composite data
+  ierr = CeedOperatorDestroySubStreams_Hip(op); CeedChk(ierr);
+
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
 }
@@ -82,6 +134,7 @@ static int CeedOperatorSetupFields_Hip(CeedQFunction qf, CeedOperator op,
   CeedOperatorField *opfields;
   CeedQFunctionField *qffields;
   CeedVector fieldvec;
+  CeedStorageType storage;
   bool strided;
   bool skiprestrict;
 
@@ -104,6 +157,7 @@ static int CeedOperatorSetupFields_Hip(CeedQFunction qf, CeedOperator op,
 
     strided = false;
     skiprestrict = false;
+    storage = CEED_STORAGE_SCALAR;
     if (emode != CEED_EVAL_WEIGHT) {
       ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &Erestrict);
       CeedChk(ierr);
@@ -117,6 +171,8 @@ static int CeedOperatorSetupFields_Hip(CeedQFunction qf, CeedOperator op,
         // Check for passive input:
         ierr = CeedOperatorFieldGetVector(opfields[i], &fieldvec); CeedChk(ierr);
         if (fieldvec != CEED_VECTOR_ACTIVE) {
+          ierr = CeedOperatorFieldGetStorage(opfields[i], &storage);
+          CeedChk(ierr);
           // Check emode
           if (emode == CEED_EVAL_NONE) {
             // Check for strided restriction
@@ -134,6 +190,9 @@ static int CeedOperatorSetupFields_Hip(CeedQFunction qf, CeedOperator op,
         // We do not need an E-Vector, but will use the input field vector's data
         // directly in the operator application.
         evecs[i + starte] = NULL;
+      } else if (storage != CEED_STORAGE_SCALAR) {
+        // Reduced precision inputs are kept in d_elow instead of an E-Vector
+        evecs[i + starte] = NULL;
       } else {
         ierr = CeedElemRestrictionCreateVector(Erestrict, NULL,
                                                &evecs[i + starte]);
@@ -170,10 +229,283 @@ static int CeedOperatorSetupFields_Hip(CeedQFunction qf, CeedOperator op,
     case CEED_EVAL_CURL:
       break; // TODO: Not implemented
     }
+
+    // Work vectors are accounted to the operator
+    ierr = CeedVectorSetMemoryClass(evecs[i + starte], CEED_MEMORY_EVECTOR);
+    CeedChk(ierr);
+    ierr = CeedVectorSetMemoryClass(qvecs[i], CEED_MEMORY_EVECTOR);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Storage conversion kernels
+//------------------------------------------------------------------------------
+// *INDENT-OFF*
+static const char *storagekernels = QUOTE(
+
+extern "C" __global__ void narrowFp32(const CeedInt n,
+    const CeedScalar *__restrict__ u, float *__restrict__ v) {
+  for (CeedInt i = blockIdx.x*blockDim.x + threadIdx.x; i < n;
+       i += blockDim.x*gridDim.x)
+    v[i] = u[i];
+}
+
+extern "C" __global__ void widenFp32(const CeedInt n,
+    const float *__restrict__ u, CeedScalar *__restrict__ v) {
+  for (CeedInt i = blockIdx.x*blockDim.x + threadIdx.x; i < n;
+       i += blockDim.x*gridDim.x)
+    v[i] = u[i];
+}
+
+extern "C" __global__ void narrowBf16(const CeedInt n,
+    const CeedScalar *__restrict__ u, unsigned short *__restrict__ v) {
+  for (CeedInt i = blockIdx.x*blockDim.x + threadIdx.x; i < n;
+       i += blockDim.x*gridDim.x) {
+    const float f = u[i];
+    unsigned int b = __float_as_uint(f);
+    if (isnan(f))
+      b |= 0x00400000; // Keep NaN after truncation
+    else
+      b += 0x7fff + ((b >> 16) & 1); // Round to nearest even
+    v[i] = b >> 16;
+  }
+}
+
+extern "C" __global__ void widenBf16(const CeedInt n,
+    const unsigned short *__restrict__ u, CeedScalar *__restrict__ v) {
+  for (CeedInt i = blockIdx.x*blockDim.x + threadIdx.x; i < n;
+       i += blockDim.x*gridDim.x)
+    v[i] = __uint_as_float(((unsigned int)u[i]) << 16);
+}
+
+);
+// *INDENT-ON*
+
+//------------------------------------------------------------------------------
+// Setup reduced precision inputs
+//
+// Scratch space for the widened values comes from the memory pool for each
+//   apply, so these operators are not captured into HIP graphs.
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupStorage_Hip(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Hip *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedOperatorField *opinputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, NULL); CeedChk(ierr);
+
+  ierr = CeedCalloc(impl->numein, &impl->d_elow); CeedChk(ierr);
+  ierr = CeedCalloc(impl->numein, &impl->inputstate); CeedChk(ierr);
+  for (CeedInt i = 0; i < impl->numein; i++) {
+    CeedStorageType storage;
+    ierr = CeedOperatorFieldGetStorage(opinputfields[i], &storage);
+    CeedChk(ierr);
+    if (storage == CEED_STORAGE_SCALAR)
+      continue;
+
+    // Conversion kernels
+    if (!impl->storagemodule) {
+      ierr = CeedCompileHip(ceed, storagekernels, &impl->storagemodule, 0);
+      CeedChk(ierr);
+      ierr = CeedGetKernelHip(ceed, impl->storagemodule, "narrowFp32",
+                               &impl->narrow[CEED_STORAGE_FP32]);
+      CeedChk(ierr);
+      ierr = CeedGetKernelHip(ceed, impl->storagemodule, "widenFp32",
+                               &impl->widen[CEED_STORAGE_FP32]);
+      CeedChk(ierr);
+      ierr = CeedGetKernelHip(ceed, impl->storagemodule, "narrowBf16",
+                               &impl->narrow[CEED_STORAGE_BF16]);
+      CeedChk(ierr);
+      ierr = CeedGetKernelHip(ceed, impl->storagemodule, "widenBf16",
+                               &impl->widen[CEED_STORAGE_BF16]);
+      CeedChk(ierr);
+    }
+
+    // Reduced precision E-vector
+    CeedElemRestriction Erestrict;
+    CeedInt nelem, elemsize, ncomp;
+    size_t bytes;
+    ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumElements(Erestrict, &nelem); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(Erestrict, &ncomp);
+    CeedChk(ierr);
+    ierr = CeedStorageGetSize(storage, &bytes); CeedChk(ierr);
+    ierr = CeedHipMalloc(ceed, &impl->d_elow[i], nelem*elemsize*ncomp*bytes);
+    CeedChk(ierr);
+    impl->streamcapable = false;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Restrict, narrow, and widen reduced precision inputs
+//
+// The restricted values are narrowed only when the input vector changes. Each
+//   apply widens them into scratch space that is returned to the pool by
+//   CeedOperatorRestoreStorage_Hip, so only the reduced precision copy
+//   persists between applies.
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyStorage_Hip(CeedOperator op,
+    CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Hip *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedOperatorField *opinputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, NULL); CeedChk(ierr);
+  const CeedInt blocksize = 512;
+
+  for (CeedInt i = 0; i < impl->numein; i++) {
+    if (!impl->d_elow[i])
+      continue;
+    CeedStorageType storage;
+    CeedVector vec;
+    CeedElemRestriction Erestrict;
+    CeedInt length;
+    uint64_t state;
+    ierr = CeedOperatorFieldGetStorage(opinputfields[i], &storage);
+    CeedChk(ierr);
+    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
+    CeedChk(ierr);
+    ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
+    if (state != impl->inputstate[i]) {
+      // Restrict and narrow
+      CeedVector evec;
+      const CeedScalar *d_e;
+      ierr = CeedElemRestrictionCreateVector(Erestrict, NULL, &evec);
+      CeedChk(ierr);
+      ierr = CeedElemRestrictionApply(Erestrict, CEED_NOTRANSPOSE, vec, evec,
+                                      request); CeedChk(ierr);
+      ierr = CeedVectorGetLength(evec, &length); CeedChk(ierr);
+      ierr = CeedVectorGetArrayRead(evec, CEED_MEM_DEVICE, &d_e); CeedChk(ierr);
+      void *args[] = {&length, &d_e, &impl->d_elow[i]};
+      ierr = CeedRunKernelHip(ceed, impl->narrow[storage],
+                               CeedDivUpInt(length, blocksize), blocksize,
+                               args); CeedChk(ierr);
+      ierr = CeedVectorRestoreArrayRead(evec, &d_e); CeedChk(ierr);
+      ierr = CeedVectorDestroy(&evec); CeedChk(ierr);
+      impl->inputstate[i] = state;
+    }
+    // Widen
+    CeedInt nelem, elemsize, ncomp;
+    ierr = CeedElemRestrictionGetNumElements(Erestrict, &nelem); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumComponents(Erestrict, &ncomp);
+    CeedChk(ierr);
+    length = nelem*elemsize*ncomp;
+    ierr = CeedHipMalloc(ceed, (void **)&impl->edata[i],
+                          length*sizeof(CeedScalar)); CeedChk(ierr);
+    void *args[] = {&length, &impl->d_elow[i], &impl->edata[i]};
+    ierr = CeedRunKernelHip(ceed, impl->widen[storage],
+                             CeedDivUpInt(length, blocksize), blocksize, args);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Return widened reduced precision inputs to the memory pool
+//------------------------------------------------------------------------------
+static int CeedOperatorRestoreStorage_Hip(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Hip *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  for (CeedInt i = 0; i < impl->numein; i++) {
+    if (!impl->d_elow[i])
+      continue;
+    ierr = CeedHipFree(ceed, impl->edata[i]); CeedChk(ierr);
+    impl->edata[i] = NULL;
   }
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Setup launch streams
+//
+// The kernels of an apply can be redirected to another stream, with
+//   CeedHipSetStream() on the applying thread, to capture them into a HIP
+//   graph or to run them concurrently with other operators, when they all
+//   launch through HIP backend Ceeds.
+//------------------------------------------------------------------------------
+static int CeedOperatorAddStreamCeed_Hip(Ceed ceed, CeedOperator_Hip *impl) {
+  int ierr;
+  for (CeedInt i = 0; i < impl->numstreamceeds; i++)
+    if (impl->streamceeds[i] == ceed)
+      return 0;
+  const char *resource;
+  ierr = CeedGetResource(ceed, &resource); CeedChk(ierr);
+  if (strncmp(resource, "/gpu/hip", 8) || strstr(resource, "magma"))
+    impl->streamcapable = false;
+  impl->streamceeds[impl->numstreamceeds++] = ceed;
+  return 0;
+}
+
+static int CeedOperatorSetupStreams_Hip(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Hip *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opfields[2];
+  ierr = CeedOperatorGetFields(op, &opfields[0], &opfields[1]); CeedChk(ierr);
+  const CeedInt numfields[2] = {numinputfields, numoutputfields};
+
+  // Collect Ceeds of the QFunction, restrictions, and bases
+  impl->streamcapable = true;
+  ierr = CeedCalloc(2*(numinputfields + numoutputfields) + 2,
+                    &impl->streamceeds); CeedChk(ierr);
+  ierr = CeedOperatorAddStreamCeed_Hip(ceed, impl); CeedChk(ierr);
+  ierr = CeedQFunctionGetCeed(qf, &ceed); CeedChk(ierr);
+  ierr = CeedOperatorAddStreamCeed_Hip(ceed, impl); CeedChk(ierr);
+  for (CeedInt k = 0; k < 2; k++)
+    for (CeedInt i = 0; i < numfields[k]; i++) {
+      CeedElemRestriction rstr;
+      ierr = CeedOperatorFieldGetElemRestriction(opfields[k][i], &rstr);
+      CeedChk(ierr);
+      if (rstr != CEED_ELEMRESTRICTION_NONE) {
+        ierr = CeedElemRestrictionGetCeed(rstr, &ceed); CeedChk(ierr);
+        ierr = CeedOperatorAddStreamCeed_Hip(ceed, impl); CeedChk(ierr);
+      }
+      CeedBasis basis;
+      ierr = CeedOperatorFieldGetBasis(opfields[k][i], &basis); CeedChk(ierr);
+      if (basis != CEED_BASIS_COLLOCATED) {
+        ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
+        ierr = CeedOperatorAddStreamCeed_Hip(ceed, impl); CeedChk(ierr);
+      }
+    }
+
+  // A QFunction field table in device memory is refilled by each apply, which
+  //   capture and concurrent applies of operators sharing the QFunction can't
+  //   order
+  const CeedInt numslots = CeedIntMax(numinputfields, CEED_HIP_MIN_FIELD_SLOTS)
+                           + CeedIntMax(numoutputfields, CEED_HIP_MIN_FIELD_SLOTS);
+  if (numslots*sizeof(CeedScalar *) > CEED_HIP_MAX_FIELDS_BYTES)
+    impl->streamcapable = false;
+
+  // Captured arrays, followed by scratch space for the current arrays
+  ierr = CeedCalloc(2*(numinputfields + numoutputfields + 1),
+                    &impl->graphptrs); CeedChk(ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // CeedOperator needs to connect all the named fields (be they active or passive)
 //   to the named inputs and outputs of its CeedQFunction.
@@ -208,8 +540,8 @@ static int CeedOperatorSetup_Hip(CeedOperator op) {
   ierr = CeedCalloc(numinputfields + numoutputfields, &impl->edata);
   CeedChk(ierr);
 
-  ierr = CeedCalloc(16, &impl->qvecsin); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->qvecsout); CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->qvecsin); CeedChk(ierr);
+  ierr = CeedCalloc(numoutputfields, &impl->qvecsout); CeedChk(ierr);
 
   impl->numein = numinputfields; impl->numeout = numoutputfields;
 
@@ -226,6 +558,12 @@ static int CeedOperatorSetup_Hip(CeedOperator op) {
                                      numinputfields, numoutputfields, Q,
                                      numelements); CeedChk(ierr);
 
+  // Launch streams
+  ierr = CeedOperatorSetupStreams_Hip(op); CeedChk(ierr);
+
+  // Reduced precision inputs
+  ierr = CeedOperatorSetupStorage_Hip(op); CeedChk(ierr);
+
   ierr = CeedOperatorSetSetupDone(op); CeedChk(ierr);
   return 0;
 }
@@ -255,6 +593,7 @@ static inline int CeedOperatorSetupInputs_Hip(CeedInt numinputfields,
     ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
     CeedChk(ierr);
     if (emode == CEED_EVAL_WEIGHT) { // Skip
+    } else if (impl->d_elow[i]) { // Set by CeedOperatorApplyStorage_Hip
     } else {
       // Get input vector
       ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
@@ -360,6 +699,7 @@ static inline int CeedOperatorRestoreInputs_Hip(CeedInt numinputfields,
     ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
     CeedChk(ierr);
     if (emode == CEED_EVAL_WEIGHT) { // Skip
+    } else if (impl->d_elow[i]) { // Released by CeedOperatorRestoreStorage_Hip
     } else {
       if (!impl->evecs[i]) {  // This was a skiprestrict case
         ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
@@ -377,10 +717,10 @@ static inline int CeedOperatorRestoreInputs_Hip(CeedInt numinputfields,
 }
 
 //------------------------------------------------------------------------------
-// Apply and add to output
+// Apply and add to output, or overwrite the output
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Hip(CeedOperator op, CeedVector invec,
-                                    CeedVector outvec, CeedRequest *request) {
+static int CeedOperatorApplyCore_Hip(CeedOperator op, CeedVector invec,
+    CeedVector outvec, bool overwrite, CeedRequest *request) {
   int ierr;
   CeedOperator_Hip *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
@@ -402,10 +742,8 @@ static int CeedOperatorApplyAdd_Hip(CeedOperator op, CeedVector invec,
   CeedBasis basis;
   CeedElemRestriction Erestrict;
 
-  // Setup
-  ierr = CeedOperatorSetup_Hip(op); CeedChk(ierr);
-
   // Input Evecs and Restriction
+  ierr = CeedOperatorApplyStorage_Hip(op, request); CeedChk(ierr);
   ierr = CeedOperatorSetupInputs_Hip(numinputfields, qfinputfields,
                                      opinputfields, invec, false, impl,
                                      request); CeedChk(ierr);
@@ -497,23 +835,237 @@ static int CeedOperatorApplyAdd_Hip(CeedOperator op, CeedVector invec,
     if (vec == CEED_VECTOR_ACTIVE)
       vec = outvec;
 
-    ierr = CeedElemRestrictionApply(Erestrict, CEED_TRANSPOSE,
-                                    impl->evecs[i + impl->numein], vec,
-                                    request); CeedChk(ierr);
+    // Overwrite with the first field that writes each vector
+    bool first = overwrite;
+    for (CeedInt j = 0; j < i && first; j++) {
+      CeedVector prevvec;
+      ierr = CeedOperatorFieldGetVector(opoutputfields[j], &prevvec);
+      CeedChk(ierr);
+      first = (prevvec == CEED_VECTOR_ACTIVE ? outvec : prevvec) != vec;
+    }
+    if (first) {
+      ierr = CeedElemRestrictionApplyOverwrite(Erestrict,
+             impl->evecs[i + impl->numein], vec, request); CeedChk(ierr);
+    } else {
+      ierr = CeedElemRestrictionApply(Erestrict, CEED_TRANSPOSE,
+                                      impl->evecs[i + impl->numein], vec,
+                                      request); CeedChk(ierr);
+    }
   }
 
   // Restore input arrays
   ierr = CeedOperatorRestoreInputs_Hip(numinputfields, qfinputfields,
                                        opinputfields, false, impl);
   CeedChk(ierr);
+  ierr = CeedOperatorRestoreStorage_Hip(op); CeedChk(ierr);
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// Assemble Linear QFunction
+// Get device arrays read or written by an apply
+//
+// This also completes any pending transfers to the device, so a captured graph
+//   can be launched without further synchronization.
 //------------------------------------------------------------------------------
-static int CeedOperatorLinearAssembleQFunction_Hip(CeedOperator op,
-    CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+static int CeedOperatorGetGraphArrays_Hip(CeedOperator op, CeedVector invec,
+    CeedVector outvec, const void **ptrs) {
+  int ierr;
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+  CeedVector vec;
+
+  for (CeedInt i = 0; i < numinputfields; i++) {
+    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) vec = invec;
+    ptrs[i] = NULL;
+    if (vec != CEED_VECTOR_NONE) {
+      const CeedScalar *array;
+      ierr = CeedVectorGetArrayRead(vec, CEED_MEM_DEVICE, &array);
+      CeedChk(ierr);
+      ptrs[i] = array;
+      ierr = CeedVectorRestoreArrayRead(vec, &array); CeedChk(ierr);
+    }
+  }
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) vec = outvec;
+    CeedScalar *array;
+    ierr = CeedVectorGetArray(vec, CEED_MEM_DEVICE, &array); CeedChk(ierr);
+    ptrs[numinputfields + i] = array;
+    ierr = CeedVectorRestoreArray(vec, &array); CeedChk(ierr);
+  }
+  CeedQFunctionContext ctx;
+  ierr = CeedQFunctionGetInnerContext(qf, &ctx); CeedChk(ierr);
+  ptrs[numinputfields + numoutputfields] = NULL;
+  if (ctx) {
+    void *data;
+    ierr = CeedQFunctionContextGetData(ctx, CEED_MEM_DEVICE, &data);
+    CeedChk(ierr);
+    ptrs[numinputfields + numoutputfields] = data;
+    ierr = CeedQFunctionContextRestoreData(ctx, &data); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Capture apply into a HIP graph
+//------------------------------------------------------------------------------
+static int CeedOperatorCaptureGraph_Hip(CeedOperator op, CeedVector invec,
+    CeedVector outvec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Hip *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  if (!impl->graphstream) {
+    ierr = hipStreamCreateWithFlags(&impl->graphstream,
+                                    hipStreamNonBlocking);
+    CeedChk_Hip(ceed, ierr);
+  }
+
+  // Redirect kernel launches to the capture stream
+  hipStream_t stream = CeedHipGetStream();
+  CeedHipSetStream(impl->graphstream);
+  hipGraph_t graph;
+  ierr = hipStreamBeginCapture(impl->graphstream,
+                               hipStreamCaptureModeThreadLocal);
+  CeedChk_Hip(ceed, ierr);
+  int ierrapply = CeedOperatorApplyCore_Hip(op, invec, outvec, false,
+                  CEED_REQUEST_IMMEDIATE);
+  ierr = hipStreamEndCapture(impl->graphstream, &graph);
+  CeedHipSetStream(stream);
+  CeedChk(ierrapply);
+  CeedChk_Hip(ceed, ierr);
+
+  ierr = hipGraphInstantiate(&impl->graph, graph, NULL, NULL, 0);
+  CeedChk_Hip(ceed, ierr);
+  ierr = hipGraphDestroy(graph); CeedChk_Hip(ceed, ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Apply and add to output
+//
+// With CEED_GRAPHS=1, the second and later applies replay a HIP graph of the
+//   kernels launched by the apply, captured while the device arrays of the
+//   input, output, and context stay the same.
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Hip(CeedOperator op, CeedVector invec,
+                                    CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Hip *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  // Setup
+  ierr = CeedOperatorSetup_Hip(op); CeedChk(ierr);
+
+  // Graphs are not used while profiling, which times each kernel separately
+  Ceed_Hip *ceed_Hip;
+  ierr = CeedHipGetSharedData(ceed, &ceed_Hip); CeedChk(ierr);
+  bool profiling = false, usegraph = ceed_Hip->graphs &&
+                                     impl->streamcapable && impl->numapplies++;
+  if (usegraph) {
+    ierr = CeedIsProfiling(ceed, &profiling); CeedChk(ierr);
+    usegraph = !profiling;
+  }
+
+  if (!usegraph) {
+    ierr = CeedOperatorApplyCore_Hip(op, invec, outvec, false, request);
+    CeedChk(ierr);
+  } else {
+    CeedInt numinputfields, numoutputfields;
+    CeedQFunction qf;
+    ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+    ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+    CeedChk(ierr);
+    const CeedInt numptrs = numinputfields + numoutputfields + 1;
+    const void **ptrs = impl->graphptrs + numptrs;
+    ierr = CeedOperatorGetGraphArrays_Hip(op, invec, outvec, ptrs);
+    CeedChk(ierr);
+
+    // Recapture if any array moved
+    if (impl->graph && memcmp(ptrs, impl->graphptrs, numptrs*sizeof(ptrs[0]))) {
+      ierr = hipGraphExecDestroy(impl->graph); CeedChk_Hip(ceed, ierr);
+      impl->graph = NULL;
+    }
+    if (!impl->graph) {
+      ierr = CeedOperatorCaptureGraph_Hip(op, invec, outvec); CeedChk(ierr);
+      memcpy(impl->graphptrs, ptrs, numptrs*sizeof(ptrs[0]));
+    }
+    ierr = hipGraphLaunch(impl->graph, CeedHipGetStream());
+    CeedChk_Hip(ceed, ierr);
+  }
+
+  // Completion request
+  ierr = CeedRequestRecord_Hip(ceed, request); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Apply, overwriting the output
+//
+// The first restriction into each output vector stores instead of adds, so
+//   the output is not zeroed first. Operators replayed from graphs zero the
+//   output and add, keeping the captured graph.
+//------------------------------------------------------------------------------
+static int CeedOperatorApply_Hip(CeedOperator op, CeedVector invec,
+                                CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Hip *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  // Setup
+  ierr = CeedOperatorSetup_Hip(op); CeedChk(ierr);
+
+  Ceed_Hip *ceed_Hip;
+  ierr = CeedGetData(ceed, &ceed_Hip); CeedChk(ierr);
+  if (ceed_Hip->graphs && impl->streamcapable) {
+    CeedQFunction qf;
+    ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+    CeedInt numinputfields, numoutputfields;
+    ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+    CeedChk(ierr);
+    CeedOperatorField *opinputfields, *opoutputfields;
+    ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+    CeedChk(ierr);
+    for (CeedInt i = 0; i < numoutputfields; i++) {
+      CeedVector vec;
+      ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
+      if (vec == CEED_VECTOR_ACTIVE)
+        vec = outvec;
+      if (vec != CEED_VECTOR_NONE) {
+        ierr = CeedVectorSetValue(vec, 0.0); CeedChk(ierr);
+      }
+    }
+    return CeedOperatorApplyAdd_Hip(op, invec, outvec, request);
+  }
+
+  ierr = CeedOperatorApplyCore_Hip(op, invec, outvec, true, request);
+  CeedChk(ierr);
+
+  // Completion request
+  ierr = CeedRequestRecord_Hip(ceed, request); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction, creating the restriction and vector on build or
+//   refilling the given ones on update
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionCore_Hip(CeedOperator op,
+    bool buildobjects, CeedVector *assembled, CeedElemRestriction *rstr,
+    CeedRequest *request) {
   int ierr;
   CeedOperator_Hip *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
@@ -551,6 +1103,7 @@ static int CeedOperatorLinearAssembleQFunction_Hip(CeedOperator op,
   // LCOV_EXCL_STOP
 
   // Input Evecs and Restriction
+  ierr = CeedOperatorApplyStorage_Hip(op, request); CeedChk(ierr);
   ierr = CeedOperatorSetupInputs_Hip(numinputfields, qfinputfields,
                                      opinputfields, NULL, true, impl, request);
   CeedChk(ierr);
@@ -596,15 +1149,17 @@ static int CeedOperatorLinearAssembleQFunction_Hip(CeedOperator op,
                      "and outputs");
   // LCOV_EXCL_STOP
 
-  // Create output restriction
-  CeedInt strides[3] = {1, numelements*Q, Q}; /* *NOPAD* */
-  ierr = CeedElemRestrictionCreateStrided(ceedparent, numelements, Q,
-                                          numactivein*numactiveout,
-                                          numactivein*numactiveout*numelements*Q,
-                                          strides, rstr); CeedChk(ierr);
-  // Create assembled vector
-  ierr = CeedVectorCreate(ceedparent, numelements*Q*numactivein*numactiveout,
-                          assembled); CeedChk(ierr);
+  if (buildobjects) {
+    // Create output restriction
+    CeedInt strides[3] = {1, numelements*Q, Q}; /* *NOPAD* */
+    ierr = CeedElemRestrictionCreateStrided(ceedparent, numelements, Q,
+                                            numactivein*numactiveout,
+                                            numactivein*numactiveout*numelements*Q,
+                                            strides, rstr); CeedChk(ierr);
+    // Create assembled vector
+    ierr = CeedVectorCreate(ceedparent, numelements*Q*numactivein*numactiveout,
+                            assembled); CeedChk(ierr);
+  }
   ierr = CeedVectorSetValue(*assembled, 0.0); CeedChk(ierr);
   ierr = CeedVectorGetArray(*assembled, CEED_MEM_DEVICE, &a); CeedChk(ierr);
 
@@ -657,6 +1212,7 @@ static int CeedOperatorLinearAssembleQFunction_Hip(CeedOperator op,
   ierr = CeedOperatorRestoreInputs_Hip(numinputfields, qfinputfields,
                                        opinputfields, true, impl);
   CeedChk(ierr);
+  ierr = CeedOperatorRestoreStorage_Hip(op); CeedChk(ierr);
 
   // Restore output
   ierr = CeedVectorRestoreArray(*assembled, &a); CeedChk(ierr);
@@ -670,6 +1226,24 @@ static int CeedOperatorLinearAssembleQFunction_Hip(CeedOperator op,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunction_Hip(CeedOperator op,
+    CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+  return CeedOperatorLinearAssembleQFunctionCore_Hip(op, true, assembled, rstr,
+         request);
+}
+
+//------------------------------------------------------------------------------
+// Update Assembled Linear QFunction
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionUpdate_Hip(CeedOperator op,
+    CeedVector assembled, CeedElemRestriction rstr, CeedRequest *request) {
+  return CeedOperatorLinearAssembleQFunctionCore_Hip(op, false, &assembled,
+         &rstr, request);
+}
+
 //------------------------------------------------------------------------------
 // Diagonal assembly kernels
 //------------------------------------------------------------------------------
@@ -1008,38 +1582,40 @@ static inline int CeedOperatorAssembleDiagonalSetup_Hip(CeedOperator op,
     ierr = CeedCalloc(nqpts*nnodes, &identity); CeedChk(ierr);
     for (CeedInt i=0; i<(nnodes<nqpts?nnodes:nqpts); i++)
       identity[i*nnodes+i] = 1.0;
-    ierr = hipMalloc((void **)&diag->d_identity, iBytes); CeedChk_Hip(ceed, ierr);
+    ierr = CeedHipMalloc(ceed, (void **)&diag->d_identity, iBytes);
+    CeedChk(ierr);
     ierr = hipMemcpy(diag->d_identity, identity, iBytes,
                      hipMemcpyHostToDevice); CeedChk_Hip(ceed, ierr);
   }
 
   // CEED_EVAL_INTERP
   ierr = CeedBasisGetInterp(basisin, &interpin); CeedChk(ierr);
-  ierr = hipMalloc((void **)&diag->d_interpin, iBytes); CeedChk_Hip(ceed, ierr);
+  ierr = CeedHipMalloc(ceed, (void **)&diag->d_interpin, iBytes); CeedChk(ierr);
   ierr = hipMemcpy(diag->d_interpin, interpin, iBytes,
                    hipMemcpyHostToDevice); CeedChk_Hip(ceed, ierr);
   ierr = CeedBasisGetInterp(basisout, &interpout); CeedChk(ierr);
-  ierr = hipMalloc((void **)&diag->d_interpout, iBytes); CeedChk_Hip(ceed, ierr);
+  ierr = CeedHipMalloc(ceed, (void **)&diag->d_interpout, iBytes);
+  CeedChk(ierr);
   ierr = hipMemcpy(diag->d_interpout, interpout, iBytes,
                    hipMemcpyHostToDevice); CeedChk_Hip(ceed, ierr);
 
   // CEED_EVAL_GRAD
   ierr = CeedBasisGetGrad(basisin, &gradin); CeedChk(ierr);
-  ierr = hipMalloc((void **)&diag->d_gradin, gBytes); CeedChk_Hip(ceed, ierr);
+  ierr = CeedHipMalloc(ceed, (void **)&diag->d_gradin, gBytes); CeedChk(ierr);
   ierr = hipMemcpy(diag->d_gradin, gradin, gBytes,
                    hipMemcpyHostToDevice); CeedChk_Hip(ceed, ierr);
   ierr = CeedBasisGetGrad(basisout, &gradout); CeedChk(ierr);
-  ierr = hipMalloc((void **)&diag->d_gradout, gBytes); CeedChk_Hip(ceed, ierr);
+  ierr = CeedHipMalloc(ceed, (void **)&diag->d_gradout, gBytes); CeedChk(ierr);
   ierr = hipMemcpy(diag->d_gradout, gradout, gBytes,
                    hipMemcpyHostToDevice); CeedChk_Hip(ceed, ierr);
 
   // Arrays of emodes
-  ierr = hipMalloc((void **)&diag->d_emodein, numemodein * eBytes);
-  CeedChk_Hip(ceed, ierr);
+  ierr = CeedHipMalloc(ceed, (void **)&diag->d_emodein, numemodein * eBytes);
+  CeedChk(ierr);
   ierr = hipMemcpy(diag->d_emodein, emodein, numemodein * eBytes,
                    hipMemcpyHostToDevice); CeedChk_Hip(ceed, ierr);
-  ierr = hipMalloc((void **)&diag->d_emodeout, numemodeout * eBytes);
-  CeedChk_Hip(ceed, ierr);
+  ierr = CeedHipMalloc(ceed, (void **)&diag->d_emodeout, numemodeout * eBytes);
+  CeedChk(ierr);
   ierr = hipMemcpy(diag->d_emodeout, emodeout, numemodeout * eBytes,
                    hipMemcpyHostToDevice); CeedChk_Hip(ceed, ierr);
 
@@ -1063,7 +1639,8 @@ static inline int CeedOperatorAssembleDiagonalCore_Hip(CeedOperator op,
   // Assemble QFunction
   CeedVector assembledqf;
   CeedElemRestriction rstr;
-  ierr = CeedOperatorLinearAssembleQFunction(op,  &assembledqf, &rstr, request);
+  ierr = CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembledqf,
+         &rstr, request);
   CeedChk(ierr);
   ierr = CeedElemRestrictionDestroy(&rstr); CeedChk(ierr);
   CeedScalar maxnorm = 0;
@@ -1183,15 +1760,251 @@ static int CeedOperatorLinearAssembleAddPointBlockDiagonal_Hip(CeedOperator op,
 }
 
 //------------------------------------------------------------------------------
-// Create FDM element inverse not supported
+// FDM element inverse kernels
+//------------------------------------------------------------------------------
+// *INDENT-OFF*
+static const char *fdmkernels = QUOTE(
+
+//------------------------------------------------------------------------------
+// FDM diagonal, one element per block and one node per thread
+//------------------------------------------------------------------------------
+extern "C" __global__ void fdmDiagonal(const CeedInt nelem,
+    const CeedScalar maxnorm, const CeedScalar *__restrict__ qweight,
+    const CeedScalar *__restrict__ lambda,
+    const CeedScalar *__restrict__ assembledqfarray,
+    CeedScalar *__restrict__ qdata) {
+  const CeedScalar qfvaluebound = maxnorm*1e-12;
+
+  for (CeedInt e = blockIdx.x; e < nelem; e += gridDim.x) {
+    // Element average of the assembled QFunction
+    CeedScalar elemavg = 0.;
+    CeedInt count = 0;
+    for (CeedInt i = 0; i < NFIELDS; i++)
+      for (CeedInt q = 0; q < NQPTS; q++) {
+        const CeedScalar qfvalue = assembledqfarray[(i*nelem+e)*NQPTS+q];
+        if (abs(qfvalue) > qfvaluebound) {
+          elemavg += qfvalue / qweight[q];
+          count++;
+        }
+      }
+    if (count)
+      elemavg /= count;
+
+    // Scaled inverse eigenvalues
+    for (CeedInt n = threadIdx.x; n < NNODES; n += blockDim.x) {
+      CeedScalar value = INTERP ? 1. : 0.;
+      if (GRAD)
+        for (CeedInt d = 0, stride = 1; d < DIM; d++, stride *= P1D)
+          value += lambda[(n / stride) % P1D];
+      for (CeedInt c = 0; c < NCOMP; c++)
+        qdata[(e*NCOMP+c)*NNODES+n] = 1. / (elemavg * value);
+    }
+  }
+}
+
+);
+// *INDENT-ON*
+
+//------------------------------------------------------------------------------
+// Create FDM element inverse
+//
+// The 1D mass and Laplacian are diagonalized on the host, as they are only
+//   P1d x P1d. The element averages of the assembled QFunction and the FDM
+//   diagonal are computed on the device, and the inverse is created with the
+//   parent Ceed, so it is applied on the device.
 //------------------------------------------------------------------------------
-static int CeedOperatorCreateFDMElementInverse_Hip(CeedOperator op) {
-  // LCOV_EXCL_START
+static int CeedOperatorCreateFDMElementInverse_Hip(CeedOperator op,
+    CeedOperator *fdminv, CeedRequest *request) {
   int ierr;
-  Ceed ceed;
+  Ceed ceed, ceedparent;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-  return CeedError(ceed, 1, "Backend does not implement FDM inverse creation");
+  ierr = CeedGetOperatorFallbackParentCeed(ceed, &ceedparent); CeedChk(ierr);
+  ceedparent = ceedparent ? ceedparent : ceed;
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+
+  // Determine active input basis
+  bool interp = false, grad = false;
+  CeedBasis basis = NULL;
+  CeedElemRestriction rstr = NULL;
+  CeedOperatorField *opfields;
+  CeedQFunctionField *qffields;
+  ierr = CeedOperatorGetFields(op, &opfields, NULL); CeedChk(ierr);
+  ierr = CeedQFunctionGetFields(qf, &qffields, NULL); CeedChk(ierr);
+  CeedInt numinputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, NULL); CeedChk(ierr);
+  for (CeedInt i = 0; i < numinputfields; i++) {
+    CeedVector vec;
+    ierr = CeedOperatorFieldGetVector(opfields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) {
+      CeedEvalMode emode;
+      ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode); CeedChk(ierr);
+      interp = interp || emode == CEED_EVAL_INTERP;
+      grad = grad || emode == CEED_EVAL_GRAD;
+      ierr = CeedOperatorFieldGetBasis(opfields[i], &basis); CeedChk(ierr);
+      ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &rstr);
+      CeedChk(ierr);
+    }
+  }
+  if (!basis)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "No active field set");
+  // LCOV_EXCL_STOP
+  CeedInt P1d, Q1d, elemsize, nqpts, dim, ncomp = 1, nelem = 1;
+  ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes(basis, &elemsize); CeedChk(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints(basis, &nqpts); CeedChk(ierr);
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumElements(rstr, &nelem); CeedChk(ierr);
+
+  // Build and diagonalize 1D Mass and Laplacian
+  bool tensorbasis;
+  ierr = CeedBasisIsTensor(basis, &tensorbasis); CeedChk(ierr);
+  if (!tensorbasis)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "FDMElementInverse only supported for tensor "
+                     "bases");
   // LCOV_EXCL_STOP
+  CeedScalar *work, *mass, *laplace, *x, *x2, *lambda;
+  ierr = CeedMalloc(Q1d*P1d, &work); CeedChk(ierr);
+  ierr = CeedMalloc(P1d*P1d, &mass); CeedChk(ierr);
+  ierr = CeedMalloc(P1d*P1d, &laplace); CeedChk(ierr);
+  ierr = CeedMalloc(P1d*P1d, &x); CeedChk(ierr);
+  ierr = CeedMalloc(P1d*P1d, &x2); CeedChk(ierr);
+  ierr = CeedMalloc(P1d, &lambda); CeedChk(ierr);
+  // -- Mass
+  const CeedScalar *interp1d, *grad1d, *qweight1d;
+  ierr = CeedBasisGetInterp1D(basis, &interp1d); CeedChk(ierr);
+  ierr = CeedBasisGetGrad1D(basis, &grad1d); CeedChk(ierr);
+  ierr = CeedBasisGetQWeights(basis, &qweight1d); CeedChk(ierr);
+  for (CeedInt i = 0; i < Q1d; i++)
+    for (CeedInt j = 0; j < P1d; j++)
+      work[i+j*Q1d] = interp1d[i*P1d+j]*qweight1d[i];
+  ierr = CeedMatrixMultiply(ceed, (const CeedScalar *)work,
+                            (const CeedScalar *)interp1d, mass, P1d, P1d, Q1d);
+  CeedChk(ierr);
+  // -- Laplacian
+  for (CeedInt i = 0; i < Q1d; i++)
+    for (CeedInt j = 0; j < P1d; j++)
+      work[i+j*Q1d] = grad1d[i*P1d+j]*qweight1d[i];
+  ierr = CeedMatrixMultiply(ceed, (const CeedScalar *)work,
+                            (const CeedScalar *)grad1d, laplace, P1d, P1d, Q1d);
+  CeedChk(ierr);
+  // -- Diagonalize
+  ierr = CeedSimultaneousDiagonalization(ceed, laplace, mass, x, lambda, P1d);
+  CeedChk(ierr);
+  ierr = CeedFree(&work); CeedChk(ierr);
+  ierr = CeedFree(&mass); CeedChk(ierr);
+  ierr = CeedFree(&laplace); CeedChk(ierr);
+  for (CeedInt i = 0; i < P1d; i++)
+    for (CeedInt j = 0; j < P1d; j++)
+      x2[i+j*P1d] = x[j+i*P1d];
+  ierr = CeedFree(&x); CeedChk(ierr);
+
+  // Assemble QFunction
+  CeedVector assembled;
+  CeedElemRestriction rstr_qf;
+  ierr = CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled,
+         &rstr_qf, request); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstr_qf); CeedChk(ierr);
+  CeedScalar maxnorm = 0;
+  ierr = CeedVectorNorm(assembled, CEED_NORM_MAX, &maxnorm); CeedChk(ierr);
+
+  // Quadrature weights and 1D eigenvalues
+  CeedVector qweights, lambdavec;
+  ierr = CeedVectorCreate(ceedparent, nqpts, &qweights); CeedChk(ierr);
+  ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT,
+                        CEED_VECTOR_NONE, qweights); CeedChk(ierr);
+  ierr = CeedVectorCreate(ceedparent, P1d, &lambdavec); CeedChk(ierr);
+  ierr = CeedVectorSetArray(lambdavec, CEED_MEM_HOST, CEED_OWN_POINTER, lambda);
+  CeedChk(ierr);
+
+  // Build FDM diagonal
+  const CeedInt nfields = ncomp*ncomp*((interp?1:0) + (grad?dim:0))*
+                          ((interp?1:0) + (grad?dim:0));
+  hipModule_t module;
+  hipFunction_t fdmDiagonal;
+  ierr = CeedCompileHip(ceed, fdmkernels, &module, 8,
+                         "NFIELDS", nfields,
+                         "NQPTS", nqpts,
+                         "NNODES", elemsize,
+                         "NCOMP", ncomp,
+                         "P1D", P1d,
+                         "DIM", dim,
+                         "INTERP", (CeedInt)interp,
+                         "GRAD", (CeedInt)grad
+                        ); CeedChk(ierr);
+  ierr = CeedGetKernelHip(ceed, module, "fdmDiagonal", &fdmDiagonal);
+  CeedChk(ierr);
+  CeedVector qdata;
+  const CeedScalar *assembledarray, *qweightsarray, *lambdaarray;
+  CeedScalar *qdataarray;
+  ierr = CeedVectorCreate(ceedparent, nelem*ncomp*elemsize, &qdata);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(assembled, CEED_MEM_DEVICE, &assembledarray);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(qweights, CEED_MEM_DEVICE, &qweightsarray);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(lambdavec, CEED_MEM_DEVICE, &lambdaarray);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArray(qdata, CEED_MEM_DEVICE, &qdataarray); CeedChk(ierr);
+  void *args[] = {(void *) &nelem, &maxnorm, &qweightsarray, &lambdaarray,
+                  &assembledarray, &qdataarray
+                 };
+  ierr = CeedRunKernelHip(ceed, fdmDiagonal, nelem,
+                           CeedIntMin(elemsize, 1024), args); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(qdata, &qdataarray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(lambdavec, &lambdaarray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(qweights, &qweightsarray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(assembled, &assembledarray); CeedChk(ierr);
+  CeedChk_Hip(ceed, hipModuleUnload(module));
+  ierr = CeedVectorDestroy(&lambdavec); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&qweights); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&assembled); CeedChk(ierr);
+
+  // Setup FDM operator
+  // -- Basis
+  CeedBasis fdm_basis;
+  CeedScalar *graddummy, *qrefdummy, *qweightdummy;
+  ierr = CeedCalloc(P1d*P1d, &graddummy); CeedChk(ierr);
+  ierr = CeedCalloc(P1d, &qrefdummy); CeedChk(ierr);
+  ierr = CeedCalloc(P1d, &qweightdummy); CeedChk(ierr);
+  ierr = CeedBasisCreateTensorH1(ceedparent, dim, ncomp, P1d, P1d, x2,
+                                 graddummy, qrefdummy, qweightdummy,
+                                 &fdm_basis); CeedChk(ierr);
+  ierr = CeedFree(&graddummy); CeedChk(ierr);
+  ierr = CeedFree(&qrefdummy); CeedChk(ierr);
+  ierr = CeedFree(&qweightdummy); CeedChk(ierr);
+  ierr = CeedFree(&x2); CeedChk(ierr);
+
+  // -- Restriction
+  CeedElemRestriction rstr_i;
+  CeedInt strides[3] = {1, elemsize, elemsize*ncomp};
+  ierr = CeedElemRestrictionCreateStrided(ceedparent, nelem, elemsize, ncomp,
+                                          elemsize*nelem*ncomp, strides,
+                                          &rstr_i); CeedChk(ierr);
+  // -- QFunction
+  CeedQFunction mass_qf;
+  ierr = CeedQFunctionCreateInteriorByName(ceedparent, "MassApply", &mass_qf);
+  CeedChk(ierr);
+  // -- Operator
+  ierr = CeedOperatorCreate(ceedparent, mass_qf, NULL, NULL, fdminv);
+  CeedChk(ierr);
+  ierr = CeedOperatorSetField(*fdminv, "u", rstr_i, fdm_basis,
+                              CEED_VECTOR_ACTIVE); CeedChk(ierr);
+  ierr = CeedOperatorSetField(*fdminv, "qdata", rstr_i, CEED_BASIS_COLLOCATED,
+                              qdata); CeedChk(ierr);
+  ierr = CeedOperatorSetField(*fdminv, "v", rstr_i, fdm_basis,
+                              CEED_VECTOR_ACTIVE); CeedChk(ierr);
+
+  // Cleanup
+  ierr = CeedVectorDestroy(&qdata); CeedChk(ierr);
+  ierr = CeedBasisDestroy(&fdm_basis); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstr_i); CeedChk(ierr);
+  ierr = CeedQFunctionDestroy(&mass_qf); CeedChk(ierr);
+  return 0;
 }
 
 //------------------------------------------------------------------------------
@@ -1209,6 +2022,10 @@ int CeedOperatorCreate_Hip(CeedOperator op) {
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction",
                                 CeedOperatorLinearAssembleQFunction_Hip);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op,
+                                "LinearAssembleQFunctionUpdate",
+                                CeedOperatorLinearAssembleQFunctionUpdate_Hip);
+  CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddDiagonal",
                                 CeedOperatorLinearAssembleAddDiagonal_Hip);
   CeedChk(ierr);
@@ -1219,6 +2036,8 @@ int CeedOperatorCreate_Hip(CeedOperator op) {
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "CreateFDMElementInverse",
                                 CeedOperatorCreateFDMElementInverse_Hip);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Apply",
+                                CeedOperatorApply_Hip); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
                                 CeedOperatorApplyAdd_Hip); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
@@ -1226,6 +2045,137 @@ int CeedOperatorCreate_Hip(CeedOperator op) {
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Composite Operator Apply
+//
+// Each suboperator launches its kernels on its own stream, so small
+//   suboperators, such as boundary terms, overlap with the others. All but
+//   the first suboperator add into private copies of the output, which are
+//   summed into the output on the default stream. The streams are blocking,
+//   so they start after and complete before work on the default stream.
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddComposite_Hip(CeedOperator op,
+    CeedVector invec, CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Hip *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedInt numsub;
+  ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
+  CeedOperator *suboperators;
+  ierr = CeedOperatorGetSubList(op, &suboperators); CeedChk(ierr);
+
+  // Suboperators run concurrently only when they launch all their kernels
+  //   through HIP Ceeds and write no passive outputs, which may be shared
+  bool concurrent = numsub > 1, profiling;
+  ierr = CeedIsProfiling(ceed, &profiling); CeedChk(ierr);
+  concurrent = concurrent && !profiling;
+  for (CeedInt i = 0; i < numsub && concurrent; i++) {
+    Ceed subceed;
+    bool iscomposite;
+    ierr = CeedOperatorGetCeed(suboperators[i], &subceed); CeedChk(ierr);
+    ierr = CeedOperatorIsComposite(suboperators[i], &iscomposite);
+    CeedChk(ierr);
+    concurrent = subceed == ceed && !iscomposite;
+    if (!concurrent) break;
+    CeedOperator_Hip *subimpl;
+    ierr = CeedOperatorSetup_Hip(suboperators[i]); CeedChk(ierr);
+    ierr = CeedOperatorGetData(suboperators[i], &subimpl); CeedChk(ierr);
+    concurrent = subimpl->streamcapable;
+
+    CeedQFunction qf;
+    ierr = CeedOperatorGetQFunction(suboperators[i], &qf); CeedChk(ierr);
+    CeedInt numinputfields, numoutputfields;
+    ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+    CeedChk(ierr);
+    CeedOperatorField *opinputfields, *opoutputfields;
+    ierr = CeedOperatorGetFields(suboperators[i], &opinputfields,
+                                 &opoutputfields); CeedChk(ierr);
+    for (CeedInt j = 0; j < numoutputfields; j++) {
+      CeedVector vec;
+      ierr = CeedOperatorFieldGetVector(opoutputfields[j], &vec); CeedChk(ierr);
+      concurrent = concurrent && vec == CEED_VECTOR_ACTIVE;
+    }
+  }
+  if (!concurrent) {
+    // Only the last suboperator may return a request
+    for (CeedInt i = 0; i < numsub; i++) {
+      ierr = CeedOperatorApplyAdd(suboperators[i], invec, outvec,
+                                  i < numsub-1 ? CEED_REQUEST_ORDERED : request);
+      CeedChk(ierr);
+    }
+    return 0;
+  }
+
+  // Streams and private outputs
+  if (impl->numsubstreams != numsub) {
+    ierr = CeedOperatorDestroySubStreams_Hip(op); CeedChk(ierr);
+    ierr = CeedCalloc(numsub, &impl->substreams); CeedChk(ierr);
+    ierr = CeedCalloc(numsub, &impl->suboutvecs); CeedChk(ierr);
+    ierr = CeedCalloc(numsub, &impl->subevents); CeedChk(ierr);
+    for (CeedInt i = 0; i < numsub; i++) {
+      ierr = hipStreamCreateWithFlags(&impl->substreams[i],
+                                      hipStreamNonBlocking);
+      CeedChk_Hip(ceed, ierr);
+      ierr = hipEventCreateWithFlags(&impl->subevents[i],
+                                     hipEventDisableTiming);
+      CeedChk_Hip(ceed, ierr);
+    }
+    impl->numsubstreams = numsub;
+  }
+  if (outvec != CEED_VECTOR_NONE) {
+    CeedInt length, sublength = -1;
+    ierr = CeedVectorGetLength(outvec, &length); CeedChk(ierr);
+    for (CeedInt i = 1; i < numsub; i++) {
+      if (impl->suboutvecs[i]) {
+        ierr = CeedVectorGetLength(impl->suboutvecs[i], &sublength);
+        CeedChk(ierr);
+      }
+      if (sublength != length) {
+        ierr = CeedVectorDestroy(&impl->suboutvecs[i]); CeedChk(ierr);
+        ierr = CeedVectorCreate(ceed, length, &impl->suboutvecs[i]);
+        CeedChk(ierr);
+      }
+      ierr = CeedVectorSetValue(impl->suboutvecs[i], 0.0); CeedChk(ierr);
+    }
+  }
+
+  // Apply suboperators on their streams, forked from and joined to the
+  //   launch stream of this thread
+  hipStream_t stream = CeedHipGetStream();
+  ierr = hipEventRecord(impl->subevents[0], stream); CeedChk_Hip(ceed, ierr);
+  for (CeedInt i = 0; i < numsub; i++) {
+    ierr = hipStreamWaitEvent(impl->substreams[i], impl->subevents[0], 0);
+    CeedChk_Hip(ceed, ierr);
+  }
+  for (CeedInt i = 0; i < numsub; i++) {
+    CeedVector subout = outvec;
+    if (i > 0 && outvec != CEED_VECTOR_NONE)
+      subout = impl->suboutvecs[i];
+    CeedHipSetStream(impl->substreams[i]);
+    int ierrapply = CeedOperatorApplyAdd(suboperators[i], invec, subout,
+                                         CEED_REQUEST_ORDERED);
+    CeedHipSetStream(stream);
+    CeedChk(ierrapply);
+    ierr = hipEventRecord(impl->subevents[i], impl->substreams[i]);
+    CeedChk_Hip(ceed, ierr);
+    ierr = hipStreamWaitEvent(stream, impl->subevents[i], 0);
+    CeedChk_Hip(ceed, ierr);
+  }
+
+  // Sum private outputs
+  if (outvec != CEED_VECTOR_NONE) {
+    for (CeedInt i = 1; i < numsub; i++) {
+      ierr = CeedVectorAXPY(outvec, 1.0, impl->suboutvecs[i]); CeedChk(ierr);
+    }
+  }
+
+  // Completion request
+  ierr = CeedRequestRecord_Hip(ceed, request); CeedChk(ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Composite Operator Create
 //------------------------------------------------------------------------------
@@ -1233,6 +2183,14 @@ int CeedCompositeOperatorCreate_Hip(CeedOperator op) {
   int ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Hip *impl;
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  ierr = CeedOperatorSetData(op, impl); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddComposite",
+                                CeedOperatorApplyAddComposite_Hip);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
+                                CeedOperatorDestroy_Hip); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddDiagonal",
                                 CeedOperatorLinearAssembleAddDiagonal_Hip);
   CeedChk(ierr);
@@ -51,12 +51,26 @@ extern "C" int CeedHipBuildQFunction(CeedQFunction qf) {
   using std::string;
   CeedQFunction_Hip *data;
   ierr = CeedQFunctionGetData(qf, (void **)&data); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields, size;
+
+  // Field pointer table, sized for the QFunction fields
+  if (!data->fields.inputs) {
+    ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+    CeedChk(ierr);
+    const CeedInt numinslots = CeedIntMax(numinputfields,
+                                          CEED_HIP_MIN_FIELD_SLOTS);
+    const CeedInt numslots = numinslots + CeedIntMax(numoutputfields,
+                             CEED_HIP_MIN_FIELD_SLOTS);
+    ierr = CeedCalloc(numslots, &data->fields.inputs); CeedChk(ierr);
+    data->fields.outputs = (CeedScalar **)(data->fields.inputs + numinslots);
+    data->fields.bytes = numslots * sizeof(CeedScalar *);
+  }
+
   // QFunction is built
   if (!data->qFunctionSource)
     return 0;
   
   // QFunction kernel generation
-  CeedInt numinputfields, numoutputfields, size;
   ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
   CeedChk(ierr);
   CeedQFunctionField *qfinputfields, *qfoutputfields;
@@ -74,11 +88,31 @@ extern "C" int CeedHipBuildQFunction(CeedQFunction qf) {
   // Defintions
   code << "\n#define CEED_QFUNCTION(name) inline __device__ int name\n";
   code << "\n#define CeedPragmaSIMD\n";
+  // Chunked QFunctions evaluate one quadrature point per thread
+  code << "#define CEED_CHUNK_WIDTH 1\n";
+  code << "#define CEED_QFUNCTION_CHUNK(name) "
+          "inline __device__ int name ## _chunk(void *, CeedInt, CeedInt, "
+          "CeedInt, const CeedScalar *const *, CeedScalar *const *); "
+          "CEED_QFUNCTION(name)(void *ctx, const CeedInt Q, "
+          "const CeedScalar *const *in, CeedScalar *const *out) { "
+          "for (CeedInt i = 0; i < Q; i++) { "
+          "int ierr = name ## _chunk(ctx, Q, i, 1, in, out); "
+          "if (ierr) return ierr; } return 0; } "
+          "inline __device__ int name ## _chunk\n";
+  code << "#define CeedForLanes(j, nlanes) "
+          "for (CeedInt j = 0; j < 1; j++)\n";
   code << "\n#define CEED_Q_VLA 1\n\n";
-  code << "typedef struct { const CeedScalar* inputs[16]; CeedScalar* outputs[16]; } Fields_Hip;\n";
+  code << "typedef struct { const CeedScalar* inputs["<<CeedIntMax(numinputfields, CEED_HIP_MIN_FIELD_SLOTS)<<"]; CeedScalar* outputs["<<CeedIntMax(numoutputfields, CEED_HIP_MIN_FIELD_SLOTS)<<"]; } Fields_Hip;\n";
   code << qReadWriteS;
   code << qFunction;
-  code << "extern \"C\" __global__ void " << kernelName << "(void *ctx, CeedInt Q, Fields_Hip fields) {\n";
+  // Launch bounds of the block size, set from the wavefront size
+  if (data->fields.bytes <= CEED_HIP_MAX_FIELDS_BYTES) {
+    code << "extern \"C\" __global__ void __launch_bounds__(BLOCK_SIZE) " << kernelName << "(void *ctx, CeedInt Q, Fields_Hip fields) {\n";
+  } else {
+    // Field table in device memory
+    code << "extern \"C\" __global__ void __launch_bounds__(BLOCK_SIZE) " << kernelName << "(void *ctx, CeedInt Q, const Fields_Hip *__restrict__ d_fields) {\n";
+    code << "  const Fields_Hip &fields = *d_fields;\n";
+  }
   
   // Inputs
   for (CeedInt i = 0; i < numinputfields; i++) {
@@ -132,7 +166,11 @@ extern "C" int CeedHipBuildQFunction(CeedQFunction qf) {
   CeedDebug(code.str().c_str());
  
   // Compile kernel
-  ierr = CeedCompileHip(ceed, code.str().c_str(), &data->module, 0);
+  ierr = CeedHipQueryDevice(ceed); CeedChk(ierr);
+  Ceed_Hip *ceed_Hip;
+  ierr = CeedGetData(ceed, (void **)&ceed_Hip); CeedChk(ierr);
+  ierr = CeedCompileHip(ceed, code.str().c_str(), &data->module, 1,
+                        "BLOCK_SIZE", ceed_Hip->optblocksize);
   CeedChk(ierr);
   ierr = CeedGetKernelHip(ceed, data->module, kernelName.c_str(), &data->qFunction);
   CeedChk(ierr);
@@ -60,9 +60,17 @@ static int CeedQFunctionApply_Hip(CeedQFunction qf, CeedInt Q,
   }
 
   // Run kernel
-  void *args[] = {&data->d_c, (void *) &Q, &data->fields};
-  ierr = CeedRunKernelHip(ceed, data->qFunction, CeedDivUpInt(Q, blocksize),
-                          blocksize, args); CeedChk(ierr);
+  void *fieldsarg = data->fields.inputs;
+  if (data->fields.bytes > CEED_HIP_MAX_FIELDS_BYTES) {
+    ierr = CeedHipCopyFieldsToDevice(ceed, data->fields.inputs,
+                                      data->fields.bytes,
+                                      &data->fields.d_fields); CeedChk(ierr);
+    fieldsarg = &data->fields.d_fields;
+  }
+  void *args[] = {&data->d_c, (void *) &Q, fieldsarg};
+  ierr = CeedRunKernelHip(ceed, data->qFunction,
+                          CeedHipGridSize(ceed_Hip, Q, blocksize), blocksize,
+                          args); CeedChk(ierr);
 
   // Restore vectors
   for (CeedInt i = 0; i < numinputfields; i++) {
@@ -93,6 +101,8 @@ static int CeedQFunctionDestroy_Hip(CeedQFunction qf) {
   ierr = CeedQFunctionGetCeed(qf, &ceed); CeedChk(ierr);
   if  (data->module)
     CeedChk_Hip(ceed, hipModuleUnload(data->module));
+  ierr = CeedHipFree(ceed, data->fields.d_fields); CeedChk(ierr);
+  ierr = CeedFree(&data->fields.inputs); CeedChk(ierr);
   ierr = CeedFree(&data); CeedChk(ierr);
   return 0;
 }
@@ -105,6 +115,18 @@ static int CeedHipLoadQFunction(CeedQFunction qf, char *c_src_file) {
   Ceed ceed;
   CeedQFunctionGetCeed(qf, &ceed);
 
+  // Use source embedded at build time, if provided
+  const char *code;
+  ierr = CeedQFunctionGetSourceCode(qf, &code); CeedChk(ierr);
+  if (code) {
+    CeedQFunction_Hip *data;
+    ierr = CeedQFunctionGetData(qf, &data); CeedChk(ierr);
+    const size_t len = strlen(code) + 1;
+    ierr = CeedMalloc(len, &data->qFunctionSource); CeedChk(ierr);
+    memcpy(data->qFunctionSource, code, len);
+    return 0;
+  }
+
   // Find source file
   char *hip_file;
   ierr = CeedCalloc(HIP_MAX_PATH, &hip_file); CeedChk(ierr);
@@ -59,6 +59,30 @@ static inline int CeedQFunctionContextSyncD2H_Hip(
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Match the tracked memory usage to the data the context currently owns
+//------------------------------------------------------------------------------
+static int CeedQFunctionContextUpdateMemory_Hip(
+  const CeedQFunctionContext ctx) {
+  int ierr;
+  CeedQFunctionContext_Hip *impl;
+  ierr = CeedQFunctionContextGetBackendData(ctx, &impl); CeedChk(ierr);
+
+  const size_t owned[CEED_MEMSPACE_NUM] = {
+    [CEED_MEMSPACE_HOST] = impl->h_data_allocated ? bytes(ctx) : 0,
+    [CEED_MEMSPACE_DEVICE] = impl->d_data_allocated ? bytes(ctx) : 0,
+  };
+  for (int s = 0; s < CEED_MEMSPACE_NUM; s++) {
+    size_t used;
+    ierr = CeedQFunctionContextGetMemoryUsage(ctx, s, &used); CeedChk(ierr);
+    if (used != owned[s]) {
+      ierr = CeedQFunctionContextTrackMemory(ctx, s, (ptrdiff_t)owned[s] -
+                                             (ptrdiff_t)used); CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Set data from host
 //------------------------------------------------------------------------------
@@ -104,20 +128,20 @@ static int CeedQFunctionContextSetDataDevice_Hip(const CeedQFunctionContext ctx,
   switch (cmode) {
   case CEED_COPY_VALUES:
     if (!impl->d_data) {
-      ierr = hipMalloc((void **)&impl->d_data_allocated, bytes(ctx));
-      CeedChk_Hip(ceed, ierr);
+      ierr = CeedHipMalloc(ceed, (void **)&impl->d_data_allocated, bytes(ctx));
+      CeedChk(ierr);
       impl->d_data = impl->d_data_allocated;
     }
     ierr = hipMemcpy(impl->d_data, data, bytes(ctx),
                      hipMemcpyDeviceToDevice); CeedChk_Hip(ceed, ierr);
     break;
   case CEED_OWN_POINTER:
-    ierr = hipFree(impl->d_data_allocated); CeedChk_Hip(ceed, ierr);
+    ierr = CeedHipFree(ceed, impl->d_data_allocated); CeedChk(ierr);
     impl->d_data_allocated = data;
     impl->d_data = data;
     break;
   case CEED_USE_POINTER:
-    ierr = hipFree(impl->d_data_allocated); CeedChk_Hip(ceed, ierr);
+    ierr = CeedHipFree(ceed, impl->d_data_allocated); CeedChk(ierr);
     impl->d_data_allocated = NULL;
     impl->d_data = data;
     break;
@@ -138,11 +162,19 @@ static int CeedQFunctionContextSetData_Hip(const CeedQFunctionContext ctx,
 
   switch (mtype) {
   case CEED_MEM_HOST:
-    return CeedQFunctionContextSetDataHost_Hip(ctx, cmode, data);
+    ierr = CeedQFunctionContextSetDataHost_Hip(ctx, cmode, data); CeedChk(ierr);
+    break;
   case CEED_MEM_DEVICE:
-    return CeedQFunctionContextSetDataDevice_Hip(ctx, cmode, data);
+    ierr = CeedQFunctionContextSetDataDevice_Hip(ctx, cmode, data);
+    CeedChk(ierr);
+    break;
+  default:
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Only MemType = HOST or DEVICE supported");
+    // LCOV_EXCL_STOP
   }
-  return 1;
+  ierr = CeedQFunctionContextUpdateMemory_Hip(ctx); CeedChk(ierr);
+  return 0;
 }
 
 //------------------------------------------------------------------------------
@@ -176,8 +208,8 @@ static int CeedQFunctionContextGetData_Hip(const CeedQFunctionContext ctx,
     break;
   case CEED_MEM_DEVICE:
     if (impl->d_data == NULL) {
-      ierr = hipMalloc((void **)&impl->d_data_allocated, bytes(ctx));
-      CeedChk_Hip(ceed, ierr);
+      ierr = CeedHipMalloc(ceed, (void **)&impl->d_data_allocated, bytes(ctx));
+      CeedChk(ierr);
       impl->d_data = impl->d_data_allocated;
     }
     if (impl->memState == CEED_HIP_HOST_SYNC) {
@@ -186,6 +218,44 @@ static int CeedQFunctionContextGetData_Hip(const CeedQFunctionContext ctx,
     impl->memState = CEED_HIP_DEVICE_SYNC;
     *(void **)data = impl->d_data;
     break;
+  case CEED_MEM_UNIFIED:
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "CEED_MEM_UNIFIED is only supported for "
+                     "CeedVector");
+    // LCOV_EXCL_STOP
+  }
+  ierr = CeedQFunctionContextUpdateMemory_Hip(ctx); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Set a registered field
+//
+// A context on the device is updated there, ordered with the kernels on the
+//   launch stream, so the host copy goes stale without invalidating or copying
+//   the rest of the device data.
+//------------------------------------------------------------------------------
+static int CeedQFunctionContextSetField_Hip(const CeedQFunctionContext ctx,
+    size_t offset, size_t size, const void *values) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedQFunctionContextGetCeed(ctx, &ceed); CeedChk(ierr);
+  CeedQFunctionContext_Hip *impl;
+  ierr = CeedQFunctionContextGetBackendData(ctx, &impl); CeedChk(ierr);
+
+  switch (impl->memState) {
+  case CEED_HIP_HOST_SYNC:
+    memcpy((char *)impl->h_data + offset, values, size);
+    break;
+  case CEED_HIP_DEVICE_SYNC:
+    ierr = hipMemcpyAsync((char *)impl->d_data + offset, values, size,
+                         hipMemcpyHostToDevice, CeedHipGetStream());
+    CeedChk_Hip(ceed, ierr);
+    break;
+  default:
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "No context data set");
+    // LCOV_EXCL_STOP
   }
   return 0;
 }
@@ -207,7 +277,7 @@ static int CeedQFunctionContextDestroy_Hip(const CeedQFunctionContext ctx) {
   CeedQFunctionContext_Hip *impl;
   ierr = CeedQFunctionContextGetBackendData(ctx, &impl); CeedChk(ierr);
 
-  ierr = hipFree(impl->d_data_allocated); CeedChk_Hip(ceed, ierr);
+  ierr = CeedHipFree(ceed, impl->d_data_allocated); CeedChk(ierr);
   ierr = CeedFree(&impl->h_data_allocated); CeedChk(ierr);
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
@@ -228,6 +298,8 @@ int CeedQFunctionContextCreate_Hip(CeedQFunctionContext ctx) {
                                 CeedQFunctionContextGetData_Hip); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "QFunctionContext", ctx, "RestoreData",
                                 CeedQFunctionContextRestoreData_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "QFunctionContext", ctx, "SetField",
+                                CeedQFunctionContextSetField_Hip); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "QFunctionContext", ctx, "Destroy",
                                 CeedQFunctionContextDestroy_Hip); CeedChk(ierr);
   ierr = CeedCalloc(1, &impl); CeedChk(ierr);
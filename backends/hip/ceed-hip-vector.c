@@ -28,7 +28,257 @@ static inline size_t bytes(const CeedVector vec) {
 }
 
 //------------------------------------------------------------------------------
-// Sync host to device
+// Record completion of an asynchronous transfer on the default stream
+//------------------------------------------------------------------------------
+static inline int CeedVectorRecordTransfer_Hip(const CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Hip *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  if (!data->transfer) {
+    ierr = hipEventCreateWithFlags(&data->transfer, hipEventDisableTiming);
+    CeedChk_Hip(ceed, ierr);
+  }
+  ierr = hipEventRecord(data->transfer, 0); CeedChk_Hip(ceed, ierr);
+  data->transferpending = true;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Wait for an asynchronous transfer to complete before host access
+//------------------------------------------------------------------------------
+static inline int CeedVectorWaitTransfer_Hip(const CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Hip *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  // Kernels may still access managed memory, so wait for the whole stream
+  if (data->unified) {
+    ierr = CeedVectorRecordTransfer_Hip(vec); CeedChk(ierr);
+  }
+  if (data->transferpending) {
+    ierr = hipEventSynchronize(data->transfer); CeedChk_Hip(ceed, ierr);
+    data->transferpending = false;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Allocate the host array in page-locked memory, so transfers run at full
+//   bandwidth without staging, falling back to pageable memory
+//------------------------------------------------------------------------------
+static int CeedVectorHostMalloc_Hip(const CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Hip *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  bool used;
+  ierr = CeedAllocatorMalloc(ceed, CEED_MEMSPACE_PINNED, bytes(vec),
+                             &data->h_array_allocated, &used); CeedChk(ierr);
+  if (used) {
+    data->h_array_pinned = true;
+    data->h_array = data->h_array_allocated;
+    return 0;
+  }
+  ierr = hipHostMalloc((void **)&data->h_array_allocated, bytes(vec));
+  data->h_array_pinned = ierr == hipSuccess;
+  if (!data->h_array_pinned) {
+    CeedInt length;
+    hipGetLastError();
+    ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+    ierr = CeedMalloc(length, &data->h_array_allocated); CeedChk(ierr);
+  }
+  data->h_array = data->h_array_allocated;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Free the host array allocated by the backend or owned by the vector
+//------------------------------------------------------------------------------
+static int CeedVectorHostFree_Hip(const CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Hip *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  ierr = CeedVectorWaitTransfer_Hip(vec); CeedChk(ierr);
+  if (data->h_array_pinned) {
+    bool used;
+    ierr = CeedAllocatorFree(ceed, CEED_MEMSPACE_PINNED,
+                             &data->h_array_allocated, &used); CeedChk(ierr);
+    if (!used) {
+      ierr = hipHostFree(data->h_array_allocated); CeedChk_Hip(ceed, ierr);
+    }
+    data->h_array_allocated = NULL;
+    data->h_array_pinned = false;
+  } else {
+    ierr = CeedFreeHost(ceed, &data->h_array_allocated); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Match the tracked memory usage to the arrays the vector currently owns,
+//   managed memory is accounted to the device
+//------------------------------------------------------------------------------
+static int CeedVectorUpdateMemory_Hip(const CeedVector vec) {
+  int ierr;
+  CeedVector_Hip *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  const size_t owned[CEED_MEMSPACE_NUM] = {
+    [CEED_MEMSPACE_HOST] = data->h_array_allocated &&
+                           !data->h_array_pinned ? bytes(vec) : 0,
+    [CEED_MEMSPACE_DEVICE] = data->d_array_allocated ||
+                             data->m_array_allocated ? bytes(vec) : 0,
+    [CEED_MEMSPACE_PINNED] = data->h_array_allocated &&
+                             data->h_array_pinned ? bytes(vec) : 0,
+  };
+  for (int s = 0; s < CEED_MEMSPACE_NUM; s++) {
+    size_t used;
+    ierr = CeedVectorGetMemoryUsage(vec, s, &used); CeedChk(ierr);
+    if (used != owned[s]) {
+      ierr = CeedVectorTrackMemory(vec, s, (ptrdiff_t)owned[s] -
+                                   (ptrdiff_t)used); CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Page-lock a CEED_USE_POINTER host array, if enabled with CEED_HOST_REGISTER
+//------------------------------------------------------------------------------
+static int CeedVectorHostRegister_Hip(const CeedVector vec,
+                                       CeedScalar *array) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  Ceed_Hip *ceed_data;
+  ierr = CeedGetData(ceed, &ceed_data); CeedChk(ierr);
+  CeedVector_Hip *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  if (!array || !ceed_data->hostregister)
+    return 0;
+  ierr = hipHostRegister(array, bytes(vec), hipHostRegisterDefault);
+  if (ierr == hipSuccess)
+    data->h_array_registered = array;
+  else
+    hipGetLastError(); // Already page-locked or unsupported, use as is
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Release page-locking of a CEED_USE_POINTER host array
+//------------------------------------------------------------------------------
+static int CeedVectorHostUnregister_Hip(const CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Hip *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  if (data->h_array_registered) {
+    ierr = CeedVectorWaitTransfer_Hip(vec); CeedChk(ierr);
+    ierr = hipHostUnregister(data->h_array_registered); CeedChk_Hip(ceed, ierr);
+    data->h_array_registered = NULL;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Move the vector data to a managed allocation shared by host and device
+//------------------------------------------------------------------------------
+static int CeedVectorSetUnified_Hip(const CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Hip *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  if (data->unified)
+    return 0;
+  if ((data->h_array && data->h_array != data->h_array_allocated) ||
+      (data->d_array && data->d_array != data->d_array_allocated))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Cannot move an array set with CEED_USE_POINTER "
+                     "to unified memory");
+  // LCOV_EXCL_STOP
+
+  CeedScalar *m_array;
+  ierr = hipMallocManaged((void **)&m_array, bytes(vec), hipMemAttachGlobal);
+  CeedChk_Hip(ceed, ierr);
+  ierr = CeedVectorWaitTransfer_Hip(vec); CeedChk(ierr);
+  switch (data->memState) {
+  case CEED_HIP_HOST_SYNC:
+    memcpy(m_array, data->h_array, bytes(vec));
+    break;
+  case CEED_HIP_DEVICE_SYNC:
+  case CEED_HIP_BOTH_SYNC:
+    ierr = hipMemcpy(m_array, data->d_array, bytes(vec),
+                      hipMemcpyDeviceToDevice); CeedChk_Hip(ceed, ierr);
+    break;
+  case CEED_HIP_NONE_SYNC:
+    break;
+  }
+  ierr = CeedVectorHostFree_Hip(vec); CeedChk(ierr);
+  ierr = CeedHipFree(ceed, data->d_array_allocated); CeedChk(ierr);
+  data->d_array_allocated = NULL;
+  data->m_array_allocated = m_array;
+  data->h_array = m_array;
+  data->d_array = m_array;
+  data->unified = true;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Release the managed allocation, leaving the vector without an array
+//------------------------------------------------------------------------------
+static int CeedVectorUnsetUnified_Hip(const CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Hip *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  if (!data->unified)
+    return 0;
+  ierr = CeedVectorWaitTransfer_Hip(vec); CeedChk(ierr);
+  ierr = hipFree(data->m_array_allocated); CeedChk_Hip(ceed, ierr);
+  data->m_array_allocated = NULL;
+  data->h_array = NULL;
+  data->d_array = NULL;
+  data->unified = false;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Prefetch managed memory to the host or device
+//------------------------------------------------------------------------------
+static inline int CeedVectorPrefetch_Hip(const CeedVector vec, int device) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Hip *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  // Only a hint; pages that are not prefetched migrate on demand
+  ierr = hipMemPrefetchAsync(data->h_array, bytes(vec), device, 0);
+  if (ierr != hipSuccess)
+    hipGetLastError();
+  ierr = CeedVectorRecordTransfer_Hip(vec); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Sync host to device, asynchronously with respect to the host
 //------------------------------------------------------------------------------
 static inline int CeedVectorSyncH2D_Hip(const CeedVector vec) {
   int ierr;
@@ -36,14 +286,28 @@ static inline int CeedVectorSyncH2D_Hip(const CeedVector vec) {
   ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
   CeedVector_Hip *data;
   ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+  ierr = CeedVectorAuditTransfer(vec, CEED_MEM_DEVICE, bytes(vec));
+  CeedChk(ierr);
 
-  ierr = hipMemcpy(data->d_array, data->h_array, bytes(vec),
-                   hipMemcpyHostToDevice); CeedChk_Hip(ceed, ierr);
+  if (data->unified) {
+    Ceed_Hip *ceed_data;
+    ierr = CeedGetData(ceed, &ceed_data); CeedChk(ierr);
+    return CeedVectorPrefetch_Hip(vec, ceed_data->deviceId);
+  }
+
+  double start;
+  ierr = CeedProfileStart(ceed, CEED_PROFILE_TRANSFER, &start); CeedChk(ierr);
+  ierr = hipMemcpyAsync(data->d_array, data->h_array, bytes(vec),
+                         hipMemcpyHostToDevice, 0); CeedChk_Hip(ceed, ierr);
+  ierr = CeedVectorRecordTransfer_Hip(vec); CeedChk(ierr);
+  ierr = CeedProfileStop(ceed, CEED_PROFILE_TRANSFER, start, bytes(vec));
+  CeedChk(ierr);
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// Sync device to host
+// Sync device to host; the host array may be used after
+//   CeedVectorWaitTransfer_Hip()
 //------------------------------------------------------------------------------
 static inline int CeedVectorSyncD2H_Hip(const CeedVector vec) {
   int ierr;
@@ -51,9 +315,19 @@ static inline int CeedVectorSyncD2H_Hip(const CeedVector vec) {
   ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
   CeedVector_Hip *data;
   ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+  ierr = CeedVectorAuditTransfer(vec, CEED_MEM_HOST, bytes(vec));
+  CeedChk(ierr);
+
+  if (data->unified)
+    return CeedVectorPrefetch_Hip(vec, hipCpuDeviceId);
 
-  ierr = hipMemcpy(data->h_array, data->d_array, bytes(vec),
-                   hipMemcpyDeviceToHost); CeedChk_Hip(ceed, ierr);
+  double start;
+  ierr = CeedProfileStart(ceed, CEED_PROFILE_TRANSFER, &start); CeedChk(ierr);
+  ierr = hipMemcpyAsync(data->h_array, data->d_array, bytes(vec),
+                         hipMemcpyDeviceToHost, 0); CeedChk_Hip(ceed, ierr);
+  ierr = CeedVectorRecordTransfer_Hip(vec); CeedChk(ierr);
+  ierr = CeedProfileStop(ceed, CEED_PROFILE_TRANSFER, start, bytes(vec));
+  CeedChk(ierr);
   return 0;
 }
 
@@ -67,24 +341,30 @@ static int CeedVectorSetArrayHost_Hip(const CeedVector vec,
   CeedVector_Hip *data;
   ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
 
+  ierr = CeedVectorWaitTransfer_Hip(vec); CeedChk(ierr);
   switch (cmode) {
-  case CEED_COPY_VALUES: {
-    CeedInt length;
+  case CEED_COPY_VALUES:
     if(!data->h_array) {
-      ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
-      ierr = CeedMalloc(length, &data->h_array_allocated); CeedChk(ierr);
-      data->h_array = data->h_array_allocated;
+      ierr = CeedVectorHostMalloc_Hip(vec); CeedChk(ierr);
     }
     if (array)
       memcpy(data->h_array, array, bytes(vec));
-  } break;
+    break;
   case CEED_OWN_POINTER:
-    ierr = CeedFree(&data->h_array_allocated); CeedChk(ierr);
+    ierr = CeedVectorUnsetUnified_Hip(vec); CeedChk(ierr);
+    ierr = CeedVectorHostUnregister_Hip(vec); CeedChk(ierr);
+    ierr = CeedVectorHostFree_Hip(vec); CeedChk(ierr);
     data->h_array_allocated = array;
     data->h_array = array;
     break;
   case CEED_USE_POINTER:
-    ierr = CeedFree(&data->h_array_allocated); CeedChk(ierr);
+    ierr = CeedVectorUnsetUnified_Hip(vec); CeedChk(ierr);
+    ierr = CeedVectorHostFree_Hip(vec); CeedChk(ierr);
+    // Keep the registration when the same array is set again
+    if (array != data->h_array_registered) {
+      ierr = CeedVectorHostUnregister_Hip(vec); CeedChk(ierr);
+      ierr = CeedVectorHostRegister_Hip(vec, array); CeedChk(ierr);
+    }
     data->h_array = array;
     break;
   }
@@ -106,8 +386,8 @@ static int CeedVectorSetArrayDevice_Hip(const CeedVector vec,
   switch (cmode) {
   case CEED_COPY_VALUES:
     if (!data->d_array) {
-      ierr = hipMalloc((void **)&data->d_array_allocated, bytes(vec));
-      CeedChk_Hip(ceed, ierr);
+      ierr = CeedHipMalloc(ceed, (void **)&data->d_array_allocated, bytes(vec));
+      CeedChk(ierr);
       data->d_array = data->d_array_allocated;
     }
     if (array) {
@@ -116,12 +396,14 @@ static int CeedVectorSetArrayDevice_Hip(const CeedVector vec,
     }
     break;
   case CEED_OWN_POINTER:
-    ierr = hipFree(data->d_array_allocated); CeedChk_Hip(ceed, ierr);
+    ierr = CeedVectorUnsetUnified_Hip(vec); CeedChk(ierr);
+    ierr = CeedHipFree(ceed, data->d_array_allocated); CeedChk(ierr);
     data->d_array_allocated = array;
     data->d_array = array;
     break;
   case CEED_USE_POINTER:
-    ierr = hipFree(data->d_array_allocated); CeedChk_Hip(ceed, ierr);
+    ierr = CeedVectorUnsetUnified_Hip(vec); CeedChk(ierr);
+    ierr = CeedHipFree(ceed, data->d_array_allocated); CeedChk(ierr);
     data->d_array_allocated = NULL;
     data->d_array = array;
     break;
@@ -130,6 +412,45 @@ static int CeedVectorSetArrayDevice_Hip(const CeedVector vec,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Set array from unified memory
+//------------------------------------------------------------------------------
+static int CeedVectorSetArrayUnified_Hip(const CeedVector vec,
+    const CeedCopyMode cmode, CeedScalar *array) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Hip *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  switch (cmode) {
+  case CEED_COPY_VALUES:
+    ierr = CeedVectorSetUnified_Hip(vec); CeedChk(ierr);
+    ierr = CeedVectorWaitTransfer_Hip(vec); CeedChk(ierr);
+    if (array) {
+      ierr = hipMemcpy(data->h_array, array, bytes(vec), hipMemcpyDefault);
+      CeedChk_Hip(ceed, ierr);
+    }
+    break;
+  case CEED_OWN_POINTER:
+  case CEED_USE_POINTER:
+    ierr = CeedVectorUnsetUnified_Hip(vec); CeedChk(ierr);
+    ierr = CeedVectorHostUnregister_Hip(vec); CeedChk(ierr);
+    ierr = CeedVectorHostFree_Hip(vec); CeedChk(ierr);
+    ierr = CeedHipFree(ceed, data->d_array_allocated); CeedChk(ierr);
+    data->d_array_allocated = NULL;
+    data->m_array_allocated = cmode == CEED_OWN_POINTER ? array : NULL;
+    data->h_array = array;
+    data->d_array = array;
+    data->unified = true;
+    break;
+  }
+  // Unified arrays are shared with host code, so the next device access
+  //   prefetches them
+  data->memState = CEED_HIP_HOST_SYNC;
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Set the array used by a vector,
 //   freeing any previously allocated array if applicable
@@ -146,11 +467,17 @@ static int CeedVectorSetArray_Hip(const CeedVector vec,
 
   switch (mtype) {
   case CEED_MEM_HOST:
-    return CeedVectorSetArrayHost_Hip(vec, cmode, array);
+    ierr = CeedVectorSetArrayHost_Hip(vec, cmode, array); CeedChk(ierr);
+    break;
   case CEED_MEM_DEVICE:
-    return CeedVectorSetArrayDevice_Hip(vec, cmode, array);
+    ierr = CeedVectorSetArrayDevice_Hip(vec, cmode, array); CeedChk(ierr);
+    break;
+  case CEED_MEM_UNIFIED:
+    ierr = CeedVectorSetArrayUnified_Hip(vec, cmode, array); CeedChk(ierr);
+    break;
   }
-  return 1;
+  ierr = CeedVectorUpdateMemory_Hip(vec); CeedChk(ierr);
+  return 0;
 }
 
 //------------------------------------------------------------------------------
@@ -159,6 +486,8 @@ static int CeedVectorSetArray_Hip(const CeedVector vec,
 static int CeedVectorTakeArray_Hip(CeedVector vec, CeedMemType mtype,
                                    CeedScalar **array) {
   int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
   CeedVector_Hip *impl;
   ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
 
@@ -167,7 +496,19 @@ static int CeedVectorTakeArray_Hip(CeedVector vec, CeedMemType mtype,
     if (impl->memState == CEED_HIP_DEVICE_SYNC) {
       ierr = CeedVectorSyncD2H_Hip(vec); CeedChk(ierr);
     }
-    (*array) = impl->h_array;
+    ierr = CeedVectorWaitTransfer_Hip(vec); CeedChk(ierr);
+    ierr = CeedVectorHostUnregister_Hip(vec); CeedChk(ierr);
+    if (impl->h_array_pinned || impl->unified) {
+      // The caller frees the array with CeedFree, so return pageable memory
+      CeedInt length;
+      ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+      ierr = CeedMalloc(length, array); CeedChk(ierr);
+      memcpy(*array, impl->h_array, bytes(vec));
+      ierr = CeedVectorHostFree_Hip(vec); CeedChk(ierr);
+      ierr = CeedVectorUnsetUnified_Hip(vec); CeedChk(ierr);
+    } else {
+      (*array) = impl->h_array;
+    }
     impl->h_array = NULL;
     impl->h_array_allocated = NULL;
     impl->memState = CEED_HIP_HOST_SYNC;
@@ -176,13 +517,36 @@ static int CeedVectorTakeArray_Hip(CeedVector vec, CeedMemType mtype,
     if (impl->memState == CEED_HIP_HOST_SYNC) {
       ierr = CeedVectorSyncH2D_Hip(vec); CeedChk(ierr);
     }
+    if (impl->unified) {
+      // The caller frees the array with hipFree, so return a copy
+      CeedScalar *d_array;
+      ierr = CeedHipMalloc(ceed, (void **)&d_array, bytes(vec)); CeedChk(ierr);
+      ierr = hipMemcpy(d_array, impl->d_array, bytes(vec),
+                        hipMemcpyDeviceToDevice); CeedChk_Hip(ceed, ierr);
+      ierr = CeedVectorUnsetUnified_Hip(vec); CeedChk(ierr);
+      impl->d_array = impl->d_array_allocated = d_array;
+    }
+    // The caller now owns the allocation and frees it with hipFree
+    ierr = CeedHipRelease(ceed, impl->d_array_allocated); CeedChk(ierr);
     (*array) = impl->d_array;
     impl->d_array = NULL;
     impl->d_array_allocated = NULL;
     impl->memState = CEED_HIP_DEVICE_SYNC;
     break;
+  case CEED_MEM_UNIFIED:
+    ierr = CeedVectorSetUnified_Hip(vec); CeedChk(ierr);
+    ierr = CeedVectorWaitTransfer_Hip(vec); CeedChk(ierr);
+    // The caller now owns the allocation and frees it with hipFree
+    (*array) = impl->h_array;
+    impl->m_array_allocated = NULL;
+    impl->h_array = NULL;
+    impl->d_array = NULL;
+    impl->unified = false;
+    impl->memState = CEED_HIP_HOST_SYNC;
+    break;
   }
 
+  ierr = CeedVectorUpdateMemory_Hip(vec); CeedChk(ierr);
   return 0;
 }
 
@@ -214,6 +578,7 @@ static int CeedVectorSetValue_Hip(CeedVector vec, CeedScalar val) {
   ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
 
   // Set value for synced device/host array
+  ierr = CeedVectorWaitTransfer_Hip(vec); CeedChk(ierr);
   switch(data->memState) {
   case CEED_HIP_HOST_SYNC:
     ierr = CeedHostSetValue_Hip(data->h_array, length, val); CeedChk(ierr);
@@ -224,8 +589,8 @@ static int CeedVectorSetValue_Hip(CeedVector vec, CeedScalar val) {
       Default allocation then happens on the GPU.
     */
     if (data->d_array == NULL) {
-      ierr = hipMalloc((void **)&data->d_array_allocated, bytes(vec));
-      CeedChk_Hip(ceed, ierr);
+      ierr = CeedHipMalloc(ceed, (void **)&data->d_array_allocated, bytes(vec));
+      CeedChk(ierr);
       data->d_array = data->d_array_allocated;
     }
     data->memState = CEED_HIP_DEVICE_SYNC;
@@ -235,10 +600,64 @@ static int CeedVectorSetValue_Hip(CeedVector vec, CeedScalar val) {
     ierr = CeedDeviceSetValue_Hip(data->d_array, length, val); CeedChk(ierr);
     break;
   case CEED_HIP_BOTH_SYNC:
-    ierr = CeedHostSetValue_Hip(data->h_array, length, val); CeedChk(ierr);
+    if (!data->unified) {
+      ierr = CeedHostSetValue_Hip(data->h_array, length, val); CeedChk(ierr);
+    }
     ierr = CeedDeviceSetValue_Hip(data->d_array, length, val); CeedChk(ierr);
     break;
   }
+  ierr = CeedVectorUpdateMemory_Hip(vec); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Copy a vector where its values are valid: host values on the host, device
+//   values on the device, or between devices through unified addressing; the
+//   previous values of the copy are dropped without a sync
+//------------------------------------------------------------------------------
+static int CeedVectorCopy_Hip(CeedVector vec, CeedVector copy) {
+  int ierr;
+  Ceed ceed, vecceed;
+  ierr = CeedVectorGetCeed(copy, &ceed); CeedChk(ierr);
+  ierr = CeedVectorGetCeed(vec, &vecceed); CeedChk(ierr);
+  Ceed_Hip *ceed_data, *vecceed_data;
+  ierr = CeedGetData(ceed, &ceed_data); CeedChk(ierr);
+  ierr = CeedGetData(vecceed, &vecceed_data); CeedChk(ierr);
+  CeedVector_Hip *data, *copy_data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+  ierr = CeedVectorGetData(copy, &copy_data); CeedChk(ierr);
+
+  ierr = CeedVectorWaitTransfer_Hip(copy); CeedChk(ierr);
+  if (data->memState == CEED_HIP_HOST_SYNC) {
+    if (!copy_data->h_array) {
+      ierr = CeedVectorHostMalloc_Hip(copy); CeedChk(ierr);
+    }
+    ierr = CeedVectorWaitTransfer_Hip(vec); CeedChk(ierr);
+    memcpy(copy_data->h_array, data->h_array, bytes(copy));
+    copy_data->memState = CEED_HIP_HOST_SYNC;
+  } else {
+    if (!copy_data->d_array) {
+      ierr = CeedHipMalloc(ceed, (void **)&copy_data->d_array_allocated,
+                           bytes(copy));
+      CeedChk(ierr);
+      copy_data->d_array = copy_data->d_array_allocated;
+    }
+    double start;
+    ierr = CeedProfileStart(ceed, CEED_PROFILE_TRANSFER, &start); CeedChk(ierr);
+    if (ceed_data->deviceId != vecceed_data->deviceId) {
+      ierr = hipMemcpyPeerAsync(copy_data->d_array, ceed_data->deviceId,
+                                data->d_array, vecceed_data->deviceId,
+                                bytes(copy), 0); CeedChk_Hip(ceed, ierr);
+    } else {
+      ierr = hipMemcpyAsync(copy_data->d_array, data->d_array, bytes(copy),
+                            hipMemcpyDeviceToDevice, 0);
+      CeedChk_Hip(ceed, ierr);
+    }
+    ierr = CeedProfileStop(ceed, CEED_PROFILE_TRANSFER, start, bytes(copy));
+    CeedChk(ierr);
+    copy_data->memState = CEED_HIP_DEVICE_SYNC;
+  }
+  ierr = CeedVectorUpdateMemory_Hip(copy); CeedChk(ierr);
   return 0;
 }
 
@@ -260,23 +679,20 @@ static int CeedVectorGetArrayRead_Hip(const CeedVector vec,
   switch (mtype) {
   case CEED_MEM_HOST:
     if(data->h_array==NULL) {
-      CeedInt length;
-      ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
-      ierr = CeedMalloc(length, &data->h_array_allocated);
-      CeedChk(ierr);
-      data->h_array = data->h_array_allocated;
+      ierr = CeedVectorHostMalloc_Hip(vec); CeedChk(ierr);
     }
     if(data->memState==CEED_HIP_DEVICE_SYNC) {
       ierr = CeedVectorSyncD2H_Hip(vec);
       CeedChk(ierr);
       data->memState = CEED_HIP_BOTH_SYNC;
     }
+    ierr = CeedVectorWaitTransfer_Hip(vec); CeedChk(ierr);
     *array = data->h_array;
     break;
   case CEED_MEM_DEVICE:
     if (data->d_array==NULL) {
-      ierr = hipMalloc((void **)&data->d_array_allocated, bytes(vec));
-      CeedChk_Hip(ceed, ierr);
+      ierr = CeedHipMalloc(ceed, (void **)&data->d_array_allocated, bytes(vec));
+      CeedChk(ierr);
       data->d_array = data->d_array_allocated;
     }
     if (data->memState==CEED_HIP_HOST_SYNC) {
@@ -286,7 +702,13 @@ static int CeedVectorGetArrayRead_Hip(const CeedVector vec,
     }
     *array = data->d_array;
     break;
+  case CEED_MEM_UNIFIED:
+    ierr = CeedVectorSetUnified_Hip(vec); CeedChk(ierr);
+    ierr = CeedVectorWaitTransfer_Hip(vec); CeedChk(ierr);
+    *array = data->h_array;
+    break;
   }
+  ierr = CeedVectorUpdateMemory_Hip(vec); CeedChk(ierr);
   return 0;
 }
 
@@ -306,22 +728,19 @@ static int CeedVectorGetArray_Hip(const CeedVector vec,
   switch (mtype) {
   case CEED_MEM_HOST:
     if(data->h_array==NULL) {
-      CeedInt length;
-      ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
-      ierr = CeedMalloc(length, &data->h_array_allocated);
-      CeedChk(ierr);
-      data->h_array = data->h_array_allocated;
+      ierr = CeedVectorHostMalloc_Hip(vec); CeedChk(ierr);
     }
     if(data->memState==CEED_HIP_DEVICE_SYNC) {
       ierr = CeedVectorSyncD2H_Hip(vec); CeedChk(ierr);
     }
+    ierr = CeedVectorWaitTransfer_Hip(vec); CeedChk(ierr);
     data->memState = CEED_HIP_HOST_SYNC;
     *array = data->h_array;
     break;
   case CEED_MEM_DEVICE:
     if (data->d_array==NULL) {
-      ierr = hipMalloc((void **)&data->d_array_allocated, bytes(vec));
-      CeedChk_Hip(ceed, ierr);
+      ierr = CeedHipMalloc(ceed, (void **)&data->d_array_allocated, bytes(vec));
+      CeedChk(ierr);
       data->d_array = data->d_array_allocated;
     }
     if (data->memState==CEED_HIP_HOST_SYNC) {
@@ -330,7 +749,57 @@ static int CeedVectorGetArray_Hip(const CeedVector vec,
     data->memState = CEED_HIP_DEVICE_SYNC;
     *array = data->d_array;
     break;
+  case CEED_MEM_UNIFIED:
+    // Pages migrate as the caller touches them
+    ierr = CeedVectorSetUnified_Hip(vec); CeedChk(ierr);
+    ierr = CeedVectorWaitTransfer_Hip(vec); CeedChk(ierr);
+    data->memState = CEED_HIP_HOST_SYNC;
+    *array = data->h_array;
+    break;
+  }
+  ierr = CeedVectorUpdateMemory_Hip(vec); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Sync array to the requested memory type, leaving the transfer in flight;
+//   host access to the array waits for it to complete
+//------------------------------------------------------------------------------
+static int CeedVectorSyncArray_Hip(const CeedVector vec,
+                                    const CeedMemType mtype) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Hip *data;
+  ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
+
+  switch (mtype) {
+  case CEED_MEM_HOST:
+    if (data->memState == CEED_HIP_DEVICE_SYNC) {
+      if (!data->h_array) {
+        ierr = CeedVectorHostMalloc_Hip(vec); CeedChk(ierr);
+      }
+      ierr = CeedVectorSyncD2H_Hip(vec); CeedChk(ierr);
+      data->memState = CEED_HIP_BOTH_SYNC;
+    }
+    break;
+  case CEED_MEM_DEVICE:
+    if (data->memState == CEED_HIP_HOST_SYNC) {
+      if (!data->d_array) {
+        ierr = CeedHipMalloc(ceed, (void **)&data->d_array_allocated,
+                              bytes(vec));
+        CeedChk(ierr);
+        data->d_array = data->d_array_allocated;
+      }
+      ierr = CeedVectorSyncH2D_Hip(vec); CeedChk(ierr);
+      data->memState = CEED_HIP_BOTH_SYNC;
+    }
+    break;
+  case CEED_MEM_UNIFIED:
+    ierr = CeedVectorSetUnified_Hip(vec); CeedChk(ierr);
+    break;
   }
+  ierr = CeedVectorUpdateMemory_Hip(vec); CeedChk(ierr);
   return 0;
 }
 
@@ -368,18 +837,18 @@ static int CeedVectorNorm_Hip(CeedVector vec, CeedNormType type,
   ierr = CeedVectorGetArrayRead(vec, CEED_MEM_DEVICE, &d_array); CeedChk(ierr);
   switch (type) {
   case CEED_NORM_1: {
-    ierr = hipblasDasum(handle, length, d_array, 1, norm);
+    ierr = hipblasXasum(handle, length, d_array, 1, norm);
     CeedChk_Hipblas(ceed, ierr);
     break;
   }
   case CEED_NORM_2: {
-    ierr = hipblasDnrm2(handle, length, d_array, 1, norm);
+    ierr = hipblasXnrm2(handle, length, d_array, 1, norm);
     CeedChk_Hipblas(ceed, ierr);
     break;
   }
   case CEED_NORM_MAX: {
     CeedInt indx;
-    ierr = hipblasIdamax(handle, length, d_array, 1, &indx);
+    ierr = hipblasIXamax(handle, length, d_array, 1, &indx);
     CeedChk_Hipblas(ceed, ierr);
     CeedScalar normNoAbs;
     ierr = hipMemcpy(&normNoAbs, data->d_array+indx-1, sizeof(CeedScalar),
@@ -421,6 +890,7 @@ static int CeedVectorReciprocal_Hip(CeedVector vec) {
   ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
 
   // Set value for synced device/host array
+  ierr = CeedVectorWaitTransfer_Hip(vec); CeedChk(ierr);
   switch(data->memState) {
   case CEED_HIP_HOST_SYNC:
     ierr = CeedHostReciprocal_Hip(data->h_array, length); CeedChk(ierr);
@@ -430,6 +900,7 @@ static int CeedVectorReciprocal_Hip(CeedVector vec) {
     break;
   case CEED_HIP_BOTH_SYNC:
     ierr = CeedDeviceReciprocal_Hip(data->d_array, length); CeedChk(ierr);
+    data->memState = CEED_HIP_DEVICE_SYNC;
     ierr = CeedVectorSyncArray(vec, CEED_MEM_HOST); CeedChk(ierr);
     break;
   // LCOV_EXCL_START
@@ -440,6 +911,377 @@ static int CeedVectorReciprocal_Hip(CeedVector vec) {
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Invert point blocks on device (impl in .hip file)
+//------------------------------------------------------------------------------
+int CeedDevicePointBlockInvert_Hip(CeedScalar *d_array, CeedInt bsize,
+                                   CeedInt length);
+
+//------------------------------------------------------------------------------
+// Invert the point blocks of a vector in place
+//------------------------------------------------------------------------------
+static int CeedVectorPointBlockInvert_Hip(CeedVector vec, CeedInt bsize) {
+  int ierr;
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  CeedScalar *d_array;
+  ierr = CeedVectorGetArray(vec, CEED_MEM_DEVICE, &d_array); CeedChk(ierr);
+  ierr = CeedDevicePointBlockInvert_Hip(d_array, bsize, length); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(vec, &d_array); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute y = alpha x + y on device (impl in .hip file)
+//------------------------------------------------------------------------------
+int CeedDeviceAXPY_Hip(CeedScalar *y_array, CeedScalar alpha,
+                        const CeedScalar *x_array, CeedInt length);
+
+//------------------------------------------------------------------------------
+// Compute y = alpha x + y
+//------------------------------------------------------------------------------
+static int CeedVectorAXPY_Hip(CeedVector y, CeedScalar alpha, CeedVector x) {
+  int ierr;
+  CeedInt length;
+  ierr = CeedVectorGetLength(y, &length); CeedChk(ierr);
+
+  CeedScalar *y_array;
+  const CeedScalar *x_array;
+  ierr = CeedVectorGetArray(y, CEED_MEM_DEVICE, &y_array); CeedChk(ierr);
+  if (x != y) {
+    ierr = CeedVectorGetArrayRead(x, CEED_MEM_DEVICE, &x_array); CeedChk(ierr);
+  } else {
+    x_array = y_array;
+  }
+  ierr = CeedDeviceAXPY_Hip(y_array, alpha, x_array, length); CeedChk(ierr);
+  if (x != y) {
+    ierr = CeedVectorRestoreArrayRead(x, &x_array); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArray(y, &y_array); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute y = alpha x + beta y on device (impl in .hip file)
+//------------------------------------------------------------------------------
+int CeedDeviceAXPBY_Hip(CeedScalar *y_array, CeedScalar alpha,
+                         CeedScalar beta, const CeedScalar *x_array,
+                         CeedInt length);
+
+//------------------------------------------------------------------------------
+// Compute y = alpha x + beta y
+//------------------------------------------------------------------------------
+static int CeedVectorAXPBY_Hip(CeedVector y, CeedScalar alpha,
+                                CeedScalar beta, CeedVector x) {
+  int ierr;
+  CeedInt length;
+  ierr = CeedVectorGetLength(y, &length); CeedChk(ierr);
+
+  CeedScalar *y_array;
+  const CeedScalar *x_array;
+  ierr = CeedVectorGetArray(y, CEED_MEM_DEVICE, &y_array); CeedChk(ierr);
+  if (x != y) {
+    ierr = CeedVectorGetArrayRead(x, CEED_MEM_DEVICE, &x_array); CeedChk(ierr);
+  } else {
+    x_array = y_array;
+  }
+  ierr = CeedDeviceAXPBY_Hip(y_array, alpha, beta, x_array, length);
+  CeedChk(ierr);
+  if (x != y) {
+    ierr = CeedVectorRestoreArrayRead(x, &x_array); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArray(y, &y_array); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute the pointwise product w = x .* y on device (impl in .hip file)
+//------------------------------------------------------------------------------
+int CeedDevicePointwiseMult_Hip(CeedScalar *w_array, const CeedScalar *x_array,
+                                 const CeedScalar *y_array, CeedInt length);
+
+//------------------------------------------------------------------------------
+// Compute the pointwise product w = x .* y
+//------------------------------------------------------------------------------
+static int CeedVectorPointwiseMult_Hip(CeedVector w, CeedVector x,
+                                        CeedVector y) {
+  int ierr;
+  CeedInt length;
+  ierr = CeedVectorGetLength(w, &length); CeedChk(ierr);
+
+  CeedScalar *w_array;
+  const CeedScalar *x_array, *y_array;
+  ierr = CeedVectorGetArray(w, CEED_MEM_DEVICE, &w_array); CeedChk(ierr);
+  if (x != w) {
+    ierr = CeedVectorGetArrayRead(x, CEED_MEM_DEVICE, &x_array); CeedChk(ierr);
+  } else {
+    x_array = w_array;
+  }
+  if (y != w && y != x) {
+    ierr = CeedVectorGetArrayRead(y, CEED_MEM_DEVICE, &y_array); CeedChk(ierr);
+  } else {
+    y_array = y == w ? w_array : x_array;
+  }
+  ierr = CeedDevicePointwiseMult_Hip(w_array, x_array, y_array, length);
+  CeedChk(ierr);
+  if (y != w && y != x) {
+    ierr = CeedVectorRestoreArrayRead(y, &y_array); CeedChk(ierr);
+  }
+  if (x != w) {
+    ierr = CeedVectorRestoreArrayRead(x, &x_array); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArray(w, &w_array); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Chebyshev smoother update on device (impl in .hip.cpp file)
+//------------------------------------------------------------------------------
+int CeedDeviceChebyshevUpdate_Hip(CeedScalar *x_array, CeedScalar *d_array,
+    CeedScalar *r_array, const CeedScalar *w_array,
+    const CeedScalar *dinv_array, CeedScalar alpha, CeedScalar beta,
+    CeedInt length);
+
+//------------------------------------------------------------------------------
+// Update the iterates of a Chebyshev smoother
+//------------------------------------------------------------------------------
+static int CeedVectorChebyshevUpdate_Hip(CeedVector x, CeedVector d,
+    CeedVector r, CeedVector w, CeedVector dinv, CeedScalar alpha,
+    CeedScalar beta) {
+  int ierr;
+  CeedInt length;
+  ierr = CeedVectorGetLength(x, &length); CeedChk(ierr);
+
+  CeedScalar *x_array, *d_array, *r_array;
+  const CeedScalar *w_array = NULL, *dinv_array;
+  ierr = CeedVectorGetArray(x, CEED_MEM_DEVICE, &x_array); CeedChk(ierr);
+  ierr = CeedVectorGetArray(d, CEED_MEM_DEVICE, &d_array); CeedChk(ierr);
+  ierr = CeedVectorGetArray(r, CEED_MEM_DEVICE, &r_array); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(dinv, CEED_MEM_DEVICE, &dinv_array);
+  CeedChk(ierr);
+  if (w != CEED_VECTOR_NONE) {
+    ierr = CeedVectorGetArrayRead(w, CEED_MEM_DEVICE, &w_array); CeedChk(ierr);
+  }
+  ierr = CeedDeviceChebyshevUpdate_Hip(x_array, d_array, r_array, w_array,
+                                     dinv_array, alpha, beta, length);
+  CeedChk(ierr);
+  if (w != CEED_VECTOR_NONE) {
+    ierr = CeedVectorRestoreArrayRead(w, &w_array); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArrayRead(dinv, &dinv_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(r, &r_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(d, &d_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(x, &x_array); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute the dot product of two vectors
+//------------------------------------------------------------------------------
+static int CeedVectorDot_Hip(CeedVector x, CeedVector y, CeedScalar *result) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(x, &ceed); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(x, &length); CeedChk(ierr);
+  hipblasHandle_t handle;
+  ierr = CeedHipGetHipblasHandle(ceed, &handle); CeedChk(ierr);
+
+  const CeedScalar *x_array, *y_array;
+  ierr = CeedVectorGetArrayRead(x, CEED_MEM_DEVICE, &x_array); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(y, CEED_MEM_DEVICE, &y_array); CeedChk(ierr);
+  ierr = hipblasXdot(handle, length, x_array, 1, y_array, 1, result);
+  CeedChk_Hipblas(ceed, ierr);
+  ierr = CeedVectorRestoreArrayRead(y, &y_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(x, &x_array); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Reduce vectors on device (impl in .hip file)
+//------------------------------------------------------------------------------
+CeedInt CeedDeviceReduceWorkSize_Hip(CeedInt length);
+int CeedDeviceReduce_Hip(const CeedScalar *x_array, const CeedScalar *y_array,
+                          CeedInt length, CeedScalar *d_work);
+
+//------------------------------------------------------------------------------
+// Reduce x and y on device, copying the requested statistics into out;
+//   nothing waits for the result on the host
+//------------------------------------------------------------------------------
+static int CeedVectorReduce_Hip(CeedVector x, CeedVector y, CeedInt nout,
+                                 const CeedInt *stats, CeedVector out) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(x, &ceed); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(x, &length); CeedChk(ierr);
+
+  const CeedInt worksize = CeedDeviceReduceWorkSize_Hip(length);
+  CeedScalar *d_work;
+  ierr = CeedHipMalloc(ceed, (void **)&d_work, worksize*sizeof(CeedScalar));
+  CeedChk(ierr);
+
+  const CeedScalar *x_array, *y_array;
+  CeedScalar *out_array;
+  ierr = CeedVectorGetArrayRead(x, CEED_MEM_DEVICE, &x_array); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(y, CEED_MEM_DEVICE, &y_array); CeedChk(ierr);
+  ierr = CeedDeviceReduce_Hip(x_array, y_array, length, d_work); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(y, &y_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(x, &x_array); CeedChk(ierr);
+
+  // The statistics follow the block partials in the workspace
+  const CeedScalar *d_stats = d_work + worksize - 4;
+  ierr = CeedVectorGetArray(out, CEED_MEM_DEVICE, &out_array); CeedChk(ierr);
+  for (CeedInt i = 0; i < nout; i++) {
+    ierr = hipMemcpyAsync(&out_array[i], &d_stats[stats[i]],
+                           sizeof(CeedScalar), hipMemcpyDeviceToDevice, 0);
+    CeedChk_Hip(ceed, ierr);
+  }
+  ierr = CeedVectorRestoreArray(out, &out_array); CeedChk(ierr);
+
+  // Later work on the stream is ordered after the copies, so the workspace
+  //   may be reused right away
+  ierr = CeedHipFree(ceed, d_work); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute several norms of a vector in a single pass, storing them on device
+//------------------------------------------------------------------------------
+static int CeedVectorNorms_Hip(CeedVector vec, CeedInt nnorms,
+                                const CeedNormType *types, CeedVector norms) {
+  int ierr;
+  CeedInt *stats;
+  ierr = CeedMalloc(nnorms, &stats); CeedChk(ierr);
+  for (CeedInt i = 0; i < nnorms; i++)
+    switch (types[i]) {
+    case CEED_NORM_1:
+      stats[i] = 0;
+      break;
+    case CEED_NORM_2:
+      stats[i] = 3;
+      break;
+    case CEED_NORM_MAX:
+      stats[i] = 2;
+      break;
+    }
+  ierr = CeedVectorReduce_Hip(vec, vec, nnorms, stats, norms); CeedChk(ierr);
+  ierr = CeedFree(&stats); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute the dot product of two vectors, storing it on device
+//------------------------------------------------------------------------------
+static int CeedVectorDotVector_Hip(CeedVector x, CeedVector y,
+                                    CeedVector dot) {
+  const CeedInt stats[1] = {1};
+  return CeedVectorReduce_Hip(x, y, 1, stats, dot);
+}
+
+//------------------------------------------------------------------------------
+// Fused updates and dot products on device (impl in .cu file)
+//------------------------------------------------------------------------------
+CeedInt CeedDeviceMultiBlocks_Hip(CeedInt length);
+int CeedDeviceMultiAXPBYDot_Hip(CeedScalar **arrays,
+    const CeedVectorMulti *multi, CeedInt length, CeedScalar *d_work,
+    CeedScalar *dots_array);
+
+//------------------------------------------------------------------------------
+// Apply several updates and dot products in one pass, storing the dot
+//   products on device
+//------------------------------------------------------------------------------
+static int CeedVectorMultiAXPBYDot_Hip(CeedVector *vecs,
+    const CeedVectorMulti *multi, CeedVector dots) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vecs[0], &ceed); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vecs[0], &length); CeedChk(ierr);
+
+  const CeedInt worksize = (multi->ndot ? multi->ndot : 1) *
+                           CeedDeviceMultiBlocks_Hip(length);
+  CeedScalar *d_work, *dots_array = NULL;
+  ierr = CeedHipMalloc(ceed, (void **)&d_work, worksize*sizeof(CeedScalar));
+  CeedChk(ierr);
+  CeedScalar *arrays[CEED_VECTOR_MULTI_MAX];
+  for (CeedInt j = 0; j < multi->nvecs; j++) {
+    if (multi->write[j]) {
+      ierr = CeedVectorGetArray(vecs[j], CEED_MEM_DEVICE, &arrays[j]);
+      CeedChk(ierr);
+    } else {
+      ierr = CeedVectorGetArrayRead(vecs[j], CEED_MEM_DEVICE,
+                                    (const CeedScalar **)&arrays[j]);
+      CeedChk(ierr);
+    }
+  }
+  if (multi->ndot) {
+    ierr = CeedVectorGetArray(dots, CEED_MEM_DEVICE, &dots_array);
+    CeedChk(ierr);
+  }
+  ierr = CeedDeviceMultiAXPBYDot_Hip(arrays, multi, length, d_work,
+                                     dots_array); CeedChk(ierr);
+  if (multi->ndot) {
+    ierr = CeedVectorRestoreArray(dots, &dots_array); CeedChk(ierr);
+  }
+  for (CeedInt j = 0; j < multi->nvecs; j++) {
+    if (multi->write[j]) {
+      ierr = CeedVectorRestoreArray(vecs[j], &arrays[j]); CeedChk(ierr);
+    } else {
+      ierr = CeedVectorRestoreArrayRead(vecs[j],
+                                        (const CeedScalar **)&arrays[j]);
+      CeedChk(ierr);
+    }
+  }
+
+  // Later work on the stream is ordered after the kernels, so the workspace
+  //   may be freed right away
+  ierr = CeedHipFree(ceed, d_work); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Reduce segments of a vector on device (impl in .cu file)
+//------------------------------------------------------------------------------
+CeedInt CeedDeviceSegmentBlocks_Hip(CeedInt seglen);
+int CeedDeviceReduceSegments_Hip(const CeedScalar *x_array, CeedInt nseg,
+                                 CeedInt seglen, CeedReduceType rtype,
+                                 bool add, CeedScalar *d_work,
+                                 CeedScalar *result_array);
+
+//------------------------------------------------------------------------------
+// Reduce contiguous segments of a vector, storing the results on device
+//------------------------------------------------------------------------------
+static int CeedVectorReduceSegments_Hip(CeedVector vec, CeedReduceType rtype,
+                                        bool add, CeedVector result) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedInt length, nseg;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+  ierr = CeedVectorGetLength(result, &nseg); CeedChk(ierr);
+  const CeedInt seglen = length / nseg;
+
+  const CeedInt worksize = nseg*CeedDeviceSegmentBlocks_Hip(seglen);
+  CeedScalar *d_work;
+  ierr = CeedHipMalloc(ceed, (void **)&d_work, worksize*sizeof(CeedScalar));
+  CeedChk(ierr);
+  const CeedScalar *x_array;
+  CeedScalar *result_array;
+  ierr = CeedVectorGetArrayRead(vec, CEED_MEM_DEVICE, &x_array); CeedChk(ierr);
+  ierr = CeedVectorGetArray(result, CEED_MEM_DEVICE, &result_array);
+  CeedChk(ierr);
+  ierr = CeedDeviceReduceSegments_Hip(x_array, nseg, seglen, rtype, add,
+                                     d_work, result_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(result, &result_array); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(vec, &x_array); CeedChk(ierr);
+
+  // Later work on the stream is ordered after the reduction
+  ierr = CeedHipFree(ceed, d_work); CeedChk(ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Destroy the vector
 //------------------------------------------------------------------------------
@@ -450,8 +1292,13 @@ static int CeedVectorDestroy_Hip(const CeedVector vec) {
   CeedVector_Hip *data;
   ierr = CeedVectorGetData(vec, &data); CeedChk(ierr);
 
-  ierr = hipFree(data->d_array_allocated); CeedChk_Hip(ceed, ierr);
-  ierr = CeedFree(&data->h_array_allocated); CeedChk(ierr);
+  ierr = CeedVectorUnsetUnified_Hip(vec); CeedChk(ierr);
+  ierr = CeedVectorHostUnregister_Hip(vec); CeedChk(ierr);
+  ierr = CeedVectorHostFree_Hip(vec); CeedChk(ierr);
+  if (data->transfer) {
+    ierr = hipEventDestroy(data->transfer); CeedChk_Hip(ceed, ierr);
+  }
+  ierr = CeedHipFree(ceed, data->d_array_allocated); CeedChk(ierr);
   ierr = CeedFree(&data); CeedChk(ierr);
   return 0;
 }
@@ -471,6 +1318,10 @@ int CeedVectorCreate_Hip(CeedInt n, CeedVector vec) {
                                 CeedVectorTakeArray_Hip); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "SetValue",
                                 CeedVectorSetValue_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Copy",
+                                CeedVectorCopy_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "SyncArray",
+                                CeedVectorSyncArray_Hip); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "GetArray",
                                 CeedVectorGetArray_Hip); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "GetArrayRead",
@@ -483,6 +1334,26 @@ int CeedVectorCreate_Hip(CeedInt n, CeedVector vec) {
                                 CeedVectorNorm_Hip); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Reciprocal",
                                 CeedVectorReciprocal_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "PointBlockInvert",
+                                CeedVectorPointBlockInvert_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "AXPY",
+                                CeedVectorAXPY_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "AXPBY",
+                                CeedVectorAXPBY_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "PointwiseMult",
+                                CeedVectorPointwiseMult_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Dot",
+                                CeedVectorDot_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Norms",
+                                CeedVectorNorms_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "ReduceSegments",
+                                CeedVectorReduceSegments_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "DotVector",
+                                CeedVectorDotVector_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "MultiAXPBYDot",
+                                CeedVectorMultiAXPBYDot_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "ChebyshevUpdate",
+                                CeedVectorChebyshevUpdate_Hip); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Destroy",
                                 CeedVectorDestroy_Hip); CeedChk(ierr);
 
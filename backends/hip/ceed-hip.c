@@ -14,8 +14,17 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdarg.h>
+#include <time.h>
+#ifdef CEED_HIP_ROCTX
+#include <roctracer/roctx.h>
+#endif
+#ifdef CEED_HIP_ROCM_SMI
+#include <rocm_smi/rocm_smi.h>
+#endif
 #include "ceed-hip.h"
 
 //------------------------------------------------------------------------------
@@ -26,6 +35,28 @@ static int CeedGetPreferredMemType_Hip(CeedMemType *type) {
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Resource of a delegate Ceed on the same device
+//------------------------------------------------------------------------------
+int CeedHipDelegateResource(const char *resource, const char *prefix,
+                            char *delegate) {
+  const char *device = strstr(resource, ":device_id=");
+  snprintf(delegate, CEED_MAX_RESOURCE_LEN, "%s%s", prefix,
+           device ? device : "");
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Make the device of the Ceed current
+//------------------------------------------------------------------------------
+static int CeedSetCurrentDevice_Hip(Ceed ceed) {
+  int ierr;
+  Ceed_Hip *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  ierr = hipSetDevice(data->deviceId); CeedChk_Hip(ceed, ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Device information backend init
 //------------------------------------------------------------------------------
@@ -33,7 +64,9 @@ int CeedHipInit(Ceed ceed, const char *resource, int nrc) {
   int ierr;
   const int rlen = strlen(resource);
   const bool slash = (rlen>nrc) ? (resource[nrc] == '/') : false;
-  const int deviceID = (slash && rlen > nrc + 1) ? atoi(&resource[nrc + 1]) : 0;
+  const char *device = strstr(resource, ":device_id=");
+  const int deviceID = device ? atoi(&device[11]) :
+                       (slash && rlen > nrc + 1) ? atoi(&resource[nrc + 1]) : 0;
 
   int currentDeviceID;
   ierr = hipGetDevice(&currentDeviceID); CeedChk_Hip(ceed,ierr);
@@ -41,28 +74,502 @@ int CeedHipInit(Ceed ceed, const char *resource, int nrc) {
     ierr = hipSetDevice(deviceID); CeedChk_Hip(ceed,ierr);
   }
 
-  struct hipDeviceProp_t deviceProp;
-  ierr = hipGetDeviceProperties(&deviceProp, deviceID); CeedChk_Hip(ceed,ierr);
-
+  // The device properties are only queried when a kernel is first compiled,
+  //   and the device context is only created on first use; the QFunction
+  //   block size is then set from the wavefront size
   Ceed_Hip *data;
   ierr = CeedGetData(ceed, &data); CeedChk(ierr);
   data->deviceId = deviceID;
   data->optblocksize = 256;
+
+  // Opt-in, since page-locking user arrays is costly and may fail for
+  //   arrays that are short lived or not page aligned
+  const char *hostregister = getenv("CEED_HOST_REGISTER");
+  data->hostregister = hostregister && strcmp(hostregister, "0");
+
+  // Opt-in, since graphs only pay off when the same operator is applied
+  //   repeatedly to the same vectors
+  const char *graphs = getenv("CEED_GRAPHS");
+  data->graphs = graphs && strcmp(graphs, "0");
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// Get hipBLAS handle
+// Share the device state of a Ceed with a delegate or operator fallback
+//
+// The HIP Ceeds of a delegate chain, such as /gpu/hip/gen, its /gpu/hip/shared
+//   delegate, their /gpu/hip/ref delegate and operator fallback, all use the
+//   hipBLAS handles of the outermost one, so each handle is only created
+//   once. Children from other backends are skipped.
 //------------------------------------------------------------------------------
+int CeedHipShareDevice(Ceed ceed, Ceed child) {
+  int ierr;
+  const char *resource;
+  ierr = CeedGetResource(child, &resource); CeedChk(ierr);
+  if (strncmp(resource, "/gpu/hip/ref", 12) &&
+      strncmp(resource, "/gpu/hip/shared", 15) &&
+      strncmp(resource, "/gpu/hip/gen", 12))
+    return 0;
+
+  Ceed_Hip *data;
+  ierr = CeedGetData(child, &data); CeedChk(ierr);
+  data->sharedceed = ceed;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Get the backend data holding the shared hipBLAS handles
+//------------------------------------------------------------------------------
+int CeedHipGetSharedData(Ceed ceed, Ceed_Hip **data) {
+  int ierr;
+  ierr = CeedGetData(ceed, data); CeedChk(ierr);
+  while ((*data)->sharedceed) {
+    ierr = CeedGetData((*data)->sharedceed, data); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Launch stream
+//
+// Work is issued on the per-thread default stream, as the backend is built
+//   with HIP_API_PER_THREAD_DEFAULT_STREAM, so operators applied on several
+//   host threads run concurrently. While an apply is captured as a graph, or
+//   runs on the stream of a composite suboperator, the launches of the
+//   calling thread are redirected to that stream.
+//------------------------------------------------------------------------------
+static __thread hipStream_t CeedHipStream = NULL;
+
+hipStream_t CeedHipGetStream(void) {
+  return CeedHipStream;
+}
+
+void CeedHipSetStream(hipStream_t stream) {
+  CeedHipStream = stream;
+}
+
+//------------------------------------------------------------------------------
+// Get the hipBLAS handle of the calling thread, bound to its launch stream
+//
+// hipBLAS handles are not shared between host threads, so each thread creates
+//   its own on first use.
+//------------------------------------------------------------------------------
+static int CeedHipGetThreadHipblasHandle(Ceed ceed, Ceed_Hip *data,
+    hipblasHandle_t *handle) {
+  int ierr;
+  const pthread_t self = pthread_self();
+
+  *handle = NULL;
+  for (CeedInt i = 0; i < data->numhipblas && !*handle; i++)
+    if (pthread_equal(data->hipblasthreads[i], self))
+      *handle = data->hipblashandles[i];
+  if (!*handle) {
+    ierr = hipblasCreate(handle); CeedChk_Hipblas(ceed, ierr);
+    ierr = CeedRealloc(data->numhipblas+1, &data->hipblasthreads);
+    CeedChk(ierr);
+    ierr = CeedRealloc(data->numhipblas+1, &data->hipblashandles);
+    CeedChk(ierr);
+    data->hipblasthreads[data->numhipblas] = self;
+    data->hipblashandles[data->numhipblas] = *handle;
+    data->numhipblas++;
+  }
+  return 0;
+}
+
 int CeedHipGetHipblasHandle(Ceed ceed, hipblasHandle_t *handle) {
+  int ierr;
+  Ceed_Hip *data;
+  ierr = CeedHipGetSharedData(ceed, &data); CeedChk(ierr);
+
+  ierr = CeedLock(ceed); CeedChk(ierr);
+  int ierrhandle = CeedHipGetThreadHipblasHandle(ceed, data, handle);
+  ierr = CeedUnlock(ceed); CeedChk(ierr);
+  CeedChk(ierrhandle);
+  hipStream_t stream = CeedHipGetStream();
+  ierr = hipblasSetStream(*handle, stream ? stream : hipStreamPerThread);
+  CeedChk_Hipblas(ceed, ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Device memory pool
+//
+// Freed device allocations are cached per Ceed and reused for later requests
+//   of similar size, so repeated setup and destruction of operators does not
+//   pay for hipMalloc and the device synchronization in hipFree. Each host
+//   thread issues its work on its own stream, so an event records the last
+//   use of a freed block, and the stream that reuses it waits for the event.
+//   The pool is shared by the threads of a Ceed and updated under CeedLock().
+//   When the application sets an allocator with CeedSetAllocator(), device
+//   memory comes from it instead and the pool is not used.
+//------------------------------------------------------------------------------
+static int CeedHipMallocLocked(Ceed ceed, Ceed_Hip *data, void **ptr,
+                                size_t bytes) {
+  int ierr;
+  if (!data->poolinuse)
+    data->poolinuse = kh_init(CeedHipPool);
+
+  // Smallest cached block that fits without wasting more than half of it
+  CeedInt best = -1;
+  for (CeedInt i=0; i<data->poolnumfree; i++) {
+    const size_t size = data->poolfree[i].bytes;
+    if (size >= bytes && size <= 2*bytes &&
+        (best < 0 || size < data->poolfree[best].bytes))
+      best = i;
+  }
+  if (best >= 0) {
+    CeedHipPoolBlock block = data->poolfree[best];
+    data->poolfree[best] = data->poolfree[--data->poolnumfree];
+    data->poolbytescached -= block.bytes;
+    ierr = hipStreamWaitEvent(CeedHipGetStream(), block.freed, 0);
+    CeedChk_Hip(ceed, ierr);
+    ierr = hipEventDestroy(block.freed); CeedChk_Hip(ceed, ierr);
+    *ptr = block.ptr;
+    bytes = block.bytes;
+  } else {
+    ierr = hipMalloc(ptr, bytes);
+    if (ierr == hipErrorOutOfMemory) {
+      // Return cached blocks to the device and try again
+      hipGetLastError();
+      ierr = CeedMemoryPoolTrim_Hip(ceed); CeedChk(ierr);
+      ierr = hipMalloc(ptr, bytes);
+    }
+    CeedChk_Hip(ceed, ierr);
+  }
+
+  int absent;
+  khint_t k = kh_put(CeedHipPool, data->poolinuse, (uintptr_t)*ptr, &absent);
+  kh_value(data->poolinuse, k) = bytes;
+  data->poolbytesinuse += bytes;
+  if (data->poolbytesinuse > data->poolhighwater)
+    data->poolhighwater = data->poolbytesinuse;
+  return 0;
+}
+
+int CeedHipMalloc(Ceed ceed, void **ptr, size_t bytes) {
+  int ierr;
+  Ceed_Hip *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  *ptr = NULL;
+  if (!bytes)
+    return 0;
+  bool used;
+  ierr = CeedAllocatorMalloc(ceed, CEED_MEMSPACE_DEVICE, bytes, ptr, &used);
+  CeedChk(ierr);
+  if (used)
+    return 0;
+  ierr = CeedLock(ceed); CeedChk(ierr);
+  int ierrmalloc = CeedHipMallocLocked(ceed, data, ptr, bytes);
+  ierr = CeedUnlock(ceed); CeedChk(ierr);
+  CeedChk(ierrmalloc);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Return device memory to the pool; memory not from the pool, such as arrays
+//   passed in with CEED_OWN_POINTER, is freed directly
+//------------------------------------------------------------------------------
+static int CeedHipFreeLocked(Ceed ceed, Ceed_Hip *data, void *ptr) {
+  int ierr;
+  khint_t k = data->poolinuse ? kh_get(CeedHipPool, data->poolinuse,
+                                       (uintptr_t)ptr) : 0;
+  if (!data->poolinuse || k == kh_end(data->poolinuse)) {
+    ierr = hipFree(ptr); CeedChk_Hip(ceed, ierr);
+    return 0;
+  }
+
+  const size_t bytes = kh_value(data->poolinuse, k);
+  kh_del(CeedHipPool, data->poolinuse, k);
+  data->poolbytesinuse -= bytes;
+  if (data->poolnumfree == data->poolmaxfree) {
+    data->poolmaxfree = data->poolmaxfree ? 2*data->poolmaxfree : 16;
+    ierr = CeedRealloc(data->poolmaxfree, &data->poolfree); CeedChk(ierr);
+  }
+  CeedHipPoolBlock *block = &data->poolfree[data->poolnumfree];
+  ierr = hipEventCreateWithFlags(&block->freed, hipEventDisableTiming);
+  CeedChk_Hip(ceed, ierr);
+  ierr = hipEventRecord(block->freed, CeedHipGetStream());
+  CeedChk_Hip(ceed, ierr);
+  block->ptr = ptr;
+  block->bytes = bytes;
+  data->poolnumfree++;
+  data->poolbytescached += bytes;
+  return 0;
+}
+
+int CeedHipFree(Ceed ceed, void *ptr) {
+  int ierr;
+  Ceed_Hip *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  if (!ptr)
+    return 0;
+  bool used;
+  ierr = CeedAllocatorFree(ceed, CEED_MEMSPACE_DEVICE, NULL, &used);
+  CeedChk(ierr);
+  if (used) {
+    // Work queued on this thread's stream may still use the memory
+    ierr = hipStreamSynchronize(CeedHipGetStream()); CeedChk_Hip(ceed, ierr);
+    ierr = CeedAllocatorFree(ceed, CEED_MEMSPACE_DEVICE, &ptr, &used);
+    CeedChk(ierr);
+    return 0;
+  }
+  ierr = CeedLock(ceed); CeedChk(ierr);
+  int ierrfree = CeedHipFreeLocked(ceed, data, ptr);
+  ierr = CeedUnlock(ceed); CeedChk(ierr);
+  CeedChk(ierrfree);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Remove device memory from the pool without freeing it, when ownership is
+//   is handed to the user by CeedVectorTakeArray
+//------------------------------------------------------------------------------
+int CeedHipRelease(Ceed ceed, void *ptr) {
   int ierr;
   Ceed_Hip *data;
   ierr = CeedGetData(ceed, &data); CeedChk(ierr);
 
-  if (!data->hipblasHandle) {
-    ierr = hipblasCreate(&data->hipblasHandle); CeedChk_Hipblas(ceed, ierr);
+  if (!ptr)
+    return 0;
+  ierr = CeedLock(ceed); CeedChk(ierr);
+  if (data->poolinuse) {
+    khint_t k = kh_get(CeedHipPool, data->poolinuse, (uintptr_t)ptr);
+    if (k != kh_end(data->poolinuse)) {
+      data->poolbytesinuse -= kh_value(data->poolinuse, k);
+      kh_del(CeedHipPool, data->poolinuse, k);
+    }
   }
-  *handle = data->hipblasHandle;
+  ierr = CeedUnlock(ceed); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Free all cached device memory
+//------------------------------------------------------------------------------
+static int CeedMemoryPoolTrimLocked_Hip(Ceed ceed, Ceed_Hip *data) {
+  int ierr;
+  for (CeedInt i=0; i<data->poolnumfree; i++) {
+    ierr = hipFree(data->poolfree[i].ptr); CeedChk_Hip(ceed, ierr);
+    ierr = hipEventDestroy(data->poolfree[i].freed); CeedChk_Hip(ceed, ierr);
+  }
+  data->poolnumfree = 0;
+  data->poolbytescached = 0;
+  return 0;
+}
+
+int CeedMemoryPoolTrim_Hip(Ceed ceed) {
+  int ierr;
+  Ceed_Hip *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  ierr = CeedLock(ceed); CeedChk(ierr);
+  int ierrtrim = CeedMemoryPoolTrimLocked_Hip(ceed, data);
+  ierr = CeedUnlock(ceed); CeedChk(ierr);
+  CeedChk(ierrtrim);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Memory pool usage
+//------------------------------------------------------------------------------
+int CeedMemoryPoolGetUsage_Hip(Ceed ceed, size_t *inuse, size_t *cached,
+                                size_t *highwater) {
+  int ierr;
+  Ceed_Hip *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  ierr = CeedLock(ceed); CeedChk(ierr);
+  *inuse = data->poolbytesinuse;
+  *cached = data->poolbytescached;
+  *highwater = data->poolhighwater;
+  ierr = CeedUnlock(ceed); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Request Wait
+//------------------------------------------------------------------------------
+static int CeedRequestWait_Hip(CeedRequest req) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedRequestGetCeed(req, &ceed); CeedChk(ierr);
+  hipEvent_t *event;
+  ierr = CeedRequestGetData(req, &event); CeedChk(ierr);
+
+  ierr = hipEventSynchronize(*event); CeedChk_Hip(ceed, ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Request Destroy
+//------------------------------------------------------------------------------
+static int CeedRequestDestroy_Hip(CeedRequest req) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedRequestGetCeed(req, &ceed); CeedChk(ierr);
+  hipEvent_t *event;
+  ierr = CeedRequestGetData(req, &event); CeedChk(ierr);
+
+  ierr = hipEventDestroy(*event); CeedChk_Hip(ceed, ierr);
+  ierr = CeedFree(&event); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Copy a kernel field pointer table to device memory, for tables too large to
+//   pass by value. The copy is ordered before the kernel on the launch stream;
+//   pageable host memory is staged before the call returns, so the table can
+//   be refilled for the next launch right away.
+//------------------------------------------------------------------------------
+int CeedHipCopyFieldsToDevice(Ceed ceed, const void *table, size_t bytes,
+                               void **d_table) {
+  int ierr;
+  if (!*d_table) {
+    ierr = CeedHipMalloc(ceed, d_table, bytes); CeedChk(ierr);
+  }
+  ierr = hipMemcpyAsync(*d_table, table, bytes, hipMemcpyHostToDevice,
+                        CeedHipGetStream()); CeedChk_Hip(ceed, ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Record an event after the work submitted so far and return it as a request
+//------------------------------------------------------------------------------
+int CeedRequestRecord_Hip(Ceed ceed, CeedRequest *request) {
+  int ierr;
+  if (request == CEED_REQUEST_IMMEDIATE || request == CEED_REQUEST_ORDERED)
+    return 0;
+
+  hipEvent_t *event;
+  ierr = CeedCalloc(1, &event); CeedChk(ierr);
+  ierr = hipEventCreateWithFlags(event, hipEventDisableTiming);
+  CeedChk_Hip(ceed, ierr);
+  ierr = hipEventRecord(*event, 0); CeedChk_Hip(ceed, ierr);
+
+  ierr = CeedRequestCreate(ceed, request); CeedChk(ierr);
+  ierr = CeedRequestSetData(*request, event); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Request", *request, "Wait",
+                                CeedRequestWait_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Request", *request, "Destroy",
+                                CeedRequestDestroy_Hip); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Open a roctx range for a profiled stage
+//------------------------------------------------------------------------------
+static int CeedProfilePush_Hip(Ceed ceed, const char *name) {
+  int ierr;
+  Ceed_Hip *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+#ifdef CEED_HIP_ROCTX
+  roctxRangePushA(name);
+#endif
+
+  // Pair the device and host clocks when the first stage opens, and again
+  //   every second, as elapsed times between events lose precision
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  const double now = ts.tv_sec + 1e-9*ts.tv_nsec;
+  if (!data->traceorigin) {
+    ierr = hipEventCreate(&data->traceorigin); CeedChk_Hip(ceed, ierr);
+    ierr = hipEventCreate(&data->traceend); CeedChk_Hip(ceed, ierr);
+    for (CeedInt i = 0; i < CEED_HIP_TRACE_DEPTH; i++) {
+      ierr = hipEventCreate(&data->tracestart[i]); CeedChk_Hip(ceed, ierr);
+    }
+  }
+  if (!data->tracedepth && (!data->traceorigintime ||
+                            now - data->traceorigintime > 1.0)) {
+    ierr = hipEventRecord(data->traceorigin, 0); CeedChk_Hip(ceed, ierr);
+    ierr = hipEventSynchronize(data->traceorigin); CeedChk_Hip(ceed, ierr);
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    data->traceorigintime = ts.tv_sec + 1e-9*ts.tv_nsec;
+  }
+  if (data->tracedepth < CEED_HIP_TRACE_DEPTH) {
+    ierr = hipEventRecord(data->tracestart[data->tracedepth], 0);
+    CeedChk_Hip(ceed, ierr);
+  }
+  data->tracedepth++;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Complete device work and close the roctx range for a profiled stage,
+//   reporting when the stage ran on the device
+//------------------------------------------------------------------------------
+static int CeedProfilePop_Hip(Ceed ceed, double *devstart, double *devend) {
+  int ierr;
+  Ceed_Hip *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  const CeedInt depth = --data->tracedepth;
+  if (depth < CEED_HIP_TRACE_DEPTH) {
+    ierr = hipEventRecord(data->traceend, 0); CeedChk_Hip(ceed, ierr);
+  }
+  ierr = hipDeviceSynchronize(); CeedChk_Hip(ceed, ierr);
+  if (depth < CEED_HIP_TRACE_DEPTH) {
+    float start, end;
+    ierr = hipEventElapsedTime(&start, data->traceorigin,
+                                data->tracestart[depth]);
+    CeedChk_Hip(ceed, ierr);
+    ierr = hipEventElapsedTime(&end, data->traceorigin, data->traceend);
+    CeedChk_Hip(ceed, ierr);
+    *devstart = data->traceorigintime + 1e-3*start;
+    *devend = data->traceorigintime + 1e-3*end;
+  }
+#ifdef CEED_HIP_ROCTX
+  roctxRangePop();
+#endif
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Read the energy used by the device, in joules, or a negative value if ROCm
+//   SMI does not report it for this device
+//------------------------------------------------------------------------------
+static int CeedEnergyRead_Hip(Ceed ceed, double *joules) {
+  *joules = -1.0;
+#ifdef CEED_HIP_ROCM_SMI
+  int ierr;
+  Ceed_Hip *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  // ROCm SMI may enumerate devices in another order, so match the PCI
+  //   domain, bus, and device, ignoring the function
+  if (!data->rsmitried) {
+    data->rsmitried = true;
+    if (rsmi_init(0) != RSMI_STATUS_SUCCESS)
+      return 0;
+    hipDeviceProp_t prop;
+    ierr = hipGetDeviceProperties(&prop, data->deviceId);
+    CeedChk_Hip(ceed, ierr);
+    const uint64_t bdfid = ((uint64_t)prop.pciDomainID << 32) |
+                           ((uint64_t)prop.pciBusID << 8) |
+                           ((uint64_t)prop.pciDeviceID << 3);
+    uint32_t numdevices = 0;
+    rsmi_num_monitor_devices(&numdevices);
+    for (uint32_t i = 0; i < numdevices && !data->rsmi; i++) {
+      uint64_t id;
+      if (rsmi_dev_pci_id_get(i, &id) == RSMI_STATUS_SUCCESS &&
+          (id & ~(uint64_t)0x7) == bdfid) {
+        data->rsmidevice = i;
+        data->rsmi = true;
+      }
+    }
+    if (!data->rsmi) {
+      rsmi_shut_down();
+      return 0;
+    }
+  }
+  uint64_t count, timestamp;
+  float resolution;
+  if (data->rsmi &&
+      rsmi_dev_energy_count_get(data->rsmidevice, &count, &resolution,
+                                &timestamp) == RSMI_STATUS_SUCCESS)
+    *joules = 1e-6*resolution*count;
+#endif
   return 0;
 }
 
@@ -73,9 +580,30 @@ int CeedDestroy_Hip(Ceed ceed) {
   int ierr;
   Ceed_Hip *data;
   ierr = CeedGetData(ceed, &data); CeedChk(ierr);
-  if (data->hipblasHandle) {
-    ierr = hipblasDestroy(data->hipblasHandle); CeedChk_Hipblas(ceed, ierr);
+  if (data->jithits || data->jitmisses)
+    CeedDebug("JIT cache: %d hits, %d misses", data->jithits, data->jitmisses);
+  for (CeedInt i = 0; i < data->numhipblas; i++) {
+    ierr = hipblasDestroy(data->hipblashandles[i]); CeedChk_Hipblas(ceed, ierr);
+  }
+  ierr = CeedFree(&data->hipblasthreads); CeedChk(ierr);
+  ierr = CeedFree(&data->hipblashandles); CeedChk(ierr);
+  if (data->poolhighwater)
+    CeedDebug("Device memory pool: %zu bytes high-water", data->poolhighwater);
+  if (data->traceorigin) {
+    ierr = hipEventDestroy(data->traceorigin); CeedChk_Hip(ceed, ierr);
+    ierr = hipEventDestroy(data->traceend); CeedChk_Hip(ceed, ierr);
+    for (CeedInt i = 0; i < CEED_HIP_TRACE_DEPTH; i++) {
+      ierr = hipEventDestroy(data->tracestart[i]); CeedChk_Hip(ceed, ierr);
+    }
   }
+#ifdef CEED_HIP_ROCM_SMI
+  if (data->rsmi)
+    rsmi_shut_down();
+#endif
+  ierr = CeedMemoryPoolTrim_Hip(ceed); CeedChk(ierr);
+  ierr = CeedFree(&data->poolfree); CeedChk(ierr);
+  if (data->poolinuse)
+    kh_destroy(CeedHipPool, data->poolinuse);
   ierr = CeedFree(&data); CeedChk(ierr);
   return 0;
 }
@@ -119,6 +647,20 @@ static int CeedInit_Hip(const char *resource, Ceed ceed) {
                                 CeedOperatorCreate_Hip); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "CompositeOperatorCreate",
                                 CeedCompositeOperatorCreate_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "ProfilePush",
+                                CeedProfilePush_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "ProfilePop",
+                                CeedProfilePop_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "EnergyRead",
+                                CeedEnergyRead_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "MemoryPoolTrim",
+                                CeedMemoryPoolTrim_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "MemoryPoolGetUsage",
+                                CeedMemoryPoolGetUsage_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "SetCurrentDevice",
+                                CeedSetCurrentDevice_Hip); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "ShareDevice",
+                                CeedHipShareDevice); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy",
                                 CeedDestroy_Hip); CeedChk(ierr);
   return 0;
@@ -129,6 +671,6 @@ static int CeedInit_Hip(const char *resource, Ceed ceed) {
 //------------------------------------------------------------------------------
 __attribute__((constructor))
 static void Register(void) {
-  CeedRegister("/gpu/hip/ref", CeedInit_Hip, 20);
+  CeedRegister("/gpu/hip/ref", CeedInit_Hip, 40);
 }
 //------------------------------------------------------------------------------
@@ -17,12 +17,23 @@
 #define _ceed_hip_h
 
 #include <ceed-backend.h>
+#include <ceed-hash.h>
 
 #include <hip/hip_runtime.h>
 #include <hipblas.h>
+#include <pthread.h>
 
 #define HIP_MAX_PATH 256
 
+// Field pointer tables larger than this are copied to device memory rather
+//   than passed by value, as kernel parameters are limited to 4 KB
+#define CEED_HIP_MAX_FIELDS_BYTES 2048
+// QFunction field tables keep at least the 16 slots per direction that user
+//   kernels set with CeedQFunctionSetHIPUserFunction() expect
+#define CEED_HIP_MIN_FIELD_SLOTS 16
+// Nesting depth of profiled stages timed on the device
+#define CEED_HIP_TRACE_DEPTH 8
+
 #define CeedChk_Hip(ceed, x) \
 do { \
   hipError_t result = x; \
@@ -41,6 +52,23 @@ do { \
    } \
 } while (0)
 
+// hipBLAS routines matching CeedScalar
+#ifdef CEED_SINGLE_PRECISION
+#  define hipblasXasum hipblasSasum
+#  define hipblasXnrm2 hipblasSnrm2
+#  define hipblasIXamax hipblasIsamax
+#  define hipblasXdot hipblasSdot
+#  define hipblasXgemm hipblasSgemm
+#  define hipblasXgemmStridedBatched hipblasSgemmStridedBatched
+#else
+#  define hipblasXasum hipblasDasum
+#  define hipblasXnrm2 hipblasDnrm2
+#  define hipblasIXamax hipblasIdamax
+#  define hipblasXdot hipblasDdot
+#  define hipblasXgemm hipblasDgemm
+#  define hipblasXgemmStridedBatched hipblasDgemmStridedBatched
+#endif
+
 #define QUOTE(...) #__VA_ARGS__
 
 #define CASE(name) case name: return #name
@@ -73,6 +101,12 @@ typedef struct {
   CeedScalar *d_array;
   CeedScalar *d_array_allocated;
   CeedHipSyncState memState;
+  bool h_array_pinned;              // h_array_allocated is page-locked
+  CeedScalar *h_array_registered;   // User array page-locked by the backend
+  hipEvent_t transfer;             // Completion of the last async transfer
+  bool transferpending;
+  bool unified;                     // h_array and d_array alias managed memory
+  CeedScalar *m_array_allocated;    // Managed allocation owned by the vector
 } CeedVector_Hip;
 
 typedef struct {
@@ -81,6 +115,16 @@ typedef struct {
   hipFunction_t noTrOffset;
   hipFunction_t trStrided;
   hipFunction_t trOffset;
+  hipFunction_t noTrCompressed;
+  hipFunction_t noTrOffsetVec2;
+  hipFunction_t trOffsetVec2;
+  hipFunction_t trOffsetSet;
+  hipFunction_t trOffsetSetVec2;
+  hipFunction_t noTrCompressedVec2;
+  hipFunction_t multiplicityOffset;
+  bool vec2;
+  bool tcovers;
+  bool sharedtables;
   CeedInt nnodes;
   CeedInt *h_ind;
   CeedInt *h_ind_allocated;
@@ -89,13 +133,18 @@ typedef struct {
   CeedInt *d_toffsets;
   CeedInt *d_tindices;
   CeedInt *d_lvec_indices;
+  CeedInt *d_eoffsets;
+  CeedInt *d_stencil;
 } CeedElemRestriction_Hip;
 
-// We use a struct to avoid having to memCpy the array of pointers
-// __global__ copies by value the struct.
+// The inputs and outputs share one host table, laid out like the kernel
+//   struct of two pointer arrays. __global__ copies the table by value, unless
+//   it is too large; then it is copied to d_fields and passed by pointer.
 typedef struct {
-  const CeedScalar *inputs[16];
-  CeedScalar *outputs[16];
+  const CeedScalar **inputs;
+  CeedScalar **outputs;
+  size_t bytes;
+  void *d_fields;
 } Fields_Hip;
 
 typedef struct {
@@ -127,8 +176,6 @@ typedef struct {
 
 typedef struct {
   hipModule_t module;
-  hipFunction_t interp;
-  hipFunction_t grad;
   hipFunction_t weight;
   CeedScalar *d_interp;
   CeedScalar *d_grad;
@@ -156,22 +203,106 @@ typedef struct {
   CeedInt    numein;
   CeedInt    numeout;
   CeedOperatorDiag_Hip *diag;
+  void **d_elow;          // Reduced precision passive input E-vector data
+  uint64_t *inputstate;   // State counter of reduced precision inputs
+  hipModule_t storagemodule;
+  hipFunction_t narrow[3]; // Kernels by CeedStorageType, CeedScalar to storage
+  hipFunction_t widen[3];  // Kernels by CeedStorageType, storage to CeedScalar
+  bool streamcapable;     // All kernels launch through HIP backend Ceeds
+  Ceed *streamceeds;      // Ceeds launching the kernels of an apply
+  CeedInt numstreamceeds;
+  CeedInt numapplies;     // Applies before capture, to compile and allocate
+  hipStream_t graphstream;
+  hipGraphExec_t graph;   // Captured apply, replayed while graphptrs match
+  const void **graphptrs; // Device arrays of inputs, outputs, and context
+  CeedInt numsubstreams;   // Composite: one stream per suboperator
+  hipStream_t *substreams;
+  hipEvent_t *subevents;   // Composite: fork and join of the substreams
+  CeedVector *suboutvecs;  // Composite: private outputs of suboperators
 } CeedOperator_Hip;
 
+// Device allocations owned by the memory pool, keyed by address
+KHASH_MAP_INIT_INT64(CeedHipPool, size_t)
+
+typedef struct {
+  void *ptr;
+  size_t bytes;
+  hipEvent_t freed; // Last use, on the launch stream of the freeing thread
+} CeedHipPoolBlock;
+
 typedef struct {
   int optblocksize;
   int deviceId;
-  hipblasHandle_t hipblasHandle;
+  int arch;          // GCN architecture, queried on first compile
+  int warpsize, numcu, maxthreadspercu; // Queried with arch
+  CeedInt numhipblas;    // hipBLAS handles, one per host thread, created on
+  pthread_t *hipblasthreads;      //   first use by the thread
+  hipblasHandle_t *hipblashandles;
+  CeedInt jithits;   // Kernels loaded from CEED_JIT_CACHE_DIR
+  CeedInt jitmisses; // Kernels compiled and added to CEED_JIT_CACHE_DIR
+  khash_t(CeedHipPool) *poolinuse; // Allocations handed out by the pool
+  CeedHipPoolBlock *poolfree;      // Freed allocations cached for reuse
+  CeedInt poolnumfree, poolmaxfree;
+  size_t poolbytesinuse, poolbytescached, poolhighwater;
+  bool hostregister; // Page-lock CEED_USE_POINTER arrays, CEED_HOST_REGISTER
+  bool graphs;       // Replay operator applies as HIP graphs, CEED_GRAPHS
+  Ceed sharedceed;    // HIP Ceed whose hipBLAS handles are used by this
+                      //   delegate or operator fallback
+  hipEvent_t traceorigin; // Device time origin of profiled stages
+  double traceorigintime; // Host time at which traceorigin completed
+  hipEvent_t tracestart[CEED_HIP_TRACE_DEPTH], traceend;
+  CeedInt tracedepth;     // Number of open profiled stages
+  bool rsmitried;         // ROCm SMI was initialized for the device energy
+  bool rsmi;
+  uint32_t rsmidevice;    // ROCm SMI index of the device
 } Ceed_Hip;
 
 static inline CeedInt CeedDivUpInt(CeedInt numer, CeedInt denom) {
   return (numer + denom - 1) / denom;
 }
 
+// Number of blocks for a grid-stride loop over n entries, enough to fill every
+//   compute unit once the device has been queried, but no more
+static inline CeedInt CeedHipGridSize(const Ceed_Hip *data, CeedInt n,
+                                      CeedInt blocksize) {
+  const CeedInt gridsize = CeedDivUpInt(n, blocksize);
+  if (!data->numcu)
+    return gridsize;
+  return CeedIntMin(gridsize, data->numcu *
+                    CeedIntMax(data->maxthreadspercu / blocksize, 1));
+}
+
+CEED_INTERN int CeedHipDelegateResource(const char *resource,
+    const char *prefix, char *delegate);
+
 CEED_INTERN int CeedHipInit(Ceed ceed, const char *resource, int nrc);
 
+CEED_INTERN int CeedHipShareDevice(Ceed ceed, Ceed child);
+
+CEED_INTERN int CeedHipGetSharedData(Ceed ceed, Ceed_Hip **data);
+
+CEED_INTERN int CeedHipCopyFieldsToDevice(Ceed ceed, const void *table,
+    size_t bytes, void **d_table);
+
 CEED_INTERN int CeedHipGetHipblasHandle(Ceed ceed, hipblasHandle_t *handle);
 
+CEED_INTERN hipStream_t CeedHipGetStream(void);
+
+CEED_INTERN void CeedHipSetStream(hipStream_t stream);
+
+CEED_INTERN int CeedHipMalloc(Ceed ceed, void **ptr, size_t bytes);
+
+CEED_INTERN int CeedHipFree(Ceed ceed, void *ptr);
+
+CEED_INTERN int CeedHipRelease(Ceed ceed, void *ptr);
+
+CEED_INTERN int CeedMemoryPoolTrim_Hip(Ceed ceed);
+
+CEED_INTERN int CeedMemoryPoolGetUsage_Hip(Ceed ceed, size_t *inuse,
+    size_t *cached, size_t *highwater);
+
+CEED_INTERN int CeedRequestRecord_Hip(Ceed ceed, CeedRequest *request);
+
 CEED_INTERN int CeedDestroy_Hip(Ceed ceed);
 
 CEED_INTERN int CeedVectorCreate_Hip(CeedInt n, CeedVector vec);
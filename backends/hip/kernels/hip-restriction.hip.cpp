@@ -0,0 +1,231 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+// the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+// reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed.h>
+#include <hip/hip_runtime.h>
+#include <hipcub/hipcub.hpp>
+
+static const int bsize = 512;
+
+static int gridSize(CeedInt size) {
+  return size / bsize + (size % bsize > 0);
+}
+
+//------------------------------------------------------------------------------
+// Kernel for marking the L-vector nodes read by the offsets
+//------------------------------------------------------------------------------
+__global__ static void markNodesK(const CeedInt *__restrict__ indices,
+                                  CeedInt size, CeedInt *__restrict__ isnode) {
+  int idx = threadIdx.x + blockDim.x * blockIdx.x;
+  if (idx >= size)
+    return;
+  isnode[indices[idx]] = 1;
+}
+
+//------------------------------------------------------------------------------
+// Kernel for listing the L-vector index of each node, after the scan of the
+//   node marks
+//------------------------------------------------------------------------------
+__global__ static void numberNodesK(const CeedInt *__restrict__ nodeoffset,
+                                    CeedInt lsize, CeedInt nnodes,
+                                    CeedInt *__restrict__ lvecindices) {
+  int idx = threadIdx.x + blockDim.x * blockIdx.x;
+  if (idx >= lsize)
+    return;
+  const CeedInt next = idx + 1 < lsize ? nodeoffset[idx + 1] : nnodes;
+  if (next != nodeoffset[idx])
+    lvecindices[nodeoffset[idx]] = idx;
+}
+
+//------------------------------------------------------------------------------
+// Kernel for counting the multiplicity of each node, shifted by one entry
+//------------------------------------------------------------------------------
+__global__ static void countNodesK(const CeedInt *__restrict__ indices,
+                                   CeedInt size,
+                                   const CeedInt *__restrict__ nodeoffset,
+                                   CeedInt *__restrict__ toffsets) {
+  int idx = threadIdx.x + blockDim.x * blockIdx.x;
+  if (idx >= size)
+    return;
+  atomicAdd(&toffsets[nodeoffset[indices[idx]] + 1], 1);
+}
+
+//------------------------------------------------------------------------------
+// Kernel for listing the E-vector indices of each node, in any order
+//------------------------------------------------------------------------------
+__global__ static void fillNodesK(const CeedInt *__restrict__ indices,
+                                  CeedInt size,
+                                  const CeedInt *__restrict__ nodeoffset,
+                                  const CeedInt *__restrict__ toffsets,
+                                  CeedInt *__restrict__ cursor,
+                                  CeedInt *__restrict__ tindices) {
+  int idx = threadIdx.x + blockDim.x * blockIdx.x;
+  if (idx >= size)
+    return;
+  const CeedInt node = nodeoffset[indices[idx]];
+  tindices[toffsets[node] + atomicAdd(&cursor[node], 1)] = idx;
+}
+
+//------------------------------------------------------------------------------
+// Kernel for sorting the E-vector indices of each node, so the transpose sums
+//   in the same order on every run; nodes are shared by few elements
+//------------------------------------------------------------------------------
+__global__ static void sortNodesK(const CeedInt *__restrict__ toffsets,
+                                  CeedInt nnodes,
+                                  CeedInt *__restrict__ tindices) {
+  int idx = threadIdx.x + blockDim.x * blockIdx.x;
+  if (idx >= nnodes)
+    return;
+  const CeedInt start = toffsets[idx], end = toffsets[idx + 1];
+  for (CeedInt i = start + 1; i < end; i++) {
+    const CeedInt lid = tindices[i];
+    CeedInt j = i;
+    for (; j > start && tindices[j - 1] > lid; j--)
+      tindices[j] = tindices[j - 1];
+    tindices[j] = lid;
+  }
+}
+
+//------------------------------------------------------------------------------
+// In-place exclusive or inclusive sum with hipCUB
+//------------------------------------------------------------------------------
+static int deviceScan(CeedInt *array, CeedInt size, bool inclusive) {
+  int ierr;
+  void *temp = NULL;
+  size_t bytes = 0;
+
+  ierr = inclusive ?
+         hipcub::DeviceScan::InclusiveSum(temp, bytes, array, array, size) :
+         hipcub::DeviceScan::ExclusiveSum(temp, bytes, array, array, size);
+  if (!ierr)
+    ierr = hipMalloc(&temp, bytes);
+  if (ierr)
+    return ierr;
+  ierr = inclusive ?
+         hipcub::DeviceScan::InclusiveSum(temp, bytes, array, array, size) :
+         hipcub::DeviceScan::ExclusiveSum(temp, bytes, array, array, size);
+  hipFree(temp);
+  return ierr;
+}
+
+//------------------------------------------------------------------------------
+// Kernel for counting how many node components write each L-vector entry
+//------------------------------------------------------------------------------
+__global__ static void hitNodesK(const CeedInt *__restrict__ lvecindices,
+                                 CeedInt nnodes, CeedInt ncomp,
+                                 CeedInt compstride, CeedInt lsize,
+                                 CeedInt *__restrict__ hits) {
+  int idx = threadIdx.x + blockDim.x * blockIdx.x;
+  if (idx >= nnodes)
+    return;
+  for (CeedInt k = 0; k < ncomp; k++) {
+    const CeedInt j = lvecindices[idx] + k*compstride;
+    if (j < lsize)
+      atomicAdd(&hits[j], 1);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Kernel for clearing a flag if any L-vector entry is not written exactly once
+//------------------------------------------------------------------------------
+__global__ static void checkHitsK(const CeedInt *__restrict__ hits,
+                                  CeedInt lsize, int *__restrict__ covers) {
+  int idx = threadIdx.x + blockDim.x * blockIdx.x;
+  if (idx >= lsize)
+    return;
+  if (hits[idx] != 1)
+    *covers = 0;
+}
+
+//------------------------------------------------------------------------------
+// Number the L-vector nodes read by the offsets; nodeoffset has lsize entries
+//------------------------------------------------------------------------------
+extern "C" int CeedDeviceRestrictionNodes_Hip(const CeedInt *d_ind,
+    CeedInt size, CeedInt lsize, CeedInt *nodeoffset, CeedInt *nnodes) {
+  int ierr;
+  CeedInt last;
+
+  ierr = hipMemset(nodeoffset, 0, lsize*sizeof(CeedInt));
+  if (ierr)
+    return ierr;
+  hipLaunchKernelGGL(markNodesK, dim3(gridSize(size)), dim3(bsize), 0, 0,
+                     d_ind, size, nodeoffset);
+  ierr = hipMemcpy(&last, nodeoffset + lsize - 1, sizeof(CeedInt),
+                   hipMemcpyDeviceToHost);
+  if (ierr)
+    return ierr;
+  ierr = deviceScan(nodeoffset, lsize, false);
+  if (ierr)
+    return ierr;
+  ierr = hipMemcpy(nnodes, nodeoffset + lsize - 1, sizeof(CeedInt),
+                   hipMemcpyDeviceToHost);
+  *nnodes += last;
+  return ierr;
+}
+
+//------------------------------------------------------------------------------
+// Build the transpose offsets and indices from the node numbering; cursor has
+//   nnodes entries
+//------------------------------------------------------------------------------
+extern "C" int CeedDeviceRestrictionTranspose_Hip(const CeedInt *d_ind,
+    CeedInt size, CeedInt lsize, CeedInt nnodes, const CeedInt *nodeoffset,
+    CeedInt *cursor, CeedInt *lvecindices, CeedInt *toffsets,
+    CeedInt *tindices) {
+  int ierr;
+
+  hipLaunchKernelGGL(numberNodesK, dim3(gridSize(lsize)), dim3(bsize), 0, 0,
+                     nodeoffset, lsize, nnodes, lvecindices);
+  ierr = hipMemset(toffsets, 0, (nnodes + 1)*sizeof(CeedInt));
+  if (!ierr)
+    ierr = hipMemset(cursor, 0, nnodes*sizeof(CeedInt));
+  if (ierr)
+    return ierr;
+  hipLaunchKernelGGL(countNodesK, dim3(gridSize(size)), dim3(bsize), 0, 0,
+                     d_ind, size, nodeoffset, toffsets);
+  ierr = deviceScan(toffsets, nnodes + 1, true);
+  if (ierr)
+    return ierr;
+  hipLaunchKernelGGL(fillNodesK, dim3(gridSize(size)), dim3(bsize), 0, 0,
+                     d_ind, size, nodeoffset, toffsets, cursor, tindices);
+  hipLaunchKernelGGL(sortNodesK, dim3(gridSize(nnodes)), dim3(bsize), 0, 0,
+                     toffsets, nnodes, tindices);
+  return hipGetLastError();
+}
+
+//------------------------------------------------------------------------------
+// Check whether the node components tile the L-vector without overlap; hits
+//   has lsize + 1 entries, the last one holding the result
+//------------------------------------------------------------------------------
+extern "C" int CeedDeviceRestrictionCovers_Hip(const CeedInt *lvecindices,
+    CeedInt nnodes, CeedInt ncomp, CeedInt compstride, CeedInt lsize,
+    CeedInt *hits, bool *covers) {
+  int ierr;
+
+  ierr = hipMemset(hits, 0, lsize*sizeof(CeedInt));
+  if (ierr)
+    return ierr;
+  hipLaunchKernelGGL(hitNodesK, dim3(gridSize(nnodes)), dim3(bsize), 0, 0,
+                     lvecindices, nnodes, ncomp, compstride, lsize, hits);
+  int *d_covers = (int *)(hits + lsize), h_covers = 1;
+  ierr = hipMemcpy(d_covers, &h_covers, sizeof(int), hipMemcpyHostToDevice);
+  if (ierr)
+    return ierr;
+  hipLaunchKernelGGL(checkHitsK, dim3(gridSize(lsize)), dim3(bsize), 0, 0,
+                     hits, lsize, d_covers);
+  ierr = hipMemcpy(&h_covers, d_covers, sizeof(int), hipMemcpyDeviceToHost);
+  *covers = h_covers;
+  return ierr;
+}
@@ -0,0 +1,276 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+// the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+// reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include "ceed-kokkos.h"
+
+//------------------------------------------------------------------------------
+// Tensor basis action in an execution space
+//
+// Each team applies the basis to one component of one element, contracting
+//   one dimension at a time through two buffers in team scratch memory. Nodes
+//   are element-major, [elem][comp][node], and gradients add a leading
+//   dimension index, [dim][elem][comp][qpt], so one element matches the
+//   layout of the operators of the delegate.
+//------------------------------------------------------------------------------
+template <class Exec>
+static int CeedBasisApplyTensor_Kokkos(Ceed ceed, CeedEvalMode emode,
+                                       bool transpose, CeedInt dim,
+                                       CeedInt ncomp, CeedInt P1d,
+                                       CeedInt Q1d, CeedInt nelem,
+                                       const CeedScalar *interp1d,
+                                       const CeedScalar *grad1d,
+                                       const CeedScalar *qweight1d,
+                                       const CeedScalar *u, CeedScalar *v) {
+  const CeedInt nnodes = CeedIntPow(P1d, dim), nqpt = CeedIntPow(Q1d, dim);
+
+  // Quadrature weights
+  if (emode == CEED_EVAL_WEIGHT) {
+    CeedKokkosView<Exec, const CeedScalar> w1d(qweight1d, Q1d);
+    CeedKokkosView<Exec, CeedScalar> w(v, nelem*nqpt);
+    CeedCallKokkos(ceed, Kokkos::parallel_for("CeedBasisWeight",
+                   Kokkos::RangePolicy<Exec>(0, nelem*nqpt),
+    KOKKOS_LAMBDA(const CeedInt i) {
+      CeedInt q = i % nqpt;
+      CeedScalar wq = 1.0;
+      for (CeedInt d = 0; d < dim; d++) {
+        wq *= w1d(q % Q1d);
+        q /= Q1d;
+      }
+      w(i) = wq;
+    }));
+    return 0;
+  }
+
+  // Interpolation and gradient
+  typedef Kokkos::TeamPolicy<Exec> Policy;
+  typedef typename Policy::member_type Member;
+  typedef Kokkos::View<CeedScalar *, typename Exec::scratch_memory_space,
+          Kokkos::MemoryTraits<Kokkos::Unmanaged>> Scratch;
+  const bool grad = emode == CEED_EVAL_GRAD;
+  const CeedInt P = transpose ? Q1d : P1d, Q = transpose ? P1d : Q1d;
+  const CeedInt stride0 = transpose ? 1 : P1d, stride1 = transpose ? P1d : 1;
+  const CeedInt usize = transpose ? nqpt : nnodes;
+  const CeedInt vsize = transpose ? nnodes : nqpt;
+  const CeedInt npass = grad ? dim : 1;
+  const CeedInt udimstride = grad && transpose ? nelem*ncomp*nqpt : 0;
+  const CeedInt vdimstride = grad && !transpose ? nelem*ncomp*nqpt : 0;
+  const CeedInt buflen = CeedIntPow(P1d > Q1d ? P1d : Q1d, dim);
+  CeedKokkosView<Exec, const CeedScalar> B(interp1d, P1d*Q1d);
+  CeedKokkosView<Exec, const CeedScalar> G(grad ? grad1d : interp1d,
+      P1d*Q1d);
+  CeedKokkosView<Exec, const CeedScalar> uv(u, (transpose ? npass : 1)*
+      nelem*ncomp*usize);
+  CeedKokkosView<Exec, CeedScalar> vv(v, (transpose ? 1 : npass)*
+                                      nelem*ncomp*vsize);
+
+  Policy policy(nelem*ncomp, Kokkos::AUTO);
+  policy.set_scratch_size(0, Kokkos::PerTeam(2*Scratch::shmem_size(buflen)));
+  CeedCallKokkos(ceed, Kokkos::parallel_for("CeedBasisTensor", policy,
+  KOKKOS_LAMBDA(const Member &team) {
+    const CeedInt ec = team.league_rank();
+    Scratch buf1(team.team_scratch(0), buflen);
+    Scratch buf2(team.team_scratch(0), buflen);
+
+    for (CeedInt pass = 0; pass < npass; pass++) {
+      const CeedInt uoff = ec*usize + pass*udimstride;
+      const CeedInt voff = ec*vsize + pass*vdimstride;
+      // Transposed gradients sum the contributions of each dimension
+      const bool add = transpose && pass > 0;
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, usize),
+      [&](const CeedInt k) {
+        buf1(k) = uv(uoff + k);
+      });
+      team.team_barrier();
+
+      CeedInt pre = usize, post = 1;
+      for (CeedInt d = 0; d < dim; d++) {
+        pre /= P;
+        const bool last = d == dim - 1, usegrad = grad && d == pass;
+        const Scratch &in = d % 2 ? buf2 : buf1;
+        const Scratch &out = d % 2 ? buf1 : buf2;
+
+        // Contract along middle index
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, pre*post*Q),
+        [&](const CeedInt k) {
+          const CeedInt c = k % post, j = (k / post) % Q, a = k / (post*Q);
+          CeedScalar vk = 0.0;
+          for (CeedInt b = 0; b < P; b++)
+            vk += (usegrad ? G : B)(j*stride0 + b*stride1) *
+                  in((a*P + b)*post + c);
+          if (!last)
+            out(k) = vk;
+          else if (add)
+            vv(voff + k) += vk;
+          else
+            vv(voff + k) = vk;
+        });
+        team.team_barrier();
+        post *= Q;
+      }
+    }
+  }));
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Basis apply - tensor
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedBasisApply_Kokkos(CeedBasis basis, const CeedInt nelem,
+                                 CeedTransposeMode tmode, CeedEvalMode emode,
+                                 CeedVector u, CeedVector v) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
+  CeedBasis_Kokkos *impl;
+  ierr = CeedBasisGetData(basis, &impl); CeedChk(ierr);
+  CeedInt dim, ncomp, P1d, Q1d;
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
+
+  switch (emode) {
+  case CEED_EVAL_INTERP:
+  case CEED_EVAL_GRAD:
+  case CEED_EVAL_WEIGHT:
+    break;
+  // LCOV_EXCL_START
+  // Evaluate the divergence to/from the quadrature points
+  case CEED_EVAL_DIV:
+    return CeedError(ceed, 1, "CEED_EVAL_DIV not supported");
+  // Evaluate the curl to/from the quadrature points
+  case CEED_EVAL_CURL:
+    return CeedError(ceed, 1, "CEED_EVAL_CURL not supported");
+  // Take no action, BasisApply should not have been called
+  case CEED_EVAL_NONE:
+    return CeedError(ceed, 1,
+                     "CEED_EVAL_NONE does not make sense in this context");
+    // LCOV_EXCL_STOP
+  }
+
+  // Values held only on the host, as in the element loop of the delegated
+  //   operator, are not moved to the device for one element; views of
+  //   vectors have no backend data and are used on the device
+  bool host = false;
+  if (!CeedKokkosHostAccessible<Space>()) {
+    CeedVector_Kokkos *vimpl;
+    ierr = CeedVectorGetData(emode == CEED_EVAL_WEIGHT ? v : u, &vimpl);
+    CeedChk(ierr);
+    host = vimpl && vimpl->memState == CeedVector_Kokkos::CEED_KOKKOS_HOST_SYNC;
+  }
+  const CeedMemType mtype = host ? CEED_MEM_HOST : CEED_MEM_DEVICE;
+
+  // Read vectors
+  const CeedScalar *d_u = NULL;
+  CeedScalar *d_v;
+  if (emode != CEED_EVAL_WEIGHT) {
+    ierr = CeedVectorGetArrayRead(u, mtype, &d_u); CeedChk(ierr);
+  }
+  ierr = CeedVectorGetArray(v, mtype, &d_v); CeedChk(ierr);
+
+  // Basis action
+  const bool transpose = tmode == CEED_TRANSPOSE;
+  if (host) {
+    const CeedScalar *interp1d, *grad1d, *qweight1d;
+    ierr = CeedBasisGetInterp1D(basis, &interp1d); CeedChk(ierr);
+    ierr = CeedBasisGetGrad1D(basis, &grad1d); CeedChk(ierr);
+    ierr = CeedBasisGetQWeights(basis, &qweight1d); CeedChk(ierr);
+    ierr = CeedBasisApplyTensor_Kokkos<Kokkos::DefaultHostExecutionSpace>(
+             ceed, emode, transpose, dim, ncomp, P1d, Q1d, nelem, interp1d,
+             grad1d, qweight1d, d_u, d_v); CeedChk(ierr);
+  } else {
+    ierr = CeedBasisApplyTensor_Kokkos<Space>(ceed, emode, transpose, dim,
+           ncomp, P1d, Q1d, nelem, impl->d_interp1d, impl->d_grad1d,
+           impl->d_qweight1d, d_u, d_v); CeedChk(ierr);
+  }
+
+  // Restore vectors
+  if (emode != CEED_EVAL_WEIGHT) {
+    ierr = CeedVectorRestoreArrayRead(u, &d_u); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArray(v, &d_v); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Destroy tensor basis
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedBasisDestroy_Kokkos(CeedBasis basis) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
+  CeedBasis_Kokkos *impl;
+  ierr = CeedBasisGetData(basis, &impl); CeedChk(ierr);
+
+  ierr = CeedKokkosFree<Space>(ceed, impl->d_qweight1d); CeedChk(ierr);
+  ierr = CeedKokkosFree<Space>(ceed, impl->d_interp1d); CeedChk(ierr);
+  ierr = CeedKokkosFree<Space>(ceed, impl->d_grad1d); CeedChk(ierr);
+  ierr = CeedFree(&impl); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Create tensor
+//------------------------------------------------------------------------------
+template <class Space>
+int CeedBasisCreateTensorH1_Kokkos(CeedInt dim, CeedInt P1d, CeedInt Q1d,
+                                   const CeedScalar *interp1d,
+                                   const CeedScalar *grad1d,
+                                   const CeedScalar *qref1d,
+                                   const CeedScalar *qweight1d,
+                                   CeedBasis basis) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
+  CeedBasis_Kokkos *impl;
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  ierr = CeedBasisSetData(basis, impl); CeedChk(ierr);
+
+  // Copy matrices to the memory space of the execution space
+  ierr = CeedKokkosMalloc<Space>(ceed, Q1d*sizeof(CeedScalar),
+                                 (void **)&impl->d_qweight1d); CeedChk(ierr);
+  ierr = CeedKokkosCopy<Space>(ceed, impl->d_qweight1d, false, qweight1d,
+                               true, Q1d); CeedChk(ierr);
+  ierr = CeedKokkosMalloc<Space>(ceed, P1d*Q1d*sizeof(CeedScalar),
+                                 (void **)&impl->d_interp1d); CeedChk(ierr);
+  ierr = CeedKokkosCopy<Space>(ceed, impl->d_interp1d, false, interp1d,
+                               true, P1d*Q1d); CeedChk(ierr);
+  ierr = CeedKokkosMalloc<Space>(ceed, P1d*Q1d*sizeof(CeedScalar),
+                                 (void **)&impl->d_grad1d); CeedChk(ierr);
+  ierr = CeedKokkosCopy<Space>(ceed, impl->d_grad1d, false, grad1d,
+                               true, P1d*Q1d); CeedChk(ierr);
+  ierr = CeedBasisTrackMemory(basis, CeedKokkosHostAccessible<Space>() ?
+                              CEED_MEMSPACE_HOST : CEED_MEMSPACE_DEVICE,
+                              (Q1d + 2*P1d*Q1d)*sizeof(CeedScalar));
+  CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Apply",
+                                (CeedKokkosFunction)
+                                CeedBasisApply_Kokkos<Space>); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Destroy",
+                                (CeedKokkosFunction)
+                                CeedBasisDestroy_Kokkos<Space>); CeedChk(ierr);
+  return 0;
+}
+
+#define CEED_KOKKOS_INSTANTIATE(Space) \
+  template int CeedBasisCreateTensorH1_Kokkos<Space>(CeedInt, CeedInt, \
+      CeedInt, const CeedScalar *, const CeedScalar *, const CeedScalar *, \
+      const CeedScalar *, CeedBasis);
+CEED_KOKKOS_FOREACH_SPACE(CEED_KOKKOS_INSTANTIATE)
+//------------------------------------------------------------------------------
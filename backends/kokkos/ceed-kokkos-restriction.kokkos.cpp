@@ -0,0 +1,298 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+// the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+// reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include "ceed-kokkos.h"
+
+//------------------------------------------------------------------------------
+// Apply restriction
+//
+// The E-vector is element-major, [elem][comp][node], as the operators of the
+//   delegate expect; the transpose of an offset restriction sums into shared
+//   L-vector nodes with atomics
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedElemRestrictionApply_Kokkos(CeedElemRestriction r,
+    CeedTransposeMode tmode, CeedVector u, CeedVector v, CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
+  CeedElemRestriction_Kokkos *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+  CeedInt nelem, elemsize, ncomp, lsize;
+  ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
+  const CeedInt nnodes = nelem*elemsize, esize = nnodes*ncomp;
+  const CeedInt compstride = impl->compstride;
+  const CeedInt snode = impl->strides[0], scomp = impl->strides[1],
+                selem = impl->strides[2];
+
+  // Get vectors
+  const CeedScalar *d_u;
+  CeedScalar *d_v;
+  ierr = CeedVectorGetArrayRead(u, CEED_MEM_DEVICE, &d_u); CeedChk(ierr);
+  ierr = CeedVectorGetArray(v, CEED_MEM_DEVICE, &d_v); CeedChk(ierr);
+  const CeedInt usize = tmode == CEED_NOTRANSPOSE ? lsize : esize;
+  const CeedInt vsize = tmode == CEED_NOTRANSPOSE ? esize : lsize;
+  CeedKokkosView<Space, const CeedScalar> uv(d_u, usize);
+  CeedKokkosView<Space, CeedScalar> vv(d_v, vsize);
+  CeedKokkosView<Space, const CeedInt> ind(impl->d_ind,
+      impl->d_ind ? nnodes : 0);
+  Kokkos::RangePolicy<Space> range(0, nnodes);
+
+  // Restrict
+  if (tmode == CEED_NOTRANSPOSE) {
+    // L-vector -> E-vector
+    if (impl->d_ind) {
+      // -- Offsets provided
+      CeedCallKokkos(ceed, Kokkos::parallel_for("CeedRestrictionOffset",
+                     range, KOKKOS_LAMBDA(const CeedInt node) {
+        const CeedInt i = ind(node), loc = node % elemsize,
+                      e = (node - loc)*ncomp + loc;
+        for (CeedInt comp = 0; comp < ncomp; comp++)
+          vv(e + comp*elemsize) = uv(i + comp*compstride);
+      }));
+    } else {
+      // -- Strided restriction
+      CeedCallKokkos(ceed, Kokkos::parallel_for("CeedRestrictionStrided",
+                     range, KOKKOS_LAMBDA(const CeedInt node) {
+        const CeedInt loc = node % elemsize, elem = node / elemsize,
+                      e = (node - loc)*ncomp + loc;
+        for (CeedInt comp = 0; comp < ncomp; comp++)
+          vv(e + comp*elemsize) = uv(loc*snode + comp*scomp + elem*selem);
+      }));
+    }
+  } else {
+    // E-vector -> L-vector
+    if (impl->d_ind) {
+      // -- Offsets provided
+      CeedCallKokkos(ceed, Kokkos::parallel_for("CeedRestrictionOffsetT",
+                     range, KOKKOS_LAMBDA(const CeedInt node) {
+        const CeedInt i = ind(node), loc = node % elemsize,
+                      e = (node - loc)*ncomp + loc;
+        for (CeedInt comp = 0; comp < ncomp; comp++)
+          Kokkos::atomic_add(&vv(i + comp*compstride), uv(e + comp*elemsize));
+      }));
+    } else {
+      // -- Strided restriction, every L-vector entry has one E-vector entry
+      CeedCallKokkos(ceed, Kokkos::parallel_for("CeedRestrictionStridedT",
+                     range, KOKKOS_LAMBDA(const CeedInt node) {
+        const CeedInt loc = node % elemsize, elem = node / elemsize,
+                      e = (node - loc)*ncomp + loc;
+        for (CeedInt comp = 0; comp < ncomp; comp++)
+          vv(loc*snode + comp*scomp + elem*selem) += uv(e + comp*elemsize);
+      }));
+    }
+  }
+
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
+
+  // Restore arrays
+  ierr = CeedVectorRestoreArrayRead(u, &d_u); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(v, &d_v); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Blocked not supported
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionApplyBlock_Kokkos(CeedElemRestriction r,
+    CeedInt block, CeedTransposeMode tmode, CeedVector u, CeedVector v,
+    CeedRequest *request) {
+  // LCOV_EXCL_START
+  int ierr;
+  Ceed ceed;
+  ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
+  return CeedError(ceed, 1, "Backend does not implement blocked restrictions");
+  // LCOV_EXCL_STOP
+}
+
+//------------------------------------------------------------------------------
+// Get offsets
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedElemRestrictionGetOffsets_Kokkos(CeedElemRestriction r,
+    CeedMemType mtype, const CeedInt **offsets) {
+  int ierr;
+  CeedElemRestriction_Kokkos *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+
+  if (mtype == CEED_MEM_DEVICE || CeedKokkosHostAccessible<Space>()) {
+    *offsets = impl->d_ind;
+    return 0;
+  }
+
+  // Offsets given in device memory are copied to the host on first use
+  if (!impl->h_ind && impl->d_ind) {
+    Ceed ceed;
+    CeedInt nelem, elemsize;
+    ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+    ierr = CeedMalloc(nelem*elemsize, &impl->h_ind_allocated); CeedChk(ierr);
+    ierr = CeedKokkosCopy<Space>(ceed, impl->h_ind_allocated, true,
+                                 (const CeedInt *)impl->d_ind, false,
+                                 nelem*elemsize); CeedChk(ierr);
+    impl->h_ind = impl->h_ind_allocated;
+    ierr = CeedElemRestrictionTrackMemory(r, CEED_MEMSPACE_HOST,
+                                          nelem*elemsize*sizeof(CeedInt));
+    CeedChk(ierr);
+  }
+  *offsets = impl->h_ind;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Destroy restriction
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedElemRestrictionDestroy_Kokkos(CeedElemRestriction r) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
+  CeedElemRestriction_Kokkos *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+
+  ierr = CeedFree(&impl->h_ind_allocated); CeedChk(ierr);
+  ierr = CeedKokkosFree<Space>(ceed, impl->d_ind_allocated); CeedChk(ierr);
+  ierr = CeedFree(&impl); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Create restriction
+//------------------------------------------------------------------------------
+template <class Space>
+int CeedElemRestrictionCreate_Kokkos(CeedMemType mtype, CeedCopyMode cmode,
+                                     const CeedInt *indices,
+                                     CeedElemRestriction r) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
+  CeedInt nsides;
+  ierr = CeedElemRestrictionGetNumSides(r, &nsides); CeedChk(ierr);
+  if (nsides > 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1,
+                     "Backend does not implement two-sided restrictions");
+  // LCOV_EXCL_STOP
+  if (mtype != CEED_MEM_HOST && mtype != CEED_MEM_DEVICE)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Only MemType = HOST or DEVICE supported");
+  // LCOV_EXCL_STOP
+  CeedElemRestriction_Kokkos *impl;
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  CeedInt nelem, elemsize;
+  ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+  const CeedInt size = nelem * elemsize;
+  impl->strides[0] = 1;
+  impl->strides[1] = size;
+  impl->strides[2] = elemsize;
+  impl->compstride = 1;
+
+  // Stride data
+  bool isStrided;
+  ierr = CeedElemRestrictionIsStrided(r, &isStrided); CeedChk(ierr);
+  if (isStrided) {
+    bool backendstrides;
+    ierr = CeedElemRestrictionHasBackendStrides(r, &backendstrides);
+    CeedChk(ierr);
+    if (!backendstrides) {
+      ierr = CeedElemRestrictionGetStrides(r, &impl->strides); CeedChk(ierr);
+    }
+  } else {
+    ierr = CeedElemRestrictionGetCompStride(r, &impl->compstride);
+    CeedChk(ierr);
+  }
+  ierr = CeedElemRestrictionSetData(r, impl); CeedChk(ierr);
+  CeedInt ncomp;
+  ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
+  CeedInt layout[3] = {1, elemsize, elemsize*ncomp};
+  ierr = CeedElemRestrictionSetELayout(r, layout); CeedChk(ierr);
+
+  // Offsets in the memory space of the execution space; host offsets are
+  //   used in place by host execution spaces
+  const bool host = mtype == CEED_MEM_HOST;
+  if (indices) {
+    if (cmode == CEED_COPY_VALUES ||
+        (host && !CeedKokkosHostAccessible<Space>())) {
+      ierr = CeedKokkosMalloc<Space>(ceed, size * sizeof(CeedInt),
+                                     (void **)&impl->d_ind_allocated);
+      CeedChk(ierr);
+      impl->d_ind = impl->d_ind_allocated;
+      ierr = CeedKokkosCopy<Space>(ceed, impl->d_ind, false, indices, host,
+                                   size); CeedChk(ierr);
+      ierr = CeedElemRestrictionTrackMemory(r, CeedKokkosHostAccessible<Space>()
+                                            ? CEED_MEMSPACE_HOST :
+                                            CEED_MEMSPACE_DEVICE,
+                                            size*sizeof(CeedInt));
+      CeedChk(ierr);
+      if (host && cmode != CEED_COPY_VALUES)
+        impl->h_ind = indices;
+      if (host && cmode == CEED_OWN_POINTER) {
+        impl->h_ind_allocated = (CeedInt *)indices;
+        ierr = CeedElemRestrictionTrackMemory(r, CEED_MEMSPACE_HOST,
+                                              size*sizeof(CeedInt));
+        CeedChk(ierr);
+      }
+    } else if (host && cmode == CEED_OWN_POINTER) {
+      // Host arrays are freed with CeedFree
+      impl->d_ind = impl->h_ind_allocated = (CeedInt *)indices;
+      ierr = CeedElemRestrictionTrackMemory(r, CEED_MEMSPACE_HOST,
+                                            size*sizeof(CeedInt));
+      CeedChk(ierr);
+    } else {
+      impl->d_ind = (CeedInt *)indices;
+      if (cmode == CEED_OWN_POINTER) {
+        impl->d_ind_allocated = impl->d_ind;
+        ierr = CeedElemRestrictionTrackMemory(r,
+                                              CeedKokkosHostAccessible<Space>()
+                                              ? CEED_MEMSPACE_HOST :
+                                              CEED_MEMSPACE_DEVICE,
+                                              size*sizeof(CeedInt));
+        CeedChk(ierr);
+      }
+    }
+  }
+
+  // Register backend functions
+  ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "Apply",
+                                (CeedKokkosFunction)
+                                CeedElemRestrictionApply_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "ApplyBlock",
+                                (CeedKokkosFunction)
+                                CeedElemRestrictionApplyBlock_Kokkos);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "GetOffsets",
+                                (CeedKokkosFunction)
+                                CeedElemRestrictionGetOffsets_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "Destroy",
+                                (CeedKokkosFunction)
+                                CeedElemRestrictionDestroy_Kokkos<Space>);
+  CeedChk(ierr);
+  return 0;
+}
+
+#define CEED_KOKKOS_INSTANTIATE(Space) \
+  template int CeedElemRestrictionCreate_Kokkos<Space>(CeedMemType, \
+      CeedCopyMode, const CeedInt *, CeedElemRestriction);
+CEED_KOKKOS_FOREACH_SPACE(CEED_KOKKOS_INSTANTIATE)
+//------------------------------------------------------------------------------
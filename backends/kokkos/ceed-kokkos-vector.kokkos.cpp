@@ -0,0 +1,660 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+// the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+// reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <math.h>
+#include <string.h>
+#include "ceed-kokkos.h"
+
+//------------------------------------------------------------------------------
+// Host access to a vector of a host execution space addresses the device
+//   array directly
+//------------------------------------------------------------------------------
+template <class Space>
+static bool CeedKokkosOnHost(CeedMemType mtype) {
+  return mtype != CEED_MEM_DEVICE && !CeedKokkosHostAccessible<Space>();
+}
+
+//------------------------------------------------------------------------------
+// Allocate the host array of a vector
+//------------------------------------------------------------------------------
+static int CeedVectorHostMalloc_Kokkos(CeedVector vec) {
+  int ierr;
+  CeedVector_Kokkos *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  ierr = CeedMalloc(length, &impl->h_array_allocated); CeedChk(ierr);
+  impl->h_array = impl->h_array_allocated;
+  ierr = CeedVectorTrackMemory(vec, CEED_MEMSPACE_HOST,
+                               length * sizeof(CeedScalar)); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Free the host array of a vector
+//------------------------------------------------------------------------------
+static int CeedVectorHostFree_Kokkos(CeedVector vec) {
+  int ierr;
+  CeedVector_Kokkos *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  if (!impl->h_array_allocated)
+    return 0;
+  if (impl->h_array == impl->h_array_allocated)
+    impl->h_array = NULL;
+  ierr = CeedFree(&impl->h_array_allocated); CeedChk(ierr);
+  ierr = CeedVectorTrackMemory(vec, CEED_MEMSPACE_HOST,
+                               -(ptrdiff_t)(length * sizeof(CeedScalar)));
+  CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Allocate the array of a vector in the memory space of the execution space
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedVectorDeviceMalloc_Kokkos(CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Kokkos *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  ierr = CeedKokkosMalloc<Space>(ceed, length * sizeof(CeedScalar),
+                                 (void **)&impl->d_array_allocated);
+  CeedChk(ierr);
+  impl->d_array = impl->d_array_allocated;
+  ierr = CeedVectorTrackMemory(vec, CeedKokkosHostAccessible<Space>() ?
+                               CEED_MEMSPACE_HOST : CEED_MEMSPACE_DEVICE,
+                               length * sizeof(CeedScalar)); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Free the array of a vector in the memory space of the execution space
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedVectorDeviceFree_Kokkos(CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Kokkos *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  if (!impl->d_array_allocated)
+    return 0;
+  if (impl->d_array == impl->d_array_allocated)
+    impl->d_array = NULL;
+  ierr = CeedKokkosFree<Space>(ceed, impl->d_array_allocated); CeedChk(ierr);
+  impl->d_array_allocated = NULL;
+  ierr = CeedVectorTrackMemory(vec, CeedKokkosHostAccessible<Space>() ?
+                               CEED_MEMSPACE_HOST : CEED_MEMSPACE_DEVICE,
+                               -(ptrdiff_t)(length * sizeof(CeedScalar)));
+  CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Bring the values to the host or to the memory space of the execution space,
+//   allocating the array if needed; read access leaves both copies valid
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedVectorSync_Kokkos(CeedVector vec, bool host, bool read) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Kokkos *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  if (host) {
+    if (!impl->h_array) {
+      ierr = CeedVectorHostMalloc_Kokkos(vec); CeedChk(ierr);
+    }
+    if (impl->memState == CeedVector_Kokkos::CEED_KOKKOS_DEVICE_SYNC) {
+      ierr = CeedVectorAuditTransfer(vec, CEED_MEM_HOST,
+                                     length * sizeof(CeedScalar));
+      CeedChk(ierr);
+      ierr = CeedKokkosCopy<Space>(ceed, impl->h_array, true,
+                                   (const CeedScalar *)impl->d_array, false,
+                                   length); CeedChk(ierr);
+      impl->memState = CeedVector_Kokkos::CEED_KOKKOS_BOTH_SYNC;
+    }
+    if (!read || impl->memState == CeedVector_Kokkos::CEED_KOKKOS_NONE_SYNC)
+      impl->memState = CeedVector_Kokkos::CEED_KOKKOS_HOST_SYNC;
+  } else {
+    if (!impl->d_array) {
+      ierr = CeedVectorDeviceMalloc_Kokkos<Space>(vec); CeedChk(ierr);
+    }
+    if (impl->memState == CeedVector_Kokkos::CEED_KOKKOS_HOST_SYNC) {
+      ierr = CeedVectorAuditTransfer(vec, CEED_MEM_DEVICE,
+                                     length * sizeof(CeedScalar));
+      CeedChk(ierr);
+      ierr = CeedKokkosCopy<Space>(ceed, impl->d_array, false,
+                                   (const CeedScalar *)impl->h_array, true,
+                                   length); CeedChk(ierr);
+      impl->memState = CeedVector_Kokkos::CEED_KOKKOS_BOTH_SYNC;
+    }
+    if (!read || impl->memState == CeedVector_Kokkos::CEED_KOKKOS_NONE_SYNC)
+      impl->memState = CeedVector_Kokkos::CEED_KOKKOS_DEVICE_SYNC;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Set array from host or from the memory space of the execution space
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedVectorSetArray_Kokkos(const CeedVector vec,
+                                     const CeedMemType mtype,
+                                     const CeedCopyMode cmode,
+                                     CeedScalar *array) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Kokkos *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+  const bool host = CeedKokkosOnHost<Space>(mtype);
+
+  if (host) {
+    switch (cmode) {
+    case CEED_COPY_VALUES:
+      if (!impl->h_array) {
+        ierr = CeedVectorHostMalloc_Kokkos(vec); CeedChk(ierr);
+      }
+      if (array)
+        memcpy(impl->h_array, array, length * sizeof(CeedScalar));
+      break;
+    case CEED_OWN_POINTER:
+      ierr = CeedVectorHostFree_Kokkos(vec); CeedChk(ierr);
+      impl->h_array = impl->h_array_allocated = array;
+      ierr = CeedVectorTrackMemory(vec, CEED_MEMSPACE_HOST,
+                                   length * sizeof(CeedScalar)); CeedChk(ierr);
+      break;
+    case CEED_USE_POINTER:
+      ierr = CeedVectorHostFree_Kokkos(vec); CeedChk(ierr);
+      impl->h_array = impl->h_array_borrowed = array;
+      break;
+    }
+    impl->memState = array || cmode != CEED_COPY_VALUES ?
+                     CeedVector_Kokkos::CEED_KOKKOS_HOST_SYNC :
+                     CeedVector_Kokkos::CEED_KOKKOS_NONE_SYNC;
+  } else {
+    switch (cmode) {
+    case CEED_COPY_VALUES:
+      if (!impl->d_array) {
+        ierr = CeedVectorDeviceMalloc_Kokkos<Space>(vec); CeedChk(ierr);
+      }
+      if (array) {
+        ierr = CeedKokkosCopy<Space>(ceed, impl->d_array, false,
+                                     (const CeedScalar *)array,
+                                     mtype != CEED_MEM_DEVICE, length);
+        CeedChk(ierr);
+      }
+      break;
+    case CEED_OWN_POINTER:
+      if (mtype != CEED_MEM_DEVICE) {
+        // Host arrays are freed with CeedFree, so their values are copied
+        if (!impl->d_array || impl->d_array == impl->d_array_borrowed) {
+          ierr = CeedVectorDeviceMalloc_Kokkos<Space>(vec); CeedChk(ierr);
+        }
+        memcpy(impl->d_array, array, length * sizeof(CeedScalar));
+        ierr = CeedFree(&array); CeedChk(ierr);
+      } else {
+        // Arrays of the memory space are freed with Kokkos::kokkos_free
+        ierr = CeedVectorDeviceFree_Kokkos<Space>(vec); CeedChk(ierr);
+        impl->d_array = impl->d_array_allocated = array;
+        ierr = CeedVectorTrackMemory(vec, CeedKokkosHostAccessible<Space>() ?
+                                     CEED_MEMSPACE_HOST : CEED_MEMSPACE_DEVICE,
+                                     length * sizeof(CeedScalar));
+        CeedChk(ierr);
+      }
+      break;
+    case CEED_USE_POINTER:
+      ierr = CeedVectorDeviceFree_Kokkos<Space>(vec); CeedChk(ierr);
+      impl->d_array = impl->d_array_borrowed = array;
+      break;
+    }
+    impl->memState = array || cmode != CEED_COPY_VALUES ?
+                     CeedVector_Kokkos::CEED_KOKKOS_DEVICE_SYNC :
+                     CeedVector_Kokkos::CEED_KOKKOS_NONE_SYNC;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Take array
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedVectorTakeArray_Kokkos(CeedVector vec, CeedMemType mtype,
+                                      CeedScalar **array) {
+  int ierr;
+  CeedVector_Kokkos *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+  const bool host = CeedKokkosOnHost<Space>(mtype);
+
+  ierr = CeedVectorSync_Kokkos<Space>(vec, host, false); CeedChk(ierr);
+  if (host) {
+    *array = impl->h_array;
+    if (impl->h_array == impl->h_array_allocated) {
+      impl->h_array_allocated = NULL;
+      ierr = CeedVectorTrackMemory(vec, CEED_MEMSPACE_HOST,
+                                   -(ptrdiff_t)(length * sizeof(CeedScalar)));
+      CeedChk(ierr);
+    }
+    impl->h_array = impl->h_array_borrowed = NULL;
+  } else if (mtype != CEED_MEM_DEVICE &&
+             impl->d_array != impl->d_array_borrowed) {
+    // The caller frees host arrays with CeedFree, so return a copy
+    ierr = CeedMalloc(length, array); CeedChk(ierr);
+    memcpy(*array, impl->d_array, length * sizeof(CeedScalar));
+    impl->d_array = NULL;
+    ierr = CeedVectorDeviceFree_Kokkos<Space>(vec); CeedChk(ierr);
+  } else {
+    *array = impl->d_array;
+    if (impl->d_array == impl->d_array_allocated) {
+      // The caller now owns the allocation and frees it with kokkos_free
+      impl->d_array_allocated = NULL;
+      ierr = CeedVectorTrackMemory(vec, CeedKokkosHostAccessible<Space>() ?
+                                   CEED_MEMSPACE_HOST : CEED_MEMSPACE_DEVICE,
+                                   -(ptrdiff_t)(length * sizeof(CeedScalar)));
+      CeedChk(ierr);
+    }
+    impl->d_array = impl->d_array_borrowed = NULL;
+  }
+  impl->memState = CeedVector_Kokkos::CEED_KOKKOS_NONE_SYNC;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Sync array to requested memtype
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedVectorSyncArray_Kokkos(const CeedVector vec,
+                                      const CeedMemType mtype) {
+  return CeedVectorSync_Kokkos<Space>(vec, CeedKokkosOnHost<Space>(mtype),
+                                      true);
+}
+
+//------------------------------------------------------------------------------
+// Get array
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedVectorGetArray_Kokkos(const CeedVector vec,
+                                     const CeedMemType mtype,
+                                     CeedScalar **array) {
+  int ierr;
+  CeedVector_Kokkos *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  const bool host = CeedKokkosOnHost<Space>(mtype);
+
+  ierr = CeedVectorSync_Kokkos<Space>(vec, host, false); CeedChk(ierr);
+  *array = host ? impl->h_array : impl->d_array;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Get read-only access to a vector via the specified mtype
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedVectorGetArrayRead_Kokkos(const CeedVector vec,
+    const CeedMemType mtype, const CeedScalar **array) {
+  int ierr;
+  CeedVector_Kokkos *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  const bool host = CeedKokkosOnHost<Space>(mtype);
+
+  ierr = CeedVectorSync_Kokkos<Space>(vec, host, true); CeedChk(ierr);
+  *array = host ? impl->h_array : impl->d_array;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Restore an array obtained using CeedVectorGetArray()
+//------------------------------------------------------------------------------
+static int CeedVectorRestoreArray_Kokkos(const CeedVector vec) {
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Restore an array obtained using CeedVectorGetArrayRead()
+//------------------------------------------------------------------------------
+static int CeedVectorRestoreArrayRead_Kokkos(const CeedVector vec) {
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Set a vector to a value
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedVectorSetValue_Kokkos(CeedVector vec, CeedScalar val) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Kokkos *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  // The old values are overwritten, so nothing is copied
+  if (!impl->d_array) {
+    ierr = CeedVectorDeviceMalloc_Kokkos<Space>(vec); CeedChk(ierr);
+  }
+  impl->memState = CeedVector_Kokkos::CEED_KOKKOS_DEVICE_SYNC;
+  CeedKokkosView<Space, CeedScalar> x(impl->d_array, length);
+  CeedCallKokkos(ceed, Kokkos::deep_copy(Space(), x, val));
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Copy a vector where its values are valid; the previous values of the copy
+//   are dropped, so nothing is synced
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedVectorCopy_Kokkos(CeedVector vec, CeedVector copy) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(copy, &ceed); CeedChk(ierr);
+  CeedVector_Kokkos *impl, *copyimpl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  ierr = CeedVectorGetData(copy, &copyimpl); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  if (impl->memState == CeedVector_Kokkos::CEED_KOKKOS_HOST_SYNC) {
+    if (!copyimpl->h_array) {
+      ierr = CeedVectorHostMalloc_Kokkos(copy); CeedChk(ierr);
+    }
+    ierr = CeedKokkosCopy<Space>(ceed, copyimpl->h_array, true,
+                                 (const CeedScalar *)impl->h_array, true,
+                                 length); CeedChk(ierr);
+    copyimpl->memState = CeedVector_Kokkos::CEED_KOKKOS_HOST_SYNC;
+  } else {
+    if (!copyimpl->d_array) {
+      ierr = CeedVectorDeviceMalloc_Kokkos<Space>(copy); CeedChk(ierr);
+    }
+    ierr = CeedKokkosCopy<Space>(ceed, copyimpl->d_array, false,
+                                 (const CeedScalar *)impl->d_array, false,
+                                 length); CeedChk(ierr);
+    copyimpl->memState = CeedVector_Kokkos::CEED_KOKKOS_DEVICE_SYNC;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute the norm of a vector
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedVectorNorm_Kokkos(CeedVector vec, CeedNormType type,
+                                 CeedScalar *norm) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  const CeedScalar *array;
+  ierr = CeedVectorGetArrayRead_Kokkos<Space>(vec, CEED_MEM_DEVICE, &array);
+  CeedChk(ierr);
+  CeedKokkosView<Space, const CeedScalar> x(array, length);
+  Kokkos::RangePolicy<Space> range(0, length);
+  CeedScalar result = 0.;
+  switch (type) {
+  case CEED_NORM_1:
+    CeedCallKokkos(ceed, Kokkos::parallel_reduce("CeedVectorNorm1", range,
+    KOKKOS_LAMBDA(const CeedInt i, CeedScalar &sum) {
+      sum += Kokkos::fabs(x(i));
+    }, result));
+    break;
+  case CEED_NORM_2:
+    CeedCallKokkos(ceed, Kokkos::parallel_reduce("CeedVectorNorm2", range,
+    KOKKOS_LAMBDA(const CeedInt i, CeedScalar &sum) {
+      sum += x(i)*x(i);
+    }, result));
+    break;
+  case CEED_NORM_MAX:
+    CeedCallKokkos(ceed, Kokkos::parallel_reduce("CeedVectorNormMax", range,
+    KOKKOS_LAMBDA(const CeedInt i, CeedScalar &max) {
+      max = Kokkos::fmax(max, Kokkos::fabs(x(i)));
+    }, Kokkos::Max<CeedScalar>(result)));
+    break;
+  }
+  *norm = type == CEED_NORM_2 ? sqrt(result) : result;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Take reciprocal of a vector
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedVectorReciprocal_Kokkos(CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  CeedScalar *array;
+  ierr = CeedVectorGetArray_Kokkos<Space>(vec, CEED_MEM_DEVICE, &array);
+  CeedChk(ierr);
+  CeedKokkosView<Space, CeedScalar> x(array, length);
+  CeedCallKokkos(ceed, Kokkos::parallel_for("CeedVectorReciprocal",
+                 Kokkos::RangePolicy<Space>(0, length),
+  KOKKOS_LAMBDA(const CeedInt i) {
+    if (Kokkos::fabs(x(i)) > 1E-16) x(i) = 1./x(i);
+  }));
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute y = alpha x + y
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedVectorAXPY_Kokkos(CeedVector y, CeedScalar alpha,
+                                 CeedVector x) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(y, &ceed); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(y, &length); CeedChk(ierr);
+
+  CeedScalar *y_array;
+  const CeedScalar *x_array;
+  ierr = CeedVectorGetArray_Kokkos<Space>(y, CEED_MEM_DEVICE, &y_array);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead_Kokkos<Space>(x, CEED_MEM_DEVICE, &x_array);
+  CeedChk(ierr);
+  CeedKokkosView<Space, CeedScalar> yv(y_array, length);
+  CeedKokkosView<Space, const CeedScalar> xv(x_array, length);
+  CeedCallKokkos(ceed, Kokkos::parallel_for("CeedVectorAXPY",
+                 Kokkos::RangePolicy<Space>(0, length),
+  KOKKOS_LAMBDA(const CeedInt i) {
+    yv(i) += alpha * xv(i);
+  }));
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute the pointwise multiplication w = x .* y
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedVectorPointwiseMult_Kokkos(CeedVector w, CeedVector x,
+    CeedVector y) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(w, &ceed); CeedChk(ierr);
+  CeedVector_Kokkos *w_impl;
+  ierr = CeedVectorGetData(w, &w_impl); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(w, &length); CeedChk(ierr);
+
+  if (!w_impl->h_array && !w_impl->d_array) {
+    ierr = CeedVectorSetValue_Kokkos<Space>(w, 0.0); CeedChk(ierr);
+  }
+  CeedScalar *w_array;
+  const CeedScalar *x_array, *y_array;
+  ierr = CeedVectorGetArray_Kokkos<Space>(w, CEED_MEM_DEVICE, &w_array);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead_Kokkos<Space>(x, CEED_MEM_DEVICE, &x_array);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead_Kokkos<Space>(y, CEED_MEM_DEVICE, &y_array);
+  CeedChk(ierr);
+  CeedKokkosView<Space, CeedScalar> wv(w_array, length);
+  CeedKokkosView<Space, const CeedScalar> xv(x_array, length),
+                 yv(y_array, length);
+  CeedCallKokkos(ceed, Kokkos::parallel_for("CeedVectorPointwiseMult",
+                 Kokkos::RangePolicy<Space>(0, length),
+  KOKKOS_LAMBDA(const CeedInt i) {
+    wv(i) = xv(i) * yv(i);
+  }));
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute the dot product of two vectors
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedVectorDot_Kokkos(CeedVector x, CeedVector y,
+                                CeedScalar *result) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(x, &ceed); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(x, &length); CeedChk(ierr);
+
+  const CeedScalar *x_array, *y_array;
+  ierr = CeedVectorGetArrayRead_Kokkos<Space>(x, CEED_MEM_DEVICE, &x_array);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead_Kokkos<Space>(y, CEED_MEM_DEVICE, &y_array);
+  CeedChk(ierr);
+  CeedKokkosView<Space, const CeedScalar> xv(x_array, length),
+                 yv(y_array, length);
+  CeedScalar dot = 0.;
+  CeedCallKokkos(ceed, Kokkos::parallel_reduce("CeedVectorDot",
+                 Kokkos::RangePolicy<Space>(0, length),
+  KOKKOS_LAMBDA(const CeedInt i, CeedScalar &sum) {
+    sum += xv(i) * yv(i);
+  }, dot));
+  *result = dot;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Destroy the vector
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedVectorDestroy_Kokkos(const CeedVector vec) {
+  int ierr;
+  CeedVector_Kokkos *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+
+  ierr = CeedVectorHostFree_Kokkos(vec); CeedChk(ierr);
+  ierr = CeedVectorDeviceFree_Kokkos<Space>(vec); CeedChk(ierr);
+  ierr = CeedFree(&impl); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Create a vector of the specified length (does not allocate memory)
+//------------------------------------------------------------------------------
+template <class Space>
+int CeedVectorCreate_Kokkos(CeedInt n, CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Kokkos *impl;
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  ierr = CeedVectorSetData(vec, impl); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "SetArray",
+                                (CeedKokkosFunction)
+                                CeedVectorSetArray_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "TakeArray",
+                                (CeedKokkosFunction)
+                                CeedVectorTakeArray_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "SetValue",
+                                (CeedKokkosFunction)
+                                CeedVectorSetValue_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Copy",
+                                (CeedKokkosFunction)
+                                CeedVectorCopy_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "SyncArray",
+                                (CeedKokkosFunction)
+                                CeedVectorSyncArray_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "GetArray",
+                                (CeedKokkosFunction)
+                                CeedVectorGetArray_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "GetArrayRead",
+                                (CeedKokkosFunction)
+                                CeedVectorGetArrayRead_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "RestoreArray",
+                                (CeedKokkosFunction)
+                                CeedVectorRestoreArray_Kokkos);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "RestoreArrayRead",
+                                (CeedKokkosFunction)
+                                CeedVectorRestoreArrayRead_Kokkos);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Norm",
+                                (CeedKokkosFunction)
+                                CeedVectorNorm_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Reciprocal",
+                                (CeedKokkosFunction)
+                                CeedVectorReciprocal_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "AXPY",
+                                (CeedKokkosFunction)
+                                CeedVectorAXPY_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "PointwiseMult",
+                                (CeedKokkosFunction)
+                                CeedVectorPointwiseMult_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Dot",
+                                (CeedKokkosFunction)
+                                CeedVectorDot_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Destroy",
+                                (CeedKokkosFunction)
+                                CeedVectorDestroy_Kokkos<Space>);
+  CeedChk(ierr);
+  return 0;
+}
+
+#define CEED_KOKKOS_INSTANTIATE(Space) \
+  template int CeedVectorCreate_Kokkos<Space>(CeedInt, CeedVector);
+CEED_KOKKOS_FOREACH_SPACE(CEED_KOKKOS_INSTANTIATE)
+//------------------------------------------------------------------------------
@@ -0,0 +1,185 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+// the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+// reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#ifndef _ceed_kokkos_h
+#define _ceed_kokkos_h
+
+#include <ceed-backend.h>
+#include <Kokkos_Core.hpp>
+
+// Kokkos reports errors by exceptions, which must not cross into C callers
+#define CeedCallKokkos(ceed, ...) \
+do { \
+  try { \
+    __VA_ARGS__; \
+  } catch (std::exception const &e) { \
+    return CeedError((ceed), 1, "Kokkos error: %s", e.what()); \
+  } \
+} while (0)
+
+// Backend functions are registered through the untyped C signature
+typedef int (*CeedKokkosFunction)();
+
+// Execution spaces enabled in the Kokkos installation; the backend functions
+//   are templates instantiated for each of them
+#if defined(KOKKOS_ENABLE_SYCL)
+#if KOKKOS_VERSION >= 40500
+typedef Kokkos::SYCL CeedKokkosSycl;
+#else
+typedef Kokkos::Experimental::SYCL CeedKokkosSycl;
+#endif
+#endif
+
+#ifdef KOKKOS_ENABLE_SERIAL
+#define CEED_KOKKOS_SERIAL(X) X(Kokkos::Serial)
+#else
+#define CEED_KOKKOS_SERIAL(X)
+#endif
+#ifdef KOKKOS_ENABLE_OPENMP
+#define CEED_KOKKOS_OPENMP(X) X(Kokkos::OpenMP)
+#else
+#define CEED_KOKKOS_OPENMP(X)
+#endif
+#ifdef KOKKOS_ENABLE_CUDA
+#define CEED_KOKKOS_CUDA(X) X(Kokkos::Cuda)
+#else
+#define CEED_KOKKOS_CUDA(X)
+#endif
+#ifdef KOKKOS_ENABLE_HIP
+#define CEED_KOKKOS_HIP(X) X(Kokkos::HIP)
+#else
+#define CEED_KOKKOS_HIP(X)
+#endif
+#ifdef KOKKOS_ENABLE_SYCL
+#define CEED_KOKKOS_SYCL(X) X(CeedKokkosSycl)
+#else
+#define CEED_KOKKOS_SYCL(X)
+#endif
+#define CEED_KOKKOS_FOREACH_SPACE(X) \
+  CEED_KOKKOS_SERIAL(X) CEED_KOKKOS_OPENMP(X) CEED_KOKKOS_CUDA(X) \
+  CEED_KOKKOS_HIP(X) CEED_KOKKOS_SYCL(X)
+
+// Arrays are held as raw pointers and wrapped in unmanaged Views for kernels,
+//   so arrays of Views owned by the application are used in place
+template <class Space, class T>
+using CeedKokkosView = Kokkos::View<T *, typename Space::memory_space,
+      Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+template <class T>
+using CeedKokkosHostView = Kokkos::View<T *, Kokkos::HostSpace,
+      Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+// Host code addresses the arrays of host execution spaces directly, so their
+//   host and device arrays are the same
+template <class Space>
+constexpr bool CeedKokkosHostAccessible() {
+  return Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+         typename Space::memory_space>::accessible;
+}
+
+// Allocation in the memory space of an execution space
+template <class Space>
+int CeedKokkosMalloc(Ceed ceed, size_t bytes, void **ptr) {
+  CeedCallKokkos(ceed, *ptr = Kokkos::kokkos_malloc<typename
+                              Space::memory_space>("libCEED", bytes));
+  return 0;
+}
+
+template <class Space>
+int CeedKokkosFree(Ceed ceed, void *ptr) {
+  if (!ptr) return 0;
+  CeedCallKokkos(ceed, Kokkos::kokkos_free<typename
+                 Space::memory_space>(ptr));
+  return 0;
+}
+
+// Copy between the memory spaces of the backend and the host
+template <class Space, class T>
+int CeedKokkosCopy(Ceed ceed, T *dst, bool dsthost, const T *src,
+                   bool srchost, size_t n) {
+  if (dst == src || !n) return 0;
+  if (dsthost && srchost) {
+    CeedKokkosHostView<T> d(dst, n);
+    CeedKokkosHostView<const T> s(src, n);
+    CeedCallKokkos(ceed, Kokkos::deep_copy(d, s));
+  } else if (dsthost) {
+    CeedKokkosHostView<T> d(dst, n);
+    CeedKokkosView<Space, const T> s(src, n);
+    CeedCallKokkos(ceed, Kokkos::deep_copy(d, s));
+  } else if (srchost) {
+    CeedKokkosView<Space, T> d(dst, n);
+    CeedKokkosHostView<const T> s(src, n);
+    CeedCallKokkos(ceed, Kokkos::deep_copy(d, s));
+  } else {
+    CeedKokkosView<Space, T> d(dst, n);
+    CeedKokkosView<Space, const T> s(src, n);
+    CeedCallKokkos(ceed, Kokkos::deep_copy(Space(), d, s));
+  }
+  return 0;
+}
+
+typedef struct {
+  int deviceId;
+} Ceed_Kokkos;
+
+// Values live on the host, in the memory space of the execution space, or
+//   both; for host execution spaces only the device array is used
+typedef struct {
+  CeedScalar *h_array;
+  CeedScalar *h_array_borrowed;
+  CeedScalar *h_array_allocated;
+  CeedScalar *d_array;
+  CeedScalar *d_array_borrowed;
+  CeedScalar *d_array_allocated;
+  enum {CEED_KOKKOS_NONE_SYNC, CEED_KOKKOS_HOST_SYNC,
+        CEED_KOKKOS_DEVICE_SYNC, CEED_KOKKOS_BOTH_SYNC
+       } memState;
+} CeedVector_Kokkos;
+
+// Offsets of the nodes of each element, in the memory space of the execution
+//   space; strided restrictions have none
+typedef struct {
+  CeedInt *d_ind;
+  CeedInt *d_ind_allocated;
+  const CeedInt *h_ind;
+  CeedInt *h_ind_allocated;
+  CeedInt strides[3];
+  CeedInt compstride;
+} CeedElemRestriction_Kokkos;
+
+// Tensor basis matrices in the memory space of the execution space
+typedef struct {
+  CeedScalar *d_interp1d;
+  CeedScalar *d_grad1d;
+  CeedScalar *d_qweight1d;
+} CeedBasis_Kokkos;
+
+template <class Space>
+int CeedVectorCreate_Kokkos(CeedInt n, CeedVector vec);
+
+template <class Space>
+int CeedElemRestrictionCreate_Kokkos(CeedMemType mtype, CeedCopyMode cmode,
+                                     const CeedInt *indices,
+                                     CeedElemRestriction r);
+
+template <class Space>
+int CeedBasisCreateTensorH1_Kokkos(CeedInt dim, CeedInt P1d, CeedInt Q1d,
+                                   const CeedScalar *interp1d,
+                                   const CeedScalar *grad1d,
+                                   const CeedScalar *qref1d,
+                                   const CeedScalar *qweight1d,
+                                   CeedBasis basis);
+
+#endif
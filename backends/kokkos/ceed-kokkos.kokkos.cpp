@@ -0,0 +1,126 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+// the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+// reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <stdlib.h>
+#include <string.h>
+#include "ceed-kokkos.h"
+
+//------------------------------------------------------------------------------
+// Kokkos preferred MemType
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedGetPreferredMemType_Kokkos(CeedMemType *type) {
+  *type = CeedKokkosHostAccessible<Space>() ? CEED_MEM_HOST : CEED_MEM_DEVICE;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+static int CeedDestroy_Kokkos(Ceed ceed) {
+  int ierr;
+  Ceed_Kokkos *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  ierr = CeedFree(&data); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Kokkos is initialized once per process; when libCEED initializes it, it is
+//   finalized at exit, after the application has destroyed its objects
+//------------------------------------------------------------------------------
+static int CeedKokkosInitialize(Ceed ceed, int deviceID) {
+  if (Kokkos::is_initialized())
+    return 0;
+  if (Kokkos::is_finalized())
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Kokkos was finalized and cannot be restarted");
+  // LCOV_EXCL_STOP
+  CeedCallKokkos(ceed, Kokkos::initialize(Kokkos::InitializationSettings()
+                                          .set_device_id(deviceID)));
+  std::atexit([]() {
+    if (Kokkos::is_initialized() && !Kokkos::is_finalized())
+      Kokkos::finalize();
+  });
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Init
+//------------------------------------------------------------------------------
+template <class Space>
+static int CeedInit_Kokkos(const char *resource, Ceed ceed) {
+  int ierr;
+  const char *device = strstr(resource, ":device_id=");
+  const int deviceID = device ? atoi(&device[11]) : 0;
+  ierr = CeedKokkosInitialize(ceed, deviceID); CeedChk(ierr);
+
+  // QFunctions are host function pointers, so QFunctions, operators, and
+  //   non-tensor bases run on the host through the reference backend, which
+  //   reaches the arrays of the vectors through the vector interface
+  Ceed ceedref;
+  CeedInit("/cpu/self/ref/serial", &ceedref);
+  ierr = CeedSetDelegate(ceed, ceedref); CeedChk(ierr);
+
+  Ceed_Kokkos *data;
+  ierr = CeedCalloc(1, &data); CeedChk(ierr);
+  ierr = CeedSetData(ceed, data); CeedChk(ierr);
+  data->deviceId = deviceID;
+
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "GetPreferredMemType",
+                                (CeedKokkosFunction)
+                                CeedGetPreferredMemType_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "VectorCreate",
+                                (CeedKokkosFunction)
+                                CeedVectorCreate_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "ElemRestrictionCreate",
+                                (CeedKokkosFunction)
+                                CeedElemRestrictionCreate_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "BasisCreateTensorH1",
+                                (CeedKokkosFunction)
+                                CeedBasisCreateTensorH1_Kokkos<Space>);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy",
+                                (CeedKokkosFunction)CeedDestroy_Kokkos);
+  CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Register
+//------------------------------------------------------------------------------
+__attribute__((constructor))
+static void Register(void) {
+#ifdef KOKKOS_ENABLE_CUDA
+  CeedRegister("/kokkos/cuda", CeedInit_Kokkos<Kokkos::Cuda>, 140);
+#endif
+#ifdef KOKKOS_ENABLE_HIP
+  CeedRegister("/kokkos/hip", CeedInit_Kokkos<Kokkos::HIP>, 140);
+#endif
+#ifdef KOKKOS_ENABLE_SYCL
+  CeedRegister("/kokkos/sycl", CeedInit_Kokkos<CeedKokkosSycl>, 140);
+#endif
+#ifdef KOKKOS_ENABLE_OPENMP
+  CeedRegister("/kokkos/openmp", CeedInit_Kokkos<Kokkos::OpenMP>, 150);
+#endif
+#ifdef KOKKOS_ENABLE_SERIAL
+  CeedRegister("/kokkos/serial", CeedInit_Kokkos<Kokkos::Serial>, 160);
+#endif
+}
+//------------------------------------------------------------------------------
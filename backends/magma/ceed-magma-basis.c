@@ -31,7 +31,7 @@ int CeedBasisApply_Magma(CeedBasis basis, CeedInt nelem,
   ierr = CeedBasisGetNumNodes(basis, &ndof); CeedChk(ierr);
 
   Ceed_Magma *data;
-  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  ierr = CeedMagmaGetData(ceed, &data); CeedChk(ierr);
 
   const CeedScalar *u;
   CeedScalar *v;
@@ -102,8 +102,8 @@ int CeedBasisApply_Magma(CeedBasis basis, CeedInt nelem,
                         impl->dinterp1d, tmode,
                         u, u_elstride, u_compstride,
                         v, v_elstride, v_compstride,
-                        nelem, data->basis_kernel_mode, data->maxthreads,
-                        data->queue);
+                        nelem, CeedMagmaKernelMode(data, dim, P1d, Q1d),
+                        data->maxthreads, data->queue);
     if (ierr != 0) CeedError(ceed, 1,
                                "MAGMA: launch failure detected for magma_interp");
   }
@@ -161,8 +161,8 @@ int CeedBasisApply_Magma(CeedBasis basis, CeedInt nelem,
                        impl->dinterp1d, impl->dgrad1d, tmode,
                        u, u_elstride, u_compstride, u_dimstride,
                        v, v_elstride, v_compstride, v_dimstride,
-                       nelem, data->basis_kernel_mode, data->maxthreads,
-                       data->queue);
+                       nelem, CeedMagmaKernelMode(data, dim, P1d, Q1d),
+                       data->maxthreads, data->queue);
     if (ierr != 0) CeedError(ceed, 1,
                                "MAGMA: launch failure detected for magma_grad");
   }
@@ -213,7 +213,7 @@ int CeedBasisApplyNonTensor_Magma(CeedBasis basis, CeedInt nelem,
   ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
 
   Ceed_Magma *data;
-  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  ierr = CeedMagmaGetData(ceed, &data); CeedChk(ierr);
 
   CeedInt dim, ncomp, ndof, nqpt;
   ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
@@ -252,13 +252,13 @@ int CeedBasisApplyNonTensor_Magma(CeedBasis basis, CeedInt nelem,
                             P, nelem*ncomp, Q,
                             1.0, impl->dinterp, P,
                             du, Q,
-                            0.0, dv, P, data->queue);
+                            0.0, dv, P, data);
     else
       magma_dgemm_nontensor(MagmaTrans, MagmaNoTrans,
                             Q, nelem*ncomp, P,
                             1.0, impl->dinterp, P,
                             du, P,
-                            0.0, dv, Q, data->queue);
+                            0.0, dv, Q, data);
   }
   break;
 
@@ -273,7 +273,7 @@ int CeedBasisApplyNonTensor_Magma(CeedBasis basis, CeedInt nelem,
                               P, nelem*ncomp, Q,
                               1.0, impl->dgrad + d*P*Q, P,
                               du + d*nelem*ncomp*Q, Q,
-                              beta, dv, P, data->queue);
+                              beta, dv, P, data);
       }
     } else {
       for(int d=0; d< dim; d++)
@@ -281,7 +281,7 @@ int CeedBasisApplyNonTensor_Magma(CeedBasis basis, CeedInt nelem,
                               Q, nelem*ncomp, P,
                               1.0, impl->dgrad + d*P*Q, P,
                               du, P,
-                              0.0, dv + d*nelem*ncomp*Q, Q, data->queue);
+                              0.0, dv + d*nelem*ncomp*Q, Q, data);
     }
   }
   break;
@@ -392,7 +392,7 @@ int CeedBasisCreateTensorH1_Magma(CeedInt dim, CeedInt P1d, CeedInt Q1d,
   // LCOV_EXCL_STOP
 
   Ceed_Magma *data;
-  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  ierr = CeedMagmaGetData(ceed, &data); CeedChk(ierr);
 
   ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Apply",
                                 CeedBasisApply_Magma); CeedChk(ierr);
@@ -442,7 +442,7 @@ int CeedBasisCreateH1_Magma(CeedElemTopology topo, CeedInt dim, CeedInt ndof,
   ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
 
   Ceed_Magma *data;
-  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  ierr = CeedMagmaGetData(ceed, &data); CeedChk(ierr);
 
   ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Apply",
                                 CeedBasisApplyNonTensor_Magma); CeedChk(ierr);
@@ -35,16 +35,6 @@ static int CeedInit_Magma_Det(const char *resource, Ceed ceed) {
   #endif
   ierr = CeedSetDelegate(ceed, ceedref); CeedChk(ierr);
 
-  // Create reference CEED for restriction
-  Ceed restrictionceedref;
-  #ifdef HAVE_HIP
-  CeedInit("/gpu/hip/ref", &restrictionceedref);
-  #else
-  CeedInit("/gpu/cuda/ref", &restrictionceedref);
-  #endif
-  ierr = CeedSetObjectDelegate(ceed, restrictionceedref, "ElemRestriction");
-  CeedChk(ierr);
-
   return 0;
 }
 
@@ -0,0 +1,464 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include "ceed-magma.h"
+
+//------------------------------------------------------------------------------
+// Destroy operator
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroy_Magma(CeedOperator op) {
+  int ierr;
+  CeedOperator_Magma *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  for (CeedInt i = 0; i < impl->numein + impl->numeout; i++) {
+    ierr = CeedVectorDestroy(&impl->evecs[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->evecs); CeedChk(ierr);
+  ierr = CeedFree(&impl->edata); CeedChk(ierr);
+  ierr = CeedFree(&impl->inputstate); CeedChk(ierr);
+
+  for (CeedInt i = 0; i < impl->numein; i++) {
+    ierr = CeedVectorDestroy(&impl->qvecsin[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->qvecsin); CeedChk(ierr);
+  for (CeedInt i = 0; i < impl->numeout; i++) {
+    ierr = CeedVectorDestroy(&impl->qvecsout[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->qvecsout); CeedChk(ierr);
+
+  // Launch queues
+  for (CeedInt i = 0; i < impl->numqueues; i++) {
+    magma_event_destroy(impl->events[i]);
+    magma_queue_destroy(impl->queues[i]);
+  }
+  if (impl->numqueues)
+    magma_event_destroy(impl->fork);
+  ierr = CeedFree(&impl->queues); CeedChk(ierr);
+  ierr = CeedFree(&impl->events); CeedChk(ierr);
+  ierr = CeedFree(&impl->fieldqueue); CeedChk(ierr);
+
+  ierr = CeedFree(&impl); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup infields or outfields
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupFields_Magma(CeedQFunction qf, CeedOperator op,
+    bool inOrOut, CeedVector *evecs, CeedVector *qvecs, CeedInt *fieldqueue,
+    CeedInt *numqueues, CeedInt starte, CeedInt numfields, CeedInt Q,
+    CeedInt numelements) {
+  int ierr;
+  CeedInt size, nqueues = 0;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedBasis basis;
+  CeedElemRestriction Erestrict;
+  CeedOperatorField *opfields;
+  CeedQFunctionField *qffields;
+
+  if (inOrOut) {
+    ierr = CeedOperatorGetFields(op, NULL, &opfields); CeedChk(ierr);
+    ierr = CeedQFunctionGetFields(qf, NULL, &qffields); CeedChk(ierr);
+  } else {
+    ierr = CeedOperatorGetFields(op, &opfields, NULL); CeedChk(ierr);
+    ierr = CeedQFunctionGetFields(qf, &qffields, NULL); CeedChk(ierr);
+  }
+
+  // Loop over fields
+  for (CeedInt i = 0; i < numfields; i++) {
+    CeedEvalMode emode;
+    ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode); CeedChk(ierr);
+
+    fieldqueue[i + starte] = -1;
+    if (emode != CEED_EVAL_WEIGHT) {
+      ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &Erestrict);
+      CeedChk(ierr);
+      ierr = CeedElemRestrictionCreateVector(Erestrict, NULL,
+                                             &evecs[i + starte]);
+      CeedChk(ierr);
+    }
+
+    switch (emode) {
+    case CEED_EVAL_NONE:
+      ierr = CeedQFunctionFieldGetSize(qffields[i], &size); CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, numelements * Q * size, &qvecs[i]);
+      CeedChk(ierr);
+      break;
+    case CEED_EVAL_INTERP:
+    case CEED_EVAL_GRAD:
+      ierr = CeedQFunctionFieldGetSize(qffields[i], &size); CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, numelements * Q * size, &qvecs[i]);
+      CeedChk(ierr);
+      // Each basis field of the inputs, or of the outputs, gets its own queue
+      fieldqueue[i + starte] = nqueues++;
+      break;
+    case CEED_EVAL_WEIGHT: // Only on input fields
+      ierr = CeedOperatorFieldGetBasis(opfields[i], &basis); CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, numelements * Q, &qvecs[i]); CeedChk(ierr);
+      ierr = CeedBasisApply(basis, numelements, CEED_NOTRANSPOSE,
+                            CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, qvecs[i]);
+      CeedChk(ierr);
+      break;
+    case CEED_EVAL_DIV:
+      break; // TODO: Not implemented
+    case CEED_EVAL_CURL:
+      break; // TODO: Not implemented
+    }
+  }
+  *numqueues = CeedIntMax(*numqueues, nqueues);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup operator
+//------------------------------------------------------------------------------
+static int CeedOperatorSetup_Magma(CeedOperator op) {
+  int ierr;
+  bool setupdone;
+  ierr = CeedOperatorIsSetupDone(op, &setupdone); CeedChk(ierr);
+  if (setupdone)
+    return 0;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Magma *data;
+  ierr = CeedMagmaGetData(ceed, &data); CeedChk(ierr);
+  CeedOperator_Magma *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt Q, numelements, numinputfields, numoutputfields;
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+
+  // Allocate
+  ierr = CeedCalloc(numinputfields + numoutputfields, &impl->evecs);
+  CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields + numoutputfields, &impl->edata);
+  CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields + numoutputfields, &impl->fieldqueue);
+  CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->inputstate); CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->qvecsin); CeedChk(ierr);
+  ierr = CeedCalloc(numoutputfields, &impl->qvecsout); CeedChk(ierr);
+  impl->numein = numinputfields; impl->numeout = numoutputfields;
+
+  // Infields and outfields
+  CeedInt numqueues = 0;
+  ierr = CeedOperatorSetupFields_Magma(qf, op, 0, impl->evecs, impl->qvecsin,
+                                       impl->fieldqueue, &numqueues, 0,
+                                       numinputfields, Q, numelements);
+  CeedChk(ierr);
+  ierr = CeedOperatorSetupFields_Magma(qf, op, 1, impl->evecs, impl->qvecsout,
+                                       impl->fieldqueue, &numqueues,
+                                       numinputfields, numoutputfields, Q,
+                                       numelements); CeedChk(ierr);
+
+  // Launch queues, only worthwhile with more than one basis field
+  if (numqueues > 1) {
+    ierr = CeedCalloc(numqueues, &impl->queues); CeedChk(ierr);
+    ierr = CeedCalloc(numqueues, &impl->events); CeedChk(ierr);
+    for (CeedInt i = 0; i < numqueues; i++) {
+      magma_queue_create(data->device, &impl->queues[i]);
+      magma_event_create(&impl->events[i]);
+    }
+    magma_event_create(&impl->fork);
+    impl->numqueues = numqueues;
+  }
+
+  ierr = CeedOperatorSetSetupDone(op); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Restrict inputs
+//
+// Passive inputs are restricted only when their vector changes. Reduced
+//   precision passive inputs are rounded to their storage type on the host
+//   when restricted, so they match the other backends, but the E-vector stays
+//   in CeedScalar.
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupInputs_Magma(CeedInt numinputfields,
+    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
+    CeedVector invec, CeedOperator_Magma *impl, CeedRequest *request) {
+  int ierr;
+  CeedEvalMode emode;
+  CeedVector vec;
+  CeedElemRestriction Erestrict;
+  uint64_t state;
+
+  for (CeedInt i = 0; i < numinputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    if (emode == CEED_EVAL_WEIGHT)
+      continue;
+    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
+    CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) {
+      ierr = CeedElemRestrictionApply(Erestrict, CEED_NOTRANSPOSE, invec,
+                                      impl->evecs[i], request); CeedChk(ierr);
+    } else {
+      ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
+      if (state != impl->inputstate[i]) {
+        ierr = CeedElemRestrictionApply(Erestrict, CEED_NOTRANSPOSE, vec,
+                                        impl->evecs[i], request); CeedChk(ierr);
+        CeedStorageType storage;
+        ierr = CeedOperatorFieldGetStorage(opinputfields[i], &storage);
+        CeedChk(ierr);
+        if (storage != CEED_STORAGE_SCALAR) {
+          CeedInt length;
+          size_t bytes;
+          CeedScalar *e;
+          void *elow;
+          ierr = CeedVectorGetLength(impl->evecs[i], &length); CeedChk(ierr);
+          ierr = CeedStorageGetSize(storage, &bytes); CeedChk(ierr);
+          ierr = CeedCalloc(length*bytes, (char **)&elow); CeedChk(ierr);
+          ierr = CeedVectorGetArray(impl->evecs[i], CEED_MEM_HOST, &e);
+          CeedChk(ierr);
+          ierr = CeedStorageNarrow(storage, length, e, elow); CeedChk(ierr);
+          ierr = CeedStorageWiden(storage, length, elow, e); CeedChk(ierr);
+          ierr = CeedVectorRestoreArray(impl->evecs[i], &e); CeedChk(ierr);
+          ierr = CeedFree(&elow); CeedChk(ierr);
+        }
+        impl->inputstate[i] = state;
+      }
+    }
+    ierr = CeedVectorGetArrayRead(impl->evecs[i], CEED_MEM_DEVICE,
+                                  (const CeedScalar **) &impl->edata[i]);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Basis action of one field on its launch queue
+//
+// The MAGMA basis kernels of the operator's Ceed launch on data->queue, which
+//   is redirected to the queue of the field for the duration of the apply.
+//------------------------------------------------------------------------------
+static int CeedOperatorBasisApply_Magma(CeedOperator op, CeedInt field,
+                                        CeedBasis basis, CeedInt numelements,
+                                        CeedTransposeMode tmode,
+                                        CeedEvalMode emode,
+                                        CeedVector u, CeedVector v) {
+  int ierr;
+  Ceed ceed, basisceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  ierr = CeedBasisGetCeed(basis, &basisceed); CeedChk(ierr);
+  CeedOperator_Magma *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  Ceed_Magma *data;
+  ierr = CeedMagmaGetData(ceed, &data); CeedChk(ierr);
+
+  // Bases of other Ceeds launch as usual
+  if (!impl->numqueues || basisceed != ceed)
+    return CeedBasisApply(basis, numelements, tmode, emode, u, v);
+
+  magma_queue_t queue = data->queue;
+  const CeedInt k = impl->fieldqueue[field];
+  magma_queue_wait_event(impl->queues[k], impl->fork);
+  data->queue = impl->queues[k];
+  int ierrapply = CeedBasisApply(basis, numelements, tmode, emode, u, v);
+  data->queue = queue;
+  CeedChk(ierrapply);
+  magma_event_record(impl->events[k], impl->queues[k]);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Fork the launch queues from, or join them into, the default queue
+//------------------------------------------------------------------------------
+static int CeedOperatorForkQueues_Magma(Ceed ceed, CeedOperator_Magma *impl) {
+  int ierr;
+  Ceed_Magma *data;
+  ierr = CeedMagmaGetData(ceed, &data); CeedChk(ierr);
+  if (impl->numqueues)
+    magma_event_record(impl->fork, data->queue);
+  return 0;
+}
+
+static int CeedOperatorJoinQueues_Magma(Ceed ceed, CeedOperator_Magma *impl) {
+  int ierr;
+  Ceed_Magma *data;
+  ierr = CeedMagmaGetData(ceed, &data); CeedChk(ierr);
+  for (CeedInt i = 0; i < impl->numqueues; i++)
+    magma_queue_wait_event(data->queue, impl->events[i]);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Apply and add to output
+//
+// Restrictions and the QFunction run on the default queue, while the basis
+//   actions of the input fields, and then of the output fields, run
+//   concurrently on one queue per field, joined through events.
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Magma(CeedOperator op, CeedVector invec,
+                                      CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Magma *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numelements, numinputfields, numoutputfields;
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+  CeedQFunctionField *qfinputfields, *qfoutputfields;
+  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
+  CeedChk(ierr);
+  CeedEvalMode emode;
+  CeedVector vec;
+  CeedBasis basis;
+  CeedElemRestriction Erestrict;
+
+  // Setup
+  ierr = CeedOperatorSetup_Magma(op); CeedChk(ierr);
+
+  // Input restriction
+  ierr = CeedOperatorSetupInputs_Magma(numinputfields, qfinputfields,
+                                       opinputfields, invec, impl, request);
+  CeedChk(ierr);
+
+  // Input basis action
+  ierr = CeedOperatorForkQueues_Magma(ceed, impl); CeedChk(ierr);
+  for (CeedInt i = 0; i < numinputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    switch (emode) {
+    case CEED_EVAL_NONE:
+      ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_DEVICE,
+                                CEED_USE_POINTER, impl->edata[i]);
+      CeedChk(ierr);
+      break;
+    case CEED_EVAL_INTERP:
+    case CEED_EVAL_GRAD:
+      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
+      ierr = CeedOperatorBasisApply_Magma(op, i, basis, numelements,
+                                          CEED_NOTRANSPOSE, emode,
+                                          impl->evecs[i], impl->qvecsin[i]);
+      CeedChk(ierr);
+      break;
+    default:
+      break; // No action
+    }
+  }
+  ierr = CeedOperatorJoinQueues_Magma(ceed, impl); CeedChk(ierr);
+
+  // Output Q-vectors of CEED_EVAL_NONE fields alias the E-vectors
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    if (emode == CEED_EVAL_NONE) {
+      ierr = CeedVectorGetArray(impl->evecs[i + numinputfields], CEED_MEM_DEVICE,
+                                &impl->edata[i + numinputfields]); CeedChk(ierr);
+      ierr = CeedVectorSetArray(impl->qvecsout[i], CEED_MEM_DEVICE,
+                                CEED_USE_POINTER,
+                                impl->edata[i + numinputfields]); CeedChk(ierr);
+    }
+  }
+
+  // QFunction
+  CeedInt Q;
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+  ierr = CeedQFunctionApply(qf, numelements * Q, impl->qvecsin, impl->qvecsout);
+  CeedChk(ierr);
+
+  // Output basis action
+  ierr = CeedOperatorForkQueues_Magma(ceed, impl); CeedChk(ierr);
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    switch (emode) {
+    case CEED_EVAL_NONE:
+      ierr = CeedVectorRestoreArray(impl->evecs[i + numinputfields],
+                                    &impl->edata[i + numinputfields]);
+      CeedChk(ierr);
+      break;
+    case CEED_EVAL_INTERP:
+    case CEED_EVAL_GRAD:
+      ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
+      CeedChk(ierr);
+      ierr = CeedOperatorBasisApply_Magma(op, i + numinputfields, basis,
+                                          numelements, CEED_TRANSPOSE, emode,
+                                          impl->qvecsout[i],
+                                          impl->evecs[i + numinputfields]);
+      CeedChk(ierr);
+      break;
+    // LCOV_EXCL_START
+    case CEED_EVAL_WEIGHT:
+      return CeedError(ceed, 1,
+                       "CEED_EVAL_WEIGHT cannot be an output evaluation mode");
+    default:
+      break; // Not implemented
+      // LCOV_EXCL_STOP
+    }
+  }
+  ierr = CeedOperatorJoinQueues_Magma(ceed, impl); CeedChk(ierr);
+
+  // Output restriction
+  for (CeedInt i = 0; i < numoutputfields; i++) {
+    ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE)
+      vec = outvec;
+    ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[i], &Erestrict);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionApply(Erestrict, CEED_TRANSPOSE,
+                                    impl->evecs[i + numinputfields], vec,
+                                    request); CeedChk(ierr);
+  }
+
+  // Restore input arrays
+  for (CeedInt i = 0; i < numinputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    if (emode != CEED_EVAL_WEIGHT) {
+      ierr = CeedVectorRestoreArrayRead(impl->evecs[i],
+                                        (const CeedScalar **) &impl->edata[i]);
+      CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Create operator
+//------------------------------------------------------------------------------
+int CeedOperatorCreate_Magma(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedOperator_Magma *impl;
+
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  ierr = CeedOperatorSetData(op, impl); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
+                                CeedOperatorApplyAdd_Magma); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
+                                CeedOperatorDestroy_Magma); CeedChk(ierr);
+  return 0;
+}
+//------------------------------------------------------------------------------
@@ -27,7 +27,7 @@ static int CeedElemRestrictionApply_Magma(CeedElemRestriction r,
   ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
 
   Ceed_Magma *data;
-  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  ierr = CeedMagmaGetData(ceed, &data); CeedChk(ierr);
 
   CeedInt nelem;
   CeedElemRestrictionGetNumElements(r, &nelem);
@@ -91,7 +91,11 @@ static int CeedElemRestrictionApply_Magma(CeedElemRestriction r,
     CeedInt compstride;
     ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
 
-    if (tmode == CEED_TRANSPOSE) {
+    if (tmode == CEED_TRANSPOSE && impl->dtoffsets) {
+      magma_writeDofsTranspose(ncomp, compstride, esize, nelem, impl->nnodes,
+                               impl->dlvec_indices, impl->dtindices,
+                               impl->dtoffsets, du, dv, data->queue);
+    } else if (tmode == CEED_TRANSPOSE) {
       magma_writeDofsOffset(ncomp, compstride, esize, nelem, impl->doffsets,
                             du, dv, data->queue);
     } else {
@@ -131,6 +135,14 @@ static int CeedElemRestrictionGetOffsets_Magma(CeedElemRestriction rstr,
   case CEED_MEM_DEVICE:
     *offsets = impl->doffsets;
     break;
+  case CEED_MEM_UNIFIED: {
+    Ceed ceed;
+    ierr = CeedElemRestrictionGetCeed(rstr, &ceed); CeedChk(ierr);
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "CEED_MEM_UNIFIED is only supported for "
+                     "CeedVector");
+    // LCOV_EXCL_STOP
+  }
   }
   return 0;
 }
@@ -147,18 +159,102 @@ static int CeedElemRestrictionDestroy_Magma(CeedElemRestriction r) {
   } else if (impl->down_) {
     ierr = magma_free(impl->doffsets);       CeedChk(ierr);
   }
+  if (impl->dtoffsets) {
+    ierr = magma_free(impl->dlvec_indices);  CeedChk(ierr);
+    ierr = magma_free(impl->dtindices);      CeedChk(ierr);
+    ierr = magma_free(impl->dtoffsets);      CeedChk(ierr);
+  }
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
 }
 
+// Build the transpose of the offsets array, so the transpose restriction can
+//   gather the contributions to each L-vector node without atomics
+static int CeedElemRestrictionTranspose_Magma(CeedElemRestriction r,
+    const CeedInt *offsets) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
+  Ceed_Magma *data;
+  ierr = CeedMagmaGetData(ceed, &data); CeedChk(ierr);
+  CeedElemRestriction_Magma *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+  CeedInt nelem, elemsize, lsize;
+  ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
+  const CeedInt size = nelem * elemsize;
+
+  // Count nodes
+  bool *isNode;
+  ierr = CeedCalloc(lsize, &isNode); CeedChk(ierr);
+  for (CeedInt i = 0; i < size; i++)
+    isNode[offsets[i]] = 1;
+  CeedInt nnodes = 0;
+  for (CeedInt i = 0; i < lsize; i++)
+    nnodes += isNode[i];
+  impl->nnodes = nnodes;
+
+  // L-vector indices of the nodes
+  CeedInt *ind_to_offset, *lvec_indices;
+  ierr = CeedCalloc(lsize, &ind_to_offset); CeedChk(ierr);
+  ierr = CeedCalloc(nnodes, &lvec_indices); CeedChk(ierr);
+  for (CeedInt i = 0, j = 0; i < lsize; i++)
+    if (isNode[i]) {
+      lvec_indices[j] = i;
+      ind_to_offset[i] = j++;
+    }
+  ierr = CeedFree(&isNode); CeedChk(ierr);
+
+  // Transpose offsets and indices
+  CeedInt *toffsets, *tindices;
+  ierr = CeedCalloc(nnodes + 1, &toffsets); CeedChk(ierr);
+  ierr = CeedMalloc(size, &tindices); CeedChk(ierr);
+  for (CeedInt i = 0; i < size; i++)
+    toffsets[ind_to_offset[offsets[i]] + 1]++;
+  for (CeedInt i = 1; i <= nnodes; i++)
+    toffsets[i] += toffsets[i-1];
+  for (CeedInt i = 0; i < size; i++)
+    tindices[toffsets[ind_to_offset[offsets[i]]]++] = i;
+  for (CeedInt i = nnodes; i > 0; i--)
+    toffsets[i] = toffsets[i-1];
+  toffsets[0] = 0;
+
+  // Copy to device
+  ierr = magma_malloc( (void **)&impl->dlvec_indices,
+                       nnodes * sizeof(CeedInt)); CeedChk(ierr);
+  ierr = magma_malloc( (void **)&impl->dtindices,
+                       size * sizeof(CeedInt)); CeedChk(ierr);
+  ierr = magma_malloc( (void **)&impl->dtoffsets,
+                       (nnodes + 1) * sizeof(CeedInt)); CeedChk(ierr);
+  magma_setvector(nnodes, sizeof(CeedInt), lvec_indices, 1,
+                  impl->dlvec_indices, 1, data->queue);
+  magma_setvector(size, sizeof(CeedInt), tindices, 1, impl->dtindices, 1,
+                  data->queue);
+  magma_setvector(nnodes + 1, sizeof(CeedInt), toffsets, 1, impl->dtoffsets, 1,
+                  data->queue);
+
+  ierr = CeedFree(&ind_to_offset); CeedChk(ierr);
+  ierr = CeedFree(&lvec_indices); CeedChk(ierr);
+  ierr = CeedFree(&toffsets); CeedChk(ierr);
+  ierr = CeedFree(&tindices); CeedChk(ierr);
+  return 0;
+}
+
 int CeedElemRestrictionCreate_Magma(CeedMemType mtype, CeedCopyMode cmode,
                                     const CeedInt *offsets, CeedElemRestriction r) {
   int ierr;
   Ceed ceed;
   ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
+  CeedInt nsides;
+  ierr = CeedElemRestrictionGetNumSides(r, &nsides); CeedChk(ierr);
+  if (nsides > 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Two-sided restrictions not supported");
+  // LCOV_EXCL_STOP
 
   Ceed_Magma *data;
-  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  ierr = CeedMagmaGetData(ceed, &data); CeedChk(ierr);
 
   CeedInt elemsize, nelem;
   ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
@@ -226,8 +322,8 @@ int CeedElemRestrictionCreate_Magma(CeedMemType mtype, CeedCopyMode cmode,
       impl->own_ = 1;
 
       if (offsets)
-        magma_getvector(size, sizeof(CeedInt), impl->doffsets, 1, (void *)offsets, 1,
-                        data->queue);
+        magma_copyvector(size, sizeof(CeedInt), offsets, 1, impl->doffsets, 1,
+                         data->queue);
       break;
     case CEED_OWN_POINTER:
       impl->doffsets = (CeedInt *)offsets;
@@ -245,6 +341,25 @@ int CeedElemRestrictionCreate_Magma(CeedMemType mtype, CeedCopyMode cmode,
     return CeedError(ceed, 1, "Only MemType = HOST or DEVICE supported");
 
   ierr = CeedElemRestrictionSetData(r, impl); CeedChk(ierr);
+
+  // Deterministic Ceeds gather the transpose instead of using atomics
+  Ceed parent;
+  ierr = CeedGetParent(ceed, &parent); CeedChk(ierr);
+  bool isDeterministic;
+  ierr = CeedIsDeterministic(parent, &isDeterministic); CeedChk(ierr);
+  if (isDeterministic && offsets) {
+    if (mtype == CEED_MEM_HOST) {
+      ierr = CeedElemRestrictionTranspose_Magma(r, offsets); CeedChk(ierr);
+    } else {
+      CeedInt *hoffsets;
+      ierr = CeedMalloc(size, &hoffsets); CeedChk(ierr);
+      magma_getvector(size, sizeof(CeedInt), impl->doffsets, 1, hoffsets, 1,
+                      data->queue);
+      ierr = CeedElemRestrictionTranspose_Magma(r, hoffsets); CeedChk(ierr);
+      ierr = CeedFree(&hoffsets); CeedChk(ierr);
+    }
+  }
+
   CeedInt layout[3] = {1, elemsize*nelem, elemsize};
   ierr = CeedElemRestrictionSetELayout(r, layout); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "Apply",
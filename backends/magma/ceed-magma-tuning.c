@@ -0,0 +1,279 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include "ceed-magma.h"
+#include <stdlib.h>
+
+//------------------------------------------------------------------------------
+// Tensor basis kernel parameters by device architecture
+//
+// Rows are ordered from the newest architecture down; a device uses the first
+//   row whose architecture it reaches, and the last row holds the defaults.
+//   The dimension-specific kernels are compiled for P and Q up to 10 in 1D
+//   and 2D and up to 14 in 3D; beyond maxpq the generic kernels are used.
+//------------------------------------------------------------------------------
+typedef struct {
+  magma_int_t arch;          // Smallest architecture the row applies to
+  magma_int_t maxthreads[3]; // Threads per block for the 1D, 2D, 3D kernels
+  magma_int_t maxpq[3];      // Largest P or Q with dimension-specific kernels
+} CeedMagmaTuning;
+
+#ifdef HAVE_HIP
+static const CeedMagmaTuning tuning[] = {
+  {908, {128, 128, 128}, {10, 10, 14}}, // MI100, 64 KB LDS per workgroup
+  {  0, {128, 128,  64}, {10, 10, 12}},
+};
+#else
+static const CeedMagmaTuning tuning[] = {
+  {800, {128, 128, 128}, {10, 10, 14}}, // A100, 163 KB shared memory per block
+  {700, {128, 128,  64}, {10, 10, 14}}, // V100, 96 KB shared memory per block
+  {  0, {128, 128,  64}, {10, 10, 10}},
+};
+#endif
+
+//------------------------------------------------------------------------------
+// Non-tensor basis GEMM variants by device architecture
+//
+// The non-tensor bases apply C = op(A) B with A the Q x P basis matrix and
+//   n = nelem*ncomp columns: NN with m = P and k = Q for the transpose
+//   action, TN with m = Q and k = P otherwise. A row applies when m, k, and n
+//   are at most its sizes, zero meaning any, and gives the GEMM variant and
+//   the columns per batch n1 of the batched variants, zero meaning n. The
+//   tables of the architectures the device reaches are searched from the
+//   newest down and the first matching row is used, so a table for a newer
+//   architecture only lists the shapes it changes. The architecture 0 rows
+//   hold the earlier offline tuning; CEED_MAGMA_GEMM forces a variant, so
+//   tables can be regenerated by timing each variant over the shapes of the
+//   simplex and non-tensor bases.
+//------------------------------------------------------------------------------
+typedef struct {
+  magma_int_t m, k, n;          // Largest sizes the row applies to, 0 for any
+  magma_gemm_variant_t variant; // GEMM variant
+  magma_int_t n1;               // Columns per batch, 0 for n
+} CeedMagmaGemmTuning;
+
+typedef struct {
+  magma_int_t arch;                      // Smallest architecture of the table
+  const CeedMagmaGemmTuning *nn, *tn;    // Rows for NN and TN, in order
+} CeedMagmaGemmTable;
+
+// Basis matrices with up to 20 nodes stay in shared memory
+static const CeedMagmaGemmTuning gemmsmallnn[] = {
+  {  20,  128, 0, MAGMA_GEMM_SMALL,       0},
+  {  -1,   -1, 0, MAGMA_GEMM_TUNED,       0},
+};
+static const CeedMagmaGemmTuning gemmsmalltn[] = {
+  { 128,   20, 0, MAGMA_GEMM_SMALL,       0},
+  {  -1,   -1, 0, MAGMA_GEMM_TUNED,       0},
+};
+
+#ifdef HAVE_HIP
+static const CeedMagmaGemmTuning gemmnn[] = {
+  {   2,    3, 0, MAGMA_GEMM_VENDOR,    128},
+  {   3,    4, 0, MAGMA_GEMM_VENDOR,    128},
+  {   4,    5, 0, MAGMA_GEMM_VENDOR,    128},
+  {   4,    9, 0, MAGMA_GEMM_VENDOR,     16},
+  {   5,    6, 0, MAGMA_GEMM_VENDOR,    128},
+  {   6,    7, 0, MAGMA_GEMM_VENDOR,    128},
+  {   7,    8, 0, MAGMA_GEMM_VENDOR,    128},
+  {   8,    9, 0, MAGMA_GEMM_VENDOR,     16},
+  {   8,   27, 0, MAGMA_GEMM_VENDOR,     16},
+  {   9,   10, 0, MAGMA_GEMM_VENDOR,    128},
+  {   9,   16, 0, MAGMA_GEMM_VENDOR,    128},
+  {  16,   25, 0, MAGMA_GEMM_VENDOR,     16},
+  {  25,   36, 0, MAGMA_GEMM_VENDOR,    128},
+  {  27,   64, 0, MAGMA_GEMM_VENDOR,    128},
+  {  36,   49, 0, MAGMA_GEMM_VENDOR,    128},
+  {  49,   64, 0, MAGMA_GEMM_VENDOR,    128},
+  {  64,   81, 0, MAGMA_GEMM_VENDOR,    128},
+  {  64,  125, 0, MAGMA_GEMM_VENDOR,    128},
+  {  81,  100, 0, MAGMA_GEMM_VENDOR,    128},
+  { 125,  216, 0, MAGMA_GEMM_VENDOR,    256},
+  { 216,  343, 0, MAGMA_GEMM_VENDOR,    256},
+  { 343,  512, 0, MAGMA_GEMM_VENDOR,    256},
+  { 512,  729, 0, MAGMA_GEMM_VENDOR,    256},
+  {   0,    0, 0, MAGMA_GEMM_DEFAULT,     0},
+};
+static const CeedMagmaGemmTuning gemmtn[] = {
+  {   2,    3, 0, MAGMA_GEMM_VENDOR,      4},
+  {   3,    4, 0, MAGMA_GEMM_VENDOR,      4},
+  {   4,    5, 0, MAGMA_GEMM_VENDOR,    128},
+  {   4,    9, 0, MAGMA_GEMM_VENDOR,      4},
+  {   5,    6, 0, MAGMA_GEMM_VENDOR,    128},
+  {   6,    7, 0, MAGMA_GEMM_VENDOR,    128},
+  {   7,    8, 0, MAGMA_GEMM_VENDOR,    128},
+  {   8,    9, 0, MAGMA_GEMM_VENDOR,    128},
+  {   8,   27, 0, MAGMA_GEMM_VENDOR,    128},
+  {   9,   10, 0, MAGMA_GEMM_VENDOR,    128},
+  {   9,   16, 0, MAGMA_GEMM_VENDOR,    128},
+  {  16,   25, 0, MAGMA_GEMM_VENDOR,    128},
+  {  25,   36, 0, MAGMA_GEMM_VENDOR,    128},
+  {  27,   64, 0, MAGMA_GEMM_VENDOR,    128},
+  {  36,   49, 0, MAGMA_GEMM_VENDOR,    128},
+  {  49,   64, 0, MAGMA_GEMM_VENDOR,    128},
+  {  64,   81, 0, MAGMA_GEMM_VENDOR,    128},
+  {  64,  125, 0, MAGMA_GEMM_VENDOR,    128},
+  {  81,  100, 0, MAGMA_GEMM_VENDOR,    128},
+  { 125,  216, 0, MAGMA_GEMM_VENDOR,    128},
+  { 216,  343, 0, MAGMA_GEMM_VENDOR,    128},
+  { 343,  512, 0, MAGMA_GEMM_VENDOR,    128},
+  { 512,  729, 0, MAGMA_GEMM_VENDOR,    128},
+  {   0,    0, 0, MAGMA_GEMM_DEFAULT,     0},
+};
+
+static const CeedMagmaGemmTable gemmtuning[] = {
+  {908, gemmsmallnn, gemmsmalltn}, // MI100
+  {  0, gemmnn, gemmtn},
+};
+#else
+static const CeedMagmaGemmTuning gemmnn[] = {
+  {   2,    3, 0, MAGMA_GEMM_VENDOR,    128},
+  {   3,    4, 0, MAGMA_GEMM_VENDOR,    128},
+  {   4,    5, 0, MAGMA_GEMM_VENDOR,    128},
+  {   4,    9, 0, MAGMA_GEMM_MAGMABLAS,  16},
+  {   5,    6, 0, MAGMA_GEMM_VENDOR,    128},
+  {   6,    7, 0, MAGMA_GEMM_VENDOR,    128},
+  {   7,    8, 0, MAGMA_GEMM_VENDOR,    128},
+  {   8,    9, 0, MAGMA_GEMM_MAGMABLAS,  16},
+  {   8,   27, 0, MAGMA_GEMM_MAGMABLAS,  16},
+  {   9,   10, 0, MAGMA_GEMM_MAGMABLAS, 128},
+  {   9,   16, 0, MAGMA_GEMM_VENDOR,    128},
+  {  16,   25, 0, MAGMA_GEMM_MAGMABLAS,  16},
+  {  25,   36, 0, MAGMA_GEMM_MAGMABLAS, 128},
+  {  27,   64, 0, MAGMA_GEMM_MAGMABLAS, 128},
+  {  36,   49, 0, MAGMA_GEMM_VENDOR,    128},
+  {  49,   64, 0, MAGMA_GEMM_VENDOR,    128},
+  {  64,   81, 0, MAGMA_GEMM_VENDOR,    128},
+  {  64,  125, 0, MAGMA_GEMM_VENDOR,    128},
+  {  81,  100, 0, MAGMA_GEMM_VENDOR,    128},
+  { 125,  216, 0, MAGMA_GEMM_VENDOR,    256},
+  { 216,  343, 0, MAGMA_GEMM_VENDOR,    256},
+  { 343,  512, 0, MAGMA_GEMM_VENDOR,    256},
+  { 512,  729, 0, MAGMA_GEMM_VENDOR,    256},
+  {   0,    0, 0, MAGMA_GEMM_DEFAULT,     0},
+};
+static const CeedMagmaGemmTuning gemmtn[] = {
+  {   2,    3, 0, MAGMA_GEMM_VENDOR,      4},
+  {   3,    4, 0, MAGMA_GEMM_VENDOR,      4},
+  {   4,    5, 0, MAGMA_GEMM_VENDOR,    128},
+  {   4,    9, 0, MAGMA_GEMM_VENDOR,      4},
+  {   5,    6, 0, MAGMA_GEMM_VENDOR,    128},
+  {   6,    7, 0, MAGMA_GEMM_VENDOR,    128},
+  {   7,    8, 0, MAGMA_GEMM_VENDOR,    128},
+  {   8,    9, 0, MAGMA_GEMM_MAGMABLAS, 128},
+  {   8,   27, 0, MAGMA_GEMM_MAGMABLAS, 128},
+  {   9,   10, 0, MAGMA_GEMM_MAGMABLAS, 128},
+  {   9,   16, 0, MAGMA_GEMM_VENDOR,    128},
+  {  16,   25, 0, MAGMA_GEMM_MAGMABLAS, 128},
+  {  25,   36, 0, MAGMA_GEMM_MAGMABLAS, 128},
+  {  27,   64, 0, MAGMA_GEMM_MAGMABLAS, 128},
+  {  36,   49, 0, MAGMA_GEMM_MAGMABLAS, 128},
+  {  49,   64, 0, MAGMA_GEMM_VENDOR,    128},
+  {  64,   81, 0, MAGMA_GEMM_VENDOR,    128},
+  {  64,  125, 0, MAGMA_GEMM_VENDOR,    128},
+  {  81,  100, 0, MAGMA_GEMM_VENDOR,    128},
+  { 125,  216, 0, MAGMA_GEMM_VENDOR,    128},
+  { 216,  343, 0, MAGMA_GEMM_VENDOR,    128},
+  { 343,  512, 0, MAGMA_GEMM_VENDOR,    128},
+  { 512,  729, 0, MAGMA_GEMM_VENDOR,    128},
+  {   0,    0, 0, MAGMA_GEMM_DEFAULT,     0},
+};
+
+static const CeedMagmaGemmTable gemmtuning[] = {
+  {700, gemmsmallnn, gemmsmalltn}, // V100 and newer
+  {  0, gemmnn, gemmtn},
+};
+#endif
+
+//------------------------------------------------------------------------------
+// Select kernel parameters for the current device
+//
+// CEED_MAGMA_KERNEL_MODE=generic forces the generic kernels for all sizes, and
+//   CEED_MAGMA_GEMM=default, magmablas, vendor, or small forces a GEMM variant
+//   for non-tensor bases.
+//------------------------------------------------------------------------------
+int CeedMagmaTune(Ceed_Magma *data) {
+  magma_int_t arch = magma_getdevice_arch();
+  const CeedMagmaTuning *row = tuning;
+  while (row->arch > arch)
+    row++;
+  for (CeedInt d = 0; d < 3; d++) {
+    data->maxthreads[d] = row->maxthreads[d];
+    data->maxpq[d] = row->maxpq[d];
+  }
+
+  const char *mode = getenv("CEED_MAGMA_KERNEL_MODE");
+  data->basis_kernel_mode = (mode && !strcmp(mode, "generic")) ?
+                            MAGMA_KERNEL_DIM_GENERIC : MAGMA_KERNEL_DIM_SPECIFIC;
+
+  // CEED_MAGMA_GEMM forces a GEMM variant for non-tensor bases
+  const char *gemm = getenv("CEED_MAGMA_GEMM");
+  const char *gemmvariants[] = {"tuned", "default", "magmablas", "vendor",
+                                "small"
+                               };
+  data->arch = arch;
+  data->gemmvariant = MAGMA_GEMM_TUNED;
+  for (CeedInt i = 0; gemm && i < 5; i++)
+    if (!strcmp(gemm, gemmvariants[i]))
+      data->gemmvariant = (magma_gemm_variant_t)i;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Kernel mode for a tensor basis of the given sizes
+//------------------------------------------------------------------------------
+magma_kernel_mode_t CeedMagmaKernelMode(Ceed_Magma *data, CeedInt dim,
+                                        CeedInt P, CeedInt Q) {
+  if (data->basis_kernel_mode == MAGMA_KERNEL_DIM_GENERIC || dim > 3 ||
+      CeedIntMax(P, Q) > data->maxpq[dim-1])
+    return MAGMA_KERNEL_DIM_GENERIC;
+  return MAGMA_KERNEL_DIM_SPECIFIC;
+}
+
+//------------------------------------------------------------------------------
+// GEMM variant and batch split for a non-tensor basis GEMM
+//------------------------------------------------------------------------------
+void CeedMagmaGemmSelect(Ceed_Magma *data, magma_trans_t transA,
+                         magma_int_t m, magma_int_t n, magma_int_t k,
+                         magma_gemm_variant_t *variant, magma_int_t *n1) {
+  *variant = MAGMA_GEMM_DEFAULT;
+  *n1 = n;
+  for (const CeedMagmaGemmTable *table = gemmtuning; ; table++) {
+    if (table->arch > data->arch)
+      continue;
+    const CeedMagmaGemmTuning *row = transA == MagmaTrans ? table->tn :
+                                     table->nn;
+    for (; row->m >= 0; row++)
+      if ((!row->m || m <= row->m) && (!row->k || k <= row->k) &&
+          (!row->n || n <= row->n)) {
+        *variant = row->variant;
+        if (row->n1)
+          *n1 = row->n1;
+        break;
+      }
+    if (row->m >= 0 || !table->arch)
+      break;
+  }
+
+  // Forced variants keep the tuned batch split
+  if (data->gemmvariant != MAGMA_GEMM_TUNED) {
+    *variant = data->gemmvariant;
+    if (*n1 == n && (*variant == MAGMA_GEMM_MAGMABLAS ||
+                     *variant == MAGMA_GEMM_VENDOR))
+      *n1 = 128;
+  }
+}
+//------------------------------------------------------------------------------
@@ -16,11 +16,47 @@
 
 #include "ceed-magma.h"
 
+//------------------------------------------------------------------------------
+// Get backend data, setting up MAGMA and the device on first use
+//
+// Creating a Ceed does not touch the device, so short-lived processes that
+//   never create device objects do not pay for MAGMA initialization.
+//------------------------------------------------------------------------------
+int CeedMagmaGetData(Ceed ceed, Ceed_Magma **data) {
+  int ierr;
+  ierr = CeedGetData(ceed, data); CeedChk(ierr);
+  if ((*data)->devicesetup)
+    return 0;
+
+  ierr = magma_init();
+  if (ierr)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "error in magma_init(): %d\n", ierr);
+  // LCOV_EXCL_STOP
+
+  // create a queue that uses the null stream
+  magma_getdevice( &((*data)->device) );
+  #ifdef HAVE_HIP
+  magma_queue_create_from_hip((*data)->device, NULL, NULL, NULL,
+                              &((*data)->queue));
+  #else
+  magma_queue_create_from_cuda((*data)->device, NULL, NULL, NULL,
+                               &((*data)->queue));
+  #endif
+
+  // kernel selection and max threads per thread-block for this device
+  ierr = CeedMagmaTune(*data); CeedChk(ierr);
+
+  (*data)->devicesetup = true;
+  return 0;
+}
+
 static int CeedDestroy_Magma(Ceed ceed) {
   int ierr;
   Ceed_Magma *data;
   ierr = CeedGetData(ceed, &data); CeedChk(ierr);
-  magma_queue_destroy( data->queue );
+  if (data->devicesetup)
+    magma_queue_destroy( data->queue );
   ierr = CeedFree(&data); CeedChk(ierr);
   return 0;
 }
@@ -42,31 +78,18 @@ static int CeedInit_Magma(const char *resource, Ceed ceed) {
   #endif
   ierr = CeedSetDelegate(ceed, ceedref); CeedChk(ierr);
 
-  ierr = magma_init();
-  if (ierr)
-    // LCOV_EXCL_START
-    return CeedError(ceed, 1, "error in magma_init(): %d\n", ierr);
-  // LCOV_EXCL_STOP
-
+  // MAGMA and the device are set up by CeedMagmaGetData() on first use
   Ceed_Magma *data;
   ierr = CeedCalloc(sizeof(Ceed_Magma), &data); CeedChk(ierr);
   ierr = CeedSetData(ceed, data); CeedChk(ierr);
 
-  // kernel selection
-  data->basis_kernel_mode = MAGMA_KERNEL_DIM_SPECIFIC;
-
-  // kernel max threads per thread-block
-  data->maxthreads[0] = 128;  // for 1D kernels
-  data->maxthreads[1] = 128;  // for 2D kernels
-  data->maxthreads[2] =  64;  // for 3D kernels
-
-  // create a queue that uses the null stream
-  magma_getdevice( &(data->device) );
+  // Assembly and other operator actions not implemented here fall back
   #ifdef HAVE_HIP
-  magma_queue_create_from_hip(data->device, NULL, NULL, NULL, &(data->queue));
+  const char fallbackresource[] = "/gpu/hip/ref";
   #else
-  magma_queue_create_from_cuda(data->device, NULL, NULL, NULL, &(data->queue));
+  const char fallbackresource[] = "/gpu/cuda/ref";
   #endif
+  ierr = CeedSetOperatorFallbackResource(ceed, fallbackresource); CeedChk(ierr);
 
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "ElemRestrictionCreate",
                                 CeedElemRestrictionCreate_Magma); CeedChk(ierr);
@@ -77,6 +100,8 @@ static int CeedInit_Magma(const char *resource, Ceed ceed) {
                                 CeedBasisCreateTensorH1_Magma); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "BasisCreateH1",
                                 CeedBasisCreateH1_Magma); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate",
+                                CeedOperatorCreate_Magma); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy",
                                 CeedDestroy_Magma); CeedChk(ierr);
   return 0;
@@ -27,11 +27,24 @@ typedef enum {
   MAGMA_KERNEL_DIM_SPECIFIC=102
 } magma_kernel_mode_t;
 
+// GEMM variants for non-tensor bases
+typedef enum {
+  MAGMA_GEMM_TUNED=0,      // Variant from the tuning tables
+  MAGMA_GEMM_DEFAULT,      // magma_dgemm over all columns
+  MAGMA_GEMM_MAGMABLAS,    // magmablas strided batched GEMM
+  MAGMA_GEMM_VENDOR,       // cuBLAS or hipBLAS strided batched GEMM
+  MAGMA_GEMM_SMALL,        // magma_dgemm_small, basis matrix in shared memory
+} magma_gemm_variant_t;
+
 typedef struct {
   magma_kernel_mode_t basis_kernel_mode;
   magma_int_t maxthreads[3];
+  magma_int_t maxpq[3];  /// Largest P or Q with dimension-specific kernels
+  magma_int_t arch;      /// Device architecture the tuning tables are read for
+  magma_gemm_variant_t gemmvariant; /// GEMM variant of non-tensor bases
   magma_device_t device;
   magma_queue_t queue;
+  bool devicesetup;      /// MAGMA and the queue are set up on first use
 } Ceed_Magma;
 
 typedef struct {
@@ -53,6 +66,12 @@ typedef struct {
   CeedInt *doffsets;
   int  own_;
   int down_;            // cover a case where we own Device memory
+  // Transpose of the offsets, used for deterministic (atomic-free)
+  //   transpose application
+  CeedInt nnodes;
+  CeedInt *dlvec_indices;
+  CeedInt *dtindices;
+  CeedInt *dtoffsets;
 } CeedElemRestriction_Magma;
 
 typedef struct {
@@ -61,6 +80,22 @@ typedef struct {
   bool setupdone;
 } CeedQFunction_Magma;
 
+typedef struct {
+  CeedVector
+  *evecs;   /// E-vectors needed to apply operator (input followed by outputs)
+  CeedScalar **edata;
+  uint64_t *inputstate;   /// State counter of inputs
+  CeedVector *qvecsin;    /// Input Q-vectors needed to apply operator
+  CeedVector *qvecsout;   /// Output Q-vectors needed to apply operator
+  CeedInt    numein;
+  CeedInt    numeout;
+  CeedInt    *fieldqueue; /// Launch queue of each basis field, or -1
+  CeedInt    numqueues;
+  magma_queue_t *queues;  /// Launch queues for the basis actions of fields
+  magma_event_t *events;  /// Completion event of each launch queue
+  magma_event_t fork;     /// Default queue event the launch queues wait on
+} CeedOperator_Magma;
+
 #define USE_MAGMA_BATCH
 #define USE_MAGMA_BATCH2
 #define USE_MAGMA_BATCH3
@@ -211,12 +246,28 @@ CEED_INTERN {
                               const double *du, double *dv,
                               magma_queue_t queue);
 
+  void magma_writeDofsTranspose(const magma_int_t NCOMP,
+                                const magma_int_t compstride,
+                                const magma_int_t esize, const magma_int_t nelem,
+                                const magma_int_t nnodes,
+                                const int *lvec_indices, const int *tindices,
+                                const int *toffsets, const double *du,
+                                double *dv, magma_queue_t queue);
+
   int magma_dgemm_nontensor(
     magma_trans_t transA, magma_trans_t transB,
     magma_int_t m, magma_int_t n, magma_int_t k,
     double alpha, const double *dA, magma_int_t ldda,
     const double *dB, magma_int_t lddb,
     double beta,  double *dC, magma_int_t lddc,
+    Ceed_Magma *data );
+
+  magma_int_t magma_dgemm_small(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    double alpha, const double *dA, magma_int_t ldda,
+    const double *dB, magma_int_t lddb,
+    double beta,  double *dC, magma_int_t lddc,
     magma_queue_t queue );
 
 
@@ -251,6 +302,17 @@ CEED_INTERN {
 
   int CeedOperatorCreate_Magma(CeedOperator op);
 
+  int CeedMagmaGetData(Ceed ceed, Ceed_Magma **data);
+
+  int CeedMagmaTune(Ceed_Magma *data);
+
+  magma_kernel_mode_t CeedMagmaKernelMode(Ceed_Magma *data, CeedInt dim,
+                                          CeedInt P, CeedInt Q);
+
+  void CeedMagmaGemmSelect(Ceed_Magma *data, magma_trans_t transA,
+                           magma_int_t m, magma_int_t n, magma_int_t k,
+                           magma_gemm_variant_t *variant, magma_int_t *n1);
+
   #ifdef __cplusplus
 }
   #endif
@@ -113,9 +113,42 @@ magma_writeDofsStrided_kernel(const int NCOMP, const int esize, const int nelem,
 
     for (CeedInt i = pid; i < esize; i += blockDim.x) {
         for (CeedInt comp = 0; comp < NCOMP; ++comp) {
-            magmablas_datomic_add(dv + (i * strides[0] + comp * strides[1] + 
-                                        elem * strides[2]),
-                                  du[i+elem*esize+comp*esize*nelem]);
+            // Strided layouts map each E-vector entry to a distinct
+            //   L-vector entry, so no atomics are needed
+            dv[i * strides[0] + comp * strides[1] + elem * strides[2]] +=
+                du[i+elem*esize+comp*esize*nelem];
+        }
+    }
+}
+
+// Fastest index listed first
+// i : related to nodes
+// e : elements
+// c: component
+// Go from E-vector (du) to L-vector (dv), gathering the contributions to
+//  each L-vector node through the transpose of the offsets array.
+//  Each node is owned by a single thread and summed in a fixed order,
+//  so the result is bitwise reproducible.
+//
+// dv(lvec_indices(n) + compstride * c) = sum_j du(tindices(j), c),
+//   toffsets(n) <= j < toffsets(n+1)
+static __global__ void
+magma_writeDofsTranspose_kernel(const int NCOMP, const int compstride,
+                                const int esize, const int nelem,
+                                const int nnodes, const int *lvec_indices,
+                                const int *tindices, const int *toffsets,
+                                const double *du, double *dv)
+{
+    for (CeedInt n = blockIdx.x * blockDim.x + threadIdx.x; n < nnodes;
+         n += blockDim.x * gridDim.x) {
+        const CeedInt ind = lvec_indices[n];
+        const CeedInt rng1 = toffsets[n];
+        const CeedInt rngN = toffsets[n+1];
+        for (CeedInt comp = 0; comp < NCOMP; ++comp) {
+            double value = 0.0;
+            for (CeedInt j = rng1; j < rngN; ++j)
+                value += du[tindices[j]+comp*esize*nelem];
+            dv[ind + compstride * comp] += value;
         }
     }
 }
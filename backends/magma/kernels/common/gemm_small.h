@@ -0,0 +1,81 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#ifndef CEED_MAGMA_GEMM_SMALL_H
+#define CEED_MAGMA_GEMM_SMALL_H
+
+#include <ceed.h>
+#include <magma_v2.h>
+#include "magma_common_device.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// C = alpha op(A) B + beta C for a small m x k op(A), such as the basis matrix
+// of a non-tensor basis, and many columns of B and C.
+// Each thread block reads op(A) into shared memory once and keeps it there
+// while it loops over tiles of blockDim.y columns, each staged in shared memory
+// by the whole block; thread (tx, ty) computes rows tx, tx + blockDim.x, ...
+// of column ty of the tile.
+template<typename T>
+static __global__ void
+magma_gemm_small_kernel(
+    const int transA, const int m, const int n, const int k,
+    const T alpha, const T *dA, const int ldda,
+    const T *dB, const int lddb,
+    const T beta, T *dC, const int lddc)
+{
+    MAGMA_DEVICE_SHARED(CeedScalar, shared_data)
+
+    const int tx       = threadIdx.x;
+    const int ty       = threadIdx.y;
+    const int tid      = ty * blockDim.x + tx;
+    const int nthreads = blockDim.x * blockDim.y;
+
+    // shared memory pointers
+    T* sA = (T*)shared_data;     // m x k, op(A)
+    T* sB = sA + m * k;          // k x blockDim.y
+
+    // read op(A)
+    for (int i = tid; i < m * k; i += nthreads) {
+        const int row = i % m, col = i / m;
+        sA[i] = transA ? dA[col + row * ldda] : dA[row + col * ldda];
+    }
+
+    for (int c0 = blockIdx.x * blockDim.y; c0 < n; c0 += gridDim.x * blockDim.y) {
+        const int ncols = min((int)blockDim.y, n - c0);
+
+        // read a tile of B
+        __syncthreads();
+        for (int i = tid; i < k * ncols; i += nthreads) {
+            const int row = i % k, col = i / k;
+            sB[i] = dB[row + (c0 + col) * lddb];
+        }
+        __syncthreads();
+
+        // write a tile of C
+        if (ty < ncols) {
+            T *dCcol = dC + (c0 + ty) * lddc;
+            for (int row = tx; row < m; row += blockDim.x) {
+                T sum = 0.;
+                for (int j = 0; j < k; j++)
+                    sum += sA[row + j * m] * sB[j + ty * k];
+                dCcol[row] = (beta == 0.) ? alpha * sum :
+                             alpha * sum + beta * dCcol[row];
+            }
+        }
+    }
+}
+
+#endif    // CEED_MAGMA_GEMM_SMALL_H
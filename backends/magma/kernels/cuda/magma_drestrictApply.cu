@@ -86,3 +86,22 @@ magma_writeDofsStrided(const magma_int_t NCOMP, const magma_int_t esize,
       magma_queue_get_cuda_stream(queue)>>>(NCOMP, esize, nelem, 
       strides, du, dv);
 }
+
+// WriteDofs from device memory, gathering through the transpose offsets
+// du is E-vector, size nelem * esize * NCOMP
+// dv is L-vector, size lsize
+extern "C" void
+magma_writeDofsTranspose(const magma_int_t NCOMP, const magma_int_t compstride,
+                         const magma_int_t esize, const magma_int_t nelem,
+                         const magma_int_t nnodes, const int *lvec_indices,
+                         const int *tindices, const int *toffsets,
+                         const double *du, double *dv, magma_queue_t queue)
+{
+    magma_int_t threads = 256;
+    magma_int_t grid    = (nnodes + threads - 1) / threads;
+    if (grid == 0) return;
+
+    magma_writeDofsTranspose_kernel<<<grid, threads, 0,
+      magma_queue_get_cuda_stream(queue)>>>(NCOMP, compstride,
+      esize, nelem, nnodes, lvec_indices, tindices, toffsets, du, dv);
+}
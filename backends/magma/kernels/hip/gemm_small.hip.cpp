@@ -0,0 +1,59 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include "hip/hip_runtime.h"
+#include "../common/gemm_small.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Small GEMM for non-tensor bases, see magma_gemm_small_kernel.
+// Returns 1 without launching when op(A) and a tile of B do not fit in shared
+// memory, so the caller can use another GEMM.
+extern "C" magma_int_t
+magma_dgemm_small(
+    magma_trans_t transA,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    double alpha, const double *dA, magma_int_t ldda,
+    const double *dB, magma_int_t lddb,
+    double beta,  double *dC, magma_int_t lddc,
+    magma_queue_t queue)
+{
+    magma_device_t device;
+    magma_getdevice( &device );
+
+    int shmem_max, nthreads_max, ncu;  // must be int
+    hipDeviceGetAttribute (&nthreads_max, hipDeviceAttributeMaxThreadsPerBlock, device);
+    hipDeviceGetAttribute (&ncu, hipDeviceAttributeMultiprocessorCount, device);
+    hipDeviceGetAttribute (&shmem_max, hipDeviceAttributeMaxSharedMemoryPerBlock, device);
+
+    // one thread per row of C, up to 256 threads per block
+    magma_int_t ntx = CeedIntMin(m, 256);
+    magma_int_t nty = CeedIntMax(1, 256 / ntx);
+    magma_int_t shmem = (m * k + k * nty) * sizeof(double);
+
+    if ( n == 0 ) return 0;
+    if ( ntx * nty > nthreads_max || shmem > shmem_max ) {
+        return 1;    // launch failed
+    }
+    else {
+        // enough blocks to fill the device, each keeping op(A) for many tiles
+        magma_int_t ntiles = (n + nty - 1) / nty;
+        dim3 threads(ntx, nty, 1);
+        dim3 grid(CeedIntMin(ntiles, 8 * ncu), 1, 1);
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(magma_gemm_small_kernel<double>), grid, threads, shmem, magma_queue_get_hip_stream(queue),
+                           transA == MagmaTrans, m, n, k, alpha, dA, ldda, dB, lddb, beta, dC, lddc);
+        return (hipPeekAtLastError() == hipSuccess) ? 0 : 1;
+    }
+}
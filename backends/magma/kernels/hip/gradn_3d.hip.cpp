@@ -140,6 +140,45 @@ magma_gradn_3d_ncomp_q(
     return launch_failed;
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Orders above 10 are specialized only for Q within two of P, which covers the
+// usual quadratures both in the forward and in the transposed action
+template<int P>
+static magma_int_t 
+magma_gradn_3d_ncomp_q_high(
+                magma_int_t Q, magma_int_t ncomp,
+                const CeedScalar *dinterp1d, const CeedScalar *dgrad1d, magma_trans_t transT,
+                const CeedScalar *dU, magma_int_t estrdU, magma_int_t cstrdU, magma_int_t dstrdU,
+                      CeedScalar *dV, magma_int_t estrdV, magma_int_t cstrdV, magma_int_t dstrdV,
+                magma_int_t nelem, magma_int_t maxthreads, magma_queue_t queue)
+{
+    magma_int_t launch_failed = 0;
+    switch (Q - P) {
+        case -2: 
+          launch_failed = magma_gradn_3d_ncomp<P, P-2>
+          (ncomp, dinterp1d, dgrad1d, transT, dU, estrdU, cstrdU, dstrdU, dV, estrdV, cstrdV, dstrdV, nelem, maxthreads, queue); 
+          break;
+        case -1: 
+          launch_failed = magma_gradn_3d_ncomp<P, P-1>
+          (ncomp, dinterp1d, dgrad1d, transT, dU, estrdU, cstrdU, dstrdU, dV, estrdV, cstrdV, dstrdV, nelem, maxthreads, queue); 
+          break;
+        case  0: 
+          launch_failed = magma_gradn_3d_ncomp<P, P>
+          (ncomp, dinterp1d, dgrad1d, transT, dU, estrdU, cstrdU, dstrdU, dV, estrdV, cstrdV, dstrdV, nelem, maxthreads, queue); 
+          break;
+        case  1: 
+          launch_failed = magma_gradn_3d_ncomp<P, P+1>
+          (ncomp, dinterp1d, dgrad1d, transT, dU, estrdU, cstrdU, dstrdU, dV, estrdV, cstrdV, dstrdV, nelem, maxthreads, queue); 
+          break;
+        case  2: 
+          launch_failed = magma_gradn_3d_ncomp<P, P+2>
+          (ncomp, dinterp1d, dgrad1d, transT, dU, estrdU, cstrdU, dstrdU, dV, estrdV, cstrdV, dstrdV, nelem, maxthreads, queue); 
+          break;
+        default: launch_failed = 1;
+    }
+    return launch_failed;
+}
+
 
 //////////////////////////////////////////////////////////////////////////////////////////
 static magma_int_t 
@@ -192,6 +231,22 @@ magma_gradn_3d_ncomp_q_p(
           launch_failed = magma_gradn_3d_ncomp_q<10>
           (Q, ncomp, dinterp1d, dgrad1d, transT, dU, estrdU, cstrdU, dstrdU, dV, estrdV, cstrdV, dstrdV, nelem, maxthreads, queue); 
           break;
+        case 11: 
+          launch_failed = magma_gradn_3d_ncomp_q_high<11>
+          (Q, ncomp, dinterp1d, dgrad1d, transT, dU, estrdU, cstrdU, dstrdU, dV, estrdV, cstrdV, dstrdV, nelem, maxthreads, queue); 
+          break;
+        case 12: 
+          launch_failed = magma_gradn_3d_ncomp_q_high<12>
+          (Q, ncomp, dinterp1d, dgrad1d, transT, dU, estrdU, cstrdU, dstrdU, dV, estrdV, cstrdV, dstrdV, nelem, maxthreads, queue); 
+          break;
+        case 13: 
+          launch_failed = magma_gradn_3d_ncomp_q_high<13>
+          (Q, ncomp, dinterp1d, dgrad1d, transT, dU, estrdU, cstrdU, dstrdU, dV, estrdV, cstrdV, dstrdV, nelem, maxthreads, queue); 
+          break;
+        case 14: 
+          launch_failed = magma_gradn_3d_ncomp_q_high<14>
+          (Q, ncomp, dinterp1d, dgrad1d, transT, dU, estrdU, cstrdU, dstrdU, dV, estrdV, cstrdV, dstrdV, nelem, maxthreads, queue); 
+          break;
         default: launch_failed = 1;
     }
     return launch_failed;
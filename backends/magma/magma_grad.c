@@ -60,7 +60,11 @@ magma_grad(
       default: launch_failed = 1;
       }
     }
-  } else {
+  }
+
+  // Sizes without dimension-specific kernels, or whose kernels exceed the
+  // resources of the device, use the generic kernels
+  if (kernel_mode != MAGMA_KERNEL_DIM_SPECIFIC || launch_failed) {
     launch_failed = magma_grad_generic(
                       P, Q, dim, ncomp,
                       dinterp1d, dgrad1d, tmode,
@@ -41,7 +41,11 @@ magma_interp(
                                               cstrdU, dV, estrdV, cstrdV, nelem, maxthreads[2], queue); break;
     default: launch_failed = 1;
     }
-  } else {
+  }
+
+  // Sizes without dimension-specific kernels, or whose kernels exceed the
+  // resources of the device, use the generic kernels
+  if (kernel_mode != MAGMA_KERNEL_DIM_SPECIFIC || launch_failed) {
     launch_failed = magma_interp_generic(
                       P, Q, dim, ncomp,
                       dT, tmode,
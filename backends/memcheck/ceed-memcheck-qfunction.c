@@ -14,13 +14,103 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
+#define _DEFAULT_SOURCE // MAP_ANONYMOUS
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
 #include "ceed-memcheck.h"
 
 //------------------------------------------------------------------------------
-// QFunction Apply
+// Guarded Allocation
+//   The array ends at a page boundary followed by an inaccessible page, so
+//   reads or writes past the end of a QFunction field fault immediately
 //------------------------------------------------------------------------------
-static int CeedQFunctionApply_Memcheck(CeedQFunction qf, CeedInt Q,
-                                       CeedVector *U, CeedVector *V) {
+static int CeedGuardedAlloc_Memcheck(Ceed ceed, CeedInt len, void **base,
+                                     size_t *size, CeedScalar **array) {
+  const size_t page = sysconf(_SC_PAGESIZE), bytes = len*sizeof(CeedScalar),
+               npages = (bytes + page - 1)/page;
+  *size = (npages + 1)*page;
+  *base = mmap(NULL, *size, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (*base == MAP_FAILED)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Unable to map guarded QFunction field");
+  // LCOV_EXCL_STOP
+  if (mprotect((char *)*base + npages*page, page, PROT_NONE))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Unable to protect guard page");
+  // LCOV_EXCL_STOP
+  *array = (CeedScalar *)((char *)*base + npages*page - bytes);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// QFunction Apply Checked
+//   Inputs are copied to read-only guarded arrays and outputs are poisoned in
+//   guarded arrays, so out of bounds accesses, writes to inputs, and outputs
+//   left unset are caught without Valgrind as well
+//------------------------------------------------------------------------------
+static int CeedQFunctionApplyChecked_Memcheck(CeedQFunction qf, CeedInt Q,
+    CeedQFunctionUser f, void *ctxData, CeedInt nIn, CeedInt nOut,
+    const CeedScalar *const *inputs, CeedScalar *const *outputs) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedQFunctionGetCeed(qf, &ceed); CeedChk(ierr);
+  CeedQFunctionField *qfinputfields, *qfoutputfields;
+  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
+  CeedChk(ierr);
+  const uint64_t poison = CEED_MEMCHECK_POISON;
+  const CeedScalar *in[nIn];
+  CeedScalar *out[nOut], *array;
+  CeedInt len[nIn+nOut], unset = -1, unsetfield = 0;
+  void *base[nIn+nOut];
+  size_t size[nIn+nOut];
+
+  for (CeedInt i=0; i<nIn+nOut; i++) {
+    CeedInt fieldsize;
+    ierr = CeedQFunctionFieldGetSize(i < nIn ? qfinputfields[i] :
+                                     qfoutputfields[i-nIn], &fieldsize);
+    CeedChk(ierr);
+    len[i] = fieldsize*Q;
+    ierr = CeedGuardedAlloc_Memcheck(ceed, len[i], &base[i], &size[i], &array);
+    CeedChk(ierr);
+    if (i < nIn) {
+      memcpy(array, inputs[i], len[i]*sizeof(CeedScalar));
+      mprotect(base[i], size[i] - sysconf(_SC_PAGESIZE), PROT_READ);
+      in[i] = array;
+    } else {
+      for (CeedInt j=0; j<len[i]; j++)
+        memcpy(&array[j], &poison, sizeof(CeedScalar));
+      VALGRIND_MAKE_MEM_UNDEFINED(array, len[i]*sizeof(CeedScalar));
+      out[i-nIn] = array;
+    }
+  }
+
+  ierr = f(ctxData, Q, in, out); CeedChk(ierr);
+
+  for (CeedInt i=0; i<nOut; i++) {
+    for (CeedInt j=0; j<len[nIn+i] && unset < 0; j++)
+      if (!memcmp(&out[i][j], &poison, sizeof(CeedScalar))) {
+        unset = j; unsetfield = i;
+      }
+    memcpy(outputs[i], out[i], len[nIn+i]*sizeof(CeedScalar));
+  }
+  for (CeedInt i=0; i<nIn+nOut; i++)
+    munmap(base[i], size[i]);
+  if (unset >= 0)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "QFunction output %d not set at index %d",
+                     unsetfield, unset);
+  // LCOV_EXCL_STOP
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// QFunction Apply to Raw Arrays
+//------------------------------------------------------------------------------
+static int CeedQFunctionApplyRaw_Memcheck(CeedQFunction qf, CeedInt Q,
+    const CeedScalar *const *U, CeedScalar *const *V) {
   int ierr;
   CeedQFunction_Memcheck *impl;
   ierr = CeedQFunctionGetData(qf, &impl); CeedChk(ierr);
@@ -39,6 +129,37 @@ static int CeedQFunctionApply_Memcheck(CeedQFunction qf, CeedInt Q,
   CeedInt nIn, nOut;
   ierr = CeedQFunctionGetNumArgs(qf, &nIn, &nOut); CeedChk(ierr);
 
+  // Only every sample-th application is checked
+  if (impl->napplies++ % impl->sample == 0) {
+    ierr = CeedQFunctionApplyChecked_Memcheck(qf, Q, f, ctxData, nIn, nOut,
+           U, V); CeedChk(ierr);
+  } else {
+    ierr = f(ctxData, Q, U, V); CeedChk(ierr);
+  }
+
+  if (ctx) {
+    ierr = CeedQFunctionContextRestoreData(ctx, &ctxData); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// QFunction Apply
+//------------------------------------------------------------------------------
+static int CeedQFunctionApply_Memcheck(CeedQFunction qf, CeedInt Q,
+                                       CeedVector *U, CeedVector *V) {
+  int ierr;
+  CeedQFunction_Memcheck *impl;
+  ierr = CeedQFunctionGetData(qf, &impl); CeedChk(ierr);
+
+  CeedInt nIn, nOut;
+  ierr = CeedQFunctionGetNumArgs(qf, &nIn, &nOut); CeedChk(ierr);
+  if (!impl->inputs) {
+    ierr = CeedCalloc(nIn, &impl->inputs); CeedChk(ierr);
+    ierr = CeedCalloc(nOut, &impl->outputs); CeedChk(ierr);
+  }
+
   for (int i = 0; i<nIn; i++) {
     ierr = CeedVectorGetArrayRead(U[i], CEED_MEM_HOST, &impl->inputs[i]);
     CeedChk(ierr);
@@ -46,12 +167,10 @@ static int CeedQFunctionApply_Memcheck(CeedQFunction qf, CeedInt Q,
   for (int i = 0; i<nOut; i++) {
     ierr = CeedVectorGetArray(V[i], CEED_MEM_HOST, &impl->outputs[i]);
     CeedChk(ierr);
-    CeedInt len;
-    ierr = CeedVectorGetLength(V[i], &len); CeedChk(ierr);
-    VALGRIND_MAKE_MEM_UNDEFINED(impl->outputs[i], len);
   }
 
-  ierr = f(ctxData, Q, impl->inputs, impl->outputs); CeedChk(ierr);
+  ierr = CeedQFunctionApplyRaw_Memcheck(qf, Q, impl->inputs, impl->outputs);
+  CeedChk(ierr);
 
   for (int i = 0; i<nIn; i++) {
     ierr = CeedVectorRestoreArrayRead(U[i], &impl->inputs[i]); CeedChk(ierr);
@@ -59,9 +178,6 @@ static int CeedQFunctionApply_Memcheck(CeedQFunction qf, CeedInt Q,
   for (int i = 0; i<nOut; i++) {
     ierr = CeedVectorRestoreArray(V[i], &impl->outputs[i]); CeedChk(ierr);
   }
-  if (ctx) {
-    ierr = CeedQFunctionContextRestoreData(ctx, &ctxData); CeedChk(ierr);
-  }
 
   return 0;
 }
@@ -91,12 +207,19 @@ int CeedQFunctionCreate_Memcheck(CeedQFunction qf) {
 
   CeedQFunction_Memcheck *impl;
   ierr = CeedCalloc(1, &impl); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->inputs); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->outputs); CeedChk(ierr);
+  const char *sample = getenv("CEED_MEMCHECK_SAMPLE");
+  impl->sample = sample ? strtol(sample, NULL, 10) : 1;
+  if (impl->sample < 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Memcheck backend cannot use sample: %s",
+                     sample);
+  // LCOV_EXCL_STOP
   ierr = CeedQFunctionSetData(qf, impl); CeedChk(ierr);
 
   ierr = CeedSetBackendFunction(ceed, "QFunction", qf, "Apply",
                                 CeedQFunctionApply_Memcheck); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "QFunction", qf, "ApplyRaw",
+                                CeedQFunctionApplyRaw_Memcheck); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "QFunction", qf, "Destroy",
                                 CeedQFunctionDestroy_Memcheck); CeedChk(ierr);
 
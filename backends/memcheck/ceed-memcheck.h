@@ -14,14 +14,21 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
+#include <stdint.h>
 #include <string.h>
 #include <ceed-backend.h>
 #include <valgrind/memcheck.h>
 
+// Bit pattern of a signaling NaN written to QFunction outputs before checked
+//   applications to detect outputs that are never set
+#define CEED_MEMCHECK_POISON 0x7ff4dead7ff4deadULL
+
 typedef struct {
   const CeedScalar **inputs;
   CeedScalar **outputs;
   bool setupdone;
+  CeedInt sample;    /// Check every sample-th application
+  CeedInt napplies;  /// Number of applications so far
 } CeedQFunction_Memcheck;
 
 CEED_INTERN int CeedQFunctionCreate_Memcheck(CeedQFunction qf);
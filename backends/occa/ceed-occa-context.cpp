@@ -18,6 +18,38 @@
 
 namespace ceed {
   namespace occa {
+    typedef std::map<std::string, ::occa::kernel> KernelCache;
+
+    static KernelCache& getKernelCache() {
+      static KernelCache kernelCache;
+      return kernelCache;
+    }
+
+    //---[ Kernel Builder ]-------------
+    KernelBuilder::KernelBuilder() {}
+
+    KernelBuilder KernelBuilder::fromString(const std::string &source_,
+                                            const std::string &kernelName_,
+                                            const ::occa::properties &defaultProps_) {
+      KernelBuilder builder;
+      builder.source = source_;
+      builder.kernelName = kernelName_;
+      builder.defaultProps = defaultProps_;
+      // Hash the source once rather than on every build
+      builder.sourceHash = ::occa::hash(source_);
+      return builder;
+    }
+
+    ::occa::kernel KernelBuilder::build(::occa::device device,
+                                        const ::occa::properties &props) {
+      return Context::buildKernel(device,
+                                  sourceHash,
+                                  source,
+                                  kernelName,
+                                  defaultProps + props);
+    }
+
+    //---[ Context ]--------------------
     Context::Context(::occa::device device_) :
         device(device_) {
       const std::string mode = device.mode();
@@ -42,5 +74,41 @@ namespace ceed {
     bool Context::usingGpuDevice() const {
       return _usingGpuDevice;
     }
+
+    //---[ Kernel Cache ]---------------
+    ::occa::kernel Context::buildKernel(::occa::device device,
+                                        const std::string &source,
+                                        const std::string &kernelName,
+                                        const ::occa::properties &props) {
+      return buildKernel(device, ::occa::hash(source), source, kernelName, props);
+    }
+
+    ::occa::kernel Context::buildKernel(::occa::device device,
+                                        const ::occa::hash_t &sourceHash,
+                                        const std::string &source,
+                                        const std::string &kernelName,
+                                        const ::occa::properties &props) {
+      const std::string key = (
+        (device.hash() ^ sourceHash ^ props.hash()).getFullString()
+        + ":" + kernelName
+      );
+
+      KernelCache &kernelCache = getKernelCache();
+      KernelCache::iterator it = kernelCache.find(key);
+      // Kernels freed along with their device are rebuilt
+      if (it != kernelCache.end() && it->second.isInitialized()) {
+        return it->second;
+      }
+
+      ::occa::kernel kernel = device.buildKernelFromString(source,
+                                                           kernelName,
+                                                           props);
+      kernelCache[key] = kernel;
+      return kernel;
+    }
+
+    void Context::clearKernelCache() {
+      getKernelCache().clear();
+    }
   }
 }
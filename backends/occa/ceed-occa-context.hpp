@@ -17,10 +17,34 @@
 #ifndef CEED_OCCA_CONTEXT_HEADER
 #define CEED_OCCA_CONTEXT_HEADER
 
+#include <map>
+#include <string>
+
 #include "ceed-occa-types.hpp"
 
 namespace ceed {
   namespace occa {
+    // Drop-in for ::occa::kernelBuilder whose kernels come from the
+    //   process-wide cache in Context, so objects with identical signatures
+    //   share one kernel instead of each building their own
+    class KernelBuilder {
+     private:
+      std::string source;
+      std::string kernelName;
+      ::occa::properties defaultProps;
+      ::occa::hash_t sourceHash;
+
+     public:
+      KernelBuilder();
+
+      static KernelBuilder fromString(const std::string &source_,
+                                      const std::string &kernelName_,
+                                      const ::occa::properties &defaultProps_);
+
+      ::occa::kernel build(::occa::device device,
+                           const ::occa::properties &props = ::occa::properties());
+    };
+
     class Context {
      private:
       bool _usingCpuDevice;
@@ -35,6 +59,23 @@ namespace ceed {
 
       bool usingCpuDevice() const;
       bool usingGpuDevice() const;
+
+      //---[ Kernel Cache ]-------------
+      // Kernels are shared across all ceed::occa objects and Ceed contexts,
+      //   keyed by device, source, kernel name, and properties; compiled
+      //   binaries are still persisted in OCCA's cache directory
+      static ::occa::kernel buildKernel(::occa::device device,
+                                        const std::string &source,
+                                        const std::string &kernelName,
+                                        const ::occa::properties &props);
+
+      static ::occa::kernel buildKernel(::occa::device device,
+                                        const ::occa::hash_t &sourceHash,
+                                        const std::string &source,
+                                        const std::string &kernelName,
+                                        const ::occa::properties &props);
+
+      static void clearKernelCache();
     };
   }
 }
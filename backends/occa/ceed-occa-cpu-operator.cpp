@@ -241,10 +241,10 @@ namespace ceed {
 
       CeedDebug(kernelSource.c_str());
 
-      // TODO: Store a kernel per Q
-      return getDevice().buildKernelFromString(kernelSource,
-                                               "applyAdd",
-                                               getKernelProps());
+      return Context::buildKernel(getDevice(),
+                                  kernelSource,
+                                  "applyAdd",
+                                  getKernelProps());
     }
 
     //---[ Kernel Generation ]--------------------
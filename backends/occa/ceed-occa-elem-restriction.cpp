@@ -185,11 +185,11 @@ namespace ceed {
       kernelProps["defines/TILE_SIZE"]       = 64;
       kernelProps["defines/USES_INDICES"]    = usesIndices();
 
-      applyKernelBuilder = ::occa::kernelBuilder::fromString(
+      applyKernelBuilder = KernelBuilder::fromString(
         occa_elem_restriction_source, "applyRestriction", kernelProps
       );
 
-      applyTransposeKernelBuilder = ::occa::kernelBuilder::fromString(
+      applyTransposeKernelBuilder = KernelBuilder::fromString(
         occa_elem_restriction_source, "applyRestrictionTranspose", kernelProps
       );
     }
@@ -337,6 +337,8 @@ namespace ceed {
           *offsets = memoryToArray<CeedInt>(indices);
           return 0;
         }
+        case CEED_MEM_UNIFIED:
+          break;
       }
       return ceedError("Unsupported CeedMemType passed to ElemRestriction::getOffsets");
     }
@@ -359,6 +361,12 @@ namespace ceed {
         return staticCeedError("Only HOST and DEVICE CeedMemType supported");
       }
 
+      CeedInt nsides;
+      ierr = CeedElemRestrictionGetNumSides(r, &nsides); CeedChk(ierr);
+      if (nsides > 1) {
+        return staticCeedError("Two-sided restrictions not supported");
+      }
+
       ElemRestriction *elemRestriction = new ElemRestriction();
       ierr = CeedElemRestrictionSetData(r, elemRestriction); CeedChk(ierr);
 
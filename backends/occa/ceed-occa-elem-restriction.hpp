@@ -54,8 +54,8 @@ namespace ceed {
       ::occa::memory transposeDofOffsets;
       ::occa::memory transposeDofIndices;
 
-      ::occa::kernelBuilder applyKernelBuilder;
-      ::occa::kernelBuilder applyTransposeKernelBuilder;
+      KernelBuilder applyKernelBuilder;
+      KernelBuilder applyTransposeKernelBuilder;
 
       ElemRestriction();
 
@@ -14,8 +14,12 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
+#include "ceed-occa-elem-restriction.hpp"
 #include "ceed-occa-gpu-operator.hpp"
 #include "ceed-occa-qfunction.hpp"
+#include "ceed-occa-qfunctioncontext.hpp"
+#include "ceed-occa-simplex-basis.hpp"
+#include "ceed-occa-tensor-basis.hpp"
 
 
 namespace ceed {
@@ -25,11 +29,307 @@ namespace ceed {
     GpuOperator::~GpuOperator() {}
 
     ::occa::kernel GpuOperator::buildApplyAddKernel() {
-      return ::occa::kernel();
+      std::stringstream ss;
+
+      addBasisFunctionSource(ss);
+
+      addFusedKernelSource(ss);
+
+      const std::string kernelSource = ss.str();
+
+      CeedDebug(kernelSource.c_str());
+
+      return Context::buildKernel(getDevice(),
+                                  kernelSource,
+                                  "applyAdd",
+                                  getKernelProps());
     }
 
     void GpuOperator::applyAdd(Vector *in, Vector *out) {
-      // TODO: Implement
+      if (qfunction->qFunctionContext) {
+        QFunctionContext *ctx = QFunctionContext::from(qfunction->qFunctionContext);
+        applyAddKernel.pushArg(ctx->getKernelArg());
+      } else {
+        applyAddKernel.pushArg(::occa::null);
+      }
+      applyAddKernel.pushArg(ceedElementCount);
+
+      for (int i = 0; i < args.inputCount(); ++i) {
+        const OperatorField &opField = args.getOpInput(i);
+        pushFieldKernelArgs(opField.usesActiveVector() ? in : opField.vec,
+                            true, i);
+      }
+      for (int i = 0; i < args.outputCount(); ++i) {
+        const OperatorField &opField = args.getOpOutput(i);
+        pushFieldKernelArgs(opField.usesActiveVector() ? out : opField.vec,
+                            false, i);
+      }
+
+      applyAddKernel.run();
+    }
+
+    void GpuOperator::pushFieldKernelArgs(Vector *lVector,
+                                          const bool isInput,
+                                          const int index) {
+      const OperatorField &opField = args.getOpField(isInput, index);
+      const QFunctionField &qfField = args.getQfField(isInput, index);
+
+      if (opField.hasBasis()) {
+        if (opField.usingTensorBasis()) {
+          pushTensorBasisKernelArgs(qfField,
+                                    *((TensorBasis*) opField.basis));
+        } else {
+          pushSimplexBasisKernelArgs(qfField,
+                                     *((SimplexBasis*) opField.basis));
+        }
+      }
+
+      // Weight fields have no restriction or L-vector
+      if (qfField.evalMode == CEED_EVAL_WEIGHT) {
+        return;
+      }
+
+      ElemRestriction &elemRestriction = *(opField.elemRestriction);
+      if (elemRestriction.usesIndices()) {
+        applyAddKernel.pushArg(elemRestriction.indices);
+      }
+
+      if (isInput) {
+        applyAddKernel.pushArg(lVector->getConstKernelArg());
+      } else {
+        applyAddKernel.pushArg(lVector->getKernelArg());
+      }
+    }
+
+    //---[ Kernel Generation ]--------------------
+    void GpuOperator::addFusedKernelSource(std::stringstream &ss) {
+      // Make sure there's a break between past code
+      ss << std::endl;
+
+      ss << "@kernel void applyAdd(" << std::endl
+         << "  void *ctx," << std::endl
+         << "  const CeedInt elementCount";
+
+      for (int i = 0; i < args.inputCount(); ++i) {
+        addFieldKernelArgSource(ss, true, i);
+      }
+      for (int i = 0; i < args.outputCount(); ++i) {
+        addFieldKernelArgSource(ss, false, i);
+      }
+
+      ss <<                                                                   std::endl
+         << ") {"                                                          << std::endl
+         << "  @tile(128, @outer, @inner)"                                 << std::endl
+         << "  for (int element = 0; element < elementCount; ++element) {" << std::endl;
+
+      addElementArraySource(ss);
+
+      addQuadArraySource(ss);
+
+      ss  << std::endl
+          << "    // [Start] Gathering inputs and transforming to quadrature points" << std::endl;
+      for (int i = 0; i < args.inputCount(); ++i) {
+        if (args.getInputEvalMode(i) == CEED_EVAL_WEIGHT) {
+          addWeightSource(ss, true, i);
+        } else {
+          addGatherSource(ss, i);
+          addFusedBasisApplySource(ss, true, i);
+        }
+      }
+      ss << "    // [End] Gathering inputs and transforming to quadrature points" << std::endl
+         << std::endl;
+
+      addQFunctionApplicationSource(ss);
+
+      ss  << std::endl
+          << "    // [Start] Transforming outputs and scattering" << std::endl;
+      for (int i = 0; i < args.outputCount(); ++i) {
+        addFusedBasisApplySource(ss, false, i);
+        addScatterSource(ss, i);
+      }
+      ss << "    // [End] Transforming outputs and scattering" << std::endl;
+
+      ss << "  }" << std::endl
+         << "}"   << std::endl;
+    }
+
+    void GpuOperator::addFieldKernelArgSource(std::stringstream &ss,
+                                              const bool isInput,
+                                              const int index) {
+      const OperatorField &opField = args.getOpField(isInput, index);
+      const QFunctionField &qfField = args.getQfField(isInput, index);
+
+      // Basis arguments match the unfused kernel; L-vectors carry no @dim
+      std::stringstream dimAttribute;
+      if (opField.hasBasis()) {
+        ss << ',' << std::endl;
+        if (opField.usingTensorBasis()) {
+          addTensorKernelArgSource(ss, isInput, index, opField, qfField, dimAttribute);
+        } else {
+          addSimplexKernelArgSource(ss, isInput, index, opField, qfField, dimAttribute);
+        }
+      }
+
+      if (qfField.evalMode == CEED_EVAL_WEIGHT) {
+        return;
+      }
+
+      if (opField.elemRestriction->usesIndices()) {
+        ss << ',' << std::endl
+           << "  const CeedInt *" << indicesVar(isInput, index);
+      }
+
+      ss << ',' << std::endl;
+      if (isInput) {
+        ss << "  const CeedScalar *" << lVectorVar(isInput, index);
+      } else {
+        ss << "  CeedScalar *" << lVectorVar(isInput, index);
+      }
+    }
+
+    void GpuOperator::addElementArraySource(std::stringstream &ss) {
+      // Output:
+      //   CeedScalar input0_dofs[ELEMENT_SIZE * COMPONENTS];
+
+      ss << "    // Store the gathered and transformed element dofs" << std::endl;
+      for (int isInput = 1; isInput >= 0; --isInput) {
+        const int count = isInput ? args.inputCount() : args.outputCount();
+        for (int i = 0; i < count; ++i) {
+          const CeedEvalMode evalMode = args.getEvalMode(isInput, i);
+          if (evalMode != CEED_EVAL_INTERP && evalMode != CEED_EVAL_GRAD) {
+            // CEED_EVAL_NONE fields gather directly into quadrature arrays
+            continue;
+          }
+          const OperatorField &opField = args.getOpField(isInput, i);
+          ss << "    CeedScalar " << elementDofsVar(isInput, i)
+             << "[" << opField.getElementSize() * opField.getComponentCount() << "];"
+             << std::endl;
+        }
+      }
+      ss << std::endl;
+    }
+
+    std::string GpuOperator::lVectorIndexSource(const bool isInput,
+                                                const int index) {
+      const ElemRestriction &elemRestriction = *(args.getOpField(isInput, index).elemRestriction);
+      const std::string elementSize = std::to_string(elemRestriction.ceedElementSize);
+
+      if (elemRestriction.indices.isInitialized()) {
+        return (
+          indicesVar(isInput, index) + "[node + (element * " + elementSize + ")]"
+          + " + (component * " + std::to_string(elemRestriction.ceedUnstridedComponentStride) + ")"
+        );
+      }
+      return (
+        "(node * " + std::to_string(elemRestriction.ceedNodeStride) + ")"
+        + " + (component * " + std::to_string(elemRestriction.ceedComponentStride) + ")"
+        + " + (element * " + std::to_string(elemRestriction.ceedElementStride) + ")"
+      );
+    }
+
+    void GpuOperator::addGatherSource(std::stringstream &ss,
+                                      const int index) {
+      const bool isInput = true;
+      const ElemRestriction &elemRestriction = *(args.getOpInput(index).elemRestriction);
+      const int elementSize = elemRestriction.ceedElementSize;
+      const int components = elemRestriction.ceedComponentCount;
+
+      // CEED_EVAL_NONE restrictions have one node per quadrature point
+      const std::string dofs = (
+        args.getInputEvalMode(index) == CEED_EVAL_NONE
+        ? quadVar(isInput, index)
+        : elementDofsVar(isInput, index)
+      );
+
+      ss << "    // Gathering element dofs (input: " << index << ")"                      << std::endl
+         << "    for (int component = 0; component < " << components << "; ++component) {" << std::endl
+         << "      for (int node = 0; node < " << elementSize << "; ++node) {"             << std::endl
+         << "        " << dofs << "[node + (component * " << elementSize << ")] = "
+         << lVectorVar(isInput, index) << "[" << lVectorIndexSource(isInput, index) << "];" << std::endl
+         << "      }"                                                                       << std::endl
+         << "    }"                                                                         << std::endl
+         <<                                                                                    std::endl;
+    }
+
+    void GpuOperator::addScatterSource(std::stringstream &ss,
+                                       const int index) {
+      const bool isInput = false;
+      const ElemRestriction &elemRestriction = *(args.getOpOutput(index).elemRestriction);
+      const int elementSize = elemRestriction.ceedElementSize;
+      const int components = elemRestriction.ceedComponentCount;
+
+      const std::string dofs = (
+        args.getOutputEvalMode(index) == CEED_EVAL_NONE
+        ? quadVar(isInput, index)
+        : elementDofsVar(isInput, index)
+      );
+
+      // Elements only share L-vector entries through restriction indices
+      const std::string atomic = (
+        elemRestriction.indices.isInitialized()
+        ? "@atomic "
+        : ""
+      );
+
+      ss << "    // Scattering element dofs (output: " << index << ")"                    << std::endl
+         << "    for (int component = 0; component < " << components << "; ++component) {" << std::endl
+         << "      for (int node = 0; node < " << elementSize << "; ++node) {"             << std::endl
+         << "        " << atomic << lVectorVar(isInput, index)
+         << "[" << lVectorIndexSource(isInput, index) << "] += "
+         << dofs << "[node + (component * " << elementSize << ")];"                       << std::endl
+         << "      }"                                                                       << std::endl
+         << "    }"                                                                         << std::endl
+         <<                                                                                    std::endl;
+    }
+
+    void GpuOperator::addFusedBasisApplySource(std::stringstream &ss,
+                                               const bool isInput,
+                                               const int index) {
+      const CeedEvalMode evalMode = args.getEvalMode(isInput, index);
+      if (evalMode != CEED_EVAL_INTERP && evalMode != CEED_EVAL_GRAD) {
+        return;
+      }
+
+      const OperatorField &opField = args.getOpField(isInput, index);
+      const bool usingTensorBasis = opField.usingTensorBasis();
+      const int components = opField.getComponentCount();
+      const int dim = opField.getDim();
+
+      const std::string dofs = (
+        "&" + elementDofsVar(isInput, index)
+        + "[component * " + std::to_string(opField.getElementSize()) + "]"
+      );
+
+      std::string weights, quads;
+      if (evalMode == CEED_EVAL_INTERP) {
+        weights = interpVar(isInput, index);
+        quads = "(CeedScalar*) " + quadVar(isInput, index) + "[component]";
+      } else if (usingTensorBasis) {
+        weights = interpVar(isInput, index) + ",\n        " + gradVar(isInput, index);
+        for (int i = 0; i < dim; ++i) {
+          if (i) {
+            quads += ",\n        ";
+          }
+          quads += "(CeedScalar*) " + quadVar(isInput, index) + "[" + std::to_string(i) + "][component]";
+        }
+      } else {
+        weights = gradVar(isInput, index);
+        quads = "(CeedScalar*) " + quadVar(isInput, index) + "[component]";
+      }
+
+      const std::string &input  = isInput ? dofs  : quads;
+      const std::string &output = isInput ? quads : dofs;
+
+      ss << "    // Applying " << fieldFunctionName(args.getQfField(isInput, index))
+         << " (" << xputName(isInput) << ": " << index << ")"                                 << std::endl
+         << "    for (int component = 0; component < " << components << "; ++component) {" << std::endl
+         << "      " << elementFunction(isInput, index) << "("                             << std::endl
+         << "        " << weights << ','                                                   << std::endl
+         << "        " << input   << ','                                                   << std::endl
+         << "        " << output                                                           << std::endl
+         << "      );"                                                                     << std::endl
+         << "    }"                                                                        << std::endl
+         <<                                                                                   std::endl;
     }
   }
 }
@@ -17,14 +17,18 @@
 #ifndef CEED_OCCA_GPU_OPERATOR_HEADER
 #define CEED_OCCA_GPU_OPERATOR_HEADER
 
-#include <vector>
+#include <sstream>
 
-#include "ceed-occa-operator.hpp"
+#include "ceed-occa-cpu-operator.hpp"
 
 
 namespace ceed {
   namespace occa {
-    class GpuOperator : public Operator {
+    // Fuses the element restriction, basis, and QFunction of each element into
+    //   one kernel: element dofs are gathered from the L-vectors into thread
+    //   local arrays, and outputs are scattered back with atomic additions, so
+    //   no E-vectors are allocated or written to device memory.
+    class GpuOperator : public CpuOperator {
      public:
       GpuOperator();
 
@@ -33,6 +37,54 @@ namespace ceed {
       ::occa::kernel buildApplyAddKernel();
 
       void applyAdd(Vector *in, Vector *out);
+
+      // Push arguments for a given field
+      void pushFieldKernelArgs(Vector *lVector,
+                               const bool isInput,
+                               const int index);
+
+      //---[ Kernel Generation ]------------------
+      void addFusedKernelSource(std::stringstream &ss);
+
+      void addFieldKernelArgSource(std::stringstream &ss,
+                                   const bool isInput,
+                                   const int index);
+
+      void addElementArraySource(std::stringstream &ss);
+
+      void addGatherSource(std::stringstream &ss,
+                           const int index);
+
+      void addScatterSource(std::stringstream &ss,
+                            const int index);
+
+      void addFusedBasisApplySource(std::stringstream &ss,
+                                    const bool isInput,
+                                    const int index);
+
+      std::string lVectorIndexSource(const bool isInput,
+                                     const int index);
+
+      //  ---[ Variables ]---------------
+      inline std::string lVectorVar(const bool isInput,
+                                    const int index) {
+        return indexedVar("lVector", isInput, index);
+      }
+
+      inline std::string indicesVar(const bool isInput,
+                                    const int index) {
+        return indexedVar("indices", isInput, index);
+      }
+
+      inline std::string elementDofsVar(const bool isInput,
+                                        const int index) {
+        return indexedVar("dofs", isInput, index);
+      }
+
+      inline std::string quadVar(const bool isInput,
+                                 const int index) {
+        return indexedVar(isInput ? "quadInput" : "quadOutput", index);
+      }
     };
   }
 }
@@ -64,7 +64,7 @@ namespace ceed {
     }
 
     int Operator::applyAdd(Vector *in, Vector *out, CeedRequest *request) {
-      // TODO: Cache kernel objects rather than relying on OCCA kernel caching
+      // Operators with the same generated source share a cached kernel
       applyAddKernel = buildApplyAddKernel();
 
       if (needsInitialSetup) {
@@ -91,16 +91,11 @@ namespace ceed {
       Ceed ceed;
       ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
 
-#if 1
-      Operator *operator_ = new CpuOperator();
-#else
-      // TODO: Add GPU specific operator
       Operator *operator_ = (
         Context::from(ceed)->usingCpuDevice()
         ? ((Operator*) new CpuOperator())
         : ((Operator*) new GpuOperator())
       );
-#endif
 
       ierr = CeedOperatorSetData(op, operator_); CeedChk(ierr);
 
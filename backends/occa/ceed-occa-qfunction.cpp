@@ -88,6 +88,22 @@ namespace ceed {
       ss << "#define CEED_QFUNCTION(FUNC_NAME) \\" << std::endl
          << "  inline int FUNC_NAME"               << std::endl
          <<                                           std::endl
+         << "#define CEED_CHUNK_WIDTH 1"           << std::endl
+         << "#define CEED_QFUNCTION_CHUNK(name) \\" << std::endl
+         << "  inline int name ## _chunk(void *, CeedInt, CeedInt, CeedInt, \\" << std::endl
+         << "    const CeedScalar *const *, CeedScalar *const *); \\" << std::endl
+         << "  inline int name(void *ctx, const CeedInt Q, \\" << std::endl
+         << "    const CeedScalar *const *in, CeedScalar *const *out) { \\" << std::endl
+         << "    for (CeedInt i = 0; i < Q; i++) { \\" << std::endl
+         << "      int ierr = name ## _chunk(ctx, Q, i, 1, in, out); \\" << std::endl
+         << "      if (ierr) return ierr; \\" << std::endl
+         << "    } \\" << std::endl
+         << "    return 0; \\" << std::endl
+         << "  } \\" << std::endl
+         << "  inline int name ## _chunk"      << std::endl
+         << "#define CeedForLanes(j, nlanes) \\" << std::endl
+         << "  for (CeedInt j = 0; j < 1; j++)" << std::endl
+         <<                                           std::endl
          << "#include \"" << filename << "\""      << std::endl;
 
       props["headers"].asArray() += ss.str();
@@ -106,9 +122,10 @@ namespace ceed {
         const std::string kernelName = "qFunctionKernel";
 
         qFunctionKernel = (
-          getDevice().buildKernelFromString(getKernelSource(kernelName, Q),
-                                            kernelName,
-                                            props)
+          Context::buildKernel(getDevice(),
+                               getKernelSource(kernelName, Q),
+                               kernelName,
+                               props)
         );
       }
 
@@ -115,6 +115,8 @@ namespace ceed {
           currentMemory.copyFrom(dataToMemory(data));
           syncState = SyncState::device;
           return 0;
+        case CEED_MEM_UNIFIED:
+          break;
       }
       return ceedError("Invalid CeedMemType passed");
     }
@@ -131,6 +133,8 @@ namespace ceed {
           memory = currentMemory = dataToMemory(data);
           syncState = SyncState::device;
           return 0;
+        case CEED_MEM_UNIFIED:
+          break;
       }
       return ceedError("Invalid CeedMemType passed");
     }
@@ -147,6 +151,8 @@ namespace ceed {
           currentMemory = dataToMemory(data);
           syncState = SyncState::device;
           return 0;
+        case CEED_MEM_UNIFIED:
+          break;
       }
       return ceedError("Invalid CeedMemType passed");
     }
@@ -173,6 +179,8 @@ namespace ceed {
           syncState = SyncState::device;
           *(void **)data = memoryToData(currentMemory);
           return 0;
+        case CEED_MEM_UNIFIED:
+          break;
       }
       return ceedError("Invalid CeedMemType passed");
     }
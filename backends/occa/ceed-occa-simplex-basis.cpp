@@ -72,13 +72,13 @@ namespace ceed {
       kernelProps["defines/MAX_PQ"] = P > Q ? P : Q;
       kernelProps["defines/BASIS_COMPONENT_COUNT"] = ceedComponentCount;
 
-      interpKernelBuilder = ::occa::kernelBuilder::fromString(
+      interpKernelBuilder = KernelBuilder::fromString(
         kernelSource, "interp", kernelProps
       );
-      gradKernelBuilder = ::occa::kernelBuilder::fromString(
+      gradKernelBuilder = KernelBuilder::fromString(
         kernelSource, "grad"  , kernelProps
       );
-      weightKernelBuilder = ::occa::kernelBuilder::fromString(
+      weightKernelBuilder = KernelBuilder::fromString(
         kernelSource, "weight", kernelProps
       );
     }
@@ -162,7 +162,7 @@ namespace ceed {
                                 false);
     }
 
-    ::occa::kernel SimplexBasis::buildCpuEvalKernel(::occa::kernelBuilder &kernelBuilder,
+    ::occa::kernel SimplexBasis::buildCpuEvalKernel(KernelBuilder &kernelBuilder,
                                                     const bool transpose) {
       ::occa::properties kernelProps;
       kernelProps["defines/TRANSPOSE"] = transpose;
@@ -170,7 +170,7 @@ namespace ceed {
       return kernelBuilder.build(getDevice(), kernelProps);
     }
 
-    ::occa::kernel SimplexBasis::buildGpuEvalKernel(::occa::kernelBuilder &kernelBuilder,
+    ::occa::kernel SimplexBasis::buildGpuEvalKernel(KernelBuilder &kernelBuilder,
                                                     const bool transpose) {
       ::occa::properties kernelProps;
       kernelProps["defines/TRANSPOSE"]          = transpose;
@@ -27,9 +27,9 @@ namespace ceed {
       ::occa::memory interp;
       ::occa::memory grad;
       ::occa::memory qWeight;
-      ::occa::kernelBuilder interpKernelBuilder;
-      ::occa::kernelBuilder gradKernelBuilder;
-      ::occa::kernelBuilder weightKernelBuilder;
+      KernelBuilder interpKernelBuilder;
+      KernelBuilder gradKernelBuilder;
+      KernelBuilder weightKernelBuilder;
 
       SimplexBasis(CeedBasis basis,
                    CeedInt dim,
@@ -69,10 +69,10 @@ namespace ceed {
       ::occa::kernel getCpuWeightKernel();
       ::occa::kernel getGpuWeightKernel();
 
-      ::occa::kernel buildCpuEvalKernel(::occa::kernelBuilder &kernelBuilder,
+      ::occa::kernel buildCpuEvalKernel(KernelBuilder &kernelBuilder,
                                         const bool transpose);
 
-      ::occa::kernel buildGpuEvalKernel(::occa::kernelBuilder &kernelBuilder,
+      ::occa::kernel buildGpuEvalKernel(KernelBuilder &kernelBuilder,
                                         const bool transpose);
 
       int apply(const CeedInt elementCount,
@@ -97,13 +97,13 @@ namespace ceed {
       kernelProps["defines/P1D"] = P1D;
       kernelProps["defines/BASIS_COMPONENT_COUNT"] = ceedComponentCount;
 
-      interpKernelBuilder = ::occa::kernelBuilder::fromString(
+      interpKernelBuilder = KernelBuilder::fromString(
         kernelSource, "interp", kernelProps
       );
-      gradKernelBuilder = ::occa::kernelBuilder::fromString(
+      gradKernelBuilder = KernelBuilder::fromString(
         kernelSource, "grad"  , kernelProps
       );
-      weightKernelBuilder = ::occa::kernelBuilder::fromString(
+      weightKernelBuilder = KernelBuilder::fromString(
         kernelSource, "weight", kernelProps
       );
     }
@@ -231,7 +231,7 @@ namespace ceed {
                                 elementsPerBlock);
     }
 
-    ::occa::kernel TensorBasis::buildCpuEvalKernel(::occa::kernelBuilder &kernelBuilder,
+    ::occa::kernel TensorBasis::buildCpuEvalKernel(KernelBuilder &kernelBuilder,
                                                    const bool transpose) {
       ::occa::properties kernelProps;
       kernelProps["defines/TRANSPOSE"] = transpose;
@@ -239,7 +239,7 @@ namespace ceed {
       return kernelBuilder.build(getDevice(), kernelProps);
     }
 
-    ::occa::kernel TensorBasis::buildGpuEvalKernel(::occa::kernelBuilder &kernelBuilder,
+    ::occa::kernel TensorBasis::buildGpuEvalKernel(KernelBuilder &kernelBuilder,
                                                    const bool transpose,
                                                    const int elementsPerBlock) {
 
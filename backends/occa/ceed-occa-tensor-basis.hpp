@@ -29,9 +29,9 @@ namespace ceed {
       ::occa::memory interp1D;
       ::occa::memory grad1D;
       ::occa::memory qWeight1D;
-      ::occa::kernelBuilder interpKernelBuilder;
-      ::occa::kernelBuilder gradKernelBuilder;
-      ::occa::kernelBuilder weightKernelBuilder;
+      KernelBuilder interpKernelBuilder;
+      KernelBuilder gradKernelBuilder;
+      KernelBuilder weightKernelBuilder;
 
       TensorBasis(CeedBasis basis,
                   CeedInt dim_,
@@ -71,10 +71,10 @@ namespace ceed {
       ::occa::kernel getCpuWeightKernel();
       ::occa::kernel getGpuWeightKernel();
 
-      ::occa::kernel buildCpuEvalKernel(::occa::kernelBuilder &kernelBuilder,
+      ::occa::kernel buildCpuEvalKernel(KernelBuilder &kernelBuilder,
                                         const bool transpose);
 
-      ::occa::kernel buildGpuEvalKernel(::occa::kernelBuilder &kernelBuilder,
+      ::occa::kernel buildGpuEvalKernel(KernelBuilder &kernelBuilder,
                                         const bool transpose,
                                         const int elementsPerBlock);
 
@@ -147,6 +147,8 @@ namespace ceed {
 
           syncState = SyncState::device;
           return 0;
+        case CEED_MEM_UNIFIED:
+          break;
       }
       return ceedError("Invalid CeedMemType passed");
     }
@@ -167,6 +169,8 @@ namespace ceed {
           }
           syncState = SyncState::device;
           return 0;
+        case CEED_MEM_UNIFIED:
+          break;
       }
       return ceedError("Invalid CeedMemType passed");
     }
@@ -183,6 +187,8 @@ namespace ceed {
           memory = currentMemory = arrayToMemory(array);
           syncState = SyncState::device;
           return 0;
+        case CEED_MEM_UNIFIED:
+          break;
       }
       return ceedError("Invalid CeedMemType passed");
     }
@@ -199,6 +205,8 @@ namespace ceed {
           currentMemory = arrayToMemory(array);
           syncState = SyncState::device;
           return 0;
+        case CEED_MEM_UNIFIED:
+          break;
       }
       return ceedError("Invalid CeedMemType passed");
     }
@@ -226,6 +234,8 @@ namespace ceed {
           syncState = SyncState::device;
           *array = memoryToArray<CeedScalar>(currentMemory);
           return 0;
+        case CEED_MEM_UNIFIED:
+          break;
       }
       return ceedError("Invalid CeedMemType passed");
     }
@@ -0,0 +1,1096 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <omp.h>
+#include <string.h>
+#include "ceed-omp.h"
+
+//------------------------------------------------------------------------------
+// Setup Input/Output Fields
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupFields_Omp(CeedQFunction qf, CeedOperator op,
+                                       bool inOrOut, const CeedInt blksize,
+                                       CeedOperator_Omp *impl, CeedInt starte,
+                                       CeedInt numfields, CeedInt Q) {
+  CeedInt dim, ierr, ncomp, size, P, lsize = 0;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedBasis basis;
+  CeedElemRestriction r;
+  CeedVector vec;
+  CeedOperatorField *opfields;
+  CeedQFunctionField *qffields;
+  if (inOrOut) {
+    ierr = CeedOperatorGetFields(op, NULL, &opfields);
+    CeedChk(ierr);
+    ierr = CeedQFunctionGetFields(qf, NULL, &qffields);
+    CeedChk(ierr);
+  } else {
+    ierr = CeedOperatorGetFields(op, &opfields, NULL);
+    CeedChk(ierr);
+    ierr = CeedQFunctionGetFields(qf, &qffields, NULL);
+    CeedChk(ierr);
+  }
+
+  // Loop over fields
+  for (CeedInt i=0; i<numfields; i++) {
+    CeedEvalMode emode;
+    ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode); CeedChk(ierr);
+    ierr = CeedOperatorFieldGetVector(opfields[i], &vec); CeedChk(ierr);
+
+    if (emode != CEED_EVAL_WEIGHT) {
+      ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &r);
+      CeedChk(ierr);
+      Ceed ceed;
+      ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
+      CeedInt nelem, elemsize, compstride;
+      ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
+      ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+      ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
+      ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
+
+      bool strided, compressed;
+      CeedInt nsides;
+      ierr = CeedElemRestrictionIsStrided(r, &strided); CeedChk(ierr);
+      ierr = CeedElemRestrictionIsCompressed(r, &compressed); CeedChk(ierr);
+      ierr = CeedElemRestrictionGetNumSides(r, &nsides); CeedChk(ierr);
+      if (strided) {
+        CeedInt strides[3];
+        ierr = CeedElemRestrictionGetStrides(r, &strides); CeedChk(ierr);
+        ierr = CeedElemRestrictionCreateBlockedStrided(ceed, nelem, elemsize,
+               blksize, ncomp, lsize, strides, &impl->blkrestr[i+starte]);
+        CeedChk(ierr);
+      } else if (compressed) {
+        const CeedInt *eoffsets, *stencil;
+        ierr = CeedElemRestrictionGetCompressedOffsets(r, &eoffsets, &stencil);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
+        ierr = CeedElemRestrictionCreateBlockedCompressed(ceed, nelem, elemsize,
+               blksize, ncomp, compstride, lsize, eoffsets, stencil,
+               &impl->blkrestr[i+starte]);
+        CeedChk(ierr);
+      } else if (nsides > 1) {
+        const CeedInt *offsets = NULL;
+        ierr = CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
+        ierr = CeedElemRestrictionCreateBlockedTwoSided(ceed, nelem, elemsize,
+               blksize, ncomp/nsides, compstride, lsize, CEED_MEM_HOST,
+               CEED_COPY_VALUES, offsets, &impl->blkrestr[i+starte]);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionRestoreOffsets(r, &offsets); CeedChk(ierr);
+      } else {
+        const CeedInt *offsets = NULL;
+        ierr = CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
+        ierr = CeedElemRestrictionCreateBlocked(ceed, nelem, elemsize,
+                                                blksize, ncomp, compstride,
+                                                lsize, CEED_MEM_HOST,
+                                                CEED_COPY_VALUES, offsets,
+                                                &impl->blkrestr[i+starte]);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionRestoreOffsets(r, &offsets); CeedChk(ierr);
+        // Compact offsets carry over when they fit the padded blocks
+        CeedIndexType itype;
+        bool fits;
+        ierr = CeedElemRestrictionGetIndexType(r, &itype); CeedChk(ierr);
+        ierr = CeedElemRestrictionCheckIndexType(impl->blkrestr[i+starte],
+                                                 itype, &fits); CeedChk(ierr);
+        if (itype != CEED_INDEX_INT32 && fits) {
+          ierr = CeedElemRestrictionSetIndexType(impl->blkrestr[i+starte],
+                                                 itype); CeedChk(ierr);
+        }
+      }
+      // Passive inputs are restricted once, outside of the threaded loop
+      if (!inOrOut && vec != CEED_VECTOR_ACTIVE) {
+        ierr = CeedElemRestrictionCreateVector(impl->blkrestr[i+starte], NULL,
+                                               &impl->evecs[i+starte]);
+        CeedChk(ierr);
+      }
+    }
+
+    // Per-thread workspaces
+    for (CeedInt t=0; t<impl->nthreads; t++) {
+      CeedOperatorThread_Omp *thread = &impl->threads[t];
+      CeedVector *evecs = inOrOut ? thread->evecsout : thread->evecsin;
+      CeedVector *qvecs = inOrOut ? thread->qvecsout : thread->qvecsin;
+
+      switch(emode) {
+      case CEED_EVAL_NONE:
+        ierr = CeedQFunctionFieldGetSize(qffields[i], &size); CeedChk(ierr);
+        ierr = CeedVectorCreate(ceed, Q*size*blksize, &evecs[i]); CeedChk(ierr);
+        ierr = CeedVectorCreate(ceed, Q*size*blksize, &qvecs[i]); CeedChk(ierr);
+        break;
+      case CEED_EVAL_INTERP:
+        ierr = CeedQFunctionFieldGetSize(qffields[i], &size); CeedChk(ierr);
+        ierr = CeedElemRestrictionGetElementSize(r, &P);
+        CeedChk(ierr);
+        ierr = CeedVectorCreate(ceed, P*size*blksize, &evecs[i]); CeedChk(ierr);
+        ierr = CeedVectorCreate(ceed, Q*size*blksize, &qvecs[i]); CeedChk(ierr);
+        break;
+      case CEED_EVAL_GRAD:
+        ierr = CeedOperatorFieldGetBasis(opfields[i], &basis); CeedChk(ierr);
+        ierr = CeedQFunctionFieldGetSize(qffields[i], &size); CeedChk(ierr);
+        ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+        ierr = CeedElemRestrictionGetElementSize(r, &P);
+        CeedChk(ierr);
+        ierr = CeedVectorCreate(ceed, P*size/dim*blksize, &evecs[i]);
+        CeedChk(ierr);
+        ierr = CeedVectorCreate(ceed, Q*size*blksize, &qvecs[i]); CeedChk(ierr);
+        break;
+      case CEED_EVAL_WEIGHT: // Only on input fields
+        ierr = CeedOperatorFieldGetBasis(opfields[i], &basis); CeedChk(ierr);
+        ierr = CeedVectorCreate(ceed, Q*blksize, &qvecs[i]); CeedChk(ierr);
+        ierr = CeedBasisApply(basis, blksize, CEED_NOTRANSPOSE,
+                              CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, qvecs[i]);
+        CeedChk(ierr);
+        break;
+      case CEED_EVAL_DIV:
+        break; // Not implemented
+      case CEED_EVAL_CURL:
+        break; // Not implemented
+      }
+
+      // View of the active input L-vector
+      if (!inOrOut && vec == CEED_VECTOR_ACTIVE && !thread->linvec) {
+        ierr = CeedVectorCreate(ceed, lsize, &thread->linvec); CeedChk(ierr);
+      }
+      // Output accumulators; thread 0 writes directly to the output vectors
+      if (inOrOut && t > 0) {
+        ierr = CeedVectorCreate(ceed, lsize, &thread->lvecsout[i]);
+        CeedChk(ierr);
+        ierr = CeedVectorSetMemoryClass(thread->lvecsout[i],
+                                        CEED_MEMORY_EVECTOR); CeedChk(ierr);
+      }
+
+      // Work vectors are accounted to the operator
+      ierr = CeedVectorSetMemoryClass(evecs[i], CEED_MEMORY_EVECTOR);
+      CeedChk(ierr);
+      ierr = CeedVectorSetMemoryClass(qvecs[i], CEED_MEMORY_EVECTOR);
+      CeedChk(ierr);
+      ierr = CeedVectorSetMemoryClass(thread->linvec, CEED_MEMORY_EVECTOR);
+      CeedChk(ierr);
+    }
+    ierr = CeedVectorSetMemoryClass(impl->evecs[i+starte], CEED_MEMORY_EVECTOR);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// First Touch
+//   Pages are placed on the NUMA node of the thread that first writes them, so
+//   the passive E-vectors are cleared block by block by the threads that later
+//   apply those blocks, and each output accumulator by the thread it belongs to
+//------------------------------------------------------------------------------
+static int CeedOperatorFirstTouch_Omp(const Ceed_Omp *ceedimpl,
+                                      CeedOperator_Omp *impl, CeedInt nblks) {
+  int ierr;
+  const CeedInt nthreads = impl->nthreads, numfields = impl->numein +
+                           impl->numeout, numout = impl->numeout;
+  CeedInt elength[numfields], alength[numout];
+  CeedScalar *edata[numfields], *acc[nthreads][numout];
+
+  for (CeedInt i=0; i<numfields; i++) {
+    edata[i] = NULL; elength[i] = 0;
+    if (impl->evecs[i]) {
+      ierr = CeedVectorGetLength(impl->evecs[i], &elength[i]); CeedChk(ierr);
+      ierr = CeedVectorGetArray(impl->evecs[i], CEED_MEM_HOST, &edata[i]);
+      CeedChk(ierr);
+    }
+  }
+  for (CeedInt i=0; i<numout; i++) {
+    alength[i] = 0;
+    for (CeedInt t=1; t<nthreads; t++) {
+      ierr = CeedVectorGetLength(impl->threads[t].lvecsout[i], &alength[i]);
+      CeedChk(ierr);
+      ierr = CeedVectorGetArray(impl->threads[t].lvecsout[i], CEED_MEM_HOST,
+                                &acc[t][i]); CeedChk(ierr);
+    }
+  }
+
+  // Same static partition of the blocks as the element loop
+  #pragma omp parallel num_threads(nthreads)
+  {
+    const CeedInt tid = omp_get_thread_num(), nt = omp_get_num_threads(),
+                  rank = CeedOmpRank(ceedimpl, tid, nt);
+    const CeedInt start = (nblks*rank)/nt, stop = (nblks*(rank+1))/nt;
+    for (CeedInt i=0; i<numfields; i++)
+      if (edata[i] && nblks) {
+        const CeedInt blklen = elength[i]/nblks;
+        memset(&edata[i][start*blklen], 0,
+               (stop - start)*blklen*sizeof(CeedScalar));
+      }
+    for (CeedInt i=0; i<numout && tid > 0; i++)
+      memset(acc[tid][i], 0, alength[i]*sizeof(CeedScalar));
+  }
+
+  for (CeedInt i=0; i<numfields; i++)
+    if (impl->evecs[i]) {
+      ierr = CeedVectorRestoreArray(impl->evecs[i], &edata[i]); CeedChk(ierr);
+    }
+  for (CeedInt i=0; i<numout; i++)
+    for (CeedInt t=1; t<nthreads; t++) {
+      ierr = CeedVectorRestoreArray(impl->threads[t].lvecsout[i], &acc[t][i]);
+      CeedChk(ierr);
+    }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Operator
+//------------------------------------------------------------------------------
+static int CeedOperatorSetup_Omp(CeedOperator op) {
+  int ierr;
+  bool setupdone;
+  ierr = CeedOperatorIsSetupDone(op, &setupdone); CeedChk(ierr);
+  if (setupdone) return 0;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Omp *ceedimpl;
+  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
+  const CeedInt blksize = ceedimpl->blksize;
+  CeedOperator_Omp *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt Q, numinputfields, numoutputfields;
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+  ierr = CeedQFunctionIsIdentity(qf, &impl->identityqf); CeedChk(ierr);
+  ierr= CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+
+  // Allocate
+  ierr = CeedCalloc(numinputfields + numoutputfields, &impl->blkrestr);
+  CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields + numoutputfields, &impl->evecs);
+  CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields + numoutputfields, &impl->edata);
+  CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->inputstate); CeedChk(ierr);
+
+  ierr = CeedCalloc(impl->nthreads, &impl->threads); CeedChk(ierr);
+  for (CeedInt t=0; t<impl->nthreads; t++) {
+    CeedOperatorThread_Omp *thread = &impl->threads[t];
+    ierr = CeedCalloc(numoutputfields, &thread->lvecsout); CeedChk(ierr);
+    ierr = CeedCalloc(numinputfields, &thread->evecsin); CeedChk(ierr);
+    ierr = CeedCalloc(numoutputfields, &thread->evecsout); CeedChk(ierr);
+    ierr = CeedCalloc(numinputfields, &thread->qvecsin); CeedChk(ierr);
+    ierr = CeedCalloc(numoutputfields, &thread->qvecsout); CeedChk(ierr);
+    ierr = CeedCalloc(numinputfields, &thread->qdatain); CeedChk(ierr);
+    ierr = CeedCalloc(numoutputfields, &thread->qdataout); CeedChk(ierr);
+  }
+
+  impl->numein = numinputfields; impl->numeout = numoutputfields;
+
+  // Set up infield and outfield pointer arrays
+  // Infields
+  ierr = CeedOperatorSetupFields_Omp(qf, op, 0, blksize, impl, 0,
+                                     numinputfields, Q);
+  CeedChk(ierr);
+  // Outfields
+  ierr = CeedOperatorSetupFields_Omp(qf, op, 1, blksize, impl, numinputfields,
+                                     numoutputfields, Q);
+  CeedChk(ierr);
+
+  // Place pages with the threads that use them
+  CeedInt nelem;
+  ierr = CeedOperatorGetNumElements(op, &nelem); CeedChk(ierr);
+  ierr = CeedOperatorFirstTouch_Omp(ceedimpl, impl,
+                                    (nelem/blksize) + !!(nelem%blksize));
+  CeedChk(ierr);
+
+  // Identity QFunctions
+  if (impl->identityqf) {
+    for (CeedInt t=0; t<impl->nthreads; t++) {
+      CeedOperatorThread_Omp *thread = &impl->threads[t];
+      for (CeedInt i=0; i<numinputfields; i++) {
+        ierr = CeedVectorDestroy(&thread->qvecsout[i]); CeedChk(ierr);
+        thread->qvecsout[i] = thread->qvecsin[i];
+        ierr = CeedVectorAddReference(thread->qvecsin[i]); CeedChk(ierr);
+      }
+    }
+  }
+
+  ierr = CeedOperatorSetSetupDone(op); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Input Fields
+//------------------------------------------------------------------------------
+static inline int CeedOperatorSetupInputs_Omp(CeedInt numinputfields,
+    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
+    CeedOperator_Omp *impl, CeedRequest *request) {
+  CeedInt ierr;
+  CeedEvalMode emode;
+  CeedVector vec;
+  uint64_t state;
+
+  for (CeedInt i=0; i<numinputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    if (emode == CEED_EVAL_WEIGHT) { // Skip
+    } else {
+      // Get input vector
+      ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+      if (vec != CEED_VECTOR_ACTIVE) {
+        // Restrict
+        ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
+        if (state != impl->inputstate[i]) {
+          ierr = CeedElemRestrictionApply(impl->blkrestr[i], CEED_NOTRANSPOSE,
+                                          vec, impl->evecs[i], request);
+          CeedChk(ierr);
+          impl->inputstate[i] = state;
+          // Round reduced precision passive inputs
+          CeedStorageType storage;
+          ierr = CeedOperatorFieldGetStorage(opinputfields[i], &storage);
+          CeedChk(ierr);
+          ierr = CeedVectorRoundToStorage(impl->evecs[i], storage); CeedChk(ierr);
+        }
+        // Get evec
+        ierr = CeedVectorGetArrayRead(impl->evecs[i], CEED_MEM_HOST,
+                                      (const CeedScalar **) &impl->edata[i]);
+        CeedChk(ierr);
+      } else if (emode == CEED_EVAL_NONE) {
+        // Set Qvec for CEED_EVAL_NONE
+        for (CeedInt t=0; t<impl->nthreads; t++) {
+          CeedOperatorThread_Omp *thread = &impl->threads[t];
+          CeedScalar *edata;
+          ierr = CeedVectorGetArray(thread->evecsin[i], CEED_MEM_HOST, &edata);
+          CeedChk(ierr);
+          ierr = CeedVectorSetArray(thread->qvecsin[i], CEED_MEM_HOST,
+                                    CEED_USE_POINTER, edata); CeedChk(ierr);
+          ierr = CeedVectorRestoreArray(thread->evecsin[i], &edata);
+          CeedChk(ierr);
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Input Basis Action
+//------------------------------------------------------------------------------
+static inline int CeedOperatorInputBasis_Omp(CeedInt e, CeedInt Q,
+    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
+    CeedInt numinputfields, CeedInt blksize, CeedOperator_Omp *impl,
+    CeedOperatorThread_Omp *thread) {
+  CeedInt ierr;
+  CeedInt dim, elemsize, size;
+  CeedElemRestriction Erestrict;
+  CeedEvalMode emode;
+  CeedBasis basis;
+  CeedVector vec;
+
+  for (CeedInt i=0; i<numinputfields; i++) {
+    CeedInt activein = 0;
+    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    // Get elemsize, emode, size
+    ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
+    CeedChk(ierr);
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    ierr = CeedQFunctionFieldGetSize(qfinputfields[i], &size); CeedChk(ierr);
+    // Restrict block active input
+    if (vec == CEED_VECTOR_ACTIVE) {
+      ierr = CeedElemRestrictionApplyBlock(impl->blkrestr[i], e/blksize,
+                                           CEED_NOTRANSPOSE, thread->linvec,
+                                           thread->evecsin[i],
+                                           CEED_REQUEST_IMMEDIATE);
+      CeedChk(ierr);
+      activein = 1;
+    }
+    // Basis action
+    switch(emode) {
+    case CEED_EVAL_NONE:
+      if (!activein) {
+        ierr = CeedVectorSetArray(thread->qvecsin[i], CEED_MEM_HOST,
+                                  CEED_USE_POINTER,
+                                  &impl->edata[i][e*Q*size]); CeedChk(ierr);
+      }
+      break;
+    case CEED_EVAL_INTERP:
+      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis);
+      CeedChk(ierr);
+      if (!activein) {
+        ierr = CeedVectorSetArray(thread->evecsin[i], CEED_MEM_HOST,
+                                  CEED_USE_POINTER,
+                                  &impl->edata[i][e*elemsize*size]);
+        CeedChk(ierr);
+      }
+      ierr = CeedBasisApply(basis, blksize, CEED_NOTRANSPOSE,
+                            CEED_EVAL_INTERP, thread->evecsin[i],
+                            thread->qvecsin[i]); CeedChk(ierr);
+      break;
+    case CEED_EVAL_GRAD:
+      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis);
+      CeedChk(ierr);
+      if (!activein) {
+        ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+        ierr = CeedVectorSetArray(thread->evecsin[i], CEED_MEM_HOST,
+                                  CEED_USE_POINTER,
+                                  &impl->edata[i][e*elemsize*size/dim]);
+        CeedChk(ierr);
+      }
+      ierr = CeedBasisApply(basis, blksize, CEED_NOTRANSPOSE,
+                            CEED_EVAL_GRAD, thread->evecsin[i],
+                            thread->qvecsin[i]); CeedChk(ierr);
+      break;
+    case CEED_EVAL_WEIGHT:
+      break;  // No action
+    // LCOV_EXCL_START
+    case CEED_EVAL_DIV:
+    case CEED_EVAL_CURL: {
+      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis);
+      CeedChk(ierr);
+      Ceed ceed;
+      ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
+      return CeedError(ceed, 1, "Ceed evaluation mode not implemented");
+      // LCOV_EXCL_STOP
+    }
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// QFunction Action
+//   The user function is called directly so that no QFunction backend data is
+//   shared between threads
+//------------------------------------------------------------------------------
+static inline int CeedOperatorQFunctionApply_Omp(CeedQFunctionUser f,
+    void *ctxdata, CeedInt Q, CeedInt numinputfields, CeedInt numoutputfields,
+    CeedOperatorThread_Omp *thread) {
+  CeedInt ierr;
+
+  for (CeedInt i=0; i<numinputfields; i++) {
+    ierr = CeedVectorGetArrayRead(thread->qvecsin[i], CEED_MEM_HOST,
+                                  &thread->qdatain[i]); CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<numoutputfields; i++) {
+    ierr = CeedVectorGetArray(thread->qvecsout[i], CEED_MEM_HOST,
+                              &thread->qdataout[i]); CeedChk(ierr);
+  }
+
+  ierr = f(ctxdata, Q, thread->qdatain, thread->qdataout); CeedChk(ierr);
+
+  for (CeedInt i=0; i<numinputfields; i++) {
+    ierr = CeedVectorRestoreArrayRead(thread->qvecsin[i], &thread->qdatain[i]);
+    CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<numoutputfields; i++) {
+    ierr = CeedVectorRestoreArray(thread->qvecsout[i], &thread->qdataout[i]);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Output Basis Action
+//------------------------------------------------------------------------------
+static inline int CeedOperatorOutputBasis_Omp(CeedInt e,
+    CeedQFunctionField *qfoutputfields, CeedOperatorField *opoutputfields,
+    CeedInt blksize, CeedInt numoutputfields, CeedOperator op,
+    CeedVector outvec, CeedOperator_Omp *impl, CeedInt tid) {
+  CeedInt ierr;
+  CeedEvalMode emode;
+  CeedBasis basis;
+  CeedVector vec;
+  CeedOperatorThread_Omp *thread = &impl->threads[tid];
+
+  for (CeedInt i=0; i<numoutputfields; i++) {
+    // Get emode
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    // Basis action
+    switch(emode) {
+    case CEED_EVAL_NONE:
+      break; // No action
+    case CEED_EVAL_INTERP:
+      ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
+      CeedChk(ierr);
+      ierr = CeedBasisApply(basis, blksize, CEED_TRANSPOSE,
+                            CEED_EVAL_INTERP, thread->qvecsout[i],
+                            thread->evecsout[i]); CeedChk(ierr);
+      break;
+    case CEED_EVAL_GRAD:
+      ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
+      CeedChk(ierr);
+      ierr = CeedBasisApply(basis, blksize, CEED_TRANSPOSE,
+                            CEED_EVAL_GRAD, thread->qvecsout[i],
+                            thread->evecsout[i]); CeedChk(ierr);
+      break;
+    // LCOV_EXCL_START
+    case CEED_EVAL_WEIGHT: {
+      Ceed ceed;
+      ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+      return CeedError(ceed, 1, "CEED_EVAL_WEIGHT cannot be an output "
+                       "evaluation mode");
+    }
+    case CEED_EVAL_DIV:
+    case CEED_EVAL_CURL: {
+      Ceed ceed;
+      ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+      return CeedError(ceed, 1, "Ceed evaluation mode not implemented");
+      // LCOV_EXCL_STOP
+    }
+    }
+    // Get output vector
+    if (tid) {
+      vec = thread->lvecsout[i];
+    } else {
+      ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec);
+      CeedChk(ierr);
+      if (vec == CEED_VECTOR_ACTIVE)
+        vec = outvec;
+    }
+    // Restrict output block
+    ierr = CeedElemRestrictionApplyBlock(impl->blkrestr[i+impl->numein],
+                                         e/blksize, CEED_TRANSPOSE,
+                                         thread->evecsout[i], vec,
+                                         CEED_REQUEST_IMMEDIATE);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Apply Operator to the Element Blocks of One Thread
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddBlocks_Omp(CeedOperator op, CeedInt tid,
+    CeedInt firstblk, CeedInt lastblk, CeedVector outvec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Omp *ceedimpl;
+  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
+  const CeedInt blksize = ceedimpl->blksize;
+  CeedOperator_Omp *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedOperatorThread_Omp *thread = &impl->threads[tid];
+  CeedInt Q;
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields;
+  ierr= CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+  CeedQFunctionField *qfinputfields, *qfoutputfields;
+  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
+  CeedChk(ierr);
+
+  // Loop through elements
+  for (CeedInt e=firstblk*blksize; e<lastblk*blksize; e+=blksize) {
+    // Input basis apply
+    ierr = CeedOperatorInputBasis_Omp(e, Q, qfinputfields, opinputfields,
+                                      numinputfields, blksize, impl, thread);
+    CeedChk(ierr);
+
+    // Q function
+    if (!impl->identityqf) {
+      ierr = CeedOperatorQFunctionApply_Omp(impl->f, impl->ctxdata, Q*blksize,
+                                            numinputfields, numoutputfields,
+                                            thread); CeedChk(ierr);
+    }
+
+    // Output basis apply and restrict
+    ierr = CeedOperatorOutputBasis_Omp(e, qfoutputfields, opoutputfields,
+                                       blksize, numoutputfields, op, outvec,
+                                       impl, tid); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Apply a Range of the Element Blocks of Several Operators
+//   Blocks are numbered consecutively through the operators, with the blocks
+//   of operator i from blkoffset[i]
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddRange_Omp(CeedInt numops, CeedOperator *ops,
+    const CeedInt *blkoffset, CeedInt tid, CeedInt firstblk, CeedInt lastblk,
+    CeedVector outvec) {
+  int ierr;
+  for (CeedInt i=0; i<numops; i++) {
+    const CeedInt first = CeedIntMax(firstblk, blkoffset[i]),
+                  last = CeedIntMin(lastblk, blkoffset[i+1]);
+    if (first >= last) continue;
+    ierr = CeedOperatorApplyAddBlocks_Omp(ops[i], tid, first - blkoffset[i],
+                                          last - blkoffset[i], outvec);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Take Blocks from a Work-Stealing Queue
+//   A queue holds the range [head, tail) of blocks left to a thread, packed in
+//   one word so that the owner, taking one block from the head, and thieves,
+//   taking half of the blocks left from the tail, update it atomically
+//------------------------------------------------------------------------------
+static inline bool CeedOmpQueueTake(uint64_t *queue, bool steal,
+                                    CeedInt *first, CeedInt *last) {
+  uint64_t old = __atomic_load_n(queue, __ATOMIC_ACQUIRE), new;
+  do {
+    const uint32_t head = old >> 32, tail = (uint32_t)old;
+    if (head >= tail) return false;
+    if (steal) {
+      *first = tail - (tail - head + 1)/2; *last = tail;
+      new = ((uint64_t)head << 32) | (uint32_t)*first;
+    } else {
+      *first = head; *last = head + 1;
+      new = ((uint64_t)*last << 32) | tail;
+    }
+  } while (!__atomic_compare_exchange_n(queue, &old, new, true,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Apply the Element Blocks of Several Operators in Parallel
+//   Each thread starts with a contiguous range of blocks; with work stealing,
+//   threads that finish early take blocks from the ranges of the others, so
+//   suboperators of different cost per block do not leave threads idle. Any
+//   thread may apply any block, since outputs are accumulated per thread.
+//   Stage profiling is not thread safe, so only the full application is timed
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddBlocksParallel_Omp(Ceed ceed,
+    const Ceed_Omp *ceedimpl, CeedInt numops, CeedOperator *ops,
+    const CeedInt *blkoffset, CeedVector outvec) {
+  int ierr, ierromp = 0;
+  const CeedInt nthreads = ceedimpl->nthreads, nblks = blkoffset[numops];
+  struct {
+    uint64_t range;
+  } CEED_ALIGNED queues[nthreads];  // One cache line each
+
+  ierr = CeedProfileSuspend(ceed, true); CeedChk(ierr);
+  #pragma omp parallel num_threads(nthreads)
+  {
+    const CeedInt tid = omp_get_thread_num(), nt = omp_get_num_threads(),
+                  rank = CeedOmpRank(ceedimpl, tid, nt);
+    const CeedInt firstblk = (nblks*rank)/nt, lastblk = (nblks*(rank+1))/nt;
+    int ierrthread = 0;
+
+    if (!ceedimpl->steal) {
+      ierrthread = CeedOperatorApplyAddRange_Omp(numops, ops, blkoffset, tid,
+                   firstblk, lastblk, outvec);
+    } else {
+      uint64_t *own = &queues[rank].range;
+      __atomic_store_n(own, ((uint64_t)firstblk << 32) | (uint32_t)lastblk,
+                       __ATOMIC_RELEASE);
+      #pragma omp barrier
+      CeedInt first, last;
+      for (CeedInt v=0; v<nt && !ierrthread; ) {
+        // Own blocks first, then steal from the following ranks in turn
+        if (CeedOmpQueueTake(own, false, &first, &last)) {
+          ierrthread = CeedOperatorApplyAddRange_Omp(numops, ops, blkoffset,
+                       tid, first, last, outvec);
+        } else if (++v < nt && CeedOmpQueueTake(&queues[(rank+v)%nt].range,
+                   true, &first, &last)) {
+          // Stolen blocks are put in the own queue, to be stolen in turn
+          __atomic_store_n(own, ((uint64_t)first << 32) | (uint32_t)last,
+                           __ATOMIC_RELEASE);
+          v = 0;
+        }
+      }
+    }
+    if (ierrthread) {
+      #pragma omp critical
+      ierromp = ierrthread;
+    }
+  }
+  ierr = CeedProfileSuspend(ceed, false); CeedChk(ierr);
+  CeedChk(ierromp);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Reduce Thread-Private Outputs
+//------------------------------------------------------------------------------
+static inline int CeedOperatorReduceOutputs_Omp(CeedInt numoutputfields,
+    CeedOperatorField *opoutputfields, CeedVector outvec,
+    const Ceed_Omp *ceedimpl, CeedOperator_Omp *impl) {
+  CeedInt ierr;
+  const CeedInt nthreads = impl->nthreads;
+  CeedVector vec;
+
+  if (nthreads == 1) return 0;
+
+  for (CeedInt i=0; i<numoutputfields; i++) {
+    ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE)
+      vec = outvec;
+    CeedInt length;
+    ierr = CeedVectorGetLength(impl->threads[1].lvecsout[i], &length);
+    CeedChk(ierr);
+    CeedScalar *out, *acc[nthreads];
+    ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, &out); CeedChk(ierr);
+    for (CeedInt t=1; t<nthreads; t++) {
+      ierr = CeedVectorGetArray(impl->threads[t].lvecsout[i], CEED_MEM_HOST,
+                                &acc[t]); CeedChk(ierr);
+    }
+
+    // Sum in fixed thread order and reset the accumulators, over the same
+    //   ranges of entries as CeedVectorSetValue_Omp
+    #pragma omp parallel num_threads(nthreads)
+    {
+      const CeedInt nt = omp_get_num_threads(),
+                    rank = CeedOmpRank(ceedimpl, omp_get_thread_num(), nt);
+      const CeedInt start = ((int64_t)length*rank)/nt,
+                    stop = ((int64_t)length*(rank+1))/nt;
+      for (CeedInt j=start; j<stop; j++)
+        for (CeedInt t=1; t<nthreads; t++) {
+          out[j] += acc[t][j];
+          acc[t][j] = 0.0;
+        }
+    }
+
+    for (CeedInt t=1; t<nthreads; t++) {
+      ierr = CeedVectorRestoreArray(impl->threads[t].lvecsout[i], &acc[t]);
+      CeedChk(ierr);
+    }
+    ierr = CeedVectorRestoreArray(vec, &out); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Restore Input Vectors
+//------------------------------------------------------------------------------
+static inline int CeedOperatorRestoreInputs_Omp(CeedInt numinputfields,
+    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
+    CeedOperator_Omp *impl) {
+  CeedInt ierr;
+  CeedEvalMode emode;
+  CeedVector vec;
+
+  for (CeedInt i=0; i<numinputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    if (emode != CEED_EVAL_WEIGHT && vec != CEED_VECTOR_ACTIVE) {
+      ierr = CeedVectorRestoreArrayRead(impl->evecs[i],
+                                        (const CeedScalar **) &impl->edata[i]);
+      CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Number of Element Blocks
+//------------------------------------------------------------------------------
+static int CeedOperatorGetNumBlocks_Omp(CeedOperator op, CeedInt *nblks) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Omp *ceedimpl;
+  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
+  CeedInt blksize = ceedimpl->blksize, numelements;
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  *nblks = (numelements/blksize) + !!(numelements%blksize);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Prepare Operator Apply
+//   Restricts passive inputs and sets the thread views of the active input,
+//   so that the element blocks can then be applied in any thread
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddBegin_Omp(CeedOperator op, CeedVector invec,
+    CeedRequest *request) {
+  int ierr;
+  CeedOperator_Omp *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields;
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  ierr= CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+  CeedQFunctionField *qfinputfields, *qfoutputfields;
+  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
+  CeedChk(ierr);
+  CeedEvalMode emode;
+
+  // Setup
+  ierr = CeedOperatorSetup_Omp(op); CeedChk(ierr);
+
+  // QFunction user function and context
+  ierr = CeedQFunctionGetUserFunction(qf, &impl->f); CeedChk(ierr);
+  ierr = CeedQFunctionGetContext(qf, &impl->ctx); CeedChk(ierr);
+  impl->ctxdata = NULL;
+  if (impl->ctx) {
+    ierr = CeedQFunctionContextGetData(impl->ctx, CEED_MEM_HOST,
+                                       &impl->ctxdata); CeedChk(ierr);
+  }
+
+  // Input Evecs and Restriction
+  ierr = CeedOperatorSetupInputs_Omp(numinputfields, qfinputfields,
+                                     opinputfields, impl, request);
+  CeedChk(ierr);
+
+  // Active input Lvec
+  impl->indata = NULL;
+  if (impl->threads[0].linvec) {
+    ierr = CeedVectorGetArrayRead(invec, CEED_MEM_HOST, &impl->indata);
+    CeedChk(ierr);
+    for (CeedInt t=0; t<impl->nthreads; t++) {
+      ierr = CeedVectorSetArray(impl->threads[t].linvec, CEED_MEM_HOST,
+                                CEED_USE_POINTER, (CeedScalar *)impl->indata);
+      CeedChk(ierr);
+    }
+  }
+
+  // Output Evecs and Qvecs
+  for (CeedInt i=0; i<numoutputfields; i++) {
+    // Set Qvec if needed
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    if (emode == CEED_EVAL_NONE) {
+      for (CeedInt t=0; t<impl->nthreads; t++) {
+        CeedOperatorThread_Omp *thread = &impl->threads[t];
+        CeedScalar *edata;
+        // Set qvec to single block evec
+        ierr = CeedVectorGetArray(thread->evecsout[i], CEED_MEM_HOST, &edata);
+        CeedChk(ierr);
+        ierr = CeedVectorSetArray(thread->qvecsout[i], CEED_MEM_HOST,
+                                  CEED_USE_POINTER, edata); CeedChk(ierr);
+        ierr = CeedVectorRestoreArray(thread->evecsout[i], &edata);
+        CeedChk(ierr);
+      }
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Complete Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddEnd_Omp(CeedOperator op, CeedVector invec,
+                                       CeedVector outvec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Omp *ceedimpl;
+  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
+  CeedOperator_Omp *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields;
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  ierr= CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+  CeedQFunctionField *qfinputfields, *qfoutputfields;
+  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
+  CeedChk(ierr);
+
+  // Restore active input array
+  if (impl->indata) {
+    ierr = CeedVectorRestoreArrayRead(invec, &impl->indata); CeedChk(ierr);
+  }
+
+  // Reduce thread-private outputs
+  ierr = CeedOperatorReduceOutputs_Omp(numoutputfields, opoutputfields, outvec,
+                                       ceedimpl, impl); CeedChk(ierr);
+
+  // Restore input arrays
+  ierr = CeedOperatorRestoreInputs_Omp(numinputfields, qfinputfields,
+                                       opinputfields, impl);
+  CeedChk(ierr);
+  if (impl->ctx) {
+    ierr = CeedQFunctionContextRestoreData(impl->ctx, &impl->ctxdata);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Omp(CeedOperator op, CeedVector invec,
+                                    CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Omp *ceedimpl;
+  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
+  CeedInt nblks;
+  ierr = CeedOperatorGetNumBlocks_Omp(op, &nblks); CeedChk(ierr);
+
+  ierr = CeedOperatorApplyAddBegin_Omp(op, invec, request); CeedChk(ierr);
+
+  // Loop through element blocks in parallel
+  const CeedInt blkoffset[2] = {0, nblks};
+  ierr = CeedOperatorApplyAddBlocksParallel_Omp(ceed, ceedimpl, 1, &op,
+         blkoffset, outvec); CeedChk(ierr);
+
+  ierr = CeedOperatorApplyAddEnd_Omp(op, invec, outvec); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Apply
+//   The element blocks of all suboperators are split between the threads of a
+//   single parallel region, so small suboperators, such as boundary terms, run
+//   concurrently with the others instead of each forking its own team
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddComposite_Omp(CeedOperator op, CeedVector invec,
+    CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Omp *ceedimpl;
+  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
+  CeedInt numsub;
+  ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
+  CeedOperator *suboperators;
+  ierr = CeedOperatorGetSubList(op, &suboperators); CeedChk(ierr);
+
+  // Composite suboperators or suboperators from other backends are applied
+  //   one after another
+  bool concurrent = true;
+  for (CeedInt i=0; i<numsub; i++) {
+    Ceed subceed;
+    bool iscomposite;
+    ierr = CeedOperatorGetCeed(suboperators[i], &subceed); CeedChk(ierr);
+    ierr = CeedOperatorIsComposite(suboperators[i], &iscomposite);
+    CeedChk(ierr);
+    concurrent = concurrent && subceed == ceed && !iscomposite;
+  }
+  if (!concurrent) {
+    for (CeedInt i=0; i<numsub; i++) {
+      ierr = CeedOperatorApplyAdd(suboperators[i], invec, outvec,
+                                  i < numsub-1 ? CEED_REQUEST_ORDERED : request);
+      CeedChk(ierr);
+    }
+    return 0;
+  }
+
+  // Prepare suboperators and offsets of their blocks
+  CeedInt blkoffset[numsub+1];
+  blkoffset[0] = 0;
+  for (CeedInt i=0; i<numsub; i++) {
+    CeedInt nblks;
+    ierr = CeedOperatorGetNumBlocks_Omp(suboperators[i], &nblks); CeedChk(ierr);
+    blkoffset[i+1] = blkoffset[i] + nblks;
+    ierr = CeedOperatorApplyAddBegin_Omp(suboperators[i], invec, request);
+    CeedChk(ierr);
+  }
+
+  // Loop through the element blocks of all suboperators in parallel
+  ierr = CeedOperatorApplyAddBlocksParallel_Omp(ceed, ceedimpl, numsub,
+         suboperators, blkoffset, outvec); CeedChk(ierr);
+
+  // Reduce outputs in suboperator order
+  for (CeedInt i=0; i<numsub; i++) {
+    ierr = CeedOperatorApplyAddEnd_Omp(suboperators[i], invec, outvec);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroy_Omp(CeedOperator op) {
+  int ierr;
+  CeedOperator_Omp *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    ierr = CeedElemRestrictionDestroy(&impl->blkrestr[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&impl->evecs[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->blkrestr); CeedChk(ierr);
+  ierr = CeedFree(&impl->evecs); CeedChk(ierr);
+  ierr = CeedFree(&impl->edata); CeedChk(ierr);
+  ierr = CeedFree(&impl->inputstate); CeedChk(ierr);
+
+  for (CeedInt t=0; impl->threads && t<impl->nthreads; t++) {
+    CeedOperatorThread_Omp *thread = &impl->threads[t];
+    ierr = CeedVectorDestroy(&thread->linvec); CeedChk(ierr);
+    for (CeedInt i=0; i<impl->numein; i++) {
+      ierr = CeedVectorDestroy(&thread->evecsin[i]); CeedChk(ierr);
+      ierr = CeedVectorDestroy(&thread->qvecsin[i]); CeedChk(ierr);
+    }
+    for (CeedInt i=0; i<impl->numeout; i++) {
+      ierr = CeedVectorDestroy(&thread->lvecsout[i]); CeedChk(ierr);
+      ierr = CeedVectorDestroy(&thread->evecsout[i]); CeedChk(ierr);
+      ierr = CeedVectorDestroy(&thread->qvecsout[i]); CeedChk(ierr);
+    }
+    ierr = CeedFree(&thread->lvecsout); CeedChk(ierr);
+    ierr = CeedFree(&thread->evecsin); CeedChk(ierr);
+    ierr = CeedFree(&thread->evecsout); CeedChk(ierr);
+    ierr = CeedFree(&thread->qvecsin); CeedChk(ierr);
+    ierr = CeedFree(&thread->qvecsout); CeedChk(ierr);
+    ierr = CeedFree(&thread->qdatain); CeedChk(ierr);
+    ierr = CeedFree(&thread->qdataout); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->threads); CeedChk(ierr);
+
+  ierr = CeedFree(&impl); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Create
+//------------------------------------------------------------------------------
+int CeedOperatorCreate_Omp(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  Ceed_Omp *ceedimpl;
+  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
+  CeedOperator_Omp *impl;
+
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  impl->nthreads = ceedimpl->nthreads;
+  ierr = CeedOperatorSetData(op, impl); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
+                                CeedOperatorApplyAdd_Omp); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
+                                CeedOperatorDestroy_Omp); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Create
+//------------------------------------------------------------------------------
+int CeedCompositeOperatorCreate_Omp(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddComposite",
+                                CeedOperatorApplyAddComposite_Omp);
+  CeedChk(ierr);
+  return 0;
+}
+//------------------------------------------------------------------------------
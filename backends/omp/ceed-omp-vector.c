@@ -0,0 +1,72 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <omp.h>
+#include "ceed-omp.h"
+#include "../ref/ceed-ref.h"
+
+// Vectors shorter than this are set without forking threads
+#define CEED_OMP_MIN_PARALLEL_LENGTH 8192
+
+//------------------------------------------------------------------------------
+// Vector Set Value
+//   The array is allocated without being written, so setting it, as before
+//   each operator output is computed, first touches each range of entries on
+//   the NUMA node of the thread that computes the matching elements
+//------------------------------------------------------------------------------
+static int CeedVectorSetValue_Omp(CeedVector vec, CeedScalar value) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  Ceed_Omp *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+  CeedScalar *array;
+  ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
+
+  #pragma omp parallel num_threads(data->nthreads) \
+    if (length >= CEED_OMP_MIN_PARALLEL_LENGTH)
+  {
+    const CeedInt nt = omp_get_num_threads(),
+                  rank = CeedOmpRank(data, omp_get_thread_num(), nt);
+    const CeedInt start = ((int64_t)length*rank)/nt,
+                  stop = ((int64_t)length*(rank+1))/nt;
+    for (CeedInt i=start; i<stop; i++)
+      array[i] = value;
+  }
+
+  ierr = CeedVectorRestoreArray(vec, &array); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Vector Create
+//   Host arrays are those of the reference backend
+//------------------------------------------------------------------------------
+int CeedVectorCreate_Omp(CeedInt n, CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+
+  ierr = CeedVectorCreate_Ref(n, vec); CeedChk(ierr);
+  // A float argument is not compatible with the unprototyped int (*)()
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "SetValue",
+                                (int (*)())CeedVectorSetValue_Omp);
+  CeedChk(ierr);
+  return 0;
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,139 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#define _GNU_SOURCE
+#include <omp.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "ceed-omp.h"
+
+//------------------------------------------------------------------------------
+// Order Threads by NUMA Node
+//   Threads that OpenMP binds to places, such as with OMP_PLACES=cores and
+//   OMP_PROC_BIND=close, stay on the NUMA node they are first seen on; unbound
+//   threads may migrate and keep the order of their thread numbers
+//------------------------------------------------------------------------------
+static int CeedOmpSetRanks(Ceed_Omp *data) {
+  const CeedInt nthreads = data->nthreads;
+  unsigned node[nthreads];
+  bool placed = true;
+
+  for (CeedInt t=0; t<nthreads; t++)
+    node[t] = 0;
+#ifdef SYS_getcpu
+  if (omp_get_proc_bind() != omp_proc_bind_false) {
+    #pragma omp parallel num_threads(nthreads)
+    {
+      unsigned cpu, n;
+      if (omp_get_num_threads() != nthreads ||
+          syscall(SYS_getcpu, &cpu, &n, NULL)) {
+        #pragma omp critical
+        placed = false;
+      } else {
+        node[omp_get_thread_num()] = n;
+      }
+    }
+  }
+#endif
+
+  // Stable order by node
+  for (CeedInt t=0; t<nthreads; t++) {
+    data->rank[t] = t;
+    if (!placed) continue;
+    data->rank[t] = 0;
+    for (CeedInt s=0; s<nthreads; s++)
+      data->rank[t] += node[s] < node[t] || (node[s] == node[t] && s < t);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+static int CeedDestroy_Omp(Ceed ceed) {
+  int ierr;
+  Ceed_Omp *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  ierr = CeedFree(&data->rank); CeedChk(ierr);
+  ierr = CeedFree(&data); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Init
+//------------------------------------------------------------------------------
+static int CeedInit_Omp(const char *resource, Ceed ceed) {
+  int ierr;
+  if (strcmp(resource, "/cpu/openmp") && strcmp(resource, "/cpu/openmp/opt"))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "OpenMP backend cannot use resource: %s",
+                     resource);
+  // LCOV_EXCL_STOP
+
+  // Create reference CEED that implementation will be dispatched
+  //   through unless overridden
+  Ceed ceedref;
+  CeedInit("/cpu/self/ref/serial", &ceedref);
+  ierr = CeedSetDelegate(ceed, ceedref); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy",
+                                CeedDestroy_Omp); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "VectorCreate",
+                                CeedVectorCreate_Omp); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate",
+                                CeedOperatorCreate_Omp); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "CompositeOperatorCreate",
+                                CeedCompositeOperatorCreate_Omp); CeedChk(ierr);
+
+  // Set blocksize and number of threads
+  Ceed_Omp *data;
+  ierr = CeedCalloc(1, &data); CeedChk(ierr);
+  const char *blksize = getenv("CEED_BLOCK_SIZE");
+  data->blksize = blksize ? strtol(blksize, NULL, 10) : 8;
+  if (data->blksize < 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "OpenMP backend cannot use blocksize: %s",
+                     blksize);
+  // LCOV_EXCL_STOP
+  // Static partition of the element blocks and a fixed reduction order,
+  //   unless blocks are scheduled by work stealing
+  const char *schedule = getenv("CEED_OMP_SCHEDULE");
+  data->steal = schedule && !strcmp(schedule, "steal");
+  if (schedule && !data->steal && strcmp(schedule, "static"))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "OpenMP backend cannot use schedule: %s",
+                     schedule);
+  // LCOV_EXCL_STOP
+  ierr = CeedSetDeterministic(ceed, !data->steal); CeedChk(ierr);
+  data->nthreads = omp_get_max_threads();
+  ierr = CeedCalloc(data->nthreads, &data->rank); CeedChk(ierr);
+  ierr = CeedOmpSetRanks(data); CeedChk(ierr);
+  ierr = CeedSetData(ceed, data); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Register
+//------------------------------------------------------------------------------
+__attribute__((constructor))
+static void Register(void) {
+  CeedRegister("/cpu/openmp/opt", CeedInit_Omp, 30);
+}
+//------------------------------------------------------------------------------
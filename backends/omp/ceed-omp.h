@@ -0,0 +1,66 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed-backend.h>
+#include <string.h>
+
+typedef struct {
+  CeedInt blksize;
+  CeedInt nthreads;
+  CeedInt *rank;  /// Position of each thread when ordered by NUMA node
+  bool steal;     /// Schedule element blocks by work stealing
+} Ceed_Omp;
+
+//------------------------------------------------------------------------------
+// Position of a thread in the static partitions of elements and vectors
+//   Threads bound to places are ordered by NUMA node, so that the threads of a
+//   node get contiguous ranges; teams of another size use the thread number
+//------------------------------------------------------------------------------
+static inline CeedInt CeedOmpRank(const Ceed_Omp *data, CeedInt tid,
+                                  CeedInt nt) {
+  return nt == data->nthreads ? data->rank[tid] : tid;
+}
+
+typedef struct {
+  CeedVector linvec;     /// Thread view of the active input L-vector
+  CeedVector *lvecsout;  /// Thread-private output L-vector accumulators
+  CeedVector *evecsin;   /// Input E-vectors needed to apply operator
+  CeedVector *evecsout;  /// Output E-vectors needed to apply operator
+  CeedVector *qvecsin;   /// Input Q-vectors needed to apply operator
+  CeedVector *qvecsout;  /// Output Q-vectors needed to apply operator
+  const CeedScalar **qdatain;  /// QFunction input arrays
+  CeedScalar **qdataout;       /// QFunction output arrays
+} CeedOperatorThread_Omp;
+
+typedef struct {
+  bool identityqf;
+  CeedElemRestriction *blkrestr; /// Blocked versions of restrictions
+  CeedVector *evecs;     /// Full E-vectors for passive inputs
+  CeedScalar **edata;
+  uint64_t *inputstate;  /// State counter of inputs
+  CeedInt    numein;
+  CeedInt    numeout;
+  CeedInt    nthreads;
+  CeedOperatorThread_Omp *threads; /// Per-thread workspaces
+  CeedQFunctionUser f;             /// QFunction user function being applied
+  CeedQFunctionContext ctx;        /// QFunction context being applied
+  void *ctxdata;                   /// Host data of the QFunction context
+  const CeedScalar *indata;        /// Active input array being applied
+} CeedOperator_Omp;
+
+CEED_INTERN int CeedVectorCreate_Omp(CeedInt n, CeedVector vec);
+CEED_INTERN int CeedOperatorCreate_Omp(CeedOperator op);
+CEED_INTERN int CeedCompositeOperatorCreate_Omp(CeedOperator op);
@@ -55,7 +55,8 @@ static int CeedInit_Opt_Blocked(const char *resource, Ceed ceed) {
   // Set blocksize
   Ceed_Opt *data;
   ierr = CeedCalloc(1, &data); CeedChk(ierr);
-  data->blksize = 8;
+  ierr = CeedInitBlockSize_Opt(ceed, data, 8); CeedChk(ierr);
+  ierr = CeedInitEVecCacheSize_Opt(ceed, data); CeedChk(ierr);
   ierr = CeedSetData(ceed, data); CeedChk(ierr);
 
   return 0;
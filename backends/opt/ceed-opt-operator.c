@@ -14,9 +14,45 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #include "ceed-opt.h"
 
+//------------------------------------------------------------------------------
+// Set E-vector cache size, optionally overridden by CEED_OPT_EVEC_CACHE
+//------------------------------------------------------------------------------
+int CeedInitEVecCacheSize_Opt(Ceed ceed, Ceed_Opt *data) {
+  const char *evecsize = getenv("CEED_OPT_EVEC_CACHE");
+  data->evecsizemax = CEED_OPT_EVEC_CACHE_SIZE;
+  if (!evecsize)
+    return 0;
+  char *end;
+  errno = 0;
+  const long size = strtol(evecsize, &end, 10);
+  if (end == evecsize || *end || errno || size < 0 || size > INT32_MAX)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Opt backend cannot use E-vector cache size: %s",
+                     evecsize);
+  // LCOV_EXCL_STOP
+  data->evecsizemax = size;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Set number of elements per block, optionally overridden by CEED_BLOCK_SIZE
+//------------------------------------------------------------------------------
+int CeedInitBlockSize_Opt(Ceed ceed, Ceed_Opt *data, CeedInt blksize) {
+  const char *size = getenv("CEED_BLOCK_SIZE");
+  data->blksize = size ? strtol(size, NULL, 10) : blksize;
+  if (data->blksize < 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Opt backend cannot use blocksize: %s", size);
+  // LCOV_EXCL_STOP
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Setup Input/Output Fields
 //------------------------------------------------------------------------------
@@ -25,7 +61,8 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op,
                                        CeedElemRestriction *blkrestr,
                                        CeedVector *fullevecs, CeedVector *evecs,
                                        CeedVector *qvecs, CeedInt starte,
-                                       CeedInt numfields, CeedInt Q) {
+                                       CeedInt numfields, CeedInt Q,
+                                       CeedInt evecsizemax) {
   CeedInt dim, ierr, ncomp, size, P;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
@@ -61,14 +98,36 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op,
       ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
       ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
 
-      bool strided;
+      bool strided, compressed;
+      CeedInt nsides;
       ierr = CeedElemRestrictionIsStrided(r, &strided); CeedChk(ierr);
+      ierr = CeedElemRestrictionIsCompressed(r, &compressed); CeedChk(ierr);
+      ierr = CeedElemRestrictionGetNumSides(r, &nsides); CeedChk(ierr);
       if (strided) {
         CeedInt strides[3];
         ierr = CeedElemRestrictionGetStrides(r, &strides); CeedChk(ierr);
         ierr = CeedElemRestrictionCreateBlockedStrided(ceed, nelem, elemsize,
                blksize, ncomp, lsize, strides, &blkrestr[i+starte]);
         CeedChk(ierr);
+      } else if (compressed) {
+        const CeedInt *eoffsets, *stencil;
+        ierr = CeedElemRestrictionGetCompressedOffsets(r, &eoffsets, &stencil);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
+        ierr = CeedElemRestrictionCreateBlockedCompressed(ceed, nelem, elemsize,
+               blksize, ncomp, compstride, lsize, eoffsets, stencil,
+               &blkrestr[i+starte]);
+        CeedChk(ierr);
+      } else if (nsides > 1) {
+        const CeedInt *offsets = NULL;
+        ierr = CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
+        ierr = CeedElemRestrictionCreateBlockedTwoSided(ceed, nelem, elemsize,
+               blksize, ncomp/nsides, compstride, lsize, CEED_MEM_HOST,
+               CEED_COPY_VALUES, offsets, &blkrestr[i+starte]);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionRestoreOffsets(r, &offsets); CeedChk(ierr);
       } else {
         const CeedInt *offsets = NULL;
         ierr = CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
@@ -81,10 +140,32 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op,
                                                 &blkrestr[i+starte]);
         CeedChk(ierr);
         ierr = CeedElemRestrictionRestoreOffsets(r, &offsets); CeedChk(ierr);
+        // Compact offsets carry over when they fit the padded blocks
+        CeedIndexType itype;
+        bool fits;
+        ierr = CeedElemRestrictionGetIndexType(r, &itype); CeedChk(ierr);
+        ierr = CeedElemRestrictionCheckIndexType(blkrestr[i+starte], itype,
+                                                 &fits); CeedChk(ierr);
+        if (itype != CEED_INDEX_INT32 && fits) {
+          ierr = CeedElemRestrictionSetIndexType(blkrestr[i+starte], itype);
+          CeedChk(ierr);
+        }
+      }
+      // Passive inputs are restricted once and cached, unless the E-vector
+      //   is too large, in which case they are restricted block by block;
+      //   reduced precision inputs are cached separately
+      CeedVector vec;
+      ierr = CeedOperatorFieldGetVector(opfields[i], &vec); CeedChk(ierr);
+      CeedStorageType storage;
+      ierr = CeedOperatorFieldGetStorage(opfields[i], &storage); CeedChk(ierr);
+      const CeedInt nblks = (nelem/blksize) + !!(nelem%blksize);
+      if (!inOrOut && vec != CEED_VECTOR_ACTIVE &&
+          storage == CEED_STORAGE_SCALAR &&
+          (size_t)nblks*blksize*elemsize*ncomp <= (size_t)evecsizemax) {
+        ierr = CeedElemRestrictionCreateVector(blkrestr[i+starte], NULL,
+                                               &fullevecs[i+starte]);
+        CeedChk(ierr);
       }
-      ierr = CeedElemRestrictionCreateVector(blkrestr[i+starte], NULL,
-                                             &fullevecs[i+starte]);
-      CeedChk(ierr);
     }
 
     switch(emode) {
@@ -110,18 +191,122 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op,
       ierr = CeedVectorCreate(ceed, Q*size*blksize, &qvecs[i]); CeedChk(ierr);
       break;
     case CEED_EVAL_WEIGHT: // Only on input fields
-      ierr = CeedOperatorFieldGetBasis(opfields[i], &basis); CeedChk(ierr);
       ierr = CeedVectorCreate(ceed, Q*blksize, &qvecs[i]); CeedChk(ierr);
-      ierr = CeedBasisApply(basis, blksize, CEED_NOTRANSPOSE,
-                            CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, qvecs[i]);
-      CeedChk(ierr);
-
       break;
     case CEED_EVAL_DIV:
       break; // Not implemented
     case CEED_EVAL_CURL:
       break; // Not implemented
     }
+
+    // Work vectors are accounted to the operator
+    ierr = CeedVectorSetMemoryClass(fullevecs[i+starte], CEED_MEMORY_EVECTOR);
+    CeedChk(ierr);
+    ierr = CeedVectorSetMemoryClass(evecs[i], CEED_MEMORY_EVECTOR);
+    CeedChk(ierr);
+    ierr = CeedVectorSetMemoryClass(qvecs[i], CEED_MEMORY_EVECTOR);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Block Arena
+//
+// The single block E- and Q-vectors of all fields share one aligned allocation,
+//   laid out in the order the element loop touches them: for each input field
+//   its E-vector then its Q-vector, then for each output field its Q-vector
+//   then its E-vector. Vectors that only ever alias other storage get no slot:
+//   E-vectors of cached inputs, Q-vectors of CEED_EVAL_NONE fields, and output
+//   Q-vectors of identity QFunctions.
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupArena_Opt(CeedOperator op, CeedOperator_Opt *impl,
+                                      CeedQFunctionField *qfinputfields,
+                                      CeedQFunctionField *qfoutputfields,
+                                      CeedInt numinputfields,
+                                      CeedInt numoutputfields) {
+  int ierr;
+  CeedInt numvecs = 2*(numinputfields + numoutputfields), length;
+  CeedVector vecs[numvecs];
+  CeedEvalMode emode;
+
+  // Vectors in arena order
+  for (CeedInt i=0; i<numinputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    vecs[2*i] = (emode == CEED_EVAL_WEIGHT || impl->evecs[i] ||
+                 impl->inplace[i]) ? NULL : impl->evecsin[i];
+    vecs[2*i+1] = emode == CEED_EVAL_NONE ? NULL : impl->qvecsin[i];
+  }
+  for (CeedInt i=0; i<numoutputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    vecs[2*(numinputfields+i)] = (emode == CEED_EVAL_NONE || impl->identityqf) ?
+                                 NULL : impl->qvecsout[i];
+    vecs[2*(numinputfields+i)+1] = impl->evecsout[i];
+  }
+
+  // Allocate
+  size_t size = 0;
+  for (CeedInt i=0; i<numvecs; i++)
+    if (vecs[i]) {
+      ierr = CeedVectorGetLength(vecs[i], &length); CeedChk(ierr);
+      size += CeedPadLength(length);
+    }
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  ierr = CeedMallocHost(ceed, size, &impl->arena); CeedChk(ierr);
+  memset(impl->arena, 0, size*sizeof(CeedScalar));
+  impl->arenasize = size;
+  ierr = CeedTrackMemory(ceed, CEED_MEMORY_EVECTOR, CEED_MEMSPACE_HOST,
+                         size*sizeof(CeedScalar)); CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->qdatain); CeedChk(ierr);
+  ierr = CeedCalloc(numoutputfields, &impl->qdataout); CeedChk(ierr);
+
+  // Attach slots
+  CeedScalar *slot = impl->arena, *slots[numvecs];
+  for (CeedInt i=0; i<numvecs; i++) {
+    slots[i] = NULL;
+    if (vecs[i]) {
+      ierr = CeedVectorSetArray(vecs[i], CEED_MEM_HOST, CEED_USE_POINTER, slot);
+      CeedChk(ierr);
+      slots[i] = slot;
+      ierr = CeedVectorGetLength(vecs[i], &length); CeedChk(ierr);
+      slot += CeedPadLength(length);
+    }
+  }
+
+  // Q-point data handed to the QFunction; a block of a CEED_EVAL_NONE field is
+  //   its E-vector block, set per block for passive inputs cached in full or
+  //   read in place
+  for (CeedInt i=0; i<numinputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    impl->qdatain[i] = slots[emode == CEED_EVAL_NONE ? 2*i : 2*i+1];
+  }
+  for (CeedInt i=0; i<numoutputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    CeedChk(ierr);
+    impl->qdataout[i] = slots[2*(numinputfields+i) + (emode == CEED_EVAL_NONE)];
+  }
+
+  // Quadrature weights
+  for (CeedInt i=0; i<numinputfields; i++) {
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    if (emode == CEED_EVAL_WEIGHT) {
+      CeedOperatorField *opinputfields;
+      CeedBasis basis;
+      Ceed ceed;
+      Ceed_Opt *ceedimpl;
+      ierr = CeedOperatorGetFields(op, &opinputfields, NULL); CeedChk(ierr);
+      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
+      ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+      ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
+      ierr = CeedBasisApply(basis, ceedimpl->blksize, CEED_NOTRANSPOSE,
+                            CEED_EVAL_WEIGHT, CEED_VECTOR_NONE,
+                            impl->qvecsin[i]); CeedChk(ierr);
+    }
   }
   return 0;
 }
@@ -162,12 +347,14 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
   CeedChk(ierr);
   ierr = CeedCalloc(numinputfields + numoutputfields, &impl->edata);
   CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->elowdata); CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->inplace); CeedChk(ierr);
 
-  ierr = CeedCalloc(16, &impl->inputstate); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->evecsin); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->evecsout); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->qvecsin); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->qvecsout); CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->inputstate); CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->evecsin); CeedChk(ierr);
+  ierr = CeedCalloc(numoutputfields, &impl->evecsout); CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->qvecsin); CeedChk(ierr);
+  ierr = CeedCalloc(numoutputfields, &impl->qvecsout); CeedChk(ierr);
 
   impl->numein = numinputfields; impl->numeout = numoutputfields;
 
@@ -176,15 +363,73 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
   ierr = CeedOperatorSetupFields_Opt(qf, op, 0, blksize, impl->blkrestr,
                                      impl->evecs, impl->evecsin,
                                      impl->qvecsin, 0,
-                                     numinputfields, Q);
+                                     numinputfields, Q,
+                                     ceedimpl->evecsizemax);
   CeedChk(ierr);
   // Outfields
   ierr = CeedOperatorSetupFields_Opt(qf, op, 1, blksize, impl->blkrestr,
                                      impl->evecs, impl->evecsout,
                                      impl->qvecsout, numinputfields,
-                                     numoutputfields, Q);
+                                     numoutputfields, Q,
+                                     ceedimpl->evecsizemax);
   CeedChk(ierr);
 
+  // Reduced precision passive inputs
+  for (CeedInt i=0; i<numinputfields; i++) {
+    CeedStorageType storage;
+    ierr = CeedOperatorFieldGetStorage(opinputfields[i], &storage);
+    CeedChk(ierr);
+    if (storage != CEED_STORAGE_SCALAR) {
+      CeedInt nelem, size;
+      size_t bytes;
+      ierr = CeedOperatorGetNumElements(op, &nelem); CeedChk(ierr);
+      ierr = CeedQFunctionFieldGetSize(qfinputfields[i], &size); CeedChk(ierr);
+      ierr = CeedStorageGetSize(storage, &bytes); CeedChk(ierr);
+      const CeedInt nblks = (nelem/blksize) + !!(nelem%blksize);
+      ierr = CeedMallocHost(ceed, nblks*blksize*Q*size*bytes,
+                            (char **)&impl->elowdata[i]); CeedChk(ierr);
+      memset(impl->elowdata[i], 0, nblks*blksize*Q*size*bytes);
+    }
+  }
+
+  // Passive CEED_EVAL_NONE inputs with single element blocks and strides
+  //   matching the E-vector layout, such as CEED_STRIDES_BACKEND, are already
+  //   in element order, so they are read in place instead of restricted
+  for (CeedInt i=0; i<numinputfields && blksize == 1; i++) {
+    CeedEvalMode emode;
+    CeedVector vec;
+    CeedStorageType storage;
+    CeedElemRestriction r;
+    bool strided, backendstrides;
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    ierr = CeedOperatorFieldGetStorage(opinputfields[i], &storage);
+    CeedChk(ierr);
+    if (emode != CEED_EVAL_NONE || vec == CEED_VECTOR_ACTIVE ||
+        storage != CEED_STORAGE_SCALAR)
+      continue;
+    ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &r);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionIsStrided(r, &strided); CeedChk(ierr);
+    if (!strided)
+      continue;
+    ierr = CeedElemRestrictionHasBackendStrides(r, &backendstrides);
+    CeedChk(ierr);
+    if (!backendstrides) {
+      CeedInt strides[3], elemsize, ncomp;
+      ierr = CeedElemRestrictionGetStrides(r, &strides); CeedChk(ierr);
+      ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+      ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
+      backendstrides = strides[0] == 1 && strides[1] == elemsize &&
+                       strides[2] == elemsize*ncomp;
+    }
+    if (backendstrides) {
+      impl->inplace[i] = true;
+      ierr = CeedVectorDestroy(&impl->evecs[i]); CeedChk(ierr);
+    }
+  }
+
   // Identity QFunctions
   if (impl->identityqf) {
     CeedEvalMode inmode, outmode;
@@ -203,6 +448,11 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
     }
   }
 
+  // Block arena
+  ierr = CeedOperatorSetupArena_Opt(op, impl, qfinputfields, qfoutputfields,
+                                    numinputfields, numoutputfields);
+  CeedChk(ierr);
+
   ierr = CeedOperatorSetSetupDone(op); CeedChk(ierr);
 
   return 0;
@@ -226,7 +476,35 @@ static inline int CeedOperatorSetupInputs_Opt(CeedInt numinputfields,
     } else {
       // Get input vector
       ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
-      if (vec != CEED_VECTOR_ACTIVE) {
+      if (impl->elowdata[i]) {
+        // Restrict and round reduced precision input
+        ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
+        if (state != impl->inputstate[i]) {
+          CeedVector evec;
+          const CeedScalar *e;
+          CeedInt length;
+          CeedStorageType storage;
+          ierr = CeedOperatorFieldGetStorage(opinputfields[i], &storage);
+          CeedChk(ierr);
+          ierr = CeedElemRestrictionCreateVector(impl->blkrestr[i], NULL, &evec);
+          CeedChk(ierr);
+          ierr = CeedElemRestrictionApply(impl->blkrestr[i], CEED_NOTRANSPOSE,
+                                          vec, evec, request); CeedChk(ierr);
+          ierr = CeedVectorGetLength(evec, &length); CeedChk(ierr);
+          ierr = CeedVectorGetArrayRead(evec, CEED_MEM_HOST, &e); CeedChk(ierr);
+          ierr = CeedStorageNarrow(storage, length, e, impl->elowdata[i]);
+          CeedChk(ierr);
+          ierr = CeedVectorRestoreArrayRead(evec, &e); CeedChk(ierr);
+          ierr = CeedVectorDestroy(&evec); CeedChk(ierr);
+          impl->inputstate[i] = state;
+        }
+      }
+      if (impl->inplace[i]) {
+        // Read in place
+        ierr = CeedVectorGetArrayRead(vec, CEED_MEM_HOST,
+                                      (const CeedScalar **) &impl->edata[i]);
+        CeedChk(ierr);
+      } else if (impl->evecs[i]) {
         // Restrict
         ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
         if (state != impl->inputstate[i]) {
@@ -236,7 +514,7 @@ static inline int CeedOperatorSetupInputs_Opt(CeedInt numinputfields,
           impl->inputstate[i] = state;
         }
       } else {
-        // Set Qvec for CEED_EVAL_NONE
+        // Set Qvec for CEED_EVAL_NONE, restricted block by block
         if (emode == CEED_EVAL_NONE) {
           ierr = CeedVectorGetArray(impl->evecsin[i], CEED_MEM_HOST,
                                     &impl->edata[i]); CeedChk(ierr);
@@ -248,9 +526,11 @@ static inline int CeedOperatorSetupInputs_Opt(CeedInt numinputfields,
         }
       }
       // Get evec
-      ierr = CeedVectorGetArrayRead(impl->evecs[i], CEED_MEM_HOST,
-                                    (const CeedScalar **) &impl->edata[i]);
-      CeedChk(ierr);
+      if (impl->evecs[i]) {
+        ierr = CeedVectorGetArrayRead(impl->evecs[i], CEED_MEM_HOST,
+                                      (const CeedScalar **) &impl->edata[i]);
+        CeedChk(ierr);
+      }
     }
   }
   return 0;
@@ -278,7 +558,7 @@ static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q,
         continue;
     }
 
-    CeedInt activein = 0;
+    CeedInt blockin = 0;
     // Get elemsize, emode, size
     ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
     CeedChk(ierr);
@@ -287,27 +567,49 @@ static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q,
     ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
     CeedChk(ierr);
     ierr = CeedQFunctionFieldGetSize(qfinputfields[i], &size); CeedChk(ierr);
-    // Restrict block active input
-    if (vec == CEED_VECTOR_ACTIVE) {
+    // Widen block of reduced precision input
+    if (impl->elowdata[i]) {
+      CeedStorageType storage;
+      size_t bytes;
+      CeedScalar *edata;
+      ierr = CeedOperatorFieldGetStorage(opinputfields[i], &storage);
+      CeedChk(ierr);
+      ierr = CeedStorageGetSize(storage, &bytes); CeedChk(ierr);
+      ierr = CeedVectorGetArray(impl->evecsin[i], CEED_MEM_HOST, &edata);
+      CeedChk(ierr);
+      ierr = CeedStorageWiden(storage, blksize*Q*size,
+                              (char *)impl->elowdata[i] + e*Q*size*bytes, edata);
+      CeedChk(ierr);
+      ierr = CeedVectorRestoreArray(impl->evecsin[i], &edata); CeedChk(ierr);
+      blockin = 1;
+    } else if (emode != CEED_EVAL_WEIGHT && !impl->evecs[i] &&
+               !impl->inplace[i]) {
+      // Restrict block of active or uncached passive input
+      if (vec == CEED_VECTOR_ACTIVE)
+        vec = invec;
       ierr = CeedElemRestrictionApplyBlock(impl->blkrestr[i], e/blksize,
-                                           CEED_NOTRANSPOSE, invec,
+                                           CEED_NOTRANSPOSE, vec,
                                            impl->evecsin[i], request);
       CeedChk(ierr);
-      activein = 1;
+      blockin = 1;
     }
     // Basis action
     switch(emode) {
     case CEED_EVAL_NONE:
-      if (!activein) {
-        ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_HOST,
-                                  CEED_USE_POINTER,
-                                  &impl->edata[i][e*Q*size]); CeedChk(ierr);
+      if (!blockin) {
+        impl->qdatain[i] = &impl->edata[i][e*Q*size];
+        // Assembly and identity QFunctions still read the Q-vector
+        if (skipactive || impl->identityqf) {
+          ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_HOST,
+                                    CEED_USE_POINTER,
+                                    &impl->edata[i][e*Q*size]); CeedChk(ierr);
+        }
       }
       break;
     case CEED_EVAL_INTERP:
       ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis);
       CeedChk(ierr);
-      if (!activein) {
+      if (!blockin) {
         ierr = CeedVectorSetArray(impl->evecsin[i], CEED_MEM_HOST,
                                   CEED_USE_POINTER,
                                   &impl->edata[i][e*elemsize*size]);
@@ -320,7 +622,7 @@ static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q,
     case CEED_EVAL_GRAD:
       ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis);
       CeedChk(ierr);
-      if (!activein) {
+      if (!blockin) {
         ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
         ierr = CeedVectorSetArray(impl->evecsin[i], CEED_MEM_HOST,
                                   CEED_USE_POINTER,
@@ -423,11 +725,17 @@ static inline int CeedOperatorRestoreInputs_Opt(CeedInt numinputfields,
     CeedOperator_Opt *impl) {
   CeedInt ierr;
   CeedEvalMode emode;
+  CeedVector vec;
 
   for (CeedInt i=0; i<numinputfields; i++) {
     ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
     CeedChk(ierr);
-    if (emode == CEED_EVAL_WEIGHT) { // Skip
+    if (impl->inplace[i]) {
+      ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+      ierr = CeedVectorRestoreArrayRead(vec,
+                                        (const CeedScalar **) &impl->edata[i]);
+      CeedChk(ierr);
+    } else if (emode == CEED_EVAL_WEIGHT || !impl->evecs[i]) { // Skip
     } else {
       ierr = CeedVectorRestoreArrayRead(impl->evecs[i],
                                         (const CeedScalar **) &impl->edata[i]);
@@ -438,10 +746,10 @@ static inline int CeedOperatorRestoreInputs_Opt(CeedInt numinputfields,
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Operator Apply to Multiple Vectors
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector invec,
-                                    CeedVector outvec, CeedRequest *request) {
+static int CeedOperatorApplyAddMultiple_Opt(CeedOperator op, CeedInt nvecs,
+    CeedVector *invecs, CeedVector *outvecs, CeedRequest *request) {
   int ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
@@ -464,53 +772,36 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector invec,
   CeedQFunctionField *qfinputfields, *qfoutputfields;
   ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
   CeedChk(ierr);
-  CeedEvalMode emode;
 
   // Setup
   ierr = CeedOperatorSetup_Opt(op); CeedChk(ierr);
 
   // Input Evecs and Restriction
   ierr = CeedOperatorSetupInputs_Opt(numinputfields, qfinputfields,
-                                     opinputfields, invec, impl, request);
+                                     opinputfields, invecs[0], impl, request);
   CeedChk(ierr);
 
-  // Output Lvecs, Evecs, and Qvecs
-  for (CeedInt i=0; i<numoutputfields; i++) {
-    // Set Qvec if needed
-    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
-    CeedChk(ierr);
-    if (emode == CEED_EVAL_NONE) {
-      // Set qvec to single block evec
-      ierr = CeedVectorGetArray(impl->evecsout[i], CEED_MEM_HOST,
-                                &impl->edata[i + numinputfields]);
-      CeedChk(ierr);
-      ierr = CeedVectorSetArray(impl->qvecsout[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                impl->edata[i + numinputfields]); CeedChk(ierr);
-      ierr = CeedVectorRestoreArray(impl->evecsout[i],
-                                    &impl->edata[i + numinputfields]);
-      CeedChk(ierr);
-    }
-  }
-
-  // Loop through elements
+  // Loop through elements, applying each block to all vectors while its
+  //   passive input data is in cache
   for (CeedInt e=0; e<nblks*blksize; e+=blksize) {
-    // Input basis apply
-    ierr = CeedOperatorInputBasis_Opt(e, Q, qfinputfields, opinputfields,
-                                      numinputfields, blksize, invec, false,
-                                      impl, request); CeedChk(ierr);
+    for (CeedInt v=0; v<nvecs; v++) {
+      // Input basis apply
+      ierr = CeedOperatorInputBasis_Opt(e, Q, qfinputfields, opinputfields,
+                                        numinputfields, blksize, invecs[v],
+                                        false, impl, request); CeedChk(ierr);
 
-    // Q function
-    if (!impl->identityqf) {
-      ierr = CeedQFunctionApply(qf, Q*blksize, impl->qvecsin, impl->qvecsout);
-      CeedChk(ierr);
-    }
+      // Q function
+      if (!impl->identityqf) {
+        ierr = CeedQFunctionApplyRaw(qf, Q*blksize, impl->qdatain,
+                                     impl->qdataout); CeedChk(ierr);
+      }
 
-    // Output basis apply and restrict
-    ierr = CeedOperatorOutputBasis_Opt(e, Q, qfoutputfields, opoutputfields,
-                                       blksize, numinputfields, numoutputfields,
-                                       op, outvec, impl, request);
-    CeedChk(ierr);
+      // Output basis apply and restrict
+      ierr = CeedOperatorOutputBasis_Opt(e, Q, qfoutputfields, opoutputfields,
+                                         blksize, numinputfields,
+                                         numoutputfields, op, outvecs[v], impl,
+                                         request); CeedChk(ierr);
+    }
   }
 
   // Restore input arrays
@@ -522,10 +813,20 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector invec,
 }
 
 //------------------------------------------------------------------------------
-// Assemble Linear QFunction
+// Operator Apply
 //------------------------------------------------------------------------------
-static int CeedOperatorLinearAssembleQFunction_Opt(CeedOperator op,
-    CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector invec,
+                                    CeedVector outvec, CeedRequest *request) {
+  return CeedOperatorApplyAddMultiple_Opt(op, 1, &invec, &outvec, request);
+}
+
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction, creating the restriction and vector on build or
+//   refilling the given ones on update
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op,
+    bool buildobjects, CeedVector *assembled, CeedElemRestriction *rstr,
+    CeedRequest *request) {
   int ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
@@ -608,20 +909,29 @@ static int CeedOperatorLinearAssembleQFunction_Opt(CeedOperator op,
                      "and outputs");
   // LCOV_EXCL_STOP
 
-  // Setup lvec
-  ierr = CeedVectorCreate(ceed, nblks*blksize*Q*numactivein*numactiveout,
-                          &lvec); CeedChk(ierr);
+  // Setup blocked lvec and restriction, kept for updates
+  CeedInt strides[3] = {1, Q, numactivein *numactiveout*Q};
+  if (!impl->qflvec) {
+    ierr = CeedVectorCreate(ceed, nblks*blksize*Q*numactivein*numactiveout,
+                            &impl->qflvec); CeedChk(ierr);
+    ierr = CeedElemRestrictionCreateBlockedStrided(ceed, numelements, Q,
+           blksize, numactivein*numactiveout,
+           numactivein*numactiveout*numelements*Q, strides, &impl->qfblkrstr);
+    CeedChk(ierr);
+  }
+  lvec = impl->qflvec;
   ierr = CeedVectorGetArray(lvec, CEED_MEM_HOST, &a); CeedChk(ierr);
 
-  // Create output restriction
-  CeedInt strides[3] = {1, Q, numactivein *numactiveout*Q};
-  ierr = CeedElemRestrictionCreateStrided(ceed, numelements, Q,
-                                          numactivein*numactiveout,
-                                          numactivein*numactiveout*numelements*Q,
-                                          strides, rstr); CeedChk(ierr);
-  // Create assembled vector
-  ierr = CeedVectorCreate(ceed, numelements*Q*numactivein*numactiveout,
-                          assembled); CeedChk(ierr);
+  if (buildobjects) {
+    // Create output restriction
+    ierr = CeedElemRestrictionCreateStrided(ceed, numelements, Q,
+                                            numactivein*numactiveout,
+                                            numactivein*numactiveout*numelements*Q,
+                                            strides, rstr); CeedChk(ierr);
+    // Create assembled vector
+    ierr = CeedVectorCreate(ceed, numelements*Q*numactivein*numactiveout,
+                            assembled); CeedChk(ierr);
+  }
 
   // Loop through elements
   for (CeedInt e=0; e<nblks*blksize; e+=blksize) {
@@ -665,8 +975,9 @@ static int CeedOperatorLinearAssembleQFunction_Opt(CeedOperator op,
     CeedChk(ierr);
     // Check if active output
     if (vec == CEED_VECTOR_ACTIVE) {
-      CeedVectorSetArray(impl->qvecsout[out], CEED_MEM_HOST, CEED_COPY_VALUES,
-                         NULL); CeedChk(ierr);
+      ierr = CeedVectorSetArray(impl->qvecsout[out], CEED_MEM_HOST,
+                                CEED_USE_POINTER, impl->qdataout[out]);
+      CeedChk(ierr);
     }
   }
 
@@ -678,24 +989,36 @@ static int CeedOperatorLinearAssembleQFunction_Opt(CeedOperator op,
   // Output blocked restriction
   ierr = CeedVectorRestoreArray(lvec, &a); CeedChk(ierr);
   ierr = CeedVectorSetValue(*assembled, 0.0); CeedChk(ierr);
-  CeedElemRestriction blkrstr;
-  ierr = CeedElemRestrictionCreateBlockedStrided(ceed, numelements, Q, blksize,
-         numactivein*numactiveout, numactivein*numactiveout*numelements*Q,
-         strides, &blkrstr); CeedChk(ierr);
-  ierr = CeedElemRestrictionApply(blkrstr, CEED_TRANSPOSE, lvec, *assembled,
-                                  request); CeedChk(ierr);
+  ierr = CeedElemRestrictionApply(impl->qfblkrstr, CEED_TRANSPOSE, lvec,
+                                  *assembled, request); CeedChk(ierr);
 
   // Cleanup
   for (CeedInt i=0; i<numactivein; i++) {
     ierr = CeedVectorDestroy(&activein[i]); CeedChk(ierr);
   }
   ierr = CeedFree(&activein); CeedChk(ierr);
-  ierr = CeedVectorDestroy(&lvec); CeedChk(ierr);
-  ierr = CeedElemRestrictionDestroy(&blkrstr); CeedChk(ierr);
 
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunction_Opt(CeedOperator op,
+    CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+  return CeedOperatorLinearAssembleQFunctionCore_Opt(op, true, assembled, rstr,
+         request);
+}
+
+//------------------------------------------------------------------------------
+// Update Assembled Linear QFunction
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionUpdate_Opt(CeedOperator op,
+    CeedVector assembled, CeedElemRestriction rstr, CeedRequest *request) {
+  return CeedOperatorLinearAssembleQFunctionCore_Opt(op, false, &assembled,
+         &rstr, request);
+}
+
 //------------------------------------------------------------------------------
 // Operator Destroy
 //------------------------------------------------------------------------------
@@ -704,6 +1027,9 @@ static int CeedOperatorDestroy_Opt(CeedOperator op) {
   CeedOperator_Opt *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
 
+  ierr = CeedVectorDestroy(&impl->qflvec); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&impl->qfblkrstr); CeedChk(ierr);
+
   for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
     ierr = CeedElemRestrictionDestroy(&impl->blkrestr[i]); CeedChk(ierr);
     ierr = CeedVectorDestroy(&impl->evecs[i]); CeedChk(ierr);
@@ -713,6 +1039,14 @@ static int CeedOperatorDestroy_Opt(CeedOperator op) {
   ierr = CeedFree(&impl->edata); CeedChk(ierr);
   ierr = CeedFree(&impl->inputstate); CeedChk(ierr);
 
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  for (CeedInt i=0; i<impl->numein; i++) {
+    ierr = CeedFreeHost(ceed, &impl->elowdata[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->elowdata); CeedChk(ierr);
+  ierr = CeedFree(&impl->inplace); CeedChk(ierr);
+
   for (CeedInt i=0; i<impl->numein; i++) {
     ierr = CeedVectorDestroy(&impl->evecsin[i]); CeedChk(ierr);
     ierr = CeedVectorDestroy(&impl->qvecsin[i]); CeedChk(ierr);
@@ -726,6 +1060,12 @@ static int CeedOperatorDestroy_Opt(CeedOperator op) {
   }
   ierr = CeedFree(&impl->evecsout); CeedChk(ierr);
   ierr = CeedFree(&impl->qvecsout); CeedChk(ierr);
+  ierr = CeedTrackMemory(ceed, CEED_MEMORY_EVECTOR, CEED_MEMSPACE_HOST,
+                         -(ptrdiff_t)(impl->arenasize*sizeof(CeedScalar)));
+  CeedChk(ierr);
+  ierr = CeedFreeHost(ceed, &impl->arena); CeedChk(ierr);
+  ierr = CeedFree(&impl->qdatain); CeedChk(ierr);
+  ierr = CeedFree(&impl->qdataout); CeedChk(ierr);
 
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
@@ -738,24 +1078,22 @@ int CeedOperatorCreate_Opt(CeedOperator op) {
   int ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-  Ceed_Opt *ceedimpl;
-  ierr = CeedGetData(ceed, &ceedimpl); CeedChk(ierr);
-  CeedInt blksize = ceedimpl->blksize;
   CeedOperator_Opt *impl;
 
   ierr = CeedCalloc(1, &impl); CeedChk(ierr);
   ierr = CeedOperatorSetData(op, impl); CeedChk(ierr);
 
-  if (blksize != 1 && blksize != 8)
-    // LCOV_EXCL_START
-    return CeedError(ceed, 1, "Opt backend cannot use blocksize: %d", blksize);
-  // LCOV_EXCL_STOP
-
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction",
                                 CeedOperatorLinearAssembleQFunction_Opt);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op,
+                                "LinearAssembleQFunctionUpdate",
+                                CeedOperatorLinearAssembleQFunctionUpdate_Opt);
+  CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
                                 CeedOperatorApplyAdd_Opt); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddMultiple",
+                                CeedOperatorApplyAddMultiple_Opt); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
                                 CeedOperatorDestroy_Opt); CeedChk(ierr);
   return 0;
@@ -17,8 +17,13 @@
 #include <ceed-backend.h>
 #include <string.h>
 
+// Default number of scalars above which a passive input E-vector is no longer
+//   cached in full but restricted block by block during the element loop
+#define CEED_OPT_EVEC_CACHE_SIZE (1 << 18)
+
 typedef struct {
   CeedInt blksize;
+  CeedInt evecsizemax; /// Largest passive input E-vector cached in full
 } Ceed_Opt;
 
 typedef struct {
@@ -31,13 +36,26 @@ typedef struct {
   CeedVector
   *evecs;   /// E-vectors needed to apply operator (input followed by outputs)
   CeedScalar **edata;
+  void **elowdata;       /// Reduced precision passive input E-vector data
+  bool *inplace;         /// Passive inputs read in place from their L-vector
   uint64_t *inputstate;  /// State counter of inputs
   CeedVector *evecsin;   /// Input E-vectors needed to apply operator
   CeedVector *evecsout;  /// Output E-vectors needed to apply operator
   CeedVector *qvecsin;   /// Input Q-vectors needed to apply operator
   CeedVector *qvecsout;  /// Output Q-vectors needed to apply operator
+  CeedScalar *arena;     /// Block E- and Q-vector storage for all fields
+  size_t arenasize;      /// Number of CeedScalars in arena
+  const CeedScalar **qdatain; /// Q-point data of inputs for current block
+  CeedScalar **qdataout; /// Q-point data of outputs for current block
+  CeedVector qflvec;     /// Blocked assembled QFunction storage
+  CeedElemRestriction qfblkrstr; /// Blocked restriction of assembled QFunction
   CeedInt    numein;
   CeedInt    numeout;
 } CeedOperator_Opt;
 
+CEED_INTERN int CeedInitEVecCacheSize_Opt(Ceed ceed, Ceed_Opt *data);
+
+CEED_INTERN int CeedInitBlockSize_Opt(Ceed ceed, Ceed_Opt *data,
+                                      CeedInt blksize);
+
 CEED_INTERN int CeedOperatorCreate_Opt(CeedOperator op);
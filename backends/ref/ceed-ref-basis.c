@@ -16,6 +16,195 @@
 
 #include "ceed-ref.h"
 
+//------------------------------------------------------------------------------
+// Collapsed Coordinate Sweep
+//   Contract one component over the collapsed coordinates of a simplex, the
+//   last coordinate first; the tuples of earlier mode degrees of coordinate l
+//   have total degrees sums[l][0..nsums[l]-1]
+//------------------------------------------------------------------------------
+static int CeedBasisCollapsedSweep_Ref(CeedTensorContract contract,
+                                       CeedInt dim, CeedInt P1d, CeedInt Q1d,
+                                       CeedInt nelem, const CeedInt *nsums,
+                                       const CeedInt *const *sums,
+                                       const CeedScalar *const *t,
+                                       CeedTransposeMode tmode, CeedInt add,
+                                       const CeedScalar *u, CeedScalar *v,
+                                       CeedScalar *const *tmp) {
+  int ierr;
+  const CeedScalar *in = u;
+  for (CeedInt k=0; k<dim; k++) {
+    CeedInt l = tmode == CEED_TRANSPOSE ? k : dim-1-k;
+    CeedInt C = CeedIntPow(Q1d, dim-1-l)*nelem;
+    CeedScalar *out = k == dim-1 ? v : tmp[k%2], *o = out;
+    const CeedScalar *i = in;
+    for (CeedInt j=0; j<nsums[l]; j++) {
+      CeedInt s = sums[l][j], B = P1d - s;
+      const CeedScalar *tl = t[l] + Q1d*(s*P1d - s*(s-1)/2);
+      if (tmode == CEED_TRANSPOSE) {
+        ierr = CeedTensorContractApply(contract, 1, Q1d, C, B, tl, tmode,
+                                       k == dim-1 && add, i, o); CeedChk(ierr);
+        i += Q1d*C; o += B*C;
+      } else {
+        ierr = CeedTensorContractApply(contract, 1, B, C, Q1d, tl, tmode,
+                                       k == dim-1 && add, i, o); CeedChk(ierr);
+        i += B*C; o += Q1d*C;
+      }
+    }
+    in = out;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Collapsed Coordinate Cost
+//   Multiply-adds of sum factorization over the collapsed coordinates relative
+//   to the dense matrices; low orders are cheaper with the dense matrices
+//------------------------------------------------------------------------------
+static bool CeedBasisCollapsedIsCheaper_Ref(CeedInt dim, CeedInt P1d,
+    CeedInt Q1d, CeedInt nnodes, CeedInt nqpt, CeedEvalMode emode) {
+  const CeedInt ndir = emode == CEED_EVAL_GRAD ? dim : 1;
+  CeedInt sweep = 0, ntuples = 1;
+  for (CeedInt l=0; l<dim; l++) {
+    // Number of mode degree tuples of length l+1 with total degree below P1d
+    ntuples = ntuples*(P1d - 1 + l + 1)/(l + 1);
+    sweep += ntuples*CeedIntPow(Q1d, dim-l);
+  }
+  return nnodes*nnodes + ndir*sweep + (ndir > 1 ? dim*dim*nqpt : 0)
+         < ndir*nqpt*nnodes;
+}
+
+//------------------------------------------------------------------------------
+// Basis Apply Collapsed Simplex
+//   Interpolation and gradients by sum factorization over the collapsed
+//   coordinates, after mapping nodal values to modal coefficients
+//------------------------------------------------------------------------------
+static int CeedBasisApplyCollapsed_Ref(CeedBasis basis, CeedInt nelem,
+                                       CeedTransposeMode tmode,
+                                       CeedEvalMode emode,
+                                       const CeedScalar *u, CeedScalar *v) {
+  int ierr;
+  CeedInt dim, ncomp, nnodes, nqpt, P1d, Q1d;
+  const CeedScalar *vinv, *interpc, *gradc, *detadx;
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes(basis, &nnodes); CeedChk(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints(basis, &nqpt); CeedChk(ierr);
+  ierr = CeedBasisGetCollapsedSimplex(basis, &P1d, &Q1d, &vinv, &interpc,
+                                      &gradc, &detadx); CeedChk(ierr);
+  CeedTensorContract contract;
+  ierr = CeedBasisGetTensorContract(basis, &contract); CeedChk(ierr);
+  const CeedInt add = (tmode == CEED_TRANSPOSE), ntab = Q1d*P1d*(P1d+1)/2;
+
+  // Total degrees of the tuples of mode degrees before each coordinate
+  CeedInt nsums[dim+1], sumsdata[(dim+1)*nnodes], tmpsize = 0;
+  CeedInt *sums[dim+1];
+  for (CeedInt l=0; l<=dim; l++)
+    sums[l] = &sumsdata[l*nnodes];
+  nsums[0] = 1; sums[0][0] = 0;
+  for (CeedInt l=1; l<=dim; l++) {
+    nsums[l] = 0;
+    for (CeedInt j=0; j<nsums[l-1]; j++)
+      for (CeedInt p=0; p<P1d-sums[l-1][j]; p++)
+        sums[l][nsums[l]++] = sums[l-1][j] + p;
+  }
+  for (CeedInt l=0; l<dim; l++)
+    tmpsize = CeedIntMax(tmpsize, CeedIntMax(nsums[l]*CeedIntPow(Q1d, dim-l),
+                         nsums[l+1]*CeedIntPow(Q1d, dim-1-l)));
+  CeedScalar modal[ncomp*nnodes*nelem] CEED_ALIGNED,
+             tmpdata[2][CeedPadLength(tmpsize*nelem)] CEED_ALIGNED;
+  CeedScalar *const tmp[2] = {tmpdata[0], tmpdata[1]};
+  const CeedScalar *tinterp[dim];
+  for (CeedInt l=0; l<dim; l++)
+    tinterp[l] = interpc + l*ntab;
+
+  switch (emode) {
+  case CEED_EVAL_INTERP:
+    if (tmode == CEED_TRANSPOSE) {
+      for (CeedInt c=0; c<ncomp; c++) {
+        ierr = CeedBasisCollapsedSweep_Ref(contract, dim, P1d, Q1d, nelem,
+                                           nsums, (const CeedInt *const *)sums,
+                                           tinterp, tmode, 0,
+                                           u + c*nqpt*nelem,
+                                           modal + c*nnodes*nelem, tmp);
+        CeedChk(ierr);
+      }
+      ierr = CeedTensorContractApply(contract, ncomp, nnodes, nelem, nnodes,
+                                     vinv, tmode, add, modal, v); CeedChk(ierr);
+    } else {
+      ierr = CeedTensorContractApply(contract, ncomp, nnodes, nelem, nnodes,
+                                     vinv, tmode, add, u, modal); CeedChk(ierr);
+      for (CeedInt c=0; c<ncomp; c++) {
+        ierr = CeedBasisCollapsedSweep_Ref(contract, dim, P1d, Q1d, nelem,
+                                           nsums, (const CeedInt *const *)sums,
+                                           tinterp, tmode, add,
+                                           modal + c*nnodes*nelem,
+                                           v + c*nqpt*nelem, tmp);
+        CeedChk(ierr);
+      }
+    }
+    break;
+  case CEED_EVAL_GRAD: {
+    // Derivatives in the collapsed coordinates, mapped to the reference
+    //   coordinates pointwise
+    const CeedInt dimstride = ncomp*nqpt*nelem;
+    CeedScalar deta[dim][CeedPadLength(nqpt*nelem)] CEED_ALIGNED;
+    if (tmode != CEED_TRANSPOSE) {
+      ierr = CeedTensorContractApply(contract, ncomp, nnodes, nelem, nnodes,
+                                     vinv, tmode, 0, u, modal); CeedChk(ierr);
+    }
+    for (CeedInt c=0; c<ncomp; c++) {
+      if (tmode == CEED_TRANSPOSE)
+        for (CeedInt m=0; m<dim; m++)
+          for (CeedInt q=0; q<nqpt; q++)
+            for (CeedInt e=0; e<nelem; e++) {
+              CeedScalar sum = 0;
+              for (CeedInt a=0; a<dim; a++)
+                sum += detadx[(q*dim+a)*dim+m]*
+                       u[a*dimstride + (c*nqpt+q)*nelem + e];
+              deta[m][q*nelem+e] = sum;
+            }
+      for (CeedInt m=0; m<dim; m++) {
+        const CeedScalar *t[dim];
+        for (CeedInt l=0; l<dim; l++)
+          t[l] = l == m ? gradc + l*ntab : tinterp[l];
+        if (tmode == CEED_TRANSPOSE) {
+          ierr = CeedBasisCollapsedSweep_Ref(contract, dim, P1d, Q1d, nelem,
+                                             nsums,
+                                             (const CeedInt *const *)sums, t,
+                                             tmode, m > 0, deta[m],
+                                             modal + c*nnodes*nelem, tmp);
+        } else {
+          ierr = CeedBasisCollapsedSweep_Ref(contract, dim, P1d, Q1d, nelem,
+                                             nsums,
+                                             (const CeedInt *const *)sums, t,
+                                             tmode, 0, modal + c*nnodes*nelem,
+                                             deta[m], tmp);
+        }
+        CeedChk(ierr);
+      }
+      if (tmode != CEED_TRANSPOSE)
+        for (CeedInt a=0; a<dim; a++)
+          for (CeedInt q=0; q<nqpt; q++)
+            for (CeedInt e=0; e<nelem; e++) {
+              CeedScalar sum = 0;
+              for (CeedInt m=0; m<dim; m++)
+                sum += detadx[(q*dim+a)*dim+m]*deta[m][q*nelem+e];
+              v[a*dimstride + (c*nqpt+q)*nelem + e] = sum;
+            }
+    }
+    if (tmode == CEED_TRANSPOSE) {
+      ierr = CeedTensorContractApply(contract, ncomp, nnodes, nelem, nnodes,
+                                     vinv, tmode, add, modal, v); CeedChk(ierr);
+    }
+  } break;
+  // LCOV_EXCL_START
+  default:
+    break;
+    // LCOV_EXCL_STOP
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Basis Apply
 //------------------------------------------------------------------------------
@@ -53,6 +242,10 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
   }
   bool tensorbasis;
   ierr = CeedBasisIsTensor(basis, &tensorbasis); CeedChk(ierr);
+  CeedInt P1dc, Q1dc;
+  const CeedScalar *vinv, *interpc, *gradc, *detadx;
+  ierr = CeedBasisGetCollapsedSimplex(basis, &P1dc, &Q1dc, &vinv, &interpc,
+                                      &gradc, &detadx); CeedChk(ierr);
   // Tensor basis
   if (tensorbasis) {
     CeedInt P1d, Q1d;
@@ -70,19 +263,11 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
         if (tmode == CEED_TRANSPOSE) {
           P = Q1d; Q = P1d;
         }
-        CeedInt pre = ncomp*CeedIntPow(P, dim-1), post = nelem;
-        CeedScalar tmp[2][nelem*ncomp*Q*CeedIntPow(P>Q?P:Q, dim-1)];
         const CeedScalar *interp1d;
         ierr = CeedBasisGetInterp1D(basis, &interp1d); CeedChk(ierr);
-        for (CeedInt d=0; d<dim; d++) {
-          ierr = CeedTensorContractApply(contract, pre, P, post, Q,
-                                         interp1d, tmode, add&&(d==dim-1),
-                                         d==0?u:tmp[d%2],
-                                         d==dim-1?v:tmp[(d+1)%2]);
-          CeedChk(ierr);
-          pre /= P;
-          post *= Q;
-        }
+        const CeedScalar *t[3] = {interp1d, interp1d, interp1d};
+        ierr = CeedTensorContractApplyFull(contract, dim, ncomp, P, Q, nelem, t,
+                                           tmode, add, u, v); CeedChk(ierr);
       }
     } break;
     // Evaluate the gradient to/from quadrature points
@@ -101,49 +286,38 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
       const CeedScalar *interp1d;
       ierr = CeedBasisGetInterp1D(basis, &interp1d); CeedChk(ierr);
       if (impl->collograd1d) {
-        CeedScalar tmp[2][nelem*ncomp*Q*CeedIntPow(P>Q?P:Q, dim-1)];
-        CeedScalar interp[nelem*ncomp*Q*CeedIntPow(P>Q?P:Q, dim-1)];
+        CeedScalar interp[nelem*ncomp*nqpt] CEED_ALIGNED;
+        const CeedScalar *t[3] = {interp1d, interp1d, interp1d};
         // Interpolate to quadrature points (NoTranspose)
-        //  or Grad to quadrature points (Transpose)
-        for (CeedInt d=0; d<dim; d++) {
-          ierr = CeedTensorContractApply(contract, pre, P, post, Q,
-                                         (tmode == CEED_NOTRANSPOSE
-                                          ? interp1d
-                                          : impl->collograd1d),
-                                         tmode, add&&(d>0),
-                                         (tmode == CEED_NOTRANSPOSE
-                                          ? (d==0?u:tmp[d%2])
-                                          : u + d*nqpt*ncomp*nelem),
-                                         (tmode == CEED_NOTRANSPOSE
-                                          ? (d==dim-1?interp:tmp[(d+1)%2])
-                                          : interp));
+        if (tmode == CEED_NOTRANSPOSE) {
+          ierr = CeedTensorContractApplyFull(contract, dim, ncomp, P1d, Q1d,
+                                             nelem, t, tmode, false, u, interp);
           CeedChk(ierr);
-          pre /= P;
-          post *= Q;
         }
         // Grad to quadrature points (NoTranspose)
-        //  or Interpolate to nodes (Transpose)
+        //  or Grad from quadrature points (Transpose)
         P = Q1d, Q = Q1d;
-        if (tmode == CEED_TRANSPOSE) {
-          P = Q1d, Q = P1d;
-        }
-        pre = ncomp*CeedIntPow(P, dim-1), post = nelem;
+        pre = ncomp*CeedIntPow(Q1d, dim-1), post = nelem;
         for (CeedInt d=0; d<dim; d++) {
           ierr = CeedTensorContractApply(contract, pre, P, post, Q,
-                                         (tmode == CEED_NOTRANSPOSE
-                                          ? impl->collograd1d
-                                          : interp1d),
-                                         tmode, add&&(d==dim-1),
+                                         impl->collograd1d, tmode,
+                                         tmode == CEED_TRANSPOSE && d>0,
                                          (tmode == CEED_NOTRANSPOSE
                                           ? interp
-                                          : (d==0?interp:tmp[d%2])),
+                                          : u + d*nqpt*ncomp*nelem),
                                          (tmode == CEED_NOTRANSPOSE
                                           ? v + d*nqpt*ncomp*nelem
-                                          : (d==dim-1?v:tmp[(d+1)%2])));
+                                          : interp));
           CeedChk(ierr);
           pre /= P;
           post *= Q;
         }
+        // Interpolate to nodes (Transpose)
+        if (tmode == CEED_TRANSPOSE) {
+          ierr = CeedTensorContractApplyFull(contract, dim, ncomp, Q1d, P1d,
+                                             nelem, t, tmode, add, interp, v);
+          CeedChk(ierr);
+        }
       } else if (impl->collointerp) { // Qpts collocated with nodes
         const CeedScalar *grad1d;
         ierr = CeedBasisGetGrad1D(basis, &grad1d); CeedChk(ierr);
@@ -161,34 +335,25 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
           pre /= P;
           post *= Q;
         }
-      } else { // Underintegration, P > Q
+      } else { // Underintegration, P > Q, or collocated grad is costlier
         const CeedScalar *grad1d;
         ierr = CeedBasisGetGrad1D(basis, &grad1d); CeedChk(ierr);
 
         if (tmode == CEED_TRANSPOSE) {
           P = Q1d, Q = P1d;
         }
-        CeedScalar tmp[2][nelem*ncomp*Q*CeedIntPow(P>Q?P:Q, dim-1)];
 
         // Dim**2 contractions, apply grad when pass == dim
         for (CeedInt p=0; p<dim; p++) {
-          CeedInt pre = ncomp*CeedIntPow(P, dim-1), post = nelem;
-          for (CeedInt d=0; d<dim; d++) {
-            ierr = CeedTensorContractApply(contract, pre, P, post, Q,
-                                           (p==d)? grad1d : interp1d,
-                                           tmode, add&&(d==dim-1),
-                                           (d == 0
-                                            ? (tmode == CEED_NOTRANSPOSE
-                                               ? u : u+p*ncomp*nqpt*nelem)
-                                            : tmp[d%2]),
-                                           (d == dim-1
-                                            ? (tmode == CEED_TRANSPOSE
-                                               ? v : v+p*ncomp*nqpt*nelem)
-                                            : tmp[(d+1)%2]));
-            CeedChk(ierr);
-            pre /= P;
-            post *= Q;
-          }
+          const CeedScalar *t[3] = {interp1d, interp1d, interp1d};
+          t[p] = grad1d;
+          ierr = CeedTensorContractApplyFull(contract, dim, ncomp, P, Q, nelem,
+                                             t, tmode, add,
+                                             tmode == CEED_NOTRANSPOSE
+                                             ? u : u+p*ncomp*nqpt*nelem,
+                                             tmode == CEED_TRANSPOSE
+                                             ? v : v+p*ncomp*nqpt*nelem);
+          CeedChk(ierr);
         }
       }
     } break;
@@ -227,6 +392,12 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
                        "CEED_EVAL_NONE does not make sense in this context");
       // LCOV_EXCL_STOP
     }
+  } else if (vinv && (emode == CEED_EVAL_INTERP || emode == CEED_EVAL_GRAD)
+             && CeedBasisCollapsedIsCheaper_Ref(dim, P1dc, Q1dc, nnodes, nqpt,
+                 emode)) {
+    // Simplex basis with collapsed coordinate structure
+    ierr = CeedBasisApplyCollapsed_Ref(basis, nelem, tmode, emode, u, v);
+    CeedChk(ierr);
   } else {
     // Non-tensor basis
     switch (emode) {
@@ -250,7 +421,17 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
       CeedInt gradstride = nqpt * nnodes;
       const CeedScalar *grad;
       ierr = CeedBasisGetGrad(basis, &grad); CeedChk(ierr);
-      if (tmode == CEED_TRANSPOSE) {
+      // With one component the derivatives are stored one after another, as
+      //   are the rows of grad, so all directions are a single contraction
+      if (ncomp == 1) {
+        if (tmode == CEED_TRANSPOSE) {
+          P = dim*nqpt; Q = nnodes;
+        } else {
+          Q = dim*nqpt;
+        }
+        ierr = CeedTensorContractApply(contract, 1, P, nelem, Q, grad, tmode,
+                                       add, u, v); CeedChk(ierr);
+      } else if (tmode == CEED_TRANSPOSE) {
         P = nqpt; Q = nnodes;
         for (CeedInt d = 0; d < dim; d++) {
           ierr = CeedTensorContractApply(contract, ncomp, P, nelem, Q,
@@ -371,20 +552,22 @@ int CeedBasisCreateTensorH1_Ref(CeedInt dim, CeedInt P1d,
   CeedBasis_Ref *impl;
   ierr = CeedCalloc(1, &impl); CeedChk(ierr);
   // Check for collocated interp
-  if (Q1d == P1d) {
-    bool collocated = 1;
-    for (CeedInt i=0; i<P1d; i++) {
-      collocated = collocated && (fabs(interp1d[i+P1d*i] - 1.0) < 1e-14);
-      for (CeedInt j=0; j<P1d; j++)
-        if (j != i)
-          collocated = collocated && (fabs(interp1d[j+P1d*i]) < 1e-14);
-    }
-    impl->collointerp = collocated;
-  }
-  // Calculate collocated grad
+  ierr = CeedBasisIsCollocated(basis, &impl->collointerp); CeedChk(ierr);
+  // Calculate collocated grad, if interpolating to quadrature points and
+  //   differentiating there takes no more flops than dim contractions for
+  //   each derivative direction
   if (Q1d >= P1d && !impl->collointerp) {
-    ierr = CeedMalloc(Q1d*Q1d, &impl->collograd1d); CeedChk(ierr);
-    ierr = CeedBasisGetCollocatedGrad(basis, impl->collograd1d); CeedChk(ierr);
+    CeedInt interpflops = 0;
+    for (CeedInt d=0; d<dim; d++)
+      interpflops += CeedIntPow(P1d, dim-d)*CeedIntPow(Q1d, d+1);
+    const CeedInt colloflops = interpflops + dim*CeedIntPow(Q1d, dim+1);
+    if (colloflops <= dim*interpflops) {
+      ierr = CeedMalloc(Q1d*Q1d, &impl->collograd1d); CeedChk(ierr);
+      ierr = CeedBasisTrackMemory(basis, CEED_MEMSPACE_HOST,
+                                  Q1d*Q1d*sizeof(CeedScalar)); CeedChk(ierr);
+      ierr = CeedBasisGetCollocatedGrad(basis, impl->collograd1d);
+      CeedChk(ierr);
+    }
   }
   ierr = CeedBasisSetData(basis, impl); CeedChk(ierr);
 
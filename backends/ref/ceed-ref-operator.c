@@ -74,16 +74,21 @@ static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op,
       ierr = CeedVectorCreate(ceed, Q*size, &qvecs[i]); CeedChk(ierr);
       break;
     case CEED_EVAL_WEIGHT: // Only on input fields
-      ierr = CeedOperatorFieldGetBasis(opfields[i], &basis); CeedChk(ierr);
       ierr = CeedVectorCreate(ceed, Q, &qvecs[i]); CeedChk(ierr);
-      ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT,
-                            CEED_VECTOR_NONE, qvecs[i]); CeedChk(ierr);
       break;
     case CEED_EVAL_DIV:
       break; // Not implemented
     case CEED_EVAL_CURL:
       break; // Not implemented
     }
+
+    // Work vectors are accounted to the operator
+    ierr = CeedVectorSetMemoryClass(fullevecs[i+starte], CEED_MEMORY_EVECTOR);
+    CeedChk(ierr);
+    ierr = CeedVectorSetMemoryClass(evecs[i], CEED_MEMORY_EVECTOR);
+    CeedChk(ierr);
+    ierr = CeedVectorSetMemoryClass(qvecs[i], CEED_MEMORY_EVECTOR);
+    CeedChk(ierr);
   }
   return 0;
 }
@@ -120,11 +125,12 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
   ierr = CeedCalloc(numinputfields + numoutputfields, &impl->edata);
   CeedChk(ierr);
 
-  ierr = CeedCalloc(16, &impl->inputstate); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->evecsin); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->evecsout); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->qvecsin); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->qvecsout); CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->inputstate); CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->cachedevecs); CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->evecsin); CeedChk(ierr);
+  ierr = CeedCalloc(numoutputfields, &impl->evecsout); CeedChk(ierr);
+  ierr = CeedCalloc(numinputfields, &impl->qvecsin); CeedChk(ierr);
+  ierr = CeedCalloc(numoutputfields, &impl->qvecsout); CeedChk(ierr);
 
   impl->numein = numinputfields; impl->numeout = numoutputfields;
 
@@ -140,6 +146,85 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
                                      numinputfields, numoutputfields, Q);
   CeedChk(ierr);
 
+  // Field data for the element loop
+  ierr = CeedCalloc(numinputfields + numoutputfields, &impl->fields);
+  CeedChk(ierr);
+  for (CeedInt i=0; i<numinputfields + numoutputfields; i++) {
+    const bool isinput = i < numinputfields;
+    CeedOperatorField opfield = isinput ? opinputfields[i] :
+                                opoutputfields[i - numinputfields];
+    CeedQFunctionField qffield = isinput ? qfinputfields[i] :
+                                 qfoutputfields[i - numinputfields];
+    CeedOperatorField_Ref *field = &impl->fields[i];
+    CeedInt dim = 1, elemsize = 0;
+
+    ierr = CeedQFunctionFieldGetEvalMode(qffield, &field->emode); CeedChk(ierr);
+    ierr = CeedQFunctionFieldGetSize(qffield, &field->size); CeedChk(ierr);
+    ierr = CeedOperatorFieldGetBasis(opfield, &field->basis); CeedChk(ierr);
+    ierr = CeedOperatorFieldGetElemRestriction(opfield, &field->Erestrict);
+    CeedChk(ierr);
+    ierr = CeedOperatorFieldGetVector(opfield, &field->vec); CeedChk(ierr);
+    ierr = CeedOperatorFieldGetStorage(opfield, &field->storage); CeedChk(ierr);
+    if (field->emode != CEED_EVAL_WEIGHT) {
+      ierr = CeedElemRestrictionGetElementSize(field->Erestrict, &elemsize);
+      CeedChk(ierr);
+    }
+    // Interpolation with a collocated basis is the identity, so the E-vector
+    //   data is handed to the QFunction as is
+    if (field->emode == CEED_EVAL_INTERP && !impl->identityqf) {
+      bool collocated;
+      ierr = CeedBasisIsCollocated(field->basis, &collocated); CeedChk(ierr);
+      if (collocated)
+        field->emode = CEED_EVAL_NONE;
+    }
+    switch (field->emode) {
+    case CEED_EVAL_NONE:
+      field->elemstride = Q*field->size;
+      break;
+    case CEED_EVAL_GRAD:
+      ierr = CeedBasisGetDimension(field->basis, &dim); CeedChk(ierr);
+      field->elemstride = elemsize*field->size/dim;
+      break;
+    default:
+      field->elemstride = elemsize*field->size;
+      break;
+    }
+  }
+
+  // Passive inputs at full precision use the E-vector cached by their
+  //   restriction, unless an earlier input caches another vector with it;
+  //   their own E-vectors are only created if the cache is read for another
+  //   input when they are applied
+  for (CeedInt i=0; i<numinputfields; i++) {
+    CeedOperatorField_Ref *field = &impl->fields[i];
+    field->cached = field->emode != CEED_EVAL_WEIGHT &&
+                    field->vec != CEED_VECTOR_ACTIVE &&
+                    field->storage == CEED_STORAGE_SCALAR;
+    for (CeedInt j=0; j<i && field->cached; j++)
+      if (impl->fields[j].cached &&
+          impl->fields[j].Erestrict == field->Erestrict &&
+          impl->fields[j].vec != field->vec)
+        field->cached = false;
+    if (field->cached) {
+      ierr = CeedVectorDestroy(&impl->evecs[i]); CeedChk(ierr);
+    }
+  }
+
+  // Active inputs with the restriction of an earlier active input, such as
+  //   the values and gradients of one field, share its E-vector
+  for (CeedInt i=0; i<numinputfields; i++) {
+    CeedOperatorField_Ref *field = &impl->fields[i];
+    field->shared = -1;
+    for (CeedInt j=0; j<i && field->shared < 0; j++)
+      if (field->vec == CEED_VECTOR_ACTIVE &&
+          field->emode != CEED_EVAL_WEIGHT &&
+          impl->fields[j].vec == CEED_VECTOR_ACTIVE &&
+          impl->fields[j].emode != CEED_EVAL_WEIGHT &&
+          impl->fields[j].shared < 0 &&
+          impl->fields[j].Erestrict == field->Erestrict)
+        field->shared = j;
+  }
+
   // Identity QFunctions
   if (impl->identityqf) {
     CeedEvalMode inmode, outmode;
@@ -158,6 +243,67 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
     }
   }
 
+  // Q-vectors of basis evaluated fields use operator storage, so the element
+  //   loop hands the QFunction raw pointers instead of resetting Q-vectors
+  ierr = CeedCalloc(numinputfields, &impl->qdatain); CeedChk(ierr);
+  ierr = CeedCalloc(numoutputfields, &impl->qdataout); CeedChk(ierr);
+  CeedInt qsize = 0;
+  for (CeedInt i=0; i<numinputfields + numoutputfields; i++)
+    if (impl->fields[i].emode != CEED_EVAL_NONE &&
+        !(impl->identityqf && i >= numinputfields))
+      qsize += Q*impl->fields[i].size;
+  ierr = CeedMalloc(qsize, &impl->qstorage); CeedChk(ierr);
+  CeedScalar *qslot = impl->qstorage;
+  for (CeedInt i=0; i<numinputfields; i++) {
+    const CeedOperatorField_Ref *field = &impl->fields[i];
+    if (field->emode == CEED_EVAL_NONE)
+      continue;
+    ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_HOST,
+                              CEED_USE_POINTER, qslot); CeedChk(ierr);
+    impl->qdatain[i] = qslot;
+    qslot += Q*field->size;
+    if (field->emode == CEED_EVAL_WEIGHT) {
+      ierr = CeedBasisApply(field->basis, 1, CEED_NOTRANSPOSE,
+                            CEED_EVAL_WEIGHT, CEED_VECTOR_NONE,
+                            impl->qvecsin[i]); CeedChk(ierr);
+    }
+  }
+  for (CeedInt i=0; i<numoutputfields && !impl->identityqf; i++) {
+    const CeedOperatorField_Ref *field = &impl->fields[i + numinputfields];
+    if (field->emode == CEED_EVAL_NONE)
+      continue;
+    ierr = CeedVectorSetArray(impl->qvecsout[i], CEED_MEM_HOST,
+                              CEED_USE_POINTER, qslot); CeedChk(ierr);
+    impl->qdataout[i] = qslot;
+    qslot += Q*field->size;
+  }
+
+  // Tile of elements per QFunction call, sized to keep the QFunction data of
+  //   the tile in cache; the Q-point data of each element is gathered into
+  //   the tile, except single component CEED_EVAL_NONE fields whose E-vector
+  //   data for consecutive elements is already laid out as the tile
+  CeedInt numelements, qfsize = 0, tilesize = 0;
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  for (CeedInt i=0; i<numinputfields + numoutputfields; i++)
+    qfsize += impl->fields[i].size;
+  impl->tileelems = impl->identityqf ? 1 :
+                    CeedIntMax(1, CeedIntMin(numelements, CEED_REF_TILE_SIZE /
+                               (Q*qfsize*sizeof(CeedScalar))));
+  ierr = CeedCalloc(numinputfields + numoutputfields, &impl->tiledata);
+  CeedChk(ierr);
+  if (impl->tileelems > 1) {
+    for (CeedInt i=0; i<numinputfields + numoutputfields; i++)
+      if (impl->fields[i].emode != CEED_EVAL_NONE || impl->fields[i].size > 1)
+        tilesize += impl->tileelems*Q*impl->fields[i].size;
+    ierr = CeedMalloc(tilesize, &impl->tilestorage); CeedChk(ierr);
+    CeedScalar *tslot = impl->tilestorage;
+    for (CeedInt i=0; i<numinputfields + numoutputfields; i++)
+      if (impl->fields[i].emode != CEED_EVAL_NONE || impl->fields[i].size > 1) {
+        impl->tiledata[i] = tslot;
+        tslot += impl->tileelems*Q*impl->fields[i].size;
+      }
+  }
+
   ierr = CeedOperatorSetSetupDone(op); CeedChk(ierr);
 
   return 0;
@@ -167,42 +313,59 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
 // Setup Operator Inputs
 //------------------------------------------------------------------------------
 static inline int CeedOperatorSetupInputs_Ref(CeedInt numinputfields,
-    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
     CeedVector invec, const bool skipactive, CeedOperator_Ref *impl,
     CeedRequest *request) {
   CeedInt ierr;
-  CeedEvalMode emode;
-  CeedVector vec;
-  CeedElemRestriction Erestrict;
   uint64_t state;
 
   for (CeedInt i=0; i<numinputfields; i++) {
+    const CeedOperatorField_Ref *field = &impl->fields[i];
     // Get input vector
-    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    CeedVector vec = field->vec;
     if (vec == CEED_VECTOR_ACTIVE) {
       if (skipactive)
         continue;
       else
         vec = invec;
+      if (field->shared >= 0) {
+        impl->edata[i] = impl->edata[field->shared];
+        continue;
+      }
     }
 
-    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
-    CeedChk(ierr);
     // Restrict and Evec
-    if (emode == CEED_EVAL_WEIGHT) { // Skip
+    if (field->emode == CEED_EVAL_WEIGHT) { // Skip
     } else {
       // Restrict
       ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
-      // Skip restriction if input is unchanged
-      if (state != impl->inputstate[i] || vec == invec) {
-        ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
-        CeedChk(ierr);
-        ierr = CeedElemRestrictionApply(Erestrict, CEED_NOTRANSPOSE, vec,
-                                        impl->evecs[i], request); CeedChk(ierr);
+      if (field->cached) {
+        // Read the E-vector cached by the restriction, which other operators
+        //   restricting the same input share, unless it is read for another
+        //   input
+        ierr = CeedElemRestrictionGetCachedEVector(field->Erestrict, vec,
+               &impl->cachedevecs[i], request); CeedChk(ierr);
+        if (!impl->cachedevecs[i] && !impl->evecs[i]) {
+          ierr = CeedElemRestrictionCreateVector(field->Erestrict, NULL,
+                                                 &impl->evecs[i]);
+          CeedChk(ierr);
+          ierr = CeedVectorSetMemoryClass(impl->evecs[i], CEED_MEMORY_EVECTOR);
+          CeedChk(ierr);
+          impl->inputstate[i] = 0;
+        }
+      }
+      CeedVector evec = impl->cachedevecs[i] ? impl->cachedevecs[i] :
+                        impl->evecs[i];
+      if (!impl->cachedevecs[i] &&
+          (state != impl->inputstate[i] || vec == invec)) {
+        // Skip restriction if input is unchanged
+        ierr = CeedElemRestrictionApply(field->Erestrict, CEED_NOTRANSPOSE, vec,
+                                        evec, request); CeedChk(ierr);
         impl->inputstate[i] = state;
+        // Round reduced precision passive inputs
+        ierr = CeedVectorRoundToStorage(evec, field->storage); CeedChk(ierr);
       }
       // Get evec
-      ierr = CeedVectorGetArrayRead(impl->evecs[i], CEED_MEM_HOST,
+      ierr = CeedVectorGetArrayRead(evec, CEED_MEM_HOST,
                                     (const CeedScalar **) &impl->edata[i]);
       CeedChk(ierr);
     }
@@ -213,68 +376,43 @@ static inline int CeedOperatorSetupInputs_Ref(CeedInt numinputfields,
 //------------------------------------------------------------------------------
 // Input Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q,
-    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
+static inline int CeedOperatorInputBasis_Ref(CeedInt e,
     CeedInt numinputfields, const bool skipactive, CeedOperator_Ref *impl) {
   CeedInt ierr;
-  CeedInt dim, elemsize, size;
-  CeedElemRestriction Erestrict;
-  CeedEvalMode emode;
-  CeedBasis basis;
 
   for (CeedInt i=0; i<numinputfields; i++) {
+    const CeedOperatorField_Ref *field = &impl->fields[i];
     // Skip active input
-    if (skipactive) {
-      CeedVector vec;
-      ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
-      if (vec == CEED_VECTOR_ACTIVE)
-        continue;
-    }
-    // Get elemsize, emode, size
-    ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
-    CeedChk(ierr);
-    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
-    CeedChk(ierr);
-    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
-    CeedChk(ierr);
-    ierr = CeedQFunctionFieldGetSize(qfinputfields[i], &size); CeedChk(ierr);
+    if (skipactive && field->vec == CEED_VECTOR_ACTIVE)
+      continue;
     // Basis action
-    switch(emode) {
+    switch(field->emode) {
     case CEED_EVAL_NONE:
-      ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i][e*Q*size]); CeedChk(ierr);
+      impl->qdatain[i] = &impl->edata[i][e*field->elemstride];
+      // Assembly and identity QFunctions still read the Q-vector
+      if (skipactive || impl->identityqf) {
+        ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_HOST,
+                                  CEED_USE_POINTER,
+                                  &impl->edata[i][e*field->elemstride]);
+        CeedChk(ierr);
+      }
       break;
     case CEED_EVAL_INTERP:
-      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
-      ierr = CeedVectorSetArray(impl->evecsin[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i][e*elemsize*size]);
-      CeedChk(ierr);
-      ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE,
-                            CEED_EVAL_INTERP, impl->evecsin[i],
-                            impl->qvecsin[i]); CeedChk(ierr);
-      break;
     case CEED_EVAL_GRAD:
-      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
-      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
       ierr = CeedVectorSetArray(impl->evecsin[i], CEED_MEM_HOST,
                                 CEED_USE_POINTER,
-                                &impl->edata[i][e*elemsize*size/dim]);
+                                &impl->edata[i][e*field->elemstride]);
       CeedChk(ierr);
-      ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE,
-                            CEED_EVAL_GRAD, impl->evecsin[i],
-                            impl->qvecsin[i]); CeedChk(ierr);
+      ierr = CeedBasisApply(field->basis, 1, CEED_NOTRANSPOSE, field->emode,
+                            impl->evecsin[i], impl->qvecsin[i]); CeedChk(ierr);
       break;
     case CEED_EVAL_WEIGHT:
       break;  // No action
     // LCOV_EXCL_START
     case CEED_EVAL_DIV:
     case CEED_EVAL_CURL: {
-      ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis);
-      CeedChk(ierr);
       Ceed ceed;
-      ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
+      ierr = CeedBasisGetCeed(field->basis, &ceed); CeedChk(ierr);
       return CeedError(ceed, 1, "Ceed evaluation mode not implemented");
       // LCOV_EXCL_STOP
     }
@@ -286,51 +424,26 @@ static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q,
 //------------------------------------------------------------------------------
 // Output Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q,
-    CeedQFunctionField *qfoutputfields, CeedOperatorField *opoutputfields,
+static inline int CeedOperatorOutputBasis_Ref(CeedInt e,
     CeedInt numinputfields, CeedInt numoutputfields, CeedOperator op,
     CeedOperator_Ref *impl) {
   CeedInt ierr;
-  CeedInt dim, elemsize, size;
-  CeedElemRestriction Erestrict;
-  CeedEvalMode emode;
-  CeedBasis basis;
 
   for (CeedInt i=0; i<numoutputfields; i++) {
-    // Get elemsize, emode, size
-    ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[i], &Erestrict);
-    CeedChk(ierr);
-    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
-    CeedChk(ierr);
-    ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
-    CeedChk(ierr);
-    ierr = CeedQFunctionFieldGetSize(qfoutputfields[i], &size); CeedChk(ierr);
+    const CeedOperatorField_Ref *field = &impl->fields[i + numinputfields];
     // Basis action
-    switch(emode) {
+    switch(field->emode) {
     case CEED_EVAL_NONE:
       break; // No action
     case CEED_EVAL_INTERP:
-      ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
-      CeedChk(ierr);
-      ierr = CeedVectorSetArray(impl->evecsout[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i + numinputfields][e*elemsize*size]);
-      CeedChk(ierr);
-      ierr = CeedBasisApply(basis, 1, CEED_TRANSPOSE,
-                            CEED_EVAL_INTERP, impl->qvecsout[i],
-                            impl->evecsout[i]); CeedChk(ierr);
-      break;
     case CEED_EVAL_GRAD:
-      ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
-      CeedChk(ierr);
-      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
       ierr = CeedVectorSetArray(impl->evecsout[i], CEED_MEM_HOST,
                                 CEED_USE_POINTER,
-                                &impl->edata[i + numinputfields][e*elemsize*size/dim]);
+                                &impl->edata[i + numinputfields][e*field->elemstride]);
+      CeedChk(ierr);
+      ierr = CeedBasisApply(field->basis, 1, CEED_TRANSPOSE, field->emode,
+                            impl->qvecsout[i], impl->evecsout[i]);
       CeedChk(ierr);
-      ierr = CeedBasisApply(basis, 1, CEED_TRANSPOSE,
-                            CEED_EVAL_GRAD, impl->qvecsout[i],
-                            impl->evecsout[i]); CeedChk(ierr);
       break;
     // LCOV_EXCL_START
     case CEED_EVAL_WEIGHT: {
@@ -354,25 +467,28 @@ static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q,
 //------------------------------------------------------------------------------
 // Restore Input Vectors
 //------------------------------------------------------------------------------
+// Only inputs still read are restored, so an apply failing part way through
+//   releases its inputs with the same function
 static inline int CeedOperatorRestoreInputs_Ref(CeedInt numinputfields,
-    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
     const bool skipactive, CeedOperator_Ref *impl) {
   CeedInt ierr;
-  CeedEvalMode emode;
 
   for (CeedInt i=0; i<numinputfields; i++) {
-    // Skip active inputs
-    if (skipactive) {
-      CeedVector vec;
-      ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
-      if (vec == CEED_VECTOR_ACTIVE)
-        continue;
-    }
+    const CeedOperatorField_Ref *field = &impl->fields[i];
+    // Skip active inputs, and those sharing an E-vector
+    if ((skipactive && field->vec == CEED_VECTOR_ACTIVE) || field->shared >= 0)
+      continue;
     // Restore input
-    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
-    CeedChk(ierr);
-    if (emode == CEED_EVAL_WEIGHT) { // Skip
-    } else {
+    if (field->emode == CEED_EVAL_WEIGHT) { // Skip
+    } else if (impl->cachedevecs[i]) {
+      if (impl->edata[i]) {
+        ierr = CeedVectorRestoreArrayRead(impl->cachedevecs[i],
+                                          (const CeedScalar **)&impl->edata[i]);
+        CeedChk(ierr);
+      }
+      ierr = CeedElemRestrictionRestoreCachedEVector(field->Erestrict,
+             &impl->cachedevecs[i]); CeedChk(ierr);
+    } else if (impl->edata[i]) {
       ierr = CeedVectorRestoreArrayRead(impl->evecs[i],
                                         (const CeedScalar **) &impl->edata[i]);
       CeedChk(ierr);
@@ -382,136 +498,465 @@ static inline int CeedOperatorRestoreInputs_Ref(CeedInt numinputfields,
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Return Work E-vectors
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector invec,
-                                    CeedVector outvec, CeedRequest *request) {
+// On a Ceed sharing work, E-vectors filled in every application, those of
+//   the outputs and uncached active inputs, use arrays of the scratch arena
+static inline bool CeedOperatorFieldUsesWork_Ref(const CeedOperator_Ref *impl,
+    CeedInt i) {
+  const CeedOperatorField_Ref *field = &impl->fields[i];
+  return i >= impl->numein || (field->vec == CEED_VECTOR_ACTIVE &&
+                               field->emode != CEED_EVAL_WEIGHT &&
+                               !field->cached && field->shared < 0);
+}
+
+static int CeedOperatorReturnWork_Ref(Ceed ceed, CeedOperator_Ref *impl,
+                                      CeedInt end) {
+  int ierr;
+
+  for (CeedInt i=0; i<end; i++) {
+    if (!CeedOperatorFieldUsesWork_Ref(impl, i))
+      continue;
+    CeedScalar *array;
+    ierr = CeedVectorTakeArray(impl->evecs[i], CEED_MEM_HOST, &array);
+    CeedChk(ierr);
+    ierr = CeedRestoreWorkArray(ceed, &array); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Borrow or Return Work E-vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorBorrowWork_Ref(CeedOperator op, bool borrow,
+                                      CeedOperator_Ref *impl) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  bool shared;
+  ierr = CeedIsSharedWork(ceed, &shared); CeedChk(ierr);
+  if (!shared)
+    return 0;
+  if (!borrow)
+    return CeedOperatorReturnWork_Ref(ceed, impl, impl->numein+impl->numeout);
+
+  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    if (!CeedOperatorFieldUsesWork_Ref(impl, i))
+      continue;
+    CeedInt length;
+    CeedScalar *array;
+    int ierrborrow = CeedVectorGetLength(impl->evecs[i], &length);
+    if (!ierrborrow)
+      ierrborrow = CeedGetWorkArray(ceed, length, &array);
+    if (!ierrborrow) {
+      ierrborrow = CeedVectorSetArray(impl->evecs[i], CEED_MEM_HOST,
+                                      CEED_USE_POINTER, array);
+      if (ierrborrow) {
+        ierr = CeedRestoreWorkArray(ceed, &array); CeedChk(ierr);
+      }
+    }
+    // Return the arrays lent to earlier E-vectors
+    if (ierrborrow) {
+      ierr = CeedOperatorReturnWork_Ref(ceed, impl, i); CeedChk(ierr);
+      return ierrborrow;
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Get L-vector Index of Each E-vector Entry
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionGetEIndices_Ref(CeedElemRestriction rstr,
+    CeedInt **indices) {
+  int ierr;
+  CeedVector lvec, evec;
+  ierr = CeedElemRestrictionCreateVector(rstr, &lvec, &evec); CeedChk(ierr);
+  CeedInt lsize, esize;
+  ierr = CeedVectorGetLength(lvec, &lsize); CeedChk(ierr);
+  ierr = CeedVectorGetLength(evec, &esize); CeedChk(ierr);
+
+  CeedScalar *larray;
+  const CeedScalar *earray;
+  ierr = CeedVectorGetArray(lvec, CEED_MEM_HOST, &larray); CeedChk(ierr);
+  for (CeedInt i=0; i<lsize; i++)
+    larray[i] = i;
+  ierr = CeedVectorRestoreArray(lvec, &larray); CeedChk(ierr);
+  ierr = CeedElemRestrictionApply(rstr, CEED_NOTRANSPOSE, lvec, evec,
+                                  CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+
+  ierr = CeedMalloc(esize, indices); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(evec, CEED_MEM_HOST, &earray); CeedChk(ierr);
+  for (CeedInt i=0; i<esize; i++)
+    (*indices)[i] = (CeedInt)earray[i];
+  ierr = CeedVectorRestoreArrayRead(evec, &earray); CeedChk(ierr);
+
+  ierr = CeedVectorDestroy(&lvec); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&evec); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Dirichlet Constrained Entries
+//------------------------------------------------------------------------------
+// E-vector entries of the active fields restricted from constrained L-vector
+//   entries, in the order the elements are applied
+static int CeedOperatorSetupDirichlet_Ref(CeedOperator op,
+    CeedOperator_Ref *impl) {
+  int ierr;
+  if (impl->bcready)
+    return 0;
+  CeedInt nbc, numelements;
+  const CeedInt *indices;
+  CeedVector values;
+  ierr = CeedOperatorGetDirichlet(op, &nbc, &indices, &values); CeedChk(ierr);
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+
+  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    CeedOperatorField_Ref *field = &impl->fields[i];
+    ierr = CeedFree(&field->bcpos); CeedChk(ierr);
+    ierr = CeedFree(&field->bck); CeedChk(ierr);
+    field->numbc = 0;
+    if (!nbc || field->vec != CEED_VECTOR_ACTIVE ||
+        field->emode == CEED_EVAL_WEIGHT || (i < impl->numein &&
+                                            field->shared >= 0))
+      continue;
+
+    // Constraint index of each L-vector entry, or -1
+    CeedInt lsize, *map, *eindices;
+    ierr = CeedElemRestrictionGetLVectorSize(field->Erestrict, &lsize);
+    CeedChk(ierr);
+    ierr = CeedMalloc(lsize, &map); CeedChk(ierr);
+    for (CeedInt l=0; l<lsize; l++)
+      map[l] = -1;
+    for (CeedInt k=0; k<nbc; k++) {
+      if (indices[k] >= lsize) {
+        // LCOV_EXCL_START
+        Ceed ceed;
+        ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+        return CeedError(ceed, 1, "Constrained entry %d exceeds the L-vector "
+                         "size %d", indices[k], lsize);
+        // LCOV_EXCL_STOP
+      }
+      map[indices[k]] = k;
+    }
+
+    ierr = CeedElemRestrictionGetEIndices_Ref(field->Erestrict, &eindices);
+    CeedChk(ierr);
+    const CeedInt esize = numelements*field->elemstride;
+    for (CeedInt p=0; p<esize; p++)
+      field->numbc += map[eindices[p]] >= 0;
+    ierr = CeedMalloc(field->numbc, &field->bcpos); CeedChk(ierr);
+    ierr = CeedMalloc(field->numbc, &field->bck); CeedChk(ierr);
+    for (CeedInt p=0, j=0; p<esize; p++)
+      if (map[eindices[p]] >= 0) {
+        field->bcpos[j] = p;
+        field->bck[j++] = map[eindices[p]];
+      }
+    ierr = CeedFree(&map); CeedChk(ierr);
+    ierr = CeedFree(&eindices); CeedChk(ierr);
+  }
+  impl->bcready = true;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Insert Dirichlet Values into Active Inputs
+//------------------------------------------------------------------------------
+static int CeedOperatorInsertDirichlet_Ref(CeedOperator op,
+    CeedOperator_Ref *impl) {
+  int ierr;
+  CeedInt nbc;
+  const CeedInt *indices;
+  CeedVector values;
+  ierr = CeedOperatorGetDirichlet(op, &nbc, &indices, &values); CeedChk(ierr);
+  const CeedScalar *g = NULL;
+  if (values != CEED_VECTOR_NONE) {
+    ierr = CeedVectorGetArrayRead(values, CEED_MEM_HOST, &g); CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<impl->numein; i++) {
+    const CeedOperatorField_Ref *field = &impl->fields[i];
+    for (CeedInt j=0; j<field->numbc; j++)
+      impl->edata[i][field->bcpos[j]] = g ? g[field->bck[j]] : 0.0;
+  }
+  if (values != CEED_VECTOR_NONE) {
+    ierr = CeedVectorRestoreArrayRead(values, &g); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Apply Operator to Elements
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyElements_Ref(CeedOperator op, CeedVector invec,
+    CeedVector outvec, bool overwrite, CeedScalar *dot, CeedRequest *request) {
   int ierr;
   CeedOperator_Ref *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
   CeedQFunction qf;
   ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
-  CeedInt Q, numelements, numinputfields, numoutputfields, size;
+  CeedInt Q, numelements;
   ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
   ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
-  ierr= CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
-  CeedChk(ierr);
-  CeedOperatorField *opinputfields, *opoutputfields;
-  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
-  CeedChk(ierr);
-  CeedQFunctionField *qfinputfields, *qfoutputfields;
-  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
-  CeedChk(ierr);
-  CeedEvalMode emode;
-  CeedVector vec;
-  CeedElemRestriction Erestrict;
-
-  // Setup
-  ierr = CeedOperatorSetup_Ref(op); CeedChk(ierr);
+  const CeedInt numinputfields = impl->numein, numoutputfields = impl->numeout;
 
   // Input Evecs and Restriction
-  ierr = CeedOperatorSetupInputs_Ref(numinputfields, qfinputfields,
-                                     opinputfields, invec, false, impl,
+  ierr = CeedOperatorSetupInputs_Ref(numinputfields, invec, false, impl,
                                      request); CeedChk(ierr);
 
+  // Dirichlet values
+  CeedInt nbc;
+  const CeedInt *bcindices;
+  CeedVector bcvalues;
+  ierr = CeedOperatorGetDirichlet(op, &nbc, &bcindices, &bcvalues);
+  CeedChk(ierr);
+  if (nbc) {
+    ierr = CeedOperatorSetupDirichlet_Ref(op, impl); CeedChk(ierr);
+    ierr = CeedOperatorInsertDirichlet_Ref(op, impl); CeedChk(ierr);
+  }
+
   // Output Evecs
   for (CeedInt i=0; i<numoutputfields; i++) {
     ierr = CeedVectorGetArray(impl->evecs[i+impl->numein], CEED_MEM_HOST,
                               &impl->edata[i + numinputfields]); CeedChk(ierr);
   }
 
-  // Loop through elements
-  for (CeedInt e=0; e<numelements; e++) {
-    // Output pointers
-    for (CeedInt i=0; i<numoutputfields; i++) {
-      ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+  // Active inputs restricted like each active output; with out = sum_i
+  //   E_i^T y_i, the product in^T out is the sum of (E_i in)^T y_i over the
+  //   element outputs y_i, accumulated while they are in cache
+  CeedInt dotin[numoutputfields];
+  bool elemdot = dot;
+  for (CeedInt i=0; i<numoutputfields && elemdot; i++) {
+    const CeedOperatorField_Ref *field = &impl->fields[i + numinputfields];
+    dotin[i] = -1;
+    for (CeedInt j=0; j<numinputfields && dotin[i] < 0 &&
+         field->vec == CEED_VECTOR_ACTIVE; j++)
+      if (impl->fields[j].vec == CEED_VECTOR_ACTIVE &&
+          impl->fields[j].emode != CEED_EVAL_WEIGHT &&
+          impl->fields[j].Erestrict == field->Erestrict &&
+          impl->fields[j].elemstride == field->elemstride)
+        dotin[i] = j;
+    if (field->vec == CEED_VECTOR_ACTIVE ? dotin[i] < 0 : field->vec == outvec)
+      elemdot = false;
+  }
+  CeedScalar dotsum = 0.0;
+  CeedInt bcnext[numoutputfields];
+  for (CeedInt i=0; i<numoutputfields; i++)
+    bcnext[i] = 0;
+
+  // Loop through tiles of elements
+  const CeedInt tileelems = impl->tileelems;
+  const CeedScalar *tilein[numinputfields];
+  CeedScalar *tileout[numoutputfields];
+  for (CeedInt e0=0; e0<numelements; e0+=tileelems) {
+    const CeedInt nelem = CeedIntMin(tileelems, numelements - e0),
+                  tileQ = nelem*Q;
+    for (CeedInt e=e0; e<e0+nelem; e++) {
+      // Output pointers
+      for (CeedInt i=0; i<numoutputfields; i++) {
+        const CeedOperatorField_Ref *field = &impl->fields[i + numinputfields];
+        if (field->emode == CEED_EVAL_NONE)
+          impl->qdataout[i] =
+            &impl->edata[i + numinputfields][e*field->elemstride];
+        if (e == e0)
+          tileout[i] = impl->tiledata[i + numinputfields] ?
+                       impl->tiledata[i + numinputfields] : impl->qdataout[i];
+      }
+
+      // Input basis apply
+      ierr = CeedOperatorInputBasis_Ref(e, numinputfields, false, impl);
       CeedChk(ierr);
-      if (emode == CEED_EVAL_NONE) {
-        ierr = CeedQFunctionFieldGetSize(qfoutputfields[i], &size);
-        CeedChk(ierr);
-        ierr = CeedVectorSetArray(impl->qvecsout[i], CEED_MEM_HOST,
-                                  CEED_USE_POINTER,
-                                  &impl->edata[i + numinputfields][e*Q*size]);
-        CeedChk(ierr);
+
+      // Gather inputs into tile
+      for (CeedInt i=0; i<numinputfields; i++) {
+        CeedScalar *tile = impl->tiledata[i];
+        if (e == e0)
+          tilein[i] = tile ? tile : impl->qdatain[i];
+        if (tile)
+          for (CeedInt c=0; c<impl->fields[i].size; c++)
+            memcpy(&tile[c*tileQ + (e-e0)*Q], &impl->qdatain[i][c*Q],
+                   Q*sizeof(CeedScalar));
       }
     }
 
-    // Input basis apply
-    ierr = CeedOperatorInputBasis_Ref(e, Q, qfinputfields, opinputfields,
-                                      numinputfields, false, impl);
-    CeedChk(ierr);
-
     // Q function
     if (!impl->identityqf) {
-      ierr = CeedQFunctionApply(qf, Q, impl->qvecsin, impl->qvecsout);
-      CeedChk(ierr);
+      ierr = CeedQFunctionApplyRaw(qf, tileQ, tilein, tileout); CeedChk(ierr);
     }
 
-    // Output basis apply
-    ierr = CeedOperatorOutputBasis_Ref(e, Q, qfoutputfields, opoutputfields,
-                                       numinputfields, numoutputfields, op, impl);
-    CeedChk(ierr);
+    for (CeedInt e=e0; e<e0+nelem; e++) {
+      // Scatter outputs from tile
+      for (CeedInt i=0; i<numoutputfields; i++) {
+        const CeedOperatorField_Ref *field = &impl->fields[i + numinputfields];
+        const CeedScalar *tile = impl->tiledata[i + numinputfields];
+        if (!tile)
+          continue;
+        CeedScalar *qdata = field->emode == CEED_EVAL_NONE ?
+                            &impl->edata[i + numinputfields][e*field->elemstride] :
+                            impl->qdataout[i];
+        for (CeedInt c=0; c<field->size; c++)
+          memcpy(&qdata[c*Q], &tile[c*tileQ + (e-e0)*Q], Q*sizeof(CeedScalar));
+      }
+
+      // Output basis apply
+      ierr = CeedOperatorOutputBasis_Ref(e, numinputfields, numoutputfields, op,
+                                         impl); CeedChk(ierr);
+
+      // Drop contributions to Dirichlet constrained entries
+      for (CeedInt i=0; i<numoutputfields && nbc; i++) {
+        const CeedOperatorField_Ref *field = &impl->fields[i + numinputfields];
+        const CeedInt end = (e+1)*field->elemstride;
+        for (; bcnext[i] < field->numbc && field->bcpos[bcnext[i]] < end;
+             bcnext[i]++)
+          impl->edata[i + numinputfields][field->bcpos[bcnext[i]]] = 0.0;
+      }
+
+      // Element contribution to in^T out
+      for (CeedInt i=0; i<numoutputfields && elemdot; i++) {
+        if (dotin[i] < 0)
+          continue;
+        const CeedInt stride = impl->fields[i + numinputfields].elemstride;
+        const CeedScalar *u = &impl->edata[dotin[i]][e*stride],
+                          *v = &impl->edata[i + numinputfields][e*stride];
+        for (CeedInt k=0; k<stride; k++)
+          dotsum += u[k] * v[k];
+      }
+    }
   }
 
   // Output restriction
   for (CeedInt i=0; i<numoutputfields; i++) {
+    const CeedOperatorField_Ref *field = &impl->fields[i + numinputfields];
     // Restore evec
     ierr = CeedVectorRestoreArray(impl->evecs[i+impl->numein],
                                   &impl->edata[i + numinputfields]);
     CeedChk(ierr);
     // Get output vector
-    ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
+    CeedVector vec = field->vec;
     // Active
     if (vec == CEED_VECTOR_ACTIVE)
       vec = outvec;
-    // Restrict
-    ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[i], &Erestrict);
-    CeedChk(ierr);
-    ierr = CeedElemRestrictionApply(Erestrict, CEED_TRANSPOSE,
-                                    impl->evecs[i+impl->numein], vec, request);
-    CeedChk(ierr);
+    // Restrict, overwriting with the first field that writes each vector
+    bool first = overwrite;
+    for (CeedInt j=0; j<i && first; j++) {
+      CeedVector prevvec = impl->fields[j + numinputfields].vec;
+      first = (prevvec == CEED_VECTOR_ACTIVE ? outvec : prevvec) != vec;
+    }
+    if (first) {
+      ierr = CeedElemRestrictionApplyOverwrite(field->Erestrict,
+             impl->evecs[i+impl->numein], vec, request); CeedChk(ierr);
+    } else {
+      ierr = CeedElemRestrictionApply(field->Erestrict, CEED_TRANSPOSE,
+                                      impl->evecs[i+impl->numein], vec, request);
+      CeedChk(ierr);
+    }
   }
 
   // Restore input arrays
-  ierr = CeedOperatorRestoreInputs_Ref(numinputfields, qfinputfields,
-                                       opinputfields, false, impl);
+  ierr = CeedOperatorRestoreInputs_Ref(numinputfields, false, impl);
   CeedChk(ierr);
 
+  // Product of input and output
+  if (elemdot) {
+    *dot = dotsum;
+  } else if (dot) {
+    ierr = CeedVectorDot(invec, outvec, dot); CeedChk(ierr);
+  }
+
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// Assemble Linear QFunction
+// Operator Apply Core
 //------------------------------------------------------------------------------
-static int CeedOperatorLinearAssembleQFunction_Ref(CeedOperator op,
-    CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+static int CeedOperatorApplyCore_Ref(CeedOperator op, CeedVector invec,
+                                     CeedVector outvec, bool overwrite,
+                                     CeedScalar *dot, CeedRequest *request) {
   int ierr;
   CeedOperator_Ref *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
-  CeedQFunction qf;
-  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
-  CeedInt Q, numelements, numinputfields, numoutputfields, size;
+
+  // Setup
+  ierr = CeedOperatorSetup_Ref(op); CeedChk(ierr);
+
+  // Work Evecs
+  ierr = CeedOperatorBorrowWork_Ref(op, true, impl); CeedChk(ierr);
+
+  int ierrapply = CeedOperatorApplyElements_Ref(op, invec, outvec, overwrite,
+                  dot, request);
+
+  // Release the arrays an apply failing part way through still accesses
+  if (ierrapply) {
+    for (CeedInt i=impl->numein; i<impl->numein+impl->numeout; i++)
+      if (impl->edata[i]) {
+        ierr = CeedVectorRestoreArray(impl->evecs[i], &impl->edata[i]);
+        CeedChk(ierr);
+      }
+    ierr = CeedOperatorRestoreInputs_Ref(impl->numein, false, impl);
+    CeedChk(ierr);
+  }
+
+  // Return work Evecs
+  ierr = CeedOperatorBorrowWork_Ref(op, false, impl); CeedChk(ierr);
+  CeedChk(ierrapply);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApply_Ref(CeedOperator op, CeedVector invec,
+                                 CeedVector outvec, CeedRequest *request) {
+  return CeedOperatorApplyCore_Ref(op, invec, outvec, true, NULL, request);
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply and Product of Input and Output
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyDot_Ref(CeedOperator op, CeedVector invec,
+                                    CeedVector outvec, CeedScalar *dot,
+                                    CeedRequest *request) {
+  return CeedOperatorApplyCore_Ref(op, invec, outvec, true, dot, request);
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply Add
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector invec,
+                                    CeedVector outvec, CeedRequest *request) {
+  return CeedOperatorApplyCore_Ref(op, invec, outvec, false, NULL, request);
+}
+
+//------------------------------------------------------------------------------
+// Operator Dirichlet Constraint Changed
+//------------------------------------------------------------------------------
+static int CeedOperatorSetDirichlet_Ref(CeedOperator op) {
+  int ierr;
+  CeedOperator_Ref *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  impl->bcready = false;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup QFunction Linearization
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearizeSetup_Ref(CeedOperator op,
+    CeedInt *numactivein, CeedVector **activein, CeedInt *numactiveout,
+    CeedRequest *request) {
+  int ierr;
+  CeedOperator_Ref *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedInt Q, size;
   ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
-  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
-  ierr= CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
-  CeedChk(ierr);
-  CeedOperatorField *opinputfields, *opoutputfields;
-  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
-  CeedChk(ierr);
-  CeedQFunctionField *qfinputfields, *qfoutputfields;
-  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
-  CeedChk(ierr);
-  CeedVector vec;
-  CeedInt numactivein = 0, numactiveout = 0;
-  CeedVector *activein = NULL;
-  CeedScalar *a, *tmp;
-  Ceed ceed, ceedparent;
+  CeedScalar *tmp;
+  Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-  ierr = CeedGetOperatorFallbackParentCeed(ceed, &ceedparent); CeedChk(ierr);
-  ceedparent = ceedparent ? ceedparent : ceed;
 
   // Setup
   ierr = CeedOperatorSetup_Ref(op); CeedChk(ierr);
+  const CeedInt numinputfields = impl->numein, numoutputfields = impl->numeout;
 
   // Check for identity
   if (impl->identityqf)
@@ -520,127 +965,198 @@ static int CeedOperatorLinearAssembleQFunction_Ref(CeedOperator op,
   // LCOV_EXCL_STOP
 
   // Input Evecs and Restriction
-  ierr = CeedOperatorSetupInputs_Ref(numinputfields, qfinputfields,
-                                     opinputfields, NULL, true, impl, request);
-  CeedChk(ierr);
+  ierr = CeedOperatorSetupInputs_Ref(numinputfields, NULL, true, impl,
+                                     request); CeedChk(ierr);
 
   // Count number of active input fields
+  *numactivein = 0;
+  *activein = NULL;
   for (CeedInt i=0; i<numinputfields; i++) {
-    // Get input vector
-    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
     // Check if active input
-    if (vec == CEED_VECTOR_ACTIVE) {
-      ierr = CeedQFunctionFieldGetSize(qfinputfields[i], &size); CeedChk(ierr);
+    if (impl->fields[i].vec == CEED_VECTOR_ACTIVE) {
+      size = impl->fields[i].size;
       ierr = CeedVectorSetValue(impl->qvecsin[i], 0.0); CeedChk(ierr);
       ierr = CeedVectorGetArray(impl->qvecsin[i], CEED_MEM_HOST, &tmp);
       CeedChk(ierr);
-      ierr = CeedRealloc(numactivein + size, &activein); CeedChk(ierr);
+      ierr = CeedRealloc(*numactivein + size, activein); CeedChk(ierr);
       for (CeedInt field=0; field<size; field++) {
-        ierr = CeedVectorCreate(ceed, Q, &activein[numactivein+field]);
-        CeedChk(ierr);
-        ierr = CeedVectorSetArray(activein[numactivein+field], CEED_MEM_HOST,
-                                  CEED_USE_POINTER, &tmp[field*Q]);
+        ierr = CeedVectorCreate(ceed, Q, &(*activein)[*numactivein+field]);
         CeedChk(ierr);
+        ierr = CeedVectorSetArray((*activein)[*numactivein+field],
+                                  CEED_MEM_HOST, CEED_USE_POINTER,
+                                  &tmp[field*Q]); CeedChk(ierr);
       }
-      numactivein += size;
+      *numactivein += size;
       ierr = CeedVectorRestoreArray(impl->qvecsin[i], &tmp); CeedChk(ierr);
     }
   }
 
   // Count number of active output fields
-  for (CeedInt i=0; i<numoutputfields; i++) {
-    // Get output vector
-    ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
-    // Check if active output
-    if (vec == CEED_VECTOR_ACTIVE) {
-      ierr = CeedQFunctionFieldGetSize(qfoutputfields[i], &size); CeedChk(ierr);
-      numactiveout += size;
-    }
-  }
+  *numactiveout = 0;
+  for (CeedInt i=0; i<numoutputfields; i++)
+    if (impl->fields[i + numinputfields].vec == CEED_VECTOR_ACTIVE)
+      *numactiveout += impl->fields[i + numinputfields].size;
 
   // Check sizes
-  if (!numactivein || !numactiveout)
+  if (!*numactivein || !*numactiveout)
     // LCOV_EXCL_START
     return CeedError(ceed, 1, "Cannot assemble QFunction without active inputs "
                      "and outputs");
   // LCOV_EXCL_STOP
+  return 0;
+}
 
-  // Create output restriction
-  CeedInt strides[3] = {1, Q, numactivein*numactiveout*Q}; /* *NOPAD* */
-  ierr = CeedElemRestrictionCreateStrided(ceedparent, numelements, Q,
-                                          numactivein*numactiveout,
-                                          numactivein*numactiveout*numelements*Q,
-                                          strides, rstr); CeedChk(ierr);
-  // Create assembled vector
-  ierr = CeedVectorCreate(ceedparent, numelements*Q*numactivein*numactiveout,
-                          assembled); CeedChk(ierr);
-  ierr = CeedVectorSetValue(*assembled, 0.0); CeedChk(ierr);
-  ierr = CeedVectorGetArray(*assembled, CEED_MEM_HOST, &a); CeedChk(ierr);
+//------------------------------------------------------------------------------
+// Linearize QFunction on one element, writing numactivein*numactiveout*Q
+//   values to a
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearizeElement_Ref(CeedOperator op, CeedInt e,
+    CeedInt numactivein, CeedVector *activein, CeedScalar *a) {
+  int ierr;
+  CeedOperator_Ref *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt Q;
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+  const CeedInt numinputfields = impl->numein, numoutputfields = impl->numeout;
 
-  // Loop through elements
-  for (CeedInt e=0; e<numelements; e++) {
-    // Input basis apply
-    ierr = CeedOperatorInputBasis_Ref(e, Q, qfinputfields, opinputfields,
-                                      numinputfields, true, impl);
-    CeedChk(ierr);
+  // Input basis apply
+  ierr = CeedOperatorInputBasis_Ref(e, numinputfields, true, impl);
+  CeedChk(ierr);
 
-    // Assemble QFunction
-    for (CeedInt in=0; in<numactivein; in++) {
-      // Set Inputs
-      ierr = CeedVectorSetValue(activein[in], 1.0); CeedChk(ierr);
-      if (numactivein > 1) {
-        ierr = CeedVectorSetValue(activein[(in+numactivein-1)%numactivein],
-                                  0.0); CeedChk(ierr);
-      }
-      // Set Outputs
-      for (CeedInt out=0; out<numoutputfields; out++) {
-        // Get output vector
-        ierr = CeedOperatorFieldGetVector(opoutputfields[out], &vec);
-        CeedChk(ierr);
-        // Check if active output
-        if (vec == CEED_VECTOR_ACTIVE) {
-          CeedVectorSetArray(impl->qvecsout[out], CEED_MEM_HOST,
-                             CEED_USE_POINTER, a); CeedChk(ierr);
-          ierr = CeedQFunctionFieldGetSize(qfoutputfields[out], &size);
-          CeedChk(ierr);
-          a += size*Q; // Advance the pointer by the size of the output
-        }
+  // Assemble QFunction
+  for (CeedInt in=0; in<numactivein; in++) {
+    // Set Inputs
+    ierr = CeedVectorSetValue(activein[in], 1.0); CeedChk(ierr);
+    if (numactivein > 1) {
+      ierr = CeedVectorSetValue(activein[(in+numactivein-1)%numactivein],
+                                0.0); CeedChk(ierr);
+    }
+    // Set Outputs
+    for (CeedInt out=0; out<numoutputfields; out++) {
+      const CeedOperatorField_Ref *field = &impl->fields[out + numinputfields];
+      // Check if active output
+      if (field->vec == CEED_VECTOR_ACTIVE) {
+        ierr = CeedVectorSetArray(impl->qvecsout[out], CEED_MEM_HOST,
+                                  CEED_USE_POINTER, a); CeedChk(ierr);
+        a += field->size*Q; // Advance the pointer by the size of the output
       }
-      // Apply QFunction
-      ierr = CeedQFunctionApply(qf, Q, impl->qvecsin, impl->qvecsout);
-      CeedChk(ierr);
     }
+    // Apply QFunction
+    ierr = CeedQFunctionApply(qf, Q, impl->qvecsin, impl->qvecsout);
+    CeedChk(ierr);
   }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Restore after QFunction Linearization
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearizeRestore_Ref(CeedOperator op,
+    CeedInt numactivein, CeedVector **activein) {
+  int ierr;
+  CeedOperator_Ref *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  const CeedInt numinputfields = impl->numein, numoutputfields = impl->numeout;
 
   // Un-set output Qvecs to prevent accidental overwrite of Assembled
   for (CeedInt out=0; out<numoutputfields; out++) {
-    // Get output vector
-    ierr = CeedOperatorFieldGetVector(opoutputfields[out], &vec);
-    CeedChk(ierr);
+    const CeedOperatorField_Ref *field = &impl->fields[out + numinputfields];
     // Check if active output
-    if (vec == CEED_VECTOR_ACTIVE) {
-      CeedVectorTakeArray(impl->qvecsout[out], CEED_MEM_HOST, NULL);
-      CeedChk(ierr);
+    if (field->vec == CEED_VECTOR_ACTIVE) {
+      if (field->emode != CEED_EVAL_NONE) {
+        ierr = CeedVectorSetArray(impl->qvecsout[out], CEED_MEM_HOST,
+                                  CEED_USE_POINTER, impl->qdataout[out]);
+        CeedChk(ierr);
+      } else {
+        ierr = CeedVectorTakeArray(impl->qvecsout[out], CEED_MEM_HOST, NULL);
+        CeedChk(ierr);
+      }
     }
   }
 
   // Restore input arrays
-  ierr = CeedOperatorRestoreInputs_Ref(numinputfields, qfinputfields,
-                                       opinputfields, true, impl);
+  ierr = CeedOperatorRestoreInputs_Ref(numinputfields, true, impl);
   CeedChk(ierr);
 
-  // Restore output
-  ierr = CeedVectorRestoreArray(*assembled, &a); CeedChk(ierr);
-
   // Cleanup
   for (CeedInt i=0; i<numactivein; i++) {
-    ierr = CeedVectorDestroy(&activein[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&(*activein)[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(activein); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction, creating the restriction and vector on build or
+//   refilling the given ones on update
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op,
+    bool buildobjects, CeedVector *assembled, CeedElemRestriction *rstr,
+    CeedRequest *request) {
+  int ierr;
+  CeedInt Q, numelements, numactivein, numactiveout;
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
+  ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
+  CeedVector *activein;
+  CeedScalar *a;
+  Ceed ceed, ceedparent;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  ierr = CeedGetOperatorFallbackParentCeed(ceed, &ceedparent); CeedChk(ierr);
+  ceedparent = ceedparent ? ceedparent : ceed;
+
+  // Setup
+  ierr = CeedOperatorLinearizeSetup_Ref(op, &numactivein, &activein,
+                                        &numactiveout, request); CeedChk(ierr);
+
+  if (buildobjects) {
+    // Create output restriction
+    CeedInt strides[3] = {1, Q, numactivein*numactiveout*Q}; /* *NOPAD* */
+    ierr = CeedElemRestrictionCreateStrided(ceedparent, numelements, Q,
+                                            numactivein*numactiveout,
+                                            numactivein*numactiveout*numelements*Q,
+                                            strides, rstr); CeedChk(ierr);
+    // Create assembled vector
+    ierr = CeedVectorCreate(ceedparent, numelements*Q*numactivein*numactiveout,
+                            assembled); CeedChk(ierr);
+  }
+  ierr = CeedVectorSetValue(*assembled, 0.0); CeedChk(ierr);
+  ierr = CeedVectorGetArray(*assembled, CEED_MEM_HOST, &a); CeedChk(ierr);
+
+  // Loop through elements
+  for (CeedInt e=0; e<numelements; e++) {
+    ierr = CeedOperatorLinearizeElement_Ref(op, e, numactivein, activein,
+                                            &a[e*numactivein*numactiveout*Q]);
+    CeedChk(ierr);
   }
-  ierr = CeedFree(&activein); CeedChk(ierr);
+
+  // Restore
+  ierr = CeedOperatorLinearizeRestore_Ref(op, numactivein, &activein);
+  CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(*assembled, &a); CeedChk(ierr);
 
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunction_Ref(CeedOperator op,
+    CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+  return CeedOperatorLinearAssembleQFunctionCore_Ref(op, true, assembled, rstr,
+         request);
+}
+
+//------------------------------------------------------------------------------
+// Update Assembled Linear QFunction
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionUpdate_Ref(CeedOperator op,
+    CeedVector assembled, CeedElemRestriction rstr, CeedRequest *request) {
+  return CeedOperatorLinearAssembleQFunctionCore_Ref(op, false, &assembled,
+         &rstr, request);
+}
+
 //------------------------------------------------------------------------------
 // Get Basis Emode Pointer
 //------------------------------------------------------------------------------
@@ -672,6 +1188,13 @@ static int CreatePBRestriction_Ref(CeedElemRestriction rstr,
   int ierr;
   Ceed ceed;
   ierr = CeedElemRestrictionGetCeed(rstr, &ceed); CeedChk(ierr);
+  CeedInt nsides;
+  ierr = CeedElemRestrictionGetNumSides(rstr, &nsides); CeedChk(ierr);
+  if (nsides > 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Point block assembly of two-sided "
+                     "restrictions not supported");
+  // LCOV_EXCL_STOP
   const CeedInt *offsets;
   ierr = CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets);
   CeedChk(ierr);
@@ -713,19 +1236,11 @@ static inline int CeedOperatorAssembleAddDiagonalCore_Ref(CeedOperator op,
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
 
-  // Assemble QFunction
   CeedQFunction qf;
   ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
   CeedInt numinputfields, numoutputfields;
   ierr= CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
   CeedChk(ierr);
-  CeedVector assembledqf;
-  CeedElemRestriction rstr;
-  ierr = CeedOperatorLinearAssembleQFunction(op,  &assembledqf, &rstr, request);
-  CeedChk(ierr);
-  ierr = CeedElemRestrictionDestroy(&rstr); CeedChk(ierr);
-  CeedScalar maxnorm = 0;
-  ierr = CeedVectorNorm(assembledqf, CEED_NORM_MAX, &maxnorm); CeedChk(ierr);
 
   // Determine active input basis
   CeedOperatorField *opfields;
@@ -832,12 +1347,10 @@ static inline int CeedOperatorAssembleAddDiagonalCore_Ref(CeedOperator op,
   CeedChk(ierr);
 
   // Assemble element operator diagonals
-  CeedScalar *elemdiagarray, *assembledqfarray;
+  CeedScalar *elemdiagarray;
   ierr = CeedVectorSetValue(elemdiag, 0.0); CeedChk(ierr);
   ierr = CeedVectorGetArray(elemdiag, CEED_MEM_HOST, &elemdiagarray);
   CeedChk(ierr);
-  ierr = CeedVectorGetArray(assembledqf, CEED_MEM_HOST, &assembledqfarray);
-  CeedChk(ierr);
   CeedInt nelem, nnodes, nqpts;
   ierr = CeedElemRestrictionGetNumElements(diagrstr, &nelem); CeedChk(ierr);
   ierr = CeedBasisGetNumNodes(basisin, &nnodes); CeedChk(ierr);
@@ -859,10 +1372,25 @@ static inline int CeedOperatorAssembleAddDiagonalCore_Ref(CeedOperator op,
   ierr = CeedBasisGetInterp(basisout, &interpout); CeedChk(ierr);
   ierr = CeedBasisGetGrad(basisin, &gradin); CeedChk(ierr);
   ierr = CeedBasisGetGrad(basisout, &gradout); CeedChk(ierr);
+  // Linearize the QFunction one element at a time, so only an element of
+  //   assembled QFunction data is stored
+  CeedInt numactivein, numactiveout;
+  CeedVector *activein;
+  CeedScalar *assembledqfarray;
+  ierr = CeedOperatorLinearizeSetup_Ref(op, &numactivein, &activein,
+                                        &numactiveout, request); CeedChk(ierr);
+  ierr = CeedMalloc(numactivein*numactiveout*nqpts, &assembledqfarray);
+  CeedChk(ierr);
   // Compute the diagonal of B^T D B
   // Each element
-  const CeedScalar qfvaluebound = maxnorm*1e-12;
   for (CeedInt e=0; e<nelem; e++) {
+    ierr = CeedOperatorLinearizeElement_Ref(op, e, numactivein, activein,
+                                            assembledqfarray); CeedChk(ierr);
+    CeedScalar maxnorm = 0;
+    for (CeedInt i=0; i<numactivein*numactiveout*nqpts; i++)
+      if (fabs(assembledqfarray[i]) > maxnorm)
+        maxnorm = fabs(assembledqfarray[i]);
+    const CeedScalar qfvaluebound = maxnorm*1e-12;
     CeedInt dout = -1;
     // Each basis eval mode pair
     for (CeedInt eout=0; eout<numemodeout; eout++) {
@@ -886,8 +1414,8 @@ static inline int CeedOperatorAssembleAddDiagonalCore_Ref(CeedOperator op,
               // Point Block Diagonal
               for (CeedInt compIn=0; compIn<ncomp; compIn++) {
                 const CeedScalar qfvalue =
-                  assembledqfarray[((((e*numemodein+ein)*ncomp+compIn)*
-                                     numemodeout+eout)*ncomp+compOut)*nqpts+q];
+                  assembledqfarray[(((ein*ncomp+compIn)*numemodeout+eout)*
+                                    ncomp+compOut)*nqpts+q];
                 if (fabs(qfvalue) > qfvaluebound)
                   for (CeedInt n=0; n<nnodes; n++)
                     elemdiagarray[((e*ncomp+compOut)*ncomp+compIn)*nnodes+n] +=
@@ -896,8 +1424,8 @@ static inline int CeedOperatorAssembleAddDiagonalCore_Ref(CeedOperator op,
             } else {
               // Diagonal Only
               const CeedScalar qfvalue =
-                assembledqfarray[((((e*numemodein+ein)*ncomp+compOut)*
-                                   numemodeout+eout)*ncomp+compOut)*nqpts+q];
+                assembledqfarray[(((ein*ncomp+compOut)*numemodeout+eout)*
+                                  ncomp+compOut)*nqpts+q];
               if (fabs(qfvalue) > qfvaluebound)
                 for (CeedInt n=0; n<nnodes; n++)
                   elemdiagarray[(e*ncomp+compOut)*nnodes+n] +=
@@ -907,7 +1435,9 @@ static inline int CeedOperatorAssembleAddDiagonalCore_Ref(CeedOperator op,
     }
   }
   ierr = CeedVectorRestoreArray(elemdiag, &elemdiagarray); CeedChk(ierr);
-  ierr = CeedVectorRestoreArray(assembledqf, &assembledqfarray); CeedChk(ierr);
+  ierr = CeedOperatorLinearizeRestore_Ref(op, numactivein, &activein);
+  CeedChk(ierr);
+  ierr = CeedFree(&assembledqfarray); CeedChk(ierr);
 
   // Assemble local operator diagonal
   ierr = CeedElemRestrictionApply(diagrstr, CEED_TRANSPOSE, elemdiag,
@@ -917,7 +1447,6 @@ static inline int CeedOperatorAssembleAddDiagonalCore_Ref(CeedOperator op,
   if (pointBlock) {
     ierr = CeedElemRestrictionDestroy(&diagrstr); CeedChk(ierr);
   }
-  ierr = CeedVectorDestroy(&assembledqf); CeedChk(ierr);
   ierr = CeedVectorDestroy(&elemdiag); CeedChk(ierr);
   ierr = CeedFree(&emodein); CeedChk(ierr);
   ierr = CeedFree(&emodeout); CeedChk(ierr);
@@ -937,9 +1466,15 @@ static inline int CeedOperatorLinearAssembleAddDiagonalCompositeCore_Ref(
   CeedOperator *subOperators;
   ierr = CeedOperatorGetNumSub(op, &numSub); CeedChk(ierr);
   ierr = CeedOperatorGetSubList(op, &subOperators); CeedChk(ierr);
+  // Suboperators of other backends linearize through their own fallbacks
   for (CeedInt i = 0; i < numSub; i++) {
-    ierr = CeedOperatorAssembleAddDiagonalCore_Ref(subOperators[i], assembled,
-           request, pointBlock); CeedChk(ierr);
+    if (pointBlock) {
+      ierr = CeedOperatorLinearAssembleAddPointBlockDiagonal(subOperators[i],
+             assembled, request); CeedChk(ierr);
+    } else {
+      ierr = CeedOperatorLinearAssembleAddDiagonal(subOperators[i], assembled,
+             request); CeedChk(ierr);
+    }
   }
   return 0;
 }
@@ -976,6 +1511,343 @@ static int CeedOperatorLinearAssembleAddPointBlockDiagonal_Ref(CeedOperator op,
   }
 }
 
+//------------------------------------------------------------------------------
+// Get Active Field Basis, Restriction, and Emodes
+//------------------------------------------------------------------------------
+static int CeedOperatorGetActiveEmodes_Ref(CeedOperator op, bool inOrOut,
+    CeedBasis *basis, CeedElemRestriction *rstr, CeedInt *numemode,
+    CeedEvalMode **emodes) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields, numfields;
+  ierr= CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opfields;
+  CeedQFunctionField *qffields;
+  if (inOrOut) {
+    ierr = CeedOperatorGetFields(op, NULL, &opfields); CeedChk(ierr);
+    ierr = CeedQFunctionGetFields(qf, NULL, &qffields); CeedChk(ierr);
+    numfields = numoutputfields;
+  } else {
+    ierr = CeedOperatorGetFields(op, &opfields, NULL); CeedChk(ierr);
+    ierr = CeedQFunctionGetFields(qf, &qffields, NULL); CeedChk(ierr);
+    numfields = numinputfields;
+  }
+
+  *basis = NULL;
+  *rstr = NULL;
+  *numemode = 0;
+  *emodes = NULL;
+  for (CeedInt i=0; i<numfields; i++) {
+    CeedVector vec;
+    ierr = CeedOperatorFieldGetVector(opfields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) {
+      CeedElemRestriction r;
+      ierr = CeedOperatorFieldGetBasis(opfields[i], basis); CeedChk(ierr);
+      ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &r);
+      CeedChk(ierr);
+      if (*rstr && *rstr != r)
+        // LCOV_EXCL_START
+        return CeedError(ceed, 1,
+                         "Multi-field non-composite operator assembly not supported");
+      // LCOV_EXCL_STOP
+      *rstr = r;
+      CeedEvalMode emode;
+      ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode); CeedChk(ierr);
+      CeedInt dim = 1;
+      switch (emode) {
+      case CEED_EVAL_NONE:
+      case CEED_EVAL_INTERP:
+        ierr = CeedRealloc(*numemode + 1, emodes); CeedChk(ierr);
+        (*emodes)[*numemode] = emode;
+        *numemode += 1;
+        break;
+      case CEED_EVAL_GRAD:
+        ierr = CeedBasisGetDimension(*basis, &dim); CeedChk(ierr);
+        ierr = CeedRealloc(*numemode + dim, emodes); CeedChk(ierr);
+        for (CeedInt d=0; d<dim; d++)
+          (*emodes)[*numemode+d] = emode;
+        *numemode += dim;
+        break;
+      case CEED_EVAL_WEIGHT:
+      case CEED_EVAL_DIV:
+      case CEED_EVAL_CURL:
+        break; // Caught by QF Assembly
+      }
+    }
+  }
+  if (!*rstr)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Cannot assemble operator without active inputs "
+                     "and outputs");
+  // LCOV_EXCL_STOP
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Get Basis Matrices for Each Emode
+//------------------------------------------------------------------------------
+static int CeedOperatorGetEmodeMatrices_Ref(CeedBasis basis, CeedInt numemode,
+    CeedEvalMode *emodes, CeedInt nnodes, CeedInt nqpts, CeedScalar **identity,
+    const CeedScalar **mats) {
+  int ierr;
+  const CeedScalar *interp = NULL, *grad = NULL;
+
+  *identity = NULL;
+  if (basis != CEED_BASIS_COLLOCATED) {
+    ierr = CeedBasisGetInterp(basis, &interp); CeedChk(ierr);
+    ierr = CeedBasisGetGrad(basis, &grad); CeedChk(ierr);
+  }
+  CeedInt d = -1;
+  for (CeedInt i=0; i<numemode; i++) {
+    if (emodes[i] == CEED_EVAL_NONE && !*identity) {
+      ierr = CeedCalloc(nqpts*nnodes, identity); CeedChk(ierr);
+      for (CeedInt j=0; j<(nnodes<nqpts?nnodes:nqpts); j++)
+        (*identity)[j*nnodes+j] = 1.0;
+    }
+    if (emodes[i] == CEED_EVAL_GRAD)
+      d += 1;
+    CeedOperatorGetBasisPointer_Ref(&mats[i], emodes[i], *identity, interp,
+                                    grad ? &grad[d*nqpts*nnodes] : NULL);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Count Assembled Entries for Single Operator
+//------------------------------------------------------------------------------
+static int CeedSingleOperatorAssemblyCount_Ref(CeedOperator op,
+    CeedInt *nentries) {
+  int ierr;
+  CeedBasis basisin, basisout;
+  CeedElemRestriction rstrin, rstrout;
+  CeedInt numemodein, numemodeout;
+  CeedEvalMode *emodein, *emodeout;
+  ierr = CeedOperatorGetActiveEmodes_Ref(op, false, &basisin, &rstrin,
+                                         &numemodein, &emodein); CeedChk(ierr);
+  ierr = CeedOperatorGetActiveEmodes_Ref(op, true, &basisout, &rstrout,
+                                         &numemodeout, &emodeout); CeedChk(ierr);
+  CeedInt nelem, elemsizein, elemsizeout, ncompin, ncompout;
+  ierr = CeedElemRestrictionGetNumElements(rstrin, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstrin, &elemsizein); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstrin, &ncompin); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstrout, &elemsizeout);
+  CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstrout, &ncompout); CeedChk(ierr);
+
+  *nentries = nelem*elemsizeout*ncompout*elemsizein*ncompin;
+
+  ierr = CeedFree(&emodein); CeedChk(ierr);
+  ierr = CeedFree(&emodeout); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Sparsity Pattern for Single Operator
+//------------------------------------------------------------------------------
+static int CeedSingleOperatorAssembleSymbolic_Ref(CeedOperator op,
+    CeedInt offset, CeedInt *rows, CeedInt *cols) {
+  int ierr;
+  CeedBasis basisin, basisout;
+  CeedElemRestriction rstrin, rstrout;
+  CeedInt numemodein, numemodeout;
+  CeedEvalMode *emodein, *emodeout;
+  ierr = CeedOperatorGetActiveEmodes_Ref(op, false, &basisin, &rstrin,
+                                         &numemodein, &emodein); CeedChk(ierr);
+  ierr = CeedOperatorGetActiveEmodes_Ref(op, true, &basisout, &rstrout,
+                                         &numemodeout, &emodeout); CeedChk(ierr);
+  CeedInt nelem, elemsizein, elemsizeout, ncompin, ncompout;
+  ierr = CeedElemRestrictionGetNumElements(rstrin, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstrin, &elemsizein); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstrin, &ncompin); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstrout, &elemsizeout);
+  CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstrout, &ncompout); CeedChk(ierr);
+
+  // L-vector indices of the E-vector entries, E-vector layout [e, comp, node]
+  CeedInt *indin, *indout;
+  ierr = CeedElemRestrictionGetEIndices_Ref(rstrin, &indin); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetEIndices_Ref(rstrout, &indout); CeedChk(ierr);
+
+  // Element matrices in row-major order, [e, comp out, node out, comp in, node in]
+  const CeedInt sizein = ncompin*elemsizein, sizeout = ncompout*elemsizeout;
+  CeedInt count = offset;
+  for (CeedInt e=0; e<nelem; e++)
+    for (CeedInt i=0; i<sizeout; i++)
+      for (CeedInt j=0; j<sizein; j++) {
+        rows[count] = indout[e*sizeout+i];
+        cols[count] = indin[e*sizein+j];
+        count++;
+      }
+
+  // Cleanup
+  ierr = CeedFree(&indin); CeedChk(ierr);
+  ierr = CeedFree(&indout); CeedChk(ierr);
+  ierr = CeedFree(&emodein); CeedChk(ierr);
+  ierr = CeedFree(&emodeout); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Values for Single Operator
+//------------------------------------------------------------------------------
+static int CeedSingleOperatorAssemble_Ref(CeedOperator op, CeedInt offset,
+    CeedScalar *values) {
+  int ierr;
+
+  // Assemble QFunction
+  CeedVector assembledqf;
+  CeedElemRestriction rstr;
+  ierr = CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembledqf,
+         &rstr, CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstr); CeedChk(ierr);
+
+  // Determine active bases
+  CeedBasis basisin, basisout;
+  CeedElemRestriction rstrin, rstrout;
+  CeedInt numemodein, numemodeout;
+  CeedEvalMode *emodein, *emodeout;
+  ierr = CeedOperatorGetActiveEmodes_Ref(op, false, &basisin, &rstrin,
+                                         &numemodein, &emodein); CeedChk(ierr);
+  ierr = CeedOperatorGetActiveEmodes_Ref(op, true, &basisout, &rstrout,
+                                         &numemodeout, &emodeout); CeedChk(ierr);
+  CeedInt nelem, elemsizein, elemsizeout, ncompin, ncompout, nqpts;
+  ierr = CeedElemRestrictionGetNumElements(rstrin, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstrin, &elemsizein); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstrin, &ncompin); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstrout, &elemsizeout);
+  CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstrout, &ncompout); CeedChk(ierr);
+  ierr = CeedOperatorGetNumQuadraturePoints(op, &nqpts); CeedChk(ierr);
+
+  // Basis matrices
+  CeedScalar *identityin, *identityout;
+  const CeedScalar *bin[numemodein], *bout[numemodeout];
+  ierr = CeedOperatorGetEmodeMatrices_Ref(basisin, numemodein, emodein,
+                                          elemsizein, nqpts, &identityin, bin);
+  CeedChk(ierr);
+  ierr = CeedOperatorGetEmodeMatrices_Ref(basisout, numemodeout, emodeout,
+                                          elemsizeout, nqpts, &identityout,
+                                          bout); CeedChk(ierr);
+
+  // Compute B^T D B for each element and component pair
+  const CeedScalar *assembledqfarray;
+  ierr = CeedVectorGetArrayRead(assembledqf, CEED_MEM_HOST, &assembledqfarray);
+  CeedChk(ierr);
+  CeedScalar *btd;
+  ierr = CeedMalloc(elemsizeout*numemodein*nqpts, &btd); CeedChk(ierr);
+  const CeedInt sizein = ncompin*elemsizein, sizeout = ncompout*elemsizeout;
+  for (CeedInt e=0; e<nelem; e++)
+    for (CeedInt compIn=0; compIn<ncompin; compIn++)
+      for (CeedInt compOut=0; compOut<ncompout; compOut++) {
+        // B^T D
+        for (CeedInt n=0; n<elemsizeout; n++)
+          for (CeedInt ein=0; ein<numemodein; ein++)
+            for (CeedInt q=0; q<nqpts; q++) {
+              CeedScalar sum = 0.0;
+              for (CeedInt eout=0; eout<numemodeout; eout++) {
+                const CeedScalar qfvalue =
+                  assembledqfarray[((((e*numemodein+ein)*ncompin+compIn)*
+                                     numemodeout+eout)*ncompout+compOut)*nqpts+q];
+                sum += bout[eout][q*elemsizeout+n] * qfvalue;
+              }
+              btd[(n*numemodein+ein)*nqpts+q] = sum;
+            }
+        // B^T D B
+        for (CeedInt n=0; n<elemsizeout; n++)
+          for (CeedInt m=0; m<elemsizein; m++) {
+            CeedScalar sum = 0.0;
+            for (CeedInt ein=0; ein<numemodein; ein++)
+              for (CeedInt q=0; q<nqpts; q++)
+                sum += btd[(n*numemodein+ein)*nqpts+q] *
+                       bin[ein][q*elemsizein+m];
+            values[offset + (e*sizeout+compOut*elemsizeout+n)*sizein +
+                            compIn*elemsizein+m] = sum;
+          }
+      }
+  ierr = CeedVectorRestoreArrayRead(assembledqf, &assembledqfarray);
+  CeedChk(ierr);
+
+  // Cleanup
+  ierr = CeedVectorDestroy(&assembledqf); CeedChk(ierr);
+  ierr = CeedFree(&btd); CeedChk(ierr);
+  ierr = CeedFree(&identityin); CeedChk(ierr);
+  ierr = CeedFree(&identityout); CeedChk(ierr);
+  ierr = CeedFree(&emodein); CeedChk(ierr);
+  ierr = CeedFree(&emodeout); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Sparsity Pattern
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleSymbolic_Ref(CeedOperator op,
+    CeedInt *nentries, CeedInt **rows, CeedInt **cols) {
+  int ierr;
+  bool isComposite;
+  ierr = CeedOperatorIsComposite(op, &isComposite); CeedChk(ierr);
+  CeedInt numSub = 1, count;
+  CeedOperator *subOperators = &op;
+  if (isComposite) {
+    ierr = CeedOperatorGetNumSub(op, &numSub); CeedChk(ierr);
+    ierr = CeedOperatorGetSubList(op, &subOperators); CeedChk(ierr);
+  }
+
+  // Count entries
+  *nentries = 0;
+  for (CeedInt i=0; i<numSub; i++) {
+    ierr = CeedSingleOperatorAssemblyCount_Ref(subOperators[i], &count);
+    CeedChk(ierr);
+    *nentries += count;
+  }
+
+  // Fill pattern
+  ierr = CeedMalloc(*nentries, rows); CeedChk(ierr);
+  ierr = CeedMalloc(*nentries, cols); CeedChk(ierr);
+  CeedInt offset = 0;
+  for (CeedInt i=0; i<numSub; i++) {
+    ierr = CeedSingleOperatorAssembleSymbolic_Ref(subOperators[i], offset,
+           *rows, *cols); CeedChk(ierr);
+    ierr = CeedSingleOperatorAssemblyCount_Ref(subOperators[i], &count);
+    CeedChk(ierr);
+    offset += count;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Values
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssemble_Ref(CeedOperator op,
+    CeedVector values) {
+  int ierr;
+  bool isComposite;
+  ierr = CeedOperatorIsComposite(op, &isComposite); CeedChk(ierr);
+  CeedInt numSub = 1, count;
+  CeedOperator *subOperators = &op;
+  if (isComposite) {
+    ierr = CeedOperatorGetNumSub(op, &numSub); CeedChk(ierr);
+    ierr = CeedOperatorGetSubList(op, &subOperators); CeedChk(ierr);
+  }
+
+  CeedScalar *valuesarray;
+  ierr = CeedVectorGetArray(values, CEED_MEM_HOST, &valuesarray); CeedChk(ierr);
+  CeedInt offset = 0;
+  for (CeedInt i=0; i<numSub; i++) {
+    ierr = CeedSingleOperatorAssemble_Ref(subOperators[i], offset, valuesarray);
+    CeedChk(ierr);
+    ierr = CeedSingleOperatorAssemblyCount_Ref(subOperators[i], &count);
+    CeedChk(ierr);
+    offset += count;
+  }
+  ierr = CeedVectorRestoreArray(values, &valuesarray); CeedChk(ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Create FDM Element Inverse
 //------------------------------------------------------------------------------
@@ -1016,7 +1888,7 @@ int CeedOperatorCreateFDMElementInverse_Ref(CeedOperator op,
     // LCOV_EXCL_START
     return CeedError(ceed, 1, "No active field set");
   // LCOV_EXCL_STOP
-  CeedInt P1d, Q1d, elemsize, nqpts, dim, ncomp = 1, nelem = 1, lsize = 1;
+  CeedInt P1d, Q1d, elemsize, nqpts, dim, ncomp = 1, nelem = 1;
   ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
   ierr = CeedBasisGetNumNodes(basis, &elemsize); CeedChk(ierr);
   ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
@@ -1024,7 +1896,6 @@ int CeedOperatorCreateFDMElementInverse_Ref(CeedOperator op,
   ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
   ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
   ierr = CeedElemRestrictionGetNumElements(rstr, &nelem); CeedChk(ierr);
-  ierr = CeedElemRestrictionGetLVectorSize(rstr, &lsize); CeedChk(ierr);
 
   // Build and diagonalize 1D Mass and Laplacian
   bool tensorbasis;
@@ -1073,13 +1944,30 @@ int CeedOperatorCreateFDMElementInverse_Ref(CeedOperator op,
   // Assemble QFunction
   CeedVector assembled;
   CeedElemRestriction rstr_qf;
-  ierr =  CeedOperatorLinearAssembleQFunction(op, &assembled, &rstr_qf,
-          request); CeedChk(ierr);
+  ierr = CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled,
+         &rstr_qf, request); CeedChk(ierr);
   ierr = CeedElemRestrictionDestroy(&rstr_qf); CeedChk(ierr);
   CeedScalar maxnorm = 0;
   ierr = CeedVectorNorm(assembled, CEED_NORM_MAX, &maxnorm); CeedChk(ierr);
 
-  // Calculate element averages
+  // Calculate element averages, of the mass and of the Laplacian in each
+  //   direction for the directional mode
+  CeedFDMMode fdmmode;
+  ierr = CeedOperatorGetFDMMode(op, &fdmmode); CeedChk(ierr);
+  CeedInt numemodein, numemodeout;
+  CeedEvalMode *emodein, *emodeout;
+  CeedBasis basisemode;
+  CeedElemRestriction rstremode;
+  ierr = CeedOperatorGetActiveEmodes_Ref(op, false, &basisemode, &rstremode,
+                                         &numemodein, &emodein); CeedChk(ierr);
+  ierr = CeedOperatorGetActiveEmodes_Ref(op, true, &basisemode, &rstremode,
+                                         &numemodeout, &emodeout); CeedChk(ierr);
+  ierr = CeedFree(&emodeout); CeedChk(ierr);
+  if (fdmmode == CEED_FDM_DIRECTIONAL && numemodein != numemodeout)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Directional FDM requires matching active input "
+                     "and output evaluation modes");
+  // LCOV_EXCL_STOP
   CeedInt nfields = ((interp?1:0) + (grad?dim:0))*((interp?1:0) + (grad?dim:0));
   CeedScalar *elemavg;
   const CeedScalar *assembledarray, *qweightsarray;
@@ -1091,20 +1979,47 @@ int CeedOperatorCreateFDMElementInverse_Ref(CeedOperator op,
   CeedChk(ierr);
   ierr = CeedVectorGetArrayRead(qweights, CEED_MEM_HOST, &qweightsarray);
   CeedChk(ierr);
-  ierr = CeedCalloc(nelem, &elemavg); CeedChk(ierr);
+  ierr = CeedCalloc(nelem*(dim+1), &elemavg); CeedChk(ierr);
   for (CeedInt e=0; e<nelem; e++) {
-    CeedInt count = 0;
-    for (CeedInt q=0; q<nqpts; q++)
-      for (CeedInt i=0; i<ncomp*ncomp*nfields; i++)
-        if (fabs(assembledarray[e*nelem*nqpts*ncomp*ncomp*nfields +
-                                                                  i*nqpts + q]) > maxnorm*1e-12) {
-          elemavg[e] += assembledarray[e*nelem*nqpts*ncomp*ncomp*nfields +
-                                       i*nqpts + q] / qweightsarray[q];
-          count++;
-        }
-    if (count)
-      elemavg[e] /= count;
+    if (fdmmode == CEED_FDM_DIRECTIONAL) {
+      // Diagonal blocks of the assembled QFunction, [e, ein, cin, eout, cout]
+      for (CeedInt ein=0, d=0; ein<numemodein; ein++) {
+        CeedInt slot = 0, count = 0;
+        if (emodein[ein] == CEED_EVAL_GRAD)
+          slot = 1 + (d++ % dim);
+        else if (emodein[ein] != CEED_EVAL_INTERP)
+          continue;
+        for (CeedInt c=0; c<ncomp; c++)
+          for (CeedInt q=0; q<nqpts; q++) {
+            CeedScalar value =
+              assembledarray[((((e*numemodein+ein)*ncomp+c)*numemodein+ein)*
+                              ncomp+c)*nqpts+q];
+            if (fabs(value) > maxnorm*1e-12) {
+              elemavg[e*(dim+1)+slot] += value / qweightsarray[q];
+              count++;
+            }
+          }
+        if (count)
+          elemavg[e*(dim+1)+slot] /= count;
+      }
+    } else {
+      CeedInt count = 0;
+      CeedScalar avg = 0;
+      for (CeedInt q=0; q<nqpts; q++)
+        for (CeedInt i=0; i<ncomp*ncomp*nfields; i++)
+          if (fabs(assembledarray[(e*ncomp*ncomp*nfields + i)*nqpts + q]) >
+              maxnorm*1e-12) {
+            avg += assembledarray[(e*ncomp*ncomp*nfields + i)*nqpts + q] /
+                   qweightsarray[q];
+            count++;
+          }
+      if (count)
+        avg /= count;
+      for (CeedInt d=0; d<=dim; d++)
+        elemavg[e*(dim+1)+d] = avg;
+    }
   }
+  ierr = CeedFree(&emodein); CeedChk(ierr);
   ierr = CeedVectorRestoreArrayRead(assembled, &assembledarray); CeedChk(ierr);
   ierr = CeedVectorDestroy(&assembled); CeedChk(ierr);
   ierr = CeedVectorRestoreArrayRead(qweights, &qweightsarray); CeedChk(ierr);
@@ -1113,22 +2028,21 @@ int CeedOperatorCreateFDMElementInverse_Ref(CeedOperator op,
   // Build FDM diagonal
   CeedVector qdata;
   CeedScalar *qdataarray;
-  ierr = CeedVectorCreate(ceedparent, nelem*ncomp*lsize, &qdata); CeedChk(ierr);
+  ierr = CeedVectorCreate(ceedparent, nelem*ncomp*elemsize, &qdata);
+  CeedChk(ierr);
   ierr = CeedVectorSetArray(qdata, CEED_MEM_HOST, CEED_COPY_VALUES, NULL);
   CeedChk(ierr);
   ierr = CeedVectorGetArray(qdata, CEED_MEM_HOST, &qdataarray); CeedChk(ierr);
   for (CeedInt e=0; e<nelem; e++)
     for (CeedInt c=0; c<ncomp; c++)
-      for (CeedInt n=0; n<lsize; n++) {
-        if (interp)
-          qdataarray[(e*ncomp+c)*lsize+n] = 1;
+      for (CeedInt n=0; n<elemsize; n++) {
+        CeedScalar value = interp ? elemavg[e*(dim+1)] : 0;
         if (grad)
           for (CeedInt d=0; d<dim; d++) {
             CeedInt i = (n / CeedIntPow(P1d, d)) % P1d;
-            qdataarray[(e*ncomp+c)*lsize+n] += lambda[i];
+            value += elemavg[e*(dim+1)+1+d] * lambda[i];
           }
-        qdataarray[(e*ncomp+c)*lsize+n] = 1 / (elemavg[e] *
-                                               qdataarray[(e*ncomp+c)*lsize+n]);
+        qdataarray[(e*ncomp+c)*elemsize+n] = 1 / value;
       }
   ierr = CeedFree(&elemavg); CeedChk(ierr);
   ierr = CeedVectorRestoreArray(qdata, &qdataarray); CeedChk(ierr);
@@ -1151,10 +2065,10 @@ int CeedOperatorCreateFDMElementInverse_Ref(CeedOperator op,
 
   // -- Restriction
   CeedElemRestriction rstr_i;
-  CeedInt strides[3] = {1, lsize, lsize*ncomp};
-  ierr = CeedElemRestrictionCreateStrided(ceedparent, nelem, lsize, ncomp,
-                                          lsize*nelem*ncomp, strides, &rstr_i);
-  CeedChk(ierr);
+  CeedInt strides[3] = {1, elemsize, elemsize*ncomp};
+  ierr = CeedElemRestrictionCreateStrided(ceedparent, nelem, elemsize, ncomp,
+                                          elemsize*nelem*ncomp, strides,
+                                          &rstr_i); CeedChk(ierr);
   // -- QFunction
   CeedQFunction mass_qf;
   ierr = CeedQFunctionCreateInteriorByName(ceedparent, "MassApply", &mass_qf);
@@ -1190,8 +2104,14 @@ static int CeedOperatorDestroy_Ref(CeedOperator op) {
     ierr = CeedVectorDestroy(&impl->evecs[i]); CeedChk(ierr);
   }
   ierr = CeedFree(&impl->evecs); CeedChk(ierr);
+  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    ierr = CeedFree(&impl->fields[i].bcpos); CeedChk(ierr);
+    ierr = CeedFree(&impl->fields[i].bck); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->fields); CeedChk(ierr);
   ierr = CeedFree(&impl->edata); CeedChk(ierr);
   ierr = CeedFree(&impl->inputstate); CeedChk(ierr);
+  ierr = CeedFree(&impl->cachedevecs); CeedChk(ierr);
 
   for (CeedInt i=0; i<impl->numein; i++) {
     ierr = CeedVectorDestroy(&impl->evecsin[i]); CeedChk(ierr);
@@ -1206,6 +2126,11 @@ static int CeedOperatorDestroy_Ref(CeedOperator op) {
   }
   ierr = CeedFree(&impl->evecsout); CeedChk(ierr);
   ierr = CeedFree(&impl->qvecsout); CeedChk(ierr);
+  ierr = CeedFree(&impl->qstorage); CeedChk(ierr);
+  ierr = CeedFree(&impl->qdatain); CeedChk(ierr);
+  ierr = CeedFree(&impl->qdataout); CeedChk(ierr);
+  ierr = CeedFree(&impl->tilestorage); CeedChk(ierr);
+  ierr = CeedFree(&impl->tiledata); CeedChk(ierr);
 
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
@@ -1226,6 +2151,10 @@ int CeedOperatorCreate_Ref(CeedOperator op) {
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction",
                                 CeedOperatorLinearAssembleQFunction_Ref);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op,
+                                "LinearAssembleQFunctionUpdate",
+                                CeedOperatorLinearAssembleQFunctionUpdate_Ref);
+  CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddDiagonal",
                                 CeedOperatorLinearAssembleAddDiagonal_Ref);
   CeedChk(ierr);
@@ -1233,11 +2162,22 @@ int CeedOperatorCreate_Ref(CeedOperator op) {
                                 "LinearAssembleAddPointBlockDiagonal",
                                 CeedOperatorLinearAssembleAddPointBlockDiagonal_Ref);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleSymbolic",
+                                CeedOperatorLinearAssembleSymbolic_Ref);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssemble",
+                                CeedOperatorLinearAssemble_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "CreateFDMElementInverse",
                                 CeedOperatorCreateFDMElementInverse_Ref);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Apply",
+                                CeedOperatorApply_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
                                 CeedOperatorApplyAdd_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyDot",
+                                CeedOperatorApplyDot_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "SetDirichlet",
+                                CeedOperatorSetDirichlet_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
                                 CeedOperatorDestroy_Ref); CeedChk(ierr);
   return 0;
@@ -1257,6 +2197,11 @@ int CeedCompositeOperatorCreate_Ref(CeedOperator op) {
                                 "LinearAssembleAddPointBlockDiagonal",
                                 CeedOperatorLinearAssembleAddPointBlockDiagonal_Ref);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleSymbolic",
+                                CeedOperatorLinearAssembleSymbolic_Ref);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssemble",
+                                CeedOperatorLinearAssemble_Ref); CeedChk(ierr);
   return 0;
 }
 //------------------------------------------------------------------------------
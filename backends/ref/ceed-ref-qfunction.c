@@ -17,14 +17,12 @@
 #include "ceed-ref.h"
 
 //------------------------------------------------------------------------------
-// QFunction Apply
+// QFunction Apply to Raw Arrays
 //------------------------------------------------------------------------------
-static int CeedQFunctionApply_Ref(CeedQFunction qf, CeedInt Q,
-                                  CeedVector *U, CeedVector *V) {
+static int CeedQFunctionApplyRaw_Ref(CeedQFunction qf, CeedInt Q,
+                                     const CeedScalar *const *U,
+                                     CeedScalar *const *V) {
   int ierr;
-  CeedQFunction_Ref *impl;
-  ierr = CeedQFunctionGetData(qf, &impl); CeedChk(ierr);
-
   CeedQFunctionContext ctx;
   ierr = CeedQFunctionGetContext(qf, &ctx); CeedChk(ierr);
   void *ctxData = NULL;
@@ -36,8 +34,30 @@ static int CeedQFunctionApply_Ref(CeedQFunction qf, CeedInt Q,
   CeedQFunctionUser f = NULL;
   ierr = CeedQFunctionGetUserFunction(qf, &f); CeedChk(ierr);
 
+  ierr = f(ctxData, Q, U, V); CeedChk(ierr);
+
+  if (ctx) {
+    ierr = CeedQFunctionContextRestoreData(ctx, &ctxData); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// QFunction Apply
+//------------------------------------------------------------------------------
+static int CeedQFunctionApply_Ref(CeedQFunction qf, CeedInt Q,
+                                  CeedVector *U, CeedVector *V) {
+  int ierr;
+  CeedQFunction_Ref *impl;
+  ierr = CeedQFunctionGetData(qf, &impl); CeedChk(ierr);
+
   CeedInt nIn, nOut;
   ierr = CeedQFunctionGetNumArgs(qf, &nIn, &nOut); CeedChk(ierr);
+  if (!impl->inputs) {
+    ierr = CeedCalloc(nIn, &impl->inputs); CeedChk(ierr);
+    ierr = CeedCalloc(nOut, &impl->outputs); CeedChk(ierr);
+  }
 
   for (int i = 0; i<nIn; i++) {
     ierr = CeedVectorGetArrayRead(U[i], CEED_MEM_HOST, &impl->inputs[i]);
@@ -48,7 +68,8 @@ static int CeedQFunctionApply_Ref(CeedQFunction qf, CeedInt Q,
     CeedChk(ierr);
   }
 
-  ierr = f(ctxData, Q, impl->inputs, impl->outputs); CeedChk(ierr);
+  ierr = CeedQFunctionApplyRaw_Ref(qf, Q, impl->inputs, impl->outputs);
+  CeedChk(ierr);
 
   for (int i = 0; i<nIn; i++) {
     ierr = CeedVectorRestoreArrayRead(U[i], &impl->inputs[i]); CeedChk(ierr);
@@ -56,9 +77,6 @@ static int CeedQFunctionApply_Ref(CeedQFunction qf, CeedInt Q,
   for (int i = 0; i<nOut; i++) {
     ierr = CeedVectorRestoreArray(V[i], &impl->outputs[i]); CeedChk(ierr);
   }
-  if (ctx) {
-    ierr = CeedQFunctionContextRestoreData(ctx, &ctxData); CeedChk(ierr);
-  }
 
   return 0;
 }
@@ -88,12 +106,12 @@ int CeedQFunctionCreate_Ref(CeedQFunction qf) {
 
   CeedQFunction_Ref *impl;
   ierr = CeedCalloc(1, &impl); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->inputs); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->outputs); CeedChk(ierr);
   ierr = CeedQFunctionSetData(qf, impl); CeedChk(ierr);
 
   ierr = CeedSetBackendFunction(ceed, "QFunction", qf, "Apply",
                                 CeedQFunctionApply_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "QFunction", qf, "ApplyRaw",
+                                CeedQFunctionApplyRaw_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "QFunction", qf, "Destroy",
                                 CeedQFunctionDestroy_Ref); CeedChk(ierr);
 
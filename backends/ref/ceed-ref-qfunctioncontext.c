@@ -34,16 +34,24 @@ static int CeedQFunctionContextSetData_Ref(CeedQFunctionContext ctx,
     // LCOV_EXCL_START
     return CeedError(ceed, 1, "Only MemType = HOST supported");
   // LCOV_EXCL_STOP
+  if (impl->data_allocated) {
+    ierr = CeedQFunctionContextTrackMemory(ctx, CEED_MEMSPACE_HOST,
+                                           -(ptrdiff_t)ctxsize); CeedChk(ierr);
+  }
   ierr = CeedFree(&impl->data_allocated); CeedChk(ierr);
   switch (cmode) {
   case CEED_COPY_VALUES:
     ierr = CeedMallocArray(1, ctxsize, &impl->data_allocated); CeedChk(ierr);
     impl->data = impl->data_allocated;
     memcpy(impl->data, data, ctxsize);
+    ierr = CeedQFunctionContextTrackMemory(ctx, CEED_MEMSPACE_HOST, ctxsize);
+    CeedChk(ierr);
     break;
   case CEED_OWN_POINTER:
     impl->data_allocated = data;
     impl->data = data;
+    ierr = CeedQFunctionContextTrackMemory(ctx, CEED_MEMSPACE_HOST, ctxsize);
+    CeedChk(ierr);
     break;
   case CEED_USE_POINTER:
     impl->data = data;
@@ -28,9 +28,10 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
   ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
   const CeedScalar *uu;
   CeedScalar *vv;
-  CeedInt nelem, elemsize, voffset;
+  CeedInt nelem, elemsize, nsides, voffset;
   ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
   ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumSides(r, &nsides); CeedChk(ierr);
   voffset = start*blksize*elemsize*ncomp;
 
   ierr = CeedVectorGetArrayRead(u, CEED_MEM_HOST, &uu); CeedChk(ierr);
@@ -38,8 +39,21 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
   // Restriction from L-vector to E-vector
   // Perform: v = r * u
   if (tmode == CEED_NOTRANSPOSE) {
-    // No offsets provided, Identity Restriction
-    if (!impl->offsets) {
+    if (impl->blkeoffsets) {
+      // Compressed restriction, offsets computed from element base offsets
+      // vv has shape [elemsize, ncomp, nelem], row-major
+      // uu has shape [nnodes, ncomp]
+      for (CeedInt e = start*blksize; e < stop*blksize; e+=blksize)
+        CeedPragmaSIMD
+        for (CeedInt k = 0; k < ncomp; k++)
+          CeedPragmaSIMD
+          for (CeedInt n = 0; n < elemsize; n++)
+            CeedPragmaSIMD
+            for (CeedInt j = 0; j < blksize; j++)
+              vv[elemsize*(k*blksize+ncomp*e) + n*blksize + j - voffset]
+                = uu[impl->blkeoffsets[e+j] + impl->stencil[n] + k*compstride];
+    } else if (!impl->offsets) {
+      // No offsets provided, Identity Restriction
       bool backendstrides;
       ierr = CeedElemRestrictionHasBackendStrides(r, &backendstrides);
       CeedChk(ierr);
@@ -71,6 +85,33 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
                   = uu[n*strides[0] + k*strides[1] +
                                     CeedIntMin(e+j, nelem-1)*strides[2]];
       }
+    } else if (impl->offsets16) {
+      // 16-bit offsets relative to the base offset of each block
+      for (CeedInt e = start*blksize; e < stop*blksize; e+=blksize) {
+        const CeedScalar *ub = uu + impl->blkbase[e/blksize];
+        CeedPragmaSIMD
+        for (CeedInt k = 0; k < ncomp; k++)
+          CeedPragmaSIMD
+          for (CeedInt i = 0; i < elemsize*blksize; i++)
+            vv[elemsize*(k*blksize+ncomp*e) + i - voffset]
+              = ub[impl->offsets16[i+elemsize*e] + k*compstride];
+      }
+    } else if (nsides > 1) {
+      // Two-sided restriction, the offsets of each block have shape
+      //   [nsides, elemsize, blksize] and side s fills the components
+      //   [s*sncomp, (s+1)*sncomp)
+      const CeedInt sncomp = ncomp / nsides;
+      for (CeedInt e = start*blksize; e < stop*blksize; e+=blksize)
+        for (CeedInt s = 0; s < nsides; s++) {
+          const CeedInt *soffsets = impl->offsets +
+                                    elemsize*(e*nsides + s*blksize);
+          CeedPragmaSIMD
+          for (CeedInt k = 0; k < sncomp; k++)
+            CeedPragmaSIMD
+            for (CeedInt i = 0; i < elemsize*blksize; i++)
+              vv[elemsize*((s*sncomp+k)*blksize+ncomp*e) + i - voffset]
+                = uu[soffsets[i] + k*compstride];
+        }
     } else {
       // Offsets provided, standard or blocked restriction
       // vv has shape [elemsize, ncomp, nelem], row-major
@@ -86,8 +127,19 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
   } else {
     // Restriction from E-vector to L-vector
     // Performing v += r^T * u
-    // No offsets provided, Identity Restriction
-    if (!impl->offsets) {
+    if (impl->blkeoffsets) {
+      // Compressed restriction, offsets computed from element base offsets
+      // uu has shape [elemsize, ncomp, nelem]
+      // vv has shape [nnodes, ncomp]
+      for (CeedInt e = start*blksize; e < stop*blksize; e+=blksize)
+        for (CeedInt k = 0; k < ncomp; k++)
+          for (CeedInt n = 0; n < elemsize; n++)
+            // Iteration bound set to discard padding elements
+            for (CeedInt j = 0; j < CeedIntMin(blksize, nelem-e); j++)
+              vv[impl->blkeoffsets[e+j] + impl->stencil[n] + k*compstride]
+              += uu[elemsize*(k*blksize+ncomp*e) + n*blksize + j - voffset];
+    } else if (!impl->offsets) {
+      // No offsets provided, Identity Restriction
       bool backendstrides;
       ierr = CeedElemRestrictionHasBackendStrides(r, &backendstrides);
       CeedChk(ierr);
@@ -117,6 +169,32 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
                 vv[n*strides[0] + k*strides[1] + (e+j)*strides[2]]
                 += uu[e*elemsize*ncomp + (k*elemsize+n)*blksize + j - voffset];
       }
+    } else if (impl->offsets16) {
+      // 16-bit offsets relative to the base offset of each block
+      for (CeedInt e = start*blksize; e < stop*blksize; e+=blksize) {
+        CeedScalar *vb = vv + impl->blkbase[e/blksize];
+        for (CeedInt k = 0; k < ncomp; k++)
+          for (CeedInt i = 0; i < elemsize*blksize; i+=blksize)
+            // Iteration bound set to discard padding elements
+            for (CeedInt j = i; j < i+CeedIntMin(blksize, nelem-e); j++)
+              vb[impl->offsets16[j+e*elemsize] + k*compstride]
+              += uu[elemsize*(k*blksize+ncomp*e) + j - voffset];
+      }
+    } else if (nsides > 1) {
+      // Two-sided restriction, side s holds the components
+      //   [s*sncomp, (s+1)*sncomp)
+      const CeedInt sncomp = ncomp / nsides;
+      for (CeedInt e = start*blksize; e < stop*blksize; e+=blksize)
+        for (CeedInt s = 0; s < nsides; s++) {
+          const CeedInt *soffsets = impl->offsets +
+                                    elemsize*(e*nsides + s*blksize);
+          for (CeedInt k = 0; k < sncomp; k++)
+            for (CeedInt i = 0; i < elemsize*blksize; i+=blksize)
+              // Iteration bound set to discard padding elements
+              for (CeedInt j = i; j < i+CeedIntMin(blksize, nelem-e); j++)
+                vv[soffsets[j] + k*compstride]
+                += uu[elemsize*((s*sncomp+k)*blksize+ncomp*e) + j - voffset];
+        }
     } else {
       // Offsets provided, standard or blocked restriction
       // uu has shape [elemsize, ncomp, nelem]
@@ -140,105 +218,51 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r,
 //------------------------------------------------------------------------------
 // ElemRestriction Apply - Common Sizes
 //------------------------------------------------------------------------------
-static int CeedElemRestrictionApply_Ref_110(CeedElemRestriction r,
-    const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 1, 1, compstride, start, stop,
-         tmode, u, v, request);
-}
-
-static int CeedElemRestrictionApply_Ref_111(CeedElemRestriction r,
-    const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 1, 1, 1, start, stop, tmode,
-         u, v, request);
-}
-
-static int CeedElemRestrictionApply_Ref_180(CeedElemRestriction r,
-    const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 1, 8, compstride, start, stop,
-         tmode, u, v, request);
-}
-
-static int CeedElemRestrictionApply_Ref_181(CeedElemRestriction r,
-    const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 1, 8, 1, start, stop, tmode,
-         u, v, request);
-}
-
-static int CeedElemRestrictionApply_Ref_310(CeedElemRestriction r,
-    const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 3, 1, compstride, start, stop,
-         tmode, u, v, request);
-}
-
-static int CeedElemRestrictionApply_Ref_311(CeedElemRestriction r,
-    const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 3, 1, 1, start, stop, tmode,
-         u, v, request);
-}
-
-static int CeedElemRestrictionApply_Ref_380(CeedElemRestriction r,
-    const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 3, 8, compstride, start, stop,
-         tmode, u, v, request);
-}
-
-static int CeedElemRestrictionApply_Ref_381(CeedElemRestriction r,
-    const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 3, 8, 1, start, stop, tmode,
-         u, v, request);
-}
-
-// LCOV_EXCL_START
-static int CeedElemRestrictionApply_Ref_510(CeedElemRestriction r,
-    const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 5, 1, compstride, start, stop,
-         tmode, u, v, request);
-}
-// LCOV_EXCL_STOP
-
-static int CeedElemRestrictionApply_Ref_511(CeedElemRestriction r,
-    const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 5, 1, 1, start, stop, tmode,
-         u, v, request);
-}
+// Specializations of the core for a number of components and block size, with
+//   a general or unit component stride
+#define CEED_REF_RESTRICTION_APPLY(ncomp, blksize)                             \
+  static int CeedElemRestrictionApply_Ref_ ## ncomp ## _ ## blksize ## _0(     \
+      CeedElemRestriction r, const CeedInt nc, const CeedInt bs,               \
+      const CeedInt compstride, CeedInt start, CeedInt stop,                   \
+      CeedTransposeMode tmode, CeedVector u, CeedVector v,                     \
+      CeedRequest *request) {                                                  \
+    return CeedElemRestrictionApply_Ref_Core(r, ncomp, blksize, compstride,    \
+           start, stop, tmode, u, v, request);                                 \
+  }                                                                            \
+  static int CeedElemRestrictionApply_Ref_ ## ncomp ## _ ## blksize ## _1(     \
+      CeedElemRestriction r, const CeedInt nc, const CeedInt bs,               \
+      const CeedInt compstride, CeedInt start, CeedInt stop,                   \
+      CeedTransposeMode tmode, CeedVector u, CeedVector v,                     \
+      CeedRequest *request) {                                                  \
+    return CeedElemRestrictionApply_Ref_Core(r, ncomp, blksize, 1, start,      \
+           stop, tmode, u, v, request);                                        \
+  }
 
-// LCOV_EXCL_START
-static int CeedElemRestrictionApply_Ref_580(CeedElemRestriction r,
-    const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 5, 8, compstride, start, stop,
-         tmode, u, v, request);
-}
-// LCOV_EXCL_STOP
-
-static int CeedElemRestrictionApply_Ref_581(CeedElemRestriction r,
-    const CeedInt ncomp, const CeedInt blksize, const CeedInt compstride,
-    CeedInt start, CeedInt stop, CeedTransposeMode tmode, CeedVector u,
-    CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 5, 8, 1, start, stop, tmode,
-         u, v, request);
-}
+// Scalar fields, vector fields and their gradients in 2D and 3D, symmetric
+//   tensors, conserved variables of the Euler equations, and stresses
+#define CEED_REF_RESTRICTION_NCOMP(X, blksize)                                 \
+  X(1, blksize) X(2, blksize) X(3, blksize) X(4, blksize) X(5, blksize)        \
+  X(6, blksize) X(9, blksize)
+#define CEED_REF_RESTRICTION_SIZES(X)                                          \
+  CEED_REF_RESTRICTION_NCOMP(X, 1) CEED_REF_RESTRICTION_NCOMP(X, 8)            \
+  CEED_REF_RESTRICTION_NCOMP(X, 16)
+
+CEED_REF_RESTRICTION_SIZES(CEED_REF_RESTRICTION_APPLY)
+
+// Table of specializations, indexed by the unit component stride
+#define CEED_REF_RESTRICTION_ENTRY(ncomp, blksize)                             \
+  {ncomp, blksize, {                                                           \
+      CeedElemRestrictionApply_Ref_ ## ncomp ## _ ## blksize ## _0,            \
+      CeedElemRestrictionApply_Ref_ ## ncomp ## _ ## blksize ## _1}},
+
+static const struct {
+  CeedInt ncomp, blksize;
+  int (*Apply[2])(CeedElemRestriction, const CeedInt, const CeedInt,
+                  const CeedInt, CeedInt, CeedInt, CeedTransposeMode,
+                  CeedVector, CeedVector, CeedRequest *);
+} CeedElemRestrictionApplyTable_Ref[] = {
+  CEED_REF_RESTRICTION_SIZES(CEED_REF_RESTRICTION_ENTRY)
+};
 
 //------------------------------------------------------------------------------
 // ElemRestriction Apply
@@ -277,6 +301,136 @@ static int CeedElemRestrictionApplyBlock_Ref(CeedElemRestriction r,
                      request);
 }
 
+//------------------------------------------------------------------------------
+// L-vector entry of an E-vector entry of an unblocked restriction
+//------------------------------------------------------------------------------
+static inline CeedInt CeedElemRestrictionLIndex_Ref(const CeedInt *offsets,
+    const CeedInt strides[3], const CeedInt compstride, const CeedInt elemsize,
+    const CeedInt e, const CeedInt k, const CeedInt n) {
+  return offsets ? offsets[n + e*elemsize] + k*compstride :
+         n*strides[0] + k*strides[1] + e*strides[2];
+}
+
+//------------------------------------------------------------------------------
+// Mark the first contribution to each L-vector entry, called with the Ceed
+//   locked
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionMarkFirst_Ref(CeedElemRestriction r,
+    const CeedInt *offsets, const CeedInt strides[3]) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+  if (impl->tfirst)
+    return 0;
+  CeedInt nelem, elemsize, ncomp, compstride, lsize;
+  ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
+
+  bool *tfirst, *touched;
+  CeedInt ntouched = 0;
+  ierr = CeedCalloc(nelem*ncomp*elemsize, &tfirst); CeedChk(ierr);
+  ierr = CeedElemRestrictionTrackMemory(r, CEED_MEMSPACE_HOST,
+                                        nelem*ncomp*elemsize*sizeof(bool));
+  CeedChk(ierr);
+  ierr = CeedCalloc(lsize, &touched); CeedChk(ierr);
+  for (CeedInt e = 0; e < nelem; e++)
+    for (CeedInt k = 0; k < ncomp; k++)
+      for (CeedInt n = 0; n < elemsize; n++) {
+        const CeedInt l = CeedElemRestrictionLIndex_Ref(offsets, strides,
+                          compstride, elemsize, e, k, n);
+        if (!touched[l]) {
+          touched[l] = true;
+          tfirst[(e*ncomp + k)*elemsize + n] = true;
+          ntouched++;
+        }
+      }
+  ierr = CeedFree(&touched); CeedChk(ierr);
+  impl->tcovers = ntouched == lsize;
+  __atomic_store_n(&impl->tfirst, tfirst, __ATOMIC_RELEASE);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Apply Transpose Overwrite
+//
+// The first contribution to each L-vector entry, in loop order, is stored and
+//   the others added. Restrictions that leave some L-vector entries untouched,
+//   and blocked or two-sided restrictions, zero the output and add instead.
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionApplyOverwrite_Ref(CeedElemRestriction r,
+    CeedVector u, CeedVector v, CeedRequest *request) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+  CeedInt nelem, elemsize, ncomp, compstride, lsize, blksize, nsides;
+  ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetBlockSize(r, &blksize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumSides(r, &nsides); CeedChk(ierr);
+  const CeedInt *offsets = NULL;
+  CeedInt strides[3] = {1, elemsize, elemsize*ncomp};
+  bool isStrided;
+  ierr = CeedElemRestrictionIsStrided(r, &isStrided); CeedChk(ierr);
+  if (isStrided) {
+    bool backendstrides;
+    ierr = CeedElemRestrictionHasBackendStrides(r, &backendstrides);
+    CeedChk(ierr);
+    if (!backendstrides) {
+      ierr = CeedElemRestrictionGetStrides(r, &strides); CeedChk(ierr);
+    }
+  } else if (blksize == 1 && nsides == 1) {
+    ierr = CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
+    CeedChk(ierr);
+  }
+
+  // Mark first contributions on first use, once for restrictions shared by
+  //   operators applied on several threads
+  if (!__atomic_load_n(&impl->tfirst, __ATOMIC_ACQUIRE) && blksize == 1 &&
+      nsides == 1) {
+    Ceed ceed;
+    ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
+    ierr = CeedLock(ceed); CeedChk(ierr);
+    int ierrmark = CeedElemRestrictionMarkFirst_Ref(r, offsets, strides);
+    ierr = CeedUnlock(ceed); CeedChk(ierr);
+    CeedChk(ierrmark);
+  }
+  if (!impl->tcovers) {
+    if (offsets) {
+      ierr = CeedElemRestrictionRestoreOffsets(r, &offsets); CeedChk(ierr);
+    }
+    ierr = CeedVectorSetValue(v, 0.0); CeedChk(ierr);
+    return CeedElemRestrictionApply_Ref(r, CEED_TRANSPOSE, u, v, request);
+  }
+
+  // Perform: v = r^T * u
+  const CeedScalar *uu;
+  CeedScalar *vv;
+  ierr = CeedVectorGetArrayRead(u, CEED_MEM_HOST, &uu); CeedChk(ierr);
+  ierr = CeedVectorGetArray(v, CEED_MEM_HOST, &vv); CeedChk(ierr);
+  for (CeedInt e = 0; e < nelem; e++)
+    for (CeedInt k = 0; k < ncomp; k++)
+      for (CeedInt n = 0; n < elemsize; n++) {
+        const CeedInt i = (e*ncomp + k)*elemsize + n;
+        const CeedInt l = CeedElemRestrictionLIndex_Ref(offsets, strides,
+                          compstride, elemsize, e, k, n);
+        vv[l] = impl->tfirst[i] ? uu[i] : vv[l] + uu[i];
+      }
+  ierr = CeedVectorRestoreArrayRead(u, &uu); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(v, &vv); CeedChk(ierr);
+  if (offsets) {
+    ierr = CeedElemRestrictionRestoreOffsets(r, &offsets); CeedChk(ierr);
+  }
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // ElemRestriction Get Offsets
 //------------------------------------------------------------------------------
@@ -293,10 +447,70 @@ static int CeedElemRestrictionGetOffsets_Ref(CeedElemRestriction rstr,
     return CeedError(ceed, 1, "Can only provide to HOST memory");
   // LCOV_EXCL_STOP
 
+  // Expand compressed offsets on first request
+  if (!impl->offsets && impl->blkeoffsets) {
+    CeedInt numblk, blksize, elemsize;
+    ierr = CeedElemRestrictionGetNumBlocks(rstr, &numblk); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetBlockSize(rstr, &blksize); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetElementSize(rstr, &elemsize); CeedChk(ierr);
+    ierr = CeedMallocHost(ceed, numblk*blksize*elemsize,
+                          &impl->offsets_allocated); CeedChk(ierr);
+    ierr = CeedElemRestrictionTrackMemory(rstr, CEED_MEMSPACE_HOST,
+                                          numblk*blksize*elemsize*
+                                          sizeof(CeedInt)); CeedChk(ierr);
+    for (CeedInt e = 0; e < numblk*blksize; e+=blksize)
+      for (CeedInt n = 0; n < elemsize; n++)
+        for (CeedInt j = 0; j < blksize; j++)
+          impl->offsets_allocated[e*elemsize + n*blksize + j]
+            = impl->blkeoffsets[e+j] + impl->stencil[n];
+    impl->offsets = impl->offsets_allocated;
+  }
+
   *offsets = impl->offsets;
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// ElemRestriction Set Index Type
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionSetIndexType_Ref(CeedElemRestriction rstr,
+    CeedIndexType itype) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(rstr, &impl); CeedChk(ierr);
+  CeedInt numblk, blksize, elemsize;
+  ierr = CeedElemRestrictionGetNumBlocks(rstr, &numblk); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetBlockSize(rstr, &blksize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstr, &elemsize); CeedChk(ierr);
+  const CeedInt blklen = blksize*elemsize;
+  const ptrdiff_t bytes = numblk*(blklen*sizeof(uint16_t) + sizeof(CeedInt));
+
+  if (impl->offsets16) {
+    ierr = CeedFree(&impl->offsets16); CeedChk(ierr);
+    ierr = CeedFree(&impl->blkbase); CeedChk(ierr);
+    ierr = CeedElemRestrictionTrackMemory(rstr, CEED_MEMSPACE_HOST, -bytes);
+    CeedChk(ierr);
+  }
+  if (itype != CEED_INDEX_INT16)
+    return 0;
+
+  // Offsets relative to the smallest offset of their block
+  ierr = CeedMalloc(numblk*blklen, &impl->offsets16); CeedChk(ierr);
+  ierr = CeedMalloc(numblk, &impl->blkbase); CeedChk(ierr);
+  ierr = CeedElemRestrictionTrackMemory(rstr, CEED_MEMSPACE_HOST, bytes);
+  CeedChk(ierr);
+  for (CeedInt b = 0; b < numblk; b++) {
+    const CeedInt *offsets = impl->offsets + b*blklen;
+    CeedInt base = offsets[0];
+    for (CeedInt i = 1; i < blklen; i++)
+      base = CeedIntMin(base, offsets[i]);
+    impl->blkbase[b] = base;
+    for (CeedInt i = 0; i < blklen; i++)
+      impl->offsets16[b*blklen + i] = offsets[i] - base;
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // ElemRestriction Destroy
 //------------------------------------------------------------------------------
@@ -304,8 +518,14 @@ static int CeedElemRestrictionDestroy_Ref(CeedElemRestriction r) {
   int ierr;
   CeedElemRestriction_Ref *impl;
   ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+  Ceed ceed;
+  ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
 
-  ierr = CeedFree(&impl->offsets_allocated); CeedChk(ierr);
+  ierr = CeedFreeHost(ceed, &impl->offsets_allocated); CeedChk(ierr);
+  ierr = CeedFree(&impl->blkeoffsets); CeedChk(ierr);
+  ierr = CeedFree(&impl->offsets16); CeedChk(ierr);
+  ierr = CeedFree(&impl->blkbase); CeedChk(ierr);
+  ierr = CeedFree(&impl->tfirst); CeedChk(ierr);
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
 }
@@ -318,15 +538,18 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mtype, CeedCopyMode cmode,
                                   CeedElemRestriction r) {
   int ierr;
   CeedElemRestriction_Ref *impl;
-  CeedInt nelem, elemsize, numblk, blksize, ncomp, compstride;
+  CeedInt nelem, elemsize, numblk, blksize, ncomp, compstride, nsides;
   ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
   ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
   ierr = CeedElemRestrictionGetNumBlocks(r, &numblk); CeedChk(ierr);
   ierr = CeedElemRestrictionGetBlockSize(r, &blksize); CeedChk(ierr);
   ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
   ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumSides(r, &nsides); CeedChk(ierr);
   Ceed ceed;
   ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
+  // Two-sided restrictions hold the offsets of every side of each face
+  const CeedInt rowsize = nsides*elemsize, sncomp = ncomp / nsides;
 
   if (mtype != CEED_MEM_HOST)
     // LCOV_EXCL_START
@@ -335,9 +558,37 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mtype, CeedCopyMode cmode,
   ierr = CeedCalloc(1, &impl); CeedChk(ierr);
 
   // Offsets data
-  bool isStrided;
+  bool isStrided, isCompressed;
   ierr = CeedElemRestrictionIsStrided(r, &isStrided); CeedChk(ierr);
-  if (!isStrided) {
+  ierr = CeedElemRestrictionIsCompressed(r, &isCompressed); CeedChk(ierr);
+  if (isCompressed) {
+    // Pad element base offsets to full blocks, the offsets are computed
+    //   during application
+    const CeedInt *eoffsets;
+    ierr = CeedElemRestrictionGetCompressedOffsets(r, &eoffsets,
+           &impl->stencil); CeedChk(ierr);
+    ierr = CeedMalloc(numblk*blksize, &impl->blkeoffsets); CeedChk(ierr);
+    ierr = CeedElemRestrictionTrackMemory(r, CEED_MEMSPACE_HOST,
+                                          numblk*blksize*sizeof(CeedInt));
+    CeedChk(ierr);
+    for (CeedInt e = 0; e < numblk*blksize; e++)
+      impl->blkeoffsets[e] = eoffsets[CeedIntMin(e, nelem-1)];
+
+    // Check offsets
+    CeedInt lsize, minstencil = impl->stencil[0], maxstencil = impl->stencil[0];
+    ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
+    for (CeedInt i = 1; i < elemsize; i++) {
+      minstencil = CeedIntMin(minstencil, impl->stencil[i]);
+      maxstencil = CeedIntMax(maxstencil, impl->stencil[i]);
+    }
+    for (CeedInt e = 0; e < nelem; e++)
+      if (eoffsets[e] + minstencil < 0 ||
+          lsize <= eoffsets[e] + maxstencil + (ncomp - 1) * compstride)
+        // LCOV_EXCL_START
+        return CeedError(ceed, 1, "Restriction offsets of element %d out of "
+                         "range [0, %d]", e, lsize);
+    // LCOV_EXCL_STOP
+  } else if (!isStrided) {
     // Check indices for ref or memcheck backends
     Ceed parentCeed = ceed, currCeed = NULL;
     while (parentCeed != currCeed) {
@@ -353,8 +604,8 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mtype, CeedCopyMode cmode,
       CeedInt lsize;
       ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
 
-      for (CeedInt i = 0; i < nelem*elemsize; i++)
-        if (offsets[i] < 0 || lsize <= offsets[i] + (ncomp - 1) * compstride)
+      for (CeedInt i = 0; i < nelem*rowsize; i++)
+        if (offsets[i] < 0 || lsize <= offsets[i] + (sncomp - 1) * compstride)
           // LCOV_EXCL_START
           return CeedError(ceed, 1, "Restriction offset %d (%d) out of range "
                            "[0, %d]", i, offsets[i], lsize);
@@ -364,15 +615,21 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mtype, CeedCopyMode cmode,
     // Copy data
     switch (cmode) {
     case CEED_COPY_VALUES:
-      ierr = CeedMalloc(nelem*elemsize, &impl->offsets_allocated);
+      ierr = CeedMallocHost(ceed, nelem*rowsize, &impl->offsets_allocated);
       CeedChk(ierr);
       memcpy(impl->offsets_allocated, offsets,
-             nelem * elemsize * sizeof(offsets[0]));
+             nelem * rowsize * sizeof(offsets[0]));
       impl->offsets = impl->offsets_allocated;
+      ierr = CeedElemRestrictionTrackMemory(r, CEED_MEMSPACE_HOST,
+                                            nelem*rowsize*sizeof(CeedInt));
+      CeedChk(ierr);
       break;
     case CEED_OWN_POINTER:
       impl->offsets_allocated = (CeedInt *)offsets;
       impl->offsets = impl->offsets_allocated;
+      ierr = CeedElemRestrictionTrackMemory(r, CEED_MEMSPACE_HOST,
+                                            numblk*blksize*rowsize*
+                                            sizeof(CeedInt)); CeedChk(ierr);
       break;
     case CEED_USE_POINTER:
       impl->offsets = offsets;
@@ -387,61 +644,28 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mtype, CeedCopyMode cmode,
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "ApplyBlock",
                                 CeedElemRestrictionApplyBlock_Ref);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "ApplyOverwrite",
+                                CeedElemRestrictionApplyOverwrite_Ref);
+  CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "GetOffsets",
                                 CeedElemRestrictionGetOffsets_Ref);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "SetIndexType",
+                                CeedElemRestrictionSetIndexType_Ref);
+  CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "Destroy",
                                 CeedElemRestrictionDestroy_Ref); CeedChk(ierr);
 
   // Set apply function based upon ncomp, blksize, and compstride
-  CeedInt idx = -1;
-  if (blksize < 10)
-    idx = 100*ncomp + 10*blksize + (compstride == 1);
-  switch (idx) {
-  case 110:
-    impl->Apply = CeedElemRestrictionApply_Ref_110;
-    break;
-  case 111:
-    impl->Apply = CeedElemRestrictionApply_Ref_111;
-    break;
-  case 180:
-    impl->Apply = CeedElemRestrictionApply_Ref_180;
-    break;
-  case 181:
-    impl->Apply = CeedElemRestrictionApply_Ref_181;
-    break;
-  case 310:
-    impl->Apply = CeedElemRestrictionApply_Ref_310;
-    break;
-  case 311:
-    impl->Apply = CeedElemRestrictionApply_Ref_311;
-    break;
-  case 380:
-    impl->Apply = CeedElemRestrictionApply_Ref_380;
-    break;
-  case 381:
-    impl->Apply = CeedElemRestrictionApply_Ref_381;
-    break;
-  // LCOV_EXCL_START
-  case 510:
-    impl->Apply = CeedElemRestrictionApply_Ref_510;
-    break;
-  // LCOV_EXCL_STOP
-  case 511:
-    impl->Apply = CeedElemRestrictionApply_Ref_511;
-    break;
-  // LCOV_EXCL_START
-  case 580:
-    impl->Apply = CeedElemRestrictionApply_Ref_580;
-    break;
-  // LCOV_EXCL_STOP
-  case 581:
-    impl->Apply = CeedElemRestrictionApply_Ref_581;
-    break;
-  default:
-    impl->Apply = CeedElemRestrictionApply_Ref_Core;
-    break;
-  }
+  impl->Apply = CeedElemRestrictionApply_Ref_Core;
+  const CeedInt numapply = sizeof(CeedElemRestrictionApplyTable_Ref) /
+                           sizeof(CeedElemRestrictionApplyTable_Ref[0]);
+  for (CeedInt i=0; i<numapply && nsides == 1; i++)
+    if (CeedElemRestrictionApplyTable_Ref[i].ncomp == ncomp &&
+        CeedElemRestrictionApplyTable_Ref[i].blksize == blksize) {
+      impl->Apply = CeedElemRestrictionApplyTable_Ref[i].Apply[compstride == 1];
+      break;
+    }
 
   return 0;
 }
@@ -16,6 +16,65 @@
 
 #include "ceed-ref.h"
 
+// Columns of u split into even and odd parts at a time
+#define CEED_REF_EVEN_ODD_CHUNK 64
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply of a matrix T with T[J-1-j][B-1-b] = sign*T[j][b]
+//
+// With e = u[b] + u[B-1-b] and o = u[b] - u[B-1-b], row j of the result is
+//   E + O and row J-1-j is sign*(E - O), where E and O are contractions of
+//   e and o with the halves of the rows of T, taking half the flops.
+//------------------------------------------------------------------------------
+static int CeedTensorContractApplyEvenOdd_Ref(CeedInt A, CeedInt B, CeedInt C,
+    CeedInt J, const CeedScalar *restrict t, CeedInt tstride0,
+    CeedInt tstride1, CeedScalar sign, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  const CeedInt hB = B/2, hJ = (J+1)/2, CH = CEED_REF_EVEN_ODD_CHUNK;
+  CeedScalar te[hJ*hB+1], to[hJ*hB+1], tm[hJ];
+  for (CeedInt j=0; j<hJ; j++) {
+    for (CeedInt b=0; b<hB; b++) {
+      const CeedScalar t0 = t[j*tstride0 + b*tstride1];
+      const CeedScalar t1 = t[j*tstride0 + (B-1-b)*tstride1];
+      te[j*hB+b] = (t0 + t1) / 2;
+      to[j*hB+b] = (t0 - t1) / 2;
+    }
+    tm[j] = B % 2 ? t[j*tstride0 + hB*tstride1] : 0.0;
+  }
+
+  CeedScalar ue[hB*CH+1], uo[hB*CH+1], E[CH], O[CH];
+  for (CeedInt a=0; a<A; a++)
+    for (CeedInt c0=0; c0<C; c0+=CH) {
+      const CeedInt nc = C-c0 < CH ? C-c0 : CH;
+      const CeedScalar *ua = &u[a*B*C + c0];
+      CeedScalar *va = &v[a*J*C + c0];
+      for (CeedInt b=0; b<hB; b++)
+        for (CeedInt c=0; c<nc; c++) {
+          ue[b*CH+c] = ua[b*C+c] + ua[(B-1-b)*C+c];
+          uo[b*CH+c] = ua[b*C+c] - ua[(B-1-b)*C+c];
+        }
+      for (CeedInt j=0; j<hJ; j++) {
+        for (CeedInt c=0; c<nc; c++) {
+          E[c] = B % 2 ? tm[j] * ua[hB*C+c] : 0.0;
+          O[c] = 0.0;
+        }
+        for (CeedInt b=0; b<hB; b++) {
+          const CeedScalar tej = te[j*hB+b], toj = to[j*hB+b];
+          for (CeedInt c=0; c<nc; c++) {
+            E[c] += tej * ue[b*CH+c];
+            O[c] += toj * uo[b*CH+c];
+          }
+        }
+        for (CeedInt c=0; c<nc; c++)
+          va[j*C+c] += E[c] + O[c];
+        if (J-1-j != j)
+          for (CeedInt c=0; c<nc; c++)
+            va[(J-1-j)*C+c] += sign*(E[c] - O[c]);
+      }
+    }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Apply
 //------------------------------------------------------------------------------
@@ -34,6 +93,30 @@ int CeedTensorContractApply_Ref(CeedTensorContract contract, CeedInt A,
     for (CeedInt q=0; q<A*J*C; q++)
       v[q] = (CeedScalar) 0.0;
 
+  // 1D matrices of symmetric bases
+  CeedTensorContract_Ref *impl;
+  int ierr = CeedTensorContractGetData(contract, &impl); CeedChk(ierr);
+  if (impl && (tmode == CEED_NOTRANSPOSE ?
+               J == impl->Q1d && B == impl->P1d :
+               J == impl->P1d && B == impl->Q1d))
+    for (CeedInt i=0; i<2; i++)
+      if (t == impl->t[i])
+        return CeedTensorContractApplyEvenOdd_Ref(A, B, C, J, t, tstride0,
+               tstride1, impl->sign[i], u, v);
+
+  // Single element, as for non-tensor bases on serial backends; rows of t are
+  //   contiguous, so take dot products instead of strided updates
+  if (C == 1 && tmode == CEED_NOTRANSPOSE) {
+    for (CeedInt a=0; a<A; a++)
+      for (CeedInt j=0; j<J; j++) {
+        CeedScalar vq = v[a*J+j];
+        for (CeedInt b=0; b<B; b++)
+          vq += t[j*B + b] * u[a*B+b];
+        v[a*J+j] = vq;
+      }
+    return 0;
+  }
+
   for (CeedInt a=0; a<A; a++)
     for (CeedInt b=0; b<B; b++)
       for (CeedInt j=0; j<J; j++) {
@@ -44,10 +127,41 @@ int CeedTensorContractApply_Ref(CeedTensorContract contract, CeedInt A,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Tensor Contract Apply Full
+//   All dimensions of one component at a time, so the intermediate values stay
+//   in cache, calling the contraction kernel directly
+//------------------------------------------------------------------------------
+static int CeedTensorContractApplyFull_Ref(CeedTensorContract contract,
+    CeedInt dim, CeedInt ncomp, CeedInt P, CeedInt Q, CeedInt nelem,
+    const CeedScalar *const *t, CeedTransposeMode tmode, const CeedInt Add,
+    const CeedScalar *restrict u, CeedScalar *restrict v) {
+  const CeedInt usize = CeedIntPow(P, dim)*nelem;
+  const CeedInt vsize = CeedIntPow(Q, dim)*nelem;
+  CeedScalar tmp[2][CeedPadLength(nelem*Q*CeedIntPow(P>Q?P:Q, dim-1))]
+  CEED_ALIGNED;
+
+  for (CeedInt c=0; c<ncomp; c++) {
+    CeedInt pre = CeedIntPow(P, dim-1), post = nelem;
+    for (CeedInt d=0; d<dim; d++) {
+      CeedTensorContractApply_Ref(contract, pre, P, post, Q, t[d], tmode, Add&&(d==dim-1),
+                                  d==0 ? &u[c*usize] : tmp[d%2],
+                                  d==dim-1 ? &v[c*vsize] : tmp[(d+1)%2]);
+      pre /= P;
+      post *= Q;
+    }
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Destroy
 //------------------------------------------------------------------------------
 static int CeedTensorContractDestroy_Ref(CeedTensorContract contract) {
+  int ierr;
+  CeedTensorContract_Ref *impl;
+  ierr = CeedTensorContractGetData(contract, &impl); CeedChk(ierr);
+  ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
 }
 
@@ -59,8 +173,26 @@ int CeedTensorContractCreate_Ref(CeedBasis basis, CeedTensorContract contract) {
   Ceed ceed;
   ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChk(ierr);
 
+  // Contractions with the 1D matrices of symmetric bases use even-odd parts
+  bool istensor, issymmetric;
+  ierr = CeedBasisIsTensor(basis, &istensor); CeedChk(ierr);
+  ierr = CeedBasisIsSymmetric(basis, &issymmetric); CeedChk(ierr);
+  if (istensor && issymmetric) {
+    CeedTensorContract_Ref *impl;
+    ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+    ierr = CeedBasisGetInterp1D(basis, &impl->t[0]); CeedChk(ierr);
+    ierr = CeedBasisGetGrad1D(basis, &impl->t[1]); CeedChk(ierr);
+    impl->sign[0] = 1.0;
+    impl->sign[1] = -1.0;
+    ierr = CeedBasisGetNumNodes1D(basis, &impl->P1d); CeedChk(ierr);
+    ierr = CeedBasisGetNumQuadraturePoints1D(basis, &impl->Q1d); CeedChk(ierr);
+    ierr = CeedTensorContractSetData(contract, impl); CeedChk(ierr);
+  }
+
   ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
                                 CeedTensorContractApply_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "ApplyFull",
+                                CeedTensorContractApplyFull_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Destroy",
                                 CeedTensorContractDestroy_Ref); CeedChk(ierr);
 
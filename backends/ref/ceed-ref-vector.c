@@ -33,16 +33,26 @@ static int CeedVectorSetArray_Ref(CeedVector vec, CeedMemType mtype,
     // LCOV_EXCL_START
     return CeedError(ceed, 1, "Only MemType = HOST supported");
   // LCOV_EXCL_STOP
-  ierr = CeedFree(&impl->array_allocated); CeedChk(ierr);
+  const ptrdiff_t bytes = length * sizeof(CeedScalar);
+  if (impl->array_allocated) {
+    ierr = CeedVectorTrackMemory(vec, CEED_MEMSPACE_HOST, -bytes);
+    CeedChk(ierr);
+  }
+  ierr = CeedFreeHost(ceed, &impl->array_allocated); CeedChk(ierr);
   switch (cmode) {
   case CEED_COPY_VALUES:
-    ierr = CeedMalloc(length, &impl->array_allocated); CeedChk(ierr);
+    ierr = CeedMallocHost(ceed, length, &impl->array_allocated); CeedChk(ierr);
     impl->array = impl->array_allocated;
     if (array) memcpy(impl->array, array, length * sizeof(array[0]));
+    ierr = CeedVectorTrackMemory(vec, CEED_MEMSPACE_HOST, bytes); CeedChk(ierr);
     break;
   case CEED_OWN_POINTER:
     impl->array_allocated = array;
     impl->array = array;
+    if (array) {
+      ierr = CeedVectorTrackMemory(vec, CEED_MEMSPACE_HOST, bytes);
+      CeedChk(ierr);
+    }
     break;
   case CEED_USE_POINTER:
     impl->array = array;
@@ -66,6 +76,13 @@ static int CeedVectorTakeArray_Ref(CeedVector vec, CeedMemType mtype,
     return CeedError(ceed, 1, "Only MemType = HOST supported");
   // LCOV_EXCL_STOP
 
+  if (impl->array_allocated) {
+    CeedInt length;
+    ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+    ierr = CeedVectorTrackMemory(vec, CEED_MEMSPACE_HOST,
+                                 -(ptrdiff_t)(length * sizeof(CeedScalar)));
+    CeedChk(ierr);
+  }
   (*array) = impl->array;
   impl->array = NULL;
   impl->array_allocated = NULL;
@@ -137,8 +154,10 @@ static int CeedVectorDestroy_Ref(CeedVector vec) {
   int ierr;
   CeedVector_Ref *impl;
   ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
 
-  ierr = CeedFree(&impl->array_allocated); CeedChk(ierr);
+  ierr = CeedFreeHost(ceed, &impl->array_allocated); CeedChk(ierr);
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
 }
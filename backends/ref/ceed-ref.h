@@ -18,11 +18,23 @@
 #include <string.h>
 #include <math.h>
 
+// Bytes of QFunction data for all fields above which a tile of elements
+//   passed to the QFunction in one call is not grown further
+#define CEED_REF_TILE_SIZE (1 << 15)
+
 typedef struct {
   CeedScalar *collograd1d;
   bool collointerp;
 } CeedBasis_Ref;
 
+// 1D matrices of a symmetric basis, whose contractions are split into even
+//   and odd parts; sign is 1 for interp1d and -1 for grad1d
+typedef struct {
+  const CeedScalar *t[2];
+  CeedScalar sign[2];
+  CeedInt P1d, Q1d;
+} CeedTensorContract_Ref;
+
 typedef struct {
   CeedScalar *array;
   CeedScalar *array_allocated;
@@ -31,6 +43,15 @@ typedef struct {
 typedef struct {
   const CeedInt *offsets;
   CeedInt *offsets_allocated;
+  CeedInt *blkeoffsets;     // base offsets of compressed restrictions, padded
+  //   to full blocks
+  const CeedInt *stencil;   // node offsets of compressed restrictions
+  uint16_t *offsets16;      // offsets relative to the base of their block,
+  //   for CEED_INDEX_INT16
+  CeedInt *blkbase;         // smallest offset of each block
+  bool *tfirst;             // first contribution to each L-vector entry in
+  //   the overwriting transpose
+  bool tcovers;             // every L-vector entry has a contribution
   int (*Apply)(CeedElemRestriction, const CeedInt, const CeedInt,
                const CeedInt, CeedInt, CeedInt, CeedTransposeMode, CeedVector,
                CeedVector, CeedRequest *);
@@ -47,18 +68,44 @@ typedef struct {
   void *data_allocated;
 } CeedQFunctionContext_Ref;
 
+// Operator field data gathered at setup, so that applying the operator does
+//   not query the operator and QFunction fields again
+typedef struct {
+  CeedEvalMode emode;            /// CEED_EVAL_NONE for collocated interpolation
+  CeedInt size;                  /// QFunction field size
+  CeedInt elemstride;            /// E-vector entries per element
+  CeedBasis basis;
+  CeedElemRestriction Erestrict;
+  CeedVector vec;                /// Field vector, or CEED_VECTOR_ACTIVE
+  CeedStorageType storage;
+  bool cached;                   /// E-vector cached by the restriction
+  CeedInt shared;                /// Active input sharing its E-vector, or -1
+  CeedInt numbc;                 /// Number of Dirichlet constrained entries
+  CeedInt *bcpos;                /// E-vector entries constrained, ascending
+  CeedInt *bck;                  /// Index of each entry in the constraint
+} CeedOperatorField_Ref;
+
 typedef struct {
   bool identityqf;
+  CeedOperatorField_Ref *fields; /// Field data (inputs followed by outputs)
   CeedVector
   *evecs;   /// E-vectors needed to apply operator (input followed by outputs)
   CeedScalar **edata;
   uint64_t *inputstate;  /// State counter of inputs
+  CeedVector *cachedevecs; /// Restriction cached E-vectors read by an apply
   CeedVector *evecsin;   /// Input E-vectors needed to apply operator
   CeedVector *evecsout;  /// Output E-vectors needed to apply operator
   CeedVector *qvecsin;   /// Input Q-vectors needed to apply operator
   CeedVector *qvecsout;  /// Output Q-vectors needed to apply operator
+  CeedScalar *qstorage;  /// Q-vector storage of basis evaluated fields
+  const CeedScalar **qdatain; /// Q-point data of inputs for current element
+  CeedScalar **qdataout; /// Q-point data of outputs for current element
+  CeedInt    tileelems; /// Elements per QFunction call
+  CeedScalar *tilestorage; /// Storage of gathered fields for a tile
+  CeedScalar **tiledata; /// Tile storage of each field, if gathered
   CeedInt    numein;
   CeedInt    numeout;
+  bool       bcready;   /// Constrained entries of the fields are current
 } CeedOperator_Ref;
 
 CEED_INTERN int CeedVectorCreate_Ref(CeedInt n, CeedVector vec);
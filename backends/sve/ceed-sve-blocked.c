@@ -1,6 +1,6 @@
-// Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
-// the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
-// reserved. See files LICENSE and NOTICE for details.
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
 //
 // This file is part of CEED, a collection of benchmarks, miniapps, software
 // libraries and APIs for efficient high-order finite element and spectral
@@ -14,36 +14,36 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
-#include <ceed.h>
-#include <cuda.h>
-
-const int sizeMax = 16;
-__constant__ double c_B[sizeMax*sizeMax];
-__constant__ double c_G[sizeMax*sizeMax];
+#include "ceed-sve.h"
 
 //------------------------------------------------------------------------------
-// Interp device initalization
+// Backend Init
 //------------------------------------------------------------------------------
-extern "C" int CeedCudaInitInterp(CeedScalar *d_B, CeedInt P1d, CeedInt Q1d,
-                                  CeedScalar **c_B_ptr) {
-  const int Bsize = P1d*Q1d*sizeof(CeedScalar);
-  cudaMemcpyToSymbol(c_B, d_B, Bsize, 0, cudaMemcpyDeviceToDevice);
-  cudaGetSymbolAddress((void **)c_B_ptr, c_B);
+static int CeedInit_Sve(const char *resource, Ceed ceed) {
+  int ierr;
+  if (strcmp(resource, "/cpu/self") && strcmp(resource, "/cpu/self/sve")
+      && strcmp(resource, "/cpu/self/sve/blocked"))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "SVE backend cannot use resource: %s", resource);
+  // LCOV_EXCL_STOP
+  ierr = CeedSetDeterministic(ceed, true); CeedChk(ierr);
+
+  // Create reference CEED that implementation will be dispatched
+  //   through unless overridden
+  Ceed ceedref;
+  CeedInit("/cpu/self/opt/blocked", &ceedref);
+  ierr = CeedSetDelegate(ceed, ceedref); CeedChk(ierr);
 
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate",
+                                CeedTensorContractCreate_Sve); CeedChk(ierr);
   return 0;
 }
 
 //------------------------------------------------------------------------------
-// Grad device initalization
+// Backend Register
 //------------------------------------------------------------------------------
-extern "C" int CeedCudaInitInterpGrad(CeedScalar *d_B, CeedScalar *d_G,
-    CeedInt P1d, CeedInt Q1d, CeedScalar **c_B_ptr, CeedScalar **c_G_ptr) {
-  const int Bsize = P1d*Q1d*sizeof(CeedScalar);
-  cudaMemcpyToSymbol(c_B, d_B, Bsize, 0, cudaMemcpyDeviceToDevice);
-  cudaGetSymbolAddress((void **)c_B_ptr, c_B);
-  cudaMemcpyToSymbol(c_G, d_G, Bsize, 0, cudaMemcpyDeviceToDevice);
-  cudaGetSymbolAddress((void **)c_G_ptr, c_G);
-
-  return 0;
+__attribute__((constructor))
+static void Register(void) {
+  CeedRegister("/cpu/self/sve/blocked", CeedInit_Sve, 30);
 }
 //------------------------------------------------------------------------------
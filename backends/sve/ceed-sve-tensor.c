@@ -0,0 +1,327 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include "ceed-sve.h"
+
+#ifdef __ARM_FEATURE_SVE
+//------------------------------------------------------------------------------
+// SVE
+//------------------------------------------------------------------------------
+// Scalable vector type and operations for CeedScalar; the vector length is
+//   only known at runtime, and predicates handle partial vectors
+#  ifdef CEED_SINGLE_PRECISION
+#    define rtype svfloat32_t
+#    define itype svint32_t
+#    define vlen() ((CeedInt)svcntw())
+#    define whilelt(i,n) svwhilelt_b32((int32_t)(i), (int32_t)(n))
+#    define zero() svdup_n_f32(0.0f)
+#    define vindex(s) svindex_s32(0, (int32_t)(s))
+#  else
+#    define rtype svfloat64_t
+#    define itype svint64_t
+#    define vlen() ((CeedInt)svcntd())
+#    define whilelt(i,n) svwhilelt_b64((int64_t)(i), (int64_t)(n))
+#    define zero() svdup_n_f64(0.0)
+#    define vindex(s) svindex_s64(0, (int64_t)(s))
+#  endif
+// Accumulator start, loaded from v or zero for overwrite
+#  define start(p,x) (Add ? svld1((p), (x)) : zero())
+// c += a * s, s scalar
+#  define fmadd(p,c,a,s) (c) = svmla_x((p), (c), (a), (s))
+
+//------------------------------------------------------------------------------
+// Blocked Tensor Contract
+//   Tiles of 4 rows by 2 vectors of columns; the vector length agnostic
+//   predicates cover the column remainder, so there is no scalar remainder
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Sve_Blocked(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  CeedInt tstride0 = B, tstride1 = 1;
+  if (tmode == CEED_TRANSPOSE) {
+    tstride0 = 1; tstride1 = J;
+  }
+  const CeedInt VL = vlen();
+
+  for (CeedInt a=0; a<A; a++) {
+    const CeedScalar *ua = &u[a*B*C];
+    CeedScalar *va = &v[a*J*C];
+    for (CeedInt c=0; c<C; c+=2*VL) {
+      const svbool_t p0 = whilelt(c, C), p1 = whilelt(c+VL, C);
+      CeedInt j = 0;
+      // Blocks of 4 rows
+      for (; j+4<=J; j+=4) {
+        CeedScalar *vj = &va[j*C+c];
+        rtype v00 = start(p0, &vj[0*C]), v01 = start(p1, &vj[0*C+VL]);
+        rtype v10 = start(p0, &vj[1*C]), v11 = start(p1, &vj[1*C+VL]);
+        rtype v20 = start(p0, &vj[2*C]), v21 = start(p1, &vj[2*C+VL]);
+        rtype v30 = start(p0, &vj[3*C]), v31 = start(p1, &vj[3*C+VL]);
+        for (CeedInt b=0; b<B; b++) {
+          const rtype u0 = svld1(p0, &ua[b*C+c]), u1 = svld1(p1, &ua[b*C+c+VL]);
+          const CeedScalar *tb = &t[j*tstride0 + b*tstride1];
+          const CeedScalar t0 = tb[0], t1 = tb[tstride0], t2 = tb[2*tstride0],
+                           t3 = tb[3*tstride0];
+          fmadd(p0, v00, u0, t0); fmadd(p1, v01, u1, t0);
+          fmadd(p0, v10, u0, t1); fmadd(p1, v11, u1, t1);
+          fmadd(p0, v20, u0, t2); fmadd(p1, v21, u1, t2);
+          fmadd(p0, v30, u0, t3); fmadd(p1, v31, u1, t3);
+        }
+        svst1(p0, &vj[0*C], v00); svst1(p1, &vj[0*C+VL], v01);
+        svst1(p0, &vj[1*C], v10); svst1(p1, &vj[1*C+VL], v11);
+        svst1(p0, &vj[2*C], v20); svst1(p1, &vj[2*C+VL], v21);
+        svst1(p0, &vj[3*C], v30); svst1(p1, &vj[3*C+VL], v31);
+      }
+      // Remainder of rows
+      for (; j<J; j++) {
+        CeedScalar *vj = &va[j*C+c];
+        rtype v00 = start(p0, &vj[0]), v01 = start(p1, &vj[VL]);
+        for (CeedInt b=0; b<B; b++) {
+          const CeedScalar t0 = t[j*tstride0 + b*tstride1];
+          fmadd(p0, v00, svld1(p0, &ua[b*C+c]), t0);
+          fmadd(p1, v01, svld1(p1, &ua[b*C+c+VL]), t0);
+        }
+        svst1(p0, &vj[0], v00); svst1(p1, &vj[VL], v01);
+      }
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Serial Tensor Contract C=1
+//   Vectorized over rows of t, gathered when they are strided in memory
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Sve_Single(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  CeedInt tstride0 = B, tstride1 = 1;
+  if (tmode == CEED_TRANSPOSE) {
+    tstride0 = 1; tstride1 = J;
+  }
+  const CeedInt VL = vlen();
+  const itype tidx = vindex(tstride0);
+
+  for (CeedInt j=0; j<J; j+=VL) {
+    const svbool_t pj = whilelt(j, J);
+    CeedInt a = 0;
+    // Blocks of 4 rows
+    for (; a+4<=A; a+=4) {
+      rtype v0 = start(pj, &v[(a+0)*J+j]), v1 = start(pj, &v[(a+1)*J+j]);
+      rtype v2 = start(pj, &v[(a+2)*J+j]), v3 = start(pj, &v[(a+3)*J+j]);
+      for (CeedInt b=0; b<B; b++) {
+        const CeedScalar *tb = &t[j*tstride0 + b*tstride1];
+        const rtype tq = tstride0 == 1 ? svld1(pj, tb) :
+                         svld1_gather_index(pj, tb, tidx);
+        fmadd(pj, v0, tq, u[(a+0)*B+b]); fmadd(pj, v1, tq, u[(a+1)*B+b]);
+        fmadd(pj, v2, tq, u[(a+2)*B+b]); fmadd(pj, v3, tq, u[(a+3)*B+b]);
+      }
+      svst1(pj, &v[(a+0)*J+j], v0); svst1(pj, &v[(a+1)*J+j], v1);
+      svst1(pj, &v[(a+2)*J+j], v2); svst1(pj, &v[(a+3)*J+j], v3);
+    }
+    // Remainder of rows
+    for (; a<A; a++) {
+      rtype v0 = start(pj, &v[a*J+j]);
+      for (CeedInt b=0; b<B; b++) {
+        const CeedScalar *tb = &t[j*tstride0 + b*tstride1];
+        const rtype tq = tstride0 == 1 ? svld1(pj, tb) :
+                         svld1_gather_index(pj, tb, tidx);
+        fmadd(pj, v0, tq, u[a*B+b]);
+      }
+      svst1(pj, &v[a*J+j], v0);
+    }
+  }
+  return 0;
+}
+
+#else
+//------------------------------------------------------------------------------
+// NEON
+//------------------------------------------------------------------------------
+// Two-lane (four-lane for single precision) vector type and operations for
+//   CeedScalar
+#  ifdef CEED_SINGLE_PRECISION
+#    define rtype float32x4_t
+#    define VLEN 4
+#    define loadu vld1q_f32
+#    define storeu vst1q_f32
+#    define zero() vdupq_n_f32(0.0f)
+// c += a * s, s scalar
+#    define fmadd(c,a,s) (c) = vfmaq_n_f32((c), (a), (s))
+#  else
+#    define rtype float64x2_t
+#    define VLEN 2
+#    define loadu vld1q_f64
+#    define storeu vst1q_f64
+#    define zero() vdupq_n_f64(0.0)
+// c += a * s, s scalar
+#    define fmadd(c,a,s) (c) = vfmaq_n_f64((c), (a), (s))
+#  endif
+
+//------------------------------------------------------------------------------
+// Tensor Contract Tile
+//   Accumulates a JJ row by CC vector tile of v in registers; when Add is false
+//   the tile starts from zero, so v is never cleared separately
+//------------------------------------------------------------------------------
+static inline void CeedTensorContract_Neon_Tile(const CeedInt B,
+    const CeedInt C, const CeedScalar *restrict t, const CeedInt tstride0,
+    const CeedInt tstride1, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v, const CeedInt JJ, const CeedInt CC) {
+  rtype vv[JJ][CC]; // Output tile to be held in registers
+  for (CeedInt jj=0; jj<JJ; jj++)
+    for (CeedInt cc=0; cc<CC; cc++)
+      vv[jj][cc] = Add ? loadu(&v[jj*C+cc*VLEN]) : zero();
+
+  for (CeedInt b=0; b<B; b++) {
+    rtype uu[CC];
+    for (CeedInt cc=0; cc<CC; cc++) // unroll
+      uu[cc] = loadu(&u[b*C+cc*VLEN]);
+    for (CeedInt jj=0; jj<JJ; jj++) { // unroll
+      const CeedScalar tq = t[jj*tstride0 + b*tstride1];
+      for (CeedInt cc=0; cc<CC; cc++) // unroll
+        fmadd(vv[jj][cc], uu[cc], tq);
+    }
+  }
+  for (CeedInt jj=0; jj<JJ; jj++)
+    for (CeedInt cc=0; cc<CC; cc++)
+      storeu(&v[jj*C+cc*VLEN], vv[jj][cc]);
+}
+
+//------------------------------------------------------------------------------
+// Blocked Tensor Contract
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Neon_Blocked(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v, const CeedInt JJ, const CeedInt CC) {
+  CeedInt tstride0 = B, tstride1 = 1;
+  if (tmode == CEED_TRANSPOSE) {
+    tstride0 = 1; tstride1 = J;
+  }
+
+  for (CeedInt a=0; a<A; a++) {
+    const CeedScalar *ua = &u[a*B*C];
+    CeedScalar *va = &v[a*J*C];
+    for (CeedInt j=0; j<J; j+=JJ) {
+      const CeedInt JJJ = J-j < JJ ? J-j : JJ;
+      const CeedScalar *tj = &t[j*tstride0];
+      CeedInt c = 0;
+      // Blocks of CC vectors
+      if (JJJ == JJ)
+        for (; c+CC*VLEN<=C; c+=CC*VLEN)
+          CeedTensorContract_Neon_Tile(B, C, tj, tstride0, tstride1, Add,
+                                       &ua[c], &va[j*C+c], JJ, CC);
+      // Remainder of vectors
+      for (; c+VLEN<=C; c+=VLEN)
+        CeedTensorContract_Neon_Tile(B, C, tj, tstride0, tstride1, Add,
+                                     &ua[c], &va[j*C+c], JJJ, 1);
+      // Remainder of columns
+      for (; c<C; c++)
+        for (CeedInt jj=0; jj<JJJ; jj++) {
+          CeedScalar vq = Add ? va[(j+jj)*C+c] : 0.0;
+          for (CeedInt b=0; b<B; b++)
+            vq += tj[jj*tstride0 + b*tstride1] * ua[b*C+c];
+          va[(j+jj)*C+c] = vq;
+        }
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Serial Tensor Contract C=1
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Neon_Single(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  CeedInt tstride0 = B, tstride1 = 1;
+  if (tmode == CEED_TRANSPOSE) {
+    tstride0 = 1; tstride1 = J;
+  }
+
+  for (CeedInt a=0; a<A; a++)
+    for (CeedInt j=0; j<J; j++) {
+      CeedScalar vq = Add ? v[a*J+j] : 0.0;
+      for (CeedInt b=0; b<B; b++)
+        vq += t[j*tstride0 + b*tstride1] * u[a*B+b];
+      v[a*J+j] = vq;
+    }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract - Common Sizes
+//   4 rows by 4 vectors uses 16 of the 32 NEON registers for accumulators
+//------------------------------------------------------------------------------
+static int CeedTensorContract_Neon_Blocked_4_4(CeedTensorContract contract,
+    CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+    CeedTransposeMode tmode, const CeedInt Add, const CeedScalar *restrict u,
+    CeedScalar *restrict v) {
+  return CeedTensorContract_Neon_Blocked(contract, A, B, C, J, t, tmode, Add,
+                                         u, v, 4, 4);
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply
+//------------------------------------------------------------------------------
+static int CeedTensorContractApply_Sve(CeedTensorContract contract, CeedInt A,
+                                       CeedInt B, CeedInt C, CeedInt J,
+                                       const CeedScalar *restrict t,
+                                       CeedTransposeMode tmode,
+                                       const CeedInt Add,
+                                       const CeedScalar *restrict u,
+                                       CeedScalar *restrict v) {
+#ifdef __ARM_FEATURE_SVE
+  if (C == 1)
+    return CeedTensorContract_Sve_Single(contract, A, B, C, J, t, tmode, Add,
+                                         u, v);
+  return CeedTensorContract_Sve_Blocked(contract, A, B, C, J, t, tmode, Add, u,
+                                        v);
+#else
+  if (C == 1)
+    return CeedTensorContract_Neon_Single(contract, A, B, C, J, t, tmode, Add,
+                                          u, v);
+  return CeedTensorContract_Neon_Blocked_4_4(contract, A, B, C, J, t, tmode,
+         Add, u, v);
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Destroy
+//------------------------------------------------------------------------------
+static int CeedTensorContractDestroy_Sve(CeedTensorContract contract) {
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Create
+//------------------------------------------------------------------------------
+int CeedTensorContractCreate_Sve(CeedBasis basis, CeedTensorContract contract) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
+                                CeedTensorContractApply_Sve); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Destroy",
+                                CeedTensorContractDestroy_Sve); CeedChk(ierr);
+
+  return 0;
+}
+//------------------------------------------------------------------------------
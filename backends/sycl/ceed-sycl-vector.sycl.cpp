@@ -0,0 +1,553 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+// the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+// reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <math.h>
+#include <string.h>
+#include "ceed-sycl.h"
+
+//------------------------------------------------------------------------------
+// Queue of the Ceed of a vector
+//------------------------------------------------------------------------------
+static int CeedVectorGetQueue_Sycl(CeedVector vec, Ceed_Sycl **data) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  ierr = CeedGetData(ceed, data); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Allocate the USM shared array of a vector, if not yet allocated
+//------------------------------------------------------------------------------
+static int CeedVectorAllocate_Sycl(CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Sycl *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  Ceed_Sycl *data;
+  ierr = CeedVectorGetQueue_Sycl(vec, &data); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  if (impl->array_allocated)
+    return 0;
+  CeedCallSycl(ceed, impl->array_allocated =
+                 sycl::malloc_shared<CeedScalar>(length, *data->queue));
+  ierr = CeedVectorTrackMemory(vec, CEED_MEMSPACE_DEVICE,
+                               length * sizeof(CeedScalar)); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Free the USM shared array of a vector
+//------------------------------------------------------------------------------
+static int CeedVectorFree_Sycl(CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Sycl *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  Ceed_Sycl *data;
+  ierr = CeedVectorGetQueue_Sycl(vec, &data); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  if (!impl->array_allocated)
+    return 0;
+  if (impl->array == impl->array_allocated)
+    impl->array = NULL;
+  CeedCallSycl(ceed, data->queue->wait_and_throw();
+               sycl::free(impl->array_allocated, *data->queue));
+  impl->array_allocated = NULL;
+  ierr = CeedVectorTrackMemory(vec, CEED_MEMSPACE_DEVICE,
+                               -(ptrdiff_t)(length * sizeof(CeedScalar)));
+  CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Move the values into USM before kernels or device access
+//------------------------------------------------------------------------------
+static int CeedVectorSyncDevice_Sycl(CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Sycl *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  Ceed_Sycl *data;
+  ierr = CeedVectorGetQueue_Sycl(vec, &data); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  if (impl->array && impl->array != impl->array_borrowed)
+    return 0;
+  ierr = CeedVectorAllocate_Sycl(vec); CeedChk(ierr);
+  if (impl->array)
+    CeedCallSycl(ceed, data->queue->memcpy(impl->array_allocated, impl->array,
+                                           length * sizeof(CeedScalar)));
+  impl->array = impl->array_allocated;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Finish pending kernels and return the values to the borrowed host array
+//------------------------------------------------------------------------------
+static int CeedVectorSyncHost_Sycl(CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Sycl *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  Ceed_Sycl *data;
+  ierr = CeedVectorGetQueue_Sycl(vec, &data); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  if (impl->array_borrowed && impl->array != impl->array_borrowed) {
+    if (impl->array)
+      CeedCallSycl(ceed, data->queue->memcpy(impl->array_borrowed,
+                                             impl->array,
+                                             length * sizeof(CeedScalar)));
+    impl->array = impl->array_borrowed;
+  }
+  CeedCallSycl(ceed, data->queue->wait_and_throw());
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Set array from host or USM
+//------------------------------------------------------------------------------
+static int CeedVectorSetArray_Sycl(const CeedVector vec,
+                                   const CeedMemType mtype,
+                                   const CeedCopyMode cmode,
+                                   CeedScalar *array) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Sycl *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  Ceed_Sycl *data;
+  ierr = CeedVectorGetQueue_Sycl(vec, &data); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  impl->array_borrowed = NULL;
+  switch (cmode) {
+  case CEED_COPY_VALUES:
+    ierr = CeedVectorAllocate_Sycl(vec); CeedChk(ierr);
+    impl->array = impl->array_allocated;
+    if (array)
+      CeedCallSycl(ceed, data->queue->memcpy(impl->array, array,
+                                             length * sizeof(CeedScalar))
+                   .wait_and_throw());
+    break;
+  case CEED_OWN_POINTER:
+    if (mtype == CEED_MEM_HOST) {
+      // Host arrays are freed with CeedFree, so their values are copied
+      ierr = CeedVectorAllocate_Sycl(vec); CeedChk(ierr);
+      impl->array = impl->array_allocated;
+      CeedCallSycl(ceed, data->queue->memcpy(impl->array, array,
+                                             length * sizeof(CeedScalar))
+                   .wait_and_throw());
+      ierr = CeedFree(&array); CeedChk(ierr);
+    } else {
+      // USM arrays from the queue of the Ceed are freed with sycl::free
+      ierr = CeedVectorFree_Sycl(vec); CeedChk(ierr);
+      impl->array = impl->array_allocated = array;
+      ierr = CeedVectorTrackMemory(vec, CEED_MEMSPACE_DEVICE,
+                                   length * sizeof(CeedScalar)); CeedChk(ierr);
+    }
+    break;
+  case CEED_USE_POINTER:
+    if (mtype == CEED_MEM_HOST)
+      impl->array_borrowed = array;
+    impl->array = array;
+    break;
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Take array
+//------------------------------------------------------------------------------
+static int CeedVectorTakeArray_Sycl(CeedVector vec, CeedMemType mtype,
+                                    CeedScalar **array) {
+  int ierr;
+  CeedVector_Sycl *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  if (mtype == CEED_MEM_HOST) {
+    ierr = CeedVectorSyncHost_Sycl(vec); CeedChk(ierr);
+    if (impl->array && impl->array == impl->array_borrowed) {
+      *array = impl->array;
+    } else {
+      // The caller frees the array with CeedFree, so return a copy
+      ierr = CeedMalloc(length, array); CeedChk(ierr);
+      if (impl->array)
+        memcpy(*array, impl->array, length * sizeof(CeedScalar));
+    }
+  } else {
+    ierr = CeedVectorSyncDevice_Sycl(vec); CeedChk(ierr);
+    *array = impl->array;
+    if (impl->array == impl->array_allocated) {
+      // The caller now owns the allocation and frees it with sycl::free
+      impl->array_allocated = NULL;
+      ierr = CeedVectorTrackMemory(vec, CEED_MEMSPACE_DEVICE,
+                                   -(ptrdiff_t)(length * sizeof(CeedScalar)));
+      CeedChk(ierr);
+    }
+  }
+  impl->array = NULL;
+  impl->array_borrowed = NULL;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Sync array to requested memtype
+//------------------------------------------------------------------------------
+static int CeedVectorSyncArray_Sycl(const CeedVector vec,
+                                    const CeedMemType mtype) {
+  int ierr;
+  if (mtype == CEED_MEM_HOST) {
+    ierr = CeedVectorSyncHost_Sycl(vec); CeedChk(ierr);
+  } else {
+    ierr = CeedVectorSyncDevice_Sycl(vec); CeedChk(ierr);
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Get array
+//------------------------------------------------------------------------------
+static int CeedVectorGetArray_Sycl(const CeedVector vec,
+                                   const CeedMemType mtype,
+                                   CeedScalar **array) {
+  int ierr;
+  CeedVector_Sycl *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+
+  if (!impl->array) {
+    ierr = CeedVectorAllocate_Sycl(vec); CeedChk(ierr);
+    impl->array = impl->array_allocated;
+  }
+  ierr = CeedVectorSyncArray_Sycl(vec, mtype); CeedChk(ierr);
+  *array = impl->array;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Get read-only access to a vector via the specified mtype
+//------------------------------------------------------------------------------
+static int CeedVectorGetArrayRead_Sycl(const CeedVector vec,
+                                       const CeedMemType mtype,
+                                       const CeedScalar **array) {
+  return CeedVectorGetArray_Sycl(vec, mtype, (CeedScalar **)array);
+}
+
+//------------------------------------------------------------------------------
+// Restore an array obtained using CeedVectorGetArray()
+//------------------------------------------------------------------------------
+static int CeedVectorRestoreArray_Sycl(const CeedVector vec) {
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Restore an array obtained using CeedVectorGetArrayRead()
+//------------------------------------------------------------------------------
+static int CeedVectorRestoreArrayRead_Sycl(const CeedVector vec) {
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Set a vector to a value
+//------------------------------------------------------------------------------
+static int CeedVectorSetValue_Sycl(CeedVector vec, CeedScalar val) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Sycl *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  Ceed_Sycl *data;
+  ierr = CeedVectorGetQueue_Sycl(vec, &data); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  // The old values are overwritten, so a borrowed array is not copied
+  if (!impl->array || impl->array == impl->array_borrowed) {
+    ierr = CeedVectorAllocate_Sycl(vec); CeedChk(ierr);
+    impl->array = impl->array_allocated;
+  }
+  CeedCallSycl(ceed, data->queue->fill(impl->array, val, length));
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Get the reduction result of a vector, allocated on first use; each vector
+//   owns its own so reductions on distinct vectors may run from several
+//   threads at once
+//------------------------------------------------------------------------------
+static int CeedVectorGetReduce_Sycl(CeedVector vec, CeedScalar **result) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Sycl *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  Ceed_Sycl *data;
+  ierr = CeedVectorGetQueue_Sycl(vec, &data); CeedChk(ierr);
+
+  if (!impl->d_reduce)
+    CeedCallSycl(ceed, impl->d_reduce =
+                   sycl::malloc_shared<CeedScalar>(1, *data->queue));
+  *result = impl->d_reduce;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute the norm of a vector
+//------------------------------------------------------------------------------
+static int CeedVectorNorm_Sycl(CeedVector vec, CeedNormType type,
+                               CeedScalar *norm) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Sycl *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  Ceed_Sycl *data;
+  ierr = CeedVectorGetQueue_Sycl(vec, &data); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  ierr = CeedVectorSyncDevice_Sycl(vec); CeedChk(ierr);
+  const CeedScalar *x = impl->array;
+  CeedScalar *result;
+  ierr = CeedVectorGetReduce_Sycl(vec, &result); CeedChk(ierr);
+  const sycl::range<1> range(length);
+  sycl::event event;
+  const sycl::property_list init{
+    sycl::property::reduction::initialize_to_identity()};
+  switch (type) {
+  case CEED_NORM_1:
+    CeedCallSycl(ceed, event = data->queue->parallel_for(range,
+                 sycl::reduction(result, sycl::plus<CeedScalar>(), init),
+    [=](sycl::id<1> i, auto &sum) { sum += sycl::fabs(x[i]); }));
+    break;
+  case CEED_NORM_2:
+    CeedCallSycl(ceed, event = data->queue->parallel_for(range,
+                 sycl::reduction(result, sycl::plus<CeedScalar>(), init),
+    [=](sycl::id<1> i, auto &sum) { sum += x[i]*x[i]; }));
+    break;
+  case CEED_NORM_MAX:
+    CeedCallSycl(ceed, event = data->queue->parallel_for(range,
+                 sycl::reduction(result, sycl::maximum<CeedScalar>(), init),
+    [=](sycl::id<1> i, auto &max) { max.combine(sycl::fabs(x[i])); }));
+    break;
+  }
+  CeedCallSycl(ceed, event.wait_and_throw());
+  *norm = type == CEED_NORM_2 ? sqrt(*result) : *result;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Take reciprocal of a vector
+//------------------------------------------------------------------------------
+static int CeedVectorReciprocal_Sycl(CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Sycl *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  Ceed_Sycl *data;
+  ierr = CeedVectorGetQueue_Sycl(vec, &data); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  ierr = CeedVectorSyncDevice_Sycl(vec); CeedChk(ierr);
+  CeedScalar *x = impl->array;
+  CeedCallSycl(ceed, data->queue->parallel_for(sycl::range<1>(length),
+  [=](sycl::id<1> i) {
+    if (sycl::fabs(x[i]) > 1E-16) x[i] = 1./x[i];
+  }));
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute y = alpha x + y
+//------------------------------------------------------------------------------
+static int CeedVectorAXPY_Sycl(CeedVector y, CeedScalar alpha, CeedVector x) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(y, &ceed); CeedChk(ierr);
+  CeedVector_Sycl *y_impl, *x_impl;
+  ierr = CeedVectorGetData(y, &y_impl); CeedChk(ierr);
+  ierr = CeedVectorGetData(x, &x_impl); CeedChk(ierr);
+  Ceed_Sycl *data;
+  ierr = CeedVectorGetQueue_Sycl(y, &data); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(y, &length); CeedChk(ierr);
+
+  ierr = CeedVectorSyncDevice_Sycl(y); CeedChk(ierr);
+  ierr = CeedVectorSyncDevice_Sycl(x); CeedChk(ierr);
+  CeedScalar *y_array = y_impl->array;
+  const CeedScalar *x_array = x_impl->array;
+  CeedCallSycl(ceed, data->queue->parallel_for(sycl::range<1>(length),
+  [=](sycl::id<1> i) {
+    y_array[i] += alpha * x_array[i];
+  }));
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute the pointwise multiplication w = x .* y
+//------------------------------------------------------------------------------
+static int CeedVectorPointwiseMult_Sycl(CeedVector w, CeedVector x,
+                                        CeedVector y) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(w, &ceed); CeedChk(ierr);
+  CeedVector_Sycl *w_impl, *x_impl, *y_impl;
+  ierr = CeedVectorGetData(w, &w_impl); CeedChk(ierr);
+  ierr = CeedVectorGetData(x, &x_impl); CeedChk(ierr);
+  ierr = CeedVectorGetData(y, &y_impl); CeedChk(ierr);
+  Ceed_Sycl *data;
+  ierr = CeedVectorGetQueue_Sycl(w, &data); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(w, &length); CeedChk(ierr);
+
+  if (!w_impl->array) {
+    ierr = CeedVectorSetValue_Sycl(w, 0.0); CeedChk(ierr);
+  }
+  ierr = CeedVectorSyncDevice_Sycl(w); CeedChk(ierr);
+  ierr = CeedVectorSyncDevice_Sycl(x); CeedChk(ierr);
+  ierr = CeedVectorSyncDevice_Sycl(y); CeedChk(ierr);
+  CeedScalar *w_array = w_impl->array;
+  const CeedScalar *x_array = x_impl->array, *y_array = y_impl->array;
+  CeedCallSycl(ceed, data->queue->parallel_for(sycl::range<1>(length),
+  [=](sycl::id<1> i) {
+    w_array[i] = x_array[i] * y_array[i];
+  }));
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Compute the dot product of two vectors
+//------------------------------------------------------------------------------
+static int CeedVectorDot_Sycl(CeedVector x, CeedVector y, CeedScalar *result) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(x, &ceed); CeedChk(ierr);
+  CeedVector_Sycl *x_impl, *y_impl;
+  ierr = CeedVectorGetData(x, &x_impl); CeedChk(ierr);
+  ierr = CeedVectorGetData(y, &y_impl); CeedChk(ierr);
+  Ceed_Sycl *data;
+  ierr = CeedVectorGetQueue_Sycl(x, &data); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(x, &length); CeedChk(ierr);
+
+  ierr = CeedVectorSyncDevice_Sycl(x); CeedChk(ierr);
+  ierr = CeedVectorSyncDevice_Sycl(y); CeedChk(ierr);
+  const CeedScalar *x_array = x_impl->array, *y_array = y_impl->array;
+  CeedScalar *d_result;
+  ierr = CeedVectorGetReduce_Sycl(x, &d_result); CeedChk(ierr);
+  const sycl::property_list init{
+    sycl::property::reduction::initialize_to_identity()};
+  CeedCallSycl(ceed, data->queue->parallel_for(sycl::range<1>(length),
+               sycl::reduction(d_result, sycl::plus<CeedScalar>(), init),
+  [=](sycl::id<1> i, auto &sum) { sum += x_array[i] * y_array[i]; })
+  .wait_and_throw());
+  *result = *d_result;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Destroy the vector
+//------------------------------------------------------------------------------
+static int CeedVectorDestroy_Sycl(const CeedVector vec) {
+  int ierr;
+  CeedVector_Sycl *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+
+  ierr = CeedVectorFree_Sycl(vec); CeedChk(ierr);
+  if (impl->d_reduce) {
+    Ceed ceed;
+    ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+    Ceed_Sycl *data;
+    ierr = CeedVectorGetQueue_Sycl(vec, &data); CeedChk(ierr);
+    CeedCallSycl(ceed, sycl::free(impl->d_reduce, *data->queue));
+  }
+  ierr = CeedFree(&impl); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Create a vector of the specified length (does not allocate memory)
+//------------------------------------------------------------------------------
+int CeedVectorCreate_Sycl(CeedInt n, CeedVector vec) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedVector_Sycl *impl;
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  ierr = CeedVectorSetData(vec, impl); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "SetArray",
+                                (CeedSyclFunction)CeedVectorSetArray_Sycl);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "TakeArray",
+                                (CeedSyclFunction)CeedVectorTakeArray_Sycl);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "SetValue",
+                                (CeedSyclFunction)CeedVectorSetValue_Sycl);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "SyncArray",
+                                (CeedSyclFunction)CeedVectorSyncArray_Sycl);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "GetArray",
+                                (CeedSyclFunction)CeedVectorGetArray_Sycl);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "GetArrayRead",
+                                (CeedSyclFunction)CeedVectorGetArrayRead_Sycl);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "RestoreArray",
+                                (CeedSyclFunction)CeedVectorRestoreArray_Sycl);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "RestoreArrayRead",
+                                (CeedSyclFunction)
+                                CeedVectorRestoreArrayRead_Sycl);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Norm",
+                                (CeedSyclFunction)CeedVectorNorm_Sycl);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Reciprocal",
+                                (CeedSyclFunction)CeedVectorReciprocal_Sycl);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "AXPY",
+                                (CeedSyclFunction)CeedVectorAXPY_Sycl);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "PointwiseMult",
+                                (CeedSyclFunction)CeedVectorPointwiseMult_Sycl);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Dot",
+                                (CeedSyclFunction)CeedVectorDot_Sycl);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Destroy",
+                                (CeedSyclFunction)CeedVectorDestroy_Sycl);
+  CeedChk(ierr);
+  return 0;
+}
+//------------------------------------------------------------------------------
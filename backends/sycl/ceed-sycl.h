@@ -0,0 +1,55 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+// the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+// reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#ifndef _ceed_sycl_h
+#define _ceed_sycl_h
+
+#include <ceed-backend.h>
+#include <sycl/sycl.hpp>
+
+// SYCL reports errors by exceptions, which must not cross into C callers
+#define CeedCallSycl(ceed, ...) \
+do { \
+  try { \
+    __VA_ARGS__; \
+  } catch (sycl::exception const &e) { \
+    return CeedError((ceed), 1, "SYCL error: %s", e.what()); \
+  } \
+} while (0)
+
+// Backend functions are registered through the untyped C signature
+typedef int (*CeedSyclFunction)();
+
+// The queue is shared by every thread using the Ceed; sycl::queue is
+//   thread-safe, and reductions use per-vector results
+typedef struct {
+  sycl::queue *queue;
+  int deviceId;
+} Ceed_Sycl;
+
+// Vector values live in one USM shared allocation, addressed by both host
+//   code and kernels; an array passed with CEED_USE_POINTER on the host is
+//   used in place until kernels need it, and is updated again on host access
+typedef struct {
+  CeedScalar *array;
+  CeedScalar *array_borrowed;
+  CeedScalar *array_allocated;
+  CeedScalar *d_reduce;
+} CeedVector_Sycl;
+
+CEED_INTERN int CeedVectorCreate_Sycl(CeedInt n, CeedVector vec);
+
+#endif
@@ -0,0 +1,100 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+// the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+// reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <stdlib.h>
+#include <string.h>
+#include "ceed-sycl.h"
+
+//------------------------------------------------------------------------------
+// SYCL preferred MemType
+//------------------------------------------------------------------------------
+static int CeedGetPreferredMemType_Sycl(CeedMemType *type) {
+  *type = CEED_MEM_DEVICE;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+static int CeedDestroy_Sycl(Ceed ceed) {
+  int ierr;
+  Ceed_Sycl *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  if (data->queue) {
+    CeedCallSycl(ceed, data->queue->wait_and_throw());
+    delete data->queue;
+  }
+  ierr = CeedFree(&data); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Init
+//------------------------------------------------------------------------------
+static int CeedInit_Sycl(const char *resource, Ceed ceed) {
+  int ierr;
+  const int nrc = 9; // number of characters in resource
+  if (strncmp(resource, "/gpu/sycl/ref", nrc))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "SYCL backend cannot use resource: %s",
+                     resource);
+  // LCOV_EXCL_STOP
+  const char *device = strstr(resource, ":device_id=");
+  const int deviceID = device ? atoi(&device[11]) : 0;
+
+  // Element restrictions, bases, QFunctions, and operators run on the host
+  //   through the reference backend, which addresses the USM shared arrays
+  //   of the vectors directly
+  Ceed ceedref;
+  CeedInit("/cpu/self/ref/serial", &ceedref);
+  ierr = CeedSetDelegate(ceed, ceedref); CeedChk(ierr);
+
+  Ceed_Sycl *data;
+  ierr = CeedCalloc(1, &data); CeedChk(ierr);
+  ierr = CeedSetData(ceed, data); CeedChk(ierr);
+  data->deviceId = deviceID;
+  std::vector<sycl::device> devices;
+  CeedCallSycl(ceed, devices =
+                 sycl::device::get_devices(sycl::info::device_type::gpu));
+  if (deviceID < 0 || deviceID >= (int)devices.size())
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "SYCL backend cannot use GPU device %d of %d",
+                     deviceID, (int)devices.size());
+  // LCOV_EXCL_STOP
+  CeedCallSycl(ceed, data->queue =
+                 new sycl::queue(devices[deviceID],
+                                 sycl::property::queue::in_order()));
+
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "GetPreferredMemType",
+                                (CeedSyclFunction)CeedGetPreferredMemType_Sycl);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "VectorCreate",
+                                (CeedSyclFunction)CeedVectorCreate_Sycl);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy",
+                                (CeedSyclFunction)CeedDestroy_Sycl);
+  CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Register
+//------------------------------------------------------------------------------
+__attribute__((constructor))
+static void Register(void) {
+  CeedRegister("/gpu/sycl/ref", CeedInit_Sycl, 40);
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,125 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed-backend.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+  char *resource;   // Resource of the traced backend
+  char *reportfile; // Report file, or NULL for stderr
+} Ceed_Trace;
+
+//------------------------------------------------------------------------------
+// Preferred MemType of the traced backend
+//------------------------------------------------------------------------------
+static int CeedGetPreferredMemType_Trace_Host(CeedMemType *type) {
+  *type = CEED_MEM_HOST;
+  return 0;
+}
+
+// LCOV_EXCL_START
+static int CeedGetPreferredMemType_Trace_Device(CeedMemType *type) {
+  *type = CEED_MEM_DEVICE;
+  return 0;
+}
+// LCOV_EXCL_STOP
+
+//------------------------------------------------------------------------------
+// Backend Destroy, reporting the profile of the traced backend
+//------------------------------------------------------------------------------
+static int CeedDestroy_Trace(Ceed ceed) {
+  int ierr;
+  Ceed_Trace *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  FILE *stream = data->reportfile ? fopen(data->reportfile, "w") : stderr;
+  if (!stream)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Unable to open trace report %s",
+                     data->reportfile);
+  // LCOV_EXCL_STOP
+  fprintf(stream, "Trace of %s\n", data->resource);
+  ierr = CeedView(ceed, stream); CeedChk(ierr);
+  if (data->reportfile && fclose(stream))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Unable to write trace report %s",
+                     data->reportfile);
+  // LCOV_EXCL_STOP
+
+  ierr = CeedFree(&data->resource); CeedChk(ierr);
+  ierr = CeedFree(&data->reportfile); CeedChk(ierr);
+  ierr = CeedFree(&data); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Init
+//------------------------------------------------------------------------------
+static int CeedInit_Trace(const char *resource, Ceed ceed) {
+  int ierr;
+  const char *traced = resource + strlen("/trace");
+  if (strncmp(resource, "/trace", strlen("/trace")) ||
+      (*traced && *traced != '/'))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Trace backend cannot use resource: %s",
+                     resource);
+  // LCOV_EXCL_STOP
+  if (!*traced)
+    traced = "/cpu/self";
+
+  // Every object is created by the traced backend, which calls the profiled
+  //   interface functions of the objects it uses
+  Ceed ceedtraced;
+  ierr = CeedInit(traced, &ceedtraced); CeedChk(ierr);
+  ierr = CeedSetDelegate(ceed, ceedtraced); CeedChk(ierr);
+  ierr = CeedSetProfiling(ceed, true); CeedChk(ierr);
+
+  // The traced backend is destroyed before the report is written
+  CeedMemType memtype;
+  ierr = CeedGetPreferredMemType(ceedtraced, &memtype); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "GetPreferredMemType",
+                                memtype == CEED_MEM_HOST ?
+                                CeedGetPreferredMemType_Trace_Host :
+                                CeedGetPreferredMemType_Trace_Device);
+  CeedChk(ierr);
+
+  Ceed_Trace *data;
+  ierr = CeedCalloc(1, &data); CeedChk(ierr);
+  ierr = CeedCalloc(strlen(traced) + 1, &data->resource); CeedChk(ierr);
+  memcpy(data->resource, traced, strlen(traced));
+  const char *reportfile = getenv("CEED_TRACE_REPORT");
+  if (reportfile) {
+    ierr = CeedCalloc(strlen(reportfile) + 1, &data->reportfile);
+    CeedChk(ierr);
+    memcpy(data->reportfile, reportfile, strlen(reportfile));
+  }
+  ierr = CeedSetData(ceed, data); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy",
+                                CeedDestroy_Trace); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Register
+//------------------------------------------------------------------------------
+__attribute__((constructor))
+static void Register(void) {
+  CeedRegister("/trace", CeedInit_Trace, 120);
+}
+//------------------------------------------------------------------------------
@@ -36,13 +36,76 @@ static int CeedTensorContract_Xsmm_C1(CeedTensorContract contract,
     beta = 0.0;
 
   // libXSMM GEMM
-  libxsmm_dgemm(&transt, &transu, &J, &A, &B,
+  libxsmm_xgemm(&transt, &transu, &J, &A, &B,
                 &alpha, &t[0], NULL, &u[0], NULL,
                 &beta, &v[0], NULL);
 
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Build Kernel
+//   Kernels are built on first use of a size and kept in the hash table for the
+//   lifetime of the contraction
+//------------------------------------------------------------------------------
+static int CeedTensorContractBuildKernel_Xsmm(Ceed ceed,
+    CeedTensorContract_Xsmm *impl, CeedHashIJKLMKey key,
+    libxsmm_xmmfunction *kernel) {
+  int new_item;
+  khint_t k = kh_put(m32, impl->lookup, key, &new_item);
+  if (new_item) {
+    // Build kernel
+    const CeedInt B = key.i, C = key.j, J = key.k, tmode = key.l, add = key.m;
+    const int flags = LIBXSMM_GEMM_FLAGS('N', tmode ? 'T' : 'N');
+    CeedScalar alpha = 1.0, beta = 1.0;
+    if (!add) beta = 0.0;
+    libxsmm_xmmfunction newkernel = libxsmm_xmmdispatch(
+                                      C, J, B, NULL, NULL, NULL, &alpha, &beta, &flags, NULL);
+    if (!newkernel) {
+      // LCOV_EXCL_START
+      kh_del(m32, impl->lookup, k);
+      return CeedError(ceed, 1, "LIBXSMM kernel failed to build.");
+      // LCOV_EXCL_STOP
+    }
+    // Add kernel to hash table
+    kh_value(impl->lookup, k) = newkernel;
+  }
+  *kernel = kh_value(impl->lookup, k);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Get Kernel
+//   Recently used kernels are found by comparing keys, without hashing or
+//   probing the table; other sizes go through the table, building on a miss
+//------------------------------------------------------------------------------
+static int CeedTensorContractGetKernel_Xsmm(CeedTensorContract contract,
+    CeedInt B, CeedInt C, CeedInt J, CeedTransposeMode tmode, CeedInt add,
+    libxsmm_xmmfunction *kernel) {
+  int ierr;
+  CeedTensorContract_Xsmm *impl;
+  ierr = CeedTensorContractGetData(contract, &impl); CeedChk(ierr);
+  CeedHashIJKLMKey key = {B, C, J, tmode, add};
+
+  // Recently used kernels
+  for (CeedInt i=0; i<CEED_XSMM_RECENT; i++)
+    if (impl->recent[i].kernel && CeedHashIJKLMKeyEqual(impl->recent[i].key,
+        key)) {
+      *kernel = impl->recent[i].kernel;
+      return 0;
+    }
+
+  // Hash table
+  Ceed ceed;
+  ierr = CeedTensorContractGetCeed(contract, &ceed); CeedChk(ierr);
+  ierr = CeedTensorContractBuildKernel_Xsmm(ceed, impl, key, kernel);
+  CeedChk(ierr);
+  impl->recent[impl->nextrecent].key = key;
+  impl->recent[impl->nextrecent].kernel = *kernel;
+  impl->nextrecent = (impl->nextrecent + 1) % CEED_XSMM_RECENT;
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Apply
 //------------------------------------------------------------------------------
@@ -54,32 +117,71 @@ static int CeedTensorContractApply_Xsmm(CeedTensorContract contract, CeedInt A,
                                         const CeedScalar *restrict u,
                                         CeedScalar *restrict v) {
   int ierr;
-  CeedTensorContract_Xsmm *impl;
-  ierr = CeedTensorContractGetData(contract, &impl); CeedChk(ierr);
-
-  // Get kernel
-  libxsmm_dmmfunction kernel;
-  CeedHashIJKLMKey key = {B, C, J, tmode, add};
-  khint_t k = kh_get(m32, impl->lookup, key);
-  CeedHashGetValue(impl->lookup, k, kernel);
 
-  // Run kernel or fallback to default implementation
-  if (C != 1)
+  // Run kernel or fallback to GEMM for C=1
+  if (C != 1) {
+    libxsmm_xmmfunction kernel;
+    ierr = CeedTensorContractGetKernel_Xsmm(contract, B, C, J, tmode, add,
+                                            &kernel); CeedChk(ierr);
     for (CeedInt a=0; a<A; a++)
       kernel(&u[a*B*C], &t[0], &v[a*J*C], NULL, NULL, NULL);
-  else
+  } else {
     CeedTensorContract_Xsmm_C1(contract, A, B, C, J, t, tmode, add, u, v);
+  }
 
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Tensor Contract Apply Full
+//   Kernels for each direction are looked up once, then all dimensions of one
+//   component are contracted at a time, so the intermediate values stay in
+//   cache
+//------------------------------------------------------------------------------
+static int CeedTensorContractApplyFull_Xsmm(CeedTensorContract contract,
+    CeedInt dim, CeedInt ncomp, CeedInt P, CeedInt Q, CeedInt nelem,
+    const CeedScalar *const *t, CeedTransposeMode tmode, const CeedInt add,
+    const CeedScalar *restrict u, CeedScalar *restrict v) {
+  int ierr;
+
+  // Kernels for each direction
+  libxsmm_xmmfunction kernels[dim];
+  for (CeedInt d=0, post=nelem; d<dim; d++, post*=Q)
+    if (post != 1) {
+      ierr = CeedTensorContractGetKernel_Xsmm(contract, P, post, Q, tmode,
+                                              add&&(d==dim-1), &kernels[d]);
+      CeedChk(ierr);
+    }
+
+  const CeedInt usize = CeedIntPow(P, dim)*nelem;
+  const CeedInt vsize = CeedIntPow(Q, dim)*nelem;
+  CeedScalar tmp[2][CeedPadLength(nelem*Q*CeedIntPow(P>Q?P:Q, dim-1))]
+  CEED_ALIGNED;
+  for (CeedInt c=0; c<ncomp; c++) {
+    CeedInt pre = CeedIntPow(P, dim-1), post = nelem;
+    for (CeedInt d=0; d<dim; d++) {
+      const CeedScalar *in = d==0 ? &u[c*usize] : tmp[d%2];
+      CeedScalar *out = d==dim-1 ? &v[c*vsize] : tmp[(d+1)%2];
+      if (post != 1)
+        for (CeedInt a=0; a<pre; a++)
+          kernels[d](&in[a*P*post], t[d], &out[a*Q*post], NULL, NULL, NULL);
+      else
+        CeedTensorContract_Xsmm_C1(contract, pre, P, post, Q, t[d], tmode,
+                                   add&&(d==dim-1), in, out);
+      pre /= P;
+      post *= Q;
+    }
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Destroy
 //------------------------------------------------------------------------------
 static int CeedTensorContractDestroy_Xsmm(CeedTensorContract contract) {
   int ierr;
   CeedTensorContract_Xsmm *impl;
-  libxsmm_dmmfunction kernel;
+  libxsmm_xmmfunction kernel;
 
   ierr = CeedTensorContractGetData(contract, &impl); CeedChk(ierr);
   // Free kernels
@@ -115,27 +217,13 @@ int CeedTensorContractCreate_Xsmm(CeedBasis basis,
         for (CeedInt tmode = 0; tmode <= 1; tmode++)
           for (CeedInt grad = 0; grad <=1; grad++)
             for (CeedInt dim = 0; dim < impl->dim; dim++) {
-              const int flags = LIBXSMM_GEMM_FLAGS('N', tmode ? 'T' : 'N');
               CeedInt B = grad ? impl->Q : (tmode ? impl->Q : impl->P),
                       J = grad ? impl->Q : (tmode ? impl->P : impl->Q),
                       C = nelem*CeedIntPow(J, dim);
-              // Add key, kernel pair to hash table
               CeedHashIJKLMKey key = {B, C, J, tmode, add};
-              int new_item;
-              khint_t k = kh_put(m32, impl->lookup, key, &new_item);
-              if (new_item) {
-                // Build kernel
-                CeedScalar alpha = 1.0, beta = 1.0;
-                if (!add) beta = 0.0;
-                libxsmm_dmmfunction kernel = libxsmm_dmmdispatch(
-                                               C, J, B, NULL, NULL, NULL, &alpha, &beta, &flags, NULL);
-                if (!kernel)
-                  // LCOV_EXCL_START
-                  return CeedError(ceed, 1, "LIBXSMM kernel failed to build.");
-                // LCOV_EXCL_STOP
-                // Add kernel to hash table
-                kh_value(impl->lookup, k) = kernel;
-              }
+              libxsmm_xmmfunction kernel;
+              ierr = CeedTensorContractBuildKernel_Xsmm(ceed, impl, key,
+                     &kernel); CeedChk(ierr);
             }
   } else {
     ierr = CeedBasisGetNumNodes(basis, &impl->P); CeedChk(ierr);
@@ -147,27 +235,13 @@ int CeedTensorContractCreate_Xsmm(CeedBasis basis,
         for (CeedInt tmode = 0; tmode <= 1; tmode++) {
           CeedInt gradstride = CeedIntMax(impl->dim-1, 1);
           for (CeedInt grad = 1; grad <= impl->dim; grad+=gradstride) {
-            const int flags = LIBXSMM_GEMM_FLAGS('N', tmode ? 'T' : 'N');
             CeedInt B = tmode ? grad*impl->Q : impl->P,
                     J = tmode ? impl->P : grad*impl->Q,
                     C = nelem;
-            // Add key, kernel pair to hash table
             CeedHashIJKLMKey key = {B, C, J, tmode, add};
-            int new_item;
-            khint_t k = kh_put(m32, impl->lookup, key, &new_item);
-            if (new_item) {
-              // Build kernel
-              CeedScalar alpha = 1.0, beta = 1.0;
-              if (!add) beta = 0.0;
-              libxsmm_dmmfunction kernel = libxsmm_dmmdispatch(
-                                             C, J, B, NULL, NULL, NULL, &alpha, &beta, &flags, NULL);
-              if (!kernel)
-                // LCOV_EXCL_START
-                return CeedError(ceed, 1, "LIBXSMM kernel failed to build.");
-              // LCOV_EXCL_STOP
-              // Add kernel to hash table
-              kh_value(impl->lookup, k) = kernel;
-            }
+            libxsmm_xmmfunction kernel;
+            ierr = CeedTensorContractBuildKernel_Xsmm(ceed, impl, key, &kernel);
+            CeedChk(ierr);
           }
         }
   }
@@ -175,6 +249,8 @@ int CeedTensorContractCreate_Xsmm(CeedBasis basis,
 
   ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply",
                                 CeedTensorContractApply_Xsmm); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "ApplyFull",
+                                CeedTensorContractApplyFull_Xsmm); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "TensorContract", contract, "Destroy",
                                 CeedTensorContractDestroy_Xsmm); CeedChk(ierr);
 
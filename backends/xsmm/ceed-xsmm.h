@@ -20,13 +20,34 @@
 #include <string.h>
 #include <math.h>
 
+// libXSMM kernels matching CeedScalar
+#ifdef CEED_SINGLE_PRECISION
+#  define libxsmm_xgemm libxsmm_sgemm
+#  define libxsmm_xmmfunction libxsmm_smmfunction
+#  define libxsmm_xmmdispatch libxsmm_smmdispatch
+#else
+#  define libxsmm_xgemm libxsmm_dgemm
+#  define libxsmm_xmmfunction libxsmm_dmmfunction
+#  define libxsmm_xmmdispatch libxsmm_dmmdispatch
+#endif
+
 // Instantiate khash structs and methods
-CeedHashIJKLMInit(m32, libxsmm_dmmfunction)
+CeedHashIJKLMInit(m32, libxsmm_xmmfunction)
+
+// Number of recently used kernels checked before the hash table
+#define CEED_XSMM_RECENT 8
+
+typedef struct {
+  CeedHashIJKLMKey key;
+  libxsmm_xmmfunction kernel;
+} CeedTensorContractKernel_Xsmm;
 
 typedef struct {
   bool isTensor;
   CeedInt P, Q, dim;
   khash_t(m32) *lookup;
+  CeedTensorContractKernel_Xsmm recent[CEED_XSMM_RECENT];
+  CeedInt nextrecent;
 } CeedTensorContract_Xsmm;
 
 CEED_INTERN int CeedTensorContractCreate_Xsmm(CeedBasis basis,
@@ -0,0 +1,296 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+//                     libCEED Benchmark Problem Operators
+//
+// This program times CeedOperatorApply for the CEED benchmark problems BP1-BP6
+// on a structured box mesh, without PETSc or MPI, so that the operator
+// throughput of a backend can be tracked on its own. The QFunctions are the
+// ones used by the PETSc BPs example. Each measurement is written as one JSON
+// object per line, in the same format as microbench.c.
+//
+// Build with:
+//
+//     make bpbench
+//
+// Sample runs:
+//
+//     build/bpbench
+//     build/bpbench -ceed /cpu/self/opt/blocked -bp 3 -p 5
+//
+// Options:
+//
+//     -ceed <resource>  libCEED resource to benchmark
+//     -bp <bp>          only run benchmark problem <bp> (default: 1 to 6)
+//     -p <P>            only run <P> 1D nodes (default: 2, 4 and 6)
+//     -s <size>         approximate number of nodes in the mesh
+//                       (default: 2^16)
+//     -t <seconds>      minimum time per measurement (default: 0.05)
+
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+// The right hand side QFunctions of these headers are not used here
+#pragma GCC diagnostic ignored "-Wunused-function"
+#include "../examples/petsc/qfunctions/bps/bp1.h"
+#include "../examples/petsc/qfunctions/bps/bp2.h"
+#include "../examples/petsc/qfunctions/bps/bp3.h"
+#include "../examples/petsc/qfunctions/bps/bp4.h"
+
+// Benchmark problem data, as in the PETSc BPs example
+typedef struct {
+  CeedInt ncomp, qdatasize, qextra;
+  CeedQFunctionUser setupgeo, apply;
+  const char *setupgeofname, *applyfname;
+  CeedEvalMode mode;
+  CeedQuadMode qmode;
+} BPData;
+
+static const BPData bpdata[6] = {
+  {1, 1, 1, SetupMassGeo, Mass, SetupMassGeo_loc, Mass_loc,
+   CEED_EVAL_INTERP, CEED_GAUSS},
+  {3, 1, 1, SetupMassGeo, Mass3, SetupMassGeo_loc, Mass3_loc,
+   CEED_EVAL_INTERP, CEED_GAUSS},
+  {1, 6, 1, SetupDiffGeo, Diff, SetupDiffGeo_loc, Diff_loc,
+   CEED_EVAL_GRAD, CEED_GAUSS},
+  {3, 6, 1, SetupDiffGeo, Diff3, SetupDiffGeo_loc, Diff3_loc,
+   CEED_EVAL_GRAD, CEED_GAUSS},
+  {1, 6, 0, SetupDiffGeo, Diff, SetupDiffGeo_loc, Diff_loc,
+   CEED_EVAL_GRAD, CEED_GAUSS_LOBATTO},
+  {3, 6, 0, SetupDiffGeo, Diff3, SetupDiffGeo_loc, Diff3_loc,
+   CEED_EVAL_GRAD, CEED_GAUSS_LOBATTO},
+};
+
+// Wall clock time in seconds
+static double Wtime(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9*ts.tv_nsec;
+}
+
+// Offsets of the nodes of each element of a box mesh with nxe elements in
+//   each direction, for elements with P nodes in each direction
+static CeedInt *BoxOffsets(const CeedInt nxe[3], CeedInt P) {
+  const CeedInt nelem = nxe[0]*nxe[1]*nxe[2], elemsize = P*P*P;
+  const CeedInt nxn[3] = {nxe[0]*(P-1) + 1, nxe[1]*(P-1) + 1,
+                          nxe[2]*(P-1) + 1
+                         };
+  CeedInt *offsets = malloc(nelem*elemsize*sizeof(offsets[0]));
+
+  for (CeedInt el=0; el<nelem; el++) {
+    CeedInt exyz[3] = {el % nxe[0], (el / nxe[0]) % nxe[1],
+                       el / (nxe[0]*nxe[1])
+                      };
+    for (CeedInt n=0; n<elemsize; n++) {
+      CeedInt idx = 0, stride = 1, rem = n;
+      for (CeedInt d=0; d<3; d++) {
+        idx += (exyz[d]*(P-1) + rem % P) * stride;
+        stride *= nxn[d];
+        rem /= P;
+      }
+      offsets[el*elemsize + n] = idx;
+    }
+  }
+  return offsets;
+}
+
+// Benchmark the operator of one benchmark problem
+static int BenchBP(Ceed ceed, const char *resource, CeedInt bp, CeedInt P,
+                   CeedInt size, double mintime) {
+  const BPData *data = &bpdata[bp-1];
+  const CeedInt ncomp = data->ncomp, qdatasize = data->qdatasize,
+                Q = P + data->qextra, dim = 3;
+  const CeedInt inscale = data->mode == CEED_EVAL_GRAD ? dim : 1;
+  CeedInt nxe[3], nelem = 1, nnodes = 1, nxnodes = 1, reps;
+  CeedInt *offsets;
+  CeedBasis basisx, basisu;
+  CeedElemRestriction rx, ru, rqd;
+  CeedQFunction qf_setup, qf_apply;
+  CeedOperator op_setup, op_apply;
+  CeedVector X, qdata, U, V;
+  CeedScalar *x;
+  size_t flops, bytes;
+  double time;
+
+  // Near cubic arrangement of the elements with about size nodes
+  for (CeedInt d=0, rem=size; d<dim; d++) {
+    nxe[d] = pow(rem, 1./(dim-d)) / (P-1) + 0.5;
+    if (nxe[d] < 1) nxe[d] = 1;
+    rem /= nxe[d]*(P-1);
+    if (rem < 1) rem = 1;
+    nelem *= nxe[d];
+    nnodes *= nxe[d]*(P-1) + 1;
+    nxnodes *= nxe[d] + 1;
+  }
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, 2, Q, data->qmode, &basisx);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, ncomp, P, Q, data->qmode,
+                                  &basisu);
+
+  // Restrictions
+  offsets = BoxOffsets(nxe, 2);
+  CeedElemRestrictionCreate(ceed, nelem, 8, dim, nxnodes, dim*nxnodes,
+                            CEED_MEM_HOST, CEED_COPY_VALUES, offsets, &rx);
+  free(offsets);
+  offsets = BoxOffsets(nxe, P);
+  CeedElemRestrictionCreate(ceed, nelem, P*P*P, ncomp, nnodes, ncomp*nnodes,
+                            CEED_MEM_HOST, CEED_COPY_VALUES, offsets, &ru);
+  free(offsets);
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q*Q*Q, qdatasize,
+                                   qdatasize*nelem*Q*Q*Q,
+                                   CEED_STRIDES_BACKEND, &rqd);
+
+  // Mesh coordinates of the unit cube
+  CeedVectorCreate(ceed, dim*nxnodes, &X);
+  CeedVectorGetArray(X, CEED_MEM_HOST, &x);
+  for (CeedInt i=0; i<nxnodes; i++) {
+    const CeedInt ixyz[3] = {i % (nxe[0]+1), (i / (nxe[0]+1)) % (nxe[1]+1),
+                             i / ((nxe[0]+1)*(nxe[1]+1))
+                            };
+    for (CeedInt d=0; d<dim; d++)
+      x[i + d*nxnodes] = (CeedScalar)ixyz[d] / nxe[d];
+  }
+  CeedVectorRestoreArray(X, &x);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, data->setupgeo, data->setupgeofname,
+                              &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "dx", dim*dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddOutput(qf_setup, "qdata", qdatasize, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, data->apply, data->applyfname,
+                              &qf_apply);
+  CeedQFunctionAddInput(qf_apply, "u", ncomp*inscale, data->mode);
+  CeedQFunctionAddInput(qf_apply, "qdata", qdatasize, CEED_EVAL_NONE);
+  CeedQFunctionAddOutput(qf_apply, "v", ncomp*inscale, data->mode);
+
+  // Operators
+  CeedVectorCreate(ceed, qdatasize*nelem*Q*Q*Q, &qdata);
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "dx", rx, basisx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basisx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "qdata", rqd, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  CeedOperatorCreate(ceed, qf_apply, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_apply);
+  CeedOperatorSetField(op_apply, "u", ru, basisu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "qdata", rqd, CEED_BASIS_COLLOCATED, qdata);
+  CeedOperatorSetField(op_apply, "v", ru, basisu, CEED_VECTOR_ACTIVE);
+  CeedOperatorGetFlopsEstimate(op_apply, &flops);
+  CeedOperatorGetBytesEstimate(op_apply, &bytes);
+
+  // Time a batch of applications, doubling the batch until it runs for at
+  //   least mintime; the norm completes any outstanding device work
+  CeedScalar norm;
+  CeedVectorCreate(ceed, ncomp*nnodes, &U);
+  CeedVectorCreate(ceed, ncomp*nnodes, &V);
+  CeedVectorSetValue(U, 1.0);
+  CeedOperatorApply(op_apply, U, V, CEED_REQUEST_IMMEDIATE);
+  CeedVectorNorm(V, CEED_NORM_1, &norm);
+  for (reps = 1; ; reps *= 2) {
+    const double start = Wtime();
+    for (CeedInt rep=0; rep<reps; rep++)
+      CeedOperatorApply(op_apply, U, V, CEED_REQUEST_IMMEDIATE);
+    CeedVectorNorm(V, CEED_NORM_1, &norm);
+    time = Wtime() - start;
+    if (time >= mintime) break;
+  }
+
+  const double t = time / reps, dofs = (double)ncomp*nnodes;
+  printf("{\"code\": \"libCEED\", \"test\": \"bpbench\", "
+         "\"kernel\": \"bp%d\", \"backend\": \"%s\", "
+         "\"tmode\": \"notranspose\", \"dim\": %d, \"degree\": %d, "
+         "\"quadrature_pts\": %d, \"ncomp\": %d, \"num_elem\": %d, "
+         "\"num_unknowns\": %.0f, \"reps\": %d, \"time\": %.6e, "
+         "\"dofs_per_sec\": %.6e, \"bytes_per_sec\": %.6e, "
+         "\"flops_per_sec\": %.6e}\n",
+         bp, resource, dim, P - 1, Q, ncomp, nelem, dofs, reps, t, dofs/t,
+         bytes/t, flops/t);
+  fflush(stdout);
+
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&qdata);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_apply);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_apply);
+  CeedElemRestrictionDestroy(&rx);
+  CeedElemRestrictionDestroy(&ru);
+  CeedElemRestrictionDestroy(&rqd);
+  CeedBasisDestroy(&basisx);
+  CeedBasisDestroy(&basisu);
+  return 0;
+}
+
+int main(int argc, const char *argv[]) {
+  const char *ceed_spec = "/cpu/self";
+  CeedInt bp = 0, P = 0, size = 1 << 16;
+  double mintime = 0.05;
+
+  // Parse command line options
+  for (int ia=1; ia<argc; ia++) {
+    int next_arg = ((ia+1) < argc), parse_error = 0;
+    if (!strcmp(argv[ia],"-h")) {
+      parse_error = 1;
+    } else if (!strcmp(argv[ia],"-c") || !strcmp(argv[ia],"-ceed")) {
+      parse_error = next_arg ? ceed_spec = argv[++ia], 0 : 1;
+    } else if (!strcmp(argv[ia],"-bp")) {
+      parse_error = next_arg ? bp = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-p")) {
+      parse_error = next_arg ? P = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-s")) {
+      parse_error = next_arg ? size = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-t")) {
+      parse_error = next_arg ? mintime = atof(argv[++ia]), 0 : 1;
+    } else {
+      parse_error = 1;
+    }
+    if (parse_error || bp < 0 || bp > 6 || P == 1) {
+      // LCOV_EXCL_START
+      fprintf(stderr, "Usage: %s [-ceed <resource>] [-bp <bp>] [-p <P>] "
+              "[-s <size>] [-t <seconds>]\n", argv[0]);
+      return 1;
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  Ceed ceed;
+  CeedInit(ceed_spec, &ceed);
+  const char *resource;
+  CeedGetResource(ceed, &resource);
+
+  const CeedInt Ps[3] = {2, 4, 6};
+  for (CeedInt b=(bp ? bp : 1); b<=(bp ? bp : 6); b++)
+    for (CeedInt p=0; p<3; p++) {
+      if (P && p) break;
+      BenchBP(ceed, resource, b, P ? P : Ps[p], size, mintime);
+    }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
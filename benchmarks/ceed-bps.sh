@@ -0,0 +1,56 @@
+# Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+# Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+# All Rights reserved. See files LICENSE and NOTICE for details.
+#
+# This file is part of CEED, a collection of benchmarks, miniapps, software
+# libraries and APIs for efficient high-order finite element and spectral
+# element discretizations for exascale applications. For more information and
+# source code availability see http://github.com/ceed.
+#
+# The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+# a collaborative effort of two U.S. Department of Energy organizations (Office
+# of Science and the National Nuclear Security Administration) responsible for
+# the planning and preparation of a capable exascale ecosystem, including
+# software, applications, hardware, advanced system engineering and early
+# testbed platforms, in support of the nation's exascale computing imperative.
+
+function run_tests()
+{
+   $dry_run cd "$test_exe_dir"
+
+   # Some of the available options are:
+   # -o <3>: Polynomial degree of tensor product basis
+   # -q <o+1+qextra>: Number of 1D quadrature points
+   # -ceed </cpu/self>: CEED resource specifier
+   # -s <262144>: Approximate number of unknowns
+   # -i <5 or 20>: Number of CG iterations, by default based on timing
+
+   # The variables 'max_dofs_node', and 'max_p' can be set on the command line
+   # invoking the 'benchmark.sh' script. The example is serial, so the number
+   # of processors is not used.
+   local ceed="${ceed:-/cpu/self}"
+   local common_args=(-ceed $ceed)
+   local max_dofs_node_def=$((3*2**20))
+   local max_dofs_node=${max_dofs_node:-$max_dofs_node_def}
+   local max_p=${max_p:-8}
+   local sol_p=
+   for ((sol_p = 1; sol_p <= max_p; sol_p++)); do
+      local loc_el=
+      # Start with 2x2x2 elements, so the Dirichlet problems have unknowns
+      for ((loc_el = 8; loc_el*sol_p**3 <= max_dofs_node; loc_el = 2*loc_el)); do
+         local loc_nodes=$((loc_el*sol_p**3))
+         local all_args=("${common_args[@]}" -o $sol_p -s $loc_nodes -b $bp)
+         if [ -z "$dry_run" ]; then
+            echo
+            echo "Running test:"
+            quoted_echo ./ex3-bps "${all_args[@]}"
+            ./ex3-bps "${all_args[@]}" || \
+               printf "\nError in the test, error code: $?\n\n"
+         else
+            $dry_run ./ex3-bps "${all_args[@]}"
+         fi
+      done
+   done
+}
+
+test_required_examples="ex3-bps"
@@ -0,0 +1,645 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+//                    libCEED Multigrid V-cycle Benchmark
+//
+// This program times the components of a p-multigrid V-cycle for a CEED
+// benchmark problem on a structured box mesh, level by level. The hierarchy is
+// built with CeedOperatorMultigridLevelCreate with the degrees of the uniform
+// or logarithmic coarsening of the PETSc multigrid example, and for each level
+// the operator application, the diagonal assembly, the Jacobi preconditioned
+// Chebyshev smoother, and the restriction and prolongation to the next coarser
+// level, which MatMult_Restrict and MatMult_Prolong of the PETSc example apply,
+// are timed. On the coarsest level, the assembly of the matrix in coordinate
+// format and a Jacobi preconditioned CG solve are timed. A whole V-cycle made
+// of these components is timed for comparison.
+//
+// Each mesh size and level is written as one JSON object per line, in the
+// format of microbench.c, with the time in seconds of each component. After
+// all mesh sizes, the time of each component of each level is fit as
+// overhead + per_dof * num_unknowns by least squares, written as one JSON
+// object per level, so the cost of a V-cycle with other levels or mesh sizes
+// can be predicted from the fitted components.
+//
+// Build with:
+//
+//     make mgbench
+//
+// Sample runs:
+//
+//     build/mgbench
+//     build/mgbench -ceed /gpu/cuda/gen -bp 3 -p 7 -coarsen logarithmic
+//     build/mgbench -ceed /cpu/self/opt/blocked -e 1000 -e 8000 -e 64000
+//
+// Options:
+//
+//     -ceed <resource>  libCEED resource to benchmark
+//     -bp <bp>          benchmark problem (default: 3)
+//     -p <P>            number of 1D nodes on the fine level (default: 5)
+//     -coarsen <type>   uniform or logarithmic coarsening (default: uniform)
+//     -e <nelem>        run about <nelem> elements; may be repeated
+//                       (default: 512, 4096, and 32768)
+//     -s <sweeps>       Chebyshev smoothing sweeps (default: 3)
+//     -t <seconds>      minimum time per measurement (default: 0.05)
+
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+// The right hand side QFunctions of these headers are not used here
+#pragma GCC diagnostic ignored "-Wunused-function"
+#include "../examples/petsc/qfunctions/bps/bp1.h"
+#include "../examples/petsc/qfunctions/bps/bp2.h"
+#include "../examples/petsc/qfunctions/bps/bp3.h"
+#include "../examples/petsc/qfunctions/bps/bp4.h"
+
+// Benchmark problem data, as in the PETSc BPs example
+typedef struct {
+  CeedInt ncomp, qdatasize, qextra;
+  CeedQFunctionUser setupgeo, apply;
+  const char *setupgeofname, *applyfname;
+  CeedEvalMode mode;
+  CeedQuadMode qmode;
+} BPData;
+
+static const BPData bpdata[6] = {
+  {1, 1, 1, SetupMassGeo, Mass, SetupMassGeo_loc, Mass_loc,
+   CEED_EVAL_INTERP, CEED_GAUSS},
+  {3, 1, 1, SetupMassGeo, Mass3, SetupMassGeo_loc, Mass3_loc,
+   CEED_EVAL_INTERP, CEED_GAUSS},
+  {1, 6, 1, SetupDiffGeo, Diff, SetupDiffGeo_loc, Diff_loc,
+   CEED_EVAL_GRAD, CEED_GAUSS},
+  {3, 6, 1, SetupDiffGeo, Diff3, SetupDiffGeo_loc, Diff3_loc,
+   CEED_EVAL_GRAD, CEED_GAUSS},
+  {1, 6, 0, SetupDiffGeo, Diff, SetupDiffGeo_loc, Diff_loc,
+   CEED_EVAL_GRAD, CEED_GAUSS_LOBATTO},
+  {3, 6, 0, SetupDiffGeo, Diff3, SetupDiffGeo_loc, Diff3_loc,
+   CEED_EVAL_GRAD, CEED_GAUSS_LOBATTO},
+};
+
+// Components of a V-cycle, in the order they are timed
+enum {
+  COMP_APPLY, COMP_DIAGONAL, COMP_SMOOTHER, COMP_RESTRICT, COMP_PROLONG,
+  COMP_COARSE_ASSEMBLE, COMP_COARSE_SOLVE, NUM_COMPONENTS
+};
+static const char *const compnames[NUM_COMPONENTS] = {
+  "apply", "diagonal", "smoother", "restrict", "prolong", "coarse_assemble",
+  "coarse_solve"
+};
+
+// Maximum number of multigrid levels and of mesh sizes
+#define MAX_LEVELS 16
+#define MAX_SIZES 8
+
+// Relative tolerance and maximum iterations of the coarse CG solve
+#define COARSE_RTOL 1e-8
+#define COARSE_MAXIT 1000
+
+// One level of the hierarchy; the transfer operators go to the next coarser
+//   level
+typedef struct {
+  CeedInt P, nnodes;
+  CeedInt *offsets;
+  CeedElemRestriction r;
+  CeedBasis basis;
+  CeedOperator op, prolongop, restrictop, smoother;
+  CeedVector b, u, v, diag, dinv, mult;
+} Level;
+
+// Work vectors of the coarse CG solve, and the assembled coarse matrix; without
+//   boundary conditions, the diffusion operators are singular with the
+//   constant of each component in their null space
+typedef struct {
+  CeedInt ncomp;
+  bool nullspace;
+  CeedVector r, z, p, ap, values;
+} CGWork;
+
+// Wall clock time in seconds
+static double Wtime(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9*ts.tv_nsec;
+}
+
+// Complete any outstanding device work on a vector
+static void Sync(CeedVector V) {
+  CeedScalar norm;
+  CeedVectorNorm(V, CEED_NORM_1, &norm);
+}
+
+// Offsets of the nodes of each element of a box mesh with nxe elements in
+//   each direction, for elements with P nodes in each direction
+static CeedInt *BoxOffsets(const CeedInt nxe[3], CeedInt P) {
+  const CeedInt nelem = nxe[0]*nxe[1]*nxe[2], elemsize = P*P*P;
+  const CeedInt nxn[3] = {nxe[0]*(P-1) + 1, nxe[1]*(P-1) + 1,
+                          nxe[2]*(P-1) + 1
+                         };
+  CeedInt *offsets = malloc(nelem*elemsize*sizeof(offsets[0]));
+
+  for (CeedInt el=0; el<nelem; el++) {
+    CeedInt exyz[3] = {el % nxe[0], (el / nxe[0]) % nxe[1],
+                       el / (nxe[0]*nxe[1])
+                      };
+    for (CeedInt n=0; n<elemsize; n++) {
+      CeedInt idx = 0, stride = 1, rem = n;
+      for (CeedInt d=0; d<3; d++) {
+        idx += (exyz[d]*(P-1) + rem % P) * stride;
+        stride *= nxn[d];
+        rem /= P;
+      }
+      offsets[el*elemsize + n] = idx;
+    }
+  }
+  return offsets;
+}
+
+// Solve A u = b on the coarsest level with Jacobi preconditioned CG from a
+//   zero initial guess, returning the number of iterations
+static CeedInt CoarseSolve(Level *lv, CGWork *cg) {
+  CeedScalar rz, rznew, pap, bnorm, rnorm;
+  CeedInt it = 0;
+
+  CeedVectorSetValue(lv->u, 0.0);
+  CeedVectorAXPBY(cg->r, 1.0, 0.0, lv->b);
+  if (cg->nullspace) {
+    // Remove the null space from the restricted residual, which is only
+    //   consistent up to the multiplicity scaling of the restriction
+    CeedScalar *r;
+    CeedVectorGetArray(cg->r, CEED_MEM_HOST, &r);
+    for (CeedInt c=0; c<cg->ncomp; c++) {
+      CeedScalar mean = 0;
+      for (CeedInt i=0; i<lv->nnodes; i++)
+        mean += r[i + c*lv->nnodes];
+      mean /= lv->nnodes;
+      for (CeedInt i=0; i<lv->nnodes; i++)
+        r[i + c*lv->nnodes] -= mean;
+    }
+    CeedVectorRestoreArray(cg->r, &r);
+  }
+  CeedVectorNorm(cg->r, CEED_NORM_2, &bnorm);
+  CeedVectorPointwiseMult(cg->z, lv->dinv, cg->r);
+  CeedVectorAXPBY(cg->p, 1.0, 0.0, cg->z);
+  CeedVectorDot(cg->r, cg->z, &rz);
+  for (rnorm=bnorm; it<COARSE_MAXIT && rnorm > COARSE_RTOL*bnorm; it++) {
+    CeedOperatorApply(lv->op, cg->p, cg->ap, CEED_REQUEST_IMMEDIATE);
+    CeedVectorDot(cg->p, cg->ap, &pap);
+    CeedVectorAXPY(lv->u, rz / pap, cg->p);
+    CeedVectorAXPY(cg->r, -rz / pap, cg->ap);
+    CeedVectorNorm(cg->r, CEED_NORM_2, &rnorm);
+    CeedVectorPointwiseMult(cg->z, lv->dinv, cg->r);
+    CeedVectorDot(cg->r, cg->z, &rznew);
+    CeedVectorAXPBY(cg->p, 1.0, rznew / rz, cg->z);
+    rz = rznew;
+  }
+  return it;
+}
+
+// Approximate A u = b on level l with a V-cycle from a zero initial guess
+static void VCycle(Level *levels, CeedInt l, CeedInt nlevels, CGWork *cg) {
+  Level *lv = &levels[l];
+
+  if (l == nlevels-1) {
+    CoarseSolve(lv, cg);
+    return;
+  }
+  // Pre-smoothing
+  CeedOperatorApply(lv->smoother, lv->b, lv->u, CEED_REQUEST_IMMEDIATE);
+  // Coarse grid correction of the residual
+  CeedOperatorApply(lv->op, lv->u, lv->v, CEED_REQUEST_IMMEDIATE);
+  CeedVectorAXPBY(lv->v, 1.0, -1.0, lv->b);
+  CeedOperatorApply(lv->restrictop, lv->v, levels[l+1].b,
+                    CEED_REQUEST_IMMEDIATE);
+  VCycle(levels, l+1, nlevels, cg);
+  CeedOperatorApply(lv->prolongop, levels[l+1].u, lv->v,
+                    CEED_REQUEST_IMMEDIATE);
+  CeedVectorAXPY(lv->u, 1.0, lv->v);
+  // Post-smoothing
+  CeedOperatorApply(lv->op, lv->u, lv->v, CEED_REQUEST_IMMEDIATE);
+  CeedVectorAXPBY(lv->v, 1.0, -1.0, lv->b);
+  CeedOperatorApplyAdd(lv->smoother, lv->v, lv->u, CEED_REQUEST_IMMEDIATE);
+}
+
+// Run one component of level l once, completing its device work
+static void RunComponent(Level *levels, CeedInt l, CeedInt comp,
+                         CGWork *cg, CeedInt *iters) {
+  Level *lv = &levels[l];
+
+  switch (comp) {
+  case COMP_APPLY:
+    CeedOperatorApply(lv->op, lv->u, lv->v, CEED_REQUEST_IMMEDIATE);
+    Sync(lv->v);
+    break;
+  case COMP_DIAGONAL:
+    CeedOperatorLinearAssembleDiagonal(lv->op, lv->diag,
+                                       CEED_REQUEST_IMMEDIATE);
+    Sync(lv->diag);
+    break;
+  case COMP_SMOOTHER:
+    CeedOperatorApply(lv->smoother, lv->b, lv->u, CEED_REQUEST_IMMEDIATE);
+    Sync(lv->u);
+    break;
+  case COMP_RESTRICT:
+    CeedOperatorApply(lv->restrictop, lv->v, levels[l+1].b,
+                      CEED_REQUEST_IMMEDIATE);
+    Sync(levels[l+1].b);
+    break;
+  case COMP_PROLONG:
+    CeedOperatorApply(lv->prolongop, levels[l+1].u, lv->v,
+                      CEED_REQUEST_IMMEDIATE);
+    Sync(lv->v);
+    break;
+  case COMP_COARSE_ASSEMBLE: {
+    CeedInt nentries, *rows, *cols;
+    CeedOperatorLinearAssembleSymbolic(lv->op, &nentries, &rows, &cols);
+    CeedOperatorLinearAssemble(lv->op, cg->values);
+    Sync(cg->values);
+    CeedFree(&rows);
+    CeedFree(&cols);
+  }
+  break;
+  case COMP_COARSE_SOLVE:
+    *iters = CoarseSolve(lv, cg);
+    Sync(lv->u);
+    break;
+  }
+}
+
+// Time per run of one component, repeated for at least mintime seconds
+static double TimeComponent(Level *levels, CeedInt l, CeedInt comp,
+                            CGWork *cg, double mintime, CeedInt *iters) {
+  CeedInt reps = 0;
+  double start = Wtime(), elapsed;
+
+  do {
+    RunComponent(levels, l, comp, cg, iters);
+    reps++;
+    elapsed = Wtime() - start;
+  } while (elapsed < mintime);
+  return elapsed / reps;
+}
+
+// Benchmark the V-cycle components of each level on about nelem elements,
+//   storing the time of each component and the number of unknowns of each
+//   level
+static int BenchLevels(const char *ceed_spec, CeedInt bp, CeedInt nlevels,
+                       const CeedInt *Plevel, CeedInt nelem_target,
+                       CeedInt sweeps, double mintime,
+                       double time[MAX_LEVELS][NUM_COMPONENTS],
+                       CeedInt ndofs[MAX_LEVELS]) {
+  const BPData *data = &bpdata[bp-1];
+  const CeedInt ncomp = data->ncomp, qdatasize = data->qdatasize,
+                P = Plevel[0], Q = P + data->qextra, dim = 3;
+  const CeedInt inscale = data->mode == CEED_EVAL_GRAD ? dim : 1;
+  CeedInt nxe[3], nelem = 1, nxnodes = 1, iters = 0;
+  CeedInt *offsetsx;
+  Ceed ceed;
+  Level levels[MAX_LEVELS];
+  CGWork cg;
+  CeedBasis basisx;
+  CeedElemRestriction rx, rqd;
+  CeedQFunction qf_setup, qf_apply;
+  CeedOperator op_setup;
+  CeedVector X, qdata;
+  CeedScalar *x;
+
+  // Near cubic arrangement of about nelem_target elements
+  for (CeedInt d=0, rem=nelem_target; d<dim; d++) {
+    nxe[d] = pow(rem, 1./(dim-d)) + 0.5;
+    if (nxe[d] < 1) nxe[d] = 1;
+    rem /= nxe[d];
+    if (rem < 1) rem = 1;
+    nelem *= nxe[d];
+    nxnodes *= nxe[d] + 1;
+  }
+
+  CeedInit(ceed_spec, &ceed);
+
+  // Fine level operator and its quadrature data on the unit cube
+  offsetsx = BoxOffsets(nxe, 2);
+  CeedElemRestrictionCreate(ceed, nelem, 8, dim, nxnodes, dim*nxnodes,
+                            CEED_MEM_HOST, CEED_USE_POINTER, offsetsx, &rx);
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q*Q*Q, qdatasize,
+                                   qdatasize*nelem*Q*Q*Q,
+                                   CEED_STRIDES_BACKEND, &rqd);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, 2, Q, data->qmode, &basisx);
+
+  CeedQFunctionCreateInterior(ceed, 1, data->setupgeo, data->setupgeofname,
+                              &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "dx", dim*dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddOutput(qf_setup, "qdata", qdatasize, CEED_EVAL_NONE);
+  CeedQFunctionCreateInterior(ceed, 1, data->apply, data->applyfname,
+                              &qf_apply);
+  CeedQFunctionAddInput(qf_apply, "u", ncomp*inscale, data->mode);
+  CeedQFunctionAddInput(qf_apply, "qdata", qdatasize, CEED_EVAL_NONE);
+  CeedQFunctionAddOutput(qf_apply, "v", ncomp*inscale, data->mode);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "dx", rx, basisx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basisx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "qdata", rqd, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedVectorCreate(ceed, dim*nxnodes, &X);
+  CeedVectorGetArray(X, CEED_MEM_HOST, &x);
+  for (CeedInt i=0; i<nxnodes; i++) {
+    const CeedInt ixyz[3] = {i % (nxe[0]+1), (i / (nxe[0]+1)) % (nxe[1]+1),
+                             i / ((nxe[0]+1)*(nxe[1]+1))
+                            };
+    for (CeedInt d=0; d<dim; d++)
+      x[i + d*nxnodes] = (CeedScalar)ixyz[d] / nxe[d];
+  }
+  CeedVectorRestoreArray(X, &x);
+  CeedVectorCreate(ceed, qdatasize*nelem*Q*Q*Q, &qdata);
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  // Hierarchy, from the fine level down
+  for (CeedInt l=0; l<nlevels; l++) {
+    Level *lv = &levels[l];
+    lv->P = Plevel[l];
+    lv->nnodes = 1;
+    for (CeedInt d=0; d<dim; d++)
+      lv->nnodes *= nxe[d]*(lv->P-1) + 1;
+    ndofs[l] = ncomp*lv->nnodes;
+    lv->offsets = BoxOffsets(nxe, lv->P);
+    CeedElemRestrictionCreate(ceed, nelem, lv->P*lv->P*lv->P, ncomp,
+                              lv->nnodes, ndofs[l], CEED_MEM_HOST,
+                              CEED_USE_POINTER, lv->offsets, &lv->r);
+    CeedBasisCreateTensorH1Lagrange(ceed, dim, ncomp, lv->P, Q, data->qmode,
+                                    &lv->basis);
+    lv->prolongop = lv->restrictop = NULL;
+    if (l == 0) {
+      CeedOperatorCreate(ceed, qf_apply, CEED_QFUNCTION_NONE,
+                         CEED_QFUNCTION_NONE, &lv->op);
+      CeedOperatorSetField(lv->op, "u", lv->r, lv->basis, CEED_VECTOR_ACTIVE);
+      CeedOperatorSetField(lv->op, "qdata", rqd, CEED_BASIS_COLLOCATED,
+                           qdata);
+      CeedOperatorSetField(lv->op, "v", lv->r, lv->basis, CEED_VECTOR_ACTIVE);
+    } else {
+      CeedOperatorMultigridLevelCreate(levels[l-1].op, levels[l-1].mult,
+                                       lv->r, lv->basis, &lv->op,
+                                       &levels[l-1].prolongop,
+                                       &levels[l-1].restrictop);
+    }
+    CeedVectorCreate(ceed, ndofs[l], &lv->mult);
+    CeedElemRestrictionGetMultiplicity(lv->r, lv->mult);
+    CeedVectorCreate(ceed, ndofs[l], &lv->b);
+    CeedVectorCreate(ceed, ndofs[l], &lv->u);
+    CeedVectorCreate(ceed, ndofs[l], &lv->v);
+    CeedVectorCreate(ceed, ndofs[l], &lv->diag);
+    CeedVectorCreate(ceed, ndofs[l], &lv->dinv);
+    CeedVectorSetValue(lv->u, 0.0);
+    CeedVectorSetValue(lv->v, 0.0);
+    CeedVectorSetValue(lv->dinv, 0.0);
+
+    // Consistent right hand side, in the range of singular operators
+    CeedScalar *hu;
+    CeedVectorGetArray(lv->u, CEED_MEM_HOST, &hu);
+    for (CeedInt i=0; i<ndofs[l]; i++)
+      hu[i] = sin((CeedScalar)i);
+    CeedVectorRestoreArray(lv->u, &hu);
+    CeedOperatorApply(lv->op, lv->u, lv->b, CEED_REQUEST_IMMEDIATE);
+
+    // Chebyshev smoother with bounds from an eigenvalue estimate, as in the
+    //   PETSc example
+    CeedScalar lmin, lmax;
+    CeedOperatorLinearAssembleDiagonal(lv->op, lv->diag,
+                                       CEED_REQUEST_IMMEDIATE);
+    CeedVectorAXPBY(lv->dinv, 1.0, 0.0, lv->diag);
+    CeedVectorReciprocal(lv->dinv);
+    CeedOperatorEstimateEigenvalues(lv->op, lv->diag, 10, &lmin, &lmax);
+    CeedOperatorCreateChebyshevSmoother(lv->op, lv->diag, 0.1*lmax, 1.1*lmax,
+                                        sweeps, &lv->smoother);
+  }
+
+  // Coarse solve work vectors and assembled matrix
+  {
+    const CeedInt n = ndofs[nlevels-1];
+    CeedInt nentries, *rows, *cols;
+    cg.ncomp = ncomp;
+    cg.nullspace = data->mode == CEED_EVAL_GRAD;
+    CeedVectorCreate(ceed, n, &cg.r);
+    CeedVectorCreate(ceed, n, &cg.z);
+    CeedVectorCreate(ceed, n, &cg.p);
+    CeedVectorCreate(ceed, n, &cg.ap);
+    CeedVectorSetValue(cg.r, 0.0);
+    CeedVectorSetValue(cg.z, 0.0);
+    CeedVectorSetValue(cg.p, 0.0);
+    CeedVectorSetValue(cg.ap, 0.0);
+    CeedOperatorLinearAssembleSymbolic(levels[nlevels-1].op, &nentries, &rows,
+                                       &cols);
+    CeedVectorCreate(ceed, nentries, &cg.values);
+    CeedFree(&rows);
+    CeedFree(&cols);
+  }
+
+  // Components of each level; every component runs once before it is timed
+  for (CeedInt l=0; l<nlevels; l++)
+    for (CeedInt c=0; c<NUM_COMPONENTS; c++) {
+      const bool coarsest = l == nlevels-1,
+                 coarse = c == COMP_COARSE_ASSEMBLE || c == COMP_COARSE_SOLVE,
+                 transfer = c == COMP_RESTRICT || c == COMP_PROLONG;
+      time[l][c] = -1;
+      if (coarse != coarsest && (coarse || transfer))
+        continue;
+      if (coarsest && nlevels > 1 && c == COMP_SMOOTHER)
+        continue;
+      RunComponent(levels, l, c, &cg, &iters);
+      time[l][c] = TimeComponent(levels, l, c, &cg, mintime, &iters);
+    }
+
+  // Whole V-cycle on the fine level
+  VCycle(levels, 0, nlevels, &cg);
+  Sync(levels[0].u);
+  CeedInt reps = 0;
+  double start = Wtime(), vcycle;
+  do {
+    VCycle(levels, 0, nlevels, &cg);
+    Sync(levels[0].u);
+    reps++;
+    vcycle = Wtime() - start;
+  } while (vcycle < mintime);
+  vcycle /= reps;
+
+  const char *resource;
+  CeedGetResource(ceed, &resource);
+  for (CeedInt l=0; l<nlevels; l++) {
+    printf("{\"code\": \"libCEED\", \"test\": \"mgbench\", "
+           "\"kernel\": \"bp%d\", \"backend\": \"%s\", \"dim\": %d, "
+           "\"level\": %d, \"degree\": %d, \"fine_degree\": %d, "
+           "\"quadrature_pts\": %d, \"ncomp\": %d, \"num_elem\": %d, "
+           "\"num_unknowns\": %d, \"sweeps\": %d, ", bp, resource, dim,
+           nlevels-1-l, Plevel[l] - 1, P - 1, Q, ncomp, nelem, ndofs[l],
+           sweeps);
+    for (CeedInt c=0; c<NUM_COMPONENTS; c++)
+      if (time[l][c] >= 0)
+        printf("\"%s\": %.6e, ", compnames[c], time[l][c]);
+    if (l == nlevels-1)
+      printf("\"coarse_iterations\": %d, ", iters);
+    printf("\"vcycle\": %.6e}\n", vcycle);
+  }
+  fflush(stdout);
+
+  for (CeedInt l=0; l<nlevels; l++) {
+    Level *lv = &levels[l];
+    CeedOperatorDestroy(&lv->op);
+    CeedOperatorDestroy(&lv->prolongop);
+    CeedOperatorDestroy(&lv->restrictop);
+    CeedOperatorDestroy(&lv->smoother);
+    CeedElemRestrictionDestroy(&lv->r);
+    CeedBasisDestroy(&lv->basis);
+    CeedVectorDestroy(&lv->b);
+    CeedVectorDestroy(&lv->u);
+    CeedVectorDestroy(&lv->v);
+    CeedVectorDestroy(&lv->diag);
+    CeedVectorDestroy(&lv->dinv);
+    CeedVectorDestroy(&lv->mult);
+    free(lv->offsets);
+  }
+  CeedVectorDestroy(&cg.r);
+  CeedVectorDestroy(&cg.z);
+  CeedVectorDestroy(&cg.p);
+  CeedVectorDestroy(&cg.ap);
+  CeedVectorDestroy(&cg.values);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&qdata);
+  CeedOperatorDestroy(&op_setup);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_apply);
+  CeedElemRestrictionDestroy(&rx);
+  CeedElemRestrictionDestroy(&rqd);
+  CeedBasisDestroy(&basisx);
+  CeedDestroy(&ceed);
+  free(offsetsx);
+  return 0;
+}
+
+int main(int argc, const char *argv[]) {
+  const char *ceed_spec = "/cpu/self";
+  CeedInt bp = 3, P = 5, sweeps = 3, nsizes = 0, nelems[MAX_SIZES];
+  bool logarithmic = false;
+  double mintime = 0.05;
+
+  // Parse command line options
+  for (int ia=1; ia<argc; ia++) {
+    int next_arg = ((ia+1) < argc), parse_error = 0;
+    if (!strcmp(argv[ia],"-h")) {
+      parse_error = 1;
+    } else if (!strcmp(argv[ia],"-c") || !strcmp(argv[ia],"-ceed")) {
+      parse_error = next_arg ? ceed_spec = argv[++ia], 0 : 1;
+    } else if (!strcmp(argv[ia],"-bp")) {
+      parse_error = next_arg ? bp = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-p")) {
+      parse_error = next_arg ? P = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-coarsen") && next_arg) {
+      ia++;
+      logarithmic = !strcmp(argv[ia],"logarithmic");
+      parse_error = !logarithmic && strcmp(argv[ia],"uniform");
+    } else if (!strcmp(argv[ia],"-e")) {
+      parse_error = next_arg && nsizes < MAX_SIZES ?
+                    nelems[nsizes++] = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-s")) {
+      parse_error = next_arg ? sweeps = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-t")) {
+      parse_error = next_arg ? mintime = atof(argv[++ia]), 0 : 1;
+    } else {
+      parse_error = 1;
+    }
+    if (parse_error || bp < 1 || bp > 6 || P < 2 || sweeps < 1 ||
+        (nsizes && nelems[nsizes-1] < 1)) {
+      // LCOV_EXCL_START
+      fprintf(stderr, "Usage: %s [-ceed <resource>] [-bp <bp>] [-p <P>] "
+              "[-coarsen uniform|logarithmic] [-e <nelem>]... [-s <sweeps>] "
+              "[-t <seconds>]\n", argv[0]);
+      return 1;
+      // LCOV_EXCL_STOP
+    }
+  }
+  if (!nsizes) {
+    const CeedInt defaults[3] = {512, 4096, 32768};
+    for (nsizes=0; nsizes<3; nsizes++)
+      nelems[nsizes] = defaults[nsizes];
+  }
+
+  // Degrees of the levels, from the fine level down, as in the PETSc
+  //   multigrid example
+  const CeedInt degree = P - 1;
+  CeedInt nlevels = 0, Plevel[MAX_LEVELS];
+  if (logarithmic) {
+    CeedInt d = 1;
+    while (2*d < degree)
+      d *= 2;
+    Plevel[nlevels++] = P;
+    for (; d>=1 && d<degree && nlevels<MAX_LEVELS; d/=2)
+      Plevel[nlevels++] = d + 1;
+  } else {
+    for (CeedInt d=degree; d>=1 && nlevels<MAX_LEVELS; d--)
+      Plevel[nlevels++] = d + 1;
+  }
+
+  // Components of each level for each mesh size
+  static double time[MAX_SIZES][MAX_LEVELS][NUM_COMPONENTS];
+  CeedInt ndofs[MAX_SIZES][MAX_LEVELS];
+  for (CeedInt s=0; s<nsizes; s++)
+    BenchLevels(ceed_spec, bp, nlevels, Plevel, nelems[s], sweeps, mintime,
+                time[s], ndofs[s]);
+
+  // Least squares fit of time = overhead + per_dof * num_unknowns for each
+  //   component of each level; with one mesh size, the overhead is zero
+  const char *resource;
+  Ceed ceed;
+  CeedInit(ceed_spec, &ceed);
+  CeedGetResource(ceed, &resource);
+  for (CeedInt l=0; l<nlevels; l++) {
+    printf("{\"code\": \"libCEED\", \"test\": \"mgbench_model\", "
+           "\"kernel\": \"bp%d\", \"backend\": \"%s\", \"level\": %d, "
+           "\"degree\": %d, \"fine_degree\": %d, \"sweeps\": %d, "
+           "\"sizes\": %d", bp, resource, nlevels-1-l, Plevel[l] - 1, degree,
+           sweeps, nsizes);
+    for (CeedInt c=0; c<NUM_COMPONENTS; c++) {
+      double sn = 0, st = 0, snn = 0, snt = 0, a, b;
+      if (time[0][l][c] < 0)
+        continue;
+      for (CeedInt s=0; s<nsizes; s++) {
+        const double n = ndofs[s][l], t = time[s][l][c];
+        sn += n;
+        st += t;
+        snn += n*n;
+        snt += n*t;
+      }
+      const double det = nsizes*snn - sn*sn;
+      if (nsizes > 1 && det > 0) {
+        b = (nsizes*snt - sn*st) / det;
+        a = (st - b*sn) / nsizes;
+      } else {
+        a = 0;
+        b = st / sn;
+      }
+      printf(", \"%s_overhead\": %.6e, \"%s_per_dof\": %.6e", compnames[c], a,
+             compnames[c], b);
+    }
+    printf("}\n");
+  }
+  CeedDestroy(&ceed);
+  return 0;
+}
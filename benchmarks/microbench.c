@@ -0,0 +1,366 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+//                         libCEED Kernel Microbenchmarks
+//
+// This program times the individual kernels that make up an operator
+// application in isolation: CeedElemRestrictionApply, CeedBasisApply and,
+// for backends that use one, the CeedTensorContract underlying the basis
+// action. The polynomial order, number of quadrature points, dimension, number
+// of components and number of elements are swept, and each measurement is
+// written as one JSON object per line so that the results can be read by
+// postprocess-table.py and postprocess_base.py.
+//
+// Build with:
+//
+//     make microbench
+//
+// Sample runs:
+//
+//     build/microbench
+//     build/microbench -ceed /cpu/self/opt/blocked -d 3 -p 8
+//     build/microbench -ceed /gpu/cuda -n 3 -s 1000000 > microbench.json
+//
+// Options:
+//
+//     -ceed <resource>  libCEED resource to benchmark
+//     -d <dim>          only run dimension <dim> (default: 1, 2 and 3)
+//     -n <ncomp>        only run <ncomp> components (default: 1 and 3)
+//     -p <pmax>         largest number of 1D nodes P (default: 8)
+//     -s <size>         largest number of element nodes per component;
+//                       element counts are swept in powers of 8 up to it
+//                       (default: 2^20)
+//     -e <nelem>        only run <nelem> elements
+//     -t <seconds>      minimum time per measurement (default: 0.05)
+//     -b <batch>        elements per basis call on host backends, matching
+//                       the operator block size (default: 8)
+
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Benchmark configuration
+typedef struct {
+  const char *resource;
+  CeedInt dim, P, Q, ncomp, nelem, batch;
+  double mintime;
+} BenchContext;
+
+// Wall clock time in seconds
+static double Wtime(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9*ts.tv_nsec;
+}
+
+// Force completion of any outstanding device work on a vector; host kernels
+//   pass NULL
+static void Sync(CeedVector v) {
+  CeedScalar norm;
+  if (v) CeedVectorNorm(v, CEED_NORM_1, &norm);
+}
+
+// Write one measurement as a JSON object on a single line
+static void Report(const BenchContext *ctx, const char *kernel,
+                   CeedTransposeMode tmode, CeedInt reps, double time,
+                   double dofs, double bytes, double flops) {
+  const double t = time / reps;
+  printf("{\"code\": \"libCEED\", \"test\": \"microbench\", "
+         "\"kernel\": \"%s\", \"backend\": \"%s\", "
+         "\"tmode\": \"%s\", \"dim\": %d, \"degree\": %d, "
+         "\"quadrature_pts\": %d, \"ncomp\": %d, \"num_elem\": %d, "
+         "\"num_unknowns\": %.0f, \"reps\": %d, \"time\": %.6e, "
+         "\"dofs_per_sec\": %.6e, \"bytes_per_sec\": %.6e, "
+         "\"flops_per_sec\": %.6e}\n",
+         kernel, ctx->resource,
+         tmode == CEED_NOTRANSPOSE ? "notranspose" : "transpose",
+         ctx->dim, ctx->P - 1, ctx->Q, ctx->ncomp, ctx->nelem,
+         dofs, reps, t, dofs/t, bytes/t, flops/t);
+  fflush(stdout);
+}
+
+// Time a batch of applications, doubling the batch until it runs for at
+// least mintime; the kernel is given by the KERNEL statement
+#define TIME_KERNEL(ctx, v, reps, time, KERNEL)                   \
+  do {                                                            \
+    KERNEL; Sync(v);                                              \
+    for (reps = 1; ; reps *= 2) {                                 \
+      const double start = Wtime();                               \
+      for (CeedInt rep=0; rep<reps; rep++) { KERNEL; }            \
+      Sync(v);                                                    \
+      time = Wtime() - start;                                     \
+      if (time >= (ctx)->mintime) break;                          \
+    }                                                             \
+  } while (0)
+
+// Flops for a tensor product interpolation from P^dim to Q^dim nodes
+static double InterpFlops(CeedInt dim, CeedInt P, CeedInt Q) {
+  double flops = 0;
+  for (CeedInt d=0; d<dim; d++)
+    flops += 2 * pow(P, dim-d) * pow(Q, d+1);
+  return flops;
+}
+
+// Benchmark restriction from an L-vector on a structured box mesh
+static int BenchRestriction(Ceed ceed, const BenchContext *ctx) {
+  const CeedInt dim = ctx->dim, P = ctx->P, ncomp = ctx->ncomp;
+  CeedInt nxe[3] = {1, 1, 1}, nxn[3] = {1, 1, 1}, nelem = 1, elemsize = 1,
+          nnodes = 1;
+  CeedInt *offsets, reps;
+  CeedElemRestriction r;
+  CeedVector l, e;
+  double time;
+
+  // Near cubic arrangement of the elements
+  for (CeedInt i=0, rem=ctx->nelem; i<dim; i++) {
+    nxe[i] = pow(rem, 1./(dim-i)) + 0.5;
+    if (nxe[i] < 1) nxe[i] = 1;
+    rem /= nxe[i];
+    nelem *= nxe[i];
+    nxn[i] = nxe[i]*(P-1) + 1;
+    nnodes *= nxn[i];
+    elemsize *= P;
+  }
+
+  offsets = malloc(nelem*elemsize*sizeof(offsets[0]));
+  for (CeedInt el=0; el<nelem; el++) {
+    CeedInt exyz[3] = {el % nxe[0], (el / nxe[0]) % nxe[1],
+                       el / (nxe[0]*nxe[1])
+                      };
+    for (CeedInt n=0; n<elemsize; n++) {
+      CeedInt idx = 0, stride = 1, rem = n;
+      for (CeedInt d=0; d<dim; d++) {
+        idx += (exyz[d]*(P-1) + rem % P) * stride;
+        stride *= nxn[d];
+        rem /= P;
+      }
+      offsets[el*elemsize + n] = idx;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, nelem, elemsize, ncomp, nnodes,
+                            ncomp*nnodes, CEED_MEM_HOST, CEED_COPY_VALUES,
+                            offsets, &r);
+  free(offsets);
+  CeedElemRestrictionCreateVector(r, &l, &e);
+  CeedVectorSetValue(l, 1.0);
+  CeedVectorSetValue(e, 1.0);
+
+  // Each E-vector entry is read or written once along with one offset, and
+  //   the matching L-vector entry is accessed once
+  const BenchContext rctx = {.resource = ctx->resource, .dim = dim, .P = P,
+                             .Q = ctx->Q, .ncomp = ncomp, .nelem = nelem,
+                             .batch = ctx->batch, .mintime = ctx->mintime
+                            };
+  const double edofs = (double)nelem*elemsize*ncomp;
+  const double bytes = edofs*2*sizeof(CeedScalar) +
+                       (double)nelem*elemsize*sizeof(CeedInt);
+
+  TIME_KERNEL(ctx, e, reps, time,
+              CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, l, e,
+                                       CEED_REQUEST_IMMEDIATE));
+  Report(&rctx, "restriction", CEED_NOTRANSPOSE, reps, time,
+         (double)nnodes*ncomp, bytes, 0);
+
+  TIME_KERNEL(ctx, l, reps, time,
+              CeedElemRestrictionApply(r, CEED_TRANSPOSE, e, l,
+                                       CEED_REQUEST_IMMEDIATE));
+  Report(&rctx, "restriction", CEED_TRANSPOSE, reps, time,
+         (double)nnodes*ncomp, bytes, edofs);
+
+  CeedVectorDestroy(&l);
+  CeedVectorDestroy(&e);
+  CeedElemRestrictionDestroy(&r);
+  return 0;
+}
+
+// Benchmark basis actions, and the underlying tensor contraction if any
+static int BenchBasis(Ceed ceed, const BenchContext *ctx) {
+  const CeedInt dim = ctx->dim, P = ctx->P, Q = ctx->Q, ncomp = ctx->ncomp,
+                nelem = ctx->nelem;
+  const CeedInt Pdim = pow(P, dim), Qdim = pow(Q, dim);
+  CeedInt reps, batch = nelem, nbatch;
+  CeedMemType mtype;
+  CeedBasis basis;
+  CeedTensorContract contract;
+  CeedVector *u, *v, *w;
+  double time;
+
+  // Host backends apply the basis to one block of elements at a time, as in
+  //   an operator application, and size their work arrays accordingly
+  CeedGetPreferredMemType(ceed, &mtype);
+  if (mtype == CEED_MEM_HOST && ctx->batch < nelem) batch = ctx->batch;
+  nbatch = (nelem + batch - 1) / batch;
+
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, ncomp, P, Q, CEED_GAUSS, &basis);
+  u = malloc(3*nbatch*sizeof(u[0]));
+  v = u + nbatch;
+  w = v + nbatch;
+  for (CeedInt b=0; b<nbatch; b++) {
+    const CeedInt ne = b < nbatch-1 ? batch : nelem - b*batch;
+    CeedVectorCreate(ceed, ne*ncomp*Pdim, &u[b]);
+    CeedVectorCreate(ceed, ne*ncomp*Qdim*dim, &v[b]);
+    CeedVectorCreate(ceed, ne*Qdim, &w[b]);
+    CeedVectorSetValue(u[b], 1.0);
+    CeedVectorSetValue(v[b], 1.0);
+  }
+
+  const double udofs = (double)nelem*ncomp*Pdim, vdofs = (double)nelem*ncomp*Qdim;
+  const double interp = nelem*ncomp*InterpFlops(dim, P, Q),
+               interpt = nelem*ncomp*InterpFlops(dim, Q, P);
+  const double sz = sizeof(CeedScalar);
+
+#define BASIS_BATCHES(tmode, emode, in, out)                      \
+  for (CeedInt b=0; b<nbatch; b++)                                \
+    CeedBasisApply(basis, b < nbatch-1 ? batch : nelem - b*batch, \
+                   tmode, emode, in, out[b])
+
+  TIME_KERNEL(ctx, v[nbatch-1], reps, time,
+              BASIS_BATCHES(CEED_NOTRANSPOSE, CEED_EVAL_INTERP, u[b], v));
+  Report(ctx, "basis-interp", CEED_NOTRANSPOSE, reps, time, udofs,
+         (udofs + vdofs)*sz, interp);
+
+  TIME_KERNEL(ctx, u[nbatch-1], reps, time,
+              BASIS_BATCHES(CEED_TRANSPOSE, CEED_EVAL_INTERP, v[b], u));
+  Report(ctx, "basis-interp", CEED_TRANSPOSE, reps, time, udofs,
+         (udofs + vdofs)*sz, interpt);
+
+  TIME_KERNEL(ctx, v[nbatch-1], reps, time,
+              BASIS_BATCHES(CEED_NOTRANSPOSE, CEED_EVAL_GRAD, u[b], v));
+  Report(ctx, "basis-grad", CEED_NOTRANSPOSE, reps, time, udofs,
+         (udofs + dim*vdofs)*sz, dim*interp);
+
+  TIME_KERNEL(ctx, u[nbatch-1], reps, time,
+              BASIS_BATCHES(CEED_TRANSPOSE, CEED_EVAL_GRAD, v[b], u));
+  Report(ctx, "basis-grad", CEED_TRANSPOSE, reps, time, udofs,
+         (udofs + dim*vdofs)*sz, dim*interpt);
+
+  TIME_KERNEL(ctx, w[nbatch-1], reps, time,
+              BASIS_BATCHES(CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT,
+                            CEED_VECTOR_NONE, w));
+  Report(ctx, "basis-weight", CEED_NOTRANSPOSE, reps, time, (double)nelem*Qdim,
+         (double)nelem*Qdim*sz, (double)nelem*Qdim*(dim-1));
+#undef BASIS_BATCHES
+
+  // Single contraction in the first direction, as applied in the basis action,
+  //   over all elements at once
+  CeedBasisGetTensorContract(basis, &contract);
+  if (contract) {
+    const CeedScalar *interp1d;
+    const CeedInt A = nelem*ncomp, C = Pdim/P;
+    const double flops = 2.*A*P*C*Q;
+    CeedScalar *hu, *hv;
+
+    CeedBasisGetInterp1D(basis, &interp1d);
+    hu = calloc((size_t)A*P*C, sizeof(hu[0]));
+    hv = calloc((size_t)A*Q*C, sizeof(hv[0]));
+    TIME_KERNEL(ctx, NULL, reps, time,
+                CeedTensorContractApply(contract, A, P, C, Q, interp1d,
+                                        CEED_NOTRANSPOSE, 0, hu, hv));
+    Report(ctx, "tensor-contract", CEED_NOTRANSPOSE, reps, time, udofs,
+           (double)A*(P+Q)*C*sz, flops);
+
+    TIME_KERNEL(ctx, NULL, reps, time,
+                CeedTensorContractApply(contract, A, Q, C, P, interp1d,
+                                        CEED_TRANSPOSE, 0, hv, hu));
+    Report(ctx, "tensor-contract", CEED_TRANSPOSE, reps, time, udofs,
+           (double)A*(P+Q)*C*sz, flops);
+    free(hu);
+    free(hv);
+  }
+
+  for (CeedInt b=0; b<nbatch; b++) {
+    CeedVectorDestroy(&u[b]);
+    CeedVectorDestroy(&v[b]);
+    CeedVectorDestroy(&w[b]);
+  }
+  free(u);
+  CeedBasisDestroy(&basis);
+  return 0;
+}
+
+int main(int argc, const char *argv[]) {
+  const char *ceed_spec = "/cpu/self";
+  CeedInt dim = 0, ncomp = 0, pmax = 8, size = 1 << 20;
+  CeedInt batch = 8, nelemfixed = 0;
+  double mintime = 0.05;
+
+  // Parse command line options
+  for (int ia=1; ia<argc; ia++) {
+    int next_arg = ((ia+1) < argc), parse_error = 0;
+    if (!strcmp(argv[ia],"-h")) {
+      parse_error = 1;
+    } else if (!strcmp(argv[ia],"-c") || !strcmp(argv[ia],"-ceed")) {
+      parse_error = next_arg ? ceed_spec = argv[++ia], 0 : 1;
+    } else if (!strcmp(argv[ia],"-d")) {
+      parse_error = next_arg ? dim = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-n")) {
+      parse_error = next_arg ? ncomp = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-p")) {
+      parse_error = next_arg ? pmax = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-s")) {
+      parse_error = next_arg ? size = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-e")) {
+      parse_error = next_arg ? nelemfixed = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-b")) {
+      parse_error = next_arg ? batch = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-t")) {
+      parse_error = next_arg ? mintime = atof(argv[++ia]), 0 : 1;
+    } else {
+      parse_error = 1;
+    }
+    if (parse_error) {
+      // LCOV_EXCL_START
+      fprintf(stderr, "Usage: %s [-ceed <resource>] [-d <dim>] [-n <ncomp>] "
+              "[-p <pmax>] [-s <size>] [-e <nelem>] [-t <seconds>] "
+              "[-b <batch>]\n", argv[0]);
+      return 1;
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  Ceed ceed;
+  CeedInit(ceed_spec, &ceed);
+  const char *resource;
+  CeedGetResource(ceed, &resource);
+
+  const CeedInt ncomps[2] = {1, 3};
+  for (CeedInt d=(dim ? dim : 1); d<=(dim ? dim : 3); d++)
+    for (CeedInt c=0; c<2; c++) {
+      if (ncomp && c) break;
+      for (CeedInt P=2; P<=pmax; P++)
+        for (CeedInt Q=P; Q<=P+1; Q++)
+          for (CeedInt nelem=(nelemfixed ? nelemfixed : 1);
+               nelemfixed ? nelem==nelemfixed : nelem*pow(P, d)<=size;
+               nelem*=8) {
+            BenchContext ctx = {.resource = resource, .dim = d, .P = P,
+                                .Q = Q, .ncomp = ncomp ? ncomp : ncomps[c],
+                                .nelem = nelem, .batch = batch,
+                                .mintime = mintime
+                               };
+            // The restriction does not depend on Q
+            if (Q == P) BenchRestriction(ceed, &ctx);
+            BenchBasis(ceed, &ctx);
+          }
+    }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
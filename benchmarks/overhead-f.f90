@@ -0,0 +1,138 @@
+!-----------------------------------------------------------------------
+!
+! libCEED Per-Apply Overhead Benchmark, Fortran interface
+!
+! Times ceedoperatorapply for the 1D mass operator of overhead.c on 1 to
+! 64 elements, writing one JSON record per line.
+!
+! Build with:
+!
+!     make overhead
+!
+! Usage:
+!
+!     build/overhead-f [resource] [max elements] [min seconds]
+!
+!-----------------------------------------------------------------------
+      program overhead
+
+      include 'ceedf.h'
+
+      integer ceed,err,i,e,n,nmax,calls
+      integer stridesq(3)
+      integer r,rq,b
+      integer qf_setup,qf_mass
+      integer op_setup,op_mass
+      integer x,qdata,u,v
+      integer p,q
+      parameter(p=2)
+      parameter(q=2)
+      integer,allocatable :: indx(:)
+      real*8,allocatable :: arrx(:)
+      integer*8 xoffset,count0,count1,rate
+      real*8 mintime,elapsed
+
+      character arg*64,resource*64
+
+      resource='/cpu/self'
+      nmax=64
+      mintime=0.05d0
+      if (iargc().ge.1) call getarg(1,resource)
+      if (iargc().ge.2) then
+        call getarg(2,arg)
+        read(arg,*) nmax
+      endif
+      if (iargc().ge.3) then
+        call getarg(3,arg)
+        read(arg,*) mintime
+      endif
+
+      call ceedinit(trim(resource)//char(0),ceed,err)
+      call ceedqfunctioncreateinteriorbyname(ceed,'Mass1DBuild',qf_setup,&
+     & err)
+      call ceedqfunctioncreateinteriorbyname(ceed,'MassApply',qf_mass,err)
+      call system_clock(count_rate=rate)
+
+      n=1
+      do while (n.le.nmax)
+        allocate(indx(2*n),arrx(n+1))
+        do e=0,n-1
+          indx(2*e+1)=e
+          indx(2*e+2)=e+1
+        enddo
+        do i=0,n
+          arrx(i+1)=i/dble(n)
+        enddo
+        call ceedelemrestrictioncreate(ceed,n,p,1,1,n+1,ceed_mem_host,&
+     &   ceed_copy_values,indx,r,err)
+        stridesq=[1,q,q]
+        call ceedelemrestrictioncreatestrided(ceed,n,q,1,n*q,stridesq,rq,&
+     &   err)
+        call ceedbasiscreatetensorh1lagrange(ceed,1,1,p,q,ceed_gauss,b,err)
+
+        call ceedvectorcreate(ceed,n+1,x,err)
+        xoffset=0
+        call ceedvectorsetarray(x,ceed_mem_host,ceed_copy_values,arrx,&
+     &   xoffset,err)
+        call ceedvectorcreate(ceed,n*q,qdata,err)
+        call ceedvectorcreate(ceed,n+1,u,err)
+        call ceedvectorcreate(ceed,n+1,v,err)
+        call ceedvectorsetvalue(u,1.d0,err)
+
+        call ceedoperatorcreate(ceed,qf_setup,ceed_qfunction_none,&
+     &   ceed_qfunction_none,op_setup,err)
+        call ceedoperatorsetfield(op_setup,'dx',r,b,ceed_vector_active,err)
+        call ceedoperatorsetfield(op_setup,'weights',&
+     &   ceed_elemrestriction_none,b,ceed_vector_none,err)
+        call ceedoperatorsetfield(op_setup,'qdata',rq,&
+     &   ceed_basis_collocated,ceed_vector_active,err)
+        call ceedoperatorapply(op_setup,x,qdata,ceed_request_immediate,err)
+
+        call ceedoperatorcreate(ceed,qf_mass,ceed_qfunction_none,&
+     &   ceed_qfunction_none,op_mass,err)
+        call ceedoperatorsetfield(op_mass,'u',r,b,ceed_vector_active,err)
+        call ceedoperatorsetfield(op_mass,'qdata',rq,&
+     &   ceed_basis_collocated,qdata,err)
+        call ceedoperatorsetfield(op_mass,'v',r,b,ceed_vector_active,err)
+
+! The first application includes the backend setup of the operator
+        call ceedoperatorapply(op_mass,u,v,ceed_request_immediate,err)
+
+! Double the number of calls until the measurement is long enough
+        calls=1
+        do
+          call system_clock(count0)
+          do i=1,calls
+            call ceedoperatorapply(op_mass,u,v,ceed_request_immediate,err)
+          enddo
+          call system_clock(count1)
+          elapsed=dble(count1-count0)/dble(rate)
+          if (elapsed.ge.mintime) exit
+          calls=2*calls
+        enddo
+
+        write(*,'(a,a,a,i0,a,i0,a,es12.6,a)') &
+     &   '{"code": "libCEED", "test": "overhead", '//&
+     &   '"interface": "fortran", "backend": "',trim(resource),&
+     &   '", "num_elem": ',n,', "calls": ',calls,', "time": ',&
+     &   elapsed/calls,'}'
+
+        call ceedvectordestroy(x,err)
+        call ceedvectordestroy(qdata,err)
+        call ceedvectordestroy(u,err)
+        call ceedvectordestroy(v,err)
+        call ceedoperatordestroy(op_setup,err)
+        call ceedoperatordestroy(op_mass,err)
+        call ceedelemrestrictiondestroy(r,err)
+        call ceedelemrestrictiondestroy(rq,err)
+        call ceedbasisdestroy(b,err)
+        deallocate(indx,arrx)
+        n=2*n
+      enddo
+
+      call ceedqfunctiondestroy(qf_setup,err)
+      call ceedqfunctiondestroy(qf_mass,err)
+      call ceeddestroy(ceed,err)
+
+      end
+!-----------------------------------------------------------------------
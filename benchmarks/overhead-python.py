@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+# the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+# reserved. See files LICENSE and NOTICE for details.
+#
+# This file is part of CEED, a collection of benchmarks, miniapps, software
+# libraries and APIs for efficient high-order finite element and spectral
+# element discretizations for exascale applications. For more information and
+# source code availability see http://github.com/ceed.
+#
+# The CEED research is supported by the Exascale Computing Project (17-SC-20-SC)
+# a collaborative effort of two U.S. Department of Energy organizations (Office
+# of Science and the National Nuclear Security Administration) responsible for
+# the planning and preparation of a capable exascale ecosystem, including
+# software, applications, hardware, advanced system engineering and early
+# testbed platforms, in support of the nation's exascale computing imperative.
+
+# Per-apply overhead benchmark, Python interface
+#
+# Times Operator.apply for the 1D mass operator of overhead.c on 1 to 64
+# elements, writing one JSON record per line. Requires the libceed Python
+# package, see python/README.md.
+
+import json
+import time
+import numpy as np
+import libceed
+
+
+def bench_overhead(ceed, nelem, mintime):
+    """Time the application of the mass operator on nelem linear elements"""
+    p, q, nnodes = 2, 2, nelem + 1
+
+    offsets = np.zeros(2 * nelem, dtype="int32")
+    offsets[0::2] = np.arange(nelem)
+    offsets[1::2] = np.arange(1, nelem + 1)
+    r = ceed.ElemRestriction(nelem, p, 1, 1, nnodes, offsets)
+    strides = np.array([1, q, q], dtype="int32")
+    rq = ceed.StridedElemRestriction(nelem, q, 1, nelem * q, strides)
+    b = ceed.BasisTensorH1Lagrange(1, 1, p, q, libceed.GAUSS)
+    qf_setup = ceed.QFunctionByName("Mass1DBuild")
+    qf_mass = ceed.QFunctionByName("MassApply")
+
+    x = ceed.Vector(nnodes)
+    x.set_array(np.arange(nnodes) / nelem)
+    qdata = ceed.Vector(nelem * q)
+    u = ceed.Vector(nnodes)
+    v = ceed.Vector(nnodes)
+    u.set_value(1.0)
+
+    op_setup = ceed.Operator(qf_setup)
+    op_setup.set_field("dx", r, b, libceed.VECTOR_ACTIVE)
+    op_setup.set_field("weights", libceed.ELEMRESTRICTION_NONE, b,
+                       libceed.VECTOR_NONE)
+    op_setup.set_field("qdata", rq, libceed.BASIS_COLLOCATED,
+                       libceed.VECTOR_ACTIVE)
+    op_setup.apply(x, qdata)
+
+    op_mass = ceed.Operator(qf_mass)
+    op_mass.set_field("u", r, b, libceed.VECTOR_ACTIVE)
+    op_mass.set_field("qdata", rq, libceed.BASIS_COLLOCATED, qdata)
+    op_mass.set_field("v", r, b, libceed.VECTOR_ACTIVE)
+
+    # The first application includes the backend setup of the operator
+    op_mass.apply(u, v)
+
+    # Double the number of calls until the measurement is long enough
+    calls = 1
+    while True:
+        start = time.perf_counter()
+        for i in range(calls):
+            op_mass.apply(u, v)
+        elapsed = time.perf_counter() - start
+        if elapsed >= mintime:
+            break
+        calls *= 2
+
+    print(json.dumps({'code': 'libCEED', 'test': 'overhead',
+                      'interface': 'python',
+                      'backend': ceed.get_resource(), 'num_elem': nelem,
+                      'calls': calls, 'time': elapsed / calls}), flush=True)
+
+
+if __name__ == '__main__':
+    import argparse
+    parser = argparse.ArgumentParser('libCEED per-apply overhead, Python')
+    parser.add_argument('-ceed', default='/cpu/self',
+                        help='libCEED resource to benchmark')
+    parser.add_argument('-e', type=int, default=64,
+                        help='Largest number of elements, swept in powers of 2')
+    parser.add_argument('-t', type=float, default=0.05,
+                        help='Minimum time per measurement (s)')
+    args = parser.parse_args()
+
+    ceed = libceed.Ceed(args.ceed)
+    nelem = 1
+    while nelem <= args.e:
+        bench_overhead(ceed, nelem, args.t)
+        nelem *= 2
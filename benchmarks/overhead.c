@@ -0,0 +1,176 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+//                      libCEED Per-Apply Overhead Benchmark
+//
+// This program times CeedOperatorApply for a 1D mass operator with linear
+// elements on tiny meshes of 1 to 64 elements, where the cost of a call is
+// dominated by the fixed overhead rather than by the element kernels. The
+// same operator is timed through the Fortran, Python and Rust interfaces by
+// overhead-f.f90, overhead-python.py and rust/examples/overhead.rs, and
+// overhead.py fits the fixed cost per call for each interface from the JSON
+// records, one per line, written by these drivers.
+//
+// Build with:
+//
+//     make overhead
+//
+// Sample runs:
+//
+//     build/overhead
+//     build/overhead -ceed /cpu/self/opt/blocked -e 16 -t 0.5
+//
+// Options:
+//
+//     -ceed <resource>  libCEED resource to benchmark
+//     -e <nelem>        largest number of elements, swept in powers of 2
+//                       (default: 64)
+//     -t <seconds>      minimum time per measurement (default: 0.05)
+
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Wall clock time in seconds
+static double Wtime(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9*ts.tv_nsec;
+}
+
+// Time the application of the mass operator on nelem linear elements
+static int BenchOverhead(Ceed ceed, CeedInt nelem, double mintime) {
+  const CeedInt P = 2, Q = 2, nnodes = nelem + 1;
+  CeedInt *offsets = malloc(2*nelem*sizeof(offsets[0]));
+  CeedInt strides[3] = {1, Q, Q};
+  CeedScalar *x;
+  CeedElemRestriction r, rq;
+  CeedBasis b;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass;
+  CeedVector X, qdata, U, V;
+  CeedInt calls;
+  double start, elapsed;
+
+  for (CeedInt e=0; e<nelem; e++) {
+    offsets[2*e] = e;
+    offsets[2*e+1] = e + 1;
+  }
+  CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, nnodes, CEED_MEM_HOST,
+                            CEED_USE_POINTER, offsets, &r);
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, nelem*Q, strides, &rq);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &b);
+  CeedQFunctionCreateInteriorByName(ceed, "Mass1DBuild", &qf_setup);
+  CeedQFunctionCreateInteriorByName(ceed, "MassApply", &qf_mass);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "dx", r, b, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, b,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "qdata", rq, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedVectorCreate(ceed, nnodes, &X);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+  CeedVectorCreate(ceed, nnodes, &U);
+  CeedVectorCreate(ceed, nnodes, &V);
+  CeedVectorGetArray(X, CEED_MEM_HOST, &x);
+  for (CeedInt i=0; i<nnodes; i++)
+    x[i] = (CeedScalar)i / nelem;
+  CeedVectorRestoreArray(X, &x);
+  CeedVectorSetValue(U, 1.0);
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+  CeedOperatorSetField(op_mass, "u", r, b, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "qdata", rq, CEED_BASIS_COLLOCATED, qdata);
+  CeedOperatorSetField(op_mass, "v", r, b, CEED_VECTOR_ACTIVE);
+
+  // The first application includes the backend setup of the operator
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+
+  // Double the number of calls until the measurement is long enough
+  for (calls=1; ; calls*=2) {
+    start = Wtime();
+    for (CeedInt i=0; i<calls; i++)
+      CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+    elapsed = Wtime() - start;
+    if (elapsed >= mintime) break;
+  }
+
+  const char *resource;
+  CeedGetResource(ceed, &resource);
+  printf("{\"code\": \"libCEED\", \"test\": \"overhead\", "
+         "\"interface\": \"c\", \"backend\": \"%s\", \"num_elem\": %d, "
+         "\"calls\": %d, \"time\": %.6e}\n", resource, nelem, calls,
+         elapsed / calls);
+  fflush(stdout);
+
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&qdata);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedElemRestrictionDestroy(&r);
+  CeedElemRestrictionDestroy(&rq);
+  CeedBasisDestroy(&b);
+  free(offsets);
+  return 0;
+}
+
+int main(int argc, const char *argv[]) {
+  const char *ceed_spec = "/cpu/self";
+  CeedInt nelem = 64;
+  double mintime = 0.05;
+
+  // Parse command line options
+  for (int ia=1; ia<argc; ia++) {
+    int next_arg = ((ia+1) < argc), parse_error = 0;
+    if (!strcmp(argv[ia],"-h")) {
+      parse_error = 1;
+    } else if (!strcmp(argv[ia],"-c") || !strcmp(argv[ia],"-ceed")) {
+      parse_error = next_arg ? ceed_spec = argv[++ia], 0 : 1;
+    } else if (!strcmp(argv[ia],"-e")) {
+      parse_error = next_arg ? nelem = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-t")) {
+      parse_error = next_arg ? mintime = atof(argv[++ia]), 0 : 1;
+    } else {
+      parse_error = 1;
+    }
+    if (parse_error || nelem < 1 || mintime <= 0) {
+      // LCOV_EXCL_START
+      fprintf(stderr, "Usage: %s [-ceed <resource>] [-e <nelem>] "
+              "[-t <seconds>]\n", argv[0]);
+      return 1;
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  Ceed ceed;
+  CeedInit(ceed_spec, &ceed);
+  for (CeedInt n=1; n<=nelem; n*=2)
+    BenchOverhead(ceed, n, mintime);
+  CeedDestroy(&ceed);
+  return 0;
+}
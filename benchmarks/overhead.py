@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+# the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+# reserved. See files LICENSE and NOTICE for details.
+#
+# This file is part of CEED, a collection of benchmarks, miniapps, software
+# libraries and APIs for efficient high-order finite element and spectral
+# element discretizations for exascale applications. For more information and
+# source code availability see http://github.com/ceed.
+#
+# The CEED research is supported by the Exascale Computing Project (17-SC-20-SC)
+# a collaborative effort of two U.S. Department of Energy organizations (Office
+# of Science and the National Nuclear Security Administration) responsible for
+# the planning and preparation of a capable exascale ecosystem, including
+# software, applications, hardware, advanced system engineering and early
+# testbed platforms, in support of the nation's exascale computing imperative.
+
+# Per-apply overhead of the language interfaces
+#
+# Runs the overhead drivers for C, Fortran, Python and Rust on each backend,
+# skipping interfaces that are not available, and fits the time per call as
+#   time = overhead + per_elem * num_elem
+# The fixed overhead of each interface is reported, together with the
+# difference from the C interface, which is the cost of the binding layer.
+
+import json
+import os
+import shutil
+import subprocess
+import sys
+
+INTERFACES = ['c', 'fortran', 'python', 'rust']
+
+
+def command(interface, builddir, backend, nelem, mintime):
+    """Command line running the driver for an interface, or None if the
+    driver is not available"""
+    here = os.path.dirname(os.path.abspath(__file__))
+    if interface == 'c':
+        exe = os.path.join(builddir, 'overhead')
+        return [exe, '-ceed', backend, '-e', str(nelem), '-t', str(mintime)] \
+            if os.path.isfile(exe) else None
+    if interface == 'fortran':
+        exe = os.path.join(builddir, 'overhead-f')
+        return [exe, backend, str(nelem), str(mintime)] \
+            if os.path.isfile(exe) else None
+    if interface == 'python':
+        probe = subprocess.run([sys.executable, '-c', 'import libceed'],
+                               stdout=subprocess.DEVNULL,
+                               stderr=subprocess.DEVNULL)
+        return [sys.executable, os.path.join(here, 'overhead-python.py'),
+                '-ceed', backend, '-e', str(nelem), '-t', str(mintime)] \
+            if probe.returncode == 0 else None
+    if interface == 'rust':
+        manifest = os.path.join(here, '..', 'rust', 'Cargo.toml')
+        return ['cargo', 'run', '--quiet', '--release', '--example',
+                'overhead', '--manifest-path', manifest, '--', backend,
+                str(nelem), str(mintime)] \
+            if shutil.which('cargo') else None
+    raise ValueError('Unknown interface ' + interface)
+
+
+def fit(records):
+    """Least squares fit of time = overhead + per_elem * num_elem"""
+    n = len(records)
+    sx = sum(r['num_elem'] for r in records)
+    sy = sum(r['time'] for r in records)
+    sxx = sum(r['num_elem']**2 for r in records)
+    sxy = sum(r['num_elem'] * r['time'] for r in records)
+    det = n * sxx - sx * sx
+    if det == 0:
+        return sy / n, 0.0
+    per_elem = (n * sxy - sx * sy) / det
+    return (sy - per_elem * sx) / n, per_elem
+
+
+if __name__ == '__main__':
+    import argparse
+    parser = argparse.ArgumentParser('Per-apply overhead of the language interfaces')
+    parser.add_argument('-c', '--ceed', help='Backends to benchmark',
+                        default=os.environ.get('BACKENDS', '/cpu/self'))
+    parser.add_argument('-i', '--interfaces', help='Interfaces to benchmark',
+                        default=','.join(INTERFACES))
+    parser.add_argument('-e', '--nelem', help='Largest number of elements',
+                        type=int, default=64)
+    parser.add_argument('-t', '--mintime', help='Minimum time per measurement (s)',
+                        type=float, default=0.05)
+    parser.add_argument('--builddir', help='Directory with the C and Fortran drivers',
+                        default='build')
+    parser.add_argument('-o', '--output', help='JSON file for the records and fits')
+    args = parser.parse_args()
+
+    records, fits, status = [], [], 0
+    for backend in args.ceed.split():
+        for interface in args.interfaces.split(','):
+            cmd = command(interface, args.builddir, backend, args.nelem,
+                          args.mintime)
+            if cmd is None:
+                print('  {:>10} {} {}: driver not available'
+                      .format('SKIP', interface, backend), file=sys.stderr)
+                continue
+            proc = subprocess.run(cmd, stdout=subprocess.PIPE)
+            if proc.returncode != 0:
+                print('  {:>10} {}'.format('FAIL', ' '.join(cmd)),
+                      file=sys.stderr)
+                status = 1
+                continue
+            runs = [json.loads(line) for line in
+                    proc.stdout.decode('utf-8').splitlines()
+                    if line.startswith('{')]
+            if not runs:
+                continue
+            records += runs
+            overhead, per_elem = fit(runs)
+            fits.append({'interface': interface, 'backend': backend,
+                         'overhead': overhead, 'per_elem': per_elem})
+
+    print('{:<28} {:<8} {:>14} {:>14} {:>14}'.format(
+        'backend', 'iface', 'overhead (us)', 'vs C (us)', 'per elem (ns)'))
+    for f in fits:
+        c = [g for g in fits
+             if g['backend'] == f['backend'] and g['interface'] == 'c']
+        f['overhead_vs_c'] = f['overhead'] - c[0]['overhead'] if c else None
+        print('{:<28} {:<8} {:>14.3f} {:>14} {:>14.3f}'.format(
+            f['backend'], f['interface'], 1e6 * f['overhead'],
+            '{:.3f}'.format(1e6 * f['overhead_vs_c']) if c else '-',
+            1e9 * f['per_elem']))
+
+    if args.output:
+        with open(args.output, 'w') as fd:
+            json.dump({'records': records, 'fits': fits}, fd, indent=2)
+            fd.write('\n')
+    sys.exit(status)
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+# the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+# reserved. See files LICENSE and NOTICE for details.
+#
+# This file is part of CEED, a collection of benchmarks, miniapps, software
+# libraries and APIs for efficient high-order finite element and spectral
+# element discretizations for exascale applications. For more information and
+# source code availability see http://github.com/ceed.
+#
+# The CEED research is supported by the Exascale Computing Project (17-SC-20-SC)
+# a collaborative effort of two U.S. Department of Energy organizations (Office
+# of Science and the National Nuclear Security Administration) responsible for
+# the planning and preparation of a capable exascale ecosystem, including
+# software, applications, hardware, advanced system engineering and early
+# testbed platforms, in support of the nation's exascale computing imperative.
+
+# Performance regression tests
+#
+# Runs a fixed set of BP1-BP6 operators (bpbench) and restriction and basis
+# kernels (microbench) on each backend in $BACKENDS, compares the throughput of
+# each case with a stored baseline, and writes JUnit XML. A case fails when its
+# throughput is below the baseline by more than the tolerance.
+
+import json
+import os
+import subprocess
+import sys
+import time
+sys.path.insert(0, os.path.abspath(os.path.join(os.path.dirname(__file__),
+                                                '..', 'tests', 'junit-xml')))
+from junit_xml import TestCase, TestSuite
+
+# Fixed configurations, kept small so the suite runs in seconds per backend
+BPBENCH_ARGS = ['-s', '65536']
+MICROBENCH_ARGS = ['-d', '3', '-n', '1', '-p', '4', '-e', '512']
+
+
+def case_name(record):
+    """Name of a measurement, unique for each backend"""
+    if record['test'] == 'bpbench':
+        return '{} P{} Q{}'.format(record['kernel'], record['degree'] + 1,
+                                   record['quadrature_pts'])
+    return '{} {} P{} Q{} ncomp {}'.format(record['kernel'], record['tmode'],
+                                           record['degree'] + 1,
+                                           record['quadrature_pts'],
+                                           record['ncomp'])
+
+
+def run_benchmarks(builddir, backend, mintime, repeat):
+    """Run the benchmarks for a backend and return the records by case name,
+    keeping the fastest of repeated runs to filter out system noise"""
+    commands = [
+        [os.path.join(builddir, 'bpbench')] + BPBENCH_ARGS,
+        [os.path.join(builddir, 'microbench')] + MICROBENCH_ARGS,
+    ]
+    records, errors = {}, []
+    for command in commands * repeat:
+        command = command + ['-ceed', backend, '-t', str(mintime)]
+        proc = subprocess.run(command, stdout=subprocess.PIPE,
+                              stderr=subprocess.PIPE)
+        if proc.returncode != 0 or proc.stderr:
+            errors.append('{}: {}'.format(' '.join(command),
+                                          proc.stderr.decode('utf-8')))
+            continue
+        for line in proc.stdout.decode('utf-8').splitlines():
+            record = json.loads(line)
+            name = case_name(record)
+            if name not in records or \
+                    record['dofs_per_sec'] > records[name]['dofs_per_sec']:
+                records[name] = record
+    return records, errors
+
+
+def check(backend, records, errors, baseline, tolerance):
+    """Compare the records for a backend with the baseline"""
+    testcases, properties = [], {}
+    timestamp = time.strftime('%Y-%m-%d %H:%M:%S %Z', time.localtime())
+    for message in errors:
+        case = TestCase('run {}'.format(backend), classname=backend,
+                        timestamp=timestamp, stderr=message)
+        case.add_error_info('benchmark failed', message)
+        testcases.append(case)
+    for name, record in sorted(records.items()):
+        rate = record['dofs_per_sec']
+        case = TestCase(name, classname=backend, elapsed_sec=record['time'],
+                        timestamp=timestamp, stdout=json.dumps(record))
+        properties[name + ' time'] = '{:.6e}'.format(record['time'])
+        properties[name + ' dofs_per_sec'] = '{:.6e}'.format(rate)
+        reference = baseline.get(backend, {}).get(name)
+        if reference is None:
+            case.status = 'no baseline'
+        else:
+            ratio = rate / reference
+            properties[name + ' baseline'] = '{:.6e}'.format(reference)
+            properties[name + ' ratio'] = '{:.3f}'.format(ratio)
+            if ratio < 1 - tolerance:
+                case.add_failure_info(
+                    'throughput {:.3e} DoF/s is {:.1f}% below baseline {:.3e}'
+                    .format(rate, 100 * (1 - ratio), reference))
+            elif ratio > 1 + tolerance:
+                case.status = 'faster than baseline by {:.1f}%'.format(
+                    100 * (ratio - 1))
+        testcases.append(case)
+    return TestSuite('perftest {}'.format(backend), testcases,
+                     properties=properties)
+
+
+if __name__ == '__main__':
+    import argparse
+    parser = argparse.ArgumentParser('Performance regression tests with JUnit output')
+    parser.add_argument('--baseline', help='Baseline throughput file',
+                        default=os.environ.get('PERFTEST_BASELINE',
+                                               os.path.join(os.path.dirname(__file__),
+                                                            'perftest-baseline.json')))
+    parser.add_argument('--tolerance', help='Allowed relative slowdown',
+                        type=float,
+                        default=float(os.environ.get('PERFTEST_TOL', 0.2)))
+    parser.add_argument('--mintime', help='Minimum time per measurement (s)',
+                        type=float, default=0.02)
+    parser.add_argument('--repeat', help='Runs of each benchmark, the fastest is kept',
+                        type=int, default=3)
+    parser.add_argument('--builddir', help='Directory with the benchmarks',
+                        default='build')
+    parser.add_argument('--output', help='JUnit XML output file',
+                        default=os.path.join('build', 'perftest.junit'))
+    parser.add_argument('--update', help='Store the results as the baseline',
+                        action='store_true')
+    args = parser.parse_args()
+
+    baseline = {}
+    if os.path.isfile(args.baseline):
+        with open(args.baseline) as fd:
+            baseline = json.load(fd)
+
+    suites = []
+    for backend in os.environ['BACKENDS'].split():
+        records, errors = run_benchmarks(args.builddir, backend, args.mintime,
+                                         args.repeat)
+        if args.update and not errors:
+            baseline[backend] = {name: record['dofs_per_sec']
+                                 for name, record in records.items()}
+        suites.append(check(backend, records, errors, baseline,
+                            args.tolerance))
+        print('  {:>10} {}'.format('PERFTEST', backend))
+
+    if args.update:
+        with open(args.baseline, 'w') as fd:
+            json.dump(baseline, fd, indent=2, sort_keys=True)
+            fd.write('\n')
+    with open(args.output, 'w') as fd:
+        TestSuite.to_file(fd, suites)
+
+    failed = [c for s in suites for c in s.test_cases
+              if c.is_failure() or c.is_error()]
+    for case in failed:
+        print('  {:>10} {} {}: {}'.format('FAIL', case.classname, case.name,
+                                          case.failure_message or
+                                          case.error_message))
+    sys.exit(1 if failed else 0)
@@ -17,6 +17,7 @@
 
 import pandas as pd
 import fileinput
+import json
 import pprint
 
 # Read all input files specified on the command line, or stdin and parse
@@ -41,8 +42,14 @@ def read_logs(files=None):
 
     runs = []
     for line in fileinput.input(files):
+        # Microbenchmark records are self-contained JSON objects
+        if line.startswith('{'):
+            record = data_default.copy()
+            record['file'] = fileinput.filename()
+            record.update(json.loads(line))
+            runs.append(record)
         # Legacy header contains number of MPI tasks
-        if 'Running the tests using a total of' in line:
+        elif 'Running the tests using a total of' in line:
             data = data_default.copy()
             data['num_procs'] = int(
                 line.split(
@@ -99,7 +106,7 @@ def read_logs(files=None):
         elif 'DoF per node' in line:
             data['dof_per_node'] = int(line.split(':')[1])
         # CG Solve Time
-        elif 'Total KSP Iterations' in line:
+        elif 'Total KSP Iterations' in line or 'Total CG Iterations' in line:
             data['ksp_its'] = int(line.split(':')[1].split()[0])
         elif 'CG Solve Time' in line:
             data['time_per_it'] = float(
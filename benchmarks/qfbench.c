@@ -0,0 +1,298 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+//                      libCEED QFunction Throughput Benchmark
+//
+// This program times CeedQFunctionApply on synthetic inputs, independently of
+// element restriction and basis. The QFunction is either a gallery QFunction,
+// created by name, or a user QFunction given by its function and source path,
+// as in the examples; user QFunctions are benchmarked by including their
+// header and adding an entry to the table below. Random inputs of the field
+// sizes of the QFunction are created for a sweep of numbers of quadrature
+// points, and the throughput in points per second is written as one JSON
+// object per line, with the vector length of the QFunction.
+//
+// Build with:
+//
+//     make qfbench
+//
+// Sample runs:
+//
+//     build/qfbench
+//     build/qfbench -ceed /cpu/self/avx/blocked -q Poisson3DApply -q Diff
+//     build/qfbench -ceed /gpu/cuda/ref -q SetupDiffGeo -v 4 -n 1048576
+//
+// Options:
+//
+//     -ceed <resource>  libCEED resource to benchmark
+//     -q <name>         QFunction to benchmark, from the table below or the
+//                       gallery; may be repeated (default: all in the table
+//                       and the gallery QFunctions listed below)
+//     -n <npoints>      only run <npoints> quadrature points (default: 2^10
+//                       to 2^22 in powers of 4)
+//     -v <vlength>      vector length of the QFunctions from the table
+//                       (default: 1); gallery QFunctions use their own
+//     -t <seconds>      minimum time per measurement (default: 0.05)
+
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+// The right hand side QFunctions of these headers are not used here
+#pragma GCC diagnostic ignored "-Wunused-function"
+#include "../examples/petsc/qfunctions/bps/bp1.h"
+#include "../examples/petsc/qfunctions/bps/bp2.h"
+#include "../examples/petsc/qfunctions/bps/bp3.h"
+#include "../examples/petsc/qfunctions/bps/bp4.h"
+
+#define MAX_FIELDS 4
+
+// QFunction field
+typedef struct {
+  const char *name;
+  CeedInt size;
+  CeedEvalMode emode;
+} FieldData;
+
+// User QFunction, given by its function and source path
+typedef struct {
+  const char *name;
+  CeedQFunctionUser f;
+  const char *source;
+  FieldData in[MAX_FIELDS], out[MAX_FIELDS];
+} QFData;
+
+// User QFunctions: the geometric factors and operators of the BPs
+static const QFData qfdata[] = {
+  { "SetupMassGeo", SetupMassGeo, SetupMassGeo_loc,
+    {{"dx", 9, CEED_EVAL_GRAD}, {"weight", 1, CEED_EVAL_WEIGHT}},
+    {{"qdata", 1, CEED_EVAL_NONE}} },
+  { "Mass", Mass, Mass_loc,
+    {{"u", 1, CEED_EVAL_INTERP}, {"qdata", 1, CEED_EVAL_NONE}},
+    {{"v", 1, CEED_EVAL_INTERP}} },
+  { "Mass3", Mass3, Mass3_loc,
+    {{"u", 3, CEED_EVAL_INTERP}, {"qdata", 1, CEED_EVAL_NONE}},
+    {{"v", 3, CEED_EVAL_INTERP}} },
+  { "SetupDiffGeo", SetupDiffGeo, SetupDiffGeo_loc,
+    {{"dx", 9, CEED_EVAL_GRAD}, {"weight", 1, CEED_EVAL_WEIGHT}},
+    {{"qdata", 6, CEED_EVAL_NONE}} },
+  { "Diff", Diff, Diff_loc,
+    {{"u", 3, CEED_EVAL_GRAD}, {"qdata", 6, CEED_EVAL_NONE}},
+    {{"v", 3, CEED_EVAL_GRAD}} },
+  { "Diff3", Diff3, Diff3_loc,
+    {{"u", 9, CEED_EVAL_GRAD}, {"qdata", 6, CEED_EVAL_NONE}},
+    {{"v", 9, CEED_EVAL_GRAD}} },
+};
+static const CeedInt num_qfdata = sizeof(qfdata) / sizeof(qfdata[0]);
+
+// Gallery QFunctions benchmarked by default; those that need fields or a
+//   context set by the caller are omitted
+static const char *const gallerynames[] = {
+  "Mass1DBuild", "Mass2DBuild", "Mass3DBuild", "MassApply", "Poisson1DBuild",
+  "Poisson2DBuild", "Poisson3DBuild", "Poisson1DApply", "Poisson2DApply",
+  "Poisson3DApply", "Vector3Poisson3DApply", "Helmholtz3DBuild",
+  "Helmholtz3DApply"
+};
+static const CeedInt num_gallerynames = sizeof(gallerynames) /
+                                        sizeof(gallerynames[0]);
+
+// Wall clock time in seconds
+static double Wtime(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9*ts.tv_nsec;
+}
+
+// Complete any outstanding device work on a vector
+static void Sync(CeedVector V) {
+  CeedScalar norm;
+  CeedVectorNorm(V, CEED_NORM_1, &norm);
+}
+
+// Create a QFunction from the table or the gallery
+static int CreateQFunction(Ceed ceed, const char *name, CeedInt vlength,
+                           CeedQFunction *qf) {
+  for (CeedInt i=0; i<num_qfdata; i++) {
+    const QFData *data = &qfdata[i];
+    if (strcmp(name, data->name)) continue;
+    CeedQFunctionCreateInterior(ceed, vlength, data->f, data->source, qf);
+    for (CeedInt j=0; j<MAX_FIELDS && data->in[j].name; j++)
+      CeedQFunctionAddInput(*qf, data->in[j].name, data->in[j].size,
+                            data->in[j].emode);
+    for (CeedInt j=0; j<MAX_FIELDS && data->out[j].name; j++)
+      CeedQFunctionAddOutput(*qf, data->out[j].name, data->out[j].size,
+                             data->out[j].emode);
+    return 0;
+  }
+  return CeedQFunctionCreateInteriorByName(ceed, name, qf);
+}
+
+// Fill an input with random values; Jacobians "dx" are perturbations of the
+//   identity, so that geometric factors stay well defined
+static void SyntheticInput(CeedVector V, const char *name, CeedInt size,
+                           CeedInt npoints) {
+  CeedInt dim = 0;
+  CeedScalar *v;
+
+  if (!strcmp(name, "dx"))
+    while ((dim+1)*(dim+1) <= size) dim++;
+  CeedVectorGetArray(V, CEED_MEM_HOST, &v);
+  for (CeedInt c=0; c<size; c++)
+    for (CeedInt i=0; i<npoints; i++) {
+      CeedScalar r = (CeedScalar)rand() / RAND_MAX;
+      v[c*npoints + i] = dim ? (c % (dim+1) ? 0. : 1.) + 0.1*(r - 0.5)
+                         : 0.5 + r;
+    }
+  CeedVectorRestoreArray(V, &v);
+}
+
+// Time the QFunction on npoints quadrature points
+static int BenchQFunction(Ceed ceed, const char *name, CeedInt vlength_user,
+                          CeedInt npoints, double mintime) {
+  CeedQFunction qf;
+  CeedQFunctionField *inputfields, *outputfields;
+  CeedInt numin, numout, vlength, size, bytes = 0, reps;
+  CeedVector in[16] = {NULL}, out[16] = {NULL};
+  double start, elapsed;
+  int ierr;
+
+  ierr = CreateQFunction(ceed, name, vlength_user, &qf);
+  if (ierr) return ierr;
+  CeedQFunctionGetVectorLength(qf, &vlength);
+  CeedQFunctionGetNumArgs(qf, &numin, &numout);
+  CeedQFunctionGetFields(qf, &inputfields, &outputfields);
+  if (!numout) {
+    // LCOV_EXCL_START
+    fprintf(stderr, "QFunction %s has no outputs\n", name);
+    CeedQFunctionDestroy(&qf);
+    return 1;
+    // LCOV_EXCL_STOP
+  }
+
+  // The number of points is a multiple of the vector length
+  npoints = (npoints + vlength - 1) / vlength * vlength;
+
+  // Synthetic inputs and outputs
+  srand(0);
+  for (CeedInt i=0; i<numin; i++) {
+    char *fieldname;
+    CeedQFunctionFieldGetName(inputfields[i], &fieldname);
+    CeedQFunctionFieldGetSize(inputfields[i], &size);
+    CeedVectorCreate(ceed, size*npoints, &in[i]);
+    SyntheticInput(in[i], fieldname, size, npoints);
+    bytes += size*sizeof(CeedScalar);
+  }
+  for (CeedInt i=0; i<numout; i++) {
+    CeedQFunctionFieldGetSize(outputfields[i], &size);
+    CeedVectorCreate(ceed, size*npoints, &out[i]);
+    CeedVectorSetValue(out[i], 0.0);
+    bytes += size*sizeof(CeedScalar);
+  }
+
+  // The first application includes any JIT compilation of the QFunction
+  CeedQFunctionApply(qf, npoints, in, out);
+  Sync(out[0]);
+
+  // Double the number of applications until the measurement is long enough
+  for (reps=1; ; reps*=2) {
+    start = Wtime();
+    for (CeedInt i=0; i<reps; i++)
+      CeedQFunctionApply(qf, npoints, in, out);
+    Sync(out[0]);
+    elapsed = Wtime() - start;
+    if (elapsed >= mintime) break;
+  }
+
+  const char *resource;
+  CeedGetResource(ceed, &resource);
+  const double time = elapsed / reps;
+  printf("{\"code\": \"libCEED\", \"test\": \"qfbench\", "
+         "\"qfunction\": \"%s\", \"backend\": \"%s\", \"vlength\": %d, "
+         "\"num_inputs\": %d, \"num_outputs\": %d, \"bytes_per_point\": %d, "
+         "\"num_points\": %d, \"reps\": %d, \"time\": %.6e, "
+         "\"points_per_sec\": %.6e, \"bytes_per_sec\": %.6e}\n", name,
+         resource, vlength, numin, numout, bytes, npoints, reps, time,
+         npoints / time, (double)bytes*npoints / time);
+  fflush(stdout);
+
+  for (CeedInt i=0; i<numin; i++)
+    CeedVectorDestroy(&in[i]);
+  for (CeedInt i=0; i<numout; i++)
+    CeedVectorDestroy(&out[i]);
+  CeedQFunctionDestroy(&qf);
+  return 0;
+}
+
+int main(int argc, const char *argv[]) {
+  const char *ceed_spec = "/cpu/self";
+  const char *names[64];
+  CeedInt numnames = 0, npoints = 0, vlength = 1;
+  double mintime = 0.05;
+
+  // Parse command line options
+  for (int ia=1; ia<argc; ia++) {
+    int next_arg = ((ia+1) < argc), parse_error = 0;
+    if (!strcmp(argv[ia],"-h")) {
+      parse_error = 1;
+    } else if (!strcmp(argv[ia],"-c") || !strcmp(argv[ia],"-ceed")) {
+      parse_error = next_arg ? ceed_spec = argv[++ia], 0 : 1;
+    } else if (!strcmp(argv[ia],"-q")) {
+      parse_error = next_arg && numnames < 64 ?
+                    names[numnames++] = argv[++ia], 0 : 1;
+    } else if (!strcmp(argv[ia],"-n")) {
+      parse_error = next_arg ? npoints = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-v")) {
+      parse_error = next_arg ? vlength = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-t")) {
+      parse_error = next_arg ? mintime = atof(argv[++ia]), 0 : 1;
+    } else {
+      parse_error = 1;
+    }
+    if (parse_error || npoints < 0 || vlength < 1 || mintime <= 0) {
+      // LCOV_EXCL_START
+      fprintf(stderr, "Usage: %s [-ceed <resource>] [-q <qfunction>]... "
+              "[-n <npoints>] [-v <vlength>] [-t <seconds>]\n", argv[0]);
+      return 1;
+      // LCOV_EXCL_STOP
+    }
+  }
+  if (!numnames) {
+    for (CeedInt i=0; i<num_qfdata; i++)
+      names[numnames++] = qfdata[i].name;
+    for (CeedInt i=0; i<num_gallerynames; i++)
+      names[numnames++] = gallerynames[i];
+  }
+
+  Ceed ceed;
+  CeedInit(ceed_spec, &ceed);
+  // Errors are reported to the caller, so that a QFunction that cannot be
+  //   created is skipped
+  CeedSetErrorHandler(ceed, CeedErrorReturn);
+  int status = 0;
+  for (CeedInt i=0; i<numnames; i++)
+    for (CeedInt n=npoints ? npoints : 1<<10; n<=(npoints ? npoints : 1<<22);
+         n*=4)
+      if (BenchQFunction(ceed, names[i], vlength, n, mintime)) {
+        fprintf(stderr, "QFunction %s failed on %s\n", names[i], ceed_spec);
+        status = 1;
+        break;
+      }
+  CeedDestroy(&ceed);
+  return status;
+}
@@ -0,0 +1,317 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+# the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+# reserved. See files LICENSE and NOTICE for details.
+#
+# This file is part of CEED, a collection of benchmarks, miniapps, software
+# libraries and APIs for efficient high-order finite element and spectral
+# element discretizations for exascale applications. For more information and
+# source code availability see http://github.com/ceed.
+#
+# The CEED research is supported by the Exascale Computing Project (17-SC-20-SC)
+# a collaborative effort of two U.S. Department of Energy organizations (Office
+# of Science and the National Nuclear Security Administration) responsible for
+# the planning and preparation of a capable exascale ecosystem, including
+# software, applications, hardware, advanced system engineering and early
+# testbed platforms, in support of the nation's exascale computing imperative.
+
+# Weak and strong scaling studies of the PETSc examples
+#
+# Runs the bps, multigrid, or navierstokes example over a matrix of node
+# counts, MPI ranks per node, and libCEED backends, with the libCEED profile
+# (CEED_PROFILE) and PETSc -log_view enabled. The solve time and the time of
+# each libCEED stage and PETSc event are collected from the output of each run,
+# and the parallel efficiency of each is plotted against the number of nodes.
+#
+# Weak scaling keeps the problem size per rank fixed, so the efficiency is
+# T(n0) / T(n); strong scaling keeps the global size fixed, so the efficiency
+# is T(n0) n0 / (T(n) n), where n0 is the smallest number of ranks run.
+
+import json
+import os
+import re
+import shlex
+import subprocess
+import sys
+
+# Executables of the examples, relative to the libCEED root
+EXAMPLES = {
+    'bps': os.path.join('examples', 'petsc', 'bps'),
+    'multigrid': os.path.join('examples', 'petsc', 'multigrid'),
+    'navierstokes': os.path.join('examples', 'fluids', 'navierstokes'),
+}
+
+# Solve time and global size reported by each example
+SOLVE_TIME = re.compile(r'(?:CG Solve Time\s*:|Time taken for solution '
+                        r'\(sec\):)\s*([0-9.eE+-]+)')
+GLOBAL_NODES = re.compile(r'Global [Nn]odes\s*:\s*(\d+)')
+DOF_PER_NODE = re.compile(r'DoF per node\s*:\s*(\d+)')
+GLOBAL_DOFS = re.compile(r'Global DoFs\s*:\s*(\d+)')
+
+# Rows of the libCEED profile and of the PETSc -log_view event table
+CEED_STAGE = re.compile(r'^\s+(Ceed[A-Za-z]+)\s+(\d+)\s+([0-9.eE+-]+)')
+PETSC_STAGE = re.compile(r'^--- Event Stage \d+: (.*)$')
+PETSC_EVENT = re.compile(r'^([A-Za-z][A-Za-z0-9_]*)\s+(\d+)\s+[0-9.]+\s+'
+                         r'([0-9.eE+-]+)\s+[0-9.]+\s')
+
+
+def split_cells(nelem):
+    """Near cubic box of about nelem elements, as powers of two"""
+    s = max(0, int(nelem).bit_length() - 1)
+    return [1 << (s // 3 + (1 if d < s % 3 else 0)) for d in range(3)]
+
+
+def size_args(example, mode, size, degree, nranks):
+    """Options setting the problem size: size is the number of nodes per rank
+    for weak scaling and the global number of nodes for strong scaling"""
+    nodes = size * nranks if mode == 'weak' else size
+    if example == 'bps':
+        return ['-local_nodes', str(max(1, nodes // nranks))]
+    cells = ','.join(str(c) for c in split_cells(nodes // degree**3))
+    if example == 'multigrid':
+        return ['-cells', cells]
+    return ['-dm_plex_box_faces', cells]
+
+
+def parse_output(text):
+    """Collect the solve time, global size, libCEED stages, and PETSc events
+    from the output of one run"""
+    result = {'solve_time': None, 'dofs': None, 'ceed': {}, 'petsc': {}}
+    match = SOLVE_TIME.search(text)
+    if match:
+        result['solve_time'] = float(match.group(1))
+    match = GLOBAL_DOFS.search(text)
+    if match:
+        result['dofs'] = int(match.group(1))
+    else:
+        nodes, ncomp = GLOBAL_NODES.search(text), DOF_PER_NODE.search(text)
+        if nodes:
+            result['dofs'] = int(nodes.group(1)) * \
+                (int(ncomp.group(1)) if ncomp else 1)
+
+    in_profile, stage = False, None
+    for line in text.splitlines():
+        if line.strip() in ('Profile:', 'Hardware counters:'):
+            in_profile = line.strip() == 'Profile:'
+            continue
+        if in_profile:
+            match = CEED_STAGE.match(line)
+            if match:
+                name = match.group(1)
+                result['ceed'][name] = result['ceed'].get(name, 0.) + \
+                    float(match.group(3))
+                continue
+            if not line.startswith('    '):
+                in_profile = False
+        if line.startswith('Memory usage is given in bytes'):
+            stage = None  # The object tables repeat the stages
+        match = PETSC_STAGE.match(line)
+        if match:
+            stage = match.group(1).strip()
+            continue
+        if stage:
+            match = PETSC_EVENT.match(line)
+            if match:
+                events = result['petsc'].setdefault(stage, {})
+                events[match.group(1)] = float(match.group(3))
+    return result
+
+
+def phases(result):
+    """Time of each libCEED stage and PETSc event, preferring the events of the
+    timed solve stage of the examples when they have one"""
+    times = {name: t for name, t in result['ceed'].items()}
+    stages = result['petsc']
+    events = stages.get('Solve Stage', stages.get('Main Stage', {}))
+    times.update(events)
+    return times
+
+
+def efficiency(mode, ref, run, key):
+    """Parallel efficiency of run with respect to ref"""
+    t0, t = ref.get(key), run.get(key)
+    if not t0 or not t:
+        return None
+    if mode == 'weak':
+        return t0 / t
+    return t0 * ref['nranks'] / (t * run['nranks'])
+
+
+def run_matrix(args):
+    """Run or print the command of each case and return the run records"""
+    root = os.path.abspath(os.path.join(os.path.dirname(__file__), '..'))
+    executable = os.path.join(root, EXAMPLES[args.example])
+    runs = []
+    os.makedirs(args.output_dir, exist_ok=True)
+    for backend in args.ceed.split():
+        for ppn in [int(p) for p in args.ranks_per_node.split()]:
+            for nodes in [int(n) for n in args.nodes.split()]:
+                nranks = nodes * ppn
+                launch = [a.format(np=nranks, nodes=nodes, ppn=ppn)
+                          for a in shlex.split(args.mpiexec_args)]
+                command = [args.mpiexec] + launch + [executable] + \
+                    ['-ceed', backend, '-degree', str(args.degree)] + \
+                    size_args(args.example, args.mode, args.size,
+                              args.degree, nranks) + \
+                    ['-log_view'] + args.extra
+                log = os.path.join(args.output_dir, '{}-{}-{}-N{}-p{}.log'.format(
+                    args.example, args.mode, backend.replace('/', ''), nodes,
+                    ppn))
+                runs.append(dict(backend=backend, nodes=nodes, ppn=ppn,
+                                 nranks=nranks, log=log,
+                                 command=' '.join(shlex.quote(c)
+                                                  for c in command)))
+                if args.dry_run:
+                    print('CEED_PROFILE=1 {} > {}'.format(runs[-1]['command'],
+                                                          log))
+                elif not args.collect:
+                    print('  {:>10} {}'.format('RUN', runs[-1]['command']))
+                    env = dict(os.environ, CEED_PROFILE='1')
+                    with open(log, 'w') as fd:
+                        subprocess.run(command, stdout=fd,
+                                       stderr=subprocess.STDOUT, env=env)
+    return runs
+
+
+def collect(args, runs):
+    """Parse the logs of the runs and compute the efficiency of each phase"""
+    for run in runs:
+        if not os.path.isfile(run['log']):
+            continue
+        with open(run['log']) as fd:
+            result = parse_output(fd.read())
+        run['solve_time'] = result['solve_time']
+        run['dofs'] = result['dofs']
+        run['phases'] = phases(result)
+    runs = [run for run in runs if run.get('solve_time')]
+
+    # Efficiency with respect to the smallest run of each backend and ppn
+    for run in runs:
+        group = [r for r in runs if r['backend'] == run['backend'] and
+                 r['ppn'] == run['ppn']]
+        ref = min(group, key=lambda r: r['nranks'])
+        run['efficiency'] = efficiency(args.mode, ref, run, 'solve_time')
+        run['phase_efficiency'] = {
+            name: efficiency(args.mode, dict(ref['phases'],
+                                             nranks=ref['nranks']),
+                             dict(run['phases'], nranks=run['nranks']), name)
+            for name in run['phases']}
+    return runs
+
+
+def plot(args, runs):
+    """Efficiency of the solve of each backend and ranks per node, and of the
+    most expensive phases of each"""
+    try:
+        import matplotlib
+    except ImportError:
+        print('matplotlib not found, skipping the plots')
+        return
+    matplotlib.use('pdf')
+    import matplotlib.pyplot as plt
+
+    def value(efficiency):
+        return float('nan') if efficiency is None else efficiency
+
+    def axes(ax, title):
+        nodes = sorted({r['nodes'] for r in runs})
+        ax.set_xscale('log')
+        ax.set_xticks(nodes)
+        ax.set_xticklabels([str(n) for n in nodes])
+        ax.set_ylim(0, 1.1)
+        ax.set_xlabel('Nodes')
+        ax.set_ylabel('{} scaling efficiency'.format(args.mode.capitalize()))
+        ax.set_title(title)
+        ax.grid(True)
+
+    prefix = os.path.join(args.output_dir, '{}-{}'.format(args.example,
+                                                          args.mode))
+    groups = sorted({(r['backend'], r['ppn']) for r in runs})
+    fig, ax = plt.subplots()
+    for backend, ppn in groups:
+        group = sorted([r for r in runs if r['backend'] == backend and
+                        r['ppn'] == ppn], key=lambda r: r['nodes'])
+        ax.plot([r['nodes'] for r in group],
+                [value(r['efficiency']) for r in group], 'o-',
+                label='{}, {} ranks/node'.format(backend, ppn))
+    axes(ax, '{} solve'.format(args.example))
+    ax.legend()
+    fig.savefig(prefix + '-efficiency.pdf', bbox_inches='tight')
+    plt.close(fig)
+
+    for backend, ppn in groups:
+        group = sorted([r for r in runs if r['backend'] == backend and
+                        r['ppn'] == ppn], key=lambda r: r['nodes'])
+        ref = group[0]['phases']
+        names = sorted(ref, key=lambda name: -ref[name])[:args.phases]
+        fig, ax = plt.subplots()
+        for name in names:
+            ax.plot([r['nodes'] for r in group],
+                    [value(r['phase_efficiency'].get(name)) for r in group],
+                    'o-',
+                    label=name)
+        axes(ax, '{} phases, {}, {} ranks/node'.format(args.example,
+                                                       backend, ppn))
+        ax.legend(fontsize='small')
+        fig.savefig('{}-phases-{}-p{}.pdf'.format(
+            prefix, backend.replace('/', ''), ppn), bbox_inches='tight')
+        plt.close(fig)
+
+
+if __name__ == '__main__':
+    import argparse
+    parser = argparse.ArgumentParser('Weak and strong scaling studies of the '
+                                     'PETSc examples')
+    parser.add_argument('-e', '--example', choices=sorted(EXAMPLES),
+                        default='bps', help='Example to run')
+    parser.add_argument('-m', '--mode', choices=['weak', 'strong'],
+                        default='weak', help='Scaling study')
+    parser.add_argument('-N', '--nodes', default='1',
+                        help='List of node counts, e.g. "1 2 4 8"')
+    parser.add_argument('-p', '--ranks-per-node', default='1',
+                        help='List of MPI ranks per node, e.g. "16 32"')
+    parser.add_argument('-c', '--ceed', default='/cpu/self',
+                        help='List of libCEED backends')
+    parser.add_argument('-s', '--size', type=int, default=100000,
+                        help='Nodes per rank (weak) or global nodes (strong)')
+    parser.add_argument('-d', '--degree', type=int, default=3,
+                        help='Polynomial degree')
+    parser.add_argument('--mpiexec', default=os.environ.get('MPIEXEC',
+                                                            'mpiexec'),
+                        help='MPI launcher')
+    parser.add_argument('--mpiexec-args', default='-n {np}',
+                        help='Launcher options, with {np}, {nodes}, and {ppn} '
+                        'replaced by the number of ranks, nodes, and ranks per '
+                        'node')
+    parser.add_argument('-o', '--output-dir', default='scaling-output',
+                        help='Directory for the logs, results, and plots')
+    parser.add_argument('--phases', type=int, default=6,
+                        help='Number of phases to plot, the most expensive')
+    parser.add_argument('--dry-run', action='store_true',
+                        help='Print the commands, e.g. for a batch script')
+    parser.add_argument('--collect', action='store_true',
+                        help='Only process the logs of earlier runs')
+    parser.add_argument('--no-plot', action='store_true',
+                        help='Do not plot the results')
+    parser.add_argument('extra', nargs='*',
+                        help='Additional options for the example, after --')
+    args = parser.parse_args()
+
+    runs = run_matrix(args)
+    if args.dry_run:
+        sys.exit(0)
+    runs = collect(args, runs)
+    with open(os.path.join(args.output_dir, '{}-{}.json'.format(
+            args.example, args.mode)), 'w') as fd:
+        json.dump(runs, fd, indent=2)
+        fd.write('\n')
+
+    print('{:>24} {:>6} {:>6} {:>12} {:>12} {:>10}'.format(
+        'backend', 'nodes', 'ranks', 'DoFs', 'solve (s)', 'efficiency'))
+    for run in runs:
+        print('{:>24} {:>6} {:>6} {:>12} {:>12.4e} {:>10.3f}'.format(
+            run['backend'], run['nodes'], run['nranks'], run['dofs'] or 0,
+            run['solve_time'], run['efficiency'] or 0))
+    if runs and not args.no_plot:
+        plot(args, runs)
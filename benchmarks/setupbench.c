@@ -0,0 +1,393 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+//                        libCEED Setup Time Benchmark
+//
+// This program measures the time to the first operator application for a CEED
+// benchmark problem on a structured box mesh, broken down by phase: CeedInit,
+// creation of the element restrictions, bases, QFunctions, and operators, the
+// setup of the quadrature data, CeedOperatorPrepare, the first application,
+// which includes any kernel compilation, and the construction and first
+// application of a p-multigrid hierarchy with CeedOperatorMultigridLevelCreate.
+// A second application is timed for comparison with the steady state. Each
+// mesh size is written as one JSON object per line, with the time in seconds of
+// each phase, in the format of microbench.c.
+//
+// Build with:
+//
+//     make setupbench
+//
+// Sample runs:
+//
+//     build/setupbench
+//     build/setupbench -ceed /gpu/cuda/gen -bp 3 -p 6 -e 1000000
+//
+// Options:
+//
+//     -ceed <resource>  libCEED resource to benchmark
+//     -bp <bp>          benchmark problem (default: 1)
+//     -p <P>            number of 1D nodes (default: 4)
+//     -e <nelem>        only run about <nelem> elements
+//                       (default: 10^4 and 10^5)
+
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+// The right hand side QFunctions of these headers are not used here
+#pragma GCC diagnostic ignored "-Wunused-function"
+#include "../examples/petsc/qfunctions/bps/bp1.h"
+#include "../examples/petsc/qfunctions/bps/bp2.h"
+#include "../examples/petsc/qfunctions/bps/bp3.h"
+#include "../examples/petsc/qfunctions/bps/bp4.h"
+
+// Benchmark problem data, as in the PETSc BPs example
+typedef struct {
+  CeedInt ncomp, qdatasize, qextra;
+  CeedQFunctionUser setupgeo, apply;
+  const char *setupgeofname, *applyfname;
+  CeedEvalMode mode;
+  CeedQuadMode qmode;
+} BPData;
+
+static const BPData bpdata[6] = {
+  {1, 1, 1, SetupMassGeo, Mass, SetupMassGeo_loc, Mass_loc,
+   CEED_EVAL_INTERP, CEED_GAUSS},
+  {3, 1, 1, SetupMassGeo, Mass3, SetupMassGeo_loc, Mass3_loc,
+   CEED_EVAL_INTERP, CEED_GAUSS},
+  {1, 6, 1, SetupDiffGeo, Diff, SetupDiffGeo_loc, Diff_loc,
+   CEED_EVAL_GRAD, CEED_GAUSS},
+  {3, 6, 1, SetupDiffGeo, Diff3, SetupDiffGeo_loc, Diff3_loc,
+   CEED_EVAL_GRAD, CEED_GAUSS},
+  {1, 6, 0, SetupDiffGeo, Diff, SetupDiffGeo_loc, Diff_loc,
+   CEED_EVAL_GRAD, CEED_GAUSS_LOBATTO},
+  {3, 6, 0, SetupDiffGeo, Diff3, SetupDiffGeo_loc, Diff3_loc,
+   CEED_EVAL_GRAD, CEED_GAUSS_LOBATTO},
+};
+
+// Setup phases, in the order they are timed
+enum {
+  PHASE_INIT, PHASE_RESTRICTION, PHASE_BASIS, PHASE_QFUNCTION, PHASE_OPERATOR,
+  PHASE_SETUP_QDATA, PHASE_PREPARE, PHASE_FIRST_APPLY, PHASE_MULTIGRID,
+  PHASE_MULTIGRID_FIRST_APPLY, NUM_PHASES
+};
+static const char *const phasenames[NUM_PHASES] = {
+  "init", "create_restriction", "create_basis", "create_qfunction",
+  "create_operator", "setup_qdata", "prepare", "first_apply", "multigrid",
+  "multigrid_first_apply"
+};
+
+// Maximum number of multigrid levels, including the fine level
+#define MAX_LEVELS 8
+
+// Wall clock time in seconds
+static double Wtime(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9*ts.tv_nsec;
+}
+
+// Complete any outstanding device work on a vector
+static void Sync(CeedVector V) {
+  CeedScalar norm;
+  CeedVectorNorm(V, CEED_NORM_1, &norm);
+}
+
+// Offsets of the nodes of each element of a box mesh with nxe elements in
+//   each direction, for elements with P nodes in each direction
+static CeedInt *BoxOffsets(const CeedInt nxe[3], CeedInt P) {
+  const CeedInt nelem = nxe[0]*nxe[1]*nxe[2], elemsize = P*P*P;
+  const CeedInt nxn[3] = {nxe[0]*(P-1) + 1, nxe[1]*(P-1) + 1,
+                          nxe[2]*(P-1) + 1
+                         };
+  CeedInt *offsets = malloc(nelem*elemsize*sizeof(offsets[0]));
+
+  for (CeedInt el=0; el<nelem; el++) {
+    CeedInt exyz[3] = {el % nxe[0], (el / nxe[0]) % nxe[1],
+                       el / (nxe[0]*nxe[1])
+                      };
+    for (CeedInt n=0; n<elemsize; n++) {
+      CeedInt idx = 0, stride = 1, rem = n;
+      for (CeedInt d=0; d<3; d++) {
+        idx += (exyz[d]*(P-1) + rem % P) * stride;
+        stride *= nxn[d];
+        rem /= P;
+      }
+      offsets[el*elemsize + n] = idx;
+    }
+  }
+  return offsets;
+}
+
+// Benchmark the setup of one benchmark problem on about nelem elements
+static int BenchSetup(const char *ceed_spec, CeedInt bp, CeedInt P,
+                      CeedInt nelem_target, double init_first) {
+  const BPData *data = &bpdata[bp-1];
+  const CeedInt ncomp = data->ncomp, qdatasize = data->qdatasize,
+                Q = P + data->qextra, dim = 3;
+  const CeedInt inscale = data->mode == CEED_EVAL_GRAD ? dim : 1;
+  CeedInt nxe[3], nelem = 1, nnodes = 1, nxnodes = 1, nlevels = 1;
+  CeedInt Plevel[MAX_LEVELS], *offsetsx, *offsetsu[MAX_LEVELS];
+  Ceed ceed;
+  CeedBasis basisx, basisu[MAX_LEVELS];
+  CeedElemRestriction rx, ru[MAX_LEVELS], rqd;
+  CeedQFunction qf_setup, qf_apply;
+  CeedOperator op_setup, op[MAX_LEVELS], op_prolong[MAX_LEVELS],
+               op_restrict[MAX_LEVELS];
+  CeedVector X, qdata, U[MAX_LEVELS], V[MAX_LEVELS], mult;
+  CeedScalar *x;
+  double time[NUM_PHASES], start, apply;
+
+  // Near cubic arrangement of about nelem_target elements
+  for (CeedInt d=0, rem=nelem_target; d<dim; d++) {
+    nxe[d] = pow(rem, 1./(dim-d)) + 0.5;
+    if (nxe[d] < 1) nxe[d] = 1;
+    rem /= nxe[d];
+    if (rem < 1) rem = 1;
+    nelem *= nxe[d];
+    nnodes *= nxe[d]*(P-1) + 1;
+    nxnodes *= nxe[d] + 1;
+  }
+
+  // p-multigrid hierarchy, halving the degree down to linear elements
+  Plevel[0] = P;
+  while (Plevel[nlevels-1] > 2 && nlevels < MAX_LEVELS) {
+    Plevel[nlevels] = (Plevel[nlevels-1] - 1) / 2 + 1;
+    nlevels++;
+  }
+
+  // The offsets are computed by the application, outside of the timed phases
+  offsetsx = BoxOffsets(nxe, 2);
+  for (CeedInt l=0; l<nlevels; l++)
+    offsetsu[l] = BoxOffsets(nxe, Plevel[l]);
+
+  // Ceed
+  start = Wtime();
+  CeedInit(ceed_spec, &ceed);
+  time[PHASE_INIT] = Wtime() - start;
+
+  // Restrictions
+  start = Wtime();
+  CeedElemRestrictionCreate(ceed, nelem, 8, dim, nxnodes, dim*nxnodes,
+                            CEED_MEM_HOST, CEED_COPY_VALUES, offsetsx, &rx);
+  CeedElemRestrictionCreate(ceed, nelem, P*P*P, ncomp, nnodes, ncomp*nnodes,
+                            CEED_MEM_HOST, CEED_COPY_VALUES, offsetsu[0],
+                            &ru[0]);
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q*Q*Q, qdatasize,
+                                   qdatasize*nelem*Q*Q*Q,
+                                   CEED_STRIDES_BACKEND, &rqd);
+  time[PHASE_RESTRICTION] = Wtime() - start;
+
+  // Bases
+  start = Wtime();
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, 2, Q, data->qmode, &basisx);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, ncomp, P, Q, data->qmode,
+                                  &basisu[0]);
+  time[PHASE_BASIS] = Wtime() - start;
+
+  // QFunctions
+  start = Wtime();
+  CeedQFunctionCreateInterior(ceed, 1, data->setupgeo, data->setupgeofname,
+                              &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "dx", dim*dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddOutput(qf_setup, "qdata", qdatasize, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, data->apply, data->applyfname,
+                              &qf_apply);
+  CeedQFunctionAddInput(qf_apply, "u", ncomp*inscale, data->mode);
+  CeedQFunctionAddInput(qf_apply, "qdata", qdatasize, CEED_EVAL_NONE);
+  CeedQFunctionAddOutput(qf_apply, "v", ncomp*inscale, data->mode);
+  time[PHASE_QFUNCTION] = Wtime() - start;
+
+  // Operators
+  start = Wtime();
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "dx", rx, basisx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basisx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "qdata", rqd, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedVectorCreate(ceed, qdatasize*nelem*Q*Q*Q, &qdata);
+  CeedOperatorCreate(ceed, qf_apply, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op[0]);
+  CeedOperatorSetField(op[0], "u", ru[0], basisu[0], CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op[0], "qdata", rqd, CEED_BASIS_COLLOCATED, qdata);
+  CeedOperatorSetField(op[0], "v", ru[0], basisu[0], CEED_VECTOR_ACTIVE);
+  time[PHASE_OPERATOR] = Wtime() - start;
+
+  // Quadrature data on the unit cube
+  start = Wtime();
+  CeedVectorCreate(ceed, dim*nxnodes, &X);
+  CeedVectorGetArray(X, CEED_MEM_HOST, &x);
+  for (CeedInt i=0; i<nxnodes; i++) {
+    const CeedInt ixyz[3] = {i % (nxe[0]+1), (i / (nxe[0]+1)) % (nxe[1]+1),
+                             i / ((nxe[0]+1)*(nxe[1]+1))
+                            };
+    for (CeedInt d=0; d<dim; d++)
+      x[i + d*nxnodes] = (CeedScalar)ixyz[d] / nxe[d];
+  }
+  CeedVectorRestoreArray(X, &x);
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+  Sync(qdata);
+  time[PHASE_SETUP_QDATA] = Wtime() - start;
+
+  // First application, with and without CeedOperatorPrepare
+  start = Wtime();
+  CeedOperatorPrepare(op[0]);
+  time[PHASE_PREPARE] = Wtime() - start;
+
+  CeedVectorCreate(ceed, ncomp*nnodes, &U[0]);
+  CeedVectorCreate(ceed, ncomp*nnodes, &V[0]);
+  CeedVectorSetValue(U[0], 1.0);
+  Sync(U[0]);
+  start = Wtime();
+  CeedOperatorApply(op[0], U[0], V[0], CEED_REQUEST_IMMEDIATE);
+  Sync(V[0]);
+  time[PHASE_FIRST_APPLY] = Wtime() - start;
+
+  start = Wtime();
+  CeedOperatorApply(op[0], U[0], V[0], CEED_REQUEST_IMMEDIATE);
+  Sync(V[0]);
+  apply = Wtime() - start;
+
+  // Multigrid hierarchy
+  start = Wtime();
+  CeedVectorCreate(ceed, ncomp*nnodes, &mult);
+  CeedElemRestrictionGetMultiplicity(ru[0], mult);
+  for (CeedInt l=1; l<nlevels; l++) {
+    CeedInt nnodesl = 1;
+    for (CeedInt d=0; d<dim; d++)
+      nnodesl *= nxe[d]*(Plevel[l]-1) + 1;
+    CeedElemRestrictionCreate(ceed, nelem, Plevel[l]*Plevel[l]*Plevel[l],
+                              ncomp, nnodesl, ncomp*nnodesl, CEED_MEM_HOST,
+                              CEED_COPY_VALUES, offsetsu[l], &ru[l]);
+    CeedBasisCreateTensorH1Lagrange(ceed, dim, ncomp, Plevel[l], Q,
+                                    data->qmode, &basisu[l]);
+    CeedOperatorMultigridLevelCreate(op[l-1], mult, ru[l], basisu[l], &op[l],
+                                     &op_prolong[l], &op_restrict[l]);
+    CeedVectorDestroy(&mult);
+    CeedVectorCreate(ceed, ncomp*nnodesl, &mult);
+    CeedElemRestrictionGetMultiplicity(ru[l], mult);
+    CeedVectorCreate(ceed, ncomp*nnodesl, &U[l]);
+    CeedVectorCreate(ceed, ncomp*nnodesl, &V[l]);
+  }
+  CeedVectorDestroy(&mult);
+  time[PHASE_MULTIGRID] = Wtime() - start;
+
+  // First application of each level operator, the transfer operators
+  //   between levels, and the coarse operators
+  start = Wtime();
+  for (CeedInt l=1; l<nlevels; l++) {
+    CeedOperatorApply(op_restrict[l], V[l-1], U[l], CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApply(op[l], U[l], V[l], CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApply(op_prolong[l], V[l], U[l-1], CEED_REQUEST_IMMEDIATE);
+  }
+  Sync(U[0]);
+  time[PHASE_MULTIGRID_FIRST_APPLY] = Wtime() - start;
+
+  double total = 0;
+  for (CeedInt i=0; i<NUM_PHASES; i++)
+    total += time[i];
+
+  const char *resource;
+  CeedGetResource(ceed, &resource);
+  printf("{\"code\": \"libCEED\", \"test\": \"setupbench\", "
+         "\"kernel\": \"bp%d\", \"backend\": \"%s\", \"dim\": %d, "
+         "\"degree\": %d, \"quadrature_pts\": %d, \"ncomp\": %d, "
+         "\"num_elem\": %d, \"num_unknowns\": %d, \"levels\": %d, "
+         "\"init_first\": %.6e, ", bp, resource, dim, P - 1, Q, ncomp, nelem,
+         ncomp*nnodes, nlevels, init_first);
+  for (CeedInt i=0; i<NUM_PHASES; i++)
+    printf("\"%s\": %.6e, ", phasenames[i], time[i]);
+  printf("\"total\": %.6e, \"apply\": %.6e}\n", total, apply);
+  fflush(stdout);
+
+  for (CeedInt l=0; l<nlevels; l++) {
+    if (l) {
+      CeedOperatorDestroy(&op_prolong[l]);
+      CeedOperatorDestroy(&op_restrict[l]);
+    }
+    CeedOperatorDestroy(&op[l]);
+    CeedElemRestrictionDestroy(&ru[l]);
+    CeedBasisDestroy(&basisu[l]);
+    CeedVectorDestroy(&U[l]);
+    CeedVectorDestroy(&V[l]);
+  }
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&qdata);
+  CeedOperatorDestroy(&op_setup);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_apply);
+  CeedElemRestrictionDestroy(&rx);
+  CeedElemRestrictionDestroy(&rqd);
+  CeedBasisDestroy(&basisx);
+  CeedDestroy(&ceed);
+  free(offsetsx);
+  for (CeedInt l=0; l<nlevels; l++)
+    free(offsetsu[l]);
+  return 0;
+}
+
+int main(int argc, const char *argv[]) {
+  const char *ceed_spec = "/cpu/self";
+  CeedInt bp = 1, P = 4, nelem = 0;
+
+  // Parse command line options
+  for (int ia=1; ia<argc; ia++) {
+    int next_arg = ((ia+1) < argc), parse_error = 0;
+    if (!strcmp(argv[ia],"-h")) {
+      parse_error = 1;
+    } else if (!strcmp(argv[ia],"-c") || !strcmp(argv[ia],"-ceed")) {
+      parse_error = next_arg ? ceed_spec = argv[++ia], 0 : 1;
+    } else if (!strcmp(argv[ia],"-bp")) {
+      parse_error = next_arg ? bp = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-p")) {
+      parse_error = next_arg ? P = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-e")) {
+      parse_error = next_arg ? nelem = atoi(argv[++ia]), 0 : 1;
+    } else {
+      parse_error = 1;
+    }
+    if (parse_error || bp < 1 || bp > 6 || P < 2 || nelem < 0) {
+      // LCOV_EXCL_START
+      fprintf(stderr, "Usage: %s [-ceed <resource>] [-bp <bp>] [-p <P>] "
+              "[-e <nelem>]\n", argv[0]);
+      return 1;
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  // The first CeedInit in the process also registers the backends and
+  //   initializes the device; it is reported with every record
+  Ceed ceed;
+  double start = Wtime();
+  CeedInit(ceed_spec, &ceed);
+  const double init_first = Wtime() - start;
+  CeedDestroy(&ceed);
+
+  const CeedInt nelems[2] = {10000, 100000};
+  for (CeedInt i=0; i<2; i++) {
+    if (nelem && i) break;
+    BenchSetup(ceed_spec, bp, P, nelem ? nelem : nelems[i], init_first);
+  }
+  return 0;
+}
@@ -284,7 +284,8 @@ int main(int argc, const char *argv[]) {
     printf("Computed mesh volume : % .14g\n", vol);
     printf("Volume error         : % .14g\n", vol-exact_vol);
   } else {
-    CeedScalar tol = (dim==1? 1E-14 : dim==2? 1E-7 : 1E-5);
+    CeedScalar tol = (dim==1? 100*CEED_EPSILON :
+                      dim==2? 1E-7 + 1000*CEED_EPSILON : 1E-5);
     if (fabs(vol-exact_vol)>tol)
       printf("Volume error : % .1e\n", vol-exact_vol);
   }
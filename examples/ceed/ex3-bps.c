@@ -0,0 +1,577 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+//                             libCEED Example 3
+//
+// This example solves the CEED benchmark problems BP1-BP6 on a structured box
+// mesh of the unit cube with an unpreconditioned conjugate gradient method
+// written with libCEED vector operations. It uses the same QFunctions as the
+// PETSc BPs example, but has no dependencies, so it can be used to benchmark
+// backends on systems where PETSc is not available.
+//
+// The mass problems, BP1 and BP2, have natural boundary conditions. The
+// diffusion problems, BP3-BP6, have homogeneous Dirichlet conditions, which
+// the true solution satisfies on the unit cube, imposed by constraining the
+// boundary nodes of the operator, which drops their rows and columns while
+// it is applied.
+//
+// The output uses the format of the PETSc BPs example, so it can be read by
+// benchmarks/postprocess_base.py.
+//
+// Build with:
+//
+//     make ex3-bps [CEED_DIR=</path/to/libceed>]
+//
+// Sample runs:
+//
+//     ./ex3-bps
+//     ./ex3-bps -ceed /cpu/self -b bp3 -o 4
+//     ./ex3-bps -ceed /gpu/cuda -b bp5 -o 7 -s 1000000
+//     ./ex3-bps -b bp3 -o 4 -qdata bp3-o4.qdata
+//
+// Next line is grep'd from tap.sh to set its arguments
+// Test vector mass and scalar diffusion problems
+//TESTARGS -ceed {ceed_resource} -t -b bp2
+//TESTARGS -ceed {ceed_resource} -t -b bp3
+
+/// @file
+/// libCEED example solving the CEED benchmark problems
+
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../petsc/qfunctions/bps/common.h"
+#include "../petsc/qfunctions/bps/bp1.h"
+#include "../petsc/qfunctions/bps/bp2.h"
+#include "../petsc/qfunctions/bps/bp3.h"
+#include "../petsc/qfunctions/bps/bp4.h"
+
+// Benchmark problem data, as in the PETSc BPs example
+typedef struct {
+  CeedInt ncomp, qdatasize, qextra;
+  CeedQFunctionUser setupgeo, setuprhs, apply, error;
+  const char *setupgeofname, *setuprhsfname, *applyfname, *errorfname;
+  CeedEvalMode mode;
+  CeedQuadMode qmode;
+  int dirichlet;
+} BPData;
+
+static const BPData bpdata[6] = {
+  {
+    1, 1, 1, SetupMassGeo, SetupMassRhs, Mass, Error,
+    SetupMassGeo_loc, SetupMassRhs_loc, Mass_loc, Error_loc,
+    CEED_EVAL_INTERP, CEED_GAUSS, 0
+  },
+  {
+    3, 1, 1, SetupMassGeo, SetupMassRhs3, Mass3, Error3,
+    SetupMassGeo_loc, SetupMassRhs3_loc, Mass3_loc, Error3_loc,
+    CEED_EVAL_INTERP, CEED_GAUSS, 0
+  },
+  {
+    1, 6, 1, SetupDiffGeo, SetupDiffRhs, Diff, Error,
+    SetupDiffGeo_loc, SetupDiffRhs_loc, Diff_loc, Error_loc,
+    CEED_EVAL_GRAD, CEED_GAUSS, 1
+  },
+  {
+    3, 6, 1, SetupDiffGeo, SetupDiffRhs3, Diff3, Error3,
+    SetupDiffGeo_loc, SetupDiffRhs3_loc, Diff3_loc, Error3_loc,
+    CEED_EVAL_GRAD, CEED_GAUSS, 1
+  },
+  {
+    1, 6, 0, SetupDiffGeo, SetupDiffRhs, Diff, Error,
+    SetupDiffGeo_loc, SetupDiffRhs_loc, Diff_loc, Error_loc,
+    CEED_EVAL_GRAD, CEED_GAUSS_LOBATTO, 1
+  },
+  {
+    3, 6, 0, SetupDiffGeo, SetupDiffRhs3, Diff3, Error3,
+    SetupDiffGeo_loc, SetupDiffRhs3_loc, Diff3_loc, Error3_loc,
+    CEED_EVAL_GRAD, CEED_GAUSS_LOBATTO, 1
+  },
+};
+
+// Auxiliary functions.
+int GetCartesianMeshSize(int dim, int order, int prob_size, int nxyz[3]);
+int BuildCartesianRestriction(Ceed ceed, int dim, int nxyz[3], int order,
+                              int ncomp, CeedInt *size, CeedInt num_qpts,
+                              CeedElemRestriction *restr,
+                              CeedElemRestriction *restr_i);
+int SetCartesianMeshCoords(int dim, int nxyz[3], int mesh_order,
+                           CeedVector mesh_coords);
+int GetBoundaryIndices(int dim, int nxyz[3], int order, int ncomp,
+                       CeedInt *nbc, CeedInt **indices);
+int CGSolve(CeedOperator oper, CeedVector rhs, CeedVector x,
+            CeedInt max_its, CeedScalar rtol, CeedVector r, CeedVector p,
+            CeedVector q, CeedInt *its, CeedScalar *rnorm);
+
+
+int main(int argc, const char *argv[]) {
+  const char *ceed_spec = "/cpu/self";
+  int dim        = 3;           // dimension of the mesh
+  int bp         = 1;           // benchmark problem
+  int sol_order  = 3;           // polynomial degree for the solution
+  int num_qpts   = -1;          // number of 1D quadrature points
+  int prob_size  = -1;          // approximate problem size
+  int max_its    = -1;          // maximum number of CG iterations
+  int help = 0, test = 0;
+  const char *qdata_file = NULL; // file to restore or save the qdata
+
+  // Process command line arguments.
+  for (int ia = 1; ia < argc; ia++) {
+    int next_arg = ((ia+1) < argc), parse_error = 0;
+    if (!strcmp(argv[ia],"-h")) {
+      help = 1;
+    } else if (!strcmp(argv[ia],"-c") || !strcmp(argv[ia],"-ceed")) {
+      parse_error = next_arg ? ceed_spec = argv[++ia], 0 : 1;
+    } else if (!strcmp(argv[ia],"-b")) {
+      // Accept both 'bp3' and '3'
+      if (next_arg) {
+        ia++;
+        bp = atoi(argv[ia] + (strncmp(argv[ia], "bp", 2) ? 0 : 2));
+      }
+      parse_error = !next_arg || bp < 1 || bp > 6;
+    } else if (!strcmp(argv[ia],"-o")) {
+      parse_error = next_arg ? sol_order = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-q")) {
+      parse_error = next_arg ? num_qpts = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-s")) {
+      parse_error = next_arg ? prob_size = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-i")) {
+      parse_error = next_arg ? max_its = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia],"-qdata")) {
+      parse_error = next_arg ? qdata_file = argv[++ia], 0 : 1;
+    } else if (!strcmp(argv[ia],"-t")) {
+      test = 1;
+    }
+    if (parse_error) {
+      printf("Error parsing command line options.\n");
+      return 1;
+    }
+  }
+  const BPData *data = &bpdata[bp-1];
+  const int ncomp = data->ncomp, qdatasize = data->qdatasize;
+  if (num_qpts < 0) num_qpts = sol_order + 1 + data->qextra;
+  if (prob_size < 0) prob_size = test ? 8*8*8*8 : 256*1024;
+  if (test && max_its < 0) max_its = 1000;
+
+  // Print the values of all options:
+  if (!test || help) {
+    printf("Selected options: [command line option] : <current value>\n");
+    printf("  Ceed specification [-c] : %s\n", ceed_spec);
+    printf("  Benchmark problem  [-b] : bp%d\n", bp);
+    printf("  Solution order     [-o] : %d\n", sol_order);
+    printf("  Num. 1D quadr. pts [-q] : %d\n", num_qpts);
+    printf("  Approx. # unknowns [-s] : %d\n", prob_size);
+    if (max_its < 0)
+      printf("  Max. CG iterations [-i] : 5 or 20, based on timing\n");
+    else
+      printf("  Max. CG iterations [-i] : %d\n", max_its);
+    if (qdata_file)
+      printf("  Quadrature data [-qdata] : %s\n", qdata_file);
+    if (help) {
+      printf("Test/quiet mode is %s\n", (test?"ON":"OFF (use -t to enable)"));
+      return 0;
+    }
+  }
+
+  // Select appropriate backend and logical device based on the <ceed-spec>
+  // command line argument.
+  Ceed ceed;
+  CeedInit(ceed_spec, &ceed);
+
+  // Construct the mesh and solution bases, the mesh is trilinear.
+  CeedBasis mesh_basis, sol_basis;
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, 2, num_qpts, data->qmode,
+                                  &mesh_basis);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, ncomp, sol_order+1, num_qpts,
+                                  data->qmode, &sol_basis);
+
+  // Determine the mesh size based on the given approximate problem size.
+  int nxyz[3];
+  GetCartesianMeshSize(dim, sol_order, prob_size, nxyz);
+
+  // Build CeedElemRestriction objects describing the mesh and solution discrete
+  // representations.
+  CeedInt mesh_size, sol_size, qdata_size;
+  CeedElemRestriction mesh_restr, sol_restr, sol_restr_i, qdata_restr_i;
+  BuildCartesianRestriction(ceed, dim, nxyz, 1, dim, &mesh_size, num_qpts,
+                            &mesh_restr, NULL);
+  BuildCartesianRestriction(ceed, dim, nxyz, sol_order, ncomp, &sol_size,
+                            num_qpts, &sol_restr, &sol_restr_i);
+  BuildCartesianRestriction(ceed, dim, nxyz, sol_order, qdatasize, &qdata_size,
+                            num_qpts, NULL, &qdata_restr_i);
+  CeedInt elem_qpts = CeedIntPow(num_qpts, dim);
+  CeedInt num_elem = nxyz[0]*nxyz[1]*nxyz[2];
+
+  if (!test) {
+    char hostname[256] = "unknown";
+    CeedMemType mem_type;
+    const char *resource;
+    gethostname(hostname, sizeof hostname);
+    CeedGetResource(ceed, &resource);
+    CeedGetPreferredMemType(ceed, &mem_type);
+    printf("\n-- CEED Benchmark Problem %d -- libCEED --\n"
+           "  MPI:\n"
+           "    Hostname                           : %s\n"
+           "    Total ranks                        : %d\n"
+           "    Ranks per compute node             : %d\n"
+           "  libCEED:\n"
+           "    libCEED Backend                    : %s\n"
+           "    libCEED Backend MemType            : %s\n"
+           "  Mesh:\n"
+           "    Number of 1D Basis Nodes (P)       : %d\n"
+           "    Number of 1D Quadrature Points (Q) : %d\n"
+           "    Global nodes                       : %d\n"
+           "    Local Elements                     : %d\n"
+           "    Owned nodes                        : %d\n"
+           "    DoF per node                       : %d\n",
+           bp, hostname, 1, 1, resource, CeedMemTypes[mem_type],
+           sol_order+1, num_qpts, sol_size/ncomp, num_elem, sol_size/ncomp,
+           ncomp);
+  }
+
+  // Create a CeedVector with the mesh coordinates.
+  CeedVector mesh_coords;
+  CeedVectorCreate(ceed, mesh_size, &mesh_coords);
+  SetCartesianMeshCoords(dim, nxyz, 1, mesh_coords);
+
+  // Create the QFunctions and operators that build the quadrature data and the
+  // right hand side, along with the true solution at the quadrature points.
+  CeedQFunction qf_setupgeo, qf_setuprhs;
+  CeedQFunctionCreateInterior(ceed, 1, data->setupgeo, data->setupgeofname,
+                              &qf_setupgeo);
+  CeedQFunctionAddInput(qf_setupgeo, "dx", dim*dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_setupgeo, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddOutput(qf_setupgeo, "qdata", qdatasize, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, data->setuprhs, data->setuprhsfname,
+                              &qf_setuprhs);
+  CeedQFunctionAddInput(qf_setuprhs, "x", dim, CEED_EVAL_INTERP);
+  CeedQFunctionAddInput(qf_setuprhs, "dx", dim*dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_setuprhs, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddOutput(qf_setuprhs, "true_soln", ncomp, CEED_EVAL_NONE);
+  CeedQFunctionAddOutput(qf_setuprhs, "rhs", ncomp, CEED_EVAL_INTERP);
+
+  CeedVector qdata, target, rhs;
+  CeedVectorCreate(ceed, qdatasize*num_elem*elem_qpts, &qdata);
+  CeedVectorCreate(ceed, ncomp*num_elem*elem_qpts, &target);
+  CeedVectorCreate(ceed, sol_size, &rhs);
+
+  CeedOperator op_setupgeo, op_setuprhs;
+  CeedOperatorCreate(ceed, qf_setupgeo, CEED_QFUNCTION_NONE,
+                     CEED_QFUNCTION_NONE, &op_setupgeo);
+  CeedOperatorSetField(op_setupgeo, "dx", mesh_restr, mesh_basis,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setupgeo, "weight", CEED_ELEMRESTRICTION_NONE,
+                       mesh_basis, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setupgeo, "qdata", qdata_restr_i,
+                       CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+  // Restore the qdata saved by an earlier run, or compute and save it
+  if (qdata_file && !access(qdata_file, R_OK)) {
+    CeedVectorLoad(qdata, qdata_restr_i, qdata_file);
+  } else {
+    CeedOperatorApply(op_setupgeo, mesh_coords, qdata, CEED_REQUEST_IMMEDIATE);
+    if (qdata_file)
+      CeedVectorSave(qdata, qdata_restr_i, qdata_file);
+  }
+
+  CeedOperatorCreate(ceed, qf_setuprhs, CEED_QFUNCTION_NONE,
+                     CEED_QFUNCTION_NONE, &op_setuprhs);
+  CeedOperatorSetField(op_setuprhs, "x", mesh_restr, mesh_basis,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setuprhs, "dx", mesh_restr, mesh_basis,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setuprhs, "weight", CEED_ELEMRESTRICTION_NONE,
+                       mesh_basis, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setuprhs, "true_soln", sol_restr_i,
+                       CEED_BASIS_COLLOCATED, target);
+  CeedOperatorSetField(op_setuprhs, "rhs", sol_restr, sol_basis,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorApply(op_setuprhs, mesh_coords, rhs, CEED_REQUEST_IMMEDIATE);
+
+  // Create the operator of the benchmark problem.
+  CeedInt inscale = data->mode == CEED_EVAL_GRAD ? dim : 1;
+  CeedQFunction qf_apply;
+  CeedQFunctionCreateInterior(ceed, 1, data->apply, data->applyfname,
+                              &qf_apply);
+  CeedQFunctionAddInput(qf_apply, "u", ncomp*inscale, data->mode);
+  CeedQFunctionAddInput(qf_apply, "qdata", qdatasize, CEED_EVAL_NONE);
+  CeedQFunctionAddOutput(qf_apply, "v", ncomp*inscale, data->mode);
+
+  CeedOperator oper;
+  CeedOperatorCreate(ceed, qf_apply, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &oper);
+  CeedOperatorSetField(oper, "u", sol_restr, sol_basis, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(oper, "qdata", qdata_restr_i, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(oper, "v", sol_restr, sol_basis, CEED_VECTOR_ACTIVE);
+
+  // Constrain the boundary nodes of the operator to zero and remove them from
+  // the right hand side for the Dirichlet problems.
+  if (data->dirichlet) {
+    CeedInt nbc, *bc_indices;
+    CeedScalar *r;
+    GetBoundaryIndices(dim, nxyz, sol_order, ncomp, &nbc, &bc_indices);
+    CeedOperatorSetDirichlet(oper, nbc, bc_indices, CEED_VECTOR_NONE);
+    CeedVectorGetArray(rhs, CEED_MEM_HOST, &r);
+    for (CeedInt i = 0; i < nbc; i++)
+      r[bc_indices[i]] = 0.;
+    CeedVectorRestoreArray(rhs, &r);
+    free(bc_indices);
+  }
+
+  // Solve with CG. As in the PETSc example, a first solve with one iteration
+  // warms up the backend and, unless given, sets the number of iterations of
+  // the timed solve.
+  CeedVector u, r, p, q;
+  CeedVectorCreate(ceed, sol_size, &u);
+  CeedVectorCreate(ceed, sol_size, &r);
+  CeedVectorCreate(ceed, sol_size, &p);
+  CeedVectorCreate(ceed, sol_size, &q);
+
+  CeedInt its;
+  CeedScalar rnorm;
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  double start = ts.tv_sec + 1e-9*ts.tv_nsec;
+  CGSolve(oper, rhs, u, 1, 1e-10, r, p, q, &its, &rnorm);
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  if (max_its < 0)
+    max_its = ts.tv_sec + 1e-9*ts.tv_nsec - start > 0.02 ? 5 : 20;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  start = ts.tv_sec + 1e-9*ts.tv_nsec;
+  CGSolve(oper, rhs, u, max_its, 1e-10, r, p, q, &its, &rnorm);
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  const double solve_time = ts.tv_sec + 1e-9*ts.tv_nsec - start;
+
+  // Compute the pointwise error at the quadrature points.
+  CeedQFunction qf_error;
+  CeedQFunctionCreateInterior(ceed, 1, data->error, data->errorfname,
+                              &qf_error);
+  CeedQFunctionAddInput(qf_error, "u", ncomp, CEED_EVAL_INTERP);
+  CeedQFunctionAddInput(qf_error, "true_soln", ncomp, CEED_EVAL_NONE);
+  CeedQFunctionAddOutput(qf_error, "error", ncomp, CEED_EVAL_NONE);
+
+  CeedOperator op_error;
+  CeedOperatorCreate(ceed, qf_error, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_error);
+  CeedOperatorSetField(op_error, "u", sol_restr, sol_basis,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_error, "true_soln", sol_restr_i,
+                       CEED_BASIS_COLLOCATED, target);
+  CeedOperatorSetField(op_error, "error", sol_restr_i, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedVector error;
+  CeedScalar max_error;
+  CeedVectorCreate(ceed, ncomp*num_elem*elem_qpts, &error);
+  CeedOperatorApply(op_error, u, error, CEED_REQUEST_IMMEDIATE);
+  CeedVectorNorm(error, CEED_NORM_MAX, &max_error);
+
+  if (!test) {
+    printf("  CG:\n"
+           "    Total CG Iterations                : %d\n"
+           "    Final rnorm                        : %e\n"
+           "  Performance:\n"
+           "    Pointwise Error (max)              : %e\n"
+           "    CG Solve Time                      : %g (%g) sec\n"
+           "    DoFs/Sec in CG                     : %g (%g) million\n",
+           its, rnorm, max_error, solve_time, solve_time,
+           1e-6*sol_size*its/solve_time, 1e-6*sol_size*its/solve_time);
+  } else if (max_error > 5e-2) {
+    printf("Pointwise error : %e\n", max_error);
+  }
+
+  // Free dynamically allocated memory.
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&r);
+  CeedVectorDestroy(&p);
+  CeedVectorDestroy(&q);
+  CeedVectorDestroy(&rhs);
+  CeedVectorDestroy(&target);
+  CeedVectorDestroy(&error);
+  CeedVectorDestroy(&qdata);
+  CeedVectorDestroy(&mesh_coords);
+  CeedOperatorDestroy(&oper);
+  CeedOperatorDestroy(&op_error);
+  CeedOperatorDestroy(&op_setupgeo);
+  CeedOperatorDestroy(&op_setuprhs);
+  CeedQFunctionDestroy(&qf_apply);
+  CeedQFunctionDestroy(&qf_error);
+  CeedQFunctionDestroy(&qf_setupgeo);
+  CeedQFunctionDestroy(&qf_setuprhs);
+  CeedElemRestrictionDestroy(&sol_restr);
+  CeedElemRestrictionDestroy(&mesh_restr);
+  CeedElemRestrictionDestroy(&sol_restr_i);
+  CeedElemRestrictionDestroy(&qdata_restr_i);
+  CeedBasisDestroy(&sol_basis);
+  CeedBasisDestroy(&mesh_basis);
+  CeedDestroy(&ceed);
+  return 0;
+}
+
+
+int GetCartesianMeshSize(int dim, int order, int prob_size, int nxyz[3]) {
+  // Use the approximate formula:
+  //    prob_size ~ num_elem * order^dim
+  CeedInt num_elem = prob_size / CeedIntPow(order, dim);
+  CeedInt s = 0;  // find s: num_elem/2 < 2^s <= num_elem
+  while (num_elem > 1) {
+    num_elem /= 2;
+    s++;
+  }
+  CeedInt r = s%dim;
+  for (int d = 0; d < dim; d++) {
+    int sd = s/dim;
+    if (r > 0) { sd++; r--; }
+    nxyz[d] = 1 << sd;
+  }
+  return 0;
+}
+
+int BuildCartesianRestriction(Ceed ceed, int dim, int nxyz[3], int order,
+                              int ncomp, CeedInt *size, CeedInt num_qpts,
+                              CeedElemRestriction *restr,
+                              CeedElemRestriction *restr_i) {
+  CeedInt p = order, pp1 = p+1;
+  CeedInt nnodes = CeedIntPow(pp1, dim); // number of scal. nodes per element
+  CeedInt elem_qpts = CeedIntPow(num_qpts, dim); // number of qpts per element
+  CeedInt nd[3], num_elem = 1, scalar_size = 1;
+  for (int d = 0; d < dim; d++) {
+    num_elem *= nxyz[d];
+    nd[d] = nxyz[d]*p + 1;
+    scalar_size *= nd[d];
+  }
+  *size = scalar_size*ncomp;
+  if (restr) {
+    // elem:         0             1                 n-1
+    //        |---*-...-*---|---*-...-*---|- ... -|--...--|
+    // nnodes:   0   1    p-1  p  p+1       2*p             n*p
+    CeedInt *el_nodes = malloc(sizeof(CeedInt)*num_elem*nnodes);
+    for (CeedInt e = 0; e < num_elem; e++) {
+      CeedInt exyz[3] = {1, 1, 1}, re = e;
+      for (int d = 0; d < dim; d++) { exyz[d] = re%nxyz[d]; re /= nxyz[d]; }
+      CeedInt *loc_el_nodes = el_nodes + e*nnodes;
+      for (int lnodes = 0; lnodes < nnodes; lnodes++) {
+        CeedInt gnodes = 0, gnodes_stride = 1, rnodes = lnodes;
+        for (int d = 0; d < dim; d++) {
+          gnodes += (exyz[d]*p + rnodes%pp1) * gnodes_stride;
+          gnodes_stride *= nd[d];
+          rnodes /= pp1;
+        }
+        loc_el_nodes[lnodes] = gnodes;
+      }
+    }
+    CeedElemRestrictionCreate(ceed, num_elem, nnodes, ncomp, scalar_size,
+                              ncomp*scalar_size, CEED_MEM_HOST,
+                              CEED_COPY_VALUES, el_nodes, restr);
+    free(el_nodes);
+  }
+  if (restr_i)
+    CeedElemRestrictionCreateStrided(ceed, num_elem, elem_qpts,
+                                     ncomp, ncomp*elem_qpts*num_elem,
+                                     CEED_STRIDES_BACKEND, restr_i);
+  return 0;
+}
+
+int SetCartesianMeshCoords(int dim, int nxyz[3], int mesh_order,
+                           CeedVector mesh_coords) {
+  CeedInt p = mesh_order;
+  CeedInt nd[3], num_elem = 1, scalar_size = 1;
+  for (int d = 0; d < dim; d++) {
+    num_elem *= nxyz[d];
+    nd[d] = nxyz[d]*p + 1;
+    scalar_size *= nd[d];
+  }
+  CeedScalar *coords;
+  CeedVectorGetArray(mesh_coords, CEED_MEM_HOST, &coords);
+  CeedScalar *nodes = malloc(sizeof(CeedScalar)*(p+1));
+  // The H1 basis uses Lobatto quadrature points as nodes.
+  CeedLobattoQuadrature(p+1, nodes, NULL); // nodes are in [-1,1]
+  for (CeedInt i = 0; i <= p; i++) { nodes[i] = 0.5+0.5*nodes[i]; }
+  for (CeedInt gsnodes = 0; gsnodes < scalar_size; gsnodes++) {
+    CeedInt rnodes = gsnodes;
+    for (int d = 0; d < dim; d++) {
+      CeedInt d1d = rnodes%nd[d];
+      coords[gsnodes+scalar_size*d] = ((d1d/p)+nodes[d1d%p]) / nxyz[d];
+      rnodes /= nd[d];
+    }
+  }
+  free(nodes);
+  CeedVectorRestoreArray(mesh_coords, &coords);
+  return 0;
+}
+
+int GetBoundaryIndices(int dim, int nxyz[3], int order, int ncomp,
+                       CeedInt *nbc, CeedInt **indices) {
+  CeedInt nd[3], scalar_size = 1, interior_size = 1;
+  for (int d = 0; d < dim; d++) {
+    nd[d] = nxyz[d]*order + 1;
+    scalar_size *= nd[d];
+    interior_size *= nd[d] - 2;
+  }
+  *nbc = 0;
+  *indices = malloc(sizeof(CeedInt)*(scalar_size-interior_size)*ncomp);
+  for (int c = 0; c < ncomp; c++)
+    for (CeedInt gsnodes = 0; gsnodes < scalar_size; gsnodes++) {
+      CeedInt rnodes = gsnodes, boundary = 0;
+      for (int d = 0; d < dim; d++) {
+        CeedInt d1d = rnodes%nd[d];
+        boundary = boundary || d1d == 0 || d1d == nd[d]-1;
+        rnodes /= nd[d];
+      }
+      if (boundary)
+        (*indices)[(*nbc)++] = gsnodes+scalar_size*c;
+    }
+  return 0;
+}
+
+int CGSolve(CeedOperator oper, CeedVector rhs, CeedVector x,
+            CeedInt max_its, CeedScalar rtol, CeedVector r, CeedVector p,
+            CeedVector q, CeedInt *its, CeedScalar *rnorm) {
+  // Start from x = 0, so r = p = rhs
+  CeedScalar rr, rr_new, pq, rhs_norm;
+  CeedVectorSetValue(x, 0.);
+  CeedVectorSetValue(r, 0.);
+  CeedVectorAXPY(r, 1., rhs);
+  CeedVectorSetValue(p, 0.);
+  CeedVectorAXPY(p, 1., rhs);
+  CeedVectorDot(r, r, &rr);
+  rhs_norm = sqrt(rr);
+
+  *its = 0;
+  while (*its < max_its && sqrt(rr) > rtol*rhs_norm) {
+    // q = A p, with the boundary nodes removed for Dirichlet problems; p^T q
+    // is computed with q, sparing a pass over both vectors
+    CeedOperatorApplyDot(oper, p, q, &pq, CEED_REQUEST_IMMEDIATE);
+    const CeedScalar alpha = rr / pq;
+    CeedVectorAXPY(x, alpha, p);
+    CeedVectorAXPY(r, -alpha, q);
+    CeedVectorDot(r, r, &rr_new);
+    // p = r + beta p
+    CeedVectorAXPBY(p, 1., rr_new / rr, r);
+    rr = rr_new;
+    (*its)++;
+  }
+  *rnorm = sqrt(rr);
+  return 0;
+}
@@ -51,6 +51,14 @@ const char help[] = "Solve Navier-Stokes using PETSc and libCEED\n";
 #include "advection2d.h"
 #include "densitycurrent.h"
 
+#if PETSC_VERSION_LT(3,12,0)
+#ifdef PETSC_HAVE_CUDA
+#include <petsccuda.h>
+// Note: With PETSc prior to version 3.12.0, providing the source path to
+//       include 'cublas_v2.h' will be needed to use 'petsccuda.h'.
+#endif
+#endif
+
 #if PETSC_VERSION_LT(3,14,0)
 #  define DMPlexGetClosureIndices(a,b,c,d,e,f,g,h,i) DMPlexGetClosureIndices(a,b,c,d,f,g,i)
 #  define DMPlexRestoreClosureIndices(a,b,c,d,e,f,g,h,i) DMPlexRestoreClosureIndices(a,b,c,d,f,g,i)
@@ -223,11 +231,20 @@ struct User_ {
   DM dm;
   DM dmviz;
   Mat interpviz;
+  PetscInt vizlattice;
+  CeedOperator op_viz;   // Samples the state on a lattice in each element
+  CeedVector vizceed, vizxceed; // Sampled state and lattice coordinates
   Ceed ceed;
   Units units;
   CeedVector qceed, qdotceed, gceed;
+  CeedVector mceed, gownedceed; // Inverse lumped mass and RHS on owned nodes
   CeedOperator op_rhs_vol, op_rhs, op_ifunction_vol, op_ifunction;
   Vec M;
+  CeedMemType memtype;
+  int (*VecGetArray)(Vec, PetscScalar **);
+  int (*VecGetArrayRead)(Vec, const PetscScalar **);
+  int (*VecRestoreArray)(Vec, PetscScalar **);
+  int (*VecRestoreArrayRead)(Vec, const PetscScalar **);
   char outputfolder[PETSC_MAX_PATH_LEN];
   PetscInt contsteps;
 };
@@ -551,25 +568,31 @@ static PetscErrorCode RHS_NS(TS ts, PetscReal t, Vec Q, Vec G, void *userData) {
   ierr = VecZeroEntries(Gloc); CHKERRQ(ierr);
 
   // Ceed Vectors
-  ierr = VecGetArrayRead(Qloc, (const PetscScalar **)&q); CHKERRQ(ierr);
-  ierr = VecGetArray(Gloc, &g); CHKERRQ(ierr);
-  CeedVectorSetArray(user->qceed, CEED_MEM_HOST, CEED_USE_POINTER, q);
-  CeedVectorSetArray(user->gceed, CEED_MEM_HOST, CEED_USE_POINTER, g);
+  ierr = user->VecGetArrayRead(Qloc, (const PetscScalar **)&q); CHKERRQ(ierr);
+  ierr = user->VecGetArray(Gloc, &g); CHKERRQ(ierr);
+  CeedVectorSetArray(user->qceed, user->memtype, CEED_USE_POINTER, q);
+  CeedVectorSetArray(user->gceed, user->memtype, CEED_USE_POINTER, g);
 
   // Apply CEED operator
   CeedOperatorApply(user->op_rhs, user->qceed, user->gceed,
                     CEED_REQUEST_IMMEDIATE);
 
   // Restore vectors
-  ierr = VecRestoreArrayRead(Qloc, (const PetscScalar **)&q); CHKERRQ(ierr);
-  ierr = VecRestoreArray(Gloc, &g); CHKERRQ(ierr);
+  CeedVectorTakeArray(user->qceed, user->memtype, NULL);
+  CeedVectorTakeArray(user->gceed, user->memtype, NULL);
+  ierr = user->VecRestoreArrayRead(Qloc, (const PetscScalar **)&q);
+  CHKERRQ(ierr);
+  ierr = user->VecRestoreArray(Gloc, &g); CHKERRQ(ierr);
 
   ierr = VecZeroEntries(G); CHKERRQ(ierr);
   ierr = DMLocalToGlobal(user->dm, Gloc, ADD_VALUES, G); CHKERRQ(ierr);
 
-  // Inverse of the lumped mass matrix
-  ierr = VecPointwiseMult(G, G, user->M); // M is Minv
-  CHKERRQ(ierr);
+  // Inverse of the lumped mass matrix, applied where G lives
+  ierr = user->VecGetArray(G, &g); CHKERRQ(ierr);
+  CeedVectorSetArray(user->gownedceed, user->memtype, CEED_USE_POINTER, g);
+  CeedVectorPointwiseMult(user->gownedceed, user->gownedceed, user->mceed);
+  CeedVectorTakeArray(user->gownedceed, user->memtype, NULL);
+  ierr = user->VecRestoreArray(G, &g); CHKERRQ(ierr);
 
   ierr = DMRestoreLocalVector(user->dm, &Qloc); CHKERRQ(ierr);
   ierr = DMRestoreLocalVector(user->dm, &Gloc); CHKERRQ(ierr);
@@ -598,23 +621,26 @@ static PetscErrorCode IFunction_NS(TS ts, PetscReal t, Vec Q, Vec Qdot, Vec G,
   ierr = VecZeroEntries(Gloc); CHKERRQ(ierr);
 
   // Ceed Vectors
-  ierr = VecGetArrayRead(Qloc, &q); CHKERRQ(ierr);
-  ierr = VecGetArrayRead(Qdotloc, &qdot); CHKERRQ(ierr);
-  ierr = VecGetArray(Gloc, &g); CHKERRQ(ierr);
-  CeedVectorSetArray(user->qceed, CEED_MEM_HOST, CEED_USE_POINTER,
+  ierr = user->VecGetArrayRead(Qloc, &q); CHKERRQ(ierr);
+  ierr = user->VecGetArrayRead(Qdotloc, &qdot); CHKERRQ(ierr);
+  ierr = user->VecGetArray(Gloc, &g); CHKERRQ(ierr);
+  CeedVectorSetArray(user->qceed, user->memtype, CEED_USE_POINTER,
                      (PetscScalar *)q);
-  CeedVectorSetArray(user->qdotceed, CEED_MEM_HOST, CEED_USE_POINTER,
+  CeedVectorSetArray(user->qdotceed, user->memtype, CEED_USE_POINTER,
                      (PetscScalar *)qdot);
-  CeedVectorSetArray(user->gceed, CEED_MEM_HOST, CEED_USE_POINTER, g);
+  CeedVectorSetArray(user->gceed, user->memtype, CEED_USE_POINTER, g);
 
   // Apply CEED operator
   CeedOperatorApply(user->op_ifunction, user->qceed, user->gceed,
                     CEED_REQUEST_IMMEDIATE);
 
   // Restore vectors
-  ierr = VecRestoreArrayRead(Qloc, &q); CHKERRQ(ierr);
-  ierr = VecRestoreArrayRead(Qdotloc, &qdot); CHKERRQ(ierr);
-  ierr = VecRestoreArray(Gloc, &g); CHKERRQ(ierr);
+  CeedVectorTakeArray(user->qceed, user->memtype, NULL);
+  CeedVectorTakeArray(user->qdotceed, user->memtype, NULL);
+  CeedVectorTakeArray(user->gceed, user->memtype, NULL);
+  ierr = user->VecRestoreArrayRead(Qloc, &q); CHKERRQ(ierr);
+  ierr = user->VecRestoreArrayRead(Qdotloc, &qdot); CHKERRQ(ierr);
+  ierr = user->VecRestoreArray(Gloc, &g); CHKERRQ(ierr);
 
   ierr = VecZeroEntries(G); CHKERRQ(ierr);
   ierr = DMLocalToGlobal(user->dm, Gloc, ADD_VALUES, G); CHKERRQ(ierr);
@@ -625,6 +651,115 @@ static PetscErrorCode IFunction_NS(TS ts, PetscReal t, Vec Q, Vec Qdot, Vec G,
   PetscFunctionReturn(0);
 }
 
+// Write data in the big-endian byte order of legacy VTK binary files
+static PetscErrorCode WriteBigEndian(FILE *fp, const void *data, size_t size,
+                                     size_t count) {
+  const unsigned char *bytes = data;
+  const int one = 1;
+  const PetscBool little = *(const char *)&one;
+  unsigned char buf[4096];
+
+  PetscFunctionBeginUser;
+  if (!little) {
+    if (fwrite(data, size, count, fp) != count)
+      SETERRQ(PETSC_COMM_SELF, PETSC_ERR_FILE_WRITE, "Failed writing file");
+    PetscFunctionReturn(0);
+  }
+  for (size_t i=0; i<count; ) {
+    size_t n = PetscMin(count - i, sizeof buf / size);
+    for (size_t k=0; k<n; k++)
+      for (size_t b=0; b<size; b++)
+        buf[k*size+b] = bytes[(i+k)*size + size - 1 - b];
+    if (fwrite(buf, size, n, fp) != n)
+      SETERRQ(PETSC_COMM_SELF, PETSC_ERR_FILE_WRITE, "Failed writing file");
+    i += n;
+  }
+  PetscFunctionReturn(0);
+}
+
+// Sample the state on the lattice of each local element with libCEED, where
+//   the state lives, and write the samples of this rank as a legacy VTK file
+//   of linear sub-cells; only the samples are copied to the host
+static PetscErrorCode WriteVizLattice(User user, Vec Qloc, PetscInt step) {
+  const PetscScalar *q;
+  const CeedScalar *v, *x;
+  CeedInt nelem, npts, ncompq, len, n = user->vizlattice;
+  PetscInt dim;
+  char filepath[PETSC_MAX_PATH_LEN];
+  PetscMPIInt rank;
+  FILE *fp;
+  PetscErrorCode ierr;
+
+  PetscFunctionBeginUser;
+  ierr = DMGetDimension(user->dm, &dim); CHKERRQ(ierr);
+  ierr = DMPlexInsertBoundaryValues(user->dm, PETSC_TRUE, Qloc, 0.0,
+                                    NULL, NULL, NULL); CHKERRQ(ierr);
+
+  // Sample
+  ierr = user->VecGetArrayRead(Qloc, &q); CHKERRQ(ierr);
+  CeedVectorSetArray(user->qceed, user->memtype, CEED_USE_POINTER,
+                     (PetscScalar *)q);
+  CeedOperatorApply(user->op_viz, user->qceed, user->vizceed,
+                    CEED_REQUEST_IMMEDIATE);
+  CeedVectorTakeArray(user->qceed, user->memtype, NULL);
+  ierr = user->VecRestoreArrayRead(Qloc, &q); CHKERRQ(ierr);
+
+  // Sizes of the sampled data
+  CeedVectorGetLength(user->vizxceed, &len);
+  npts = CeedIntPow(n, dim);
+  nelem = len / (dim*npts);
+  CeedVectorGetLength(user->vizceed, &len);
+  ncompq = nelem ? len / (nelem*npts) : 0;
+  const PetscInt ncells = dim == 3 ? (n-1)*(n-1)*(n-1) : (n-1)*(n-1);
+  const PetscInt nverts = dim == 3 ? 8 : 4;
+
+  // Write
+  ierr = MPI_Comm_rank(user->comm, &rank); CHKERRQ(ierr);
+  ierr = PetscSNPrintf(filepath, sizeof filepath, "%s/nslattice-%03D-%d.vtk",
+                       user->outputfolder, step, rank); CHKERRQ(ierr);
+  ierr = PetscFOpen(PETSC_COMM_SELF, filepath, "wb", &fp); CHKERRQ(ierr);
+  ierr = PetscFPrintf(PETSC_COMM_SELF, fp, "# vtk DataFile Version 3.0\n"
+                      "libCEED fluids lattice output\nBINARY\n"
+                      "DATASET UNSTRUCTURED_GRID\nPOINTS %D double\n",
+                      (PetscInt)(nelem*npts)); CHKERRQ(ierr);
+  CeedVectorGetArrayRead(user->vizxceed, CEED_MEM_HOST, &x);
+  for (CeedInt i=0; i<nelem*npts; i++) {
+    double xyz[3] = {0, 0, 0};
+    for (CeedInt d=0; d<dim; d++)
+      xyz[d] = x[i*dim+d];
+    ierr = WriteBigEndian(fp, xyz, sizeof(double), 3); CHKERRQ(ierr);
+  }
+  CeedVectorRestoreArrayRead(user->vizxceed, &x);
+  ierr = PetscFPrintf(PETSC_COMM_SELF, fp, "\nCELLS %D %D\n",
+                      (PetscInt)nelem*ncells,
+                      (PetscInt)nelem*ncells*(nverts+1)); CHKERRQ(ierr);
+  for (CeedInt e=0; e<nelem; e++)
+    for (CeedInt k=0; k<(dim == 3 ? n-1 : 1); k++)
+      for (CeedInt j=0; j<n-1; j++)
+        for (CeedInt i=0; i<n-1; i++) {
+          const int base = e*npts + i + j*n + k*n*n;
+          const int cell[9] = {nverts, base, base+1, base+n+1, base+n,
+                               base+n*n, base+n*n+1, base+n*n+n+1, base+n*n+n
+                              };
+          ierr = WriteBigEndian(fp, cell, sizeof(int), nverts+1); CHKERRQ(ierr);
+        }
+  ierr = PetscFPrintf(PETSC_COMM_SELF, fp, "\nCELL_TYPES %D\n",
+                      (PetscInt)nelem*ncells); CHKERRQ(ierr);
+  for (PetscInt c=0; c<nelem*ncells; c++) {
+    const int type = dim == 3 ? 12 : 9; // VTK_HEXAHEDRON or VTK_QUAD
+    ierr = WriteBigEndian(fp, &type, sizeof(int), 1); CHKERRQ(ierr);
+  }
+  ierr = PetscFPrintf(PETSC_COMM_SELF, fp, "\nPOINT_DATA %D\nFIELD FieldData 1"
+                      "\nStateVec %D %D double\n", (PetscInt)(nelem*npts),
+                      (PetscInt)ncompq, (PetscInt)(nelem*npts)); CHKERRQ(ierr);
+  CeedVectorGetArrayRead(user->vizceed, CEED_MEM_HOST, &v);
+  ierr = WriteBigEndian(fp, v, sizeof(CeedScalar), nelem*npts*ncompq);
+  CHKERRQ(ierr);
+  CeedVectorRestoreArrayRead(user->vizceed, &v);
+  ierr = PetscFClose(PETSC_COMM_SELF, fp); CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
 // User provided TS Monitor
 static PetscErrorCode TSMonitor_NS(TS ts, PetscInt stepno, PetscReal time,
                                    Vec Q, void *ctx) {
@@ -645,13 +780,18 @@ static PetscErrorCode TSMonitor_NS(TS ts, PetscInt stepno, PetscReal time,
   ierr = DMGlobalToLocal(user->dm, Q, INSERT_VALUES, Qloc); CHKERRQ(ierr);
 
   // Output
-  ierr = PetscSNPrintf(filepath, sizeof filepath, "%s/ns-%03D.vtu",
-                       user->outputfolder, stepno + user->contsteps);
-  CHKERRQ(ierr);
-  ierr = PetscViewerVTKOpen(PetscObjectComm((PetscObject)Q), filepath,
-                            FILE_MODE_WRITE, &viewer); CHKERRQ(ierr);
-  ierr = VecView(Qloc, viewer); CHKERRQ(ierr);
-  ierr = PetscViewerDestroy(&viewer); CHKERRQ(ierr);
+  if (user->vizlattice) {
+    ierr = WriteVizLattice(user, Qloc, stepno + user->contsteps);
+    CHKERRQ(ierr);
+  } else {
+    ierr = PetscSNPrintf(filepath, sizeof filepath, "%s/ns-%03D.vtu",
+                         user->outputfolder, stepno + user->contsteps);
+    CHKERRQ(ierr);
+    ierr = PetscViewerVTKOpen(PetscObjectComm((PetscObject)Q), filepath,
+                              FILE_MODE_WRITE, &viewer); CHKERRQ(ierr);
+    ierr = VecView(Qloc, viewer); CHKERRQ(ierr);
+    ierr = PetscViewerDestroy(&viewer); CHKERRQ(ierr);
+  }
   if (user->dmviz) {
     Vec Qrefined, Qrefined_loc;
     char filepath_refined[PETSC_MAX_PATH_LEN];
@@ -910,7 +1050,7 @@ int main(int argc, char **argv) {
   testType testChoice;
   testData *test = NULL;
   PetscBool implicit;
-  PetscInt    viz_refine = 0;
+  PetscInt    viz_refine = 0, viz_lattice = 0;
   struct SimpleBC_ bc = {
     .nslip = {2, 2, 2},
     .slips = {{5, 6}, {3, 4}, {1, 2}}
@@ -1044,6 +1184,14 @@ int main(int argc, char **argv) {
                          "Regular refinement levels for visualization",
                          NULL, viz_refine, &viz_refine, NULL);
   CHKERRQ(ierr);
+  ierr = PetscOptionsInt("-viz_lattice",
+                         "Output samples on this many points per direction in "
+                         "each element, computed by libCEED",
+                         NULL, viz_lattice, &viz_lattice, NULL);
+  CHKERRQ(ierr);
+  if (viz_lattice == 1)
+    SETERRQ(comm, PETSC_ERR_ARG_OUTOFRANGE,
+            "-viz_lattice needs at least 2 points per direction");
   ierr = PetscOptionsScalar("-units_meter", "1 meter in scaled length units",
                             NULL, meter, &meter, NULL); CHKERRQ(ierr);
   meter = fabs(meter);
@@ -1285,11 +1433,6 @@ int main(int argc, char **argv) {
     }
     dmviz = dmhierarchy[viz_refine];
   }
-  ierr = DMCreateGlobalVector(dm, &Q); CHKERRQ(ierr);
-  ierr = DMGetLocalVector(dm, &Qloc); CHKERRQ(ierr);
-  ierr = VecGetSize(Qloc, &lnodes); CHKERRQ(ierr);
-  lnodes /= ncompq;
-
   // Initialize CEED
   CeedInit(ceedresource, &ceed);
   // Set memtype
@@ -1303,6 +1446,16 @@ int main(int argc, char **argv) {
              "PETSc was not built with CUDA. "
              "Requested MemType CEED_MEM_DEVICE is not supported.", NULL);
 
+  // PETSc vectors live with the libCEED data, so each time step stays in
+  //   device memory on GPU backends
+  if (memtyperequested == CEED_MEM_DEVICE) {
+    ierr = DMSetVecType(dm, VECCUDA); CHKERRQ(ierr);
+  }
+  ierr = DMCreateGlobalVector(dm, &Q); CHKERRQ(ierr);
+  ierr = DMGetLocalVector(dm, &Qloc); CHKERRQ(ierr);
+  ierr = VecGetSize(Qloc, &lnodes); CHKERRQ(ierr);
+  lnodes /= ncompq;
+
   // Set number of 1D nodes and quadrature points
   numP = degree + 1;
   numQ = numP + qextra;
@@ -1355,7 +1508,6 @@ int main(int argc, char **argv) {
 
   // Set up libCEED
   // CEED Bases
-  CeedInit(ceedresource, &ceed);
   CeedBasisCreateTensorH1Lagrange(ceed, dim, ncompq, numP, numQ, CEED_GAUSS,
                                   &basisq);
   CeedBasisCreateTensorH1Lagrange(ceed, dim, ncompx, 2, numQ, CEED_GAUSS,
@@ -1463,6 +1615,58 @@ int main(int argc, char **argv) {
     user->op_ifunction_vol = op;
   }
 
+  // Create the operators that sample the state and the coordinates on the
+  //   Gauss-Lobatto lattice of each element, for output
+  user->vizlattice = viz_lattice;
+  user->op_viz = NULL;
+  user->vizceed = user->vizxceed = NULL;
+  if (viz_lattice) {
+    CeedBasis basisviz, basisxviz;
+    CeedElemRestriction restrictviz, restrictxviz;
+    CeedQFunction qf_viz, qf_vizx;
+    CeedOperator op_vizx;
+    CeedInt nptsviz = CeedIntPow(viz_lattice, dim);
+    CeedInt stridesviz[3] = {ncompq, 1, ncompq*nptsviz};
+    CeedInt stridesxviz[3] = {ncompx, 1, ncompx*nptsviz};
+
+    CeedBasisCreateTensorH1Lagrange(ceed, dim, ncompq, numP, viz_lattice,
+                                    CEED_GAUSS_LOBATTO, &basisviz);
+    CeedBasisCreateTensorH1Lagrange(ceed, dim, ncompx, 2, viz_lattice,
+                                    CEED_GAUSS_LOBATTO, &basisxviz);
+    CeedElemRestrictionCreateStrided(ceed, localNelemVol, nptsviz, ncompq,
+                                     ncompq*localNelemVol*nptsviz, stridesviz,
+                                     &restrictviz);
+    CeedElemRestrictionCreateStrided(ceed, localNelemVol, nptsviz, ncompx,
+                                     ncompx*localNelemVol*nptsviz, stridesxviz,
+                                     &restrictxviz);
+    CeedQFunctionCreateIdentity(ceed, ncompq, CEED_EVAL_INTERP, CEED_EVAL_NONE,
+                                &qf_viz);
+    CeedQFunctionCreateIdentity(ceed, ncompx, CEED_EVAL_INTERP, CEED_EVAL_NONE,
+                                &qf_vizx);
+    CeedOperatorCreate(ceed, qf_viz, NULL, NULL, &user->op_viz);
+    CeedOperatorSetField(user->op_viz, "input", restrictq, basisviz,
+                         CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(user->op_viz, "output", restrictviz,
+                         CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+    CeedOperatorCreate(ceed, qf_vizx, NULL, NULL, &op_vizx);
+    CeedOperatorSetField(op_vizx, "input", restrictx, basisxviz,
+                         CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_vizx, "output", restrictxviz,
+                         CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+    CeedElemRestrictionCreateVector(restrictviz, &user->vizceed, NULL);
+    CeedElemRestrictionCreateVector(restrictxviz, &user->vizxceed, NULL);
+    CeedOperatorApply(op_vizx, xcorners, user->vizxceed,
+                      CEED_REQUEST_IMMEDIATE);
+
+    CeedBasisDestroy(&basisviz);
+    CeedBasisDestroy(&basisxviz);
+    CeedElemRestrictionDestroy(&restrictviz);
+    CeedElemRestrictionDestroy(&restrictxviz);
+    CeedQFunctionDestroy(&qf_viz);
+    CeedQFunctionDestroy(&qf_vizx);
+    CeedOperatorDestroy(&op_vizx);
+  }
+
   // Set up CEED for the boundaries
   CeedInt height = 1;
   CeedInt dimSur = dim - height;
@@ -1580,6 +1784,18 @@ int main(int argc, char **argv) {
   user->dmviz = dmviz;
   user->interpviz = interpviz;
   user->ceed = ceed;
+  user->memtype = memtyperequested;
+  if (memtyperequested == CEED_MEM_HOST) {
+    user->VecGetArray = VecGetArray;
+    user->VecGetArrayRead = VecGetArrayRead;
+    user->VecRestoreArray = VecRestoreArray;
+    user->VecRestoreArrayRead = VecRestoreArrayRead;
+  } else {
+    user->VecGetArray = VecCUDAGetArray;
+    user->VecGetArrayRead = VecCUDAGetArrayRead;
+    user->VecRestoreArray = VecCUDARestoreArray;
+    user->VecRestoreArrayRead = VecCUDARestoreArrayRead;
+  }
 
   // Calculate qdata and ICs
   // Set up state global and local vectors
@@ -1592,6 +1808,19 @@ int main(int argc, char **argv) {
   CeedOperatorApply(op_setupVol, xcorners, qdata, CEED_REQUEST_IMMEDIATE);
   ierr = ComputeLumpedMassMatrix(ceed, dm, restrictq, basisq, restrictqdi, qdata,
                                  user->M); CHKERRQ(ierr);
+  {
+    // Keep the inverse lumped mass in libCEED to apply it in RHS_NS
+    const PetscScalar *m;
+    PetscInt odofs;
+
+    ierr = VecGetLocalSize(user->M, &odofs); CHKERRQ(ierr);
+    CeedVectorCreate(ceed, odofs, &user->mceed);
+    CeedVectorCreate(ceed, odofs, &user->gownedceed);
+    ierr = user->VecGetArrayRead(user->M, &m); CHKERRQ(ierr);
+    CeedVectorSetArray(user->mceed, user->memtype, CEED_COPY_VALUES,
+                       (PetscScalar *)m);
+    ierr = user->VecRestoreArrayRead(user->M, &m); CHKERRQ(ierr);
+  }
 
   ierr = ICs_FixMultiplicity(op_ics, xcorners, q0ceed, dm, Qloc, Q, restrictq,
                              ctxSetup, 0.0); CHKERRQ(ierr);
@@ -1755,6 +1984,10 @@ int main(int argc, char **argv) {
   CeedVectorDestroy(&user->qceed);
   CeedVectorDestroy(&user->qdotceed);
   CeedVectorDestroy(&user->gceed);
+  CeedVectorDestroy(&user->mceed);
+  CeedVectorDestroy(&user->gownedceed);
+  CeedVectorDestroy(&user->vizceed);
+  CeedVectorDestroy(&user->vizxceed);
   CeedVectorDestroy(&xcorners);
   CeedBasisDestroy(&basisq);
   CeedBasisDestroy(&basisx);
@@ -1774,6 +2007,13 @@ int main(int argc, char **argv) {
   CeedOperatorDestroy(&op_ics);
   CeedOperatorDestroy(&user->op_rhs_vol);
   CeedOperatorDestroy(&user->op_ifunction_vol);
+  CeedOperatorDestroy(&user->op_viz);
+  // libCEED profile of rank 0, when enabled with CEED_PROFILE
+  if (testChoice == TEST_NONE) {
+    bool profiling;
+    CeedIsProfiling(ceed, &profiling);
+    if (profiling && !rank) CeedView(ceed, stdout);
+  }
   CeedDestroy(&ceed);
   CeedBasisDestroy(&basisqSur);
   CeedBasisDestroy(&basisxSur);
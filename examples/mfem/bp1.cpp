@@ -24,6 +24,7 @@
 //     ./bp1
 //     ./bp1 -ceed /cpu/self
 //     ./bp1 -ceed /gpu/cuda
+//     ./bp1 -ceed /gpu/cuda -d cuda
 //     ./bp1 -m ../../../mfem/data/fichera.mesh
 //     ./bp1 -m ../../../mfem/data/star.vtk -o 3
 //     ./bp1 -m ../../../mfem/data/inline-segment.mesh -o 8
@@ -44,6 +45,7 @@ double solution(const mfem::Vector &pt) {
 int main(int argc, char *argv[]) {
   // 1. Parse command-line options.
   const char *ceed_spec = "/cpu/self";
+  const char *device_config = "cpu";
   #ifndef MFEM_DIR
   const char *mesh_file = "../../../mfem/data/star.mesh";
   #else
@@ -56,6 +58,8 @@ int main(int argc, char *argv[]) {
 
   mfem::OptionsParser args(argc, argv);
   args.AddOption(&ceed_spec, "-c", "-ceed", "Ceed specification.");
+  args.AddOption(&device_config, "-d", "--device",
+                 "MFEM device configuration string, see Device::Configure().");
   args.AddOption(&mesh_file, "-m", "--mesh", "Mesh file to use.");
   args.AddOption(&order, "-o", "--order",
                  "Finite element order (polynomial degree).");
@@ -75,9 +79,15 @@ int main(int argc, char *argv[]) {
     args.PrintOptions(std::cout);
   }
 
-  // 2. Initialize a Ceed device object using the given Ceed specification.
+  // 2. Initialize a Ceed device object using the given Ceed specification and
+  //    the MFEM device. When both run on the GPU, MFEM vectors are passed to
+  //    libCEED as device pointers.
   Ceed ceed;
   CeedInit(ceed_spec, &ceed);
+  mfem::Device device(device_config);
+  if (!test) {
+    device.Print();
+  }
 
   // 3. Read the mesh from the given mesh file.
   mfem::Mesh *mesh = new mfem::Mesh(mesh_file, 1, 1);
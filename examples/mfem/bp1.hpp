@@ -31,13 +31,15 @@ class CeedMassOperator : public mfem::Operator {
   CeedQFunction apply_qfunc, build_qfunc;
   CeedQFunctionContext build_ctx;
   CeedVector node_coords, qdata;
+  CeedMemType mem_type;
+  bool use_device;
   CeedVector u, v;
 
   BuildContext build_ctx_data;
 
   static void FESpace2Ceed(const mfem::FiniteElementSpace *fes,
                            const mfem::IntegrationRule &ir,
-                           Ceed ceed, CeedBasis *basis,
+                           Ceed ceed, bool use_device, CeedBasis *basis,
                            CeedElemRestriction *restr) {
     mfem::Mesh *mesh = fes->GetMesh();
     const mfem::FiniteElement *fe = fes->GetFE(0);
@@ -104,8 +106,9 @@ class CeedMassOperator : public mfem::Operator {
     CeedElemRestrictionCreate(ceed, mesh->GetNE(), fe->GetDof(),
                               fes->GetVDim(), fes->GetNDofs(),
                               (fes->GetVDim())*(fes->GetNDofs()),
-                              CEED_MEM_HOST, CEED_COPY_VALUES,
-                              tp_el_dof.GetData(), restr);
+                              use_device ? CEED_MEM_DEVICE : CEED_MEM_HOST,
+                              CEED_COPY_VALUES, tp_el_dof.Read(use_device),
+                              restr);
   }
 
  public:
@@ -121,11 +124,19 @@ class CeedMassOperator : public mfem::Operator {
     CeedInt nelem = mesh->GetNE(), dim = mesh->SpaceDimension(),
             ncompx = dim, nqpts;
 
-    FESpace2Ceed(fes, ir, ceed, &basis, &restr);
+    // Share device memory with MFEM when both MFEM and libCEED run on the
+    // device; otherwise, exchange data through host memory.
+    CeedGetPreferredMemType(ceed, &mem_type);
+    use_device = mfem::Device::Allows(mfem::Backend::DEVICE_MASK) &&
+                 mem_type == CEED_MEM_DEVICE;
+    mem_type = use_device ? CEED_MEM_DEVICE : CEED_MEM_HOST;
+
+    FESpace2Ceed(fes, ir, ceed, use_device, &basis, &restr);
 
     const mfem::FiniteElementSpace *mesh_fes = mesh->GetNodalFESpace();
     MFEM_VERIFY(mesh_fes, "the Mesh has no nodal FE space");
-    FESpace2Ceed(mesh_fes, ir, ceed, &mesh_basis, &mesh_restr);
+    FESpace2Ceed(mesh_fes, ir, ceed, use_device, &mesh_basis,
+                 &mesh_restr);
     CeedBasisGetNumQuadraturePoints(basis, &nqpts);
 
     CeedInt strides[3] = {1, nqpts, nqpts};
@@ -133,8 +144,9 @@ class CeedMassOperator : public mfem::Operator {
                                      strides, &restr_i);
 
     CeedVectorCreate(ceed, mesh->GetNodes()->Size(), &node_coords);
-    CeedVectorSetArray(node_coords, CEED_MEM_HOST, CEED_USE_POINTER,
-                       mesh->GetNodes()->GetData());
+    CeedVectorSetArray(node_coords, mem_type, CEED_USE_POINTER,
+                       const_cast<CeedScalar *>(
+                         mesh->GetNodes()->Read(use_device)));
 
     CeedVectorCreate(ceed, nelem*nqpts, &qdata);
 
@@ -207,9 +219,10 @@ class CeedMassOperator : public mfem::Operator {
 
   /// Operator action
   virtual void Mult(const mfem::Vector &x, mfem::Vector &y) const {
-    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_USE_POINTER, x.GetData());
-    CeedVectorSetArray(v, CEED_MEM_HOST, CEED_USE_POINTER, y.GetData());
+    CeedVectorSetArray(u, mem_type, CEED_USE_POINTER,
+                       const_cast<CeedScalar *>(x.Read(use_device)));
+    CeedVectorSetArray(v, mem_type, CEED_USE_POINTER, y.Write(use_device));
     CeedOperatorApply(oper, u, v, CEED_REQUEST_IMMEDIATE);
-    CeedVectorSyncArray(v, CEED_MEM_HOST);
+    CeedVectorSyncArray(v, mem_type);
   }
 };
@@ -24,6 +24,7 @@
 //     ./bp3
 //     ./bp3 -ceed /cpu/self
 //     ./bp3 -ceed /gpu/cuda
+//     ./bp3 -ceed /gpu/cuda -d cuda
 //     ./bp3 -m ../../../mfem/data/fichera.mesh -o 4
 //     ./bp3 -m ../../../mfem/data/square-disc-nurbs.mesh -o 6
 //     ./bp3 -m ../../../mfem/data/inline-segment.mesh -o 8
@@ -67,6 +68,7 @@ double rhs(const mfem::Vector &pt) {
 int main(int argc, char *argv[]) {
   // 1. Parse command-line options.
   const char *ceed_spec = "/cpu/self";
+  const char *device_config = "cpu";
   #ifndef MFEM_DIR
   const char *mesh_file = "../../../mfem/data/star.mesh";
   #else
@@ -79,6 +81,8 @@ int main(int argc, char *argv[]) {
 
   mfem::OptionsParser args(argc, argv);
   args.AddOption(&ceed_spec, "-c", "-ceed", "Ceed specification.");
+  args.AddOption(&device_config, "-d", "--device",
+                 "MFEM device configuration string, see Device::Configure().");
   args.AddOption(&mesh_file, "-m", "--mesh", "Mesh file to use.");
   args.AddOption(&order, "-o", "--order",
                  "Finite element order (polynomial degree).");
@@ -98,9 +102,15 @@ int main(int argc, char *argv[]) {
     args.PrintOptions(std::cout);
   }
 
-  // 2. Initialize a Ceed device object using the given Ceed specification.
+  // 2. Initialize a Ceed device object using the given Ceed specification and
+  //    the MFEM device. When both run on the GPU, MFEM vectors are passed to
+  //    libCEED as device pointers.
   Ceed ceed;
   CeedInit(ceed_spec, &ceed);
+  mfem::Device device(device_config);
+  if (!test) {
+    device.Print();
+  }
 
   // 3. Read the mesh from the given mesh file.
   mfem::Mesh *mesh = new mfem::Mesh(mesh_file, 1, 1);
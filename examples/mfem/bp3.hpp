@@ -31,6 +31,8 @@ class CeedDiffusionOperator : public mfem::Operator {
   CeedQFunction apply_qfunc, build_qfunc;
   CeedQFunctionContext build_ctx;
   CeedVector node_coords, qdata;
+  CeedMemType mem_type;
+  bool use_device;
 
   BuildContext build_ctx_data;
 
@@ -38,7 +40,7 @@ class CeedDiffusionOperator : public mfem::Operator {
 
   static void FESpace2Ceed(const mfem::FiniteElementSpace *fes,
                            const mfem::IntegrationRule &ir,
-                           Ceed ceed, CeedBasis *basis,
+                           Ceed ceed, bool use_device, CeedBasis *basis,
                            CeedElemRestriction *restr) {
     mfem::Mesh *mesh = fes->GetMesh();
     const mfem::FiniteElement *fe = fes->GetFE(0);
@@ -105,8 +107,9 @@ class CeedDiffusionOperator : public mfem::Operator {
     CeedElemRestrictionCreate(ceed, mesh->GetNE(), fe->GetDof(),
                               fes->GetVDim(), fes->GetNDofs(),
                               (fes->GetVDim())*(fes->GetNDofs()),
-                              CEED_MEM_HOST, CEED_COPY_VALUES,
-                              tp_el_dof.GetData(), restr);
+                              use_device ? CEED_MEM_DEVICE : CEED_MEM_HOST,
+                              CEED_COPY_VALUES, tp_el_dof.Read(use_device),
+                              restr);
   }
 
  public:
@@ -122,11 +125,19 @@ class CeedDiffusionOperator : public mfem::Operator {
     CeedInt nelem = mesh->GetNE(), dim = mesh->SpaceDimension(),
             ncompx = dim, nqpts;
 
-    FESpace2Ceed(fes, ir, ceed, &basis, &restr);
+    // Share device memory with MFEM when both MFEM and libCEED run on the
+    // device; otherwise, exchange data through host memory.
+    CeedGetPreferredMemType(ceed, &mem_type);
+    use_device = mfem::Device::Allows(mfem::Backend::DEVICE_MASK) &&
+                 mem_type == CEED_MEM_DEVICE;
+    mem_type = use_device ? CEED_MEM_DEVICE : CEED_MEM_HOST;
+
+    FESpace2Ceed(fes, ir, ceed, use_device, &basis, &restr);
 
     const mfem::FiniteElementSpace *mesh_fes = mesh->GetNodalFESpace();
     MFEM_VERIFY(mesh_fes, "the Mesh has no nodal FE space");
-    FESpace2Ceed(mesh_fes, ir, ceed, &mesh_basis, &mesh_restr);
+    FESpace2Ceed(mesh_fes, ir, ceed, use_device, &mesh_basis,
+                 &mesh_restr);
     CeedBasisGetNumQuadraturePoints(basis, &nqpts);
 
     CeedInt strides[3] = {1, nqpts, nqpts *dim *(dim+1)/2};
@@ -135,8 +146,9 @@ class CeedDiffusionOperator : public mfem::Operator {
                                      &restr_i);
 
     CeedVectorCreate(ceed, mesh->GetNodes()->Size(), &node_coords);
-    CeedVectorSetArray(node_coords, CEED_MEM_HOST, CEED_USE_POINTER,
-                       mesh->GetNodes()->GetData());
+    CeedVectorSetArray(node_coords, mem_type, CEED_USE_POINTER,
+                       const_cast<CeedScalar *>(
+                         mesh->GetNodes()->Read(use_device)));
 
     CeedVectorCreate(ceed, nelem*nqpts*dim*(dim+1)/2, &qdata);
 
@@ -209,10 +221,11 @@ class CeedDiffusionOperator : public mfem::Operator {
 
   /// Operator action
   virtual void Mult(const mfem::Vector &x, mfem::Vector &y) const {
-    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_USE_POINTER, x.GetData());
-    CeedVectorSetArray(v, CEED_MEM_HOST, CEED_USE_POINTER, y.GetData());
+    CeedVectorSetArray(u, mem_type, CEED_USE_POINTER,
+                       const_cast<CeedScalar *>(x.Read(use_device)));
+    CeedVectorSetArray(v, mem_type, CEED_USE_POINTER, y.Write(use_device));
 
     CeedOperatorApply(oper, u, v, CEED_REQUEST_IMMEDIATE);
-    CeedVectorSyncArray(v, CEED_MEM_HOST);
+    CeedVectorSyncArray(v, mem_type);
   }
 };
@@ -33,6 +33,7 @@
 //     ./bps -problem bp4 -degree 3
 //     ./bps -problem bp5 -degree 3 -ceed /cpu/self
 //     ./bps -problem bp6 -degree 3 -ceed /gpu/cuda
+//     mpiexec -n 4 ./bps -problem bp3 -degree 3 -overlap
 //
 //TESTARGS -ceed {ceed_resource} -test -problem bp5 -degree 3 -ksp_max_it_clip 15,15
 
@@ -77,7 +78,7 @@ typedef struct RunParams_ *RunParams;
 struct RunParams_ {
   MPI_Comm comm;
   PetscBool test_mode, read_mesh, userlnodes, setmemtyperequest,
-            petschavecuda, write_solution;
+            petschavecuda, write_solution, overlap;
   char *filename, *hostname;
   PetscInt localnodes, degree, qextra, dim, ncompu, *melem;
   PetscInt ksp_max_it_clip[2];
@@ -199,10 +200,13 @@ static PetscErrorCode RunWithDM(RunParams rp, DM dm,
   CeedVectorCreate(ceed, xlsize, &rhsceed);
   CeedVectorSetArray(rhsceed, rp->memtyperequested, CEED_USE_POINTER, r);
 
-  ierr = PetscMalloc1(1, &ceeddata); CHKERRQ(ierr);
+  ierr = PetscCalloc1(1, &ceeddata); CHKERRQ(ierr);
   ierr = SetupLibceedByDegree(dm, ceed, rp->degree, rp->dim, rp->qextra,
                               rp->ncompu, gsize, xlsize, rp->bpchoice, ceeddata,
                               true, rhsceed, &target); CHKERRQ(ierr);
+  if (rp->overlap) {
+    ierr = SetupLibceedSplit(dm, ceeddata); CHKERRQ(ierr);
+  }
 
   // Gather RHS
   CeedVectorTakeArray(rhsceed, rp->memtyperequested, NULL);
@@ -241,6 +245,8 @@ static PetscErrorCode RunWithDM(RunParams rp, DM dm,
   userO->xceed = ceeddata->xceed;
   userO->yceed = ceeddata->yceed;
   userO->op = ceeddata->opapply;
+  userO->opinterior = ceeddata->opsplit[0];
+  userO->opboundary = ceeddata->opsplit[1];
   userO->ceed = ceed;
   userO->memtype = rp->memtyperequested;
   if (rp->memtyperequested == CEED_MEM_HOST) {
@@ -378,6 +384,15 @@ static PetscErrorCode RunWithDM(RunParams rp, DM dm,
   CeedVectorDestroy(&target);
   CeedQFunctionDestroy(&qferror);
   CeedOperatorDestroy(&operror);
+
+  // libCEED profile of rank 0, when enabled with CEED_PROFILE
+  if (!rp->test_mode) {
+    bool profiling;
+    PetscMPIInt rank;
+    CeedIsProfiling(ceed, &profiling);
+    ierr = MPI_Comm_rank(rp->comm, &rank); CHKERRQ(ierr);
+    if (profiling && !rank) CeedView(ceed, stdout);
+  }
   CeedDestroy(&ceed);
   PetscFunctionReturn(0);
 }
@@ -515,6 +530,10 @@ int main(int argc, char **argv) {
   ierr = PetscOptionsBool("-write_solution", "Write solution for visualization",
                           NULL, rp->write_solution, &rp->write_solution, NULL);
   CHKERRQ(ierr);
+  rp->overlap = PETSC_FALSE;
+  ierr = PetscOptionsBool("-overlap",
+                          "Apply interior elements during the ghost update",
+                          NULL, rp->overlap, &rp->overlap, NULL); CHKERRQ(ierr);
   degree[0] = rp->test_mode ? 3 : 2;
   ierr = PetscOptionsIntArray("-degree",
                               "Polynomial degree of tensor product basis", NULL,
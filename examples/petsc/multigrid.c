@@ -31,6 +31,7 @@
 //     multigrid -problem bp4
 //     multigrid -problem bp5 -ceed /cpu/self
 //     multigrid -problem bp6 -ceed /gpu/cuda
+//     multigrid -problem bp3 -degree 4 -ceed /gpu/cuda -ceed_coarse /cpu/self
 //
 //TESTARGS -ceed {ceed_resource} -test -problem bp3 -degree 3
 
@@ -45,10 +46,12 @@ int main(int argc, char **argv) {
   PetscInt ierr;
   MPI_Comm comm;
   char filename[PETSC_MAX_PATH_LEN],
-       ceedresource[PETSC_MAX_PATH_LEN] = "/cpu/self";
+       ceedresource[PETSC_MAX_PATH_LEN] = "/cpu/self",
+       ceedresourcecoarse[PETSC_MAX_PATH_LEN] = "";
   double my_rt_start, my_rt, rt_min, rt_max;
   PetscInt degree = 3, qextra, *lsize, *xlsize, *gsize, dim = 3, fineLevel,
-           melem[3] = {3, 3, 3}, ncompu = 1, numlevels = degree, *leveldegrees;
+           melem[3] = {3, 3, 3}, ncompu = 1, numlevels = degree, *leveldegrees,
+           coarselevels = 1;
   PetscScalar *r;
   PetscBool test_mode, benchmark_mode, read_mesh, write_solution;
   PetscLogStage solvestage;
@@ -60,11 +63,11 @@ int main(int argc, char **argv) {
   Vec *X, *Xloc, *mult, rhs, rhsloc;
   UserO *userO;
   UserProlongRestr *userPR;
-  Ceed ceed;
+  Ceed ceed, ceedcoarse = NULL, *levelceed;
   CeedData *ceeddata;
-  CeedMemType memtyperequested;
+  CeedMemType memtyperequested, memtypecoarse, *levelmemtype;
   CeedVector rhsceed, target;
-  CeedQFunction qferror, qfrestrict, qfprolong;
+  CeedQFunction qferror;
   CeedOperator operror;
   bpType bpchoice;
   coarsenType coarsen;
@@ -116,6 +119,14 @@ int main(int argc, char **argv) {
   ierr = PetscOptionsString("-ceed", "CEED resource specifier",
                             NULL, ceedresource, ceedresource,
                             sizeof(ceedresource), NULL); CHKERRQ(ierr);
+  ierr = PetscOptionsString("-ceed_coarse",
+                            "CEED resource specifier for the coarse levels",
+                            NULL, ceedresourcecoarse, ceedresourcecoarse,
+                            sizeof(ceedresourcecoarse), NULL); CHKERRQ(ierr);
+  ierr = PetscOptionsInt("-ceed_coarse_levels",
+                         "Number of coarsest levels using -ceed_coarse",
+                         NULL, coarselevels, &coarselevels, NULL);
+  CHKERRQ(ierr);
   coarsen = COARSEN_UNIFORM;
   ierr = PetscOptionsEnum("-coarsen",
                           "Coarsening strategy to use", NULL,
@@ -151,6 +162,15 @@ int main(int argc, char **argv) {
              "PETSc was not built with CUDA. "
              "Requested MemType CEED_MEM_DEVICE is not supported.", NULL);
 
+  // Coarse levels on another CEED resource, such as the CPU for a GPU run
+  memtypecoarse = memtyperequested;
+  if (ceedresourcecoarse[0]) {
+    CeedInit(ceedresourcecoarse, &ceedcoarse);
+    CeedGetPreferredMemType(ceedcoarse, &memtypecoarse);
+    if (!petschavecuda)
+      memtypecoarse = CEED_MEM_HOST;
+  }
+
   // Setup DM
   if (read_mesh) {
     ierr = DMPlexCreateFromFile(PETSC_COMM_WORLD, filename, PETSC_TRUE, &dmorig);
@@ -205,6 +225,15 @@ int main(int argc, char **argv) {
   ierr = PetscMalloc1(numlevels, &lsize); CHKERRQ(ierr);
   ierr = PetscMalloc1(numlevels, &xlsize); CHKERRQ(ierr);
   ierr = PetscMalloc1(numlevels, &gsize); CHKERRQ(ierr);
+  ierr = PetscMalloc1(numlevels, &levelceed); CHKERRQ(ierr);
+  ierr = PetscMalloc1(numlevels, &levelmemtype); CHKERRQ(ierr);
+
+  // The fine level always uses the -ceed resource
+  for (CeedInt i=0; i<numlevels; i++) {
+    PetscBool coarse = ceedcoarse && i < coarselevels && i < fineLevel;
+    levelceed[i] = coarse ? ceedcoarse : ceed;
+    levelmemtype[i] = coarse ? memtypecoarse : memtyperequested;
+  }
 
   // Setup DM and Operator Mat Shells for each level
   for (CeedInt i=0; i<numlevels; i++) {
@@ -214,7 +243,7 @@ int main(int argc, char **argv) {
     CHKERRQ(ierr);
 
     // Create vectors
-    if (memtyperequested == CEED_MEM_DEVICE) {
+    if (levelmemtype[i] == CEED_MEM_DEVICE) {
       ierr = DMSetVecType(dm[i], VECCUDA); CHKERRQ(ierr);
     }
     ierr = DMCreateGlobalVector(dm[i], &X[i]); CHKERRQ(ierr);
@@ -231,7 +260,7 @@ int main(int argc, char **argv) {
                                 (void(*)(void))MatMult_Ceed); CHKERRQ(ierr);
     ierr = MatShellSetOperation(matO[i], MATOP_GET_DIAGONAL,
                                 (void(*)(void))MatGetDiag); CHKERRQ(ierr);
-    if (memtyperequested == CEED_MEM_DEVICE) {
+    if (levelmemtype[i] == CEED_MEM_DEVICE) {
       ierr = MatShellSetVecType(matO[i], VECCUDA); CHKERRQ(ierr);
     }
 
@@ -247,7 +276,7 @@ int main(int argc, char **argv) {
       ierr = MatShellSetOperation(matPR[i], MATOP_MULT_TRANSPOSE,
                                   (void(*)(void))MatMult_Restrict);
       CHKERRQ(ierr);
-      if (memtyperequested == CEED_MEM_DEVICE) {
+      if (levelmemtype[i] == CEED_MEM_DEVICE) {
         ierr = MatShellSetVecType(matPR[i], VECCUDA); CHKERRQ(ierr);
       }
     }
@@ -286,6 +315,14 @@ int main(int argc, char **argv) {
                        CeedMemTypes[memtyperequested] : "none",
                        P, Q, gsize[fineLevel]/ncompu, lsize[fineLevel]/ncompu,
                        ncompu, numlevels); CHKERRQ(ierr);
+    if (ceedcoarse) {
+      CeedGetResource(ceedcoarse, &usedresource);
+      ierr = PetscPrintf(comm,
+                         "    Coarse Levels libCEED Backend      : %s\n"
+                         "    Number of Coarse Backend Levels    : %D\n",
+                         usedresource, PetscMin(coarselevels, fineLevel));
+      CHKERRQ(ierr);
+    }
   }
 
   // Create RHS vector
@@ -311,9 +348,9 @@ int main(int argc, char **argv) {
                          i, (i? "fine" : "coarse"), leveldegrees[i] + 1,
                          gsize[i]/ncompu, lsize[i]/ncompu); CHKERRQ(ierr);
     }
-    ierr = PetscMalloc1(1, &ceeddata[i]); CHKERRQ(ierr);
-    ierr = SetupLibceedByDegree(dm[i], ceed, leveldegrees[i], dim, qextra,
-                                ncompu, gsize[i], xlsize[i], bpchoice,
+    ierr = PetscCalloc1(1, &ceeddata[i]); CHKERRQ(ierr);
+    ierr = SetupLibceedByDegree(dm[i], levelceed[i], leveldegrees[i], dim,
+                                qextra, ncompu, gsize[i], xlsize[i], bpchoice,
                                 ceeddata[i], i==(fineLevel), rhsceed, &target);
     CHKERRQ(ierr);
   }
@@ -329,16 +366,9 @@ int main(int argc, char **argv) {
   ierr = DMLocalToGlobal(dm[fineLevel], rhsloc, ADD_VALUES, rhs); CHKERRQ(ierr);
   CeedVectorDestroy(&rhsceed);
 
-  // Create the restriction/interpolation QFunction
-  CeedQFunctionCreateIdentity(ceed, ncompu, CEED_EVAL_NONE, CEED_EVAL_INTERP,
-                              &qfrestrict);
-  CeedQFunctionCreateIdentity(ceed, ncompu, CEED_EVAL_INTERP, CEED_EVAL_NONE,
-                              &qfprolong);
-
   // Set up libCEED level transfer operators
-  ierr = CeedLevelTransferSetup(ceed, numlevels, ncompu, bpchoice, ceeddata,
-                                leveldegrees, qfrestrict, qfprolong);
-  CHKERRQ(ierr);
+  ierr = CeedLevelTransferSetup(dm, numlevels, ncompu, bpchoice, ceeddata,
+                                leveldegrees); CHKERRQ(ierr);
 
   // Create the error QFunction
   CeedQFunctionCreateInterior(ceed, 1, bpOptions[bpchoice].error,
@@ -402,9 +432,11 @@ int main(int argc, char **argv) {
     userO[i]->xceed = ceeddata[i]->xceed;
     userO[i]->yceed = ceeddata[i]->yceed;
     userO[i]->op = ceeddata[i]->opapply;
-    userO[i]->ceed = ceed;
-    userO[i]->memtype = memtyperequested;
-    if (memtyperequested == CEED_MEM_HOST) {
+    userO[i]->opinterior = NULL;
+    userO[i]->opboundary = NULL;
+    userO[i]->ceed = levelceed[i];
+    userO[i]->memtype = levelmemtype[i];
+    if (levelmemtype[i] == CEED_MEM_HOST) {
       userO[i]->VecGetArray = VecGetArray;
       userO[i]->VecGetArrayRead = VecGetArrayRead;
       userO[i]->VecRestoreArray = VecRestoreArray;
@@ -428,12 +460,18 @@ int main(int argc, char **argv) {
       userPR[i]->ceedvecf = userO[i]->yceed;
       userPR[i]->opprolong = ceeddata[i]->opprolong;
       userPR[i]->oprestrict = ceeddata[i]->oprestrict;
-      userPR[i]->ceed = ceed;
+      userPR[i]->ceed = levelceed[i];
       userPR[i]->memtype = userO[i]->memtype;
       userPR[i]->VecGetArray = userO[i]->VecGetArray;
       userPR[i]->VecGetArrayRead = userO[i]->VecGetArrayRead;
       userPR[i]->VecRestoreArray = userO[i]->VecRestoreArray;
       userPR[i]->VecRestoreArrayRead = userO[i]->VecRestoreArrayRead;
+      // The coarse level may use another memory space
+      userPR[i]->memtypec = userO[i-1]->memtype;
+      userPR[i]->VecGetArrayc = userO[i-1]->VecGetArray;
+      userPR[i]->VecGetArrayReadc = userO[i-1]->VecGetArrayRead;
+      userPR[i]->VecRestoreArrayc = userO[i-1]->VecRestoreArray;
+      userPR[i]->VecRestoreArrayReadc = userO[i-1]->VecRestoreArrayRead;
     }
   }
 
@@ -653,6 +691,8 @@ int main(int argc, char **argv) {
   ierr = PetscFree(lsize); CHKERRQ(ierr);
   ierr = PetscFree(xlsize); CHKERRQ(ierr);
   ierr = PetscFree(gsize); CHKERRQ(ierr);
+  ierr = PetscFree(levelceed); CHKERRQ(ierr);
+  ierr = PetscFree(levelmemtype); CHKERRQ(ierr);
   ierr = VecDestroy(&rhs); CHKERRQ(ierr);
   ierr = VecDestroy(&rhsloc); CHKERRQ(ierr);
   ierr = MatDestroy(&matcoarse); CHKERRQ(ierr);
@@ -661,9 +701,17 @@ int main(int argc, char **argv) {
   ierr = DMDestroy(&dmorig); CHKERRQ(ierr);
   CeedVectorDestroy(&target);
   CeedQFunctionDestroy(&qferror);
-  CeedQFunctionDestroy(&qfrestrict);
-  CeedQFunctionDestroy(&qfprolong);
   CeedOperatorDestroy(&operror);
+
+  // libCEED profile of rank 0, when enabled with CEED_PROFILE
+  if (!test_mode) {
+    bool profiling;
+    PetscMPIInt rank;
+    CeedIsProfiling(ceed, &profiling);
+    ierr = MPI_Comm_rank(comm, &rank); CHKERRQ(ierr);
+    if (profiling && !rank) CeedView(ceed, stdout);
+  }
+  CeedDestroy(&ceedcoarse);
   CeedDestroy(&ceed);
   return PetscFinalize();
 }
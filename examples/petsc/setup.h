@@ -59,6 +59,7 @@ struct UserO_ {
   Vec Xloc, Yloc;
   CeedVector xceed, yceed;
   CeedOperator op;
+  CeedOperator opinterior, opboundary; // Element split for overlap, or NULL
   Ceed ceed;
   CeedMemType memtype;
   int (*VecGetArray)(Vec, PetscScalar **);
@@ -81,6 +82,12 @@ struct UserProlongRestr_ {
   int (*VecGetArrayRead)(Vec, const PetscScalar **);
   int (*VecRestoreArray)(Vec, PetscScalar **);
   int (*VecRestoreArrayRead)(Vec, const PetscScalar **);
+  // Coarse level memory space, when its libCEED resource differs
+  CeedMemType memtypec;
+  int (*VecGetArrayc)(Vec, PetscScalar **);
+  int (*VecGetArrayReadc)(Vec, const PetscScalar **);
+  int (*VecRestoreArrayc)(Vec, PetscScalar **);
+  int (*VecRestoreArrayReadc)(Vec, const PetscScalar **);
 };
 
 // -----------------------------------------------------------------------------
@@ -93,9 +100,11 @@ struct CeedData_ {
   Ceed ceed;
   CeedBasis basisx, basisu, basisctof;
   CeedElemRestriction Erestrictx, Erestrictu, Erestrictui, Erestrictqdi;
+  CeedElemRestriction Erestrictuc; // Coarse Erestrictu on this level's Ceed
   CeedQFunction qfapply;
   CeedOperator opapply, oprestrict, opprolong;
   CeedVector qdata, xceed, yceed;
+  CeedOperator opsplit[2]; // Interior [0] and ghost-adjacent [1] opapply
 };
 
 // -----------------------------------------------------------------------------
@@ -430,10 +439,13 @@ static PetscErrorCode CeedDataDestroy(CeedInt i, CeedData data) {
   CeedElemRestrictionDestroy(&data->Erestrictqdi);
   CeedQFunctionDestroy(&data->qfapply);
   CeedOperatorDestroy(&data->opapply);
+  CeedOperatorDestroy(&data->opsplit[0]);
+  CeedOperatorDestroy(&data->opsplit[1]);
   if (i > 0) {
     CeedOperatorDestroy(&data->opprolong);
     CeedBasisDestroy(&data->basisctof);
     CeedOperatorDestroy(&data->oprestrict);
+    CeedElemRestrictionDestroy(&data->Erestrictuc);
   }
   ierr = PetscFree(data); CHKERRQ(ierr);
 
@@ -633,6 +645,7 @@ static int SetupLibceedByDegree(DM dm, Ceed ceed, CeedInt degree, CeedInt dim,
   CeedVectorDestroy(&xcoord);
 
   // Save libCEED data required for level
+  data->ceed = ceed;
   data->basisx = basisx; data->basisu = basisu;
   data->Erestrictx = Erestrictx;
   data->Erestrictu = Erestrictu;
@@ -647,21 +660,94 @@ static int SetupLibceedByDegree(DM dm, Ceed ceed, CeedInt degree, CeedInt dim,
   PetscFunctionReturn(0);
 }
 
+// Set up the interior and ghost-adjacent element split of the operator, so
+//   the interior elements can be applied while the ghost values are in flight
+#ifndef multigrid
+static int SetupLibceedSplit(DM dm, CeedData data) {
+  int ierr;
+  PetscSF sf;
+  PetscInt pStart, pEnd, cStart, cEnd, nleaves;
+  const PetscInt *ilocal;
+  PetscBool *ghost;
+  CeedInt nelem[2] = {0, 0}, *elems;
+
+  PetscFunctionBeginUser;
+
+  // Mark ghost points, the leaves of the point SF
+  ierr = DMPlexGetChart(dm, &pStart, &pEnd); CHKERRQ(ierr);
+  ierr = PetscCalloc1(pEnd - pStart, &ghost); CHKERRQ(ierr);
+  ierr = DMGetPointSF(dm, &sf); CHKERRQ(ierr);
+  ierr = PetscSFGetGraph(sf, NULL, &nleaves, &ilocal, NULL); CHKERRQ(ierr);
+  for (PetscInt l=0; l<nleaves; l++)
+    ghost[(ilocal ? ilocal[l] : l) - pStart] = PETSC_TRUE;
+
+  // Split elements by whether their closure touches a ghost point
+  //   Interior elements are stored first, ghost-adjacent elements last
+  ierr = DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd); CHKERRQ(ierr);
+  ierr = PetscMalloc1(cEnd - cStart, &elems); CHKERRQ(ierr);
+  for (PetscInt c=cStart; c<cEnd; c++) {
+    PetscInt nclosure, *closure = NULL;
+    PetscBool touchesghost = PETSC_FALSE;
+    ierr = DMPlexGetTransitiveClosure(dm, c, PETSC_TRUE, &nclosure, &closure);
+    CHKERRQ(ierr);
+    for (PetscInt i=0; i<nclosure; i++)
+      touchesghost |= ghost[closure[2*i] - pStart];
+    ierr = DMPlexRestoreTransitiveClosure(dm, c, PETSC_TRUE, &nclosure,
+                                          &closure); CHKERRQ(ierr);
+    if (touchesghost)
+      elems[cEnd - cStart - 1 - nelem[1]++] = c - cStart;
+    else
+      elems[nelem[0]++] = c - cStart;
+  }
+  ierr = PetscFree(ghost); CHKERRQ(ierr);
+
+  // Operators over each part, sharing the quadrature data of opapply
+  for (CeedInt s=0; s<2; s++)
+    if (nelem[s])
+      CeedOperatorCreateSubset(data->opapply, nelem[s],
+                               s ? &elems[nelem[0]] : elems, &data->opsplit[s]);
+
+  ierr = PetscFree(elems); CHKERRQ(ierr);
+
+  PetscFunctionReturn(0);
+}
+#endif
+
 // Setup libCEED level transfer operator objects
 #ifdef multigrid
-static PetscErrorCode CeedLevelTransferSetup(Ceed ceed, CeedInt numlevels,
-    CeedInt ncompu, bpType bpChoice, CeedData *data, CeedInt *leveldegrees,
-    CeedQFunction qfrestrict, CeedQFunction qfprolong) {
+static PetscErrorCode CeedLevelTransferSetup(DM *dm, CeedInt numlevels,
+    CeedInt ncompu, bpType bpChoice, CeedData *data, CeedInt *leveldegrees) {
+  PetscErrorCode ierr;
+
   // Return early if numlevels=1
   if (numlevels==1)
     PetscFunctionReturn(0);
 
   // Set up each level
   for (CeedInt i=1; i<numlevels; i++) {
+    // Transfer operators use the Ceed of the fine level
+    Ceed ceed = data[i]->ceed;
+
     // P coarse and P fine
     CeedInt Pc = leveldegrees[i-1] + 1;
     CeedInt Pf = leveldegrees[i] + 1;
 
+    // Coarse restriction on the fine level Ceed; libCEED copies the coarse
+    //   vectors between memory spaces when the coarse level Ceed differs
+    CeedElemRestriction Erestrictuc = data[i-1]->Erestrictu;
+    if (data[i-1]->ceed != ceed) {
+      ierr = CreateRestrictionPlex(ceed, Pc, ncompu, &data[i]->Erestrictuc,
+                                   dm[i-1]); CHKERRQ(ierr);
+      Erestrictuc = data[i]->Erestrictuc;
+    }
+
+    // Identity QFunctions
+    CeedQFunction qfrestrict, qfprolong;
+    CeedQFunctionCreateIdentity(ceed, ncompu, CEED_EVAL_NONE, CEED_EVAL_INTERP,
+                                &qfrestrict);
+    CeedQFunctionCreateIdentity(ceed, ncompu, CEED_EVAL_INTERP, CEED_EVAL_NONE,
+                                &qfprolong);
+
     // Restriction - Fine to corse
     CeedBasis basisctof;
     CeedOperator oprestrict;
@@ -675,7 +761,7 @@ static PetscErrorCode CeedLevelTransferSetup(Ceed ceed, CeedInt numlevels,
                        CEED_QFUNCTION_NONE, &oprestrict);
     CeedOperatorSetField(oprestrict, "input", data[i]->Erestrictu,
                          CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
-    CeedOperatorSetField(oprestrict, "output", data[i-1]->Erestrictu,
+    CeedOperatorSetField(oprestrict, "output", Erestrictuc,
                          basisctof, CEED_VECTOR_ACTIVE);
 
     // Save libCEED data required for level
@@ -688,13 +774,17 @@ static PetscErrorCode CeedLevelTransferSetup(Ceed ceed, CeedInt numlevels,
     // Create the prolongation operator
     CeedOperatorCreate(ceed, qfprolong, CEED_QFUNCTION_NONE,
                        CEED_QFUNCTION_NONE, &opprolong);
-    CeedOperatorSetField(opprolong, "input", data[i-1]->Erestrictu,
+    CeedOperatorSetField(opprolong, "input", Erestrictuc,
                          basisctof, CEED_VECTOR_ACTIVE);
     CeedOperatorSetField(opprolong, "output", data[i]->Erestrictu,
                          CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
 
     // Save libCEED data required for level
     data[i]->opprolong = opprolong;
+
+    // The operators keep references to the QFunctions
+    CeedQFunctionDestroy(&qfrestrict);
+    CeedQFunctionDestroy(&qfprolong);
   }
 
   PetscFunctionReturn(0);
@@ -736,17 +826,15 @@ static PetscErrorCode MatGetDiag(Mat A, Vec D) {
   PetscFunctionReturn(0);
 }
 
-// This function uses libCEED to compute the action of the Laplacian with
-// Dirichlet boundary conditions
-static PetscErrorCode ApplyLocal_Ceed(Vec X, Vec Y, UserO user) {
+// This function applies a libCEED operator to the local vectors, adding to
+//   Yloc if requested
+static PetscErrorCode ApplyLocalOp_Ceed(UserO user, CeedOperator op,
+                                        PetscBool add) {
   PetscErrorCode ierr;
   PetscScalar *x, *y;
 
   PetscFunctionBeginUser;
 
-  // Global-to-local
-  ierr = DMGlobalToLocal(user->dm, X, INSERT_VALUES, user->Xloc); CHKERRQ(ierr);
-
   // Setup libCEED vectors
   ierr = user->VecGetArrayRead(user->Xloc, (const PetscScalar **)&x);
   CHKERRQ(ierr);
@@ -755,7 +843,10 @@ static PetscErrorCode ApplyLocal_Ceed(Vec X, Vec Y, UserO user) {
   CeedVectorSetArray(user->yceed, user->memtype, CEED_USE_POINTER, y);
 
   // Apply libCEED operator
-  CeedOperatorApply(user->op, user->xceed, user->yceed, CEED_REQUEST_IMMEDIATE);
+  if (add)
+    CeedOperatorApplyAdd(op, user->xceed, user->yceed, CEED_REQUEST_IMMEDIATE);
+  else
+    CeedOperatorApply(op, user->xceed, user->yceed, CEED_REQUEST_IMMEDIATE);
 
   // Restore PETSc vectors
   CeedVectorTakeArray(user->xceed, user->memtype, NULL);
@@ -764,6 +855,42 @@ static PetscErrorCode ApplyLocal_Ceed(Vec X, Vec Y, UserO user) {
   CHKERRQ(ierr);
   ierr = user->VecRestoreArray(user->Yloc, &y); CHKERRQ(ierr);
 
+  PetscFunctionReturn(0);
+}
+
+// This function uses libCEED to compute the action of the Laplacian with
+// Dirichlet boundary conditions
+static PetscErrorCode ApplyLocal_Ceed(Vec X, Vec Y, UserO user) {
+  PetscErrorCode ierr;
+
+  PetscFunctionBeginUser;
+
+  if (user->opinterior || user->opboundary) {
+    // Overlap the ghost update with the interior elements
+    // Note: PetscSF copies the owned values into Xloc when the scatter is
+    //         started, and the interior elements read only owned values.
+    ierr = VecZeroEntries(user->Yloc); CHKERRQ(ierr);
+    ierr = DMGlobalToLocalBegin(user->dm, X, INSERT_VALUES, user->Xloc);
+    CHKERRQ(ierr);
+    if (user->opinterior) {
+      ierr = ApplyLocalOp_Ceed(user, user->opinterior, PETSC_TRUE);
+      CHKERRQ(ierr);
+    }
+    ierr = DMGlobalToLocalEnd(user->dm, X, INSERT_VALUES, user->Xloc);
+    CHKERRQ(ierr);
+    if (user->opboundary) {
+      ierr = ApplyLocalOp_Ceed(user, user->opboundary, PETSC_TRUE);
+      CHKERRQ(ierr);
+    }
+  } else {
+    // Global-to-local
+    ierr = DMGlobalToLocal(user->dm, X, INSERT_VALUES, user->Xloc);
+    CHKERRQ(ierr);
+
+    // Apply libCEED operator
+    ierr = ApplyLocalOp_Ceed(user, user->op, PETSC_FALSE); CHKERRQ(ierr);
+  }
+
   // Local-to-global
   ierr = VecZeroEntries(Y); CHKERRQ(ierr);
   ierr = DMLocalToGlobal(user->dm, user->Yloc, ADD_VALUES, Y); CHKERRQ(ierr);
@@ -818,10 +945,10 @@ static PetscErrorCode MatMult_Prolong(Mat A, Vec X, Vec Y) {
   CHKERRQ(ierr);
 
   // Setup libCEED vectors
-  ierr = user->VecGetArrayRead(user->locvecc, (const PetscScalar **)&c);
+  ierr = user->VecGetArrayReadc(user->locvecc, (const PetscScalar **)&c);
   CHKERRQ(ierr);
   ierr = user->VecGetArray(user->locvecf, &f); CHKERRQ(ierr);
-  CeedVectorSetArray(user->ceedvecc, user->memtype, CEED_USE_POINTER, c);
+  CeedVectorSetArray(user->ceedvecc, user->memtypec, CEED_USE_POINTER, c);
   CeedVectorSetArray(user->ceedvecf, user->memtype, CEED_USE_POINTER, f);
 
   // Apply libCEED operator
@@ -829,9 +956,9 @@ static PetscErrorCode MatMult_Prolong(Mat A, Vec X, Vec Y) {
                     CEED_REQUEST_IMMEDIATE);
 
   // Restore PETSc vectors
-  CeedVectorTakeArray(user->ceedvecc, user->memtype, NULL);
+  CeedVectorTakeArray(user->ceedvecc, user->memtypec, NULL);
   CeedVectorTakeArray(user->ceedvecf, user->memtype, NULL);
-  ierr = user->VecRestoreArrayRead(user->locvecc, (const PetscScalar **)&c);
+  ierr = user->VecRestoreArrayReadc(user->locvecc, (const PetscScalar **)&c);
   CHKERRQ(ierr);
   ierr = user->VecRestoreArray(user->locvecf, &f); CHKERRQ(ierr);
 
@@ -870,20 +997,20 @@ static PetscErrorCode MatMult_Restrict(Mat A, Vec X, Vec Y) {
   // Setup libCEED vectors
   ierr = user->VecGetArrayRead(user->locvecf, (const PetscScalar **)&f);
   CHKERRQ(ierr);
-  ierr = user->VecGetArray(user->locvecc, &c); CHKERRQ(ierr);
+  ierr = user->VecGetArrayc(user->locvecc, &c); CHKERRQ(ierr);
   CeedVectorSetArray(user->ceedvecf, user->memtype, CEED_USE_POINTER, f);
-  CeedVectorSetArray(user->ceedvecc, user->memtype, CEED_USE_POINTER, c);
+  CeedVectorSetArray(user->ceedvecc, user->memtypec, CEED_USE_POINTER, c);
 
   // Apply CEED operator
   CeedOperatorApply(user->oprestrict, user->ceedvecf, user->ceedvecc,
                     CEED_REQUEST_IMMEDIATE);
 
   // Restore PETSc vectors
-  CeedVectorTakeArray(user->ceedvecc, user->memtype, NULL);
+  CeedVectorTakeArray(user->ceedvecc, user->memtypec, NULL);
   CeedVectorTakeArray(user->ceedvecf, user->memtype, NULL);
   ierr = user->VecRestoreArrayRead(user->locvecf, (const PetscScalar **)&f);
   CHKERRQ(ierr);
-  ierr = user->VecRestoreArray(user->locvecc, &c); CHKERRQ(ierr);
+  ierr = user->VecRestoreArrayc(user->locvecc, &c); CHKERRQ(ierr);
 
   // Local-to-global
   ierr = VecZeroEntries(Y); CHKERRQ(ierr);
@@ -59,10 +59,10 @@ int main(int argc, char **argv) {
   Vec            U, *Ug, *Uloc;          // U: solution, R: residual, F: forcing
   Vec            R, Rloc, F, Floc;       // g: global, loc: local
   Vec            NBCs = NULL, NBCsloc = NULL;
-  SNES           snes, snesCoarse = NULL;
-  Mat            *jacobMat, jacobMatCoarse, *prolongRestrMat;
+  SNES           snes;
+  Mat            *jacobMat, jacobMatCoarse = NULL, *prolongRestrMat;
   // PETSc data
-  UserMult       resCtx, jacobCoarseCtx = NULL, *jacobCtx;
+  UserMult       resCtx, *jacobCtx;
   FormJacobCtx   formJacobCtx;
   UserMultProlongRestr *prolongRestrCtx;
   PCMGCycleType  pcmgCycleType = PC_MG_CYCLE_V;
@@ -458,10 +458,13 @@ int main(int argc, char **argv) {
   }
   // Note: FormJacobian updates Jacobian matrices on each level
   //   and assembles the Jpre matrix, if needed
-  ierr = PetscMalloc1(1, &formJacobCtx); CHKERRQ(ierr);
+  ierr = PetscCalloc1(1, &formJacobCtx); CHKERRQ(ierr);
   formJacobCtx->jacobCtx = jacobCtx;
   formJacobCtx->numLevels = numLevels;
   formJacobCtx->jacobMat = jacobMat;
+  formJacobCtx->opTangent = ceedData[fineLevel]->opTangent;
+  formJacobCtx->gradu = ceedData[fineLevel]->gradu;
+  formJacobCtx->tangent = ceedData[fineLevel]->tangent;
 
   // -- Residual evaluation function
   ierr = PetscCalloc1(1, &resCtx); CHKERRQ(ierr);
@@ -503,34 +506,17 @@ int main(int argc, char **argv) {
   }
 
   // ---------------------------------------------------------------------------
-  // Setup dummy SNES for AMG coarse solve
+  // Setup assembled coarse Jacobian for AMG coarse solve
   // ---------------------------------------------------------------------------
   if (appCtx->multigridChoice != MULTIGRID_NONE) {
     // -- Jacobian Matrix
     ierr = DMSetMatType(levelDMs[0], MATAIJ); CHKERRQ(ierr);
     ierr = DMCreateMatrix(levelDMs[0], &jacobMatCoarse); CHKERRQ(ierr);
 
-    if (appCtx->degree > 1) {
-      ierr = SNESCreate(comm, &snesCoarse); CHKERRQ(ierr);
-      ierr = SNESSetDM(snesCoarse, levelDMs[0]); CHKERRQ(ierr);
-      ierr = SNESSetSolution(snesCoarse, Ug[0]); CHKERRQ(ierr);
-
-      // -- Jacobian function
-      ierr = SNESSetJacobian(snesCoarse, jacobMatCoarse, jacobMatCoarse, NULL,
-                             NULL); CHKERRQ(ierr);
-
-      // -- Residual evaluation function
-      ierr = PetscMalloc1(1, &jacobCoarseCtx); CHKERRQ(ierr);
-      ierr = PetscMemcpy(jacobCoarseCtx, jacobCtx[0], sizeof(*jacobCtx[0]));
-      CHKERRQ(ierr);
-      ierr = SNESSetFunction(snesCoarse, Ug[0], ApplyJacobianCoarse_Ceed,
-                             jacobCoarseCtx); CHKERRQ(ierr);
-
-      // -- Update formJacobCtx
-      formJacobCtx->Ucoarse = Ug[0];
-      formJacobCtx->snesCoarse = snesCoarse;
-      formJacobCtx->jacobMatCoarse = jacobMatCoarse;
-    }
+    // -- Assembled directly from libCEED, see FormJacobian
+    ierr = SetupCoarseAssembly(levelDMs[0], ceed, ceedData[0]->opJacob,
+                               formJacobCtx); CHKERRQ(ierr);
+    formJacobCtx->jacobMatCoarse = jacobMatCoarse;
   }
 
   // Set Jacobian function
@@ -539,8 +525,7 @@ int main(int argc, char **argv) {
                            FormJacobian, formJacobCtx); CHKERRQ(ierr);
   } else {
     ierr = SNESSetJacobian(snes, jacobMat[0], jacobMatCoarse,
-                           SNESComputeJacobianDefaultColor, NULL);
-    CHKERRQ(ierr);
+                           FormJacobian, formJacobCtx); CHKERRQ(ierr);
   }
 
   // ---------------------------------------------------------------------------
@@ -944,6 +929,7 @@ int main(int argc, char **argv) {
   // libCEED objects
   CeedQFunctionContextDestroy(&ctxPhys);
   CeedQFunctionContextDestroy(&ctxPhysSmoother);
+  CeedVectorDestroy(&formJacobCtx->valuesCoarse);
   CeedDestroy(&ceed);
 
   // PETSc objects
@@ -956,7 +942,6 @@ int main(int argc, char **argv) {
   ierr = VecDestroy(&NBCsloc); CHKERRQ(ierr);
   ierr = MatDestroy(&jacobMatCoarse); CHKERRQ(ierr);
   ierr = SNESDestroy(&snes); CHKERRQ(ierr);
-  ierr = SNESDestroy(&snesCoarse); CHKERRQ(ierr);
   ierr = DMDestroy(&dmOrig); CHKERRQ(ierr);
   ierr = DMDestroy(&dmEnergy); CHKERRQ(ierr);
   ierr = DMDestroy(&dmDiagnostic); CHKERRQ(ierr);
@@ -964,8 +949,9 @@ int main(int argc, char **argv) {
 
   // Structs
   ierr = PetscFree(resCtx); CHKERRQ(ierr);
+  ierr = PetscFree2(formJacobCtx->rowsCoarse, formJacobCtx->colsCoarse);
+  CHKERRQ(ierr);
   ierr = PetscFree(formJacobCtx); CHKERRQ(ierr);
-  ierr = PetscFree(jacobCoarseCtx); CHKERRQ(ierr);
   ierr = PetscFree(appCtx); CHKERRQ(ierr);
   ierr = PetscFree(phys); CHKERRQ(ierr);
   ierr = PetscFree(physSmoother); CHKERRQ(ierr);
@@ -136,14 +136,18 @@ struct AppCtx_private {
   PetscScalar   forcingVector[3];
   PetscBool     petscHaveCuda, setMemTypeRequest;
   CeedMemType   memTypeRequested;
+  PetscBool     storeTangent;                         // Stored linearization
+  PetscBool     jacobianAD;                           // Jacobian by Enzyme AD
 };
 
 // Problem specific data
 // *INDENT-OFF*
 typedef struct {
-  CeedInt           qdatasize;
-  CeedQFunctionUser setupgeo, apply, jacob, energy, diagnostic;
-  const char        *setupgeofname, *applyfname, *jacobfname, *energyfname,
+  CeedInt           qdatasize, tangentsize;
+  CeedQFunctionUser setupgeo, apply, jacob, jacobad, tangent, jacobstored,
+                    energy, diagnostic;
+  const char        *setupgeofname, *applyfname, *jacobfname, *jacobadfname,
+                    *tangentfname, *jacobstoredfname, *energyfname,
                     *diagnosticfname;
   CeedQuadMode      qmode;
 } problemData;
@@ -184,9 +188,10 @@ typedef struct FormJacobCtx_private *FormJacobCtx;
 struct FormJacobCtx_private {
   UserMult     *jacobCtx;
   PetscInt     numLevels;
-  SNES         snesCoarse;
   Mat          *jacobMat, jacobMatCoarse;
-  Vec          Ucoarse;
+  CeedOperator opTangent, opCoarse;
+  CeedVector   gradu, tangent, valuesCoarse;
+  PetscInt     numEntriesCoarse, *rowsCoarse, *colsCoarse;
 };
 
 // Data for PETSc Prolongation/Restriction Matshell
@@ -211,12 +216,13 @@ struct CeedData_private {
   Ceed                ceed;
   CeedBasis           basisx, basisu, basisCtoF, basisEnergy, basisDiagnostic;
   CeedElemRestriction Erestrictx, Erestrictu, Erestrictqdi,
-                      ErestrictGradui, ErestrictEnergy, ErestrictDiagnostic,
-                      ErestrictqdDiagnostici;
-  CeedQFunction       qfApply, qfJacob, qfEnergy, qfDiagnostic;
-  CeedOperator        opApply, opJacob, opRestrict, opProlong, opEnergy,
-                      opDiagnostic;
-  CeedVector          qdata, qdataDiagnostic, gradu, xceed, yceed, truesoln;
+                      ErestrictGradui, ErestrictTangenti, ErestrictEnergy,
+                      ErestrictDiagnostic, ErestrictqdDiagnostici;
+  CeedQFunction       qfApply, qfJacob, qfTangent, qfEnergy, qfDiagnostic;
+  CeedOperator        opApply, opJacob, opTangent, opRestrict, opProlong,
+                      opEnergy, opDiagnostic;
+  CeedVector          qdata, qdataDiagnostic, gradu, tangent, xceed, yceed,
+                      truesoln;
 };
 
 // -----------------------------------------------------------------------------
@@ -297,6 +303,11 @@ PetscErrorCode SetupProlongRestrictCtx(MPI_Comm comm, AppCtx appCtx, DM dmC,
 // -----------------------------------------------------------------------------
 // Jacobian setup
 // -----------------------------------------------------------------------------
+// Setup assembly of the coarse Jacobian from the libCEED nonzero pattern
+PetscErrorCode SetupCoarseAssembly(DM dmCoarse, Ceed ceed,
+                                   CeedOperator opCoarse,
+                                   FormJacobCtx formJacobCtx);
+
 PetscErrorCode FormJacobian(SNES snes, Vec U, Mat J, Mat Jpre, void *ctx);
 
 // -----------------------------------------------------------------------------
@@ -318,9 +329,6 @@ PetscErrorCode ApplyLocalCeedOp(Vec X, Vec Y, UserMult user);
 // This function uses libCEED to compute the non-linear residual
 PetscErrorCode FormResidual_Ceed(SNES snes, Vec X, Vec Y, void *ctx);
 
-// This function uses libCEED to apply the Jacobian for assembly via a SNES
-PetscErrorCode ApplyJacobianCoarse_Ceed(SNES snes, Vec X, Vec Y, void *ctx);
-
 // This function uses libCEED to compute the action of the Jacobian
 PetscErrorCode ApplyJacobian_Ceed(Mat A, Vec X, Vec Y);
 
@@ -141,6 +141,90 @@ static inline int commonFS(const CeedScalar lambda, const CeedScalar mu,
   return 0;
 };
 
+// -----------------------------------------------------------------------------
+// Linearization of the first Piola-Kirchhoff stress about F
+//   deltaP = dPdF:deltaF, with deltaF = graddeltau
+// -----------------------------------------------------------------------------
+static inline int linearizeFS(const CeedScalar lambda, const CeedScalar mu,
+                              const CeedScalar graddeltau[3][3],
+                              const CeedScalar F[3][3],
+                              const CeedScalar Swork[6],
+                              const CeedScalar Cinvwork[6],
+                              const CeedScalar llnj, CeedScalar deltaP[3][3]) {
+  // deltaE - Green-Lagrange strain tensor
+  const CeedInt indj[6] = {0, 1, 2, 1, 0, 0}, indk[6] = {0, 1, 2, 2, 2, 1};
+  CeedScalar deltaEwork[6];
+  for (CeedInt m = 0; m < 6; m++) {
+    deltaEwork[m] = 0;
+    for (CeedInt n = 0; n < 3; n++)
+      deltaEwork[m] += (graddeltau[n][indj[m]]*F[n][indk[m]] +
+                        F[n][indj[m]]*graddeltau[n][indk[m]])/2.;
+  }
+  // *INDENT-OFF*
+  CeedScalar deltaE[3][3] = {{deltaEwork[0], deltaEwork[5], deltaEwork[4]},
+                             {deltaEwork[5], deltaEwork[1], deltaEwork[3]},
+                             {deltaEwork[4], deltaEwork[3], deltaEwork[2]}
+                            };
+  // *INDENT-ON*
+
+  // C : right Cauchy-Green tensor
+  // C^(-1) : C-Inverse
+  // *INDENT-OFF*
+  const CeedScalar Cinv[3][3] = {{Cinvwork[0], Cinvwork[5], Cinvwork[4]},
+                                 {Cinvwork[5], Cinvwork[1], Cinvwork[3]},
+                                 {Cinvwork[4], Cinvwork[3], Cinvwork[2]}
+                                };
+  // *INDENT-ON*
+
+  // Second Piola-Kirchhoff (S)
+  // *INDENT-OFF*
+  const CeedScalar S[3][3] = {{Swork[0], Swork[5], Swork[4]},
+                              {Swork[5], Swork[1], Swork[3]},
+                              {Swork[4], Swork[3], Swork[2]}
+                             };
+  // *INDENT-ON*
+
+  // deltaS = dSdE:deltaE
+  //      = lambda(Cinv:deltaE)Cinv + 2(mu-lambda*log(J))Cinv*deltaE*Cinv
+  // -- Cinv:deltaE
+  CeedScalar Cinv_contract_E = 0;
+  for (CeedInt j = 0; j < 3; j++)
+    for (CeedInt k = 0; k < 3; k++)
+      Cinv_contract_E += Cinv[j][k]*deltaE[j][k];
+  // -- deltaE*Cinv
+  CeedScalar deltaECinv[3][3];
+  for (CeedInt j = 0; j < 3; j++)
+    for (CeedInt k = 0; k < 3; k++) {
+      deltaECinv[j][k] = 0;
+      for (CeedInt m = 0; m < 3; m++)
+        deltaECinv[j][k] += deltaE[j][m]*Cinv[m][k];
+    }
+  // -- intermediate deltaS = Cinv*deltaE*Cinv
+  CeedScalar deltaS[3][3];
+  for (CeedInt j = 0; j < 3; j++)
+    for (CeedInt k = 0; k < 3; k++) {
+      deltaS[j][k] = 0;
+      for (CeedInt m = 0; m < 3; m++)
+        deltaS[j][k] += Cinv[j][m]*deltaECinv[m][k];
+    }
+  // -- deltaS = lambda(Cinv:deltaE)Cinv - 2(lambda*log(J)-mu)*(intermediate)
+  const CeedScalar llnj_m = llnj - mu;
+  for (CeedInt j = 0; j < 3; j++)
+    for (CeedInt k = 0; k < 3; k++)
+      deltaS[j][k] = lambda*Cinv_contract_E*Cinv[j][k] -
+                     2.*llnj_m*deltaS[j][k];
+
+  // deltaP = dPdF:deltaF = deltaF*S + F*deltaS
+  for (CeedInt j = 0; j < 3; j++)
+    for (CeedInt k = 0; k < 3; k++) {
+      deltaP[j][k] = 0;
+      for (CeedInt m = 0; m < 3; m++)
+        deltaP[j][k] += graddeltau[j][m]*S[m][k] + F[j][m]*deltaS[m][k];
+    }
+
+  return 0;
+};
+
 // -----------------------------------------------------------------------------
 // Residual evaluation for hyperelasticity, finite strain
 // -----------------------------------------------------------------------------
@@ -378,77 +462,143 @@ CEED_QFUNCTION(HyperFSdF)(void *ctx, CeedInt Q, const CeedScalar *const *in,
     // *INDENT-ON*
     commonFS(lambda, mu, tempgradu, Swork, Cinvwork, &detC_m1, &llnj);
 
-    // deltaE - Green-Lagrange strain tensor
-    const CeedInt indj[6] = {0, 1, 2, 1, 0, 0}, indk[6] = {0, 1, 2, 2, 2, 1};
-    CeedScalar deltaEwork[6];
-    for (CeedInt m = 0; m < 6; m++) {
-      deltaEwork[m] = 0;
-      for (CeedInt n = 0; n < 3; n++)
-        deltaEwork[m] += (graddeltau[n][indj[m]]*F[n][indk[m]] +
-                          F[n][indj[m]]*graddeltau[n][indk[m]])/2.;
+    // deltaP = dPdF:deltaF
+    CeedScalar deltaP[3][3];
+    linearizeFS(lambda, mu, graddeltau, F, Swork, Cinvwork, llnj, deltaP);
+
+    // Apply dXdx^T and weight
+    for (CeedInt j = 0; j < 3; j++)     // Component
+      for (CeedInt k = 0; k < 3; k++) { // Derivative
+        deltadvdX[k][j][i] = 0;
+        for (CeedInt m = 0; m < 3; m++)
+          deltadvdX[k][j][i] += dXdx[k][m] * deltaP[j][m] * wdetJ;
+      }
+
+  } // End of Quadrature Point Loop
+
+  return 0;
+}
+
+#ifdef CEED_ENZYME
+// -----------------------------------------------------------------------------
+// Jacobian evaluation for hyperelasticity, finite strain, by forward mode
+//   automatic differentiation of the first Piola-Kirchhoff stress with Enzyme
+//
+// Build with ENZYME_LIB set to the Enzyme Clang plugin. Enzyme differentiates
+//   computeP_FS when the example is compiled, so the Jacobian of a new
+//   constitutive model only needs its stress; GPU backends compile QFunction
+//   source at run time without the plugin and keep HyperFSdF.
+// -----------------------------------------------------------------------------
+void __enzyme_fwddiff(void *, ...);
+int enzyme_const, enzyme_dup, enzyme_dupnoneed;
+
+static inline int computeP_FS(const CeedScalar lambda, const CeedScalar mu,
+                              const CeedScalar gradu[3][3],
+                              CeedScalar P[3][3]) {
+  CeedScalar Swork[6], Cinvwork[6], llnj, detC_m1;
+  commonFS(lambda, mu, gradu, Swork, Cinvwork, &detC_m1, &llnj);
+
+  // *INDENT-OFF*
+  const CeedScalar S[3][3] = {{Swork[0], Swork[5], Swork[4]},
+                              {Swork[5], Swork[1], Swork[3]},
+                              {Swork[4], Swork[3], Swork[2]}
+                             };
+  // *INDENT-ON*
+
+  // P = F*S, with F = I3 + gradu
+  for (CeedInt j = 0; j < 3; j++)
+    for (CeedInt k = 0; k < 3; k++) {
+      P[j][k] = S[j][k];
+      for (CeedInt m = 0; m < 3; m++)
+        P[j][k] += gradu[j][m] * S[m][k];
     }
-    // *INDENT-OFF*
-    CeedScalar deltaE[3][3] = {{deltaEwork[0], deltaEwork[5], deltaEwork[4]},
-                               {deltaEwork[5], deltaEwork[1], deltaEwork[3]},
-                               {deltaEwork[4], deltaEwork[3], deltaEwork[2]}
-                              };
-    // *INDENT-ON*
 
-    // C : right Cauchy-Green tensor
-    // C^(-1) : C-Inverse
-    // *INDENT-OFF*
-    const CeedScalar Cinv[3][3] = {{Cinvwork[0], Cinvwork[5], Cinvwork[4]},
-                                   {Cinvwork[5], Cinvwork[1], Cinvwork[3]},
-                                   {Cinvwork[4], Cinvwork[3], Cinvwork[2]}
-                                  };
-    // *INDENT-ON*
+  return 0;
+};
 
-    // Second Piola-Kirchhoff (S)
+CEED_QFUNCTION(HyperFSdF_AD)(void *ctx, CeedInt Q, const CeedScalar *const *in,
+                             CeedScalar *const *out) {
+  // *INDENT-OFF*
+  // Inputs
+  const CeedScalar (*deltaug)[3][CEED_Q_VLA] = (const CeedScalar(*)[3][CEED_Q_VLA])in[0],
+                   (*qdata)[CEED_Q_VLA] = (const CeedScalar(*)[CEED_Q_VLA])in[1];
+  // gradu is used for hyperelasticity (non-linear)
+  const CeedScalar (*gradu)[3][CEED_Q_VLA] = (const CeedScalar(*)[3][CEED_Q_VLA])in[2];
+
+  // Outputs
+  CeedScalar (*deltadvdX)[3][CEED_Q_VLA] = (CeedScalar(*)[3][CEED_Q_VLA])out[0];
+  // *INDENT-ON*
+
+  // Context
+  const Physics context = (Physics)ctx;
+  const CeedScalar E  = context->E;
+  const CeedScalar nu = context->nu;
+
+  // Constants
+  const CeedScalar TwoMu = E / (1 + nu);
+  const CeedScalar mu = TwoMu / 2;
+  const CeedScalar Kbulk = E / (3*(1 - 2*nu)); // Bulk Modulus
+  const CeedScalar lambda = (3*Kbulk - TwoMu) / 3;
+
+  // Quadrature Point Loop
+  CeedPragmaSIMD
+  for (CeedInt i=0; i<Q; i++) {
+    // Read spatial derivatives of delta_u
     // *INDENT-OFF*
-    const CeedScalar S[3][3] = {{Swork[0], Swork[5], Swork[4]},
-                                {Swork[5], Swork[1], Swork[3]},
-                                {Swork[4], Swork[3], Swork[2]}
-                               };
+    const CeedScalar deltadu[3][3] = {{deltaug[0][0][i],
+                                       deltaug[1][0][i],
+                                       deltaug[2][0][i]},
+                                      {deltaug[0][1][i],
+                                       deltaug[1][1][i],
+                                       deltaug[2][1][i]},
+                                      {deltaug[0][2][i],
+                                       deltaug[1][2][i],
+                                       deltaug[2][2][i]}
+                                     };
+    // -- Qdata
+    const CeedScalar wdetJ      =      qdata[0][i];
+    const CeedScalar dXdx[3][3] =    {{qdata[1][i],
+                                       qdata[2][i],
+                                       qdata[3][i]},
+                                      {qdata[4][i],
+                                       qdata[5][i],
+                                       qdata[6][i]},
+                                      {qdata[7][i],
+                                       qdata[8][i],
+                                       qdata[9][i]}
+                                      };
     // *INDENT-ON*
 
-    // deltaS = dSdE:deltaE
-    //      = lambda(Cinv:deltaE)Cinv + 2(mu-lambda*log(J))Cinv*deltaE*Cinv
-    // -- Cinv:deltaE
-    CeedScalar Cinv_contract_E = 0;
-    for (CeedInt j = 0; j < 3; j++)
-      for (CeedInt k = 0; k < 3; k++)
-        Cinv_contract_E += Cinv[j][k]*deltaE[j][k];
-    // -- deltaE*Cinv
-    CeedScalar deltaECinv[3][3];
-    for (CeedInt j = 0; j < 3; j++)
-      for (CeedInt k = 0; k < 3; k++) {
-        deltaECinv[j][k] = 0;
-        for (CeedInt m = 0; m < 3; m++)
-          deltaECinv[j][k] += deltaE[j][m]*Cinv[m][k];
-      }
-    // -- intermediate deltaS = Cinv*deltaE*Cinv
-    CeedScalar deltaS[3][3];
-    for (CeedInt j = 0; j < 3; j++)
-      for (CeedInt k = 0; k < 3; k++) {
-        deltaS[j][k] = 0;
-        for (CeedInt m = 0; m < 3; m++)
-          deltaS[j][k] += Cinv[j][m]*deltaECinv[m][k];
+    // Compute graddeltau
+    //   dXdx = (dx/dX)^(-1)
+    // Apply dXdx to deltadu = graddelta
+    CeedScalar graddeltau[3][3];
+    for (CeedInt j = 0; j < 3; j++)     // Component
+      for (CeedInt k = 0; k < 3; k++) { // Derivative
+        graddeltau[j][k] = 0;
+        for (CeedInt m =0 ; m < 3; m++)
+          graddeltau[j][k] += dXdx[m][k] * deltadu[j][m];
       }
-    // -- deltaS = lambda(Cinv:deltaE)Cinv - 2(lambda*log(J)-mu)*(intermediate)
-    const CeedScalar llnj_m = llnj - mu;
-    for (CeedInt j = 0; j < 3; j++)
-      for (CeedInt k = 0; k < 3; k++)
-        deltaS[j][k] = lambda*Cinv_contract_E*Cinv[j][k] -
-                       2.*llnj_m*deltaS[j][k];
 
-    // deltaP = dPdF:deltaF = deltaF*S + F*deltaS
-    CeedScalar deltaP[3][3];
-    for (CeedInt j = 0; j < 3; j++)
-      for (CeedInt k = 0; k < 3; k++) {
-        deltaP[j][k] = 0;
-        for (CeedInt m = 0; m < 3; m++)
-          deltaP[j][k] += graddeltau[j][m]*S[m][k] + F[j][m]*deltaS[m][k];
-      }
+    // *INDENT-OFF*
+    const CeedScalar tempgradu[3][3] =  {{gradu[0][0][i],
+                                          gradu[0][1][i],
+                                          gradu[0][2][i]},
+                                         {gradu[1][0][i],
+                                          gradu[1][1][i],
+                                          gradu[1][2][i]},
+                                         {gradu[2][0][i],
+                                          gradu[2][1][i],
+                                          gradu[2][2][i]}
+                                        };
+    // *INDENT-ON*
+
+    // deltaP = dPdF:deltaF, by forward mode differentiation of P in the
+    //   direction graddeltau
+    CeedScalar P[3][3], deltaP[3][3];
+    __enzyme_fwddiff((void *)computeP_FS, enzyme_const, lambda, enzyme_const,
+                     mu, enzyme_dup, tempgradu, graddeltau, enzyme_dupnoneed,
+                     P, deltaP);
 
     // Apply dXdx^T and weight
     for (CeedInt j = 0; j < 3; j++)     // Component
@@ -462,6 +612,156 @@ CEED_QFUNCTION(HyperFSdF)(void *ctx, CeedInt Q, const CeedScalar *const *in,
 
   return 0;
 }
+#endif // CEED_ENZYME
+
+// -----------------------------------------------------------------------------
+// Stored linearization for hyperelasticity, finite strain
+//
+// The Jacobian maps the reference gradient of delta_u, deltaug, to deltadvdX,
+//   both stored as 9 entries per quadrature point. HyperFSTangent evaluates
+//   this 9x9 map once at the Newton linearization point, including dXdx and
+//   the quadrature weight, and HyperFSdFStored applies it with a contraction.
+//   The map is symmetric, so only the 45 entries of the lower triangle are
+//   stored, column by column.
+// -----------------------------------------------------------------------------
+CEED_QFUNCTION(HyperFSTangent)(void *ctx, CeedInt Q,
+                               const CeedScalar *const *in,
+                               CeedScalar *const *out) {
+  // *INDENT-OFF*
+  // Inputs
+  const CeedScalar (*gradu)[3][CEED_Q_VLA] = (const CeedScalar(*)[3][CEED_Q_VLA])in[0],
+                   (*qdata)[CEED_Q_VLA] = (const CeedScalar(*)[CEED_Q_VLA])in[1];
+
+  // Outputs
+  CeedScalar (*tangent)[CEED_Q_VLA] = (CeedScalar(*)[CEED_Q_VLA])out[0];
+  // *INDENT-ON*
+
+  // Context
+  const Physics context = (Physics)ctx;
+  const CeedScalar E  = context->E;
+  const CeedScalar nu = context->nu;
+
+  // Constants
+  const CeedScalar TwoMu = E / (1 + nu);
+  const CeedScalar mu = TwoMu / 2;
+  const CeedScalar Kbulk = E / (3*(1 - 2*nu)); // Bulk Modulus
+  const CeedScalar lambda = (3*Kbulk - TwoMu) / 3;
+
+  // Quadrature Point Loop
+  CeedPragmaSIMD
+  for (CeedInt i=0; i<Q; i++) {
+    // -- Qdata
+    // *INDENT-OFF*
+    const CeedScalar wdetJ      =      qdata[0][i];
+    const CeedScalar dXdx[3][3] =    {{qdata[1][i],
+                                       qdata[2][i],
+                                       qdata[3][i]},
+                                      {qdata[4][i],
+                                       qdata[5][i],
+                                       qdata[6][i]},
+                                      {qdata[7][i],
+                                       qdata[8][i],
+                                       qdata[9][i]}
+                                      };
+
+    // Deformation Gradient : F = I3 + gradu
+    const CeedScalar F[3][3] =      {{gradu[0][0][i] + 1,
+                                      gradu[0][1][i],
+                                      gradu[0][2][i]},
+                                     {gradu[1][0][i],
+                                      gradu[1][1][i] + 1,
+                                      gradu[1][2][i]},
+                                     {gradu[2][0][i],
+                                      gradu[2][1][i],
+                                      gradu[2][2][i] + 1}
+                                    };
+    const CeedScalar tempgradu[3][3] =  {{gradu[0][0][i],
+                                          gradu[0][1][i],
+                                          gradu[0][2][i]},
+                                         {gradu[1][0][i],
+                                          gradu[1][1][i],
+                                          gradu[1][2][i]},
+                                         {gradu[2][0][i],
+                                          gradu[2][1][i],
+                                          gradu[2][2][i]}
+                                        };
+    // *INDENT-ON*
+
+    // Common components of finite strain calculations
+    CeedScalar Swork[6], Cinvwork[6], llnj, detC_m1;
+    commonFS(lambda, mu, tempgradu, Swork, Cinvwork, &detC_m1, &llnj);
+
+    // Columns of the linearization, one per entry of deltaug
+    CeedScalar T[9][9];
+    for (CeedInt p = 0; p < 3; p++)     // Derivative
+      for (CeedInt l = 0; l < 3; l++) { // Component
+        // Unit deltaug[p][l] gives graddeltau[l][k] = dXdx[p][k]
+        CeedScalar graddeltau[3][3] = {{0.}};
+        for (CeedInt k = 0; k < 3; k++)
+          graddeltau[l][k] = dXdx[p][k];
+
+        // deltaP = dPdF:deltaF
+        CeedScalar deltaP[3][3];
+        linearizeFS(lambda, mu, graddeltau, F, Swork, Cinvwork, llnj, deltaP);
+
+        // Apply dXdx^T and weight
+        for (CeedInt j = 0; j < 3; j++)     // Component
+          for (CeedInt k = 0; k < 3; k++) { // Derivative
+            T[k*3+j][p*3+l] = 0;
+            for (CeedInt m = 0; m < 3; m++)
+              T[k*3+j][p*3+l] += dXdx[k][m] * deltaP[j][m] * wdetJ;
+          }
+      }
+
+    // Store lower triangle, symmetrized
+    for (CeedInt b = 0, n = 0; b < 9; b++)
+      for (CeedInt a = b; a < 9; a++, n++)
+        tangent[n][i] = (T[a][b] + T[b][a]) / 2.;
+
+  } // End of Quadrature Point Loop
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Jacobian evaluation for hyperelasticity, finite strain, stored linearization
+// -----------------------------------------------------------------------------
+CEED_QFUNCTION(HyperFSdFStored)(void *ctx, CeedInt Q,
+                                const CeedScalar *const *in,
+                                CeedScalar *const *out) {
+  // *INDENT-OFF*
+  // Inputs
+  const CeedScalar (*deltaug)[CEED_Q_VLA] = (const CeedScalar(*)[CEED_Q_VLA])in[0],
+                   (*tangent)[CEED_Q_VLA] = (const CeedScalar(*)[CEED_Q_VLA])in[1];
+
+  // Outputs
+  CeedScalar (*deltadvdX)[CEED_Q_VLA] = (CeedScalar(*)[CEED_Q_VLA])out[0];
+  // *INDENT-ON*
+
+  // Quadrature Point Loop
+  CeedPragmaSIMD
+  for (CeedInt i=0; i<Q; i++) {
+    CeedScalar deltadu[9], deltadv[9] = {0.};
+    for (CeedInt a = 0; a < 9; a++)
+      deltadu[a] = deltaug[a][i];
+
+    // Symmetric contraction with the lower triangle
+    for (CeedInt b = 0, n = 0; b < 9; b++) {
+      deltadv[b] += tangent[n][i] * deltadu[b];
+      n++;
+      for (CeedInt a = b + 1; a < 9; a++, n++) {
+        deltadv[a] += tangent[n][i] * deltadu[b];
+        deltadv[b] += tangent[n][i] * deltadu[a];
+      }
+    }
+
+    for (CeedInt a = 0; a < 9; a++)
+      deltadvdX[a][i] = deltadv[a];
+
+  } // End of Quadrature Point Loop
+
+  return 0;
+}
 
 // -----------------------------------------------------------------------------
 // Strain energy computation for hyperelasticity, finite strain
@@ -163,6 +163,36 @@ PetscErrorCode ProcessCommandLineOptions(MPI_Comm comm, AppCtx appCtx) {
                             NULL, appCtx->nuSmoother, &appCtx->nuSmoother, NULL);
   CHKERRQ(ierr);
 
+  appCtx->storeTangent = PETSC_FALSE;
+  ierr = PetscOptionsBool("-store_tangent",
+                          "Store the linearization at quadrature points for "
+                          "Jacobian application", NULL, appCtx->storeTangent,
+                          &(appCtx->storeTangent), NULL); CHKERRQ(ierr);
+  if (appCtx->storeTangent && !problemOptions[appCtx->problemChoice].tangent)
+    SETERRQ(PETSC_COMM_SELF, PETSC_ERR_SUP,
+            "Stored linearization only available for finite strain "
+            "hyperelasticity.");
+  if (appCtx->storeTangent && fabs(appCtx->nuSmoother) > 1E-14)
+    SETERRQ(PETSC_COMM_SELF, PETSC_ERR_SUP,
+            "Cannot use smoother Poisson's ratio with stored linearization.");
+
+  appCtx->jacobianAD = PETSC_FALSE;
+  ierr = PetscOptionsBool("-jacobian_ad",
+                          "Apply the Jacobian with automatic differentiation "
+                          "of the stress by Enzyme", NULL, appCtx->jacobianAD,
+                          &(appCtx->jacobianAD), NULL); CHKERRQ(ierr);
+  if (appCtx->jacobianAD && !problemOptions[appCtx->problemChoice].jacobad)
+    SETERRQ(PETSC_COMM_SELF, PETSC_ERR_SUP,
+            "Jacobian by automatic differentiation only available for finite "
+            "strain hyperelasticity built with ENZYME_LIB.");
+  if (appCtx->jacobianAD && appCtx->storeTangent)
+    SETERRQ(PETSC_COMM_SELF, PETSC_ERR_SUP,
+            "Cannot use automatic differentiation with stored linearization.");
+  if (appCtx->jacobianAD && strstr(appCtx->ceedResource, "/gpu"))
+    SETERRQ(PETSC_COMM_SELF, PETSC_ERR_SUP,
+            "Jacobian by automatic differentiation not available for GPU "
+            "backends, which compile QFunctions without Enzyme.");
+
   appCtx->testMode = PETSC_FALSE;
   ierr = PetscOptionsBool("-test",
                           "Testing mode (do not print unless error is large)",
@@ -38,16 +38,18 @@ PetscErrorCode ApplyLocalCeedOp(Vec X, Vec Y, UserMult user) {
   CHKERRQ(ierr);
   ierr = user->VecGetArray(user->Yloc, &y); CHKERRQ(ierr);
   CeedVectorSetArray(user->Xceed, user->memType, CEED_USE_POINTER, x);
-  CeedVectorSetArray(user->Yceed, user->memType, CEED_USE_POINTER, y);
+  CeedVectorBindArray(user->Yceed, user->memType, y);
 
   // Apply CEED operator
   // Note: We could use VecGetArrayInPlace. Instead, we use SetArray/TakeArray
-  //         so we can request host memory for easier debugging.
+  //         so we can request host memory for easier debugging. Yloc lives
+  //         as long as the context, so its array stays bound to Yceed and
+  //         only needs a sync after each apply.
   CeedOperatorApply(user->op, user->Xceed, user->Yceed, CEED_REQUEST_IMMEDIATE);
 
   // Restore PETSc vectors
   CeedVectorTakeArray(user->Xceed, user->memType, NULL);
-  CeedVectorTakeArray(user->Yceed, user->memType, NULL);
+  CeedVectorBoundArraySync(user->Yceed);
   ierr = user->VecRestoreArrayRead(user->Xloc, (const PetscScalar **)&x);
   CHKERRQ(ierr);
   ierr = user->VecRestoreArray(user->Yloc, &y); CHKERRQ(ierr);
@@ -83,22 +85,6 @@ PetscErrorCode FormResidual_Ceed(SNES snes, Vec X, Vec Y, void *ctx) {
   PetscFunctionReturn(0);
 };
 
-// This function uses libCEED to apply the Jacobian for assembly via a SNES
-PetscErrorCode ApplyJacobianCoarse_Ceed(SNES snes, Vec X, Vec Y, void *ctx) {
-  PetscErrorCode ierr;
-  UserMult user = (UserMult)ctx;
-
-  PetscFunctionBeginUser;
-
-  // Zero boundary values
-  ierr = VecZeroEntries(user->Xloc); CHKERRQ(ierr);
-
-  // libCEED for local action of residual evaluator
-  ierr = ApplyLocalCeedOp(X, Y, user); CHKERRQ(ierr);
-
-  PetscFunctionReturn(0);
-};
-
 // This function uses libCEED to compute the action of the Jacobian
 PetscErrorCode ApplyJacobian_Ceed(Mat A, Vec X, Vec Y) {
   PetscErrorCode ierr;
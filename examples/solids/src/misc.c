@@ -116,6 +116,58 @@ PetscErrorCode SetupProlongRestrictCtx(MPI_Comm comm, AppCtx appCtx, DM dmC,
 // -----------------------------------------------------------------------------
 // Jacobian setup
 // -----------------------------------------------------------------------------
+// Setup assembly of the coarse Jacobian from the libCEED nonzero pattern
+PetscErrorCode SetupCoarseAssembly(DM dmCoarse, Ceed ceed,
+                                   CeedOperator opCoarse,
+                                   FormJacobCtx formJacobCtx) {
+  PetscErrorCode ierr;
+  CeedInt nentries, *rows, *cols;
+  Vec Ig, Iloc;
+  PetscInt start, lsize;
+  PetscScalar *ig;
+  const PetscScalar *iloc;
+
+  PetscFunctionBeginUser;
+
+  // Nonzero pattern, in local vector numbering
+  CeedOperatorLinearAssembleSymbolic(opCoarse, &nentries, &rows, &cols);
+
+  // Global index of each local dof
+  //   Constrained dofs are not set by DMGlobalToLocal and keep the index -1,
+  //   which MatSetValues ignores
+  ierr = DMGetGlobalVector(dmCoarse, &Ig); CHKERRQ(ierr);
+  ierr = DMGetLocalVector(dmCoarse, &Iloc); CHKERRQ(ierr);
+  ierr = VecGetOwnershipRange(Ig, &start, NULL); CHKERRQ(ierr);
+  ierr = VecGetLocalSize(Ig, &lsize); CHKERRQ(ierr);
+  ierr = VecGetArray(Ig, &ig); CHKERRQ(ierr);
+  for (PetscInt i = 0; i < lsize; i++)
+    ig[i] = start + i;
+  ierr = VecRestoreArray(Ig, &ig); CHKERRQ(ierr);
+  ierr = VecSet(Iloc, -1.); CHKERRQ(ierr);
+  ierr = DMGlobalToLocal(dmCoarse, Ig, INSERT_VALUES, Iloc); CHKERRQ(ierr);
+
+  // Global nonzero pattern
+  formJacobCtx->numEntriesCoarse = nentries;
+  ierr = PetscMalloc2(nentries, &formJacobCtx->rowsCoarse, nentries,
+                      &formJacobCtx->colsCoarse); CHKERRQ(ierr);
+  ierr = VecGetArrayRead(Iloc, &iloc); CHKERRQ(ierr);
+  for (PetscInt e = 0; e < nentries; e++) {
+    formJacobCtx->rowsCoarse[e] = (PetscInt)PetscRealPart(iloc[rows[e]]);
+    formJacobCtx->colsCoarse[e] = (PetscInt)PetscRealPart(iloc[cols[e]]);
+  }
+  ierr = VecRestoreArrayRead(Iloc, &iloc); CHKERRQ(ierr);
+  ierr = DMRestoreLocalVector(dmCoarse, &Iloc); CHKERRQ(ierr);
+  ierr = DMRestoreGlobalVector(dmCoarse, &Ig); CHKERRQ(ierr);
+  CeedFree(&rows);
+  CeedFree(&cols);
+
+  // Values
+  CeedVectorCreate(ceed, nentries, &formJacobCtx->valuesCoarse);
+  formJacobCtx->opCoarse = opCoarse;
+
+  PetscFunctionReturn(0);
+};
+
 PetscErrorCode FormJacobian(SNES snes, Vec U, Mat J, Mat Jpre, void *ctx) {
   PetscErrorCode ierr;
 
@@ -126,6 +178,11 @@ PetscErrorCode FormJacobian(SNES snes, Vec U, Mat J, Mat Jpre, void *ctx) {
   PetscInt      numLevels = formJacobCtx->numLevels;
   Mat           *jacobMat = formJacobCtx->jacobMat;
 
+  // Store linearization at the state from the last residual evaluation
+  if (formJacobCtx->opTangent)
+    CeedOperatorApply(formJacobCtx->opTangent, formJacobCtx->gradu,
+                      formJacobCtx->tangent, CEED_REQUEST_IMMEDIATE);
+
   // Update Jacobian on each level
   for (PetscInt level = 0; level < numLevels; level++) {
     ierr = MatAssemblyBegin(jacobMat[level], MAT_FINAL_ASSEMBLY); CHKERRQ(ierr);
@@ -133,14 +190,26 @@ PetscErrorCode FormJacobian(SNES snes, Vec U, Mat J, Mat Jpre, void *ctx) {
   }
 
   // Form coarse assembled matrix
-  ierr = VecZeroEntries(formJacobCtx->Ucoarse); CHKERRQ(ierr);
-  ierr = SNESComputeJacobianDefaultColor(formJacobCtx->snesCoarse,
-                                         formJacobCtx->Ucoarse,
-                                         formJacobCtx->jacobMat[0],
-                                         formJacobCtx->jacobMatCoarse, NULL);
-  CHKERRQ(ierr);
+  if (formJacobCtx->jacobMatCoarse) {
+    Mat JCoarse = formJacobCtx->jacobMatCoarse;
+    PetscInt *rows = formJacobCtx->rowsCoarse, *cols = formJacobCtx->colsCoarse;
+    const CeedScalar *values;
+
+    CeedOperatorLinearAssemble(formJacobCtx->opCoarse,
+                               formJacobCtx->valuesCoarse);
+    ierr = MatZeroEntries(JCoarse); CHKERRQ(ierr);
+    CeedVectorGetArrayRead(formJacobCtx->valuesCoarse, CEED_MEM_HOST, &values);
+    for (PetscInt e = 0; e < formJacobCtx->numEntriesCoarse; e++) {
+      ierr = MatSetValue(JCoarse, rows[e], cols[e], values[e], ADD_VALUES);
+      CHKERRQ(ierr);
+    }
+    CeedVectorRestoreArrayRead(formJacobCtx->valuesCoarse, &values);
+    ierr = MatAssemblyBegin(JCoarse, MAT_FINAL_ASSEMBLY); CHKERRQ(ierr);
+    ierr = MatAssemblyEnd(JCoarse, MAT_FINAL_ASSEMBLY); CHKERRQ(ierr);
+  }
 
-  // Jpre might be AIJ (e.g., when using coloring), so we need to assemble it
+  // Jpre might be AIJ (e.g., the coarse matrix for degree 1), so we need to
+  //   assemble it
   ierr = MatAssemblyBegin(Jpre, MAT_FINAL_ASSEMBLY); CHKERRQ(ierr);
   ierr = MatAssemblyEnd(Jpre, MAT_FINAL_ASSEMBLY); CHKERRQ(ierr);
   if (J != Jpre) {
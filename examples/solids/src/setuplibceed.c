@@ -67,14 +67,25 @@ problemData problemOptions[3] = {
   },
   [ELAS_HYPER_FS] = {
     .qdatasize = 10,
+    .tangentsize = 45,
     .setupgeo = SetupGeo,
     .apply = HyperFSF,
     .jacob = HyperFSdF,
+#ifdef CEED_ENZYME
+    .jacobad = HyperFSdF_AD,
+#endif
+    .tangent = HyperFSTangent,
+    .jacobstored = HyperFSdFStored,
     .energy = HyperFSEnergy,
     .diagnostic = HyperFSDiagnostic,
     .setupgeofname = SetupGeo_loc,
     .applyfname = HyperFSF_loc,
     .jacobfname = HyperFSdF_loc,
+#ifdef CEED_ENZYME
+    .jacobadfname = HyperFSdF_AD_loc,
+#endif
+    .tangentfname = HyperFSTangent_loc,
+    .jacobstoredfname = HyperFSdFStored_loc,
     .energyfname = HyperFSEnergy_loc,
     .diagnosticfname = HyperFSDiagnostic_loc,
     .qmode = CEED_GAUSS
@@ -108,6 +119,7 @@ PetscErrorCode CeedDataDestroy(CeedInt level, CeedData data) {
   CeedVectorDestroy(&data->qdata);
   CeedVectorDestroy(&data->qdataDiagnostic);
   CeedVectorDestroy(&data->gradu);
+  CeedVectorDestroy(&data->tangent);
   CeedVectorDestroy(&data->xceed);
   CeedVectorDestroy(&data->yceed);
   CeedVectorDestroy(&data->truesoln);
@@ -116,6 +128,7 @@ PetscErrorCode CeedDataDestroy(CeedInt level, CeedData data) {
   CeedElemRestrictionDestroy(&data->Erestrictu);
   CeedElemRestrictionDestroy(&data->Erestrictx);
   CeedElemRestrictionDestroy(&data->ErestrictGradui);
+  CeedElemRestrictionDestroy(&data->ErestrictTangenti);
   CeedElemRestrictionDestroy(&data->Erestrictqdi);
   CeedElemRestrictionDestroy(&data->ErestrictEnergy);
   CeedElemRestrictionDestroy(&data->ErestrictDiagnostic);
@@ -129,12 +142,14 @@ PetscErrorCode CeedDataDestroy(CeedInt level, CeedData data) {
 
   // QFunctions
   CeedQFunctionDestroy(&data->qfJacob);
+  CeedQFunctionDestroy(&data->qfTangent);
   CeedQFunctionDestroy(&data->qfApply);
   CeedQFunctionDestroy(&data->qfEnergy);
   CeedQFunctionDestroy(&data->qfDiagnostic);
 
   // Operators
   CeedOperatorDestroy(&data->opJacob);
+  CeedOperatorDestroy(&data->opTangent);
   CeedOperatorDestroy(&data->opApply);
   CeedOperatorDestroy(&data->opEnergy);
   CeedOperatorDestroy(&data->opDiagnostic);
@@ -334,6 +349,7 @@ PetscErrorCode SetupLibceedFineLevel(DM dm, DM dmEnergy, DM dmDiagnostic,
   CeedInt       dim, ncompx, ncompe = 1, ncompd = 5;
   CeedInt       nqpts;
   CeedInt       qdatasize = problemOptions[appCtx->problemChoice].qdatasize;
+  CeedInt       tangentsize = problemOptions[appCtx->problemChoice].tangentsize;
   problemType   problemChoice = appCtx->problemChoice;
   forcingType   forcingChoice = appCtx->forcingChoice;
   DM            dmcoord;
@@ -341,8 +357,10 @@ PetscErrorCode SetupLibceedFineLevel(DM dm, DM dmEnergy, DM dmDiagnostic,
   PetscInt      cStart, cEnd, nelem;
   const PetscScalar *coordArray;
   CeedVector    xcoord;
-  CeedQFunction qfSetupGeo, qfApply, qfJacob, qfEnergy, qfDiagnostic;
-  CeedOperator  opSetupGeo, opApply, opJacob, opEnergy, opDiagnostic;
+  CeedQFunction qfSetupGeo, qfApply, qfJacob, qfTangent, qfEnergy,
+                qfDiagnostic;
+  CeedOperator  opSetupGeo, opApply, opJacob, opTangent, opEnergy,
+                opDiagnostic;
 
   PetscFunctionBeginUser;
 
@@ -387,6 +405,12 @@ PetscErrorCode SetupLibceedFineLevel(DM dm, DM dmEnergy, DM dmDiagnostic,
                                      dim*ncompu*nelem*Q*Q*Q,
                                      CEED_STRIDES_BACKEND,
                                      &data[fineLevel]->ErestrictGradui);
+  // -- Stored linearization restriction
+  if (appCtx->storeTangent)
+    CeedElemRestrictionCreateStrided(ceed, nelem, Q*Q*Q, tangentsize,
+                                     tangentsize*nelem*Q*Q*Q,
+                                     CEED_STRIDES_BACKEND,
+                                     &data[fineLevel]->ErestrictTangenti);
   // -- Geometric data restriction
   CeedElemRestrictionCreateStrided(ceed, nelem, P*P*P, qdatasize,
                                    qdatasize*nelem*P*P*P,
@@ -435,6 +459,9 @@ PetscErrorCode SetupLibceedFineLevel(DM dm, DM dmEnergy, DM dmDiagnostic,
   // -- State gradient vector
   if (problemChoice != ELAS_LIN)
     CeedVectorCreate(ceed, dim*ncompu*nelem*nqpts, &data[fineLevel]->gradu);
+  // -- Stored linearization vector
+  if (appCtx->storeTangent)
+    CeedVectorCreate(ceed, tangentsize*nelem*nqpts, &data[fineLevel]->tangent);
   // -- Operator action variables
   CeedVectorCreate(ceed, Ulocsz, &data[fineLevel]->xceed);
   CeedVectorCreate(ceed, Ulocsz, &data[fineLevel]->yceed);
@@ -510,29 +537,76 @@ PetscErrorCode SetupLibceedFineLevel(DM dm, DM dmEnergy, DM dmDiagnostic,
   // Create the QFunction and Operator that computes the action of the
   //   Jacobian for each linear solve.
   // ---------------------------------------------------------------------------
-  // -- QFunction
-  CeedQFunctionCreateInterior(ceed, 1, problemOptions[problemChoice].jacob,
-                              problemOptions[problemChoice].jacobfname,
-                              &qfJacob);
-  CeedQFunctionAddInput(qfJacob, "deltadu", ncompu*dim, CEED_EVAL_GRAD);
-  CeedQFunctionAddInput(qfJacob, "qdata", qdatasize, CEED_EVAL_NONE);
-  if (problemChoice != ELAS_LIN)
-    CeedQFunctionAddInput(qfJacob, "gradu", ncompu*dim, CEED_EVAL_NONE);
-  CeedQFunctionAddOutput(qfJacob, "deltadv", ncompu*dim, CEED_EVAL_GRAD);
-  CeedQFunctionSetContext(qfJacob, physCtx);
+  if (appCtx->storeTangent) {
+    // -- Linearization QFunction
+    CeedQFunctionCreateInterior(ceed, 1, problemOptions[problemChoice].tangent,
+                                problemOptions[problemChoice].tangentfname,
+                                &qfTangent);
+    CeedQFunctionAddInput(qfTangent, "gradu", ncompu*dim, CEED_EVAL_NONE);
+    CeedQFunctionAddInput(qfTangent, "qdata", qdatasize, CEED_EVAL_NONE);
+    CeedQFunctionAddOutput(qfTangent, "tangent", tangentsize, CEED_EVAL_NONE);
+    CeedQFunctionSetContext(qfTangent, physCtx);
+
+    // -- Linearization Operator
+    CeedOperatorCreate(ceed, qfTangent, CEED_QFUNCTION_NONE,
+                       CEED_QFUNCTION_NONE, &opTangent);
+    CeedOperatorSetField(opTangent, "gradu", data[fineLevel]->ErestrictGradui,
+                         CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(opTangent, "qdata", data[fineLevel]->Erestrictqdi,
+                         CEED_BASIS_COLLOCATED, data[fineLevel]->qdata);
+    CeedOperatorSetField(opTangent, "tangent",
+                         data[fineLevel]->ErestrictTangenti,
+                         CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+    data[fineLevel]->qfTangent = qfTangent;
+    data[fineLevel]->opTangent = opTangent;
 
-  // -- Operator
-  CeedOperatorCreate(ceed, qfJacob, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
-                     &opJacob);
-  CeedOperatorSetField(opJacob, "deltadu", data[fineLevel]->Erestrictu,
-                       data[fineLevel]->basisu, CEED_VECTOR_ACTIVE);
-  CeedOperatorSetField(opJacob, "qdata", data[fineLevel]->Erestrictqdi,
-                       CEED_BASIS_COLLOCATED, data[fineLevel]->qdata);
-  CeedOperatorSetField(opJacob, "deltadv", data[fineLevel]->Erestrictu,
-                       data[fineLevel]->basisu, CEED_VECTOR_ACTIVE);
-  if (problemChoice != ELAS_LIN)
-    CeedOperatorSetField(opJacob, "gradu", data[fineLevel]->ErestrictGradui,
-                         CEED_BASIS_COLLOCATED, data[fineLevel]->gradu);
+    // -- QFunction
+    CeedQFunctionCreateInterior(ceed, 1,
+                                problemOptions[problemChoice].jacobstored,
+                                problemOptions[problemChoice].jacobstoredfname,
+                                &qfJacob);
+    CeedQFunctionAddInput(qfJacob, "deltadu", ncompu*dim, CEED_EVAL_GRAD);
+    CeedQFunctionAddInput(qfJacob, "tangent", tangentsize, CEED_EVAL_NONE);
+    CeedQFunctionAddOutput(qfJacob, "deltadv", ncompu*dim, CEED_EVAL_GRAD);
+    CeedQFunctionSetContext(qfJacob, physCtx);
+
+    // -- Operator
+    CeedOperatorCreate(ceed, qfJacob, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &opJacob);
+    CeedOperatorSetField(opJacob, "deltadu", data[fineLevel]->Erestrictu,
+                         data[fineLevel]->basisu, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(opJacob, "tangent", data[fineLevel]->ErestrictTangenti,
+                         CEED_BASIS_COLLOCATED, data[fineLevel]->tangent);
+    CeedOperatorSetField(opJacob, "deltadv", data[fineLevel]->Erestrictu,
+                         data[fineLevel]->basisu, CEED_VECTOR_ACTIVE);
+  } else {
+    // -- QFunction
+    problemData *problem = &problemOptions[problemChoice];
+    CeedQFunctionCreateInterior(ceed, 1,
+                                appCtx->jacobianAD ? problem->jacobad :
+                                problem->jacob,
+                                appCtx->jacobianAD ? problem->jacobadfname :
+                                problem->jacobfname, &qfJacob);
+    CeedQFunctionAddInput(qfJacob, "deltadu", ncompu*dim, CEED_EVAL_GRAD);
+    CeedQFunctionAddInput(qfJacob, "qdata", qdatasize, CEED_EVAL_NONE);
+    if (problemChoice != ELAS_LIN)
+      CeedQFunctionAddInput(qfJacob, "gradu", ncompu*dim, CEED_EVAL_NONE);
+    CeedQFunctionAddOutput(qfJacob, "deltadv", ncompu*dim, CEED_EVAL_GRAD);
+    CeedQFunctionSetContext(qfJacob, physCtx);
+
+    // -- Operator
+    CeedOperatorCreate(ceed, qfJacob, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &opJacob);
+    CeedOperatorSetField(opJacob, "deltadu", data[fineLevel]->Erestrictu,
+                         data[fineLevel]->basisu, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(opJacob, "qdata", data[fineLevel]->Erestrictqdi,
+                         CEED_BASIS_COLLOCATED, data[fineLevel]->qdata);
+    CeedOperatorSetField(opJacob, "deltadv", data[fineLevel]->Erestrictu,
+                         data[fineLevel]->basisu, CEED_VECTOR_ACTIVE);
+    if (problemChoice != ELAS_LIN)
+      CeedOperatorSetField(opJacob, "gradu", data[fineLevel]->ErestrictGradui,
+                           CEED_BASIS_COLLOCATED, data[fineLevel]->gradu);
+  }
 
   // -- Save libCEED data
   data[fineLevel]->qfJacob = qfJacob;
@@ -0,0 +1,60 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+#include <string.h>
+#include "ceed-backend.h"
+#include "ceed-helmholtz3dapply.h"
+
+// QFunction source, embedded at build time for JIT backends
+static const char source_code[] =
+#include "gallery/helmholtz3d/ceed-helmholtz3dapply.h.src"
+  ;
+
+/**
+  @brief Set fields for Ceed QFunction applying the 3D Helmholtz operator
+**/
+static int CeedQFunctionInit_Helmholtz3DApply(Ceed ceed, const char *requested,
+    CeedQFunction qf) {
+  int ierr;
+
+  // Check QFunction name
+  const char *name = "Helmholtz3DApply";
+  if (strcmp(name, requested))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "QFunction '%s' does not match requested name: %s",
+                     name, requested);
+  // LCOV_EXCL_STOP
+
+  // Add QFunction fields
+  const CeedInt dim = 3;
+  ierr = CeedQFunctionAddInput(qf, "u", 1, CEED_EVAL_INTERP); CeedChk(ierr);
+  ierr = CeedQFunctionAddInput(qf, "du", dim, CEED_EVAL_GRAD); CeedChk(ierr);
+  ierr = CeedQFunctionAddInput(qf, "qdata", dim*(dim+1)/2 + 1, CEED_EVAL_NONE);
+  CeedChk(ierr);
+  ierr = CeedQFunctionAddOutput(qf, "v", 1, CEED_EVAL_INTERP); CeedChk(ierr);
+  ierr = CeedQFunctionAddOutput(qf, "dv", dim, CEED_EVAL_GRAD); CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Register Ceed QFunction for applying the 3D Helmholtz operator
+**/
+__attribute__((constructor))
+static void Register(void) {
+  CeedQFunctionRegister("Helmholtz3DApply", Helmholtz3DApply_loc, source_code,
+                        1, Helmholtz3DApply,
+                        CeedQFunctionInit_Helmholtz3DApply);
+}
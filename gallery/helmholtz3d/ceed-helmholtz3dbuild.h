@@ -0,0 +1,75 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+/**
+  @brief Ceed QFunction for building the geometric data for the 3D Helmholtz
+           operator, a mass plus diffusion operator applied in one pass
+**/
+
+#ifndef helmholtz3dbuild_h
+#define helmholtz3dbuild_h
+
+CEED_QFUNCTION(Helmholtz3DBuild)(void *ctx, const CeedInt Q,
+                                 const CeedScalar *const *in,
+                                 CeedScalar *const *out) {
+  // At every quadrature point, compute beta.qw/det(J).adj(J).adj(J)^T as in
+  // Poisson3DBuild and alpha.qw.det(J) as in Mass3DBuild. The optional context
+  // holds the mass and diffusion coefficients alpha and beta, both 1 without
+  // a context.
+  const CeedScalar *coeffs = (const CeedScalar *)ctx;
+  const CeedScalar alpha = coeffs ? coeffs[0] : 1.0;
+  const CeedScalar beta = coeffs ? coeffs[1] : 1.0;
+
+  // in[0] is Jacobians with shape [3, nc=3, Q]
+  // in[1] is quadrature weights, size (Q)
+  const CeedScalar *J = in[0], *qw = in[1];
+
+  // out[0] is qdata, size (7*Q)
+  CeedScalar *qd = out[0];
+
+  // Quadrature point loop
+  CeedPragmaSIMD
+  for (CeedInt i=0; i<Q; i++) {
+    // Compute the adjoint
+    CeedScalar A[3][3];
+    for (CeedInt j=0; j<3; j++)
+      for (CeedInt k=0; k<3; k++)
+        A[k][j] = J[i+Q*((j+1)%3+3*((k+1)%3))]*J[i+Q*((j+2)%3+3*((k+2)%3))] -
+                  J[i+Q*((j+1)%3+3*((k+2)%3))]*J[i+Q*((j+2)%3+3*((k+1)%3))];
+
+    // Compute det(J)
+    const CeedScalar detJ = J[i+Q*0]*A[0][0] + J[i+Q*1]*A[0][1] +
+                            J[i+Q*2]*A[0][2];
+    const CeedScalar w = beta * qw[i] / detJ;
+
+    // Compute geometric factors
+    // Stored in Voigt convention
+    // 0 5 4
+    // 5 1 3
+    // 4 3 2
+    qd[i+Q*0] = w * (A[0][0]*A[0][0] + A[0][1]*A[0][1] + A[0][2]*A[0][2]);
+    qd[i+Q*1] = w * (A[1][0]*A[1][0] + A[1][1]*A[1][1] + A[1][2]*A[1][2]);
+    qd[i+Q*2] = w * (A[2][0]*A[2][0] + A[2][1]*A[2][1] + A[2][2]*A[2][2]);
+    qd[i+Q*3] = w * (A[1][0]*A[2][0] + A[1][1]*A[2][1] + A[1][2]*A[2][2]);
+    qd[i+Q*4] = w * (A[0][0]*A[2][0] + A[0][1]*A[2][1] + A[0][2]*A[2][2]);
+    qd[i+Q*5] = w * (A[0][0]*A[1][0] + A[0][1]*A[1][1] + A[0][2]*A[1][2]);
+    // Mass factor
+    qd[i+Q*6] = alpha * qw[i] * detJ;
+  } // End of Quadrature Point Loop
+
+  return 0;
+}
+
+#endif // helmholtz3dbuild_h
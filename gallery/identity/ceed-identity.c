@@ -18,6 +18,11 @@
 #include "ceed-backend.h"
 #include "ceed-identity.h"
 
+// QFunction source, embedded at build time for JIT backends
+static const char source_code[] =
+#include "gallery/identity/ceed-identity.h.src"
+  ;
+
 /**
   @brief Set fields identity QFunction that copies inputs directly into outputs
 **/
@@ -42,6 +47,6 @@ static int CeedQFunctionInit_Identity(Ceed ceed, const char *requested,
 **/
 __attribute__((constructor))
 static void Register(void) {
-  CeedQFunctionRegister("Identity", Identity_loc, 1, Identity,
+  CeedQFunctionRegister("Identity", Identity_loc, source_code, 1, Identity,
                         CeedQFunctionInit_Identity);
 }
@@ -18,6 +18,11 @@
 #include "ceed-backend.h"
 #include "ceed-mass1dbuild.h"
 
+// QFunction source, embedded at build time for JIT backends
+static const char source_code[] =
+#include "gallery/mass1d/ceed-mass1dbuild.h.src"
+  ;
+
 /**
   @brief Set fields for Ceed QFunction building the geometric data for the 1D
            mass matrix
@@ -51,6 +56,6 @@ static int CeedQFunctionInit_Mass1DBuild(Ceed ceed, const char *requested,
 **/
 __attribute__((constructor))
 static void Register(void) {
-  CeedQFunctionRegister("Mass1DBuild", Mass1DBuild_loc, 1, Mass1DBuild,
-                        CeedQFunctionInit_Mass1DBuild);
+  CeedQFunctionRegister("Mass1DBuild", Mass1DBuild_loc, source_code, 1,
+                        Mass1DBuild, CeedQFunctionInit_Mass1DBuild);
 }
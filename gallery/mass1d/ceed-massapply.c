@@ -18,6 +18,11 @@
 #include "ceed-backend.h"
 #include "ceed-massapply.h"
 
+// QFunction source, embedded at build time for JIT backends
+static const char source_code[] =
+#include "gallery/mass1d/ceed-massapply.h.src"
+  ;
+
 /**
   @brief Set fields for Ceed QFunction for applying the mass matrix
 **/
@@ -46,6 +51,6 @@ static int CeedQFunctionInit_MassApply(Ceed ceed, const char *requested,
 **/
 __attribute__((constructor))
 static void Register(void) {
-  CeedQFunctionRegister("MassApply", MassApply_loc, 1, MassApply,
+  CeedQFunctionRegister("MassApply", MassApply_loc, source_code, 1, MassApply,
                         CeedQFunctionInit_MassApply);
 }
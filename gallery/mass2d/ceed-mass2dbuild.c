@@ -18,6 +18,11 @@
 #include "ceed-backend.h"
 #include "ceed-mass2dbuild.h"
 
+// QFunction source, embedded at build time for JIT backends
+static const char source_code[] =
+#include "gallery/mass2d/ceed-mass2dbuild.h.src"
+  ;
+
 /**
   @brief Set fields for Ceed QFunction building the geometric data for the 2D
            mass matrix
@@ -51,6 +56,6 @@ static int CeedQFunctionInit_Mass2DBuild(Ceed ceed, const char *requested,
 **/
 __attribute__((constructor))
 static void Register(void) {
-  CeedQFunctionRegister("Mass2Dbuild", Mass2DBuild_loc, 1, Mass2DBuild,
-                        CeedQFunctionInit_Mass2DBuild);
+  CeedQFunctionRegister("Mass2Dbuild", Mass2DBuild_loc, source_code, 1,
+                        Mass2DBuild, CeedQFunctionInit_Mass2DBuild);
 }
@@ -18,6 +18,11 @@
 #include "ceed-backend.h"
 #include "ceed-mass3dbuild.h"
 
+// QFunction source, embedded at build time for JIT backends
+static const char source_code[] =
+#include "gallery/mass3d/ceed-mass3dbuild.h.src"
+  ;
+
 /**
   @brief Set fields for Ceed QFunction building the geometric data for the 3D
            mass matrix
@@ -51,6 +56,6 @@ static int CeedQFunctionInit_Mass3DBuild(Ceed ceed, const char *requested,
 **/
 __attribute__((constructor))
 static void Register(void) {
-  CeedQFunctionRegister("Mass3DBuild", Mass3DBuild_loc, 1, Mass3DBuild,
-                        CeedQFunctionInit_Mass3DBuild);
+  CeedQFunctionRegister("Mass3DBuild", Mass3DBuild_loc, source_code, 1,
+                        Mass3DBuild, CeedQFunctionInit_Mass3DBuild);
 }
@@ -18,6 +18,11 @@
 #include "ceed-backend.h"
 #include "ceed-poisson1dapply.h"
 
+// QFunction source, embedded at build time for JIT backends
+static const char source_code[] =
+#include "gallery/poisson1d/ceed-poisson1dapply.h.src"
+  ;
+
 /**
   @brief Set fields for Ceed QFunction applying the 1D Poisson operator
 **/
@@ -48,6 +53,6 @@ static int CeedQFunctionInit_Poisson1DApply(Ceed ceed, const char *requested,
 **/
 __attribute__((constructor))
 static void Register(void) {
-  CeedQFunctionRegister("Poisson1DApply", Poisson1DApply_loc, 1, Poisson1DApply,
-                        CeedQFunctionInit_Poisson1DApply);
+  CeedQFunctionRegister("Poisson1DApply", Poisson1DApply_loc, source_code, 1,
+                        Poisson1DApply, CeedQFunctionInit_Poisson1DApply);
 }
@@ -18,6 +18,11 @@
 #include "ceed-backend.h"
 #include "ceed-poisson1dbuild.h"
 
+// QFunction source, embedded at build time for JIT backends
+static const char source_code[] =
+#include "gallery/poisson1d/ceed-poisson1dbuild.h.src"
+  ;
+
 /**
   @brief Set fields for Ceed QFunction building the geometric data for the 1D
            Poisson operator
@@ -52,6 +57,6 @@ static int CeedQFunctionInit_Poisson1DBuild(Ceed ceed, const char *requested,
 **/
 __attribute__((constructor))
 static void Register(void) {
-  CeedQFunctionRegister("Poisson1DBuild", Poisson1DBuild_loc, 1, Poisson1DBuild,
-                        CeedQFunctionInit_Poisson1DBuild);
+  CeedQFunctionRegister("Poisson1DBuild", Poisson1DBuild_loc, source_code, 1,
+                        Poisson1DBuild, CeedQFunctionInit_Poisson1DBuild);
 }
@@ -18,6 +18,11 @@
 #include "ceed-backend.h"
 #include "ceed-poisson2dapply.h"
 
+// QFunction source, embedded at build time for JIT backends
+static const char source_code[] =
+#include "gallery/poisson2d/ceed-poisson2dapply.h.src"
+  ;
+
 /**
   @brief Set fields for Ceed QFunction applying the 2D Poisson operator
 **/
@@ -48,6 +53,6 @@ static int CeedQFunctionInit_Poisson2DApply(Ceed ceed, const char *requested,
 **/
 __attribute__((constructor))
 static void Register(void) {
-  CeedQFunctionRegister("Poisson2DApply", Poisson2DApply_loc, 1, Poisson2DApply,
-                        CeedQFunctionInit_Poisson2DApply);
+  CeedQFunctionRegister("Poisson2DApply", Poisson2DApply_loc, source_code, 1,
+                        Poisson2DApply, CeedQFunctionInit_Poisson2DApply);
 }
@@ -18,6 +18,11 @@
 #include "ceed-backend.h"
 #include "ceed-poisson2dbuild.h"
 
+// QFunction source, embedded at build time for JIT backends
+static const char source_code[] =
+#include "gallery/poisson2d/ceed-poisson2dbuild.h.src"
+  ;
+
 /**
   @brief Set fields for Ceed QFunction building the geometric data for the 2D
            Poisson operator
@@ -52,6 +57,6 @@ static int CeedQFunctionInit_Poisson2DBuild(Ceed ceed, const char *requested,
 **/
 __attribute__((constructor))
 static void Register(void) {
-  CeedQFunctionRegister("Poisson2DBuild", Poisson2DBuild_loc, 1, Poisson2DBuild,
-                        CeedQFunctionInit_Poisson2DBuild);
+  CeedQFunctionRegister("Poisson2DBuild", Poisson2DBuild_loc, source_code, 1,
+                        Poisson2DBuild, CeedQFunctionInit_Poisson2DBuild);
 }
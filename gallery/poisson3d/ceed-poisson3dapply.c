@@ -18,6 +18,11 @@
 #include "ceed-backend.h"
 #include "ceed-poisson3dapply.h"
 
+// QFunction source, embedded at build time for JIT backends
+static const char source_code[] =
+#include "gallery/poisson3d/ceed-poisson3dapply.h.src"
+  ;
+
 /**
   @brief Set fields for Ceed QFunction applying the 3D Poisson operator
 **/
@@ -48,6 +53,6 @@ static int CeedQFunctionInit_Poisson3DApply(Ceed ceed, const char *requested,
 **/
 __attribute__((constructor))
 static void Register(void) {
-  CeedQFunctionRegister("Poisson3DApply", Poisson3DApply_loc, 1, Poisson3DApply,
-                        CeedQFunctionInit_Poisson3DApply);
+  CeedQFunctionRegister("Poisson3DApply", Poisson3DApply_loc, source_code, 1,
+                        Poisson3DApply, CeedQFunctionInit_Poisson3DApply);
 }
@@ -18,6 +18,11 @@
 #include "ceed-backend.h"
 #include "ceed-poisson3dbuild.h"
 
+// QFunction source, embedded at build time for JIT backends
+static const char source_code[] =
+#include "gallery/poisson3d/ceed-poisson3dbuild.h.src"
+  ;
+
 /**
   @brief Set fields for Ceed QFunction building the geometric data for the 3D
            Poisson operator
@@ -52,6 +57,6 @@ static int CeedQFunctionInit_Poisson3DBuild(Ceed ceed, const char *requested,
 **/
 __attribute__((constructor))
 static void Register(void) {
-  CeedQFunctionRegister("Poisson3DBuild", Poisson3DBuild_loc, 1, Poisson3DBuild,
-                        CeedQFunctionInit_Poisson3DBuild);
+  CeedQFunctionRegister("Poisson3DBuild", Poisson3DBuild_loc, source_code, 1,
+                        Poisson3DBuild, CeedQFunctionInit_Poisson3DBuild);
 }
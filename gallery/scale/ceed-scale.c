@@ -18,6 +18,11 @@
 #include "ceed-backend.h"
 #include "ceed-scale.h"
 
+// QFunction source, embedded at build time for JIT backends
+static const char source_code[] =
+#include "gallery/scale/ceed-scale.h.src"
+  ;
+
 /**
   @brief  Set fields for vector scaling QFunction that scales inputs
 **/
@@ -38,10 +43,32 @@ static int CeedQFunctionInit_Scale(Ceed ceed, const char *requested,
 }
 
 /**
-  @brief Register scaling QFunction
+  @brief  Set fields for vector scaling QFunction that scales all components
+            of inputs by a single factor
+**/
+static int CeedQFunctionInit_ScaleScalar(Ceed ceed, const char *requested,
+    CeedQFunction qf) {
+  // Check QFunction name
+  const char *name = "ScaleScalar";
+  if (strcmp(name, requested))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "QFunction '%s' does not match requested name: %s",
+                     name, requested);
+  // LCOV_EXCL_STOP
+
+  // QFunction fields 'input' and 'output' with requested emodes added
+  //   by the library rather than being added here
+
+  return 0;
+}
+
+/**
+  @brief Register scaling QFunctions
 **/
 __attribute__((constructor))
 static void Register(void) {
-  CeedQFunctionRegister("Scale", Scale_loc, 1, Scale,
+  CeedQFunctionRegister("Scale", Scale_loc, source_code, 1, Scale,
                         CeedQFunctionInit_Scale);
+  CeedQFunctionRegister("ScaleScalar", ScaleScalar_loc, source_code, 1,
+                        ScaleScalar, CeedQFunctionInit_ScaleScalar);
 }
@@ -15,7 +15,7 @@
 // testbed platforms, in support of the nation's exascale computing imperative.
 
 /**
-  @brief  Scaling QFunction that scales inputs
+  @brief  Scaling QFunctions that scale inputs
 **/
 
 #ifndef scale_h
@@ -41,4 +41,27 @@ CEED_QFUNCTION(Scale)(void *ctx, const CeedInt Q, const CeedScalar *const *in,
   return 0;
 }
 
+CEED_QFUNCTION(ScaleScalar)(void *ctx, const CeedInt Q,
+                            const CeedScalar *const *in,
+                            CeedScalar *const *out) {
+  // Ctx holds field size
+  const CeedInt size = *(CeedInt *)ctx;
+
+  // in[0] is input, size (Q*size)
+  // in[1] is scaling factor shared by all components, size (Q)
+  const CeedScalar *input = in[0];
+  const CeedScalar *scale = in[1];
+  // out[0] is output, size (Q*size)
+  CeedScalar *output = out[0];
+
+  // Quadrature point loop
+  for (CeedInt c=0; c<size; c++) {
+    CeedPragmaSIMD
+    for (CeedInt i=0; i<Q; i++) {
+      output[c*Q+i] = input[c*Q+i] * scale[i];
+    }
+  } // End of Quadrature Point Loop
+  return 0;
+}
+
 #endif // scale_h
@@ -0,0 +1,51 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+/**
+  @brief  Transposed block scaling QFunction that multiplies inputs by the
+            transpose of blocks at each quadrature point
+**/
+
+#ifndef tblockscale_h
+#define tblockscale_h
+
+CEED_QFUNCTION(TransposeBlockScale)(void *ctx, const CeedInt Q,
+                                    const CeedScalar *const *in,
+                                    CeedScalar *const *out) {
+  // Ctx holds input and output sizes
+  const CeedInt insize = ((CeedInt *)ctx)[0], outsize = ((CeedInt *)ctx)[1];
+
+  // in[0] is input, size (Q*insize)
+  // in[1] is block with rows of length insize, size (Q*outsize*insize)
+  const CeedScalar *input = in[0];
+  const CeedScalar *block = in[1];
+  // out[0] is output, size (Q*outsize)
+  CeedScalar *output = out[0];
+
+  // Quadrature point loop
+  CeedPragmaSIMD
+  for (CeedInt i=0; i<Q; i++) {
+    for (CeedInt r=0; r<outsize; r++) {
+      CeedScalar sum = 0;
+      for (CeedInt c=0; c<insize; c++)
+        sum += block[(r*insize+c)*Q+i] * input[c*Q+i];
+      output[r*Q+i] = sum;
+    }
+  } // End of Quadrature Point Loop
+  return 0;
+}
+
+#endif // tblockscale_h
@@ -26,8 +26,22 @@
 
 #define CEED_MAX_RESOURCE_LEN 1024
 #define CEED_ALIGN 64
+/// Round a length in CeedScalar up to a multiple of CEED_ALIGN bytes, so
+///   arrays laid out one after another all start on aligned addresses
+#define CeedPadLength(n) ((((n) + CEED_ALIGN/(CeedInt)sizeof(CeedScalar) - 1) \
+    / (CEED_ALIGN/(CeedInt)sizeof(CeedScalar))) \
+    * (CEED_ALIGN/(CeedInt)sizeof(CeedScalar)))
+/// Align a (stack) array to CEED_ALIGN bytes
+#define CEED_ALIGNED __attribute__((aligned(CEED_ALIGN)))
+/// Host allocations of at least this many bytes are backed by huge pages
+#define CEED_HUGE_PAGE_SIZE (2 << 20)
 #define CEED_COMPOSITE_MAX 16
-#define CEED_EPSILON 1E-16
+/// Number of applies of a split operator timed to balance its shards
+#define CEED_SPLIT_TIMED_APPLIES 2
+/// Maximum distinct vectors and updates, and dot products, fused by
+///   CeedVectorMultiAXPBYDot()
+#define CEED_VECTOR_MULTI_MAX 16
+#define CEED_VECTOR_MULTI_MAX_DOTS 8
 
 /// CEED_DEBUG_COLOR default value, forward CeedDebug* declarations & macros
 #ifndef CEED_DEBUG_COLOR
@@ -40,6 +54,27 @@ CEED_EXTERN void CeedDebugImpl256(const Ceed,const unsigned char,const char *,
 #define CeedDebug256(ceed,color, ...) CeedDebugImpl256(ceed,color, ## __VA_ARGS__)
 #define CeedDebug(...) CeedDebug256(ceed,(unsigned char)CEED_DEBUG_COLOR, ## __VA_ARGS__)
 
+/// Stages of operator application recorded when profiling
+/// @ingroup CeedBackend
+typedef enum {
+  /// Full CeedOperator application
+  CEED_PROFILE_OPERATOR = 0,
+  /// CeedElemRestriction application
+  CEED_PROFILE_RESTRICTION = 1,
+  /// CeedBasis application
+  CEED_PROFILE_BASIS = 2,
+  /// CeedQFunction application
+  CEED_PROFILE_QFUNCTION = 3,
+  /// Host/device memory transfer
+  CEED_PROFILE_TRANSFER = 4,
+  /// Ceed creation, including backend and delegate initialization
+  CEED_PROFILE_INIT = 5,
+  /// Runtime compilation of kernels
+  CEED_PROFILE_COMPILE = 6,
+  /// Number of profiled stages
+  CEED_PROFILE_NUM_STAGES = 7
+} CeedProfileStage;
+
 /// Handle for object handling TensorContraction
 /// @ingroup CeedBasis
 typedef struct CeedTensorContract_private *CeedTensorContract;
@@ -49,7 +84,8 @@ typedef struct CeedTensorContract_private *CeedTensorContract;
 CEED_INTERN int CeedMallocArray(size_t n, size_t unit, void *p);
 CEED_INTERN int CeedCallocArray(size_t n, size_t unit, void *p);
 CEED_INTERN int CeedReallocArray(size_t n, size_t unit, void *p);
-CEED_INTERN int CeedFree(void *p);
+CEED_INTERN int CeedMallocHostArray(Ceed ceed, size_t n, size_t unit, void *p);
+CEED_INTERN int CeedFreeHost(Ceed ceed, void *p);
 
 #define CeedChk(ierr) do { if (ierr) return ierr; } while (0)
 /* Note that CeedMalloc and CeedCalloc will, generally, return pointers with
@@ -58,6 +94,10 @@ CEED_INTERN int CeedFree(void *p);
 #define CeedMalloc(n, p) CeedMallocArray((n), sizeof(**(p)), p)
 #define CeedCalloc(n, p) CeedCallocArray((n), sizeof(**(p)), p)
 #define CeedRealloc(n, p) CeedReallocArray((n), sizeof(**(p)), p)
+/* Large arrays of libCEED objects, taken from the allocator set with
+   CeedSetAllocator() when there is one, and released with CeedFreeHost(). */
+#define CeedMallocHost(ceed, n, p) \
+  CeedMallocHostArray((ceed), (n), sizeof(**(p)), p)
 
 /// Handle for object describing CeedQFunction fields
 /// @ingroup CeedQFunctionBackend
@@ -69,6 +109,7 @@ typedef struct CeedOperatorField_private *CeedOperatorField;
 CEED_EXTERN int CeedRegister(const char *prefix,
                              int (*init)(const char *, Ceed),
                              unsigned int priority);
+CEED_EXTERN int CeedIsRegistered(const char *prefix, bool *isregistered);
 
 CEED_EXTERN int CeedIsDebug(Ceed ceed, bool *isDebug);
 CEED_EXTERN int CeedGetParent(Ceed ceed, Ceed *parent);
@@ -84,20 +125,86 @@ CEED_EXTERN int CeedSetOperatorFallbackResource(Ceed ceed,
     const char *resource);
 CEED_EXTERN int CeedGetOperatorFallbackParentCeed(Ceed ceed, Ceed *parent);
 CEED_EXTERN int CeedSetDeterministic(Ceed ceed, bool isDeterministic);
+/// Longest kernel name kept in a CeedKernelInfo
+#define CEED_MAX_KERNEL_NAME 64
+
+/// Resource usage of a kernel compiled at runtime, reported by CeedView() and
+///   CeedOperatorView()
+/// @ingroup Ceed
+typedef struct {
+  /// Kernel name, truncated
+  char name[CEED_MAX_KERNEL_NAME];
+  /// Registers per thread
+  CeedInt registers;
+  /// Local memory per thread, including register spills, in bytes
+  size_t localbytes;
+  /// Shared memory per block, static and dynamic, in bytes
+  size_t sharedbytes;
+  /// Largest block size the kernel can be launched with
+  CeedInt maxthreads;
+  /// Block size the occupancy is computed for
+  CeedInt blocksize;
+  /// Theoretical occupancy, resident threads over the maximum per
+  ///   multiprocessor, or negative if unknown
+  double occupancy;
+} CeedKernelInfo;
+
+CEED_EXTERN int CeedAddKernelInfo(Ceed ceed, const CeedKernelInfo *info);
+CEED_EXTERN int CeedProfileStart(Ceed ceed, CeedProfileStage stage,
+                                 double *start);
+CEED_EXTERN int CeedProfileStop(Ceed ceed, CeedProfileStage stage,
+                                double start, double bytes);
+CEED_EXTERN int CeedProfileSuspend(Ceed ceed, bool suspend);
+CEED_EXTERN int CeedVectorAuditTransfer(CeedVector vec, CeedMemType dest,
+                                        size_t bytes);
+CEED_EXTERN int CeedTrackMemory(Ceed ceed, CeedMemoryClass memclass,
+                                CeedMemSpace space, ptrdiff_t bytes);
+CEED_EXTERN int CeedAllocatorMalloc(Ceed ceed, CeedMemSpace space,
+                                    size_t bytes, void *p, bool *used);
+CEED_EXTERN int CeedAllocatorFree(Ceed ceed, CeedMemSpace space, void *p,
+                                  bool *used);
+CEED_EXTERN int CeedIsSharedWork(Ceed ceed, bool *shared);
+CEED_EXTERN int CeedGetWorkArray(Ceed ceed, size_t n, CeedScalar **array);
+CEED_EXTERN int CeedRestoreWorkArray(Ceed ceed, CeedScalar **array);
+CEED_EXTERN int CeedLock(Ceed ceed);
+CEED_EXTERN int CeedUnlock(Ceed ceed);
 CEED_EXTERN int CeedSetBackendFunction(Ceed ceed,
                                        const char *type, void *object,
                                        const char *fname, int (*f)());
 CEED_EXTERN int CeedGetData(Ceed ceed, void *data);
 CEED_EXTERN int CeedSetData(Ceed ceed, void *data);
 
+CEED_EXTERN int CeedRequestCreate(Ceed ceed, CeedRequest *req);
+CEED_EXTERN int CeedRequestGetCeed(CeedRequest req, Ceed *ceed);
+CEED_EXTERN int CeedRequestGetData(CeedRequest req, void *data);
+CEED_EXTERN int CeedRequestSetData(CeedRequest req, void *data);
+
 CEED_EXTERN int CeedVectorGetCeed(CeedVector vec, Ceed *ceed);
 CEED_EXTERN int CeedVectorGetState(CeedVector vec, uint64_t *state);
 CEED_EXTERN int CeedVectorAddReference(CeedVector vec);
 CEED_EXTERN int CeedVectorGetData(CeedVector vec, void *data);
 CEED_EXTERN int CeedVectorSetData(CeedVector vec, void *data);
+CEED_EXTERN int CeedVectorTrackMemory(CeedVector vec, CeedMemSpace space,
+                                      ptrdiff_t bytes);
+CEED_EXTERN int CeedVectorSetMemoryClass(CeedVector vec,
+    CeedMemoryClass memclass);
+CEED_EXTERN int CeedVectorChebyshevUpdate(CeedVector x, CeedVector d,
+    CeedVector r, CeedVector w, CeedVector dinv, CeedScalar alpha,
+    CeedScalar beta);
+
+/// Fused updates and dot products of CeedVectorMultiAXPBYDot(), referring to
+///   the distinct vectors by index; write marks the updated vectors
+typedef struct {
+  CeedInt nvecs, nupdate, ndot;
+  CeedInt y[CEED_VECTOR_MULTI_MAX], x[CEED_VECTOR_MULTI_MAX];
+  CeedScalar alpha[CEED_VECTOR_MULTI_MAX], beta[CEED_VECTOR_MULTI_MAX];
+  CeedInt u[CEED_VECTOR_MULTI_MAX_DOTS], v[CEED_VECTOR_MULTI_MAX_DOTS];
+  bool write[CEED_VECTOR_MULTI_MAX];
+} CeedVectorMulti;
 
 CEED_EXTERN int CeedElemRestrictionGetCeed(CeedElemRestriction rstr,
     Ceed *ceed);
+CEED_EXTERN int CeedElemRestrictionAddReference(CeedElemRestriction rstr);
 CEED_EXTERN int CeedElemRestrictionGetStrides(CeedElemRestriction rstr,
     CeedInt (*strides)[3]);
 CEED_EXTERN int CeedElemRestrictionGetOffsets(CeedElemRestriction rstr,
@@ -108,6 +215,18 @@ CEED_EXTERN int CeedElemRestrictionIsStrided(CeedElemRestriction rstr,
     bool *isstrided);
 CEED_EXTERN int CeedElemRestrictionHasBackendStrides( CeedElemRestriction rstr,
     bool *hasbackendstrides);
+CEED_EXTERN int CeedElemRestrictionIsCompressed(CeedElemRestriction rstr,
+    bool *iscompressed);
+CEED_EXTERN int CeedElemRestrictionGetCompressedOffsets(
+  CeedElemRestriction rstr, const CeedInt **eoffsets, const CeedInt **stencil);
+CEED_EXTERN int CeedElemRestrictionGetNumSides(CeedElemRestriction rstr,
+    CeedInt *nsides);
+CEED_EXTERN int CeedElemRestrictionGetViewSource(CeedElemRestriction rstr,
+    CeedElemRestriction *source);
+CEED_EXTERN int CeedElemRestrictionGetIndexType(CeedElemRestriction rstr,
+    CeedIndexType *itype);
+CEED_EXTERN int CeedElemRestrictionCheckIndexType(CeedElemRestriction rstr,
+    CeedIndexType itype, bool *fits);
 CEED_EXTERN int CeedElemRestrictionGetELayout(CeedElemRestriction rstr,
     CeedInt (*layout)[3]);
 CEED_EXTERN int CeedElemRestrictionSetELayout(CeedElemRestriction rstr,
@@ -116,6 +235,24 @@ CEED_EXTERN int CeedElemRestrictionGetData(CeedElemRestriction rstr,
     void *data);
 CEED_EXTERN int CeedElemRestrictionSetData(CeedElemRestriction rstr,
     void *data);
+CEED_EXTERN int CeedElemRestrictionGetElementOrdering(
+  CeedElemRestriction rstr, CeedElemOrdering ordering, CeedInt *perm);
+CEED_EXTERN int CeedElemRestrictionCreateSubset(CeedElemRestriction rstr,
+    CeedInt nelem, const CeedInt *elems, CeedElemRestriction *rstrsub);
+CEED_EXTERN int CeedElemRestrictionCreatePermuted(CeedElemRestriction rstr,
+    const CeedInt *perm, CeedElemRestriction *rstrperm);
+CEED_EXTERN int CeedElemRestrictionCreateConcatenated(CeedInt nrstr,
+    CeedElemRestriction *rstrs, CeedElemRestriction *rstrcat);
+CEED_EXTERN int CeedElemRestrictionCreateOnCeed(CeedElemRestriction rstr,
+    Ceed ceed, CeedElemRestriction *rstrnew);
+CEED_EXTERN int CeedElemRestrictionGetCachedEVector(CeedElemRestriction rstr,
+    CeedVector lvec, CeedVector *evec, CeedRequest *request);
+CEED_EXTERN int CeedElemRestrictionRestoreCachedEVector(
+  CeedElemRestriction rstr, CeedVector *evec);
+CEED_EXTERN int CeedElemRestrictionApplyOverwrite(CeedElemRestriction rstr,
+    CeedVector u, CeedVector ru, CeedRequest *request);
+CEED_EXTERN int CeedElemRestrictionTrackMemory(CeedElemRestriction rstr,
+    CeedMemSpace space, ptrdiff_t bytes);
 
 CEED_EXTERN int CeedBasisGetCollocatedGrad(CeedBasis basis,
     CeedScalar *colograd1d);
@@ -124,12 +261,22 @@ CEED_EXTERN int CeedHouseholderApplyQ(CeedScalar *A, const CeedScalar *Q,
                                       CeedInt k, CeedInt row, CeedInt col);
 CEED_EXTERN int CeedBasisGetCeed(CeedBasis basis, Ceed *ceed);
 CEED_EXTERN int CeedBasisIsTensor(CeedBasis basis, bool *istensor);
+CEED_EXTERN int CeedBasisIsCollocated(CeedBasis basis, bool *iscollocated);
+CEED_EXTERN int CeedBasisIsSymmetric(CeedBasis basis, bool *issymmetric);
 CEED_EXTERN int CeedBasisGetData(CeedBasis basis, void *data);
 CEED_EXTERN int CeedBasisSetData(CeedBasis basis, void *data);
+CEED_EXTERN int CeedBasisTrackMemory(CeedBasis basis, CeedMemSpace space,
+                                     ptrdiff_t bytes);
 
 CEED_EXTERN int CeedBasisGetTopologyDimension(CeedElemTopology topo,
     CeedInt *dim);
 
+CEED_EXTERN int CeedBasisGetCollapsedSimplex(CeedBasis basis, CeedInt *P1d,
+    CeedInt *Q1d, const CeedScalar **vinv, const CeedScalar **interpc,
+    const CeedScalar **gradc, const CeedScalar **detadx);
+CEED_EXTERN int CeedBasisCreateOnCeed(CeedBasis basis, Ceed ceed,
+                                      CeedBasis *basisnew);
+
 CEED_EXTERN int CeedBasisGetTensorContract(CeedBasis basis,
     CeedTensorContract *contract);
 CEED_EXTERN int CeedBasisSetTensorContract(CeedBasis basis,
@@ -143,6 +290,10 @@ CEED_EXTERN int CeedTensorContractApply(CeedTensorContract contract, CeedInt A,
                                         const CeedInt Add,
                                         const CeedScalar *__restrict__ u,
                                         CeedScalar *__restrict__ v);
+CEED_EXTERN int CeedTensorContractApplyFull(CeedTensorContract contract,
+    CeedInt dim, CeedInt ncomp, CeedInt P, CeedInt Q, CeedInt nelem,
+    const CeedScalar *const *t, CeedTransposeMode tmode, const CeedInt Add,
+    const CeedScalar *__restrict__ u, CeedScalar *__restrict__ v);
 CEED_EXTERN int CeedTensorContractGetCeed(CeedTensorContract contract,
     Ceed *ceed);
 CEED_EXTERN int CeedTensorContractGetData(CeedTensorContract contract,
@@ -151,8 +302,9 @@ CEED_EXTERN int CeedTensorContractSetData(CeedTensorContract contract,
     void *data);
 CEED_EXTERN int CeedTensorContractDestroy(CeedTensorContract *contract);
 
-CEED_EXTERN int CeedQFunctionRegister(const char *, const char *, CeedInt,
-                                      CeedQFunctionUser, int (*init)(Ceed, const char *, CeedQFunction));
+CEED_EXTERN int CeedQFunctionRegister(const char *, const char *,
+                                      const char *, CeedInt, CeedQFunctionUser,
+                                      int (*init)(Ceed, const char *, CeedQFunction));
 CEED_EXTERN int CeedQFunctionSetFortranStatus(CeedQFunction qf, bool status);
 CEED_EXTERN int CeedQFunctionGetCeed(CeedQFunction qf, Ceed *ceed);
 CEED_EXTERN int CeedQFunctionGetVectorLength(CeedQFunction qf,
@@ -161,6 +313,8 @@ CEED_EXTERN int CeedQFunctionGetNumArgs(CeedQFunction qf,
                                         CeedInt *numinputfields,
                                         CeedInt *numoutputfields);
 CEED_EXTERN int CeedQFunctionGetSourcePath(CeedQFunction qf, char **source);
+CEED_EXTERN int CeedQFunctionGetSourceCode(CeedQFunction qf,
+    const char **code);
 CEED_EXTERN int CeedQFunctionGetUserFunction(CeedQFunction qf,
     CeedQFunctionUser *f);
 CEED_EXTERN int CeedQFunctionGetContext(CeedQFunction qf,
@@ -170,6 +324,9 @@ CEED_EXTERN int CeedQFunctionGetInnerContext(CeedQFunction qf,
 CEED_EXTERN int CeedQFunctionIsIdentity(CeedQFunction qf, bool *isidentity);
 CEED_EXTERN int CeedQFunctionGetData(CeedQFunction qf, void *data);
 CEED_EXTERN int CeedQFunctionSetData(CeedQFunction qf, void *data);
+CEED_EXTERN int CeedQFunctionApplyRaw(CeedQFunction qf, CeedInt Q,
+                                      const CeedScalar *const *u,
+                                      CeedScalar *const *v);
 CEED_EXTERN int CeedQFunctionGetFields(CeedQFunction qf,
                                        CeedQFunctionField **inputfields,
                                        CeedQFunctionField **outputfields);
@@ -179,6 +336,8 @@ CEED_EXTERN int CeedQFunctionFieldGetSize(CeedQFunctionField qffield,
     CeedInt *size);
 CEED_EXTERN int CeedQFunctionFieldGetEvalMode(CeedQFunctionField qffield,
     CeedEvalMode *emode);
+CEED_EXTERN int CeedQFunctionCreateOnCeed(CeedQFunction qf, Ceed ceed,
+    CeedQFunction *qfnew);
 
 CEED_EXTERN int CeedQFunctionContextGetCeed(CeedQFunctionContext cxt,
     Ceed *ceed);
@@ -190,6 +349,10 @@ CEED_EXTERN int CeedQFunctionContextGetBackendData(CeedQFunctionContext ctx,
     void *data);
 CEED_EXTERN int CeedQFunctionContextSetBackendData(CeedQFunctionContext ctx,
     void *data);
+CEED_EXTERN int CeedQFunctionContextTrackMemory(CeedQFunctionContext ctx,
+    CeedMemSpace space, ptrdiff_t bytes);
+CEED_EXTERN int CeedQFunctionContextCreateOnCeed(CeedQFunctionContext ctx,
+    Ceed ceed, CeedQFunctionContext *ctxnew);
 
 CEED_EXTERN int CeedOperatorGetCeed(CeedOperator op, Ceed *ceed);
 CEED_EXTERN int CeedOperatorGetNumElements(CeedOperator op, CeedInt *numelem);
@@ -204,8 +367,13 @@ CEED_EXTERN int CeedOperatorGetSubList(CeedOperator op,
                                        CeedOperator **suboperators);
 CEED_EXTERN int CeedOperatorGetData(CeedOperator op, void *data);
 CEED_EXTERN int CeedOperatorSetData(CeedOperator op, void *data);
+CEED_EXTERN int CeedOperatorSetKernelInfo(CeedOperator op,
+    const CeedKernelInfo *info);
 CEED_EXTERN int CeedOperatorSetSetupDone(CeedOperator op);
 
+CEED_EXTERN int CeedOperatorGetDirichlet(CeedOperator op, CeedInt *nbc,
+    const CeedInt **indices, CeedVector *values);
+CEED_EXTERN int CeedOperatorGetFDMMode(CeedOperator op, CeedFDMMode *mode);
 CEED_EXTERN int CeedOperatorGetFields(CeedOperator op,
                                       CeedOperatorField **inputfields,
                                       CeedOperatorField **outputfields);
@@ -215,6 +383,19 @@ CEED_EXTERN int CeedOperatorFieldGetBasis(CeedOperatorField opfield,
     CeedBasis *basis);
 CEED_EXTERN int CeedOperatorFieldGetVector(CeedOperatorField opfield,
     CeedVector *vec);
+CEED_EXTERN int CeedOperatorFieldGetStorage(CeedOperatorField opfield,
+    CeedStorageType *storage);
+CEED_EXTERN int CeedOperatorCreateDelegate(CeedOperator op, Ceed ceed,
+    CeedOperator *opdelegate);
+CEED_EXTERN int CeedOperatorDestroyDelegate(CeedOperator *opdelegate);
+
+CEED_EXTERN int CeedStorageGetSize(CeedStorageType storage, size_t *size);
+CEED_EXTERN int CeedStorageNarrow(CeedStorageType storage, CeedInt n,
+                                  const CeedScalar *in, void *out);
+CEED_EXTERN int CeedStorageWiden(CeedStorageType storage, CeedInt n,
+                                 const void *in, CeedScalar *out);
+CEED_EXTERN int CeedVectorRoundToStorage(CeedVector vec,
+    CeedStorageType storage);
 
 CEED_INTERN int CeedMatrixMultiply(Ceed ceed, const CeedScalar *matA,
                                    const CeedScalar *matB, CeedScalar *matC,
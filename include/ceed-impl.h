@@ -21,6 +21,7 @@
 
 #include <ceed.h>
 #include <ceed-backend.h>
+#include <pthread.h>
 #include <stdbool.h>
 
 /** @defgroup CeedUser Public API for Ceed
@@ -90,14 +91,85 @@ typedef struct {
   Ceed delegate;
 } objdelegate;
 
+/// Hardware counters read with PAPI around profiled stages on CPU backends
+typedef enum {
+  CEED_COUNTER_L1_MISSES = 0,
+  CEED_COUNTER_L2_MISSES = 1,
+  CEED_COUNTER_L3_MISSES = 2,
+  CEED_COUNTER_FP_OPS    = 3,
+  CEED_COUNTER_CYCLES    = 4,
+  CEED_NUM_COUNTERS      = 5,
+} CeedCounter;
+#define CEED_COUNTER_MAX_DEPTH 16
+#define CEED_SYNC_AUDIT_MAX_DEPTH 16
+
+/// Sources of the energy measured around CeedOperator applications
+typedef enum {
+  CEED_ENERGY_HOST   = 0, /// CPU packages, read from RAPL
+  CEED_ENERGY_DEVICE = 1, /// Device of a GPU backend, from NVML or ROCm SMI
+  CEED_NUM_ENERGY    = 2,
+} CeedEnergySource;
+
+/// Call counts, wall times, and bytes moved and flops for each profiled stage
+typedef struct {
+  CeedInt count[CEED_PROFILE_NUM_STAGES];
+  double time[CEED_PROFILE_NUM_STAGES];
+  double bytes[CEED_PROFILE_NUM_STAGES];
+  double flops[CEED_PROFILE_NUM_STAGES];
+  long long counters[CEED_PROFILE_NUM_STAGES][CEED_NUM_COUNTERS];
+  CeedInt energycount[CEED_NUM_ENERGY]; /// Operator applications measured
+  double energy[CEED_NUM_ENERGY];       /// Joules used by those applications
+  double dofs[CEED_NUM_ENERGY];         /// DoFs of those applications
+} CeedProfileData;
+
+/// Host and device times of a profiled stage, recorded when tracing
+typedef struct {
+  CeedProfileStage stage;
+  double start, end;       /// Host times, CLOCK_MONOTONIC in seconds
+  double devstart, devend; /// Device times on the host clock, or negative
+  double bytes, flops;
+} CeedTraceEvent;
+
+/// Host array of the scratch arena of a Ceed, see CeedGetWorkArray()
+typedef struct {
+  CeedScalar *array;
+  size_t n;
+  bool inuse;
+} CeedWorkArray;
+
+CEED_INTERN int CeedProfileStopFlops(Ceed ceed, CeedProfileStage stage,
+                                     double start, double bytes, double flops);
+CEED_INTERN int CeedProfileStopOperator(Ceed ceed, double start,
+                                        double bytes, double flops,
+                                        double dofs);
+CEED_INTERN int CeedProfileSetOperator(Ceed ceed, CeedOperator op,
+                                       CeedOperator *prevop);
+CEED_INTERN int CeedKernelInfoView(const CeedKernelInfo *kernels,
+                                   const CeedInt *counts, CeedInt numkernels,
+                                   const char *indent, FILE *stream);
+CEED_INTERN int CeedProfileView(const CeedProfileData *data, const char *indent,
+                                FILE *stream);
+
+/// Reference counts of Ceeds and objects change atomically, since host threads
+///   applying distinct operators create, reference, and destroy objects they
+///   share; CeedDereference() evaluates to the remaining count
+#define CeedReference(obj) \
+  __atomic_add_fetch(&(obj)->refcount, 1, __ATOMIC_RELAXED)
+#define CeedDereference(obj) \
+  __atomic_sub_fetch(&(obj)->refcount, 1, __ATOMIC_ACQ_REL)
+
 struct Ceed_private {
   const char *resource;
   Ceed delegate;
   Ceed parent;
   objdelegate *objdelegates;
   int objdelegatecount;
+  struct kh_CeedObjectDelegate_s *objdelegatemap; /// objdelegates by objname
   Ceed opfallbackceed, opfallbackparent;
   const char *opfallbackresource;
+  bool opfallbackdelegate; /// opfallbackceed is also a delegate of this Ceed
+  CeedInt numopfallbacks;  /// Operators given a fallback
+  CeedInt numopfallbackscrossed; /// Fallbacks to another memory space
   int (*Error)(Ceed, const char *, int, const char *, int, const char *,
                va_list *);
   int (*GetPreferredMemType)(CeedMemType *);
@@ -107,6 +179,8 @@ struct Ceed_private {
                                const CeedInt *, CeedElemRestriction);
   int (*ElemRestrictionCreateBlocked)(CeedMemType, CeedCopyMode,
                                       const CeedInt *, CeedElemRestriction);
+  int (*ElemRestrictionCreateCompressed)(CeedMemType, CeedCopyMode,
+                                         const CeedInt *, CeedElemRestriction);
   int (*BasisCreateTensorH1)(CeedInt, CeedInt, CeedInt, const CeedScalar *,
                              const CeedScalar *, const CeedScalar *,
                              const CeedScalar *, CeedBasis);
@@ -119,19 +193,80 @@ struct Ceed_private {
   int (*QFunctionContextCreate)(CeedQFunctionContext);
   int (*OperatorCreate)(CeedOperator);
   int (*CompositeOperatorCreate)(CeedOperator);
+  int (*ProfilePush)(Ceed, const char *);
+  int (*ProfilePop)(Ceed, double *, double *);
+  int (*EnergyRead)(Ceed, double *);
+  int (*MemoryPoolTrim)(Ceed);
+  int (*MemoryPoolGetUsage)(Ceed, size_t *, size_t *, size_t *);
+  int (*SetCurrentDevice)(Ceed);
+  int (*ShareDevice)(Ceed, Ceed);
   int refcount;
   bool isDeterministic;
   void *data;
   bool debug;
+  bool profile;
+  bool profilesuspended;
+  CeedOperator profileop;     /// Innermost CeedOperator being applied
+  CeedInt profiledepth;       /// Number of nested CeedOperator applications
+  CeedProfileData profiledata;
+  bool countertried;          /// Hardware counters were requested
+  bool counting;              /// Holds a reference to the PAPI event set
+  CeedInt counterdepth;       /// Number of open stages being counted
+  long long counterstart[CEED_COUNTER_MAX_DEPTH][CEED_NUM_COUNTERS];
+  bool energytried;           /// Energy sources were probed
+  bool energyavail[CEED_NUM_ENERGY];
+  CeedInt energydepth;        /// Number of open operator stages measured
+  double energystart[CEED_COUNTER_MAX_DEPTH][CEED_NUM_ENERGY];
+  char *tracefile;            /// Chrome trace written by CeedDestroy()
+  CeedTraceEvent *traceevents;
+  size_t numtraceevents, maxtraceevents;
+  CeedKernelInfo *kernels;    /// Distinct kernels compiled at runtime
+  CeedInt *kernelcounts;      /// Number of kernels compiled with each usage
+  CeedInt numkernels, maxkernels;
+  CeedSyncAuditMode syncaudit; /// Set by CeedSetSyncAudit()
+  const char *auditregions[CEED_SYNC_AUDIT_MAX_DEPTH]; /// Open audited regions
+  CeedInt auditdepth;
+  CeedInt numtransfers[2];    /// Audited transfers, by destination CeedMemType
+  size_t transferbytes[2];
+  /// Bytes allocated to libCEED objects, by CeedMemoryClass and CeedMemSpace
+  size_t memusage[CEED_MEMORY_NUM_CLASSES][CEED_MEMSPACE_NUM];
+  size_t memtotal[CEED_MEMSPACE_NUM];     /// Bytes allocated in each space
+  size_t memhighwater[CEED_MEMSPACE_NUM]; /// Largest memtotal reached
+  CeedAllocFunction alloc;    /// Allocator set by CeedSetAllocator()
+  CeedDeallocFunction dealloc;
+  void *allocctx;
+  char *jitoptions;           /// Additional options for runtime compilation
+  CeedBasis *basiscache;      /// Lagrange bases shared by identical requests
+  CeedInt numbasiscache, maxbasiscache;
+  bool sharedwork;            /// Operators borrow work from the arena
+  CeedWorkArray *work;        /// Scratch arena of operator work arrays
+  CeedInt numwork, maxwork;
   char errmsg[CEED_MAX_RESOURCE_LEN];
-  foffset *foffsets;
+  pthread_mutex_t lock;       /// Recursive, see CeedLock()
+};
+
+struct CeedRequest_private {
+  Ceed ceed;
+  int (*Wait)(CeedRequest);
+  int (*Destroy)(CeedRequest);
+  void *data;
 };
 
+CEED_INTERN int CeedVectorSetAuditSite(CeedVector vec, const char *site,
+                                       void *caller);
+CEED_INTERN int CeedVectorWriteRecord(CeedVector vec,
+                                      CeedElemRestriction rstr, FILE *stream);
+CEED_INTERN int CeedVectorReadRecord(CeedVector vec, CeedElemRestriction rstr,
+                                     const void *record, size_t size,
+                                     size_t *used);
+
 struct CeedVector_private {
   Ceed ceed;
   int (*SetArray)(CeedVector, CeedMemType, CeedCopyMode, CeedScalar *);
   int (*SetValue)(CeedVector, CeedScalar);
+  int (*Copy)(CeedVector, CeedVector);
   int (*SyncArray)(CeedVector, CeedMemType);
+  int (*Snapshot)(CeedVector, CeedInt, CeedVector, CeedRequest *);
   int (*TakeArray)(CeedVector, CeedMemType, CeedScalar **);
   int (*GetArray)(CeedVector, CeedMemType, CeedScalar **);
   int (*GetArrayRead)(CeedVector, CeedMemType, const CeedScalar **);
@@ -139,11 +274,30 @@ struct CeedVector_private {
   int (*RestoreArrayRead)(CeedVector);
   int (*Norm)(CeedVector, CeedNormType, CeedScalar *);
   int (*Reciprocal)(CeedVector);
+  int (*PointBlockInvert)(CeedVector, CeedInt);
+  int (*AXPY)(CeedVector, CeedScalar, CeedVector);
+  int (*AXPBY)(CeedVector, CeedScalar, CeedScalar, CeedVector);
+  int (*PointwiseMult)(CeedVector, CeedVector, CeedVector);
+  int (*Dot)(CeedVector, CeedVector, CeedScalar *);
+  int (*Norms)(CeedVector, CeedInt, const CeedNormType *, CeedVector);
+  int (*ReduceSegments)(CeedVector, CeedReduceType, bool, CeedVector);
+  int (*DotVector)(CeedVector, CeedVector, CeedVector);
+  int (*MultiAXPBYDot)(CeedVector *, const CeedVectorMulti *, CeedVector);
+  int (*ChebyshevUpdate)(CeedVector, CeedVector, CeedVector, CeedVector,
+                         CeedVector, CeedScalar, CeedScalar);
   int (*Destroy)(CeedVector);
   int refcount;
   CeedInt length;
   uint64_t state;
   uint64_t numreaders;
+  CeedMemoryClass memclass;
+  size_t memusage[CEED_MEMSPACE_NUM];
+  CeedVector parent;          /// CeedVector viewed, for views
+  CeedInt viewoffset;         /// Offset of a view in its parent
+  CeedScalar *boundarray;     /// Application array bound as the storage
+  CeedMemType boundmtype;     /// Memory type of the bound array
+  const char *auditsite;      /// Interface function of the last array access
+  void *auditcaller;          /// Return address of that function
   void *data;
 };
 
@@ -153,7 +307,11 @@ struct CeedElemRestriction_private {
                CeedRequest *);
   int (*ApplyBlock)(CeedElemRestriction, CeedInt, CeedTransposeMode, CeedVector,
                     CeedVector, CeedRequest *);
+  int (*ApplyOverwrite)(CeedElemRestriction, CeedVector, CeedVector,
+                        CeedRequest *);
   int (*GetOffsets)(CeedElemRestriction, CeedMemType, const CeedInt **);
+  int (*SetIndexType)(CeedElemRestriction, CeedIndexType);
+  int (*GetMultiplicity)(CeedElemRestriction, CeedVector);
   int (*Destroy)(CeedElemRestriction);
   int refcount;
   CeedInt nelem;            /* number of elements */
@@ -165,8 +323,24 @@ struct CeedElemRestriction_private {
   CeedInt blksize;          /* number of elements in a batch */
   CeedInt nblk;             /* number of blocks of elements */
   CeedInt *strides;         /* strides between [nodes, components, elements] */
+  CeedInt *eoffsets;        /* base offset of each element, for compressed
+                                 restrictions */
+  CeedInt *stencil;         /* offsets of the element nodes relative to the
+                                 element base offset, for compressed
+                                 restrictions */
+  CeedInt nsides;           /* number of elements sharing each face, for
+                                 two-sided interface restrictions */
   CeedInt layout[3];        /* E-vector layout [nodes, components, elements] */
+  CeedElemRestriction viewof; /* restriction whose offsets this one shares */
+  CeedIndexType indextype;  /* integer type of the offsets read on apply */
   uint64_t numreaders;      /* number of instances of offset read only access */
+  CeedVector cachedevec;    /* E-vector of the last cached restriction */
+  CeedVector cachedlvec;    /* L-vector restricted into cachedevec */
+  uint64_t cachedstate;     /* state of cachedlvec when restricted */
+  CeedInt numcachedreaders; /* number of callers reading cachedevec */
+  CeedVector mult;          /* multiplicity of the L-vector nodes, computed on
+                                 first use */
+  size_t memusage[CEED_MEMSPACE_NUM]; /* bytes allocated in each space */
   void *data;               /* place for the backend to store any data */
 };
 
@@ -177,6 +351,10 @@ struct CeedBasis_private {
   int (*Destroy)(CeedBasis);
   int refcount;
   bool tensorbasis;      /* flag for tensor basis */
+  bool collocated;       /* flag for quadrature points at the nodes, Q1d = P1d
+                              with identity interp1d */
+  bool symmetric;        /* flag for centro-symmetric interp1d and
+                              anti-centro-symmetric grad1d */
   CeedInt dim;           /* topological dimension */
   CeedElemTopology topo; /* element topology */
   CeedInt ncomp;         /* number of field components (1 for scalar fields) */
@@ -184,6 +362,9 @@ struct CeedBasis_private {
   CeedInt Q1d;           /* number of quadrature points in one dimension */
   CeedInt P;             /* total number of nodes */
   CeedInt Q;             /* total number of quadrature points */
+  CeedQuadMode qmode;    /* distribution of the quadrature points of a cached
+                              Lagrange basis */
+  bool cached;           /* flag for a basis in the basis cache of its Ceed */
   CeedScalar *qref1d;    /* Array of length Q1d holding the locations of
                               quadrature points on the 1D reference
                               element [-1, 1] */
@@ -201,7 +382,19 @@ struct CeedBasis_private {
   CeedScalar
   *grad1d;    /* row-major matrix of shape [Q1d, P1d] matrix expressing
                    derivatives of nodal basis functions at quadrature points */
+  CeedScalar
+  *vinv;      /* row-major matrix of shape [P, P] mapping nodal values to
+                   modal coefficients of a collapsed coordinate simplex basis */
+  CeedScalar
+  *interpc;   /* values of the modal functions in each collapsed coordinate */
+  CeedScalar
+  *gradc;     /* derivatives of the modal functions in each collapsed
+                   coordinate */
+  CeedScalar
+  *detadx;    /* row-major array of shape [Q, dim, dim] of derivatives of
+                   collapsed coordinates with respect to reference coordinates */
   CeedTensorContract contract; /* tensor contraction object */
+  size_t memusage[CEED_MEMSPACE_NUM]; /* bytes allocated in each space */
   void *data;                  /* place for the backend to store any data */
 };
 
@@ -210,6 +403,10 @@ struct CeedTensorContract_private {
   int (*Apply)(CeedTensorContract, CeedInt, CeedInt, CeedInt, CeedInt,
                const CeedScalar *restrict, CeedTransposeMode, const CeedInt,
                const CeedScalar *restrict, CeedScalar *restrict);
+  int (*ApplyFull)(CeedTensorContract, CeedInt, CeedInt, CeedInt, CeedInt,
+                   CeedInt, const CeedScalar *const *, CeedTransposeMode,
+                   const CeedInt, const CeedScalar *restrict,
+                   CeedScalar *restrict);
   int (*Destroy)(CeedTensorContract);
   int refcount;
   void *data;
@@ -224,6 +421,8 @@ struct CeedQFunctionField_private {
 struct CeedQFunction_private {
   Ceed ceed;
   int (*Apply)(CeedQFunction, CeedInt, CeedVector *, CeedVector *);
+  int (*ApplyRaw)(CeedQFunction, CeedInt, const CeedScalar *const *,
+                  CeedScalar *const *);
   int (*SetCUDAUserFunction)(CeedQFunction, void *);
   int (*SetHIPUserFunction)(CeedQFunction, void *);
   int (*Destroy)(CeedQFunction);
@@ -235,28 +434,43 @@ struct CeedQFunction_private {
   CeedInt numinputfields, numoutputfields;
   CeedQFunctionUser function;
   const char *sourcepath;
+  const char *sourcecode; /* contents of source file, if embedded */
   const char *qfname;
   bool identity;
   bool fortranstatus;
+  size_t userflops;         /* flops per quadrature point, set by the user */
   CeedQFunctionContext ctx; /* user context for function */
   void *data;          /* place for the backend to store any data */
 };
 
+typedef struct {
+  char *name;
+  char *description;
+  CeedContextFieldType type;
+  size_t offset;
+  size_t numvalues;
+} CeedContextFieldDescription;
+
 struct CeedQFunctionContext_private {
   Ceed ceed;
   int refcount;
   int (*SetData)(CeedQFunctionContext, CeedMemType, CeedCopyMode, void *);
   int (*GetData)(CeedQFunctionContext, CeedMemType, void *);
   int (*RestoreData)(CeedQFunctionContext);
+  int (*SetField)(CeedQFunctionContext, size_t, size_t, const void *);
   int (*Destroy)(CeedQFunctionContext);
   uint64_t state;
   size_t ctxsize;
+  CeedContextFieldDescription *fields;
+  CeedInt numfields;
+  size_t memusage[CEED_MEMSPACE_NUM];
   void *data;
 };
 
 /// Struct to handle the context data to use the Fortran QFunction stub
 /// @ingroup CeedQFunction
 struct CeedFortranContext_private {
+  CeedQFunction qf; // Not referenced; the QFunction owns this context
   CeedQFunctionContext innerctx;
   void (*f)(void *ctx, int *nq,
             const CeedScalar *u,const CeedScalar *u1,
@@ -283,8 +497,42 @@ struct CeedOperatorField_private {
   CeedVector vec;                /* State vector for passive fields or
                                       CEED_VECTOR_NONE for no vector */
   const char *fieldname;         /* matching QFunction field name */
+  CeedOperator buildop;          /* Operator computing vec on demand, or NULL */
+  CeedVector buildinput;         /* Active input of buildop */
+  uint64_t buildstate;           /* Input state when vec was last built */
+  bool built;                    /* vec has been built at least once */
+  CeedStorageType storage;       /* Storage precision of passive input */
+  CeedVector reduction;          /* Reduced values of an output, or NULL */
+  CeedReduceType rtype;          /* Reduction of the output values */
 };
 
+/// Suboperators of a composite CeedOperator evaluated by one fused QFunction;
+///   fields of the suboperators map to fields of the fused operator, sub-major
+typedef struct {
+  CeedInt numsub, maxfields;
+  CeedQFunctionUser f[CEED_COMPOSITE_MAX]; /// User function of each sub
+  CeedInt ctxindex[CEED_COMPOSITE_MAX];    /// Context of each sub, or -1
+  CeedQFunctionContext ctx[CEED_COMPOSITE_MAX]; /// Distinct contexts
+  void *ctxdata[CEED_COMPOSITE_MAX];       /// Context data while applied
+  CeedInt numctx;
+  CeedInt instart[CEED_COMPOSITE_MAX+1], outstart[CEED_COMPOSITE_MAX+1];
+  CeedInt *inmap, *outmap;   /// Fused field of each suboperator field
+  CeedInt *outsize;          /// Size of each suboperator output field
+  bool *outadd;              /// Output adds to one written by an earlier sub
+  size_t scratchsize;        /// Scratch values per quadrature point
+} CeedOperatorFusion;
+
+/// Instances of an ensemble CeedOperator with distinct QFunction contexts,
+///   followed in memory by the copies of the context data of every instance
+typedef struct {
+  CeedQFunctionUser f;       /// User function of the instances
+  CeedInt numinstances, numinputs, numoutputs;
+  size_t ctxsize;            /// Bytes of the context data of each instance
+  size_t ctxoffset;          /// Bytes from the struct to the first copy
+  size_t scratchsize;        /// Values of all fields per quadrature point
+  CeedInt sizes[];           /// Size of each input, then each output field
+} CeedOperatorEnsemble;
+
 struct CeedOperator_private {
   Ceed ceed;
   CeedOperator opfallback;
@@ -292,19 +540,30 @@ struct CeedOperator_private {
   int refcount;
   int (*LinearAssembleQFunction)(CeedOperator, CeedVector *,
                                  CeedElemRestriction *, CeedRequest *);
+  int (*LinearAssembleQFunctionUpdate)(CeedOperator, CeedVector,
+                                       CeedElemRestriction, CeedRequest *);
   int (*LinearAssembleDiagonal)(CeedOperator, CeedVector, CeedRequest *);
   int (*LinearAssembleAddDiagonal)(CeedOperator, CeedVector, CeedRequest *);
   int (*LinearAssemblePointBlockDiagonal)(CeedOperator, CeedVector,
                                           CeedRequest *);
   int (*LinearAssembleAddPointBlockDiagonal)(CeedOperator, CeedVector,
       CeedRequest *);
+  int (*LinearAssembleSymbolic)(CeedOperator, CeedInt *, CeedInt **,
+                                CeedInt **);
+  int (*LinearAssemble)(CeedOperator, CeedVector);
   int (*CreateFDMElementInverse)(CeedOperator, CeedOperator *, CeedRequest *);
+  int (*Prepare)(CeedOperator);
   int (*Apply)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAdd)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAddComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
+  int (*ApplyDot)(CeedOperator, CeedVector, CeedVector, CeedScalar *,
+                  CeedRequest *);
+  int (*ApplyAddMultiple)(CeedOperator, CeedInt, CeedVector *, CeedVector *,
+                          CeedRequest *);
   int (*ApplyJacobian)(CeedOperator, CeedVector, CeedVector, CeedVector,
                        CeedVector, CeedRequest *);
+  int (*SetDirichlet)(CeedOperator);
   int (*Destroy)(CeedOperator);
   CeedOperatorField *inputfields;
   CeedOperatorField *outputfields;
@@ -316,9 +575,53 @@ struct CeedOperator_private {
   CeedQFunction dqfT;
   bool setupdone;
   bool composite;
+  bool sharded;              /// Composite with suboperators on other Ceeds
   bool hasrestriction;
   CeedOperator *suboperators;
   CeedInt numsub;
+  CeedVector *shardin, *shardout; /// L-vectors of each shard, on its Ceed
+  CeedOperator *splitops;    /// Full operators whose elements are split
+  CeedInt *splitfirst;       /// First element of each shard, then the total
+  CeedInt splitapplies;      /// Number of timed applies to balance the split
+  CeedInt numorders;         /// Number of element groups of a p-adaptive op
+  CeedInt *orders;           /// Order of the elements of each group
+  CeedInt *orderfirst;       /// First element of each group, then the total
+  CeedInt *orderelems;       /// Elements grouped by order
+  CeedOperator smoothop;     /// Operator smoothed by a Chebyshev smoother
+  CeedVector smoothdinv;     /// Inverse diagonal of smoothop
+  CeedVector smoothr, smoothd, smoothw; /// Residual, direction, and product
+  CeedScalar smoothlmin, smoothlmax; /// Eigenvalue bounds of diag^-1 smoothop
+  CeedInt smoothdegree;      /// Number of smoothing sweeps
+  CeedOperator chainops[2];  /// Operators applied in turn by a chain
+  CeedVector chainvec;       /// Intermediate vector of a chain
+  bool chainfused;           /// Intermediate kept in element layout
+  CeedVector stagein, stageout; /// Copies of vectors in other memory spaces
+  CeedOperator fusedop;      /// Suboperators fused into one operator
+  CeedOperatorFusion *fusion;
+  bool fusionchecked;        /// Whether fusion of suboperators was decided
+  CeedInt numensemble;       /// Instances of an ensemble with distinct contexts
+  CeedQFunctionContext *ensemblectx; /// Context of each instance
+  uint64_t *ensemblestate;   /// Context states when copied for the ensemble
+  CeedInt nbc;               /// Number of Dirichlet constrained entries
+  CeedInt *bcindices;        /// Constrained entries of the active L-vectors
+  CeedVector bcvalues;       /// Constrained values, or CEED_VECTOR_NONE
+  CeedVector bcin;           /// Input with constrained values, for fallback
+  CeedScalar *bcsaved;       /// Output entries kept by fallback ApplyAdd
+  bool bcapplying;           /// Constraint applied by the fallback
+  CeedOperator transposeop;  /// Transpose applying the assembled QFunction
+  CeedVector qfassembled;    /// Assembled QFunction kept for updates
+  CeedElemRestriction qfassembledrstr;
+  uint64_t qfassembledstate; /// Passive input and context state when assembled
+  CeedFDMMode fdmmode;       /// Scaling of FDM element inverses
+  CeedElemMatrixMode ematmode;
+  bool ematchecked;          /// Whether element matrices apply was decided
+  bool ematused;             /// Whether the operator applies element matrices
+  CeedVector emat;           /// Dense element matrices
+  CeedVector ematin, ematout; /// Active input and output E-vectors
+  uint64_t ematstate;        /// Passive input and context state when assembled
+  CeedProfileData profiledata;
+  CeedKernelInfo *kernels;   /// Kernels set by the backend, by name
+  CeedInt numkernels;
   void *data;
 };
 
@@ -78,6 +78,59 @@
 #  define CEED_Q_VLA Q
 #endif
 
+/**
+  @ingroup CeedQFunction
+  Number of quadrature points in the chunks passed to User QFunction kernels
+    defined with CEED_QFUNCTION_CHUNK. GPU backends define it as 1, so each
+    thread evaluates one quadrature point.
+**/
+#ifndef CEED_CHUNK_WIDTH
+#  define CEED_CHUNK_WIDTH 8
+#endif
+
+/**
+  @ingroup CeedQFunction
+  This macro defines a User QFunction from a kernel that evaluates the
+    quadrature points i to i+CEED_CHUNK_WIDTH-1, of which the first nlanes
+    are active. The kernel has the signature
+
+      (void *ctx, CeedInt Q, CeedInt i, CeedInt nlanes,
+       const CeedScalar *const *in, CeedScalar *const *out)
+
+    where component c of point i+j of a field is at index c*Q+i+j, and loops
+    over the lanes with CeedForLanes(). The fixed trip count vectorizes where
+    a flat loop over Q does not. Only a trailing chunk has inactive lanes, so
+    the blocked CPU backends, which evaluate Q times eight points at once,
+    always pass full chunks.
+**/
+#ifndef CEED_QFUNCTION_CHUNK
+#define CEED_QFUNCTION_CHUNK(name) \
+  static inline int name ## _chunk(void *, CeedInt, CeedInt, CeedInt, \
+                                   const CeedScalar *const *, \
+                                   CeedScalar *const *); \
+  CEED_QFUNCTION(name)(void *ctx, const CeedInt Q, \
+                       const CeedScalar *const *in, CeedScalar *const *out) { \
+    CeedInt i = 0; \
+    for (; i + CEED_CHUNK_WIDTH <= Q; i += CEED_CHUNK_WIDTH) { \
+      int ierr = name ## _chunk(ctx, Q, i, CEED_CHUNK_WIDTH, in, out); \
+      if (ierr) return ierr; \
+    } \
+    return i < Q ? name ## _chunk(ctx, Q, i, Q - i, in, out) : 0; \
+  } \
+  static inline int name ## _chunk
+#endif
+
+/**
+  @ingroup CeedQFunction
+  Loop over the lanes of a chunk in a User QFunction kernel defined with
+    CEED_QFUNCTION_CHUNK, skipping the inactive lanes.
+**/
+#ifndef CeedForLanes
+#  define CeedForLanes(j, nlanes) \
+  CeedPragmaSIMD \
+  for (CeedInt j = 0; j < CEED_CHUNK_WIDTH; j++) if (j < (nlanes))
+#endif
+
 /**
   @ingroup Ceed
   This macro provides the appropriate SIMD Pragma for the compilation
@@ -115,9 +168,22 @@
 /// Integer type, used for indexing
 /// @ingroup Ceed
 typedef int32_t CeedInt;
-/// Scalar (floating point) type
+/// Scalar (floating point) type, selected at build time with
+/// CEED_SINGLE_PRECISION
 /// @ingroup Ceed
+#ifdef CEED_SINGLE_PRECISION
+typedef float CeedScalar;
+#else
 typedef double CeedScalar;
+#endif
+/// Machine epsilon of \ref CeedScalar, for tolerances that hold in both
+///   precisions
+/// @ingroup Ceed
+#ifdef CEED_SINGLE_PRECISION
+#define CEED_EPSILON 6E-08
+#else
+#define CEED_EPSILON 1E-16
+#endif
 
 /// Library context created by CeedInit()
 /// @ingroup CeedUser
@@ -153,8 +219,20 @@ typedef struct CeedOperator_private *CeedOperator;
 CEED_EXTERN int CeedInit(const char *resource, Ceed *ceed);
 CEED_EXTERN int CeedGetResource(Ceed ceed, const char **resource);
 CEED_EXTERN int CeedIsDeterministic(Ceed ceed, bool *isDeterministic);
+CEED_EXTERN int CeedSetProfiling(Ceed ceed, bool profile);
+CEED_EXTERN int CeedIsProfiling(Ceed ceed, bool *profile);
+CEED_EXTERN int CeedSetTraceFile(Ceed ceed, const char *filename);
+CEED_EXTERN int CeedSetJitOptions(Ceed ceed, const char *options);
+CEED_EXTERN int CeedGetJitOptions(Ceed ceed, const char **options);
+CEED_EXTERN int CeedMemoryPoolTrim(Ceed ceed);
+CEED_EXTERN int CeedMemoryPoolGetUsage(Ceed ceed, size_t *inuse,
+                                       size_t *cached, size_t *highwater);
+CEED_EXTERN int CeedSetCurrentDevice(Ceed ceed);
+CEED_EXTERN int CeedGetOperatorFallbackCount(Ceed ceed, CeedInt *count,
+    CeedInt *crossed);
 CEED_EXTERN int CeedView(Ceed ceed, FILE *stream);
 CEED_EXTERN int CeedDestroy(Ceed *ceed);
+CEED_EXTERN int CeedFree(void *p);
 
 CEED_EXTERN int CeedErrorImpl(Ceed, const char *, int, const char *, int,
                               const char *, ...);
@@ -202,10 +280,89 @@ typedef enum {
   CEED_MEM_HOST,
   /// Memory resides on a device (corresponding to \ref Ceed resource)
   CEED_MEM_DEVICE,
+  /// Memory is managed and accessible from both the host and the device;
+  ///   equivalent to CEED_MEM_HOST for backends that prefer host memory.
+  ///   Only supported for CeedVector
+  CEED_MEM_UNIFIED,
 } CeedMemType;
 
 CEED_EXTERN const char *const CeedMemTypes[];
 
+/// Memory spaces in which the allocations of libCEED objects are accounted
+/// @ingroup Ceed
+typedef enum {
+  /// Pageable host memory
+  CEED_MEMSPACE_HOST = 0,
+  /// Device memory
+  CEED_MEMSPACE_DEVICE = 1,
+  /// Page-locked host memory
+  CEED_MEMSPACE_PINNED = 2,
+  /// Number of memory spaces
+  CEED_MEMSPACE_NUM = 3
+} CeedMemSpace;
+
+CEED_EXTERN const char *const CeedMemSpaces[];
+
+/// Auditing of host/device transfers of CeedVector data, see CeedSetSyncAudit()
+/// @ingroup Ceed
+typedef enum {
+  /// Transfers are not audited
+  CEED_SYNC_AUDIT_NONE = 0,
+  /// Each transfer is counted and logged
+  CEED_SYNC_AUDIT_LOG = 1,
+  /// As CEED_SYNC_AUDIT_LOG, and device to host transfers within an audited
+  ///   region are errors
+  CEED_SYNC_AUDIT_ERROR = 2,
+} CeedSyncAuditMode;
+
+CEED_EXTERN const char *const CeedSyncAuditModes[];
+
+CEED_EXTERN int CeedSetSyncAudit(Ceed ceed, CeedSyncAuditMode mode);
+CEED_EXTERN int CeedSyncAuditRegionBegin(Ceed ceed, const char *name);
+CEED_EXTERN int CeedSyncAuditRegionEnd(Ceed ceed);
+CEED_EXTERN int CeedGetSyncAuditCounts(Ceed ceed, CeedInt *h2d, CeedInt *d2h);
+
+/// Kinds of allocations accounted in the memory footprint of a Ceed
+/// @ingroup Ceed
+typedef enum {
+  /// CeedVectors created by the user
+  CEED_MEMORY_VECTOR = 0,
+  /// CeedVectors holding quadrature point data of CeedOperators
+  CEED_MEMORY_QDATA = 1,
+  /// E-vectors, Q-vectors, and other work vectors of CeedOperators
+  CEED_MEMORY_EVECTOR = 2,
+  /// Assembled CeedQFunctions, element matrices, and smoother diagonals
+  CEED_MEMORY_ASSEMBLED = 3,
+  /// Offsets and other data of CeedElemRestrictions
+  CEED_MEMORY_RESTRICTION = 4,
+  /// Basis matrices and quadrature data of CeedBases
+  CEED_MEMORY_BASIS = 5,
+  /// CeedQFunctionContext data
+  CEED_MEMORY_CONTEXT = 6,
+  /// Number of kinds of allocations
+  CEED_MEMORY_NUM_CLASSES = 7
+} CeedMemoryClass;
+
+CEED_EXTERN const char *const CeedMemoryClasses[];
+
+CEED_EXTERN int CeedGetMemoryUsage(Ceed ceed, CeedMemoryClass memclass,
+                                   CeedMemSpace space, size_t *bytes);
+CEED_EXTERN int CeedGetMemoryHighWater(Ceed ceed, CeedMemSpace space,
+                                       size_t *bytes);
+
+/// Function allocating memory of a CeedMemSpace for a Ceed, given the context
+///   passed to CeedSetAllocator()
+/// @ingroup Ceed
+typedef int (*CeedAllocFunction)(void *ctx, CeedMemSpace space, size_t bytes,
+                                 void **ptr);
+/// Function freeing memory allocated by a CeedAllocFunction
+/// @ingroup Ceed
+typedef int (*CeedDeallocFunction)(void *ctx, CeedMemSpace space, void *ptr);
+
+CEED_EXTERN int CeedSetAllocator(Ceed ceed, CeedAllocFunction alloc,
+                                 CeedDeallocFunction dealloc, void *ctx);
+CEED_EXTERN int CeedSetSharedWork(Ceed ceed, bool shared);
+
 CEED_EXTERN int CeedGetPreferredMemType(Ceed ceed, CeedMemType *type);
 
 /// Conveys ownership status of arrays passed to Ceed interfaces.
@@ -236,15 +393,38 @@ typedef enum {
   CEED_NORM_MAX,
 } CeedNormType;
 
+/// Denotes the reduction applied to the entries of a CeedVector
+/// @ingroup CeedVector
+typedef enum {
+  /// Sum of the entries
+  CEED_REDUCE_SUM = 0,
+  /// Largest entry
+  CEED_REDUCE_MAX = 1,
+  /// Smallest entry
+  CEED_REDUCE_MIN = 2,
+} CeedReduceType;
+
 CEED_EXTERN const char *const CeedCopyModes[];
+CEED_EXTERN const char *const CeedReduceTypes[];
 
 CEED_EXTERN int CeedVectorCreate(Ceed ceed, CeedInt len, CeedVector *vec);
+CEED_EXTERN int CeedVectorCreateView(CeedVector parent, CeedInt offset,
+                                     CeedInt length, CeedVector *vec);
 CEED_EXTERN int CeedVectorSetArray(CeedVector vec, CeedMemType mtype,
                                    CeedCopyMode cmode, CeedScalar *array);
 CEED_EXTERN int CeedVectorSetValue(CeedVector vec, CeedScalar value);
+CEED_EXTERN int CeedVectorCopy(CeedVector vec, CeedVector copy);
+CEED_EXTERN int CeedVectorDuplicate(CeedVector vec, CeedVector *copy);
 CEED_EXTERN int CeedVectorSyncArray(CeedVector vec, CeedMemType mtype);
+CEED_EXTERN int CeedVectorSnapshot(CeedVector vec, CeedInt offset,
+                                   CeedVector snapshot, CeedRequest *request);
 CEED_EXTERN int CeedVectorTakeArray(CeedVector vec, CeedMemType mtype,
                                     CeedScalar **array);
+CEED_EXTERN int CeedVectorBindArray(CeedVector vec, CeedMemType mtype,
+                                    CeedScalar *array);
+CEED_EXTERN int CeedVectorBoundArrayModified(CeedVector vec);
+CEED_EXTERN int CeedVectorBoundArraySync(CeedVector vec);
+CEED_EXTERN int CeedVectorUnbindArray(CeedVector vec);
 CEED_EXTERN int CeedVectorGetArray(CeedVector vec, CeedMemType mtype,
                                    CeedScalar **array);
 CEED_EXTERN int CeedVectorGetArrayRead(CeedVector vec, CeedMemType mtype,
@@ -254,9 +434,30 @@ CEED_EXTERN int CeedVectorRestoreArrayRead(CeedVector vec,
     const CeedScalar **array);
 CEED_EXTERN int CeedVectorNorm(CeedVector vec, CeedNormType type,
                                CeedScalar *norm);
+CEED_EXTERN int CeedVectorNorms(CeedVector vec, CeedInt nnorms,
+                                const CeedNormType *types, CeedVector norms);
+CEED_EXTERN int CeedVectorReduceSegments(CeedVector vec, CeedReduceType rtype,
+    bool add, CeedVector result);
 CEED_EXTERN int CeedVectorReciprocal(CeedVector vec);
+CEED_EXTERN int CeedVectorPointBlockInvert(CeedVector vec, CeedInt bsize);
+CEED_EXTERN int CeedVectorAXPY(CeedVector y, CeedScalar alpha, CeedVector x);
+CEED_EXTERN int CeedVectorAXPBY(CeedVector y, CeedScalar alpha, CeedScalar beta,
+                                CeedVector x);
+CEED_EXTERN int CeedVectorPointwiseMult(CeedVector w, CeedVector x,
+                                        CeedVector y);
+CEED_EXTERN int CeedVectorDot(CeedVector x, CeedVector y, CeedScalar *result);
+CEED_EXTERN int CeedVectorDotVector(CeedVector x, CeedVector y, CeedVector dot);
+CEED_EXTERN int CeedVectorMultiAXPBYDot(CeedInt nupdate, CeedVector *y,
+    const CeedScalar *alpha, const CeedScalar *beta, CeedVector *x,
+    CeedInt ndot, CeedVector *u, CeedVector *v, CeedVector dots);
 CEED_EXTERN int CeedVectorView(CeedVector vec, const char *fpfmt, FILE *stream);
+CEED_EXTERN int CeedVectorSave(CeedVector vec, CeedElemRestriction rstr,
+                               const char *filename);
+CEED_EXTERN int CeedVectorLoad(CeedVector vec, CeedElemRestriction rstr,
+                               const char *filename);
 CEED_EXTERN int CeedVectorGetLength(CeedVector vec, CeedInt *length);
+CEED_EXTERN int CeedVectorGetMemoryUsage(CeedVector vec, CeedMemSpace space,
+    size_t *bytes);
 CEED_EXTERN int CeedVectorDestroy(CeedVector *vec);
 
 CEED_EXTERN CeedRequest *const CEED_REQUEST_IMMEDIATE;
@@ -301,6 +502,67 @@ typedef enum {
 
 CEED_EXTERN const char *const CeedTransposeModes[];
 
+/// Order in which a CeedOperator processes its elements
+/// @ingroup CeedOperator
+typedef enum {
+  /// Process elements in the order given by the CeedElemRestrictions
+  CEED_ORDERING_NATURAL = 0,
+  /// Reverse Cuthill-McKee ordering of the elements sharing L-vector nodes
+  CEED_ORDERING_RCM = 1,
+} CeedElemOrdering;
+
+CEED_EXTERN const char *const CeedElemOrderings[];
+
+/// Application of a CeedOperator with stored dense element matrices
+/// @ingroup CeedOperator
+typedef enum {
+  /// Apply the operator matrix-free
+  CEED_ELEMMATRIX_NEVER = 0,
+  /// Apply element matrices when they are estimated to be cheaper
+  CEED_ELEMMATRIX_AUTO = 1,
+  /// Always apply element matrices
+  CEED_ELEMMATRIX_ALWAYS = 2,
+} CeedElemMatrixMode;
+
+CEED_EXTERN const char *const CeedElemMatrixModes[];
+
+/// Scaling of the element inverses built by CeedOperatorCreateFDMElementInverse
+/// @ingroup CeedOperator
+typedef enum {
+  /// Scale each element inverse by one average of the assembled QFunction
+  CEED_FDM_AVERAGED = 0,
+  /// Scale the mass and each direction by its own element average
+  CEED_FDM_DIRECTIONAL = 1,
+} CeedFDMMode;
+
+CEED_EXTERN const char *const CeedFDMModes[];
+
+/// Storage precision of a passive CeedOperator input field
+/// @ingroup CeedOperator
+typedef enum {
+  /// Stored as CeedScalar
+  CEED_STORAGE_SCALAR = 0,
+  /// Stored as IEEE single precision
+  CEED_STORAGE_FP32 = 1,
+  /// Stored as bfloat16, with the exponent range of single precision and
+  ///   8 significant bits
+  CEED_STORAGE_BF16 = 2,
+} CeedStorageType;
+
+CEED_EXTERN const char *const CeedStorageTypes[];
+
+/// Integer type of the offsets a CeedElemRestriction reads when applied
+/// @ingroup CeedElemRestriction
+typedef enum {
+  /// CeedInt offsets
+  CEED_INDEX_INT32 = 0,
+  /// 16-bit unsigned offsets relative to a base offset for each block of
+  ///   elements, for restrictions whose blocks span fewer than 2^16 nodes
+  CEED_INDEX_INT16 = 1,
+} CeedIndexType;
+
+CEED_EXTERN const char *const CeedIndexTypes[];
+
 /// Argument for CeedElemRestrictionCreateStrided that L-vector is in
 /// the Ceed backend's preferred layout. This argument should only be used
 /// with vectors created by a Ceed backend.
@@ -321,6 +583,30 @@ CEED_EXTERN int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt nelem,
 CEED_EXTERN int CeedElemRestrictionCreateBlockedStrided(Ceed ceed,
     CeedInt nelem, CeedInt elemsize, CeedInt blksize, CeedInt ncomp,
     CeedInt lsize, const CeedInt strides[3], CeedElemRestriction *rstr);
+CEED_EXTERN int CeedElemRestrictionCreateCompressed(Ceed ceed, CeedInt nelem,
+    CeedInt elemsize, CeedInt ncomp, CeedInt compstride, CeedInt lsize,
+    const CeedInt *eoffsets, const CeedInt *stencil, CeedElemRestriction *rstr);
+CEED_EXTERN int CeedElemRestrictionCreateBlockedCompressed(Ceed ceed,
+    CeedInt nelem, CeedInt elemsize, CeedInt blksize, CeedInt ncomp,
+    CeedInt compstride, CeedInt lsize, const CeedInt *eoffsets,
+    const CeedInt *stencil, CeedElemRestriction *rstr);
+CEED_EXTERN int CeedElemRestrictionCreateTwoSided(Ceed ceed, CeedInt nfaces,
+    CeedInt facesize, CeedInt ncomp, CeedInt compstride, CeedInt lsize,
+    CeedMemType mtype, CeedCopyMode cmode, const CeedInt *offsets,
+    CeedElemRestriction *rstr);
+CEED_EXTERN int CeedElemRestrictionCreateBlockedTwoSided(Ceed ceed,
+    CeedInt nfaces, CeedInt facesize, CeedInt blksize, CeedInt ncomp,
+    CeedInt compstride, CeedInt lsize, CeedMemType mtype, CeedCopyMode cmode,
+    const CeedInt *offsets, CeedElemRestriction *rstr);
+CEED_EXTERN int CeedElemRestrictionCreateView(CeedElemRestriction rstr,
+    CeedInt ncomp, CeedInt compstride, CeedInt lsize,
+    CeedElemRestriction *view);
+CEED_EXTERN int CeedElemRestrictionCreateBatch(Ceed ceed, CeedInt nrstr,
+    const CeedInt *nelem, const CeedInt *elemsize, CeedInt ncomp,
+    CeedInt compstride, CeedInt lsize, CeedMemType mtype, CeedCopyMode cmode,
+    const CeedInt *offsets, CeedElemRestriction *rstrs);
+CEED_EXTERN int CeedElemRestrictionSetIndexType(CeedElemRestriction rstr,
+    CeedIndexType itype);
 CEED_EXTERN int CeedElemRestrictionCreateVector(CeedElemRestriction rstr,
     CeedVector *lvec, CeedVector *evec);
 CEED_EXTERN int CeedElemRestrictionApply(CeedElemRestriction rstr,
@@ -344,6 +630,8 @@ CEED_EXTERN int CeedElemRestrictionGetBlockSize(CeedElemRestriction rstr,
     CeedInt *blksize);
 CEED_EXTERN int CeedElemRestrictionGetMultiplicity(CeedElemRestriction rstr,
     CeedVector mult);
+CEED_EXTERN int CeedElemRestrictionGetMemoryUsage(CeedElemRestriction rstr,
+    CeedMemSpace space, size_t *bytes);
 CEED_EXTERN int CeedElemRestrictionView(CeedElemRestriction rstr, FILE *stream);
 CEED_EXTERN int CeedElemRestrictionDestroy(CeedElemRestriction *rstr);
 
@@ -410,6 +698,8 @@ CEED_EXTERN const char *const CeedElemTopologies[];
 
 CEED_EXTERN int CeedBasisCreateTensorH1Lagrange(Ceed ceed, CeedInt dim,
     CeedInt ncomp, CeedInt P, CeedInt Q, CeedQuadMode qmode, CeedBasis *basis);
+CEED_EXTERN int CeedBasisCreateAtQuadrature(CeedBasis basis, CeedInt Q,
+    CeedQuadMode qmode, CeedBasis *basisQ);
 CEED_EXTERN int CeedBasisCreateTensorH1(Ceed ceed, CeedInt dim, CeedInt ncomp,
                                         CeedInt P1d, CeedInt Q1d,
                                         const CeedScalar *interp1d,
@@ -424,10 +714,16 @@ CEED_EXTERN int CeedBasisCreateH1(Ceed ceed, CeedElemTopology topo,
                                   const CeedScalar *grad,
                                   const CeedScalar *qref,
                                   const CeedScalar *qweight, CeedBasis *basis);
+CEED_EXTERN int CeedBasisCreateH1Simplex(Ceed ceed, CeedElemTopology topo,
+    CeedInt ncomp, CeedInt P, CeedInt Q, CeedBasis *basis);
+CEED_EXTERN int CeedBasisGetMemoryUsage(CeedBasis basis, CeedMemSpace space,
+                                        size_t *bytes);
 CEED_EXTERN int CeedBasisView(CeedBasis basis, FILE *stream);
 CEED_EXTERN int CeedBasisApply(CeedBasis basis, CeedInt nelem,
                                CeedTransposeMode tmode,
                                CeedEvalMode emode, CeedVector u, CeedVector v);
+CEED_EXTERN int CeedBasisGetFlopsEstimate(CeedBasis basis,
+    CeedTransposeMode tmode, CeedEvalMode emode, size_t *flops);
 CEED_EXTERN int CeedBasisGetDimension(CeedBasis basis, CeedInt *dim);
 CEED_EXTERN int CeedBasisGetTopology(CeedBasis basis, CeedElemTopology *topo);
 CEED_EXTERN int CeedBasisGetNumComponents(CeedBasis basis, CeedInt *numcomp);
@@ -485,6 +781,9 @@ typedef int (*CeedQFunctionUser)(void *ctx, const CeedInt Q,
 
 CEED_EXTERN int CeedQFunctionCreateInterior(Ceed ceed, CeedInt vlength,
     CeedQFunctionUser f, const char *source, CeedQFunction *qf);
+CEED_EXTERN int CeedQFunctionCreateInteriorWithSource(Ceed ceed,
+    CeedInt vlength, CeedQFunctionUser f, const char *source, const char *code,
+    CeedQFunction *qf);
 CEED_EXTERN int CeedQFunctionCreateInteriorByName(Ceed ceed, const char *name,
     CeedQFunction *qf);
 CEED_EXTERN int CeedQFunctionCreateIdentity(Ceed ceed, CeedInt size,
@@ -495,11 +794,26 @@ CEED_EXTERN int CeedQFunctionAddOutput(CeedQFunction qf, const char *fieldname,
                                        CeedInt size, CeedEvalMode emode);
 CEED_EXTERN int CeedQFunctionSetContext(CeedQFunction qf,
                                         CeedQFunctionContext ctx);
+CEED_EXTERN int CeedQFunctionSetUserFlopsEstimate(CeedQFunction qf,
+    size_t flops);
+CEED_EXTERN int CeedQFunctionGetUserFlopsEstimate(CeedQFunction qf,
+    size_t *flops);
 CEED_EXTERN int CeedQFunctionView(CeedQFunction qf, FILE *stream);
 CEED_EXTERN int CeedQFunctionApply(CeedQFunction qf, CeedInt Q,
                                    CeedVector *u, CeedVector *v);
 CEED_EXTERN int CeedQFunctionDestroy(CeedQFunction *qf);
 
+/// Type of a named CeedQFunctionContext field
+/// @ingroup CeedQFunction
+typedef enum {
+  /// Double precision values
+  CEED_CONTEXT_FIELD_DOUBLE = 1,
+  /// 32 bit integer values
+  CEED_CONTEXT_FIELD_INT32  = 2,
+} CeedContextFieldType;
+
+CEED_EXTERN const char *const CeedContextFieldTypes[];
+
 CEED_EXTERN int CeedQFunctionContextCreate(Ceed ceed,
     CeedQFunctionContext *ctx);
 CEED_EXTERN int CeedQFunctionContextSetData(CeedQFunctionContext ctx,
@@ -509,6 +823,18 @@ CEED_EXTERN int CeedQFunctionContextGetData(CeedQFunctionContext ctx,
     void *data);
 CEED_EXTERN int CeedQFunctionContextRestoreData(CeedQFunctionContext ctx,
     void *data);
+CEED_EXTERN int CeedQFunctionContextRegisterDouble(CeedQFunctionContext ctx,
+    const char *fieldname, size_t fieldoffset, size_t numvalues,
+    const char *fielddescription);
+CEED_EXTERN int CeedQFunctionContextRegisterInt32(CeedQFunctionContext ctx,
+    const char *fieldname, size_t fieldoffset, size_t numvalues,
+    const char *fielddescription);
+CEED_EXTERN int CeedQFunctionContextSetDouble(CeedQFunctionContext ctx,
+    const char *fieldname, const double *values);
+CEED_EXTERN int CeedQFunctionContextSetInt32(CeedQFunctionContext ctx,
+    const char *fieldname, const int *values);
+CEED_EXTERN int CeedQFunctionContextGetMemoryUsage(CeedQFunctionContext ctx,
+    CeedMemSpace space, size_t *bytes);
 CEED_EXTERN int CeedQFunctionContextView(CeedQFunctionContext ctx,
     FILE *stream);
 CEED_EXTERN int CeedQFunctionContextDestroy(CeedQFunctionContext *ctx);
@@ -522,8 +848,52 @@ CEED_EXTERN int CeedOperatorSetField(CeedOperator op, const char *fieldname,
                                      CeedVector v);
 CEED_EXTERN int CeedCompositeOperatorAddSub(CeedOperator compositeop,
     CeedOperator subop);
+CEED_EXTERN int CeedShardedOperatorCreate(Ceed ceed, CeedOperator *op);
+CEED_EXTERN int CeedShardedOperatorAddShard(CeedOperator shardedop,
+    CeedOperator shard);
+CEED_EXTERN int CeedShardedOperatorCreateSplit(Ceed ceed, CeedInt numops,
+    CeedOperator *ops, CeedOperator *op);
+CEED_EXTERN int CeedOperatorCreatePAdaptive(Ceed ceed, CeedQFunction qf,
+    CeedInt nelem, const CeedInt *elemorder, CeedOperator *op);
+CEED_EXTERN int CeedOperatorSetFieldPAdaptive(CeedOperator op,
+    const char *fieldname, const CeedInt *elemsize, CeedInt ncomp,
+    CeedInt compstride, CeedInt lsize, const CeedInt *offsets,
+    const CeedBasis *bases, CeedVector v);
+CEED_EXTERN int CeedOperatorCreateChebyshevSmoother(CeedOperator op,
+    CeedVector diag, CeedScalar lmin, CeedScalar lmax, CeedInt degree,
+    CeedOperator *smoother);
+CEED_EXTERN int CeedOperatorCreatePointBlockJacobi(CeedOperator op,
+    CeedOperator *pbjacobi);
+CEED_EXTERN int CeedOperatorEstimateEigenvalues(CeedOperator op,
+    CeedVector diag, CeedInt niter, CeedScalar *lmin, CeedScalar *lmax);
+CEED_EXTERN int CeedOperatorSetFieldBuilder(CeedOperator op,
+    const char *fieldname, CeedOperator buildop, CeedVector buildinput);
+CEED_EXTERN int CeedOperatorSetElementOrdering(CeedOperator op,
+    CeedElemOrdering ordering);
+CEED_EXTERN int CeedOperatorSetElementMatrixMode(CeedOperator op,
+    CeedElemMatrixMode mode);
+CEED_EXTERN int CeedOperatorSetFDMMode(CeedOperator op, CeedFDMMode mode);
+CEED_EXTERN int CeedOperatorSetFieldStorage(CeedOperator op,
+    const char *fieldname, CeedStorageType storage);
+CEED_EXTERN int CeedOperatorSetFieldReduce(CeedOperator op,
+    const char *fieldname, CeedReduceType rtype, CeedVector result);
+CEED_EXTERN int CeedOperatorSetDirichlet(CeedOperator op, CeedInt nbc,
+    const CeedInt *indices, CeedVector values);
+CEED_EXTERN int CeedOperatorCreateSubset(CeedOperator op, CeedInt nelem,
+    const CeedInt *elems, CeedOperator *subop);
+CEED_EXTERN int CeedOperatorCreateSubsetRange(CeedOperator op, CeedInt first,
+    CeedInt last, CeedOperator *subop);
+CEED_EXTERN int CeedOperatorCreateReducedPrecision(CeedOperator op,
+    CeedStorageType storage, CeedOperator *opreduced);
+CEED_EXTERN int CeedOperatorCreateEnsemble(CeedInt numinstances,
+    CeedOperator *instances, CeedOperator *ensemble);
+CEED_EXTERN int CeedOperatorCreateChain(CeedOperator first,
+    CeedOperator second, CeedOperator *chain);
 CEED_EXTERN int CeedOperatorLinearAssembleQFunction(CeedOperator op,
     CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request);
+CEED_EXTERN int CeedOperatorLinearAssembleQFunctionBuildOrUpdate(
+  CeedOperator op, CeedVector *assembled, CeedElemRestriction *rstr,
+  CeedRequest *request);
 CEED_EXTERN int CeedOperatorLinearAssembleDiagonal(CeedOperator op,
     CeedVector assembled, CeedRequest *request);
 CEED_EXTERN int CeedOperatorLinearAssembleAddDiagonal(CeedOperator op,
@@ -532,6 +902,9 @@ CEED_EXTERN int CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op,
     CeedVector assembled, CeedRequest *request);
 CEED_EXTERN int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op,
     CeedVector assembled, CeedRequest *request);
+CEED_EXTERN int CeedOperatorLinearAssembleSymbolic(CeedOperator op,
+    CeedInt *nentries, CeedInt **rows, CeedInt **cols);
+CEED_EXTERN int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values);
 CEED_EXTERN int CeedOperatorMultigridLevelCreate(CeedOperator opFine,
     CeedVector PMultFine, CeedElemRestriction rstrCoarse, CeedBasis basisCoarse,
     CeedOperator *opCoarse, CeedOperator *opProlong, CeedOperator *opRestrict);
@@ -543,13 +916,29 @@ CEED_EXTERN int CeedOperatorMultigridLevelCreateH1(CeedOperator opFine,
     CeedVector PMultFine, CeedElemRestriction rstrCoarse, CeedBasis basisCoarse,
     const CeedScalar *interpCtoF, CeedOperator *opCoarse,
     CeedOperator *opProlong, CeedOperator *opRestrict);
+CEED_EXTERN int CeedOperatorCreateAtQuadrature(CeedOperator op, CeedInt Q,
+    CeedQuadMode qmode, CeedOperator *opQ);
 CEED_EXTERN int CeedOperatorCreateFDMElementInverse(CeedOperator op,
     CeedOperator *fdminv, CeedRequest *request);
+CEED_EXTERN int CeedOperatorGetFlopsEstimate(CeedOperator op, size_t *flops);
+CEED_EXTERN int CeedOperatorGetBytesEstimate(CeedOperator op, size_t *bytes);
+CEED_EXTERN int CeedOperatorSave(CeedOperator op, const char *filename);
+CEED_EXTERN int CeedOperatorLoad(CeedOperator op, const char *filename);
 CEED_EXTERN int CeedOperatorView(CeedOperator op, FILE *stream);
+CEED_EXTERN int CeedOperatorPrepare(CeedOperator op);
 CEED_EXTERN int CeedOperatorApply(CeedOperator op, CeedVector in,
                                   CeedVector out, CeedRequest *request);
 CEED_EXTERN int CeedOperatorApplyAdd(CeedOperator op, CeedVector in,
                                      CeedVector out, CeedRequest *request);
+CEED_EXTERN int CeedOperatorApplyDot(CeedOperator op, CeedVector in,
+                                     CeedVector out, CeedScalar *dot,
+                                     CeedRequest *request);
+CEED_EXTERN int CeedOperatorApplyTranspose(CeedOperator op, CeedVector in,
+    CeedVector out, CeedRequest *request);
+CEED_EXTERN int CeedOperatorApplyMultiple(CeedOperator op, CeedInt nvecs,
+    CeedVector *in, CeedVector *out, CeedRequest *request);
+CEED_EXTERN int CeedOperatorApplyAddMultiple(CeedOperator op, CeedInt nvecs,
+    CeedVector *in, CeedVector *out, CeedRequest *request);
 CEED_EXTERN int CeedOperatorDestroy(CeedOperator *op);
 
 /**
@@ -175,6 +175,172 @@ static int CeedScalarView(const char *name, const char *fpformat, CeedInt m,
   return 0;
 }
 
+/**
+  @brief Evaluate Jacobi polynomials P_n^(alpha,0), n = 0, ..., N, in the
+           homogeneous form t^n P_n(X/t), with derivatives with respect to X
+
+  The homogeneous form stays a polynomial where the collapsed coordinate X/t
+    of a simplex is singular, such as at a vertex.
+
+  @param N        Highest degree to evaluate
+  @param alpha    Jacobi parameter alpha
+  @param X        Scaled evaluation point X = t x
+  @param t        Scaling
+  @param[out] h   Array of length N+1 holding the values
+  @param[out] dh  Array of length N+1 holding the derivatives, or NULL
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedJacobiHomogeneous(CeedInt N, CeedScalar alpha, CeedScalar X,
+                                 CeedScalar t, CeedScalar *h, CeedScalar *dh) {
+  h[0] = 1.0;
+  if (dh) dh[0] = 0.0;
+  if (N == 0) return 0;
+  h[1] = ((alpha + 2)*X + alpha*t)/2;
+  if (dh) dh[1] = (alpha + 2)/2;
+  for (CeedInt n=2; n<=N; n++) {
+    CeedScalar a = 2*n*(n + alpha)*(2*n + alpha - 2),
+               b = (2*n + alpha - 1)*(2*n + alpha)*(2*n + alpha - 2),
+               c = (2*n + alpha - 1)*alpha*alpha,
+               d = 2*(n + alpha - 1)*(n - 1)*(2*n + alpha);
+    h[n] = ((b*X + c*t)*h[n-1] - d*t*t*h[n-2])/a;
+    if (dh)
+      dh[n] = (b*h[n-1] + (b*X + c*t)*dh[n-1] - d*t*t*dh[n-2])/a;
+  }
+  return 0;
+}
+
+/**
+  @brief Construct a Gauss-Jacobi quadrature for the weight (1 - x)^alpha
+
+  @param Q              Number of quadrature points
+  @param alpha          Exponent of the weight
+  @param[out] qref      Array of length Q to hold the abscissa on [-1, 1]
+  @param[out] qweight   Array of length Q to hold the weights
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedGaussJacobiQuadrature(CeedInt Q, CeedScalar alpha,
+                                     CeedScalar *qref, CeedScalar *qweight) {
+  CeedScalar h[Q+1], dh[Q+1], PI = 4.0*atan(1.0);
+  for (CeedInt i=0; i<Q; i++) {
+    // Chebyshev guess, averaged with the previous root, and Newton with
+    //   deflation of the roots already found
+    CeedScalar xi = -cos(PI*(CeedScalar)(2*i+1)/((CeedScalar)(2*Q)));
+    if (i > 0) xi = (xi + qref[i-1])/2;
+    for (CeedInt k=0; k<100; k++) {
+      CeedScalar sum = 0, delta;
+      CeedJacobiHomogeneous(Q, alpha, xi, 1.0, h, dh);
+      for (CeedInt j=0; j<i; j++)
+        sum += 1.0/(xi - qref[j]);
+      delta = -h[Q]/(dh[Q] - sum*h[Q]);
+      xi += delta;
+      if (fabs(delta) < 10*CEED_EPSILON) break;
+    }
+    CeedJacobiHomogeneous(Q, alpha, xi, 1.0, h, dh);
+    qref[i] = xi;
+    qweight[i] = pow(2.0, alpha + 1)/((1.0 - xi*xi)*dh[Q]*dh[Q]);
+  }
+  return 0;
+}
+
+/**
+  @brief Evaluate the Lagrange polynomials on a set of nodes and their
+           derivatives at a set of points, Fornberg (1998)
+
+  @param[in] nodes    Array of length P of nodes
+  @param P            Number of nodes
+  @param[in] points   Array of length Q of evaluation points
+  @param Q            Number of evaluation points
+  @param[out] interp  Row-major Q x P matrix of Lagrange polynomial values
+  @param[out] grad    Row-major Q x P matrix of Lagrange polynomial derivatives
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedLagrangeInterpolation(const CeedScalar *nodes, CeedInt P,
+                                     const CeedScalar *points, CeedInt Q,
+                                     CeedScalar *interp, CeedScalar *grad) {
+  CeedScalar c1, c2, c3, c4, dx;
+  for (CeedInt i = 0; i < Q*P; i++)
+    interp[i] = grad[i] = 0.0;
+  for (CeedInt i = 0; i < Q; i++) {
+    c1 = 1.0;
+    c3 = nodes[0] - points[i];
+    interp[i*P+0] = 1.0;
+    for (CeedInt j = 1; j < P; j++) {
+      c2 = 1.0;
+      c4 = c3;
+      c3 = nodes[j] - points[i];
+      for (CeedInt k = 0; k < j; k++) {
+        dx = nodes[j] - nodes[k];
+        c2 *= dx;
+        if (k == j - 1) {
+          grad[i*P + j] = c1*(interp[i*P + k] - c4*grad[i*P + k]) / c2;
+          interp[i*P + j] = - c1*c4*interp[i*P + k] / c2;
+        }
+        grad[i*P + k] = (c3*grad[i*P + k] - interp[i*P + k]) / dx;
+        interp[i*P + k] = c3*interp[i*P + k] / dx;
+      }
+      c1 = c2;
+    }
+  }
+  return 0;
+}
+
+/**
+  @brief Invert a square matrix by Gauss-Jordan elimination with partial
+           pivoting
+
+  @param ceed         A Ceed context for error handling
+  @param[in,out] A    Row-major matrix to invert, overwritten
+  @param[out] Ainv    Row-major inverse of A
+  @param n            Number of rows and columns of A
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedMatrixInverse(Ceed ceed, CeedScalar *A, CeedScalar *Ainv,
+                             CeedInt n) {
+  for (CeedInt i=0; i<n; i++)
+    for (CeedInt j=0; j<n; j++)
+      Ainv[i*n+j] = i == j;
+
+  for (CeedInt k=0; k<n; k++) {
+    // Pivot
+    CeedInt p = k;
+    for (CeedInt i=k+1; i<n; i++)
+      if (fabs(A[i*n+k]) > fabs(A[p*n+k])) p = i;
+    if (fabs(A[p*n+k]) < 10*CEED_EPSILON)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Matrix is singular");
+    // LCOV_EXCL_STOP
+    for (CeedInt j=0; j<n; j++) {
+      CeedScalar tmp = A[k*n+j]; A[k*n+j] = A[p*n+j]; A[p*n+j] = tmp;
+      tmp = Ainv[k*n+j]; Ainv[k*n+j] = Ainv[p*n+j]; Ainv[p*n+j] = tmp;
+    }
+    // Eliminate column k
+    CeedScalar pivot = A[k*n+k];
+    for (CeedInt j=0; j<n; j++) {
+      A[k*n+j] /= pivot; Ainv[k*n+j] /= pivot;
+    }
+    for (CeedInt i=0; i<n; i++)
+      if (i != k) {
+        CeedScalar f = A[i*n+k];
+        for (CeedInt j=0; j<n; j++) {
+          A[i*n+j] -= f*A[k*n+j]; Ainv[i*n+j] -= f*Ainv[k*n+j];
+        }
+      }
+  }
+  return 0;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -262,6 +428,46 @@ int CeedBasisIsTensor(CeedBasis basis, bool *istensor) {
   return 0;
 }
 
+/**
+  @brief Get collocation status for given CeedBasis
+
+  A tensor basis is collocated when its quadrature points coincide with its
+    nodes, as for Q = P on Gauss-Lobatto points, so that interpolation is the
+    identity and the gradient is a single 1D derivative in each direction.
+
+  @param basis              CeedBasis
+  @param[out] iscollocated  Variable to store collocation status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedBasisIsCollocated(CeedBasis basis, bool *iscollocated) {
+  *iscollocated = basis->collocated;
+  return 0;
+}
+
+/**
+  @brief Get symmetry status for given CeedBasis
+
+  A tensor basis is symmetric when its nodes and quadrature points are
+    symmetric about the center of the element, as for Lagrange bases on
+    Gauss or Gauss-Lobatto points. Then reversing both the rows and the
+    columns of interp1d leaves it unchanged and negates grad1d, so 1D
+    contractions can be split into even and odd parts of half the size.
+
+  @param basis             CeedBasis
+  @param[out] issymmetric  Variable to store symmetry status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedBasisIsSymmetric(CeedBasis basis, bool *issymmetric) {
+  *issymmetric = basis->symmetric;
+  return 0;
+}
+
 /**
   @brief Get backend data of a CeedBasis
 
@@ -292,6 +498,29 @@ int CeedBasisSetData(CeedBasis basis, void *data) {
   return 0;
 }
 
+/**
+  @brief Account for memory allocated or freed by the backend for a CeedBasis
+
+  Bytes still accounted when the CeedBasis is destroyed are released, so
+    backends only need to report memory freed during the life of the object.
+
+  @param basis  CeedBasis owning the memory
+  @param space  CeedMemSpace of the allocation
+  @param bytes  Number of bytes allocated, negative for bytes freed
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedBasisTrackMemory(CeedBasis basis, CeedMemSpace space, ptrdiff_t bytes) {
+  int ierr;
+
+  basis->memusage[space] += bytes;
+  ierr = CeedTrackMemory(basis->ceed, CEED_MEMORY_BASIS, space, bytes);
+  CeedChk(ierr);
+  return 0;
+}
+
 /**
   @brief Get dimension for given CeedElemTopology
 
@@ -337,6 +566,98 @@ int CeedBasisSetTensorContract(CeedBasis basis, CeedTensorContract *contract) {
   return 0;
 }
 
+/**
+  @brief Get the collapsed coordinate structure of a simplex CeedBasis created
+           by CeedBasisCreateH1Simplex()
+
+  The modal basis functions are products over the collapsed coordinates
+    eta_0, ..., eta_{dim-1} of one function per coordinate, so interpolation
+    and gradients are applied one coordinate at a time. The function for
+    coordinate l with degree m, following modes of total degree s in the
+    coordinates before it, is ((1 - eta)/2)^s P_m^(2s+l,0)(eta), tabulated
+    at the Q1d quadrature points as the row-major (Q1d * (P1d-s)) matrix
+    starting at Q1d*(l*P1d*(P1d+1)/2 + s*P1d - s*(s-1)/2) in interpc, with
+    derivatives in gradc. Quadrature points are ordered with eta_{dim-1}
+    varying fastest.
+
+  @param basis          CeedBasis
+  @param[out] P1d       Number of nodes along an edge
+  @param[out] Q1d       Number of quadrature points in each collapsed
+                          coordinate
+  @param[out] vinv      Row-major (nnodes * nnodes) matrix mapping nodal values
+                          to modal coefficients, or NULL if the basis has no
+                          collapsed coordinate structure
+  @param[out] interpc   Values of the modal functions in each coordinate
+  @param[out] gradc     Derivatives of the modal functions in each coordinate
+  @param[out] detadx    Row-major (nqpts * dim * dim) array of derivatives of
+                          collapsed coordinates, d eta_m / d x_a at index
+                          (q*dim + a)*dim + m
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedBasisGetCollapsedSimplex(CeedBasis basis, CeedInt *P1d, CeedInt *Q1d,
+                                 const CeedScalar **vinv,
+                                 const CeedScalar **interpc,
+                                 const CeedScalar **gradc,
+                                 const CeedScalar **detadx) {
+  *P1d = basis->P1d;
+  *Q1d = basis->Q1d;
+  *vinv = basis->vinv;
+  *interpc = basis->interpc;
+  *gradc = basis->gradc;
+  *detadx = basis->detadx;
+  return 0;
+}
+
+/**
+  @brief Create a copy of a CeedBasis on another Ceed
+
+  If @a basis belongs to @a ceed or one of its delegates, @a basis is
+    referenced instead.
+
+  @param basis          CeedBasis to copy
+  @param ceed           Ceed to create the new CeedBasis on
+  @param[out] basisnew  Address of the variable where the newly created
+                          CeedBasis will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedBasisCreateOnCeed(CeedBasis basis, Ceed ceed, CeedBasis *basisnew) {
+  int ierr;
+  Ceed parent, basisparent;
+
+  *basisnew = basis;
+  if (basis == CEED_BASIS_COLLOCATED)
+    return 0;
+  ierr = CeedGetParent(ceed, &parent); CeedChk(ierr);
+  ierr = CeedGetParent(basis->ceed, &basisparent); CeedChk(ierr);
+  if (parent == basisparent) {
+    CeedReference(basis);
+    return 0;
+  }
+
+  if (basis->tensorbasis) {
+    ierr = CeedBasisCreateTensorH1(ceed, basis->dim, basis->ncomp, basis->P1d,
+                                   basis->Q1d, basis->interp1d, basis->grad1d,
+                                   basis->qref1d, basis->qweight1d, basisnew);
+    CeedChk(ierr);
+  } else if (basis->vinv) {
+    ierr = CeedBasisCreateH1Simplex(ceed, basis->topo, basis->ncomp,
+                                    basis->P1d, basis->Q1d, basisnew);
+    CeedChk(ierr);
+  } else {
+    ierr = CeedBasisCreateH1(ceed, basis->topo, basis->ncomp, basis->P,
+                             basis->Q, basis->interp, basis->grad,
+                             basis->qref1d, basis->qweight1d, basisnew);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
 /**
   @brief Return a reference implementation of matrix multiplication C = A B.
            Note, this is a reference implementation for CPU CeedScalar pointers
@@ -375,6 +696,36 @@ int CeedMatrixMultiply(Ceed ceed, const CeedScalar *matA,
 /// @addtogroup CeedBasisUser
 /// @{
 
+/**
+  @brief Check whether reversing the rows and columns of a matrix scales it by
+           sign, and make it exactly so when it does up to rounding
+
+  @param m         Number of rows
+  @param n         Number of columns
+  @param sign      Scaling, 1 for centro-symmetric or -1 for
+                     anti-centro-symmetric matrices
+  @param[in,out] A Row-major m x n matrix
+  @param[out] is   Variable to store symmetry status
+
+  @ref Developer
+**/
+static void CeedMatrixSymmetrize(CeedInt m, CeedInt n, CeedScalar sign,
+                                 CeedScalar *A, bool *is) {
+  CeedScalar maxabs = 1.0;
+  for (CeedInt i=0; i<m*n; i++)
+    if (fabs(A[i]) > maxabs) maxabs = fabs(A[i]);
+  *is = true;
+  for (CeedInt i=0; i<m*n && *is; i++)
+    *is = fabs(A[i] - sign*A[m*n-1-i]) <= 100*CEED_EPSILON*maxabs;
+  if (*is) {
+    for (CeedInt i=0; i<m*n/2; i++) {
+      A[i] = (A[i] + sign*A[m*n-1-i]) / 2;
+      A[m*n-1-i] = sign*A[i];
+    }
+    if (m*n % 2 && sign < 0) A[m*n/2] = 0.0;
+  }
+}
+
 /**
   @brief Create a tensor-product basis for H^1 discretizations
 
@@ -428,7 +779,7 @@ int CeedBasisCreateTensorH1(Ceed ceed, CeedInt dim, CeedInt ncomp, CeedInt P1d,
   }
   ierr = CeedCalloc(1,basis); CeedChk(ierr);
   (*basis)->ceed = ceed;
-  ceed->refcount++;
+  CeedReference(ceed);
   (*basis)->refcount = 1;
   (*basis)->tensorbasis = 1;
   (*basis)->dim = dim;
@@ -438,22 +789,115 @@ int CeedBasisCreateTensorH1(Ceed ceed, CeedInt dim, CeedInt ncomp, CeedInt P1d,
   (*basis)->Q1d = Q1d;
   (*basis)->P = CeedIntPow(P1d, dim);
   (*basis)->Q = CeedIntPow(Q1d, dim);
-  ierr = CeedMalloc(Q1d,&(*basis)->qref1d); CeedChk(ierr);
-  ierr = CeedMalloc(Q1d,&(*basis)->qweight1d); CeedChk(ierr);
+  ierr = CeedMallocHost(ceed, Q1d, &(*basis)->qref1d); CeedChk(ierr);
+  ierr = CeedMallocHost(ceed, Q1d, &(*basis)->qweight1d); CeedChk(ierr);
   memcpy((*basis)->qref1d, qref1d, Q1d*sizeof(qref1d[0]));
   memcpy((*basis)->qweight1d, qweight1d, Q1d*sizeof(qweight1d[0]));
-  ierr = CeedMalloc(Q1d*P1d,&(*basis)->interp1d); CeedChk(ierr);
-  ierr = CeedMalloc(Q1d*P1d,&(*basis)->grad1d); CeedChk(ierr);
+  ierr = CeedMallocHost(ceed, Q1d*P1d, &(*basis)->interp1d); CeedChk(ierr);
+  ierr = CeedMallocHost(ceed, Q1d*P1d, &(*basis)->grad1d); CeedChk(ierr);
   memcpy((*basis)->interp1d, interp1d, Q1d*P1d*sizeof(interp1d[0]));
   memcpy((*basis)->grad1d, grad1d, Q1d*P1d*sizeof(grad1d[0]));
-  ierr = ceed->BasisCreateTensorH1(dim, P1d, Q1d, interp1d, grad1d, qref1d,
-                                   qweight1d, *basis); CeedChk(ierr);
+  ierr = CeedBasisTrackMemory(*basis, CEED_MEMSPACE_HOST,
+                              2*Q1d*(P1d + 1)*sizeof(CeedScalar));
+  CeedChk(ierr);
+  // Check for identity interp1d, set before the backend creates its data
+  (*basis)->collocated = Q1d == P1d;
+  for (CeedInt i=0; i<P1d && (*basis)->collocated; i++)
+    for (CeedInt j=0; j<P1d; j++)
+      if (fabs(interp1d[j+P1d*i] - (i == j)) > 1e-14)
+        (*basis)->collocated = false;
+  // Check for symmetric nodes and quadrature points, removing rounding
+  //   differences so that even-odd contractions match the dense ones
+  bool symmetricinterp, symmetricgrad;
+  CeedMatrixSymmetrize(Q1d, P1d, 1.0, (*basis)->interp1d, &symmetricinterp);
+  CeedMatrixSymmetrize(Q1d, P1d, -1.0, (*basis)->grad1d, &symmetricgrad);
+  (*basis)->symmetric = symmetricinterp && symmetricgrad;
+  ierr = ceed->BasisCreateTensorH1(dim, P1d, Q1d, (*basis)->interp1d,
+                                   (*basis)->grad1d, qref1d, qweight1d, *basis);
+  CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Find a Lagrange basis in the basis cache of a Ceed and reference it,
+           called under CeedLock()
+
+  @param ceed        Ceed context holding the cache
+  @param dim         Topological dimension of element
+  @param ncomp       Number of field components
+  @param P           Number of Gauss-Lobatto nodes in one dimension
+  @param Q           Number of quadrature points in one dimension
+  @param qmode       Distribution of the Q quadrature points
+  @param[out] basis  Variable to store the basis, or NULL when not cached
+
+  @ref Developer
+**/
+static void CeedBasisCacheFind(Ceed ceed, CeedInt dim, CeedInt ncomp,
+                               CeedInt P, CeedInt Q, CeedQuadMode qmode,
+                               CeedBasis *basis) {
+  *basis = NULL;
+  for (CeedInt i=0; i<ceed->numbasiscache; i++) {
+    CeedBasis b = ceed->basiscache[i];
+    if (b->dim == dim && b->ncomp == ncomp && b->P1d == P && b->Q1d == Q &&
+        b->qmode == qmode) {
+      CeedReference(b);
+      *basis = b;
+      return;
+    }
+  }
+}
+
+/**
+  @brief Add a Lagrange basis to the basis cache of a Ceed, called under
+           CeedLock()
+
+  @param ceed   Ceed context holding the cache
+  @param basis  CeedBasis to add
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisCacheAdd(Ceed ceed, CeedBasis basis) {
+  int ierr;
+  if (ceed->numbasiscache == ceed->maxbasiscache) {
+    ceed->maxbasiscache = ceed->maxbasiscache ? 2*ceed->maxbasiscache : 8;
+    ierr = CeedRealloc(ceed->maxbasiscache, &ceed->basiscache); CeedChk(ierr);
+  }
+  ceed->basiscache[ceed->numbasiscache++] = basis;
+  basis->cached = true;
+  return 0;
+}
+
+/**
+  @brief Release a reference to a cached basis, removing the basis from the
+           cache when no references remain, called under CeedLock()
+
+  @param ceed   Ceed context holding the cache
+  @param basis  Cached CeedBasis
+
+  @return Remaining number of references
+
+  @ref Developer
+**/
+static int CeedBasisCacheRelease(Ceed ceed, CeedBasis basis) {
+  const int refcount = CeedDereference(basis);
+  if (refcount > 0) return refcount;
+  for (CeedInt i=0; i<ceed->numbasiscache; i++)
+    if (ceed->basiscache[i] == basis) {
+      ceed->basiscache[i] = ceed->basiscache[--ceed->numbasiscache];
+      break;
+    }
   return 0;
 }
 
 /**
   @brief Create a tensor-product Lagrange basis
 
+  Identical requests on a Ceed share one basis, so the quadrature and basis
+    matrices are computed, and copied to the device, only once; each call
+    still returns a reference to be released with CeedBasisDestroy().
+
   @param ceed        A Ceed object where the CeedBasis will be created
   @param dim         Topological dimension of element
   @param ncomp       Number of field components (1 for scalar fields)
@@ -465,6 +909,12 @@ int CeedBasisCreateTensorH1(Ceed ceed, CeedInt dim, CeedInt ncomp, CeedInt P1d,
   @param[out] basis  Address of the variable where the newly created
                        CeedBasis will be stored.
 
+  With P=1, the Q_0 basis broadcasts one value per element to every
+    quadrature point. Used with @ref CEED_EVAL_INTERP and a restriction of one
+    node per element, it gives element-wise constant fields, such as material
+    IDs or stabilization parameters, that are stored and moved once per
+    element instead of once per quadrature point.
+
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
@@ -473,21 +923,33 @@ int CeedBasisCreateTensorH1Lagrange(Ceed ceed, CeedInt dim, CeedInt ncomp,
                                     CeedInt P, CeedInt Q, CeedQuadMode qmode,
                                     CeedBasis *basis) {
   // Allocate
-  int ierr, i, j, k;
-  CeedScalar c1, c2, c3, c4, dx, *nodes, *interp1d, *grad1d, *qref1d, *qweight1d;
+  int ierr;
+  CeedScalar *nodes, *interp1d, *grad1d, *qref1d, *qweight1d;
 
   if (dim<1)
     // LCOV_EXCL_START
     return CeedError(ceed, 1, "Basis dimension must be a positive value");
   // LCOV_EXCL_STOP
 
+  // Share the basis of an identical earlier request on the parent Ceed
+  Ceed root;
+  ierr = CeedGetParent(ceed, &root); CeedChk(ierr);
+  if (root == ceed) {
+    ierr = CeedLock(ceed); CeedChk(ierr);
+    CeedBasisCacheFind(ceed, dim, ncomp, P, Q, qmode, basis);
+    ierr = CeedUnlock(ceed); CeedChk(ierr);
+    if (*basis) return 0;
+  }
+
   ierr = CeedCalloc(P*Q, &interp1d); CeedChk(ierr);
   ierr = CeedCalloc(P*Q, &grad1d); CeedChk(ierr);
   ierr = CeedCalloc(P, &nodes); CeedChk(ierr);
   ierr = CeedCalloc(Q, &qref1d); CeedChk(ierr);
   ierr = CeedCalloc(Q, &qweight1d); CeedChk(ierr);
-  // Get Nodes and Weights
-  ierr = CeedLobattoQuadrature(P, nodes, NULL); CeedChk(ierr);
+  // Get Nodes and Weights; the single node of a constant basis is centered
+  if (P > 1) {
+    ierr = CeedLobattoQuadrature(P, nodes, NULL); CeedChk(ierr);
+  }
   switch (qmode) {
   case CEED_GAUSS:
     ierr = CeedGaussQuadrature(Q, qref1d, qweight1d); CeedChk(ierr);
@@ -497,31 +959,17 @@ int CeedBasisCreateTensorH1Lagrange(Ceed ceed, CeedInt dim, CeedInt ncomp,
     break;
   }
   // Build B, D matrix
-  // Fornberg, 1998
-  for (i = 0; i  < Q; i++) {
-    c1 = 1.0;
-    c3 = nodes[0] - qref1d[i];
-    interp1d[i*P+0] = 1.0;
-    for (j = 1; j < P; j++) {
-      c2 = 1.0;
-      c4 = c3;
-      c3 = nodes[j] - qref1d[i];
-      for (k = 0; k < j; k++) {
-        dx = nodes[j] - nodes[k];
-        c2 *= dx;
-        if (k == j - 1) {
-          grad1d[i*P + j] = c1*(interp1d[i*P + k] - c4*grad1d[i*P + k]) / c2;
-          interp1d[i*P + j] = - c1*c4*interp1d[i*P + k] / c2;
-        }
-        grad1d[i*P + k] = (c3*grad1d[i*P + k] - interp1d[i*P + k]) / dx;
-        interp1d[i*P + k] = c3*interp1d[i*P + k] / dx;
-      }
-      c1 = c2;
-    }
-  }
+  CeedLagrangeInterpolation(nodes, P, qref1d, Q, interp1d, grad1d);
   //  // Pass to CeedBasisCreateTensorH1
   ierr = CeedBasisCreateTensorH1(ceed, dim, ncomp, P, Q, interp1d, grad1d, qref1d,
                                  qweight1d, basis); CeedChk(ierr);
+  if (root == ceed) {
+    (*basis)->qmode = qmode;
+    ierr = CeedLock(ceed); CeedChk(ierr);
+    int ierradd = CeedBasisCacheAdd(ceed, *basis);
+    ierr = CeedUnlock(ceed); CeedChk(ierr);
+    CeedChk(ierradd);
+  }
   ierr = CeedFree(&interp1d); CeedChk(ierr);
   ierr = CeedFree(&grad1d); CeedChk(ierr);
   ierr = CeedFree(&nodes); CeedChk(ierr);
@@ -530,6 +978,79 @@ int CeedBasisCreateTensorH1Lagrange(Ceed ceed, CeedInt dim, CeedInt ncomp,
   return 0;
 }
 
+/**
+  @brief Create a tensor-product basis with the same nodal functions as a
+           given basis, evaluated at a different set of quadrature points
+
+  The nodal functions of @a basis are recovered by Lagrange interpolation
+    through its quadrature points, which is exact when @a basis has at least
+    as many quadrature points as nodes in each dimension. This allows an
+    operator to be evaluated with a coarser quadrature, such as on coarse
+    levels of a p-multigrid hierarchy.
+
+  @param basis       Tensor-product CeedBasis with at least as many quadrature
+                       points as nodes in one dimension
+  @param Q           Number of quadrature points in one dimension
+  @param qmode       Distribution of the Q quadrature points
+  @param[out] basisQ Address of the variable where the newly created
+                       CeedBasis will be stored.
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedBasisCreateAtQuadrature(CeedBasis basis, CeedInt Q, CeedQuadMode qmode,
+                                CeedBasis *basisQ) {
+  int ierr;
+  Ceed ceed = basis->ceed;
+  CeedInt P = basis->P1d, Qold = basis->Q1d;
+
+  if (!basis->tensorbasis)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Only tensor-product bases can be evaluated at "
+                     "new quadrature points");
+  // LCOV_EXCL_STOP
+  if (Qold < P)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Basis with %d nodes and %d quadrature points "
+                     "does not determine its nodal functions", P, Qold);
+  // LCOV_EXCL_STOP
+
+  CeedScalar *interp1d, *grad1d, *qref1d, *qweight1d, *interpQ, *gradQ;
+  ierr = CeedCalloc(P*Q, &interp1d); CeedChk(ierr);
+  ierr = CeedCalloc(P*Q, &grad1d); CeedChk(ierr);
+  ierr = CeedCalloc(Q, &qref1d); CeedChk(ierr);
+  ierr = CeedCalloc(Q, &qweight1d); CeedChk(ierr);
+  ierr = CeedCalloc(Qold*Q, &interpQ); CeedChk(ierr);
+  ierr = CeedCalloc(Qold*Q, &gradQ); CeedChk(ierr);
+  switch (qmode) {
+  case CEED_GAUSS:
+    ierr = CeedGaussQuadrature(Q, qref1d, qweight1d); CeedChk(ierr);
+    break;
+  case CEED_GAUSS_LOBATTO:
+    ierr = CeedLobattoQuadrature(Q, qref1d, qweight1d); CeedChk(ierr);
+    break;
+  }
+
+  // Interpolate from the old quadrature points to the new ones
+  CeedLagrangeInterpolation(basis->qref1d, Qold, qref1d, Q, interpQ, gradQ);
+  ierr = CeedMatrixMultiply(ceed, interpQ, basis->interp1d, interp1d, Q, P,
+                            Qold); CeedChk(ierr);
+  ierr = CeedMatrixMultiply(ceed, gradQ, basis->interp1d, grad1d, Q, P, Qold);
+  CeedChk(ierr);
+
+  ierr = CeedBasisCreateTensorH1(ceed, basis->dim, basis->ncomp, P, Q,
+                                 interp1d, grad1d, qref1d, qweight1d, basisQ);
+  CeedChk(ierr);
+  ierr = CeedFree(&interp1d); CeedChk(ierr);
+  ierr = CeedFree(&grad1d); CeedChk(ierr);
+  ierr = CeedFree(&qref1d); CeedChk(ierr);
+  ierr = CeedFree(&qweight1d); CeedChk(ierr);
+  ierr = CeedFree(&interpQ); CeedChk(ierr);
+  ierr = CeedFree(&gradQ); CeedChk(ierr);
+  return 0;
+}
+
 /**
   @brief Create a non tensor-product basis for H^1 discretizations
 
@@ -580,7 +1101,7 @@ int CeedBasisCreateH1(Ceed ceed, CeedElemTopology topo, CeedInt ncomp,
   ierr = CeedBasisGetTopologyDimension(topo, &dim); CeedChk(ierr);
 
   (*basis)->ceed = ceed;
-  ceed->refcount++;
+  CeedReference(ceed);
   (*basis)->refcount = 1;
   (*basis)->tensorbasis = 0;
   (*basis)->dim = dim;
@@ -588,19 +1109,229 @@ int CeedBasisCreateH1(Ceed ceed, CeedElemTopology topo, CeedInt ncomp,
   (*basis)->ncomp = ncomp;
   (*basis)->P = P;
   (*basis)->Q = Q;
-  ierr = CeedMalloc(Q*dim,&(*basis)->qref1d); CeedChk(ierr);
-  ierr = CeedMalloc(Q,&(*basis)->qweight1d); CeedChk(ierr);
+  ierr = CeedMallocHost(ceed, Q*dim, &(*basis)->qref1d); CeedChk(ierr);
+  ierr = CeedMallocHost(ceed, Q, &(*basis)->qweight1d); CeedChk(ierr);
   memcpy((*basis)->qref1d, qref, Q*dim*sizeof(qref[0]));
   memcpy((*basis)->qweight1d, qweight, Q*sizeof(qweight[0]));
-  ierr = CeedMalloc(Q*P, &(*basis)->interp); CeedChk(ierr);
-  ierr = CeedMalloc(dim*Q*P, &(*basis)->grad); CeedChk(ierr);
+  ierr = CeedMallocHost(ceed, Q*P, &(*basis)->interp); CeedChk(ierr);
+  ierr = CeedMallocHost(ceed, dim*Q*P, &(*basis)->grad); CeedChk(ierr);
   memcpy((*basis)->interp, interp, Q*P*sizeof(interp[0]));
   memcpy((*basis)->grad, grad, dim*Q*P*sizeof(grad[0]));
+  ierr = CeedBasisTrackMemory(*basis, CEED_MEMSPACE_HOST,
+                              (dim + 1)*Q*(P + 1)*sizeof(CeedScalar));
+  CeedChk(ierr);
   ierr = ceed->BasisCreateH1(topo, dim, P, Q, interp, grad, qref,
                              qweight, *basis); CeedChk(ierr);
   return 0;
 }
 
+/**
+  @brief Create a Lagrange basis on a simplex with collapsed coordinate
+           structure for H^1 discretizations
+
+  Nodes lie on the equispaced lattice x = (a_0, ..., a_{dim-1})/(P-1) of the
+    reference simplex with vertices at the origin and the unit vectors, ordered
+    lexicographically with a_{dim-1} varying fastest. The quadrature is a
+    Gauss-Jacobi rule in the collapsed coordinates of the simplex. Backends
+    may apply the basis by sum factorization over the collapsed coordinates
+    instead of the dense interpolation and gradient matrices.
+
+  @param ceed        A Ceed object where the CeedBasis will be created
+  @param topo        Topology of element, CEED_LINE, CEED_TRIANGLE, or CEED_TET
+  @param ncomp       Number of field components (1 for scalar fields)
+  @param P           Number of nodes along an edge.  The polynomial degree of
+                       the resulting P_k element is k=P-1.
+  @param Q           Number of quadrature points in each collapsed coordinate,
+                       for Q^dim quadrature points in total
+  @param[out] basis  Address of the variable where the newly created
+                       CeedBasis will be stored.
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedBasisCreateH1Simplex(Ceed ceed, CeedElemTopology topo, CeedInt ncomp,
+                             CeedInt P, CeedInt Q, CeedBasis *basis) {
+  int ierr;
+  CeedInt dim, N = P-1, nnodes = 1, nqpts, ntab;
+
+  if (topo != CEED_LINE && topo != CEED_TRIANGLE && topo != CEED_TET)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Simplex basis requires a simplex topology");
+  // LCOV_EXCL_STOP
+  if (P < 1 || Q < 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Simplex basis requires P and Q positive");
+  // LCOV_EXCL_STOP
+
+  ierr = CeedBasisGetTopologyDimension(topo, &dim); CeedChk(ierr);
+  for (CeedInt k=1; k<=dim; k++)
+    nnodes = nnodes*(N + k)/k;
+  nqpts = CeedIntPow(Q, dim);
+  ntab = Q*P*(P+1)/2;
+
+  // Lattice indices of nodes, also the degrees of the modes
+  CeedInt modes[nnodes*dim], idx[dim];
+  for (CeedInt d=0; d<dim; d++)
+    idx[d] = 0;
+  for (CeedInt n=0; n<nnodes; n++) {
+    for (CeedInt d=0; d<dim; d++)
+      modes[n*dim+d] = idx[d];
+    // Advance the last index, carrying when the total degree exceeds N
+    for (CeedInt d=dim-1; d>=0; d--) {
+      CeedInt s = 0;
+      idx[d]++;
+      for (CeedInt m=0; m<=d; m++)
+        s += idx[m];
+      if (s <= N || d == 0) break;
+      idx[d] = 0;
+    }
+  }
+
+  CeedScalar *vander, *vinv, *interpc, *gradc, *detadx, *interp, *grad, *qref,
+             *qweight, eta[dim][Q], w[dim][Q], h[P], dh[P];
+  ierr = CeedCalloc(nnodes*nnodes, &vander); CeedChk(ierr);
+  ierr = CeedCalloc(nnodes*nnodes, &vinv); CeedChk(ierr);
+  ierr = CeedCalloc(dim*ntab, &interpc); CeedChk(ierr);
+  ierr = CeedCalloc(dim*ntab, &gradc); CeedChk(ierr);
+  ierr = CeedCalloc(nqpts*dim*dim, &detadx); CeedChk(ierr);
+  ierr = CeedCalloc(nqpts*nnodes, &interp); CeedChk(ierr);
+  ierr = CeedCalloc(dim*nqpts*nnodes, &grad); CeedChk(ierr);
+  ierr = CeedCalloc(dim*nqpts, &qref); CeedChk(ierr);
+  ierr = CeedCalloc(nqpts, &qweight); CeedChk(ierr);
+
+  // Vandermonde matrix of the Dubiner modes at the nodes, in homogeneous form
+  //   so the collapsed coordinates need not be formed
+  for (CeedInt n=0; n<nnodes; n++) {
+    CeedScalar x[dim];
+    for (CeedInt d=0; d<dim; d++)
+      x[d] = N ? (CeedScalar)modes[n*dim+d]/N : 1.0/(dim+1);
+    for (CeedInt k=0; k<nnodes; k++) {
+      CeedInt s = 0;
+      CeedScalar t = 1.0;
+      for (CeedInt d=0; d<dim; d++)
+        t -= x[d];
+      vander[n*nnodes+k] = 1.0;
+      for (CeedInt d=0; d<dim; d++) {
+        // Scaling t_d = 1 - x_{d+1} - ... - x_{dim-1}
+        t += x[d];
+        CeedInt p = modes[k*dim+d];
+        ierr = CeedJacobiHomogeneous(p, 2*s+d, 2*x[d]-t, t, h, NULL);
+        CeedChk(ierr);
+        vander[n*nnodes+k] *= h[p];
+        s += p;
+      }
+    }
+  }
+  ierr = CeedMatrixInverse(ceed, vander, vinv, nnodes); CeedChk(ierr);
+
+  // Modal functions of each collapsed coordinate at Gauss-Jacobi points
+  for (CeedInt d=0; d<dim; d++) {
+    ierr = CeedGaussJacobiQuadrature(Q, d, eta[d], w[d]); CeedChk(ierr);
+    for (CeedInt s=0; s<P; s++) {
+      CeedScalar *tab = &interpc[d*ntab + Q*(s*P - s*(s-1)/2)],
+                  *dtab = &gradc[d*ntab + Q*(s*P - s*(s-1)/2)];
+      for (CeedInt i=0; i<Q; i++) {
+        CeedScalar f = pow((1 - eta[d][i])/2, s),
+                   df = s ? -0.5*s*pow((1 - eta[d][i])/2, s-1) : 0.0;
+        ierr = CeedJacobiHomogeneous(N-s, 2*s+d, eta[d][i], 1.0, h, dh);
+        CeedChk(ierr);
+        for (CeedInt m=0; m<P-s; m++) {
+          tab[i*(P-s)+m] = f*h[m];
+          dtab[i*(P-s)+m] = f*dh[m] + df*h[m];
+        }
+      }
+    }
+  }
+
+  // Quadrature points, weights, and derivatives of collapsed coordinates,
+  //   with x_a = (1 + eta_a)/2 prod_{m>a} (1 - eta_m)/2
+  for (CeedInt q=0; q<nqpts; q++) {
+    CeedInt iq[dim];
+    CeedScalar e[dim], J[dim*dim], Jcopy[dim*dim], Jinv[dim*dim];
+    for (CeedInt d=dim-1, r=q; d>=0; d--, r/=Q) {
+      iq[d] = r%Q;
+      e[d] = eta[d][iq[d]];
+    }
+    qweight[q] = 1.0;
+    for (CeedInt a=0; a<dim; a++) {
+      qweight[q] *= w[a][iq[a]]/pow(2.0, a+1);
+      qref[a*nqpts+q] = (1 + e[a])/2;
+      for (CeedInt m=0; m<dim; m++)
+        J[a*dim+m] = m < a ? 0.0 : (m == a ? 0.5 : -(1 + e[a])/4);
+      for (CeedInt m=a+1; m<dim; m++) {
+        qref[a*nqpts+q] *= (1 - e[m])/2;
+        for (CeedInt n=a; n<dim; n++)
+          if (n != m) J[a*dim+n] *= (1 - e[m])/2;
+      }
+    }
+    memcpy(Jcopy, J, dim*dim*sizeof(J[0]));
+    ierr = CeedMatrixInverse(ceed, Jcopy, Jinv, dim); CeedChk(ierr);
+    for (CeedInt a=0; a<dim; a++)
+      for (CeedInt m=0; m<dim; m++)
+        detadx[(q*dim+a)*dim+m] = Jinv[m*dim+a];
+
+    // Dense interpolation and gradient matrices for backends without
+    //   collapsed coordinate support
+    for (CeedInt k=0; k<nnodes; k++) {
+      CeedScalar psi = 1.0, dpsi[dim];
+      for (CeedInt m=0; m<dim; m++)
+        dpsi[m] = 1.0;
+      for (CeedInt d=0, s=0; d<dim; d++) {
+        CeedInt p = modes[k*dim+d],
+                off = d*ntab + Q*(s*P - s*(s-1)/2) + iq[d]*(P-s) + p;
+        psi *= interpc[off];
+        for (CeedInt m=0; m<dim; m++)
+          dpsi[m] *= m == d ? gradc[off] : interpc[off];
+        s += p;
+      }
+      for (CeedInt n=0; n<nnodes; n++) {
+        interp[q*nnodes+n] += psi*vinv[k*nnodes+n];
+        for (CeedInt a=0; a<dim; a++)
+          for (CeedInt m=0; m<dim; m++)
+            grad[(a*nqpts+q)*nnodes+n] += detadx[(q*dim+a)*dim+m]*dpsi[m]*
+                                          vinv[k*nnodes+n];
+      }
+    }
+  }
+
+  ierr = CeedBasisCreateH1(ceed, topo, ncomp, nnodes, nqpts, interp, grad,
+                           qref, qweight, basis); CeedChk(ierr);
+  (*basis)->P1d = P;
+  (*basis)->Q1d = Q;
+  (*basis)->vinv = vinv;
+  (*basis)->interpc = interpc;
+  (*basis)->gradc = gradc;
+  (*basis)->detadx = detadx;
+  ierr = CeedBasisTrackMemory(*basis, CEED_MEMSPACE_HOST,
+                              (nnodes*nnodes + 2*dim*ntab + nqpts*dim*dim)*
+                              sizeof(CeedScalar)); CeedChk(ierr);
+
+  ierr = CeedFree(&vander); CeedChk(ierr);
+  ierr = CeedFree(&interp); CeedChk(ierr);
+  ierr = CeedFree(&grad); CeedChk(ierr);
+  ierr = CeedFree(&qref); CeedChk(ierr);
+  ierr = CeedFree(&qweight); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Get the memory allocated for the matrices of a CeedBasis
+
+  @param basis       CeedBasis to retrieve memory usage
+  @param space       CeedMemSpace to get the usage of
+  @param[out] bytes  Variable to store the number of bytes allocated
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedBasisGetMemoryUsage(CeedBasis basis, CeedMemSpace space,
+                            size_t *bytes) {
+  *bytes = basis->memusage[space];
+  return 0;
+}
+
 /**
   @brief View a CeedBasis
 
@@ -685,7 +1416,68 @@ int CeedBasisApply(CeedBasis basis, CeedInt nelem, CeedTransposeMode tmode,
     return CeedError(basis->ceed, 1, "Length of input/output vectors "
                      "incompatible with basis dimensions");
 
+  double start;
+  ierr = CeedProfileStart(basis->ceed, CEED_PROFILE_BASIS, &start);
+  CeedChk(ierr);
   ierr = basis->Apply(basis, nelem, tmode, emode, u, v); CeedChk(ierr);
+  size_t flops = 0;
+  if (start >= 0) {
+    ierr = CeedBasisGetFlopsEstimate(basis, tmode, emode, &flops);
+    CeedChk(ierr);
+  }
+  ierr = CeedProfileStopFlops(basis->ceed, CEED_PROFILE_BASIS, start, 0,
+                              (double)nelem*flops); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Estimate the flops of applying a CeedBasis to one element
+
+  Tensor product bases are counted as a sequence of one dimensional
+    contractions, with one sequence per direction for gradients; other bases
+    as dense matrix products.
+
+  @param basis       CeedBasis
+  @param tmode       \ref CEED_NOTRANSPOSE or \ref CEED_TRANSPOSE
+  @param emode       CeedEvalMode to apply
+  @param[out] flops  Variable to store the flops per element
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedBasisGetFlopsEstimate(CeedBasis basis, CeedTransposeMode tmode,
+                              CeedEvalMode emode, size_t *flops) {
+  CeedInt passes = 0;
+
+  *flops = 0;
+  switch (emode) {
+  case CEED_EVAL_INTERP: passes = 1; break;
+  case CEED_EVAL_GRAD: passes = basis->dim; break;
+  case CEED_EVAL_WEIGHT:
+    // Products of the one dimensional weights
+    if (basis->tensorbasis)
+      *flops = (size_t)(basis->dim - 1)*basis->Q;
+    return 0;
+  default: return 0;
+  }
+  if (basis->tensorbasis) {
+    // Contractions P^dim -> P^(dim-1) Q -> ... -> Q^dim, or the reverse
+    const CeedInt from = tmode == CEED_TRANSPOSE ? basis->Q1d : basis->P1d,
+                  to = tmode == CEED_TRANSPOSE ? basis->P1d : basis->Q1d;
+    size_t size = 1;
+    for (CeedInt d=0; d<basis->dim; d++)
+      size *= from;
+    for (CeedInt d=0; d<basis->dim; d++) {
+      *flops += 2*size*to;
+      size = size / from * to;
+    }
+    // Each pass contracts in every direction
+    *flops *= passes;
+  } else {
+    *flops = 2*(size_t)passes*basis->P*basis->Q;
+  }
+  *flops *= basis->ncomp;
   return 0;
 }
 
@@ -850,7 +1642,11 @@ int CeedBasisGetInterp(CeedBasis basis, const CeedScalar **interp) {
   if (!basis->interp && basis->tensorbasis) {
     // Allocate
     int ierr;
-    ierr = CeedMalloc(basis->Q*basis->P, &basis->interp); CeedChk(ierr);
+    ierr = CeedMallocHost(basis->ceed, basis->Q*basis->P, &basis->interp);
+    CeedChk(ierr);
+    ierr = CeedBasisTrackMemory(basis, CEED_MEMSPACE_HOST,
+                                basis->Q*basis->P*sizeof(CeedScalar));
+    CeedChk(ierr);
 
     // Initialize
     for (CeedInt i=0; i<basis->Q*basis->P; i++)
@@ -906,7 +1702,11 @@ int CeedBasisGetGrad(CeedBasis basis, const CeedScalar **grad) {
   if (!basis->grad && basis->tensorbasis) {
     // Allocate
     int ierr;
-    ierr = CeedMalloc(basis->dim*basis->Q*basis->P, &basis->grad);
+    ierr = CeedMallocHost(basis->ceed, basis->dim*basis->Q*basis->P,
+                          &basis->grad);
+    CeedChk(ierr);
+    ierr = CeedBasisTrackMemory(basis, CEED_MEMSPACE_HOST, basis->dim*basis->Q*
+                                basis->P*sizeof(CeedScalar));
     CeedChk(ierr);
 
     // Initialize
@@ -967,16 +1767,32 @@ int CeedBasisGetGrad1D(CeedBasis basis, const CeedScalar **grad1d) {
 int CeedBasisDestroy(CeedBasis *basis) {
   int ierr;
 
-  if (!*basis || --(*basis)->refcount > 0) return 0;
+  if (!*basis) return 0;
+  if ((*basis)->cached) {
+    Ceed root;
+    ierr = CeedGetParent((*basis)->ceed, &root); CeedChk(ierr);
+    ierr = CeedLock(root); CeedChk(ierr);
+    int refcount = CeedBasisCacheRelease(root, *basis);
+    ierr = CeedUnlock(root); CeedChk(ierr);
+    if (refcount > 0) return 0;
+  } else if (CeedDereference(*basis) > 0) return 0;
   if ((*basis)->Destroy) {
     ierr = (*basis)->Destroy(*basis); CeedChk(ierr);
   }
-  ierr = CeedFree(&(*basis)->interp); CeedChk(ierr);
-  ierr = CeedFree(&(*basis)->interp1d); CeedChk(ierr);
-  ierr = CeedFree(&(*basis)->grad); CeedChk(ierr);
-  ierr = CeedFree(&(*basis)->grad1d); CeedChk(ierr);
-  ierr = CeedFree(&(*basis)->qref1d); CeedChk(ierr);
-  ierr = CeedFree(&(*basis)->qweight1d); CeedChk(ierr);
+  for (CeedInt s=0; s<CEED_MEMSPACE_NUM; s++) {
+    const ptrdiff_t bytes = (*basis)->memusage[s];
+    ierr = CeedBasisTrackMemory(*basis, s, -bytes); CeedChk(ierr);
+  }
+  ierr = CeedFreeHost((*basis)->ceed, &(*basis)->interp); CeedChk(ierr);
+  ierr = CeedFreeHost((*basis)->ceed, &(*basis)->interp1d); CeedChk(ierr);
+  ierr = CeedFreeHost((*basis)->ceed, &(*basis)->grad); CeedChk(ierr);
+  ierr = CeedFreeHost((*basis)->ceed, &(*basis)->grad1d); CeedChk(ierr);
+  ierr = CeedFreeHost((*basis)->ceed, &(*basis)->qref1d); CeedChk(ierr);
+  ierr = CeedFreeHost((*basis)->ceed, &(*basis)->qweight1d); CeedChk(ierr);
+  ierr = CeedFree(&(*basis)->vinv); CeedChk(ierr);
+  ierr = CeedFree(&(*basis)->interpc); CeedChk(ierr);
+  ierr = CeedFree(&(*basis)->gradc); CeedChk(ierr);
+  ierr = CeedFree(&(*basis)->detadx); CeedChk(ierr);
   ierr = CeedDestroy(&(*basis)->ceed); CeedChk(ierr);
   ierr = CeedFree(basis); CeedChk(ierr);
   return 0;
@@ -1205,7 +2021,9 @@ int CeedSymmetricSchurDecomposition(Ceed ceed, CeedScalar *mat,
     // norm of v[i:m] after modification above and scaling below
     //   norm = sqrt(v[i]*v[i] + sigma) / v[i];
     //   tau = 2 / (norm*norm)
-    if (sigma > 10*CEED_EPSILON)
+    // The reflector is applied even when v[i+1:n-1] vanishes, as it changes
+    //   the sign of the sub diagonal entry to Rii
+    if (v[i]*v[i] + sigma > 0)
       tau[i] = 2 * v[i]*v[i] / (v[i]*v[i] + sigma);
     else
       tau[i] = 0;
@@ -1245,21 +2063,25 @@ int CeedSymmetricSchurDecomposition(Ceed ceed, CeedScalar *mat,
   CeedScalar tol = 10*CEED_EPSILON;
 
   while (q < n && itr < maxitr) {
-    // Update p, q, size of reduced portions of diagonal
-    p = 0; q = 0;
+    // Update p, q, size of reduced portions of diagonal; sub diagonal entries
+    //   are negligible relative to their neighboring diagonal entries
+    for (CeedInt i=0; i<n-1; i++)
+      if (fabs(matT[i+n*(i+1)]) <
+          tol*(fabs(matT[i+n*i]) + fabs(matT[(i+1)+n*(i+1)]) + tol)) {
+        matT[i+n*(i+1)] = 0; matT[(i+1)+n*i] = 0;
+      }
+    q = 0;
     for (CeedInt i=n-2; i>=0; i--) {
-      if (fabs(matT[i+n*(i+1)]) < tol)
+      if (matT[i+n*(i+1)] == 0)
         q += 1;
       else
         break;
     }
-    for (CeedInt i=0; i<n-1-q; i++) {
-      if (fabs(matT[i+n*(i+1)]) < tol)
-        p += 1;
-      else
-        break;
-    }
     if (q == n-1) break; // Finished reducing
+    // Unreduced block ending above the reduced portion
+    p = n-2-q;
+    while (p > 0 && matT[(p-1)+n*p] != 0)
+      p--;
 
     // Reduce tridiagonal portion
     CeedScalar tnn = matT[(n-1-q)+n*(n-1-q)],
@@ -1272,7 +2094,7 @@ int CeedSymmetricSchurDecomposition(Ceed ceed, CeedScalar *mat,
     for (CeedInt k=p; k<n-1-q; k++) {
       // Compute Givens rotation
       CeedScalar c = 1, s = 0;
-      if (fabs(z) > tol) {
+      if (z != 0) {
         if (fabs(z) > fabs(x)) {
           CeedScalar tau = -x/z;
           s = 1/sqrt(1+tau*tau), c = s*tau;
@@ -16,6 +16,8 @@
 
 #include <ceed-impl.h>
 #include <ceed-backend.h>
+#include <stdint.h>
+#include <string.h>
 
 /// @file
 /// Implementation of CeedElemRestriction interfaces
@@ -56,6 +58,63 @@ int CeedPermutePadOffsets(const CeedInt *offsets, CeedInt *blkoffsets,
   return 0;
 }
 
+/**
+  @brief Expand the offsets of a compressed restriction
+
+  @param eoffsets   Array of the base offsets of each element, of size @a nelem
+  @param stencil    Array of the offsets of the element nodes relative to the
+                      element base offset, of size @a elemsize
+  @param offsets    Array of expanded offsets of shape [@a nelem, @a elemsize]
+  @param nelem      Number of elements
+  @param elemsize   Size of each element
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Utility
+**/
+static int CeedExpandCompressedOffsets(const CeedInt *eoffsets,
+                                       const CeedInt *stencil,
+                                       CeedInt *offsets, CeedInt nelem,
+                                       CeedInt elemsize) {
+  for (CeedInt e = 0; e < nelem; e++)
+    for (CeedInt k = 0; k < elemsize; k++)
+      offsets[e*elemsize + k] = eoffsets[e] + stencil[k];
+  return 0;
+}
+
+/**
+  @brief Copy the element base offsets and stencil of a compressed
+           restriction
+
+  @param rstr       CeedElemRestriction
+  @param eoffsets   Array of the base offsets of each element
+  @param stencil    Array of the offsets of the element nodes relative to the
+                      element base offset
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionSetCompressedOffsets(CeedElemRestriction rstr,
+    const CeedInt *eoffsets, const CeedInt *stencil) {
+  int ierr;
+
+  if (!eoffsets || !stencil)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, 1, "Compressed ElemRestriction requires "
+                     "element offsets and a stencil");
+  // LCOV_EXCL_STOP
+
+  ierr = CeedMalloc(rstr->nelem, &rstr->eoffsets); CeedChk(ierr);
+  memcpy(rstr->eoffsets, eoffsets, rstr->nelem * sizeof(eoffsets[0]));
+  ierr = CeedMalloc(rstr->elemsize, &rstr->stencil); CeedChk(ierr);
+  memcpy(rstr->stencil, stencil, rstr->elemsize * sizeof(stencil[0]));
+  ierr = CeedElemRestrictionTrackMemory(rstr, CEED_MEMSPACE_HOST,
+                                        (rstr->nelem + rstr->elemsize) *
+                                        sizeof(CeedInt)); CeedChk(ierr);
+  return 0;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -79,6 +138,20 @@ int CeedElemRestrictionGetCeed(CeedElemRestriction rstr, Ceed *ceed) {
   return 0;
 }
 
+/**
+  @brief Add a reference to a CeedElemRestriction
+
+  @param[out] rstr        CeedElemRestriction to increment reference counter
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionAddReference(CeedElemRestriction rstr) {
+  CeedReference(rstr);
+  return 0;
+}
+
 /**
 
   @brief Get the strides of a strided CeedElemRestriction
@@ -119,13 +192,19 @@ int CeedElemRestrictionGetOffsets(CeedElemRestriction rstr, CeedMemType mtype,
                                   const CeedInt **offsets) {
   int ierr;
 
+  if (mtype == CEED_MEM_UNIFIED)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, 1, "CEED_MEM_UNIFIED is only supported "
+                     "for CeedVector");
+  // LCOV_EXCL_STOP
+
   if (!rstr->GetOffsets)
     // LCOV_EXCL_START
     return CeedError(rstr->ceed, 1, "Backend does not support GetOffsets");
   // LCOV_EXCL_STOP
 
   ierr = rstr->GetOffsets(rstr, mtype, offsets); CeedChk(ierr);
-  rstr->numreaders++;
+  __atomic_add_fetch(&rstr->numreaders, 1, __ATOMIC_RELAXED);
   return 0;
 }
 
@@ -142,7 +221,7 @@ int CeedElemRestrictionGetOffsets(CeedElemRestriction rstr, CeedMemType mtype,
 int CeedElemRestrictionRestoreOffsets(CeedElemRestriction rstr,
                                       const CeedInt **offsets) {
   *offsets = NULL;
-  rstr->numreaders--;
+  __atomic_sub_fetch(&rstr->numreaders, 1, __ATOMIC_RELAXED);
   return 0;
 }
 
@@ -161,6 +240,142 @@ int CeedElemRestrictionIsStrided(CeedElemRestriction rstr, bool *isstrided) {
   return 0;
 }
 
+/**
+  @brief Get the compressed status of a CeedElemRestriction
+
+  @param rstr               CeedElemRestriction
+  @param[out] iscompressed  Variable to store compressed status, 1 if the
+                              offsets are given by element base offsets and
+                              a stencil, else 0
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionIsCompressed(CeedElemRestriction rstr,
+                                    bool *iscompressed) {
+  *iscompressed = rstr->eoffsets ? 1 : 0;
+  return 0;
+}
+
+/**
+  @brief Get the element base offsets and stencil of a compressed
+           CeedElemRestriction
+
+  The offset of node i of element k is eoffsets[k] + stencil[i].
+
+  @param rstr           CeedElemRestriction
+  @param[out] eoffsets  Variable to store the base offsets of each element,
+                          of size nelem
+  @param[out] stencil   Variable to store the node offsets relative to the
+                          element base offset, of size elemsize
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetCompressedOffsets(CeedElemRestriction rstr,
+    const CeedInt **eoffsets, const CeedInt **stencil) {
+  if (!rstr->eoffsets)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, 1, "ElemRestriction is not compressed");
+  // LCOV_EXCL_STOP
+
+  *eoffsets = rstr->eoffsets;
+  *stencil = rstr->stencil;
+  return 0;
+}
+
+/**
+  @brief Get the number of elements a CeedElemRestriction gathers per face
+
+  @param rstr          CeedElemRestriction
+  @param[out] nsides   Variable to store the number of sides, 2 for
+                         restrictions created by
+                         @ref CeedElemRestrictionCreateTwoSided(), else 1
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetNumSides(CeedElemRestriction rstr, CeedInt *nsides) {
+  *nsides = CeedIntMax(rstr->nsides, 1);
+  return 0;
+}
+
+/**
+  @brief Get the CeedElemRestriction whose offsets a view shares
+
+  @param rstr          CeedElemRestriction
+  @param[out] source   Variable to store the source restriction, or NULL if
+                         @a rstr was not created by
+                         @ref CeedElemRestrictionCreateView()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetViewSource(CeedElemRestriction rstr,
+                                     CeedElemRestriction *source) {
+  *source = rstr->viewof;
+  return 0;
+}
+
+/**
+  @brief Get the integer type of the offsets a CeedElemRestriction reads
+
+  @param rstr          CeedElemRestriction
+  @param[out] itype    Variable to store the CeedIndexType
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetIndexType(CeedElemRestriction rstr,
+                                    CeedIndexType *itype) {
+  *itype = rstr->indextype;
+  return 0;
+}
+
+/**
+  @brief Check whether the offsets of a CeedElemRestriction can be stored
+           with an integer type
+
+  @param rstr          CeedElemRestriction
+  @param itype         CeedIndexType to check
+  @param[out] fits     Variable to store whether the offsets of every block
+                         of elements, relative to the smallest offset of the
+                         block, are representable with @a itype
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionCheckIndexType(CeedElemRestriction rstr,
+                                      CeedIndexType itype, bool *fits) {
+  int ierr;
+
+  *fits = itype == CEED_INDEX_INT32;
+  if (*fits || rstr->strides || rstr->eoffsets || rstr->nsides > 1)
+    return 0;
+
+  const CeedInt *offsets;
+  const CeedInt blklen = rstr->blksize*rstr->elemsize;
+  ierr = CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets);
+  CeedChk(ierr);
+  *fits = true;
+  for (CeedInt b = 0; b < rstr->nblk && *fits; b++) {
+    CeedInt min = offsets[b*blklen], max = offsets[b*blklen];
+    for (CeedInt i = 1; i < blklen; i++) {
+      min = CeedIntMin(min, offsets[b*blklen + i]);
+      max = CeedIntMax(max, offsets[b*blklen + i]);
+    }
+    *fits = max - min <= UINT16_MAX;
+  }
+  ierr = CeedElemRestrictionRestoreOffsets(rstr, &offsets); CeedChk(ierr);
+  return 0;
+}
+
 /**
   @brief Get the backend stride status of a CeedElemRestriction
 
@@ -263,6 +478,632 @@ int CeedElemRestrictionSetData(CeedElemRestriction rstr, void *data) {
   return 0;
 }
 
+/**
+  @brief Account for memory allocated or freed by the backend for a
+           CeedElemRestriction
+
+  Bytes still accounted when the CeedElemRestriction is destroyed are
+    released, so backends only need to report memory freed during the life of
+    the object.
+
+  @param rstr   CeedElemRestriction owning the memory
+  @param space  CeedMemSpace of the allocation
+  @param bytes  Number of bytes allocated, negative for bytes freed
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionTrackMemory(CeedElemRestriction rstr, CeedMemSpace space,
+                                   ptrdiff_t bytes) {
+  int ierr;
+
+  rstr->memusage[space] += bytes;
+  ierr = CeedTrackMemory(rstr->ceed, CEED_MEMORY_RESTRICTION, space, bytes);
+  CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Compute an element processing order for a CeedElemRestriction
+
+  Elements are adjacent when they share an L-vector node. The reverse
+    Cuthill-McKee ordering numbers adjacent elements close together, so
+    consecutive elements touch nearby L-vector entries.
+
+  @param rstr       CeedElemRestriction with offsets
+  @param ordering   Element ordering to compute, see CeedElemOrdering
+  @param[out] perm  Array of size nelem; perm[k] is the element processed k-th
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetElementOrdering(CeedElemRestriction rstr,
+    CeedElemOrdering ordering, CeedInt *perm) {
+  int ierr;
+  // Rows of two-sided restrictions hold the nodes of both sides
+  const CeedInt nelem = rstr->nelem, lsize = rstr->lsize,
+                elemsize = rstr->elemsize*CeedIntMax(rstr->nsides, 1);
+
+  if (ordering == CEED_ORDERING_NATURAL || nelem == 0) {
+    for (CeedInt e = 0; e < nelem; e++)
+      perm[e] = e;
+    return 0;
+  }
+  if (rstr->strides || rstr->blksize > 1)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, 1, "Element ordering requires an unblocked "
+                     "ElemRestriction with offsets");
+  // LCOV_EXCL_STOP
+
+  const CeedInt *offsets;
+  ierr = CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets);
+  CeedChk(ierr);
+  if (!offsets)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, 1, "Element ordering requires offsets in "
+                     "host memory");
+  // LCOV_EXCL_STOP
+
+  // Elements touching each L-vector node
+  CeedInt *nodestart, *nodeelems;
+  ierr = CeedCalloc(lsize+1, &nodestart); CeedChk(ierr);
+  ierr = CeedMalloc(nelem*elemsize, &nodeelems); CeedChk(ierr);
+  for (CeedInt i = 0; i < nelem*elemsize; i++)
+    nodestart[offsets[i]+1]++;
+  for (CeedInt n = 0; n < lsize; n++)
+    nodestart[n+1] += nodestart[n];
+  for (CeedInt i = 0; i < nelem*elemsize; i++)
+    nodeelems[nodestart[offsets[i]]++] = i / elemsize;
+  for (CeedInt n = lsize; n > 0; n--)
+    nodestart[n] = nodestart[n-1];
+  nodestart[0] = 0;
+
+  // Element adjacency graph
+  CeedInt *mark, *adjstart, *adj;
+  ierr = CeedMalloc(nelem, &mark); CeedChk(ierr);
+  ierr = CeedCalloc(nelem+1, &adjstart); CeedChk(ierr);
+  for (CeedInt pass = 0; pass < 2; pass++) {
+    if (pass == 1) {
+      for (CeedInt e = 0; e < nelem; e++)
+        adjstart[e+1] += adjstart[e];
+      ierr = CeedMalloc(adjstart[nelem], &adj); CeedChk(ierr);
+    }
+    for (CeedInt e = 0; e < nelem; e++)
+      mark[e] = -1;
+    for (CeedInt e = 0; e < nelem; e++) {
+      CeedInt count = 0;
+      for (CeedInt i = 0; i < elemsize; i++) {
+        const CeedInt n = offsets[e*elemsize + i];
+        for (CeedInt j = nodestart[n]; j < nodestart[n+1]; j++) {
+          const CeedInt f = nodeelems[j];
+          if (f != e && mark[f] != e) {
+            mark[f] = e;
+            if (pass == 1)
+              adj[adjstart[e] + count] = f;
+            count++;
+          }
+        }
+      }
+      if (pass == 0)
+        adjstart[e+1] = count;
+    }
+  }
+  ierr = CeedFree(&nodestart); CeedChk(ierr);
+  ierr = CeedFree(&nodeelems); CeedChk(ierr);
+  ierr = CeedElemRestrictionRestoreOffsets(rstr, &offsets); CeedChk(ierr);
+
+  // Cuthill-McKee: breadth first search from a minimum degree element of each
+  //   connected component, visiting neighbors by increasing degree
+  CeedInt *order = mark, head = 0, tail = 0;
+  bool *visited;
+  ierr = CeedCalloc(nelem, &visited); CeedChk(ierr);
+  while (tail < nelem) {
+    CeedInt start = -1;
+    for (CeedInt e = 0; e < nelem; e++)
+      if (!visited[e] && (start < 0 ||
+                          adjstart[e+1] - adjstart[e] <
+                          adjstart[start+1] - adjstart[start]))
+        start = e;
+    visited[start] = 1;
+    order[tail++] = start;
+    while (head < tail) {
+      const CeedInt e = order[head++], first = tail;
+      for (CeedInt j = adjstart[e]; j < adjstart[e+1]; j++)
+        if (!visited[adj[j]]) {
+          visited[adj[j]] = 1;
+          order[tail++] = adj[j];
+        }
+      // Insertion sort of the new elements by degree
+      for (CeedInt j = first + 1; j < tail; j++) {
+        const CeedInt f = order[j], deg = adjstart[f+1] - adjstart[f];
+        CeedInt k = j;
+        for (; k > first && adjstart[order[k-1]+1] - adjstart[order[k-1]] > deg;
+             k--)
+          order[k] = order[k-1];
+        order[k] = f;
+      }
+    }
+  }
+
+  // Reverse
+  for (CeedInt e = 0; e < nelem; e++)
+    perm[e] = order[nelem-1-e];
+
+  ierr = CeedFree(&visited); CeedChk(ierr);
+  ierr = CeedFree(&mark); CeedChk(ierr);
+  ierr = CeedFree(&adjstart); CeedChk(ierr);
+  ierr = CeedFree(&adj); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Create a CeedElemRestriction over a subset of elements
+
+  Element k of the new restriction is element elems[k] of @a rstr, so the
+    L-vector layout is unchanged and vectors, such as quadrature data, can be
+    shared with operators using @a rstr. Strided restrictions become
+    compressed restrictions with the same L-vector layout. Only the offsets of
+    the selected elements are copied.
+
+  @param rstr          CeedElemRestriction to take elements from
+  @param nelem         Number of elements of the new restriction
+  @param elems         Array of size @a nelem; elems[k] is the element of
+                         @a rstr used for element k
+  @param[out] rstrsub  Address of the variable where the newly created
+                         CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionCreateSubset(CeedElemRestriction rstr, CeedInt nelem,
+                                    const CeedInt *elems,
+                                    CeedElemRestriction *rstrsub) {
+  int ierr;
+  const CeedInt elemsize = rstr->elemsize,
+                nsides = CeedIntMax(rstr->nsides, 1), rowsize = elemsize*nsides;
+
+  if (rstr->blksize > 1)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, 1, "Cannot take elements of a blocked "
+                     "ElemRestriction");
+  // LCOV_EXCL_STOP
+  for (CeedInt e = 0; e < nelem; e++)
+    if (elems[e] < 0 || elems[e] >= rstr->nelem)
+      // LCOV_EXCL_START
+      return CeedError(rstr->ceed, 1, "Element %d not in [0, %d)", elems[e],
+                       rstr->nelem);
+  // LCOV_EXCL_STOP
+
+  if (rstr->strides) {
+    // Compressed restriction with the same L-vector layout
+    CeedInt strides[3], *eoffsets, *stencil;
+    bool backendstrides;
+    ierr = CeedElemRestrictionHasBackendStrides(rstr, &backendstrides);
+    CeedChk(ierr);
+    if (backendstrides) {
+      ierr = CeedElemRestrictionGetELayout(rstr, &strides); CeedChk(ierr);
+    } else {
+      ierr = CeedElemRestrictionGetStrides(rstr, &strides); CeedChk(ierr);
+    }
+    ierr = CeedMalloc(nelem, &eoffsets); CeedChk(ierr);
+    ierr = CeedMalloc(elemsize, &stencil); CeedChk(ierr);
+    for (CeedInt e = 0; e < nelem; e++)
+      eoffsets[e] = elems[e]*strides[2];
+    for (CeedInt i = 0; i < elemsize; i++)
+      stencil[i] = i*strides[0];
+    ierr = CeedElemRestrictionCreateCompressed(rstr->ceed, nelem, elemsize,
+           rstr->ncomp, strides[1], rstr->lsize, eoffsets, stencil, rstrsub);
+    CeedChk(ierr);
+    ierr = CeedFree(&eoffsets); CeedChk(ierr);
+    ierr = CeedFree(&stencil); CeedChk(ierr);
+  } else if (rstr->eoffsets) {
+    // Select element base offsets
+    CeedInt *eoffsets;
+    ierr = CeedMalloc(nelem, &eoffsets); CeedChk(ierr);
+    for (CeedInt e = 0; e < nelem; e++)
+      eoffsets[e] = rstr->eoffsets[elems[e]];
+    ierr = CeedElemRestrictionCreateCompressed(rstr->ceed, nelem, elemsize,
+           rstr->ncomp, rstr->compstride, rstr->lsize, eoffsets, rstr->stencil,
+           rstrsub); CeedChk(ierr);
+    ierr = CeedFree(&eoffsets); CeedChk(ierr);
+  } else {
+    // Select rows of offsets
+    const CeedInt *offsets;
+    CeedInt *suboffsets;
+    ierr = CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets);
+    CeedChk(ierr);
+    if (!offsets)
+      // LCOV_EXCL_START
+      return CeedError(rstr->ceed, 1, "Taking elements of an ElemRestriction "
+                       "requires offsets in host memory");
+    // LCOV_EXCL_STOP
+    ierr = CeedMalloc(nelem*rowsize, &suboffsets); CeedChk(ierr);
+    for (CeedInt e = 0; e < nelem; e++)
+      memcpy(&suboffsets[e*rowsize], &offsets[elems[e]*rowsize],
+             rowsize * sizeof(offsets[0]));
+    ierr = CeedElemRestrictionRestoreOffsets(rstr, &offsets); CeedChk(ierr);
+    if (nsides > 1) {
+      ierr = CeedElemRestrictionCreateTwoSided(rstr->ceed, nelem, elemsize,
+             rstr->ncomp/nsides, rstr->compstride, rstr->lsize, CEED_MEM_HOST,
+             CEED_OWN_POINTER, suboffsets, rstrsub); CeedChk(ierr);
+    } else {
+      ierr = CeedElemRestrictionCreate(rstr->ceed, nelem, elemsize, rstr->ncomp,
+                                       rstr->compstride, rstr->lsize,
+                                       CEED_MEM_HOST, CEED_OWN_POINTER,
+                                       suboffsets, rstrsub); CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
+/**
+  @brief Create a CeedElemRestriction with permuted elements
+
+  Element k of the new restriction is element perm[k] of @a rstr, so the
+    L-vector layout is unchanged. Strided restrictions become compressed
+    restrictions with the same L-vector layout.
+
+  @param rstr           CeedElemRestriction to permute
+  @param perm           Array of size nelem; perm[k] is the element of @a rstr
+                          used for element k
+  @param[out] rstrperm  Address of the variable where the newly created
+                          CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionCreatePermuted(CeedElemRestriction rstr,
+                                      const CeedInt *perm,
+                                      CeedElemRestriction *rstrperm) {
+  return CeedElemRestrictionCreateSubset(rstr, rstr->nelem, perm, rstrperm);
+}
+
+/**
+  @brief Create a CeedElemRestriction concatenating the elements and L-vectors
+           of several CeedElemRestrictions
+
+  The elements of rstrs[0] come first, followed by those of rstrs[1], and so
+    on, and the L-vector of the new restriction holds the L-vectors of
+    @a rstrs one after another, so the L-vector of rstrs[k] starts at the sum
+    of the L-vector sizes of the earlier restrictions. Strided and compressed
+    restrictions become offsets with the same L-vector layout. The
+    restrictions must have the same element size and number of components
+    and, for more than one component, the same component stride.
+
+  @param nrstr         Number of CeedElemRestrictions to concatenate
+  @param rstrs         Array of size @a nrstr of CeedElemRestrictions
+  @param[out] rstrcat  Address of the variable where the newly created
+                         CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionCreateConcatenated(CeedInt nrstr,
+    CeedElemRestriction *rstrs, CeedElemRestriction *rstrcat) {
+  int ierr;
+  Ceed ceed = rstrs[0]->ceed;
+  const CeedInt elemsize = rstrs[0]->elemsize, ncomp = rstrs[0]->ncomp;
+  CeedInt nelem = 0, lsize = 0, compstride = 0;
+
+  // Component strides in the L-vectors
+  CeedInt (*strides)[3];
+  ierr = CeedMalloc(nrstr, &strides); CeedChk(ierr);
+  for (CeedInt k = 0; k < nrstr; k++) {
+    CeedElemRestriction rstr = rstrs[k];
+    if (rstr->blksize > 1 || rstr->nsides > 1 || rstr->elemsize != elemsize ||
+        rstr->ncomp != ncomp)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Concatenated ElemRestrictions must be "
+                       "one-sided and unblocked, with the same element size "
+                       "and number of components");
+    // LCOV_EXCL_STOP
+    CeedInt stride = rstr->compstride;
+    if (rstr->strides) {
+      bool backendstrides;
+      ierr = CeedElemRestrictionHasBackendStrides(rstr, &backendstrides);
+      CeedChk(ierr);
+      if (backendstrides) {
+        ierr = CeedElemRestrictionGetELayout(rstr, &strides[k]); CeedChk(ierr);
+      } else {
+        ierr = CeedElemRestrictionGetStrides(rstr, &strides[k]); CeedChk(ierr);
+      }
+      stride = strides[k][1];
+    }
+    if (k == 0)
+      compstride = stride;
+    if (ncomp > 1 && stride != compstride)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Concatenated ElemRestrictions must have the "
+                       "same component stride, %d != %d", stride, compstride);
+    // LCOV_EXCL_STOP
+    nelem += rstr->nelem;
+  }
+
+  // Offsets shifted to the start of each L-vector
+  CeedInt *offsets;
+  ierr = CeedMalloc(nelem*elemsize, &offsets); CeedChk(ierr);
+  for (CeedInt k = 0, start = 0; k < nrstr; k++) {
+    CeedElemRestriction rstr = rstrs[k];
+    CeedInt *catoffsets = &offsets[start*elemsize];
+    if (rstr->strides) {
+      for (CeedInt e = 0; e < rstr->nelem; e++)
+        for (CeedInt i = 0; i < elemsize; i++)
+          catoffsets[e*elemsize + i] = lsize + i*strides[k][0] +
+                                       e*strides[k][2];
+    } else if (rstr->eoffsets) {
+      ierr = CeedExpandCompressedOffsets(rstr->eoffsets, rstr->stencil,
+                                         catoffsets, rstr->nelem, elemsize);
+      CeedChk(ierr);
+      for (CeedInt i = 0; i < rstr->nelem*elemsize; i++)
+        catoffsets[i] += lsize;
+    } else {
+      const CeedInt *rstroffsets;
+      ierr = CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &rstroffsets);
+      CeedChk(ierr);
+      if (!rstroffsets)
+        // LCOV_EXCL_START
+        return CeedError(ceed, 1, "Concatenating ElemRestrictions requires "
+                         "offsets in host memory");
+      // LCOV_EXCL_STOP
+      for (CeedInt i = 0; i < rstr->nelem*elemsize; i++)
+        catoffsets[i] = lsize + rstroffsets[i];
+      ierr = CeedElemRestrictionRestoreOffsets(rstr, &rstroffsets);
+      CeedChk(ierr);
+    }
+    start += rstr->nelem;
+    lsize += rstr->lsize;
+  }
+  ierr = CeedFree(&strides); CeedChk(ierr);
+  ierr = CeedElemRestrictionCreate(ceed, nelem, elemsize, ncomp, compstride,
+                                   lsize, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                   offsets, rstrcat); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Create a copy of a CeedElemRestriction on another Ceed
+
+  The L-vector layout is unchanged. Restrictions with backend strides are
+    created with the E-vector layout of @a rstr as user strides, so vectors
+    in that layout, such as quadrature data, can be copied to @a ceed as they
+    are. If @a rstr belongs to @a ceed or one of its delegates, @a rstr is
+    referenced instead.
+
+  @param rstr          CeedElemRestriction to copy
+  @param ceed          Ceed to create the new CeedElemRestriction on
+  @param[out] rstrnew  Address of the variable where the newly created
+                         CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionCreateOnCeed(CeedElemRestriction rstr, Ceed ceed,
+                                    CeedElemRestriction *rstrnew) {
+  int ierr;
+  const CeedInt nsides = CeedIntMax(rstr->nsides, 1);
+  Ceed parent, rstrparent;
+
+  ierr = CeedGetParent(ceed, &parent); CeedChk(ierr);
+  ierr = CeedGetParent(rstr->ceed, &rstrparent); CeedChk(ierr);
+  if (parent == rstrparent) {
+    ierr = CeedElemRestrictionAddReference(rstr); CeedChk(ierr);
+    *rstrnew = rstr;
+    return 0;
+  }
+  if (rstr->blksize > 1)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, 1, "Cannot copy a blocked ElemRestriction "
+                     "to another Ceed");
+  // LCOV_EXCL_STOP
+
+  if (rstr->strides) {
+    CeedInt strides[3];
+    bool backendstrides;
+    ierr = CeedElemRestrictionHasBackendStrides(rstr, &backendstrides);
+    CeedChk(ierr);
+    if (backendstrides) {
+      ierr = CeedElemRestrictionGetELayout(rstr, &strides); CeedChk(ierr);
+    } else {
+      ierr = CeedElemRestrictionGetStrides(rstr, &strides); CeedChk(ierr);
+    }
+    ierr = CeedElemRestrictionCreateStrided(ceed, rstr->nelem, rstr->elemsize,
+                                            rstr->ncomp, rstr->lsize, strides,
+                                            rstrnew); CeedChk(ierr);
+  } else if (rstr->eoffsets) {
+    ierr = CeedElemRestrictionCreateCompressed(ceed, rstr->nelem,
+           rstr->elemsize, rstr->ncomp, rstr->compstride, rstr->lsize,
+           rstr->eoffsets, rstr->stencil, rstrnew); CeedChk(ierr);
+  } else {
+    const CeedInt *offsets;
+    ierr = CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets);
+    CeedChk(ierr);
+    if (!offsets)
+      // LCOV_EXCL_START
+      return CeedError(rstr->ceed, 1, "Copying an ElemRestriction to another "
+                       "Ceed requires offsets in host memory");
+    // LCOV_EXCL_STOP
+    if (nsides > 1) {
+      ierr = CeedElemRestrictionCreateTwoSided(ceed, rstr->nelem,
+             rstr->elemsize, rstr->ncomp/nsides, rstr->compstride, rstr->lsize,
+             CEED_MEM_HOST, CEED_COPY_VALUES, offsets, rstrnew); CeedChk(ierr);
+    } else {
+      ierr = CeedElemRestrictionCreate(ceed, rstr->nelem, rstr->elemsize,
+                                       rstr->ncomp, rstr->compstride,
+                                       rstr->lsize, CEED_MEM_HOST,
+                                       CEED_COPY_VALUES, offsets, rstrnew);
+      CeedChk(ierr);
+    }
+    ierr = CeedElemRestrictionRestoreOffsets(rstr, &offsets); CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Restrict an L-vector to the E-vector cached by a CeedElemRestriction,
+           called under CeedLock()
+
+  @param rstr         CeedElemRestriction
+  @param lvec         Input L-vector
+  @param[out] evec    Variable to store the cached E-vector, or NULL
+  @param request      Request or @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionGetCachedEVector_Core(CeedElemRestriction rstr,
+    CeedVector lvec, CeedVector *evec, CeedRequest *request) {
+  int ierr;
+  uint64_t state;
+
+  *evec = NULL;
+  ierr = CeedVectorGetState(lvec, &state); CeedChk(ierr);
+  if (!rstr->cachedevec) {
+    ierr = CeedElemRestrictionCreateVector(rstr, NULL, &rstr->cachedevec);
+    CeedChk(ierr);
+    ierr = CeedVectorSetMemoryClass(rstr->cachedevec, CEED_MEMORY_EVECTOR);
+    CeedChk(ierr);
+  }
+  // Restrict unless the cached E-vector holds this state of the L-vector;
+  //   it is not overwritten while other callers read it
+  if (lvec != rstr->cachedlvec || state != rstr->cachedstate) {
+    if (rstr->numcachedreaders > 0)
+      return 0;
+    // The cached L-vector is referenced, so its address is not reused
+    if (lvec != rstr->cachedlvec) {
+      ierr = CeedVectorAddReference(lvec); CeedChk(ierr);
+      ierr = CeedVectorDestroy(&rstr->cachedlvec); CeedChk(ierr);
+      rstr->cachedlvec = lvec;
+    }
+    rstr->cachedstate = 0;
+    ierr = CeedElemRestrictionApply(rstr, CEED_NOTRANSPOSE, lvec,
+                                    rstr->cachedevec, request); CeedChk(ierr);
+    rstr->cachedstate = state;
+  }
+  rstr->numcachedreaders++;
+  *evec = rstr->cachedevec;
+  return 0;
+}
+
+/**
+  @brief Restrict an L-vector to an E-vector cached by the CeedElemRestriction
+
+  The restriction keeps the E-vector of the last L-vector it restricted
+    through this function, with the state of that L-vector. Operators sharing
+    the restriction for the same unchanged input reuse the E-vector instead of
+    restricting again. The E-vector must not be written and is read until
+    @ref CeedElemRestrictionRestoreCachedEVector(). While it is read, requests
+    for a different L-vector, or a different state, return NULL, and the
+    caller restricts into its own E-vector instead. The cache is updated under
+    @ref CeedLock(), so operators sharing the restriction may be applied from
+    several threads.
+
+  @param rstr         CeedElemRestriction
+  @param lvec         Input L-vector
+  @param[out] evec    Variable to store the cached E-vector, owned by @a rstr,
+                        or NULL if it is read for another input
+  @param request      Request or @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetCachedEVector(CeedElemRestriction rstr,
+                                        CeedVector lvec, CeedVector *evec,
+                                        CeedRequest *request) {
+  int ierr;
+
+  ierr = CeedLock(rstr->ceed); CeedChk(ierr);
+  int ierrget = CeedElemRestrictionGetCachedEVector_Core(rstr, lvec, evec,
+                request);
+  ierr = CeedUnlock(rstr->ceed); CeedChk(ierr);
+  CeedChk(ierrget);
+  return 0;
+}
+
+/**
+  @brief Stop reading an E-vector from CeedElemRestrictionGetCachedEVector()
+
+  @param rstr         CeedElemRestriction
+  @param evec         Address of the cached E-vector, zeroed when restored;
+                        nothing is done if it is NULL
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionRestoreCachedEVector(CeedElemRestriction rstr,
+    CeedVector *evec) {
+  int ierr;
+
+  if (!*evec)
+    return 0;
+  ierr = CeedLock(rstr->ceed); CeedChk(ierr);
+  rstr->numcachedreaders--;
+  *evec = NULL;
+  ierr = CeedUnlock(rstr->ceed); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Apply the transpose of a CeedElemRestriction, overwriting the output
+
+  Computes @a ru = R^T @a u instead of adding to @a ru. Backends implementing
+    this store the first contribution to each L-vector entry and add the
+    others, so @a ru is not zeroed first; otherwise @a ru is zeroed and the
+    transpose is added.
+
+  @param rstr    CeedElemRestriction
+  @param u       Input E-vector
+  @param ru      Output L-vector (of size @a lsize)
+  @param request Request or @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionApplyOverwrite(CeedElemRestriction rstr, CeedVector u,
+                                      CeedVector ru, CeedRequest *request) {
+  int ierr;
+
+  if (!rstr->ApplyOverwrite) {
+    ierr = CeedVectorSetValue(ru, 0.0); CeedChk(ierr);
+    return CeedElemRestrictionApply(rstr, CEED_TRANSPOSE, u, ru, request);
+  }
+
+  const CeedInt n = rstr->nblk * rstr->blksize * rstr->elemsize * rstr->ncomp;
+  if (n != u->length)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, 2, "Input vector size %d not compatible with "
+                     "element restriction (%d, %d)", u->length, rstr->lsize, n);
+  // LCOV_EXCL_STOP
+  if (rstr->lsize != ru->length)
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, 2, "Output vector size %d not compatible with "
+                     "element restriction (%d, %d)", ru->length, rstr->lsize,
+                     n);
+  // LCOV_EXCL_STOP
+  // Operations complete on return unless the backend provides a request
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
+  // Bytes moved: E-vector read and write, plus offsets
+  double start, bytes = (double)rstr->nelem*rstr->elemsize*
+                        (rstr->ncomp*2*sizeof(CeedScalar) +
+                         (rstr->strides ? 0 : sizeof(CeedInt)));
+  ierr = CeedProfileStart(rstr->ceed, CEED_PROFILE_RESTRICTION, &start);
+  CeedChk(ierr);
+  ierr = rstr->ApplyOverwrite(rstr, u, ru, request); CeedChk(ierr);
+  ierr = CeedProfileStop(rstr->ceed, CEED_PROFILE_RESTRICTION, start, bytes);
+  CeedChk(ierr);
+  return 0;
+}
+
 /// @}
 
 /// @cond DOXYGEN_SKIP
@@ -317,6 +1158,12 @@ int CeedElemRestrictionCreate(Ceed ceed, CeedInt nelem, CeedInt elemsize,
                               CeedElemRestriction *rstr) {
   int ierr;
 
+  if (mtype == CEED_MEM_UNIFIED)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "CEED_MEM_UNIFIED is only supported "
+                     "for CeedVector");
+  // LCOV_EXCL_STOP
+
   if (!ceed->ElemRestrictionCreate) {
     Ceed delegate;
     ierr = CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction");
@@ -335,7 +1182,7 @@ int CeedElemRestrictionCreate(Ceed ceed, CeedInt nelem, CeedInt elemsize,
 
   ierr = CeedCalloc(1, rstr); CeedChk(ierr);
   (*rstr)->ceed = ceed;
-  ceed->refcount++;
+  CeedReference(ceed);
   (*rstr)->refcount = 1;
   (*rstr)->nelem = nelem;
   (*rstr)->elemsize = elemsize;
@@ -355,27 +1202,103 @@ int CeedElemRestrictionCreate(Ceed ceed, CeedInt nelem, CeedInt elemsize,
   @param ceed       A Ceed object where the CeedElemRestriction will be created
   @param nelem      Number of elements described by the restriction
   @param elemsize   Size (number of "nodes") per element
-  @param ncomp      Number of field components per interpolation "node"
+  @param ncomp      Number of field components per interpolation "node"
+                      (1 for scalar fields)
+  @param lsize      The size of the L-vector. This vector may be larger than
+                      the elements and fields given by this restriction.
+  @param strides    Array for strides between [nodes, components, elements].
+                      Data for node i, component j, element k can be found in
+                      the L-vector at index
+                        i*strides[0] + j*strides[1] + k*strides[2].
+                      @a CEED_STRIDES_BACKEND may be used with vectors created
+                      by a Ceed backend.
+  @param rstr       Address of the variable where the newly created
+                      CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionCreateStrided(Ceed ceed, CeedInt nelem, CeedInt elemsize,
+                                     CeedInt ncomp, CeedInt lsize,
+                                     const CeedInt strides[3],
+                                     CeedElemRestriction *rstr) {
+  int ierr;
+
+  if (!ceed->ElemRestrictionCreate) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction");
+    CeedChk(ierr);
+
+    if (!delegate)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Backend does not support ElemRestrictionCreate");
+    // LCOV_EXCL_STOP
+
+    ierr = CeedElemRestrictionCreateStrided(delegate, nelem, elemsize, ncomp,
+                                            lsize, strides, rstr);
+    CeedChk(ierr);
+    return 0;
+  }
+
+  ierr = CeedCalloc(1, rstr); CeedChk(ierr);
+  (*rstr)->ceed = ceed;
+  CeedReference(ceed);
+  (*rstr)->refcount = 1;
+  (*rstr)->nelem = nelem;
+  (*rstr)->elemsize = elemsize;
+  (*rstr)->ncomp = ncomp;
+  (*rstr)->lsize = lsize;
+  (*rstr)->nblk = nelem;
+  (*rstr)->blksize = 1;
+  ierr = CeedMalloc(3, &(*rstr)->strides); CeedChk(ierr);
+  for (int i = 0; i<3; i++)
+    (*rstr)->strides[i] = strides[i];
+  ierr = ceed->ElemRestrictionCreate(CEED_MEM_HOST, CEED_OWN_POINTER, NULL,
+                                     *rstr);
+  CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Create a compressed CeedElemRestriction
+
+  A compressed restriction describes the offsets of each element by a single
+    base offset and a stencil of node offsets shared by all elements, as for
+    structured and extruded meshes. Backends that support compressed
+    restrictions compute the offsets during application instead of loading
+    them; other backends store the expanded offsets.
+
+  @param ceed       A Ceed object where the CeedElemRestriction will be created
+  @param nelem      Number of elements described by the restriction
+  @param elemsize   Size (number of "nodes") per element
+  @param ncomp      Number of field components per interpolation node
                       (1 for scalar fields)
-  @param lsize      The size of the L-vector. This vector may be larger than
-                      the elements and fields given by this restriction.
-  @param strides    Array for strides between [nodes, components, elements].
+  @param compstride Stride between components for the same L-vector "node".
                       Data for node i, component j, element k can be found in
                       the L-vector at index
-                        i*strides[0] + j*strides[1] + k*strides[2].
-                      @a CEED_STRIDES_BACKEND may be used with vectors created
-                      by a Ceed backend.
-  @param rstr       Address of the variable where the newly created
+                        eoffsets[k] + stencil[i] + j*compstride.
+  @param lsize      The size of the L-vector. This vector may be larger than
+                      the elements and fields given by this restriction.
+  @param eoffsets   Array of size @a nelem holding the base offset of each
+                      element
+  @param stencil    Array of size @a elemsize holding the offsets of the
+                      element nodes relative to the element base offset. All
+                      offsets eoffsets[k] + stencil[i] must be in the range
+                      [0, @a lsize - 1].
+  @param[out] rstr  Address of the variable where the newly created
                       CeedElemRestriction will be stored
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
-int CeedElemRestrictionCreateStrided(Ceed ceed, CeedInt nelem, CeedInt elemsize,
-                                     CeedInt ncomp, CeedInt lsize,
-                                     const CeedInt strides[3],
-                                     CeedElemRestriction *rstr) {
+int CeedElemRestrictionCreateCompressed(Ceed ceed, CeedInt nelem,
+                                        CeedInt elemsize, CeedInt ncomp,
+                                        CeedInt compstride, CeedInt lsize,
+                                        const CeedInt *eoffsets,
+                                        const CeedInt *stencil,
+                                        CeedElemRestriction *rstr) {
   int ierr;
 
   if (!ceed->ElemRestrictionCreate) {
@@ -388,28 +1311,38 @@ int CeedElemRestrictionCreateStrided(Ceed ceed, CeedInt nelem, CeedInt elemsize,
       return CeedError(ceed, 1, "Backend does not support ElemRestrictionCreate");
     // LCOV_EXCL_STOP
 
-    ierr = CeedElemRestrictionCreateStrided(delegate, nelem, elemsize, ncomp,
-                                            lsize, strides, rstr);
+    ierr = CeedElemRestrictionCreateCompressed(delegate, nelem, elemsize, ncomp,
+           compstride, lsize, eoffsets, stencil, rstr);
     CeedChk(ierr);
     return 0;
   }
 
   ierr = CeedCalloc(1, rstr); CeedChk(ierr);
   (*rstr)->ceed = ceed;
-  ceed->refcount++;
+  CeedReference(ceed);
   (*rstr)->refcount = 1;
   (*rstr)->nelem = nelem;
   (*rstr)->elemsize = elemsize;
   (*rstr)->ncomp = ncomp;
+  (*rstr)->compstride = compstride;
   (*rstr)->lsize = lsize;
   (*rstr)->nblk = nelem;
   (*rstr)->blksize = 1;
-  ierr = CeedMalloc(3, &(*rstr)->strides); CeedChk(ierr);
-  for (int i = 0; i<3; i++)
-    (*rstr)->strides[i] = strides[i];
-  ierr = ceed->ElemRestrictionCreate(CEED_MEM_HOST, CEED_OWN_POINTER, NULL,
-                                     *rstr);
+  ierr = CeedElemRestrictionSetCompressedOffsets(*rstr, eoffsets, stencil);
   CeedChk(ierr);
+  if (ceed->ElemRestrictionCreateCompressed) {
+    ierr = ceed->ElemRestrictionCreateCompressed(CEED_MEM_HOST,
+           CEED_COPY_VALUES, NULL, *rstr); CeedChk(ierr);
+  } else {
+    // Backend does not compute offsets, expand them
+    CeedInt *offsets;
+    ierr = CeedMalloc(nelem*elemsize, &offsets); CeedChk(ierr);
+    ierr = CeedExpandCompressedOffsets(eoffsets, stencil, offsets, nelem,
+                                       elemsize); CeedChk(ierr);
+    ierr = ceed->ElemRestrictionCreate(CEED_MEM_HOST, CEED_OWN_POINTER,
+                                       (const CeedInt *) offsets, *rstr);
+    CeedChk(ierr);
+  }
   return 0;
 }
 
@@ -455,6 +1388,12 @@ int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt nelem, CeedInt elemsize,
   CeedInt *blkoffsets;
   CeedInt nblk = (nelem / blksize) + !!(nelem % blksize);
 
+  if (mtype == CEED_MEM_UNIFIED)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "CEED_MEM_UNIFIED is only supported "
+                     "for CeedVector");
+  // LCOV_EXCL_STOP
+
   if (!ceed->ElemRestrictionCreateBlocked) {
     Ceed delegate;
     ierr = CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction");
@@ -481,7 +1420,7 @@ int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt nelem, CeedInt elemsize,
   CeedChk(ierr);
 
   (*rstr)->ceed = ceed;
-  ceed->refcount++;
+  CeedReference(ceed);
   (*rstr)->refcount = 1;
   (*rstr)->nelem = nelem;
   (*rstr)->elemsize = elemsize;
@@ -550,7 +1489,7 @@ int CeedElemRestrictionCreateBlockedStrided(Ceed ceed, CeedInt nelem,
   ierr = CeedCalloc(1, rstr); CeedChk(ierr);
 
   (*rstr)->ceed = ceed;
-  ceed->refcount++;
+  CeedReference(ceed);
   (*rstr)->refcount = 1;
   (*rstr)->nelem = nelem;
   (*rstr)->elemsize = elemsize;
@@ -567,6 +1506,438 @@ int CeedElemRestrictionCreateBlockedStrided(Ceed ceed, CeedInt nelem,
   return 0;
 }
 
+/**
+  @brief Create a blocked compressed CeedElemRestriction, typically only called
+           by backends
+
+  @param ceed       A Ceed object where the CeedElemRestriction will be created
+  @param nelem      Number of elements described by the restriction
+  @param elemsize   Size (number of "nodes") per element
+  @param blksize    Number of elements in a block
+  @param ncomp      Number of field components per interpolation node
+                      (1 for scalar fields)
+  @param compstride Stride between components for the same L-vector "node".
+                      Data for node i, component j, element k can be found in
+                      the L-vector at index
+                        eoffsets[k] + stencil[i] + j*compstride.
+  @param lsize      The size of the L-vector. This vector may be larger than
+                      the elements and fields given by this restriction.
+  @param eoffsets   Array of size @a nelem holding the base offset of each
+                      element
+  @param stencil    Array of size @a elemsize holding the offsets of the
+                      element nodes relative to the element base offset
+  @param[out] rstr  Address of the variable where the newly created
+                      CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionCreateBlockedCompressed(Ceed ceed, CeedInt nelem,
+    CeedInt elemsize, CeedInt blksize, CeedInt ncomp, CeedInt compstride,
+    CeedInt lsize, const CeedInt *eoffsets, const CeedInt *stencil,
+    CeedElemRestriction *rstr) {
+  int ierr;
+  CeedInt nblk = (nelem / blksize) + !!(nelem % blksize);
+
+  if (!ceed->ElemRestrictionCreateBlocked) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction");
+    CeedChk(ierr);
+
+    if (!delegate)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Backend does not support "
+                       "ElemRestrictionCreateBlocked");
+    // LCOV_EXCL_STOP
+
+    ierr = CeedElemRestrictionCreateBlockedCompressed(delegate, nelem, elemsize,
+           blksize, ncomp, compstride, lsize, eoffsets, stencil, rstr);
+    CeedChk(ierr);
+    return 0;
+  }
+
+  ierr = CeedCalloc(1, rstr); CeedChk(ierr);
+  (*rstr)->ceed = ceed;
+  CeedReference(ceed);
+  (*rstr)->refcount = 1;
+  (*rstr)->nelem = nelem;
+  (*rstr)->elemsize = elemsize;
+  (*rstr)->ncomp = ncomp;
+  (*rstr)->compstride = compstride;
+  (*rstr)->lsize = lsize;
+  (*rstr)->nblk = nblk;
+  (*rstr)->blksize = blksize;
+  ierr = CeedElemRestrictionSetCompressedOffsets(*rstr, eoffsets, stencil);
+  CeedChk(ierr);
+  if (ceed->ElemRestrictionCreateCompressed) {
+    ierr = ceed->ElemRestrictionCreateCompressed(CEED_MEM_HOST,
+           CEED_COPY_VALUES, NULL, *rstr); CeedChk(ierr);
+  } else {
+    // Backend does not compute offsets, expand and block them
+    CeedInt *offsets, *blkoffsets;
+    ierr = CeedMalloc(nelem*elemsize, &offsets); CeedChk(ierr);
+    ierr = CeedExpandCompressedOffsets(eoffsets, stencil, offsets, nelem,
+                                       elemsize); CeedChk(ierr);
+    ierr = CeedCalloc(nblk*blksize*elemsize, &blkoffsets); CeedChk(ierr);
+    ierr = CeedPermutePadOffsets(offsets, blkoffsets, nblk, nelem, blksize,
+                                 elemsize); CeedChk(ierr);
+    ierr = CeedFree(&offsets); CeedChk(ierr);
+    ierr = ceed->ElemRestrictionCreateBlocked(CEED_MEM_HOST, CEED_OWN_POINTER,
+           (const CeedInt *) blkoffsets, *rstr); CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Create a two-sided CeedElemRestriction for the faces between elements
+
+  Each face gathers the nodes of both neighboring elements in one pass, as
+    needed by the numerical fluxes of discontinuous Galerkin methods. The
+    restriction has @a nfaces elements of @a facesize nodes with 2*@a ncomp
+    components: components [0, @a ncomp) hold the trace of side 0 and
+    components [@a ncomp, 2*@a ncomp) the trace of side 1. A QFunction output
+    holding the contributions to both sides is thus scattered by a single
+    transpose application.
+
+  @param ceed       A Ceed object where the CeedElemRestriction will be created
+  @param nfaces     Number of faces described in the @a offsets array
+  @param facesize   Size (number of "nodes") per face and side
+  @param ncomp      Number of field components per interpolation node on each
+                      side (1 for scalar fields)
+  @param compstride Stride between components for the same L-vector "node".
+                      Data for node i, component j, side s, face k can be
+                      found in the L-vector at index
+                        offsets[i + (2*k + s)*facesize] + j*compstride.
+  @param lsize      The size of the L-vector. This vector may be larger than
+                      the elements and fields given by this restriction.
+  @param mtype      Memory type of the @a offsets array, see CeedMemType
+  @param cmode      Copy mode for the @a offsets array, see CeedCopyMode
+  @param offsets    Array of shape [@a nfaces, 2, @a facesize]. Row k holds
+                      the ordered offsets of the face nodes in the element on
+                      side 0 of face k, followed by those in the element on
+                      side 1. All offsets must be in the range
+                      [0, @a lsize - 1].
+  @param[out] rstr  Address of the variable where the newly created
+                      CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionCreateTwoSided(Ceed ceed, CeedInt nfaces,
+                                      CeedInt facesize, CeedInt ncomp,
+                                      CeedInt compstride, CeedInt lsize,
+                                      CeedMemType mtype, CeedCopyMode cmode,
+                                      const CeedInt *offsets,
+                                      CeedElemRestriction *rstr) {
+  int ierr;
+
+  if (mtype == CEED_MEM_UNIFIED)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "CEED_MEM_UNIFIED is only supported "
+                     "for CeedVector");
+  // LCOV_EXCL_STOP
+
+  if (!ceed->ElemRestrictionCreate) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction");
+    CeedChk(ierr);
+
+    if (!delegate)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Backend does not support ElemRestrictionCreate");
+    // LCOV_EXCL_STOP
+
+    ierr = CeedElemRestrictionCreateTwoSided(delegate, nfaces, facesize, ncomp,
+           compstride, lsize, mtype, cmode, offsets, rstr); CeedChk(ierr);
+    return 0;
+  }
+
+  ierr = CeedCalloc(1, rstr); CeedChk(ierr);
+  (*rstr)->ceed = ceed;
+  CeedReference(ceed);
+  (*rstr)->refcount = 1;
+  (*rstr)->nelem = nfaces;
+  (*rstr)->elemsize = facesize;
+  (*rstr)->ncomp = 2*ncomp;
+  (*rstr)->compstride = compstride;
+  (*rstr)->lsize = lsize;
+  (*rstr)->nblk = nfaces;
+  (*rstr)->blksize = 1;
+  (*rstr)->nsides = 2;
+  ierr = ceed->ElemRestrictionCreate(mtype, cmode, offsets, *rstr);
+  CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Create a blocked two-sided CeedElemRestriction, typically only called
+           by backends
+
+  @param ceed       A Ceed object where the CeedElemRestriction will be created
+  @param nfaces     Number of faces described in the @a offsets array
+  @param facesize   Size (number of "nodes") per face and side
+  @param blksize    Number of faces in a block
+  @param ncomp      Number of field components per interpolation node on each
+                      side (1 for scalar fields)
+  @param compstride Stride between components for the same L-vector "node"
+  @param lsize      The size of the L-vector. This vector may be larger than
+                      the elements and fields given by this restriction.
+  @param mtype      Memory type of the @a offsets array, see CeedMemType
+  @param cmode      Copy mode for the @a offsets array, see CeedCopyMode
+  @param offsets    Array of shape [@a nfaces, 2, @a facesize], see
+                      @ref CeedElemRestrictionCreateTwoSided(). The backend
+                      will permute and pad this array to blocks of shape
+                      [2, @a facesize, @a blksize].
+  @param[out] rstr  Address of the variable where the newly created
+                      CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionCreateBlockedTwoSided(Ceed ceed, CeedInt nfaces,
+    CeedInt facesize, CeedInt blksize, CeedInt ncomp, CeedInt compstride,
+    CeedInt lsize, CeedMemType mtype, CeedCopyMode cmode,
+    const CeedInt *offsets, CeedElemRestriction *rstr) {
+  int ierr;
+  CeedInt *blkoffsets;
+  CeedInt nblk = (nfaces / blksize) + !!(nfaces % blksize);
+
+  if (mtype == CEED_MEM_UNIFIED)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "CEED_MEM_UNIFIED is only supported "
+                     "for CeedVector");
+  // LCOV_EXCL_STOP
+
+  if (!ceed->ElemRestrictionCreateBlocked) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction");
+    CeedChk(ierr);
+
+    if (!delegate)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Backend does not support "
+                       "ElemRestrictionCreateBlocked");
+    // LCOV_EXCL_STOP
+
+    ierr = CeedElemRestrictionCreateBlockedTwoSided(delegate, nfaces, facesize,
+           blksize, ncomp, compstride, lsize, mtype, cmode, offsets, rstr);
+    CeedChk(ierr);
+    return 0;
+  }
+
+  ierr = CeedCalloc(1, rstr); CeedChk(ierr);
+
+  // Both sides of a face are permuted together
+  ierr = CeedCalloc(nblk*blksize*2*facesize, &blkoffsets); CeedChk(ierr);
+  ierr = CeedPermutePadOffsets(offsets, blkoffsets, nblk, nfaces, blksize,
+                               2*facesize); CeedChk(ierr);
+
+  (*rstr)->ceed = ceed;
+  CeedReference(ceed);
+  (*rstr)->refcount = 1;
+  (*rstr)->nelem = nfaces;
+  (*rstr)->elemsize = facesize;
+  (*rstr)->ncomp = 2*ncomp;
+  (*rstr)->compstride = compstride;
+  (*rstr)->lsize = lsize;
+  (*rstr)->nblk = nblk;
+  (*rstr)->blksize = blksize;
+  (*rstr)->nsides = 2;
+  ierr = ceed->ElemRestrictionCreateBlocked(CEED_MEM_HOST, CEED_OWN_POINTER,
+         (const CeedInt *) blkoffsets, *rstr); CeedChk(ierr);
+
+  if (cmode == CEED_OWN_POINTER) {
+    ierr = CeedFree(&offsets); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+/**
+  @brief Create a CeedElemRestriction sharing the offsets of another one with
+           a different number of components
+
+  The view reads the same element offsets as @a rstr, without copying them, so
+    a scalar restriction and a vector restriction for the same mesh store the
+    offsets, and on GPU backends the transpose tables, only once. The view
+    keeps a reference to @a rstr.
+
+  @param rstr        CeedElemRestriction with the element offsets
+  @param ncomp       Number of field components per interpolation node
+  @param compstride  Stride between components of the view in the L-vector
+  @param lsize       The size of the L-vector of the view
+  @param[out] view   Address of the variable where the newly created
+                       CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionCreateView(CeedElemRestriction rstr, CeedInt ncomp,
+                                  CeedInt compstride, CeedInt lsize,
+                                  CeedElemRestriction *view) {
+  int ierr;
+  Ceed ceed = rstr->ceed;
+
+  if (rstr->strides || rstr->blksize > 1 || rstr->nsides > 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Views are only supported for unblocked "
+                     "one-sided restrictions with offsets");
+  // LCOV_EXCL_STOP
+
+  // Compressed offsets are small, the view expands its own copy
+  if (rstr->eoffsets) {
+    ierr = CeedElemRestrictionCreateCompressed(ceed, rstr->nelem,
+           rstr->elemsize, ncomp, compstride, lsize, rstr->eoffsets,
+           rstr->stencil, view); CeedChk(ierr);
+    return 0;
+  }
+
+  CeedMemType mtype;
+  const CeedInt *offsets;
+  ierr = CeedGetPreferredMemType(ceed, &mtype); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetOffsets(rstr, mtype, &offsets); CeedChk(ierr);
+  ierr = CeedCalloc(1, view); CeedChk(ierr);
+  (*view)->ceed = ceed;
+  CeedReference(ceed);
+  (*view)->refcount = 1;
+  (*view)->nelem = rstr->nelem;
+  (*view)->elemsize = rstr->elemsize;
+  (*view)->ncomp = ncomp;
+  (*view)->compstride = compstride;
+  (*view)->lsize = lsize;
+  (*view)->nblk = rstr->nelem;
+  (*view)->blksize = 1;
+  (*view)->viewof = rstr;
+  CeedReference(rstr);
+  ierr = ceed->ElemRestrictionCreate(mtype, CEED_USE_POINTER, offsets, *view);
+  CeedChk(ierr);
+  ierr = CeedElemRestrictionRestoreOffsets(rstr, &offsets); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Create a batch of CeedElemRestrictions over one array of offsets
+
+  The offsets of all restrictions are stored, and on GPU backends uploaded to
+    the device, once; each restriction reads its own range of the array, so
+    many small restrictions, such as one per boundary face label and element
+    topology, avoid an allocation and a transfer each. The restrictions keep a
+    reference to the shared offsets, which are freed with the last of them.
+
+  @param ceed       A Ceed object where the CeedElemRestrictions will be created
+  @param nrstr      Number of CeedElemRestrictions to create
+  @param nelem      Array of size @a nrstr with the number of elements of each
+                      restriction
+  @param elemsize   Array of size @a nrstr with the element size of each
+                      restriction
+  @param ncomp      Number of field components per interpolation node
+                      (1 for scalar fields)
+  @param compstride Stride between components for the same L-vector "node"
+  @param lsize      The size of the L-vector
+  @param mtype      Memory type of the @a offsets array, see CeedMemType
+  @param cmode      Copy mode for the @a offsets array, see CeedCopyMode
+  @param offsets    Array holding, restriction after restriction, the
+                      @a nelem[i]*@a elemsize[i] offsets of each restriction,
+                      ordered as in @ref CeedElemRestrictionCreate()
+  @param[out] rstrs Array of size @a nrstr where the newly created
+                      CeedElemRestrictions will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionCreateBatch(Ceed ceed, CeedInt nrstr,
+                                   const CeedInt *nelem,
+                                   const CeedInt *elemsize, CeedInt ncomp,
+                                   CeedInt compstride, CeedInt lsize,
+                                   CeedMemType mtype, CeedCopyMode cmode,
+                                   const CeedInt *offsets,
+                                   CeedElemRestriction *rstrs) {
+  int ierr;
+  CeedInt size = 0;
+  CeedElemRestriction all;
+
+  // One restriction with one node per element owns the offsets
+  for (CeedInt i = 0; i < nrstr; i++)
+    size += nelem[i]*elemsize[i];
+  ierr = CeedElemRestrictionCreate(ceed, size, 1, ncomp, compstride, lsize,
+                                   mtype, cmode, offsets, &all); CeedChk(ierr);
+  ceed = all->ceed;
+
+  CeedMemType pmtype;
+  const CeedInt *alloffsets;
+  ierr = CeedGetPreferredMemType(ceed, &pmtype); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetOffsets(all, pmtype, &alloffsets);
+  CeedChk(ierr);
+  for (CeedInt i = 0, start = 0; i < nrstr; i++) {
+    ierr = CeedCalloc(1, &rstrs[i]); CeedChk(ierr);
+    rstrs[i]->ceed = ceed;
+    CeedReference(ceed);
+    rstrs[i]->refcount = 1;
+    rstrs[i]->nelem = nelem[i];
+    rstrs[i]->elemsize = elemsize[i];
+    rstrs[i]->ncomp = ncomp;
+    rstrs[i]->compstride = compstride;
+    rstrs[i]->lsize = lsize;
+    rstrs[i]->nblk = nelem[i];
+    rstrs[i]->blksize = 1;
+    rstrs[i]->viewof = all;
+    CeedReference(all);
+    ierr = ceed->ElemRestrictionCreate(pmtype, CEED_USE_POINTER,
+                                       alloffsets + start, rstrs[i]);
+    CeedChk(ierr);
+    start += nelem[i]*elemsize[i];
+  }
+  ierr = CeedElemRestrictionRestoreOffsets(all, &alloffsets); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&all); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Set the integer type of the offsets a CeedElemRestriction reads when
+           applied
+
+  With @ref CEED_INDEX_INT16, backends that support it store the offsets of
+    each block of elements as 16-bit differences from the smallest offset of
+    the block, halving the index traffic of the restriction. The offsets
+    returned by @ref CeedElemRestrictionGetOffsets() are not affected, and
+    backends without support keep reading CeedInt offsets.
+
+  @param rstr   CeedElemRestriction with offsets
+  @param itype  CeedIndexType of the offsets
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionSetIndexType(CeedElemRestriction rstr,
+                                    CeedIndexType itype) {
+  int ierr;
+  bool fits;
+
+  if (itype != CEED_INDEX_INT32 && (rstr->strides || rstr->eoffsets ||
+                                    rstr->nsides > 1))
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, 1, "Index type %s requires a one-sided "
+                     "restriction with offsets", CeedIndexTypes[itype]);
+  // LCOV_EXCL_STOP
+  ierr = CeedElemRestrictionCheckIndexType(rstr, itype, &fits); CeedChk(ierr);
+  if (!fits)
+    return CeedError(rstr->ceed, 1, "Restriction offsets of a block of "
+                     "elements span too many nodes for index type %s",
+                     CeedIndexTypes[itype]);
+
+  if (rstr->SetIndexType) {
+    ierr = rstr->SetIndexType(rstr, itype); CeedChk(ierr);
+  }
+  rstr->indextype = itype;
+  return 0;
+}
+
 /**
   @brief Create CeedVectors associated with a CeedElemRestriction
 
@@ -631,7 +2002,18 @@ int CeedElemRestrictionApply(CeedElemRestriction rstr, CeedTransposeMode tmode,
     return CeedError(rstr->ceed, 2, "Output vector size %d not compatible with "
                      "element restriction (%d, %d)", ru->length, m, n);
   // LCOV_EXCL_STOP
+  // Operations complete on return unless the backend provides a request
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
+  // Bytes moved: E-vector read and write, plus offsets
+  double start, bytes = (double)rstr->nelem*rstr->elemsize*
+                        (rstr->ncomp*2*sizeof(CeedScalar) +
+                         (rstr->strides ? 0 : sizeof(CeedInt)));
+  ierr = CeedProfileStart(rstr->ceed, CEED_PROFILE_RESTRICTION, &start);
+  CeedChk(ierr);
   ierr = rstr->Apply(rstr, tmode, u, ru, request); CeedChk(ierr);
+  ierr = CeedProfileStop(rstr->ceed, CEED_PROFILE_RESTRICTION, start, bytes);
+  CeedChk(ierr);
 
   return 0;
 }
@@ -683,8 +2065,19 @@ int CeedElemRestrictionApplyBlock(CeedElemRestriction rstr, CeedInt block,
                      "total elements %d", block, rstr->blksize*block,
                      rstr->nelem);
   // LCOV_EXCL_STOP
+  // Operations complete on return unless the backend provides a request
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
+  // Bytes moved: E-vector block read and write, plus offsets
+  double start, bytes = (double)rstr->blksize*rstr->elemsize*
+                        (rstr->ncomp*2*sizeof(CeedScalar) +
+                         (rstr->strides ? 0 : sizeof(CeedInt)));
+  ierr = CeedProfileStart(rstr->ceed, CEED_PROFILE_RESTRICTION, &start);
+  CeedChk(ierr);
   ierr = rstr->ApplyBlock(rstr, block, tmode, u, ru, request);
   CeedChk(ierr);
+  ierr = CeedProfileStop(rstr->ceed, CEED_PROFILE_RESTRICTION, start, bytes);
+  CeedChk(ierr);
 
   return 0;
 }
@@ -805,6 +2198,12 @@ int CeedElemRestrictionGetBlockSize(CeedElemRestriction rstr,
 /**
   @brief Get the multiplicity of nodes in a CeedElemRestriction
 
+  The multiplicity is computed on the first call, by the backend when it
+    provides it, such as from the transpose tables of the CUDA and HIP
+    backends, and otherwise by the transpose restriction of an E-vector of
+    ones. It is cached on @a rstr, so later calls only copy it into @a mult,
+    on the device for device backends.
+
   @param rstr             CeedElemRestriction
   @param[out] mult        Vector to store multiplicity (of size lsize)
 
@@ -815,20 +2214,48 @@ int CeedElemRestrictionGetBlockSize(CeedElemRestriction rstr,
 int CeedElemRestrictionGetMultiplicity(CeedElemRestriction rstr,
                                        CeedVector mult) {
   int ierr;
-  CeedVector evec;
 
-  // Create and set evec
-  ierr = CeedElemRestrictionCreateVector(rstr, NULL, &evec); CeedChk(ierr);
-  ierr = CeedVectorSetValue(evec, 1.0); CeedChk(ierr);
-  ierr = CeedVectorSetValue(mult, 0.0); CeedChk(ierr);
+  if (!rstr->mult) {
+    CeedVector rmult;
+    ierr = CeedElemRestrictionCreateVector(rstr, &rmult, NULL); CeedChk(ierr);
+    if (rstr->GetMultiplicity) {
+      ierr = rstr->GetMultiplicity(rstr, rmult); CeedChk(ierr);
+    } else {
+      CeedVector evec;
+
+      // Create and set evec
+      ierr = CeedElemRestrictionCreateVector(rstr, NULL, &evec); CeedChk(ierr);
+      ierr = CeedVectorSetValue(evec, 1.0); CeedChk(ierr);
+      ierr = CeedVectorSetValue(rmult, 0.0); CeedChk(ierr);
+
+      // Apply to get multiplicity
+      ierr = CeedElemRestrictionApply(rstr, CEED_TRANSPOSE, evec, rmult,
+                                      CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+
+      // Cleanup
+      ierr = CeedVectorDestroy(&evec); CeedChk(ierr);
+    }
+    rstr->mult = rmult;
+  }
+  ierr = CeedVectorCopy(rstr->mult, mult); CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Get the memory allocated for the offsets of a CeedElemRestriction
 
-  // Apply to get multiplicity
-  ierr = CeedElemRestrictionApply(rstr, CEED_TRANSPOSE, evec, mult,
-                                  CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+  @param rstr        CeedElemRestriction to retrieve memory usage
+  @param space       CeedMemSpace to get the usage of
+  @param[out] bytes  Variable to store the number of bytes allocated
 
-  // Cleanup
-  ierr = CeedVectorDestroy(&evec); CeedChk(ierr);
+  @return An error code: 0 - success, otherwise - failure
 
+  @ref User
+**/
+int CeedElemRestrictionGetMemoryUsage(CeedElemRestriction rstr,
+                                      CeedMemSpace space, size_t *bytes) {
+  *bytes = rstr->memusage[space];
   return 0;
 }
 
@@ -850,8 +2277,10 @@ int CeedElemRestrictionView(CeedElemRestriction rstr, FILE *stream) {
   else
     sprintf(stridesstr, "%d", rstr->compstride);
 
-  fprintf(stream, "%sCeedElemRestriction from (%d, %d) to %d elements with %d "
-          "nodes each and %s %s\n", rstr->blksize > 1 ? "Blocked " : "",
+  fprintf(stream, "%s%s%sCeedElemRestriction from (%d, %d) to %d elements "
+          "with %d nodes each and %s %s\n", rstr->blksize > 1 ? "Blocked " : "",
+          rstr->eoffsets ? "Compressed " : "",
+          rstr->nsides > 1 ? "Two-sided " : "",
           rstr->lsize, rstr->ncomp, rstr->nelem, rstr->elemsize,
           rstr->strides ? "strides" : "component stride", stridesstr);
   return 0;
@@ -869,14 +2298,24 @@ int CeedElemRestrictionView(CeedElemRestriction rstr, FILE *stream) {
 int CeedElemRestrictionDestroy(CeedElemRestriction *rstr) {
   int ierr;
 
-  if (!*rstr || --(*rstr)->refcount > 0) return 0;
+  if (!*rstr || CeedDereference(*rstr) > 0) return 0;
   if ((*rstr)->numreaders)
     return CeedError((*rstr)->ceed, 1, "Cannot destroy CeedElemRestriction, "
                      "a process has read access to the offset data");
   if ((*rstr)->Destroy) {
     ierr = (*rstr)->Destroy(*rstr); CeedChk(ierr);
   }
+  for (CeedInt s=0; s<CEED_MEMSPACE_NUM; s++) {
+    const ptrdiff_t bytes = (*rstr)->memusage[s];
+    ierr = CeedElemRestrictionTrackMemory(*rstr, s, -bytes); CeedChk(ierr);
+  }
   ierr = CeedFree(&(*rstr)->strides); CeedChk(ierr);
+  ierr = CeedFree(&(*rstr)->eoffsets); CeedChk(ierr);
+  ierr = CeedFree(&(*rstr)->stencil); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*rstr)->cachedevec); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*rstr)->cachedlvec); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*rstr)->mult); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&(*rstr)->viewof); CeedChk(ierr);
   ierr = CeedDestroy(&(*rstr)->ceed); CeedChk(ierr);
   ierr = CeedFree(rstr); CeedChk(ierr);
   return 0;
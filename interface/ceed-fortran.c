@@ -32,10 +32,42 @@
 #define FORTRAN_BASIS_COLLOCATED -8
 #define FORTRAN_QFUNCTION_NONE -9
 
-static Ceed *Ceed_dict = NULL;
-static int Ceed_count = 0;
-static int Ceed_n = 0;
-static int Ceed_count_max = 0;
+// Handle tables map the integer handles seen from Fortran to libCEED objects.
+//   Translating a handle is a single array access. Destroyed handles go on a
+//   free list and are handed out again by the next create, so the tables stay
+//   as large as the number of live objects however many are created.
+//
+// type##_Next() returns the slot the next object is created in, and
+//   type##_Add() claims it once creation succeeds; type##_Remove() releases
+//   a handle and frees the table with the last live object.
+#define FORTRAN_HANDLE_TABLE(type)                                      \
+  static type *type##_dict = NULL;                                      \
+  static int *type##_free = NULL;                                       \
+  static int type##_count = 0, type##_count_max = 0;                    \
+  static int type##_n = 0, type##_nfree = 0;                            \
+  static inline type *type##_Next(void) {                               \
+    if (type##_nfree) return &type##_dict[type##_free[type##_nfree-1]]; \
+    if (type##_count == type##_count_max) {                             \
+      type##_count_max += type##_count_max/2 + 1;                       \
+      CeedRealloc(type##_count_max, &type##_dict);                      \
+      CeedRealloc(type##_count_max, &type##_free);                      \
+    }                                                                   \
+    return &type##_dict[type##_count];                                  \
+  }                                                                     \
+  static inline int type##_Add(void) {                                  \
+    type##_n++;                                                         \
+    return type##_nfree ? type##_free[--type##_nfree] : type##_count++; \
+  }                                                                     \
+  static inline void type##_Remove(int handle) {                        \
+    type##_free[type##_nfree++] = handle;                               \
+    if (--type##_n == 0) {                                              \
+      CeedFree(&type##_dict);                                           \
+      CeedFree(&type##_free);                                           \
+      type##_count = type##_count_max = type##_nfree = 0;               \
+    }                                                                   \
+  }
+
+FORTRAN_HANDLE_TABLE(Ceed)
 
 // This test should actually be for the gfortran version, but we don't currently
 // have a configure system to determine that (TODO).  At present, this will use
@@ -72,17 +104,11 @@ typedef int fortran_charlen_t;
 void fCeedInit(const char *resource, int *ceed, int *err,
                fortran_charlen_t resource_len) {
   FIX_STRING(resource);
-  if (Ceed_count == Ceed_count_max) {
-    Ceed_count_max += Ceed_count_max/2 + 1;
-    CeedRealloc(Ceed_count_max, &Ceed_dict);
-  }
-
-  Ceed *ceed_ = &Ceed_dict[Ceed_count];
+  Ceed *ceed_ = Ceed_Next();
   *err = CeedInit(resource_c, ceed_);
 
   if (*err == 0) {
-    *ceed = Ceed_count++;
-    Ceed_n++;
+    *ceed = Ceed_Add();
   }
 }
 
@@ -109,37 +135,23 @@ void fCeedDestroy(int *ceed, int *err) {
   *err = CeedDestroy(&Ceed_dict[*ceed]);
 
   if (*err == 0) {
+    Ceed_Remove(*ceed);
     *ceed = FORTRAN_NULL;
-    Ceed_n--;
-    if (Ceed_n == 0) {
-      CeedFree(&Ceed_dict);
-      Ceed_count = 0;
-      Ceed_count_max = 0;
-    }
   }
 }
 
 // -----------------------------------------------------------------------------
 // CeedVector
 // -----------------------------------------------------------------------------
-static CeedVector *CeedVector_dict = NULL;
-static int CeedVector_count = 0;
-static int CeedVector_n = 0;
-static int CeedVector_count_max = 0;
+FORTRAN_HANDLE_TABLE(CeedVector)
 
 #define fCeedVectorCreate FORTRAN_NAME(ceedvectorcreate,CEEDVECTORCREATE)
 void fCeedVectorCreate(int *ceed, int *length, int *vec, int *err) {
-  if (CeedVector_count == CeedVector_count_max) {
-    CeedVector_count_max += CeedVector_count_max/2 + 1;
-    CeedRealloc(CeedVector_count_max, &CeedVector_dict);
-  }
-
-  CeedVector *vec_ = &CeedVector_dict[CeedVector_count];
+  CeedVector *vec_ = CeedVector_Next();
   *err = CeedVectorCreate(Ceed_dict[*ceed], *length, vec_);
 
   if (*err == 0) {
-    *vec = CeedVector_count++;
-    CeedVector_n++;
+    *vec = CeedVector_Add();
   }
 }
 
@@ -160,6 +172,25 @@ void fCeedVectorTakeArray(int *vec, int *memtype, CeedScalar *array,
   *offset = b - array;
 }
 
+// The array of these two takes a C pointer value rather than a Fortran array,
+//   e.g. a type(c_ptr) from c_loc or a CUDA Fortran type(c_devptr), so device
+//   arrays can be passed with CEED_MEM_DEVICE
+#define fCeedVectorSetArrayPointer \
+    FORTRAN_NAME(ceedvectorsetarraypointer,CEEDVECTORSETARRAYPOINTER)
+void fCeedVectorSetArrayPointer(int *vec, int *memtype, int *copymode,
+                                CeedScalar **array, int *err) {
+  *err = CeedVectorSetArray(CeedVector_dict[*vec], (CeedMemType)*memtype,
+                            (CeedCopyMode)*copymode, *array);
+}
+
+#define fCeedVectorTakeArrayPointer \
+    FORTRAN_NAME(ceedvectortakearraypointer,CEEDVECTORTAKEARRAYPOINTER)
+void fCeedVectorTakeArrayPointer(int *vec, int *memtype, CeedScalar **array,
+                                 int *err) {
+  *err = CeedVectorTakeArray(CeedVector_dict[*vec], (CeedMemType)*memtype,
+                             array);
+}
+
 #define fCeedVectorSyncArray FORTRAN_NAME(ceedvectorsyncarray,CEEDVECTORSYNCARRAY)
 void fCeedVectorSyncArray(int *vec, int *memtype, int *err) {
   *err = CeedVectorSyncArray(CeedVector_dict[*vec], (CeedMemType)*memtype);
@@ -218,6 +249,12 @@ void fCeedVectorReciprocal(int *vec, int *err) {
   *err = CeedVectorReciprocal(CeedVector_dict[*vec]);
 }
 
+#define fCeedVectorPointBlockInvert \
+    FORTRAN_NAME(ceedvectorpointblockinvert,CEEDVECTORPOINTBLOCKINVERT)
+void fCeedVectorPointBlockInvert(int *vec, int *bsize, int *err) {
+  *err = CeedVectorPointBlockInvert(CeedVector_dict[*vec], *bsize);
+}
+
 #define fCeedVectorView FORTRAN_NAME(ceedvectorview,CEEDVECTORVIEW)
 void fCeedVectorView(int *vec, int *err) {
   *err = CeedVectorView(CeedVector_dict[*vec], "%12.8f", stdout);
@@ -229,23 +266,15 @@ void fCeedVectorDestroy(int *vec, int *err) {
   *err = CeedVectorDestroy(&CeedVector_dict[*vec]);
 
   if (*err == 0) {
+    CeedVector_Remove(*vec);
     *vec = FORTRAN_NULL;
-    CeedVector_n--;
-    if (CeedVector_n == 0) {
-      CeedFree(&CeedVector_dict);
-      CeedVector_count = 0;
-      CeedVector_count_max = 0;
-    }
   }
 }
 
 // -----------------------------------------------------------------------------
 // CeedElemRestriction
 // -----------------------------------------------------------------------------
-static CeedElemRestriction *CeedElemRestriction_dict = NULL;
-static int CeedElemRestriction_count = 0;
-static int CeedElemRestriction_n = 0;
-static int CeedElemRestriction_count_max = 0;
+FORTRAN_HANDLE_TABLE(CeedElemRestriction)
 
 #define fCeedElemRestrictionCreate \
     FORTRAN_NAME(ceedelemrestrictioncreate, CEEDELEMRESTRICTIONCREATE)
@@ -253,15 +282,10 @@ void fCeedElemRestrictionCreate(int *ceed, int *nelements, int *esize,
                                 int *ncomp, int *compstride, int *lsize,
                                 int *memtype, int *copymode, const int *offsets,
                                 int *elemrestriction, int *err) {
-  if (CeedElemRestriction_count == CeedElemRestriction_count_max) {
-    CeedElemRestriction_count_max += CeedElemRestriction_count_max/2 + 1;
-    CeedRealloc(CeedElemRestriction_count_max, &CeedElemRestriction_dict);
-  }
-
   const int *offsets_ = offsets;
 
   CeedElemRestriction *elemrestriction_ =
-    &CeedElemRestriction_dict[CeedElemRestriction_count];
+    CeedElemRestriction_Next();
   *err = CeedElemRestrictionCreate(Ceed_dict[*ceed], *nelements, *esize,
                                    *ncomp, *compstride, *lsize,
                                    (CeedMemType)*memtype,
@@ -269,8 +293,7 @@ void fCeedElemRestrictionCreate(int *ceed, int *nelements, int *esize,
                                    elemrestriction_);
 
   if (*err == 0) {
-    *elemrestriction = CeedElemRestriction_count++;
-    CeedElemRestriction_n++;
+    *elemrestriction = CeedElemRestriction_Add();
   }
 }
 
@@ -279,21 +302,15 @@ void fCeedElemRestrictionCreate(int *ceed, int *nelements, int *esize,
 void fCeedElemRestrictionCreateStrided(int *ceed, int *nelements, int *esize,
                                        int *ncomp, int *lsize, int *strides,
                                        int *elemrestriction, int *err) {
-  if (CeedElemRestriction_count == CeedElemRestriction_count_max) {
-    CeedElemRestriction_count_max += CeedElemRestriction_count_max/2 + 1;
-    CeedRealloc(CeedElemRestriction_count_max, &CeedElemRestriction_dict);
-  }
-
   CeedElemRestriction *elemrestriction_ =
-    &CeedElemRestriction_dict[CeedElemRestriction_count];
+    CeedElemRestriction_Next();
   *err = CeedElemRestrictionCreateStrided(Ceed_dict[*ceed], *nelements, *esize,
                                           *ncomp, *lsize,
                                           *strides == FORTRAN_STRIDES_BACKEND ?
                                           CEED_STRIDES_BACKEND : strides,
                                           elemrestriction_);
   if (*err == 0) {
-    *elemrestriction = CeedElemRestriction_count++;
-    CeedElemRestriction_n++;
+    *elemrestriction = CeedElemRestriction_Add();
   }
 }
 
@@ -306,13 +323,8 @@ void fCeedElemRestrictionCreateBlocked(int *ceed, int *nelements, int *esize,
                                        int *blkindices, int *elemrestriction,
                                        int *err) {
 
-  if (CeedElemRestriction_count == CeedElemRestriction_count_max) {
-    CeedElemRestriction_count_max += CeedElemRestriction_count_max/2 + 1;
-    CeedRealloc(CeedElemRestriction_count_max, &CeedElemRestriction_dict);
-  }
-
   CeedElemRestriction *elemrestriction_ =
-    &CeedElemRestriction_dict[CeedElemRestriction_count];
+    CeedElemRestriction_Next();
   *err = CeedElemRestrictionCreateBlocked(Ceed_dict[*ceed],
                                           *nelements, *esize, *blocksize,
                                           *ncomp, *compstride, *lsize,
@@ -321,8 +333,7 @@ void fCeedElemRestrictionCreateBlocked(int *ceed, int *nelements, int *esize,
                                           elemrestriction_);
 
   if (*err == 0) {
-    *elemrestriction = CeedElemRestriction_count++;
-    CeedElemRestriction_n++;
+    *elemrestriction = CeedElemRestriction_Add();
   }
 }
 
@@ -331,25 +342,16 @@ void fCeedElemRestrictionCreateBlocked(int *ceed, int *nelements, int *esize,
 void fCeedElemRestrictionCreateBlockedStrided(int *ceed, int *nelements,
     int *esize, int *blksize, int *ncomp, int *lsize, int *strides,
     int *elemrestriction, int *err) {
-  if (CeedElemRestriction_count == CeedElemRestriction_count_max) {
-    CeedElemRestriction_count_max += CeedElemRestriction_count_max/2 + 1;
-    CeedRealloc(CeedElemRestriction_count_max, &CeedElemRestriction_dict);
-  }
-
   CeedElemRestriction *elemrestriction_ =
-    &CeedElemRestriction_dict[CeedElemRestriction_count];
+    CeedElemRestriction_Next();
   *err = CeedElemRestrictionCreateBlockedStrided(Ceed_dict[*ceed], *nelements,
          *esize, *blksize, *ncomp, *lsize, strides, elemrestriction_);
   if (*err == 0) {
-    *elemrestriction = CeedElemRestriction_count++;
-    CeedElemRestriction_n++;
+    *elemrestriction = CeedElemRestriction_Add();
   }
 }
 
-static CeedRequest *CeedRequest_dict = NULL;
-static int CeedRequest_count = 0;
-static int CeedRequest_n = 0;
-static int CeedRequest_count_max = 0;
+FORTRAN_HANDLE_TABLE(CeedRequest)
 
 #define fCeedElemRestrictionApply \
     FORTRAN_NAME(ceedelemrestrictionapply,CEEDELEMRESTRICTIONAPPLY)
@@ -360,15 +362,10 @@ void fCeedElemRestrictionApply(int *elemr, int *tmode, int *uvec, int *ruvec,
   if (*rqst == FORTRAN_REQUEST_IMMEDIATE || *rqst == FORTRAN_REQUEST_ORDERED)
     createRequest = 0;
 
-  if (createRequest && CeedRequest_count == CeedRequest_count_max) {
-    CeedRequest_count_max += CeedRequest_count_max/2 + 1;
-    CeedRealloc(CeedRequest_count_max, &CeedRequest_dict);
-  }
-
   CeedRequest *rqst_;
   if      (*rqst == FORTRAN_REQUEST_IMMEDIATE) rqst_ = CEED_REQUEST_IMMEDIATE;
   else if (*rqst == FORTRAN_REQUEST_ORDERED  ) rqst_ = CEED_REQUEST_ORDERED;
-  else rqst_ = &CeedRequest_dict[CeedRequest_count];
+  else rqst_ = CeedRequest_Next();
 
   *err = CeedElemRestrictionApply(CeedElemRestriction_dict[*elemr],
                                   (CeedTransposeMode)*tmode,
@@ -376,8 +373,7 @@ void fCeedElemRestrictionApply(int *elemr, int *tmode, int *uvec, int *ruvec,
                                   CeedVector_dict[*ruvec], rqst_);
 
   if (*err == 0 && createRequest) {
-    *rqst = CeedRequest_count++;
-    CeedRequest_n++;
+    *rqst = CeedRequest_Add();
   }
 }
 
@@ -390,23 +386,17 @@ void fCeedElemRestrictionApplyBlock(int *elemr, int *block, int *tmode,
   if (*rqst == FORTRAN_REQUEST_IMMEDIATE || *rqst == FORTRAN_REQUEST_ORDERED)
     createRequest = 0;
 
-  if (createRequest && CeedRequest_count == CeedRequest_count_max) {
-    CeedRequest_count_max += CeedRequest_count_max/2 + 1;
-    CeedRealloc(CeedRequest_count_max, &CeedRequest_dict);
-  }
-
   CeedRequest *rqst_;
   if      (*rqst == FORTRAN_REQUEST_IMMEDIATE) rqst_ = CEED_REQUEST_IMMEDIATE;
   else if (*rqst == FORTRAN_REQUEST_ORDERED  ) rqst_ = CEED_REQUEST_ORDERED;
-  else rqst_ = &CeedRequest_dict[CeedRequest_count];
+  else rqst_ = CeedRequest_Next();
 
   *err = CeedElemRestrictionApplyBlock(CeedElemRestriction_dict[*elemr], *block,
                                        (CeedTransposeMode)*tmode, CeedVector_dict[*uvec],
                                        CeedVector_dict[*ruvec], rqst_);
 
   if (*err == 0 && createRequest) {
-    *rqst = CeedRequest_count++;
-    CeedRequest_n++;
+    *rqst = CeedRequest_Add();
   }
 }
 
@@ -439,12 +429,8 @@ void fCeedRequestWait(int *rqst, int *err) {
   //*err = CeedRequestWait(&CeedRequest_dict[*rqst]);
 
   if (*err == 0) {
-    CeedRequest_n--;
-    if (CeedRequest_n == 0) {
-      CeedFree(&CeedRequest_dict);
-      CeedRequest_count = 0;
-      CeedRequest_count_max = 0;
-    }
+    CeedRequest_Remove(*rqst);
+    *rqst = FORTRAN_NULL;
   }
 }
 
@@ -455,41 +441,27 @@ void fCeedElemRestrictionDestroy(int *elem, int *err) {
   *err = CeedElemRestrictionDestroy(&CeedElemRestriction_dict[*elem]);
 
   if (*err == 0) {
+    CeedElemRestriction_Remove(*elem);
     *elem = FORTRAN_NULL;
-    CeedElemRestriction_n--;
-    if (CeedElemRestriction_n == 0) {
-      CeedFree(&CeedElemRestriction_dict);
-      CeedElemRestriction_count = 0;
-      CeedElemRestriction_count_max = 0;
-    }
   }
 }
 
 // -----------------------------------------------------------------------------
 // CeedBasis
 // -----------------------------------------------------------------------------
-static CeedBasis *CeedBasis_dict = NULL;
-static int CeedBasis_count = 0;
-static int CeedBasis_n = 0;
-static int CeedBasis_count_max = 0;
+FORTRAN_HANDLE_TABLE(CeedBasis)
 
 #define fCeedBasisCreateTensorH1Lagrange \
     FORTRAN_NAME(ceedbasiscreatetensorh1lagrange, CEEDBASISCREATETENSORH1LAGRANGE)
 void fCeedBasisCreateTensorH1Lagrange(int *ceed, int *dim,
                                       int *ncomp, int *P, int *Q, int *quadmode,
                                       int *basis, int *err) {
-  if (CeedBasis_count == CeedBasis_count_max) {
-    CeedBasis_count_max += CeedBasis_count_max/2 + 1;
-    CeedRealloc(CeedBasis_count_max, &CeedBasis_dict);
-  }
-
   *err = CeedBasisCreateTensorH1Lagrange(Ceed_dict[*ceed], *dim, *ncomp, *P, *Q,
                                          (CeedQuadMode)*quadmode,
-                                         &CeedBasis_dict[CeedBasis_count]);
+                                         CeedBasis_Next());
 
   if (*err == 0) {
-    *basis = CeedBasis_count++;
-    CeedBasis_n++;
+    *basis = CeedBasis_Add();
   }
 }
 
@@ -501,18 +473,12 @@ void fCeedBasisCreateTensorH1(int *ceed, int *dim, int *ncomp, int *P1d,
                               const CeedScalar *qref1d,
                               const CeedScalar *qweight1d, int *basis,
                               int *err) {
-  if (CeedBasis_count == CeedBasis_count_max) {
-    CeedBasis_count_max += CeedBasis_count_max/2 + 1;
-    CeedRealloc(CeedBasis_count_max, &CeedBasis_dict);
-  }
-
   *err = CeedBasisCreateTensorH1(Ceed_dict[*ceed], *dim, *ncomp, *P1d, *Q1d,
                                  interp1d, grad1d, qref1d, qweight1d,
-                                 &CeedBasis_dict[CeedBasis_count]);
+                                 CeedBasis_Next());
 
   if (*err == 0) {
-    *basis = CeedBasis_count++;
-    CeedBasis_n++;
+    *basis = CeedBasis_Add();
   }
 }
 
@@ -522,18 +488,12 @@ void fCeedBasisCreateH1(int *ceed, int *topo, int *ncomp, int *nnodes,
                         int *nqpts, const CeedScalar *interp,
                         const CeedScalar *grad, const CeedScalar *qref,
                         const CeedScalar *qweight, int *basis, int *err) {
-  if (CeedBasis_count == CeedBasis_count_max) {
-    CeedBasis_count_max += CeedBasis_count_max/2 + 1;
-    CeedRealloc(CeedBasis_count_max, &CeedBasis_dict);
-  }
-
   *err = CeedBasisCreateH1(Ceed_dict[*ceed], (CeedElemTopology)*topo, *ncomp,
                            *nnodes, *nqpts, interp, grad, qref, qweight,
-                           &CeedBasis_dict[CeedBasis_count]);
+                           CeedBasis_Next());
 
   if (*err == 0) {
-    *basis = CeedBasis_count++;
-    CeedBasis_n++;
+    *basis = CeedBasis_Add();
   }
 }
 
@@ -609,13 +569,8 @@ void fCeedBasisDestroy(int *basis, int *err) {
   *err = CeedBasisDestroy(&CeedBasis_dict[*basis]);
 
   if (*err == 0) {
+    CeedBasis_Remove(*basis);
     *basis = FORTRAN_NULL;
-    CeedBasis_n--;
-    if (CeedBasis_n == 0) {
-      CeedFree(&CeedBasis_dict);
-      CeedBasis_count = 0;
-      CeedBasis_count_max = 0;
-    }
   }
 }
 
@@ -635,26 +590,17 @@ void fCeedLobattoQuadrature(int *Q, CeedScalar *qref1d, CeedScalar *qweight1d,
 // -----------------------------------------------------------------------------
 // CeedQFunctionContext
 // -----------------------------------------------------------------------------
-static CeedQFunctionContext *CeedQFunctionContext_dict = NULL;
-static int CeedQFunctionContext_count = 0;
-static int CeedQFunctionContext_n = 0;
-static int CeedQFunctionContext_count_max = 0;
+FORTRAN_HANDLE_TABLE(CeedQFunctionContext)
 
 #define fCeedQFunctionContextCreate \
     FORTRAN_NAME(ceedqfunctioncontextcreate,CEEDQFUNCTIONCONTEXTCREATE)
 void fCeedQFunctionContextCreate(int *ceed, int *ctx, int *err) {
-  if (CeedQFunctionContext_count == CeedQFunctionContext_count_max) {
-    CeedQFunctionContext_count_max += CeedQFunctionContext_count_max/2 + 1;
-    CeedRealloc(CeedQFunctionContext_count_max, &CeedQFunctionContext_dict);
-  }
-
   CeedQFunctionContext *ctx_ =
-    &CeedQFunctionContext_dict[CeedQFunctionContext_count];
+    CeedQFunctionContext_Next();
 
   *err = CeedQFunctionContextCreate(Ceed_dict[*ceed], ctx_);
   if (*err) return;
-  *ctx = CeedQFunctionContext_count++;
-  CeedQFunctionContext_n++;
+  *ctx = CeedQFunctionContext_Add();
 }
 
 #define fCeedQFunctionContextSetData \
@@ -701,23 +647,15 @@ void fCeedQFunctionContextDestroy(int *ctx, int *err) {
   *err = CeedQFunctionContextDestroy(&CeedQFunctionContext_dict[*ctx]);
 
   if (*err == 0) {
+    CeedQFunctionContext_Remove(*ctx);
     *ctx = FORTRAN_NULL;
-    CeedQFunctionContext_n--;
-    if (CeedQFunctionContext_n == 0) {
-      CeedFree(&CeedQFunctionContext_dict);
-      CeedQFunctionContext_count = 0;
-      CeedQFunctionContext_count_max = 0;
-    }
   }
 }
 
 // -----------------------------------------------------------------------------
 // CeedQFunction
 // -----------------------------------------------------------------------------
-static CeedQFunction *CeedQFunction_dict = NULL;
-static int CeedQFunction_count = 0;
-static int CeedQFunction_n = 0;
-static int CeedQFunction_count_max = 0;
+FORTRAN_HANDLE_TABLE(CeedQFunction)
 
 static int CeedQFunctionFortranStub(void *ctx, int nq,
                                     const CeedScalar *const *u,
@@ -735,10 +673,18 @@ static int CeedQFunctionFortranStub(void *ctx, int nq,
     CeedChk(ierr);
   }
 
-  fctx->f((void *)ctx_,&nq,u[0],u[1],u[2],u[3],u[4],u[5],u[6],
-          u[7],u[8],u[9],u[10],u[11],u[12],u[13],u[14],u[15],
-          v[0],v[1],v[2],v[3],v[4],v[5],v[6],v[7],v[8],v[9],
-          v[10],v[11],v[12],v[13],v[14],v[15],&ierr);
+  // Backends pass arrays with one entry per field; the slots beyond the
+  //   QFunction fields are NULL in the Fortran argument list
+  CeedInt nin, nout;
+  ierr = CeedQFunctionGetNumArgs(fctx->qf, &nin, &nout); CeedChk(ierr);
+#define U(i) ((i) < nin ? u[i] : NULL)
+#define V(i) ((i) < nout ? v[i] : NULL)
+  fctx->f((void *)ctx_,&nq,U(0),U(1),U(2),U(3),U(4),U(5),U(6),
+          U(7),U(8),U(9),U(10),U(11),U(12),U(13),U(14),U(15),
+          V(0),V(1),V(2),V(3),V(4),V(5),V(6),V(7),V(8),V(9),
+          V(10),V(11),V(12),V(13),V(14),V(15),&ierr);
+#undef U
+#undef V
 
   if (innerctx) {
     ierr = CeedQFunctionContextRestoreData(innerctx, (void *)&ctx_);
@@ -771,24 +717,18 @@ void fCeedQFunctionCreateInterior(int *ceed, int *vlength,
                                   const char *source, int *qf, int *err,
                                   fortran_charlen_t source_len) {
   FIX_STRING(source);
-  if (CeedQFunction_count == CeedQFunction_count_max) {
-    CeedQFunction_count_max += CeedQFunction_count_max/2 + 1;
-    CeedRealloc(CeedQFunction_count_max, &CeedQFunction_dict);
-  }
-
-  CeedQFunction *qf_ = &CeedQFunction_dict[CeedQFunction_count];
+  CeedQFunction *qf_ = CeedQFunction_Next();
   *err = CeedQFunctionCreateInterior(Ceed_dict[*ceed], *vlength,
                                      CeedQFunctionFortranStub, source_c, qf_);
 
   if (*err == 0) {
-    *qf = CeedQFunction_count++;
-    CeedQFunction_n++;
+    *qf = CeedQFunction_Add();
   }
 
   CeedFortranContext fctxdata;
   *err = CeedCalloc(1, &fctxdata);
   if (*err) return;
-  fctxdata->f = f; fctxdata->innerctx = NULL;
+  fctxdata->qf = *qf_; fctxdata->f = f; fctxdata->innerctx = NULL;
   CeedQFunctionContext fctx;
   *err = CeedQFunctionContextCreate(Ceed_dict[*ceed], &fctx);
   if (*err) return;
@@ -808,17 +748,11 @@ void fCeedQFunctionCreateInterior(int *ceed, int *vlength,
 void fCeedQFunctionCreateInteriorByName(int *ceed, const char *name, int *qf,
                                         int *err, fortran_charlen_t name_len) {
   FIX_STRING(name);
-  if (CeedQFunction_count == CeedQFunction_count_max) {
-    CeedQFunction_count_max += CeedQFunction_count_max/2 + 1;
-    CeedRealloc(CeedQFunction_count_max, &CeedQFunction_dict);
-  }
-
-  CeedQFunction *qf_ = &CeedQFunction_dict[CeedQFunction_count];
+  CeedQFunction *qf_ = CeedQFunction_Next();
   *err = CeedQFunctionCreateInteriorByName(Ceed_dict[*ceed], name_c, qf_);
 
   if (*err == 0) {
-    *qf = CeedQFunction_count++;
-    CeedQFunction_n++;
+    *qf = CeedQFunction_Add();
   }
 }
 
@@ -826,19 +760,13 @@ void fCeedQFunctionCreateInteriorByName(int *ceed, const char *name, int *qf,
     FORTRAN_NAME(ceedqfunctioncreateidentity, CEEDQFUNCTIONCREATEIDENTITY)
 void fCeedQFunctionCreateIdentity(int *ceed, int *size, int *inmode,
                                   int *outmode, int *qf, int *err) {
-  if (CeedQFunction_count == CeedQFunction_count_max) {
-    CeedQFunction_count_max += CeedQFunction_count_max/2 + 1;
-    CeedRealloc(CeedQFunction_count_max, &CeedQFunction_dict);
-  }
-
-  CeedQFunction *qf_ = &CeedQFunction_dict[CeedQFunction_count];
+  CeedQFunction *qf_ = CeedQFunction_Next();
   *err = CeedQFunctionCreateIdentity(Ceed_dict[*ceed], *size,
                                      (CeedEvalMode)*inmode,
                                      (CeedEvalMode)*outmode, qf_);
 
   if (*err == 0) {
-    *qf = CeedQFunction_count++;
-    CeedQFunction_n++;
+    *qf = CeedQFunction_Add();
   }
 }
 
@@ -901,9 +829,7 @@ void fCeedQFunctionApply(int *qf, int *Q,
                          int *v8, int *v9, int *v10, int *v11,
                          int *v12, int *v13, int *v14, int *v15, int *err) {
   CeedQFunction qf_ = CeedQFunction_dict[*qf];
-  CeedVector *in;
-  *err = CeedCalloc(16, &in);
-  if (*err) return;
+  CeedVector in[16], out[16];
   in[0] = *u==FORTRAN_NULL?NULL:CeedVector_dict[*u];
   in[1] = *u1==FORTRAN_NULL?NULL:CeedVector_dict[*u1];
   in[2] = *u2==FORTRAN_NULL?NULL:CeedVector_dict[*u2];
@@ -920,9 +846,6 @@ void fCeedQFunctionApply(int *qf, int *Q,
   in[13] = *u13==FORTRAN_NULL?NULL:CeedVector_dict[*u13];
   in[14] = *u14==FORTRAN_NULL?NULL:CeedVector_dict[*u14];
   in[15] = *u15==FORTRAN_NULL?NULL:CeedVector_dict[*u15];
-  CeedVector *out;
-  *err = CeedCalloc(16, &out);
-  if (*err) return;
   out[0] = *v==FORTRAN_NULL?NULL:CeedVector_dict[*v];
   out[1] = *v1==FORTRAN_NULL?NULL:CeedVector_dict[*v1];
   out[2] = *v2==FORTRAN_NULL?NULL:CeedVector_dict[*v2];
@@ -940,11 +863,6 @@ void fCeedQFunctionApply(int *qf, int *Q,
   out[14] = *v14==FORTRAN_NULL?NULL:CeedVector_dict[*v14];
   out[15] = *v15==FORTRAN_NULL?NULL:CeedVector_dict[*v15];
   *err = CeedQFunctionApply(qf_, *Q, in, out);
-  if (*err) return;
-
-  *err = CeedFree(&in);
-  if (*err) return;
-  *err = CeedFree(&out);
 }
 
 #define fCeedQFunctionDestroy \
@@ -954,34 +872,21 @@ void fCeedQFunctionDestroy(int *qf, int *err) {
 
   *err = CeedQFunctionDestroy(&CeedQFunction_dict[*qf]);
   if (*err == 0) {
+    CeedQFunction_Remove(*qf);
     *qf = FORTRAN_NULL;
-    CeedQFunction_n--;
-    if (CeedQFunction_n == 0) {
-      *err = CeedFree(&CeedQFunction_dict);
-      CeedQFunction_count = 0;
-      CeedQFunction_count_max = 0;
-    }
   }
 }
 
 // -----------------------------------------------------------------------------
 // CeedOperator
 // -----------------------------------------------------------------------------
-static CeedOperator *CeedOperator_dict = NULL;
-static int CeedOperator_count = 0;
-static int CeedOperator_n = 0;
-static int CeedOperator_count_max = 0;
+FORTRAN_HANDLE_TABLE(CeedOperator)
 
 #define fCeedOperatorCreate \
     FORTRAN_NAME(ceedoperatorcreate, CEEDOPERATORCREATE)
 void fCeedOperatorCreate(int *ceed,
                          int *qf, int *dqf, int *dqfT, int *op, int *err) {
-  if (CeedOperator_count == CeedOperator_count_max) {
-    CeedOperator_count_max += CeedOperator_count_max/2 + 1;
-    CeedRealloc(CeedOperator_count_max, &CeedOperator_dict);
-  }
-
-  CeedOperator *op_ = &CeedOperator_dict[CeedOperator_count];
+  CeedOperator *op_ = CeedOperator_Next();
 
   CeedQFunction dqf_  = CEED_QFUNCTION_NONE, dqfT_ = CEED_QFUNCTION_NONE;
   if (*dqf  != FORTRAN_QFUNCTION_NONE) dqf_  = CeedQFunction_dict[*dqf ];
@@ -990,24 +895,17 @@ void fCeedOperatorCreate(int *ceed,
   *err = CeedOperatorCreate(Ceed_dict[*ceed], CeedQFunction_dict[*qf], dqf_,
                             dqfT_, op_);
   if (*err) return;
-  *op = CeedOperator_count++;
-  CeedOperator_n++;
+  *op = CeedOperator_Add();
 }
 
 #define fCeedCompositeOperatorCreate \
     FORTRAN_NAME(ceedcompositeoperatorcreate, CEEDCOMPOSITEOPERATORCREATE)
 void fCeedCompositeOperatorCreate(int *ceed, int *op, int *err) {
-  if (CeedOperator_count == CeedOperator_count_max) {
-    CeedOperator_count_max += CeedOperator_count_max/2 + 1;
-    CeedRealloc(CeedOperator_count_max, &CeedOperator_dict);
-  }
-
-  CeedOperator *op_ = &CeedOperator_dict[CeedOperator_count];
+  CeedOperator *op_ = CeedOperator_Next();
 
   *err = CeedCompositeOperatorCreate(Ceed_dict[*ceed], op_);
   if (*err) return;
-  *op = CeedOperator_count++;
-  CeedOperator_n++;
+  *op = CeedOperator_Add();
 }
 
 #define fCeedOperatorSetField \
@@ -1064,19 +962,11 @@ void fCeedCompositeOperatorAddSub(int *compositeop, int *subop, int *err) {
 void fCeedOperatorLinearAssembleQFunction(int *op, int *assembledvec,
     int *assembledrstr, int *rqst, int *err) {
   // Vector
-  if (CeedVector_count == CeedVector_count_max) {
-    CeedVector_count_max += CeedVector_count_max/2 + 1;
-    CeedRealloc(CeedVector_count_max, &CeedVector_dict);
-  }
-  CeedVector *assembledvec_ = &CeedVector_dict[CeedVector_count];
+  CeedVector *assembledvec_ = CeedVector_Next();
 
   // Restriction
-  if (CeedElemRestriction_count == CeedElemRestriction_count_max) {
-    CeedElemRestriction_count_max += CeedElemRestriction_count_max/2 + 1;
-    CeedRealloc(CeedElemRestriction_count_max, &CeedElemRestriction_dict);
-  }
   CeedElemRestriction *rstr_ =
-    &CeedElemRestriction_dict[CeedElemRestriction_count];
+    CeedElemRestriction_Next();
 
   int createRequest = 1;
   // Check if input is CEED_REQUEST_ORDERED(-2) or CEED_REQUEST_IMMEDIATE(-1)
@@ -1084,29 +974,21 @@ void fCeedOperatorLinearAssembleQFunction(int *op, int *assembledvec,
     createRequest = 0;
   }
 
-  if (createRequest && CeedRequest_count == CeedRequest_count_max) {
-    CeedRequest_count_max += CeedRequest_count_max/2 + 1;
-    CeedRealloc(CeedRequest_count_max, &CeedRequest_dict);
-  }
-
   CeedRequest *rqst_;
   if (*rqst == -1) rqst_ = CEED_REQUEST_IMMEDIATE;
   else if (*rqst == -2) rqst_ = CEED_REQUEST_ORDERED;
-  else rqst_ = &CeedRequest_dict[CeedRequest_count];
+  else rqst_ = CeedRequest_Next();
 
   *err = CeedOperatorLinearAssembleQFunction(CeedOperator_dict[*op],
          assembledvec_, rstr_, rqst_);
   if (*err) return;
   if (createRequest) {
-    *rqst = CeedRequest_count++;
-    CeedRequest_n++;
+    *rqst = CeedRequest_Add();
   }
 
   if (*err == 0) {
-    *assembledrstr = CeedElemRestriction_count++;
-    CeedElemRestriction_n++;
-    *assembledvec = CeedVector_count++;
-    CeedVector_n++;
+    *assembledrstr = CeedElemRestriction_Add();
+    *assembledvec = CeedVector_Add();
   }
 }
 
@@ -1120,22 +1002,16 @@ void fCeedOperatorLinearAssembleDiagonal(int *op, int *assembledvec,
     createRequest = 0;
   }
 
-  if (createRequest && CeedRequest_count == CeedRequest_count_max) {
-    CeedRequest_count_max += CeedRequest_count_max/2 + 1;
-    CeedRealloc(CeedRequest_count_max, &CeedRequest_dict);
-  }
-
   CeedRequest *rqst_;
   if (*rqst == -1) rqst_ = CEED_REQUEST_IMMEDIATE;
   else if (*rqst == -2) rqst_ = CEED_REQUEST_ORDERED;
-  else rqst_ = &CeedRequest_dict[CeedRequest_count];
+  else rqst_ = CeedRequest_Next();
 
   *err = CeedOperatorLinearAssembleDiagonal(CeedOperator_dict[*op],
          CeedVector_dict[*assembledvec], rqst_);
   if (*err) return;
   if (createRequest) {
-    *rqst = CeedRequest_count++;
-    CeedRequest_n++;
+    *rqst = CeedRequest_Add();
   }
 }
 
@@ -1155,17 +1031,12 @@ void fCeedOperatorMultigridLevelCreate(int *opFine, int *pMultFine,
            &opCoarse_, &opProlong_, &opRestrict_);
 
   if (*err) return;
-  while (CeedOperator_count + 2 >= CeedOperator_count_max) {
-    CeedOperator_count_max += CeedOperator_count_max/2 + 1;
-  }
-  CeedRealloc(CeedOperator_count_max, &CeedOperator_dict);
-  CeedOperator_dict[CeedOperator_count] = opCoarse_;
-  *opCoarse = CeedOperator_count++;
-  CeedOperator_dict[CeedOperator_count] = opProlong_;
-  *opProlong = CeedOperator_count++;
-  CeedOperator_dict[CeedOperator_count] = opRestrict_;
-  *opRestrict = CeedOperator_count++;
-  CeedOperator_n += 3;
+  *CeedOperator_Next() = opCoarse_;
+  *opCoarse = CeedOperator_Add();
+  *CeedOperator_Next() = opProlong_;
+  *opProlong = CeedOperator_Add();
+  *CeedOperator_Next() = opRestrict_;
+  *opRestrict = CeedOperator_Add();
 }
 
 #define fCeedOperatorMultigridLevelCreateTensorH1 \
@@ -1183,17 +1054,12 @@ void fCeedOperatorMultigridLevelCreateTensorH1(int *opFine, int *pMultFine,
            interpCtoF, &opCoarse_, &opProlong_, &opRestrict_);
 
   if (*err) return;
-  while (CeedOperator_count + 2 >= CeedOperator_count_max) {
-    CeedOperator_count_max += CeedOperator_count_max/2 + 1;
-  }
-  CeedRealloc(CeedOperator_count_max, &CeedOperator_dict);
-  CeedOperator_dict[CeedOperator_count] = opCoarse_;
-  *opCoarse = CeedOperator_count++;
-  CeedOperator_dict[CeedOperator_count] = opProlong_;
-  *opProlong = CeedOperator_count++;
-  CeedOperator_dict[CeedOperator_count] = opRestrict_;
-  *opRestrict = CeedOperator_count++;
-  CeedOperator_n += 3;
+  *CeedOperator_Next() = opCoarse_;
+  *opCoarse = CeedOperator_Add();
+  *CeedOperator_Next() = opProlong_;
+  *opProlong = CeedOperator_Add();
+  *CeedOperator_Next() = opRestrict_;
+  *opRestrict = CeedOperator_Add();
 }
 
 #define fCeedOperatorMultigridLevelCreateH1 \
@@ -1211,17 +1077,12 @@ void fCeedOperatorMultigridLevelCreateH1(int *opFine, int *pMultFine,
            interpCtoF, &opCoarse_, &opProlong_, &opRestrict_);
 
   if (*err) return;
-  while (CeedOperator_count + 2 >= CeedOperator_count_max) {
-    CeedOperator_count_max += CeedOperator_count_max/2 + 1;
-  }
-  CeedRealloc(CeedOperator_count_max, &CeedOperator_dict);
-  CeedOperator_dict[CeedOperator_count] = opCoarse_;
-  *opCoarse = CeedOperator_count++;
-  CeedOperator_dict[CeedOperator_count] = opProlong_;
-  *opProlong = CeedOperator_count++;
-  CeedOperator_dict[CeedOperator_count] = opRestrict_;
-  *opRestrict = CeedOperator_count++;
-  CeedOperator_n += 3;
+  *CeedOperator_Next() = opCoarse_;
+  *opCoarse = CeedOperator_Add();
+  *CeedOperator_Next() = opProlong_;
+  *opProlong = CeedOperator_Add();
+  *CeedOperator_Next() = opRestrict_;
+  *opRestrict = CeedOperator_Add();
 }
 
 #define fCeedOperatorView \
@@ -1237,12 +1098,8 @@ void fCeedOperatorView(int *op, int *err) {
 void fCeedOperatorCreateFDMElementInverse(int *op, int *fdminv,
     int *rqst, int *err) {
   // Operator
-  if (CeedOperator_count == CeedOperator_count_max) {
-    CeedOperator_count_max += CeedOperator_count_max/2 + 1;
-    CeedRealloc(CeedOperator_count_max, &CeedOperator_dict);
-  }
   CeedOperator *fdminv_ =
-    &CeedOperator_dict[CeedOperator_count];
+    CeedOperator_Next();
 
   int createRequest = 1;
   // Check if input is CEED_REQUEST_ORDERED(-2) or CEED_REQUEST_IMMEDIATE(-1)
@@ -1250,27 +1107,20 @@ void fCeedOperatorCreateFDMElementInverse(int *op, int *fdminv,
     createRequest = 0;
   }
 
-  if (createRequest && CeedRequest_count == CeedRequest_count_max) {
-    CeedRequest_count_max += CeedRequest_count_max/2 + 1;
-    CeedRealloc(CeedRequest_count_max, &CeedRequest_dict);
-  }
-
   CeedRequest *rqst_;
   if (*rqst == -1) rqst_ = CEED_REQUEST_IMMEDIATE;
   else if (*rqst == -2) rqst_ = CEED_REQUEST_ORDERED;
-  else rqst_ = &CeedRequest_dict[CeedRequest_count];
+  else rqst_ = CeedRequest_Next();
 
   *err = CeedOperatorCreateFDMElementInverse(CeedOperator_dict[*op],
          fdminv_, rqst_);
   if (*err) return;
   if (createRequest) {
-    *rqst = CeedRequest_count++;
-    CeedRequest_n++;
+    *rqst = CeedRequest_Add();
   }
 
   if (*err == 0) {
-    *fdminv = CeedOperator_count++;
-    CeedOperator_n++;
+    *fdminv = CeedOperator_Add();
   }
 }
 
@@ -1290,22 +1140,16 @@ void fCeedOperatorApply(int *op, int *ustatevec,
     createRequest = 0;
   }
 
-  if (createRequest && CeedRequest_count == CeedRequest_count_max) {
-    CeedRequest_count_max += CeedRequest_count_max/2 + 1;
-    CeedRealloc(CeedRequest_count_max, &CeedRequest_dict);
-  }
-
   CeedRequest *rqst_;
   if (*rqst == -1) rqst_ = CEED_REQUEST_IMMEDIATE;
   else if (*rqst == -2) rqst_ = CEED_REQUEST_ORDERED;
-  else rqst_ = &CeedRequest_dict[CeedRequest_count];
+  else rqst_ = CeedRequest_Next();
 
   *err = CeedOperatorApply(CeedOperator_dict[*op],
                            ustatevec_, resvec_, rqst_);
   if (*err) return;
   if (createRequest) {
-    *rqst = CeedRequest_count++;
-    CeedRequest_n++;
+    *rqst = CeedRequest_Add();
   }
 }
 
@@ -1323,22 +1167,16 @@ void fCeedOperatorApplyAdd(int *op, int *ustatevec,
     createRequest = 0;
   }
 
-  if (createRequest && CeedRequest_count == CeedRequest_count_max) {
-    CeedRequest_count_max += CeedRequest_count_max/2 + 1;
-    CeedRealloc(CeedRequest_count_max, &CeedRequest_dict);
-  }
-
   CeedRequest *rqst_;
   if (*rqst == -1) rqst_ = CEED_REQUEST_IMMEDIATE;
   else if (*rqst == -2) rqst_ = CEED_REQUEST_ORDERED;
-  else rqst_ = &CeedRequest_dict[CeedRequest_count];
+  else rqst_ = CeedRequest_Next();
 
   *err = CeedOperatorApplyAdd(CeedOperator_dict[*op],
                               ustatevec_, resvec_, rqst_);
   if (*err) return;
   if (createRequest) {
-    *rqst = CeedRequest_count++;
-    CeedRequest_n++;
+    *rqst = CeedRequest_Add();
   }
 }
 
@@ -1359,13 +1197,8 @@ void fCeedOperatorDestroy(int *op, int *err) {
   if (*op == FORTRAN_NULL) return;
   *err = CeedOperatorDestroy(&CeedOperator_dict[*op]);
   if (*err == 0) {
+    CeedOperator_Remove(*op);
     *op = FORTRAN_NULL;
-    CeedOperator_n--;
-    if (CeedOperator_n == 0) {
-      *err = CeedFree(&CeedOperator_dict);
-      CeedOperator_count = 0;
-      CeedOperator_count_max = 0;
-    }
   }
 }
 
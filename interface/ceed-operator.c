@@ -14,20 +14,183 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
+#define _POSIX_C_SOURCE 200112
 #include <ceed-impl.h>
 #include <ceed-backend.h>
+#include <fcntl.h>
+#include <stdint.h>
 #include <string.h>
 #include <math.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
 
 /// @file
 /// Implementation of CeedOperator interfaces
 
+/// @cond DOXYGEN_SKIP
+// Header of the files written by CeedOperatorSave, followed by the records
+typedef struct {
+  char magic[8];      // "CEEDOPR"
+  int32_t version;
+  int32_t numops;     // Number of operators in the depth-first traversal
+  int32_t numrecords;
+  int32_t reserved;
+} CeedOperatorFileHeader;
+
+// Header of each record, followed by a CeedVector record
+typedef struct {
+  int32_t kind;       // CeedOperatorRecordKind
+  int32_t opindex;    // Operator in the depth-first traversal
+  int32_t field;      // Input field index, for passive inputs
+  int32_t backendstrides; // Restriction of the data has backend strides
+  int32_t nelem, elemsize, ncomp; // Restriction of the data, if created
+  int32_t strides[3];
+  double bounds[2];   // Eigenvalue bounds of a Chebyshev smoother
+  char fieldname[64];
+} CeedOperatorRecordHeader;
+
+typedef enum {
+  CEED_OPERATOR_RECORD_FIELD = 1,       // Passive input vector
+  CEED_OPERATOR_RECORD_QFASSEMBLED = 2, // Assembled CeedQFunction
+  CEED_OPERATOR_RECORD_EMAT = 3,        // Dense element matrices
+  CEED_OPERATOR_RECORD_SMOOTHER = 4,    // Inverse diagonal and bounds
+} CeedOperatorRecordKind;
+
+static const char ceed_operator_file_magic[8] = "CEEDOPR";
+#define CEED_OPERATOR_FILE_VERSION 1
+/// @endcond
+
 /// ----------------------------------------------------------------------------
 /// CeedOperator Library Internal Functions
 /// ----------------------------------------------------------------------------
 /// @addtogroup CeedOperatorDeveloper
 /// @{
 
+/**
+  @brief Duplicate a CeedOperator on another Ceed, sharing its fields
+
+  The duplicate shares the fields and suboperators of @a op; only the backend
+    data and the QFunction backend data are created for @a ceed.
+
+  @param op            CeedOperator to duplicate
+  @param ceed          Ceed to create the duplicate with
+  @param[out] clone    Address of the duplicate CeedOperator
+  @param[out] qfclone  Address of the duplicate CeedQFunction, or NULL for
+                         composite operators
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorClone(CeedOperator op, Ceed ceed, CeedOperator *clone,
+                             CeedQFunction *qfclone) {
+  int ierr;
+
+  // Clone Op
+  CeedOperator opclone;
+  ierr = CeedCalloc(1, &opclone); CeedChk(ierr);
+  memcpy(opclone, op, sizeof(*opclone));
+  opclone->data = NULL;
+  opclone->setupdone = 0;
+  opclone->ceed = ceed;
+  opclone->opfallback = NULL;
+  opclone->qffallback = NULL;
+  opclone->qfassembled = NULL;
+  opclone->qfassembledrstr = NULL;
+  opclone->ematmode = CEED_ELEMMATRIX_NEVER;
+  opclone->ematused = false;
+  opclone->emat = NULL;
+  opclone->ematin = NULL;
+  opclone->ematout = NULL;
+  *clone = opclone;
+  *qfclone = NULL;
+
+  // Composite operators keep their suboperators, which create their own
+  //   fallbacks as needed
+  if (op->composite) {
+    opclone->Destroy = NULL;
+    opclone->ApplyComposite = NULL;
+    opclone->ApplyAddComposite = NULL;
+    if (ceed->CompositeOperatorCreate) {
+      ierr = ceed->CompositeOperatorCreate(opclone); CeedChk(ierr);
+    }
+    return 0;
+  }
+  while (!opclone->ceed->OperatorCreate) {
+    ierr = CeedGetObjectDelegate(opclone->ceed, &opclone->ceed, "Operator");
+    CeedChk(ierr);
+    if (!opclone->ceed)
+      // LCOV_EXCL_START
+      return CeedError(op->ceed, 1, "Backend does not support OperatorCreate");
+    // LCOV_EXCL_STOP
+  }
+  ierr = opclone->ceed->OperatorCreate(opclone); CeedChk(ierr);
+
+  // Clone QF
+  CeedQFunction qf;
+  ierr = CeedCalloc(1, &qf); CeedChk(ierr);
+  memcpy(qf, (op->qf), sizeof(*qf));
+  qf->data = NULL;
+  qf->ceed = ceed;
+  while (!qf->ceed->QFunctionCreate) {
+    ierr = CeedGetObjectDelegate(qf->ceed, &qf->ceed, "QFunction");
+    CeedChk(ierr);
+    if (!qf->ceed)
+      // LCOV_EXCL_START
+      return CeedError(op->ceed, 1, "Backend does not support QFunctionCreate");
+    // LCOV_EXCL_STOP
+  }
+  ierr = qf->ceed->QFunctionCreate(qf); CeedChk(ierr);
+  opclone->qf = qf;
+  *qfclone = qf;
+
+  return 0;
+}
+
+/**
+  @brief Create the operator fallback Ceed of a Ceed, if not yet present
+
+  A delegate for the fallback resource, such as the /gpu/cuda/ref delegate of
+    /gpu/cuda/gen or the /cpu/self/ref/serial delegate of the CPU backends, is
+    reused instead of initializing a new Ceed, so the fallback works in the
+    buffers and streams of its parent.
+
+  @param ceed              Ceed to create the fallback Ceed of
+  @param fallbackresource  Resource of the fallback Ceed
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedCreateOperatorFallbackCeed(Ceed ceed,
+    const char *fallbackresource) {
+  int ierr;
+  Ceed ceedref;
+
+  if (ceed->opfallbackceed)
+    return 0;
+  for (ceedref = ceed->delegate; ceedref; ceedref = ceedref->delegate)
+    if (!strcmp(ceedref->resource, fallbackresource) &&
+        !ceedref->opfallbackparent)
+      break;
+  if (ceedref) {
+    CeedReference(ceedref);
+    ceed->opfallbackdelegate = true;
+  } else {
+    ierr = CeedInit(fallbackresource, &ceedref); CeedChk(ierr);
+    // Let the fallback use the device handles and stream of its parent
+    if (ceed->ShareDevice) {
+      ierr = ceed->ShareDevice(ceed, ceedref); CeedChk(ierr);
+    }
+  }
+  ceedref->opfallbackparent = ceed;
+  ceedref->Error = ceed->Error;
+  ceed->opfallbackceed = ceedref;
+  return 0;
+}
+
 /**
   @brief Duplicate a CeedOperator with a reference Ceed to fallback for advanced
            CeedOperator functionality
@@ -41,6 +204,12 @@
 int CeedOperatorCreateFallback(CeedOperator op) {
   int ierr;
 
+  if (op->sharded || op->smoothop)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Not defined for %s operator",
+                     op->sharded ? "sharded" : "smoother");
+  // LCOV_EXCL_STOP
+
   // Fallback Ceed
   const char *resource, *fallbackresource;
   ierr = CeedGetResource(op->ceed, &resource); CeedChk(ierr);
@@ -52,36 +221,63 @@ int CeedOperatorCreateFallback(CeedOperator op) {
                      "fallback to resource %s", resource, fallbackresource);
   // LCOV_EXCL_STOP
 
-  // Fallback Ceed
-  Ceed ceedref;
-  if (!op->ceed->opfallbackceed) {
-    ierr = CeedInit(fallbackresource, &ceedref); CeedChk(ierr);
-    ceedref->opfallbackparent = op->ceed;
-    ceedref->Error = op->ceed->Error;
-    op->ceed->opfallbackceed = ceedref;
-  }
-  ceedref = op->ceed->opfallbackceed;
+  // Fallback Ceed, created once for operators applied on several threads
+  ierr = CeedLock(op->ceed); CeedChk(ierr);
+  int ierrfallback = CeedCreateOperatorFallbackCeed(op->ceed,
+                     fallbackresource);
+  ierr = CeedUnlock(op->ceed); CeedChk(ierr);
+  CeedChk(ierrfallback);
+  Ceed ceedref = op->ceed->opfallbackceed;
 
   // Clone Op
-  CeedOperator opref;
-  ierr = CeedCalloc(1, &opref); CeedChk(ierr);
-  memcpy(opref, op, sizeof(*opref)); CeedChk(ierr);
-  opref->data = NULL;
-  opref->setupdone = 0;
-  opref->ceed = ceedref;
-  ierr = ceedref->OperatorCreate(opref); CeedChk(ierr);
-  op->opfallback = opref;
+  ierr = CeedOperatorClone(op, ceedref, &op->opfallback, &op->qffallback);
+  CeedChk(ierr);
 
-  // Clone QF
-  CeedQFunction qfref;
-  ierr = CeedCalloc(1, &qfref); CeedChk(ierr);
-  memcpy(qfref, (op->qf), sizeof(*qfref)); CeedChk(ierr);
-  qfref->data = NULL;
-  qfref->ceed = ceedref;
-  ierr = ceedref->QFunctionCreate(qfref); CeedChk(ierr);
-  opref->qf = qfref;
-  op->qffallback = qfref;
+  // Count fallbacks on the Ceed created by the user; a fallback to another
+  //   memory space moves the operator data between host and device
+  CeedMemType memtype, fallbackmemtype;
+  ierr = CeedGetPreferredMemType(op->ceed, &memtype); CeedChk(ierr);
+  ierr = CeedGetPreferredMemType(ceedref, &fallbackmemtype); CeedChk(ierr);
+  Ceed ceed;
+  ierr = CeedGetParent(op->ceed, &ceed); CeedChk(ierr);
+  while (ceed->opfallbackparent) {
+    ierr = CeedGetParent(ceed->opfallbackparent, &ceed); CeedChk(ierr);
+  }
+  __atomic_add_fetch(&ceed->numopfallbacks, 1, __ATOMIC_RELAXED);
+  if (memtype != fallbackmemtype) {
+    __atomic_add_fetch(&ceed->numopfallbackscrossed, 1, __ATOMIC_RELAXED);
+    CeedDebug("Operator falls back from %s to %s, %s memory", resource,
+              fallbackresource, CeedMemTypes[fallbackmemtype]);
+  }
+
+  return 0;
+}
+
+/**
+  @brief Destroy a CeedOperator fallback, if present
+
+  @param op  CeedOperator to destroy the fallback of
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorDestroyFallback(CeedOperator op) {
+  int ierr;
 
+  if (op->qffallback) {
+    ierr = op->qffallback->Destroy(op->qffallback); CeedChk(ierr);
+    ierr = CeedFree(&op->qffallback); CeedChk(ierr);
+  }
+  if (op->opfallback) {
+    if (op->opfallback->Destroy) {
+      ierr = op->opfallback->Destroy(op->opfallback); CeedChk(ierr);
+    }
+    ierr = CeedVectorDestroy(&op->opfallback->qfassembled); CeedChk(ierr);
+    ierr = CeedElemRestrictionDestroy(&op->opfallback->qfassembledrstr);
+    CeedChk(ierr);
+    ierr = CeedFree(&op->opfallback); CeedChk(ierr);
+  }
   return 0;
 }
 
@@ -98,7 +294,9 @@ int CeedOperatorCreateFallback(CeedOperator op) {
 static int CeedOperatorCheckReady(Ceed ceed, CeedOperator op) {
   CeedQFunction qf = op->qf;
 
-  if (op->composite) {
+  if (op->smoothop) {
+    return CeedOperatorCheckReady(ceed, op->smoothop);
+  } else if (op->composite) {
     if (!op->numsub)
       // LCOV_EXCL_START
       return CeedError(ceed, 1, "No suboperators set");
@@ -126,815 +324,4587 @@ static int CeedOperatorCheckReady(Ceed ceed, CeedOperator op) {
 }
 
 /**
-  @brief View a field of a CeedOperator
+  @brief Get the combined state of the inputs of a build CeedOperator
 
-  @param[in] field       Operator field to view
-  @param[in] qffield     QFunction field (carries field name)
-  @param[in] fieldnumber Number of field being viewed
-  @param[in] sub         true indicates sub-operator, which increases indentation; false for top-level operator
-  @param[in] in          true for an input field; false for output field
-  @param[in] stream      Stream to view to, e.g., stdout
+  States only increase, so the sum of the state of the active input, the
+    passive input vectors, and the CeedQFunctionContexts changes whenever any
+    of them is modified.
+
+  @param[in] op     Build CeedOperator
+  @param[in] in     Active input vector of @a op or @ref CEED_VECTOR_NONE
+  @param[out] state Variable to store combined state
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Utility
+  @ref Developer
 **/
-static int CeedOperatorFieldView(CeedOperatorField field,
-                                 CeedQFunctionField qffield,
-                                 CeedInt fieldnumber, bool sub, bool in,
-                                 FILE *stream) {
-  const char *pre = sub ? "  " : "";
-  const char *inout = in ? "Input" : "Output";
-
-  fprintf(stream, "%s    %s Field [%d]:\n"
-          "%s      Name: \"%s\"\n",
-          pre, inout, fieldnumber, pre, qffield->fieldname);
-
-  if (field->basis == CEED_BASIS_COLLOCATED)
-    fprintf(stream, "%s      Collocated basis\n", pre);
+static int CeedOperatorGetBuildState(CeedOperator op, CeedVector in,
+                                     uint64_t *state) {
+  int ierr;
+  uint64_t vecstate;
 
-  if (field->vec == CEED_VECTOR_ACTIVE)
-    fprintf(stream, "%s      Active vector\n", pre);
-  else if (field->vec == CEED_VECTOR_NONE)
-    fprintf(stream, "%s      No vector\n", pre);
+  *state = 0;
+  if (in && in != CEED_VECTOR_NONE) {
+    ierr = CeedVectorGetState(in, &vecstate); CeedChk(ierr);
+    *state += vecstate;
+  }
+  if (op->composite) {
+    for (CeedInt i=0; i<op->numsub; i++) {
+      ierr = CeedOperatorGetBuildState(op->suboperators[i], CEED_VECTOR_NONE,
+                                       &vecstate); CeedChk(ierr);
+      *state += vecstate;
+    }
+    return 0;
+  }
+  if (op->qf->ctx) {
+    ierr = CeedQFunctionContextGetState(op->qf->ctx, &vecstate); CeedChk(ierr);
+    *state += vecstate;
+  }
+  for (CeedInt i=0; i<op->qf->numinputfields; i++) {
+    CeedVector vec = op->inputfields[i]->vec;
+    if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE) {
+      ierr = CeedVectorGetState(vec, &vecstate); CeedChk(ierr);
+      *state += vecstate;
+    }
+  }
 
   return 0;
 }
 
 /**
-  @brief View a single CeedOperator
+  @brief Copy the context data of the instances of an ensemble CeedOperator
+           that changed since they were last copied
 
-  @param[in] op     CeedOperator to view
-  @param[in] sub    Boolean flag for sub-operator
-  @param[in] stream Stream to write; typically stdout/stderr or a file
+  @param[in] op CeedOperator about to be applied or assembled
 
-  @return Error code: 0 - success, otherwise - failure
+  @return An error code: 0 - success, otherwise - failure
 
-  @ref Utility
+  @ref Developer
 **/
-int CeedOperatorSingleView(CeedOperator op, bool sub, FILE *stream) {
+static int CeedOperatorUpdateEnsembleContexts(CeedOperator op) {
   int ierr;
-  const char *pre = sub ? "  " : "";
+  CeedOperatorEnsemble *ensemble = NULL;
 
-  CeedInt totalfields;
-  ierr = CeedOperatorGetNumArgs(op, &totalfields); CeedChk(ierr);
+  for (CeedInt k=0; k<op->numensemble; k++) {
+    uint64_t state;
+    ierr = CeedQFunctionContextGetState(op->ensemblectx[k], &state);
+    CeedChk(ierr);
+    if (state == op->ensemblestate[k])
+      continue;
+    if (!ensemble) {
+      ierr = CeedQFunctionContextGetData(op->qf->ctx, CEED_MEM_HOST,
+                                         &ensemble); CeedChk(ierr);
+    }
+    void *data;
+    ierr = CeedQFunctionContextGetData(op->ensemblectx[k], CEED_MEM_HOST,
+                                       &data); CeedChk(ierr);
+    memcpy((char *)ensemble + ensemble->ctxoffset + k*ensemble->ctxsize, data,
+           ensemble->ctxsize);
+    ierr = CeedQFunctionContextRestoreData(op->ensemblectx[k], &data);
+    CeedChk(ierr);
+    op->ensemblestate[k] = state;
+  }
+  if (ensemble) {
+    ierr = CeedQFunctionContextRestoreData(op->qf->ctx, &ensemble);
+    CeedChk(ierr);
+  }
+  return 0;
+}
 
-  fprintf(stream, "%s  %d Field%s\n", pre, totalfields, totalfields>1 ? "s" : "");
+/**
+  @brief Rebuild passive input vectors of a CeedOperator that are out of date
 
-  fprintf(stream, "%s  %d Input Field%s:\n", pre, op->qf->numinputfields,
-          op->qf->numinputfields>1 ? "s" : "");
-  for (CeedInt i=0; i<op->qf->numinputfields; i++) {
-    ierr = CeedOperatorFieldView(op->inputfields[i], op->qf->inputfields[i],
-                                 i, sub, 1, stream); CeedChk(ierr);
-  }
+  Passive input vectors with a build operator set by
+    CeedOperatorSetFieldBuilder() are recomputed if this is the first use or if
+    any input of the build operator changed since the last build.
 
-  fprintf(stream, "%s  %d Output Field%s:\n", pre, op->qf->numoutputfields,
-          op->qf->numoutputfields>1 ? "s" : "");
-  for (CeedInt i=0; i<op->qf->numoutputfields; i++) {
-    ierr = CeedOperatorFieldView(op->outputfields[i], op->qf->outputfields[i],
-                                 i, sub, 0, stream); CeedChk(ierr);
+  @param[in] op CeedOperator about to be applied or assembled
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorUpdateBuiltFields(CeedOperator op) {
+  int ierr;
+
+  // Shards update their fields on their own device when applied, and
+  //   smoothers when their operator is applied
+  if (op->sharded || op->smoothop)
+    return 0;
+  if (op->composite) {
+    for (CeedInt i=0; i<op->numsub; i++) {
+      ierr = CeedOperatorUpdateBuiltFields(op->suboperators[i]); CeedChk(ierr);
+    }
+    return 0;
+  }
+  ierr = CeedOperatorUpdateEnsembleContexts(op); CeedChk(ierr);
+  for (CeedInt i=0; i<op->qf->numinputfields; i++) {
+    CeedOperatorField field = op->inputfields[i];
+    if (!field->buildop)
+      continue;
+    uint64_t state;
+    ierr = CeedOperatorGetBuildState(field->buildop, field->buildinput, &state);
+    CeedChk(ierr);
+    if (field->built && state == field->buildstate)
+      continue;
+    ierr = CeedOperatorApply(field->buildop, field->buildinput, field->vec,
+                             CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+    ierr = CeedOperatorGetBuildState(field->buildop, field->buildinput,
+                                     &field->buildstate); CeedChk(ierr);
+    field->built = true;
   }
 
   return 0;
 }
 
 /**
-  @brief Find the active vector basis for a CeedOperator
+  @brief Zero the quadrature point values of the reduced output fields of a
+           CeedOperator, before they are summed into by CeedOperatorApplyAdd()
 
-  @param[in] op            CeedOperator to find active basis for
-  @param[out] activeBasis  Basis for active input vector
+  @param[in] op   CeedOperator about to be applied
+  @param results  Also set the result vectors to the identity of their
+                    reduction, so suboperators of a composite CeedOperator
+                    combine their reductions with it
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ ref Developer
+  @ref Developer
 **/
-static int CeedOperatorGetActiveBasis(CeedOperator op,
-                                      CeedBasis *activeBasis) {
-  *activeBasis = NULL;
-  for (int i = 0; i < op->qf->numinputfields; i++)
-    if (op->inputfields[i]->vec == CEED_VECTOR_ACTIVE) {
-      *activeBasis = op->inputfields[i]->basis;
-      break;
-    }
+static int CeedOperatorResetReducedOutputs(CeedOperator op, bool results) {
+  int ierr;
 
-  if (!*activeBasis) {
-    // LCOV_EXCL_START
-    int ierr;
-    Ceed ceed;
-    ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
-    return CeedError(ceed, 1,
-                     "No active basis found for automatic multigrid setup");
-    // LCOV_EXCL_STOP
+  if (op->composite) {
+    for (CeedInt i=0; i<op->numsub; i++) {
+      ierr = CeedOperatorResetReducedOutputs(op->suboperators[i], results);
+      CeedChk(ierr);
+    }
+    return 0;
+  }
+  for (CeedInt i=0; i<op->qf->numoutputfields; i++) {
+    CeedOperatorField field = op->outputfields[i];
+    if (!field->reduction)
+      continue;
+    ierr = CeedVectorSetValue(field->vec, 0.0); CeedChk(ierr);
+    if (results) {
+      const CeedScalar identity[] = {[CEED_REDUCE_SUM] = 0.0,
+                                     [CEED_REDUCE_MAX] = -INFINITY,
+                                     [CEED_REDUCE_MIN] = INFINITY
+                                    };
+      ierr = CeedVectorSetValue(field->reduction, identity[field->rtype]);
+      CeedChk(ierr);
+    }
   }
   return 0;
 }
 
-
 /**
-  @brief Common code for creating a multigrid coarse operator and level
-           transfer operators for a CeedOperator
+  @brief Reduce the quadrature point values of the reduced output fields of a
+           CeedOperator into their result vectors, after it is applied
 
-  @param[in] opFine       Fine grid operator
-  @param[in] PMultFine    L-vector multiplicity in parallel gather/scatter
-  @param[in] rstrCoarse   Coarse grid restriction
-  @param[in] basisCoarse  Coarse grid active vector basis
-  @param[in] basisCtoF    Basis for coarse to fine interpolation
-  @param[out] opCoarse    Coarse grid operator
-  @param[out] opProlong   Coarse to fine operator
-  @param[out] opRestrict  Fine to coarse operator
+  @param[in] op  CeedOperator that was applied
+  @param add     Combine the reductions with the values in the result vectors
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref Developer
 **/
-static int CeedOperatorMultigridLevel_Core(CeedOperator opFine,
-    CeedVector PMultFine, CeedElemRestriction rstrCoarse, CeedBasis basisCoarse,
-    CeedBasis basisCtoF, CeedOperator *opCoarse, CeedOperator *opProlong,
-    CeedOperator *opRestrict) {
+static int CeedOperatorReduceOutputs(CeedOperator op, bool add) {
   int ierr;
-  Ceed ceed;
-  ierr = CeedOperatorGetCeed(opFine, &ceed); CeedChk(ierr);
-
-  // Check for composite operator
-  bool isComposite;
-  ierr = CeedOperatorIsComposite(opFine, &isComposite); CeedChk(ierr);
-  if (isComposite)
-    // LCOV_EXCL_START
-    return CeedError(ceed, 1,
-                     "Automatic multigrid setup for composite operators not supported");
-  // LCOV_EXCL_STOP
 
-  // Coarse Grid
-  ierr = CeedOperatorCreate(ceed, opFine->qf, opFine->dqf, opFine->dqfT,
-                            opCoarse); CeedChk(ierr);
-  CeedElemRestriction rstrFine = NULL;
-  // -- Clone input fields
-  for (int i = 0; i < opFine->qf->numinputfields; i++) {
-    if (opFine->inputfields[i]->vec == CEED_VECTOR_ACTIVE) {
-      rstrFine = opFine->inputfields[i]->Erestrict;
-      ierr = CeedOperatorSetField(*opCoarse, opFine->inputfields[i]->fieldname,
-                                  rstrCoarse, basisCoarse, CEED_VECTOR_ACTIVE);
+  if (op->composite) {
+    for (CeedInt i=0; i<op->numsub; i++) {
+      ierr = CeedOperatorReduceOutputs(op->suboperators[i], add);
       CeedChk(ierr);
-    } else {
-      ierr = CeedOperatorSetField(*opCoarse, opFine->inputfields[i]->fieldname,
-                                  opFine->inputfields[i]->Erestrict,
-                                  opFine->inputfields[i]->basis,
-                                  opFine->inputfields[i]->vec); CeedChk(ierr);
     }
+    return 0;
   }
-  // -- Clone output fields
-  for (int i = 0; i < opFine->qf->numoutputfields; i++) {
-    if (opFine->outputfields[i]->vec == CEED_VECTOR_ACTIVE) {
-      ierr = CeedOperatorSetField(*opCoarse, opFine->outputfields[i]->fieldname,
-                                  rstrCoarse, basisCoarse, CEED_VECTOR_ACTIVE);
-      CeedChk(ierr);
-    } else {
-      ierr = CeedOperatorSetField(*opCoarse, opFine->outputfields[i]->fieldname,
-                                  opFine->outputfields[i]->Erestrict,
-                                  opFine->outputfields[i]->basis,
-                                  opFine->outputfields[i]->vec); CeedChk(ierr);
+  for (CeedInt i=0; i<op->qf->numoutputfields; i++) {
+    CeedOperatorField field = op->outputfields[i];
+    if (field->reduction) {
+      ierr = CeedVectorReduceSegments(field->vec, field->rtype, add,
+                                      field->reduction); CeedChk(ierr);
     }
   }
+  return 0;
+}
 
-  // Multiplicity vector
-  CeedVector multVec, multE;
-  ierr = CeedElemRestrictionCreateVector(rstrFine, &multVec, &multE);
-  CeedChk(ierr);
-  ierr = CeedVectorSetValue(multE, 0.0); CeedChk(ierr);
-  ierr = CeedElemRestrictionApply(rstrFine, CEED_NOTRANSPOSE, PMultFine, multE,
-                                  CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
-  ierr = CeedVectorSetValue(multVec, 0.0); CeedChk(ierr);
-  ierr = CeedElemRestrictionApply(rstrFine, CEED_TRANSPOSE, multE, multVec,
-                                  CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
-  ierr = CeedVectorDestroy(&multE); CeedChk(ierr);
-  ierr = CeedVectorReciprocal(multVec); CeedChk(ierr);
+/**
+  @brief Balance the element split of a split sharded CeedOperator
 
-  // Restriction
-  CeedInt ncomp;
-  ierr = CeedBasisGetNumComponents(basisCoarse, &ncomp); CeedChk(ierr);
-  CeedQFunction qfRestrict;
-  ierr = CeedQFunctionCreateInteriorByName(ceed, "Scale", &qfRestrict);
-  CeedChk(ierr);
-  CeedInt *ncompRData;
-  ierr = CeedCalloc(1, &ncompRData); CeedChk(ierr);
-  ncompRData[0] = ncomp;
-  CeedQFunctionContext ctxR;
-  ierr = CeedQFunctionContextCreate(ceed, &ctxR); CeedChk(ierr);
-  ierr = CeedQFunctionContextSetData(ctxR, CEED_MEM_HOST, CEED_OWN_POINTER,
-                                     sizeof(*ncompRData), ncompRData);
+  The elements are split again in proportion to the throughput of each shard
+    in the last apply. Every shard keeps at least one element, when there are
+    enough, so that its throughput is measured again.
+
+  @param op        Split sharded CeedOperator
+  @param time      Time of each shard in the last apply, in seconds
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedShardedOperatorBalanceSplit(CeedOperator op,
+    const double *time) {
+  int ierr;
+  const CeedInt numops = op->numsub, nelem = op->splitfirst[numops],
+                minelem = nelem >= numops ? 1 : 0;
+  double rate[CEED_COMPOSITE_MAX], totalrate = 0, partialrate = 0;
+  CeedInt first[CEED_COMPOSITE_MAX+1];
+
+  // Throughput of each shard, in elements per second
+  for (CeedInt s=0; s<numops; s++) {
+    rate[s] = (op->splitfirst[s+1] - op->splitfirst[s]) /
+              (time[s] > 1e-9 ? time[s] : 1e-9);
+    totalrate += rate[s];
+  }
+  if (totalrate <= 0)
+    return 0;
+
+  // Split the elements in proportion
+  first[0] = 0;
+  for (CeedInt s=0; s<numops; s++) {
+    partialrate += rate[s];
+    CeedInt last = s == numops-1 ? nelem :
+                   (CeedInt)(nelem*partialrate/totalrate + 0.5);
+    if (last < first[s] + minelem)
+      last = first[s] + minelem;
+    if (last > nelem - minelem*(numops-1-s))
+      last = nelem - minelem*(numops-1-s);
+    first[s+1] = last;
+  }
+
+  // Replace the shards whose elements changed
+  for (CeedInt s=0; s<numops; s++) {
+    if (first[s] != op->splitfirst[s] || first[s+1] != op->splitfirst[s+1]) {
+      CeedOperator shard;
+      ierr = CeedSetCurrentDevice(op->splitops[s]->ceed); CeedChk(ierr);
+      ierr = CeedOperatorCreateSubsetRange(op->splitops[s], first[s],
+                                           first[s+1], &shard); CeedChk(ierr);
+      ierr = CeedOperatorDestroy(&op->suboperators[s]); CeedChk(ierr);
+      op->suboperators[s] = shard;
+    }
+  }
+  for (CeedInt s=0; s<=numops; s++)
+    op->splitfirst[s] = first[s];
+  ierr = CeedSetCurrentDevice(op->ceed); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Apply a sharded CeedOperator and add the result to the output vector
+
+  The input is copied to an L-vector of each shard through host memory, the
+    shards are applied on their devices, and their outputs are summed on the
+    host. Each shard is launched before any output is read back, so shards on
+    different devices run concurrently. Shards on device memory are launched
+    first, so that the shards on the host overlap them.
+
+  While the split of a sharded operator from
+    @ref CeedShardedOperatorCreateSplit() is balanced, each shard is instead
+    timed to completion in turn.
+
+  @param op        Sharded CeedOperator
+  @param[in] in    Input CeedVector or @ref CEED_VECTOR_NONE
+  @param[out] out  Output CeedVector or @ref CEED_VECTOR_NONE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorApplyAddSharded(CeedOperator op, CeedVector in,
+                                       CeedVector out) {
+  int ierr;
+  const CeedScalar *inarray = NULL;
+  const bool timed = op->splitops && out != CEED_VECTOR_NONE &&
+                     op->splitapplies < CEED_SPLIT_TIMED_APPLIES;
+  double time[CEED_COMPOSITE_MAX];
+
+  if (in != CEED_VECTOR_NONE) {
+    ierr = CeedVectorGetArrayRead(in, CEED_MEM_HOST, &inarray); CeedChk(ierr);
+  }
+  for (CeedInt pass=0; pass<2; pass++)
+    for (CeedInt s=0; s<op->numsub; s++) {
+      CeedOperator shard = op->suboperators[s];
+      CeedVector shardin = CEED_VECTOR_NONE, shardout = CEED_VECTOR_NONE;
+      CeedMemType memtype;
+      struct timespec start, end;
+
+      ierr = CeedGetPreferredMemType(shard->ceed, &memtype); CeedChk(ierr);
+      if ((memtype == CEED_MEM_HOST) != (pass == 1))
+        continue;
+      ierr = CeedSetCurrentDevice(shard->ceed); CeedChk(ierr);
+      if (timed)
+        clock_gettime(CLOCK_MONOTONIC, &start);
+      if (in != CEED_VECTOR_NONE) {
+        if (!op->shardin[s]) {
+          ierr = CeedVectorCreate(shard->ceed, in->length, &op->shardin[s]);
+          CeedChk(ierr);
+          ierr = CeedVectorSetMemoryClass(op->shardin[s], CEED_MEMORY_EVECTOR);
+          CeedChk(ierr);
+        }
+        shardin = op->shardin[s];
+        ierr = CeedVectorSetArray(shardin, CEED_MEM_HOST, CEED_COPY_VALUES,
+                                  (CeedScalar *)inarray); CeedChk(ierr);
+      }
+      if (out != CEED_VECTOR_NONE) {
+        if (!op->shardout[s]) {
+          ierr = CeedVectorCreate(shard->ceed, out->length, &op->shardout[s]);
+          CeedChk(ierr);
+          ierr = CeedVectorSetMemoryClass(op->shardout[s],
+                                          CEED_MEMORY_EVECTOR); CeedChk(ierr);
+        }
+        shardout = op->shardout[s];
+      }
+      ierr = CeedOperatorApply(shard, shardin, shardout, CEED_REQUEST_ORDERED);
+      CeedChk(ierr);
+      if (timed) {
+        // Reading the output back waits for the shard to complete
+        const CeedScalar *shardarray;
+        ierr = CeedVectorGetArrayRead(shardout, CEED_MEM_HOST, &shardarray);
+        CeedChk(ierr);
+        ierr = CeedVectorRestoreArrayRead(shardout, &shardarray);
+        CeedChk(ierr);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        time[s] = (end.tv_sec - start.tv_sec) +
+                  1e-9*(end.tv_nsec - start.tv_nsec);
+      }
+    }
+  if (in != CEED_VECTOR_NONE) {
+    ierr = CeedVectorRestoreArrayRead(in, &inarray); CeedChk(ierr);
+  }
+
+  // Sum the shard outputs
+  if (out != CEED_VECTOR_NONE) {
+    CeedScalar *outarray;
+    ierr = CeedSetCurrentDevice(op->ceed); CeedChk(ierr);
+    ierr = CeedVectorGetArray(out, CEED_MEM_HOST, &outarray); CeedChk(ierr);
+    for (CeedInt s=0; s<op->numsub; s++) {
+      const CeedScalar *shardarray;
+      ierr = CeedSetCurrentDevice(op->suboperators[s]->ceed); CeedChk(ierr);
+      ierr = CeedVectorGetArrayRead(op->shardout[s], CEED_MEM_HOST,
+                                    &shardarray); CeedChk(ierr);
+      for (CeedInt i=0; i<out->length; i++)
+        outarray[i] += shardarray[i];
+      ierr = CeedVectorRestoreArrayRead(op->shardout[s], &shardarray);
+      CeedChk(ierr);
+    }
+    ierr = CeedSetCurrentDevice(op->ceed); CeedChk(ierr);
+    ierr = CeedVectorRestoreArray(out, &outarray); CeedChk(ierr);
+  }
+  ierr = CeedSetCurrentDevice(op->ceed); CeedChk(ierr);
+
+  // Balance the split
+  if (timed) {
+    ierr = CeedShardedOperatorBalanceSplit(op, time); CeedChk(ierr);
+    op->splitapplies++;
+  }
+  return 0;
+}
+
+/**
+  @brief Apply a Chebyshev smoother and add the result to the output vector
+
+  With the bounds [lmin, lmax] of the spectrum of D^-1 A, this adds the
+    Chebyshev polynomial approximation of A^-1 in, computed with the
+    three-term recurrence from a zero initial guess. Each sweep after the
+    first applies A once; the inverse diagonal scaling and the vector updates
+    of a sweep are fused into a single pass by CeedVectorChebyshevUpdate().
+
+  @param op        Chebyshev smoother CeedOperator
+  @param[in] in    Input CeedVector
+  @param[out] out  Output CeedVector to add the result to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorApplyAddChebyshev(CeedOperator op, CeedVector in,
+    CeedVector out) {
+  int ierr;
+  const CeedScalar theta = (op->smoothlmax + op->smoothlmin) / 2;
+  const CeedScalar delta = (op->smoothlmax - op->smoothlmin) / 2;
+  const CeedScalar sigma = theta / delta;
+  CeedScalar rho = 1 / sigma;
+
+  // First sweep, d = D^-1 in / theta
+  ierr = CeedVectorPointwiseMult(op->smoothr, op->smoothdinv, in);
   CeedChk(ierr);
-  ierr = CeedQFunctionSetContext(qfRestrict, ctxR); CeedChk(ierr);
-  ierr = CeedQFunctionContextDestroy(&ctxR); CeedChk(ierr);
-  ierr = CeedQFunctionAddInput(qfRestrict, "input", ncomp, CEED_EVAL_NONE);
+  ierr = CeedVectorChebyshevUpdate(out, op->smoothd, op->smoothr,
+                                   CEED_VECTOR_NONE, op->smoothdinv, 0.0,
+                                   1 / theta); CeedChk(ierr);
+  // Remaining sweeps
+  for (CeedInt k=1; k<op->smoothdegree; k++) {
+    ierr = CeedOperatorApply(op->smoothop, op->smoothd, op->smoothw,
+                             CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+    const CeedScalar rhonew = 1 / (2*sigma - rho);
+    ierr = CeedVectorChebyshevUpdate(out, op->smoothd, op->smoothr,
+                                     op->smoothw, op->smoothdinv, rhonew*rho,
+                                     2*rhonew / delta); CeedChk(ierr);
+    rho = rhonew;
+  }
+  return 0;
+}
+
+/**
+  @brief QFunction of fused suboperators, calling the user function of each
+           suboperator with its fields among the fused fields
+
+  Outputs shared with an earlier suboperator are written to scratch and added.
+
+  @ref Developer
+**/
+static int CeedOperatorFusedQFunction(void *ctx, const CeedInt Q,
+                                      const CeedScalar *const *in,
+                                      CeedScalar *const *out) {
+  int ierr;
+  CeedOperatorFusion *fusion = ctx;
+  const CeedScalar *subin[fusion->maxfields];
+  CeedScalar *subout[fusion->maxfields], *scratch = NULL;
+
+  if (fusion->scratchsize) {
+    ierr = CeedMalloc(fusion->scratchsize*Q, &scratch); CeedChk(ierr);
+  }
+  for (CeedInt s=0; s<fusion->numsub; s++) {
+    const CeedInt instart = fusion->instart[s],
+                  outstart = fusion->outstart[s];
+    for (CeedInt i=instart; i<fusion->instart[s+1]; i++)
+      subin[i-instart] = in[fusion->inmap[i]];
+    size_t offset = 0;
+    for (CeedInt i=outstart; i<fusion->outstart[s+1]; i++)
+      if (fusion->outadd[i]) {
+        subout[i-outstart] = &scratch[offset];
+        offset += fusion->outsize[i]*Q;
+      } else {
+        subout[i-outstart] = out[fusion->outmap[i]];
+      }
+
+    void *data = fusion->ctxindex[s] < 0 ? NULL :
+                 fusion->ctxdata[fusion->ctxindex[s]];
+    ierr = fusion->f[s](data, Q, subin, subout); CeedChk(ierr);
+
+    for (CeedInt i=outstart; i<fusion->outstart[s+1]; i++)
+      if (fusion->outadd[i]) {
+        CeedScalar *v = out[fusion->outmap[i]];
+        for (CeedInt j=0; j<fusion->outsize[i]*Q; j++)
+          v[j] += subout[i-outstart][j];
+      }
+  }
+  ierr = CeedFree(&scratch); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Destroy the fused operator of a composite CeedOperator, to be decided
+           again at the next application
+
+  @param op  Composite CeedOperator
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedCompositeOperatorDestroyFusion(CeedOperator op) {
+  int ierr;
+  ierr = CeedOperatorDestroy(&op->fusedop); CeedChk(ierr);
+  if (op->fusion) {
+    ierr = CeedFree(&op->fusion->inmap); CeedChk(ierr);
+    ierr = CeedFree(&op->fusion->outmap); CeedChk(ierr);
+    ierr = CeedFree(&op->fusion->outsize); CeedChk(ierr);
+    ierr = CeedFree(&op->fusion->outadd); CeedChk(ierr);
+    ierr = CeedFree(&op->fusion); CeedChk(ierr);
+  }
+  op->fusionchecked = false;
+  return 0;
+}
+
+/**
+  @brief Fuse the suboperators of a composite CeedOperator sharing fields
+
+  Suboperators such as mass and stiffness terms often read the same input
+    through the same restriction and basis, and write the same output. When
+    some field is shared, the suboperators are fused into one operator whose
+    QFunction calls each user function in turn, so shared inputs are restricted
+    and interpolated once, and shared outputs are summed at quadrature points
+    and projected once. Fusion applies to backends preferring host memory,
+    where user functions are called directly, and to suboperators with active
+    outputs only.
+
+  @param op  Composite CeedOperator
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedCompositeOperatorFuse(CeedOperator op) {
+  int ierr;
+  op->fusionchecked = true;
+  CeedMemType mtype;
+  ierr = CeedGetPreferredMemType(op->ceed, &mtype); CeedChk(ierr);
+  if (mtype != CEED_MEM_HOST || op->sharded || op->numsub < 2)
+    return 0;
+
+  // Suboperators applied matrix-free with only active outputs
+  CeedOperator *subs = op->suboperators;
+  CeedInt totalin = 0, totalout = 0;
+  for (CeedInt s=0; s<op->numsub; s++) {
+    CeedOperator sub = subs[s];
+    CeedQFunction qf = sub->qf;
+    if (sub->composite || sub->smoothop || sub->chainops[0] ||
+        sub->ematmode != CEED_ELEMMATRIX_NEVER || !sub->numelements ||
+        !qf->function || sub->ceed != subs[0]->ceed ||
+        sub->numelements != subs[0]->numelements ||
+        sub->numqpoints != subs[0]->numqpoints)
+      return 0;
+    for (CeedInt i=0; i<qf->numinputfields; i++)
+      if (sub->inputfields[i]->storage != CEED_STORAGE_SCALAR)
+        return 0;
+    for (CeedInt i=0; i<qf->numoutputfields; i++)
+      if (sub->outputfields[i]->vec != CEED_VECTOR_ACTIVE ||
+          sub->outputfields[i]->reduction)
+        return 0;
+    totalin += qf->numinputfields;
+    totalout += qf->numoutputfields;
+  }
+
+  // Map fields of the suboperators to distinct fused fields
+  CeedOperatorFusion *fusion;
+  ierr = CeedCalloc(1, &fusion); CeedChk(ierr);
+  ierr = CeedCalloc(totalin, &fusion->inmap); CeedChk(ierr);
+  ierr = CeedCalloc(totalout, &fusion->outmap); CeedChk(ierr);
+  ierr = CeedCalloc(totalout, &fusion->outsize); CeedChk(ierr);
+  ierr = CeedCalloc(totalout, &fusion->outadd); CeedChk(ierr);
+  CeedOperatorField opin[totalin], opout[totalout];
+  CeedQFunctionField qfin[totalin], qfout[totalout];
+  CeedInt numin = 0, numout = 0, kin = 0, kout = 0;
+  fusion->numsub = op->numsub;
+  fusion->maxfields = 1;
+  for (CeedInt s=0; s<op->numsub; s++) {
+    CeedQFunction qf = subs[s]->qf;
+    fusion->instart[s] = kin;
+    fusion->outstart[s] = kout;
+    fusion->maxfields = CeedIntMax(fusion->maxfields,
+                                   CeedIntMax(qf->numinputfields,
+                                              qf->numoutputfields));
+    fusion->f[s] = qf->function;
+    fusion->ctxindex[s] = -1;
+    if (qf->ctx) {
+      CeedInt j = 0;
+      while (j < fusion->numctx && fusion->ctx[j] != qf->ctx)
+        j++;
+      if (j == fusion->numctx)
+        fusion->ctx[fusion->numctx++] = qf->ctx;
+      fusion->ctxindex[s] = j;
+    }
+    for (CeedInt i=0; i<qf->numinputfields; i++, kin++) {
+      CeedOperatorField field = subs[s]->inputfields[i];
+      CeedQFunctionField qffield = qf->inputfields[i];
+      CeedInt j = 0;
+      while (j < numin && (opin[j]->Erestrict != field->Erestrict ||
+                           opin[j]->basis != field->basis ||
+                           opin[j]->vec != field->vec ||
+                           qfin[j]->emode != qffield->emode ||
+                           qfin[j]->size != qffield->size))
+        j++;
+      if (j == numin) {
+        opin[numin] = field;
+        qfin[numin++] = qffield;
+      }
+      fusion->inmap[kin] = j;
+    }
+    size_t scratch = 0;
+    for (CeedInt i=0; i<qf->numoutputfields; i++, kout++) {
+      CeedOperatorField field = subs[s]->outputfields[i];
+      CeedQFunctionField qffield = qf->outputfields[i];
+      CeedInt j = 0;
+      while (j < numout && (opout[j]->Erestrict != field->Erestrict ||
+                            opout[j]->basis != field->basis ||
+                            qfout[j]->emode != qffield->emode ||
+                            qfout[j]->size != qffield->size))
+        j++;
+      fusion->outadd[kout] = j < numout;
+      if (j == numout) {
+        opout[numout] = field;
+        qfout[numout++] = qffield;
+      } else {
+        scratch += qffield->size;
+      }
+      fusion->outmap[kout] = j;
+      fusion->outsize[kout] = qffield->size;
+    }
+    if (scratch > fusion->scratchsize)
+      fusion->scratchsize = scratch;
+  }
+  fusion->instart[op->numsub] = kin;
+  fusion->outstart[op->numsub] = kout;
+  op->fusion = fusion;
+  if (numin + numout == totalin + totalout) {
+    // Nothing shared
+    ierr = CeedCompositeOperatorDestroyFusion(op); CeedChk(ierr);
+    op->fusionchecked = true;
+    return 0;
+  }
+
+  // Fused QFunction, with a vector length suiting every user function
+  Ceed ceed = subs[0]->ceed;
+  CeedInt vlength = 1;
+  size_t flops = 0;
+  for (CeedInt s=0; s<op->numsub; s++) {
+    CeedInt a = vlength, b = subs[s]->qf->vlength;
+    while (b) {
+      const CeedInt r = a % b;
+      a = b;
+      b = r;
+    }
+    vlength = vlength / a * subs[s]->qf->vlength;
+    flops += subs[s]->qf->userflops;
+  }
+  CeedQFunction qf;
+  ierr = CeedQFunctionCreateInterior(ceed, vlength, CeedOperatorFusedQFunction,
+                                     __FILE__ ":CeedOperatorFusedQFunction",
+                                     &qf); CeedChk(ierr);
+  ierr = CeedQFunctionSetUserFlopsEstimate(qf, flops); CeedChk(ierr);
+  char name[16];
+  for (CeedInt j=0; j<numin; j++) {
+    snprintf(name, sizeof name, "in%d", j);
+    ierr = CeedQFunctionAddInput(qf, name, qfin[j]->size, qfin[j]->emode);
+    CeedChk(ierr);
+  }
+  for (CeedInt j=0; j<numout; j++) {
+    snprintf(name, sizeof name, "out%d", j);
+    ierr = CeedQFunctionAddOutput(qf, name, qfout[j]->size, qfout[j]->emode);
+    CeedChk(ierr);
+  }
+  CeedQFunctionContext ctx;
+  ierr = CeedQFunctionContextCreate(ceed, &ctx); CeedChk(ierr);
+  ierr = CeedQFunctionContextSetData(ctx, CEED_MEM_HOST, CEED_USE_POINTER,
+                                     sizeof(*fusion), fusion); CeedChk(ierr);
+  ierr = CeedQFunctionSetContext(qf, ctx); CeedChk(ierr);
+  ierr = CeedQFunctionContextDestroy(&ctx); CeedChk(ierr);
+
+  // Fused operator
+  ierr = CeedOperatorCreate(ceed, qf, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                            &op->fusedop); CeedChk(ierr);
+  ierr = CeedQFunctionDestroy(&qf); CeedChk(ierr);
+  for (CeedInt j=0; j<numin; j++) {
+    snprintf(name, sizeof name, "in%d", j);
+    ierr = CeedOperatorSetField(op->fusedop, name, opin[j]->Erestrict,
+                                opin[j]->basis, opin[j]->vec); CeedChk(ierr);
+  }
+  for (CeedInt j=0; j<numout; j++) {
+    snprintf(name, sizeof name, "out%d", j);
+    ierr = CeedOperatorSetField(op->fusedop, name, opout[j]->Erestrict,
+                                opout[j]->basis, CEED_VECTOR_ACTIVE);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Apply the fused suboperators of a composite CeedOperator and add the
+           result to the output vector, if the suboperators can be fused
+
+  @param op             Composite CeedOperator
+  @param[in] in         Input CeedVector
+  @param[out] out       Output CeedVector to add the result to
+  @param request        Address of CeedRequest for non-blocking completion,
+                          else @ref CEED_REQUEST_IMMEDIATE
+  @param[out] applied   Variable to store whether the fused operator was
+                          applied
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedCompositeOperatorApplyAddFused(CeedOperator op, CeedVector in,
+    CeedVector out, CeedRequest *request, bool *applied) {
+  int ierr;
+  if (!op->fusionchecked) {
+    ierr = CeedCompositeOperatorFuse(op); CeedChk(ierr);
+  }
+  *applied = op->fusedop != NULL;
+  if (!*applied)
+    return 0;
+
+  // User contexts are read once for all calls of the fused QFunction
+  CeedOperatorFusion *fusion = op->fusion;
+  for (CeedInt i=0; i<fusion->numctx; i++) {
+    ierr = CeedQFunctionContextGetData(fusion->ctx[i], CEED_MEM_HOST,
+                                       &fusion->ctxdata[i]); CeedChk(ierr);
+  }
+  ierr = CeedOperatorApplyAdd(op->fusedop, in, out, request); CeedChk(ierr);
+  for (CeedInt i=0; i<fusion->numctx; i++) {
+    ierr = CeedQFunctionContextRestoreData(fusion->ctx[i],
+                                           &fusion->ctxdata[i]); CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief QFunction of an ensemble CeedOperator, calling the user function with
+           the context of the instance of each run of quadrature points
+
+  The last input holds the instance of each quadrature point. When the points
+    belong to several instances, as for blocked backends packing elements of
+    different instances, the fields of each run of points are gathered to
+    scratch for the user function and its outputs are scattered back.
+
+  @ref Developer
+**/
+static int CeedOperatorEnsembleQFunction(void *ctx, const CeedInt Q,
+    const CeedScalar *const *in,
+    CeedScalar *const *out) {
+  int ierr;
+  CeedOperatorEnsemble *ensemble = ctx;
+  const CeedInt numin = ensemble->numinputs, numout = ensemble->numoutputs;
+  const CeedInt *sizes = ensemble->sizes;
+  const CeedScalar *instance = in[numin];
+  char *ctxdata = (char *)ensemble + ensemble->ctxoffset;
+  const CeedScalar *runin[numin + 1];
+  CeedScalar *runout[numout + 1], *scratch = NULL;
+
+  for (CeedInt q=0, n; q<Q; q+=n) {
+    const CeedInt k = (CeedInt)instance[q];
+    for (n=1; q+n<Q && (CeedInt)instance[q+n] == k; n++);
+    void *data = &ctxdata[k*ensemble->ctxsize];
+    if (n == Q) {
+      ierr = ensemble->f(data, Q, in, out); CeedChk(ierr);
+      break;
+    }
+
+    // Points of one instance
+    if (!scratch) {
+      ierr = CeedMalloc(ensemble->scratchsize*Q, &scratch); CeedChk(ierr);
+    }
+    CeedScalar *v = scratch;
+    for (CeedInt i=0; i<numin; i++) {
+      for (CeedInt c=0; c<sizes[i]; c++)
+        for (CeedInt j=0; j<n; j++)
+          v[c*n + j] = in[i][c*Q + q + j];
+      runin[i] = v;
+      v += sizes[i]*n;
+    }
+    for (CeedInt i=0; i<numout; i++) {
+      runout[i] = v;
+      v += sizes[numin + i]*n;
+    }
+    ierr = ensemble->f(data, n, runin, runout); CeedChk(ierr);
+    for (CeedInt i=0; i<numout; i++)
+      for (CeedInt c=0; c<sizes[numin + i]; c++)
+        for (CeedInt j=0; j<n; j++)
+          out[i][c*Q + q + j] = runout[i][c*n + j];
+  }
+  ierr = CeedFree(&scratch); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Estimate the cost of applying one element of a CeedOperator field
+           matrix-free, in flops, for CeedOperatorUseElementMatrices()
+
+  @param[in] field   CeedOperatorField
+  @param[in] qffield Matching CeedQFunctionField
+  @param[in] tmode   \ref CEED_NOTRANSPOSE for inputs, \ref CEED_TRANSPOSE
+                       for outputs
+  @param[out] flops  Variable to store the flops of the basis action
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorFieldBasisFlops(CeedOperatorField field,
+                                       CeedQFunctionField qffield,
+                                       CeedTransposeMode tmode,
+                                       size_t *flops) {
+  *flops = 0;
+  if (field->basis == CEED_BASIS_COLLOCATED)
+    return 0;
+  return CeedBasisGetFlopsEstimate(field->basis, tmode, qffield->emode, flops);
+}
+
+/**
+  @brief Decide whether a CeedOperator is applied with element matrices
+
+  Element matrices require a single operator whose outputs are all active, with
+    one CeedElemRestriction for the active inputs and one for the active
+    outputs. With @ref CEED_ELEMMATRIX_AUTO they are also only used on host
+    backends, when the roofline cost of reading and applying the dense element
+    matrices, max(flops, 8*words), is below that of the basis actions and the
+    linearized CeedQFunction.
+
+  @param[in] op CeedOperator to check
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorUseElementMatrices(CeedOperator op) {
+  int ierr;
+  CeedQFunction qf = op->qf;
+  CeedElemRestriction rstrin = NULL, rstrout = NULL;
+  bool eligible = !op->composite && !op->sharded && op->numelements;
+  CeedInt activein = 0, activeout = 0, passivein = 0;
+  size_t mfflops = 0, flops;
+
+  op->ematchecked = true;
+  op->ematused = false;
+  if (op->ematmode == CEED_ELEMMATRIX_NEVER)
+    return 0;
+  for (CeedInt i=0; eligible && i<qf->numinputfields; i++) {
+    CeedOperatorField field = op->inputfields[i];
+    if (field->vec == CEED_VECTOR_ACTIVE) {
+      eligible = !rstrin || rstrin == field->Erestrict;
+      rstrin = field->Erestrict;
+      ierr = CeedOperatorFieldBasisFlops(field, qf->inputfields[i],
+                                         CEED_NOTRANSPOSE, &flops);
+      CeedChk(ierr);
+      mfflops += flops;
+      activein += qf->inputfields[i]->size;
+    } else if (field->vec != CEED_VECTOR_NONE) {
+      passivein += qf->inputfields[i]->size;
+    }
+  }
+  for (CeedInt i=0; eligible && i<qf->numoutputfields; i++) {
+    CeedOperatorField field = op->outputfields[i];
+    eligible = field->vec == CEED_VECTOR_ACTIVE &&
+               (!rstrout || rstrout == field->Erestrict);
+    rstrout = field->Erestrict;
+    ierr = CeedOperatorFieldBasisFlops(field, qf->outputfields[i],
+                                       CEED_TRANSPOSE, &flops);
+    CeedChk(ierr);
+    mfflops += flops;
+    activeout += qf->outputfields[i]->size;
+  }
+  eligible = eligible && rstrin && rstrout;
+  if (!eligible) {
+    if (op->ematmode == CEED_ELEMMATRIX_ALWAYS)
+      // LCOV_EXCL_START
+      return CeedError(op->ceed, 1, "Element matrices require a single "
+                       "operator with only active outputs and one restriction "
+                       "for the active inputs and outputs");
+    // LCOV_EXCL_STOP
+    return 0;
+  }
+
+  if (op->ematmode == CEED_ELEMMATRIX_AUTO) {
+    CeedMemType memtype;
+    ierr = CeedGetPreferredMemType(op->ceed, &memtype); CeedChk(ierr);
+    if (memtype != CEED_MEM_HOST)
+      return 0;
+    const CeedInt Q = op->numqpoints / op->numelements;
+    const size_t sizein = rstrin->elemsize*rstrin->ncomp,
+                   sizeout = rstrout->elemsize*rstrout->ncomp;
+    // Matrix-free reads the E-vectors and passive inputs, and applies the bases
+    //   and at least the linearized QFunction
+    mfflops += 2*(size_t)activein*activeout*Q;
+    const size_t mfwords = sizein + sizeout + (size_t)passivein*Q;
+    const size_t ematflops = 2*sizein*sizeout,
+                   ematwords = sizein*sizeout + sizein + sizeout;
+    const size_t ematcost = ematflops > 8*ematwords ? ematflops : 8*ematwords,
+                 mfcost = mfflops > 8*mfwords ? mfflops : 8*mfwords;
+    op->ematused = ematcost < mfcost;
+  } else {
+    op->ematused = true;
+  }
+  return 0;
+}
+
+/**
+  @brief Create the storage of the dense element matrices of a CeedOperator
+
+  @param[in] op CeedOperator with a single restriction for its active inputs
+                  and one for its active outputs
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorCreateElementMatrices(CeedOperator op) {
+  int ierr;
+  CeedElemRestriction rstrin = NULL, rstrout = NULL;
+  for (CeedInt i=0; i<op->qf->numinputfields && !rstrin; i++)
+    if (op->inputfields[i]->vec == CEED_VECTOR_ACTIVE)
+      rstrin = op->inputfields[i]->Erestrict;
+  if (op->qf->numoutputfields)
+    rstrout = op->outputfields[0]->Erestrict;
+  if (!rstrin || !rstrout)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Element matrices require active inputs and "
+                     "outputs");
+  // LCOV_EXCL_STOP
+  const CeedInt sizein = rstrin->elemsize*rstrin->ncomp,
+                sizeout = rstrout->elemsize*rstrout->ncomp;
+
+  ierr = CeedVectorCreate(op->ceed, op->numelements*sizein*sizeout, &op->emat);
   CeedChk(ierr);
-  ierr = CeedQFunctionAddInput(qfRestrict, "scale", ncomp, CEED_EVAL_NONE);
+  ierr = CeedVectorSetMemoryClass(op->emat, CEED_MEMORY_ASSEMBLED);
   CeedChk(ierr);
-  ierr = CeedQFunctionAddOutput(qfRestrict, "output", ncomp, CEED_EVAL_INTERP);
+  ierr = CeedElemRestrictionCreateVector(rstrin, NULL, &op->ematin);
   CeedChk(ierr);
-
-  ierr = CeedOperatorCreate(ceed, qfRestrict, CEED_QFUNCTION_NONE,
-                            CEED_QFUNCTION_NONE, opRestrict);
+  ierr = CeedVectorSetMemoryClass(op->ematin, CEED_MEMORY_EVECTOR);
   CeedChk(ierr);
-  ierr = CeedOperatorSetField(*opRestrict, "input", rstrFine,
-                              CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+  ierr = CeedElemRestrictionCreateVector(rstrout, NULL, &op->ematout);
   CeedChk(ierr);
-  ierr = CeedOperatorSetField(*opRestrict, "scale", rstrFine,
-                              CEED_BASIS_COLLOCATED, multVec);
+  ierr = CeedVectorSetMemoryClass(op->ematout, CEED_MEMORY_EVECTOR);
   CeedChk(ierr);
-  ierr = CeedOperatorSetField(*opRestrict, "output", rstrCoarse, basisCtoF,
-                              CEED_VECTOR_ACTIVE); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Apply a CeedOperator with dense element matrices, adding the result
+
+  The element matrices are assembled with CeedOperatorLinearAssemble(), which
+    stores the entries of each element as a dense row-major block
+    [comp out, node out, comp in, node in], and are reassembled whenever the
+    passive inputs or CeedQFunctionContext of the operator change state.
+
+  @param op        CeedOperator to apply
+  @param[in] in    Active input CeedVector
+  @param[out] out  Active output CeedVector
+  @param request   Address of CeedRequest for non-blocking completion, else
+                     @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorApplyAddElementMatrices(CeedOperator op, CeedVector in,
+    CeedVector out, CeedRequest *request) {
+  int ierr;
+  CeedQFunction qf = op->qf;
+  CeedElemRestriction rstrin = NULL, rstrout = op->outputfields[0]->Erestrict;
+  for (CeedInt i=0; i<qf->numinputfields && !rstrin; i++)
+    if (op->inputfields[i]->vec == CEED_VECTOR_ACTIVE)
+      rstrin = op->inputfields[i]->Erestrict;
+  const CeedInt nelem = op->numelements,
+                elemsizein = rstrin->elemsize, ncompin = rstrin->ncomp,
+                elemsizeout = rstrout->elemsize, ncompout = rstrout->ncomp,
+                sizein = elemsizein*ncompin, sizeout = elemsizeout*ncompout;
+
+  // Assemble element matrices
+  uint64_t state;
+  ierr = CeedOperatorGetBuildState(op, CEED_VECTOR_NONE, &state); CeedChk(ierr);
+  if (!op->emat || state != op->ematstate) {
+    if (!op->emat) {
+      ierr = CeedOperatorCreateElementMatrices(op); CeedChk(ierr);
+    }
+    ierr = CeedOperatorLinearAssemble(op, op->emat); CeedChk(ierr);
+    // Record the state after assembly, applying the QFunction reads its context
+    ierr = CeedOperatorGetBuildState(op, CEED_VECTOR_NONE, &op->ematstate);
+    CeedChk(ierr);
+  }
+
+  // Apply element matrices in the backend E-vector layout
+  CeedInt layoutin[3], layoutout[3];
+  ierr = CeedElemRestrictionGetELayout(rstrin, &layoutin); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetELayout(rstrout, &layoutout); CeedChk(ierr);
+  ierr = CeedElemRestrictionApply(rstrin, CEED_NOTRANSPOSE, in, op->ematin,
+                                  request); CeedChk(ierr);
+  const CeedScalar *emat, *ein;
+  CeedScalar *eout;
+  ierr = CeedVectorGetArrayRead(op->emat, CEED_MEM_HOST, &emat); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(op->ematin, CEED_MEM_HOST, &ein); CeedChk(ierr);
+  ierr = CeedVectorGetArray(op->ematout, CEED_MEM_HOST, &eout); CeedChk(ierr);
+  for (CeedInt e=0; e<nelem; e++) {
+    const CeedScalar *mat = &emat[(size_t)e*sizeout*sizein];
+    for (CeedInt compout=0; compout<ncompout; compout++)
+      for (CeedInt nout=0; nout<elemsizeout; nout++) {
+        const CeedScalar *row = &mat[(compout*elemsizeout+nout)*sizein];
+        CeedScalar sum = 0.0;
+        for (CeedInt compin=0; compin<ncompin; compin++)
+          for (CeedInt nin=0; nin<elemsizein; nin++)
+            sum += row[compin*elemsizein+nin] *
+                   ein[nin*layoutin[0] + compin*layoutin[1] + e*layoutin[2]];
+        eout[nout*layoutout[0] + compout*layoutout[1] + e*layoutout[2]] = sum;
+      }
+  }
+  ierr = CeedVectorRestoreArrayRead(op->emat, &emat); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(op->ematin, &ein); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(op->ematout, &eout); CeedChk(ierr);
+  ierr = CeedElemRestrictionApply(rstrout, CEED_TRANSPOSE, op->ematout, out,
+                                  request); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief View a field of a CeedOperator
+
+  @param[in] field       Operator field to view
+  @param[in] qffield     QFunction field (carries field name)
+  @param[in] fieldnumber Number of field being viewed
+  @param[in] sub         true indicates sub-operator, which increases indentation; false for top-level operator
+  @param[in] in          true for an input field; false for output field
+  @param[in] stream      Stream to view to, e.g., stdout
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Utility
+**/
+static int CeedOperatorFieldView(CeedOperatorField field,
+                                 CeedQFunctionField qffield,
+                                 CeedInt fieldnumber, bool sub, bool in,
+                                 FILE *stream) {
+  const char *pre = sub ? "  " : "";
+  const char *inout = in ? "Input" : "Output";
+
+  fprintf(stream, "%s    %s Field [%d]:\n"
+          "%s      Name: \"%s\"\n",
+          pre, inout, fieldnumber, pre, qffield->fieldname);
+
+  if (field->basis == CEED_BASIS_COLLOCATED)
+    fprintf(stream, "%s      Collocated basis\n", pre);
+
+  if (field->vec == CEED_VECTOR_ACTIVE)
+    fprintf(stream, "%s      Active vector\n", pre);
+  else if (field->vec == CEED_VECTOR_NONE)
+    fprintf(stream, "%s      No vector\n", pre);
+
+  if (field->storage != CEED_STORAGE_SCALAR)
+    fprintf(stream, "%s      Stored as %s\n", pre,
+            CeedStorageTypes[field->storage]);
+
+  return 0;
+}
+
+/**
+  @brief View a single CeedOperator
+
+  @param[in] op     CeedOperator to view
+  @param[in] sub    Boolean flag for sub-operator
+  @param[in] stream Stream to write; typically stdout/stderr or a file
+
+  @return Error code: 0 - success, otherwise - failure
+
+  @ref Utility
+**/
+int CeedOperatorSingleView(CeedOperator op, bool sub, FILE *stream) {
+  int ierr;
+  const char *pre = sub ? "  " : "";
+
+  CeedInt totalfields;
+  ierr = CeedOperatorGetNumArgs(op, &totalfields); CeedChk(ierr);
+
+  fprintf(stream, "%s  %d Field%s\n", pre, totalfields, totalfields>1 ? "s" : "");
+
+  fprintf(stream, "%s  %d Input Field%s:\n", pre, op->qf->numinputfields,
+          op->qf->numinputfields>1 ? "s" : "");
+  for (CeedInt i=0; i<op->qf->numinputfields; i++) {
+    ierr = CeedOperatorFieldView(op->inputfields[i], op->qf->inputfields[i],
+                                 i, sub, 1, stream); CeedChk(ierr);
+  }
+
+  fprintf(stream, "%s  %d Output Field%s:\n", pre, op->qf->numoutputfields,
+          op->qf->numoutputfields>1 ? "s" : "");
+  for (CeedInt i=0; i<op->qf->numoutputfields; i++) {
+    ierr = CeedOperatorFieldView(op->outputfields[i], op->qf->outputfields[i],
+                                 i, sub, 0, stream); CeedChk(ierr);
+  }
+
+  if (op->profiledata.count[CEED_PROFILE_OPERATOR]) {
+    ierr = CeedProfileView(&op->profiledata, sub ? "    " : "  ", stream);
+    CeedChk(ierr);
+  }
+  if (op->numkernels) {
+    ierr = CeedKernelInfoView(op->kernels, NULL, op->numkernels,
+                              sub ? "    " : "  ", stream); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+/**
+  @brief Find the active vector basis for a CeedOperator
+
+  @param[in] op            CeedOperator to find active basis for
+  @param[out] activeBasis  Basis for active input vector
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ ref Developer
+**/
+static int CeedOperatorGetActiveBasis(CeedOperator op,
+                                      CeedBasis *activeBasis) {
+  *activeBasis = NULL;
+  for (int i = 0; i < op->qf->numinputfields; i++)
+    if (op->inputfields[i]->vec == CEED_VECTOR_ACTIVE) {
+      *activeBasis = op->inputfields[i]->basis;
+      break;
+    }
+
+  if (!*activeBasis) {
+    // LCOV_EXCL_START
+    int ierr;
+    Ceed ceed;
+    ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+    return CeedError(ceed, 1,
+                     "No active basis found for automatic multigrid setup");
+    // LCOV_EXCL_STOP
+  }
+  return 0;
+}
+
+
+/**
+  @brief Create a single component CeedElemRestriction for the multiplicity of
+           a multi-component CeedElemRestriction
+
+  The new restriction reads the first component of each node. It is only
+    created if the multiplicity vector is the same for all components of every
+    node, so the inverse multiplicity can be stored once per node.
+
+  @param[in] rstr        Multi-component CeedElemRestriction with offsets
+  @param[in] PMult       L-vector multiplicity
+  @param[out] rstrScalar Single component CeedElemRestriction, or NULL if the
+                           multiplicity differs between components
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedElemRestrictionCreateScalarMultiplicity(CeedElemRestriction rstr,
+    CeedVector PMult, CeedElemRestriction *rstrScalar) {
+  int ierr;
+  *rstrScalar = NULL;
+  if (rstr->ncomp == 1 || rstr->strides || rstr->blksize > 1 ||
+      rstr->nsides > 1)
+    return 0;
+
+  const CeedInt *offsets;
+  const CeedScalar *mult;
+  CeedInt size = rstr->nelem*rstr->elemsize;
+  bool uniform = true;
+  ierr = CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets);
+  CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(PMult, CEED_MEM_HOST, &mult); CeedChk(ierr);
+  for (CeedInt i=0; i<size && uniform; i++)
+    for (CeedInt c=1; c<rstr->ncomp; c++)
+      uniform = uniform && mult[offsets[i] + c*rstr->compstride] ==
+                mult[offsets[i]];
+  ierr = CeedVectorRestoreArrayRead(PMult, &mult); CeedChk(ierr);
+  ierr = CeedElemRestrictionRestoreOffsets(rstr, &offsets); CeedChk(ierr);
+  if (uniform) {
+    ierr = CeedElemRestrictionCreateView(rstr, 1, 1, rstr->lsize, rstrScalar);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Set a passive field of a CeedOperator on the Ceed of another operator
+
+  The restriction, basis, and vector of @a field are copied to the Ceed of
+    @a op when they belong to another Ceed. A copied vector holds the values
+    of the vector of @a field when the field is set.
+
+  @param[in,out] op  CeedOperator to set the field on
+  @param[in] field   Passive field of another CeedOperator
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorSetFieldOnCeed(CeedOperator op,
+                                      CeedOperatorField field) {
+  int ierr;
+  CeedElemRestriction rstr = field->Erestrict;
+  CeedBasis basis;
+  CeedVector vec = field->vec;
+
+  if (rstr != CEED_ELEMRESTRICTION_NONE) {
+    ierr = CeedElemRestrictionCreateOnCeed(field->Erestrict, op->ceed, &rstr);
+    CeedChk(ierr);
+  }
+  ierr = CeedBasisCreateOnCeed(field->basis, op->ceed, &basis); CeedChk(ierr);
+  Ceed parent, vecparent = NULL;
+  ierr = CeedGetParent(op->ceed, &parent); CeedChk(ierr);
+  if (vec != CEED_VECTOR_NONE) {
+    ierr = CeedGetParent(vec->ceed, &vecparent); CeedChk(ierr);
+  }
+  if (vec != CEED_VECTOR_NONE && vecparent != parent) {
+    ierr = CeedVectorCreate(op->ceed, field->vec->length, &vec); CeedChk(ierr);
+    ierr = CeedVectorCopy(field->vec, vec); CeedChk(ierr);
+  } else if (vec != CEED_VECTOR_NONE) {
+    ierr = CeedVectorAddReference(vec); CeedChk(ierr);
+  }
+
+  ierr = CeedOperatorSetField(op, field->fieldname, rstr, basis, vec);
+  CeedChk(ierr);
+  if (rstr != CEED_ELEMRESTRICTION_NONE) {
+    ierr = CeedElemRestrictionDestroy(&rstr); CeedChk(ierr);
+  }
+  if (basis != CEED_BASIS_COLLOCATED) {
+    ierr = CeedBasisDestroy(&basis); CeedChk(ierr);
+  }
+  if (vec != CEED_VECTOR_NONE) {
+    ierr = CeedVectorDestroy(&vec); CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Common code for creating a multigrid coarse operator and level
+           transfer operators for a CeedOperator
+
+  @param[in] opFine       Fine grid operator
+  @param[in] PMultFine    L-vector multiplicity in parallel gather/scatter
+  @param[in] rstrCoarse   Coarse grid restriction
+  @param[in] basisCoarse  Coarse grid active vector basis
+  @param[in] basisCtoF    Basis for coarse to fine interpolation
+  @param[out] opCoarse    Coarse grid operator
+  @param[out] opProlong   Coarse to fine operator
+  @param[out] opRestrict  Fine to coarse operator
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorMultigridLevel_Core(CeedOperator opFine,
+    CeedVector PMultFine, CeedElemRestriction rstrCoarse, CeedBasis basisCoarse,
+    CeedBasis basisCtoF, CeedOperator *opCoarse, CeedOperator *opProlong,
+    CeedOperator *opRestrict) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(opFine, &ceed); CeedChk(ierr);
+
+  // Check for composite operator
+  bool isComposite;
+  ierr = CeedOperatorIsComposite(opFine, &isComposite); CeedChk(ierr);
+  if (isComposite)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1,
+                     "Automatic multigrid setup for composite operators not supported");
+  // LCOV_EXCL_STOP
+
+  // Coarse Grid
+  //   The coarse operator is created on the Ceed of the coarse restriction,
+  //   with passive fields copied to that Ceed when it is not the fine Ceed
+  Ceed ceedCoarse, parent;
+  ierr = CeedGetParent(ceed, &parent); CeedChk(ierr);
+  ierr = CeedGetParent(rstrCoarse->ceed, &ceedCoarse); CeedChk(ierr);
+  if (ceedCoarse == parent)
+    ceedCoarse = ceed;
+  CeedQFunction qf, dqf, dqfT;
+  ierr = CeedQFunctionCreateOnCeed(opFine->qf, ceedCoarse, &qf); CeedChk(ierr);
+  ierr = CeedQFunctionCreateOnCeed(opFine->dqf, ceedCoarse, &dqf);
+  CeedChk(ierr);
+  ierr = CeedQFunctionCreateOnCeed(opFine->dqfT, ceedCoarse, &dqfT);
+  CeedChk(ierr);
+  ierr = CeedOperatorCreate(ceedCoarse, qf, dqf, dqfT, opCoarse);
+  CeedChk(ierr);
+  ierr = CeedQFunctionDestroy(&qf); CeedChk(ierr);
+  if (dqf != CEED_QFUNCTION_NONE) {
+    ierr = CeedQFunctionDestroy(&dqf); CeedChk(ierr);
+  }
+  if (dqfT != CEED_QFUNCTION_NONE) {
+    ierr = CeedQFunctionDestroy(&dqfT); CeedChk(ierr);
+  }
+  CeedElemRestriction rstrFine = NULL;
+  // -- Clone input fields
+  for (int i = 0; i < opFine->qf->numinputfields; i++) {
+    if (opFine->inputfields[i]->vec == CEED_VECTOR_ACTIVE) {
+      rstrFine = opFine->inputfields[i]->Erestrict;
+      ierr = CeedOperatorSetField(*opCoarse, opFine->inputfields[i]->fieldname,
+                                  rstrCoarse, basisCoarse, CEED_VECTOR_ACTIVE);
+      CeedChk(ierr);
+    } else {
+      ierr = CeedOperatorSetFieldOnCeed(*opCoarse, opFine->inputfields[i]);
+      CeedChk(ierr);
+      if (opFine->inputfields[i]->buildop && ceedCoarse == ceed) {
+        ierr = CeedOperatorSetFieldBuilder(*opCoarse,
+                                           opFine->inputfields[i]->fieldname,
+                                           opFine->inputfields[i]->buildop,
+                                           opFine->inputfields[i]->buildinput);
+        CeedChk(ierr);
+      }
+    }
+  }
+  // -- Clone output fields
+  for (int i = 0; i < opFine->qf->numoutputfields; i++) {
+    if (opFine->outputfields[i]->vec == CEED_VECTOR_ACTIVE) {
+      ierr = CeedOperatorSetField(*opCoarse, opFine->outputfields[i]->fieldname,
+                                  rstrCoarse, basisCoarse, CEED_VECTOR_ACTIVE);
+      CeedChk(ierr);
+    } else {
+      ierr = CeedOperatorSetFieldOnCeed(*opCoarse, opFine->outputfields[i]);
+      CeedChk(ierr);
+    }
+  }
+
+  // Coarse restriction of the transfer operators, on the fine Ceed
+  ierr = CeedElemRestrictionCreateOnCeed(rstrCoarse, ceed, &rstrCoarse);
+  CeedChk(ierr);
+
+  // Multiplicity vector
+  //   The inverse multiplicity is kept in the backend E-vector layout, so the
+  //   transfer operators read it without a restriction on every apply. When
+  //   all components of a node share their multiplicity, it is stored once
+  //   per node and broadcast to the components by the transfer QFunctions
+  CeedElemRestriction rstrScalar;
+  ierr = CeedElemRestrictionCreateScalarMultiplicity(rstrFine, PMultFine,
+         &rstrScalar); CeedChk(ierr);
+  CeedElemRestriction rstrMultL = rstrScalar ? rstrScalar : rstrFine;
+  CeedVector multVec, multE;
+  ierr = CeedElemRestrictionCreateVector(rstrMultL, &multVec, &multE);
+  CeedChk(ierr);
+  ierr = CeedVectorSetValue(multE, 0.0); CeedChk(ierr);
+  ierr = CeedElemRestrictionApply(rstrMultL, CEED_NOTRANSPOSE, PMultFine,
+                                  multE, CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+  ierr = CeedVectorSetValue(multVec, 0.0); CeedChk(ierr);
+  ierr = CeedElemRestrictionApply(rstrMultL, CEED_TRANSPOSE, multE, multVec,
+                                  CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+  ierr = CeedVectorReciprocal(multVec); CeedChk(ierr);
+  ierr = CeedElemRestrictionApply(rstrMultL, CEED_NOTRANSPOSE, multVec, multE,
+                                  CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&multVec); CeedChk(ierr);
+  CeedInt nelem, elemsize, ncompMult;
+  ierr = CeedElemRestrictionGetNumElements(rstrMultL, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstrMultL, &elemsize);
+  CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstrMultL, &ncompMult);
+  CeedChk(ierr);
+  CeedElemRestriction rstrMult;
+  ierr = CeedElemRestrictionCreateStrided(ceed, nelem, elemsize, ncompMult,
+                                          nelem*elemsize*ncompMult,
+                                          CEED_STRIDES_BACKEND, &rstrMult);
+  CeedChk(ierr);
+  const char *qfScaleName = rstrScalar ? "ScaleScalar" : "Scale";
+  ierr = CeedElemRestrictionDestroy(&rstrScalar); CeedChk(ierr);
+
+  // Restriction
+  CeedInt ncomp;
+  ierr = CeedBasisGetNumComponents(basisCoarse, &ncomp); CeedChk(ierr);
+  CeedQFunction qfRestrict;
+  ierr = CeedQFunctionCreateInteriorByName(ceed, qfScaleName, &qfRestrict);
+  CeedChk(ierr);
+  CeedInt *ncompRData;
+  ierr = CeedCalloc(1, &ncompRData); CeedChk(ierr);
+  ncompRData[0] = ncomp;
+  CeedQFunctionContext ctxR;
+  ierr = CeedQFunctionContextCreate(ceed, &ctxR); CeedChk(ierr);
+  ierr = CeedQFunctionContextSetData(ctxR, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                     sizeof(*ncompRData), ncompRData);
+  CeedChk(ierr);
+  ierr = CeedQFunctionSetContext(qfRestrict, ctxR); CeedChk(ierr);
+  ierr = CeedQFunctionContextDestroy(&ctxR); CeedChk(ierr);
+  ierr = CeedQFunctionAddInput(qfRestrict, "input", ncomp, CEED_EVAL_NONE);
+  CeedChk(ierr);
+  ierr = CeedQFunctionAddInput(qfRestrict, "scale", ncompMult, CEED_EVAL_NONE);
+  CeedChk(ierr);
+  ierr = CeedQFunctionAddOutput(qfRestrict, "output", ncomp, CEED_EVAL_INTERP);
+  CeedChk(ierr);
+
+  ierr = CeedOperatorCreate(ceed, qfRestrict, CEED_QFUNCTION_NONE,
+                            CEED_QFUNCTION_NONE, opRestrict);
+  CeedChk(ierr);
+  ierr = CeedOperatorSetField(*opRestrict, "input", rstrFine,
+                              CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+  CeedChk(ierr);
+  ierr = CeedOperatorSetField(*opRestrict, "scale", rstrMult,
+                              CEED_BASIS_COLLOCATED, multE);
+  CeedChk(ierr);
+  ierr = CeedOperatorSetField(*opRestrict, "output", rstrCoarse, basisCtoF,
+                              CEED_VECTOR_ACTIVE); CeedChk(ierr);
+
+  // Prolongation
+  CeedQFunction qfProlong;
+  ierr = CeedQFunctionCreateInteriorByName(ceed, qfScaleName, &qfProlong);
+  CeedChk(ierr);
+  CeedInt *ncompPData;
+  ierr = CeedCalloc(1, &ncompPData); CeedChk(ierr);
+  ncompPData[0] = ncomp;
+  CeedQFunctionContext ctxP;
+  ierr = CeedQFunctionContextCreate(ceed, &ctxP); CeedChk(ierr);
+  ierr = CeedQFunctionContextSetData(ctxP, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                     sizeof(*ncompPData), ncompPData);
+  CeedChk(ierr);
+  ierr = CeedQFunctionSetContext(qfProlong, ctxP); CeedChk(ierr);
+  ierr = CeedQFunctionContextDestroy(&ctxP); CeedChk(ierr);
+  ierr = CeedQFunctionAddInput(qfProlong, "input", ncomp, CEED_EVAL_INTERP);
+  CeedChk(ierr);
+  ierr = CeedQFunctionAddInput(qfProlong, "scale", ncompMult, CEED_EVAL_NONE);
+  CeedChk(ierr);
+  ierr = CeedQFunctionAddOutput(qfProlong, "output", ncomp, CEED_EVAL_NONE);
+  CeedChk(ierr);
+
+  ierr = CeedOperatorCreate(ceed, qfProlong, CEED_QFUNCTION_NONE,
+                            CEED_QFUNCTION_NONE, opProlong);
+  CeedChk(ierr);
+  ierr = CeedOperatorSetField(*opProlong, "input", rstrCoarse, basisCtoF,
+                              CEED_VECTOR_ACTIVE); CeedChk(ierr);
+  ierr = CeedOperatorSetField(*opProlong, "scale", rstrMult,
+                              CEED_BASIS_COLLOCATED, multE);
+  CeedChk(ierr);
+  ierr = CeedOperatorSetField(*opProlong, "output", rstrFine,
+                              CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+  CeedChk(ierr);
+
+  // Cleanup
+  ierr = CeedVectorDestroy(&multE); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstrMult); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstrCoarse); CeedChk(ierr);
+  ierr = CeedBasisDestroy(&basisCtoF); CeedChk(ierr);
+  ierr = CeedQFunctionDestroy(&qfRestrict); CeedChk(ierr);
+  ierr = CeedQFunctionDestroy(&qfProlong); CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Set a field of a CeedOperator evaluated at new quadrature points
+
+  Bases are evaluated at the new quadrature points with
+    CeedBasisCreateAtQuadrature(). Collocated fields with one value per
+    quadrature point get a strided restriction for the new quadrature points,
+    and passive quadrature data gets a new vector, computed by its build
+    operator evaluated at the new quadrature points.
+
+  @param[in] field     Field of the original CeedOperator
+  @param[in] numqpts   Number of quadrature points of the original CeedOperator
+  @param[in] numqptsQ  Number of new quadrature points
+  @param[in] Q         Number of new quadrature points in one dimension
+  @param[in] qmode     Distribution of the new quadrature points
+  @param[in,out] opQ   CeedOperator to set the field on
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorSetFieldAtQuadrature(CeedOperatorField field,
+    CeedInt numqpts, CeedInt numqptsQ, CeedInt Q, CeedQuadMode qmode,
+    CeedOperator opQ) {
+  int ierr;
+  Ceed ceed = opQ->ceed;
+  CeedElemRestriction rstr = field->Erestrict, rstrQ = NULL;
+  CeedBasis basisQ = NULL;
+  CeedVector vecQ = NULL;
+  bool passive = field->vec != CEED_VECTOR_ACTIVE &&
+                 field->vec != CEED_VECTOR_NONE;
+
+  if (field->basis != CEED_BASIS_COLLOCATED) {
+    ierr = CeedBasisCreateAtQuadrature(field->basis, Q, qmode, &basisQ);
+    CeedChk(ierr);
+  } else if (rstr != CEED_ELEMRESTRICTION_NONE && rstr->elemsize == numqpts) {
+    // Quadrature data
+    if (passive && !field->buildop)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Quadrature data field '%s' needs a build "
+                       "operator to be evaluated at new quadrature points",
+                       field->fieldname);
+    // LCOV_EXCL_STOP
+    CeedInt lsize = rstr->nelem*numqptsQ*rstr->ncomp;
+    ierr = CeedElemRestrictionCreateStrided(ceed, rstr->nelem, numqptsQ,
+                                            rstr->ncomp, lsize,
+                                            CEED_STRIDES_BACKEND, &rstrQ);
+    CeedChk(ierr);
+    if (passive) {
+      ierr = CeedVectorCreate(ceed, lsize, &vecQ); CeedChk(ierr);
+    }
+  }
+
+  ierr = CeedOperatorSetField(opQ, field->fieldname, rstrQ ? rstrQ : rstr,
+                              basisQ ? basisQ : field->basis,
+                              vecQ ? vecQ : field->vec); CeedChk(ierr);
+  if (field->buildop) {
+    if (vecQ) {
+      CeedOperator buildopQ;
+      ierr = CeedOperatorCreateAtQuadrature(field->buildop, Q, qmode,
+                                            &buildopQ); CeedChk(ierr);
+      ierr = CeedOperatorSetFieldBuilder(opQ, field->fieldname, buildopQ,
+                                         field->buildinput); CeedChk(ierr);
+      ierr = CeedOperatorDestroy(&buildopQ); CeedChk(ierr);
+    } else {
+      ierr = CeedOperatorSetFieldBuilder(opQ, field->fieldname, field->buildop,
+                                         field->buildinput); CeedChk(ierr);
+    }
+  }
+
+  // Cleanup
+  ierr = CeedElemRestrictionDestroy(&rstrQ); CeedChk(ierr);
+  ierr = CeedBasisDestroy(&basisQ); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&vecQ); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Estimate the bytes of the offsets of a CeedElemRestriction
+
+  @param[in] rstr  CeedElemRestriction
+
+  @return Bytes of offsets read by an application of @a rstr
+
+  @ref Developer
+**/
+static size_t CeedElemRestrictionOffsetsBytes(CeedElemRestriction rstr) {
+  if (rstr->strides)
+    return 0;
+  if (rstr->eoffsets)
+    return (size_t)(rstr->nelem + rstr->elemsize)*sizeof(CeedInt);
+  return (size_t)rstr->nelem*rstr->elemsize*sizeof(CeedInt);
+}
+
+/**
+  @brief Estimate the flops and bytes of one application of a CeedOperator
+           that is not composite
+
+  Each L-vector read through a CeedElemRestriction is counted once, output
+    L-vectors are read and written, and the offsets of each distinct
+    CeedElemRestriction are read once. Flops are those of the basis actions,
+    the transpose restrictions, and the CeedQFunction, from
+    CeedQFunctionSetUserFlopsEstimate(), or those of the element matrices when
+    the operator is applied with them.
+
+  @param[in] op      CeedOperator
+  @param[out] flops  Variable to store the flops
+  @param[out] bytes  Variable to store the bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorEstimate(CeedOperator op, size_t *flops,
+                                      size_t *bytes) {
+  int ierr;
+  CeedQFunction qf = op->qf;
+  const CeedInt numin = qf->numinputfields, numout = qf->numoutputfields;
+  const size_t nelem = op->numelements;
+  CeedOperatorField fields[numin + numout];
+  CeedElemRestriction rstrs[numin + numout];
+  CeedInt numrstrs = 0;
+  size_t basisflops, sizein = 0, sizeout = 0;
+
+  for (CeedInt i=0; i<numin; i++)
+    fields[i] = op->inputfields[i];
+  for (CeedInt i=0; i<numout; i++)
+    fields[numin + i] = op->outputfields[i];
+
+  *flops = 0;
+  *bytes = 0;
+  for (CeedInt i=0; i<numin + numout; i++) {
+    CeedOperatorField field = fields[i];
+    CeedQFunctionField qffield = i < numin ? qf->inputfields[i] :
+                                 qf->outputfields[i - numin];
+    CeedElemRestriction rstr = field->Erestrict;
+
+    // Element matrices replace the passive inputs and the basis actions
+    if (op->ematused && field->vec != CEED_VECTOR_ACTIVE)
+      continue;
+
+    // Basis and transpose restriction
+    ierr = CeedOperatorFieldBasisFlops(field, qffield, i < numin ?
+                                       CEED_NOTRANSPOSE : CEED_TRANSPOSE,
+                                       &basisflops); CeedChk(ierr);
+    if (!op->ematused)
+      *flops += nelem*basisflops;
+    if (rstr == CEED_ELEMRESTRICTION_NONE || field->vec == CEED_VECTOR_NONE)
+      continue;
+    const size_t esize = (size_t)rstr->elemsize*rstr->ncomp;
+    if (field->vec == CEED_VECTOR_ACTIVE) {
+      if (i < numin) sizein = esize;
+      else sizeout = esize;
+    }
+    if (i >= numin)
+      *flops += nelem*esize;
+
+    // L-vector and offsets, once for each vector and restriction
+    bool seen = false, seenrstr = false;
+    for (CeedInt j=0; j<i; j++) {
+      seenrstr = seenrstr || fields[j]->Erestrict == rstr;
+      seen = seen || (fields[j]->Erestrict == rstr &&
+                      fields[j]->vec == field->vec && (j < numin) == (i < numin));
+    }
+    if (!seen)
+      *bytes += (i < numin ? 1 : 2)*(size_t)rstr->lsize*sizeof(CeedScalar);
+    for (CeedInt j=0; j<numrstrs; j++)
+      seenrstr = seenrstr || rstrs[j] == rstr;
+    if (!seenrstr) {
+      rstrs[numrstrs++] = rstr;
+      *bytes += CeedElemRestrictionOffsetsBytes(rstr);
+    }
+  }
+
+  // CeedQFunction, or element matrices
+  if (op->ematused) {
+    *flops += 2*nelem*sizein*sizeout;
+    *bytes += nelem*sizein*sizeout*sizeof(CeedScalar);
+  } else {
+    *flops += nelem*op->numqpoints*qf->userflops;
+  }
+  return 0;
+}
+
+/**
+  @brief Estimate the flops and bytes of one application of a CeedOperator
+
+  @param[in] op      CeedOperator
+  @param[out] flops  Variable to store the flops
+  @param[out] bytes  Variable to store the bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorEstimate(CeedOperator op, size_t *flops,
+                                size_t *bytes) {
+  int ierr;
+  size_t subflops, subbytes;
+
+  *flops = 0;
+  *bytes = 0;
+  if (op->numelements) {
+    ierr = CeedSingleOperatorEstimate(op, flops, bytes); CeedChk(ierr);
+  } else if (op->smoothop) {
+    // Chebyshev smoother, one application of the operator and a fused
+    //   update reading five and writing three vectors for each later sweep
+    const size_t n = op->smoothdinv->length;
+    ierr = CeedOperatorEstimate(op->smoothop, &subflops, &subbytes);
+    CeedChk(ierr);
+    *flops = (op->smoothdegree - 1)*subflops + op->smoothdegree*6*n;
+    *bytes = (op->smoothdegree - 1)*subbytes +
+             op->smoothdegree*8*n*sizeof(CeedScalar);
+  } else {
+    // Composite and sharded operators
+    for (CeedInt i=0; i<op->numsub; i++) {
+      ierr = CeedOperatorEstimate(op->suboperators[i], &subflops, &subbytes);
+      CeedChk(ierr);
+      *flops += subflops;
+      *bytes += subbytes;
+    }
+  }
+  return 0;
+}
+
+/**
+  @brief Stop timing an operator application, counting its estimated flops
+           and bytes
+
+  @param[in] op     CeedOperator being applied
+  @param nvecs      Number of vectors applied to
+  @param out        First output vector, or CEED_VECTOR_NONE
+  @param start      Start time from CeedProfileStart()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorProfileStop(CeedOperator op, CeedInt nvecs,
+                                   CeedVector out, double start) {
+  int ierr;
+  size_t flops = 0, bytes = 0;
+
+  if (start >= 0) {
+    ierr = CeedOperatorEstimate(op, &flops, &bytes); CeedChk(ierr);
+  }
+  const CeedInt dofs = out != CEED_VECTOR_NONE ? out->length : 0;
+  ierr = CeedProfileStopOperator(op->ceed, start, (double)nvecs*bytes,
+                                 (double)nvecs*flops, (double)nvecs*dofs);
+  CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Write a record of a CeedOperator file
+
+  @param op            CeedOperator the data belongs to
+  @param stream        File stream to write to
+  @param kind          CeedOperatorRecordKind of the record
+  @param opindex       Index of @a op in the depth-first traversal
+  @param field         Input field index, or -1
+  @param vec           CeedVector with the data
+  @param rstr          CeedElemRestriction of @a vec, or NULL
+  @param[in,out] numrecords Number of records written, incremented
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorWriteRecord(CeedOperator op, FILE *stream,
+                                   CeedOperatorRecordKind kind,
+                                   CeedInt opindex, CeedInt field,
+                                   CeedVector vec, CeedElemRestriction rstr,
+                                   CeedInt *numrecords) {
+  int ierr;
+  CeedOperatorRecordHeader header;
+
+  memset(&header, 0, sizeof(header));
+  header.kind = kind;
+  header.opindex = opindex;
+  header.field = field;
+  if (kind == CEED_OPERATOR_RECORD_FIELD)
+    strncpy(header.fieldname, op->inputfields[field]->fieldname,
+            sizeof(header.fieldname) - 1);
+  if (kind == CEED_OPERATOR_RECORD_SMOOTHER) {
+    header.bounds[0] = op->smoothlmin;
+    header.bounds[1] = op->smoothlmax;
+  }
+  if (rstr && rstr != CEED_ELEMRESTRICTION_NONE && rstr->strides) {
+    bool backendstrides;
+    CeedInt strides[3];
+    ierr = CeedElemRestrictionHasBackendStrides(rstr, &backendstrides);
+    CeedChk(ierr);
+    if (backendstrides) {
+      ierr = CeedElemRestrictionGetELayout(rstr, &strides); CeedChk(ierr);
+    } else {
+      ierr = CeedElemRestrictionGetStrides(rstr, &strides); CeedChk(ierr);
+    }
+    header.backendstrides = backendstrides;
+    header.nelem = rstr->nelem;
+    header.elemsize = rstr->elemsize;
+    header.ncomp = rstr->ncomp;
+    for (int i = 0; i < 3; i++)
+      header.strides[i] = strides[i];
+  }
+  if (fwrite(&header, sizeof(header), 1, stream) != 1)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Cannot write CeedOperator record");
+  // LCOV_EXCL_STOP
+  ierr = CeedVectorWriteRecord(vec, rstr, stream); CeedChk(ierr);
+  (*numrecords)++;
+  return 0;
+}
+
+/**
+  @brief Write the records of a CeedOperator and its suboperators
+
+  @param op                 CeedOperator to save
+  @param stream             File stream to write to
+  @param[in,out] opindex    Index of @a op in the depth-first traversal,
+                              advanced past @a op and its suboperators
+  @param[in,out] numrecords Number of records written
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorSaveRecords(CeedOperator op, FILE *stream,
+                                   CeedInt *opindex, CeedInt *numrecords) {
+  int ierr;
+  const CeedInt index = (*opindex)++;
+
+  if (op->smoothop) {
+    ierr = CeedOperatorWriteRecord(op, stream, CEED_OPERATOR_RECORD_SMOOTHER,
+                                   index, -1, op->smoothdinv, NULL,
+                                   numrecords); CeedChk(ierr);
+    ierr = CeedOperatorSaveRecords(op->smoothop, stream, opindex, numrecords);
+    CeedChk(ierr);
+    return 0;
+  }
+  if (op->composite) {
+    for (CeedInt i=0; i<op->numsub; i++) {
+      ierr = CeedOperatorSaveRecords(op->suboperators[i], stream, opindex,
+                                     numrecords); CeedChk(ierr);
+    }
+    return 0;
+  }
+  for (CeedInt i=0; i<op->qf->numinputfields; i++) {
+    CeedOperatorField field = op->inputfields[i];
+    if (field->vec == CEED_VECTOR_ACTIVE || field->vec == CEED_VECTOR_NONE)
+      continue;
+    ierr = CeedOperatorWriteRecord(op, stream, CEED_OPERATOR_RECORD_FIELD,
+                                   index, i, field->vec, field->Erestrict,
+                                   numrecords); CeedChk(ierr);
+  }
+  if (op->qfassembled) {
+    ierr = CeedOperatorWriteRecord(op, stream,
+                                   CEED_OPERATOR_RECORD_QFASSEMBLED, index,
+                                   -1, op->qfassembled, op->qfassembledrstr,
+                                   numrecords); CeedChk(ierr);
+  }
+  if (op->emat) {
+    ierr = CeedOperatorWriteRecord(op, stream, CEED_OPERATOR_RECORD_EMAT,
+                                   index, -1, op->emat, NULL, numrecords);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Find a CeedOperator by its index in the depth-first traversal of
+           CeedOperatorSaveRecords()
+
+  @param op              CeedOperator to search
+  @param index           Index to find
+  @param[in,out] count   Index of @a op, advanced past @a op and its
+                           suboperators
+  @param[out] found      Address to store the CeedOperator, if found
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorFindRecordOperator(CeedOperator op, CeedInt index,
+    CeedInt *count, CeedOperator *found) {
+  int ierr;
+
+  if ((*count)++ == index)
+    *found = op;
+  if (op->smoothop) {
+    ierr = CeedOperatorFindRecordOperator(op->smoothop, index, count, found);
+    CeedChk(ierr);
+  }
+  for (CeedInt i=0; op->composite && i<op->numsub; i++) {
+    ierr = CeedOperatorFindRecordOperator(op->suboperators[i], index, count,
+                                          found); CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Read a record of a CeedOperator file into its operator
+
+  @param op            CeedOperator the record was written for
+  @param header        Record header
+  @param record        Start of the CeedVector record following @a header
+  @param size          Number of bytes available from @a record
+  @param[out] used     Number of bytes of the CeedVector record
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorReadRecord(CeedOperator op,
+                                  const CeedOperatorRecordHeader *header,
+                                  const void *record, size_t size,
+                                  size_t *used) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  bool single = !op->composite && !op->smoothop;
+
+  switch (header->kind) {
+  case CEED_OPERATOR_RECORD_FIELD: {
+    CeedOperatorField field = single && header->field >= 0 &&
+                              header->field < op->qf->numinputfields ?
+                              op->inputfields[header->field] : NULL;
+    if (!field || field->vec == CEED_VECTOR_ACTIVE ||
+        field->vec == CEED_VECTOR_NONE ||
+        strncmp(field->fieldname, header->fieldname,
+                sizeof(header->fieldname)))
+      return CeedError(ceed, 1, "CeedOperator file has passive input %s, "
+                       "which does not match the CeedOperator",
+                       header->fieldname);
+    ierr = CeedVectorReadRecord(field->vec, field->Erestrict, record, size,
+                                used); CeedChk(ierr);
+    break;
+  }
+  case CEED_OPERATOR_RECORD_QFASSEMBLED:
+    if (!single)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "CeedOperator file has an assembled "
+                       "CeedQFunction for a composite CeedOperator");
+    // LCOV_EXCL_STOP
+    if (!op->qfassembled) {
+      const CeedInt n = header->nelem*header->elemsize*header->ncomp;
+      CeedInt strides[3];
+      for (int i = 0; i < 3; i++)
+        strides[i] = header->backendstrides ? CEED_STRIDES_BACKEND[i] :
+                     header->strides[i];
+      ierr = CeedElemRestrictionCreateStrided(ceed, header->nelem,
+                                              header->elemsize, header->ncomp,
+                                              n, strides,
+                                              &op->qfassembledrstr);
+      CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, n, &op->qfassembled); CeedChk(ierr);
+    }
+    ierr = CeedVectorReadRecord(op->qfassembled, op->qfassembledrstr, record,
+                                size, used); CeedChk(ierr);
+    break;
+  case CEED_OPERATOR_RECORD_EMAT:
+    if (!single)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "CeedOperator file has element matrices for "
+                       "a composite CeedOperator");
+    // LCOV_EXCL_STOP
+    if (!op->emat) {
+      ierr = CeedOperatorCreateElementMatrices(op); CeedChk(ierr);
+    }
+    ierr = CeedVectorReadRecord(op->emat, NULL, record, size, used);
+    CeedChk(ierr);
+    break;
+  case CEED_OPERATOR_RECORD_SMOOTHER:
+    if (!op->smoothop)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "CeedOperator file has a Chebyshev smoother "
+                       "where the CeedOperator has none");
+    // LCOV_EXCL_STOP
+    ierr = CeedVectorReadRecord(op->smoothdinv, NULL, record, size, used);
+    CeedChk(ierr);
+    op->smoothlmin = header->bounds[0];
+    op->smoothlmax = header->bounds[1];
+    break;
+  default:
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Unknown CeedOperator record %d", header->kind);
+    // LCOV_EXCL_STOP
+  }
+  return 0;
+}
+
+/**
+  @brief Mark the data read from a CeedOperator record as up to date
+
+  Called once all records are read, since reading passive inputs changes the
+    state that assembled data is compared against.
+
+  @param op            CeedOperator the record was read into
+  @param header        Record header
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorRecordState(CeedOperator op,
+                                   const CeedOperatorRecordHeader *header) {
+  int ierr;
+
+  if (header->kind == CEED_OPERATOR_RECORD_FIELD) {
+    CeedOperatorField field = op->inputfields[header->field];
+    if (field->buildop) {
+      ierr = CeedOperatorGetBuildState(field->buildop, field->buildinput,
+                                       &field->buildstate); CeedChk(ierr);
+      field->built = true;
+    }
+  } else if (header->kind == CEED_OPERATOR_RECORD_QFASSEMBLED) {
+    ierr = CeedOperatorGetBuildState(op, CEED_VECTOR_NONE,
+                                     &op->qfassembledstate); CeedChk(ierr);
+  } else if (header->kind == CEED_OPERATOR_RECORD_EMAT) {
+    ierr = CeedOperatorGetBuildState(op, CEED_VECTOR_NONE, &op->ematstate);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Get the single active input or output field of a CeedOperator
+
+  @param op           CeedOperator, not composite
+  @param output       Search the output fields instead of the input fields
+  @param[out] index   Index of the active field, or -1 if there is none or
+                        more than one
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorGetActiveFieldIndex(CeedOperator op, bool output,
+    CeedInt *index) {
+  const CeedInt numfields = output ? op->qf->numoutputfields :
+                            op->qf->numinputfields;
+  CeedOperatorField *fields = output ? op->outputfields : op->inputfields;
+
+  *index = -1;
+  for (CeedInt i=0; i<numfields; i++)
+    if (fields[i]->vec == CEED_VECTOR_ACTIVE) {
+      if (*index >= 0) {
+        *index = -1;
+        return 0;
+      }
+      *index = i;
+    }
+  return 0;
+}
+
+/**
+  @brief Duplicate a CeedOperator with the restriction of one field replaced
+
+  @param op          CeedOperator to duplicate, not composite
+  @param output      Replace an output field instead of an input field
+  @param index       Index of the field to replace the restriction of
+  @param rstr        New CeedElemRestriction of the field
+  @param[out] copy   Address of the variable where the newly created
+                       CeedOperator will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorCreateWithRestriction(CeedOperator op, bool output,
+    CeedInt index, CeedElemRestriction rstr, CeedOperator *copy) {
+  int ierr;
+
+  ierr = CeedOperatorCreate(op->ceed, op->qf, op->dqf, op->dqfT, copy);
+  CeedChk(ierr);
+  const CeedInt numin = op->qf->numinputfields,
+                numout = op->qf->numoutputfields;
+  for (CeedInt i = 0; i < numin + numout; i++) {
+    CeedOperatorField field = i < numin ? op->inputfields[i] :
+                              op->outputfields[i - numin];
+    const bool replace = i == (output ? numin + index : index);
+    ierr = CeedOperatorSetField(*copy, field->fieldname,
+                                replace ? rstr : field->Erestrict,
+                                field->basis, field->vec); CeedChk(ierr);
+    if (i < numin) {
+      (*copy)->inputfields[i]->storage = field->storage;
+      if (field->buildop) {
+        ierr = CeedOperatorSetFieldBuilder(*copy, field->fieldname,
+                                           field->buildop, field->buildinput);
+        CeedChk(ierr);
+      }
+    } else if (field->reduction) {
+      CeedOperatorField copyfield = (*copy)->outputfields[i - numin];
+      CeedReference(field->reduction);
+      copyfield->reduction = field->reduction;
+      copyfield->rtype = field->rtype;
+    }
+  }
+  return 0;
+}
+
+/**
+  @brief Update the assembled CeedQFunction of a CeedOperator and create the
+           CeedOperator applying its transpose, if not yet created
+
+  The transpose operator reads the active output space of @a op through its
+    restriction and basis, applies the transpose of the assembled CeedQFunction
+    at each quadrature point, and writes the active input space of @a op. The
+    assembled CeedQFunction is kept with @a op and refilled in place, so the
+    transpose operator stays valid when passive inputs change.
+
+  @param op  CeedOperator with a single active input and output field, not
+               composite
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorUpdateTranspose(CeedOperator op) {
+  int ierr;
+  Ceed ceed = op->ceed;
+
+  if (op->composite || op->chainops[0] || !op->qf)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Transpose needs an operator with a QFunction");
+  // LCOV_EXCL_STOP
+  CeedInt inindex, outindex;
+  ierr = CeedOperatorGetActiveFieldIndex(op, false, &inindex); CeedChk(ierr);
+  ierr = CeedOperatorGetActiveFieldIndex(op, true, &outindex); CeedChk(ierr);
+  if (inindex < 0 || outindex < 0)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Transpose needs a single active input and "
+                     "output field");
+  // LCOV_EXCL_STOP
+
+  // Assembled QFunction, refilled when passive inputs change
+  CeedVector assembled;
+  CeedElemRestriction rstr;
+  ierr = CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled,
+         &rstr, CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&assembled); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstr); CeedChk(ierr);
+  if (op->transposeop)
+    return 0;
+
+  // QFunction, with the active output of op as input and vice versa
+  CeedOperatorField infield = op->inputfields[inindex],
+                    outfield = op->outputfields[outindex];
+  CeedQFunctionField qfin = op->qf->inputfields[inindex],
+                     qfout = op->qf->outputfields[outindex];
+  CeedQFunction qf;
+  ierr = CeedQFunctionCreateInteriorByName(ceed, "TransposeBlockScale", &qf);
+  CeedChk(ierr);
+  CeedInt *sizedata;
+  ierr = CeedCalloc(2, &sizedata); CeedChk(ierr);
+  sizedata[0] = qfout->size;
+  sizedata[1] = qfin->size;
+  CeedQFunctionContext ctx;
+  ierr = CeedQFunctionContextCreate(ceed, &ctx); CeedChk(ierr);
+  ierr = CeedQFunctionContextSetData(ctx, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                     2*sizeof(*sizedata), sizedata);
+  CeedChk(ierr);
+  ierr = CeedQFunctionSetContext(qf, ctx); CeedChk(ierr);
+  ierr = CeedQFunctionContextDestroy(&ctx); CeedChk(ierr);
+  ierr = CeedQFunctionAddInput(qf, "input", qfout->size, qfout->emode);
+  CeedChk(ierr);
+  ierr = CeedQFunctionAddInput(qf, "block", qfin->size*qfout->size,
+                               CEED_EVAL_NONE); CeedChk(ierr);
+  ierr = CeedQFunctionAddOutput(qf, "output", qfin->size, qfin->emode);
+  CeedChk(ierr);
+
+  // Operator
+  ierr = CeedOperatorCreate(ceed, qf, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                            &op->transposeop); CeedChk(ierr);
+  ierr = CeedOperatorSetField(op->transposeop, "input", outfield->Erestrict,
+                              outfield->basis, CEED_VECTOR_ACTIVE);
+  CeedChk(ierr);
+  ierr = CeedOperatorSetField(op->transposeop, "block", op->qfassembledrstr,
+                              CEED_BASIS_COLLOCATED, op->qfassembled);
+  CeedChk(ierr);
+  ierr = CeedOperatorSetField(op->transposeop, "output", infield->Erestrict,
+                              infield->basis, CEED_VECTOR_ACTIVE);
+  CeedChk(ierr);
+  ierr = CeedQFunctionDestroy(&qf); CeedChk(ierr);
+  return 0;
+}
+
+/// @}
+
+/// ----------------------------------------------------------------------------
+/// CeedOperator Backend API
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedOperatorBackend
+/// @{
+
+/**
+  @brief Get the Ceed associated with a CeedOperator
+
+  @param op              CeedOperator
+  @param[out] ceed       Variable to store Ceed
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorGetCeed(CeedOperator op, Ceed *ceed) {
+  *ceed = op->ceed;
+  return 0;
+}
+
+/**
+  @brief Get the number of elements associated with a CeedOperator
+
+  @param op              CeedOperator
+  @param[out] numelem    Variable to store number of elements
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorGetNumElements(CeedOperator op, CeedInt *numelem) {
+  if (op->composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Not defined for composite operator");
+  // LCOV_EXCL_STOP
+
+  *numelem = op->numelements;
+  return 0;
+}
+
+/**
+  @brief Get the number of quadrature points associated with a CeedOperator
+
+  @param op              CeedOperator
+  @param[out] numqpts    Variable to store vector number of quadrature points
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorGetNumQuadraturePoints(CeedOperator op, CeedInt *numqpts) {
+  if (op->composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Not defined for composite operator");
+  // LCOV_EXCL_STOP
+
+  *numqpts = op->numqpoints;
+  return 0;
+}
+
+/**
+  @brief Get the number of arguments associated with a CeedOperator
+
+  @param op              CeedOperator
+  @param[out] numargs    Variable to store vector number of arguments
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorGetNumArgs(CeedOperator op, CeedInt *numargs) {
+  if (op->composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Not defined for composite operators");
+  // LCOV_EXCL_STOP
+
+  *numargs = op->nfields;
+  return 0;
+}
+
+/**
+  @brief Get the setup status of a CeedOperator
+
+  @param op                CeedOperator
+  @param[out] issetupdone  Variable to store setup status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorIsSetupDone(CeedOperator op, bool *issetupdone) {
+  *issetupdone = op->setupdone;
+  return 0;
+}
+
+/**
+  @brief Get the QFunction associated with a CeedOperator
+
+  @param op              CeedOperator
+  @param[out] qf         Variable to store QFunction
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorGetQFunction(CeedOperator op, CeedQFunction *qf) {
+  if (op->composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Not defined for composite operator");
+  // LCOV_EXCL_STOP
+
+  *qf = op->qf;
+  return 0;
+}
+
+/**
+  @brief Get a boolean value indicating if the CeedOperator is composite
+
+  @param op                CeedOperator
+  @param[out] iscomposite  Variable to store composite status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorIsComposite(CeedOperator op, bool *iscomposite) {
+  *iscomposite = op->composite;
+  return 0;
+}
+
+/**
+  @brief Get the number of suboperators associated with a CeedOperator
+
+  @param op              CeedOperator
+  @param[out] numsub     Variable to store number of suboperators
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorGetNumSub(CeedOperator op, CeedInt *numsub) {
+  if (!op->composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Not a composite operator");
+  // LCOV_EXCL_STOP
+
+  *numsub = op->numsub;
+  return 0;
+}
+
+/**
+  @brief Get the list of suboperators associated with a CeedOperator
+
+  @param op                CeedOperator
+  @param[out] suboperators Variable to store list of suboperators
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorGetSubList(CeedOperator op, CeedOperator **suboperators) {
+  if (!op->composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Not a composite operator");
+  // LCOV_EXCL_STOP
+
+  *suboperators = op->suboperators;
+  return 0;
+}
+
+/**
+  @brief Get the backend data of a CeedOperator
+
+  @param op              CeedOperator
+  @param[out] data       Variable to store data
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorGetData(CeedOperator op, void *data) {
+  *(void **)data = op->data;
+  return 0;
+}
+
+/**
+  @brief Set the backend data of a CeedOperator
+
+  @param[out] op         CeedOperator
+  @param data            Data to set
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorSetData(CeedOperator op, void *data) {
+  op->data = data;
+  return 0;
+}
+
+/**
+  @brief Set the resource usage of a kernel a backend compiled for a
+           CeedOperator, printed by CeedOperatorView()
+
+  A kernel with the same name as an earlier one replaces it.
+
+  @param op    CeedOperator
+  @param info  CeedKernelInfo of the kernel, at the launch size used by @a op
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorSetKernelInfo(CeedOperator op, const CeedKernelInfo *info) {
+  int ierr;
+  CeedInt k = 0;
+
+  while (k < op->numkernels && strcmp(op->kernels[k].name, info->name))
+    k++;
+  if (k == op->numkernels) {
+    ierr = CeedRealloc(k+1, &op->kernels); CeedChk(ierr);
+    op->numkernels++;
+  }
+  op->kernels[k] = *info;
+  return 0;
+}
+
+/**
+  @brief Set the setup flag of a CeedOperator to True
+
+  @param op              CeedOperator
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorSetSetupDone(CeedOperator op) {
+  op->setupdone = 1;
+  return 0;
+}
+
+/**
+  @brief Get the CeedOperatorFields of a CeedOperator
+
+  @param op                 CeedOperator
+  @param[out] inputfields   Variable to store inputfields
+  @param[out] outputfields  Variable to store outputfields
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorGetFields(CeedOperator op, CeedOperatorField **inputfields,
+                          CeedOperatorField **outputfields) {
+  if (op->composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Not defined for composite operator");
+  // LCOV_EXCL_STOP
+
+  if (inputfields) *inputfields = op->inputfields;
+  if (outputfields) *outputfields = op->outputfields;
+  return 0;
+}
+
+/**
+  @brief Get the CeedElemRestriction of a CeedOperatorField
+
+  @param opfield         CeedOperatorField
+  @param[out] rstr       Variable to store CeedElemRestriction
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorFieldGetElemRestriction(CeedOperatorField opfield,
+                                        CeedElemRestriction *rstr) {
+  *rstr = opfield->Erestrict;
+  return 0;
+}
+
+/**
+  @brief Get the CeedBasis of a CeedOperatorField
+
+  @param opfield         CeedOperatorField
+  @param[out] basis      Variable to store CeedBasis
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorFieldGetBasis(CeedOperatorField opfield, CeedBasis *basis) {
+  *basis = opfield->basis;
+  return 0;
+}
+
+/**
+  @brief Get the CeedVector of a CeedOperatorField
+
+  @param opfield         CeedOperatorField
+  @param[out] vec        Variable to store CeedVector
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorFieldGetVector(CeedOperatorField opfield, CeedVector *vec) {
+  *vec = opfield->vec;
+  return 0;
+}
+
+/**
+  @brief Get the storage precision of a CeedOperatorField
+
+  @param opfield         CeedOperatorField
+  @param[out] storage    Variable to store CeedStorageType
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorFieldGetStorage(CeedOperatorField opfield,
+                                CeedStorageType *storage) {
+  *storage = opfield->storage;
+  return 0;
+}
+
+/**
+  @brief Get the Dirichlet constraint of a CeedOperator
+
+  @param op            CeedOperator
+  @param[out] nbc      Variable to store the number of constrained entries
+  @param[out] indices  Variable to store the constrained L-vector entries
+  @param[out] values   Variable to store the CeedVector of constrained
+                         values, or @ref CEED_VECTOR_NONE for zero values
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorGetDirichlet(CeedOperator op, CeedInt *nbc,
+                             const CeedInt **indices, CeedVector *values) {
+  *nbc = op->nbc;
+  *indices = op->bcindices;
+  *values = op->bcvalues ? op->bcvalues : CEED_VECTOR_NONE;
+  return 0;
+}
+
+/**
+  @brief Get the scaling of the FDM element inverses of a CeedOperator
+
+  @param op         CeedOperator
+  @param[out] mode  Variable to store the FDM mode
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorGetFDMMode(CeedOperator op, CeedFDMMode *mode) {
+  *mode = op->fdmmode;
+  return 0;
+}
+
+/**
+  @brief Duplicate a CeedOperator on another Ceed to delegate its application
+
+  The delegate shares the restrictions and passive vectors of @a op, which
+    must outlive it, and applies tensor product bases created with @a ceed.
+    Passive fields built on demand are updated by @a op, so the delegate should
+    only be applied from within the application of @a op.
+
+  @param op               CeedOperator to duplicate
+  @param ceed             Ceed to create the delegate with
+  @param[out] opdelegate  Address of the delegate CeedOperator
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorCreateDelegate(CeedOperator op, Ceed ceed,
+                               CeedOperator *opdelegate) {
+  int ierr;
+
+  if (op->composite || op->sharded)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Delegates are not defined for composite or "
+                     "sharded operators");
+  // LCOV_EXCL_STOP
+
+  CeedQFunction qf;
+  ierr = CeedOperatorClone(op, ceed, opdelegate, &qf); CeedChk(ierr);
+  (*opdelegate)->qffallback = qf;
+
+  // Fields, with bases for the delegate Ceed
+  CeedInt numfields[2] = {qf->numinputfields, qf->numoutputfields};
+  CeedOperatorField *fields[2] = {op->inputfields, op->outputfields};
+  ierr = CeedCalloc(numfields[0], &(*opdelegate)->inputfields); CeedChk(ierr);
+  ierr = CeedCalloc(numfields[1], &(*opdelegate)->outputfields);
+  CeedChk(ierr);
+  CeedOperatorField *delegatefields[2] = {(*opdelegate)->inputfields,
+                                          (*opdelegate)->outputfields
+                                         };
+  for (CeedInt j=0; j<2; j++)
+    for (CeedInt i=0; i<numfields[j]; i++) {
+      CeedOperatorField field;
+      ierr = CeedCalloc(1, &field); CeedChk(ierr);
+      memcpy(field, fields[j][i], sizeof(*field));
+      field->buildop = NULL;
+      // Reductions are computed by the operator applying the delegate
+      field->reduction = NULL;
+      CeedBasis basis = field->basis;
+      if (basis != CEED_BASIS_COLLOCATED && basis->tensorbasis) {
+        ierr = CeedBasisCreateTensorH1(ceed, basis->dim, basis->ncomp,
+                                       basis->P1d, basis->Q1d, basis->interp1d,
+                                       basis->grad1d, basis->qref1d,
+                                       basis->qweight1d, &field->basis);
+        CeedChk(ierr);
+      } else if (basis != CEED_BASIS_COLLOCATED) {
+        CeedReference(basis);
+      }
+      delegatefields[j][i] = field;
+    }
+
+  return 0;
+}
+
+/**
+  @brief Destroy a CeedOperator created with CeedOperatorCreateDelegate()
+
+  @param opdelegate  Address of the delegate CeedOperator
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorDestroyDelegate(CeedOperator *opdelegate) {
+  int ierr;
+  CeedOperator op = *opdelegate;
+
+  if (!op) return 0;
+  if (op->Destroy) {
+    ierr = op->Destroy(op); CeedChk(ierr);
+  }
+  CeedInt numfields[2] = {op->qf->numinputfields, op->qf->numoutputfields};
+  CeedOperatorField *fields[2] = {op->inputfields, op->outputfields};
+  for (CeedInt j=0; j<2; j++)
+    for (CeedInt i=0; i<numfields[j]; i++) {
+      if (fields[j][i]->basis != CEED_BASIS_COLLOCATED) {
+        ierr = CeedBasisDestroy(&fields[j][i]->basis); CeedChk(ierr);
+      }
+      ierr = CeedFree(&fields[j][i]); CeedChk(ierr);
+    }
+  ierr = CeedFree(&op->inputfields); CeedChk(ierr);
+  ierr = CeedFree(&op->outputfields); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&op->qfassembled); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&op->qfassembledrstr); CeedChk(ierr);
+  ierr = CeedOperatorDestroyFallback(op); CeedChk(ierr);
+  ierr = CeedFree(opdelegate); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Get the size in bytes of one value stored with a CeedStorageType
+
+  @param storage     CeedStorageType
+  @param[out] size   Variable to store size in bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedStorageGetSize(CeedStorageType storage, size_t *size) {
+  switch (storage) {
+  case CEED_STORAGE_SCALAR:
+    *size = sizeof(CeedScalar);
+    break;
+  case CEED_STORAGE_FP32:
+    *size = sizeof(float);
+    break;
+  case CEED_STORAGE_BF16:
+    *size = sizeof(uint16_t);
+    break;
+  }
+  return 0;
+}
+
+/**
+  @brief Convert CeedScalar values to a CeedStorageType, rounding to nearest
+
+  @param storage  CeedStorageType of @a out
+  @param n        Number of values
+  @param in       Array of @a n CeedScalar values
+  @param[out] out Array of @a n values stored as @a storage
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedStorageNarrow(CeedStorageType storage, CeedInt n, const CeedScalar *in,
+                      void *out) {
+  switch (storage) {
+  case CEED_STORAGE_SCALAR:
+    memcpy(out, in, n*sizeof(CeedScalar));
+    break;
+  case CEED_STORAGE_FP32:
+    for (CeedInt i=0; i<n; i++)
+      ((float *)out)[i] = in[i];
+    break;
+  case CEED_STORAGE_BF16:
+    for (CeedInt i=0; i<n; i++) {
+      float f = in[i];
+      uint32_t u;
+      memcpy(&u, &f, sizeof(u));
+      if (isnan(f))
+        u |= 0x00400000; // Keep NaN after truncation
+      else
+        u += 0x7fff + ((u >> 16) & 1); // Round to nearest even
+      ((uint16_t *)out)[i] = u >> 16;
+    }
+    break;
+  }
+  return 0;
+}
+
+/**
+  @brief Convert values stored with a CeedStorageType to CeedScalar
+
+  @param storage  CeedStorageType of @a in
+  @param n        Number of values
+  @param in       Array of @a n values stored as @a storage
+  @param[out] out Array of @a n CeedScalar values
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedStorageWiden(CeedStorageType storage, CeedInt n, const void *in,
+                     CeedScalar *out) {
+  switch (storage) {
+  case CEED_STORAGE_SCALAR:
+    memcpy(out, in, n*sizeof(CeedScalar));
+    break;
+  case CEED_STORAGE_FP32:
+    for (CeedInt i=0; i<n; i++)
+      out[i] = ((const float *)in)[i];
+    break;
+  case CEED_STORAGE_BF16:
+    for (CeedInt i=0; i<n; i++) {
+      uint32_t u = (uint32_t)((const uint16_t *)in)[i] << 16;
+      float f;
+      memcpy(&f, &u, sizeof(f));
+      out[i] = f;
+    }
+    break;
+  }
+  return 0;
+}
+
+/// @}
+
+/// ----------------------------------------------------------------------------
+/// CeedOperator Public API
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedOperatorUser
+/// @{
+
+/**
+  @brief Create a CeedOperator and associate a CeedQFunction. A CeedBasis and
+           CeedElemRestriction can be associated with CeedQFunction fields with
+           \ref CeedOperatorSetField.
+
+  @param ceed    A Ceed object where the CeedOperator will be created
+  @param qf      QFunction defining the action of the operator at quadrature points
+  @param dqf     QFunction defining the action of the Jacobian of @a qf (or
+                   @ref CEED_QFUNCTION_NONE)
+  @param dqfT    QFunction defining the action of the transpose of the Jacobian
+                   of @a qf (or @ref CEED_QFUNCTION_NONE)
+  @param[out] op Address of the variable where the newly created
+                     CeedOperator will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+ */
+int CeedOperatorCreate(Ceed ceed, CeedQFunction qf, CeedQFunction dqf,
+                       CeedQFunction dqfT, CeedOperator *op) {
+  int ierr;
+
+  if (!ceed->OperatorCreate) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(ceed, &delegate, "Operator"); CeedChk(ierr);
+
+    if (!delegate)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Backend does not support OperatorCreate");
+    // LCOV_EXCL_STOP
+
+    ierr = CeedOperatorCreate(delegate, qf, dqf, dqfT, op); CeedChk(ierr);
+    return 0;
+  }
+
+  if (!qf || qf == CEED_QFUNCTION_NONE)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Operator must have a valid QFunction.");
+  // LCOV_EXCL_STOP
+  ierr = CeedCalloc(1, op); CeedChk(ierr);
+  (*op)->ceed = ceed;
+  CeedReference(ceed);
+  (*op)->refcount = 1;
+  (*op)->qf = qf;
+  CeedReference(qf);
+  if (dqf && dqf != CEED_QFUNCTION_NONE) {
+    (*op)->dqf = dqf;
+    CeedReference(dqf);
+  }
+  if (dqfT && dqfT != CEED_QFUNCTION_NONE) {
+    (*op)->dqfT = dqfT;
+    CeedReference(dqfT);
+  }
+  ierr = CeedCalloc(qf->numinputfields, &(*op)->inputfields); CeedChk(ierr);
+  ierr = CeedCalloc(qf->numoutputfields, &(*op)->outputfields); CeedChk(ierr);
+  ierr = ceed->OperatorCreate(*op); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Create an operator that composes the action of several operators
+
+  @param ceed    A Ceed object where the CeedOperator will be created
+  @param[out] op Address of the variable where the newly created
+                     Composite CeedOperator will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+ */
+int CeedCompositeOperatorCreate(Ceed ceed, CeedOperator *op) {
+  int ierr;
+
+  if (!ceed->CompositeOperatorCreate) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(ceed, &delegate, "Operator"); CeedChk(ierr);
+
+    if (delegate) {
+      ierr = CeedCompositeOperatorCreate(delegate, op); CeedChk(ierr);
+      return 0;
+    }
+  }
+
+  ierr = CeedCalloc(1, op); CeedChk(ierr);
+  (*op)->ceed = ceed;
+  CeedReference(ceed);
+  (*op)->composite = true;
+  ierr = CeedCalloc(16, &(*op)->suboperators); CeedChk(ierr);
+
+  if (ceed->CompositeOperatorCreate) {
+    ierr = ceed->CompositeOperatorCreate(*op); CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Provide a field to a CeedOperator for use by its CeedQFunction
+
+  This function is used to specify both active and passive fields to a
+  CeedOperator.  For passive fields, a vector @arg v must be provided.  Passive
+  fields can inputs or outputs (updated in-place when operator is applied).
+
+  Active fields must be specified using this function, but their data (in a
+  CeedVector) is passed in CeedOperatorApply().  There can be at most one active
+  input and at most one active output.
+
+  @param op         CeedOperator on which to provide the field
+  @param fieldname  Name of the field (to be matched with the name used by
+                      CeedQFunction)
+  @param r          CeedElemRestriction
+  @param b          CeedBasis in which the field resides or @ref CEED_BASIS_COLLOCATED
+                      if collocated with quadrature points
+  @param v          CeedVector to be used by CeedOperator or @ref CEED_VECTOR_ACTIVE
+                      if field is active or @ref CEED_VECTOR_NONE if using
+                      @ref CEED_EVAL_WEIGHT in the QFunction
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorSetField(CeedOperator op, const char *fieldname,
+                         CeedElemRestriction r, CeedBasis b, CeedVector v) {
+  int ierr;
+  if (op->composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Cannot add field to composite operator.");
+  // LCOV_EXCL_STOP
+  if (!r)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1,
+                     "ElemRestriction r for field \"%s\" must be non-NULL.",
+                     fieldname);
+  // LCOV_EXCL_STOP
+  if (!b)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Basis b for field \"%s\" must be non-NULL.",
+                     fieldname);
+  // LCOV_EXCL_STOP
+  if (!v)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Vector v for field \"%s\" must be non-NULL.",
+                     fieldname);
+  // LCOV_EXCL_STOP
+
+  CeedInt numelements;
+  ierr = CeedElemRestrictionGetNumElements(r, &numelements); CeedChk(ierr);
+  if (r != CEED_ELEMRESTRICTION_NONE && op->hasrestriction &&
+      op->numelements != numelements)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1,
+                     "ElemRestriction with %d elements incompatible with prior "
+                     "%d elements", numelements, op->numelements);
+  // LCOV_EXCL_STOP
+  if (r != CEED_ELEMRESTRICTION_NONE) {
+    op->numelements = numelements;
+    op->hasrestriction = true; // Restriction set, but numelements may be 0
+  }
+
+  if (b != CEED_BASIS_COLLOCATED) {
+    CeedInt numqpoints;
+    ierr = CeedBasisGetNumQuadraturePoints(b, &numqpoints); CeedChk(ierr);
+    if (op->numqpoints && op->numqpoints != numqpoints)
+      // LCOV_EXCL_START
+      return CeedError(op->ceed, 1, "Basis with %d quadrature points "
+                       "incompatible with prior %d points", numqpoints,
+                       op->numqpoints);
+    // LCOV_EXCL_STOP
+    op->numqpoints = numqpoints;
+  }
+  CeedQFunctionField qfield;
+  CeedOperatorField *ofield;
+  for (CeedInt i=0; i<op->qf->numinputfields; i++) {
+    if (!strcmp(fieldname, (*op->qf->inputfields[i]).fieldname)) {
+      qfield = op->qf->inputfields[i];
+      ofield = &op->inputfields[i];
+      goto found;
+    }
+  }
+  for (CeedInt i=0; i<op->qf->numoutputfields; i++) {
+    if (!strcmp(fieldname, (*op->qf->outputfields[i]).fieldname)) {
+      qfield = op->qf->outputfields[i];
+      ofield = &op->outputfields[i];
+      goto found;
+    }
+  }
+  // LCOV_EXCL_START
+  return CeedError(op->ceed, 1, "QFunction has no knowledge of field '%s'",
+                   fieldname);
+  // LCOV_EXCL_STOP
+found:
+  if (r == CEED_ELEMRESTRICTION_NONE && qfield->emode != CEED_EVAL_WEIGHT)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "CEED_ELEMRESTRICTION_NONE can only be used "
+                     "for a field with eval mode CEED_EVAL_WEIGHT");
+  // LCOV_EXCL_STOP
+  ierr = CeedCalloc(1, ofield); CeedChk(ierr);
+  (*ofield)->Erestrict = r;
+  CeedReference(r);
+  (*ofield)->basis = b;
+  if (b != CEED_BASIS_COLLOCATED)
+    CeedReference(b);
+  (*ofield)->vec = v;
+  if (v != CEED_VECTOR_ACTIVE && v != CEED_VECTOR_NONE)
+    CeedReference(v);
+  op->nfields += 1;
+  // Passive fields given at quadrature points are accounted as qdata
+  if (b == CEED_BASIS_COLLOCATED && qfield->emode == CEED_EVAL_NONE &&
+      v != CEED_VECTOR_ACTIVE && v != CEED_VECTOR_NONE &&
+      v->memclass == CEED_MEMORY_VECTOR) {
+    ierr = CeedVectorSetMemoryClass(v, CEED_MEMORY_QDATA); CeedChk(ierr);
+  }
+
+  size_t len = strlen(fieldname);
+  char *tmp;
+  ierr = CeedCalloc(len+1, &tmp); CeedChk(ierr);
+  memcpy(tmp, fieldname, len+1);
+  (*ofield)->fieldname = tmp;
+  return 0;
+}
 
-  // Prolongation
-  CeedQFunction qfProlong;
-  ierr = CeedQFunctionCreateInteriorByName(ceed, "Scale", &qfProlong);
-  CeedChk(ierr);
-  CeedInt *ncompPData;
-  ierr = CeedCalloc(1, &ncompPData); CeedChk(ierr);
-  ncompPData[0] = ncomp;
-  CeedQFunctionContext ctxP;
-  ierr = CeedQFunctionContextCreate(ceed, &ctxP); CeedChk(ierr);
-  ierr = CeedQFunctionContextSetData(ctxP, CEED_MEM_HOST, CEED_OWN_POINTER,
-                                     sizeof(*ncompPData), ncompPData);
-  CeedChk(ierr);
-  ierr = CeedQFunctionSetContext(qfProlong, ctxP); CeedChk(ierr);
-  ierr = CeedQFunctionContextDestroy(&ctxP); CeedChk(ierr);
-  ierr = CeedQFunctionAddInput(qfProlong, "input", ncomp, CEED_EVAL_INTERP);
-  CeedChk(ierr);
-  ierr = CeedQFunctionAddInput(qfProlong, "scale", ncomp, CEED_EVAL_NONE);
-  CeedChk(ierr);
-  ierr = CeedQFunctionAddOutput(qfProlong, "output", ncomp, CEED_EVAL_NONE);
-  CeedChk(ierr);
+/**
+  @brief Compute a passive input field of a CeedOperator on demand
 
-  ierr = CeedOperatorCreate(ceed, qfProlong, CEED_QFUNCTION_NONE,
-                            CEED_QFUNCTION_NONE, opProlong);
-  CeedChk(ierr);
-  ierr = CeedOperatorSetField(*opProlong, "input", rstrCoarse, basisCtoF,
-                              CEED_VECTOR_ACTIVE); CeedChk(ierr);
-  ierr = CeedOperatorSetField(*opProlong, "scale", rstrFine,
-                              CEED_BASIS_COLLOCATED, multVec);
-  CeedChk(ierr);
-  ierr = CeedOperatorSetField(*opProlong, "output", rstrFine,
-                              CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
-  CeedChk(ierr);
+  The passive input vector of the field, such as quadrature data, is marked as
+    the (active) output of a build CeedOperator applied to @a buildinput. Before
+    @a op is applied or assembled, the field is rebuilt if it has not been
+    built yet or if the state of @a buildinput, a passive input vector, or a
+    CeedQFunctionContext of @a buildop changed since the last build. Unchanged
+    inputs do not trigger a rebuild.
 
-  // Cleanup
-  ierr = CeedVectorDestroy(&multVec); CeedChk(ierr);
-  ierr = CeedBasisDestroy(&basisCtoF); CeedChk(ierr);
-  ierr = CeedQFunctionDestroy(&qfRestrict); CeedChk(ierr);
-  ierr = CeedQFunctionDestroy(&qfProlong); CeedChk(ierr);
+  @param op          CeedOperator with the passive input field
+  @param fieldname   Name of the passive input field
+  @param buildop     CeedOperator computing the field vector
+  @param buildinput  Active input vector of @a buildop, such as the mesh
+                       coordinates, or @ref CEED_VECTOR_NONE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorSetFieldBuilder(CeedOperator op, const char *fieldname,
+                                CeedOperator buildop, CeedVector buildinput) {
+  int ierr;
+  if (op->composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Cannot set field builder on composite "
+                     "operator.");
+  // LCOV_EXCL_STOP
+
+  CeedOperatorField field = NULL;
+  for (CeedInt i=0; i<op->qf->numinputfields; i++)
+    if (op->inputfields[i] && !strcmp(fieldname, op->inputfields[i]->fieldname))
+      field = op->inputfields[i];
+  if (!field)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Operator has no input field '%s' set",
+                     fieldname);
+  // LCOV_EXCL_STOP
+  if (field->vec == CEED_VECTOR_ACTIVE || field->vec == CEED_VECTOR_NONE)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Field '%s' must have a passive vector",
+                     fieldname);
+  // LCOV_EXCL_STOP
 
+  CeedReference(buildop);
+  ierr = CeedOperatorDestroy(&field->buildop); CeedChk(ierr);
+  field->buildop = buildop;
+  if (buildinput && buildinput != CEED_VECTOR_NONE)
+    CeedReference(buildinput);
+  if (field->buildinput != CEED_VECTOR_NONE) {
+    ierr = CeedVectorDestroy(&field->buildinput); CeedChk(ierr);
+  }
+  field->buildinput = buildinput;
+  field->built = false;
   return 0;
 }
 
-/// @}
+/**
+  @brief Store a passive input field of a CeedOperator in reduced precision
 
-/// ----------------------------------------------------------------------------
-/// CeedOperator Backend API
-/// ----------------------------------------------------------------------------
-/// @addtogroup CeedOperatorBackend
-/// @{
+  The values of the passive input vector, such as quadrature data, are rounded
+    to @a storage when they are restricted to elements, and widened to
+    CeedScalar when read by the CeedQFunction. The opt, CUDA, and HIP
+    backends keep the restricted values in the reduced precision, reducing
+    memory footprint and traffic, while the CeedQFunction and the solution
+    remain in CeedScalar precision.
 
-/**
-  @brief Get the Ceed associated with a CeedOperator
+  The field must use @ref CEED_EVAL_NONE. This must be called before the
+    operator is applied or assembled.
 
-  @param op              CeedOperator
-  @param[out] ceed       Variable to store Ceed
+  @param op         CeedOperator with the passive input field
+  @param fieldname  Name of the passive input field
+  @param storage    CeedStorageType for the field values
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref User
 **/
+int CeedOperatorSetFieldStorage(CeedOperator op, const char *fieldname,
+                                CeedStorageType storage) {
+  if (op->composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Cannot set field storage on composite "
+                     "operator.");
+  // LCOV_EXCL_STOP
+  if (op->setupdone)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Cannot set field storage after the "
+                     "operator is set up");
+  // LCOV_EXCL_STOP
 
-int CeedOperatorGetCeed(CeedOperator op, Ceed *ceed) {
-  *ceed = op->ceed;
-  return 0;
+  for (CeedInt i=0; i<op->qf->numinputfields; i++) {
+    CeedOperatorField field = op->inputfields[i];
+    if (!field || strcmp(fieldname, field->fieldname))
+      continue;
+    if (field->vec == CEED_VECTOR_ACTIVE || field->vec == CEED_VECTOR_NONE)
+      // LCOV_EXCL_START
+      return CeedError(op->ceed, 1, "Field '%s' must have a passive vector",
+                       fieldname);
+    // LCOV_EXCL_STOP
+    if (op->qf->inputfields[i]->emode != CEED_EVAL_NONE)
+      // LCOV_EXCL_START
+      return CeedError(op->ceed, 1, "Field '%s' must use CEED_EVAL_NONE",
+                       fieldname);
+    // LCOV_EXCL_STOP
+    field->storage = storage;
+    return 0;
+  }
+  // LCOV_EXCL_START
+  return CeedError(op->ceed, 1, "Operator has no input field '%s' set",
+                   fieldname);
+  // LCOV_EXCL_STOP
 }
 
 /**
-  @brief Get the number of elements associated with a CeedOperator
+  @brief Reduce an output field of a CeedOperator over all quadrature points
+           and elements
 
-  @param op              CeedOperator
-  @param[out] numelem    Variable to store number of elements
+  The CeedQFunction values of the field are reduced, component by component,
+    into @a result when the operator is applied, instead of being restricted
+    to an L-vector, for functionals such as energies, fluxes, or error norms;
+    quadrature weights are applied by the CeedQFunction. Only the values at
+    quadrature points are stored. @ref CeedOperatorApply() overwrites
+    @a result, while @ref CeedOperatorApplyAdd() combines the reductions with
+    its values.
+
+  The field must use @ref CEED_EVAL_NONE and is set by this function, after
+    the fields that set the number of elements and quadrature points.
+
+  @param op         CeedOperator
+  @param fieldname  Name of the output field
+  @param rtype      CeedReduceType applied to the values of each component
+  @param result     CeedVector with one entry per component of the field
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref User
 **/
-
-int CeedOperatorGetNumElements(CeedOperator op, CeedInt *numelem) {
+int CeedOperatorSetFieldReduce(CeedOperator op, const char *fieldname,
+                               CeedReduceType rtype, CeedVector result) {
+  int ierr;
   if (op->composite)
     // LCOV_EXCL_START
-    return CeedError(op->ceed, 1, "Not defined for composite operator");
+    return CeedError(op->ceed, 1, "Cannot add field to composite operator.");
+  // LCOV_EXCL_STOP
+  if (!op->hasrestriction || !op->numqpoints)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Fields setting the number of elements and "
+                     "quadrature points must be set before reduced field "
+                     "'%s'", fieldname);
   // LCOV_EXCL_STOP
 
-  *numelem = op->numelements;
+  CeedInt i;
+  for (i=0; i<op->qf->numoutputfields; i++)
+    if (!strcmp(fieldname, op->qf->outputfields[i]->fieldname))
+      break;
+  if (i == op->qf->numoutputfields)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "QFunction has no output field '%s'",
+                     fieldname);
+  // LCOV_EXCL_STOP
+  CeedQFunctionField qfield = op->qf->outputfields[i];
+  if (qfield->emode != CEED_EVAL_NONE)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Field '%s' must use CEED_EVAL_NONE",
+                     fieldname);
+  // LCOV_EXCL_STOP
+  if (result->length != qfield->size)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "CeedVector of length %d cannot store the "
+                     "reductions of %d components", result->length,
+                     qfield->size);
+  // LCOV_EXCL_STOP
+
+  // Quadrature point values, component by component
+  const CeedInt nelem = op->numelements, Q = op->numqpoints,
+                ncomp = qfield->size;
+  CeedInt strides[3] = {1, nelem*Q, Q};
+  CeedElemRestriction rstr;
+  CeedVector qvec;
+  ierr = CeedElemRestrictionCreateStrided(op->ceed, nelem, Q, ncomp,
+                                          nelem*Q*ncomp, strides, &rstr);
+  CeedChk(ierr);
+  ierr = CeedVectorCreate(op->ceed, nelem*Q*ncomp, &qvec); CeedChk(ierr);
+  ierr = CeedOperatorSetField(op, fieldname, rstr, CEED_BASIS_COLLOCATED,
+                              qvec); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstr); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&qvec); CeedChk(ierr);
+
+  CeedReference(result);
+  op->outputfields[i]->reduction = result;
+  op->outputfields[i]->rtype = rtype;
   return 0;
 }
 
 /**
-  @brief Get the number of quadrature points associated with a CeedOperator
-
-  @param op              CeedOperator
-  @param[out] numqpts    Variable to store vector number of quadrature points
+  @brief Constrain entries of the active vectors of a CeedOperator to
+           Dirichlet values
+
+  Applying the operator then computes out = P A (P in + g), where P zeroes the
+    constrained entries and g holds their values: the constrained input
+    entries are replaced by @a values while the input is restricted to
+    elements, and the element contributions to constrained output entries are
+    dropped before the transpose restriction.  @ref CeedOperatorApply() and
+    @ref CeedOperatorApplyDot() set the constrained output entries to zero,
+    while @ref CeedOperatorApplyAdd() leaves them unchanged, so boundary values
+    need no separate insertion or zeroing passes over the vectors.  Backends
+    without native support apply the constraint through a copy of the input
+    on the host.  Linear assembly ignores the constraint.
+
+  @param op       CeedOperator with matching active input and output vectors
+  @param nbc      Number of constrained entries, or 0 to remove the constraint
+  @param indices  Constrained entries of the active L-vectors, copied
+  @param values   CeedVector of length @a nbc with the constrained values, or
+                    @ref CEED_VECTOR_NONE for zero values
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref User
 **/
-
-int CeedOperatorGetNumQuadraturePoints(CeedOperator op, CeedInt *numqpts) {
-  if (op->composite)
+int CeedOperatorSetDirichlet(CeedOperator op, CeedInt nbc,
+                             const CeedInt *indices, CeedVector values) {
+  int ierr;
+  if (nbc < 0 || (values != CEED_VECTOR_NONE && values->length != nbc))
     // LCOV_EXCL_START
-    return CeedError(op->ceed, 1, "Not defined for composite operator");
+    return CeedError(op->ceed, 1, "Dirichlet values must have one entry for "
+                     "each of the %d constrained entries", nbc);
+  // LCOV_EXCL_STOP
+  for (CeedInt k=0; k<nbc; k++)
+    if (indices[k] < 0)
+      // LCOV_EXCL_START
+      return CeedError(op->ceed, 1, "Invalid constrained entry %d",
+                       indices[k]);
   // LCOV_EXCL_STOP
 
-  *numqpts = op->numqpoints;
+  ierr = CeedFree(&op->bcindices); CeedChk(ierr);
+  ierr = CeedFree(&op->bcsaved); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&op->bcvalues); CeedChk(ierr);
+  op->bcvalues = NULL;
+  op->nbc = nbc;
+  if (nbc) {
+    ierr = CeedMalloc(nbc, &op->bcindices); CeedChk(ierr);
+    memcpy(op->bcindices, indices, nbc*sizeof(CeedInt));
+  }
+  if (nbc && values != CEED_VECTOR_NONE) {
+    CeedReference(values);
+    op->bcvalues = values;
+  }
+  if (op->SetDirichlet) {
+    ierr = op->SetDirichlet(op); CeedChk(ierr);
+  }
   return 0;
 }
 
 /**
-  @brief Get the number of arguments associated with a CeedOperator
+  @brief Add a sub-operator to a composite CeedOperator
 
-  @param op              CeedOperator
-  @param[out] numargs    Variable to store vector number of arguments
+  @param[out] compositeop Composite CeedOperator
+  @param      subop       Sub-operator CeedOperator
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
-**/
+  @ref User
+ */
+int CeedCompositeOperatorAddSub(CeedOperator compositeop, CeedOperator subop) {
+  if (!compositeop->composite || compositeop->sharded)
+    // LCOV_EXCL_START
+    return CeedError(compositeop->ceed, 1, "CeedOperator is not a composite "
+                     "operator");
+  // LCOV_EXCL_STOP
 
-int CeedOperatorGetNumArgs(CeedOperator op, CeedInt *numargs) {
-  if (op->composite)
+  if (compositeop->numsub == CEED_COMPOSITE_MAX)
     // LCOV_EXCL_START
-    return CeedError(op->ceed, 1, "Not defined for composite operators");
+    return CeedError(compositeop->ceed, 1, "Cannot add additional suboperators");
   // LCOV_EXCL_STOP
 
-  *numargs = op->nfields;
+  int ierr = CeedCompositeOperatorDestroyFusion(compositeop); CeedChk(ierr);
+  compositeop->suboperators[compositeop->numsub] = subop;
+  CeedReference(subop);
+  compositeop->numsub++;
   return 0;
 }
 
 /**
-  @brief Get the setup status of a CeedOperator
+  @brief Create an operator that sums the action of operators on other Ceeds
 
-  @param op                CeedOperator
-  @param[out] issetupdone  Variable to store setup status
+  Each shard is a CeedOperator on its own Ceed, typically a Ceed for one of
+    several devices selected with the resource suffix ":device_id=N", acting
+    on a part of the elements of the problem. When the sharded operator is
+    applied, the input L-vector is copied to each shard, the shards are
+    applied concurrently on their devices, and their outputs are summed into
+    the output L-vector. The copies are staged through host memory. Shared
+    degrees of freedom are reduced on the host, and only active vectors are
+    exchanged.
+
+  Sharded operators can be applied but not assembled.
+
+  @param ceed    A Ceed object where the CeedOperator will be created, the
+                   Ceed of the input and output vectors
+  @param[out] op Address of the variable where the newly created
+                     sharded CeedOperator will be stored
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
-**/
+  @ref User
+ */
+int CeedShardedOperatorCreate(Ceed ceed, CeedOperator *op) {
+  int ierr;
 
-int CeedOperatorIsSetupDone(CeedOperator op, bool *issetupdone) {
-  *issetupdone = op->setupdone;
+  ierr = CeedCalloc(1, op); CeedChk(ierr);
+  (*op)->ceed = ceed;
+  CeedReference(ceed);
+  (*op)->refcount = 1;
+  (*op)->composite = true;
+  (*op)->sharded = true;
+  ierr = CeedCalloc(CEED_COMPOSITE_MAX, &(*op)->suboperators); CeedChk(ierr);
+  ierr = CeedCalloc(CEED_COMPOSITE_MAX, &(*op)->shardin); CeedChk(ierr);
+  ierr = CeedCalloc(CEED_COMPOSITE_MAX, &(*op)->shardout); CeedChk(ierr);
   return 0;
 }
 
 /**
-  @brief Get the QFunction associated with a CeedOperator
+  @brief Add a shard to a sharded CeedOperator
 
-  @param op              CeedOperator
-  @param[out] qf         Variable to store QFunction
+  @param[out] shardedop Sharded CeedOperator
+  @param      shard     CeedOperator on any Ceed, with active input and
+                          output L-vectors of the sizes of those passed to
+                          @a shardedop
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
-**/
+  @ref User
+ */
+int CeedShardedOperatorAddShard(CeedOperator shardedop, CeedOperator shard) {
+  if (!shardedop->sharded)
+    // LCOV_EXCL_START
+    return CeedError(shardedop->ceed, 1, "CeedOperator is not a sharded "
+                     "operator");
+  // LCOV_EXCL_STOP
 
-int CeedOperatorGetQFunction(CeedOperator op, CeedQFunction *qf) {
-  if (op->composite)
+  if (shardedop->numsub == CEED_COMPOSITE_MAX)
     // LCOV_EXCL_START
-    return CeedError(op->ceed, 1, "Not defined for composite operator");
+    return CeedError(shardedop->ceed, 1, "Cannot add additional shards");
   // LCOV_EXCL_STOP
 
-  *qf = op->qf;
+  shardedop->suboperators[shardedop->numsub] = shard;
+  CeedReference(shard);
+  shardedop->numsub++;
   return 0;
 }
 
 /**
-  @brief Get a boolean value indicating if the CeedOperator is composite
+  @brief Create a sharded CeedOperator splitting the elements of an operator
+           between Ceeds
+
+  Each of @a ops is the same CeedOperator, with the same numbering of the
+    elements, created on its own Ceed, for example one for a GPU resource
+    such as "/gpu/cuda/gen" and one for a threaded CPU resource such as
+    "/cpu/openmp/opt". The sharded operator applies a contiguous range of the
+    elements of each operator, through @ref CeedOperatorCreateSubsetRange(),
+    so the elements are split between the Ceeds, which run concurrently.
+    The degrees of freedom shared by elements in different ranges are reduced
+    on the host, as for any sharded operator.
+
+  The elements are split evenly at first. The first
+    @ref CEED_SPLIT_TIMED_APPLIES applies with an output vector time each
+    shard, and split the elements again in proportion to the throughput of
+    the shards.
+
+  @param ceed    A Ceed object where the CeedOperator will be created, the
+                   Ceed of the input and output vectors
+  @param numops  Number of operators, at most 16
+  @param ops     Array of @a numops CeedOperators, each on its own Ceed
+  @param[out] op Address of the variable where the newly created
+                     sharded CeedOperator will be stored
 
-  @param op                CeedOperator
-  @param[out] iscomposite  Variable to store composite status
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+ */
+int CeedShardedOperatorCreateSplit(Ceed ceed, CeedInt numops,
+                                   CeedOperator *ops, CeedOperator *op) {
+  int ierr;
+  CeedInt nelem;
+
+  if (numops < 1 || numops > CEED_COMPOSITE_MAX)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Cannot split an operator into %d shards",
+                     numops);
+  // LCOV_EXCL_STOP
+  ierr = CeedOperatorGetNumElements(ops[0], &nelem); CeedChk(ierr);
+  for (CeedInt s=1; s<numops; s++) {
+    CeedInt n;
+    ierr = CeedOperatorGetNumElements(ops[s], &n); CeedChk(ierr);
+    if (n != nelem)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Split operators must have the same number "
+                       "of elements, %d != %d", n, nelem);
+    // LCOV_EXCL_STOP
+  }
+
+  ierr = CeedShardedOperatorCreate(ceed, op); CeedChk(ierr);
+  ierr = CeedCalloc(numops, &(*op)->splitops); CeedChk(ierr);
+  ierr = CeedCalloc(numops+1, &(*op)->splitfirst); CeedChk(ierr);
+  for (CeedInt s=0; s<numops; s++) {
+    CeedOperator shard;
+    (*op)->splitops[s] = ops[s];
+    CeedReference(ops[s]);
+    (*op)->splitfirst[s+1] = (CeedInt)(((int64_t)nelem*(s+1))/numops);
+    ierr = CeedSetCurrentDevice(ops[s]->ceed); CeedChk(ierr);
+    ierr = CeedOperatorCreateSubsetRange(ops[s], (*op)->splitfirst[s],
+                                         (*op)->splitfirst[s+1], &shard);
+    CeedChk(ierr);
+    ierr = CeedShardedOperatorAddShard(*op, shard); CeedChk(ierr);
+    ierr = CeedOperatorDestroy(&shard); CeedChk(ierr);
+  }
+  ierr = CeedSetCurrentDevice(ceed); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Create a p-adaptive CeedOperator from the polynomial order of each
+           element
+
+  The elements are grouped by order, and each group is applied by its own
+    suboperator of a composite CeedOperator, with restrictions laid out group
+    by group, so each group runs with the basis of its order and without
+    padding to the largest order. Backends that apply the suboperators of a
+    composite concurrently launch all groups together. The fields are set
+    with @ref CeedOperatorSetFieldPAdaptive().
+
+  @param ceed       A Ceed object where the CeedOperator will be created
+  @param qf         QFunction defining the action of the operator at
+                      quadrature points
+  @param nelem      Number of elements
+  @param elemorder  Array of size @a nelem with the order of each element, a
+                      nonnegative integer such as the number of nodes P per
+                      direction; at most 16 distinct orders
+  @param[out] op    Address of the variable where the newly created
+                      CeedOperator will be stored
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
-**/
+  @ref User
+ */
+int CeedOperatorCreatePAdaptive(Ceed ceed, CeedQFunction qf, CeedInt nelem,
+                                const CeedInt *elemorder, CeedOperator *op) {
+  int ierr;
+  CeedInt maxorder = 0, numorders = 0, *count;
 
-int CeedOperatorIsComposite(CeedOperator op, bool *iscomposite) {
-  *iscomposite = op->composite;
+  for (CeedInt e=0; e<nelem; e++) {
+    if (elemorder[e] < 0)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Element %d has negative order %d", e,
+                       elemorder[e]);
+    // LCOV_EXCL_STOP
+    maxorder = CeedIntMax(maxorder, elemorder[e]);
+  }
+  ierr = CeedCalloc(maxorder+2, &count); CeedChk(ierr);
+  for (CeedInt e=0; e<nelem; e++)
+    count[elemorder[e]+1]++;
+  for (CeedInt p=0; p<=maxorder; p++)
+    numorders += count[p+1] > 0;
+  if (numorders > CEED_COMPOSITE_MAX) {
+    // LCOV_EXCL_START
+    ierr = CeedFree(&count); CeedChk(ierr);
+    return CeedError(ceed, 1, "Cannot group elements of %d distinct orders",
+                     numorders);
+    // LCOV_EXCL_STOP
+  }
+
+  ierr = CeedCompositeOperatorCreate(ceed, op); CeedChk(ierr);
+  (*op)->numorders = numorders;
+  ierr = CeedMalloc(numorders, &(*op)->orders); CeedChk(ierr);
+  ierr = CeedMalloc(numorders+1, &(*op)->orderfirst); CeedChk(ierr);
+  ierr = CeedMalloc(nelem, &(*op)->orderelems); CeedChk(ierr);
+
+  // Counting sort of the elements by order, keeping their numbering within
+  //   each group
+  for (CeedInt p=0; p<=maxorder; p++)
+    count[p+1] += count[p];
+  (*op)->orderfirst[0] = 0;
+  for (CeedInt p=0, g=0; p<=maxorder; p++)
+    if (count[p+1] > count[p]) {
+      (*op)->orders[g] = p;
+      (*op)->orderfirst[++g] = count[p+1];
+    }
+  for (CeedInt e=0; e<nelem; e++)
+    (*op)->orderelems[count[elemorder[e]]++] = e;
+  ierr = CeedFree(&count); CeedChk(ierr);
+
+  for (CeedInt g=0; g<numorders; g++) {
+    CeedOperator subop;
+    ierr = CeedOperatorCreate(ceed, qf, CEED_QFUNCTION_NONE,
+                              CEED_QFUNCTION_NONE, &subop); CeedChk(ierr);
+    ierr = CeedCompositeOperatorAddSub(*op, subop); CeedChk(ierr);
+    ierr = CeedOperatorDestroy(&subop); CeedChk(ierr);
+  }
   return 0;
 }
 
 /**
-  @brief Get the number of suboperators associated with a CeedOperator
+  @brief Provide a field to a p-adaptive CeedOperator
 
-  @param op              CeedOperator
-  @param[out] numsub     Variable to store number of suboperators
+  The offsets of all elements are given in the numbering of the elements, and
+    are regrouped by order into the restrictions of the groups, which share
+    one allocation, see @ref CeedElemRestrictionCreateBatch().
+
+  @param op         CeedOperator created with
+                      @ref CeedOperatorCreatePAdaptive()
+  @param fieldname  Name of the field (to be matched with the name used by
+                      CeedQFunction)
+  @param elemsize   Array indexed by order with the element size of the
+                      elements of each order, or NULL for
+                      @ref CEED_ELEMRESTRICTION_NONE
+  @param ncomp      Number of field components per interpolation node
+  @param compstride Stride between components for the same L-vector "node"
+  @param lsize      The size of the L-vector
+  @param offsets    Array holding, element after element, the
+                      elemsize[elemorder[e]] offsets of each element e, or
+                      NULL for an L-vector holding the data of the elements
+                      one after the other, each with the layout
+                      [ncomp, elemsize], as for quadrature data
+  @param bases      Array indexed by order with the basis of the elements of
+                      each order, or NULL for @ref CEED_BASIS_COLLOCATED
+  @param v          CeedVector to be used by CeedOperator or
+                      @ref CEED_VECTOR_ACTIVE or @ref CEED_VECTOR_NONE
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref User
 **/
+int CeedOperatorSetFieldPAdaptive(CeedOperator op, const char *fieldname,
+                                  const CeedInt *elemsize, CeedInt ncomp,
+                                  CeedInt compstride, CeedInt lsize,
+                                  const CeedInt *offsets,
+                                  const CeedBasis *bases, CeedVector v) {
+  int ierr;
+  const CeedInt numorders = op->numorders;
 
-int CeedOperatorGetNumSub(CeedOperator op, CeedInt *numsub) {
-  if (!op->composite)
+  if (!op->orders)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Operator is not p-adaptive");
+  // LCOV_EXCL_STOP
+
+  CeedElemRestriction rstrs[CEED_COMPOSITE_MAX];
+  for (CeedInt g=0; g<numorders; g++)
+    rstrs[g] = CEED_ELEMRESTRICTION_NONE;
+  if (elemsize) {
+    const CeedInt nelem = op->orderfirst[numorders];
+    const CeedInt *elems = op->orderelems;
+    CeedInt *start, gnelem[CEED_COMPOSITE_MAX], gelemsize[CEED_COMPOSITE_MAX];
+
+    // Start of the data of each element, in the numbering of the elements
+    ierr = CeedCalloc(nelem+1, &start); CeedChk(ierr);
+    for (CeedInt g=0; g<numorders; g++) {
+      gnelem[g] = op->orderfirst[g+1] - op->orderfirst[g];
+      gelemsize[g] = elemsize[op->orders[g]];
+      for (CeedInt i=op->orderfirst[g]; i<op->orderfirst[g+1]; i++)
+        start[elems[i]+1] = gelemsize[g]*(offsets ? 1 : ncomp);
+    }
+    for (CeedInt e=0; e<nelem; e++)
+      start[e+1] += start[e];
+
+    if (offsets) {
+      // Offsets of the groups one after the other
+      CeedInt *goffsets;
+      ierr = CeedMalloc(start[nelem], &goffsets); CeedChk(ierr);
+      for (CeedInt i=0, j=0; i<nelem; i++) {
+        const CeedInt e = elems[i];
+        memcpy(&goffsets[j], &offsets[start[e]],
+               (start[e+1] - start[e]) * sizeof(offsets[0]));
+        j += start[e+1] - start[e];
+      }
+      ierr = CeedElemRestrictionCreateBatch(op->ceed, numorders, gnelem,
+                                            gelemsize, ncomp, compstride,
+                                            lsize, CEED_MEM_HOST,
+                                            CEED_OWN_POINTER, goffsets, rstrs);
+      CeedChk(ierr);
+    } else {
+      // Elements stored one after the other, with their component stride
+      for (CeedInt g=0; g<numorders; g++) {
+        CeedInt *eoffsets, *stencil;
+        ierr = CeedMalloc(gnelem[g], &eoffsets); CeedChk(ierr);
+        ierr = CeedMalloc(gelemsize[g], &stencil); CeedChk(ierr);
+        for (CeedInt i=0; i<gnelem[g]; i++)
+          eoffsets[i] = start[elems[op->orderfirst[g]+i]];
+        for (CeedInt n=0; n<gelemsize[g]; n++)
+          stencil[n] = n;
+        ierr = CeedElemRestrictionCreateCompressed(op->ceed, gnelem[g],
+               gelemsize[g], ncomp, gelemsize[g], lsize, eoffsets, stencil,
+               &rstrs[g]); CeedChk(ierr);
+        ierr = CeedFree(&eoffsets); CeedChk(ierr);
+        ierr = CeedFree(&stencil); CeedChk(ierr);
+      }
+    }
+    ierr = CeedFree(&start); CeedChk(ierr);
+  }
+
+  for (CeedInt g=0; g<numorders; g++) {
+    CeedBasis basis = bases ? bases[op->orders[g]] : CEED_BASIS_COLLOCATED;
+    ierr = CeedOperatorSetField(op->suboperators[g], fieldname, rstrs[g],
+                                basis, v); CeedChk(ierr);
+    if (rstrs[g] != CEED_ELEMRESTRICTION_NONE) {
+      ierr = CeedElemRestrictionDestroy(&rstrs[g]); CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
+/**
+  @brief Create a Chebyshev smoother for a CeedOperator
+
+  The smoother is a CeedOperator applying @a degree sweeps of Chebyshev
+    iteration, preconditioned with the inverse diagonal, from a zero initial
+    guess. Applying the smoother to a residual b - A x with
+    CeedOperatorApplyAdd() adds the smoothed correction to x. The bounds
+    should enclose the part of the spectrum of D^-1 A to be damped, such as
+    [0.1 lmax, 1.1 lmax] for an estimate lmax of its largest eigenvalue.
+
+  @param op             CeedOperator to smooth, with its active input and
+                          output on the same L-vector space
+  @param diag           Assembled diagonal of @a op, such as from
+                          CeedOperatorLinearAssembleDiagonal(); it is copied
+  @param lmin           Lower bound of the smoothed eigenvalues of D^-1 A
+  @param lmax           Upper bound of the eigenvalues of D^-1 A
+  @param degree         Number of smoothing sweeps; the smoother applies
+                          @a op @a degree - 1 times
+  @param[out] smoother  Address of the variable where the newly created
+                          CeedOperator will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+ */
+int CeedOperatorCreateChebyshevSmoother(CeedOperator op, CeedVector diag,
+                                        CeedScalar lmin, CeedScalar lmax,
+                                        CeedInt degree,
+                                        CeedOperator *smoother) {
+  int ierr;
+  Ceed ceed = op->ceed;
+
+  if (degree < 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Chebyshev smoother needs at least one sweep");
+  // LCOV_EXCL_STOP
+  if (!(lmin > 0 && lmax > lmin))
     // LCOV_EXCL_START
-    return CeedError(op->ceed, 1, "Not a composite operator");
+    return CeedError(ceed, 1, "Chebyshev smoother needs bounds 0 < lmin < "
+                     "lmax, not [%g, %g]", lmin, lmax);
   // LCOV_EXCL_STOP
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
 
-  *numsub = op->numsub;
+  ierr = CeedCalloc(1, smoother); CeedChk(ierr);
+  (*smoother)->ceed = ceed;
+  CeedReference(ceed);
+  (*smoother)->refcount = 1;
+  (*smoother)->smoothop = op;
+  CeedReference(op);
+  (*smoother)->smoothlmin = lmin;
+  (*smoother)->smoothlmax = lmax;
+  (*smoother)->smoothdegree = degree;
+
+  // Inverse diagonal and work vectors
+  CeedInt length = diag->length;
+  ierr = CeedVectorCreate(ceed, length, &(*smoother)->smoothdinv);
+  CeedChk(ierr);
+  ierr = CeedVectorSetValue((*smoother)->smoothdinv, 0.0); CeedChk(ierr);
+  ierr = CeedVectorAXPY((*smoother)->smoothdinv, 1.0, diag); CeedChk(ierr);
+  ierr = CeedVectorReciprocal((*smoother)->smoothdinv); CeedChk(ierr);
+  ierr = CeedVectorCreate(ceed, length, &(*smoother)->smoothr); CeedChk(ierr);
+  ierr = CeedVectorCreate(ceed, length, &(*smoother)->smoothd); CeedChk(ierr);
+  ierr = CeedVectorSetValue((*smoother)->smoothd, 0.0); CeedChk(ierr);
+  ierr = CeedVectorCreate(ceed, length, &(*smoother)->smoothw); CeedChk(ierr);
+  ierr = CeedVectorSetMemoryClass((*smoother)->smoothdinv,
+                                  CEED_MEMORY_ASSEMBLED); CeedChk(ierr);
+  ierr = CeedVectorSetMemoryClass((*smoother)->smoothr, CEED_MEMORY_EVECTOR);
+  CeedChk(ierr);
+  ierr = CeedVectorSetMemoryClass((*smoother)->smoothd, CEED_MEMORY_EVECTOR);
+  CeedChk(ierr);
+  ierr = CeedVectorSetMemoryClass((*smoother)->smoothw, CEED_MEMORY_EVECTOR);
+  CeedChk(ierr);
   return 0;
 }
 
 /**
-  @brief Get the list of suboperators associated with a CeedOperator
+  @brief Create a point block Jacobi CeedOperator for a CeedOperator
 
-  @param op                CeedOperator
-  @param[out] suboperators Variable to store list of suboperators
+  The point block diagonal of @a op is assembled with
+    CeedOperatorLinearAssemblePointBlockDiagonal() and its @a ncomp * @a ncomp
+    blocks are inverted in place with CeedVectorPointBlockInvert(), so the
+    data stays in the memory of the backend. The new CeedOperator applies the
+    inverse blocks node by node, so it can be used as a smoother or coarse
+    solver with other CeedOperators. The blocks are not updated if @a op
+    changes; create a new point block Jacobi operator instead.
+
+  @param op              CeedOperator with a single active field, with its
+                           active input and output on the same L-vector space
+  @param[out] pbjacobi   Address of the variable where the newly created
+                           CeedOperator will be stored
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref User
 **/
+int CeedOperatorCreatePointBlockJacobi(CeedOperator op,
+                                       CeedOperator *pbjacobi) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
 
-int CeedOperatorGetSubList(CeedOperator op, CeedOperator **suboperators) {
-  if (!op->composite)
+  // Active restriction
+  CeedOperator opfields = op->composite ? op->suboperators[0] : op;
+  CeedElemRestriction rstr = NULL;
+  if (opfields->qf)
+    for (CeedInt i=0; i<opfields->qf->numinputfields; i++)
+      if (opfields->inputfields[i]->vec == CEED_VECTOR_ACTIVE) {
+        rstr = opfields->inputfields[i]->Erestrict;
+        break;
+      }
+  if (!rstr)
     // LCOV_EXCL_START
-    return CeedError(op->ceed, 1, "Not a composite operator");
+    return CeedError(ceed, 1, "No active restriction found for point block "
+                     "Jacobi");
   // LCOV_EXCL_STOP
+  CeedInt ncomp, compstride, lsize;
+  ierr = CeedElemRestrictionGetNumComponents(rstr, &ncomp); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetCompStride(rstr, &compstride); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetLVectorSize(rstr, &lsize); CeedChk(ierr);
+  CeedInt nnodes = compstride == 1 ? lsize / ncomp : compstride;
+
+  // Assemble and invert point block diagonal
+  CeedVector pbinv;
+  ierr = CeedVectorCreate(ceed, nnodes*ncomp*ncomp, &pbinv); CeedChk(ierr);
+  ierr = CeedVectorSetMemoryClass(pbinv, CEED_MEMORY_ASSEMBLED); CeedChk(ierr);
+  ierr = CeedOperatorLinearAssemblePointBlockDiagonal(op, pbinv,
+         CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+  ierr = CeedVectorPointBlockInvert(pbinv, ncomp); CeedChk(ierr);
+
+  // Restrictions, with one node per element
+  CeedInt *offsets;
+  ierr = CeedMalloc(nnodes, &offsets); CeedChk(ierr);
+  for (CeedInt i=0; i<nnodes; i++)
+    offsets[i] = compstride == 1 ? i*ncomp : i;
+  CeedElemRestriction rstrnode, rstrblock;
+  ierr = CeedElemRestrictionCreate(ceed, nnodes, 1, ncomp, compstride, lsize,
+                                   CEED_MEM_HOST, CEED_OWN_POINTER, offsets,
+                                   &rstrnode); CeedChk(ierr);
+  CeedInt strides[3] = {1, 1, ncomp*ncomp};
+  ierr = CeedElemRestrictionCreateStrided(ceed, nnodes, 1, ncomp*ncomp,
+                                          nnodes*ncomp*ncomp, strides,
+                                          &rstrblock); CeedChk(ierr);
+
+  // Single node basis
+  const CeedScalar interp1d[1] = {1.0}, grad1d[1] = {0.0},
+                   qref1d[1] = {0.0}, qweight1d[1] = {2.0};
+  CeedBasis basis;
+  ierr = CeedBasisCreateTensorH1(ceed, 1, ncomp, 1, 1, interp1d, grad1d,
+                                 qref1d, qweight1d, &basis); CeedChk(ierr);
+
+  // QFunction
+  CeedQFunction qf;
+  ierr = CeedQFunctionCreateInteriorByName(ceed, "PointBlockScale", &qf);
+  CeedChk(ierr);
+  CeedInt *ncompdata;
+  ierr = CeedCalloc(1, &ncompdata); CeedChk(ierr);
+  ncompdata[0] = ncomp;
+  CeedQFunctionContext ctx;
+  ierr = CeedQFunctionContextCreate(ceed, &ctx); CeedChk(ierr);
+  ierr = CeedQFunctionContextSetData(ctx, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                     sizeof(*ncompdata), ncompdata);
+  CeedChk(ierr);
+  ierr = CeedQFunctionSetContext(qf, ctx); CeedChk(ierr);
+  ierr = CeedQFunctionContextDestroy(&ctx); CeedChk(ierr);
+  ierr = CeedQFunctionAddInput(qf, "input", ncomp, CEED_EVAL_INTERP);
+  CeedChk(ierr);
+  ierr = CeedQFunctionAddInput(qf, "block", ncomp*ncomp, CEED_EVAL_NONE);
+  CeedChk(ierr);
+  ierr = CeedQFunctionAddOutput(qf, "output", ncomp, CEED_EVAL_INTERP);
+  CeedChk(ierr);
 
-  *suboperators = op->suboperators;
+  // Operator
+  ierr = CeedOperatorCreate(ceed, qf, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                            pbjacobi); CeedChk(ierr);
+  ierr = CeedOperatorSetField(*pbjacobi, "input", rstrnode, basis,
+                              CEED_VECTOR_ACTIVE); CeedChk(ierr);
+  ierr = CeedOperatorSetField(*pbjacobi, "block", rstrblock,
+                              CEED_BASIS_COLLOCATED, pbinv); CeedChk(ierr);
+  ierr = CeedOperatorSetField(*pbjacobi, "output", rstrnode, basis,
+                              CEED_VECTOR_ACTIVE); CeedChk(ierr);
+
+  // Cleanup
+  ierr = CeedVectorDestroy(&pbinv); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstrnode); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstrblock); CeedChk(ierr);
+  ierr = CeedBasisDestroy(&basis); CeedChk(ierr);
+  ierr = CeedQFunctionDestroy(&qf); CeedChk(ierr);
   return 0;
 }
 
 /**
-  @brief Get the backend data of a CeedOperator
+  @brief Estimate the extreme eigenvalues of a Jacobi preconditioned
+           CeedOperator
 
-  @param op              CeedOperator
-  @param[out] data       Variable to store data
+  The eigenvalues of D^-1 A, for the diagonal D of a symmetric positive
+    definite CeedOperator A, are estimated with @a niter steps of Lanczos
+    iteration, carried out as preconditioned conjugate gradients so only
+    CeedOperator applications and CeedVector operations are used and the
+    vectors stay in the memory of the backend. The extreme eigenvalues of the
+    Lanczos tridiagonal matrix are returned; they lie inside the spectrum and
+    converge first, so @a lmax is typically within a few percent after 10
+    iterations. The estimates can be used to set the bounds of
+    CeedOperatorCreateChebyshevSmoother().
+
+  @param op         Symmetric positive definite CeedOperator, with its active
+                      input and output on the same L-vector space
+  @param diag       Assembled diagonal of @a op, such as from
+                      CeedOperatorLinearAssembleDiagonal()
+  @param niter      Maximum number of Lanczos iterations
+  @param[out] lmin  Variable to store the smallest eigenvalue estimate
+  @param[out] lmax  Variable to store the largest eigenvalue estimate
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref User
 **/
+int CeedOperatorEstimateEigenvalues(CeedOperator op, CeedVector diag,
+                                    CeedInt niter, CeedScalar *lmin,
+                                    CeedScalar *lmax) {
+  int ierr;
+  Ceed ceed = op->ceed;
 
-int CeedOperatorGetData(CeedOperator op, void *data) {
-  *(void **)data = op->data;
-  return 0;
-}
-
-/**
-  @brief Set the backend data of a CeedOperator
-
-  @param[out] op         CeedOperator
-  @param data            Data to set
+  if (niter < 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Eigenvalue estimate needs at least one "
+                     "iteration");
+  // LCOV_EXCL_STOP
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
 
-  @return An error code: 0 - success, otherwise - failure
+  // Work vectors
+  CeedInt length = diag->length;
+  CeedVector dinv, r, z, p, w;
+  ierr = CeedVectorCreate(ceed, length, &dinv); CeedChk(ierr);
+  ierr = CeedVectorSetValue(dinv, 0.0); CeedChk(ierr);
+  ierr = CeedVectorAXPY(dinv, 1.0, diag); CeedChk(ierr);
+  ierr = CeedVectorReciprocal(dinv); CeedChk(ierr);
+  ierr = CeedVectorCreate(ceed, length, &r); CeedChk(ierr);
+  ierr = CeedVectorCreate(ceed, length, &z); CeedChk(ierr);
+  ierr = CeedVectorCreate(ceed, length, &p); CeedChk(ierr);
+  ierr = CeedVectorCreate(ceed, length, &w); CeedChk(ierr);
+
+  // Deterministic pseudo-random starting vector
+  CeedScalar *rarray;
+  ierr = CeedVectorGetArray(r, CEED_MEM_HOST, &rarray); CeedChk(ierr);
+  unsigned int seed = 1;
+  for (CeedInt i=0; i<length; i++) {
+    seed = 1103515245u*seed + 12345u;
+    rarray[i] = 0.5 + (CeedScalar)(seed >> 16) / 65536.;
+  }
+  ierr = CeedVectorRestoreArray(r, &rarray); CeedChk(ierr);
+
+  // Preconditioned conjugate gradients, recording the Lanczos coefficients
+  CeedScalar alpha[niter], beta[niter], rz, rz0, rznew, pw;
+  CeedInt n = 0;
+  ierr = CeedVectorPointwiseMult(z, dinv, r); CeedChk(ierr);
+  ierr = CeedVectorSetValue(p, 0.0); CeedChk(ierr);
+  ierr = CeedVectorAXPY(p, 1.0, z); CeedChk(ierr);
+  ierr = CeedVectorDot(r, z, &rz); CeedChk(ierr);
+  rz0 = rz;
+  while (n < niter && rz > 0) {
+    ierr = CeedOperatorApply(op, p, w, CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+    ierr = CeedVectorDot(p, w, &pw); CeedChk(ierr);
+    if (!(pw > 0))
+      break;
+    alpha[n] = rz / pw;
+    ierr = CeedVectorAXPY(r, -alpha[n], w); CeedChk(ierr);
+    ierr = CeedVectorPointwiseMult(z, dinv, r); CeedChk(ierr);
+    ierr = CeedVectorDot(r, z, &rznew); CeedChk(ierr);
+    beta[n] = rznew / rz;
+    rz = rznew;
+    n++;
+    if (rz <= CEED_EPSILON*CEED_EPSILON*rz0)
+      break;
+    ierr = CeedVectorAXPBY(p, 1.0, beta[n-1], z); CeedChk(ierr);
+  }
+  if (n == 0)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Eigenvalue estimate requires a positive "
+                     "definite CeedOperator");
+  // LCOV_EXCL_STOP
 
-  @ref Backend
-**/
+  // Eigenvalues of the Lanczos tridiagonal matrix
+  if (n == 1) {
+    *lmin = *lmax = 1. / alpha[0];
+  } else {
+    CeedScalar T[n*n], lambda[n];
+    for (CeedInt i=0; i<n*n; i++)
+      T[i] = 0.;
+    for (CeedInt i=0; i<n; i++) {
+      T[i*n+i] = 1. / alpha[i] + (i > 0 ? beta[i-1] / alpha[i-1] : 0.);
+      if (i < n-1)
+        T[i*n+i+1] = T[(i+1)*n+i] = sqrt(beta[i]) / alpha[i];
+    }
+    ierr = CeedSymmetricSchurDecomposition(ceed, T, lambda, n); CeedChk(ierr);
+    *lmin = *lmax = lambda[0];
+    for (CeedInt i=1; i<n; i++) {
+      *lmin = (lambda[i] < *lmin ? lambda[i] : *lmin);
+      *lmax = lambda[i] > *lmax ? lambda[i] : *lmax;
+    }
+  }
 
-int CeedOperatorSetData(CeedOperator op, void *data) {
-  op->data = data;
+  // Cleanup
+  ierr = CeedVectorDestroy(&dinv); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&r); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&z); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&p); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&w); CeedChk(ierr);
   return 0;
 }
 
 /**
-  @brief Set the setup flag of a CeedOperator to True
-
-  @param op              CeedOperator
-
-  @return An error code: 0 - success, otherwise - failure
+  @brief Set the order in which a CeedOperator processes its elements
 
-  @ref Backend
-**/
-
-int CeedOperatorSetSetupDone(CeedOperator op) {
-  op->setupdone = 1;
-  return 0;
-}
+  The elements of all CeedElemRestrictions of the operator are permuted
+    consistently, so the result of applying the operator is unchanged while
+    neighboring elements are processed together, improving cache reuse for
+    poorly ordered meshes. The ordering is computed from the first
+    CeedElemRestriction with offsets, preferring an active input field.
+    Strided restrictions, such as for quadrature data, are replaced by
+    compressed restrictions with the same L-vector layout. E-vector data
+    produced by the operator, such as an assembled CeedQFunction, is stored in
+    the new element order.
 
-/**
-  @brief Get the CeedOperatorFields of a CeedOperator
+  This must be called after all fields are set and before the operator is
+    applied or assembled. For a composite operator, each sub-operator is
+    reordered independently.
 
-  @param op                 CeedOperator
-  @param[out] inputfields   Variable to store inputfields
-  @param[out] outputfields  Variable to store outputfields
+  @param op        CeedOperator to reorder
+  @param ordering  Element ordering, see CeedElemOrdering
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref User
 **/
+int CeedOperatorSetElementOrdering(CeedOperator op,
+                                   CeedElemOrdering ordering) {
+  int ierr;
 
-int CeedOperatorGetFields(CeedOperator op, CeedOperatorField **inputfields,
-                          CeedOperatorField **outputfields) {
-  if (op->composite)
+  if (op->composite) {
+    for (CeedInt i = 0; i < op->numsub; i++) {
+      ierr = CeedOperatorSetElementOrdering(op->suboperators[i], ordering);
+      CeedChk(ierr);
+    }
+    return 0;
+  }
+  if (op->setupdone)
     // LCOV_EXCL_START
-    return CeedError(op->ceed, 1, "Not defined for composite operator");
+    return CeedError(op->ceed, 1, "Cannot set element ordering after the "
+                     "operator is set up");
   // LCOV_EXCL_STOP
+  ierr = CeedOperatorCheckReady(op->ceed, op); CeedChk(ierr);
+  if (ordering == CEED_ORDERING_NATURAL || op->numelements == 0)
+    return 0;
 
-  if (inputfields) *inputfields = op->inputfields;
-  if (outputfields) *outputfields = op->outputfields;
-  return 0;
-}
-
-/**
-  @brief Get the CeedElemRestriction of a CeedOperatorField
-
-  @param opfield         CeedOperatorField
-  @param[out] rstr       Variable to store CeedElemRestriction
+  // Find the restriction defining the ordering
+  const CeedInt numin = op->qf->numinputfields,
+                numout = op->qf->numoutputfields;
+  CeedElemRestriction rstr = NULL;
+  for (CeedInt i = 0; i < numin + numout && !rstr; i++) {
+    CeedOperatorField field = i < numin ? op->inputfields[i] :
+                              op->outputfields[i - numin];
+    if (field->vec == CEED_VECTOR_ACTIVE && !field->Erestrict->strides)
+      rstr = field->Erestrict;
+  }
+  for (CeedInt i = 0; i < numin + numout && !rstr; i++) {
+    CeedOperatorField field = i < numin ? op->inputfields[i] :
+                              op->outputfields[i - numin];
+    if (field->Erestrict != CEED_ELEMRESTRICTION_NONE &&
+        !field->Erestrict->strides)
+      rstr = field->Erestrict;
+  }
+  // No offsets, elements are already in L-vector order
+  if (!rstr)
+    return 0;
 
-  @return An error code: 0 - success, otherwise - failure
+  CeedInt *perm;
+  ierr = CeedMalloc(op->numelements, &perm); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementOrdering(rstr, ordering, perm);
+  CeedChk(ierr);
 
-  @ref Backend
-**/
+  // Permute every restriction once, fields sharing a restriction keep sharing
+  CeedElemRestriction *oldrstr, *newrstr;
+  CeedInt numrstr = 0;
+  ierr = CeedCalloc(numin + numout, &oldrstr); CeedChk(ierr);
+  ierr = CeedCalloc(numin + numout, &newrstr); CeedChk(ierr);
+  for (CeedInt i = 0; i < numin + numout; i++) {
+    CeedOperatorField field = i < numin ? op->inputfields[i] :
+                              op->outputfields[i - numin];
+    CeedElemRestriction r = field->Erestrict;
+    if (r == CEED_ELEMRESTRICTION_NONE)
+      continue;
+    CeedInt j = 0;
+    while (j < numrstr && oldrstr[j] != r)
+      j++;
+    if (j == numrstr) {
+      oldrstr[j] = r;
+      ierr = CeedElemRestrictionCreatePermuted(r, perm, &newrstr[j]);
+      CeedChk(ierr);
+      numrstr++;
+    } else {
+      CeedReference(newrstr[j]);
+    }
+    field->Erestrict = newrstr[j];
+    ierr = CeedElemRestrictionDestroy(&r); CeedChk(ierr);
+  }
 
-int CeedOperatorFieldGetElemRestriction(CeedOperatorField opfield,
-                                        CeedElemRestriction *rstr) {
-  *rstr = opfield->Erestrict;
+  ierr = CeedFree(&oldrstr); CeedChk(ierr);
+  ierr = CeedFree(&newrstr); CeedChk(ierr);
+  ierr = CeedFree(&perm); CeedChk(ierr);
   return 0;
 }
 
 /**
-  @brief Get the CeedBasis of a CeedOperatorField
+  @brief Choose whether a CeedOperator is applied with dense element matrices
 
-  @param opfield         CeedOperatorField
-  @param[out] basis      Variable to store CeedBasis
+  For low order elements, applying a stored dense matrix per element can be
+    cheaper than the basis actions and CeedQFunction of the matrix-free
+    operator. The element matrices are assembled with
+    CeedOperatorLinearAssemble() on first application and reassembled when the
+    passive inputs or CeedQFunctionContext change state, so the CeedQFunction
+    must be linear in the active inputs. With @ref CEED_ELEMMATRIX_AUTO the
+    choice is made from the element size, number of components, and number of
+    quadrature points on host backends. For a composite operator, the mode is
+    set for each sub-operator.
+
+  @param op    CeedOperator
+  @param mode  Element matrix mode, see CeedElemMatrixMode
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref User
 **/
+int CeedOperatorSetElementMatrixMode(CeedOperator op,
+                                     CeedElemMatrixMode mode) {
+  int ierr;
 
-int CeedOperatorFieldGetBasis(CeedOperatorField opfield, CeedBasis *basis) {
-  *basis = opfield->basis;
+  if (op->composite) {
+    for (CeedInt i = 0; i < op->numsub; i++) {
+      ierr = CeedOperatorSetElementMatrixMode(op->suboperators[i], mode);
+      CeedChk(ierr);
+    }
+    return 0;
+  }
+  op->ematmode = mode;
+  op->ematchecked = false;
   return 0;
 }
 
 /**
-  @brief Get the CeedVector of a CeedOperatorField
+  @brief Choose the scaling of the element inverses built by
+           CeedOperatorCreateFDMElementInverse()
 
-  @param opfield         CeedOperatorField
-  @param[out] vec        Variable to store CeedVector
+  The fast diagonalization method diagonalizes the 1D mass and Laplacian of the
+    reference element once. With @ref CEED_FDM_AVERAGED, each element inverse
+    is scaled by a single average of the assembled CeedQFunction. With
+    @ref CEED_FDM_DIRECTIONAL, the mass and the Laplacian in each direction are
+    scaled by their own element averages, which keeps the smoother effective
+    on stretched and anisotropic elements and is exact for axis-aligned
+    elements with constant coefficients. For a composite operator, the mode is
+    set for each sub-operator.
+
+  @param op    CeedOperator
+  @param mode  FDM mode, see CeedFDMMode
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref User
 **/
+int CeedOperatorSetFDMMode(CeedOperator op, CeedFDMMode mode) {
+  int ierr;
 
-int CeedOperatorFieldGetVector(CeedOperatorField opfield, CeedVector *vec) {
-  *vec = opfield->vec;
+  if (op->composite) {
+    for (CeedInt i = 0; i < op->numsub; i++) {
+      ierr = CeedOperatorSetFDMMode(op->suboperators[i], mode); CeedChk(ierr);
+    }
+    return 0;
+  }
+  op->fdmmode = mode;
+  if (op->opfallback)
+    op->opfallback->fdmmode = mode;
   return 0;
 }
 
-/// @}
-
-/// ----------------------------------------------------------------------------
-/// CeedOperator Public API
-/// ----------------------------------------------------------------------------
-/// @addtogroup CeedOperatorUser
-/// @{
-
 /**
-  @brief Create a CeedOperator and associate a CeedQFunction. A CeedBasis and
-           CeedElemRestriction can be associated with CeedQFunction fields with
-           \ref CeedOperatorSetField.
-
-  @param ceed    A Ceed object where the CeedOperator will be created
-  @param qf      QFunction defining the action of the operator at quadrature points
-  @param dqf     QFunction defining the action of the Jacobian of @a qf (or
-                   @ref CEED_QFUNCTION_NONE)
-  @param dqfT    QFunction defining the action of the transpose of the Jacobian
-                   of @a qf (or @ref CEED_QFUNCTION_NONE)
-  @param[out] op Address of the variable where the newly created
-                     CeedOperator will be stored
+  @brief Create a CeedOperator acting on a subset of the elements of another
+
+  The new operator uses the CeedQFunctions, CeedBases, and passive vectors of
+    @a op, so quadrature data is shared rather than copied, while its
+    CeedElemRestrictions hold only the selected elements of those of @a op.
+    Applying the operators for a partition of the elements with
+    @ref CeedOperatorApplyAdd is equivalent to applying @a op, which allows,
+    for example, elements that do not need ghost values to be applied while
+    ghost values are communicated. Passive fields computed on demand keep
+    their builder, which computes the whole shared vector.
+
+  The element numbers refer to the current element order of @a op, see
+    @ref CeedOperatorSetElementOrdering. Later changes to the fields of @a op
+    do not affect the new operator.
+
+  @param op          CeedOperator to take elements from, must not be composite
+  @param nelem       Number of elements of the new operator
+  @param elems       Array of size @a nelem of element numbers of @a op
+  @param[out] subop  Address of the variable where the newly created
+                       CeedOperator will be stored
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
- */
-int CeedOperatorCreate(Ceed ceed, CeedQFunction qf, CeedQFunction dqf,
-                       CeedQFunction dqfT, CeedOperator *op) {
+**/
+int CeedOperatorCreateSubset(CeedOperator op, CeedInt nelem,
+                             const CeedInt *elems, CeedOperator *subop) {
   int ierr;
 
-  if (!ceed->OperatorCreate) {
-    Ceed delegate;
-    ierr = CeedGetObjectDelegate(ceed, &delegate, "Operator"); CeedChk(ierr);
-
-    if (!delegate)
-      // LCOV_EXCL_START
-      return CeedError(ceed, 1, "Backend does not support OperatorCreate");
-    // LCOV_EXCL_STOP
-
-    ierr = CeedOperatorCreate(delegate, qf, dqf, dqfT, op); CeedChk(ierr);
-    return 0;
-  }
-
-  if (!qf || qf == CEED_QFUNCTION_NONE)
+  if (op->composite)
     // LCOV_EXCL_START
-    return CeedError(ceed, 1, "Operator must have a valid QFunction.");
+    return CeedError(op->ceed, 1, "Cannot take elements of a composite "
+                     "operator");
   // LCOV_EXCL_STOP
-  ierr = CeedCalloc(1, op); CeedChk(ierr);
-  (*op)->ceed = ceed;
-  ceed->refcount++;
-  (*op)->refcount = 1;
-  (*op)->qf = qf;
-  qf->refcount++;
-  if (dqf && dqf != CEED_QFUNCTION_NONE) {
-    (*op)->dqf = dqf;
-    dqf->refcount++;
+  ierr = CeedOperatorCheckReady(op->ceed, op); CeedChk(ierr);
+
+  ierr = CeedOperatorCreate(op->ceed, op->qf, op->dqf, op->dqfT, subop);
+  CeedChk(ierr);
+
+  // Restrict every restriction once, fields sharing a restriction keep sharing
+  const CeedInt numin = op->qf->numinputfields,
+                numout = op->qf->numoutputfields;
+  CeedElemRestriction *oldrstr, *newrstr;
+  CeedInt numrstr = 0;
+  ierr = CeedCalloc(numin + numout, &oldrstr); CeedChk(ierr);
+  ierr = CeedCalloc(numin + numout, &newrstr); CeedChk(ierr);
+  for (CeedInt i = 0; i < numin + numout; i++) {
+    CeedOperatorField field = i < numin ? op->inputfields[i] :
+                              op->outputfields[i - numin];
+    CeedElemRestriction r = field->Erestrict;
+    if (r != CEED_ELEMRESTRICTION_NONE) {
+      CeedInt j = 0;
+      while (j < numrstr && oldrstr[j] != r)
+        j++;
+      if (j == numrstr) {
+        oldrstr[j] = r;
+        ierr = CeedElemRestrictionCreateSubset(r, nelem, elems, &newrstr[j]);
+        CeedChk(ierr);
+        numrstr++;
+      }
+      r = newrstr[j];
+    }
+    ierr = CeedOperatorSetField(*subop, field->fieldname, r, field->basis,
+                                field->vec); CeedChk(ierr);
+    if (i < numin) {
+      CeedOperatorField subfield = (*subop)->inputfields[i];
+      subfield->storage = field->storage;
+      if (field->buildop) {
+        ierr = CeedOperatorSetFieldBuilder(*subop, field->fieldname,
+                                           field->buildop, field->buildinput);
+        CeedChk(ierr);
+      }
+    }
   }
-  if (dqfT && dqfT != CEED_QFUNCTION_NONE) {
-    (*op)->dqfT = dqfT;
-    dqfT->refcount++;
+  // The fields hold the references to the new restrictions
+  for (CeedInt j = 0; j < numrstr; j++) {
+    ierr = CeedElemRestrictionDestroy(&newrstr[j]); CeedChk(ierr);
   }
-  ierr = CeedCalloc(16, &(*op)->inputfields); CeedChk(ierr);
-  ierr = CeedCalloc(16, &(*op)->outputfields); CeedChk(ierr);
-  ierr = ceed->OperatorCreate(*op); CeedChk(ierr);
+  ierr = CeedFree(&oldrstr); CeedChk(ierr);
+  ierr = CeedFree(&newrstr); CeedChk(ierr);
   return 0;
 }
 
 /**
-  @brief Create an operator that composes the action of several operators
+  @brief Create a CeedOperator acting on a range of the elements of another
 
-  @param ceed    A Ceed object where the CeedOperator will be created
-  @param[out] op Address of the variable where the newly created
-                     Composite CeedOperator will be stored
+  See @ref CeedOperatorCreateSubset.
+
+  @param op          CeedOperator to take elements from, must not be composite
+  @param first       First element of the range
+  @param last        One past the last element of the range
+  @param[out] subop  Address of the variable where the newly created
+                       CeedOperator will be stored
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
- */
-int CeedCompositeOperatorCreate(Ceed ceed, CeedOperator *op) {
+**/
+int CeedOperatorCreateSubsetRange(CeedOperator op, CeedInt first, CeedInt last,
+                                  CeedOperator *subop) {
   int ierr;
+  const CeedInt nelem = last > first ? last - first : 0;
+  CeedInt *elems;
+
+  ierr = CeedMalloc(nelem, &elems); CeedChk(ierr);
+  for (CeedInt e = 0; e < nelem; e++)
+    elems[e] = first + e;
+  ierr = CeedOperatorCreateSubset(op, nelem, elems, subop); CeedChk(ierr);
+  ierr = CeedFree(&elems); CeedChk(ierr);
+  return 0;
+}
 
-  if (!ceed->CompositeOperatorCreate) {
-    Ceed delegate;
-    ierr = CeedGetObjectDelegate(ceed, &delegate, "Operator"); CeedChk(ierr);
+/**
+  @brief Create a copy of a CeedOperator storing its quadrature data in
+           reduced precision
 
-    if (delegate) {
-      ierr = CeedCompositeOperatorCreate(delegate, op); CeedChk(ierr);
-      return 0;
-    }
-  }
+  The copy shares the CeedQFunction, element restrictions, bases, and passive
+    vectors of @a op, and every passive input using @ref CEED_EVAL_NONE, such
+    as quadrature data, is stored in @a storage precision, see
+    @ref CeedOperatorSetFieldStorage. This gives a cheaper operator for
+    smoothing or coarse solves in a mixed precision preconditioner, while
+    @a op keeps computing the residual. Suboperators of composite operators
+    are copied in turn.
 
-  ierr = CeedCalloc(1, op); CeedChk(ierr);
-  (*op)->ceed = ceed;
-  ceed->refcount++;
-  (*op)->composite = true;
-  ierr = CeedCalloc(16, &(*op)->suboperators); CeedChk(ierr);
+  Vectors, bases, and CeedQFunctions remain in CeedScalar precision, so the
+    copy differs from @a op only by the rounding of its passive inputs.
 
-  if (ceed->CompositeOperatorCreate) {
-    ierr = ceed->CompositeOperatorCreate(*op); CeedChk(ierr);
-  }
-  return 0;
-}
+  @param op               CeedOperator to copy
+  @param storage          CeedStorageType for the passive inputs of the copy
+  @param[out] opreduced   Address of the variable where the newly created
+                            CeedOperator will be stored
 
-/**
-  @brief Provide a field to a CeedOperator for use by its CeedQFunction
+  @return An error code: 0 - success, otherwise - failure
 
-  This function is used to specify both active and passive fields to a
-  CeedOperator.  For passive fields, a vector @arg v must be provided.  Passive
-  fields can inputs or outputs (updated in-place when operator is applied).
+  @ref User
+**/
+int CeedOperatorCreateReducedPrecision(CeedOperator op,
+                                       CeedStorageType storage,
+                                       CeedOperator *opreduced) {
+  int ierr;
+
+  if (op->sharded)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Cannot copy a sharded operator");
+  // LCOV_EXCL_STOP
+
+  if (op->composite) {
+    ierr = CeedCompositeOperatorCreate(op->ceed, opreduced); CeedChk(ierr);
+    for (CeedInt i = 0; i < op->numsub; i++) {
+      CeedOperator subreduced;
+      ierr = CeedOperatorCreateReducedPrecision(op->suboperators[i], storage,
+             &subreduced); CeedChk(ierr);
+      ierr = CeedCompositeOperatorAddSub(*opreduced, subreduced);
+      CeedChk(ierr);
+      ierr = CeedOperatorDestroy(&subreduced); CeedChk(ierr);
+    }
+  } else {
+    ierr = CeedOperatorCheckReady(op->ceed, op); CeedChk(ierr);
+    ierr = CeedOperatorCreate(op->ceed, op->qf, op->dqf, op->dqfT, opreduced);
+    CeedChk(ierr);
+    const CeedInt numin = op->qf->numinputfields,
+                  numout = op->qf->numoutputfields;
+    for (CeedInt i = 0; i < numin + numout; i++) {
+      CeedOperatorField field = i < numin ? op->inputfields[i] :
+                                op->outputfields[i - numin];
+      ierr = CeedOperatorSetField(*opreduced, field->fieldname,
+                                  field->Erestrict, field->basis, field->vec);
+      CeedChk(ierr);
+      if (i >= numin)
+        continue;
+      CeedOperatorField newfield = (*opreduced)->inputfields[i];
+      newfield->storage = field->storage;
+      if (field->vec != CEED_VECTOR_ACTIVE &&
+          field->vec != CEED_VECTOR_NONE &&
+          op->qf->inputfields[i]->emode == CEED_EVAL_NONE)
+        newfield->storage = storage;
+      if (field->buildop) {
+        ierr = CeedOperatorSetFieldBuilder(*opreduced, field->fieldname,
+                                           field->buildop, field->buildinput);
+        CeedChk(ierr);
+      }
+    }
+  }
 
-  Active fields must be specified using this function, but their data (in a
-  CeedVector) is passed in CeedOperatorApply().  There can be at most one active
-  input and at most one active output.
+  (*opreduced)->fdmmode = op->fdmmode;
+  if (op->nbc) {
+    ierr = CeedOperatorSetDirichlet(*opreduced, op->nbc, op->bcindices,
+                                    op->bcvalues ? op->bcvalues :
+                                    CEED_VECTOR_NONE); CeedChk(ierr);
+  }
+  return 0;
+}
 
-  @param op         CeedOperator on which to provide the field
-  @param fieldname  Name of the field (to be matched with the name used by
-                      CeedQFunction)
-  @param r          CeedElemRestriction
-  @param b          CeedBasis in which the field resides or @ref CEED_BASIS_COLLOCATED
-                      if collocated with quadrature points
-  @param v          CeedVector to be used by CeedOperator or @ref CEED_VECTOR_ACTIVE
-                      if field is active or @ref CEED_VECTOR_NONE if using
-                      @ref CEED_EVAL_WEIGHT in the QFunction
+/**
+  @brief Create a CeedOperator evaluating many independent instances of an
+           operator in one application
+
+  The instances share the CeedQFunction user function, fields, and bases, but
+    may have different meshes, passive inputs such as quadrature data, and
+    CeedQFunctionContexts. The ensemble has the elements of instances[0],
+    followed by those of instances[1], and so on, and its active input and
+    output L-vectors hold the active L-vectors of the instances one after
+    another, so a single application covers all instances and elements, for
+    example in one kernel launch on GPU backends, while blocked backends pack
+    elements of consecutive instances into blocks. Restrictions are
+    concatenated with @ref CeedElemRestrictionCreateConcatenated and passive
+    inputs are copied one after another, so later changes to the fields of the
+    instances do not affect the ensemble.
+
+  When the instances have distinct CeedQFunctionContexts, the user function is
+    called with the context of the instance of each quadrature point, and the
+    context data is copied again before the ensemble is applied or assembled
+    whenever it changed. This requires a backend preferring host memory, where
+    user functions are called directly; parameters varying across instances
+    may instead be given as a passive input on any backend.
+
+  @param numinstances  Number of instances, at least one
+  @param instances     Array of size @a numinstances of non-composite
+                         CeedOperators with active outputs
+  @param[out] ensemble Address of the variable where the newly created
+                         CeedOperator will be stored
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
-int CeedOperatorSetField(CeedOperator op, const char *fieldname,
-                         CeedElemRestriction r, CeedBasis b, CeedVector v) {
+int CeedOperatorCreateEnsemble(CeedInt numinstances, CeedOperator *instances,
+                               CeedOperator *ensemble) {
   int ierr;
-  if (op->composite)
-    // LCOV_EXCL_START
-    return CeedError(op->ceed, 1, "Cannot add field to composite operator.");
-  // LCOV_EXCL_STOP
-  if (!r)
-    // LCOV_EXCL_START
-    return CeedError(op->ceed, 1,
-                     "ElemRestriction r for field \"%s\" must be non-NULL.",
-                     fieldname);
-  // LCOV_EXCL_STOP
-  if (!b)
-    // LCOV_EXCL_START
-    return CeedError(op->ceed, 1, "Basis b for field \"%s\" must be non-NULL.",
-                     fieldname);
-  // LCOV_EXCL_STOP
-  if (!v)
-    // LCOV_EXCL_START
-    return CeedError(op->ceed, 1, "Vector v for field \"%s\" must be non-NULL.",
-                     fieldname);
-  // LCOV_EXCL_STOP
-
-  CeedInt numelements;
-  ierr = CeedElemRestrictionGetNumElements(r, &numelements); CeedChk(ierr);
-  if (r != CEED_ELEMRESTRICTION_NONE && op->hasrestriction &&
-      op->numelements != numelements)
-    // LCOV_EXCL_START
-    return CeedError(op->ceed, 1,
-                     "ElemRestriction with %d elements incompatible with prior "
-                     "%d elements", numelements, op->numelements);
-  // LCOV_EXCL_STOP
-  if (r != CEED_ELEMRESTRICTION_NONE) {
-    op->numelements = numelements;
-    op->hasrestriction = true; // Restriction set, but numelements may be 0
+  CeedOperator op = instances[0];
+  Ceed ceed = op->ceed;
+  CeedQFunction qf = op->qf;
+  const CeedInt numin = qf ? qf->numinputfields : 0,
+                numout = qf ? qf->numoutputfields : 0;
+  bool distinctctx = false, shareddqf = true;
+
+  // Instances of the same operator
+  for (CeedInt k=0; k<numinstances; k++) {
+    CeedOperator inst = instances[k];
+    CeedQFunction instqf = inst->qf;
+    if (inst->composite || inst->sharded || inst->smoothop ||
+        inst->chainops[0] || !instqf)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Ensemble instances must be non-composite "
+                       "operators");
+    // LCOV_EXCL_STOP
+    ierr = CeedOperatorCheckReady(ceed, inst); CeedChk(ierr);
+    bool same = inst->ceed == ceed && inst->numqpoints == op->numqpoints &&
+                (instqf == qf || (instqf->function &&
+                                  instqf->function == qf->function &&
+                                  instqf->numinputfields == numin &&
+                                  instqf->numoutputfields == numout));
+    for (CeedInt i=0; same && i<numin+numout; i++) {
+      CeedQFunctionField qffield = i < numin ? qf->inputfields[i] :
+                                   qf->outputfields[i - numin],
+                                   instqffield = i < numin ?
+                                       instqf->inputfields[i] :
+                                       instqf->outputfields[i - numin];
+      CeedOperatorField field = i < numin ? op->inputfields[i] :
+                                op->outputfields[i - numin],
+                                instfield = i < numin ? inst->inputfields[i] :
+                                            inst->outputfields[i - numin];
+      same = instqffield->size == qffield->size &&
+             instqffield->emode == qffield->emode &&
+             instfield->basis == field->basis &&
+             (instfield->Erestrict == CEED_ELEMRESTRICTION_NONE) ==
+             (field->Erestrict == CEED_ELEMRESTRICTION_NONE) &&
+             (instfield->vec == CEED_VECTOR_ACTIVE) ==
+             (field->vec == CEED_VECTOR_ACTIVE) &&
+             (instfield->vec == CEED_VECTOR_NONE) ==
+             (field->vec == CEED_VECTOR_NONE);
+    }
+    if (!same)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Ensemble instances must share the Ceed, "
+                       "CeedQFunction user function, fields, and bases");
+    // LCOV_EXCL_STOP
+    for (CeedInt i=0; i<numout; i++)
+      if (inst->outputfields[i]->vec != CEED_VECTOR_ACTIVE &&
+          inst->outputfields[i]->vec != CEED_VECTOR_NONE)
+        // LCOV_EXCL_START
+        return CeedError(ceed, 1, "Ensemble instances must have active "
+                         "outputs");
+    // LCOV_EXCL_STOP
+    distinctctx = distinctctx || instqf->ctx != qf->ctx;
+    shareddqf = shareddqf && inst->dqf == op->dqf && inst->dqfT == op->dqfT;
+    ierr = CeedOperatorUpdateBuiltFields(inst); CeedChk(ierr);
   }
 
-  if (b != CEED_BASIS_COLLOCATED) {
-    CeedInt numqpoints;
-    ierr = CeedBasisGetNumQuadraturePoints(b, &numqpoints); CeedChk(ierr);
-    if (op->numqpoints && op->numqpoints != numqpoints)
+  // Contexts of the instances, copied one after another
+  size_t ctxsize = 0;
+  if (distinctctx) {
+    CeedMemType mtype;
+    ierr = CeedGetPreferredMemType(ceed, &mtype); CeedChk(ierr);
+    if (mtype != CEED_MEM_HOST || !qf->function)
       // LCOV_EXCL_START
-      return CeedError(op->ceed, 1, "Basis with %d quadrature points "
-                       "incompatible with prior %d points", numqpoints,
-                       op->numqpoints);
+      return CeedError(ceed, 1, "Ensemble instances with distinct "
+                       "CeedQFunctionContexts require a backend preferring "
+                       "host memory");
     // LCOV_EXCL_STOP
-    op->numqpoints = numqpoints;
+    for (CeedInt k=0; k<numinstances; k++) {
+      CeedQFunctionContext ctx = instances[k]->qf->ctx;
+      if (!ctx || (k > 0 && ctx->ctxsize != ctxsize))
+        // LCOV_EXCL_START
+        return CeedError(ceed, 1, "Ensemble instances must have contexts of "
+                         "the same size");
+      // LCOV_EXCL_STOP
+      ctxsize = ctx->ctxsize;
+    }
   }
-  CeedQFunctionField qfield;
-  CeedOperatorField *ofield;
-  for (CeedInt i=0; i<op->qf->numinputfields; i++) {
-    if (!strcmp(fieldname, (*op->qf->inputfields[i]).fieldname)) {
-      qfield = op->qf->inputfields[i];
-      ofield = &op->inputfields[i];
-      goto found;
+
+  // QFunction calling the user function with the context of each instance
+  CeedQFunction ensembleqf = qf;
+  if (distinctctx) {
+    CeedOperatorEnsemble *data;
+    char *bytes;
+    const size_t align = 2*sizeof(double),
+                 ctxoffset = (sizeof(*data) + (numin + numout)*sizeof(CeedInt) +
+                              align - 1) / align * align;
+    ierr = CeedCalloc(ctxoffset + numinstances*ctxsize, &bytes); CeedChk(ierr);
+    data = (CeedOperatorEnsemble *)bytes;
+    data->f = qf->function;
+    data->numinstances = numinstances;
+    data->numinputs = numin;
+    data->numoutputs = numout;
+    data->ctxsize = ctxsize;
+    data->ctxoffset = ctxoffset;
+    for (CeedInt i=0; i<numin+numout; i++) {
+      data->sizes[i] = i < numin ? qf->inputfields[i]->size :
+                       qf->outputfields[i - numin]->size;
+      data->scratchsize += data->sizes[i];
+    }
+
+    ierr = CeedQFunctionCreateInterior(ceed, qf->vlength,
+                                       CeedOperatorEnsembleQFunction,
+                                       __FILE__
+                                       ":CeedOperatorEnsembleQFunction",
+                                       &ensembleqf); CeedChk(ierr);
+    ierr = CeedQFunctionSetUserFlopsEstimate(ensembleqf, qf->userflops);
+    CeedChk(ierr);
+    for (CeedInt i=0; i<numin; i++) {
+      ierr = CeedQFunctionAddInput(ensembleqf, qf->inputfields[i]->fieldname,
+                                   qf->inputfields[i]->size,
+                                   qf->inputfields[i]->emode); CeedChk(ierr);
+    }
+    ierr = CeedQFunctionAddInput(ensembleqf, "_ensemble_instance", 1,
+                                 CEED_EVAL_NONE); CeedChk(ierr);
+    for (CeedInt i=0; i<numout; i++) {
+      ierr = CeedQFunctionAddOutput(ensembleqf, qf->outputfields[i]->fieldname,
+                                    qf->outputfields[i]->size,
+                                    qf->outputfields[i]->emode); CeedChk(ierr);
     }
+    CeedQFunctionContext ctx;
+    ierr = CeedQFunctionContextCreate(ceed, &ctx); CeedChk(ierr);
+    ierr = CeedQFunctionContextSetData(ctx, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                       ctxoffset + numinstances*ctxsize, bytes);
+    CeedChk(ierr);
+    ierr = CeedQFunctionSetContext(ensembleqf, ctx); CeedChk(ierr);
+    ierr = CeedQFunctionContextDestroy(&ctx); CeedChk(ierr);
   }
-  for (CeedInt i=0; i<op->qf->numoutputfields; i++) {
-    if (!strcmp(fieldname, (*op->qf->outputfields[i]).fieldname)) {
-      qfield = op->qf->inputfields[i];
-      ofield = &op->outputfields[i];
-      goto found;
+  const bool usedqf = !distinctctx && shareddqf;
+  ierr = CeedOperatorCreate(ceed, ensembleqf,
+                            usedqf ? op->dqf : CEED_QFUNCTION_NONE,
+                            usedqf ? op->dqfT : CEED_QFUNCTION_NONE, ensemble);
+  CeedChk(ierr);
+  if (distinctctx) {
+    ierr = CeedQFunctionDestroy(&ensembleqf); CeedChk(ierr);
+  }
+
+  // Concatenate every restriction once, fields sharing restrictions in all
+  //   instances keep sharing
+  CeedElemRestriction *rstrs, catrstr[numin + numout];
+  bool created[numin + numout];
+  ierr = CeedCalloc(numinstances, &rstrs); CeedChk(ierr);
+  for (CeedInt i=0; i<numin+numout; i++) {
+    CeedOperatorField field = i < numin ? op->inputfields[i] :
+                              op->outputfields[i - numin];
+    catrstr[i] = CEED_ELEMRESTRICTION_NONE;
+    created[i] = false;
+    if (field->Erestrict != CEED_ELEMRESTRICTION_NONE) {
+      for (CeedInt k=0; k<numinstances; k++)
+        rstrs[k] = i < numin ? instances[k]->inputfields[i]->Erestrict :
+                   instances[k]->outputfields[i - numin]->Erestrict;
+      for (CeedInt j=0; j<i && catrstr[i] == CEED_ELEMRESTRICTION_NONE; j++) {
+        bool shared = created[j];
+        for (CeedInt k=0; shared && k<numinstances; k++) {
+          CeedOperator inst = instances[k];
+          shared = rstrs[k] == (j < numin ? inst->inputfields[j]->Erestrict :
+                                inst->outputfields[j - numin]->Erestrict);
+        }
+        if (shared)
+          catrstr[i] = catrstr[j];
+      }
+      if (catrstr[i] == CEED_ELEMRESTRICTION_NONE) {
+        ierr = CeedElemRestrictionCreateConcatenated(numinstances, rstrs,
+               &catrstr[i]); CeedChk(ierr);
+        created[i] = true;
+      }
+    }
+
+    // Passive inputs one after another, as their L-vectors
+    CeedVector vec = field->vec;
+    if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE) {
+      CeedInt lsize;
+      CeedScalar *array;
+      ierr = CeedElemRestrictionGetLVectorSize(catrstr[i], &lsize);
+      CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, lsize, &vec); CeedChk(ierr);
+      ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
+      for (CeedInt k=0, start=0; k<numinstances; k++) {
+        CeedOperatorField instfield = instances[k]->inputfields[i];
+        const CeedScalar *instarray;
+        ierr = CeedElemRestrictionGetLVectorSize(instfield->Erestrict, &lsize);
+        CeedChk(ierr);
+        ierr = CeedVectorGetArrayRead(instfield->vec, CEED_MEM_HOST,
+                                      &instarray); CeedChk(ierr);
+        memcpy(&array[start], instarray, lsize*sizeof(array[0]));
+        ierr = CeedVectorRestoreArrayRead(instfield->vec, &instarray);
+        CeedChk(ierr);
+        start += lsize;
+      }
+      ierr = CeedVectorRestoreArray(vec, &array); CeedChk(ierr);
+    }
+    ierr = CeedOperatorSetField(*ensemble, field->fieldname, catrstr[i],
+                                field->basis, vec); CeedChk(ierr);
+    if (vec != field->vec) {
+      ierr = CeedVectorDestroy(&vec); CeedChk(ierr);
+    }
+    if (i < numin)
+      (*ensemble)->inputfields[i]->storage = field->storage;
+  }
+  // The fields hold the references to the new restrictions
+  for (CeedInt i=0; i<numin+numout; i++)
+    if (created[i]) {
+      ierr = CeedElemRestrictionDestroy(&catrstr[i]); CeedChk(ierr);
+    }
+  ierr = CeedFree(&rstrs); CeedChk(ierr);
+
+  // Instance of each quadrature point
+  if (distinctctx) {
+    const CeedInt nelem = (*ensemble)->numelements, Q = op->numqpoints;
+    const CeedInt strides[3] = {1, Q, Q};
+    CeedElemRestriction rstr;
+    CeedVector vec;
+    CeedScalar *array;
+    ierr = CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, nelem*Q,
+                                            strides, &rstr); CeedChk(ierr);
+    ierr = CeedVectorCreate(ceed, nelem*Q, &vec); CeedChk(ierr);
+    ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
+    for (CeedInt k=0, start=0; k<numinstances; k++) {
+      const CeedInt end = start + instances[k]->numelements*Q;
+      for (CeedInt j=start; j<end; j++)
+        array[j] = k;
+      start = end;
+    }
+    ierr = CeedVectorRestoreArray(vec, &array); CeedChk(ierr);
+    ierr = CeedOperatorSetField(*ensemble, "_ensemble_instance", rstr,
+                                CEED_BASIS_COLLOCATED, vec); CeedChk(ierr);
+    ierr = CeedElemRestrictionDestroy(&rstr); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&vec); CeedChk(ierr);
+
+    // Contexts copied before the ensemble is applied or assembled
+    (*ensemble)->numensemble = numinstances;
+    ierr = CeedCalloc(numinstances, &(*ensemble)->ensemblectx); CeedChk(ierr);
+    ierr = CeedCalloc(numinstances, &(*ensemble)->ensemblestate);
+    CeedChk(ierr);
+    for (CeedInt k=0; k<numinstances; k++) {
+      (*ensemble)->ensemblectx[k] = instances[k]->qf->ctx;
+      CeedReference(instances[k]->qf->ctx);
+      (*ensemble)->ensemblestate[k] = UINT64_MAX;
     }
   }
-  // LCOV_EXCL_START
-  return CeedError(op->ceed, 1, "QFunction has no knowledge of field '%s'",
-                   fieldname);
-  // LCOV_EXCL_STOP
-found:
-  if (r == CEED_ELEMRESTRICTION_NONE && qfield->emode != CEED_EVAL_WEIGHT)
-    // LCOV_EXCL_START
-    return CeedError(op->ceed, 1, "CEED_ELEMRESTRICTION_NONE can only be used "
-                     "for a field with eval mode CEED_EVAL_WEIGHT");
-  // LCOV_EXCL_STOP
-  ierr = CeedCalloc(1, ofield); CeedChk(ierr);
-  (*ofield)->Erestrict = r;
-  r->refcount += 1;
-  (*ofield)->basis = b;
-  if (b != CEED_BASIS_COLLOCATED)
-    b->refcount += 1;
-  (*ofield)->vec = v;
-  if (v != CEED_VECTOR_ACTIVE && v != CEED_VECTOR_NONE)
-    v->refcount += 1;
-  op->nfields += 1;
 
-  size_t len = strlen(fieldname);
-  char *tmp;
-  ierr = CeedCalloc(len+1, &tmp); CeedChk(ierr);
-  memcpy(tmp, fieldname, len+1);
-  (*ofield)->fieldname = tmp;
+  (*ensemble)->fdmmode = op->fdmmode;
   return 0;
 }
 
 /**
-  @brief Add a sub-operator to a composite CeedOperator
+  @brief Create a CeedOperator applying two CeedOperators in turn
 
-  @param[out] compositeop Composite CeedOperator
-  @param      subop       Sub-operator CeedOperator
+  The active output of @a first is the active input of @a second. When both
+    use the same CeedElemRestriction for it, with a single active field on
+    each side, and no L-vector entry is shared by two element nodes, as for
+    discontinuous or element-local fields, restricting the intermediate
+    L-vector again is the identity. The chain then keeps the intermediate in
+    element layout, replacing the restriction of these two fields with a
+    strided restriction, so the gather and scatter through the offsets are
+    skipped. Otherwise the intermediate is an L-vector.
+
+  Only @ref CeedOperatorApply() and @ref CeedOperatorApplyAdd() are defined
+    for the chain; the latter adds the output of @a second.
+
+  @param first        First CeedOperator, not composite
+  @param second       Second CeedOperator, not composite
+  @param[out] chain   Address of the variable where the newly created
+                        CeedOperator will be stored
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
- */
-int CeedCompositeOperatorAddSub(CeedOperator compositeop, CeedOperator subop) {
-  if (!compositeop->composite)
+**/
+int CeedOperatorCreateChain(CeedOperator first, CeedOperator second,
+                            CeedOperator *chain) {
+  int ierr;
+  Ceed ceed = first->ceed;
+
+  if (first->composite || second->composite || !first->qf || !second->qf)
     // LCOV_EXCL_START
-    return CeedError(compositeop->ceed, 1, "CeedOperator is not a composite "
-                     "operator");
+    return CeedError(ceed, 1, "Chains are only defined for non-composite "
+                     "operators");
   // LCOV_EXCL_STOP
+  ierr = CeedOperatorCheckReady(ceed, first); CeedChk(ierr);
+  ierr = CeedOperatorCheckReady(ceed, second); CeedChk(ierr);
 
-  if (compositeop->numsub == CEED_COMPOSITE_MAX)
+  // Intermediate fields
+  CeedInt outindex, inindex;
+  ierr = CeedOperatorGetActiveFieldIndex(first, true, &outindex);
+  CeedChk(ierr);
+  ierr = CeedOperatorGetActiveFieldIndex(second, false, &inindex);
+  CeedChk(ierr);
+  CeedElemRestriction rstr = NULL;
+  for (CeedInt i=0; i<first->qf->numoutputfields && !rstr; i++)
+    if (first->outputfields[i]->vec == CEED_VECTOR_ACTIVE)
+      rstr = first->outputfields[i]->Erestrict;
+  CeedElemRestriction inrstr = NULL;
+  for (CeedInt i=0; i<second->qf->numinputfields && !inrstr; i++)
+    if (second->inputfields[i]->vec == CEED_VECTOR_ACTIVE)
+      inrstr = second->inputfields[i]->Erestrict;
+  if (!rstr || !inrstr || rstr->lsize != inrstr->lsize)
     // LCOV_EXCL_START
-    return CeedError(compositeop->ceed, 1, "Cannot add additional suboperators");
+    return CeedError(ceed, 1, "Active output of the first operator does not "
+                     "match the active input of the second operator");
   // LCOV_EXCL_STOP
 
-  compositeop->suboperators[compositeop->numsub] = subop;
-  subop->refcount++;
-  compositeop->numsub++;
+  // Element-local intermediate, if no L-vector entry has multiplicity above 1
+  bool fused = outindex >= 0 && inindex >= 0 &&
+               first->outputfields[outindex]->Erestrict ==
+               second->inputfields[inindex]->Erestrict;
+  if (fused) {
+    CeedVector mult;
+    CeedScalar maxmult;
+    ierr = CeedElemRestrictionCreateVector(rstr, &mult, NULL); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetMultiplicity(rstr, mult); CeedChk(ierr);
+    ierr = CeedVectorNorm(mult, CEED_NORM_MAX, &maxmult); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&mult); CeedChk(ierr);
+    fused = maxmult <= 1.0;
+  }
+
+  ierr = CeedCalloc(1, chain); CeedChk(ierr);
+  (*chain)->ceed = ceed;
+  CeedReference(ceed);
+  (*chain)->refcount = 1;
+  (*chain)->chainfused = fused;
+  if (fused) {
+    const CeedInt size = rstr->nelem*rstr->elemsize*rstr->ncomp;
+    CeedElemRestriction erstr;
+    ierr = CeedElemRestrictionCreateStrided(ceed, rstr->nelem, rstr->elemsize,
+                                            rstr->ncomp, size,
+                                            CEED_STRIDES_BACKEND, &erstr);
+    CeedChk(ierr);
+    ierr = CeedOperatorCreateWithRestriction(first, true, outindex, erstr,
+           &(*chain)->chainops[0]); CeedChk(ierr);
+    ierr = CeedOperatorCreateWithRestriction(second, false, inindex, erstr,
+           &(*chain)->chainops[1]); CeedChk(ierr);
+    ierr = CeedVectorCreate(ceed, size, &(*chain)->chainvec); CeedChk(ierr);
+    ierr = CeedElemRestrictionDestroy(&erstr); CeedChk(ierr);
+  } else {
+    CeedReference(first);
+    CeedReference(second);
+    (*chain)->chainops[0] = first;
+    (*chain)->chainops[1] = second;
+    ierr = CeedVectorCreate(ceed, rstr->lsize, &(*chain)->chainvec);
+    CeedChk(ierr);
+  }
   return 0;
 }
 
@@ -971,6 +4941,7 @@ int CeedOperatorLinearAssembleQFunction(CeedOperator op, CeedVector *assembled,
   int ierr;
   Ceed ceed = op->ceed;
   ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  ierr = CeedOperatorUpdateBuiltFields(op); CeedChk(ierr);
 
   // Backend version
   if (op->LinearAssembleQFunction) {
@@ -985,7 +4956,78 @@ int CeedOperatorLinearAssembleQFunction(CeedOperator op, CeedVector *assembled,
     ierr = op->opfallback->LinearAssembleQFunction(op->opfallback, assembled,
            rstr, request); CeedChk(ierr);
   }
+  ierr = CeedVectorSetMemoryClass(*assembled, CEED_MEMORY_ASSEMBLED);
+  CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Assemble a linear CeedQFunction associated with a CeedOperator, reusing
+           the storage of the previous assembly
+
+  The first call assembles as CeedOperatorLinearAssembleQFunction() and keeps
+    the CeedVector and CeedElemRestriction with the CeedOperator. Later calls
+    refill the same storage in place, and return it unchanged when no passive
+    input vector or CeedQFunctionContext has been modified since the previous
+    assembly. The caller owns a reference to both objects and must destroy them.
+
+  @param op             CeedOperator to assemble CeedQFunction
+  @param[out] assembled CeedVector to store assembled CeedQFunction at
+                          quadrature points
+  @param[out] rstr      CeedElemRestriction for CeedVector containing assembled
+                          CeedQFunction
+  @param request        Address of CeedRequest for non-blocking completion, else
+                          @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorLinearAssembleQFunctionBuildOrUpdate(CeedOperator op,
+    CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  ierr = CeedOperatorUpdateBuiltFields(op); CeedChk(ierr);
+
+  uint64_t state;
+  ierr = CeedOperatorGetBuildState(op, CEED_VECTOR_NONE, &state); CeedChk(ierr);
+  if (!op->qfassembled) {
+    ierr = CeedOperatorLinearAssembleQFunction(op, &op->qfassembled,
+           &op->qfassembledrstr, request); CeedChk(ierr);
+  } else if (state != op->qfassembledstate) {
+    if (!op->LinearAssembleQFunction && !op->opfallback) {
+      ierr = CeedOperatorCreateFallback(op); CeedChk(ierr);
+    }
+    CeedOperator opassemble = op->LinearAssembleQFunction ? op : op->opfallback;
+    if (opassemble->LinearAssembleQFunctionUpdate) {
+      // Refill in place
+      ierr = opassemble->LinearAssembleQFunctionUpdate(opassemble,
+             op->qfassembled, op->qfassembledrstr, request); CeedChk(ierr);
+    } else {
+      // Assemble anew and copy the values into the kept storage
+      CeedVector qfnew;
+      CeedElemRestriction rstrnew;
+      const CeedScalar *array;
+      ierr = opassemble->LinearAssembleQFunction(opassemble, &qfnew, &rstrnew,
+             request); CeedChk(ierr);
+      ierr = CeedVectorGetArrayRead(qfnew, CEED_MEM_HOST, &array); CeedChk(ierr);
+      ierr = CeedVectorSetArray(op->qfassembled, CEED_MEM_HOST, CEED_COPY_VALUES,
+                                (CeedScalar *)array); CeedChk(ierr);
+      ierr = CeedVectorRestoreArrayRead(qfnew, &array); CeedChk(ierr);
+      ierr = CeedVectorDestroy(&qfnew); CeedChk(ierr);
+      ierr = CeedElemRestrictionDestroy(&rstrnew); CeedChk(ierr);
+    }
+  }
+  // Record the state after assembly, applying the QFunction reads its context
+  ierr = CeedOperatorGetBuildState(op, CEED_VECTOR_NONE, &op->qfassembledstate);
+  CeedChk(ierr);
 
+  *assembled = op->qfassembled;
+  ierr = CeedVectorAddReference(op->qfassembled); CeedChk(ierr);
+  *rstr = op->qfassembledrstr;
+  ierr = CeedElemRestrictionAddReference(op->qfassembledrstr); CeedChk(ierr);
   return 0;
 }
 
@@ -1011,6 +5053,7 @@ int CeedOperatorLinearAssembleDiagonal(CeedOperator op, CeedVector assembled,
   int ierr;
   Ceed ceed = op->ceed;
   ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  ierr = CeedOperatorUpdateBuiltFields(op); CeedChk(ierr);
 
   // Use backend version, if available
   if (op->LinearAssembleDiagonal) {
@@ -1058,6 +5101,7 @@ int CeedOperatorLinearAssembleAddDiagonal(CeedOperator op, CeedVector assembled,
   int ierr;
   Ceed ceed = op->ceed;
   ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  ierr = CeedOperatorUpdateBuiltFields(op); CeedChk(ierr);
 
   // Use backend version, if available
   if (op->LinearAssembleAddDiagonal) {
@@ -1103,6 +5147,7 @@ int CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op,
   int ierr;
   Ceed ceed = op->ceed;
   ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  ierr = CeedOperatorUpdateBuiltFields(op); CeedChk(ierr);
 
   // Use backend version, if available
   if (op->LinearAssemblePointBlockDiagonal) {
@@ -1132,46 +5177,146 @@ int CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op,
 }
 
 /**
-  @brief Assemble the point block diagonal of a square linear CeedOperator
+  @brief Assemble the point block diagonal of a square linear CeedOperator
+
+  This sums into a CeedVector with the point block diagonal of a linear
+    CeedOperator.
+
+  Note: Currently only non-composite CeedOperators with a single field and
+          composite CeedOperators with single field sub-operators are supported.
+
+  @param op             CeedOperator to assemble CeedQFunction
+  @param[out] assembled CeedVector to store assembled CeedOperator point block
+                          diagonal, provided in row-major form with an
+                          @a ncomp * @a ncomp block at each node. The dimensions
+                          of this vector are derived from the active vector
+                          for the CeedOperator. The array has shape
+                          [nodes, component out, component in].
+  @param request        Address of CeedRequest for non-blocking completion, else
+                          CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op,
+    CeedVector assembled, CeedRequest *request) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  ierr = CeedOperatorUpdateBuiltFields(op); CeedChk(ierr);
+
+  // Use backend version, if available
+  if (op->LinearAssembleAddPointBlockDiagonal) {
+    ierr = op->LinearAssembleAddPointBlockDiagonal(op, assembled, request);
+    CeedChk(ierr);
+  } else {
+    // Fallback to reference Ceed
+    if (!op->opfallback) {
+      ierr = CeedOperatorCreateFallback(op); CeedChk(ierr);
+    }
+    // Assemble
+    ierr = op->opfallback->LinearAssembleAddPointBlockDiagonal(op->opfallback,
+           assembled, request); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+/**
+  @brief Fully assemble the nonzero pattern of a linear operator.
+
+  Expected to be used in conjunction with CeedOperatorLinearAssemble()
+
+  The assembly routines use coordinate format, with nentries tuples of the
+    form (i, j, value) which indicate that value should be added to the
+    matrix in entry (i, j). Note that the (i, j) pairs are not unique and
+    may repeat. This function returns the number of entries and their (i, j)
+    locations, while CeedOperatorLinearAssemble() provides the values in the
+    same ordering.
+
+  This will generally be slow unless your operator is low-order.
+
+  Note: Currently only non-composite CeedOperators with a single field and
+          composite CeedOperators with single field sub-operators are supported.
+
+  @param[in]  op        CeedOperator to assemble
+  @param[out] nentries  Number of entries in coordinate nonzero pattern
+  @param[out] rows      Row number for each entry, allocated by this function
+                          and freed by the caller with CeedFree(&rows)
+  @param[out] cols      Column number for each entry, allocated by this
+                          function and freed by the caller with
+                          CeedFree(&cols)
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorLinearAssembleSymbolic(CeedOperator op, CeedInt *nentries,
+                                       CeedInt **rows, CeedInt **cols) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+
+  // Use backend version, if available
+  if (op->LinearAssembleSymbolic) {
+    ierr = op->LinearAssembleSymbolic(op, nentries, rows, cols); CeedChk(ierr);
+  } else {
+    // Fallback to reference Ceed
+    if (!op->opfallback) {
+      ierr = CeedOperatorCreateFallback(op); CeedChk(ierr);
+    }
+    // Assemble
+    ierr = op->opfallback->LinearAssembleSymbolic(op->opfallback, nentries,
+           rows, cols); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+/**
+  @brief Fully assemble the nonzero entries of a linear operator.
 
-  This sums into a CeedVector with the point block diagonal of a linear
-    CeedOperator.
+  Expected to be used in conjunction with CeedOperatorLinearAssembleSymbolic()
+
+  The assembly routines use coordinate format, with nentries tuples of the
+    form (i, j, value) which indicate that value should be added to the
+    matrix in entry (i, j). Note that the (i, j) pairs are not unique and
+    may repeat. This function returns the values of the nonzero entries to
+    be added, their (i, j) locations are provided by
+    CeedOperatorLinearAssembleSymbolic()
+
+  This will generally be slow unless your operator is low-order.
 
   Note: Currently only non-composite CeedOperators with a single field and
           composite CeedOperators with single field sub-operators are supported.
 
-  @param op             CeedOperator to assemble CeedQFunction
-  @param[out] assembled CeedVector to store assembled CeedOperator point block
-                          diagonal, provided in row-major form with an
-                          @a ncomp * @a ncomp block at each node. The dimensions
-                          of this vector are derived from the active vector
-                          for the CeedOperator. The array has shape
-                          [nodes, component out, component in].
-  @param request        Address of CeedRequest for non-blocking completion, else
-                          CEED_REQUEST_IMMEDIATE
+  @param[in]  op      CeedOperator to assemble
+  @param[out] values  CeedVector of length nentries to store the values of
+                        the assembled entries, in the same ordering as the
+                        pattern from CeedOperatorLinearAssembleSymbolic()
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
-int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op,
-    CeedVector assembled, CeedRequest *request) {
+int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values) {
   int ierr;
   Ceed ceed = op->ceed;
   ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  ierr = CeedOperatorUpdateBuiltFields(op); CeedChk(ierr);
 
   // Use backend version, if available
-  if (op->LinearAssembleAddPointBlockDiagonal) {
-    ierr = op->LinearAssembleAddPointBlockDiagonal(op, assembled, request);
-    CeedChk(ierr);
+  if (op->LinearAssemble) {
+    ierr = op->LinearAssemble(op, values); CeedChk(ierr);
   } else {
     // Fallback to reference Ceed
     if (!op->opfallback) {
       ierr = CeedOperatorCreateFallback(op); CeedChk(ierr);
     }
     // Assemble
-    ierr = op->opfallback->LinearAssembleAddPointBlockDiagonal(op->opfallback,
-           assembled, request); CeedChk(ierr);
+    ierr = op->opfallback->LinearAssemble(op->opfallback, values);
+    CeedChk(ierr);
   }
 
   return 0;
@@ -1416,110 +5561,702 @@ int CeedOperatorMultigridLevelCreateH1(CeedOperator opFine,
 }
 
 /**
-  @brief Build a FDM based approximate inverse for each element for a
-           CeedOperator
+  @brief Create a copy of a CeedOperator evaluated at new quadrature points
+
+  All bases of the operator are evaluated at @a Q quadrature points per
+    dimension, see CeedBasisCreateAtQuadrature(). Quadrature data set as a
+    passive input field must have a build operator, set with
+    CeedOperatorSetFieldBuilder(); the new operator stores its own quadrature
+    data at the new quadrature points, computed by a copy of the build
+    operator evaluated at the new quadrature points. Active fields at the
+    quadrature points, such as the output of a build operator, use the
+    backend strided layout for the new quadrature points.
+
+  A coarse operator from CeedOperatorMultigridLevelCreate() is evaluated at
+    the quadrature points of the fine operator. Evaluating it at quadrature
+    suited to the coarse basis instead, such as @a Q = @a P for
+    @ref CEED_GAUSS, makes its memory traffic scale with the coarse level.
+
+  @param op         CeedOperator with tensor-product bases
+  @param Q          Number of quadrature points in one dimension
+  @param qmode      Distribution of the Q quadrature points
+  @param[out] opQ   Address of the variable where the newly created
+                      CeedOperator will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorCreateAtQuadrature(CeedOperator op, CeedInt Q,
+                                   CeedQuadMode qmode, CeedOperator *opQ) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+
+  if (op->sharded || op->smoothop)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Cannot evaluate sharded or smoother operators "
+                     "at new quadrature points");
+  // LCOV_EXCL_STOP
+  if (op->composite) {
+    ierr = CeedCompositeOperatorCreate(ceed, opQ); CeedChk(ierr);
+    for (CeedInt i=0; i<op->numsub; i++) {
+      CeedOperator subQ;
+      ierr = CeedOperatorCreateAtQuadrature(op->suboperators[i], Q, qmode,
+                                            &subQ); CeedChk(ierr);
+      ierr = CeedCompositeOperatorAddSub(*opQ, subQ); CeedChk(ierr);
+      ierr = CeedOperatorDestroy(&subQ); CeedChk(ierr);
+    }
+    return 0;
+  }
+
+  // Number of new quadrature points
+  CeedInt dim = 0;
+  for (CeedInt i=0; i<op->nfields && !dim; i++) {
+    CeedOperatorField field = i < op->qf->numinputfields ?
+                              op->inputfields[i] :
+                              op->outputfields[i - op->qf->numinputfields];
+    if (field->basis != CEED_BASIS_COLLOCATED)
+      dim = field->basis->dim;
+  }
+  CeedInt numqptsQ = CeedIntPow(Q, dim);
+
+  ierr = CeedOperatorCreate(ceed, op->qf, op->dqf, op->dqfT, opQ);
+  CeedChk(ierr);
+  for (CeedInt i=0; i<op->qf->numinputfields; i++) {
+    ierr = CeedOperatorSetFieldAtQuadrature(op->inputfields[i], op->numqpoints,
+                                            numqptsQ, Q, qmode, *opQ);
+    CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<op->qf->numoutputfields; i++) {
+    ierr = CeedOperatorSetFieldAtQuadrature(op->outputfields[i],
+                                            op->numqpoints, numqptsQ, Q, qmode,
+                                            *opQ); CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Build a FDM based approximate inverse for each element for a
+           CeedOperator
+
+  This returns a CeedOperator and CeedVector to apply a Fast Diagonalization
+    Method based approximate inverse. This function obtains the simultaneous
+    diagonalization for the 1D mass and Laplacian operators,
+      M = V^T V, K = V^T S V.
+    The assembled QFunction is used to modify the eigenvalues from simultaneous
+    diagonalization and obtain an approximate inverse of the form
+      V^T S^hat V. The CeedOperator must be linear and non-composite. The
+    associated CeedQFunction must therefore also be linear. The scaling of the
+    eigenvalues is chosen with CeedOperatorSetFDMMode().
+
+  @param op             CeedOperator to create element inverses
+  @param[out] fdminv    CeedOperator to apply the action of a FDM based inverse
+                          for each element
+  @param request        Address of CeedRequest for non-blocking completion, else
+                          @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdminv,
+                                        CeedRequest *request) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  ierr = CeedOperatorUpdateBuiltFields(op); CeedChk(ierr);
+
+  // Use backend version, if available
+  if (op->CreateFDMElementInverse) {
+    ierr = op->CreateFDMElementInverse(op, fdminv, request); CeedChk(ierr);
+  } else {
+    // Fallback to reference Ceed
+    if (!op->opfallback) {
+      ierr = CeedOperatorCreateFallback(op); CeedChk(ierr);
+    }
+    // Assemble
+    ierr = op->opfallback->CreateFDMElementInverse(op->opfallback, fdminv,
+           request); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+/**
+  @brief Estimate the flops of one application of a CeedOperator
+
+  The estimate counts the basis actions from their contraction sizes, the
+    additions of the transpose restrictions, and the flops per quadrature
+    point set with CeedQFunctionSetUserFlopsEstimate(). Composite operators
+    and Chebyshev smoothers add up the estimates of the operators they apply.
+
+  @param op          CeedOperator
+  @param[out] flops  Variable to store the estimated flops
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorGetFlopsEstimate(CeedOperator op, size_t *flops) {
+  int ierr;
+  size_t bytes;
+  ierr = CeedOperatorCheckReady(op->ceed, op); CeedChk(ierr);
+  ierr = CeedOperatorEstimate(op, flops, &bytes); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Estimate the bytes moved by one application of a CeedOperator
+
+  The estimate counts each L-vector read through a CeedElemRestriction once,
+    output L-vectors as read and written, and the offsets of each distinct
+    CeedElemRestriction once, which is the traffic of an operator that keeps
+    element data in cache.
+
+  @param op          CeedOperator
+  @param[out] bytes  Variable to store the estimated bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorGetBytesEstimate(CeedOperator op, size_t *bytes) {
+  int ierr;
+  size_t flops;
+  ierr = CeedOperatorCheckReady(op->ceed, op); CeedChk(ierr);
+  ierr = CeedOperatorEstimate(op, &flops, bytes); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Save the setup state of a CeedOperator to a binary file
+
+  The file holds the passive input vectors, such as quadrature data, the
+    assembled CeedQFunction kept by
+    CeedOperatorLinearAssembleQFunctionBuildOrUpdate(), the dense element
+    matrices, and the inverse diagonal and eigenvalue bounds of Chebyshev
+    smoothers, for @a op and all its suboperators. A restarted run can restore
+    them with @ref CeedOperatorLoad instead of recomputing them. Kernels
+    compiled by the CUDA and HIP backends are not included; they are reused
+    across runs by setting the environment variable CEED_JIT_CACHE_DIR.
+
+  @param op            CeedOperator to save
+  @param filename      Name of the file to write
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorSave(CeedOperator op, const char *filename) {
+  int ierr;
+  CeedOperatorFileHeader header;
+  CeedInt numops = 0, numrecords = 0;
+
+  ierr = CeedOperatorCheckReady(op->ceed, op); CeedChk(ierr);
+  FILE *stream = fopen(filename, "wb");
+  if (!stream)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Cannot open %s for writing", filename);
+  // LCOV_EXCL_STOP
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, ceed_operator_file_magic, sizeof(header.magic));
+  header.version = CEED_OPERATOR_FILE_VERSION;
+  bool written = fwrite(&header, sizeof(header), 1, stream) == 1;
+  ierr = CeedOperatorSaveRecords(op, stream, &numops, &numrecords);
+  // Rewrite the header with the number of records
+  header.numops = numops;
+  header.numrecords = numrecords;
+  written = written && !fseek(stream, 0, SEEK_SET) &&
+            fwrite(&header, sizeof(header), 1, stream) == 1;
+  written = !fclose(stream) && written;
+  CeedChk(ierr);
+  if (!written)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Cannot write %s", filename);
+  // LCOV_EXCL_STOP
+  return 0;
+}
+
+/**
+  @brief Load the setup state of a CeedOperator from a file written by
+           @ref CeedOperatorSave
+
+  The CeedOperator must have the same structure as the one saved, with the
+    same suboperators and passive input fields. The file is mapped into memory
+    and its data copied into the passive input vectors and the assembled data
+    of the operators, which are then considered up to date: passive inputs set
+    with CeedOperatorSetFieldBuilder() are not rebuilt and assembled data is not
+    reassembled until their inputs change.
+
+  @param op            CeedOperator to load
+  @param filename      Name of the file to read
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorLoad(CeedOperator op, const char *filename) {
+  int ierr;
+  struct stat st;
+  CeedInt numops = 0;
+  CeedOperator dummy = NULL;
+
+  ierr = CeedOperatorCheckReady(op->ceed, op); CeedChk(ierr);
+  ierr = CeedOperatorFindRecordOperator(op, -1, &numops, &dummy);
+  CeedChk(ierr);
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Cannot open %s for reading", filename);
+  // LCOV_EXCL_STOP
+  void *map = MAP_FAILED;
+  if (!fstat(fd, &st) && st.st_size > 0)
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Cannot map %s", filename);
+  // LCOV_EXCL_STOP
+  const CeedOperatorFileHeader *header = map;
+  if ((size_t)st.st_size < sizeof(*header) ||
+      memcmp(header->magic, ceed_operator_file_magic, sizeof(header->magic)) ||
+      header->version > CEED_OPERATOR_FILE_VERSION) {
+    // LCOV_EXCL_START
+    munmap(map, st.st_size);
+    return CeedError(op->ceed, 1, "%s is not a CeedOperator file", filename);
+    // LCOV_EXCL_STOP
+  }
+  if (header->numops != numops) {
+    const CeedInt filenumops = header->numops;
+    munmap(map, st.st_size);
+    return CeedError(op->ceed, 1, "CeedOperator file has %d operators, "
+                     "CeedOperator has %d", filenumops, numops);
+  }
+
+  // Read the records, then mark their data as up to date
+  size_t *offsets;
+  ierr = CeedCalloc(header->numrecords, &offsets);
+  for (CeedInt r = 0; !ierr && r < header->numrecords; r++) {
+    const size_t offset = r ? offsets[r-1] : sizeof(*header);
+    const CeedOperatorRecordHeader *record =
+      (const CeedOperatorRecordHeader *)((const char *)map + offset);
+    CeedOperator target = NULL;
+    CeedInt count = 0;
+    size_t used;
+    if ((size_t)st.st_size - offset < sizeof(*record)) {
+      // LCOV_EXCL_START
+      ierr = CeedError(op->ceed, 1, "CeedOperator file is truncated");
+      break;
+      // LCOV_EXCL_STOP
+    }
+    ierr = CeedOperatorFindRecordOperator(op, record->opindex, &count,
+                                          &target);
+    if (!ierr && !target)
+      // LCOV_EXCL_START
+      ierr = CeedError(op->ceed, 1, "CeedOperator record for operator %d "
+                       "out of range", record->opindex);
+    // LCOV_EXCL_STOP
+    if (!ierr)
+      ierr = CeedOperatorReadRecord(target, record, record + 1,
+                                    st.st_size - offset - sizeof(*record),
+                                    &used);
+    if (!ierr)
+      offsets[r] = offset + sizeof(*record) + used;
+  }
+  for (CeedInt r = 0; !ierr && r < header->numrecords; r++) {
+    const CeedOperatorRecordHeader *record = (const CeedOperatorRecordHeader *)
+        ((const char *)map + (r ? offsets[r-1] : sizeof(*header)));
+    CeedOperator target = NULL;
+    CeedInt count = 0;
+    ierr = CeedOperatorFindRecordOperator(op, record->opindex, &count,
+                                          &target);
+    if (!ierr)
+      ierr = CeedOperatorRecordState(target, record);
+  }
+  CeedFree(&offsets);
+  munmap(map, st.st_size);
+  CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief View a CeedOperator
+
+  @param[in] op     CeedOperator to view
+  @param[in] stream Stream to write; typically stdout/stderr or a file
+
+  @return Error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorView(CeedOperator op, FILE *stream) {
+  int ierr;
+
+  if (op->smoothop) {
+    fprintf(stream, "Chebyshev smoother CeedOperator\n");
+    fprintf(stream, "  %d sweeps, eigenvalue bounds [%g, %g]\n",
+            op->smoothdegree, op->smoothlmin, op->smoothlmax);
+    fprintf(stream, "  Smoothed Operator:\n");
+    ierr = CeedOperatorView(op->smoothop, stream); CeedChk(ierr);
+  } else if (op->composite) {
+    fprintf(stream, "%s CeedOperator\n", op->sharded ? "Sharded" : "Composite");
+
+    for (CeedInt i=0; i<op->numsub; i++) {
+      fprintf(stream, "  SubOperator [%d]:\n", i);
+      ierr = CeedOperatorSingleView(op->suboperators[i], 1, stream);
+      CeedChk(ierr);
+    }
+    if (op->profiledata.count[CEED_PROFILE_OPERATOR]) {
+      ierr = CeedProfileView(&op->profiledata, "  ", stream); CeedChk(ierr);
+    }
+  } else if (op->chainops[0]) {
+    fprintf(stream, "Chained CeedOperator, intermediate %s\n",
+            op->chainfused ? "in element layout" : "L-vector");
+    for (CeedInt i=0; i<2; i++) {
+      fprintf(stream, "  Operator [%d]:\n", i);
+      ierr = CeedOperatorView(op->chainops[i], stream); CeedChk(ierr);
+    }
+} else {
+    fprintf(stream, "CeedOperator\n");
+    ierr = CeedOperatorSingleView(op, 0, stream); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+/**
+  @brief Prepare a CeedOperator for application
+
+  Backends that generate and compile kernels for each operator, such as
+    /gpu/cuda/gen and /gpu/hip/gen, start the compilation in the background and
+    return right away. Calling CeedOperatorPrepare() on every operator of an
+    application before the first CeedOperatorApply() lets these compilations
+    run concurrently with each other and with the rest of the setup. The first
+    application waits for the compilation of its kernel, if still pending.
+    Backends that compile nothing do nothing.
+
+  @param op  CeedOperator to prepare
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorPrepare(CeedOperator op) {
+  int ierr;
+  ierr = CeedOperatorCheckReady(op->ceed, op); CeedChk(ierr);
+
+  if (op->smoothop) {
+    ierr = CeedOperatorPrepare(op->smoothop); CeedChk(ierr);
+  } else if (op->composite) {
+    for (CeedInt i=0; i<op->numsub; i++) {
+      if (op->sharded) {
+        ierr = CeedSetCurrentDevice(op->suboperators[i]->ceed); CeedChk(ierr);
+      }
+      ierr = CeedOperatorPrepare(op->suboperators[i]); CeedChk(ierr);
+    }
+    if (op->sharded) {
+      ierr = CeedSetCurrentDevice(op->ceed); CeedChk(ierr);
+    }
+  } else {
+    for (CeedInt i=0; i<op->qf->numinputfields; i++)
+      if (op->inputfields[i]->buildop) {
+        ierr = CeedOperatorPrepare(op->inputfields[i]->buildop); CeedChk(ierr);
+      }
+    if (op->Prepare && op->numelements) {
+      ierr = op->Prepare(op); CeedChk(ierr);
+    }
+  }
+  return 0;
+}
+
+/**
+  @brief Whether the backend applies the Dirichlet constraint of a CeedOperator
+
+  @param op  CeedOperator
+
+  @return true if the backend inserts and zeroes the constrained entries
+
+  @ref Developer
+**/
+static bool CeedOperatorHasNativeDirichlet(CeedOperator op) {
+  return op->SetDirichlet && op->numelements &&
+         op->ematmode == CEED_ELEMMATRIX_NEVER;
+}
+
+/**
+  @brief Apply a CeedOperator with a Dirichlet constraint the backend does not
+           apply, inserting the constrained values into a copy of the input
+
+  @param op        CeedOperator to apply
+  @param[in] in    CeedVector containing input state
+  @param[out] out  CeedVector to store or sum in the result
+  @param add       Whether to sum the result into @a out
+  @param[out] dot  Address to store in^T out, or NULL
+  @param request   Address of CeedRequest for non-blocking completion, else
+                     @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorApplyDirichlet(CeedOperator op, CeedVector in,
+                                      CeedVector out, bool add,
+                                      CeedScalar *dot, CeedRequest *request) {
+  int ierr;
+  const CeedInt nbc = op->nbc, *indices = op->bcindices;
+  if (in == CEED_VECTOR_NONE || out == CEED_VECTOR_NONE)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Dirichlet constraints require active input "
+                     "and output vectors");
+  // LCOV_EXCL_STOP
+  for (CeedInt k=0; k<nbc; k++)
+    if (indices[k] >= in->length || indices[k] >= out->length)
+      // LCOV_EXCL_START
+      return CeedError(op->ceed, 1, "Constrained entry %d exceeds the active "
+                       "vector lengths", indices[k]);
+  // LCOV_EXCL_STOP
+
+  // Input with the constrained values
+  if (op->bcin && op->bcin->length != in->length) {
+    ierr = CeedVectorDestroy(&op->bcin); CeedChk(ierr);
+  }
+  if (!op->bcin) {
+    ierr = CeedVectorCreate(op->ceed, in->length, &op->bcin); CeedChk(ierr);
+  }
+  const CeedScalar *inarray, *values = NULL;
+  CeedScalar *bcarray;
+  ierr = CeedVectorGetArrayRead(in, CEED_MEM_HOST, &inarray); CeedChk(ierr);
+  ierr = CeedVectorGetArray(op->bcin, CEED_MEM_HOST, &bcarray); CeedChk(ierr);
+  memcpy(bcarray, inarray, in->length*sizeof(CeedScalar));
+  ierr = CeedVectorRestoreArrayRead(in, &inarray); CeedChk(ierr);
+  if (op->bcvalues) {
+    ierr = CeedVectorGetArrayRead(op->bcvalues, CEED_MEM_HOST, &values);
+    CeedChk(ierr);
+  }
+  for (CeedInt k=0; k<nbc; k++)
+    bcarray[indices[k]] = values ? values[k] : 0.0;
+  if (op->bcvalues) {
+    ierr = CeedVectorRestoreArrayRead(op->bcvalues, &values); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArray(op->bcin, &bcarray); CeedChk(ierr);
+
+  // Output entries kept by ApplyAdd
+  CeedScalar *outarray;
+  if (add) {
+    if (!op->bcsaved) {
+      ierr = CeedMalloc(nbc, &op->bcsaved); CeedChk(ierr);
+    }
+    ierr = CeedVectorGetArrayRead(out, CEED_MEM_HOST,
+                                  (const CeedScalar **)&outarray);
+    CeedChk(ierr);
+    for (CeedInt k=0; k<nbc; k++)
+      op->bcsaved[k] = outarray[indices[k]];
+    ierr = CeedVectorRestoreArrayRead(out, (const CeedScalar **)&outarray);
+    CeedChk(ierr);
+  }
+
+  // Apply
+  op->bcapplying = true;
+  if (add)
+    ierr = CeedOperatorApplyAdd(op, op->bcin, out, request);
+  else
+    ierr = CeedOperatorApply(op, op->bcin, out, request);
+  op->bcapplying = false;
+  CeedChk(ierr);
+
+  // Constrained output entries
+  ierr = CeedVectorGetArray(out, CEED_MEM_HOST, &outarray); CeedChk(ierr);
+  for (CeedInt k=0; k<nbc; k++)
+    outarray[indices[k]] = add ? op->bcsaved[k] : 0.0;
+  ierr = CeedVectorRestoreArray(out, &outarray); CeedChk(ierr);
+  if (dot) {
+    ierr = CeedVectorDot(in, out, dot); CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Get the staging copy of a vector in another memory space
 
-  This returns a CeedOperator and CeedVector to apply a Fast Diagonalization
-    Method based approximate inverse. This function obtains the simultaneous
-    diagonalization for the 1D mass and Laplacian operators,
-      M = V^T V, K = V^T S V.
-    The assembled QFunction is used to modify the eigenvalues from simultaneous
-    diagonalization and obtain an approximate inverse of the form
-      V^T S^hat V. The CeedOperator must be linear and non-composite. The
-    associated CeedQFunction must therefore also be linear.
+  Vectors of a Ceed preferring another memory type than the Ceed of the
+    operator, such as the host vectors of a coarse multigrid level placed on a
+    CPU Ceed for an operator on a GPU Ceed, are copied to a vector of the
+    operator Ceed. Vectors of other Ceeds with the same preferred memory type
+    are used directly.
 
-  @param op             CeedOperator to create element inverses
-  @param[out] fdminv    CeedOperator to apply the action of a FDM based inverse
-                          for each element
-  @param request        Address of CeedRequest for non-blocking completion, else
-                          @ref CEED_REQUEST_IMMEDIATE
+  @param op            CeedOperator
+  @param vec           Input or output vector
+  @param[in,out] stage Staging vector of @a op, created as needed
+  @param[out] staged   Address to store @a vec or its staging vector
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref Developer
 **/
-int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdminv,
-                                        CeedRequest *request) {
+static int CeedOperatorGetStagedVector(CeedOperator op, CeedVector vec,
+                                       CeedVector *stage, CeedVector *staged) {
   int ierr;
-  Ceed ceed = op->ceed;
-  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
 
-  // Use backend version, if available
-  if (op->CreateFDMElementInverse) {
-    ierr = op->CreateFDMElementInverse(op, fdminv, request); CeedChk(ierr);
-  } else {
-    // Fallback to reference Ceed
-    if (!op->opfallback) {
-      ierr = CeedOperatorCreateFallback(op); CeedChk(ierr);
-    }
-    // Assemble
-    ierr = op->opfallback->CreateFDMElementInverse(op->opfallback, fdminv,
-           request); CeedChk(ierr);
-  }
+  *staged = vec;
+  if (vec == CEED_VECTOR_NONE || vec == CEED_VECTOR_ACTIVE ||
+      vec->ceed == op->ceed)
+    return 0;
+  Ceed parent, vecparent;
+  ierr = CeedGetParent(op->ceed, &parent); CeedChk(ierr);
+  ierr = CeedGetParent(vec->ceed, &vecparent); CeedChk(ierr);
+  if (parent == vecparent)
+    return 0;
+  CeedMemType memtype, vecmemtype;
+  ierr = CeedGetPreferredMemType(op->ceed, &memtype); CeedChk(ierr);
+  ierr = CeedGetPreferredMemType(vec->ceed, &vecmemtype); CeedChk(ierr);
+  if (memtype == vecmemtype)
+    return 0;
 
+  if (*stage && (*stage)->length != vec->length) {
+    ierr = CeedVectorDestroy(stage); CeedChk(ierr);
+  }
+  if (!*stage) {
+    ierr = CeedVectorCreate(op->ceed, vec->length, stage); CeedChk(ierr);
+  }
+  *staged = *stage;
   return 0;
 }
 
 /**
-  @brief View a CeedOperator
+  @brief Apply a CeedOperator to vectors in another memory space
 
-  @param[in] op     CeedOperator to view
-  @param[in] stream Stream to write; typically stdout/stderr or a file
+  The input is copied to the memory space of the operator Ceed before the
+    apply, and the output is copied back after it. The copies go through the
+    vector interface and complete before the function returns.
 
-  @return Error code: 0 - success, otherwise - failure
+  @param op        CeedOperator to apply
+  @param[in] in    CeedVector containing input state
+  @param[out] out  CeedVector to store or sum in the result
+  @param[out] dot  Address to store in^T out, or NULL
+  @param add       Boolean flag to sum into @a out
+  @param request   Address of CeedRequest for non-blocking completion, else
+                     @ref CEED_REQUEST_IMMEDIATE
+  @param[out] applied  Boolean flag set when a vector was staged and @a op
+                         applied
 
-  @ref User
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
 **/
-int CeedOperatorView(CeedOperator op, FILE *stream) {
+static int CeedOperatorApplyStaged(CeedOperator op, CeedVector in,
+                                   CeedVector out, CeedScalar *dot, bool add,
+                                   CeedRequest *request, bool *applied) {
   int ierr;
+  CeedVector instaged, outstaged;
 
-  if (op->composite) {
-    fprintf(stream, "Composite CeedOperator\n");
+  ierr = CeedOperatorGetStagedVector(op, in, &op->stagein, &instaged);
+  CeedChk(ierr);
+  ierr = CeedOperatorGetStagedVector(op, out, &op->stageout, &outstaged);
+  CeedChk(ierr);
+  *applied = instaged != in || outstaged != out;
+  if (!*applied)
+    return 0;
 
-    for (CeedInt i=0; i<op->numsub; i++) {
-      fprintf(stream, "  SubOperator [%d]:\n", i);
-      ierr = CeedOperatorSingleView(op->suboperators[i], 1, stream);
-      CeedChk(ierr);
-    }
+  if (instaged != in) {
+    ierr = CeedVectorCopy(in, instaged); CeedChk(ierr);
+  }
+  if (add && outstaged != out) {
+    ierr = CeedVectorCopy(out, outstaged); CeedChk(ierr);
+  }
+  if (add) {
+    ierr = CeedOperatorApplyAdd(op, instaged, outstaged,
+                                CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
+  } else if (dot) {
+    ierr = CeedOperatorApplyDot(op, instaged, outstaged, dot,
+                                CEED_REQUEST_IMMEDIATE); CeedChk(ierr);
   } else {
-    fprintf(stream, "CeedOperator\n");
-    ierr = CeedOperatorSingleView(op, 0, stream); CeedChk(ierr);
+    ierr = CeedOperatorApply(op, instaged, outstaged, CEED_REQUEST_IMMEDIATE);
+    CeedChk(ierr);
   }
-
+  if (outstaged != out) {
+    ierr = CeedVectorCopy(outstaged, out); CeedChk(ierr);
+  }
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
   return 0;
 }
 
 /**
-  @brief Apply CeedOperator to a vector
-
-  This computes the action of the operator on the specified (active) input,
-  yielding its (active) output.  All inputs and outputs must be specified using
-  CeedOperatorSetField().
+  @brief Apply CeedOperator to a vector, optionally computing the product of
+           the input and output
 
   @param op        CeedOperator to apply
-  @param[in] in    CeedVector containing input state or @ref CEED_VECTOR_NONE if
-                  there are no active inputs
-  @param[out] out  CeedVector to store result of applying operator (must be
-                     distinct from @a in) or @ref CEED_VECTOR_NONE if there are no
-                     active outputs
+  @param[in] in    CeedVector containing input state
+  @param[out] out  CeedVector to store result of applying operator
+  @param[out] dot  Address to store in^T out, or NULL
   @param request   Address of CeedRequest for non-blocking completion, else
                      @ref CEED_REQUEST_IMMEDIATE
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref User
+  @ref Developer
 **/
-int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out,
-                      CeedRequest *request) {
+static int CeedOperatorApplyCore(CeedOperator op, CeedVector in,
+                                 CeedVector out, CeedScalar *dot,
+                                 CeedRequest *request) {
   int ierr;
   Ceed ceed = op->ceed;
+
+  // Vectors in another memory space
+  bool staged;
+  ierr = CeedOperatorApplyStaged(op, in, out, dot, false, request, &staged);
+  CeedChk(ierr);
+  if (staged)
+    return 0;
+
+  if (op->nbc && !op->bcapplying && !CeedOperatorHasNativeDirichlet(op))
+    // Dirichlet constraint on a copy of the input
+    return CeedOperatorApplyDirichlet(op, in, out, false, dot, request);
+
+  if (op->chainops[0]) {
+    // Chained operators
+    ierr = CeedOperatorApply(op->chainops[0], in, op->chainvec,
+                             CEED_REQUEST_ORDERED); CeedChk(ierr);
+    ierr = CeedOperatorApply(op->chainops[1], op->chainvec, out, request);
+    CeedChk(ierr);
+    if (dot) {
+      ierr = CeedVectorDot(in, out, dot); CeedChk(ierr);
+    }
+    return 0;
+  }
+
   ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  ierr = CeedOperatorUpdateBuiltFields(op); CeedChk(ierr);
+
+  // Operations complete on return unless the backend provides a request
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
+
+  // Profile operator application
+  CeedOperator prevop;
+  double start;
+  ierr = CeedProfileSetOperator(ceed, op, &prevop); CeedChk(ierr);
+  ierr = CeedProfileStart(ceed, CEED_PROFILE_OPERATOR, &start); CeedChk(ierr);
 
-  if (op->numelements)  {
+  if (op->ematmode && !op->ematchecked) {
+    ierr = CeedOperatorUseElementMatrices(op); CeedChk(ierr);
+  }
+  if (op->ematused) {
+    // Element matrices
+    ierr = CeedVectorSetValue(out, 0.0); CeedChk(ierr);
+    ierr = CeedOperatorApplyAddElementMatrices(op, in, out, request);
+    CeedChk(ierr);
+  } else if (op->numelements)  {
     // Standard Operator
-    if (op->Apply) {
+    if (dot && op->ApplyDot) {
+      // Backend accumulates the product while applying
+      ierr = op->ApplyDot(op, in, out, dot, request); CeedChk(ierr);
+      dot = NULL;
+    } else if (op->Apply) {
       ierr = op->Apply(op, in, out, request); CeedChk(ierr);
     } else {
+      // Zeroing the outputs also resets reduced outputs
       // Zero all output vectors
       CeedQFunction qf = op->qf;
       for (CeedInt i=0; i<qf->numoutputfields; i++) {
@@ -1533,10 +6270,22 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out,
       // Apply
       ierr = op->ApplyAdd(op, in, out, request); CeedChk(ierr);
     }
+    ierr = CeedOperatorReduceOutputs(op, false); CeedChk(ierr);
+  } else if (op->smoothop) {
+    // Chebyshev smoother
+    ierr = CeedVectorSetValue(out, 0.0); CeedChk(ierr);
+    ierr = CeedOperatorApplyAddChebyshev(op, in, out); CeedChk(ierr);
+  } else if (op->sharded) {
+    // Sharded Operator
+    if (out != CEED_VECTOR_NONE) {
+      ierr = CeedVectorSetValue(out, 0.0); CeedChk(ierr);
+    }
+    ierr = CeedOperatorApplyAddSharded(op, in, out); CeedChk(ierr);
   } else if (op->composite) {
     // Composite Operator
     if (op->ApplyComposite) {
       ierr = op->ApplyComposite(op, in, out, request); CeedChk(ierr);
+      ierr = CeedOperatorReduceOutputs(op, false); CeedChk(ierr);
     } else {
       CeedInt numsub;
       ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
@@ -1555,17 +6304,91 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out,
           }
         }
       }
-      // Apply
-      for (CeedInt i=0; i<op->numsub; i++) {
-        ierr = CeedOperatorApplyAdd(op->suboperators[i], in, out, request);
-        CeedChk(ierr);
+      ierr = CeedOperatorResetReducedOutputs(op, true); CeedChk(ierr);
+      // Apply; only the last suboperator may return a request
+      bool fused;
+      ierr = CeedCompositeOperatorApplyAddFused(op, in, out, request, &fused);
+      CeedChk(ierr);
+      if (fused) {
+        // Suboperators sharing fields applied in one pass
+      } else if (op->ApplyAddComposite) {
+        ierr = op->ApplyAddComposite(op, in, out, request); CeedChk(ierr);
+        ierr = CeedOperatorReduceOutputs(op, true); CeedChk(ierr);
+      } else {
+        for (CeedInt i=0; i<op->numsub; i++) {
+          ierr = CeedOperatorApplyAdd(op->suboperators[i], in, out,
+                                      i < numsub-1 ? CEED_REQUEST_ORDERED : request);
+          CeedChk(ierr);
+        }
       }
     }
   }
 
+  if (dot) {
+    ierr = CeedVectorDot(in, out, dot); CeedChk(ierr);
+  }
+  ierr = CeedOperatorProfileStop(op, 1, out, start); CeedChk(ierr);
+  ierr = CeedProfileSetOperator(ceed, prevop, NULL); CeedChk(ierr);
+
   return 0;
 }
 
+/**
+  @brief Apply CeedOperator to a vector
+
+  This computes the action of the operator on the specified (active) input,
+  yielding its (active) output.  All inputs and outputs must be specified using
+  CeedOperatorSetField().
+
+  @param op        CeedOperator to apply
+  @param[in] in    CeedVector containing input state or @ref CEED_VECTOR_NONE if
+                  there are no active inputs
+  @param[out] out  CeedVector to store result of applying operator (must be
+                     distinct from @a in) or @ref CEED_VECTOR_NONE if there are no
+                     active outputs
+  @param request   Address of CeedRequest for non-blocking completion, else
+                     @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out,
+                      CeedRequest *request) {
+  return CeedOperatorApplyCore(op, in, out, NULL, request);
+}
+
+/**
+  @brief Apply CeedOperator to a vector and compute the product of the input
+           and output
+
+  This computes out = A in, as CeedOperatorApply(), along with in^T out, as
+    needed by conjugate gradient iterations.  Backends may accumulate the
+    product from the element vectors while applying the operator, sparing a
+    separate pass over both vectors.
+
+  @param op        CeedOperator to apply
+  @param[in] in    CeedVector containing input state
+  @param[out] out  CeedVector to store result of applying operator (must be
+                     distinct from @a in)
+  @param[out] dot  Address to store the product in^T out
+  @param request   Address of CeedRequest for non-blocking completion, else
+                     @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyDot(CeedOperator op, CeedVector in, CeedVector out,
+                         CeedScalar *dot, CeedRequest *request) {
+  if (in == CEED_VECTOR_NONE || out == CEED_VECTOR_NONE || in == out)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "CeedOperatorApplyDot requires distinct "
+                     "active input and output vectors");
+  // LCOV_EXCL_STOP
+  return CeedOperatorApplyCore(op, in, out, dot, request);
+}
+
 /**
   @brief Apply CeedOperator to a vector and add result to output vector
 
@@ -1589,28 +6412,301 @@ int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out,
                          CeedRequest *request) {
   int ierr;
   Ceed ceed = op->ceed;
+
+  // Vectors in another memory space
+  bool staged;
+  ierr = CeedOperatorApplyStaged(op, in, out, NULL, true, request, &staged);
+  CeedChk(ierr);
+  if (staged)
+    return 0;
+
+  if (op->nbc && !op->bcapplying && !CeedOperatorHasNativeDirichlet(op))
+    // Dirichlet constraint on a copy of the input
+    return CeedOperatorApplyDirichlet(op, in, out, true, NULL, request);
+
+  if (op->chainops[0]) {
+    // Chained operators
+    ierr = CeedOperatorApply(op->chainops[0], in, op->chainvec,
+                             CEED_REQUEST_ORDERED); CeedChk(ierr);
+    ierr = CeedOperatorApplyAdd(op->chainops[1], op->chainvec, out, request);
+    CeedChk(ierr);
+    return 0;
+  }
+
   ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  ierr = CeedOperatorUpdateBuiltFields(op); CeedChk(ierr);
+
+  // Operations complete on return unless the backend provides a request
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
+
+  // Profile operator application
+  CeedOperator prevop;
+  double start;
+  ierr = CeedProfileSetOperator(ceed, op, &prevop); CeedChk(ierr);
+  ierr = CeedProfileStart(ceed, CEED_PROFILE_OPERATOR, &start); CeedChk(ierr);
 
-  if (op->numelements)  {
+  if (op->ematmode && !op->ematchecked) {
+    ierr = CeedOperatorUseElementMatrices(op); CeedChk(ierr);
+  }
+  if (op->ematused) {
+    // Element matrices
+    ierr = CeedOperatorApplyAddElementMatrices(op, in, out, request);
+    CeedChk(ierr);
+  } else if (op->numelements)  {
     // Standard Operator
+    ierr = CeedOperatorResetReducedOutputs(op, false); CeedChk(ierr);
     ierr = op->ApplyAdd(op, in, out, request); CeedChk(ierr);
+    ierr = CeedOperatorReduceOutputs(op, true); CeedChk(ierr);
+  } else if (op->smoothop) {
+    // Chebyshev smoother
+    ierr = CeedOperatorApplyAddChebyshev(op, in, out); CeedChk(ierr);
+  } else if (op->sharded) {
+    // Sharded Operator
+    ierr = CeedOperatorApplyAddSharded(op, in, out); CeedChk(ierr);
   } else if (op->composite) {
     // Composite Operator
-    if (op->ApplyAddComposite) {
+    bool fused;
+    ierr = CeedCompositeOperatorApplyAddFused(op, in, out, request, &fused);
+    CeedChk(ierr);
+    if (fused) {
+      // Suboperators sharing fields applied in one pass
+    } else if (op->ApplyAddComposite) {
+      ierr = CeedOperatorResetReducedOutputs(op, false); CeedChk(ierr);
       ierr = op->ApplyAddComposite(op, in, out, request); CeedChk(ierr);
+      ierr = CeedOperatorReduceOutputs(op, true); CeedChk(ierr);
     } else {
       CeedInt numsub;
       ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
       CeedOperator *suboperators;
       ierr = CeedOperatorGetSubList(op, &suboperators); CeedChk(ierr);
 
+      // Only the last suboperator may return a request
       for (CeedInt i=0; i<numsub; i++) {
-        ierr = CeedOperatorApplyAdd(suboperators[i], in, out, request);
+        ierr = CeedOperatorApplyAdd(suboperators[i], in, out,
+                                    i < numsub-1 ? CEED_REQUEST_ORDERED : request);
+        CeedChk(ierr);
+      }
+    }
+  }
+
+  ierr = CeedOperatorProfileStop(op, 1, out, start); CeedChk(ierr);
+  ierr = CeedProfileSetOperator(ceed, prevop, NULL); CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Apply the transpose of a linear CeedOperator
+
+  This computes the action of the transpose of the operator on a vector in its
+  (active) output space, yielding a vector in its (active) input space, as
+  needed by adjoint solves. The CeedQFunction is assembled at quadrature points
+  with CeedOperatorLinearAssembleQFunctionBuildOrUpdate() and applied with
+  swapped indices between the transposed basis and restriction actions of the
+  output and input fields, so no second set of quadrature data or restrictions
+  is created. The assembly is reused until a passive input or
+  CeedQFunctionContext of @a op changes.
+
+  Note: Each non-composite CeedOperator, and each suboperator of a composite
+          CeedOperator, must have a single active input and output field.
+
+  @param op        Linear CeedOperator to apply the transpose of
+  @param[in] in    CeedVector in the active output space of @a op
+  @param[out] out  CeedVector in the active input space of @a op to store the
+                     result (must be distinct from @a in)
+  @param request   Address of CeedRequest for non-blocking completion, else
+                     @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyTranspose(CeedOperator op, CeedVector in, CeedVector out,
+                               CeedRequest *request) {
+  int ierr;
+  Ceed ceed = op->ceed;
+
+  if (op->chainops[0]) {
+    // Chained operators, applied in reverse order
+    if (op->chainfused)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Transpose is not supported for fused chains");
+    // LCOV_EXCL_STOP
+    ierr = CeedOperatorApplyTranspose(op->chainops[1], in, op->chainvec,
+                                      CEED_REQUEST_ORDERED); CeedChk(ierr);
+    ierr = CeedOperatorApplyTranspose(op->chainops[0], op->chainvec, out,
+                                      request); CeedChk(ierr);
+    return 0;
+  }
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+
+  if (op->composite) {
+    // Sum of the transposes of the suboperators
+    ierr = CeedVectorSetValue(out, 0.0); CeedChk(ierr);
+    for (CeedInt i=0; i<op->numsub; i++) {
+      ierr = CeedOperatorUpdateTranspose(op->suboperators[i]); CeedChk(ierr);
+      ierr = CeedOperatorApplyAdd(op->suboperators[i]->transposeop, in, out,
+                                  i < op->numsub-1 ? CEED_REQUEST_ORDERED :
+                                  request); CeedChk(ierr);
+    }
+  } else {
+    ierr = CeedOperatorUpdateTranspose(op); CeedChk(ierr);
+    ierr = CeedOperatorApply(op->transposeop, in, out, request); CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Apply CeedOperator to several vectors
+
+  This computes the action of the operator on each of @a nvecs (active) inputs,
+  storing the results in the matching (active) outputs.  This is equivalent to
+  calling CeedOperatorApply() once per vector pair, but backends may traverse
+  the passive inputs, such as quadrature data, once for all vectors.
+
+  @param op        CeedOperator to apply
+  @param nvecs     Number of input and output vectors
+  @param[in] in    Array of @a nvecs CeedVectors containing input states
+  @param[out] out  Array of @a nvecs CeedVectors to store results of applying
+                     operator (each must be distinct from all of @a in)
+  @param request   Address of CeedRequest for non-blocking completion, else
+                     @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyMultiple(CeedOperator op, CeedInt nvecs, CeedVector *in,
+                              CeedVector *out, CeedRequest *request) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  ierr = CeedOperatorUpdateBuiltFields(op); CeedChk(ierr);
+
+  // Operations complete on return unless the backend provides a request
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
+
+  // Passive outputs hold the result for the last vector, as for repeated
+  //   CeedOperatorApply, so apply the vectors one at a time
+  bool passiveout = false;
+  CeedInt numsub = op->composite ? op->numsub : op->smoothop ? 0 : 1;
+  CeedOperator *suboperators = op->composite ? op->suboperators : &op;
+  for (CeedInt i=0; i<numsub; i++)
+    for (CeedInt j=0; j<suboperators[i]->qf->numoutputfields; j++) {
+      CeedVector vec = suboperators[i]->outputfields[j]->vec;
+      if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE)
+        passiveout = true;
+    }
+  if (passiveout) {
+    for (CeedInt v=0; v<nvecs; v++) {
+      ierr = CeedOperatorApply(op, in[v], out[v],
+                               v < nvecs-1 ? CEED_REQUEST_ORDERED : request);
+      CeedChk(ierr);
+    }
+    return 0;
+  }
+
+  // Zero all output vectors
+  for (CeedInt v=0; v<nvecs; v++)
+    if (out[v] != CEED_VECTOR_NONE) {
+      ierr = CeedVectorSetValue(out[v], 0.0); CeedChk(ierr);
+    }
+  // Apply
+  ierr = CeedOperatorApplyAddMultiple(op, nvecs, in, out, request);
+  CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Apply CeedOperator to several vectors and add results to output vectors
+
+  This is equivalent to calling CeedOperatorApplyAdd() once per vector pair,
+  but backends may traverse the passive inputs, such as quadrature data, once
+  for all vectors.
+
+  @param op        CeedOperator to apply
+  @param nvecs     Number of input and output vectors
+  @param[in] in    Array of @a nvecs CeedVectors containing input states
+  @param[out] out  Array of @a nvecs CeedVectors to sum in results of applying
+                     operator (each must be distinct from all of @a in)
+  @param request   Address of CeedRequest for non-blocking completion, else
+                     @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyAddMultiple(CeedOperator op, CeedInt nvecs,
+                                 CeedVector *in, CeedVector *out,
+                                 CeedRequest *request) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  if (op->nbc) {
+    // Constrained vectors applied one at a time
+    for (CeedInt v=0; v<nvecs; v++) {
+      ierr = CeedOperatorApplyAdd(op, in[v], out[v],
+                                  v < nvecs-1 ? CEED_REQUEST_ORDERED : request);
+      CeedChk(ierr);
+    }
+    return 0;
+  }
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  ierr = CeedOperatorUpdateBuiltFields(op); CeedChk(ierr);
+
+  // Operations complete on return unless the backend provides a request
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
+
+  // Profile operator application
+  CeedOperator prevop;
+  double start;
+  ierr = CeedProfileSetOperator(ceed, op, &prevop); CeedChk(ierr);
+  ierr = CeedProfileStart(ceed, CEED_PROFILE_OPERATOR, &start); CeedChk(ierr);
+
+  if (op->numelements) {
+    // Standard Operator
+    if (op->ApplyAddMultiple) {
+      ierr = op->ApplyAddMultiple(op, nvecs, in, out, request); CeedChk(ierr);
+    } else {
+      for (CeedInt v=0; v<nvecs; v++) {
+        ierr = op->ApplyAdd(op, in[v], out[v],
+                            v < nvecs-1 ? CEED_REQUEST_ORDERED : request);
         CeedChk(ierr);
       }
     }
+  } else if (op->smoothop) {
+    // Chebyshev smoother
+    for (CeedInt v=0; v<nvecs; v++) {
+      ierr = CeedOperatorApplyAddChebyshev(op, in[v], out[v]); CeedChk(ierr);
+    }
+  } else if (op->sharded) {
+    // Sharded Operator
+    for (CeedInt v=0; v<nvecs; v++) {
+      ierr = CeedOperatorApplyAddSharded(op, in[v], out[v]); CeedChk(ierr);
+    }
+  } else if (op->composite) {
+    // Composite Operator
+    CeedInt numsub;
+    ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
+    CeedOperator *suboperators;
+    ierr = CeedOperatorGetSubList(op, &suboperators); CeedChk(ierr);
+
+    // Only the last suboperator may return a request
+    for (CeedInt i=0; i<numsub; i++) {
+      ierr = CeedOperatorApplyAddMultiple(suboperators[i], nvecs, in, out,
+                                          i < numsub-1 ? CEED_REQUEST_ORDERED :
+                                          request);
+      CeedChk(ierr);
+    }
   }
 
+  ierr = CeedOperatorProfileStop(op, nvecs, nvecs ? out[0] : CEED_VECTOR_NONE,
+                                 start); CeedChk(ierr);
+  ierr = CeedProfileSetOperator(ceed, prevop, NULL); CeedChk(ierr);
+
   return 0;
 }
 
@@ -1626,13 +6722,15 @@ int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out,
 int CeedOperatorDestroy(CeedOperator *op) {
   int ierr;
 
-  if (!*op || --(*op)->refcount > 0) return 0;
+  if (!*op || CeedDereference(*op) > 0) return 0;
   if ((*op)->Destroy) {
     ierr = (*op)->Destroy(*op); CeedChk(ierr);
   }
   ierr = CeedDestroy(&(*op)->ceed); CeedChk(ierr);
   // Free fields
-  for (int i=0; i<(*op)->nfields; i++)
+  CeedInt numin = (*op)->qf ? (*op)->qf->numinputfields : 0;
+  CeedInt numout = (*op)->qf ? (*op)->qf->numoutputfields : 0;
+  for (int i=0; i<numin; i++)
     if ((*op)->inputfields[i]) {
       if ((*op)->inputfields[i]->Erestrict != CEED_ELEMRESTRICTION_NONE) {
         ierr = CeedElemRestrictionDestroy(&(*op)->inputfields[i]->Erestrict);
@@ -1645,10 +6743,15 @@ int CeedOperatorDestroy(CeedOperator *op) {
           (*op)->inputfields[i]->vec != CEED_VECTOR_NONE ) {
         ierr = CeedVectorDestroy(&(*op)->inputfields[i]->vec); CeedChk(ierr);
       }
+      ierr = CeedOperatorDestroy(&(*op)->inputfields[i]->buildop); CeedChk(ierr);
+      if ((*op)->inputfields[i]->buildinput != CEED_VECTOR_NONE) {
+        ierr = CeedVectorDestroy(&(*op)->inputfields[i]->buildinput);
+        CeedChk(ierr);
+      }
       ierr = CeedFree(&(*op)->inputfields[i]->fieldname); CeedChk(ierr);
       ierr = CeedFree(&(*op)->inputfields[i]); CeedChk(ierr);
     }
-  for (int i=0; i<(*op)->nfields; i++)
+  for (int i=0; i<numout; i++)
     if ((*op)->outputfields[i]) {
       ierr = CeedElemRestrictionDestroy(&(*op)->outputfields[i]->Erestrict);
       CeedChk(ierr);
@@ -1659,29 +6762,73 @@ int CeedOperatorDestroy(CeedOperator *op) {
           (*op)->outputfields[i]->vec != CEED_VECTOR_NONE ) {
         ierr = CeedVectorDestroy(&(*op)->outputfields[i]->vec); CeedChk(ierr);
       }
+      ierr = CeedVectorDestroy(&(*op)->outputfields[i]->reduction);
+      CeedChk(ierr);
       ierr = CeedFree(&(*op)->outputfields[i]->fieldname); CeedChk(ierr);
       ierr = CeedFree(&(*op)->outputfields[i]); CeedChk(ierr);
     }
   // Destroy suboperators
+  ierr = CeedCompositeOperatorDestroyFusion(*op); CeedChk(ierr);
   for (int i=0; i<(*op)->numsub; i++)
     if ((*op)->suboperators[i]) {
+      if ((*op)->sharded) {
+        ierr = CeedVectorDestroy(&(*op)->shardin[i]); CeedChk(ierr);
+        ierr = CeedVectorDestroy(&(*op)->shardout[i]); CeedChk(ierr);
+      }
       ierr = CeedOperatorDestroy(&(*op)->suboperators[i]); CeedChk(ierr);
     }
+  // Destroy smoother
+  ierr = CeedOperatorDestroy(&(*op)->smoothop); CeedChk(ierr);
+  // Destroy chain
+  ierr = CeedOperatorDestroy(&(*op)->chainops[0]); CeedChk(ierr);
+  ierr = CeedOperatorDestroy(&(*op)->chainops[1]); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*op)->chainvec); CeedChk(ierr);
+  // Destroy staging vectors
+  ierr = CeedVectorDestroy(&(*op)->stagein); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*op)->stageout); CeedChk(ierr);
+  ierr = CeedOperatorDestroy(&(*op)->transposeop); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*op)->smoothdinv); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*op)->smoothr); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*op)->smoothd); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*op)->smoothw); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*op)->qfassembled); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&(*op)->qfassembledrstr); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*op)->emat); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*op)->ematin); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*op)->ematout); CeedChk(ierr);
   ierr = CeedQFunctionDestroy(&(*op)->qf); CeedChk(ierr);
   ierr = CeedQFunctionDestroy(&(*op)->dqf); CeedChk(ierr);
   ierr = CeedQFunctionDestroy(&(*op)->dqfT); CeedChk(ierr);
+  // Destroy ensemble contexts
+  for (CeedInt k=0; k<(*op)->numensemble; k++) {
+    ierr = CeedQFunctionContextDestroy(&(*op)->ensemblectx[k]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&(*op)->ensemblectx); CeedChk(ierr);
+  ierr = CeedFree(&(*op)->ensemblestate); CeedChk(ierr);
+  // Destroy Dirichlet constraint
+  ierr = CeedFree(&(*op)->bcindices); CeedChk(ierr);
+  ierr = CeedFree(&(*op)->bcsaved); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*op)->bcvalues); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*op)->bcin); CeedChk(ierr);
 
   // Destroy fallback
-  if ((*op)->opfallback) {
-    ierr = (*op)->qffallback->Destroy((*op)->qffallback); CeedChk(ierr);
-    ierr = CeedFree(&(*op)->qffallback); CeedChk(ierr);
-    ierr = (*op)->opfallback->Destroy((*op)->opfallback); CeedChk(ierr);
-    ierr = CeedFree(&(*op)->opfallback); CeedChk(ierr);
-  }
+  ierr = CeedOperatorDestroyFallback(*op); CeedChk(ierr);
 
   ierr = CeedFree(&(*op)->inputfields); CeedChk(ierr);
   ierr = CeedFree(&(*op)->outputfields); CeedChk(ierr);
+  ierr = CeedFree(&(*op)->kernels); CeedChk(ierr);
   ierr = CeedFree(&(*op)->suboperators); CeedChk(ierr);
+  ierr = CeedFree(&(*op)->shardin); CeedChk(ierr);
+  ierr = CeedFree(&(*op)->shardout); CeedChk(ierr);
+  if ((*op)->splitops)
+    for (CeedInt s=0; s<(*op)->numsub; s++) {
+      ierr = CeedOperatorDestroy(&(*op)->splitops[s]); CeedChk(ierr);
+    }
+  ierr = CeedFree(&(*op)->splitops); CeedChk(ierr);
+  ierr = CeedFree(&(*op)->splitfirst); CeedChk(ierr);
+  ierr = CeedFree(&(*op)->orders); CeedChk(ierr);
+  ierr = CeedFree(&(*op)->orderfirst); CeedChk(ierr);
+  ierr = CeedFree(&(*op)->orderelems); CeedChk(ierr);
   ierr = CeedFree(op); CeedChk(ierr);
   return 0;
 }
@@ -38,6 +38,7 @@ const CeedQFunction CEED_QFUNCTION_NONE = &ceed_qfunction_none;
 static struct {
   char name[CEED_MAX_RESOURCE_LEN];
   char source[CEED_MAX_RESOURCE_LEN];
+  const char *code;
   CeedInt vlength;
   CeedQFunctionUser f;
   int (*init)(Ceed ceed, const char *name, CeedQFunction qf);
@@ -57,6 +58,8 @@ static size_t num_qfunctions;
   @param name     Name for this backend to respond to
   @param source   Absolute path to source of QFunction,
                     "\path\CEED_DIR\gallery\folder\file.h:function_name"
+  @param code     Contents of the source file, embedded at build time, or NULL
+                    to have JIT backends read the source file
   @param vlength  Vector length.  Caller must ensure that number of quadrature
                     points is a multiple of vlength.
   @param f        Function pointer to evaluate action at quadrature points.
@@ -69,7 +72,7 @@ static size_t num_qfunctions;
   @ref Developer
 **/
 int CeedQFunctionRegister(const char *name, const char *source,
-                          CeedInt vlength, CeedQFunctionUser f,
+                          const char *code, CeedInt vlength, CeedQFunctionUser f,
                           int (*init)(Ceed, const char *, CeedQFunction)) {
   if (num_qfunctions >= sizeof(qfunctions) / sizeof(qfunctions[0]))
     // LCOV_EXCL_START
@@ -80,6 +83,7 @@ int CeedQFunctionRegister(const char *name, const char *source,
   qfunctions[num_qfunctions].name[CEED_MAX_RESOURCE_LEN-1] = 0;
   strncpy(qfunctions[num_qfunctions].source, source, CEED_MAX_RESOURCE_LEN);
   qfunctions[num_qfunctions].source[CEED_MAX_RESOURCE_LEN-1] = 0;
+  qfunctions[num_qfunctions].code = code;
   qfunctions[num_qfunctions].vlength = vlength;
   qfunctions[num_qfunctions].f = f;
   qfunctions[num_qfunctions].init = init;
@@ -159,6 +163,65 @@ int CeedQFunctionSetFortranStatus(CeedQFunction qf, bool status) {
   return 0;
 }
 
+/**
+  @brief Create a CeedQFunction for evaluating interior terms, with optional
+           source code for JIT backends
+
+  @param ceed       A Ceed object where the CeedQFunction will be created
+  @param vlength    Vector length
+  @param f          Function pointer to evaluate action at quadrature points
+  @param source     Absolute path to source of QFunction,
+                      "\abs_path\file.h:function_name"
+  @param code       Contents of the source file, or NULL
+  @param[out] qf    Address of the variable where the newly created
+                      CeedQFunction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedQFunctionCreateInterior_Core(Ceed ceed, CeedInt vlength,
+    CeedQFunctionUser f, const char *source, const char *code,
+    CeedQFunction *qf) {
+  int ierr;
+  char *source_copy;
+
+  if (!ceed->QFunctionCreate) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(ceed, &delegate, "QFunction"); CeedChk(ierr);
+
+    if (!delegate)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Backend does not support QFunctionCreate");
+    // LCOV_EXCL_STOP
+
+    ierr = CeedQFunctionCreateInterior_Core(delegate, vlength, f, source, code,
+                                            qf); CeedChk(ierr);
+    return 0;
+  }
+
+  ierr = CeedCalloc(1, qf); CeedChk(ierr);
+  (*qf)->ceed = ceed;
+  CeedReference(ceed);
+  (*qf)->refcount = 1;
+  (*qf)->vlength = vlength;
+  (*qf)->identity = 0;
+  (*qf)->function = f;
+  size_t slen = strlen(source) + 1;
+  ierr = CeedMalloc(slen, &source_copy); CeedChk(ierr);
+  memcpy(source_copy, source, slen);
+  (*qf)->sourcepath = source_copy;
+  if (code) {
+    char *code_copy;
+    slen = strlen(code) + 1;
+    ierr = CeedMalloc(slen, &code_copy); CeedChk(ierr);
+    memcpy(code_copy, code, slen);
+    (*qf)->sourcecode = code_copy;
+  }
+  ierr = ceed->QFunctionCreate(*qf); CeedChk(ierr);
+  return 0;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -230,6 +293,25 @@ int CeedQFunctionGetSourcePath(CeedQFunction qf, char **source) {
   return 0;
 }
 
+/**
+  @brief Get the source code of a CeedQFunction, if it was provided on creation
+
+  JIT backends compile this source, if available, instead of reading the file
+    given by CeedQFunctionGetSourcePath().
+
+  @param qf              CeedQFunction
+  @param[out] code       Variable to store source code string, or NULL if
+                           the source must be read from the source path
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionGetSourceCode(CeedQFunction qf, const char **code) {
+  *code = qf->sourcecode;
+  return 0;
+}
+
 /**
   @brief Get the User Function for a CeedQFunction
 
@@ -336,6 +418,43 @@ int CeedQFunctionSetData(CeedQFunction qf, void *data) {
   return 0;
 }
 
+/**
+  @brief Apply the action of a CeedQFunction to raw host arrays
+
+  Backends use this inside operator element loops, where the Q-point data of
+    each field is addressed directly rather than through a CeedVector whose
+    array would be reset for every element.
+
+  @param qf      CeedQFunction
+  @param Q       Number of quadrature points
+  @param[in] u   Array of input host arrays, one per input field
+  @param[out] v  Array of output host arrays, one per output field
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionApplyRaw(CeedQFunction qf, CeedInt Q,
+                          const CeedScalar *const *u, CeedScalar *const *v) {
+  int ierr;
+  if (!qf->ApplyRaw)
+    // LCOV_EXCL_START
+    return CeedError(qf->ceed, 1, "Backend does not support QFunctionApplyRaw");
+  // LCOV_EXCL_STOP
+  if (Q % qf->vlength)
+    // LCOV_EXCL_START
+    return CeedError(qf->ceed, 2, "Number of quadrature points %d must be a "
+                     "multiple of %d", Q, qf->vlength);
+  // LCOV_EXCL_STOP
+  double start;
+  ierr = CeedProfileStart(qf->ceed, CEED_PROFILE_QFUNCTION, &start);
+  CeedChk(ierr);
+  ierr = qf->ApplyRaw(qf, Q, u, v); CeedChk(ierr);
+  ierr = CeedProfileStopFlops(qf->ceed, CEED_PROFILE_QFUNCTION, start, 0,
+                              (double)Q*qf->userflops); CeedChk(ierr);
+  return 0;
+}
+
 /**
   @brief Get the CeedQFunctionFields of a CeedQFunction
 
@@ -402,6 +521,79 @@ int CeedQFunctionFieldGetEvalMode(CeedQFunctionField qffield,
   return 0;
 }
 
+/**
+  @brief Create a copy of a CeedQFunction on another Ceed
+
+  The user function, source, fields, and a copy of the context are used to
+    create the new CeedQFunction. If @a qf belongs to @a ceed or one of its
+    delegates, @a qf is referenced instead.
+
+  @param qf          CeedQFunction to copy
+  @param ceed        Ceed to create the new CeedQFunction on
+  @param[out] qfnew  Address of the variable where the newly created
+                       CeedQFunction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionCreateOnCeed(CeedQFunction qf, Ceed ceed,
+                              CeedQFunction *qfnew) {
+  int ierr;
+  Ceed parent, qfparent;
+
+  *qfnew = qf;
+  if (!qf || qf == CEED_QFUNCTION_NONE)
+    return 0;
+  ierr = CeedGetParent(ceed, &parent); CeedChk(ierr);
+  ierr = CeedGetParent(qf->ceed, &qfparent); CeedChk(ierr);
+  if (parent == qfparent) {
+    CeedReference(qf);
+    return 0;
+  }
+  if (qf->fortranstatus)
+    // LCOV_EXCL_START
+    return CeedError(qf->ceed, 1, "Cannot copy a Fortran QFunction to "
+                     "another Ceed");
+  // LCOV_EXCL_STOP
+
+  // Gallery QFunctions add their own fields
+  CeedInt numinput = 0, numoutput = 0;
+  if (qf->qfname) {
+    ierr = CeedQFunctionCreateInteriorByName(ceed, qf->qfname, qfnew);
+    CeedChk(ierr);
+    numinput = (*qfnew)->numinputfields;
+    numoutput = (*qfnew)->numoutputfields;
+  } else {
+    ierr = CeedQFunctionCreateInterior_Core(ceed, qf->vlength, qf->function,
+                                            qf->sourcepath, qf->sourcecode,
+                                            qfnew); CeedChk(ierr);
+  }
+  for (CeedInt i=numinput; i<qf->numinputfields; i++) {
+    ierr = CeedQFunctionAddInput(*qfnew, qf->inputfields[i]->fieldname,
+                                 qf->inputfields[i]->size,
+                                 qf->inputfields[i]->emode); CeedChk(ierr);
+  }
+  for (CeedInt i=numoutput; i<qf->numoutputfields; i++) {
+    ierr = CeedQFunctionAddOutput(*qfnew, qf->outputfields[i]->fieldname,
+                                  qf->outputfields[i]->size,
+                                  qf->outputfields[i]->emode); CeedChk(ierr);
+  }
+  (*qfnew)->identity = qf->identity;
+  (*qfnew)->userflops = qf->userflops;
+
+  // Context
+  if (qf->ctx) {
+    CeedQFunctionContext ctx;
+    ierr = CeedQFunctionContextDestroy(&(*qfnew)->ctx); CeedChk(ierr);
+    ierr = CeedQFunctionContextCreateOnCeed(qf->ctx, ceed, &ctx);
+    CeedChk(ierr);
+    ierr = CeedQFunctionSetContext(*qfnew, ctx); CeedChk(ierr);
+    ierr = CeedQFunctionContextDestroy(&ctx); CeedChk(ierr);
+  }
+  return 0;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -435,36 +627,51 @@ int CeedQFunctionFieldGetEvalMode(CeedQFunctionField qffield,
 int CeedQFunctionCreateInterior(Ceed ceed, CeedInt vlength, CeedQFunctionUser f,
                                 const char *source, CeedQFunction *qf) {
   int ierr;
-  char *source_copy;
+  ierr = CeedQFunctionCreateInterior_Core(ceed, vlength, f, source, NULL, qf);
+  CeedChk(ierr);
+  return 0;
+}
 
-  if (!ceed->QFunctionCreate) {
-    Ceed delegate;
-    ierr = CeedGetObjectDelegate(ceed, &delegate, "QFunction"); CeedChk(ierr);
+/**
+  @brief Create a CeedQFunction for evaluating interior (volumetric) terms,
+           providing the contents of its source file.
 
-    if (!delegate)
-      // LCOV_EXCL_START
-      return CeedError(ceed, 1, "Backend does not support QFunctionCreate");
-    // LCOV_EXCL_STOP
+  JIT backends, such as /gpu/cuda/\* and /gpu/hip/\*, compile @a code instead
+    of reading the source file at runtime. This avoids opening the same file
+    from every process of a parallel job. The contents can be embedded when
+    building the application, for example by converting the header into a
+    string literal that is included with `#include`, as is done for the
+    gallery QFunctions.
 
-    ierr = CeedQFunctionCreateInterior(delegate, vlength, f, source, qf);
-    CeedChk(ierr);
-    return 0;
-  }
+  @param ceed       A Ceed object where the CeedQFunction will be created
+  @param vlength    Vector length. Caller must ensure that number of quadrature
+                      points is a multiple of vlength.
+  @param f          Function pointer to evaluate action at quadrature points.
+                      See \ref CeedQFunctionUser.
+  @param source     Path to source of QFunction and name of the function,
+                      "\abs_path\file.h:function_name". The path is only used
+                      to identify the QFunction.
+  @param code       Contents of the source file, which must only contain
+                      constructs supported by C99, C++11, and CUDA
+  @param[out] qf    Address of the variable where the newly created
+                      CeedQFunction will be stored
 
-  ierr = CeedCalloc(1, qf); CeedChk(ierr);
-  (*qf)->ceed = ceed;
-  ceed->refcount++;
-  (*qf)->refcount = 1;
-  (*qf)->vlength = vlength;
-  (*qf)->identity = 0;
-  (*qf)->function = f;
-  size_t slen = strlen(source) + 1;
-  ierr = CeedMalloc(slen, &source_copy); CeedChk(ierr);
-  memcpy(source_copy, source, slen);
-  (*qf)->sourcepath = source_copy;
-  ierr = CeedCalloc(16, &(*qf)->inputfields); CeedChk(ierr);
-  ierr = CeedCalloc(16, &(*qf)->outputfields); CeedChk(ierr);
-  ierr = ceed->QFunctionCreate(*qf); CeedChk(ierr);
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionCreateInteriorWithSource(Ceed ceed, CeedInt vlength,
+    CeedQFunctionUser f, const char *source, const char *code,
+    CeedQFunction *qf) {
+  int ierr;
+  if (!strchr(source, ':'))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "QFunction source must be given as "
+                     "path:function_name");
+  // LCOV_EXCL_STOP
+
+  ierr = CeedQFunctionCreateInterior_Core(ceed, vlength, f, source, code, qf);
+  CeedChk(ierr);
   return 0;
 }
 
@@ -503,9 +710,10 @@ int CeedQFunctionCreateInteriorByName(Ceed ceed,  const char *name,
   // LCOV_EXCL_STOP
 
   // Create QFunction
-  ierr = CeedQFunctionCreateInterior(ceed, qfunctions[matchidx].vlength,
-                                     qfunctions[matchidx].f,
-                                     qfunctions[matchidx].source, qf);
+  ierr = CeedQFunctionCreateInterior_Core(ceed, qfunctions[matchidx].vlength,
+                                          qfunctions[matchidx].f,
+                                          qfunctions[matchidx].source,
+                                          qfunctions[matchidx].code, qf);
   CeedChk(ierr);
 
   // QFunction specific setup
@@ -586,9 +794,11 @@ int CeedQFunctionCreateIdentity(Ceed ceed, CeedInt size, CeedEvalMode inmode,
 **/
 int CeedQFunctionAddInput(CeedQFunction qf, const char *fieldname, CeedInt size,
                           CeedEvalMode emode) {
-  int ierr = CeedQFunctionFieldSet(&qf->inputfields[qf->numinputfields],
-                                   fieldname, size, emode);
-  CeedChk(ierr);
+  int ierr;
+
+  ierr = CeedRealloc(qf->numinputfields + 1, &qf->inputfields); CeedChk(ierr);
+  ierr = CeedQFunctionFieldSet(&qf->inputfields[qf->numinputfields],
+                               fieldname, size, emode); CeedChk(ierr);
   qf->numinputfields++;
   return 0;
 }
@@ -615,9 +825,12 @@ int CeedQFunctionAddOutput(CeedQFunction qf, const char *fieldname,
     return CeedError(qf->ceed, 1, "Cannot create QFunction output with "
                      "CEED_EVAL_WEIGHT");
   // LCOV_EXCL_STOP
-  int ierr = CeedQFunctionFieldSet(&qf->outputfields[qf->numoutputfields],
-                                   fieldname, size, emode);
+  int ierr;
+
+  ierr = CeedRealloc(qf->numoutputfields + 1, &qf->outputfields);
   CeedChk(ierr);
+  ierr = CeedQFunctionFieldSet(&qf->outputfields[qf->numoutputfields],
+                               fieldname, size, emode); CeedChk(ierr);
   qf->numoutputfields++;
   return 0;
 }
@@ -634,7 +847,41 @@ int CeedQFunctionAddOutput(CeedQFunction qf, const char *fieldname,
 **/
 int CeedQFunctionSetContext(CeedQFunction qf, CeedQFunctionContext ctx) {
   qf->ctx = ctx;
-  ctx->refcount++;
+  CeedReference(ctx);
+  return 0;
+}
+
+/**
+  @brief Set the number of flops a CeedQFunction performs per quadrature point
+
+  The estimate is used by CeedOperatorGetFlopsEstimate() and by the profile
+    report, since the flops of user code are not known to libCEED.
+
+  @param qf     CeedQFunction
+  @param flops  Flops per quadrature point
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionSetUserFlopsEstimate(CeedQFunction qf, size_t flops) {
+  qf->userflops = flops;
+  return 0;
+}
+
+/**
+  @brief Get the number of flops a CeedQFunction performs per quadrature point
+
+  @param qf          CeedQFunction
+  @param[out] flops  Variable to store the flops per quadrature point, 0 if
+                       not set with CeedQFunctionSetUserFlopsEstimate()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionGetUserFlopsEstimate(CeedQFunction qf, size_t *flops) {
+  *flops = qf->userflops;
   return 0;
 }
 
@@ -694,7 +941,12 @@ int CeedQFunctionApply(CeedQFunction qf, CeedInt Q,
     return CeedError(qf->ceed, 2, "Number of quadrature points %d must be a "
                      "multiple of %d", Q, qf->vlength);
   // LCOV_EXCL_STOP
+  double start;
+  ierr = CeedProfileStart(qf->ceed, CEED_PROFILE_QFUNCTION, &start);
+  CeedChk(ierr);
   ierr = qf->Apply(qf, Q, u, v); CeedChk(ierr);
+  ierr = CeedProfileStopFlops(qf->ceed, CEED_PROFILE_QFUNCTION, start, 0,
+                              (double)Q*qf->userflops); CeedChk(ierr);
   return 0;
 }
 
@@ -710,7 +962,7 @@ int CeedQFunctionApply(CeedQFunction qf, CeedInt Q,
 int CeedQFunctionDestroy(CeedQFunction *qf) {
   int ierr;
 
-  if (!*qf || --(*qf)->refcount > 0) return 0;
+  if (!*qf || CeedDereference(*qf) > 0) return 0;
   // Backend destroy
   if ((*qf)->Destroy) {
     ierr = (*qf)->Destroy(*qf); CeedChk(ierr);
@@ -731,6 +983,7 @@ int CeedQFunctionDestroy(CeedQFunction *qf) {
   ierr = CeedQFunctionContextDestroy(&(*qf)->ctx); CeedChk(ierr);
 
   ierr = CeedFree(&(*qf)->sourcepath); CeedChk(ierr);
+  ierr = CeedFree(&(*qf)->sourcecode); CeedChk(ierr);
   ierr = CeedFree(&(*qf)->qfname); CeedChk(ierr);
   ierr = CeedDestroy(&(*qf)->ceed); CeedChk(ierr);
   ierr = CeedFree(qf); CeedChk(ierr);
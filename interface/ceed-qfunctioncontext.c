@@ -17,10 +17,129 @@
 #include <ceed-impl.h>
 #include <ceed-backend.h>
 #include <limits.h>
+#include <string.h>
 
 /// @file
 /// Implementation of public CeedQFunctionContext interfaces
 
+/// ----------------------------------------------------------------------------
+/// CeedQFunctionContext Library Internal Functions
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedQFunctionDeveloper
+/// @{
+
+/**
+  @brief Register a named field of a CeedQFunctionContext
+
+  @param ctx               CeedQFunctionContext
+  @param fieldname         Name of field to register
+  @param fieldoffset       Offset of field in the context data, in bytes
+  @param numvalues         Number of values in the field
+  @param fielddescription  Description of the field, or NULL
+  @param fieldtype         Type of the field values
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedQFunctionContextRegisterGeneric(CeedQFunctionContext ctx,
+    const char *fieldname, size_t fieldoffset, size_t numvalues,
+    const char *fielddescription, CeedContextFieldType fieldtype) {
+  int ierr;
+
+  for (CeedInt i=0; i<ctx->numfields; i++)
+    if (!strcmp(ctx->fields[i].name, fieldname))
+      // LCOV_EXCL_START
+      return CeedError(ctx->ceed, 1, "QFunctionContext field '%s' is already "
+                       "registered", fieldname);
+  // LCOV_EXCL_STOP
+  const size_t size = fieldtype == CEED_CONTEXT_FIELD_DOUBLE ?
+                      sizeof(double) : sizeof(int);
+  if (ctx->ctxsize && fieldoffset + numvalues*size > ctx->ctxsize)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, 1, "QFunctionContext field '%s' extends past "
+                     "the %zd bytes of context data", fieldname, ctx->ctxsize);
+  // LCOV_EXCL_STOP
+
+  ierr = CeedRealloc(ctx->numfields + 1, &ctx->fields); CeedChk(ierr);
+  CeedContextFieldDescription *field = &ctx->fields[ctx->numfields];
+  size_t len = strlen(fieldname);
+  ierr = CeedCalloc(len + 1, &field->name); CeedChk(ierr);
+  memcpy(field->name, fieldname, len + 1);
+  field->description = NULL;
+  if (fielddescription) {
+    len = strlen(fielddescription);
+    ierr = CeedCalloc(len + 1, &field->description); CeedChk(ierr);
+    memcpy(field->description, fielddescription, len + 1);
+  }
+  field->type = fieldtype;
+  field->offset = fieldoffset;
+  field->numvalues = numvalues;
+  ctx->numfields++;
+  return 0;
+}
+
+/**
+  @brief Set the values of a named field of a CeedQFunctionContext
+
+  Backends with a SetField implementation update the field in the memory type
+    that holds the current data, such as device memory after an apply, without
+    invalidating or copying the rest of the context.
+
+  @param ctx        CeedQFunctionContext
+  @param fieldname  Name of field to set
+  @param fieldtype  Type of the field values
+  @param values     Values to set
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedQFunctionContextSetGeneric(CeedQFunctionContext ctx,
+    const char *fieldname, CeedContextFieldType fieldtype,
+    const void *values) {
+  int ierr;
+
+  CeedContextFieldDescription *field = NULL;
+  for (CeedInt i=0; i<ctx->numfields; i++)
+    if (!strcmp(ctx->fields[i].name, fieldname))
+      field = &ctx->fields[i];
+  if (!field)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, 1, "QFunctionContext has no field '%s'",
+                     fieldname);
+  // LCOV_EXCL_STOP
+  if (field->type != fieldtype)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, 1, "QFunctionContext field '%s' has type %s, "
+                     "not %s", fieldname, CeedContextFieldTypes[field->type],
+                     CeedContextFieldTypes[fieldtype]);
+  // LCOV_EXCL_STOP
+  if (ctx->state % 2 == 1)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, 1,
+                     "Cannot set CeedQFunctionContext field, the "
+                     "access lock is already in use");
+  // LCOV_EXCL_STOP
+
+  const size_t valuesize = fieldtype == CEED_CONTEXT_FIELD_DOUBLE ?
+                           sizeof(double) : sizeof(int),
+               bytes = field->numvalues*valuesize;
+  if (ctx->SetField) {
+    ierr = ctx->SetField(ctx, field->offset, bytes, values); CeedChk(ierr);
+    ctx->state += 2;
+  } else {
+    char *data;
+    ierr = CeedQFunctionContextGetData(ctx, CEED_MEM_HOST, &data);
+    CeedChk(ierr);
+    memcpy(data + field->offset, values, bytes);
+    ierr = CeedQFunctionContextRestoreData(ctx, &data); CeedChk(ierr);
+  }
+  return 0;
+}
+
+/// @}
+
 /// ----------------------------------------------------------------------------
 /// CeedQFunctionContext Backend API
 /// ----------------------------------------------------------------------------
@@ -103,6 +222,79 @@ int CeedQFunctionContextSetBackendData(CeedQFunctionContext ctx, void *data) {
   return 0;
 }
 
+/**
+  @brief Account for memory allocated or freed by the backend for a
+           CeedQFunctionContext
+
+  Bytes still accounted when the CeedQFunctionContext is destroyed are
+    released, so backends only need to report memory freed during the life of
+    the object.
+
+  @param ctx    CeedQFunctionContext owning the memory
+  @param space  CeedMemSpace of the allocation
+  @param bytes  Number of bytes allocated, negative for bytes freed
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionContextTrackMemory(CeedQFunctionContext ctx,
+                                    CeedMemSpace space, ptrdiff_t bytes) {
+  int ierr;
+
+  ctx->memusage[space] += bytes;
+  ierr = CeedTrackMemory(ctx->ceed, CEED_MEMORY_CONTEXT, space, bytes);
+  CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Create a copy of a CeedQFunctionContext on another Ceed
+
+  The context data and the registered fields are copied. If @a ctx belongs
+    to @a ceed or one of its delegates, @a ctx is referenced instead.
+
+  @param ctx          CeedQFunctionContext to copy
+  @param ceed         Ceed to create the new CeedQFunctionContext on
+  @param[out] ctxnew  Address of the variable where the newly created
+                        CeedQFunctionContext will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionContextCreateOnCeed(CeedQFunctionContext ctx, Ceed ceed,
+                                     CeedQFunctionContext *ctxnew) {
+  int ierr;
+  Ceed parent, ctxparent;
+
+  ierr = CeedGetParent(ceed, &parent); CeedChk(ierr);
+  ierr = CeedGetParent(ctx->ceed, &ctxparent); CeedChk(ierr);
+  if (parent == ctxparent) {
+    CeedReference(ctx);
+    *ctxnew = ctx;
+    return 0;
+  }
+
+  ierr = CeedQFunctionContextCreate(ceed, ctxnew); CeedChk(ierr);
+  if (ctx->ctxsize) {
+    void *data;
+    ierr = CeedQFunctionContextGetData(ctx, CEED_MEM_HOST, &data);
+    CeedChk(ierr);
+    ierr = CeedQFunctionContextSetData(*ctxnew, CEED_MEM_HOST,
+                                       CEED_COPY_VALUES, ctx->ctxsize, data);
+    CeedChk(ierr);
+    ierr = CeedQFunctionContextRestoreData(ctx, &data); CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<ctx->numfields; i++) {
+    CeedContextFieldDescription *field = &ctx->fields[i];
+    ierr = CeedQFunctionContextRegisterGeneric(*ctxnew, field->name,
+           field->offset, field->numvalues, field->description, field->type);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -140,7 +332,7 @@ int CeedQFunctionContextCreate(Ceed ceed, CeedQFunctionContext *ctx) {
 
   ierr = CeedCalloc(1, ctx); CeedChk(ierr);
   (*ctx)->ceed = ceed;
-  ceed->refcount++;
+  CeedReference(ceed);
   (*ctx)->refcount = 1;
   ierr = ceed->QFunctionContextCreate(*ctx); CeedChk(ierr);
   return 0;
@@ -166,6 +358,12 @@ int CeedQFunctionContextSetData(CeedQFunctionContext ctx, CeedMemType mtype,
                                 size_t size, void *data) {
   int ierr;
 
+  if (mtype == CEED_MEM_UNIFIED)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, 1, "CEED_MEM_UNIFIED is only supported "
+                     "for CeedVector");
+  // LCOV_EXCL_STOP
+
   if (!ctx->SetData)
     // LCOV_EXCL_START
     return CeedError(ctx->ceed, 1, "Backend does not support ContextSetData");
@@ -206,6 +404,12 @@ int CeedQFunctionContextGetData(CeedQFunctionContext ctx, CeedMemType mtype,
                                 void *data) {
   int ierr;
 
+  if (mtype == CEED_MEM_UNIFIED)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, 1, "CEED_MEM_UNIFIED is only supported "
+                     "for CeedVector");
+  // LCOV_EXCL_STOP
+
   if (!ctx->GetData)
     // LCOV_EXCL_START
     return CeedError(ctx->ceed, 1, "Backend does not support GetData");
@@ -256,6 +460,108 @@ int CeedQFunctionContextRestoreData(CeedQFunctionContext ctx, void *data) {
   return 0;
 }
 
+/**
+  @brief Register a named field of double precision values in a
+           CeedQFunctionContext, to be set with
+           @ref CeedQFunctionContextSetDouble()
+
+  @param ctx               CeedQFunctionContext
+  @param fieldname         Name of field to register
+  @param fieldoffset       Offset of field in the context data, in bytes
+  @param numvalues         Number of values in the field
+  @param fielddescription  Description of the field, or NULL
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionContextRegisterDouble(CeedQFunctionContext ctx,
+                                       const char *fieldname,
+                                       size_t fieldoffset, size_t numvalues,
+                                       const char *fielddescription) {
+  return CeedQFunctionContextRegisterGeneric(ctx, fieldname, fieldoffset,
+         numvalues, fielddescription, CEED_CONTEXT_FIELD_DOUBLE);
+}
+
+/**
+  @brief Register a named field of 32 bit integer values in a
+           CeedQFunctionContext, to be set with
+           @ref CeedQFunctionContextSetInt32()
+
+  @param ctx               CeedQFunctionContext
+  @param fieldname         Name of field to register
+  @param fieldoffset       Offset of field in the context data, in bytes
+  @param numvalues         Number of values in the field
+  @param fielddescription  Description of the field, or NULL
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionContextRegisterInt32(CeedQFunctionContext ctx,
+                                      const char *fieldname,
+                                      size_t fieldoffset, size_t numvalues,
+                                      const char *fielddescription) {
+  return CeedQFunctionContextRegisterGeneric(ctx, fieldname, fieldoffset,
+         numvalues, fielddescription, CEED_CONTEXT_FIELD_INT32);
+}
+
+/**
+  @brief Set the values of a registered double precision field of a
+           CeedQFunctionContext
+
+  Only the field is updated; on GPU backends, a context already on the device
+    is updated there with a small asynchronous copy.
+
+  @param ctx        CeedQFunctionContext
+  @param fieldname  Name of field to set
+  @param values     Values to set, as many as registered for the field
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionContextSetDouble(CeedQFunctionContext ctx,
+                                  const char *fieldname, const double *values) {
+  return CeedQFunctionContextSetGeneric(ctx, fieldname,
+                                        CEED_CONTEXT_FIELD_DOUBLE, values);
+}
+
+/**
+  @brief Set the values of a registered 32 bit integer field of a
+           CeedQFunctionContext
+
+  @param ctx        CeedQFunctionContext
+  @param fieldname  Name of field to set
+  @param values     Values to set, as many as registered for the field
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionContextSetInt32(CeedQFunctionContext ctx,
+                                 const char *fieldname, const int *values) {
+  return CeedQFunctionContextSetGeneric(ctx, fieldname,
+                                        CEED_CONTEXT_FIELD_INT32, values);
+}
+
+/**
+  @brief Get the memory allocated for the data of a CeedQFunctionContext
+
+  @param ctx         CeedQFunctionContext to retrieve memory usage
+  @param space       CeedMemSpace to get the usage of
+  @param[out] bytes  Variable to store the number of bytes allocated
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionContextGetMemoryUsage(CeedQFunctionContext ctx,
+                                       CeedMemSpace space, size_t *bytes) {
+  *bytes = ctx->memusage[space];
+  return 0;
+}
+
 /**
   @brief View a CeedQFunctionContext
 
@@ -269,6 +575,11 @@ int CeedQFunctionContextRestoreData(CeedQFunctionContext ctx, void *data) {
 int CeedQFunctionContextView(CeedQFunctionContext ctx, FILE *stream) {
   fprintf(stream, "CeedQFunctionContext\n");
   fprintf(stream, "  Context Data Size: %ld\n", ctx->ctxsize);
+  for (CeedInt i=0; i<ctx->numfields; i++)
+    fprintf(stream, "  Labeled %s field: %s%s%s\n",
+            CeedContextFieldTypes[ctx->fields[i].type], ctx->fields[i].name,
+            ctx->fields[i].description ? " - " : "",
+            ctx->fields[i].description ? ctx->fields[i].description : "");
   return 0;
 }
 
@@ -284,7 +595,7 @@ int CeedQFunctionContextView(CeedQFunctionContext ctx, FILE *stream) {
 int CeedQFunctionContextDestroy(CeedQFunctionContext *ctx) {
   int ierr;
 
-  if (!*ctx || --(*ctx)->refcount > 0)
+  if (!*ctx || CeedDereference(*ctx) > 0)
     return 0;
 
   if ((*ctx) && ((*ctx)->state % 2) == 1)
@@ -297,7 +608,16 @@ int CeedQFunctionContextDestroy(CeedQFunctionContext *ctx) {
   if ((*ctx)->Destroy) {
     ierr = (*ctx)->Destroy(*ctx); CeedChk(ierr);
   }
+  for (CeedInt s=0; s<CEED_MEMSPACE_NUM; s++) {
+    const ptrdiff_t bytes = (*ctx)->memusage[s];
+    ierr = CeedQFunctionContextTrackMemory(*ctx, s, -bytes); CeedChk(ierr);
+  }
 
+  for (CeedInt i=0; i<(*ctx)->numfields; i++) {
+    ierr = CeedFree(&(*ctx)->fields[i].name); CeedChk(ierr);
+    ierr = CeedFree(&(*ctx)->fields[i].description); CeedChk(ierr);
+  }
+  ierr = CeedFree(&(*ctx)->fields); CeedChk(ierr);
   ierr = CeedDestroy(&(*ctx)->ceed); CeedChk(ierr);
   ierr = CeedFree(ctx); CeedChk(ierr);
   return 0;
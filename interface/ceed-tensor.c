@@ -60,7 +60,7 @@ int CeedTensorContractCreate(Ceed ceed, CeedBasis basis,
   ierr = CeedCalloc(1,contract); CeedChk(ierr);
 
   (*contract)->ceed = ceed;
-  ceed->refcount++;
+  CeedReference(ceed);
   ierr = ceed->TensorContractCreate(basis, *contract);
   CeedChk(ierr);
   return 0;
@@ -102,6 +102,66 @@ int CeedTensorContractApply(CeedTensorContract contract, CeedInt A, CeedInt B,
   return 0;
 }
 
+/**
+  @brief Apply tensor contractions in every dimension of a tensor product basis
+
+    Contracts u, of shape [ncomp, P^dim, nelem], in each of the dim directions,
+    giving v of shape [ncomp, Q^dim, nelem]. Backends may provide a fused
+    kernel keeping the intermediate values of each component in cache;
+    otherwise the contractions are applied one dimension at a time with
+    CeedTensorContractApply.
+
+  @param contract   CeedTensorContract to use
+  @param dim        Dimension of the basis
+  @param ncomp      Number of components
+  @param P          Input size in each direction
+  @param Q          Output size in each direction
+  @param nelem      Number of elements, the last index of u and v
+  @param[in] t      Array of dim Q by P tensors, one for each direction, in the
+                      order they are contracted against
+  @param tmode      Transpose mode for each t, as in CeedTensorContractApply
+  @param add        Add mode
+  @param[in] u      Input array
+  @param[out] v     Output array
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedTensorContractApplyFull(CeedTensorContract contract, CeedInt dim,
+                                CeedInt ncomp, CeedInt P, CeedInt Q,
+                                CeedInt nelem, const CeedScalar *const *t,
+                                CeedTransposeMode tmode, const CeedInt add,
+                                const CeedScalar *restrict u,
+                                CeedScalar *restrict v) {
+  int ierr;
+
+  if (contract->ApplyFull) {
+    ierr = contract->ApplyFull(contract, dim, ncomp, P, Q, nelem, t, tmode, add,
+                               u, v); CeedChk(ierr);
+    return 0;
+  }
+
+  // One dimension at a time, for each component
+  const CeedInt usize = CeedIntPow(P, dim)*nelem;
+  const CeedInt vsize = CeedIntPow(Q, dim)*nelem;
+  CeedScalar tmp[2][CeedPadLength(nelem*Q*CeedIntPow(P>Q?P:Q, dim-1))]
+  CEED_ALIGNED;
+  for (CeedInt c=0; c<ncomp; c++) {
+    CeedInt pre = CeedIntPow(P, dim-1), post = nelem;
+    for (CeedInt d=0; d<dim; d++) {
+      ierr = contract->Apply(contract, pre, P, post, Q, t[d], tmode,
+                             add&&(d==dim-1),
+                             d==0 ? &u[c*usize] : tmp[d%2],
+                             d==dim-1 ? &v[c*vsize] : tmp[(d+1)%2]);
+      CeedChk(ierr);
+      pre /= P;
+      post *= Q;
+    }
+  }
+  return 0;
+}
+
 /**
   @brief Get Ceed associated with a CeedTensorContract
 
@@ -159,7 +219,7 @@ int CeedTensorContractSetData(CeedTensorContract contract, void *data) {
 int CeedTensorContractDestroy(CeedTensorContract *contract) {
   int ierr;
 
-  if (!*contract || --(*contract)->refcount > 0) return 0;
+  if (!*contract || CeedDereference(*contract) > 0) return 0;
   if ((*contract)->Destroy) {
     ierr = (*contract)->Destroy(*contract); CeedChk(ierr);
   }
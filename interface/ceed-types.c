@@ -19,6 +19,29 @@
 const char *const CeedMemTypes[] = {
   [CEED_MEM_HOST] = "host",
   [CEED_MEM_DEVICE] = "device",
+  [CEED_MEM_UNIFIED] = "unified",
+};
+
+const char *const CeedMemSpaces[] = {
+  [CEED_MEMSPACE_HOST] = "host",
+  [CEED_MEMSPACE_DEVICE] = "device",
+  [CEED_MEMSPACE_PINNED] = "pinned",
+};
+
+const char *const CeedSyncAuditModes[] = {
+  [CEED_SYNC_AUDIT_NONE] = "none",
+  [CEED_SYNC_AUDIT_LOG] = "log",
+  [CEED_SYNC_AUDIT_ERROR] = "error",
+};
+
+const char *const CeedMemoryClasses[] = {
+  [CEED_MEMORY_VECTOR] = "CeedVector",
+  [CEED_MEMORY_QDATA] = "qdata",
+  [CEED_MEMORY_EVECTOR] = "E-vectors",
+  [CEED_MEMORY_ASSEMBLED] = "assembled",
+  [CEED_MEMORY_RESTRICTION] = "CeedElemRestriction",
+  [CEED_MEMORY_BASIS] = "CeedBasis",
+  [CEED_MEMORY_CONTEXT] = "CeedQFunctionContext",
 };
 
 const char *const CeedCopyModes[] = {
@@ -27,11 +50,44 @@ const char *const CeedCopyModes[] = {
   [CEED_OWN_POINTER] = "own pointer",
 };
 
+const char *const CeedReduceTypes[] = {
+  [CEED_REDUCE_SUM] = "sum",
+  [CEED_REDUCE_MAX] = "max",
+  [CEED_REDUCE_MIN] = "min",
+};
+
 const char *const CeedTransposeModes[] = {
   [CEED_TRANSPOSE] = "transpose",
   [CEED_NOTRANSPOSE] = "no transpose",
 };
 
+const char *const CeedElemOrderings[] = {
+  [CEED_ORDERING_NATURAL] = "natural",
+  [CEED_ORDERING_RCM] = "reverse Cuthill-McKee",
+};
+
+const char *const CeedElemMatrixModes[] = {
+  [CEED_ELEMMATRIX_NEVER] = "never",
+  [CEED_ELEMMATRIX_AUTO] = "auto",
+  [CEED_ELEMMATRIX_ALWAYS] = "always",
+};
+
+const char *const CeedFDMModes[] = {
+  [CEED_FDM_AVERAGED] = "averaged",
+  [CEED_FDM_DIRECTIONAL] = "directional",
+};
+
+const char *const CeedStorageTypes[] = {
+  [CEED_STORAGE_SCALAR] = "CeedScalar",
+  [CEED_STORAGE_FP32] = "fp32",
+  [CEED_STORAGE_BF16] = "bf16",
+};
+
+const char *const CeedIndexTypes[] = {
+  [CEED_INDEX_INT32] = "int32",
+  [CEED_INDEX_INT16] = "int16",
+};
+
 const char *const CeedEvalModes[] = {
   [CEED_EVAL_NONE] = "none",
   [CEED_EVAL_INTERP] = "interpolation",
@@ -41,6 +97,11 @@ const char *const CeedEvalModes[] = {
   [CEED_EVAL_WEIGHT] = "quadrature weights",
 };
 
+const char *const CeedContextFieldTypes[] = {
+  [CEED_CONTEXT_FIELD_DOUBLE] = "double",
+  [CEED_CONTEXT_FIELD_INT32] = "int32",
+};
+
 const char *const CeedQuadModes[] = {
   [CEED_GAUSS] = "Gauss",
   [CEED_GAUSS_LOBATTO] = "Gauss Lobatto",
@@ -14,9 +14,17 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
+#define _POSIX_C_SOURCE 200112
 #include <ceed-impl.h>
 #include <ceed-backend.h>
+#include <fcntl.h>
 #include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 /// @file
 /// Implementation of public CeedVector interfaces
@@ -24,6 +32,23 @@
 /// @cond DOXYGEN_SKIP
 static struct CeedVector_private ceed_vector_active;
 static struct CeedVector_private ceed_vector_none;
+
+// Header of the files written by CeedVectorSave, followed by the values
+typedef struct {
+  char magic[8];      // "CEEDVEC"
+  int32_t version;
+  int32_t scalarsize; // sizeof(CeedScalar) of the writer
+  int64_t length;     // Number of values
+  int64_t offset;     // Byte offset of the values in the file
+  int32_t nelem, elemsize, ncomp; // Restriction of the vector, if any
+  int32_t strided;    // Values are laid out by the strides below
+  int32_t layout[3];  // Strides between [nodes, components, elements]
+  int32_t reserved;
+  char resource[64];  // Resource of the Ceed that wrote the file
+} CeedVectorFileHeader;
+static const char ceed_vector_file_magic[8] = "CEEDVEC";
+#define CEED_VECTOR_FILE_VERSION 1
+#define CEED_VECTOR_FILE_OFFSET 256
 /// @endcond
 
 /// @addtogroup CeedVectorUser
@@ -38,6 +63,392 @@ const CeedVector CEED_VECTOR_NONE = &ceed_vector_none;
 
 /// @}
 
+/// ----------------------------------------------------------------------------
+/// CeedVector Library Internal Functions
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedVectorDeveloper
+/// @{
+
+/**
+  @brief Resolve the memory type requested for a CeedVector array. Host memory
+           is trivially unified for backends that prefer it, so
+           @ref CEED_MEM_UNIFIED is passed to the backend only for backends
+           that prefer device memory.
+
+  @param vec           CeedVector
+  @param[in,out] mtype Memory type to resolve
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedVectorResolveMemType(CeedVector vec, CeedMemType *mtype) {
+  int ierr;
+
+  if (*mtype == CEED_MEM_UNIFIED) {
+    CeedMemType preferred;
+    ierr = CeedGetPreferredMemType(vec->ceed, &preferred); CeedChk(ierr);
+    if (preferred == CEED_MEM_HOST)
+      *mtype = CEED_MEM_HOST;
+  }
+  return 0;
+}
+
+/**
+  @brief Check that two CeedVectors have the same length and that the input
+           vector has data set, for vector algebra
+
+  @param x             Input CeedVector
+  @param y             CeedVector combined with x
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedVectorCheckCompatible(CeedVector x, CeedVector y) {
+  int ierr;
+  uint64_t state;
+
+  if (x->length != y->length)
+    // LCOV_EXCL_START
+    return CeedError(y->ceed, 1, "Cannot combine CeedVectors of length %d and "
+                     "%d", x->length, y->length);
+  // LCOV_EXCL_STOP
+  ierr = CeedVectorGetState(x, &state); CeedChk(ierr);
+  if (!state)
+    // LCOV_EXCL_START
+    return CeedError(x->ceed, 1, "CeedVector must have data set");
+  // LCOV_EXCL_STOP
+  return 0;
+}
+
+/**
+  @brief Views take no array of their own, their values belong to the parent
+
+  @ref Developer
+**/
+static int CeedVectorSetArray_View(CeedVector vec, CeedMemType mtype,
+                                   CeedCopyMode cmode, CeedScalar *array) {
+  // LCOV_EXCL_START
+  return CeedError(vec->ceed, 1, "Cannot set the array of a CeedVector view");
+  // LCOV_EXCL_STOP
+}
+
+static int CeedVectorTakeArray_View(CeedVector vec, CeedMemType mtype,
+                                    CeedScalar **array) {
+  // LCOV_EXCL_START
+  return CeedError(vec->ceed, 1, "Cannot take the array of a CeedVector view");
+  // LCOV_EXCL_STOP
+}
+
+/**
+  @brief Access the values of a view through the array of its parent, which
+           holds the memory state and the access lock for all of its views
+
+  @ref Developer
+**/
+static int CeedVectorGetArray_View(CeedVector vec, CeedMemType mtype,
+                                   CeedScalar **array) {
+  int ierr;
+
+  ierr = CeedVectorGetArray(vec->parent, mtype, array); CeedChk(ierr);
+  *array += vec->viewoffset;
+  return 0;
+}
+
+static int CeedVectorGetArrayRead_View(CeedVector vec, CeedMemType mtype,
+                                       const CeedScalar **array) {
+  int ierr;
+
+  ierr = CeedVectorGetArrayRead(vec->parent, mtype, array); CeedChk(ierr);
+  *array += vec->viewoffset;
+  return 0;
+}
+
+static int CeedVectorRestoreArray_View(CeedVector vec) {
+  int ierr;
+  CeedScalar *array;
+
+  ierr = CeedVectorRestoreArray(vec->parent, &array); CeedChk(ierr);
+  return 0;
+}
+
+static int CeedVectorRestoreArrayRead_View(CeedVector vec) {
+  int ierr;
+  const CeedScalar *array;
+
+  ierr = CeedVectorRestoreArrayRead(vec->parent, &array); CeedChk(ierr);
+  return 0;
+}
+
+static int CeedVectorSyncArray_View(CeedVector vec, CeedMemType mtype) {
+  int ierr;
+
+  ierr = CeedVectorSyncArray(vec->parent, mtype); CeedChk(ierr);
+  return 0;
+}
+
+static int CeedVectorDestroy_View(CeedVector vec) {
+  int ierr;
+
+  ierr = CeedVectorDestroy(&vec->parent); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Check if any of several CeedVectors is a view. Views have no backend
+           data, so backend implementations of vector algebra are used only
+           when no argument is a view.
+
+  @param n             Number of CeedVectors
+  @param vecs          Array of n CeedVectors, entries may be
+                         @ref CEED_VECTOR_NONE
+
+  @return True if any of the CeedVectors is a view
+
+  @ref Developer
+**/
+static bool CeedVectorAnyView(CeedInt n, const CeedVector *vecs) {
+  for (CeedInt i=0; i<n; i++)
+    if (vecs[i] && vecs[i]->parent)
+      return true;
+  return false;
+}
+
+/**
+  @brief Describe the layout of the values of a CeedVector in a file header
+
+  Strided restrictions record their strides, or the E-vector layout of the
+    backend for CEED_STRIDES_BACKEND, so the values can be read back through
+    a restriction with a different layout.
+
+  @param vec           CeedVector
+  @param rstr          CeedElemRestriction of @a vec, or NULL
+  @param[out] header   Header to fill
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedVectorFileLayout(CeedVector vec, CeedElemRestriction rstr,
+                                CeedVectorFileHeader *header) {
+  int ierr;
+
+  memset(header, 0, sizeof(*header));
+  memcpy(header->magic, ceed_vector_file_magic, sizeof(header->magic));
+  header->version = CEED_VECTOR_FILE_VERSION;
+  header->scalarsize = sizeof(CeedScalar);
+  header->length = vec->length;
+  header->offset = CEED_VECTOR_FILE_OFFSET;
+  if (!rstr || rstr == CEED_ELEMRESTRICTION_NONE)
+    return 0;
+
+  if (rstr->lsize != vec->length)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "CeedElemRestriction L-vector size %d does "
+                     "not match CeedVector length %d", rstr->lsize,
+                     vec->length);
+  // LCOV_EXCL_STOP
+  header->nelem = rstr->nelem;
+  header->elemsize = rstr->elemsize;
+  header->ncomp = rstr->ncomp;
+  if (rstr->strides) {
+    bool backendstrides;
+    CeedInt layout[3];
+    ierr = CeedElemRestrictionHasBackendStrides(rstr, &backendstrides);
+    CeedChk(ierr);
+    if (backendstrides) {
+      ierr = CeedElemRestrictionGetELayout(rstr, &layout); CeedChk(ierr);
+    } else {
+      ierr = CeedElemRestrictionGetStrides(rstr, &layout); CeedChk(ierr);
+    }
+    header->strided = 1;
+    for (int i = 0; i < 3; i++)
+      header->layout[i] = layout[i];
+  }
+  return 0;
+}
+
+/**
+  @brief Check that a file header written by CeedVectorSave matches a
+           CeedVector and its CeedElemRestriction
+
+  @param vec           CeedVector to load
+  @param rstr          CeedElemRestriction of @a vec, or NULL
+  @param file          File header
+  @param size          Size of the file in bytes
+  @param[out] permute  Whether the values must be permuted into the layout of
+                         @a rstr
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedVectorFileCheck(CeedVector vec, CeedElemRestriction rstr,
+                               const CeedVectorFileHeader *file, size_t size,
+                               bool *permute) {
+  int ierr;
+  CeedVectorFileHeader header;
+
+  *permute = false;
+  if (size < sizeof(*file) || memcmp(file->magic, ceed_vector_file_magic,
+                                     sizeof(file->magic)))
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Not a CeedVector file");
+  // LCOV_EXCL_STOP
+  if (file->version > CEED_VECTOR_FILE_VERSION)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "CeedVector file version %d is newer than "
+                     "%d", file->version, CEED_VECTOR_FILE_VERSION);
+  // LCOV_EXCL_STOP
+  if (file->scalarsize != (int32_t)sizeof(CeedScalar))
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "CeedVector file has %d byte scalars, "
+                     "CeedScalar has %d bytes", file->scalarsize,
+                     (int)sizeof(CeedScalar));
+  // LCOV_EXCL_STOP
+  if (file->length != vec->length)
+    return CeedError(vec->ceed, 1, "CeedVector file has length %ld, CeedVector "
+                     "has length %d", (long)file->length, vec->length);
+  if (file->offset < (int64_t)sizeof(*file) ||
+      file->offset > (int64_t)size || file->offset % sizeof(CeedScalar))
+    return CeedError(vec->ceed, 1, "CeedVector file has invalid offset %ld",
+                     (long)file->offset);
+  if ((size - file->offset) / sizeof(CeedScalar) < (size_t)file->length)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "CeedVector file is truncated");
+  // LCOV_EXCL_STOP
+  if (!rstr || rstr == CEED_ELEMRESTRICTION_NONE || !file->nelem)
+    return 0;
+
+  ierr = CeedVectorFileLayout(vec, rstr, &header); CeedChk(ierr);
+  if (header.nelem != file->nelem || header.elemsize != file->elemsize ||
+      header.ncomp != file->ncomp || header.strided != file->strided)
+    return CeedError(vec->ceed, 1, "CeedVector file was written for a "
+                     "CeedElemRestriction with %d elements of size %d and %d "
+                     "components%s", file->nelem, file->elemsize, file->ncomp,
+                     file->strided ? ", strided" : "");
+  *permute = memcmp(header.layout, file->layout, sizeof(header.layout));
+  if (*permute) {
+    if (!file->strided || file->layout[0] <= 0 || file->layout[1] <= 0 ||
+        file->layout[2] <= 0)
+      return CeedError(vec->ceed, 1, "CeedVector file has invalid strides "
+                       "[%d, %d, %d]", file->layout[0], file->layout[1],
+                       file->layout[2]);
+    int64_t last = 0, lastfile = 0;
+    for (int i = 0; i < 3; i++) {
+      const int64_t n = (i == 0 ? file->elemsize : i == 1 ? file->ncomp :
+                         file->nelem) - 1;
+      last += n*header.layout[i];
+      lastfile += n*file->layout[i];
+    }
+    if (last >= vec->length || lastfile >= file->length)
+      // LCOV_EXCL_START
+      return CeedError(vec->ceed, 1, "CeedVector file layout does not fit in "
+                       "the CeedVector");
+    // LCOV_EXCL_STOP
+  }
+  return 0;
+}
+
+/**
+  @brief Write a CeedVector as a record of a binary file
+
+  The record is the file header, padded to CEED_VECTOR_FILE_OFFSET bytes,
+    followed by the values, so records can be concatenated in one file, as
+    done by CeedOperatorSave().
+
+  @param vec           CeedVector to write
+  @param rstr          CeedElemRestriction of @a vec, or NULL
+  @param stream        File stream to write to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedVectorWriteRecord(CeedVector vec, CeedElemRestriction rstr,
+                          FILE *stream) {
+  int ierr;
+  CeedVectorFileHeader header;
+  char padding[CEED_VECTOR_FILE_OFFSET] = {0};
+  const char *resource;
+  const CeedScalar *array;
+
+  ierr = CeedVectorFileLayout(vec, rstr, &header); CeedChk(ierr);
+  ierr = CeedGetResource(vec->ceed, &resource); CeedChk(ierr);
+  strncpy(header.resource, resource, sizeof(header.resource) - 1);
+
+  ierr = CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
+  bool written = fwrite(&header, sizeof(header), 1, stream) == 1 &&
+                 fwrite(padding, header.offset - sizeof(header), 1, stream) == 1
+                 && fwrite(array, sizeof(CeedScalar), vec->length, stream) ==
+                 (size_t)vec->length;
+  ierr = CeedVectorRestoreArrayRead(vec, &array); CeedChk(ierr);
+  if (!written)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Cannot write CeedVector record");
+  // LCOV_EXCL_STOP
+  return 0;
+}
+
+/**
+  @brief Read a CeedVector from a record written by CeedVectorWriteRecord()
+
+  When both the record and @a rstr have strided layouts that differ, the
+    values are permuted into the layout of @a rstr.
+
+  @param vec           CeedVector to read into
+  @param rstr          CeedElemRestriction of @a vec, or NULL to copy the
+                         values without checking their layout
+  @param record        Start of the record in memory, aligned for CeedScalar
+  @param size          Number of bytes available from @a record
+  @param[out] used     Number of bytes of the record
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedVectorReadRecord(CeedVector vec, CeedElemRestriction rstr,
+                         const void *record, size_t size, size_t *used) {
+  int ierr;
+  bool permute;
+  const CeedVectorFileHeader *header = record;
+
+  ierr = CeedVectorFileCheck(vec, rstr, header, size, &permute); CeedChk(ierr);
+  const CeedScalar *values = (const CeedScalar *)((const char *)record +
+                             header->offset);
+  *used = header->offset + header->length*sizeof(CeedScalar);
+
+  if (!permute) {
+    ierr = CeedVectorSetArray(vec, CEED_MEM_HOST, CEED_COPY_VALUES,
+                              (CeedScalar *)values); CeedChk(ierr);
+    return 0;
+  }
+  // Entries not read through the restriction are zeroed
+  CeedInt layout[3];
+  CeedScalar *array;
+  bool backendstrides;
+  ierr = CeedElemRestrictionHasBackendStrides(rstr, &backendstrides);
+  CeedChk(ierr);
+  if (backendstrides) {
+    ierr = CeedElemRestrictionGetELayout(rstr, &layout); CeedChk(ierr);
+  } else {
+    ierr = CeedElemRestrictionGetStrides(rstr, &layout); CeedChk(ierr);
+  }
+  ierr = CeedVectorSetValue(vec, 0.0); CeedChk(ierr);
+  ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
+  const int32_t *l = header->layout;
+  for (CeedInt e = 0; e < header->nelem; e++)
+    for (CeedInt j = 0; j < header->ncomp; j++)
+      for (CeedInt i = 0; i < header->elemsize; i++)
+        array[i*layout[0] + j*layout[1] + e*layout[2]] =
+          values[i*l[0] + j*l[1] + e*l[2]];
+  ierr = CeedVectorRestoreArray(vec, &array); CeedChk(ierr);
+  return 0;
+}
+
+/// @}
+
 /// ----------------------------------------------------------------------------
 /// CeedVector Backend API
 /// ----------------------------------------------------------------------------
@@ -70,7 +481,45 @@ int CeedVectorGetCeed(CeedVector vec, Ceed *ceed) {
   @ref Backend
 **/
 int CeedVectorGetState(CeedVector vec, uint64_t *state) {
+  int ierr;
+
   *state = vec->state;
+  // Writes to the parent, through it or through other views, change views
+  if (vec->parent) {
+    uint64_t parentstate;
+    ierr = CeedVectorGetState(vec->parent, &parentstate); CeedChk(ierr);
+    *state += parentstate - parentstate % 2;
+  }
+  return 0;
+}
+
+/**
+  @brief Round the values of a CeedVector to a CeedStorageType
+
+  Backends that keep reduced precision data in CeedScalar arrays use this so
+    that results match backends that store the reduced precision values.
+
+  @param vec     CeedVector to round in place
+  @param storage CeedStorageType to round to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedVectorRoundToStorage(CeedVector vec, CeedStorageType storage) {
+  int ierr;
+  CeedScalar *array;
+  float buffer[256]; // Large enough for 256 values of any storage type
+
+  if (storage == CEED_STORAGE_SCALAR)
+    return 0;
+  ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
+  for (CeedInt i=0; i<vec->length; i+=256) {
+    const CeedInt n = CeedIntMin(256, vec->length - i);
+    ierr = CeedStorageNarrow(storage, n, &array[i], buffer); CeedChk(ierr);
+    ierr = CeedStorageWiden(storage, n, buffer, &array[i]); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArray(vec, &array); CeedChk(ierr);
   return 0;
 }
 
@@ -84,7 +533,7 @@ int CeedVectorGetState(CeedVector vec, uint64_t *state) {
   @ref Backend
 **/
 int CeedVectorAddReference(CeedVector vec) {
-  vec->refcount++;
+  CeedReference(vec);
   return 0;
 }
 
@@ -118,6 +567,126 @@ int CeedVectorSetData(CeedVector vec, void *data) {
   return 0;
 }
 
+/**
+  @brief Account for memory allocated or freed for the data of a CeedVector
+
+  Bytes still accounted when the CeedVector is destroyed are released, so
+    backends only need to report memory freed during the life of the vector.
+
+  @param vec    CeedVector owning the memory
+  @param space  CeedMemSpace of the allocation
+  @param bytes  Number of bytes allocated, negative for bytes freed
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedVectorTrackMemory(CeedVector vec, CeedMemSpace space,
+                          ptrdiff_t bytes) {
+  int ierr;
+
+  vec->memusage[space] += bytes;
+  ierr = CeedTrackMemory(vec->ceed, vec->memclass, space, bytes); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Set the CeedMemoryClass the memory of a CeedVector is accounted to
+
+  CeedVectors are accounted as @ref CEED_MEMORY_VECTOR until their owner
+    sets another class. Memory already allocated moves to the new class.
+
+  @param vec       CeedVector to set the class of, or NULL
+  @param memclass  CeedMemoryClass of the vector
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedVectorSetMemoryClass(CeedVector vec, CeedMemoryClass memclass) {
+  int ierr;
+
+  if (!vec || vec == CEED_VECTOR_ACTIVE || vec == CEED_VECTOR_NONE ||
+      vec->memclass == memclass)
+    return 0;
+  for (CeedInt s=0; s<CEED_MEMSPACE_NUM; s++) {
+    if (!vec->memusage[s]) continue;
+    const ptrdiff_t bytes = vec->memusage[s];
+    ierr = CeedTrackMemory(vec->ceed, vec->memclass, s, -bytes); CeedChk(ierr);
+    ierr = CeedTrackMemory(vec->ceed, memclass, s, bytes); CeedChk(ierr);
+  }
+  vec->memclass = memclass;
+  return 0;
+}
+
+/**
+  @brief Update the iterates of a Chebyshev smoother in one pass
+
+  This computes r = r - dinv .* w, then d = alpha d + beta r, then x = x + d.
+    The first update is skipped when @a w is @ref CEED_VECTOR_NONE.
+
+  @param[in,out] x     CeedVector of the accumulated correction
+  @param[in,out] d     CeedVector of the search direction
+  @param[in,out] r     CeedVector of the preconditioned residual
+  @param w             CeedVector of the operator applied to the previous
+                         direction, or @ref CEED_VECTOR_NONE
+  @param dinv          CeedVector of the inverse diagonal
+  @param alpha         Scaling factor for d
+  @param beta          Scaling factor for r
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedVectorChebyshevUpdate(CeedVector x, CeedVector d, CeedVector r,
+                              CeedVector w, CeedVector dinv, CeedScalar alpha,
+                              CeedScalar beta) {
+  int ierr;
+
+  ierr = CeedVectorCheckCompatible(d, x); CeedChk(ierr);
+  ierr = CeedVectorCheckCompatible(r, x); CeedChk(ierr);
+  ierr = CeedVectorCheckCompatible(dinv, x); CeedChk(ierr);
+  if (w != CEED_VECTOR_NONE) {
+    ierr = CeedVectorCheckCompatible(w, x); CeedChk(ierr);
+  }
+
+  // Backend impl for GPU, if added
+  if (x->ChebyshevUpdate &&
+      !CeedVectorAnyView(5, (CeedVector[]) {x, d, r, w, dinv})) {
+    ierr = x->ChebyshevUpdate(x, d, r, w, dinv, alpha, beta); CeedChk(ierr);
+    return 0;
+  }
+
+  CeedScalar *xarray, *darray, *rarray;
+  const CeedScalar *warray = NULL, *dinvarray;
+  ierr = CeedVectorGetArray(x, CEED_MEM_HOST, &xarray); CeedChk(ierr);
+  ierr = CeedVectorGetArray(d, CEED_MEM_HOST, &darray); CeedChk(ierr);
+  ierr = CeedVectorGetArray(r, CEED_MEM_HOST, &rarray); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(dinv, CEED_MEM_HOST, &dinvarray); CeedChk(ierr);
+  if (w != CEED_VECTOR_NONE) {
+    ierr = CeedVectorGetArrayRead(w, CEED_MEM_HOST, &warray); CeedChk(ierr);
+    CeedPragmaSIMD
+    for (CeedInt i=0; i<x->length; i++) {
+      rarray[i] -= dinvarray[i]*warray[i];
+      darray[i] = alpha*darray[i] + beta*rarray[i];
+      xarray[i] += darray[i];
+    }
+    ierr = CeedVectorRestoreArrayRead(w, &warray); CeedChk(ierr);
+  } else {
+    CeedPragmaSIMD
+    for (CeedInt i=0; i<x->length; i++) {
+      darray[i] = alpha*darray[i] + beta*rarray[i];
+      xarray[i] += darray[i];
+    }
+  }
+  ierr = CeedVectorRestoreArrayRead(dinv, &dinvarray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(r, &rarray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(d, &darray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(x, &xarray); CeedChk(ierr);
+
+  return 0;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -156,7 +725,7 @@ int CeedVectorCreate(Ceed ceed, CeedInt length, CeedVector *vec) {
 
   ierr = CeedCalloc(1,vec); CeedChk(ierr);
   (*vec)->ceed = ceed;
-  ceed->refcount++;
+  CeedReference(ceed);
   (*vec)->refcount = 1;
   (*vec)->length = length;
   (*vec)->state = 0;
@@ -165,31 +734,84 @@ int CeedVectorCreate(Ceed ceed, CeedInt length, CeedVector *vec) {
 }
 
 /**
-  @brief Set the array used by a CeedVector, freeing any previously allocated
-           array if applicable. The backend may copy values to a different
-           memtype, such as during @ref CeedOperatorApply().
-           See also @ref CeedVectorSyncArray() and @ref CeedVectorTakeArray().
-
-  @param vec   CeedVector
-  @param mtype Memory type of the array being passed
-  @param cmode Copy mode for the array
-  @param array Array to be used, or NULL with @ref CEED_COPY_VALUES to have the
-                 library allocate
+  @brief Create a CeedVector viewing a contiguous range of another CeedVector
+
+  The view holds no values of its own; entries [offset, offset + length) of
+    @a parent are accessed in place in any memory type, so the parts of a
+    multi-field vector can be used as the inputs and outputs of operators
+    and in vector algebra without copies. Views share the memory state and
+    the access lock of their parent, so only one view of a parent, or the
+    parent itself, may be accessed for writing at a time. Views cannot set or
+    take an array, and keep a reference to their parent until destroyed.
+
+  @param parent    CeedVector to view, which may itself be a view
+  @param offset    Index of the first entry of @a parent in the view
+  @param length    Length of the view
+  @param[out] vec  Address of the variable where the newly created
+                     CeedVector will be stored
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
-int CeedVectorSetArray(CeedVector vec, CeedMemType mtype, CeedCopyMode cmode,
-                       CeedScalar *array) {
+int CeedVectorCreateView(CeedVector parent, CeedInt offset, CeedInt length,
+                         CeedVector *vec) {
   int ierr;
 
-  if (!vec->SetArray)
+  if (offset < 0 || length < 0 || offset + length > parent->length)
     // LCOV_EXCL_START
-    return CeedError(vec->ceed, 1, "Backend does not support VectorSetArray");
+    return CeedError(parent->ceed, 1, "Cannot view entries [%d, %d) of "
+                     "CeedVector of length %d", offset, offset + length,
+                     parent->length);
   // LCOV_EXCL_STOP
 
-  if (vec->state % 2 == 1)
+  ierr = CeedCalloc(1,vec); CeedChk(ierr);
+  (*vec)->ceed = parent->ceed;
+  CeedReference(parent->ceed);
+  (*vec)->refcount = 1;
+  (*vec)->length = length;
+  (*vec)->state = 0;
+  (*vec)->memclass = parent->memclass;
+  (*vec)->parent = parent;
+  ierr = CeedVectorAddReference(parent); CeedChk(ierr);
+  (*vec)->viewoffset = offset;
+  (*vec)->SetArray = CeedVectorSetArray_View;
+  (*vec)->TakeArray = CeedVectorTakeArray_View;
+  (*vec)->SyncArray = CeedVectorSyncArray_View;
+  (*vec)->GetArray = CeedVectorGetArray_View;
+  (*vec)->GetArrayRead = CeedVectorGetArrayRead_View;
+  (*vec)->RestoreArray = CeedVectorRestoreArray_View;
+  (*vec)->RestoreArrayRead = CeedVectorRestoreArrayRead_View;
+  (*vec)->Destroy = CeedVectorDestroy_View;
+  return 0;
+}
+
+/**
+  @brief Set the array used by a CeedVector, freeing any previously allocated
+           array if applicable. The backend may copy values to a different
+           memtype, such as during @ref CeedOperatorApply().
+           See also @ref CeedVectorSyncArray() and @ref CeedVectorTakeArray().
+
+  @param vec   CeedVector
+  @param mtype Memory type of the array being passed
+  @param cmode Copy mode for the array
+  @param array Array to be used, or NULL with @ref CEED_COPY_VALUES to have the
+                 library allocate
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorSetArray(CeedVector vec, CeedMemType mtype, CeedCopyMode cmode,
+                       CeedScalar *array) {
+  int ierr;
+
+  if (!vec->SetArray)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Backend does not support VectorSetArray");
+  // LCOV_EXCL_STOP
+
+  if (vec->state % 2 == 1)
     return CeedError(vec->ceed, 1, "Cannot grant CeedVector array access, the "
                      "access lock is already in use");
 
@@ -197,6 +819,13 @@ int CeedVectorSetArray(CeedVector vec, CeedMemType mtype, CeedCopyMode cmode,
     return CeedError(vec->ceed, 1, "Cannot grant CeedVector array access, a "
                      "process has read access");
 
+  if (vec->boundarray)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Cannot set the array of a CeedVector with "
+                     "a bound array, unbind it first");
+  // LCOV_EXCL_STOP
+
+  ierr = CeedVectorResolveMemType(vec, &mtype); CeedChk(ierr);
   ierr = vec->SetArray(vec, mtype, cmode, array); CeedChk(ierr);
   vec->state += 2;
 
@@ -234,6 +863,80 @@ int CeedVectorSetValue(CeedVector vec, CeedScalar value) {
   return 0;
 }
 
+/**
+  @brief Copy the values of a CeedVector into another CeedVector
+
+  Backends copy from the memory type where the values of @a vec are valid, on
+    the device for device data, so the copy keeps the data where it is and
+    does not sync either vector. The vectors may belong to different Ceed
+    contexts of the same backend, such as two devices. Otherwise the values
+    are copied on the host.
+
+  @param vec           CeedVector to copy
+  @param[out] copy     CeedVector of the same length to copy the values into
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorCopy(CeedVector vec, CeedVector copy) {
+  int ierr;
+
+  ierr = CeedVectorCheckCompatible(vec, copy); CeedChk(ierr);
+  if (vec == copy)
+    return 0;
+  if (copy->state % 2 == 1)
+    return CeedError(copy->ceed, 1, "Cannot grant CeedVector array access, the "
+                     "access lock is already in use");
+  if (copy->numreaders > 0)
+    return CeedError(copy->ceed, 1, "Cannot grant CeedVector array access, a "
+                     "process has read access");
+
+  // Backend impl for GPU, if both vectors are of the same backend
+  if (copy->Copy && vec->Copy == copy->Copy) {
+    if (vec->state % 2 == 1)
+      // LCOV_EXCL_START
+      return CeedError(vec->ceed, 1, "Cannot grant CeedVector read-only array "
+                       "access, the access lock is already in use");
+    // LCOV_EXCL_STOP
+    ierr = CeedVectorSetAuditSite(vec, __func__, __builtin_return_address(0));
+    CeedChk(ierr);
+    ierr = copy->Copy(vec, copy); CeedChk(ierr);
+    copy->state += 2;
+    return 0;
+  }
+
+  const CeedScalar *array;
+  CeedScalar *copyarray;
+  ierr = CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
+  ierr = CeedVectorGetArray(copy, CEED_MEM_HOST, &copyarray); CeedChk(ierr);
+  memcpy(copyarray, array, vec->length * sizeof(CeedScalar));
+  ierr = CeedVectorRestoreArray(copy, &copyarray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(vec, &array); CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Create a CeedVector with the same Ceed, length, and values as another
+           CeedVector, with the values in the same memory type
+
+  @param vec           CeedVector to duplicate
+  @param[out] copy     Address of the variable where the newly created
+                         CeedVector will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorDuplicate(CeedVector vec, CeedVector *copy) {
+  int ierr;
+
+  ierr = CeedVectorCreate(vec->ceed, vec->length, copy); CeedChk(ierr);
+  ierr = CeedVectorCopy(vec, *copy); CeedChk(ierr);
+  return 0;
+}
+
 /**
   @brief Sync the CeedVector to a specified memtype. This function is used to
            force synchronization of arrays set with @ref CeedVectorSetArray().
@@ -254,7 +957,10 @@ int CeedVectorSyncArray(CeedVector vec, CeedMemType mtype) {
     return CeedError(vec->ceed, 1, "Cannot sync CeedVector, the access lock is "
                      "already in use");
 
+  ierr = CeedVectorResolveMemType(vec, &mtype); CeedChk(ierr);
   if (vec->SyncArray) {
+    ierr = CeedVectorSetAuditSite(vec, __func__, __builtin_return_address(0));
+    CeedChk(ierr);
     ierr = vec->SyncArray(vec, mtype); CeedChk(ierr);
   } else {
     const CeedScalar *array;
@@ -266,254 +972,1062 @@ int CeedVectorSyncArray(CeedVector vec, CeedMemType mtype) {
 }
 
 /**
-  @brief Take ownership of the CeedVector array and remove the array from the
-           CeedVector. The caller is responsible for managing and freeing
-           the array.
-
-  @param vec        CeedVector
-  @param mtype      Memory type on which to take the array. If the backend
-                    uses a different memory type, this will perform a copy.
-  @param[out] array Array on memory type mtype, or NULL if array pointer is
-                      not required
+  @brief Copy a range of a CeedVector into the host memory of another
+           CeedVector without waiting for the copy
+
+  Entries [offset, offset + n) of @a vec, where n is the length of
+    @a snapshot, are copied to the host array of @a snapshot. Backends with
+    device memory copy on a separate stream, after the work already submitted
+    and before work submitted later that modifies @a vec, so the caller may
+    keep computing with @a vec while the copy is in flight. Host access to
+    @a snapshot, or waiting on @a request, waits for the copy. Alternating
+    between two snapshot vectors lets the host process one snapshot while the
+    next one is taken.
+
+  @param vec          CeedVector to copy from
+  @param offset       Index of the first entry of @a vec to copy
+  @param snapshot     CeedVector to copy to
+  @param request      Address of CeedRequest for non-blocking completion, else
+                        @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorSnapshot(CeedVector vec, CeedInt offset, CeedVector snapshot,
+                       CeedRequest *request) {
+  int ierr;
+
+  if (offset < 0 || offset + snapshot->length > vec->length)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Snapshot range [%d, %d) is outside of "
+                     "the vector of length %d", offset,
+                     offset + snapshot->length, vec->length);
+  // LCOV_EXCL_STOP
+  if (vec == snapshot)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Cannot snapshot a CeedVector into itself");
+  // LCOV_EXCL_STOP
+  if (vec->state % 2 == 1 || snapshot->state % 2 == 1)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Cannot snapshot CeedVector, the access "
+                     "lock is already in use");
+  // LCOV_EXCL_STOP
+
+  if (vec->Snapshot && snapshot->Snapshot) {
+    ierr = CeedVectorSetAuditSite(vec, __func__, __builtin_return_address(0));
+    CeedChk(ierr);
+    ierr = vec->Snapshot(vec, offset, snapshot, request); CeedChk(ierr);
+    snapshot->state += 2;
+    return 0;
+  }
+
+  // Fallback copies through host memory and completes immediately
+  const CeedScalar *array;
+  CeedScalar *snaparray;
+  ierr = CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
+  ierr = CeedVectorGetArray(snapshot, CEED_MEM_HOST, &snaparray);
+  CeedChk(ierr);
+  memcpy(snaparray, array + offset, snapshot->length*sizeof(CeedScalar));
+  ierr = CeedVectorRestoreArray(snapshot, &snaparray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(vec, &array); CeedChk(ierr);
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED)
+    *request = NULL;
+
+  return 0;
+}
+
+/**
+  @brief Take ownership of the CeedVector array and remove the array from the
+           CeedVector. The caller is responsible for managing and freeing
+           the array.
+
+  @param vec        CeedVector
+  @param mtype      Memory type on which to take the array. If the backend
+                    uses a different memory type, this will perform a copy.
+  @param[out] array Array on memory type mtype, or NULL if array pointer is
+                      not required
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorTakeArray(CeedVector vec, CeedMemType mtype, CeedScalar **array) {
+  int ierr;
+
+  if (vec->state % 2 == 1)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Cannot take CeedVector array, the access "
+                     "lock is already in use");
+  // LCOV_EXCL_STOP
+  if (vec->numreaders > 0)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Cannot take CeedVector array, a process "
+                     "has read access");
+  // LCOV_EXCL_STOP
+  if (vec->boundarray)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Cannot take the array of a CeedVector "
+                     "with a bound array, unbind it first");
+  // LCOV_EXCL_STOP
+
+  CeedScalar *tempArray = NULL;
+  ierr = CeedVectorResolveMemType(vec, &mtype); CeedChk(ierr);
+  ierr = CeedVectorSetAuditSite(vec, __func__, __builtin_return_address(0));
+  CeedChk(ierr);
+  ierr = vec->TakeArray(vec, mtype, &tempArray); CeedChk(ierr);
+  if (array)
+    (*array) = tempArray;
+  return 0;
+}
+
+/**
+  @brief Bind an application array as the storage of a CeedVector in a memory
+           type, for repeated use without setting and taking the array
+
+  The array is used in place, as with @ref CEED_USE_POINTER, until
+    @ref CeedVectorUnbindArray(). After writing to the array, the application
+    calls @ref CeedVectorBoundArrayModified(); before reading results from it,
+    @ref CeedVectorBoundArraySync(). Neither validates or moves the array, so
+    an application array that stays in place, such as the local vector of a
+    solver, costs no more per application than these notifications. Binding
+    the array already bound marks it modified, so the array of a solver
+    vector may be bound on every use.
+
+  @param vec   CeedVector
+  @param mtype Memory type of the array
+  @param array Array to use as the storage of @a vec
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorBindArray(CeedVector vec, CeedMemType mtype, CeedScalar *array) {
+  int ierr;
+
+  ierr = CeedVectorResolveMemType(vec, &mtype); CeedChk(ierr);
+  if (vec->boundarray &&
+      (vec->boundarray != array || vec->boundmtype != mtype)) {
+    ierr = CeedVectorUnbindArray(vec); CeedChk(ierr);
+  }
+  if (!vec->boundarray) {
+    ierr = CeedVectorSetArray(vec, mtype, CEED_USE_POINTER, array);
+    CeedChk(ierr);
+    vec->boundarray = array;
+    vec->boundmtype = mtype;
+    return 0;
+  }
+  return CeedVectorBoundArrayModified(vec);
+}
+
+/**
+  @brief Notify a CeedVector that the application wrote to its bound array
+
+  The bound array becomes the current values of the vector; copies in other
+    memory types are refreshed from it when next accessed.
+
+  @param vec   CeedVector with an array bound by @ref CeedVectorBindArray()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorBoundArrayModified(CeedVector vec) {
+  int ierr;
+
+  if (!vec->boundarray)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "CeedVector has no bound array");
+  // LCOV_EXCL_STOP
+  if (vec->state % 2 == 1 || vec->numreaders > 0)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Cannot modify CeedVector, the access lock "
+                     "is in use");
+  // LCOV_EXCL_STOP
+
+  // Setting the array in use again only marks it current in the backends
+  ierr = vec->SetArray(vec, vec->boundmtype, CEED_USE_POINTER,
+                       vec->boundarray); CeedChk(ierr);
+  vec->state += 2;
+  return 0;
+}
+
+/**
+  @brief Bring the values of a CeedVector into its bound array, once libCEED
+           is done writing to the vector and before the application reads
+           the array
+
+  @param vec   CeedVector with an array bound by @ref CeedVectorBindArray()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorBoundArraySync(CeedVector vec) {
+  if (!vec->boundarray)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "CeedVector has no bound array");
+  // LCOV_EXCL_STOP
+  return CeedVectorSyncArray(vec, vec->boundmtype);
+}
+
+/**
+  @brief Release the array bound to a CeedVector, leaving the current values
+           of the vector in it
+
+  @param vec   CeedVector with an array bound by @ref CeedVectorBindArray()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorUnbindArray(CeedVector vec) {
+  int ierr;
+
+  if (!vec->boundarray)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "CeedVector has no bound array");
+  // LCOV_EXCL_STOP
+  const CeedMemType mtype = vec->boundmtype;
+  vec->boundarray = NULL;
+  ierr = CeedVectorTakeArray(vec, mtype, NULL); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Get read/write access to a CeedVector via the specified memory type.
+           Restore access with @ref CeedVectorRestoreArray().
+
+  @param vec        CeedVector to access
+  @param mtype      Memory type on which to access the array. If the backend
+                    uses a different memory type, this will perform a copy.
+  @param[out] array Array on memory type mtype
+
+  @note The CeedVectorGetArray* and CeedVectorRestoreArray* functions provide
+    access to array pointers in the desired memory space. Pairing get/restore
+    allows the Vector to track access, thus knowing if norms or other
+    operations may need to be recomputed.
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorGetArray(CeedVector vec, CeedMemType mtype, CeedScalar **array) {
+  int ierr;
+
+  if (!vec->GetArray)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Backend does not support GetArray");
+  // LCOV_EXCL_STOP
+
+  if (vec->state % 2 == 1)
+    return CeedError(vec->ceed, 1, "Cannot grant CeedVector array access, the "
+                     "access lock is already in use");
+
+  if (vec->numreaders > 0)
+    return CeedError(vec->ceed, 1, "Cannot grant CeedVector array access, a "
+                     "process has read access");
+
+  ierr = CeedVectorResolveMemType(vec, &mtype); CeedChk(ierr);
+  ierr = CeedVectorSetAuditSite(vec, __func__, __builtin_return_address(0));
+  CeedChk(ierr);
+  ierr = vec->GetArray(vec, mtype, array); CeedChk(ierr);
+  vec->state += 1;
+
+  return 0;
+}
+
+/**
+  @brief Get read-only access to a CeedVector via the specified memory type.
+           Restore access with @ref CeedVectorRestoreArrayRead().
+
+  @param vec        CeedVector to access
+  @param mtype      Memory type on which to access the array.  If the backend
+                    uses a different memory type, this will perform a copy
+                    (possibly cached).
+  @param[out] array Array on memory type mtype
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorGetArrayRead(CeedVector vec, CeedMemType mtype,
+                           const CeedScalar **array) {
+  int ierr;
+
+  if (!vec->GetArrayRead)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Backend does not support GetArrayRead");
+  // LCOV_EXCL_STOP
+
+  if (vec->state % 2 == 1)
+    return CeedError(vec->ceed, 1, "Cannot grant CeedVector read-only array "
+                     "access, the access lock is already in use");
+
+  ierr = CeedVectorResolveMemType(vec, &mtype); CeedChk(ierr);
+  ierr = CeedVectorSetAuditSite(vec, __func__, __builtin_return_address(0));
+  CeedChk(ierr);
+  ierr = vec->GetArrayRead(vec, mtype, array); CeedChk(ierr);
+  // Passive inputs may be read by operators applied on several threads
+  __atomic_add_fetch(&vec->numreaders, 1, __ATOMIC_RELAXED);
+
+  return 0;
+}
+
+/**
+  @brief Restore an array obtained using @ref CeedVectorGetArray()
+
+  @param vec     CeedVector to restore
+  @param array   Array of vector data
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorRestoreArray(CeedVector vec, CeedScalar **array) {
+  int ierr;
+
+  if (!vec->RestoreArray)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Backend does not support RestoreArray");
+  // LCOV_EXCL_STOP
+
+  if (vec->state % 2 != 1)
+    return CeedError(vec->ceed, 1, "Cannot restore CeedVector array access, "
+                     "access was not granted");
+
+  ierr = vec->RestoreArray(vec); CeedChk(ierr);
+  *array = NULL;
+  vec->state += 1;
+
+  return 0;
+}
+
+/**
+  @brief Restore an array obtained using @ref CeedVectorGetArrayRead()
+
+  @param vec     CeedVector to restore
+  @param array   Array of vector data
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorRestoreArrayRead(CeedVector vec, const CeedScalar **array) {
+  int ierr;
+
+  if (!vec->RestoreArrayRead)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Backend does not support RestoreArrayRead");
+  // LCOV_EXCL_STOP
+
+  ierr = vec->RestoreArrayRead(vec); CeedChk(ierr);
+  *array = NULL;
+  __atomic_sub_fetch(&vec->numreaders, 1, __ATOMIC_RELAXED);
+
+  return 0;
+}
+
+/**
+  @brief Get the norm of a CeedVector.
+
+  Note: This operation is local to the CeedVector. This function will likely
+          not provide the desired results for the norm of the libCEED portion
+          of a parallel vector or a CeedVector with duplicated or hanging nodes.
+
+  @param vec           CeedVector to retrieve maximum value
+  @param type          Norm type @ref CEED_NORM_1, @ref CEED_NORM_2, or @ref CEED_NORM_MAX
+  @param[out] norm     Variable to store norm value
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorNorm(CeedVector vec, CeedNormType type, CeedScalar *norm) {
+  int ierr;
+
+  // Backend impl for GPU, if added
+  if (vec->Norm) {
+    ierr = vec->Norm(vec, type, norm); CeedChk(ierr);
+    return 0;
+  }
+
+  const CeedScalar *array;
+  ierr = CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
+
+  *norm = 0.;
+  switch (type) {
+  case CEED_NORM_1:
+    for (int i=0; i<vec->length; i++) {
+      *norm += fabs(array[i]);
+    }
+    break;
+  case CEED_NORM_2:
+    for (int i=0; i<vec->length; i++) {
+      *norm += fabs(array[i])*fabs(array[i]);
+    }
+    break;
+  case CEED_NORM_MAX:
+    for (int i=0; i<vec->length; i++) {
+      const CeedScalar absi = fabs(array[i]);
+      *norm = *norm > absi ? *norm : absi;
+    }
+  }
+  if (type == CEED_NORM_2)
+    *norm = sqrt(*norm);
+
+  ierr = CeedVectorRestoreArrayRead(vec, &array); CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Compute several norms of a CeedVector in a single pass, storing them
+           in a CeedVector. Backends compute the norms in their preferred
+           memory, so a device backend can keep chaining work on the results
+           without waiting for them on the host.
+
+  @param vec           CeedVector to compute the norms of
+  @param nnorms        Number of norms to compute
+  @param types         Array of nnorms norm types
+  @param[out] norms    CeedVector of length at least nnorms to store the norms,
+                         in the order of types
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorNorms(CeedVector vec, CeedInt nnorms, const CeedNormType *types,
+                    CeedVector norms) {
+  int ierr;
+
+  uint64_t state;
+  ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
+  if (!state)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "CeedVector must have data set");
+  // LCOV_EXCL_STOP
+  if (norms->length < nnorms)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "CeedVector of length %d cannot store %d "
+                     "norms", norms->length, nnorms);
+  // LCOV_EXCL_STOP
+  if (norms == vec)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Cannot store norms of a CeedVector in "
+                     "itself");
+  // LCOV_EXCL_STOP
+
+  // Backend impl for GPU, if added
+  if (vec->Norms && !CeedVectorAnyView(1, &norms)) {
+    ierr = vec->Norms(vec, nnorms, types, norms); CeedChk(ierr);
+    return 0;
+  }
+
+  const CeedScalar *array;
+  ierr = CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
+  CeedScalar norm[CEED_NORM_MAX+1] = {0.};
+  for (CeedInt i=0; i<vec->length; i++) {
+    const CeedScalar absi = fabs(array[i]);
+    norm[CEED_NORM_1] += absi;
+    norm[CEED_NORM_2] += absi*absi;
+    norm[CEED_NORM_MAX] = norm[CEED_NORM_MAX] > absi ? norm[CEED_NORM_MAX] : absi;
+  }
+  norm[CEED_NORM_2] = sqrt(norm[CEED_NORM_2]);
+  ierr = CeedVectorRestoreArrayRead(vec, &array); CeedChk(ierr);
+
+  CeedScalar *normsarray;
+  ierr = CeedVectorGetArray(norms, CEED_MEM_HOST, &normsarray); CeedChk(ierr);
+  for (CeedInt i=0; i<nnorms; i++)
+    normsarray[i] = norm[types[i]];
+  ierr = CeedVectorRestoreArray(norms, &normsarray); CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Reduce contiguous segments of a CeedVector, storing one value per
+           segment in a CeedVector. Backends reduce in their preferred memory,
+           so a device backend can keep chaining work on the results without
+           waiting for them on the host.
+
+  @param vec           CeedVector to reduce, split into as many segments of
+                         equal length as @a result has entries
+  @param rtype         CeedReduceType applied to the entries of each segment
+  @param add           Combine the reduction of each segment with the value
+                         already in @a result, instead of overwriting it
+  @param[out] result   CeedVector storing the reduction of each segment
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorReduceSegments(CeedVector vec, CeedReduceType rtype, bool add,
+                             CeedVector result) {
+  int ierr;
+  const CeedInt nseg = result->length;
+
+  uint64_t state;
+  ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
+  if (!state)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "CeedVector must have data set");
+  // LCOV_EXCL_STOP
+  if (!nseg || vec->length % nseg)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "CeedVector of length %d cannot be split "
+                     "into %d segments", vec->length, nseg);
+  // LCOV_EXCL_STOP
+  if (result == vec)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Cannot store reductions of a CeedVector "
+                     "in itself");
+  // LCOV_EXCL_STOP
+
+  // Backend impl for GPU, if added
+  if (vec->ReduceSegments && !CeedVectorAnyView(1, &result)) {
+    ierr = vec->ReduceSegments(vec, rtype, add, result); CeedChk(ierr);
+    return 0;
+  }
+
+  const CeedInt seglen = vec->length / nseg;
+  const CeedScalar *array;
+  CeedScalar *resultarray;
+  ierr = CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
+  ierr = CeedVectorGetArray(result, CEED_MEM_HOST, &resultarray);
+  CeedChk(ierr);
+  for (CeedInt k=0; k<nseg; k++) {
+    const CeedScalar *seg = array + k*seglen;
+    CeedScalar r = add ? resultarray[k] : seg[0];
+    const CeedInt start = add ? 0 : 1;
+    switch (rtype) {
+    case CEED_REDUCE_SUM:
+      for (CeedInt i=start; i<seglen; i++)
+        r += seg[i];
+      break;
+    case CEED_REDUCE_MAX:
+      for (CeedInt i=start; i<seglen; i++)
+        r = r > seg[i] ? r : seg[i];
+      break;
+    case CEED_REDUCE_MIN:
+      for (CeedInt i=start; i<seglen; i++)
+        r = r < seg[i] ? r : seg[i];
+      break;
+    }
+    resultarray[k] = r;
+  }
+  ierr = CeedVectorRestoreArray(result, &resultarray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(vec, &array); CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Compute the dot product of two CeedVectors, storing it in a
+           CeedVector. Backends compute the dot product in their preferred
+           memory, so a device backend can keep chaining work on the result
+           without waiting for it on the host.
+
+  @param x             First CeedVector
+  @param y             Second CeedVector, may be the same as x
+  @param[out] dot      CeedVector of length at least 1 to store the dot product
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorDotVector(CeedVector x, CeedVector y, CeedVector dot) {
+  int ierr;
+
+  ierr = CeedVectorCheckCompatible(x, y); CeedChk(ierr);
+  ierr = CeedVectorCheckCompatible(y, x); CeedChk(ierr);
+  if (dot->length < 1)
+    // LCOV_EXCL_START
+    return CeedError(x->ceed, 1, "CeedVector of length 0 cannot store a dot "
+                     "product");
+  // LCOV_EXCL_STOP
+  if (dot == x || dot == y)
+    // LCOV_EXCL_START
+    return CeedError(x->ceed, 1, "Cannot store a dot product in one of its "
+                     "arguments");
+  // LCOV_EXCL_STOP
+
+  // Backend impl for GPU, if added
+  if (x->DotVector && !CeedVectorAnyView(2, (CeedVector[]) {y, dot})) {
+    ierr = x->DotVector(x, y, dot); CeedChk(ierr);
+    return 0;
+  }
+
+  CeedScalar result, *dotarray;
+  ierr = CeedVectorDot(x, y, &result); CeedChk(ierr);
+  ierr = CeedVectorGetArray(dot, CEED_MEM_HOST, &dotarray); CeedChk(ierr);
+  dotarray[0] = result;
+  ierr = CeedVectorRestoreArray(dot, &dotarray); CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Find the index of a vector among the distinct vectors of a fused
+           operation, adding it if needed
+
+  @param vec           CeedVector to find
+  @param vecs          Distinct CeedVectors of the operation
+  @param multi         Fused operation to update
+
+  @return Index of @a vec in @a vecs, or -1 if there are too many vectors
+
+  @ref Developer
+**/
+static CeedInt CeedVectorMultiIndex(CeedVector vec, CeedVector *vecs,
+                                    CeedVectorMulti *multi) {
+  for (CeedInt i=0; i<multi->nvecs; i++)
+    if (vecs[i] == vec)
+      return i;
+  if (multi->nvecs == CEED_VECTOR_MULTI_MAX)
+    return -1;
+  vecs[multi->nvecs] = vec;
+  multi->write[multi->nvecs] = false;
+  return multi->nvecs++;
+}
+
+/**
+  @brief Apply several AXPBY updates and compute several dot products in a
+           single pass over the vectors, as needed by pipelined Krylov methods
+
+  Each entry i is updated in order by y[k] = alpha[k] x[k] + beta[k] y[k] for
+    k < @a nupdate, so later updates see the results of earlier ones, and the
+    dot products u[l]^T v[l] for l < @a ndot are then taken of the updated
+    vectors.  At most @ref CEED_VECTOR_MULTI_MAX distinct vectors and updates
+    and @ref CEED_VECTOR_MULTI_MAX_DOTS dot products may be fused.  As with
+    CeedVectorDotVector(), the dot products are stored in a CeedVector, so a
+    device backend does not wait for them on the host.
+
+  @param nupdate       Number of updates
+  @param[in,out] y     Array of @a nupdate CeedVectors to update
+  @param alpha         Array of @a nupdate scaling factors for x
+  @param beta          Array of @a nupdate scaling factors for y
+  @param x             Array of @a nupdate CeedVectors to add
+  @param ndot          Number of dot products
+  @param u             Array of @a ndot first CeedVectors of the dot products
+  @param v             Array of @a ndot second CeedVectors of the dot products
+  @param[out] dots     CeedVector of length at least @a ndot to store the dot
+                         products, or @ref CEED_VECTOR_NONE if @a ndot is 0
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
-int CeedVectorTakeArray(CeedVector vec, CeedMemType mtype, CeedScalar **array) {
+int CeedVectorMultiAXPBYDot(CeedInt nupdate, CeedVector *y,
+                            const CeedScalar *alpha, const CeedScalar *beta,
+                            CeedVector *x, CeedInt ndot, CeedVector *u,
+                            CeedVector *v, CeedVector dots) {
   int ierr;
-
-  if (vec->state % 2 == 1)
+  if (nupdate + ndot == 0)
+    return 0;
+  CeedVector vec = nupdate ? y[0] : u[0];
+  if (nupdate > CEED_VECTOR_MULTI_MAX || ndot > CEED_VECTOR_MULTI_MAX_DOTS)
     // LCOV_EXCL_START
-    return CeedError(vec->ceed, 1, "Cannot take CeedVector array, the access "
-                     "lock is already in use");
+    return CeedError(vec->ceed, 1, "Cannot fuse %d updates and %d dot "
+                     "products", nupdate, ndot);
   // LCOV_EXCL_STOP
-  if (vec->numreaders > 0)
+  if (ndot && (dots == CEED_VECTOR_NONE || dots->length < ndot))
     // LCOV_EXCL_START
-    return CeedError(vec->ceed, 1, "Cannot take CeedVector array, a process "
-                     "has read access");
+    return CeedError(vec->ceed, 1, "CeedVector for %d dot products too short",
+                     ndot);
   // LCOV_EXCL_STOP
 
-  CeedScalar *tempArray = NULL;
-  ierr = vec->TakeArray(vec, mtype, &tempArray); CeedChk(ierr);
-  if (array)
-    (*array) = tempArray;
+  // Distinct vectors
+  CeedVector vecs[CEED_VECTOR_MULTI_MAX];
+  CeedVectorMulti multi = {.nvecs = 0, .nupdate = nupdate, .ndot = ndot};
+  bool fits = true;
+  for (CeedInt k=0; k<nupdate; k++) {
+    multi.y[k] = CeedVectorMultiIndex(y[k], vecs, &multi);
+    multi.x[k] = CeedVectorMultiIndex(x[k], vecs, &multi);
+    fits = fits && multi.y[k] >= 0 && multi.x[k] >= 0;
+    if (multi.y[k] >= 0)
+      multi.write[multi.y[k]] = true;
+    multi.alpha[k] = alpha[k];
+    multi.beta[k] = beta[k];
+  }
+  for (CeedInt l=0; l<ndot; l++) {
+    multi.u[l] = CeedVectorMultiIndex(u[l], vecs, &multi);
+    multi.v[l] = CeedVectorMultiIndex(v[l], vecs, &multi);
+    fits = fits && multi.u[l] >= 0 && multi.v[l] >= 0;
+  }
+  if (!fits)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Cannot fuse operations on more than %d "
+                     "vectors", CEED_VECTOR_MULTI_MAX);
+  // LCOV_EXCL_STOP
+  for (CeedInt i=0; i<multi.nvecs; i++) {
+    ierr = CeedVectorCheckCompatible(vecs[i], vec); CeedChk(ierr);
+    if (vecs[i] == dots)
+      // LCOV_EXCL_START
+      return CeedError(vec->ceed, 1, "Cannot store dot products in one of "
+                       "their arguments");
+    // LCOV_EXCL_STOP
+  }
+
+  // Backend impl for GPU, if added
+  if (vec->MultiAXPBYDot && !CeedVectorAnyView(multi.nvecs, vecs) &&
+      !CeedVectorAnyView(1, &dots)) {
+    ierr = vec->MultiAXPBYDot(vecs, &multi, dots); CeedChk(ierr);
+    return 0;
+  }
+
+  // Sweep over chunks of entries that stay in cache across the operations
+  const CeedInt chunk = 512;
+  CeedScalar *arrays[CEED_VECTOR_MULTI_MAX];
+  for (CeedInt i=0; i<multi.nvecs; i++) {
+    if (multi.write[i]) {
+      ierr = CeedVectorGetArray(vecs[i], CEED_MEM_HOST, &arrays[i]);
+      CeedChk(ierr);
+    } else {
+      ierr = CeedVectorGetArrayRead(vecs[i], CEED_MEM_HOST,
+                                    (const CeedScalar **)&arrays[i]);
+      CeedChk(ierr);
+    }
+  }
+  CeedScalar sums[CEED_VECTOR_MULTI_MAX_DOTS] = {0.};
+  for (CeedInt i0=0; i0<vec->length; i0+=chunk) {
+    const CeedInt n = CeedIntMin(chunk, vec->length - i0);
+    for (CeedInt k=0; k<nupdate; k++) {
+      CeedScalar *yk = &arrays[multi.y[k]][i0];
+      const CeedScalar *xk = &arrays[multi.x[k]][i0];
+      const CeedScalar a = multi.alpha[k], b = multi.beta[k];
+      CeedPragmaSIMD
+      for (CeedInt i=0; i<n; i++)
+        yk[i] = a*xk[i] + b*yk[i];
+    }
+    for (CeedInt l=0; l<ndot; l++) {
+      const CeedScalar *ul = &arrays[multi.u[l]][i0],
+                        *vl = &arrays[multi.v[l]][i0];
+      CeedScalar sum = 0.;
+      for (CeedInt i=0; i<n; i++)
+        sum += ul[i]*vl[i];
+      sums[l] += sum;
+    }
+  }
+  for (CeedInt i=0; i<multi.nvecs; i++) {
+    if (multi.write[i]) {
+      ierr = CeedVectorRestoreArray(vecs[i], &arrays[i]); CeedChk(ierr);
+    } else {
+      ierr = CeedVectorRestoreArrayRead(vecs[i],
+                                        (const CeedScalar **)&arrays[i]);
+      CeedChk(ierr);
+    }
+  }
+  if (ndot) {
+    CeedScalar *dotarray;
+    ierr = CeedVectorGetArray(dots, CEED_MEM_HOST, &dotarray); CeedChk(ierr);
+    for (CeedInt l=0; l<ndot; l++)
+      dotarray[l] = sums[l];
+    ierr = CeedVectorRestoreArray(dots, &dotarray); CeedChk(ierr);
+  }
+
   return 0;
 }
 
 /**
-  @brief Get read/write access to a CeedVector via the specified memory type.
-           Restore access with @ref CeedVectorRestoreArray().
-
-  @param vec        CeedVector to access
-  @param mtype      Memory type on which to access the array. If the backend
-                    uses a different memory type, this will perform a copy.
-  @param[out] array Array on memory type mtype
+  @brief Take the reciprocal of a CeedVector.
 
-  @note The CeedVectorGetArray* and CeedVectorRestoreArray* functions provide
-    access to array pointers in the desired memory space. Pairing get/restore
-    allows the Vector to track access, thus knowing if norms or other
-    operations may need to be recomputed.
+  @param vec           CeedVector to take reciprocal
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
-int CeedVectorGetArray(CeedVector vec, CeedMemType mtype, CeedScalar **array) {
+int CeedVectorReciprocal(CeedVector vec) {
   int ierr;
 
-  if (!vec->GetArray)
+  // Check if vector data set
+  uint64_t state;
+  ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
+  if (!state)
     // LCOV_EXCL_START
-    return CeedError(vec->ceed, 1, "Backend does not support GetArray");
+    return CeedError(vec->ceed, 1,
+                     "CeedVector must have data set to take reciprocal");
   // LCOV_EXCL_STOP
 
-  if (vec->state % 2 == 1)
-    return CeedError(vec->ceed, 1, "Cannot grant CeedVector array access, the "
-                     "access lock is already in use");
-
-  if (vec->numreaders > 0)
-    return CeedError(vec->ceed, 1, "Cannot grant CeedVector array access, a "
-                     "process has read access");
+  // Backend impl for GPU, if added
+  if (vec->Reciprocal) {
+    ierr = vec->Reciprocal(vec); CeedChk(ierr);
+    return 0;
+  }
 
-  ierr = vec->GetArray(vec, mtype, array); CeedChk(ierr);
-  vec->state += 1;
+  CeedInt len;
+  ierr = CeedVectorGetLength(vec, &len); CeedChk(ierr);
+  CeedScalar *array;
+  ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
+  for (CeedInt i=0; i<len; i++)
+    if (fabs(array[i]) > CEED_EPSILON)
+      array[i] = 1./array[i];
+  ierr = CeedVectorRestoreArray(vec, &array); CeedChk(ierr);
 
   return 0;
 }
 
 /**
-  @brief Get read-only access to a CeedVector via the specified memory type.
-           Restore access with @ref CeedVectorRestoreArrayRead().
+  @brief Invert the point blocks of a CeedVector in place
 
-  @param vec        CeedVector to access
-  @param mtype      Memory type on which to access the array.  If the backend
-                    uses a different memory type, this will perform a copy
-                    (possibly cached).
-  @param[out] array Array on memory type mtype
+  The vector holds consecutive row-major @a bsize * @a bsize blocks, such as
+    the point block diagonal from
+    CeedOperatorLinearAssemblePointBlockDiagonal(), and each block is
+    replaced by its inverse, computed with Gauss-Jordan elimination and
+    partial pivoting. Columns without a pivot larger than CEED_EPSILON are
+    skipped, so zero blocks are left zero, as CeedVectorReciprocal() does for
+    zero entries.
+
+  @param vec           CeedVector of point blocks to invert
+  @param bsize         Size of each block, at most 16
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
-int CeedVectorGetArrayRead(CeedVector vec, CeedMemType mtype,
-                           const CeedScalar **array) {
+int CeedVectorPointBlockInvert(CeedVector vec, CeedInt bsize) {
   int ierr;
 
-  if (!vec->GetArrayRead)
+  // Check if vector data set
+  uint64_t state;
+  ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
+  if (!state)
     // LCOV_EXCL_START
-    return CeedError(vec->ceed, 1, "Backend does not support GetArrayRead");
+    return CeedError(vec->ceed, 1,
+                     "CeedVector must have data set to invert point blocks");
+  // LCOV_EXCL_STOP
+  if (bsize < 1 || bsize > 16 || vec->length % (bsize*bsize))
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Cannot invert point blocks of size %d in "
+                     "CeedVector of length %d", bsize, vec->length);
   // LCOV_EXCL_STOP
 
-  if (vec->state % 2 == 1)
-    return CeedError(vec->ceed, 1, "Cannot grant CeedVector read-only array "
-                     "access, the access lock is already in use");
+  // Backend impl for GPU, if added
+  if (vec->PointBlockInvert) {
+    ierr = vec->PointBlockInvert(vec, bsize); CeedChk(ierr);
+    return 0;
+  }
 
-  ierr = vec->GetArrayRead(vec, mtype, array); CeedChk(ierr);
-  vec->numreaders++;
+  CeedInt len, piv[16];
+  ierr = CeedVectorGetLength(vec, &len); CeedChk(ierr);
+  CeedScalar *array;
+  ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
+  for (CeedInt b=0; b<len; b+=bsize*bsize) {
+    CeedScalar *A = &array[b];
+    for (CeedInt k=0; k<bsize; k++) {
+      // Pivot row
+      CeedInt p = k;
+      for (CeedInt i=k+1; i<bsize; i++)
+        if (fabs(A[i*bsize+k]) > fabs(A[p*bsize+k]))
+          p = i;
+      piv[k] = p;
+      if (fabs(A[p*bsize+k]) <= CEED_EPSILON) {
+        piv[k] = k;
+        continue;
+      }
+      if (p != k)
+        for (CeedInt j=0; j<bsize; j++) {
+          CeedScalar t = A[k*bsize+j];
+          A[k*bsize+j] = A[p*bsize+j];
+          A[p*bsize+j] = t;
+        }
+      // Eliminate column k
+      const CeedScalar pivinv = 1./A[k*bsize+k];
+      A[k*bsize+k] = 1.;
+      for (CeedInt j=0; j<bsize; j++)
+        A[k*bsize+j] *= pivinv;
+      for (CeedInt i=0; i<bsize; i++)
+        if (i != k) {
+          const CeedScalar f = A[i*bsize+k];
+          A[i*bsize+k] = 0.;
+          for (CeedInt j=0; j<bsize; j++)
+            A[i*bsize+j] -= f*A[k*bsize+j];
+        }
+    }
+    // Undo the row swaps as column swaps
+    for (CeedInt k=bsize-1; k>=0; k--)
+      if (piv[k] != k)
+        for (CeedInt i=0; i<bsize; i++) {
+          CeedScalar t = A[i*bsize+k];
+          A[i*bsize+k] = A[i*bsize+piv[k]];
+          A[i*bsize+piv[k]] = t;
+        }
+  }
+  ierr = CeedVectorRestoreArray(vec, &array); CeedChk(ierr);
 
   return 0;
 }
 
 /**
-  @brief Restore an array obtained using @ref CeedVectorGetArray()
+  @brief Compute y = alpha x + y
 
-  @param vec     CeedVector to restore
-  @param array   Array of vector data
+  @param[in,out] y     CeedVector to update, may be the same as x
+  @param alpha         Scaling factor for x
+  @param x             CeedVector to add
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
-int CeedVectorRestoreArray(CeedVector vec, CeedScalar **array) {
+int CeedVectorAXPY(CeedVector y, CeedScalar alpha, CeedVector x) {
   int ierr;
 
-  if (!vec->RestoreArray)
-    // LCOV_EXCL_START
-    return CeedError(vec->ceed, 1, "Backend does not support RestoreArray");
-  // LCOV_EXCL_STOP
+  ierr = CeedVectorCheckCompatible(x, y); CeedChk(ierr);
+  ierr = CeedVectorCheckCompatible(y, x); CeedChk(ierr);
 
-  if (vec->state % 2 != 1)
-    return CeedError(vec->ceed, 1, "Cannot restore CeedVector array access, "
-                     "access was not granted");
+  // Backend impl for GPU, if added
+  if (y->AXPY && !CeedVectorAnyView(1, &x)) {
+    ierr = y->AXPY(y, alpha, x); CeedChk(ierr);
+    return 0;
+  }
 
-  ierr = vec->RestoreArray(vec); CeedChk(ierr);
-  *array = NULL;
-  vec->state += 1;
+  CeedScalar *yarray;
+  const CeedScalar *xarray;
+  ierr = CeedVectorGetArray(y, CEED_MEM_HOST, &yarray); CeedChk(ierr);
+  if (x != y) {
+    ierr = CeedVectorGetArrayRead(x, CEED_MEM_HOST, &xarray); CeedChk(ierr);
+  } else {
+    xarray = yarray;
+  }
+  CeedPragmaSIMD
+  for (CeedInt i=0; i<y->length; i++)
+    yarray[i] += alpha*xarray[i];
+  if (x != y) {
+    ierr = CeedVectorRestoreArrayRead(x, &xarray); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArray(y, &yarray); CeedChk(ierr);
 
   return 0;
 }
 
 /**
-  @brief Restore an array obtained using @ref CeedVectorGetArrayRead()
+  @brief Compute y = alpha x + beta y
 
-  @param vec     CeedVector to restore
-  @param array   Array of vector data
+  @param[in,out] y     CeedVector to update, may be the same as x
+  @param alpha         Scaling factor for x
+  @param beta          Scaling factor for y
+  @param x             CeedVector to add
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
-int CeedVectorRestoreArrayRead(CeedVector vec, const CeedScalar **array) {
+int CeedVectorAXPBY(CeedVector y, CeedScalar alpha, CeedScalar beta,
+                    CeedVector x) {
   int ierr;
 
-  if (!vec->RestoreArrayRead)
-    // LCOV_EXCL_START
-    return CeedError(vec->ceed, 1, "Backend does not support RestoreArrayRead");
-  // LCOV_EXCL_STOP
+  ierr = CeedVectorCheckCompatible(x, y); CeedChk(ierr);
+  ierr = CeedVectorCheckCompatible(y, x); CeedChk(ierr);
 
-  ierr = vec->RestoreArrayRead(vec); CeedChk(ierr);
-  *array = NULL;
-  vec->numreaders--;
+  // Backend impl for GPU, if added
+  if (y->AXPBY && !CeedVectorAnyView(1, &x)) {
+    ierr = y->AXPBY(y, alpha, beta, x); CeedChk(ierr);
+    return 0;
+  }
+
+  CeedScalar *yarray;
+  const CeedScalar *xarray;
+  ierr = CeedVectorGetArray(y, CEED_MEM_HOST, &yarray); CeedChk(ierr);
+  if (x != y) {
+    ierr = CeedVectorGetArrayRead(x, CEED_MEM_HOST, &xarray); CeedChk(ierr);
+  } else {
+    xarray = yarray;
+  }
+  CeedPragmaSIMD
+  for (CeedInt i=0; i<y->length; i++)
+    yarray[i] = alpha*xarray[i] + beta*yarray[i];
+  if (x != y) {
+    ierr = CeedVectorRestoreArrayRead(x, &xarray); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArray(y, &yarray); CeedChk(ierr);
 
   return 0;
 }
 
 /**
-  @brief Get the norm of a CeedVector.
+  @brief Compute the pointwise product w = x .* y
 
-  Note: This operation is local to the CeedVector. This function will likely
-          not provide the desired results for the norm of the libCEED portion
-          of a parallel vector or a CeedVector with duplicated or hanging nodes.
-
-  @param vec           CeedVector to retrieve maximum value
-  @param type          Norm type @ref CEED_NORM_1, @ref CEED_NORM_2, or @ref CEED_NORM_MAX
-  @param[out] norm     Variable to store norm value
+  @param[out] w        CeedVector to store the product, may be the same as x
+                         or y
+  @param x             First CeedVector
+  @param y             Second CeedVector, may be the same as x
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
-int CeedVectorNorm(CeedVector vec, CeedNormType type, CeedScalar *norm) {
+int CeedVectorPointwiseMult(CeedVector w, CeedVector x, CeedVector y) {
   int ierr;
 
+  ierr = CeedVectorCheckCompatible(x, w); CeedChk(ierr);
+  ierr = CeedVectorCheckCompatible(y, w); CeedChk(ierr);
+
   // Backend impl for GPU, if added
-  if (vec->Norm) {
-    ierr = vec->Norm(vec, type, norm); CeedChk(ierr);
+  if (w->PointwiseMult && !CeedVectorAnyView(2, (CeedVector[]) {x, y})) {
+    ierr = w->PointwiseMult(w, x, y); CeedChk(ierr);
     return 0;
   }
 
-  const CeedScalar *array;
-  ierr = CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
-
-  *norm = 0.;
-  switch (type) {
-  case CEED_NORM_1:
-    for (int i=0; i<vec->length; i++) {
-      *norm += fabs(array[i]);
-    }
-    break;
-  case CEED_NORM_2:
-    for (int i=0; i<vec->length; i++) {
-      *norm += fabs(array[i])*fabs(array[i]);
-    }
-    break;
-  case CEED_NORM_MAX:
-    for (int i=0; i<vec->length; i++) {
-      const CeedScalar absi = fabs(array[i]);
-      *norm = *norm > absi ? *norm : absi;
-    }
+  CeedScalar *warray;
+  const CeedScalar *xarray, *yarray;
+  ierr = CeedVectorGetArray(w, CEED_MEM_HOST, &warray); CeedChk(ierr);
+  if (x != w) {
+    ierr = CeedVectorGetArrayRead(x, CEED_MEM_HOST, &xarray); CeedChk(ierr);
+  } else {
+    xarray = warray;
   }
-  if (type == CEED_NORM_2)
-    *norm = sqrt(*norm);
-
-  ierr = CeedVectorRestoreArrayRead(vec, &array); CeedChk(ierr);
+  if (y != w && y != x) {
+    ierr = CeedVectorGetArrayRead(y, CEED_MEM_HOST, &yarray); CeedChk(ierr);
+  } else {
+    yarray = y == w ? warray : xarray;
+  }
+  CeedPragmaSIMD
+  for (CeedInt i=0; i<w->length; i++)
+    warray[i] = xarray[i]*yarray[i];
+  if (y != w && y != x) {
+    ierr = CeedVectorRestoreArrayRead(y, &yarray); CeedChk(ierr);
+  }
+  if (x != w) {
+    ierr = CeedVectorRestoreArrayRead(x, &xarray); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArray(w, &warray); CeedChk(ierr);
 
   return 0;
 }
 
 /**
-  @brief Take the reciprocal of a CeedVector.
+  @brief Compute the dot product of two CeedVectors
 
-  @param vec           CeedVector to take reciprocal
+  @param x             First CeedVector
+  @param y             Second CeedVector, may be the same as x
+  @param[out] result   Variable to store the dot product
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
-int CeedVectorReciprocal(CeedVector vec) {
+int CeedVectorDot(CeedVector x, CeedVector y, CeedScalar *result) {
   int ierr;
 
-  // Check if vector data set
-  if (!vec->state)
-    // LCOV_EXCL_START
-    return CeedError(vec->ceed, 1,
-                     "CeedVector must have data set to take reciprocal");
-  // LCOV_EXCL_STOP
+  ierr = CeedVectorCheckCompatible(x, y); CeedChk(ierr);
+  ierr = CeedVectorCheckCompatible(y, x); CeedChk(ierr);
 
   // Backend impl for GPU, if added
-  if (vec->Reciprocal) {
-    ierr = vec->Reciprocal(vec); CeedChk(ierr);
+  if (x->Dot && !CeedVectorAnyView(1, &y)) {
+    ierr = x->Dot(x, y, result); CeedChk(ierr);
     return 0;
   }
 
-  CeedInt len;
-  ierr = CeedVectorGetLength(vec, &len); CeedChk(ierr);
-  CeedScalar *array;
-  ierr = CeedVectorGetArray(vec, CEED_MEM_HOST, &array); CeedChk(ierr);
-  for (CeedInt i=0; i<len; i++)
-    if (fabs(array[i]) > CEED_EPSILON)
-      array[i] = 1./array[i];
-  ierr = CeedVectorRestoreArray(vec, &array); CeedChk(ierr);
+  const CeedScalar *xarray, *yarray;
+  ierr = CeedVectorGetArrayRead(x, CEED_MEM_HOST, &xarray); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(y, CEED_MEM_HOST, &yarray); CeedChk(ierr);
+  CeedScalar sum = 0.;
+  for (CeedInt i=0; i<x->length; i++)
+    sum += xarray[i]*yarray[i];
+  *result = sum;
+  ierr = CeedVectorRestoreArrayRead(y, &yarray); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(x, &xarray); CeedChk(ierr);
 
   return 0;
 }
@@ -545,6 +2059,83 @@ int CeedVectorView(CeedVector vec, const char *fpfmt, FILE *stream) {
   return 0;
 }
 
+/**
+  @brief Save the values of a CeedVector to a binary file
+
+  The file records the precision of CeedScalar and, when @a rstr is given,
+    the size and layout of the restriction, so quadrature data computed once
+    can be restored with @ref CeedVectorLoad instead of rerunning the operator
+    that built it, e.g. when restarting a simulation.
+
+  @param vec           CeedVector to save
+  @param rstr          CeedElemRestriction of @a vec, or NULL
+  @param filename      Name of the file to write
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorSave(CeedVector vec, CeedElemRestriction rstr,
+                   const char *filename) {
+  int ierr;
+
+  FILE *stream = fopen(filename, "wb");
+  if (!stream)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Cannot open %s for writing", filename);
+  // LCOV_EXCL_STOP
+  ierr = CeedVectorWriteRecord(vec, rstr, stream);
+  if (fclose(stream) && !ierr)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Cannot write %s", filename);
+  // LCOV_EXCL_STOP
+  CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Load the values of a CeedVector from a file written by
+           @ref CeedVectorSave
+
+  The file is mapped into memory and its values copied into the vector. When
+    both the file and @a rstr have strided layouts that differ, such as
+    CEED_STRIDES_BACKEND written by one backend and read by another, the
+    values are permuted into the layout of @a rstr.
+
+  @param vec           CeedVector to load
+  @param rstr          CeedElemRestriction of @a vec, or NULL to copy the
+                         values without checking their layout
+  @param filename      Name of the file to read
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorLoad(CeedVector vec, CeedElemRestriction rstr,
+                   const char *filename) {
+  int ierr;
+  struct stat st;
+  size_t used;
+
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Cannot open %s for reading", filename);
+  // LCOV_EXCL_STOP
+  void *map = MAP_FAILED;
+  if (!fstat(fd, &st) && st.st_size > 0)
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED)
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, 1, "Cannot map %s", filename);
+  // LCOV_EXCL_STOP
+  ierr = CeedVectorReadRecord(vec, rstr, map, st.st_size, &used);
+  munmap(map, st.st_size);
+  CeedChk(ierr);
+  return 0;
+}
+
 /**
   @brief Get the length of a CeedVector
 
@@ -560,6 +2151,25 @@ int CeedVectorGetLength(CeedVector vec, CeedInt *length) {
   return 0;
 }
 
+/**
+  @brief Get the memory allocated for the data of a CeedVector
+
+  Arrays provided with CEED_USE_POINTER are not counted.
+
+  @param vec         CeedVector to retrieve memory usage
+  @param space       CeedMemSpace to get the usage of
+  @param[out] bytes  Variable to store the number of bytes allocated
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorGetMemoryUsage(CeedVector vec, CeedMemSpace space,
+                             size_t *bytes) {
+  *bytes = vec->memusage[space];
+  return 0;
+}
+
 /**
   @brief Destroy a CeedVector
 
@@ -572,7 +2182,7 @@ int CeedVectorGetLength(CeedVector vec, CeedInt *length) {
 int CeedVectorDestroy(CeedVector *vec) {
   int ierr;
 
-  if (!*vec || --(*vec)->refcount > 0) return 0;
+  if (!*vec || CeedDereference(*vec) > 0) return 0;
 
   if (((*vec)->state % 2) == 1)
     return CeedError((*vec)->ceed, 1,
@@ -586,6 +2196,10 @@ int CeedVectorDestroy(CeedVector *vec) {
   if ((*vec)->Destroy) {
     ierr = (*vec)->Destroy(*vec); CeedChk(ierr);
   }
+  for (CeedInt s=0; s<CEED_MEMSPACE_NUM; s++) {
+    const ptrdiff_t bytes = (*vec)->memusage[s];
+    ierr = CeedVectorTrackMemory(*vec, s, -bytes); CeedChk(ierr);
+  }
 
   ierr = CeedDestroy(&(*vec)->ceed); CeedChk(ierr);
   ierr = CeedFree(vec); CeedChk(ierr);
@@ -14,15 +14,24 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
-#define _POSIX_C_SOURCE 200112
+#define _POSIX_C_SOURCE 200809 // recursive mutexes
+#define _DEFAULT_SOURCE // madvise
 #include <ceed-impl.h>
 #include <ceed-backend.h>
+#include <ceed-hash.h>
+#include <fcntl.h>
 #include <limits.h>
 #include <stdarg.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef CEED_USE_PAPI
+#include <papi.h>
+#endif
 
 /// @cond DOXYGEN_SKIP
 static CeedRequest ceed_request_immediate;
@@ -37,6 +46,417 @@ static size_t num_backends;
 
 #define CEED_FTABLE_ENTRY(class, method) \
   {#class #method, offsetof(struct class ##_private, method)}
+
+// Lookup table of backend functions, indexed by name in CeedSetBackendFunction
+static const foffset foffsets[] = {
+  CEED_FTABLE_ENTRY(Ceed, Error),
+  CEED_FTABLE_ENTRY(Ceed, GetPreferredMemType),
+  CEED_FTABLE_ENTRY(Ceed, Destroy),
+  CEED_FTABLE_ENTRY(Ceed, VectorCreate),
+  CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreate),
+  CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreateBlocked),
+  CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreateCompressed),
+  CEED_FTABLE_ENTRY(Ceed, BasisCreateTensorH1),
+  CEED_FTABLE_ENTRY(Ceed, BasisCreateH1),
+  CEED_FTABLE_ENTRY(Ceed, TensorContractCreate),
+  CEED_FTABLE_ENTRY(Ceed, QFunctionCreate),
+  CEED_FTABLE_ENTRY(Ceed, QFunctionContextCreate),
+  CEED_FTABLE_ENTRY(Ceed, OperatorCreate),
+  CEED_FTABLE_ENTRY(Ceed, CompositeOperatorCreate),
+  CEED_FTABLE_ENTRY(Ceed, ProfilePush),
+  CEED_FTABLE_ENTRY(Ceed, ProfilePop),
+  CEED_FTABLE_ENTRY(Ceed, EnergyRead),
+  CEED_FTABLE_ENTRY(Ceed, MemoryPoolTrim),
+  CEED_FTABLE_ENTRY(Ceed, MemoryPoolGetUsage),
+  CEED_FTABLE_ENTRY(Ceed, SetCurrentDevice),
+  CEED_FTABLE_ENTRY(Ceed, ShareDevice),
+  CEED_FTABLE_ENTRY(CeedVector, SetArray),
+  CEED_FTABLE_ENTRY(CeedVector, TakeArray),
+  CEED_FTABLE_ENTRY(CeedVector, SetValue),
+  CEED_FTABLE_ENTRY(CeedVector, Copy),
+  CEED_FTABLE_ENTRY(CeedVector, SyncArray),
+  CEED_FTABLE_ENTRY(CeedVector, Snapshot),
+  CEED_FTABLE_ENTRY(CeedVector, GetArray),
+  CEED_FTABLE_ENTRY(CeedVector, GetArrayRead),
+  CEED_FTABLE_ENTRY(CeedVector, RestoreArray),
+  CEED_FTABLE_ENTRY(CeedVector, RestoreArrayRead),
+  CEED_FTABLE_ENTRY(CeedVector, Norm),
+  CEED_FTABLE_ENTRY(CeedVector, Reciprocal),
+  CEED_FTABLE_ENTRY(CeedVector, PointBlockInvert),
+  CEED_FTABLE_ENTRY(CeedVector, AXPY),
+  CEED_FTABLE_ENTRY(CeedVector, AXPBY),
+  CEED_FTABLE_ENTRY(CeedVector, PointwiseMult),
+  CEED_FTABLE_ENTRY(CeedVector, Dot),
+  CEED_FTABLE_ENTRY(CeedVector, Norms),
+  CEED_FTABLE_ENTRY(CeedVector, ReduceSegments),
+  CEED_FTABLE_ENTRY(CeedVector, DotVector),
+  CEED_FTABLE_ENTRY(CeedVector, MultiAXPBYDot),
+  CEED_FTABLE_ENTRY(CeedVector, ChebyshevUpdate),
+  CEED_FTABLE_ENTRY(CeedVector, Destroy),
+  CEED_FTABLE_ENTRY(CeedElemRestriction, Apply),
+  CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyBlock),
+  CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyOverwrite),
+  CEED_FTABLE_ENTRY(CeedElemRestriction, GetOffsets),
+  CEED_FTABLE_ENTRY(CeedElemRestriction, SetIndexType),
+  CEED_FTABLE_ENTRY(CeedElemRestriction, GetMultiplicity),
+  CEED_FTABLE_ENTRY(CeedElemRestriction, Destroy),
+  CEED_FTABLE_ENTRY(CeedBasis, Apply),
+  CEED_FTABLE_ENTRY(CeedBasis, Destroy),
+  CEED_FTABLE_ENTRY(CeedTensorContract, Apply),
+  CEED_FTABLE_ENTRY(CeedTensorContract, ApplyFull),
+  CEED_FTABLE_ENTRY(CeedTensorContract, Destroy),
+  CEED_FTABLE_ENTRY(CeedQFunction, Apply),
+  CEED_FTABLE_ENTRY(CeedQFunction, ApplyRaw),
+  CEED_FTABLE_ENTRY(CeedQFunction, SetCUDAUserFunction),
+  CEED_FTABLE_ENTRY(CeedQFunction, SetHIPUserFunction),
+  CEED_FTABLE_ENTRY(CeedQFunction, Destroy),
+  CEED_FTABLE_ENTRY(CeedQFunctionContext, SetData),
+  CEED_FTABLE_ENTRY(CeedQFunctionContext, GetData),
+  CEED_FTABLE_ENTRY(CeedQFunctionContext, RestoreData),
+  CEED_FTABLE_ENTRY(CeedQFunctionContext, SetField),
+  CEED_FTABLE_ENTRY(CeedQFunctionContext, Destroy),
+  CEED_FTABLE_ENTRY(CeedOperator, Prepare),
+  CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleQFunction),
+  CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleQFunctionUpdate),
+  CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleDiagonal),
+  CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleAddDiagonal),
+  CEED_FTABLE_ENTRY(CeedOperator, LinearAssemblePointBlockDiagonal),
+  CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleAddPointBlockDiagonal),
+  CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleSymbolic),
+  CEED_FTABLE_ENTRY(CeedOperator, LinearAssemble),
+  CEED_FTABLE_ENTRY(CeedOperator, CreateFDMElementInverse),
+  CEED_FTABLE_ENTRY(CeedOperator, Apply),
+  CEED_FTABLE_ENTRY(CeedOperator, ApplyComposite),
+  CEED_FTABLE_ENTRY(CeedOperator, ApplyAdd),
+  CEED_FTABLE_ENTRY(CeedOperator, ApplyAddComposite),
+  CEED_FTABLE_ENTRY(CeedOperator, ApplyDot),
+  CEED_FTABLE_ENTRY(CeedOperator, ApplyAddMultiple),
+  CEED_FTABLE_ENTRY(CeedOperator, ApplyJacobian),
+  CEED_FTABLE_ENTRY(CeedOperator, SetDirichlet),
+  CEED_FTABLE_ENTRY(CeedOperator, Destroy),
+  CEED_FTABLE_ENTRY(CeedRequest, Wait),
+  CEED_FTABLE_ENTRY(CeedRequest, Destroy),
+};
+
+KHASH_MAP_INIT_STR(CeedFunctionOffset, size_t)
+static khash_t(CeedFunctionOffset) *function_offsets;
+
+// Built when the library is loaded, like the backend registry, so that
+//   setting backend functions does not scan the table
+__attribute__((constructor))
+static void CeedFunctionOffsetsCreate(void) {
+  int ret;
+  function_offsets = kh_init(CeedFunctionOffset);
+  for (size_t i = 0; i < sizeof(foffsets)/sizeof(foffsets[0]); i++) {
+    khiter_t k = kh_put(CeedFunctionOffset, function_offsets, foffsets[i].fname,
+                        &ret);
+    kh_value(function_offsets, k) = foffsets[i].offset;
+  }
+}
+
+__attribute__((destructor))
+static void CeedFunctionOffsetsDestroy(void) {
+  kh_destroy(CeedFunctionOffset, function_offsets);
+}
+
+// Object delegates of a Ceed by object type name, which the interface looks
+//   up whenever it creates an object
+KHASH_MAP_INIT_STR(CeedObjectDelegate, Ceed)
+
+static const char *const CeedProfileStages[] = {
+  [CEED_PROFILE_OPERATOR]    = "CeedOperatorApply",
+  [CEED_PROFILE_RESTRICTION] = "CeedElemRestrictionApply",
+  [CEED_PROFILE_BASIS]       = "CeedBasisApply",
+  [CEED_PROFILE_QFUNCTION]   = "CeedQFunctionApply",
+  [CEED_PROFILE_TRANSFER]    = "CeedVectorTransfer",
+  [CEED_PROFILE_INIT]        = "CeedInit",
+  [CEED_PROFILE_COMPILE]     = "CeedCompile",
+};
+
+static const char *const CeedCounterNames[] = {
+  [CEED_COUNTER_L1_MISSES] = "L1 misses",
+  [CEED_COUNTER_L2_MISSES] = "L2 misses",
+  [CEED_COUNTER_L3_MISSES] = "L3 misses",
+  [CEED_COUNTER_FP_OPS]    = "FP ops",
+  [CEED_COUNTER_CYCLES]    = "Cycles",
+};
+
+#ifdef CEED_USE_PAPI
+// PAPI counts for the calling thread, so all Ceeds share one event set
+static int CeedPapiEventSet = PAPI_NULL, CeedPapiUsers = 0;
+static int CeedPapiSlots[CEED_NUM_COUNTERS];
+static const int CeedPapiEvents[CEED_NUM_COUNTERS] = {
+  [CEED_COUNTER_L1_MISSES] = PAPI_L1_DCM,
+  [CEED_COUNTER_L2_MISSES] = PAPI_L2_DCM,
+  [CEED_COUNTER_L3_MISSES] = PAPI_L3_TCM,
+  [CEED_COUNTER_FP_OPS]    = PAPI_FP_OPS,
+  [CEED_COUNTER_CYCLES]    = PAPI_TOT_CYC,
+};
+#endif
+
+// RAPL package domains are system-wide, so all Ceeds share the open files;
+//   the counters wrap around, so their increments are accumulated on each read
+#define CEED_RAPL_MAX_PACKAGES 16
+static int CeedRaplUsers = 0, CeedRaplNumPackages = 0;
+static int CeedRaplFds[CEED_RAPL_MAX_PACKAGES];
+static unsigned long long CeedRaplRange[CEED_RAPL_MAX_PACKAGES];
+static unsigned long long CeedRaplLast[CEED_RAPL_MAX_PACKAGES];
+static double CeedRaplTotal[CEED_RAPL_MAX_PACKAGES];
+
+// Profile data and JIT options are kept on the Ceed created by the user
+static int CeedGetUserCeed(Ceed ceed, Ceed *root) {
+  while (ceed->parent || ceed->opfallbackparent)
+    ceed = ceed->parent ? ceed->parent : ceed->opfallbackparent;
+  *root = ceed;
+  return 0;
+}
+
+// Append an event to the trace of a Ceed
+static int CeedTraceRecord(Ceed ceed, CeedTraceEvent event) {
+  int ierr = 0;
+  pthread_mutex_lock(&ceed->lock);
+  if (ceed->numtraceevents == ceed->maxtraceevents) {
+    ceed->maxtraceevents = ceed->maxtraceevents ? 2*ceed->maxtraceevents : 1024;
+    ierr = CeedRealloc(ceed->maxtraceevents, &ceed->traceevents);
+  }
+  if (!ierr)
+    ceed->traceevents[ceed->numtraceevents++] = event;
+  pthread_mutex_unlock(&ceed->lock);
+  CeedChk(ierr);
+  return 0;
+}
+
+// Start hardware counters for a Ceed on a CPU backend, if PAPI provides any;
+//   counters that are not available on this CPU are left out
+static int CeedCountersStart(Ceed ceed) {
+  ceed->countertried = true;
+#ifdef CEED_USE_PAPI
+  int ierr;
+  CeedMemType memtype;
+  ierr = CeedGetPreferredMemType(ceed, &memtype); CeedChk(ierr);
+  if (memtype != CEED_MEM_HOST) return 0;
+
+  if (!CeedPapiUsers) {
+    if (PAPI_is_initialized() == PAPI_NOT_INITED &&
+        PAPI_library_init(PAPI_VER_CURRENT) != PAPI_VER_CURRENT)
+      return 0;
+    if (PAPI_create_eventset(&CeedPapiEventSet) != PAPI_OK)
+      return 0;
+    int numslots = 0;
+    for (CeedInt i=0; i<CEED_NUM_COUNTERS; i++)
+      CeedPapiSlots[i] = PAPI_add_event(CeedPapiEventSet, CeedPapiEvents[i])
+                         == PAPI_OK ? numslots++ : -1;
+    if (!numslots || PAPI_start(CeedPapiEventSet) != PAPI_OK) {
+      PAPI_cleanup_eventset(CeedPapiEventSet);
+      PAPI_destroy_eventset(&CeedPapiEventSet);
+      return 0;
+    }
+  }
+  CeedPapiUsers++;
+  ceed->counting = true;
+#endif
+  return 0;
+}
+
+// Read the hardware counters, 0 for counters that are not available
+static void CeedCountersRead(long long values[CEED_NUM_COUNTERS]) {
+  for (CeedInt i=0; i<CEED_NUM_COUNTERS; i++)
+    values[i] = 0;
+#ifdef CEED_USE_PAPI
+  long long raw[CEED_NUM_COUNTERS];
+  if (PAPI_read(CeedPapiEventSet, raw) != PAPI_OK) return;
+  for (CeedInt i=0; i<CEED_NUM_COUNTERS; i++)
+    if (CeedPapiSlots[i] >= 0)
+      values[i] = raw[CeedPapiSlots[i]];
+#endif
+}
+
+// Check if a hardware counter is collected
+static bool CeedCounterAvailable(CeedCounter counter) {
+#ifdef CEED_USE_PAPI
+  return CeedPapiUsers && CeedPapiSlots[counter] >= 0;
+#else
+  return false;
+#endif
+}
+
+// Release the hardware counters held by a Ceed
+static void CeedCountersStop(Ceed ceed) {
+  if (!ceed->counting) return;
+  ceed->counting = false;
+#ifdef CEED_USE_PAPI
+  if (--CeedPapiUsers) return;
+  PAPI_stop(CeedPapiEventSet, NULL);
+  PAPI_cleanup_eventset(CeedPapiEventSet);
+  PAPI_destroy_eventset(&CeedPapiEventSet);
+#endif
+}
+
+// Read a counter in microjoules from a RAPL sysfs file
+static bool CeedRaplReadFile(int fd, unsigned long long *value) {
+  char buf[32];
+  ssize_t len = pread(fd, buf, sizeof(buf) - 1, 0);
+  if (len <= 0) return false;
+  buf[len] = '\0';
+  *value = strtoull(buf, NULL, 10);
+  return true;
+}
+
+// Open the RAPL package domains, if the powercap interface is readable; since
+//   Linux 5.10 the counters are only readable by root unless permitted
+static void CeedRaplStart(Ceed ceed) {
+  if (!CeedRaplUsers) {
+    CeedRaplNumPackages = 0;
+    for (CeedInt p=0; p<CEED_RAPL_MAX_PACKAGES; p++) {
+      char path[64];
+      snprintf(path, sizeof(path),
+               "/sys/class/powercap/intel-rapl:%d/max_energy_range_uj", p);
+      int fd = open(path, O_RDONLY);
+      if (fd < 0) break;
+      bool ok = CeedRaplReadFile(fd, &CeedRaplRange[p]);
+      close(fd);
+      snprintf(path, sizeof(path),
+               "/sys/class/powercap/intel-rapl:%d/energy_uj", p);
+      fd = ok ? open(path, O_RDONLY) : -1;
+      if (fd < 0 || !CeedRaplReadFile(fd, &CeedRaplLast[p])) {
+        if (fd >= 0) close(fd);
+        break;
+      }
+      CeedRaplFds[p] = fd;
+      CeedRaplTotal[p] = 0.;
+      CeedRaplNumPackages++;
+    }
+    if (!CeedRaplNumPackages) return;
+  }
+  CeedRaplUsers++;
+  ceed->energyavail[CEED_ENERGY_HOST] = true;
+}
+
+// Read the energy used by all CPU packages since CeedRaplStart(), in joules
+static double CeedRaplRead(void) {
+  double total = 0.;
+  for (CeedInt p=0; p<CeedRaplNumPackages; p++) {
+    unsigned long long value;
+    if (CeedRaplReadFile(CeedRaplFds[p], &value)) {
+      unsigned long long delta = value >= CeedRaplLast[p] ? value -
+                                 CeedRaplLast[p] : value + CeedRaplRange[p] -
+                                 CeedRaplLast[p];
+      CeedRaplTotal[p] += 1e-6*delta;
+      CeedRaplLast[p] = value;
+    }
+    total += CeedRaplTotal[p];
+  }
+  return total;
+}
+
+// Read the energy of each available source, in joules
+static int CeedEnergyRead(Ceed ceed, double energy[CEED_NUM_ENERGY]) {
+  int ierr;
+  energy[CEED_ENERGY_HOST] = energy[CEED_ENERGY_DEVICE] = 0.;
+  if (ceed->energyavail[CEED_ENERGY_HOST])
+    energy[CEED_ENERGY_HOST] = CeedRaplRead();
+  if (ceed->energyavail[CEED_ENERGY_DEVICE])
+    for (Ceed c = ceed; c; c = c->delegate)
+      if (c->EnergyRead) {
+        ierr = c->EnergyRead(c, &energy[CEED_ENERGY_DEVICE]); CeedChk(ierr);
+        break;
+      }
+  return 0;
+}
+
+// Probe the energy sources of a Ceed: RAPL on the host and, for GPU backends
+//   providing EnergyRead, the device
+static int CeedEnergyStart(Ceed ceed) {
+  int ierr;
+  ceed->energytried = true;
+  CeedRaplStart(ceed);
+  for (Ceed c = ceed; c; c = c->delegate)
+    if (c->EnergyRead) {
+      double joules;
+      ierr = c->EnergyRead(c, &joules); CeedChk(ierr);
+      ceed->energyavail[CEED_ENERGY_DEVICE] = joules >= 0;
+      break;
+    }
+  return 0;
+}
+
+// Release the RAPL files held by a Ceed
+static void CeedEnergyStop(Ceed ceed) {
+  if (!ceed->energyavail[CEED_ENERGY_HOST]) return;
+  ceed->energyavail[CEED_ENERGY_HOST] = false;
+  if (--CeedRaplUsers) return;
+  for (CeedInt p=0; p<CeedRaplNumPackages; p++)
+    close(CeedRaplFds[p]);
+  CeedRaplNumPackages = 0;
+}
+
+// Write one complete event in Chrome trace format, times in microseconds
+static void CeedTraceWriteEvent(FILE *stream, const CeedTraceEvent *event,
+                                double start, double end, int pid, int tid) {
+  fprintf(stream, ",\n{\"name\":\"%s\",\"cat\":\"libCEED\",\"ph\":\"X\","
+          "\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%d",
+          CeedProfileStages[event->stage], 1e6*start, 1e6*(end - start), pid,
+          tid);
+  if (event->bytes > 0 || event->flops > 0)
+    fprintf(stream, ",\"args\":{\"bytes\":%.0f,\"flops\":%.0f}",
+            event->bytes, event->flops);
+  fprintf(stream, "}");
+}
+
+// Write the trace of a Ceed as Chrome trace JSON, with host stages on one
+//   thread and their device execution, if timed by the backend, on another.
+//   Times are shifted to the real-time clock, so traces from several
+//   processes line up. A "%d" in the file name is replaced by the process id.
+static int CeedTraceWrite(Ceed ceed) {
+  int ierr;
+  const int pid = (int)getpid();
+  const size_t len = strlen(ceed->tracefile) + 16;
+  char *filename;
+  ierr = CeedMalloc(len, &filename); CeedChk(ierr);
+  const char *pos = strstr(ceed->tracefile, "%d");
+  if (pos)
+    snprintf(filename, len, "%.*s%d%s", (int)(pos - ceed->tracefile),
+             ceed->tracefile, pid, pos + 2);
+  else
+    snprintf(filename, len, "%s", ceed->tracefile);
+  FILE *stream = fopen(filename, "w");
+  if (!stream)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Unable to open trace file %s", filename);
+  // LCOV_EXCL_STOP
+
+  struct timespec real, mono;
+  clock_gettime(CLOCK_REALTIME, &real);
+  clock_gettime(CLOCK_MONOTONIC, &mono);
+  const double offset = real.tv_sec - mono.tv_sec +
+                        1e-9*(real.tv_nsec - mono.tv_nsec);
+  fprintf(stream, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+  fprintf(stream, "\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+          "\"args\":{\"name\":\"libCEED %s\"}}", pid, ceed->resource);
+  fprintf(stream, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,"
+          "\"tid\":0,\"args\":{\"name\":\"host\"}}", pid);
+  bool device = false;
+  for (size_t i=0; i<ceed->numtraceevents; i++)
+    device = device || ceed->traceevents[i].devstart >= 0;
+  if (device)
+    fprintf(stream, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,"
+            "\"tid\":1,\"args\":{\"name\":\"device\"}}", pid);
+  for (size_t i=0; i<ceed->numtraceevents; i++) {
+    const CeedTraceEvent *event = &ceed->traceevents[i];
+    CeedTraceWriteEvent(stream, event, event->start + offset,
+                        event->end + offset, pid, 0);
+    if (event->devstart >= 0)
+      CeedTraceWriteEvent(stream, event, event->devstart + offset,
+                          event->devend + offset, pid, 1);
+  }
+  fprintf(stream, "\n]}\n");
+  if (fclose(stream))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Unable to write trace file %s", filename);
+  // LCOV_EXCL_STOP
+  ierr = CeedFree(&filename); CeedChk(ierr);
+  return 0;
+}
 /// @endcond
 
 /// @file
@@ -97,7 +517,9 @@ CeedRequest *const CEED_REQUEST_ORDERED = &ceed_request_ordered;
 /**
   @brief Wait for a CeedRequest to complete.
 
-  Calling CeedRequestWait on a NULL request is a no-op.
+  Calling CeedRequestWait on a NULL request is a no-op.  Interfaces that
+    complete before returning set a caller-owned request to NULL, so waiting
+    on it is always valid.
 
   @param req Address of CeedRequest to wait for; zeroed on completion.
 
@@ -106,9 +528,18 @@ CeedRequest *const CEED_REQUEST_ORDERED = &ceed_request_ordered;
   @ref User
 **/
 int CeedRequestWait(CeedRequest *req) {
+  int ierr;
   if (!*req)
     return 0;
-  return CeedError(NULL, 2, "CeedRequestWait not implemented");
+
+  if ((*req)->Wait) {
+    ierr = (*req)->Wait(*req); CeedChk(ierr);
+  }
+  if ((*req)->Destroy) {
+    ierr = (*req)->Destroy(*req); CeedChk(ierr);
+  }
+  ierr = CeedFree(req); CeedChk(ierr);
+  return 0;
 }
 
 /// @}
@@ -179,6 +610,10 @@ void CeedDebugImpl256(const Ceed ceed, const unsigned char color,
 
   Memory usage can be tracked by the library.  This ensures sufficient
     alignment for vectorization and should be used for large allocations.
+    Allocations of at least CEED_HUGE_PAGE_SIZE bytes are aligned to a huge
+    page and advised to be backed by transparent huge pages, reducing TLB
+    misses of the gathers and scatters in element restrictions; set the
+    environment variable CEED_HUGE_PAGES=0 to disable this.
 
   @param n Number of units to allocate
   @param unit Size of each unit
@@ -191,12 +626,22 @@ void CeedDebugImpl256(const Ceed ceed, const unsigned char color,
   @ref Backend
 **/
 int CeedMallocArray(size_t n, size_t unit, void *p) {
-  int ierr = posix_memalign((void **)p, CEED_ALIGN, n*unit);
+  const size_t bytes = n*unit;
+  const char *hugepages = getenv("CEED_HUGE_PAGES");
+  const bool huge = bytes >= CEED_HUGE_PAGE_SIZE &&
+                    !(hugepages && !strcmp(hugepages, "0"));
+  int ierr = posix_memalign((void **)p, huge ? CEED_HUGE_PAGE_SIZE : CEED_ALIGN,
+                            bytes);
   if (ierr)
     // LCOV_EXCL_START
     return CeedError(NULL, ierr, "posix_memalign failed to allocate %zd "
                      "members of size %zd\n", n, unit);
   // LCOV_EXCL_STOP
+#ifdef MADV_HUGEPAGE
+  // Only advisory; regular pages are used if the kernel declines
+  if (huge)
+    madvise(*(void **)p, bytes - bytes%CEED_HUGE_PAGE_SIZE, MADV_HUGEPAGE);
+#endif
 
   return 0;
 }
@@ -253,11 +698,17 @@ int CeedReallocArray(size_t n, size_t unit, void *p) {
   return 0;
 }
 
-/** Free memory allocated using CeedMalloc() or CeedCalloc()
+/**
+  @brief Free memory allocated using CeedMalloc() or CeedCalloc(), including
+           arrays that the library returns to the user
 
   @param p address of pointer to memory.  This argument is of type void* to
              avoid needing a cast, but is the address of the pointer (which is
              zeroed) rather than the pointer.
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
 **/
 int CeedFree(void *p) {
   free(*(void **)p);
@@ -265,6 +716,124 @@ int CeedFree(void *p) {
   return 0;
 }
 
+/**
+  @brief Allocate memory through the allocator of a Ceed
+
+  When the user set an allocator with CeedSetAllocator(), the memory is taken
+    from it; otherwise @a used is false and the backend allocates the memory
+    itself.
+
+  @param ceed        Ceed context
+  @param space       CeedMemSpace to allocate in
+  @param bytes       Number of bytes to allocate
+  @param p           Address of pointer to hold the result
+  @param[out] used   Boolean flag set when the allocator of the Ceed was used
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @sa CeedAllocatorFree()
+
+  @ref Backend
+**/
+int CeedAllocatorMalloc(Ceed ceed, CeedMemSpace space, size_t bytes, void *p,
+                        bool *used) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+
+  *used = root->alloc != NULL;
+  if (!*used) return 0;
+  *(void **)p = NULL;
+  if (!bytes) return 0;
+  ierr = root->alloc(root->allocctx, space, bytes, (void **)p);
+  if (ierr || !*(void **)p)
+    // LCOV_EXCL_START
+    return CeedError(ceed, ierr ? ierr : 1, "Allocator failed to allocate %zu "
+                     "bytes of %s memory", bytes, CeedMemSpaces[space]);
+  // LCOV_EXCL_STOP
+  return 0;
+}
+
+/**
+  @brief Free memory allocated by CeedAllocatorMalloc()
+
+  @param ceed        Ceed context
+  @param space       CeedMemSpace of the memory
+  @param p           Address of pointer to the memory, zeroed when freed, or
+                       NULL to only query whether the Ceed has an allocator
+  @param[out] used   Boolean flag set when the allocator of the Ceed was used
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedAllocatorFree(Ceed ceed, CeedMemSpace space, void *p, bool *used) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+
+  *used = root->dealloc != NULL;
+  if (!*used || !p) return 0;
+  if (*(void **)p) {
+    ierr = root->dealloc(root->allocctx, space, *(void **)p);
+    if (ierr)
+      // LCOV_EXCL_START
+      return CeedError(ceed, ierr, "Allocator failed to free %s memory",
+                       CeedMemSpaces[space]);
+    // LCOV_EXCL_STOP
+  }
+  *(void **)p = NULL;
+  return 0;
+}
+
+/**
+  @brief Allocate a large host array of a libCEED object; use CeedMallocHost()
+
+  The array is taken from the allocator set with CeedSetAllocator() when there
+    is one, and allocated like CeedMalloc() otherwise.
+
+  @param ceed  Ceed context
+  @param n     Number of units to allocate
+  @param unit  Size of each unit
+  @param p     Address of pointer to hold the result
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @sa CeedFreeHost()
+
+  @ref Backend
+**/
+int CeedMallocHostArray(Ceed ceed, size_t n, size_t unit, void *p) {
+  int ierr;
+  bool used;
+  ierr = CeedAllocatorMalloc(ceed, CEED_MEMSPACE_HOST, n*unit, p, &used);
+  CeedChk(ierr);
+  if (!used) {
+    ierr = CeedMallocArray(n, unit, p); CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Free a host array allocated with CeedMallocHost()
+
+  @param ceed  Ceed context
+  @param p     Address of pointer to the array, zeroed when freed
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedFreeHost(Ceed ceed, void *p) {
+  int ierr;
+  bool used;
+  ierr = CeedAllocatorFree(ceed, CEED_MEMSPACE_HOST, p, &used); CeedChk(ierr);
+  if (!used) {
+    ierr = CeedFree(p); CeedChk(ierr);
+  }
+  return 0;
+}
+
 /**
   @brief Register a Ceed backend
 
@@ -295,6 +864,24 @@ int CeedRegister(const char *prefix, int (*init)(const char *, Ceed),
   return 0;
 }
 
+/**
+  @brief Check whether a backend is registered for a resource prefix
+
+  @param prefix             Resource prefix, matched exactly
+  @param[out] isregistered  Variable to store the registration status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedIsRegistered(const char *prefix, bool *isregistered) {
+  *isregistered = false;
+  for (size_t i=0; i<num_backends; i++)
+    if (!strcmp(backends[i].prefix, prefix))
+      *isregistered = true;
+  return 0;
+}
+
 /**
   @brief Return debugging status flag
 
@@ -380,11 +967,13 @@ int CeedGetObjectDelegate(Ceed ceed, Ceed *delegate, const char *objname) {
   CeedInt ierr;
 
   // Check for object delegate
-  for (CeedInt i=0; i<ceed->objdelegatecount; i++)
-    if (!strcmp(objname, ceed->objdelegates->objname)) {
-      *delegate = ceed->objdelegates->delegate;
+  if (ceed->objdelegatemap) {
+    khiter_t k = kh_get(CeedObjectDelegate, ceed->objdelegatemap, objname);
+    if (k != kh_end(ceed->objdelegatemap)) {
+      *delegate = kh_value(ceed->objdelegatemap, k);
       return 0;
     }
+  }
 
   // Use default delegate if no object delegate
   ierr = CeedGetDelegate(ceed, delegate); CeedChk(ierr);
@@ -427,6 +1016,19 @@ int CeedSetObjectDelegate(Ceed ceed, Ceed delegate, const char *objname) {
   ierr = CeedMalloc(slen, &ceed->objdelegates[count].objname); CeedChk(ierr);
   memcpy(ceed->objdelegates[count].objname, objname, slen);
 
+  // Index the delegate by object type, keeping the first delegate set
+  int ret;
+  if (!ceed->objdelegatemap)
+    ceed->objdelegatemap = kh_init(CeedObjectDelegate);
+  khiter_t k = kh_put(CeedObjectDelegate, ceed->objdelegatemap,
+                      ceed->objdelegates[count].objname, &ret);
+  if (ret < 0)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Failed to index the object delegate");
+  // LCOV_EXCL_STOP
+  if (ret > 0)
+    kh_value(ceed->objdelegatemap, k) = delegate;
+
   // Set delegate parent
   delegate->parent = ceed;
 
@@ -511,113 +1113,745 @@ int CeedSetDeterministic(Ceed ceed, bool isDeterministic) {
 }
 
 /**
-  @brief Set a backend function
+  @brief Start timing a profiled stage
 
-  This function is used for a backend to set the function associated with
-  the Ceed objects. For example,
-    CeedSetBackendFunction(ceed, "Ceed", ceed, "VectorCreate", BackendVectorCreate)
-  sets the backend implementation of 'CeedVectorCreate' and
-    CeedSetBackendFunction(ceed, "Basis", basis, "Apply", BackendBasisApply)
-  sets the backend implementation of 'CeedBasisApply'. Note, the prefix 'Ceed'
-  is not required for the object type ("Basis" vs "CeedBasis").
+  When profiling is enabled, this opens a backend trace range, if the backend
+  provides one, and records the start time for CeedProfileStop().  When
+  libCEED is built with PAPI, hardware counters are also read on CPU backends.
+  The energy used by CeedOperator applications is read from RAPL for the CPU
+  packages, when readable, and from NVML or ROCm SMI for GPU backends built
+  with them.
 
-  @param ceed           Ceed context for error handling
-  @param type           Type of Ceed object to set function for
-  @param[out] object    Ceed object to set function for
-  @param fname          Name of function to set
-  @param f              Function to set
+  @param ceed        Ceed context of the object being applied
+  @param stage       CeedProfileStage being timed
+  @param[out] start  Variable to store start time, negative if not profiling
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref Backend
 **/
-int CeedSetBackendFunction(Ceed ceed, const char *type, void *object,
-                           const char *fname, int (*f)()) {
-  char lookupname[CEED_MAX_RESOURCE_LEN+1] = "";
+int CeedProfileStart(Ceed ceed, CeedProfileStage stage, double *start) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
 
-  // Build lookup name
-  if (strcmp(type, "Ceed"))
-    strncat (lookupname, "Ceed", CEED_MAX_RESOURCE_LEN);
-  strncat(lookupname, type, CEED_MAX_RESOURCE_LEN);
-  strncat(lookupname, fname, CEED_MAX_RESOURCE_LEN);
+  *start = -1.0;
+  if (!(root->profile || root->tracefile) ||
+      (root->profilesuspended && stage != CEED_PROFILE_OPERATOR))
+    return 0;
 
-  // Find and use offset
-  for (CeedInt i = 0; ceed->foffsets[i].fname; i++)
-    if (!strcmp(ceed->foffsets[i].fname, lookupname)) {
-      size_t offset = ceed->foffsets[i].offset;
-      int (**fpointer)(void) = (int (**)(void))((char *)object + offset); // *NOPAD*
-      *fpointer = f;
-      return 0;
+  for (Ceed c = root; c; c = c->delegate)
+    if (c->ProfilePush) {
+      ierr = c->ProfilePush(c, CeedProfileStages[stage]); CeedChk(ierr);
+      break;
+    }
+  if (root->profile && !root->countertried) {
+    ierr = CeedCountersStart(root); CeedChk(ierr);
+  }
+  if (root->counting) {
+    if (root->counterdepth < CEED_COUNTER_MAX_DEPTH)
+      CeedCountersRead(root->counterstart[root->counterdepth]);
+    root->counterdepth++;
+  }
+  if (stage == CEED_PROFILE_OPERATOR && root->profile) {
+    if (!root->energytried) {
+      ierr = CeedEnergyStart(root); CeedChk(ierr);
+    }
+    if (root->energyavail[CEED_ENERGY_HOST] ||
+        root->energyavail[CEED_ENERGY_DEVICE]) {
+      if (root->energydepth < CEED_COUNTER_MAX_DEPTH) {
+        ierr = CeedEnergyRead(root, root->energystart[root->energydepth]);
+        CeedChk(ierr);
+      }
+      root->energydepth++;
     }
+  }
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  *start = ts.tv_sec + 1e-9*ts.tv_nsec;
+  return 0;
+}
 
-  // LCOV_EXCL_START
-  return CeedError(ceed, 1, "Requested function '%s' was not found for CEED "
-                   "object '%s'", fname, type);
-  // LCOV_EXCL_STOP
+// Stop timing a profiled stage; the DoFs are counted for operator stages
+static int CeedProfileStopStage(Ceed ceed, CeedProfileStage stage,
+                                double start, double bytes, double flops,
+                                double dofs) {
+  int ierr;
+  if (start < 0) return 0;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+
+  double devstart = -1.0, devend = -1.0;
+  for (Ceed c = root; c; c = c->delegate)
+    if (c->ProfilePop) {
+      ierr = c->ProfilePop(c, &devstart, &devend); CeedChk(ierr);
+      break;
+    }
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  const double end = ts.tv_sec + 1e-9*ts.tv_nsec, elapsed = end - start;
+
+  // Counters are read once per stage, nested stages count towards both
+  long long counters[CEED_NUM_COUNTERS] = {0};
+  if (root->counting && root->counterdepth > 0 &&
+      --root->counterdepth < CEED_COUNTER_MAX_DEPTH) {
+    CeedCountersRead(counters);
+    for (CeedInt i=0; i<CEED_NUM_COUNTERS; i++)
+      counters[i] -= root->counterstart[root->counterdepth][i];
+  }
+
+  // Energy is read after the backend completes device work
+  double energy[CEED_NUM_ENERGY] = {0};
+  bool measured = false;
+  if (stage == CEED_PROFILE_OPERATOR && root->energydepth > 0 &&
+      --root->energydepth < CEED_COUNTER_MAX_DEPTH) {
+    ierr = CeedEnergyRead(root, energy); CeedChk(ierr);
+    for (CeedInt i=0; i<CEED_NUM_ENERGY; i++)
+      energy[i] -= root->energystart[root->energydepth][i];
+    measured = true;
+  }
+
+  if (root->tracefile) {
+    // Compilation does not run on the device
+    if (stage == CEED_PROFILE_COMPILE)
+      devstart = devend = -1.0;
+    CeedTraceEvent event = {stage, start, end, devstart, devend, bytes, flops};
+    ierr = CeedTraceRecord(root, event); CeedChk(ierr);
+  }
+
+  // Nested operator applications are only counted once in the Ceed totals
+  CeedProfileData *data[2] = {NULL, NULL};
+  if (stage != CEED_PROFILE_OPERATOR || root->profiledepth == 1)
+    data[0] = &root->profiledata;
+  if (root->profileop)
+    data[1] = &root->profileop->profiledata;
+  for (CeedInt i=0; i<2; i++) {
+    if (!data[i]) continue;
+    data[i]->count[stage]++;
+    data[i]->time[stage] += elapsed;
+    data[i]->bytes[stage] += bytes;
+    data[i]->flops[stage] += flops;
+    for (CeedInt j=0; j<CEED_NUM_COUNTERS; j++)
+      data[i]->counters[stage][j] += counters[j];
+    for (CeedInt j=0; measured && j<CEED_NUM_ENERGY; j++)
+      if (root->energyavail[j]) {
+        data[i]->energycount[j]++;
+        data[i]->energy[j] += energy[j];
+        data[i]->dofs[j] += dofs;
+      }
+  }
+  return 0;
 }
 
 /**
-  @brief Retrieve backend data for a Ceed context
+  @brief Stop timing a profiled stage
 
-  @param ceed      Ceed context to retrieve data of
-  @param[out] data Address to save data to
+  The elapsed time is added to the totals for the Ceed and for the innermost
+  CeedOperator being applied, and the stage is appended to the trace when
+  tracing.  Backends with asynchronous execution complete outstanding work
+  before the time is recorded, and may report when the stage ran on the device.
+
+  @param ceed   Ceed context of the object being applied
+  @param stage  CeedProfileStage being timed
+  @param start  Start time from CeedProfileStart()
+  @param bytes  Number of bytes moved by the stage, or 0 if not counted
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref Backend
 **/
-int CeedGetData(Ceed ceed, void *data) {
-  *(void **)data = ceed->data;
-  return 0;
+int CeedProfileStop(Ceed ceed, CeedProfileStage stage, double start,
+                    double bytes) {
+  return CeedProfileStopFlops(ceed, stage, start, bytes, 0);
 }
 
 /**
-  @brief Set backend data for a Ceed context
+  @brief Stop timing a profiled stage, also counting its flops
 
-  @param ceed           Ceed context to set data of
-  @param data           Address of data to set
+  @param ceed   Ceed context of the object being applied
+  @param stage  CeedProfileStage being timed
+  @param start  Start time from CeedProfileStart()
+  @param bytes  Number of bytes moved by the stage, or 0 if not counted
+  @param flops  Number of flops of the stage, or 0 if not counted
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedProfileStopFlops(Ceed ceed, CeedProfileStage stage, double start,
+                         double bytes, double flops) {
+  return CeedProfileStopStage(ceed, stage, start, bytes, flops, 0);
+}
+
+/**
+  @brief Stop timing a CeedOperator application
+
+  @param ceed   Ceed context of the CeedOperator
+  @param start  Start time from CeedProfileStart()
+  @param bytes  Number of bytes moved by the application, or 0 if not counted
+  @param flops  Number of flops of the application, or 0 if not counted
+  @param dofs   Number of DoFs of the output vectors, for the energy per DoF
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedProfileStopOperator(Ceed ceed, double start, double bytes,
+                            double flops, double dofs) {
+  return CeedProfileStopStage(ceed, CEED_PROFILE_OPERATOR, start, bytes, flops,
+                              dofs);
+}
+
+/**
+  @brief Suspend profiling of stages within an operator application
+
+  Backends that apply stages concurrently from several threads suspend stage
+  profiling while the threads run; the full CeedOperator application is still
+  timed.
+
+  @param ceed     Ceed context
+  @param suspend  Boolean flag to suspend (true) or resume (false) profiling
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref Backend
 **/
-int CeedSetData(Ceed ceed, void *data) {
-  ceed->data = data;
+int CeedProfileSuspend(Ceed ceed, bool suspend) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+
+  root->profilesuspended = suspend;
   return 0;
 }
 
-/// @}
+/**
+  @brief Record the interface function accessing the array of a CeedVector
 
-/// ----------------------------------------------------------------------------
-/// Ceed Public API
-/// ----------------------------------------------------------------------------
-/// @addtogroup CeedUser
-/// @{
+  The call site is reported by CeedVectorAuditTransfer() for transfers made
+    to grant the access. It is only recorded while transfers are audited.
+
+  @param vec     CeedVector being accessed
+  @param site    Name of the interface function
+  @param caller  Return address of the interface function
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedVectorSetAuditSite(CeedVector vec, const char *site, void *caller) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(vec->ceed, &root); CeedChk(ierr);
+
+  if (root->syncaudit != CEED_SYNC_AUDIT_NONE) {
+    vec->auditsite = site;
+    vec->auditcaller = caller;
+  }
+  return 0;
+}
 
 /**
-  @brief Initialize a \ref Ceed context to use the specified resource.
+  @brief Audit a transfer of CeedVector data between host and device
 
-  @param resource  Resource to use, e.g., "/cpu/self"
-  @param ceed      The library context
-  @sa CeedRegister() CeedDestroy()
+  Backends call this before each copy or migration of vector data between
+    host and device memory. When auditing is enabled with CeedSetSyncAudit(),
+    the transfer is counted and logged to stderr with its size, the
+    CeedVector, and the interface function and return address that requested
+    the access. The address can be resolved with addr2line. In
+    CEED_SYNC_AUDIT_ERROR mode, a transfer to the host within a region opened
+    by CeedSyncAuditRegionBegin() is an error.
+
+  @param vec    CeedVector whose data is transferred
+  @param dest   Destination memory type of the transfer
+  @param bytes  Number of bytes transferred
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref User
+  @ref Backend
 **/
-int CeedInit(const char *resource, Ceed *ceed) {
+int CeedVectorAuditTransfer(CeedVector vec, CeedMemType dest, size_t bytes) {
   int ierr;
-  size_t matchlen = 0, matchidx = UINT_MAX, matchpriority = UINT_MAX, priority;
+  Ceed root;
+  ierr = CeedGetUserCeed(vec->ceed, &root); CeedChk(ierr);
 
-  // Find matching backend
-  if (!resource)
-    // LCOV_EXCL_START
-    return CeedError(NULL, 1, "No resource provided");
-  // LCOV_EXCL_STOP
+  if (root->syncaudit == CEED_SYNC_AUDIT_NONE)
+    return 0;
 
-  for (size_t i=0; i<num_backends; i++) {
-    size_t n;
-    const char *prefix = backends[i].prefix;
+  const bool tohost = dest == CEED_MEM_HOST;
+  pthread_mutex_lock(&root->lock);
+  root->numtransfers[tohost ? CEED_MEM_HOST : CEED_MEM_DEVICE]++;
+  root->transferbytes[tohost ? CEED_MEM_HOST : CEED_MEM_DEVICE] += bytes;
+  const char *region = root->auditdepth ?
+                       root->auditregions[root->auditdepth-1] : NULL;
+  pthread_mutex_unlock(&root->lock);
+
+  const char *site = vec->auditsite ? vec->auditsite : "unknown";
+  fprintf(stderr, "CeedSyncAudit: %s %zu bytes of CeedVector %p of length %d,"
+          " for %s called from %p%s%s%s\n", tohost ? "D2H" : "H2D", bytes,
+          (void *)vec, vec->length, site, vec->auditcaller,
+          region ? " in region \"" : "", region ? region : "",
+          region ? "\"" : "");
+  if (root->syncaudit == CEED_SYNC_AUDIT_ERROR && tohost && region)
+    return CeedError(vec->ceed, 1, "Device to host transfer of a CeedVector "
+                     "for %s in audited region \"%s\"", site, region);
+  return 0;
+}
+
+/**
+  @brief Record the resource usage of a kernel compiled at runtime
+
+  Kernels are recorded on the Ceed created by the user and printed by
+    CeedView(). Kernels with the same name and usage are counted once.
+
+  @param ceed  Ceed context compiling the kernel
+  @param info  CeedKernelInfo of the kernel
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedAddKernelInfo(Ceed ceed, const CeedKernelInfo *info) {
+  int ierr = 0;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+
+  pthread_mutex_lock(&root->lock);
+  CeedInt k = 0;
+  for (; k<root->numkernels; k++) {
+    const CeedKernelInfo *other = &root->kernels[k];
+    if (!strcmp(other->name, info->name) &&
+        other->registers == info->registers &&
+        other->localbytes == info->localbytes &&
+        other->sharedbytes == info->sharedbytes &&
+        other->blocksize == info->blocksize)
+      break;
+  }
+  if (k == root->numkernels && k == root->maxkernels) {
+    root->maxkernels = root->maxkernels ? 2*root->maxkernels : 16;
+    ierr = CeedRealloc(root->maxkernels, &root->kernels);
+    if (!ierr)
+      ierr = CeedRealloc(root->maxkernels, &root->kernelcounts);
+  }
+  if (!ierr) {
+    if (k == root->numkernels) {
+      root->kernels[k] = *info;
+      root->kernelcounts[k] = 0;
+      root->numkernels++;
+    }
+    root->kernelcounts[k]++;
+  }
+  pthread_mutex_unlock(&root->lock);
+  CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Account for memory allocated or freed by a backend
+
+  Usage is recorded on the Ceed created by the user, so allocations made by
+    delegate Ceeds are included. Objects with their own accounting, such as
+    CeedVectors, call this through their TrackMemory functions.
+
+  @param ceed      Ceed context of the allocating object
+  @param memclass  CeedMemoryClass of the allocation
+  @param space     CeedMemSpace of the allocation
+  @param bytes     Number of bytes allocated, negative for bytes freed
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedTrackMemory(Ceed ceed, CeedMemoryClass memclass, CeedMemSpace space,
+                    ptrdiff_t bytes) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+
+  pthread_mutex_lock(&root->lock);
+  root->memusage[memclass][space] += bytes;
+  root->memtotal[space] += bytes;
+  if (root->memtotal[space] > root->memhighwater[space])
+    root->memhighwater[space] = root->memtotal[space];
+  pthread_mutex_unlock(&root->lock);
+  return 0;
+}
+
+/**
+  @brief Lock a Ceed against other host threads
+
+  Distinct CeedOperators on one Ceed may be applied from several host threads
+    at once. Backend state shared between them, such as memory pools and the
+    lazily created operator fallback Ceed, is updated while holding this lock.
+    The lock is taken on the Ceed created by the user, so it covers its
+    delegate and fallback Ceeds, and may be taken again by the thread
+    holding it.
+
+  @param ceed  Ceed context
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedLock(Ceed ceed) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+
+  ierr = pthread_mutex_lock(&root->lock);
+  if (ierr)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Could not lock Ceed: %s", strerror(ierr));
+  // LCOV_EXCL_STOP
+  return 0;
+}
+
+/**
+  @brief Unlock a Ceed locked with @ref CeedLock()
+
+  @param ceed  Ceed context
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedUnlock(Ceed ceed) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+
+  ierr = pthread_mutex_unlock(&root->lock);
+  if (ierr)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Could not unlock Ceed: %s", strerror(ierr));
+  // LCOV_EXCL_STOP
+  return 0;
+}
+
+/**
+  @brief Set the CeedOperator that profiled stages are attributed to
+
+  Each call with @a prevop starts a nested CeedOperator application, and
+  the matching call without @a prevop restores the previous CeedOperator.
+  Nothing is recorded while profiling is disabled.
+
+  @param ceed         Ceed context
+  @param op           CeedOperator being applied, or NULL
+  @param[out] prevop  Variable to store the previous CeedOperator, or NULL
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedProfileSetOperator(Ceed ceed, CeedOperator op, CeedOperator *prevop) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+
+  // Without profiling, concurrent applies leave the Ceed untouched
+  if (prevop) {
+    *prevop = NULL;
+    if (!root->profile && !root->tracefile) return 0;
+    *prevop = root->profileop;
+    root->profiledepth++;
+  } else {
+    if (!root->profiledepth) return 0;
+    root->profiledepth--;
+  }
+  root->profileop = op;
+  return 0;
+}
+
+/**
+  @brief View profile data
+
+  @param[in] data    CeedProfileData to view
+  @param[in] indent  Indentation for each line
+  @param[in] stream  Filestream to write to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedProfileView(const CeedProfileData *data, const char *indent,
+                    FILE *stream) {
+  fprintf(stream, "%sProfile:\n"
+          "%s  %-26s %10s %14s %10s %10s\n", indent, indent,
+          "Stage", "Calls", "Time (s)", "GB/s", "GFLOP/s");
+  for (CeedInt i=0; i<CEED_PROFILE_NUM_STAGES; i++) {
+    if (!data->count[i]) continue;
+    const bool timed = data->time[i] > 0;
+    fprintf(stream, "%s  %-26s %10d %14.6e", indent, CeedProfileStages[i],
+            data->count[i], data->time[i]);
+    if (data->bytes[i] > 0 && timed)
+      fprintf(stream, " %10.3f", 1e-9*data->bytes[i]/data->time[i]);
+    else if (data->flops[i] > 0 && timed)
+      fprintf(stream, " %10s", "");
+    if (data->flops[i] > 0 && timed)
+      fprintf(stream, " %10.3f", 1e-9*data->flops[i]/data->time[i]);
+    fprintf(stream, "\n");
+  }
+
+  // Energy of CeedOperator applications
+  static const char *const sources[CEED_NUM_ENERGY] = {
+    [CEED_ENERGY_HOST]   = "CPU packages (RAPL)",
+    [CEED_ENERGY_DEVICE] = "Device",
+  };
+  if (data->energycount[CEED_ENERGY_HOST] ||
+      data->energycount[CEED_ENERGY_DEVICE]) {
+    fprintf(stream, "%s  Energy:\n%s    %-24s %10s %14s %10s %10s\n", indent,
+            indent, "Source", "Applies", "Energy (J)", "J/apply", "J/DoF");
+    for (CeedInt j=0; j<CEED_NUM_ENERGY; j++) {
+      if (!data->energycount[j]) continue;
+      fprintf(stream, "%s    %-24s %10d %14.6e %10.3e", indent, sources[j],
+              data->energycount[j], data->energy[j],
+              data->energy[j]/data->energycount[j]);
+      if (data->dofs[j] > 0)
+        fprintf(stream, " %10.3e", data->energy[j]/data->dofs[j]);
+      fprintf(stream, "\n");
+    }
+  }
+
+  // Hardware counters, when built with PAPI
+  bool counted = false;
+  for (CeedInt j=0; j<CEED_NUM_COUNTERS; j++)
+    counted = counted || CeedCounterAvailable(j);
+  if (!counted) return 0;
+  fprintf(stream, "%s  Hardware counters:\n%s    %-24s", indent, indent,
+          "Stage");
+  for (CeedInt j=0; j<CEED_NUM_COUNTERS; j++)
+    fprintf(stream, " %14s", CeedCounterNames[j]);
+  fprintf(stream, "\n");
+  for (CeedInt i=0; i<CEED_PROFILE_NUM_STAGES; i++) {
+    if (!data->count[i] || i == CEED_PROFILE_INIT) continue;
+    fprintf(stream, "%s    %-24s", indent, CeedProfileStages[i]);
+    for (CeedInt j=0; j<CEED_NUM_COUNTERS; j++)
+      if (CeedCounterAvailable(j))
+        fprintf(stream, " %14lld", data->counters[i][j]);
+      else
+        fprintf(stream, " %14s", "-");
+    fprintf(stream, "\n");
+  }
+  return 0;
+}
+
+/**
+  @brief View the resource usage of kernels compiled at runtime
+
+  @param[in] kernels     Array of CeedKernelInfo
+  @param[in] counts      Number of kernels compiled with each usage, or NULL
+  @param[in] numkernels  Number of kernels
+  @param[in] indent      Indentation for each line
+  @param[in] stream      Filestream to write to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedKernelInfoView(const CeedKernelInfo *kernels, const CeedInt *counts,
+                       CeedInt numkernels, const char *indent, FILE *stream) {
+  fprintf(stream, "%sJIT kernels:\n%s  %-40s %6s %9s %10s %10s %6s %9s\n",
+          indent, indent, "Kernel", "Count", "Registers", "Local (B)",
+          "Shared (B)", "Block", "Occupancy");
+  for (CeedInt k=0; k<numkernels; k++) {
+    const CeedKernelInfo *info = &kernels[k];
+    fprintf(stream, "%s  %-40s %6d %9d %10zu %10zu %6d", indent, info->name,
+            counts ? counts[k] : 1, info->registers, info->localbytes,
+            info->sharedbytes, info->blocksize);
+    if (info->occupancy >= 0)
+      fprintf(stream, " %8.1f%%\n", 100*info->occupancy);
+    else
+      fprintf(stream, " %9s\n", "-");
+  }
+  return 0;
+}
+
+/**
+  @brief Set a backend function
+
+  This function is used for a backend to set the function associated with
+  the Ceed objects. For example,
+    CeedSetBackendFunction(ceed, "Ceed", ceed, "VectorCreate", BackendVectorCreate)
+  sets the backend implementation of 'CeedVectorCreate' and
+    CeedSetBackendFunction(ceed, "Basis", basis, "Apply", BackendBasisApply)
+  sets the backend implementation of 'CeedBasisApply'. Note, the prefix 'Ceed'
+  is not required for the object type ("Basis" vs "CeedBasis").
+
+  @param ceed           Ceed context for error handling
+  @param type           Type of Ceed object to set function for
+  @param[out] object    Ceed object to set function for
+  @param fname          Name of function to set
+  @param f              Function to set
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedSetBackendFunction(Ceed ceed, const char *type, void *object,
+                           const char *fname, int (*f)()) {
+  char lookupname[CEED_MAX_RESOURCE_LEN+1];
+
+  // Build lookup name
+  size_t len = 0;
+  const char *parts[3] = {strcmp(type, "Ceed") ? "Ceed" : "", type, fname};
+  for (CeedInt i = 0; i < 3; i++) {
+    size_t n = strlen(parts[i]);
+    if (len + n > CEED_MAX_RESOURCE_LEN) n = CEED_MAX_RESOURCE_LEN - len;
+    memcpy(&lookupname[len], parts[i], n);
+    len += n;
+  }
+  lookupname[len] = '\0';
+
+  // Find and use offset
+  khiter_t k = kh_get(CeedFunctionOffset, function_offsets, lookupname);
+  if (k != kh_end(function_offsets)) {
+    size_t offset = kh_value(function_offsets, k);
+    int (**fpointer)(void) = (int (**)(void))((char *)object + offset); // *NOPAD*
+    *fpointer = f;
+    return 0;
+  }
+
+  // LCOV_EXCL_START
+  return CeedError(ceed, 1, "Requested function '%s' was not found for CEED "
+                   "object '%s'", fname, type);
+  // LCOV_EXCL_STOP
+}
+
+/**
+  @brief Retrieve backend data for a Ceed context
+
+  @param ceed      Ceed context to retrieve data of
+  @param[out] data Address to save data to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedGetData(Ceed ceed, void *data) {
+  *(void **)data = ceed->data;
+  return 0;
+}
+
+/**
+  @brief Set backend data for a Ceed context
+
+  @param ceed           Ceed context to set data of
+  @param data           Address of data to set
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedSetData(Ceed ceed, void *data) {
+  ceed->data = data;
+  return 0;
+}
+
+/**
+  @brief Create a CeedRequest for an operation that completes asynchronously
+
+  Backends set the "Wait" and, optionally, "Destroy" functions of the request
+    with CeedSetBackendFunction().  The request is freed by CeedRequestWait().
+
+  @param ceed      Ceed context the operation was submitted to
+  @param[out] req  Address of the variable where the newly created
+                     CeedRequest will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedRequestCreate(Ceed ceed, CeedRequest *req) {
+  int ierr;
+
+  ierr = CeedCalloc(1, req); CeedChk(ierr);
+  (*req)->ceed = ceed;
+  return 0;
+}
+
+/**
+  @brief Get the Ceed associated with a CeedRequest
+
+  @param req        CeedRequest
+  @param[out] ceed  Variable to store Ceed
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedRequestGetCeed(CeedRequest req, Ceed *ceed) {
+  *ceed = req->ceed;
+  return 0;
+}
+
+/**
+  @brief Get the backend data of a CeedRequest
+
+  @param req        CeedRequest
+  @param[out] data  Variable to store data
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedRequestGetData(CeedRequest req, void *data) {
+  *(void **)data = req->data;
+  return 0;
+}
+
+/**
+  @brief Set the backend data of a CeedRequest
+
+  @param[out] req  CeedRequest
+  @param data      Data to set
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedRequestSetData(CeedRequest req, void *data) {
+  req->data = data;
+  return 0;
+}
+
+/// @}
+
+/// ----------------------------------------------------------------------------
+/// Ceed Public API
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedUser
+/// @{
+
+/**
+  @brief Initialize a \ref Ceed context to use the specified resource.
+
+  The time taken is reported as the CeedInit stage by CeedView() once
+    profiling is enabled.
+
+  @param resource  Resource to use, e.g., "/cpu/self"
+  @param ceed      The library context
+  @sa CeedRegister() CeedDestroy()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedInit(const char *resource, Ceed *ceed) {
+  int ierr;
+  size_t matchlen = 0, matchidx = UINT_MAX, matchpriority = UINT_MAX, priority;
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  const double start = ts.tv_sec + 1e-9*ts.tv_nsec;
+
+  // Find matching backend
+  if (!resource)
+    // LCOV_EXCL_START
+    return CeedError(NULL, 1, "No resource provided");
+  // LCOV_EXCL_STOP
+
+  for (size_t i=0; i<num_backends; i++) {
+    size_t n;
+    const char *prefix = backends[i].prefix;
     for (n = 0; prefix[n] && prefix[n] == resource[n]; n++) {}
     priority = backends[i].priority;
     if (n > matchlen || (n == matchlen && matchpriority > priority)) {
@@ -628,161 +1862,735 @@ int CeedInit(const char *resource, Ceed *ceed) {
   }
   if (matchlen <= 1)
     // LCOV_EXCL_START
-    return CeedError(NULL, 1, "No suitable backend: %s", resource);
+    return CeedError(NULL, 1, "No suitable backend: %s", resource);
+  // LCOV_EXCL_STOP
+
+  // Setup Ceed
+  ierr = CeedCalloc(1, ceed); CeedChk(ierr);
+  const char *ceed_error_handler = getenv("CEED_ERROR_HANDLER");
+  if (!ceed_error_handler)
+    ceed_error_handler = "abort";
+  if (!strcmp(ceed_error_handler, "exit"))
+    (*ceed)->Error = CeedErrorExit;
+  else if (!strcmp(ceed_error_handler, "store"))
+    (*ceed)->Error = CeedErrorStore;
+  else
+    (*ceed)->Error = CeedErrorAbort;
+  memcpy((*ceed)->errmsg, "No error message stored", 24);
+  (*ceed)->refcount = 1;
+  (*ceed)->data = NULL;
+  pthread_mutexattr_t lockattr;
+  pthread_mutexattr_init(&lockattr);
+  pthread_mutexattr_settype(&lockattr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&(*ceed)->lock, &lockattr);
+  pthread_mutexattr_destroy(&lockattr);
+
+  // Set fallback for advanced CeedOperator functions
+  const char fallbackresource[] = "/cpu/self/ref/serial";
+  ierr = CeedSetOperatorFallbackResource(*ceed, fallbackresource);
+  CeedChk(ierr);
+
+  // Record env variables CEED_DEBUG or DBG
+  (*ceed)->debug = !!getenv("CEED_DEBUG") || !!getenv("DBG");
+
+  // Record env variable CEED_PROFILE
+  const char *ceed_profile = getenv("CEED_PROFILE");
+  (*ceed)->profile = ceed_profile && strcmp(ceed_profile, "0");
+
+  // Record env variable CEED_SYNC_AUDIT
+  const char *ceed_sync_audit = getenv("CEED_SYNC_AUDIT");
+  if (ceed_sync_audit && strcmp(ceed_sync_audit, "0"))
+    (*ceed)->syncaudit = strcmp(ceed_sync_audit, "error") ?
+                         CEED_SYNC_AUDIT_LOG : CEED_SYNC_AUDIT_ERROR;
+
+  // Record env variable CEED_TRACE
+  ierr = CeedSetTraceFile(*ceed, getenv("CEED_TRACE")); CeedChk(ierr);
+
+  // Record env variable CEED_JIT_OPTIONS
+  ierr = CeedSetJitOptions(*ceed, getenv("CEED_JIT_OPTIONS")); CeedChk(ierr);
+
+  // Backend specific setup
+  ierr = backends[matchidx].init(resource, *ceed); CeedChk(ierr);
+
+  // Copy resource prefix, if backend setup sucessful
+  size_t len = strlen(backends[matchidx].prefix);
+  char *tmp;
+  ierr = CeedCalloc(len+1, &tmp); CeedChk(ierr);
+  memcpy(tmp, backends[matchidx].prefix, len+1);
+  (*ceed)->resource = tmp;
+
+  // Startup time is always recorded, so it is reported once profiling is
+  //   enabled on the new Ceed
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  const double end = ts.tv_sec + 1e-9*ts.tv_nsec;
+  (*ceed)->profiledata.count[CEED_PROFILE_INIT] = 1;
+  (*ceed)->profiledata.time[CEED_PROFILE_INIT] = end - start;
+  if ((*ceed)->tracefile) {
+    CeedTraceEvent event = {CEED_PROFILE_INIT, start, end, -1.0, -1.0, 0, 0};
+    ierr = CeedTraceRecord(*ceed, event); CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Get the full resource name for a Ceed context
+
+  @param ceed            Ceed context to get resource name of
+  @param[out] resource   Variable to store resource name
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+
+int CeedGetResource(Ceed ceed, const char **resource) {
+  *resource = (const char *)ceed->resource;
+  return 0;
+}
+
+/**
+  @brief Return Ceed context preferred memory type
+
+  @param ceed      Ceed context to get preferred memory type of
+  @param[out] type Address to save preferred memory type to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedGetPreferredMemType(Ceed ceed, CeedMemType *type) {
+  int ierr;
+
+  if (ceed->GetPreferredMemType) {
+    ierr = ceed->GetPreferredMemType(type); CeedChk(ierr);
+  } else {
+    Ceed delegate;
+    ierr = CeedGetDelegate(ceed, &delegate); CeedChk(ierr);
+
+    if (delegate) {
+      ierr = CeedGetPreferredMemType(delegate, type); CeedChk(ierr);
+    } else {
+      *type = CEED_MEM_HOST;
+    }
+  }
+
+  return 0;
+}
+
+/**
+  @brief Get deterministic status of Ceed
+
+  @param[in] ceed              Ceed
+  @param[out] isDeterministic  Variable to store deterministic status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedIsDeterministic(Ceed ceed, bool *isDeterministic) {
+  *isDeterministic = ceed->isDeterministic;
+  return 0;
+}
+
+/**
+  @brief Enable or disable profiling of operator application
+
+  When profiling is enabled, calls to CeedOperatorApply() and its restriction,
+  basis, QFunction, and memory transfer stages are counted and timed.  The
+  totals are printed by CeedView() and, for each CeedOperator, by
+  CeedOperatorView().  GPU backends also emit NVTX or roctx ranges for each
+  stage and complete device work before recording each time.  The energy of
+  each CeedOperator application is also measured, per application and per
+  output DoF, for the CPU packages when the RAPL counters in
+  /sys/class/powercap are readable, and for the device of /gpu/cuda/\* and
+  /gpu/hip/\* backends when libCEED is built with NVML or ROCm SMI. Device
+  counters are updated every few milliseconds, so the energy of short
+  applications is only meaningful summed over many.  Profiling may also be
+  enabled by setting the environment variable CEED_PROFILE.
+
+  @param ceed     Ceed context
+  @param profile  Boolean flag to enable (true) or disable (false) profiling
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedSetProfiling(Ceed ceed, bool profile) {
+  ceed->profile = profile;
+  return 0;
+}
+
+/**
+  @brief Get profiling status of Ceed
+
+  @param[in] ceed      Ceed
+  @param[out] profile  Variable to store profiling status, true when profiling
+                         or tracing
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedIsProfiling(Ceed ceed, bool *profile) {
+  *profile = ceed->profile || ceed->tracefile;
+  return 0;
+}
+
+/**
+  @brief Record a timeline of operator application in a trace file
+
+  When tracing is enabled, the begin and end times of each stage profiled by
+  CeedSetProfiling(), and of runtime kernel compilation, are recorded and
+  written to @a filename in Chrome trace format by CeedDestroy().  The trace
+  can be viewed with Perfetto or chrome://tracing, alongside traces of other
+  libraries recorded on the same clock.  GPU backends also record when each
+  stage ran on the device.  A "%d" in @a filename is replaced by the process
+  id, so each MPI rank writes its own file.  Tracing may also be enabled by
+  setting the environment variable CEED_TRACE to the file name.
+
+  @param ceed      Ceed context
+  @param filename  Name of the trace file, or NULL to disable tracing
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedSetTraceFile(Ceed ceed, const char *filename) {
+  int ierr;
+  ierr = CeedFree(&ceed->tracefile); CeedChk(ierr);
+  if (filename && filename[0]) {
+    size_t len = strlen(filename) + 1;
+    ierr = CeedMalloc(len, &ceed->tracefile); CeedChk(ierr);
+    memcpy(ceed->tracefile, filename, len);
+  }
+  return 0;
+}
+
+/**
+  @brief Audit host/device transfers of CeedVector data
+
+  When auditing is enabled, each transfer of CeedVector data between host and
+    device memory is counted and logged to stderr with its size, the
+    CeedVector, and the call site that requested it. The counts are returned
+    by CeedGetSyncAuditCounts() and printed by CeedView(). In
+    CEED_SYNC_AUDIT_ERROR mode, host access to device data within a region
+    marked with CeedSyncAuditRegionBegin() is also an error, to find stray
+    synchronizations in code meant to stay on the device. Backends whose data
+    stays in host memory make no transfers. Auditing may also be enabled by
+    setting the environment variable CEED_SYNC_AUDIT to "1" or "error".
+
+  @param ceed  Ceed context
+  @param mode  CeedSyncAuditMode to use
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedSetSyncAudit(Ceed ceed, CeedSyncAuditMode mode) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+
+  root->syncaudit = mode;
+  return 0;
+}
+
+/**
+  @brief Open a region in which host access to device data is audited
+
+  Regions may be nested; transfers are reported with the innermost region.
+
+  @param ceed  Ceed context
+  @param name  Name of the region, kept until CeedSyncAuditRegionEnd()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedSyncAuditRegionBegin(Ceed ceed, const char *name) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+
+  if (root->auditdepth == CEED_SYNC_AUDIT_MAX_DEPTH)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Audited regions nested more than %d deep",
+                     CEED_SYNC_AUDIT_MAX_DEPTH);
   // LCOV_EXCL_STOP
+  root->auditregions[root->auditdepth++] = name;
+  return 0;
+}
 
-  // Setup Ceed
-  ierr = CeedCalloc(1, ceed); CeedChk(ierr);
-  const char *ceed_error_handler = getenv("CEED_ERROR_HANDLER");
-  if (!ceed_error_handler)
-    ceed_error_handler = "abort";
-  if (!strcmp(ceed_error_handler, "exit"))
-    (*ceed)->Error = CeedErrorExit;
-  else if (!strcmp(ceed_error_handler, "store"))
-    (*ceed)->Error = CeedErrorStore;
-  else
-    (*ceed)->Error = CeedErrorAbort;
-  memcpy((*ceed)->errmsg, "No error message stored", 24);
-  (*ceed)->refcount = 1;
-  (*ceed)->data = NULL;
+/**
+  @brief Close the innermost region opened by CeedSyncAuditRegionBegin()
 
-  // Set lookup table
-  foffset foffsets[] = {
-    CEED_FTABLE_ENTRY(Ceed, Error),
-    CEED_FTABLE_ENTRY(Ceed, GetPreferredMemType),
-    CEED_FTABLE_ENTRY(Ceed, Destroy),
-    CEED_FTABLE_ENTRY(Ceed, VectorCreate),
-    CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreate),
-    CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreateBlocked),
-    CEED_FTABLE_ENTRY(Ceed, BasisCreateTensorH1),
-    CEED_FTABLE_ENTRY(Ceed, BasisCreateH1),
-    CEED_FTABLE_ENTRY(Ceed, TensorContractCreate),
-    CEED_FTABLE_ENTRY(Ceed, QFunctionCreate),
-    CEED_FTABLE_ENTRY(Ceed, QFunctionContextCreate),
-    CEED_FTABLE_ENTRY(Ceed, OperatorCreate),
-    CEED_FTABLE_ENTRY(Ceed, CompositeOperatorCreate),
-    CEED_FTABLE_ENTRY(CeedVector, SetArray),
-    CEED_FTABLE_ENTRY(CeedVector, TakeArray),
-    CEED_FTABLE_ENTRY(CeedVector, SetValue),
-    CEED_FTABLE_ENTRY(CeedVector, GetArray),
-    CEED_FTABLE_ENTRY(CeedVector, GetArrayRead),
-    CEED_FTABLE_ENTRY(CeedVector, RestoreArray),
-    CEED_FTABLE_ENTRY(CeedVector, RestoreArrayRead),
-    CEED_FTABLE_ENTRY(CeedVector, Norm),
-    CEED_FTABLE_ENTRY(CeedVector, Reciprocal),
-    CEED_FTABLE_ENTRY(CeedVector, Destroy),
-    CEED_FTABLE_ENTRY(CeedElemRestriction, Apply),
-    CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyBlock),
-    CEED_FTABLE_ENTRY(CeedElemRestriction, GetOffsets),
-    CEED_FTABLE_ENTRY(CeedElemRestriction, Destroy),
-    CEED_FTABLE_ENTRY(CeedBasis, Apply),
-    CEED_FTABLE_ENTRY(CeedBasis, Destroy),
-    CEED_FTABLE_ENTRY(CeedTensorContract, Apply),
-    CEED_FTABLE_ENTRY(CeedTensorContract, Destroy),
-    CEED_FTABLE_ENTRY(CeedQFunction, Apply),
-    CEED_FTABLE_ENTRY(CeedQFunction, SetCUDAUserFunction),
-    CEED_FTABLE_ENTRY(CeedQFunction, SetHIPUserFunction),
-    CEED_FTABLE_ENTRY(CeedQFunction, Destroy),
-    CEED_FTABLE_ENTRY(CeedQFunctionContext, SetData),
-    CEED_FTABLE_ENTRY(CeedQFunctionContext, GetData),
-    CEED_FTABLE_ENTRY(CeedQFunctionContext, RestoreData),
-    CEED_FTABLE_ENTRY(CeedQFunctionContext, Destroy),
-    CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleQFunction),
-    CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleDiagonal),
-    CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleAddDiagonal),
-    CEED_FTABLE_ENTRY(CeedOperator, LinearAssemblePointBlockDiagonal),
-    CEED_FTABLE_ENTRY(CeedOperator, LinearAssembleAddPointBlockDiagonal),
-    CEED_FTABLE_ENTRY(CeedOperator, CreateFDMElementInverse),
-    CEED_FTABLE_ENTRY(CeedOperator, Apply),
-    CEED_FTABLE_ENTRY(CeedOperator, ApplyComposite),
-    CEED_FTABLE_ENTRY(CeedOperator, ApplyAdd),
-    CEED_FTABLE_ENTRY(CeedOperator, ApplyAddComposite),
-    CEED_FTABLE_ENTRY(CeedOperator, ApplyJacobian),
-    CEED_FTABLE_ENTRY(CeedOperator, Destroy),
-    {NULL, 0} // End of lookup table - used in SetBackendFunction loop
-  };
+  @param ceed  Ceed context
 
-  ierr = CeedCalloc(sizeof(foffsets), &(*ceed)->foffsets); CeedChk(ierr);
-  memcpy((*ceed)->foffsets, foffsets, sizeof(foffsets));
+  @return An error code: 0 - success, otherwise - failure
 
-  // Set fallback for advanced CeedOperator functions
-  const char fallbackresource[] = "/cpu/self/ref/serial";
-  ierr = CeedSetOperatorFallbackResource(*ceed, fallbackresource);
-  CeedChk(ierr);
+  @ref User
+**/
+int CeedSyncAuditRegionEnd(Ceed ceed) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
 
-  // Record env variables CEED_DEBUG or DBG
-  (*ceed)->debug = !!getenv("CEED_DEBUG") || !!getenv("DBG");
+  if (!root->auditdepth)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "No audited region is open");
+  // LCOV_EXCL_STOP
+  root->auditdepth--;
+  return 0;
+}
 
-  // Backend specific setup
-  ierr = backends[matchidx].init(resource, *ceed); CeedChk(ierr);
+/**
+  @brief Get the number of host/device transfers audited by a Ceed
 
-  // Copy resource prefix, if backend setup sucessful
-  size_t len = strlen(backends[matchidx].prefix);
-  char *tmp;
-  ierr = CeedCalloc(len+1, &tmp); CeedChk(ierr);
-  memcpy(tmp, backends[matchidx].prefix, len+1);
-  (*ceed)->resource = tmp;
+  @param ceed      Ceed context
+  @param[out] h2d  Variable to store the number of host to device transfers
+  @param[out] d2h  Variable to store the number of device to host transfers
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedGetSyncAuditCounts(Ceed ceed, CeedInt *h2d, CeedInt *d2h) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
 
+  if (h2d) *h2d = root->numtransfers[CEED_MEM_DEVICE];
+  if (d2h) *d2h = root->numtransfers[CEED_MEM_HOST];
   return 0;
 }
 
 /**
-  @brief Get the full resource name for a Ceed context
+  @brief Set additional options for runtime compilation of kernels
 
-  @param ceed            Ceed context to get resource name of
-  @param[out] resource   Variable to store resource name
+  JIT backends, such as /gpu/cuda/\* and /gpu/hip/\*, pass these options to
+    NVRTC or hipRTC when compiling kernels for this Ceed and its delegates,
+    for example "--use_fast_math --maxrregcount=64" for NVRTC or
+    "-ffast-math" for hipRTC. Defining CEED_MAX_THREADS_PER_BLOCK, as in
+    "-DCEED_MAX_THREADS_PER_BLOCK=256", adds launch bounds to the fused
+    kernels of /gpu/cuda/gen and /gpu/hip/gen. The options are part of the
+    key of the JIT cache and only affect kernels compiled after this call.
+    Options may also be set with the environment variable CEED_JIT_OPTIONS.
+
+  @param ceed     Ceed context
+  @param options  Options separated by whitespace, or NULL to clear them
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
+int CeedSetJitOptions(Ceed ceed, const char *options) {
+  int ierr;
+  ierr = CeedFree(&ceed->jitoptions); CeedChk(ierr);
+  if (options && options[0]) {
+    size_t len = strlen(options) + 1;
+    ierr = CeedMalloc(len, &ceed->jitoptions); CeedChk(ierr);
+    memcpy(ceed->jitoptions, options, len);
+  }
+  return 0;
+}
 
-int CeedGetResource(Ceed ceed, const char **resource) {
-  *resource = (const char *)ceed->resource;
+/**
+  @brief Get additional options for runtime compilation of kernels
+
+  @param[in] ceed      Ceed context
+  @param[out] options  Variable to store options, or NULL if none are set
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedGetJitOptions(Ceed ceed, const char **options) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+  *options = root->jitoptions;
   return 0;
 }
 
 /**
-  @brief Return Ceed context preferred memory type
+  @brief Release device memory cached by the backend memory pool
 
-  @param ceed      Ceed context to get preferred memory type of
-  @param[out] type Address to save preferred memory type to
+  GPU backends keep freed device allocations in a per-Ceed pool for reuse by
+    later allocations, avoiding the device synchronization of the native
+    allocator. This returns all cached, unused allocations to the device for
+    the Ceed and its delegates; allocations in use are not affected.
+
+  @param ceed  Ceed context
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
-int CeedGetPreferredMemType(Ceed ceed, CeedMemType *type) {
+int CeedMemoryPoolTrim(Ceed ceed) {
   int ierr;
 
-  if (ceed->GetPreferredMemType) {
-    ierr = ceed->GetPreferredMemType(type); CeedChk(ierr);
-  } else {
-    Ceed delegate;
-    ierr = CeedGetDelegate(ceed, &delegate); CeedChk(ierr);
+  if (ceed->MemoryPoolTrim) {
+    ierr = ceed->MemoryPoolTrim(ceed); CeedChk(ierr);
+  }
+  if (ceed->delegate) {
+    ierr = CeedMemoryPoolTrim(ceed->delegate); CeedChk(ierr);
+  }
+  for (int i=0; i<ceed->objdelegatecount; i++) {
+    ierr = CeedMemoryPoolTrim(ceed->objdelegates[i].delegate); CeedChk(ierr);
+  }
+  if (ceed->opfallbackceed && !ceed->opfallbackdelegate) {
+    ierr = CeedMemoryPoolTrim(ceed->opfallbackceed); CeedChk(ierr);
+  }
+  return 0;
+}
 
-    if (delegate) {
-      ierr = CeedGetPreferredMemType(delegate, type); CeedChk(ierr);
-    } else {
-      *type = CEED_MEM_HOST;
+/**
+  @brief Get the number of CeedOperators that fell back to the operator
+           fallback Ceed
+
+  Operators use the fallback resource for functionality their backend does not
+    implement, such as some assembly. Fallbacks whose preferred memory type
+    differs from the one of the backend, for example a GPU backend falling
+    back to /cpu/self/ref/serial, copy the operator data between host and
+    device memory and are counted in `crossed`.
+
+  @param ceed          Ceed context created by the user
+  @param[out] count    Number of operators given a fallback
+  @param[out] crossed  Number of those whose fallback uses another memory type
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedGetOperatorFallbackCount(Ceed ceed, CeedInt *count, CeedInt *crossed) {
+  *count = ceed->numopfallbacks;
+  *crossed = ceed->numopfallbackscrossed;
+  return 0;
+}
+
+/**
+  @brief Get device memory usage of the backend memory pool
+
+  Usage is summed over the Ceed and its delegates. Backends without a memory
+    pool report zero.
+
+  @param ceed            Ceed context
+  @param[out] inuse      Bytes currently allocated to libCEED objects
+  @param[out] cached     Bytes held by the pool for reuse
+  @param[out] highwater  Largest number of bytes allocated to libCEED objects
+                           at any one time
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMemoryPoolGetUsage(Ceed ceed, size_t *inuse, size_t *cached,
+                           size_t *highwater) {
+  int ierr;
+  size_t u = 0, c = 0, h = 0;
+
+  *inuse = *cached = *highwater = 0;
+  if (ceed->MemoryPoolGetUsage) {
+    ierr = ceed->MemoryPoolGetUsage(ceed, inuse, cached, highwater);
+    CeedChk(ierr);
+  }
+  Ceed delegates[ceed->objdelegatecount + 2];
+  CeedInt numdelegates = 0;
+  if (ceed->delegate)
+    delegates[numdelegates++] = ceed->delegate;
+  for (int i=0; i<ceed->objdelegatecount; i++)
+    delegates[numdelegates++] = ceed->objdelegates[i].delegate;
+  if (ceed->opfallbackceed && !ceed->opfallbackdelegate)
+    delegates[numdelegates++] = ceed->opfallbackceed;
+  for (CeedInt i=0; i<numdelegates; i++) {
+    ierr = CeedMemoryPoolGetUsage(delegates[i], &u, &c, &h); CeedChk(ierr);
+    *inuse += u;
+    *cached += c;
+    *highwater += h;
+  }
+  return 0;
+}
+
+/**
+  @brief Get the memory allocated to libCEED objects of a Ceed
+
+  Backends account for the data of CeedVectors, CeedElemRestrictions,
+    CeedBases, and CeedQFunctionContexts, and for the work vectors of
+    CeedOperators. Memory provided by the user with CEED_USE_POINTER is not
+    counted.
+
+  @param ceed        Ceed context
+  @param memclass    CeedMemoryClass to get the usage of
+  @param space       CeedMemSpace to get the usage of
+  @param[out] bytes  Variable to store the number of bytes allocated
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedGetMemoryUsage(Ceed ceed, CeedMemoryClass memclass, CeedMemSpace space,
+                       size_t *bytes) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+
+  *bytes = root->memusage[memclass][space];
+  return 0;
+}
+
+/**
+  @brief Set the functions that allocate the memory of a Ceed
+
+  Applications managing memory in their own pools set an allocator right
+    after CeedInit(), before creating libCEED objects. Vector arrays, work
+    vectors of operators, quadrature data, restriction offsets, and basis
+    matrices are then allocated by @a alloc in the CeedMemSpace they live in,
+    host, device, or page-locked host memory, and returned to @a dealloc;
+    GPU backends do not cache device memory freed through an allocator, and
+    return it only after the work queued by the freeing thread completes.
+    Managed memory is still allocated by the backend.
+    Arrays passed to libCEED with @ref CEED_OWN_POINTER must come from the
+    allocator, and arrays taken with CeedVectorTakeArray() are returned to it.
+    Small host structures are still allocated with malloc().
+
+  @param ceed     Ceed context
+  @param alloc    Function allocating memory, or NULL to use the backend
+                    allocation
+  @param dealloc  Function freeing memory allocated by @a alloc
+  @param ctx      Context passed to @a alloc and @a dealloc
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedSetAllocator(Ceed ceed, CeedAllocFunction alloc,
+                     CeedDeallocFunction dealloc, void *ctx) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+
+  if (!alloc != !dealloc)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Allocator needs both alloc and dealloc");
+  // LCOV_EXCL_STOP
+  for (CeedInt i=0; i<CEED_MEMSPACE_NUM; i++)
+    if (root->memtotal[i])
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Allocator must be set before libCEED objects "
+                       "allocate memory; %zu bytes of %s memory in use",
+                       root->memtotal[i], CeedMemSpaces[i]);
+  // LCOV_EXCL_STOP
+
+  root->alloc = alloc;
+  root->dealloc = dealloc;
+  root->allocctx = ctx;
+  return 0;
+}
+
+/**
+  @brief Share the work arrays of operators through a scratch arena
+
+  Operators on a shared Ceed borrow their large work arrays, such as the
+    E-vectors of active fields, from an arena owned by the Ceed while they are
+    applied, and return them when the application completes. Applications
+    holding many operators that are applied one at a time, such as the levels
+    of a multigrid hierarchy, then need work memory for the largest operator
+    only, instead of for all operators together. Arena arrays are reused
+    between applications and freed with the Ceed.
+
+  @param ceed    Ceed context
+  @param shared  Boolean flag to borrow work arrays from the arena
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedSetSharedWork(Ceed ceed, bool shared) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+
+  root->sharedwork = shared;
+  return 0;
+}
+
+/**
+  @brief Get whether operators of a Ceed borrow work arrays from its arena
+
+  @param ceed         Ceed context
+  @param[out] shared  Variable to store the flag set with CeedSetSharedWork()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedIsSharedWork(Ceed ceed, bool *shared) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+
+  *shared = root->sharedwork;
+  return 0;
+}
+
+/**
+  @brief Borrow a work array from the arena of a user Ceed, called under
+           CeedLock()
+
+  The arena is only updated once every allocation succeeded, so a failure
+    leaves all arena arrays valid.
+
+  @param root        User Ceed context owning the arena
+  @param n           Number of CeedScalars needed
+  @param[out] array  Variable to store the borrowed array
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedGetWorkArray_Core(Ceed root, size_t n, CeedScalar **array) {
+  int ierr;
+  CeedInt fit = -1, largest = -1;
+  for (CeedInt i=0; i<root->numwork; i++) {
+    CeedWorkArray *w = &root->work[i];
+    if (w->inuse)
+      continue;
+    if (w->n >= n && (fit < 0 || w->n < root->work[fit].n))
+      fit = i;
+    if (largest < 0 || w->n > root->work[largest].n)
+      largest = i;
+  }
+  if (fit < 0) {
+    if (largest < 0) {
+      if (root->numwork == root->maxwork) {
+        CeedInt maxwork = root->maxwork ? 2*root->maxwork : 8;
+        CeedWorkArray *work = root->work;
+        ierr = CeedRealloc(maxwork, &work); CeedChk(ierr);
+        root->work = work;
+        root->maxwork = maxwork;
+      }
+      largest = root->numwork++;
+      root->work[largest].array = NULL;
+      root->work[largest].n = 0;
+      root->work[largest].inuse = false;
     }
+    CeedWorkArray *w = &root->work[largest];
+    CeedScalar *grown = NULL;
+    ierr = CeedMallocHost(root, n, &grown); CeedChk(ierr);
+    ierr = CeedFreeHost(root, &w->array); CeedChk(ierr);
+    ierr = CeedTrackMemory(root, CEED_MEMORY_EVECTOR, CEED_MEMSPACE_HOST,
+                           (ptrdiff_t)((n - w->n)*sizeof(CeedScalar)));
+    CeedChk(ierr);
+    w->array = grown;
+    w->n = n;
+    fit = largest;
   }
+  root->work[fit].inuse = true;
+  *array = root->work[fit].array;
+  return 0;
+}
+
+/**
+  @brief Borrow a host work array from the scratch arena of a Ceed
+
+  The smallest free arena array holding @a n scalars is lent; otherwise the
+    largest free array is grown, so the arena converges to the work of the
+    largest operator applied at one time. The contents are undefined.
+
+  @param ceed        Ceed context
+  @param n           Number of CeedScalars needed
+  @param[out] array  Variable to store the borrowed array
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @sa CeedRestoreWorkArray()
+
+  @ref Backend
+**/
+int CeedGetWorkArray(Ceed ceed, size_t n, CeedScalar **array) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
 
+  ierr = CeedLock(root); CeedChk(ierr);
+  int ierrget = CeedGetWorkArray_Core(root, n, array);
+  ierr = CeedUnlock(root); CeedChk(ierr);
+  CeedChk(ierrget);
   return 0;
 }
 
 /**
-  @brief Get deterministic status of Ceed
+  @brief Return a work array borrowed with CeedGetWorkArray()
 
-  @param[in] ceed              Ceed
-  @param[out] isDeterministic  Variable to store deterministic status
+  @param ceed   Ceed context
+  @param array  Address of the borrowed array, zeroed when returned
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedRestoreWorkArray(Ceed ceed, CeedScalar **array) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+
+  ierr = CeedLock(root); CeedChk(ierr);
+  for (CeedInt i=0; i<root->numwork; i++)
+    if (root->work[i].inuse && root->work[i].array == *array) {
+      root->work[i].inuse = false;
+      *array = NULL;
+      ierr = CeedUnlock(root); CeedChk(ierr);
+      return 0;
+    }
+  ierr = CeedUnlock(root); CeedChk(ierr);
+  // LCOV_EXCL_START
+  return CeedError(ceed, 1, "Array was not borrowed from the scratch arena");
+  // LCOV_EXCL_STOP
+}
+
+/**
+  @brief Get the largest memory allocated to libCEED objects of a Ceed
+
+  @param ceed        Ceed context
+  @param space       CeedMemSpace to get the high-water mark of
+  @param[out] bytes  Variable to store the largest number of bytes allocated
+                       at any one time
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref User
 **/
-int CeedIsDeterministic(Ceed ceed, bool *isDeterministic) {
-  *isDeterministic = ceed->isDeterministic;
+int CeedGetMemoryHighWater(Ceed ceed, CeedMemSpace space, size_t *bytes) {
+  int ierr;
+  Ceed root;
+  ierr = CeedGetUserCeed(ceed, &root); CeedChk(ierr);
+
+  *bytes = root->memhighwater[space];
+  return 0;
+}
+
+/**
+  @brief Make the device of a Ceed current for the calling thread
+
+  GPU backends allocate memory and launch kernels on the current device. A
+    process using Ceeds on several devices, selected with the resource suffix
+    ":device_id=N", calls this before working with the objects of each Ceed.
+    Backends without a device do nothing.
+
+  @param ceed  Ceed context
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedSetCurrentDevice(Ceed ceed) {
+  int ierr;
+
+  for (; ceed; ceed = ceed->delegate)
+    if (ceed->SetCurrentDevice) {
+      ierr = ceed->SetCurrentDevice(ceed); CeedChk(ierr);
+      return 0;
+    }
   return 0;
 }
 
@@ -806,6 +2614,49 @@ int CeedView(Ceed ceed, FILE *stream) {
           "  Ceed Resource: %s\n"
           "  Preferred MemType: %s\n",
           ceed->resource, CeedMemTypes[memtype]);
+  if (ceed->profile) {
+    ierr = CeedProfileView(&ceed->profiledata, "  ", stream); CeedChk(ierr);
+  }
+  if (ceed->syncaudit)
+    fprintf(stream, "  Sync audit (%s): %d H2D transfers, %.3f MB, "
+            "%d D2H transfers, %.3f MB\n", CeedSyncAuditModes[ceed->syncaudit],
+            ceed->numtransfers[CEED_MEM_DEVICE],
+            ceed->transferbytes[CEED_MEM_DEVICE]/1048576.,
+            ceed->numtransfers[CEED_MEM_HOST],
+            ceed->transferbytes[CEED_MEM_HOST]/1048576.);
+  if (ceed->numkernels) {
+    ierr = CeedKernelInfoView(ceed->kernels, ceed->kernelcounts,
+                              ceed->numkernels, "  ", stream); CeedChk(ierr);
+  }
+  size_t inuse, cached, highwater;
+  ierr = CeedMemoryPoolGetUsage(ceed, &inuse, &cached, &highwater);
+  CeedChk(ierr);
+  if (highwater)
+    fprintf(stream, "  Device memory pool: %.1f MB in use, %.1f MB cached, "
+            "%.1f MB high-water\n", inuse/1048576., cached/1048576.,
+            highwater/1048576.);
+  if (ceed->numopfallbacks)
+    fprintf(stream, "  Operator fallbacks: %d, %d to another memory space\n",
+            ceed->numopfallbacks, ceed->numopfallbackscrossed);
+  bool tracked = false;
+  for (CeedInt s=0; s<CEED_MEMSPACE_NUM; s++)
+    tracked = tracked || ceed->memhighwater[s];
+  if (tracked) {
+    fprintf(stream, "  Memory usage (MB):\n"
+            "    %-22s %10s %10s %10s\n", "", CeedMemSpaces[CEED_MEMSPACE_HOST],
+            CeedMemSpaces[CEED_MEMSPACE_DEVICE],
+            CeedMemSpaces[CEED_MEMSPACE_PINNED]);
+    for (CeedInt c=0; c<CEED_MEMORY_NUM_CLASSES; c++) {
+      fprintf(stream, "    %-22s", CeedMemoryClasses[c]);
+      for (CeedInt s=0; s<CEED_MEMSPACE_NUM; s++)
+        fprintf(stream, " %10.3f", ceed->memusage[c][s]/1048576.);
+      fprintf(stream, "\n");
+    }
+    fprintf(stream, "    %-22s", "high-water");
+    for (CeedInt s=0; s<CEED_MEMSPACE_NUM; s++)
+      fprintf(stream, " %10.3f", ceed->memhighwater[s]/1048576.);
+    fprintf(stream, "\n");
+  }
 
   return 0;
 }
@@ -821,11 +2672,14 @@ int CeedView(Ceed ceed, FILE *stream) {
 **/
 int CeedDestroy(Ceed *ceed) {
   int ierr;
-  if (!*ceed || --(*ceed)->refcount > 0) return 0;
+  if (!*ceed || CeedDereference(*ceed) > 0) return 0;
+  // A fallback reusing a delegate is released while the chain is intact
+  ierr = CeedDestroy(&(*ceed)->opfallbackceed); CeedChk(ierr);
   if ((*ceed)->delegate) {
     ierr = CeedDestroy(&(*ceed)->delegate); CeedChk(ierr);
   }
 
+  kh_destroy(CeedObjectDelegate, (*ceed)->objdelegatemap);
   if ((*ceed)->objdelegatecount > 0) {
     for (int i=0; i<(*ceed)->objdelegatecount; i++) {
       ierr = CeedDestroy(&((*ceed)->objdelegates[i].delegate)); CeedChk(ierr);
@@ -838,10 +2692,31 @@ int CeedDestroy(Ceed *ceed) {
     ierr = (*ceed)->Destroy(*ceed); CeedChk(ierr);
   }
 
-  ierr = CeedFree(&(*ceed)->foffsets); CeedChk(ierr);
+  for (CeedInt i=0; i<(*ceed)->numwork; i++) {
+    CeedWorkArray *w = &(*ceed)->work[i];
+    ierr = CeedFreeHost(*ceed, &w->array); CeedChk(ierr);
+    ierr = CeedTrackMemory(*ceed, CEED_MEMORY_EVECTOR, CEED_MEMSPACE_HOST,
+                           -(ptrdiff_t)(w->n*sizeof(CeedScalar)));
+    CeedChk(ierr);
+  }
+  ierr = CeedFree(&(*ceed)->work); CeedChk(ierr);
+
+  // Only the Ceed created by the user records events
+  if ((*ceed)->tracefile && !(*ceed)->parent && !(*ceed)->opfallbackparent) {
+    ierr = CeedTraceWrite(*ceed); CeedChk(ierr);
+  }
+  ierr = CeedFree(&(*ceed)->tracefile); CeedChk(ierr);
+  ierr = CeedFree(&(*ceed)->traceevents); CeedChk(ierr);
+  ierr = CeedFree(&(*ceed)->kernels); CeedChk(ierr);
+  ierr = CeedFree(&(*ceed)->kernelcounts); CeedChk(ierr);
+  CeedCountersStop(*ceed);
+  CeedEnergyStop(*ceed);
+
   ierr = CeedFree(&(*ceed)->resource); CeedChk(ierr);
-  ierr = CeedDestroy(&(*ceed)->opfallbackceed); CeedChk(ierr);
   ierr = CeedFree(&(*ceed)->opfallbackresource); CeedChk(ierr);
+  ierr = CeedFree(&(*ceed)->jitoptions); CeedChk(ierr);
+  ierr = CeedFree(&(*ceed)->basiscache); CeedChk(ierr);
+  pthread_mutex_destroy(&(*ceed)->lock);
   ierr = CeedFree(ceed); CeedChk(ierr);
   return 0;
 }
@@ -128,6 +128,14 @@ function setarray!(v::CeedVector, mtype::MemType, cmode::CopyMode, arr)
     end
 end
 
+"""
+    memtype(arr::AbstractArray)
+
+Return the [`MemType`](@ref) of the memory holding `arr`: `MEM_DEVICE` for a `CuArray`, and
+`MEM_HOST` otherwise.
+"""
+memtype(::AbstractArray) = MEM_HOST
+
 """
     syncarray!(v::CeedVector, mtype::MemType)
 
@@ -175,12 +183,16 @@ function witharray_parse(assignment, args)
     arr, v, sz, mtype, body
 end
 
+# Device data is wrapped as a CuArray without a copy once CUDA.jl is loaded
+isdevicearray(mtype::MemType) = mtype == MEM_DEVICE && cuda_is_loaded
+
 """
     @witharray(v_arr=v, [size=(dims...)], [mtype=MEM_HOST], body)
 
 Executes `body`, having extracted the contents of the [`CeedVector`](@ref) `v` as an array
 with name `v_arr`. If the [`memory type`](@ref MemType) `mtype` is not provided, `MEM_HOST`
-will be used. If the size is not specified, a flat vector will be assumed.
+will be used. If the size is not specified, a flat vector will be assumed. With `MEM_DEVICE`
+and CUDA.jl loaded, `v_arr` is a `CuArray` wrapping the device data without a copy.
 
 # Examples
 Negate the contents of `CeedVector` `v`:
@@ -194,8 +206,13 @@ macro witharray(assignment, args...)
         arr_ref = Ref{Ptr{C.CeedScalar}}()
         C.CeedVectorGetArray($(esc(v))[], $(esc(mtype)), arr_ref)
         try
-            $(esc(arr)) = UnsafeArray(arr_ref[], Int.($sz))
-            $(esc(body))
+            if isdevicearray($(esc(mtype)))
+                $(esc(arr)) = devicearray(arr_ref[], Int.($sz))
+                $(esc(body))
+            else
+                $(esc(arr)) = UnsafeArray(arr_ref[], Int.($sz))
+                $(esc(body))
+            end
         finally
             C.CeedVectorRestoreArray($(esc(v))[], arr_ref)
         end
@@ -213,8 +230,13 @@ macro witharray_read(assignment, args...)
         arr_ref = Ref{Ptr{C.CeedScalar}}()
         C.CeedVectorGetArrayRead($(esc(v))[], $(esc(mtype)), arr_ref)
         try
-            $(esc(arr)) = UnsafeArray(arr_ref[], Int.($sz))
-            $(esc(body))
+            if isdevicearray($(esc(mtype)))
+                $(esc(arr)) = devicearray(arr_ref[], Int.($sz))
+                $(esc(body))
+            else
+                $(esc(arr)) = UnsafeArray(arr_ref[], Int.($sz))
+                $(esc(body))
+            end
         finally
             C.CeedVectorRestoreArrayRead($(esc(v))[], arr_ref)
         end
@@ -230,13 +252,26 @@ Sets the values of [`CeedVector`](@ref) `v` equal to those of `v2` using broadca
 Base.setindex!(v::CeedVector, v2::AbstractArray) = @witharray(a = v, a .= v2)
 
 """
-    CeedVector(c::Ceed, v2::AbstractVector; mtype=MEM_HOST, cmode=COPY_VALUES)
+    CeedVector(c::Ceed, v2::AbstractVector; mtype=memtype(v2), cmode=COPY_VALUES)
 
 Creates a new [`CeedVector`](@ref) using the contents of the given vector `v2`. By default,
 the contents of `v2` will be copied to the new [`CeedVector`](@ref), but this behavior can
 be changed by specifying a different `cmode`.
+
+With `cmode=USE_POINTER`, the [`CeedVector`](@ref) uses the memory of `v2` directly and
+keeps a reference to `v2`, so a Julia `Array` or, with CUDA.jl loaded, a `CuArray` can be
+passed to libCEED without a copy. `CuArray`s are given to libCEED as `MEM_DEVICE` memory.
+
+# Examples
+Apply an operator to the data of Julia arrays in place:
+```
+u = CeedVector(c, u_arr; cmode=USE_POINTER)
+v = CeedVector(c, v_arr; cmode=USE_POINTER)
+apply!(op, u, v)
+syncarray!(v, memtype(v_arr))
+```
 """
-function CeedVector(c::Ceed, v2::AbstractVector; mtype=MEM_HOST, cmode=COPY_VALUES)
+function CeedVector(c::Ceed, v2::AbstractVector; mtype=memtype(v2), cmode=COPY_VALUES)
     v = CeedVector(c, length(v2))
     setarray!(v, mtype, cmode, v2)
     v
@@ -256,7 +291,8 @@ end
     witharray(f, v::CeedVector, mtype=MEM_HOST)
 
 Calls `f` with an array containing the data of the `CeedVector` `v`, using [`memory
-type`](@ref MemType) `mtype`.
+type`](@ref MemType) `mtype`. With `MEM_DEVICE` and CUDA.jl loaded, `f` is passed a
+`CuArray` wrapping the device data without a copy.
 
 Because of performance issues involving closures, if `f` is a complex operation, it may be
 more efficient to use the macro version `@witharray` (cf. the section on "Performance of
@@ -274,9 +310,12 @@ witharray(sum, v)
 function witharray(f, v::CeedVector, mtype::MemType=MEM_HOST)
     arr_ref = Ref{Ptr{C.CeedScalar}}()
     C.CeedVectorGetArray(v[], mtype, arr_ref)
-    arr = UnsafeArray(arr_ref[], (length(v),))
     res = try
-        f(arr)
+        if isdevicearray(mtype)
+            f(devicearray(arr_ref[], (length(v),)))
+        else
+            f(UnsafeArray(arr_ref[], (length(v),)))
+        end
     finally
         C.CeedVectorRestoreArray(v[], arr_ref)
     end
@@ -298,9 +337,12 @@ witharray_read(display, v)
 function witharray_read(f, v::CeedVector, mtype::MemType=MEM_HOST)
     arr_ref = Ref{Ptr{C.CeedScalar}}()
     C.CeedVectorGetArrayRead(v[], mtype, arr_ref)
-    arr = UnsafeArray(arr_ref[], (length(v),))
     res = try
-        f(arr)
+        if isdevicearray(mtype)
+            f(devicearray(arr_ref[], (length(v),)))
+        else
+            f(UnsafeArray(arr_ref[], (length(v),)))
+        end
     finally
         C.CeedVectorRestoreArrayRead(v[], arr_ref)
     end
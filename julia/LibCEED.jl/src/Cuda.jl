@@ -51,6 +51,12 @@ function setarray!(v::CeedVector, mtype::MemType, cmode::CopyMode, arr::CuArray)
     end
 end
 
+memtype(::CuArray) = MEM_DEVICE
+
+# CuArray wrapping device data of a CeedVector, without a copy
+devicearray(ptr::Ptr{CeedScalar}, dims) =
+    unsafe_wrap(CuArray, CuPtr{CeedScalar}(UInt64(ptr)), dims)
+
 struct FieldsCuda
     inputs::NTuple{16,Int}
     outputs::NTuple{16,Int}
@@ -23,11 +23,12 @@ const GAUSS_LOBATTO = C.CEED_GAUSS_LOBATTO
 """
     MemType
 
-One of `MEM_HOST` or `MEM_DEVICE`.
+One of `MEM_HOST`, `MEM_DEVICE`, or `MEM_UNIFIED`.
 """
 const MemType = C.CeedMemType
 const MEM_HOST = C.CEED_MEM_HOST
 const MEM_DEVICE = C.CEED_MEM_DEVICE
+const MEM_UNIFIED = C.CEED_MEM_UNIFIED
 
 """
     CopyMode
@@ -39,6 +39,7 @@ export @interior_qf,
     LINE,
     MEM_DEVICE,
     MEM_HOST,
+    MEM_UNIFIED,
     MemType,
     NORM_1,
     NORM_2,
@@ -112,6 +113,7 @@ export @interior_qf,
     iscuda,
     isdeterministic,
     lobatto_quadrature,
+    memtype,
     norm,
     reciprocal!,
     set_context!,
@@ -14,6 +14,62 @@ function CeedIsDeterministic(ceed, isDeterministic)
     ccall((:CeedIsDeterministic, libceed), Cint, (Ceed, Ptr{Bool}), ceed, isDeterministic)
 end
 
+function CeedSetProfiling(ceed, profile)
+    ccall((:CeedSetProfiling, libceed), Cint, (Ceed, Bool), ceed, profile)
+end
+
+function CeedIsProfiling(ceed, profile)
+    ccall((:CeedIsProfiling, libceed), Cint, (Ceed, Ptr{Bool}), ceed, profile)
+end
+
+function CeedSetTraceFile(ceed, filename)
+    ccall((:CeedSetTraceFile, libceed), Cint, (Ceed, Cstring), ceed, filename)
+end
+
+function CeedSetJitOptions(ceed, options)
+    ccall((:CeedSetJitOptions, libceed), Cint, (Ceed, Cstring), ceed, options)
+end
+
+function CeedGetJitOptions(ceed, options)
+    ccall((:CeedGetJitOptions, libceed), Cint, (Ceed, Ptr{Cstring}), ceed, options)
+end
+
+function CeedMemoryPoolTrim(ceed)
+    ccall((:CeedMemoryPoolTrim, libceed), Cint, (Ceed,), ceed)
+end
+
+function CeedMemoryPoolGetUsage(ceed, inuse, cached, highwater)
+    ccall((:CeedMemoryPoolGetUsage, libceed), Cint, (Ceed, Ptr{Csize_t}, Ptr{Csize_t}, Ptr{Csize_t}), ceed, inuse, cached, highwater)
+end
+
+function CeedSetSyncAudit(ceed, mode)
+    ccall((:CeedSetSyncAudit, libceed), Cint, (Ceed, CeedSyncAuditMode), ceed, mode)
+end
+
+function CeedSyncAuditRegionBegin(ceed, name)
+    ccall((:CeedSyncAuditRegionBegin, libceed), Cint, (Ceed, Cstring), ceed, name)
+end
+
+function CeedSyncAuditRegionEnd(ceed)
+    ccall((:CeedSyncAuditRegionEnd, libceed), Cint, (Ceed,), ceed)
+end
+
+function CeedGetSyncAuditCounts(ceed, h2d, d2h)
+    ccall((:CeedGetSyncAuditCounts, libceed), Cint, (Ceed, Ptr{CeedInt}, Ptr{CeedInt}), ceed, h2d, d2h)
+end
+
+function CeedGetMemoryUsage(ceed, memclass, space, bytes)
+    ccall((:CeedGetMemoryUsage, libceed), Cint, (Ceed, CeedMemoryClass, CeedMemSpace, Ptr{Csize_t}), ceed, memclass, space, bytes)
+end
+
+function CeedGetMemoryHighWater(ceed, space, bytes)
+    ccall((:CeedGetMemoryHighWater, libceed), Cint, (Ceed, CeedMemSpace, Ptr{Csize_t}), ceed, space, bytes)
+end
+
+function CeedSetCurrentDevice(ceed)
+    ccall((:CeedSetCurrentDevice, libceed), Cint, (Ceed,), ceed)
+end
+
 function CeedView(ceed, stream)
     ccall((:CeedView, libceed), Cint, (Ceed, Ptr{FILE}), ceed, stream)
 end
@@ -94,10 +150,38 @@ function CeedVectorNorm(vec, type, norm)
     ccall((:CeedVectorNorm, libceed), Cint, (CeedVector, CeedNormType, Ptr{CeedScalar}), vec, type, norm)
 end
 
+function CeedVectorNorms(vec, nnorms, types, norms)
+    ccall((:CeedVectorNorms, libceed), Cint, (CeedVector, CeedInt, Ptr{CeedNormType}, CeedVector), vec, nnorms, types, norms)
+end
+
 function CeedVectorReciprocal(vec)
     ccall((:CeedVectorReciprocal, libceed), Cint, (CeedVector,), vec)
 end
 
+function CeedVectorPointBlockInvert(vec, bsize)
+    ccall((:CeedVectorPointBlockInvert, libceed), Cint, (CeedVector, CeedInt), vec, bsize)
+end
+
+function CeedVectorAXPY(y, alpha, x)
+    ccall((:CeedVectorAXPY, libceed), Cint, (CeedVector, CeedScalar, CeedVector), y, alpha, x)
+end
+
+function CeedVectorAXPBY(y, alpha, beta, x)
+    ccall((:CeedVectorAXPBY, libceed), Cint, (CeedVector, CeedScalar, CeedScalar, CeedVector), y, alpha, beta, x)
+end
+
+function CeedVectorPointwiseMult(w, x, y)
+    ccall((:CeedVectorPointwiseMult, libceed), Cint, (CeedVector, CeedVector, CeedVector), w, x, y)
+end
+
+function CeedVectorDot(x, y, result)
+    ccall((:CeedVectorDot, libceed), Cint, (CeedVector, CeedVector, Ptr{CeedScalar}), x, y, result)
+end
+
+function CeedVectorDotVector(x, y, dot)
+    ccall((:CeedVectorDotVector, libceed), Cint, (CeedVector, CeedVector, CeedVector), x, y, dot)
+end
+
 function CeedVectorView(vec, fpfmt, stream)
     ccall((:CeedVectorView, libceed), Cint, (CeedVector, Cstring, Ptr{FILE}), vec, fpfmt, stream)
 end
@@ -106,6 +190,10 @@ function CeedVectorGetLength(vec, length)
     ccall((:CeedVectorGetLength, libceed), Cint, (CeedVector, Ptr{CeedInt}), vec, length)
 end
 
+function CeedVectorGetMemoryUsage(vec, space, bytes)
+    ccall((:CeedVectorGetMemoryUsage, libceed), Cint, (CeedVector, CeedMemSpace, Ptr{Csize_t}), vec, space, bytes)
+end
+
 function CeedVectorDestroy(vec)
     ccall((:CeedVectorDestroy, libceed), Cint, (Ptr{CeedVector},), vec)
 end
@@ -130,6 +218,14 @@ function CeedElemRestrictionCreateBlockedStrided(ceed, nelem, elemsize, blksize,
     ccall((:CeedElemRestrictionCreateBlockedStrided, libceed), Cint, (Ceed, CeedInt, CeedInt, CeedInt, CeedInt, CeedInt, Ptr{CeedInt}, Ptr{CeedElemRestriction}), ceed, nelem, elemsize, blksize, ncomp, lsize, strides, rstr)
 end
 
+function CeedElemRestrictionCreateCompressed(ceed, nelem, elemsize, ncomp, compstride, lsize, eoffsets, stencil, rstr)
+    ccall((:CeedElemRestrictionCreateCompressed, libceed), Cint, (Ceed, CeedInt, CeedInt, CeedInt, CeedInt, CeedInt, Ptr{CeedInt}, Ptr{CeedInt}, Ptr{CeedElemRestriction}), ceed, nelem, elemsize, ncomp, compstride, lsize, eoffsets, stencil, rstr)
+end
+
+function CeedElemRestrictionCreateBlockedCompressed(ceed, nelem, elemsize, blksize, ncomp, compstride, lsize, eoffsets, stencil, rstr)
+    ccall((:CeedElemRestrictionCreateBlockedCompressed, libceed), Cint, (Ceed, CeedInt, CeedInt, CeedInt, CeedInt, CeedInt, CeedInt, Ptr{CeedInt}, Ptr{CeedInt}, Ptr{CeedElemRestriction}), ceed, nelem, elemsize, blksize, ncomp, compstride, lsize, eoffsets, stencil, rstr)
+end
+
 function CeedElemRestrictionCreateVector(rstr, lvec, evec)
     ccall((:CeedElemRestrictionCreateVector, libceed), Cint, (CeedElemRestriction, Ptr{CeedVector}, Ptr{CeedVector}), rstr, lvec, evec)
 end
@@ -174,6 +270,10 @@ function CeedElemRestrictionGetMultiplicity(rstr, mult)
     ccall((:CeedElemRestrictionGetMultiplicity, libceed), Cint, (CeedElemRestriction, CeedVector), rstr, mult)
 end
 
+function CeedElemRestrictionGetMemoryUsage(rstr, space, bytes)
+    ccall((:CeedElemRestrictionGetMemoryUsage, libceed), Cint, (CeedElemRestriction, CeedMemSpace, Ptr{Csize_t}), rstr, space, bytes)
+end
+
 function CeedElemRestrictionView(rstr, stream)
     ccall((:CeedElemRestrictionView, libceed), Cint, (CeedElemRestriction, Ptr{FILE}), rstr, stream)
 end
@@ -186,6 +286,10 @@ function CeedBasisCreateTensorH1Lagrange(ceed, dim, ncomp, P, Q, qmode, basis)
     ccall((:CeedBasisCreateTensorH1Lagrange, libceed), Cint, (Ceed, CeedInt, CeedInt, CeedInt, CeedInt, CeedQuadMode, Ptr{CeedBasis}), ceed, dim, ncomp, P, Q, qmode, basis)
 end
 
+function CeedBasisCreateAtQuadrature(basis, Q, qmode, basisQ)
+    ccall((:CeedBasisCreateAtQuadrature, libceed), Cint, (CeedBasis, CeedInt, CeedQuadMode, Ptr{CeedBasis}), basis, Q, qmode, basisQ)
+end
+
 function CeedBasisCreateTensorH1(ceed, dim, ncomp, P1d, Q1d, interp1d, grad1d, qref1d, qweight1d, basis)
     ccall((:CeedBasisCreateTensorH1, libceed), Cint, (Ceed, CeedInt, CeedInt, CeedInt, CeedInt, Ptr{CeedScalar}, Ptr{CeedScalar}, Ptr{CeedScalar}, Ptr{CeedScalar}, Ptr{CeedBasis}), ceed, dim, ncomp, P1d, Q1d, interp1d, grad1d, qref1d, qweight1d, basis)
 end
@@ -194,6 +298,14 @@ function CeedBasisCreateH1(ceed, topo, ncomp, nnodes, nqpts, interp, grad, qref,
     ccall((:CeedBasisCreateH1, libceed), Cint, (Ceed, CeedElemTopology, CeedInt, CeedInt, CeedInt, Ptr{CeedScalar}, Ptr{CeedScalar}, Ptr{CeedScalar}, Ptr{CeedScalar}, Ptr{CeedBasis}), ceed, topo, ncomp, nnodes, nqpts, interp, grad, qref, qweight, basis)
 end
 
+function CeedBasisCreateH1Simplex(ceed, topo, ncomp, P, Q, basis)
+    ccall((:CeedBasisCreateH1Simplex, libceed), Cint, (Ceed, CeedElemTopology, CeedInt, CeedInt, CeedInt, Ptr{CeedBasis}), ceed, topo, ncomp, P, Q, basis)
+end
+
+function CeedBasisGetMemoryUsage(basis, space, bytes)
+    ccall((:CeedBasisGetMemoryUsage, libceed), Cint, (CeedBasis, CeedMemSpace, Ptr{Csize_t}), basis, space, bytes)
+end
+
 function CeedBasisView(basis, stream)
     ccall((:CeedBasisView, libceed), Cint, (CeedBasis, Ptr{FILE}), basis, stream)
 end
@@ -202,6 +314,10 @@ function CeedBasisApply(basis, nelem, tmode, emode, u, v)
     ccall((:CeedBasisApply, libceed), Cint, (CeedBasis, CeedInt, CeedTransposeMode, CeedEvalMode, CeedVector, CeedVector), basis, nelem, tmode, emode, u, v)
 end
 
+function CeedBasisGetFlopsEstimate(basis, tmode, emode, flops)
+    ccall((:CeedBasisGetFlopsEstimate, libceed), Cint, (CeedBasis, CeedTransposeMode, CeedEvalMode, Ptr{Csize_t}), basis, tmode, emode, flops)
+end
+
 function CeedBasisGetDimension(basis, dim)
     ccall((:CeedBasisGetDimension, libceed), Cint, (CeedBasis, Ptr{CeedInt}), basis, dim)
 end
@@ -282,6 +398,10 @@ function CeedQFunctionCreateInterior(ceed, vlength, f, source, qf)
     ccall((:CeedQFunctionCreateInterior, libceed), Cint, (Ceed, CeedInt, CeedQFunctionUser, Cstring, Ptr{CeedQFunction}), ceed, vlength, f, source, qf)
 end
 
+function CeedQFunctionCreateInteriorWithSource(ceed, vlength, f, source, code, qf)
+    ccall((:CeedQFunctionCreateInteriorWithSource, libceed), Cint, (Ceed, CeedInt, CeedQFunctionUser, Cstring, Cstring, Ptr{CeedQFunction}), ceed, vlength, f, source, code, qf)
+end
+
 function CeedQFunctionCreateInteriorByName(ceed, name, qf)
     ccall((:CeedQFunctionCreateInteriorByName, libceed), Cint, (Ceed, Cstring, Ptr{CeedQFunction}), ceed, name, qf)
 end
@@ -302,6 +422,14 @@ function CeedQFunctionSetContext(qf, ctx)
     ccall((:CeedQFunctionSetContext, libceed), Cint, (CeedQFunction, CeedQFunctionContext), qf, ctx)
 end
 
+function CeedQFunctionSetUserFlopsEstimate(qf, flops)
+    ccall((:CeedQFunctionSetUserFlopsEstimate, libceed), Cint, (CeedQFunction, Csize_t), qf, flops)
+end
+
+function CeedQFunctionGetUserFlopsEstimate(qf, flops)
+    ccall((:CeedQFunctionGetUserFlopsEstimate, libceed), Cint, (CeedQFunction, Ptr{Csize_t}), qf, flops)
+end
+
 function CeedQFunctionView(qf, stream)
     ccall((:CeedQFunctionView, libceed), Cint, (CeedQFunction, Ptr{FILE}), qf, stream)
 end
@@ -330,6 +458,26 @@ function CeedQFunctionContextRestoreData(ctx, data)
     ccall((:CeedQFunctionContextRestoreData, libceed), Cint, (CeedQFunctionContext, Ptr{Cvoid}), ctx, data)
 end
 
+function CeedQFunctionContextRegisterDouble(ctx, fieldname, fieldoffset, numvalues, fielddescription)
+    ccall((:CeedQFunctionContextRegisterDouble, libceed), Cint, (CeedQFunctionContext, Cstring, Csize_t, Csize_t, Cstring), ctx, fieldname, fieldoffset, numvalues, fielddescription)
+end
+
+function CeedQFunctionContextRegisterInt32(ctx, fieldname, fieldoffset, numvalues, fielddescription)
+    ccall((:CeedQFunctionContextRegisterInt32, libceed), Cint, (CeedQFunctionContext, Cstring, Csize_t, Csize_t, Cstring), ctx, fieldname, fieldoffset, numvalues, fielddescription)
+end
+
+function CeedQFunctionContextSetDouble(ctx, fieldname, values)
+    ccall((:CeedQFunctionContextSetDouble, libceed), Cint, (CeedQFunctionContext, Cstring, Ptr{Cdouble}), ctx, fieldname, values)
+end
+
+function CeedQFunctionContextSetInt32(ctx, fieldname, values)
+    ccall((:CeedQFunctionContextSetInt32, libceed), Cint, (CeedQFunctionContext, Cstring, Ptr{Cint}), ctx, fieldname, values)
+end
+
+function CeedQFunctionContextGetMemoryUsage(ctx, space, bytes)
+    ccall((:CeedQFunctionContextGetMemoryUsage, libceed), Cint, (CeedQFunctionContext, CeedMemSpace, Ptr{Csize_t}), ctx, space, bytes)
+end
+
 function CeedQFunctionContextView(ctx, stream)
     ccall((:CeedQFunctionContextView, libceed), Cint, (CeedQFunctionContext, Ptr{FILE}), ctx, stream)
 end
@@ -354,10 +502,70 @@ function CeedCompositeOperatorAddSub(compositeop, subop)
     ccall((:CeedCompositeOperatorAddSub, libceed), Cint, (CeedOperator, CeedOperator), compositeop, subop)
 end
 
+function CeedShardedOperatorCreate(ceed, op)
+    ccall((:CeedShardedOperatorCreate, libceed), Cint, (Ceed, Ptr{CeedOperator}), ceed, op)
+end
+
+function CeedShardedOperatorAddShard(shardedop, shard)
+    ccall((:CeedShardedOperatorAddShard, libceed), Cint, (CeedOperator, CeedOperator), shardedop, shard)
+end
+
+function CeedOperatorCreateChebyshevSmoother(op, diag, lmin, lmax, degree, smoother)
+    ccall((:CeedOperatorCreateChebyshevSmoother, libceed), Cint, (CeedOperator, CeedVector, CeedScalar, CeedScalar, CeedInt, Ptr{CeedOperator}), op, diag, lmin, lmax, degree, smoother)
+end
+
+function CeedOperatorCreatePointBlockJacobi(op, pbjacobi)
+    ccall((:CeedOperatorCreatePointBlockJacobi, libceed), Cint, (CeedOperator, Ptr{CeedOperator}), op, pbjacobi)
+end
+
+function CeedOperatorEstimateEigenvalues(op, diag, niter, lmin, lmax)
+    ccall((:CeedOperatorEstimateEigenvalues, libceed), Cint, (CeedOperator, CeedVector, CeedInt, Ptr{CeedScalar}, Ptr{CeedScalar}), op, diag, niter, lmin, lmax)
+end
+
+function CeedOperatorSetFieldBuilder(op, fieldname, buildop, buildinput)
+    ccall((:CeedOperatorSetFieldBuilder, libceed), Cint, (CeedOperator, Cstring, CeedOperator, CeedVector), op, fieldname, buildop, buildinput)
+end
+
+function CeedOperatorSetElementOrdering(op, ordering)
+    ccall((:CeedOperatorSetElementOrdering, libceed), Cint, (CeedOperator, CeedElemOrdering), op, ordering)
+end
+
+function CeedOperatorSetElementMatrixMode(op, mode)
+    ccall((:CeedOperatorSetElementMatrixMode, libceed), Cint, (CeedOperator, CeedElemMatrixMode), op, mode)
+end
+
+function CeedOperatorSetFDMMode(op, mode)
+    ccall((:CeedOperatorSetFDMMode, libceed), Cint, (CeedOperator, CeedFDMMode), op, mode)
+end
+
+function CeedOperatorSetFieldStorage(op, fieldname, storage)
+    ccall((:CeedOperatorSetFieldStorage, libceed), Cint, (CeedOperator, Cstring, CeedStorageType), op, fieldname, storage)
+end
+
+function CeedOperatorCreateSubset(op, nelem, elems, subop)
+    ccall((:CeedOperatorCreateSubset, libceed), Cint, (CeedOperator, CeedInt, Ptr{CeedInt}, Ptr{CeedOperator}), op, nelem, elems, subop)
+end
+
+function CeedOperatorCreateSubsetRange(op, first, last, subop)
+    ccall((:CeedOperatorCreateSubsetRange, libceed), Cint, (CeedOperator, CeedInt, CeedInt, Ptr{CeedOperator}), op, first, last, subop)
+end
+
+function CeedOperatorCreateReducedPrecision(op, storage, opreduced)
+    ccall((:CeedOperatorCreateReducedPrecision, libceed), Cint, (CeedOperator, CeedStorageType, Ptr{CeedOperator}), op, storage, opreduced)
+end
+
+function CeedOperatorCreateEnsemble(numinstances, instances, ensemble)
+    ccall((:CeedOperatorCreateEnsemble, libceed), Cint, (CeedInt, Ptr{CeedOperator}, Ptr{CeedOperator}), numinstances, instances, ensemble)
+end
+
 function CeedOperatorLinearAssembleQFunction(op, assembled, rstr, request)
     ccall((:CeedOperatorLinearAssembleQFunction, libceed), Cint, (CeedOperator, Ptr{CeedVector}, Ptr{CeedElemRestriction}, Ptr{CeedRequest}), op, assembled, rstr, request)
 end
 
+function CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, assembled, rstr, request)
+    ccall((:CeedOperatorLinearAssembleQFunctionBuildOrUpdate, libceed), Cint, (CeedOperator, Ptr{CeedVector}, Ptr{CeedElemRestriction}, Ptr{CeedRequest}), op, assembled, rstr, request)
+end
+
 function CeedOperatorLinearAssembleDiagonal(op, assembled, request)
     ccall((:CeedOperatorLinearAssembleDiagonal, libceed), Cint, (CeedOperator, CeedVector, Ptr{CeedRequest}), op, assembled, request)
 end
@@ -374,6 +582,14 @@ function CeedOperatorLinearAssembleAddPointBlockDiagonal(op, assembled, request)
     ccall((:CeedOperatorLinearAssembleAddPointBlockDiagonal, libceed), Cint, (CeedOperator, CeedVector, Ptr{CeedRequest}), op, assembled, request)
 end
 
+function CeedOperatorLinearAssembleSymbolic(op, nentries, rows, cols)
+    ccall((:CeedOperatorLinearAssembleSymbolic, libceed), Cint, (CeedOperator, Ptr{CeedInt}, Ptr{Ptr{CeedInt}}, Ptr{Ptr{CeedInt}}), op, nentries, rows, cols)
+end
+
+function CeedOperatorLinearAssemble(op, values)
+    ccall((:CeedOperatorLinearAssemble, libceed), Cint, (CeedOperator, CeedVector), op, values)
+end
+
 function CeedOperatorMultigridLevelCreate(opFine, PMultFine, rstrCoarse, basisCoarse, opCoarse, opProlong, opRestrict)
     ccall((:CeedOperatorMultigridLevelCreate, libceed), Cint, (CeedOperator, CeedVector, CeedElemRestriction, CeedBasis, Ptr{CeedOperator}, Ptr{CeedOperator}, Ptr{CeedOperator}), opFine, PMultFine, rstrCoarse, basisCoarse, opCoarse, opProlong, opRestrict)
 end
@@ -386,14 +602,30 @@ function CeedOperatorMultigridLevelCreateH1(opFine, PMultFine, rstrCoarse, basis
     ccall((:CeedOperatorMultigridLevelCreateH1, libceed), Cint, (CeedOperator, CeedVector, CeedElemRestriction, CeedBasis, Ptr{CeedScalar}, Ptr{CeedOperator}, Ptr{CeedOperator}, Ptr{CeedOperator}), opFine, PMultFine, rstrCoarse, basisCoarse, interpCtoF, opCoarse, opProlong, opRestrict)
 end
 
+function CeedOperatorCreateAtQuadrature(op, Q, qmode, opQ)
+    ccall((:CeedOperatorCreateAtQuadrature, libceed), Cint, (CeedOperator, CeedInt, CeedQuadMode, Ptr{CeedOperator}), op, Q, qmode, opQ)
+end
+
 function CeedOperatorCreateFDMElementInverse(op, fdminv, request)
     ccall((:CeedOperatorCreateFDMElementInverse, libceed), Cint, (CeedOperator, Ptr{CeedOperator}, Ptr{CeedRequest}), op, fdminv, request)
 end
 
+function CeedOperatorGetFlopsEstimate(op, flops)
+    ccall((:CeedOperatorGetFlopsEstimate, libceed), Cint, (CeedOperator, Ptr{Csize_t}), op, flops)
+end
+
+function CeedOperatorGetBytesEstimate(op, bytes)
+    ccall((:CeedOperatorGetBytesEstimate, libceed), Cint, (CeedOperator, Ptr{Csize_t}), op, bytes)
+end
+
 function CeedOperatorView(op, stream)
     ccall((:CeedOperatorView, libceed), Cint, (CeedOperator, Ptr{FILE}), op, stream)
 end
 
+function CeedOperatorPrepare(op)
+    ccall((:CeedOperatorPrepare, libceed), Cint, (CeedOperator,), op)
+end
+
 function CeedOperatorApply(op, in, out, request)
     ccall((:CeedOperatorApply, libceed), Cint, (CeedOperator, CeedVector, CeedVector, Ptr{CeedRequest}), op, in, out, request)
 end
@@ -402,6 +634,14 @@ function CeedOperatorApplyAdd(op, in, out, request)
     ccall((:CeedOperatorApplyAdd, libceed), Cint, (CeedOperator, CeedVector, CeedVector, Ptr{CeedRequest}), op, in, out, request)
 end
 
+function CeedOperatorApplyMultiple(op, nvecs, in, out, request)
+    ccall((:CeedOperatorApplyMultiple, libceed), Cint, (CeedOperator, CeedInt, Ptr{CeedVector}, Ptr{CeedVector}, Ptr{CeedRequest}), op, nvecs, in, out, request)
+end
+
+function CeedOperatorApplyAddMultiple(op, nvecs, in, out, request)
+    ccall((:CeedOperatorApplyAddMultiple, libceed), Cint, (CeedOperator, CeedInt, Ptr{CeedVector}, Ptr{CeedVector}, Ptr{CeedRequest}), op, nvecs, in, out, request)
+end
+
 function CeedOperatorDestroy(op)
     ccall((:CeedOperatorDestroy, libceed), Cint, (Ptr{CeedOperator},), op)
 end
@@ -448,6 +688,10 @@ function CeedRegister(prefix, init, priority)
     ccall((:CeedRegister, libceed), Cint, (Cstring, Ptr{Cvoid}, UInt32), prefix, init, priority)
 end
 
+function CeedIsRegistered(prefix, isregistered)
+    ccall((:CeedIsRegistered, libceed), Cint, (Cstring, Ptr{Bool}), prefix, isregistered)
+end
+
 function CeedIsDebug(ceed, isDebug)
     ccall((:CeedIsDebug, libceed), Cint, (Ceed, Ptr{Bool}), ceed, isDebug)
 end
@@ -488,6 +732,26 @@ function CeedSetDeterministic(ceed, isDeterministic)
     ccall((:CeedSetDeterministic, libceed), Cint, (Ceed, Bool), ceed, isDeterministic)
 end
 
+function CeedProfileStart(ceed, stage, start)
+    ccall((:CeedProfileStart, libceed), Cint, (Ceed, CeedProfileStage, Ptr{Cdouble}), ceed, stage, start)
+end
+
+function CeedProfileStop(ceed, stage, start, bytes)
+    ccall((:CeedProfileStop, libceed), Cint, (Ceed, CeedProfileStage, Cdouble, Cdouble), ceed, stage, start, bytes)
+end
+
+function CeedProfileSuspend(ceed, suspend)
+    ccall((:CeedProfileSuspend, libceed), Cint, (Ceed, Bool), ceed, suspend)
+end
+
+function CeedVectorAuditTransfer(vec, dest, bytes)
+    ccall((:CeedVectorAuditTransfer, libceed), Cint, (CeedVector, CeedMemType, Csize_t), vec, dest, bytes)
+end
+
+function CeedTrackMemory(ceed, memclass, space, bytes)
+    ccall((:CeedTrackMemory, libceed), Cint, (Ceed, CeedMemoryClass, CeedMemSpace, Cptrdiff_t), ceed, memclass, space, bytes)
+end
+
 function CeedSetBackendFunction(ceed, type, object, fname, f)
     ccall((:CeedSetBackendFunction, libceed), Cint, (Ceed, Cstring, Ptr{Cvoid}, Cstring, Ptr{Cvoid}), ceed, type, object, fname, f)
 end
@@ -500,6 +764,22 @@ function CeedSetData(ceed, data)
     ccall((:CeedSetData, libceed), Cint, (Ceed, Ptr{Cvoid}), ceed, data)
 end
 
+function CeedRequestCreate(ceed, req)
+    ccall((:CeedRequestCreate, libceed), Cint, (Ceed, Ptr{CeedRequest}), ceed, req)
+end
+
+function CeedRequestGetCeed(req, ceed)
+    ccall((:CeedRequestGetCeed, libceed), Cint, (CeedRequest, Ptr{Ceed}), req, ceed)
+end
+
+function CeedRequestGetData(req, data)
+    ccall((:CeedRequestGetData, libceed), Cint, (CeedRequest, Ptr{Cvoid}), req, data)
+end
+
+function CeedRequestSetData(req, data)
+    ccall((:CeedRequestSetData, libceed), Cint, (CeedRequest, Ptr{Cvoid}), req, data)
+end
+
 function CeedVectorGetCeed(vec, ceed)
     ccall((:CeedVectorGetCeed, libceed), Cint, (CeedVector, Ptr{Ceed}), vec, ceed)
 end
@@ -520,10 +800,26 @@ function CeedVectorSetData(vec, data)
     ccall((:CeedVectorSetData, libceed), Cint, (CeedVector, Ptr{Cvoid}), vec, data)
 end
 
+function CeedVectorTrackMemory(vec, space, bytes)
+    ccall((:CeedVectorTrackMemory, libceed), Cint, (CeedVector, CeedMemSpace, Cptrdiff_t), vec, space, bytes)
+end
+
+function CeedVectorSetMemoryClass(vec, memclass)
+    ccall((:CeedVectorSetMemoryClass, libceed), Cint, (CeedVector, CeedMemoryClass), vec, memclass)
+end
+
+function CeedVectorChebyshevUpdate(x, d, r, w, dinv, alpha, beta)
+    ccall((:CeedVectorChebyshevUpdate, libceed), Cint, (CeedVector, CeedVector, CeedVector, CeedVector, CeedVector, CeedScalar, CeedScalar), x, d, r, w, dinv, alpha, beta)
+end
+
 function CeedElemRestrictionGetCeed(rstr, ceed)
     ccall((:CeedElemRestrictionGetCeed, libceed), Cint, (CeedElemRestriction, Ptr{Ceed}), rstr, ceed)
 end
 
+function CeedElemRestrictionAddReference(rstr)
+    ccall((:CeedElemRestrictionAddReference, libceed), Cint, (CeedElemRestriction,), rstr)
+end
+
 function CeedElemRestrictionGetStrides(rstr, strides)
     ccall((:CeedElemRestrictionGetStrides, libceed), Cint, (CeedElemRestriction, Ptr{NTuple{3, CeedInt}}), rstr, strides)
 end
@@ -544,6 +840,14 @@ function CeedElemRestrictionHasBackendStrides(rstr, hasbackendstrides)
     ccall((:CeedElemRestrictionHasBackendStrides, libceed), Cint, (CeedElemRestriction, Ptr{Bool}), rstr, hasbackendstrides)
 end
 
+function CeedElemRestrictionIsCompressed(rstr, iscompressed)
+    ccall((:CeedElemRestrictionIsCompressed, libceed), Cint, (CeedElemRestriction, Ptr{Bool}), rstr, iscompressed)
+end
+
+function CeedElemRestrictionGetCompressedOffsets(rstr, eoffsets, stencil)
+    ccall((:CeedElemRestrictionGetCompressedOffsets, libceed), Cint, (CeedElemRestriction, Ptr{Ptr{CeedInt}}, Ptr{Ptr{CeedInt}}), rstr, eoffsets, stencil)
+end
+
 function CeedElemRestrictionGetELayout(rstr, layout)
     ccall((:CeedElemRestrictionGetELayout, libceed), Cint, (CeedElemRestriction, Ptr{NTuple{3, CeedInt}}), rstr, layout)
 end
@@ -560,6 +864,34 @@ function CeedElemRestrictionSetData(rstr, data)
     ccall((:CeedElemRestrictionSetData, libceed), Cint, (CeedElemRestriction, Ptr{Cvoid}), rstr, data)
 end
 
+function CeedElemRestrictionTrackMemory(rstr, space, bytes)
+    ccall((:CeedElemRestrictionTrackMemory, libceed), Cint, (CeedElemRestriction, CeedMemSpace, Cptrdiff_t), rstr, space, bytes)
+end
+
+function CeedElemRestrictionGetElementOrdering(rstr, ordering, perm)
+    ccall((:CeedElemRestrictionGetElementOrdering, libceed), Cint, (CeedElemRestriction, CeedElemOrdering, Ptr{CeedInt}), rstr, ordering, perm)
+end
+
+function CeedElemRestrictionCreateSubset(rstr, nelem, elems, rstrsub)
+    ccall((:CeedElemRestrictionCreateSubset, libceed), Cint, (CeedElemRestriction, CeedInt, Ptr{CeedInt}, Ptr{CeedElemRestriction}), rstr, nelem, elems, rstrsub)
+end
+
+function CeedElemRestrictionCreatePermuted(rstr, perm, rstrperm)
+    ccall((:CeedElemRestrictionCreatePermuted, libceed), Cint, (CeedElemRestriction, Ptr{CeedInt}, Ptr{CeedElemRestriction}), rstr, perm, rstrperm)
+end
+
+function CeedElemRestrictionCreateConcatenated(nrstr, rstrs, rstrcat)
+    ccall((:CeedElemRestrictionCreateConcatenated, libceed), Cint, (CeedInt, Ptr{CeedElemRestriction}, Ptr{CeedElemRestriction}), nrstr, rstrs, rstrcat)
+end
+
+function CeedElemRestrictionGetCachedEVector(rstr, lvec, evec, request)
+    ccall((:CeedElemRestrictionGetCachedEVector, libceed), Cint, (CeedElemRestriction, CeedVector, Ptr{CeedVector}, Ptr{CeedRequest}), rstr, lvec, evec, request)
+end
+
+function CeedElemRestrictionApplyOverwrite(rstr, u, ru, request)
+    ccall((:CeedElemRestrictionApplyOverwrite, libceed), Cint, (CeedElemRestriction, CeedVector, CeedVector, Ptr{CeedRequest}), rstr, u, ru, request)
+end
+
 function CeedBasisGetCollocatedGrad(basis, colograd1d)
     ccall((:CeedBasisGetCollocatedGrad, libceed), Cint, (CeedBasis, Ptr{CeedScalar}), basis, colograd1d)
 end
@@ -576,6 +908,10 @@ function CeedBasisIsTensor(basis, istensor)
     ccall((:CeedBasisIsTensor, libceed), Cint, (CeedBasis, Ptr{Bool}), basis, istensor)
 end
 
+function CeedBasisIsCollocated(basis, iscollocated)
+    ccall((:CeedBasisIsCollocated, libceed), Cint, (CeedBasis, Ptr{Bool}), basis, iscollocated)
+end
+
 function CeedBasisGetData(basis, data)
     ccall((:CeedBasisGetData, libceed), Cint, (CeedBasis, Ptr{Cvoid}), basis, data)
 end
@@ -584,10 +920,18 @@ function CeedBasisSetData(basis, data)
     ccall((:CeedBasisSetData, libceed), Cint, (CeedBasis, Ptr{Cvoid}), basis, data)
 end
 
+function CeedBasisTrackMemory(basis, space, bytes)
+    ccall((:CeedBasisTrackMemory, libceed), Cint, (CeedBasis, CeedMemSpace, Cptrdiff_t), basis, space, bytes)
+end
+
 function CeedBasisGetTopologyDimension(topo, dim)
     ccall((:CeedBasisGetTopologyDimension, libceed), Cint, (CeedElemTopology, Ptr{CeedInt}), topo, dim)
 end
 
+function CeedBasisGetCollapsedSimplex(basis, P1d, Q1d, vinv, interpc, gradc, detadx)
+    ccall((:CeedBasisGetCollapsedSimplex, libceed), Cint, (CeedBasis, Ptr{CeedInt}, Ptr{CeedInt}, Ptr{Ptr{CeedScalar}}, Ptr{Ptr{CeedScalar}}, Ptr{Ptr{CeedScalar}}, Ptr{Ptr{CeedScalar}}), basis, P1d, Q1d, vinv, interpc, gradc, detadx)
+end
+
 function CeedBasisGetTensorContract(basis, contract)
     ccall((:CeedBasisGetTensorContract, libceed), Cint, (CeedBasis, Ptr{CeedTensorContract}), basis, contract)
 end
@@ -604,6 +948,10 @@ function CeedTensorContractApply(contract, A, B, C, J, t, tmode, Add, u, v)
     ccall((:CeedTensorContractApply, libceed), Cint, (CeedTensorContract, CeedInt, CeedInt, CeedInt, CeedInt, Ptr{CeedScalar}, CeedTransposeMode, CeedInt, Ptr{CeedScalar}, Ptr{CeedScalar}), contract, A, B, C, J, t, tmode, Add, u, v)
 end
 
+function CeedTensorContractApplyFull(contract, dim, ncomp, P, Q, nelem, t, tmode, Add, u, v)
+    ccall((:CeedTensorContractApplyFull, libceed), Cint, (CeedTensorContract, CeedInt, CeedInt, CeedInt, CeedInt, CeedInt, Ptr{Ptr{CeedScalar}}, CeedTransposeMode, CeedInt, Ptr{CeedScalar}, Ptr{CeedScalar}), contract, dim, ncomp, P, Q, nelem, t, tmode, Add, u, v)
+end
+
 function CeedTensorContractGetCeed(contract, ceed)
     ccall((:CeedTensorContractGetCeed, libceed), Cint, (CeedTensorContract, Ptr{Ceed}), contract, ceed)
 end
@@ -620,8 +968,8 @@ function CeedTensorContractDestroy(contract)
     ccall((:CeedTensorContractDestroy, libceed), Cint, (Ptr{CeedTensorContract},), contract)
 end
 
-function CeedQFunctionRegister(arg1, arg2, arg3, arg4, init)
-    ccall((:CeedQFunctionRegister, libceed), Cint, (Cstring, Cstring, CeedInt, CeedQFunctionUser, Ptr{Cvoid}), arg1, arg2, arg3, arg4, init)
+function CeedQFunctionRegister(arg1, arg2, arg3, arg4, arg5, init)
+    ccall((:CeedQFunctionRegister, libceed), Cint, (Cstring, Cstring, Cstring, CeedInt, CeedQFunctionUser, Ptr{Cvoid}), arg1, arg2, arg3, arg4, arg5, init)
 end
 
 function CeedQFunctionSetFortranStatus(qf, status)
@@ -644,6 +992,10 @@ function CeedQFunctionGetSourcePath(qf, source)
     ccall((:CeedQFunctionGetSourcePath, libceed), Cint, (CeedQFunction, Ptr{Cstring}), qf, source)
 end
 
+function CeedQFunctionGetSourceCode(qf, code)
+    ccall((:CeedQFunctionGetSourceCode, libceed), Cint, (CeedQFunction, Ptr{Cstring}), qf, code)
+end
+
 function CeedQFunctionGetUserFunction(qf, f)
     ccall((:CeedQFunctionGetUserFunction, libceed), Cint, (CeedQFunction, Ptr{CeedQFunctionUser}), qf, f)
 end
@@ -668,6 +1020,10 @@ function CeedQFunctionSetData(qf, data)
     ccall((:CeedQFunctionSetData, libceed), Cint, (CeedQFunction, Ptr{Cvoid}), qf, data)
 end
 
+function CeedQFunctionApplyRaw(qf, Q, u, v)
+    ccall((:CeedQFunctionApplyRaw, libceed), Cint, (CeedQFunction, CeedInt, Ptr{Ptr{CeedScalar}}, Ptr{Ptr{CeedScalar}}), qf, Q, u, v)
+end
+
 function CeedQFunctionGetFields(qf, inputfields, outputfields)
     ccall((:CeedQFunctionGetFields, libceed), Cint, (CeedQFunction, Ptr{Ptr{CeedQFunctionField}}, Ptr{Ptr{CeedQFunctionField}}), qf, inputfields, outputfields)
 end
@@ -704,6 +1060,10 @@ function CeedQFunctionContextSetBackendData(ctx, data)
     ccall((:CeedQFunctionContextSetBackendData, libceed), Cint, (CeedQFunctionContext, Ptr{Cvoid}), ctx, data)
 end
 
+function CeedQFunctionContextTrackMemory(ctx, space, bytes)
+    ccall((:CeedQFunctionContextTrackMemory, libceed), Cint, (CeedQFunctionContext, CeedMemSpace, Cptrdiff_t), ctx, space, bytes)
+end
+
 function CeedOperatorGetCeed(op, ceed)
     ccall((:CeedOperatorGetCeed, libceed), Cint, (CeedOperator, Ptr{Ceed}), op, ceed)
 end
@@ -768,6 +1128,34 @@ function CeedOperatorFieldGetVector(opfield, vec)
     ccall((:CeedOperatorFieldGetVector, libceed), Cint, (CeedOperatorField, Ptr{CeedVector}), opfield, vec)
 end
 
+function CeedOperatorFieldGetStorage(opfield, storage)
+    ccall((:CeedOperatorFieldGetStorage, libceed), Cint, (CeedOperatorField, Ptr{CeedStorageType}), opfield, storage)
+end
+
+function CeedOperatorCreateDelegate(op, ceed, opdelegate)
+    ccall((:CeedOperatorCreateDelegate, libceed), Cint, (CeedOperator, Ceed, Ptr{CeedOperator}), op, ceed, opdelegate)
+end
+
+function CeedOperatorDestroyDelegate(opdelegate)
+    ccall((:CeedOperatorDestroyDelegate, libceed), Cint, (Ptr{CeedOperator},), opdelegate)
+end
+
+function CeedStorageGetSize(storage, size)
+    ccall((:CeedStorageGetSize, libceed), Cint, (CeedStorageType, Ptr{Csize_t}), storage, size)
+end
+
+function CeedStorageNarrow(storage, n, in, out)
+    ccall((:CeedStorageNarrow, libceed), Cint, (CeedStorageType, CeedInt, Ptr{CeedScalar}, Ptr{Cvoid}), storage, n, in, out)
+end
+
+function CeedStorageWiden(storage, n, in, out)
+    ccall((:CeedStorageWiden, libceed), Cint, (CeedStorageType, CeedInt, Ptr{Cvoid}, Ptr{CeedScalar}), storage, n, in, out)
+end
+
+function CeedVectorRoundToStorage(vec, storage)
+    ccall((:CeedVectorRoundToStorage, libceed), Cint, (CeedVector, CeedStorageType), vec, storage)
+end
+
 function CeedMatrixMultiply(ceed, matA, matB, matC, m, n, kk)
     ccall((:CeedMatrixMultiply, libceed), Cint, (Ceed, Ptr{CeedScalar}, Ptr{CeedScalar}, Ptr{CeedScalar}, CeedInt, CeedInt, CeedInt), ceed, matA, matB, matC, m, n, kk)
 end
@@ -29,6 +29,31 @@ const CeedOperator = Ptr{CeedOperator_private}
 @cenum CeedMemType::UInt32 begin
     CEED_MEM_HOST = 0
     CEED_MEM_DEVICE = 1
+    CEED_MEM_UNIFIED = 2
+end
+
+@cenum CeedMemSpace::UInt32 begin
+    CEED_MEMSPACE_HOST = 0
+    CEED_MEMSPACE_DEVICE = 1
+    CEED_MEMSPACE_PINNED = 2
+    CEED_MEMSPACE_NUM = 3
+end
+
+@cenum CeedSyncAuditMode::UInt32 begin
+    CEED_SYNC_AUDIT_NONE = 0
+    CEED_SYNC_AUDIT_LOG = 1
+    CEED_SYNC_AUDIT_ERROR = 2
+end
+
+@cenum CeedMemoryClass::UInt32 begin
+    CEED_MEMORY_VECTOR = 0
+    CEED_MEMORY_QDATA = 1
+    CEED_MEMORY_EVECTOR = 2
+    CEED_MEMORY_ASSEMBLED = 3
+    CEED_MEMORY_RESTRICTION = 4
+    CEED_MEMORY_BASIS = 5
+    CEED_MEMORY_CONTEXT = 6
+    CEED_MEMORY_NUM_CLASSES = 7
 end
 
 @cenum CeedCopyMode::UInt32 begin
@@ -48,6 +73,28 @@ end
     CEED_TRANSPOSE = 1
 end
 
+@cenum CeedElemOrdering::UInt32 begin
+    CEED_ORDERING_NATURAL = 0
+    CEED_ORDERING_RCM = 1
+end
+
+@cenum CeedElemMatrixMode::UInt32 begin
+    CEED_ELEMMATRIX_NEVER = 0
+    CEED_ELEMMATRIX_AUTO = 1
+    CEED_ELEMMATRIX_ALWAYS = 2
+end
+
+@cenum CeedFDMMode::UInt32 begin
+    CEED_FDM_AVERAGED = 0
+    CEED_FDM_DIRECTIONAL = 1
+end
+
+@cenum CeedStorageType::UInt32 begin
+    CEED_STORAGE_SCALAR = 0
+    CEED_STORAGE_FP32 = 1
+    CEED_STORAGE_BF16 = 2
+end
+
 @cenum CeedEvalMode::UInt32 begin
     CEED_EVAL_NONE = 0
     CEED_EVAL_INTERP = 1
@@ -72,6 +119,11 @@ end
     CEED_HEX = 196614
 end
 
+@cenum CeedContextFieldType::UInt32 begin
+    CEED_CONTEXT_FIELD_DOUBLE = 1
+    CEED_CONTEXT_FIELD_INT32 = 2
+end
+
 
 const CeedQFunctionUser = Ptr{Cvoid}
 
@@ -83,6 +135,17 @@ const CEED_COMPOSITE_MAX = 16
 const CEED_EPSILON = 1.0e-16
 const CEED_DEBUG_COLOR = 0
 
+@cenum CeedProfileStage::UInt32 begin
+    CEED_PROFILE_OPERATOR = 0
+    CEED_PROFILE_RESTRICTION = 1
+    CEED_PROFILE_BASIS = 2
+    CEED_PROFILE_QFUNCTION = 3
+    CEED_PROFILE_TRANSFER = 4
+    CEED_PROFILE_INIT = 5
+    CEED_PROFILE_COMPILE = 6
+    CEED_PROFILE_NUM_STAGES = 7
+end
+
 # Skipping MacroDefinition: CeedDebug1 ( ceed , format , ... ) CeedDebugImpl ( ceed , format , ## __VA_ARGS__ )
 # Skipping MacroDefinition: CeedDebug256 ( ceed , color , ... ) CeedDebugImpl256 ( ceed , color , ## __VA_ARGS__ )
 # Skipping MacroDefinition: CeedDebug ( ... ) CeedDebug256 ( ceed , ( unsigned char ) CEED_DEBUG_COLOR , ## __VA_ARGS__ )
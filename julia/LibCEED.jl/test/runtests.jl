@@ -91,6 +91,13 @@ end
         vm = CeedVector(c, vec(m))
         @test @witharray_read(a = vm, size = size(m), a == m)
 
+        a3 = zeros(n)
+        @test memtype(a3) == MEM_HOST
+        v3 = CeedVector(c, a3; cmode=USE_POINTER)
+        v3[] = 2.0
+        syncarray!(v3, MEM_HOST)
+        @test all(a3 .== 2.0)
+
         @test CeedVectorActive()[] == LibCEED.C.CEED_VECTOR_ACTIVE[]
         @test CeedVectorNone()[] == LibCEED.C.CEED_VECTOR_NONE[]
     end
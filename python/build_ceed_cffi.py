@@ -25,6 +25,7 @@ ffibuilder = FFI()
 with open(os.path.abspath("include/ceed.h")) as f:
     lines = [line.strip() for line in f if
              not line.startswith("#") and
+             "typedef float CeedScalar" not in line and
              not line.startswith("  static") and
              "CeedErrorImpl" not in line and
              "const char *, ...);" not in line and
@@ -302,21 +302,26 @@ class Ceed():
                        interp, grad, qref, qweight)
 
     # CeedQFunction
-    def QFunction(self, vlength, f, source):
+    def QFunction(self, vlength, f, source, name=None):
         """Ceed QFunction: point-wise operation at quadrature points for
              evaluating volumetric terms.
 
            Args:
              vlength: vector length. Caller must ensure that number of quadrature
                         points is a multiple of vlength
-             f: ctypes function pointer to evaluate action at quadrature points
+             f: function to evaluate action at quadrature points, a ctypes
+                  function pointer, a Numba @cfunc with the CeedQFunctionUser
+                  signature, or the address of a compiled function
              source: absolute path to source of QFunction,
-               "\\abs_path\\file.h:function_name
+               "\\abs_path\\file.h:function_name, or the C source of the
+               QFunction for JiT backends
+             **name: name of the QFunction in a C source string, default the
+                       name of f
 
            Returns:
              qfunction: Ceed QFunction"""
 
-        return QFunction(self, vlength, f, source)
+        return QFunction(self, vlength, f, source, name)
 
     def QFunctionByName(self, name):
         """Ceed QFunction By Name: point-wise operation at quadrature points
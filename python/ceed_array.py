@@ -0,0 +1,232 @@
+# Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+# the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+# reserved. See files LICENSE and NOTICE for details.
+#
+# This file is part of CEED, a collection of benchmarks, miniapps, software
+# libraries and APIs for efficient high-order finite element and spectral
+# element discretizations for exascale applications. For more information and
+# source code availability see http://github.com/ceed.
+#
+# The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+# a collaborative effort of two U.S. Department of Energy organizations (Office
+# of Science and the National Nuclear Security Administration) responsible for
+# the planning and preparation of a capable exascale ecosystem, including
+# software, applications, hardware, advanced system engineering and early
+# testbed platforms, in support of the nation's exascale computing imperative.
+
+import ctypes
+from .ceed_constants import MEM_HOST
+
+# ------------------------------------------------------------------------------
+# DLPack
+#   https://dmlc.github.io/dlpack/latest/c_api.html
+# ------------------------------------------------------------------------------
+_DL_CPU = 1
+_DL_CUDA = 2
+_DL_CUDA_HOST = 3
+_DL_ROCM = 10
+_DL_CUDA_MANAGED = 13
+_DL_FLOAT = 2
+
+# Device types whose data can be passed with each memory type
+_dl_host_devices = (_DL_CPU, _DL_CUDA_HOST, _DL_CUDA_MANAGED)
+_dl_device_devices = (_DL_CUDA, _DL_ROCM, _DL_CUDA_MANAGED)
+
+
+class _DLDevice(ctypes.Structure):
+    _fields_ = [("device_type", ctypes.c_int32),
+                ("device_id", ctypes.c_int32)]
+
+
+class _DLDataType(ctypes.Structure):
+    _fields_ = [("code", ctypes.c_uint8),
+                ("bits", ctypes.c_uint8),
+                ("lanes", ctypes.c_uint16)]
+
+
+class _DLTensor(ctypes.Structure):
+    _fields_ = [("data", ctypes.c_void_p),
+                ("device", _DLDevice),
+                ("ndim", ctypes.c_int32),
+                ("dtype", _DLDataType),
+                ("shape", ctypes.POINTER(ctypes.c_int64)),
+                ("strides", ctypes.POINTER(ctypes.c_int64)),
+                ("byte_offset", ctypes.c_uint64)]
+
+
+_DLDeleter = ctypes.CFUNCTYPE(None, ctypes.c_void_p)
+
+
+class _DLManagedTensor(ctypes.Structure):
+    _fields_ = [("dl_tensor", _DLTensor),
+                ("manager_ctx", ctypes.c_void_p),
+                ("deleter", _DLDeleter)]
+
+
+# Capsule API, with private prototypes so ctypes.pythonapi is left untouched
+_dltensor = b"dltensor"
+_capsule_new = ctypes.PYFUNCTYPE(ctypes.py_object, ctypes.c_void_p,
+                                 ctypes.c_char_p, ctypes.c_void_p)(
+    ("PyCapsule_New", ctypes.pythonapi))
+_capsule_get_pointer = ctypes.PYFUNCTYPE(ctypes.c_void_p, ctypes.py_object,
+                                         ctypes.c_char_p)(
+    ("PyCapsule_GetPointer", ctypes.pythonapi))
+_capsule_is_valid_raw = ctypes.PYFUNCTYPE(ctypes.c_int, ctypes.c_void_p,
+                                          ctypes.c_char_p)(
+    ("PyCapsule_IsValid", ctypes.pythonapi))
+_capsule_get_pointer_raw = ctypes.PYFUNCTYPE(ctypes.c_void_p, ctypes.c_void_p,
+                                             ctypes.c_char_p)(
+    ("PyCapsule_GetPointer", ctypes.pythonapi))
+
+# Managed tensors handed out and not yet released by their consumer
+_dl_live = {}
+
+
+@_DLDeleter
+def _dl_deleter(managed):
+    _dl_live.pop(managed, None)
+
+
+@ctypes.CFUNCTYPE(None, ctypes.c_void_p)
+def _dl_capsule_destructor(capsule):
+    # A capsule still named "dltensor" was never consumed
+    if _capsule_is_valid_raw(capsule, _dltensor):
+        _dl_deleter(_capsule_get_pointer_raw(capsule, _dltensor))
+
+
+def _is_contiguous(shape, strides, itemsize):
+    """Check for row-major contiguous strides, ignoring unit dimensions"""
+
+    stride = itemsize
+    for n, s in reversed(list(zip(shape, strides))):
+        if n > 1 and s != stride:
+            return False
+        stride *= n
+    return True
+
+
+def _dlpack_pointer(array, memtype):
+    """Data pointer of an object supporting DLPack, and the capsule that keeps
+       the data alive"""
+
+    capsule = array.__dlpack__()
+    tensor = _DLManagedTensor.from_address(
+        _capsule_get_pointer(capsule, _dltensor)).dl_tensor
+    devices = _dl_host_devices if memtype == MEM_HOST else _dl_device_devices
+    if tensor.device.device_type not in devices:
+        raise ValueError("DLPack device type %d does not match memtype" %
+                         tensor.device.device_type)
+    if (tensor.dtype.code, tensor.dtype.bits, tensor.dtype.lanes) != \
+            (_DL_FLOAT, 64, 1):
+        raise ValueError("DLPack array must be float64")
+    if tensor.strides and not _is_contiguous(
+            [tensor.shape[d] for d in range(tensor.ndim)],
+            [tensor.strides[d] for d in range(tensor.ndim)], 1):
+        raise ValueError("DLPack array must be contiguous")
+    return tensor.data + tensor.byte_offset, capsule
+
+
+def array_pointer(array, memtype):
+    """Data pointer of a host or device array, and the object that must be kept
+       alive while libCEED uses the data.
+
+       Host arrays are taken through the NumPy array interface or DLPack,
+       device arrays through the CUDA array interface or DLPack; either way
+       the data is not copied."""
+
+    if memtype == MEM_HOST and hasattr(array, "__array_interface__"):
+        return array.__array_interface__['data'][0], array
+    if memtype != MEM_HOST and hasattr(array, "__cuda_array_interface__"):
+        desc = array.__cuda_array_interface__
+        if desc['typestr'] != '<f8':
+            raise ValueError("CUDA array interface data must be float64")
+        strides = desc.get('strides')
+        if strides is not None and not _is_contiguous(desc['shape'], strides,
+                                                      8):
+            raise ValueError("CUDA array interface data must be contiguous")
+        return desc['data'][0], array
+    if hasattr(array, "__dlpack__"):
+        pointer, capsule = _dlpack_pointer(array, memtype)
+        return pointer, (array, capsule)
+    raise TypeError("Array must support the %s array interface or DLPack" %
+                    ("NumPy" if memtype == MEM_HOST else "CUDA"))
+
+
+# ------------------------------------------------------------------------------
+
+
+class DeviceArray():
+    """Zero-copy view of libCEED device memory.
+
+       The view exposes the CUDA array interface and DLPack, so CuPy, Numba,
+       PyTorch, and JAX can wrap it without a copy, for example with
+       cupy.asarray(view) or torch.from_dlpack(view). The view is valid until
+       the array is restored to the Vector."""
+
+    # Constructor
+    def __init__(self, pointer, length, readonly, device_type, device_id):
+        self._pointer = pointer
+        self._length = length
+        self._readonly = readonly
+        self._device = (device_type, device_id)
+
+    # Representation
+    def __repr__(self):
+        return "<CeedDeviceArray of length %d at %s>" % (self._length,
+                                                         hex(self._pointer))
+
+    def __len__(self):
+        return self._length
+
+    @property
+    def shape(self):
+        return (self._length,)
+
+    @property
+    def dtype(self):
+        return "float64"
+
+    # CUDA array interface
+    #   https://numba.readthedocs.io/en/stable/cuda/cuda_array_interface.html
+    @property
+    def __cuda_array_interface__(self):
+        return {'shape': (self._length,),
+                'typestr': '<f8',
+                'data': (self._pointer, self._readonly),
+                'strides': None,
+                'stream': None,
+                'version': 3}
+
+    # DLPack
+    def __dlpack_device__(self):
+        return self._device
+
+    def __dlpack__(self, stream=None):
+        managed = _DLManagedTensor()
+        shape = (ctypes.c_int64 * 1)(self._length)
+        managed.dl_tensor.data = self._pointer
+        managed.dl_tensor.device = _DLDevice(*self._device)
+        managed.dl_tensor.ndim = 1
+        managed.dl_tensor.dtype = _DLDataType(_DL_FLOAT, 64, 1)
+        managed.dl_tensor.shape = shape
+        managed.dl_tensor.strides = None
+        managed.dl_tensor.byte_offset = 0
+        managed.deleter = _dl_deleter
+        address = ctypes.addressof(managed)
+        _dl_live[address] = (managed, shape, self)
+        return _capsule_new(address, _dltensor,
+                            ctypes.cast(_dl_capsule_destructor,
+                                        ctypes.c_void_p))
+
+
+def device_array(ceed, pointer, length, readonly):
+    """DeviceArray view of device memory of a Ceed"""
+
+    resource = ceed.get_resource()
+    device_type = _DL_ROCM if "/gpu/hip" in resource else _DL_CUDA
+    device_id = 0
+    if "device_id=" in resource:
+        device_id = int(resource.split("device_id=")[1].split(":")[0])
+    return DeviceArray(pointer, length, readonly, device_type, device_id)
+
+# ------------------------------------------------------------------------------
@@ -23,8 +23,10 @@ from abc import ABC
 # CeedMemType
 MEM_HOST = lib.CEED_MEM_HOST
 MEM_DEVICE = lib.CEED_MEM_DEVICE
+MEM_UNIFIED = lib.CEED_MEM_UNIFIED
 mem_types = {MEM_HOST: "host",
-             MEM_DEVICE: "device"}
+             MEM_DEVICE: "device",
+             MEM_UNIFIED: "unified"}
 
 # CeedCopyMode
 COPY_VALUES = lib.CEED_COPY_VALUES
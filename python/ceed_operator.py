@@ -119,7 +119,12 @@ class _OperatorBase(ABC):
                   active inputs
              v: Vector to store result of applying operator (must be distinct from u)
                   or CEED_VECTOR_NONE if there are no active outputs
-             **request: Ceed request, default CEED_REQUEST_IMMEDIATE"""
+             **request: Ceed request, default CEED_REQUEST_IMMEDIATE
+
+           The GIL is released while the operator is applied, so other Python
+             threads run during the application. QFunctions that are Numba
+             @cfuncs or compiled C run without it; Python callbacks take it
+             back at each call."""
 
         # libCEED call
         err_code = lib.CeedOperatorApply(self._pointer[0], u._pointer[0], v._pointer[0],
@@ -15,10 +15,51 @@
 # testbed platforms, in support of the nation's exascale computing imperative.
 
 from _ceed_cffi import ffi, lib
+import atexit
 import ctypes
+import hashlib
+import os
+import shutil
 import tempfile
 from abc import ABC
 
+# Directory of QFunction sources given as strings, read by JiT backends when
+#   operators are set up, so kept until exit
+_source_dir = None
+
+
+def _source_path(source, name):
+    """Path and function name of a QFunction source, writing the C source
+         of a QFunction given as a string to a file for JiT backends."""
+
+    global _source_dir
+    if "\n" not in source:
+        return source
+    if not name:
+        raise ValueError("The name of the QFunction is needed for its source")
+    if _source_dir is None:
+        _source_dir = tempfile.mkdtemp(prefix="libceed-qfunctions-")
+        atexit.register(shutil.rmtree, _source_dir, True)
+    digest = hashlib.sha1(source.encode('ascii')).hexdigest()
+    path = os.path.join(_source_dir, digest + ".h")
+    if not os.path.exists(path):
+        with open(path, 'w') as source_file:
+            source_file.write(source)
+    return path + ":" + name
+
+
+def _user_pointer(f):
+    """CeedQFunctionUser from a ctypes function of a shared library, a Numba
+         @cfunc with the CeedQFunctionUser signature, or an address."""
+
+    if hasattr(f, "address"):
+        address = f.address
+    elif isinstance(f, int):
+        address = f
+    else:
+        address = ctypes.cast(f, ctypes.c_void_p).value
+    return ffi.cast("CeedQFunctionUser", address)
+
 # ------------------------------------------------------------------------------
 
 
@@ -85,19 +126,22 @@ class QFunction(_QFunctionBase):
          volumetric terms."""
 
     # Constructor
-    def __init__(self, ceed, vlength, f, source):
+    def __init__(self, ceed, vlength, f, source, name=None):
         # libCEED object
         self._pointer = ffi.new("CeedQFunction *")
 
         # Reference to Ceed
         self._ceed = ceed
 
-        # Function pointer
-        fpointer = ffi.cast(
-            "CeedQFunctionUser", ctypes.cast(
-                f, ctypes.c_void_p).value)
+        # Function pointer; compiled Numba functions are freed with their
+        #   Python object, so keep a reference
+        self._f = f
+        fpointer = _user_pointer(f)
 
         # libCEED call
+        if name is None:
+            name = getattr(f, "__name__", None)
+        source = _source_path(source, name)
         sourceAscii = ffi.new("char[]", source.encode('ascii'))
         err_code = lib.CeedQFunctionCreateInterior(self._ceed._pointer[0], vlength,
                                                    fpointer, sourceAscii, self._pointer)
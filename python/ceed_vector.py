@@ -19,6 +19,7 @@ import tempfile
 import numpy as np
 import contextlib
 from .ceed_constants import MEM_HOST, USE_POINTER, COPY_VALUES, NORM_2
+from .ceed_array import array_pointer, device_array
 
 # ------------------------------------------------------------------------------
 
@@ -73,30 +74,28 @@ class Vector():
            array if applicable.
 
            Args:
-             *array: Numpy or Numba array to be used
+             *array: array to be used; host arrays must support the NumPy
+                       array interface or DLPack, device arrays the CUDA
+                       array interface or DLPack, such as CuPy, Numba,
+                       PyTorch, or JAX arrays
              **memtype: memory type of the array being passed, default CEED_MEM_HOST
              **cmode: copy mode for the array, default CEED_COPY_VALUES"""
 
+        # Get the data pointer without copying
+        pointer, reference = array_pointer(array, memtype)
+
         # Store array reference if needed
         if cmode == USE_POINTER:
-            self._array_reference = array
+            self._array_reference = reference
         else:
             self._array_reference = None
 
-        # Setup the numpy array for the libCEED call
-        array_pointer = ffi.new("CeedScalar *")
-        if memtype == MEM_HOST:
-            array_pointer = ffi.cast(
-                "CeedScalar *",
-                array.__array_interface__['data'][0])
-        else:
-            array_pointer = ffi.cast(
-                "CeedScalar *",
-                array.__cuda_array_interface__['data'][0])
+        # Setup the array for the libCEED call
+        data_pointer = ffi.cast("CeedScalar *", pointer)
 
         # libCEED call
         err_code = lib.CeedVectorSetArray(
-            self._pointer[0], memtype, cmode, array_pointer)
+            self._pointer[0], memtype, cmode, data_pointer)
         self._ceed._check_error(err_code)
 
     # Get Vector's data array
@@ -107,7 +106,7 @@ class Vector():
              **memtype: memory type of the array being passed, default CEED_MEM_HOST
 
            Returns:
-             *array: Numpy or Numba array"""
+             *array: Numpy array, or DeviceArray view for CEED_MEM_DEVICE"""
 
         # Retrieve the length of the array
         length_pointer = ffi.new("CeedInt *")
@@ -132,17 +131,10 @@ class Vector():
             # return Numpy array
             return np.frombuffer(buff, dtype="float64")
         else:
-            # CUDA array interface
-            # https://numba.pydata.org/numba-doc/latest/cuda/cuda_array_interface.html
-            import numba.cuda as nbcuda
-            desc = {
-                'shape': (length_pointer[0]),
-                'typestr': '>f8',
-                'data': (int(ffi.cast("intptr_t", array_pointer[0])), False),
-                'version': 2
-            }
-            # return Numba array
-            return nbcuda.from_cuda_array_interface(desc)
+            # Zero-copy view for CuPy, Numba, PyTorch, or JAX
+            return device_array(self._ceed,
+                                int(ffi.cast("intptr_t", array_pointer[0])),
+                                length_pointer[0], False)
 
     # Get Vector's data array in read-only mode
     def get_array_read(self, memtype=MEM_HOST):
@@ -152,7 +144,7 @@ class Vector():
              **memtype: memory type of the array being passed, default CEED_MEM_HOST
 
            Returns:
-             *array: Numpy or Numba array"""
+             *array: Numpy array, or DeviceArray view for CEED_MEM_DEVICE"""
 
         # Retrieve the length of the array
         length_pointer = ffi.new("CeedInt *")
@@ -179,17 +171,10 @@ class Vector():
             ret.flags['WRITEABLE'] = False
             return ret
         else:
-            # CUDA array interface
-            # https://numba.pydata.org/numba-doc/latest/cuda/cuda_array_interface.html
-            import numba.cuda as nbcuda
-            desc = {
-                'shape': (length_pointer[0]),
-                'typestr': '>f8',
-                'data': (int(ffi.cast("intptr_t", array_pointer[0])), False),
-                'version': 2
-            }
-            # return read only Numba array
-            return nbcuda.from_cuda_array_interface(desc)
+            # Zero-copy view for CuPy, Numba, PyTorch, or JAX
+            return device_array(self._ceed,
+                                int(ffi.cast("intptr_t", array_pointer[0])),
+                                length_pointer[0], True)
 
     # Restore the Vector's data array
     def restore_array(self):
@@ -331,6 +316,25 @@ class Vector():
 
         return norm_pointer[0]
 
+    # Compute several norms of a vector into a vector
+    def norms(self, normtypes, result):
+        """Compute several norms of a Vector in a single pass, storing them in
+           another Vector without synchronizing with the host.
+
+           Args:
+             normtypes: list of norm types to be computed
+             result: Vector of length at least len(normtypes) to store the
+                       norms"""
+
+        types_pointer = ffi.new("CeedNormType[]", list(normtypes))
+
+        # libCEED call
+        err_code = lib.CeedVectorNorms(self._pointer[0], len(normtypes),
+                                       types_pointer, result._pointer[0])
+        self._ceed._check_error(err_code)
+
+        return result
+
     # Take the reciprocal of a vector
     def reciprocal(self):
         """Take the reciprocal of a Vector."""
@@ -341,6 +345,81 @@ class Vector():
 
         return self
 
+    # Invert point blocks in place
+    def point_block_invert(self, bsize):
+        """Invert the consecutive row-major bsize x bsize blocks of a Vector in
+           place.
+
+           Args:
+             bsize: size of each block, at most 16"""
+
+        # libCEED call
+        err_code = lib.CeedVectorPointBlockInvert(self._pointer[0], bsize)
+        self._ceed._check_error(err_code)
+
+        return self
+
+    # Compute self = alpha x + self
+    def axpy(self, alpha, x):
+        """Compute self = alpha x + self.
+
+           Args:
+             alpha: scaling factor for x
+             x: Vector to add"""
+
+        # libCEED call
+        err_code = lib.CeedVectorAXPY(self._pointer[0], alpha, x._pointer[0])
+        self._ceed._check_error(err_code)
+
+        return self
+
+    # Compute self = alpha x + beta self
+    def axpby(self, alpha, beta, x):
+        """Compute self = alpha x + beta self.
+
+           Args:
+             alpha: scaling factor for x
+             beta: scaling factor for self
+             x: Vector to add"""
+
+        # libCEED call
+        err_code = lib.CeedVectorAXPBY(self._pointer[0], alpha, beta,
+                                       x._pointer[0])
+        self._ceed._check_error(err_code)
+
+        return self
+
+    # Compute the pointwise product self = x .* y
+    def pointwise_mult(self, x, y):
+        """Compute the pointwise product self = x .* y.
+
+           Args:
+             x: first Vector
+             y: second Vector"""
+
+        # libCEED call
+        err_code = lib.CeedVectorPointwiseMult(self._pointer[0], x._pointer[0],
+                                               y._pointer[0])
+        self._ceed._check_error(err_code)
+
+        return self
+
+    # Compute the dot product with another vector
+    def dot(self, y):
+        """Compute the dot product of self and y.
+
+           Args:
+             y: Vector to take the dot product with"""
+
+        dot_pointer = ffi.new("CeedScalar *")
+
+        # libCEED call
+        err_code = lib.CeedVectorDot(self._pointer[0], y._pointer[0],
+                                     dot_pointer)
+        self._ceed._check_error(err_code)
+
+        return dot_pointer[0]
+
     def _state(self):
         """Return the modification state of the Vector.
 
@@ -0,0 +1,86 @@
+// Per-apply overhead benchmark, Rust interface
+//
+// Times Operator::apply for the 1D mass operator of benchmarks/overhead.c on
+// 1 to 64 elements, writing one JSON record per line.
+//
+// Usage:
+//
+//     cargo run --release --example overhead -- [resource] [max elements] [min seconds]
+
+use libceed::prelude::*;
+use std::time::Instant;
+
+// Time the application of the mass operator on nelem linear elements
+fn bench_overhead(ceed: &libceed::Ceed, resource: &str, nelem: usize, mintime: f64) {
+    let (p, q, nnodes) = (2, 2, nelem + 1);
+
+    let mut offsets: Vec<i32> = vec![0; 2 * nelem];
+    for e in 0..nelem {
+        offsets[2 * e] = e as i32;
+        offsets[2 * e + 1] = (e + 1) as i32;
+    }
+    let r = ceed.elem_restriction(nelem, p, 1, 1, nnodes, MemType::Host, &offsets);
+    let strides: [i32; 3] = [1, q as i32, q as i32];
+    let rq = ceed.strided_elem_restriction(nelem, q, 1, nelem * q, strides);
+    let b = ceed.basis_tensor_H1_Lagrange(1, 1, p, q, QuadMode::Gauss);
+    let qf_setup = ceed.q_function_interior_by_name("Mass1DBuild");
+    let qf_mass = ceed.q_function_interior_by_name("MassApply");
+
+    let xarray: Vec<f64> = (0..nnodes).map(|i| i as f64 / nelem as f64).collect();
+    let x = ceed.vector_from_slice(&xarray);
+    let mut qdata = ceed.vector(nelem * q);
+    let mut u = ceed.vector(nnodes);
+    let mut v = ceed.vector(nnodes);
+    u.set_value(1.0);
+
+    let mut op_setup = ceed.operator(&qf_setup, QFunctionOpt::None, QFunctionOpt::None);
+    op_setup.set_field("dx", &r, &b, VectorOpt::Active);
+    op_setup.set_field("weights", ElemRestrictionOpt::None, &b, VectorOpt::None);
+    op_setup.set_field("qdata", &rq, BasisOpt::Collocated, VectorOpt::Active);
+    op_setup.apply(&x, &mut qdata);
+
+    let mut op_mass = ceed.operator(&qf_mass, QFunctionOpt::None, QFunctionOpt::None);
+    op_mass.set_field("u", &r, &b, VectorOpt::Active);
+    op_mass.set_field("qdata", &rq, BasisOpt::Collocated, &qdata);
+    op_mass.set_field("v", &r, &b, VectorOpt::Active);
+
+    // The first application includes the backend setup of the operator
+    op_mass.apply(&u, &mut v);
+
+    // Double the number of calls until the measurement is long enough
+    let mut calls = 1;
+    let elapsed = loop {
+        let start = Instant::now();
+        for _ in 0..calls {
+            op_mass.apply(&u, &mut v);
+        }
+        let elapsed = start.elapsed().as_secs_f64();
+        if elapsed >= mintime {
+            break elapsed;
+        }
+        calls *= 2;
+    };
+
+    println!(
+        "{{\"code\": \"libCEED\", \"test\": \"overhead\", \"interface\": \"rust\", \
+         \"backend\": \"{}\", \"num_elem\": {}, \"calls\": {}, \"time\": {:.6e}}}",
+        resource,
+        nelem,
+        calls,
+        elapsed / calls as f64
+    );
+}
+
+fn main() {
+    let args: Vec<String> = std::env::args().collect();
+    let resource = args.get(1).map_or("/cpu/self", |s| s.as_str());
+    let nmax: usize = args.get(2).map_or(64, |s| s.parse().expect("max elements"));
+    let mintime: f64 = args.get(3).map_or(0.05, |s| s.parse().expect("min seconds"));
+
+    let ceed = libceed::Ceed::init(resource);
+    let mut nelem = 1;
+    while nelem <= nmax {
+        bench_overhead(&ceed, resource, nelem, mintime);
+        nelem *= 2;
+    }
+}
@@ -18,17 +18,18 @@
 //! quadrature rule.
 
 use crate::prelude::*;
+use std::marker::PhantomData;
 
 // -----------------------------------------------------------------------------
 // CeedBasis option
 // -----------------------------------------------------------------------------
 #[derive(Clone, Copy)]
 pub enum BasisOpt<'a> {
-    Some(&'a Basis),
+    Some(&'a Basis<'a>),
     Collocated,
 }
 /// Construct a BasisOpt reference from a Basis reference
-impl<'a> From<&'a Basis> for BasisOpt<'a> {
+impl<'a> From<&'a Basis<'_>> for BasisOpt<'a> {
     fn from(basis: &'a Basis) -> Self {
         debug_assert!(basis.ptr != unsafe { bind_ceed::CEED_BASIS_COLLOCATED });
         Self::Some(basis)
@@ -47,14 +48,15 @@ impl<'a> BasisOpt<'a> {
 // -----------------------------------------------------------------------------
 // CeedBasis context wrapper
 // -----------------------------------------------------------------------------
-pub struct Basis {
+pub struct Basis<'a> {
     pub(crate) ptr: bind_ceed::CeedBasis,
+    _lifeline: PhantomData<&'a ()>,
 }
 
 // -----------------------------------------------------------------------------
 // Destructor
 // -----------------------------------------------------------------------------
-impl Drop for Basis {
+impl<'a> Drop for Basis<'a> {
     fn drop(&mut self) {
         unsafe {
             if self.ptr != bind_ceed::CEED_BASIS_COLLOCATED {
@@ -67,7 +69,7 @@ impl Drop for Basis {
 // -----------------------------------------------------------------------------
 // Display
 // -----------------------------------------------------------------------------
-impl fmt::Display for Basis {
+impl<'a> fmt::Display for Basis<'a> {
     /// View a Basis
     ///
     /// ```
@@ -92,10 +94,10 @@ impl fmt::Display for Basis {
 // -----------------------------------------------------------------------------
 // Implementations
 // -----------------------------------------------------------------------------
-impl Basis {
+impl<'a> Basis<'a> {
     // Constructors
     pub fn create_tensor_H1(
-        ceed: &crate::Ceed,
+        ceed: &'a crate::Ceed,
         dim: usize,
         ncomp: usize,
         P1d: usize,
@@ -121,11 +123,14 @@ impl Basis {
                 &mut ptr,
             )
         };
-        Self { ptr }
+        Self {
+            ptr,
+            _lifeline: PhantomData,
+        }
     }
 
     pub fn create_tensor_H1_Lagrange(
-        ceed: &crate::Ceed,
+        ceed: &'a crate::Ceed,
         dim: usize,
         ncomp: usize,
         P: usize,
@@ -138,11 +143,14 @@ impl Basis {
         unsafe {
             bind_ceed::CeedBasisCreateTensorH1Lagrange(ceed.ptr, dim, ncomp, P, Q, qmode, &mut ptr);
         }
-        Self { ptr }
+        Self {
+            ptr,
+            _lifeline: PhantomData,
+        }
     }
 
     pub fn create_H1(
-        ceed: &crate::Ceed,
+        ceed: &'a crate::Ceed,
         topo: crate::ElemTopology,
         ncomp: usize,
         nnodes: usize,
@@ -173,7 +181,10 @@ impl Basis {
                 &mut ptr,
             )
         };
-        Self { ptr }
+        Self {
+            ptr,
+            _lifeline: PhantomData,
+        }
     }
 
     /// Apply basis evaluation from nodes to quadrature points or vice versa
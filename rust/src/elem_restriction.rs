@@ -18,17 +18,18 @@
 //! (dofs) according to the different elements they belong to.
 
 use crate::prelude::*;
+use std::marker::PhantomData;
 
 // -----------------------------------------------------------------------------
 // CeedElemRestriction option
 // -----------------------------------------------------------------------------
 #[derive(Clone, Copy)]
 pub enum ElemRestrictionOpt<'a> {
-    Some(&'a ElemRestriction),
+    Some(&'a ElemRestriction<'a>),
     None,
 }
 /// Construct a ElemRestrictionOpt reference from a ElemRestriction reference
-impl<'a> From<&'a ElemRestriction> for ElemRestrictionOpt<'a> {
+impl<'a> From<&'a ElemRestriction<'_>> for ElemRestrictionOpt<'a> {
     fn from(restr: &'a ElemRestriction) -> Self {
         debug_assert!(restr.ptr != unsafe { bind_ceed::CEED_ELEMRESTRICTION_NONE });
         Self::Some(restr)
@@ -48,14 +49,15 @@ impl<'a> ElemRestrictionOpt<'a> {
 // -----------------------------------------------------------------------------
 // CeedElemRestriction context wrapper
 // -----------------------------------------------------------------------------
-pub struct ElemRestriction {
+pub struct ElemRestriction<'a> {
     pub(crate) ptr: bind_ceed::CeedElemRestriction,
+    _lifeline: PhantomData<&'a ()>,
 }
 
 // -----------------------------------------------------------------------------
 // Destructor
 // -----------------------------------------------------------------------------
-impl Drop for ElemRestriction {
+impl<'a> Drop for ElemRestriction<'a> {
     fn drop(&mut self) {
         unsafe {
             if self.ptr != bind_ceed::CEED_ELEMRESTRICTION_NONE {
@@ -68,7 +70,7 @@ impl Drop for ElemRestriction {
 // -----------------------------------------------------------------------------
 // Display
 // -----------------------------------------------------------------------------
-impl fmt::Display for ElemRestriction {
+impl<'a> fmt::Display for ElemRestriction<'a> {
     /// View an ElemRestriction
     ///
     /// ```
@@ -99,10 +101,10 @@ impl fmt::Display for ElemRestriction {
 // -----------------------------------------------------------------------------
 // Implementations
 // -----------------------------------------------------------------------------
-impl ElemRestriction {
+impl<'a> ElemRestriction<'a> {
     // Constructors
     pub fn create(
-        ceed: &crate::Ceed,
+        ceed: &'a crate::Ceed,
         nelem: usize,
         elemsize: usize,
         ncomp: usize,
@@ -133,11 +135,14 @@ impl ElemRestriction {
                 &mut ptr,
             )
         };
-        Self { ptr }
+        Self {
+            ptr,
+            _lifeline: PhantomData,
+        }
     }
 
     pub fn create_strided(
-        ceed: &crate::Ceed,
+        ceed: &'a crate::Ceed,
         nelem: usize,
         elemsize: usize,
         ncomp: usize,
@@ -158,7 +163,10 @@ impl ElemRestriction {
                 &mut ptr,
             )
         };
-        Self { ptr }
+        Self {
+            ptr,
+            _lifeline: PhantomData,
+        }
     }
 
     /// Create an Lvector for an ElemRestriction
@@ -178,7 +186,7 @@ impl ElemRestriction {
     ///
     /// assert_eq!(lvector.length(), nelem+1, "Incorrect Lvector size");
     /// ```
-    pub fn create_lvector(&self) -> Vector {
+    pub fn create_lvector(&self) -> Vector<'a> {
         let mut ptr_lvector = std::ptr::null_mut();
         let null = std::ptr::null_mut() as *mut _;
         unsafe { bind_ceed::CeedElemRestrictionCreateVector(self.ptr, &mut ptr_lvector, null) };
@@ -202,7 +210,7 @@ impl ElemRestriction {
     ///
     /// assert_eq!(evector.length(), nelem*2, "Incorrect Evector size");
     /// ```
-    pub fn create_evector(&self) -> Vector {
+    pub fn create_evector(&self) -> Vector<'a> {
         let mut ptr_evector = std::ptr::null_mut();
         let null = std::ptr::null_mut() as *mut _;
         unsafe { bind_ceed::CeedElemRestrictionCreateVector(self.ptr, null, &mut ptr_evector) };
@@ -227,7 +235,7 @@ impl ElemRestriction {
     /// assert_eq!(lvector.length(), nelem+1, "Incorrect Lvector size");
     /// assert_eq!(evector.length(), nelem*2, "Incorrect Evector size");
     /// ```
-    pub fn create_vectors(&self) -> (Vector, Vector) {
+    pub fn create_vectors(&self) -> (Vector<'a>, Vector<'a>) {
         let mut ptr_lvector = std::ptr::null_mut();
         let mut ptr_evector = std::ptr::null_mut();
         unsafe {
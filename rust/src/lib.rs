@@ -24,6 +24,41 @@
 //! First, libCEED needs to be built and `LD_LIBRARY_PATH` updated to contain
 //! the filepath to `libceed.so`. Then `cargo` commands may be used as usual in
 //! the `libCEED/rust` folder, such as `cargo build` and `cargo test`.
+//!
+//! ## Thread safety
+//!
+//! Separate [`Ceed`] contexts are independent, so each thread may drive its own
+//! context. A context and every object created from it must stay on one
+//! thread: the objects borrow the [`Ceed`], which is [`Send`] but not
+//! [`Sync`], and are themselves neither. A [`Ceed`] may therefore be moved to
+//! another thread only before any objects are created from it, or after they
+//! have all been dropped.
+//!
+//! Operators for independent problems can thus be applied in parallel by
+//! giving each thread a context. [`Vector::from_array`] uses a mutable slice
+//! as storage without copying, and the borrow checker keeps the slice from
+//! being used elsewhere until the Vector is dropped.
+//!
+//! ```
+//! # use libceed::prelude::*;
+//! let mut data = vec![vec![0.; 10]; 4];
+//! let workers: Vec<_> = data
+//!     .drain(..)
+//!     .map(|mut x| {
+//!         let ceed = libceed::Ceed::init("/cpu/self/ref/serial");
+//!         std::thread::spawn(move || {
+//!             {
+//!                 let mut vec = ceed.vector_from_array(&mut x);
+//!                 vec.set_value(1.);
+//!             }
+//!             x
+//!         })
+//!     })
+//!     .collect();
+//! for worker in workers {
+//!     assert_eq!(worker.join().unwrap(), vec![1.; 10]);
+//! }
+//! ```
 
 // -----------------------------------------------------------------------------
 // Exceptions
@@ -80,6 +115,7 @@ pub const MAX_QFUNCTION_FIELDS: usize = 16;
 pub enum MemType {
     Host,
     Device,
+    Unified,
 }
 
 #[derive(Clone, Copy, PartialEq, Eq)]
@@ -147,6 +183,10 @@ pub struct Ceed {
     ptr: bind_ceed::Ceed,
 }
 
+// Objects created from a Ceed borrow it, so a Ceed can only change threads
+// together with all of the objects that share its (unsynchronized) state
+unsafe impl Send for Ceed {}
+
 // -----------------------------------------------------------------------------
 // Destructor
 // -----------------------------------------------------------------------------
@@ -223,7 +263,7 @@ impl Ceed {
     /// # let ceed = libceed::Ceed::default_init();
     /// let vec = ceed.vector(10);
     /// ```
-    pub fn vector(&self, n: usize) -> Vector {
+    pub fn vector(&self, n: usize) -> Vector<'_> {
         Vector::create(self, n)
     }
 
@@ -239,10 +279,31 @@ impl Ceed {
     /// let vec = ceed.vector_from_slice(&[1., 2., 3.]);
     /// assert_eq!(vec.length(), 3);
     /// ```
-    pub fn vector_from_slice(&self, slice: &[f64]) -> Vector {
+    pub fn vector_from_slice(&self, slice: &[f64]) -> Vector<'_> {
         Vector::from_slice(self, slice)
     }
 
+    /// Create a Vector that uses a mutable slice as its storage, without
+    /// copying; the slice is borrowed until the Vector is dropped
+    ///
+    /// # arguments
+    ///
+    /// * `slice` - Slice containing data
+    ///
+    /// ```
+    /// # use libceed::prelude::*;
+    /// # let ceed = libceed::Ceed::default_init();
+    /// let mut x = [1., 2., 3.];
+    /// {
+    ///   let mut vec = ceed.vector_from_array(&mut x);
+    ///   vec.set_value(0.);
+    /// }
+    /// assert_eq!(x, [0., 0., 0.]);
+    /// ```
+    pub fn vector_from_array<'a>(&'a self, slice: &'a mut [f64]) -> Vector<'a> {
+        Vector::from_array(self, slice)
+    }
+
     /// Returns a ElemRestriction
     ///
     /// # arguments
@@ -285,7 +346,7 @@ impl Ceed {
         lsize: usize,
         mtype: MemType,
         offsets: &[i32],
-    ) -> ElemRestriction {
+    ) -> ElemRestriction<'_> {
         ElemRestriction::create(
             self, nelem, elemsize, ncomp, compstride, lsize, mtype, offsets,
         )
@@ -326,7 +387,7 @@ impl Ceed {
         ncomp: usize,
         lsize: usize,
         strides: [i32; 3],
-    ) -> ElemRestriction {
+    ) -> ElemRestriction<'_> {
         ElemRestriction::create_strided(self, nelem, elemsize, ncomp, lsize, strides)
     }
 
@@ -375,7 +436,7 @@ impl Ceed {
         grad1d: &[f64],
         qref1d: &[f64],
         qweight1d: &[f64],
-    ) -> Basis {
+    ) -> Basis<'_> {
         Basis::create_tensor_H1(
             self, dim, ncomp, P1d, Q1d, interp1d, grad1d, qref1d, qweight1d,
         )
@@ -405,7 +466,7 @@ impl Ceed {
         P: usize,
         Q: usize,
         qmode: QuadMode,
-    ) -> Basis {
+    ) -> Basis<'_> {
         Basis::create_tensor_H1_Lagrange(self, dim, ncomp, P, Q, qmode)
     }
 
@@ -455,7 +516,7 @@ impl Ceed {
         grad: &[f64],
         qref: &[f64],
         qweight: &[f64],
-    ) -> Basis {
+    ) -> Basis<'_> {
         Basis::create_H1(
             self, topo, ncomp, nnodes, nqpts, interp, grad, qref, qweight,
         )
@@ -493,10 +554,55 @@ impl Ceed {
         &self,
         vlength: i32,
         f: Box<qfunction::QFunctionUserClosure>,
-    ) -> QFunction {
+    ) -> QFunction<'_> {
         QFunction::create(self, vlength, f)
     }
 
+    /// Returns a CeedQFunction for evaluating interior (volumetric) terms,
+    /// calling the closure without boxing it or dynamic dispatch
+    ///
+    /// # arguments
+    ///
+    /// * `vlength` - Vector length. Caller must ensure that number of
+    ///                 quadrature points is a multiple of vlength.
+    /// * `f`       - Closure to evaluate action at quadrature points.
+    /// * `source`  - Absolute path to the C source of the QFunction for JiT
+    ///                 backends, `"/abs_path/file.h:function_name"`, or `""`
+    ///                 for backends running the closure on the host.
+    ///
+    /// ```
+    /// # use libceed::prelude::*;
+    /// # let ceed = libceed::Ceed::default_init();
+    /// let scale = 2.0;
+    /// let user_f = |
+    ///   [u, weights, ..]: QFunctionInputs,
+    ///   [v, ..]: QFunctionOutputs,
+    /// |
+    /// {
+    ///   // Iterate over quadrature points
+    ///   v
+    ///     .iter_mut()
+    ///     .zip(u.iter().zip(weights.iter()))
+    ///     .for_each(|(v, (u, w))| *v = scale * u * w);
+    ///
+    ///   // Return clean error code
+    ///   0
+    /// };
+    ///
+    /// let qf = ceed.q_function_interior_generic(1, user_f, "");
+    /// ```
+    pub fn q_function_interior_generic<'a, F>(
+        &'a self,
+        vlength: i32,
+        f: F,
+        source: &str,
+    ) -> QFunction<'a>
+    where
+        F: FnMut(QFunctionInputs, QFunctionOutputs) -> i32 + 'a,
+    {
+        QFunction::create_generic(self, vlength, f, source)
+    }
+
     /// Returns a CeedQFunction for evaluating interior (volumetric) terms
     /// created by name
     ///
@@ -505,7 +611,7 @@ impl Ceed {
     /// # let ceed = libceed::Ceed::default_init();
     /// let qf = ceed.q_function_interior_by_name("Mass1DBuild");
     /// ```
-    pub fn q_function_interior_by_name(&self, name: &str) -> QFunctionByName {
+    pub fn q_function_interior_by_name(&self, name: &str) -> QFunctionByName<'_> {
         QFunctionByName::create(self, name)
     }
 
@@ -531,7 +637,7 @@ impl Ceed {
         qf: impl Into<QFunctionOpt<'b>>,
         dqf: impl Into<QFunctionOpt<'b>>,
         dqfT: impl Into<QFunctionOpt<'b>>,
-    ) -> Operator {
+    ) -> Operator<'_> {
         Operator::create(self, qf, dqf, dqfT)
     }
 
@@ -542,7 +648,7 @@ impl Ceed {
     /// # let ceed = libceed::Ceed::default_init();
     /// let op = ceed.composite_operator();
     /// ```
-    pub fn composite_operator(&self) -> CompositeOperator {
+    pub fn composite_operator(&self) -> CompositeOperator<'_> {
         CompositeOperator::create(self)
     }
 }
@@ -554,10 +660,8 @@ impl Ceed {
 mod tests {
     use super::*;
 
-    #[test]
-    fn ceed_t501() {
-        let resource = "/cpu/self/ref/blocked";
-        let ceed = Ceed::init(resource);
+    // Length of [-1, 1] computed with a 1D mass operator
+    fn interval_length(ceed: &Ceed) -> f64 {
         let nelem = 4;
         let p = 3;
         let q = 4;
@@ -569,8 +673,8 @@ mod tests {
         qdata.set_value(0.0);
         let mut u = ceed.vector(ndofs);
         u.set_value(1.0);
-        let mut v = ceed.vector(ndofs);
-        v.set_value(0.0);
+        let mut v_array = vec![0.0; ndofs];
+        let mut v = ceed.vector_from_array(&mut v_array);
 
         // Restrictions
         let mut indx: Vec<i32> = vec![0; 2 * nelem];
@@ -612,17 +716,40 @@ mod tests {
         v.set_value(0.0);
         op_mass.apply(&u, &mut v);
 
-        // Check
-        let array = v.view();
-        let mut sum = 0.0;
-        for i in 0..ndofs {
-            sum += array[i];
-        }
+        drop(op_mass);
+        drop(v);
+        v_array.iter().sum()
+    }
+
+    #[test]
+    fn ceed_t501() {
+        let resource = "/cpu/self/ref/blocked";
+        let ceed = Ceed::init(resource);
+        let sum = interval_length(&ceed);
         assert!(
             (sum - 2.0).abs() < 1e-15,
             "Incorrect interval length computed"
         );
     }
+
+    #[test]
+    fn ceed_t501_threads() {
+        // Each thread applies operators on its own context
+        let resource = "/cpu/self/ref/blocked";
+        let workers: Vec<_> = (0..4)
+            .map(|_| {
+                let ceed = Ceed::init(resource);
+                std::thread::spawn(move || interval_length(&ceed))
+            })
+            .collect();
+        for worker in workers {
+            let sum = worker.join().unwrap();
+            assert!(
+                (sum - 2.0).abs() < 1e-15,
+                "Incorrect interval length computed"
+            );
+        }
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -19,26 +19,30 @@
 //! Ceed Bases, and Ceed QFunctions.
 
 use crate::prelude::*;
+use std::marker::PhantomData;
 
 // -----------------------------------------------------------------------------
 // CeedOperator context wrapper
 // -----------------------------------------------------------------------------
-pub(crate) struct OperatorCore {
+pub(crate) struct OperatorCore<'a> {
     ptr: bind_ceed::CeedOperator,
+    _lifeline: PhantomData<&'a ()>,
 }
 
-pub struct Operator {
-    op_core: OperatorCore,
+// libCEED keeps the restrictions, bases, and vectors given as fields without
+// taking references to them, so they are borrowed for the Operator lifetime
+pub struct Operator<'a> {
+    op_core: OperatorCore<'a>,
 }
 
-pub struct CompositeOperator {
-    op_core: OperatorCore,
+pub struct CompositeOperator<'a> {
+    op_core: OperatorCore<'a>,
 }
 
 // -----------------------------------------------------------------------------
 // Destructor
 // -----------------------------------------------------------------------------
-impl Drop for OperatorCore {
+impl<'a> Drop for OperatorCore<'a> {
     fn drop(&mut self) {
         unsafe {
             bind_ceed::CeedOperatorDestroy(&mut self.ptr);
@@ -49,7 +53,7 @@ impl Drop for OperatorCore {
 // -----------------------------------------------------------------------------
 // Display
 // -----------------------------------------------------------------------------
-impl fmt::Display for OperatorCore {
+impl<'a> fmt::Display for OperatorCore<'a> {
     fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
         let mut ptr = std::ptr::null_mut();
         let mut sizeloc = crate::MAX_BUFFER_LENGTH;
@@ -69,7 +73,6 @@ impl fmt::Display for OperatorCore {
 /// # use libceed::prelude::*;
 /// # let ceed = libceed::Ceed::default_init();
 /// let qf = ceed.q_function_interior_by_name("Mass1DBuild");
-/// let mut op = ceed.operator(&qf, QFunctionOpt::None, QFunctionOpt::None);
 ///
 /// // Operator field arguments
 /// let ne = 3;
@@ -86,13 +89,14 @@ impl fmt::Display for OperatorCore {
 /// let b = ceed.basis_tensor_H1_Lagrange(1, 1, 2, q, QuadMode::Gauss);
 ///
 /// // Operator fields
+/// let mut op = ceed.operator(&qf, QFunctionOpt::None, QFunctionOpt::None);
 /// op.set_field("dx", &r, &b, VectorOpt::Active);
 /// op.set_field("weights", ElemRestrictionOpt::None, &b, VectorOpt::None);
 /// op.set_field("qdata", &rq, BasisOpt::Collocated, VectorOpt::Active);
 ///
 /// println!("{}", op);
 /// ```
-impl fmt::Display for Operator {
+impl<'a> fmt::Display for Operator<'a> {
     fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
         self.op_core.fmt(f)
     }
@@ -103,8 +107,6 @@ impl fmt::Display for Operator {
 /// ```
 /// # use libceed::prelude::*;
 /// # let ceed = libceed::Ceed::default_init();
-/// let mut op = ceed.composite_operator();
-///
 /// // Sub operator field arguments
 /// let ne = 3;
 /// let q = 4 as usize;
@@ -122,6 +124,8 @@ impl fmt::Display for Operator {
 /// let qdata_mass = ceed.vector(q*ne);
 /// let qdata_diff = ceed.vector(q*ne);
 ///
+/// let mut op = ceed.composite_operator();
+///
 /// let qf_mass = ceed.q_function_interior_by_name("MassApply");
 /// let mut op_mass = ceed.operator(&qf_mass, QFunctionOpt::None, QFunctionOpt::None);
 /// op_mass.set_field("u", &r, &b, VectorOpt::Active);
@@ -140,7 +144,7 @@ impl fmt::Display for Operator {
 ///
 /// println!("{}", op);
 /// ```
-impl fmt::Display for CompositeOperator {
+impl<'a> fmt::Display for CompositeOperator<'a> {
     fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
         self.op_core.fmt(f)
     }
@@ -149,7 +153,7 @@ impl fmt::Display for CompositeOperator {
 // -----------------------------------------------------------------------------
 // Core functionality
 // -----------------------------------------------------------------------------
-impl OperatorCore {
+impl<'a> OperatorCore<'a> {
     // Common implementations
     pub fn apply(&self, input: &Vector, output: &mut Vector) {
         unsafe {
@@ -217,10 +221,10 @@ impl OperatorCore {
 // -----------------------------------------------------------------------------
 // Operator
 // -----------------------------------------------------------------------------
-impl Operator {
+impl<'a> Operator<'a> {
     // Constructor
     pub fn create<'b>(
-        ceed: &crate::Ceed,
+        ceed: &'a crate::Ceed,
         qf: impl Into<QFunctionOpt<'b>>,
         dqf: impl Into<QFunctionOpt<'b>>,
         dqfT: impl Into<QFunctionOpt<'b>>,
@@ -235,12 +239,18 @@ impl Operator {
                 &mut ptr,
             )
         };
-        let op_core = OperatorCore { ptr };
+        let op_core = OperatorCore {
+            ptr,
+            _lifeline: PhantomData,
+        };
         Self { op_core }
     }
 
     fn from_raw(ptr: bind_ceed::CeedOperator) -> Self {
-        let op_core = OperatorCore { ptr };
+        let op_core = OperatorCore {
+            ptr,
+            _lifeline: PhantomData,
+        };
         Self { op_core }
     }
 
@@ -410,7 +420,6 @@ impl Operator {
     /// # use libceed::prelude::*;
     /// # let ceed = libceed::Ceed::default_init();
     /// let qf = ceed.q_function_interior_by_name("Mass1DBuild");
-    /// let mut op = ceed.operator(&qf, QFunctionOpt::None, QFunctionOpt::None);
     ///
     /// // Operator field arguments
     /// let ne = 3;
@@ -425,14 +434,15 @@ impl Operator {
     /// let b = ceed.basis_tensor_H1_Lagrange(1, 1, 2, q, QuadMode::Gauss);
     ///
     /// // Operator field
+    /// let mut op = ceed.operator(&qf, QFunctionOpt::None, QFunctionOpt::None);
     /// op.set_field("dx", &r, &b, VectorOpt::Active);
     /// ```
-    pub fn set_field<'b>(
+    pub fn set_field(
         &mut self,
         fieldname: &str,
-        r: impl Into<ElemRestrictionOpt<'b>>,
-        b: impl Into<BasisOpt<'b>>,
-        v: impl Into<VectorOpt<'b>>,
+        r: impl Into<ElemRestrictionOpt<'a>>,
+        b: impl Into<BasisOpt<'a>>,
+        v: impl Into<VectorOpt<'a>>,
     ) {
         let fieldname = CString::new(fieldname).expect("CString::new failed");
         let fieldname = fieldname.as_ptr() as *const i8;
@@ -1046,9 +1056,9 @@ impl Operator {
     pub fn create_multigrid_level(
         &self,
         p_mult_fine: &Vector,
-        rstr_coarse: &ElemRestriction,
-        basis_coarse: &Basis,
-    ) -> (Operator, Operator, Operator) {
+        rstr_coarse: &'a ElemRestriction,
+        basis_coarse: &'a Basis,
+    ) -> (Operator<'a>, Operator<'a>, Operator<'a>) {
         let mut ptr_coarse = std::ptr::null_mut();
         let mut ptr_prolong = std::ptr::null_mut();
         let mut ptr_restrict = std::ptr::null_mut();
@@ -1211,15 +1221,15 @@ impl Operator {
     /// for i in 0..ndofs_coarse {
     ///   sum += array[i];
     /// }
-    /// assert!((sum - 2.0).abs() < 1e-15, "Incorrect interval length computed");
+    /// assert!((sum - 2.0).abs() < 1e-14, "Incorrect interval length computed");
     /// ```
     pub fn create_multigrid_level_tensor_H1(
         &self,
         p_mult_fine: &Vector,
-        rstr_coarse: &ElemRestriction,
-        basis_coarse: &Basis,
+        rstr_coarse: &'a ElemRestriction,
+        basis_coarse: &'a Basis,
         interpCtoF: &Vec<f64>,
-    ) -> (Operator, Operator, Operator) {
+    ) -> (Operator<'a>, Operator<'a>, Operator<'a>) {
         let mut ptr_coarse = std::ptr::null_mut();
         let mut ptr_prolong = std::ptr::null_mut();
         let mut ptr_restrict = std::ptr::null_mut();
@@ -1383,15 +1393,15 @@ impl Operator {
     /// for i in 0..ndofs_coarse {
     ///   sum += array[i];
     /// }
-    /// assert!((sum - 2.0).abs() < 1e-15, "Incorrect interval length computed");
+    /// assert!((sum - 2.0).abs() < 1e-14, "Incorrect interval length computed");
     /// ```
     pub fn create_multigrid_level_H1(
         &self,
         p_mult_fine: &Vector,
-        rstr_coarse: &ElemRestriction,
-        basis_coarse: &Basis,
+        rstr_coarse: &'a ElemRestriction,
+        basis_coarse: &'a Basis,
         interpCtoF: &[f64],
-    ) -> (Operator, Operator, Operator) {
+    ) -> (Operator<'a>, Operator<'a>, Operator<'a>) {
         let mut ptr_coarse = std::ptr::null_mut();
         let mut ptr_prolong = std::ptr::null_mut();
         let mut ptr_restrict = std::ptr::null_mut();
@@ -1418,12 +1428,15 @@ impl Operator {
 // -----------------------------------------------------------------------------
 // Composite Operator
 // -----------------------------------------------------------------------------
-impl CompositeOperator {
+impl<'a> CompositeOperator<'a> {
     // Constructor
-    pub fn create(ceed: &crate::Ceed) -> Self {
+    pub fn create(ceed: &'a crate::Ceed) -> Self {
         let mut ptr = std::ptr::null_mut();
         unsafe { bind_ceed::CeedCompositeOperatorCreate(ceed.ptr, &mut ptr) };
-        let op_core = OperatorCore { ptr };
+        let op_core = OperatorCore {
+            ptr,
+            _lifeline: PhantomData,
+        };
         Self { op_core }
     }
 
@@ -1636,7 +1649,7 @@ impl CompositeOperator {
     /// let op_diff = ceed.operator(&qf_diff, QFunctionOpt::None, QFunctionOpt::None);
     /// op.add_sub_operator(&op_diff);
     /// ```
-    pub fn add_sub_operator(&mut self, subop: &Operator) {
+    pub fn add_sub_operator(&mut self, subop: &Operator<'a>) {
         unsafe { bind_ceed::CeedCompositeOperatorAddSub(self.op_core.ptr, subop.op_core.ptr) };
     }
 
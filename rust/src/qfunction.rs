@@ -18,6 +18,7 @@
 //! describing the physics at the quadrature points.
 
 use crate::prelude::*;
+use std::marker::PhantomData;
 
 pub type QFunctionInputs<'a> = [&'a [f64]; MAX_QFUNCTION_FIELDS];
 pub type QFunctionOutputs<'a> = [&'a mut [f64]; MAX_QFUNCTION_FIELDS];
@@ -27,13 +28,13 @@ pub type QFunctionOutputs<'a> = [&'a mut [f64]; MAX_QFUNCTION_FIELDS];
 // -----------------------------------------------------------------------------
 #[derive(Clone, Copy)]
 pub enum QFunctionOpt<'a> {
-    SomeQFunction(&'a QFunction),
-    SomeQFunctionByName(&'a QFunctionByName),
+    SomeQFunction(&'a QFunction<'a>),
+    SomeQFunctionByName(&'a QFunctionByName<'a>),
     None,
 }
 
 /// Construct a QFunctionOpt reference from a QFunction reference
-impl<'a> From<&'a QFunction> for QFunctionOpt<'a> {
+impl<'a> From<&'a QFunction<'_>> for QFunctionOpt<'a> {
     fn from(qfunc: &'a QFunction) -> Self {
         debug_assert!(qfunc.qf_core.ptr != unsafe { bind_ceed::CEED_QFUNCTION_NONE });
         Self::SomeQFunction(qfunc)
@@ -41,7 +42,7 @@ impl<'a> From<&'a QFunction> for QFunctionOpt<'a> {
 }
 
 /// Construct a QFunctionOpt reference from a QFunction by Name reference
-impl<'a> From<&'a QFunctionByName> for QFunctionOpt<'a> {
+impl<'a> From<&'a QFunctionByName<'_>> for QFunctionOpt<'a> {
     fn from(qfunc: &'a QFunctionByName) -> Self {
         debug_assert!(qfunc.qf_core.ptr != unsafe { bind_ceed::CEED_QFUNCTION_NONE });
         Self::SomeQFunctionByName(qfunc)
@@ -62,32 +63,52 @@ impl<'a> QFunctionOpt<'a> {
 // -----------------------------------------------------------------------------
 // CeedQFunction context wrapper
 // -----------------------------------------------------------------------------
-pub(crate) struct QFunctionCore {
+pub(crate) struct QFunctionCore<'a> {
     ptr: bind_ceed::CeedQFunction,
+    _lifeline: PhantomData<&'a ()>,
 }
 
-struct QFunctionTrampolineData {
+// Sizes of the fields, to build the slices handed to the closure
+struct QFunctionFields {
     number_inputs: usize,
     number_outputs: usize,
     input_sizes: [i32; MAX_QFUNCTION_FIELDS],
     output_sizes: [i32; MAX_QFUNCTION_FIELDS],
 }
 
-pub struct QFunction {
-    qf_core: QFunctionCore,
+// Boxed so the address handed to libCEED as the context stays fixed when the
+// QFunction is moved; generic over the closure, so each QFunction gets its own
+// trampoline calling the closure without dynamic dispatch
+struct QFunctionTrampolineData<F> {
+    fields: QFunctionFields,
+    user_f: F,
+}
+
+// Fields of the trampoline data, whatever the type of the closure
+trait QFunctionTrampolineFields {
+    fn fields(&mut self) -> &mut QFunctionFields;
+}
+
+impl<F> QFunctionTrampolineFields for QFunctionTrampolineData<F> {
+    fn fields(&mut self) -> &mut QFunctionFields {
+        &mut self.fields
+    }
+}
+
+pub struct QFunction<'a> {
+    qf_core: QFunctionCore<'a>,
     qf_ctx_ptr: bind_ceed::CeedQFunctionContext,
-    trampoline_data: QFunctionTrampolineData,
-    user_f: Box<QFunctionUserClosure>,
+    trampoline_data: Box<dyn QFunctionTrampolineFields + 'a>,
 }
 
-pub struct QFunctionByName {
-    qf_core: QFunctionCore,
+pub struct QFunctionByName<'a> {
+    qf_core: QFunctionCore<'a>,
 }
 
 // -----------------------------------------------------------------------------
 // Destructor
 // -----------------------------------------------------------------------------
-impl Drop for QFunctionCore {
+impl<'a> Drop for QFunctionCore<'a> {
     fn drop(&mut self) {
         unsafe {
             if self.ptr != bind_ceed::CEED_QFUNCTION_NONE {
@@ -97,19 +118,18 @@ impl Drop for QFunctionCore {
     }
 }
 
-impl Drop for QFunction {
+impl<'a> Drop for QFunction<'a> {
     fn drop(&mut self) {
         unsafe {
             bind_ceed::CeedQFunctionContextDestroy(&mut self.qf_ctx_ptr);
         }
-        drop(&mut self.qf_core);
     }
 }
 
 // -----------------------------------------------------------------------------
 // Display
 // -----------------------------------------------------------------------------
-impl fmt::Display for QFunctionCore {
+impl<'a> fmt::Display for QFunctionCore<'a> {
     fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
         let mut ptr = std::ptr::null_mut();
         let mut sizeloc = crate::MAX_BUFFER_LENGTH;
@@ -151,7 +171,7 @@ impl fmt::Display for QFunctionCore {
 ///
 /// println!("{}", qf);
 /// ```
-impl fmt::Display for QFunction {
+impl<'a> fmt::Display for QFunction<'a> {
     fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
         self.qf_core.fmt(f)
     }
@@ -165,7 +185,7 @@ impl fmt::Display for QFunction {
 /// let qf = ceed.q_function_interior_by_name("Mass1DBuild");
 /// println!("{}", qf);
 /// ```
-impl fmt::Display for QFunctionByName {
+impl<'a> fmt::Display for QFunctionByName<'a> {
     fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
         self.qf_core.fmt(f)
     }
@@ -174,7 +194,7 @@ impl fmt::Display for QFunctionByName {
 // -----------------------------------------------------------------------------
 // Core functionality
 // -----------------------------------------------------------------------------
-impl QFunctionCore {
+impl<'a> QFunctionCore<'a> {
     // Common implementation
     pub fn apply(&self, Q: i32, u: &[Vector], v: &[Vector]) {
         let mut u_c = [std::ptr::null_mut(); MAX_QFUNCTION_FIELDS];
@@ -204,73 +224,69 @@ macro_rules! mut_max_fields {
         ]
     };
 }
-unsafe extern "C" fn trampoline(
+unsafe extern "C" fn trampoline<F>(
     ctx: *mut ::std::os::raw::c_void,
     q: bind_ceed::CeedInt,
     inputs: *const *const bind_ceed::CeedScalar,
     outputs: *const *mut bind_ceed::CeedScalar,
-) -> ::std::os::raw::c_int {
-    let context = &mut *(ctx as *mut QFunction);
-    let trampoline_data = &context.trampoline_data;
+) -> ::std::os::raw::c_int
+where
+    F: FnMut(QFunctionInputs, QFunctionOutputs) -> i32,
+{
+    let trampoline_data = &mut *(ctx as *mut QFunctionTrampolineData<F>);
+    let fields = &trampoline_data.fields;
 
     // Inputs
-    let inputs_slice: &[*const bind_ceed::CeedScalar] =
-        std::slice::from_raw_parts(inputs, MAX_QFUNCTION_FIELDS);
-    let mut inputs_array: [&[f64]; MAX_QFUNCTION_FIELDS] = [&[0.0]; MAX_QFUNCTION_FIELDS];
-    inputs_slice
-        .iter()
-        .enumerate()
-        .map(|(i, &x)| {
-            std::slice::from_raw_parts(x, (trampoline_data.input_sizes[i] * q) as usize) as &[f64]
-        })
-        .zip(inputs_array.iter_mut())
-        .for_each(|(x, a)| *a = x);
+    let mut inputs_array: QFunctionInputs = [&[0.0]; MAX_QFUNCTION_FIELDS];
+    for i in 0..fields.number_inputs {
+        let length = (fields.input_sizes[i] * q) as usize;
+        inputs_array[i] = std::slice::from_raw_parts(*inputs.add(i), length);
+    }
 
     // Outputs
-    let outputs_slice: &[*mut bind_ceed::CeedScalar] =
-        std::slice::from_raw_parts(outputs, MAX_QFUNCTION_FIELDS);
-    let mut outputs_array: [&mut [f64]; MAX_QFUNCTION_FIELDS] = mut_max_fields!(&mut [0.0]);
-    outputs_slice
-        .iter()
-        .enumerate()
-        .map(|(i, &x)| {
-            std::slice::from_raw_parts_mut(x, (trampoline_data.output_sizes[i] * q) as usize)
-                as &mut [f64]
-        })
-        .zip(outputs_array.iter_mut())
-        .for_each(|(x, a)| *a = x);
+    let mut outputs_array: QFunctionOutputs = mut_max_fields!(&mut [0.0]);
+    for i in 0..fields.number_outputs {
+        let length = (fields.output_sizes[i] * q) as usize;
+        outputs_array[i] = std::slice::from_raw_parts_mut(*outputs.add(i), length);
+    }
 
     // User closure
-    (context.user_f)(inputs_array, outputs_array)
+    (trampoline_data.user_f)(inputs_array, outputs_array)
 }
 
 // -----------------------------------------------------------------------------
 // QFunction
 // -----------------------------------------------------------------------------
-impl QFunction {
+impl<'a> QFunction<'a> {
     // Constructor
-    pub fn create(ceed: &crate::Ceed, vlength: i32, user_f: Box<QFunctionUserClosure>) -> Self {
-        let source_c = CString::new("").expect("CString::new failed");
+    pub fn create(ceed: &'a crate::Ceed, vlength: i32, user_f: Box<QFunctionUserClosure>) -> Self {
+        Self::create_generic(ceed, vlength, user_f, "")
+    }
+
+    // Constructor, with the closure type as a parameter of the trampoline
+    pub fn create_generic<F>(ceed: &'a crate::Ceed, vlength: i32, user_f: F, source: &str) -> Self
+    where
+        F: FnMut(QFunctionInputs, QFunctionOutputs) -> i32 + 'a,
+    {
+        let source_c = CString::new(source).expect("CString::new failed");
         let mut ptr = std::ptr::null_mut();
 
         // Context for closure
-        let number_inputs = 0;
-        let number_outputs = 0;
-        let input_sizes = [0; MAX_QFUNCTION_FIELDS];
-        let output_sizes = [0; MAX_QFUNCTION_FIELDS];
-        let trampoline_data = QFunctionTrampolineData {
-            number_inputs,
-            number_outputs,
-            input_sizes,
-            output_sizes,
+        let fields = QFunctionFields {
+            number_inputs: 0,
+            number_outputs: 0,
+            input_sizes: [0; MAX_QFUNCTION_FIELDS],
+            output_sizes: [0; MAX_QFUNCTION_FIELDS],
         };
+        let mut trampoline_data = Box::new(QFunctionTrampolineData { fields, user_f });
+        let trampoline_ptr = &mut *trampoline_data as *mut QFunctionTrampolineData<F>;
 
         // Create QFunction
         unsafe {
             bind_ceed::CeedQFunctionCreateInterior(
                 ceed.ptr,
                 vlength,
-                Some(trampoline),
+                Some(trampoline::<F>),
                 source_c.as_ptr(),
                 &mut ptr,
             )
@@ -280,12 +296,14 @@ impl QFunction {
         let qf_ctx_ptr = std::ptr::null_mut();
 
         // Create object
-        let qf_core = QFunctionCore { ptr };
+        let qf_core = QFunctionCore {
+            ptr,
+            _lifeline: PhantomData,
+        };
         let mut qf_self = Self {
             qf_core,
             qf_ctx_ptr,
             trampoline_data,
-            user_f,
         };
 
         // Set closure
@@ -297,7 +315,7 @@ impl QFunction {
                 crate::MemType::Host as bind_ceed::CeedMemType,
                 crate::CopyMode::UsePointer as bind_ceed::CeedCopyMode,
                 10, /* Note: size not relevant - CPU only approach */
-                &mut qf_self as *mut _ as *mut ::std::os::raw::c_void,
+                trampoline_ptr as *mut ::std::os::raw::c_void,
             );
             bind_ceed::CeedQFunctionSetContext(qf_self.qf_core.ptr, qf_ctx_ptr);
         }
@@ -402,8 +420,9 @@ impl QFunction {
     /// ```
     pub fn add_input(&mut self, fieldname: &str, size: i32, emode: crate::EvalMode) {
         let name_c = CString::new(fieldname).expect("CString::new failed");
-        self.trampoline_data.input_sizes[self.trampoline_data.number_inputs] = size;
-        self.trampoline_data.number_inputs += 1;
+        let fields = self.trampoline_data.fields();
+        fields.input_sizes[fields.number_inputs] = size;
+        fields.number_inputs += 1;
         let emode = emode as bind_ceed::CeedEvalMode;
         unsafe {
             bind_ceed::CeedQFunctionAddInput(self.qf_core.ptr, name_c.as_ptr(), size, emode);
@@ -443,8 +462,9 @@ impl QFunction {
     /// ```
     pub fn add_output(&mut self, fieldname: &str, size: i32, emode: crate::EvalMode) {
         let name_c = CString::new(fieldname).expect("CString::new failed");
-        self.trampoline_data.output_sizes[self.trampoline_data.number_outputs] = size;
-        self.trampoline_data.number_outputs += 1;
+        let fields = self.trampoline_data.fields();
+        fields.output_sizes[fields.number_outputs] = size;
+        fields.number_outputs += 1;
         let emode = emode as bind_ceed::CeedEvalMode;
         unsafe {
             bind_ceed::CeedQFunctionAddOutput(self.qf_core.ptr, name_c.as_ptr(), size, emode);
@@ -455,15 +475,18 @@ impl QFunction {
 // -----------------------------------------------------------------------------
 // QFunction
 // -----------------------------------------------------------------------------
-impl QFunctionByName {
+impl<'a> QFunctionByName<'a> {
     // Constructor
-    pub fn create(ceed: &crate::Ceed, name: &str) -> Self {
+    pub fn create(ceed: &'a crate::Ceed, name: &str) -> Self {
         let name_c = CString::new(name).expect("CString::new failed");
         let mut ptr = std::ptr::null_mut();
         unsafe {
             bind_ceed::CeedQFunctionCreateInteriorByName(ceed.ptr, name_c.as_ptr(), &mut ptr)
         };
-        let qf_core = QFunctionCore { ptr };
+        let qf_core = QFunctionCore {
+            ptr,
+            _lifeline: PhantomData,
+        };
         Self { qf_core }
     }
 
@@ -19,6 +19,7 @@
 
 use std::{
     convert::TryFrom,
+    marker::PhantomData,
     ops::{Deref, DerefMut},
     os::raw::c_char,
 };
@@ -30,12 +31,12 @@ use crate::prelude::*;
 // -----------------------------------------------------------------------------
 #[derive(Debug, Clone, Copy)]
 pub enum VectorOpt<'a> {
-    Some(&'a Vector),
+    Some(&'a Vector<'a>),
     Active,
     None,
 }
 /// Construct a VectorOpt reference from a Vector reference
-impl<'a> From<&'a Vector> for VectorOpt<'a> {
+impl<'a> From<&'a Vector<'_>> for VectorOpt<'a> {
     fn from(vec: &'a Vector) -> Self {
         debug_assert!(vec.ptr != unsafe { bind_ceed::CEED_VECTOR_NONE });
         debug_assert!(vec.ptr != unsafe { bind_ceed::CEED_VECTOR_ACTIVE });
@@ -57,10 +58,12 @@ impl<'a> VectorOpt<'a> {
 // CeedVector context wrapper
 // -----------------------------------------------------------------------------
 #[derive(Debug)]
-pub struct Vector {
+pub struct Vector<'a> {
     pub(crate) ptr: bind_ceed::CeedVector,
+    pub(crate) sync_on_drop: bool,
+    _lifeline: PhantomData<&'a ()>,
 }
-impl From<&'_ Vector> for bind_ceed::CeedVector {
+impl From<&'_ Vector<'_>> for bind_ceed::CeedVector {
     fn from(vec: &Vector) -> Self {
         vec.ptr
     }
@@ -69,12 +72,17 @@ impl From<&'_ Vector> for bind_ceed::CeedVector {
 // -----------------------------------------------------------------------------
 // Destructor
 // -----------------------------------------------------------------------------
-impl Drop for Vector {
+impl<'a> Drop for Vector<'a> {
     fn drop(&mut self) {
         let not_none_and_active = self.ptr != unsafe { bind_ceed::CEED_VECTOR_NONE }
             && self.ptr != unsafe { bind_ceed::CEED_VECTOR_ACTIVE };
 
         if not_none_and_active {
+            // A borrowed slice must hold the current values when it is released
+            if self.sync_on_drop {
+                let host = crate::MemType::Host as bind_ceed::CeedMemType;
+                unsafe { bind_ceed::CeedVectorSyncArray(self.ptr, host) };
+            }
             unsafe { bind_ceed::CeedVectorDestroy(&mut self.ptr) };
         }
     }
@@ -83,7 +91,7 @@ impl Drop for Vector {
 // -----------------------------------------------------------------------------
 // Display
 // -----------------------------------------------------------------------------
-impl fmt::Display for Vector {
+impl<'a> fmt::Display for Vector<'a> {
     /// View a Vector
     ///
     /// ```
@@ -114,17 +122,21 @@ impl fmt::Display for Vector {
 // -----------------------------------------------------------------------------
 // Implementations
 // -----------------------------------------------------------------------------
-impl Vector {
+impl<'a> Vector<'a> {
     // Constructors
-    pub fn create(ceed: &crate::Ceed, n: usize) -> Self {
+    pub fn create(ceed: &'a crate::Ceed, n: usize) -> Self {
         let n = n as i32;
         let mut ptr = std::ptr::null_mut();
         unsafe { bind_ceed::CeedVectorCreate(ceed.ptr, n, &mut ptr) };
-        Self { ptr: ptr }
+        Self::from_raw(ptr)
     }
 
     pub(crate) fn from_raw(ptr: bind_ceed::CeedVector) -> Self {
-        Self { ptr: ptr }
+        Self {
+            ptr: ptr,
+            sync_on_drop: false,
+            _lifeline: PhantomData,
+        }
     }
 
     /// Create a Vector from a slice
@@ -139,13 +151,18 @@ impl Vector {
     /// let vec = vector::Vector::from_slice(&ceed, &[1., 2., 3.,]);
     /// assert_eq!(vec.length(), 3, "Incorrect length from slice");
     /// ```
-    pub fn from_slice(ceed: &crate::Ceed, v: &[f64]) -> Self {
+    pub fn from_slice(ceed: &'a crate::Ceed, v: &[f64]) -> Self {
         let mut x = Self::create(ceed, v.len());
         x.set_slice(v);
         x
     }
 
-    /// Create a Vector from a mutable array reference
+    /// Create a Vector that uses a mutable array reference as its storage,
+    ///   without copying
+    ///
+    /// The Vector borrows the slice for its whole lifetime, so the slice
+    ///   cannot be read or freed while libCEED may still write to it. When
+    ///   the Vector is dropped, the slice holds its current values.
     ///
     /// # arguments
     ///
@@ -155,18 +172,23 @@ impl Vector {
     /// # use libceed::prelude::*;
     /// # let ceed = libceed::Ceed::default_init();
     /// let mut rust_vec = vec![1., 2., 3.];
-    /// let vec = libceed::vector::Vector::from_array(&ceed, &mut rust_vec);
+    /// {
+    ///   let mut vec = libceed::vector::Vector::from_array(&ceed, &mut rust_vec);
+    ///   assert_eq!(vec.length(), 3, "Incorrect length from slice");
+    ///   vec.set_value(4.);
+    /// }
     ///
-    /// assert_eq!(vec.length(), 3, "Incorrect length from slice");
+    /// assert_eq!(rust_vec, [4., 4., 4.], "Slice not updated");
     /// ```
-    pub fn from_array(ceed: &crate::Ceed, v: &mut [f64]) -> Self {
-        let x = Self::create(ceed, v.len());
+    pub fn from_array(ceed: &'a crate::Ceed, v: &'a mut [f64]) -> Self {
+        let mut x = Self::create(ceed, v.len());
         let (host, user_pointer) = (
             crate::MemType::Host as bind_ceed::CeedMemType,
             crate::CopyMode::UsePointer as bind_ceed::CeedCopyMode,
         );
-        let v = v.as_ptr() as *mut f64;
+        let v = v.as_mut_ptr();
         unsafe { bind_ceed::CeedVectorSetArray(x.ptr, host, user_pointer, v) };
+        x.sync_on_drop = true;
         x
     }
 
@@ -289,7 +311,7 @@ impl Vector {
     /// let w = vec.view();
     /// assert_eq!(v[1..], w[1..]);
     /// ```
-    pub fn view(&self) -> VectorView {
+    pub fn view(&self) -> VectorView<'_> {
         VectorView::new(self)
     }
 
@@ -308,7 +330,7 @@ impl Vector {
     /// let w = vec.view();
     /// assert_eq!(w[2], 9., "View did not mutate data");
     /// ```
-    pub fn view_mut(&mut self) -> VectorViewMut {
+    pub fn view_mut(&mut self) -> VectorViewMut<'_> {
         VectorViewMut::new(self)
     }
 
@@ -347,13 +369,13 @@ impl Vector {
 /// call bind_ceed::CeedVectorRestoreArrayRead().
 #[derive(Debug)]
 pub struct VectorView<'a> {
-    vec: &'a Vector,
+    vec: &'a Vector<'a>,
     array: *const f64,
 }
 
 impl<'a> VectorView<'a> {
     /// Construct a VectorView from a Vector reference
-    fn new(vec: &'a Vector) -> Self {
+    fn new(vec: &'a Vector<'a>) -> Self {
         let mut array = std::ptr::null();
         unsafe {
             bind_ceed::CeedVectorGetArrayRead(
@@ -399,7 +421,7 @@ impl<'a> fmt::Display for VectorView<'a> {
 /// A mutable (host) view of a Vector with Deref to slice.
 #[derive(Debug)]
 pub struct VectorViewMut<'a> {
-    vec: &'a Vector,
+    vec: &'a Vector<'a>,
     array: *mut f64,
 }
 
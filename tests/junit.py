@@ -45,7 +45,7 @@ def contains_any(resource, substrings):
 
 def skip_rule(test, resource):
     return any((
-        test.startswith('fluids-') and contains_any(resource, ['occa', 'gpu']) and not contains_any(resource, ['/gpu/cuda/gen']),
+        test.startswith('fluids-') and contains_any(resource, ['occa', 'gpu']) and not contains_any(resource, ['/gpu/cuda/gen', '/gpu/hip/gen']),
         test.startswith('solids-') and contains_any(resource, ['occa']),
         test.startswith('petsc-multigrid') and contains_any(resource, ['occa']),
         test.startswith('nek') and contains_any(resource, ['occa']),
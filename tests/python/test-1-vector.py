@@ -162,6 +162,43 @@ def test_105(ceed_resource):
             for i in range(n):
                 assert b[i] == 10 + i
 
+# -------------------------------------------------------------------------------
+# Test setting a vector from an array passed through DLPack without a copy
+# -------------------------------------------------------------------------------
+
+
+class DLPackOnly():
+    """Exposes only the DLPack protocol of an array"""
+
+    def __init__(self, array):
+        self._array = array
+
+    def __dlpack__(self, stream=None):
+        return self._array.__dlpack__()
+
+    def __dlpack_device__(self):
+        return self._array.__dlpack_device__()
+
+
+def test_106(ceed_resource):
+    # Skip test for NumPy without DLPack
+    if hasattr(np.ndarray, "__dlpack__"):
+        ceed = libceed.Ceed(ceed_resource)
+
+        n = 10
+        x = ceed.Vector(n)
+
+        a = np.arange(10, 10 + n, dtype="float64")
+        x.set_array(DLPackOnly(a), cmode=libceed.USE_POINTER)
+
+        with x.array() as b:
+            b[3] = -3.14
+
+        assert a[3] == -3.14
+        with x.array_read() as b:
+            for i in range(n):
+                assert b[i] == (-3.14 if i == 3 else 10 + i)
+
 # -------------------------------------------------------------------------------
 # Test view
 # -------------------------------------------------------------------------------
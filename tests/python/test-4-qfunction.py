@@ -20,6 +20,7 @@
 import os
 import libceed
 import numpy as np
+import pytest
 import check
 
 # -------------------------------------------------------------------------------
@@ -193,6 +194,64 @@ def test_402(ceed_resource, capsys):
     assert not stderr
     assert stdout == ref_stdout
 
+# -------------------------------------------------------------------------------
+# Test qfunction compiled with Numba, with its source given as a string
+# -------------------------------------------------------------------------------
+
+
+setup_mass_source = """
+CEED_QFUNCTION(setup_mass)(void *ctx, const CeedInt Q,
+                           const CeedScalar *const *in,
+                           CeedScalar *const *out) {
+  const CeedScalar *w = in[0], *J = in[1];
+  CeedScalar *qdata = out[0];
+  for (CeedInt i=0; i<Q; i++)
+    qdata[i] = J[i] * w[i];
+  return 0;
+}
+"""
+
+
+def test_403(ceed_resource):
+    numba = pytest.importorskip("numba")
+    from numba import types
+
+    ceed = libceed.Ceed(ceed_resource)
+
+    sig = types.int32(types.voidptr, types.int32,
+                      types.CPointer(types.CPointer(types.float64)),
+                      types.CPointer(types.CPointer(types.float64)))
+
+    @numba.cfunc(sig)
+    def setup_mass(ctx, q, inputs, outputs):
+        w = numba.carray(inputs[0], (q,))
+        dx = numba.carray(inputs[1], (q,))
+        qdata = numba.carray(outputs[0], (q,))
+        for i in range(q):
+            qdata[i] = dx[i] * w[i]
+        return 0
+
+    qf_setup = ceed.QFunction(1, setup_mass, setup_mass_source)
+    qf_setup.add_input("w", 1, libceed.EVAL_WEIGHT)
+    qf_setup.add_input("dx", 1, libceed.EVAL_GRAD)
+    qf_setup.add_output("qdata", 1, libceed.EVAL_NONE)
+
+    q = 8
+
+    w_array = np.linspace(0., 1., q)
+    dx = ceed.Vector(q)
+    dx.set_value(2)
+    w = ceed.Vector(q)
+    w.set_array(w_array, cmode=libceed.USE_POINTER)
+    qdata = ceed.Vector(q)
+    qdata.set_value(0)
+
+    qf_setup.apply(q, [w, dx], [qdata])
+
+    with qdata.array_read() as qdata_array:
+        for i in range(q):
+            assert qdata_array[i] == 2 * w_array[i]
+
 # -------------------------------------------------------------------------------
 # Test creation, evaluation, and destruction for qfunction by name
 # -------------------------------------------------------------------------------
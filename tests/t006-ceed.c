@@ -0,0 +1,47 @@
+/// @file
+/// Test device memory pool usage and trimming
+/// \test Test device memory pool usage and trimming
+#include <ceed.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x;
+  const CeedInt n = 1000;
+  size_t inuse0, inuse, cached, highwater;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedMemoryPoolGetUsage(ceed, &inuse0, &cached, &highwater);
+
+  // Allocate vector memory on the preferred memory type
+  CeedVectorCreate(ceed, n, &x);
+  CeedVectorSetValue(x, 1.0);
+  CeedMemoryPoolGetUsage(ceed, &inuse, &cached, &highwater);
+  if (highwater && inuse < inuse0 + n*sizeof(CeedScalar))
+    // LCOV_EXCL_START
+    printf("Vector allocation not counted: %zu bytes in use\n", inuse);
+  // LCOV_EXCL_STOP
+  if (inuse > highwater)
+    // LCOV_EXCL_START
+    printf("In use %zu exceeds high-water %zu\n", inuse, highwater);
+  // LCOV_EXCL_STOP
+
+  // Freed memory is returned to the pool
+  CeedVectorDestroy(&x);
+  CeedMemoryPoolGetUsage(ceed, &inuse, &cached, &highwater);
+  if (inuse != inuse0)
+    // LCOV_EXCL_START
+    printf("Vector memory not released: %zu bytes in use\n", inuse);
+  // LCOV_EXCL_STOP
+
+  // Trimming releases all cached memory
+  CeedMemoryPoolTrim(ceed);
+  CeedMemoryPoolGetUsage(ceed, &inuse, &cached, &highwater);
+  if (cached)
+    // LCOV_EXCL_START
+    printf("Memory pool not trimmed: %zu bytes cached\n", cached);
+  // LCOV_EXCL_STOP
+
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,30 @@
+/// @file
+/// Test setting options for runtime compilation of kernels
+/// \test Test setting options for runtime compilation of kernels
+#include <ceed.h>
+#include <string.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  const char *options;
+  const char *fastmath = "--use_fast_math -DCEED_MAX_THREADS_PER_BLOCK=256";
+
+  CeedInit(argv[1], &ceed);
+
+  CeedSetJitOptions(ceed, fastmath);
+  CeedGetJitOptions(ceed, &options);
+  if (!options || strcmp(options, fastmath))
+    // LCOV_EXCL_START
+    printf("JIT options not set: %s\n", options ? options : "(null)");
+  // LCOV_EXCL_STOP
+
+  CeedSetJitOptions(ceed, NULL);
+  CeedGetJitOptions(ceed, &options);
+  if (options)
+    // LCOV_EXCL_START
+    printf("JIT options not cleared: %s\n", options);
+  // LCOV_EXCL_STOP
+
+  CeedDestroy(&ceed);
+  return 0;
+}
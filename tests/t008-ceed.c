@@ -0,0 +1,53 @@
+/// @file
+/// Test writing a trace of profiled stages
+/// \test Test writing a trace of profiled stages
+#include <ceed.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedBasis b;
+  CeedVector U, V;
+  CeedInt Q = 4;
+  char filename[64], trace[4096];
+
+  CeedInit(argv[1], &ceed);
+  CeedSetTraceFile(ceed, "t008-ceed-%d.json");
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &b);
+  CeedVectorCreate(ceed, 2, &U);
+  CeedVectorSetValue(U, 1.0);
+  CeedVectorCreate(ceed, Q, &V);
+  CeedBasisApply(b, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, U, V);
+
+  CeedBasisDestroy(&b);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedDestroy(&ceed);
+
+  // The trace is written by CeedDestroy, with the process id in its name
+  snprintf(filename, sizeof filename, "t008-ceed-%d.json", (int)getpid());
+  FILE *stream = fopen(filename, "r");
+  if (!stream) {
+    // LCOV_EXCL_START
+    printf("Trace file %s not written\n", filename);
+    return 0;
+    // LCOV_EXCL_STOP
+  }
+  size_t len = fread(trace, 1, sizeof trace - 1, stream);
+  trace[len] = '\0';
+  fclose(stream);
+  remove(filename);
+
+  if (strncmp(trace, "{\"displayTimeUnit\"", 18))
+    // LCOV_EXCL_START
+    printf("Trace is not Chrome trace JSON:\n%s\n", trace);
+  // LCOV_EXCL_STOP
+  if (!strstr(trace, "{\"name\":\"CeedBasisApply\",\"cat\":\"libCEED\","))
+    // LCOV_EXCL_START
+    printf("Trace does not record CeedBasisApply:\n%s\n", trace);
+  // LCOV_EXCL_STOP
+  return 0;
+}
@@ -0,0 +1,93 @@
+/// @file
+/// Test allocating the memory of a Ceed through an application allocator
+/// \test Test allocating the memory of a Ceed through an application allocator
+#include <ceed.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_BLOCKS 256
+
+typedef struct {
+  void *blocks[MAX_BLOCKS];
+  int numblocks, numbad;
+} Pool;
+
+static int PoolAlloc(void *ctx, CeedMemSpace space, size_t bytes, void **ptr) {
+  Pool *pool = ctx;
+  if (space != CEED_MEMSPACE_HOST || pool->numblocks == MAX_BLOCKS)
+    return 1;
+  *ptr = malloc(bytes);
+  pool->blocks[pool->numblocks++] = *ptr;
+  return 0;
+}
+
+static int PoolDealloc(void *ctx, CeedMemSpace space, void *ptr) {
+  Pool *pool = ctx;
+  for (int i=0; i<pool->numblocks; i++)
+    if (pool->blocks[i] == ptr) {
+      pool->blocks[i] = pool->blocks[--pool->numblocks];
+      free(ptr);
+      return 0;
+    }
+  // LCOV_EXCL_START
+  pool->numbad++;
+  return 0;
+  // LCOV_EXCL_STOP
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction r;
+  CeedBasis b;
+  CeedVector x, u, v;
+  CeedInt ne = 3, P = 2, Q = 4, ind[2*ne];
+  CeedScalar a[ne+1];
+  const CeedScalar *vv;
+  Pool pool = {.numblocks = 0, .numbad = 0};
+
+  CeedInit(argv[1], &ceed);
+  if (strncmp(argv[1], "/cpu", 4))
+    return 0;
+  CeedSetAllocator(ceed, PoolAlloc, PoolDealloc, &pool);
+
+  for (CeedInt i=0; i<ne; i++) {
+    ind[2*i+0] = i;
+    ind[2*i+1] = i+1;
+  }
+  CeedElemRestrictionCreate(ceed, ne, P, 1, 1, ne+1, CEED_MEM_HOST,
+                            CEED_COPY_VALUES, ind, &r);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &b);
+  CeedVectorCreate(ceed, ne+1, &x);
+  for (CeedInt i=0; i<ne+1; i++)
+    a[i] = 10 + i;
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, a);
+  CeedVectorCreate(ceed, ne*P, &u);
+  CeedVectorCreate(ceed, ne*Q, &v);
+
+  CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, x, u, CEED_REQUEST_IMMEDIATE);
+  CeedBasisApply(b, ne, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, u, v);
+
+  // Interpolated values lie between the smallest and largest nodal values
+  CeedVectorGetArrayRead(v, CEED_MEM_HOST, &vv);
+  for (CeedInt i=0; i<ne*Q; i++)
+    if (vv[i] < a[0] || vv[i] > a[ne])
+      // LCOV_EXCL_START
+      printf("Error interpolating: v[%d] = %f\n", i, (double)vv[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(v, &vv);
+
+  CeedElemRestrictionDestroy(&r);
+  CeedBasisDestroy(&b);
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedDestroy(&ceed);
+
+  if (pool.numblocks || pool.numbad)
+    // LCOV_EXCL_START
+    printf("Allocator has %d blocks not freed and %d unknown frees\n",
+           pool.numblocks, pool.numbad);
+  // LCOV_EXCL_STOP
+  return 0;
+}
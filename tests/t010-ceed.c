@@ -0,0 +1,62 @@
+/// @file
+/// Test profiling a backend through the trace interposer
+/// \test Test profiling a backend through the trace interposer
+#define _POSIX_C_SOURCE 200112 // setenv
+#include <ceed.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedBasis b;
+  CeedVector U, V;
+  CeedInt Q = 4;
+  bool profiling;
+  char resource[1024], filename[64], report[4096];
+
+  // The report is written by CeedDestroy, with the process id in its name
+  snprintf(filename, sizeof filename, "t010-ceed-%d.txt", (int)getpid());
+  setenv("CEED_TRACE_REPORT", filename, 1);
+  snprintf(resource, sizeof resource, "/trace%s", argv[1]);
+  CeedInit(resource, &ceed);
+  CeedIsProfiling(ceed, &profiling);
+  if (!profiling)
+    // LCOV_EXCL_START
+    printf("Trace backend is not profiling\n");
+  // LCOV_EXCL_STOP
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &b);
+  CeedVectorCreate(ceed, 2, &U);
+  CeedVectorSetValue(U, 1.0);
+  CeedVectorCreate(ceed, Q, &V);
+  CeedBasisApply(b, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, U, V);
+
+  CeedBasisDestroy(&b);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedDestroy(&ceed);
+
+  FILE *stream = fopen(filename, "r");
+  if (!stream) {
+    // LCOV_EXCL_START
+    printf("Trace report %s not written\n", filename);
+    return 0;
+    // LCOV_EXCL_STOP
+  }
+  size_t len = fread(report, 1, sizeof report - 1, stream);
+  report[len] = '\0';
+  fclose(stream);
+  remove(filename);
+
+  if (strncmp(report, "Trace of ", 9) || !strstr(report, argv[1]))
+    // LCOV_EXCL_START
+    printf("Report does not name the traced backend:\n%s\n", report);
+  // LCOV_EXCL_STOP
+  if (!strstr(report, "CeedBasisApply"))
+    // LCOV_EXCL_START
+    printf("Report does not record CeedBasisApply:\n%s\n", report);
+  // LCOV_EXCL_STOP
+  return 0;
+}
@@ -0,0 +1,59 @@
+/// @file
+/// Test auditing host/device transfers of CeedVector data
+/// \test Test auditing host/device transfers of CeedVector data
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <stdio.h>
+#include <string.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x;
+  CeedInt n = 10, h2d, d2h;
+  CeedScalar a[n];
+  const CeedScalar *b;
+
+  CeedInit(argv[1], &ceed);
+  for (CeedInt i=0; i<n; i++)
+    a[i] = 10 + i;
+  CeedVectorCreate(ceed, n, &x);
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, a);
+
+  // Host access to host data needs no transfer, even within a region
+  CeedSetSyncAudit(ceed, CEED_SYNC_AUDIT_ERROR);
+  CeedSyncAuditRegionBegin(ceed, "outer");
+  CeedSyncAuditRegionBegin(ceed, "inner");
+  CeedVectorSyncArray(x, CEED_MEM_HOST);
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++)
+    if (b[i] != 10 + i)
+      // LCOV_EXCL_START
+      printf("Error reading array b[%d] = %f\n", i, (double)b[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(x, &b);
+  CeedSyncAuditRegionEnd(ceed);
+  CeedSyncAuditRegionEnd(ceed);
+
+  if (!strncmp(argv[1], "/cpu", 4)) {
+    CeedGetSyncAuditCounts(ceed, &h2d, &d2h);
+    if (h2d || d2h)
+      // LCOV_EXCL_START
+      printf("Transfers audited on a host backend: %d H2D, %d D2H\n", h2d, d2h);
+    // LCOV_EXCL_STOP
+  }
+
+  // Transfers are not counted when auditing is disabled
+  CeedGetSyncAuditCounts(ceed, &h2d, &d2h);
+  CeedSetSyncAudit(ceed, CEED_SYNC_AUDIT_NONE);
+  CeedVectorAuditTransfer(x, CEED_MEM_HOST, n*sizeof(CeedScalar));
+  CeedInt h2d2, d2h2;
+  CeedGetSyncAuditCounts(ceed, &h2d2, &d2h2);
+  if (h2d2 != h2d || d2h2 != d2h)
+    // LCOV_EXCL_START
+    printf("Transfer counted with auditing disabled\n");
+  // LCOV_EXCL_STOP
+
+  CeedVectorDestroy(&x);
+  CeedDestroy(&ceed);
+  return 0;
+}
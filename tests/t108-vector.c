@@ -19,19 +19,19 @@ int main(int argc, char **argv) {
 
   CeedScalar norm;
   CeedVectorNorm(x, CEED_NORM_1, &norm);
-  if (fabs(norm - 45.) > 1e-14)
+  if (fabs(norm - 45.) > 100*CEED_EPSILON)
     // LCOV_EXCL_START
     printf("Error: L1 norm %f != 45.\n", norm);
   // LCOV_EXCL_STOP
 
   CeedVectorNorm(x, CEED_NORM_2, &norm);
-  if (fabs(norm - sqrt(285.)) > 1e-14)
+  if (fabs(norm - sqrt(285.)) > 100*CEED_EPSILON)
     // LCOV_EXCL_START
     printf("Error: L2 norm %f != sqrt(285.)\n", norm);
   // LCOV_EXCL_STOP
 
   CeedVectorNorm(x, CEED_NORM_MAX, &norm);
-  if (fabs(norm - 9.) > 1e-14)
+  if (fabs(norm - 9.) > 100*CEED_EPSILON)
     // LCOV_EXCL_START
     printf("Error: Max norm %f != 9.\n", norm);
   // LCOV_EXCL_STOP
@@ -0,0 +1,59 @@
+/// @file
+/// Test CeedVector access through unified memory
+/// \test Test CeedVector access through unified memory
+#include <ceed.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x;
+  CeedInt n;
+  CeedScalar a[10], *c;
+  const CeedScalar *b;
+
+  CeedInit(argv[1], &ceed);
+
+  n = 10;
+  CeedVectorCreate(ceed, n, &x);
+  for (CeedInt i=0; i<n; i++)
+    a[i] = 10 + i;
+  CeedVectorSetArray(x, CEED_MEM_UNIFIED, CEED_COPY_VALUES, a);
+
+  // Read back through unified and host memory
+  CeedVectorGetArrayRead(x, CEED_MEM_UNIFIED, &b);
+  for (CeedInt i=0; i<n; i++)
+    if (b[i] != 10+i)
+      // LCOV_EXCL_START
+      printf("Error reading unified array b[%d] = %f\n",i,(double)b[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(x, &b);
+
+  // Modify through unified memory after a device-side update
+  CeedVectorSetValue(x, 2.0);
+  CeedVectorGetArray(x, CEED_MEM_UNIFIED, &c);
+  for (CeedInt i=0; i<n; i++)
+    c[i] += i;
+  CeedVectorRestoreArray(x, &c);
+
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++)
+    if (b[i] != 2+i)
+      // LCOV_EXCL_START
+      printf("Error reading host array b[%d] = %f\n",i,(double)b[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(x, &b);
+
+  // Copy host values into unified memory
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, a);
+  CeedVectorSyncArray(x, CEED_MEM_UNIFIED);
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++)
+    if (b[i] != 10+i)
+      // LCOV_EXCL_START
+      printf("Error reading host array b[%d] = %f\n",i,(double)b[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(x, &b);
+
+  CeedVectorDestroy(&x);
+  CeedDestroy(&ceed);
+  return 0;
+}
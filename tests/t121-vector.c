@@ -0,0 +1,80 @@
+/// @file
+/// Test vector algebra: AXPY, AXPBY, pointwise multiplication, and dot product
+/// \test Test vector algebra: AXPY, AXPBY, pointwise multiplication, and dot product
+#include <ceed.h>
+#include <math.h>
+
+static int CheckValues(CeedVector x, CeedScalar (*f)(CeedInt),
+                       const char *name) {
+  const CeedScalar *a;
+
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &a);
+  for (CeedInt i=0; i<10; i++)
+    if (fabs(a[i] - f(i)) > 100*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error in %s: a[%d] = %f != %f\n", name, i, (double)a[i],
+             (double)f(i));
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(x, &a);
+  return 0;
+}
+
+static CeedScalar AXPY(CeedInt i) {return 2*(10+i) + i;}
+static CeedScalar AXPBY(CeedInt i) {return 2*(10+i) - 3*AXPY(i);}
+static CeedScalar Mult(CeedInt i) {return (10+i)*AXPBY(i);}
+static CeedScalar Square(CeedInt i) {return (10+i)*(10+i);}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x, y;
+  CeedInt n = 10;
+  CeedScalar a[10], dot;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, n, &x);
+  CeedVectorCreate(ceed, n, &y);
+  for (CeedInt i=0; i<n; i++)
+    a[i] = 10 + i;
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, a);
+  for (CeedInt i=0; i<n; i++)
+    a[i] = i;
+  CeedVectorSetArray(y, CEED_MEM_HOST, CEED_COPY_VALUES, a);
+
+  // y = 2 x + y
+  CeedVectorAXPY(y, 2.0, x);
+  CheckValues(y, AXPY, "AXPY");
+
+  // y = 2 x - 3 y
+  CeedVectorAXPBY(y, 2.0, -3.0, x);
+  CheckValues(y, AXPBY, "AXPBY");
+
+  // y = x .* y
+  CeedVectorPointwiseMult(y, x, y);
+  CheckValues(y, Mult, "PointwiseMult");
+
+  // x . y
+  CeedVectorDot(x, y, &dot);
+  CeedScalar expected = 0;
+  for (CeedInt i=0; i<n; i++)
+    expected += (10+i)*Mult(i);
+  if (fabs(dot - expected) > 100*CEED_EPSILON*fabs(expected))
+    // LCOV_EXCL_START
+    printf("Error in Dot: %f != %f\n", (double)dot, (double)expected);
+  // LCOV_EXCL_STOP
+
+  // Aliased arguments
+  CeedVectorPointwiseMult(y, x, x);
+  CheckValues(y, Square, "PointwiseMult aliased");
+  CeedVectorAXPY(x, -1.0, x);
+  CeedVectorNorm(x, CEED_NORM_MAX, &dot);
+  if (dot > 100*CEED_EPSILON)
+    // LCOV_EXCL_START
+    printf("Error in AXPY aliased: norm %f != 0\n", (double)dot);
+  // LCOV_EXCL_STOP
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,66 @@
+/// @file
+/// Test computing norms and dot products into a CeedVector
+/// \test Test computing norms and dot products into a CeedVector
+#include <ceed.h>
+#include <math.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x, y, result;
+  CeedInt n = 10;
+  CeedScalar a[10], norm[3], dot;
+  const CeedScalar *r;
+  const CeedNormType types[4] = {CEED_NORM_MAX, CEED_NORM_1, CEED_NORM_2,
+                                 CEED_NORM_MAX
+                                };
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, n, &x);
+  CeedVectorCreate(ceed, n, &y);
+  CeedVectorCreate(ceed, 4, &result);
+  for (CeedInt i=0; i<n; i++)
+    a[i] = i % 2 ? -(10 + i) : 10 + i;
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, a);
+  CeedVectorSetValue(y, 2.0);
+
+  // Compare the fused norms to individual norms
+  CeedVectorNorms(x, 4, types, result);
+  CeedVectorNorm(x, CEED_NORM_1, &norm[0]);
+  CeedVectorNorm(x, CEED_NORM_2, &norm[1]);
+  CeedVectorNorm(x, CEED_NORM_MAX, &norm[2]);
+  CeedVectorGetArrayRead(result, CEED_MEM_HOST, &r);
+  if (fabs(r[0] - norm[2]) > 100*CEED_EPSILON ||
+      fabs(r[3] - norm[2]) > 100*CEED_EPSILON)
+    // LCOV_EXCL_START
+    printf("Error in max norm: %f, %f != %f\n", (double)r[0], (double)r[3],
+           (double)norm[2]);
+  // LCOV_EXCL_STOP
+  if (fabs(r[1] - norm[0]) > 1000*CEED_EPSILON)
+    // LCOV_EXCL_START
+    printf("Error in 1-norm: %f != %f\n", (double)r[1], (double)norm[0]);
+  // LCOV_EXCL_STOP
+  if (fabs(r[2] - norm[1]) > 1000*CEED_EPSILON)
+    // LCOV_EXCL_START
+    printf("Error in 2-norm: %f != %f\n", (double)r[2], (double)norm[1]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(result, &r);
+
+  // Compare the dot product to the scalar version
+  CeedVectorDotVector(x, y, result);
+  CeedVectorDot(x, y, &dot);
+  CeedVectorGetArrayRead(result, CEED_MEM_HOST, &r);
+  if (fabs(r[0] - dot) > 1000*CEED_EPSILON ||
+      fabs(dot - (-10.)) > 1000*CEED_EPSILON)
+    // LCOV_EXCL_START
+    printf("Error in dot product: %f, %f != %f\n", (double)r[0], (double)dot,
+           -10.);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(result, &r);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&result);
+  CeedDestroy(&ceed);
+  return 0;
+}
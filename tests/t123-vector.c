@@ -0,0 +1,114 @@
+/// @file
+/// Test saving and loading a CeedVector with its strided restriction
+/// \test Test saving and loading a CeedVector with its strided restriction
+#include <ceed.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+// Write a copy of a file with n bytes at position pos replaced by patch
+static void WritePatched(const char *filename, const char *buffer,
+                         size_t nbytes, size_t pos, const void *patch,
+                         size_t n) {
+  char copy[1024];
+  memcpy(copy, buffer, nbytes);
+  memcpy(&copy[pos], patch, n);
+  FILE *file = fopen(filename, "wb");
+  fwrite(copy, 1, nbytes, file);
+  fclose(file);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction r, rinterlaced;
+  CeedVector x, y;
+  const CeedInt nelem = 3, elemsize = 4, ncomp = 2,
+                size = nelem*elemsize*ncomp;
+  CeedInt strides[3] = {1, elemsize, elemsize*ncomp},
+          interlaced[3] = {ncomp, 1, elemsize*ncomp};
+  const CeedScalar *xx, *yy;
+  char filename[64];
+
+  CeedInit(argv[1], &ceed);
+  snprintf(filename, sizeof filename, "t123-vector-%d.bin", (int)getpid());
+
+  CeedElemRestrictionCreateStrided(ceed, nelem, elemsize, ncomp, size, strides,
+                                   &r);
+  CeedElemRestrictionCreateStrided(ceed, nelem, elemsize, ncomp, size,
+                                   interlaced, &rinterlaced);
+  CeedVectorCreate(ceed, size, &x);
+  CeedVectorCreate(ceed, size, &y);
+  CeedScalar a[size];
+  for (CeedInt i=0; i<size; i++)
+    a[i] = 10 + i;
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, a);
+  CeedVectorSave(x, r, filename);
+
+  // Same layout
+  CeedVectorLoad(y, r, filename);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &yy);
+  for (CeedInt i=0; i<size; i++)
+    if (yy[i] != a[i])
+      // LCOV_EXCL_START
+      printf("Error loading vector: y[%d] = %f != %f\n", i, (double)yy[i],
+             (double)a[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(y, &yy);
+
+  // Interlaced components
+  CeedVectorLoad(y, rinterlaced, filename);
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &xx);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &yy);
+  for (CeedInt e=0; e<nelem; e++)
+    for (CeedInt j=0; j<ncomp; j++)
+      for (CeedInt i=0; i<elemsize; i++) {
+        CeedScalar xv = xx[i*strides[0] + j*strides[1] + e*strides[2]],
+                   yv = yy[i*interlaced[0] + j*interlaced[1] + e*interlaced[2]];
+        if (xv != yv)
+          // LCOV_EXCL_START
+          printf("Error permuting node %d component %d element %d: %f != %f\n",
+                 i, j, e, (double)yv, (double)xv);
+        // LCOV_EXCL_STOP
+      }
+  CeedVectorRestoreArrayRead(x, &xx);
+  CeedVectorRestoreArrayRead(y, &yy);
+
+  // Wrong length
+  CeedVector z;
+  CeedVectorCreate(ceed, size + 1, &z);
+  CeedSetErrorHandler(ceed, CeedErrorReturn);
+  if (!CeedVectorLoad(z, NULL, filename))
+    // LCOV_EXCL_START
+    printf("Loaded a vector of the wrong length\n");
+  // LCOV_EXCL_STOP
+
+  // Corrupt headers; the value offset is at byte 24, the strides at byte 48
+  char buffer[1024];
+  FILE *file = fopen(filename, "rb");
+  size_t nbytes = fread(buffer, 1, sizeof buffer, file);
+  fclose(file);
+  int64_t offsets[2] = {(int64_t)1 << 40, 257};
+  for (CeedInt k=0; k<2; k++) {
+    WritePatched(filename, buffer, nbytes, 24, &offsets[k], sizeof offsets[k]);
+    if (!CeedVectorLoad(y, r, filename))
+      // LCOV_EXCL_START
+      printf("Loaded a vector with offset %ld\n", (long)offsets[k]);
+    // LCOV_EXCL_STOP
+  }
+  int32_t badstrides[3] = {-1, elemsize, elemsize*ncomp};
+  WritePatched(filename, buffer, nbytes, 48, badstrides, sizeof badstrides);
+  if (!CeedVectorLoad(y, rinterlaced, filename))
+    // LCOV_EXCL_START
+    printf("Loaded a vector with negative strides\n");
+  // LCOV_EXCL_STOP
+  remove(filename);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&z);
+  CeedElemRestrictionDestroy(&r);
+  CeedElemRestrictionDestroy(&rinterlaced);
+  CeedDestroy(&ceed);
+  return 0;
+}
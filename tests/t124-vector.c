@@ -0,0 +1,49 @@
+/// @file
+/// Test double-buffered snapshots of a CeedVector range
+/// \test Test double-buffered snapshots of a CeedVector range
+#include <ceed.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x, snap[2];
+  CeedRequest request[2] = {NULL, NULL};
+  const CeedInt n = 10, offset = 3, m = 4;
+  const CeedScalar *s;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, n, &x);
+  CeedVectorCreate(ceed, m, &snap[0]);
+  CeedVectorCreate(ceed, m, &snap[1]);
+  CeedScalar a[n];
+  for (CeedInt i=0; i<n; i++)
+    a[i] = 10 + i;
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, a);
+
+  // Take a snapshot, keep updating the vector, and take the next one
+  for (CeedInt k=0; k<3; k++) {
+    CeedVector cur = snap[k%2], prev = snap[(k+1)%2];
+
+    CeedVectorSnapshot(x, offset, cur, &request[k%2]);
+    CeedVectorAXPY(x, 1.0, x);
+    if (k > 0) {
+      CeedRequestWait(&request[(k+1)%2]);
+      CeedVectorGetArrayRead(prev, CEED_MEM_HOST, &s);
+      for (CeedInt i=0; i<m; i++)
+        if (s[i] != (1 << (k-1))*a[offset+i])
+          // LCOV_EXCL_START
+          printf("Error in snapshot %d: s[%d] = %f != %f\n", k-1, i,
+                 (double)s[i], (double)((1 << (k-1))*a[offset+i]));
+      // LCOV_EXCL_STOP
+      CeedVectorRestoreArrayRead(prev, &s);
+    }
+  }
+  CeedRequestWait(&request[0]);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&snap[0]);
+  CeedVectorDestroy(&snap[1]);
+  CeedDestroy(&ceed);
+  return 0;
+}
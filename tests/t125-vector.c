@@ -0,0 +1,79 @@
+/// @file
+/// Test fused updates and dot products of CeedVectors
+/// \test Test fused updates and dot products of CeedVectors
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector p, q, r, dots;
+  const CeedInt n = 1000;
+  CeedScalar a[n], b[n], c[n];
+  const CeedScalar *s;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, n, &p);
+  CeedVectorCreate(ceed, n, &q);
+  CeedVectorCreate(ceed, n, &r);
+  CeedVectorCreate(ceed, 2, &dots);
+  for (CeedInt i=0; i<n; i++) {
+    a[i] = sin(i);
+    b[i] = cos(i);
+    c[i] = 1. / (i + 1);
+  }
+  CeedVectorSetArray(p, CEED_MEM_HOST, CEED_COPY_VALUES, a);
+  CeedVectorSetArray(q, CEED_MEM_HOST, CEED_COPY_VALUES, b);
+  CeedVectorSetArray(r, CEED_MEM_HOST, CEED_COPY_VALUES, c);
+
+  // p = r + 2 p, r = r - q/2, q = p (updated), then r^T r and p^T q
+  CeedVector y[3] = {p, r, q}, x[3] = {r, q, p}, u[2] = {r, p}, v[2] = {r, q};
+  const CeedScalar alpha[3] = {1., -0.5, 1.}, beta[3] = {2., 1., 0.};
+  CeedVectorMultiAXPBYDot(3, y, alpha, beta, x, 2, u, v, dots);
+
+  CeedScalar rr = 0., pq = 0.;
+  for (CeedInt i=0; i<n; i++) {
+    a[i] = c[i] + 2*a[i];
+    c[i] = c[i] - b[i]/2;
+    b[i] = a[i];
+    rr += c[i]*c[i];
+    pq += a[i]*b[i];
+  }
+  CeedVectorGetArrayRead(p, CEED_MEM_HOST, &s);
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(s[i] - a[i]) > 100*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error in p[%d] = %f != %f\n", i, (double)s[i], (double)a[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(p, &s);
+  CeedVectorGetArrayRead(q, CEED_MEM_HOST, &s);
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(s[i] - b[i]) > 100*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error in q[%d] = %f != %f\n", i, (double)s[i], (double)b[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(q, &s);
+  CeedVectorGetArrayRead(r, CEED_MEM_HOST, &s);
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(s[i] - c[i]) > 100*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error in r[%d] = %f != %f\n", i, (double)s[i], (double)c[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(r, &s);
+  CeedVectorGetArrayRead(dots, CEED_MEM_HOST, &s);
+  if (fabs(s[0] - rr) > 1e4*CEED_EPSILON*rr ||
+      fabs(s[1] - pq) > 1e4*CEED_EPSILON*pq)
+    // LCOV_EXCL_START
+    printf("Error in dot products %f, %f != %f, %f\n", (double)s[0],
+           (double)s[1], (double)rr, (double)pq);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(dots, &s);
+
+  CeedVectorDestroy(&p);
+  CeedVectorDestroy(&q);
+  CeedVectorDestroy(&r);
+  CeedVectorDestroy(&dots);
+  CeedDestroy(&ceed);
+  return 0;
+}
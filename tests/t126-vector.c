@@ -0,0 +1,65 @@
+/// @file
+/// Test binding an application array to a CeedVector
+/// \test Test binding an application array to a CeedVector
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x, y;
+  const CeedInt n = 10;
+  CeedScalar a[n], norm;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, n, &x);
+  CeedVectorCreate(ceed, n, &y);
+  CeedVectorSetValue(y, 1.0);
+  CeedVectorBindArray(x, CEED_MEM_HOST, a);
+
+  // Results of libCEED reach the bound array after a sync
+  for (CeedInt pass=0; pass<3; pass++) {
+    for (CeedInt i=0; i<n; i++)
+      a[i] = pass*i;
+    CeedVectorBoundArrayModified(x);
+    CeedVectorAXPY(x, 1.0, y);
+    CeedVectorBoundArraySync(x);
+    for (CeedInt i=0; i<n; i++)
+      if (a[i] != pass*i + 1.0)
+        // LCOV_EXCL_START
+        printf("Pass %d: a[%d] = %f != %f\n", pass, i, (double)a[i],
+               (double)(pass*i + 1.0));
+    // LCOV_EXCL_STOP
+  }
+
+  // Binding the same array again marks it modified
+  for (CeedInt i=0; i<n; i++)
+    a[i] = -2.0*i;
+  CeedVectorBindArray(x, CEED_MEM_HOST, a);
+  CeedVectorNorm(x, CEED_NORM_MAX, &norm);
+  if (fabs(norm - 2.0*(n-1)) > 100*CEED_EPSILON)
+    // LCOV_EXCL_START
+    printf("Max norm %f != %f\n", (double)norm, 2.0*(n-1));
+  // LCOV_EXCL_STOP
+
+  // The array keeps the values of the vector when unbound
+  CeedVectorSetValue(x, 3.0);
+  CeedVectorUnbindArray(x);
+  for (CeedInt i=0; i<n; i++)
+    if (a[i] != 3.0)
+      // LCOV_EXCL_START
+      printf("Unbound a[%d] = %f != 3.0\n", i, (double)a[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorSetValue(x, 0.0);
+  for (CeedInt i=0; i<n; i++)
+    if (a[i] != 3.0)
+      // LCOV_EXCL_START
+      printf("Unbound array modified, a[%d] = %f\n", i, (double)a[i]);
+  // LCOV_EXCL_STOP
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedDestroy(&ceed);
+  return 0;
+}
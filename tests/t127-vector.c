@@ -0,0 +1,74 @@
+/// @file
+/// Test views of ranges of a CeedVector
+/// \test Test views of ranges of a CeedVector
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x, x0, x1, x11, y;
+  const CeedInt n = 10, n0 = 4;
+  CeedScalar a[n], norm, dot;
+  const CeedScalar *b;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, n, &x);
+  for (CeedInt i=0; i<n; i++)
+    a[i] = i;
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, a);
+  CeedVectorCreateView(x, 0, n0, &x0);
+  CeedVectorCreateView(x, n0, n - n0, &x1);
+  CeedVectorCreateView(x1, 2, 3, &x11);
+
+  // Vector algebra on a view, combined with a vector of the backend
+  CeedVectorCreate(ceed, n - n0, &y);
+  CeedVectorSetValue(y, 1.0);
+  CeedVectorAXPY(x1, 2.0, y);
+  CeedVectorAXPY(y, 1.0, x1);
+  CeedVectorDot(y, x1, &dot);
+  CeedScalar expected = 0.;
+  for (CeedInt i=n0; i<n; i++)
+    expected += (i + 3.)*(i + 2.);
+  if (fabs(dot - expected) > 1e6*CEED_EPSILON)
+    // LCOV_EXCL_START
+    printf("Dot %f != %f\n", (double)dot, (double)expected);
+  // LCOV_EXCL_STOP
+
+  // Nested views
+  CeedVectorSetValue(x11, -1.0);
+  CeedVectorNorm(x0, CEED_NORM_MAX, &norm);
+  if (fabs(norm - (n0 - 1.)) > 100*CEED_EPSILON)
+    // LCOV_EXCL_START
+    printf("Max norm of first view %f != %f\n", (double)norm, n0 - 1.);
+  // LCOV_EXCL_STOP
+
+  // The parent holds the values of the views
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++) {
+    const bool nested = i >= n0 + 2 && i < n0 + 5;
+    const CeedScalar v = i < n0 ? i : (nested ? -1. : i + 2.);
+    if (b[i] != v)
+      // LCOV_EXCL_START
+      printf("x[%d] = %f != %f\n", i, (double)b[i], (double)v);
+    // LCOV_EXCL_STOP
+  }
+  CeedVectorRestoreArrayRead(x, &b);
+
+  // Views stay valid after the parent is destroyed by the application
+  CeedVectorDestroy(&x);
+  CeedVectorSetValue(x0, 0.0);
+  CeedVectorNorm(x0, CEED_NORM_1, &norm);
+  if (norm != 0.)
+    // LCOV_EXCL_START
+    printf("Norm of first view %f != 0\n", (double)norm);
+  // LCOV_EXCL_STOP
+
+  CeedVectorDestroy(&x0);
+  CeedVectorDestroy(&x11);
+  CeedVectorDestroy(&x1);
+  CeedVectorDestroy(&y);
+  CeedDestroy(&ceed);
+  return 0;
+}
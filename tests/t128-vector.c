@@ -0,0 +1,67 @@
+/// @file
+/// Test copying and duplicating a CeedVector
+/// \test Test copying and duplicating a CeedVector
+#include <ceed.h>
+#include <stdio.h>
+
+static int CheckValues(CeedVector x, CeedScalar shift, const char *name) {
+  CeedInt n;
+  const CeedScalar *a;
+
+  CeedVectorGetLength(x, &n);
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &a);
+  for (CeedInt i=0; i<n; i++)
+    if (a[i] != 10 + i + shift)
+      // LCOV_EXCL_START
+      printf("%s[%d] = %f != %f\n", name, i, (double)a[i], 10. + i + shift);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(x, &a);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x, y, z, v, ones;
+  const CeedInt n = 10;
+  CeedScalar a[n], b[n];
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, n, &x);
+  for (CeedInt i=0; i<n; i++)
+    a[i] = 10 + i;
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, a);
+
+  // Copy into the array of the application
+  CeedVectorCreate(ceed, n, &y);
+  CeedVectorSetArray(y, CEED_MEM_HOST, CEED_USE_POINTER, b);
+  CeedVectorCopy(x, y);
+  CeedVectorSyncArray(y, CEED_MEM_HOST);
+  for (CeedInt i=0; i<n; i++)
+    if (b[i] != a[i])
+      // LCOV_EXCL_START
+      printf("b[%d] = %f != %f\n", i, (double)b[i], (double)a[i]);
+  // LCOV_EXCL_STOP
+
+  // Copies are independent of the original
+  CeedVectorDuplicate(x, &z);
+  CeedVectorCreate(ceed, n, &ones);
+  CeedVectorSetValue(ones, 1.0);
+  CeedVectorAXPY(x, 1.0, ones);
+  CheckValues(z, 0.0, "Duplicate");
+  CheckValues(x, 1.0, "Original");
+
+  // Copy from a view
+  CeedVectorCreateView(x, 0, n, &v);
+  CeedVectorCopy(v, z);
+  CheckValues(z, 1.0, "Copy of view");
+
+  CeedVectorTakeArray(y, CEED_MEM_HOST, NULL);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&z);
+  CeedVectorDestroy(&ones);
+  CeedDestroy(&ceed);
+  return 0;
+}
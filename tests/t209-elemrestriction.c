@@ -1,6 +1,6 @@
 /// @file
-/// Test calculation of dof multiplicity in element restriction
-/// \test Test calculation of dof multiplicity in element restriction
+/// Test calculation and caching of dof multiplicity in element restriction
+/// \test Test calculation and caching of dof multiplicity in element restriction
 #include <ceed.h>
 
 int main(int argc, char **argv) {
@@ -25,15 +25,20 @@ int main(int argc, char **argv) {
   CeedElemRestrictionCreate(ceed, ne, 4, 1, 1, 3*ne+1, CEED_MEM_HOST,
                             CEED_USE_POINTER, ind, &r);
 
-  CeedElemRestrictionGetMultiplicity(r, mult);
+  // The second call returns the cached multiplicity
+  for (CeedInt k=0; k<2; k++) {
+    CeedVectorSetValue(mult, -1);
+    CeedElemRestrictionGetMultiplicity(r, mult);
 
-  CeedVectorGetArrayRead(mult, CEED_MEM_HOST, &mm);
-  for (CeedInt i=0; i<3*ne+1; i++)
-    if ((1 + (i > 0 && i < 3*ne && (i%3==0) ? 1 : 0)) != mm[i])
-      // LCOV_EXCL_START
-      printf("Error in multiplicity vector: mult[%d] = %f\n", i, (double)mm[i]);
-  // LCOV_EXCL_STOP
-  CeedVectorRestoreArrayRead(mult, &mm);
+    CeedVectorGetArrayRead(mult, CEED_MEM_HOST, &mm);
+    for (CeedInt i=0; i<3*ne+1; i++)
+      if ((1 + (i > 0 && i < 3*ne && (i%3==0) ? 1 : 0)) != mm[i])
+        // LCOV_EXCL_START
+        printf("Error in multiplicity vector: mult[%d] = %f\n", i,
+               (double)mm[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(mult, &mm);
+  }
 
   CeedVectorDestroy(&mult);
   CeedElemRestrictionDestroy(&r);
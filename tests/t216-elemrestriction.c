@@ -0,0 +1,106 @@
+/// @file
+/// Test compressed element restriction against the expanded offsets
+/// \test Test compressed element restriction against the expanded offsets
+#include <ceed.h>
+#include <math.h>
+
+static int CompareVectors(CeedVector x, CeedVector y, const char *name) {
+  CeedInt n;
+  const CeedScalar *a, *b;
+
+  CeedVectorGetLength(x, &n);
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &a);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(a[i] - b[i]) > 100*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error in %s: [%d] %f != %f\n", name, i, (double)a[i],
+             (double)b[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(x, &a);
+  CeedVectorRestoreArrayRead(y, &b);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  const CeedInt nx = 3, ny = 2, P = 3, ncomp = 2, blksize = 4;
+  const CeedInt ne = nx*ny, Nx = nx*(P-1)+1, Ny = ny*(P-1)+1;
+  const CeedInt nnodes = Nx*Ny;
+  CeedInt ind[ne*P*P], eoffsets[ne], stencil[P*P];
+  CeedScalar x[ncomp*nnodes];
+  CeedVector X, Y, Z, Ye, Ze;
+  CeedElemRestriction r, rc, rb, rbc;
+
+  CeedInit(argv[1], &ceed);
+
+  // Structured 2D mesh of biquadratic elements
+  for (CeedInt j=0; j<P; j++)
+    for (CeedInt i=0; i<P; i++)
+      stencil[i+j*P] = i + j*Nx;
+  for (CeedInt ey=0; ey<ny; ey++)
+    for (CeedInt ex=0; ex<nx; ex++) {
+      const CeedInt e = ex + ey*nx;
+      eoffsets[e] = ex*(P-1) + ey*(P-1)*Nx;
+      for (CeedInt k=0; k<P*P; k++)
+        ind[e*P*P+k] = eoffsets[e] + stencil[k];
+    }
+  CeedElemRestrictionCreate(ceed, ne, P*P, ncomp, nnodes, ncomp*nnodes,
+                            CEED_MEM_HOST, CEED_USE_POINTER, ind, &r);
+  CeedElemRestrictionCreateCompressed(ceed, ne, P*P, ncomp, nnodes,
+                                      ncomp*nnodes, eoffsets, stencil, &rc);
+
+  CeedVectorCreate(ceed, ncomp*nnodes, &X);
+  for (CeedInt i=0; i<ncomp*nnodes; i++)
+    x[i] = 10 + i;
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedElemRestrictionCreateVector(r, &Y, &Ye);
+  CeedElemRestrictionCreateVector(rc, &Z, &Ze);
+
+  // L-vector to E-vector and back
+  CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, X, Ye, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(rc, CEED_NOTRANSPOSE, X, Ze, CEED_REQUEST_IMMEDIATE);
+  CompareVectors(Ye, Ze, "restriction");
+  CeedVectorSetValue(Y, 0.0);
+  CeedVectorSetValue(Z, 0.0);
+  CeedElemRestrictionApply(r, CEED_TRANSPOSE, Ye, Y, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(rc, CEED_TRANSPOSE, Ze, Z, CEED_REQUEST_IMMEDIATE);
+  CompareVectors(Y, Z, "transpose restriction");
+
+  // Blocked restrictions
+  CeedVectorDestroy(&Ye);
+  CeedVectorDestroy(&Ze);
+  CeedElemRestrictionCreateBlocked(ceed, ne, P*P, blksize, ncomp, nnodes,
+                                   ncomp*nnodes, CEED_MEM_HOST,
+                                   CEED_USE_POINTER, ind, &rb);
+  CeedElemRestrictionCreateBlockedCompressed(ceed, ne, P*P, blksize, ncomp,
+      nnodes, ncomp*nnodes, eoffsets, stencil, &rbc);
+  CeedElemRestrictionCreateVector(rb, NULL, &Ye);
+  CeedElemRestrictionCreateVector(rbc, NULL, &Ze);
+  CeedElemRestrictionApply(rb, CEED_NOTRANSPOSE, X, Ye, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(rbc, CEED_NOTRANSPOSE, X, Ze,
+                           CEED_REQUEST_IMMEDIATE);
+  CompareVectors(Ye, Ze, "blocked restriction");
+  CeedVectorSetValue(Y, 0.0);
+  CeedVectorSetValue(Z, 0.0);
+  CeedElemRestrictionApply(rb, CEED_TRANSPOSE, Ye, Y, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(rbc, CEED_TRANSPOSE, Ze, Z, CEED_REQUEST_IMMEDIATE);
+  CompareVectors(Y, Z, "blocked transpose restriction");
+
+  // Multiplicity uses the expanded offsets
+  CeedElemRestrictionGetMultiplicity(r, Y);
+  CeedElemRestrictionGetMultiplicity(rc, Z);
+  CompareVectors(Y, Z, "multiplicity");
+
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&Y);
+  CeedVectorDestroy(&Z);
+  CeedVectorDestroy(&Ye);
+  CeedVectorDestroy(&Ze);
+  CeedElemRestrictionDestroy(&r);
+  CeedElemRestrictionDestroy(&rc);
+  CeedElemRestrictionDestroy(&rb);
+  CeedElemRestrictionDestroy(&rbc);
+  CeedDestroy(&ceed);
+  return 0;
+}
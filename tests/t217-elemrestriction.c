@@ -0,0 +1,81 @@
+/// @file
+/// Test element restriction view with a different number of components
+/// \test Test element restriction view with a different number of components
+#include <ceed.h>
+#include <math.h>
+
+static int CompareVectors(CeedVector x, CeedVector y, const char *name) {
+  CeedInt n;
+  const CeedScalar *a, *b;
+
+  CeedVectorGetLength(x, &n);
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &a);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(a[i] - b[i]) > 100*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error in %s: [%d] %f != %f\n", name, i, (double)a[i],
+             (double)b[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(x, &a);
+  CeedVectorRestoreArrayRead(y, &b);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  const CeedInt ne = 5, P = 3, ncomp = 3, nnodes = ne*(P-1)+1;
+  CeedInt ind[ne*P];
+  CeedScalar x[ncomp*nnodes];
+  CeedVector X, Y, Z, Ye, Ze;
+  CeedElemRestriction r, rs, rv;
+  size_t bytes;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt e=0; e<ne; e++)
+    for (CeedInt k=0; k<P; k++)
+      ind[e*P+k] = e*(P-1) + k;
+  CeedElemRestrictionCreate(ceed, ne, P, ncomp, nnodes, ncomp*nnodes,
+                            CEED_MEM_HOST, CEED_USE_POINTER, ind, &r);
+  CeedElemRestrictionCreate(ceed, ne, P, 1, 1, nnodes, CEED_MEM_HOST,
+                            CEED_COPY_VALUES, ind, &rs);
+  CeedElemRestrictionCreateView(rs, ncomp, nnodes, ncomp*nnodes, &rv);
+
+  // The view stores no offsets of its own
+  CeedElemRestrictionGetMemoryUsage(rv, CEED_MEMSPACE_HOST, &bytes);
+  if (bytes)
+    // LCOV_EXCL_START
+    printf("View allocated %zu bytes of host memory\n", bytes);
+  // LCOV_EXCL_STOP
+
+  // The scalar restriction may be destroyed before its view
+  CeedElemRestrictionDestroy(&rs);
+
+  CeedVectorCreate(ceed, ncomp*nnodes, &X);
+  for (CeedInt i=0; i<ncomp*nnodes; i++)
+    x[i] = 10 + i;
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedElemRestrictionCreateVector(r, &Y, &Ye);
+  CeedElemRestrictionCreateVector(rv, &Z, &Ze);
+
+  // L-vector to E-vector and back
+  CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, X, Ye, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(rv, CEED_NOTRANSPOSE, X, Ze, CEED_REQUEST_IMMEDIATE);
+  CompareVectors(Ye, Ze, "restriction");
+  CeedVectorSetValue(Y, 0.0);
+  CeedVectorSetValue(Z, 0.0);
+  CeedElemRestrictionApply(r, CEED_TRANSPOSE, Ye, Y, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(rv, CEED_TRANSPOSE, Ze, Z, CEED_REQUEST_IMMEDIATE);
+  CompareVectors(Y, Z, "transpose restriction");
+
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&Y);
+  CeedVectorDestroy(&Z);
+  CeedVectorDestroy(&Ye);
+  CeedVectorDestroy(&Ze);
+  CeedElemRestrictionDestroy(&r);
+  CeedElemRestrictionDestroy(&rv);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,83 @@
+/// @file
+/// Test element restriction with 16-bit offsets
+/// \test Test element restriction with 16-bit offsets
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+static int CompareVectors(CeedVector x, CeedVector y, const char *name) {
+  CeedInt n;
+  const CeedScalar *a, *b;
+
+  CeedVectorGetLength(x, &n);
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &a);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(a[i] - b[i]) > 100*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error in %s: [%d] %f != %f\n", name, i, (double)a[i],
+             (double)b[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(x, &a);
+  CeedVectorRestoreArrayRead(y, &b);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  const CeedInt ne = 6, P = 3, ncomp = 2, nnodes = ne*(P-1)+1;
+  CeedInt ind[ne*P], far[2] = {0, 69999};
+  CeedScalar x[ncomp*nnodes];
+  CeedVector X, Y, Z, Ye, Ze;
+  CeedElemRestriction r, r16, rfar;
+
+  CeedInit(argv[1], &ceed);
+
+  // Elements in reverse order, so block bases are not the first offset
+  for (CeedInt e=0; e<ne; e++)
+    for (CeedInt k=0; k<P; k++)
+      ind[e*P+k] = (ne-1-e)*(P-1) + k;
+  CeedElemRestrictionCreate(ceed, ne, P, ncomp, nnodes, ncomp*nnodes,
+                            CEED_MEM_HOST, CEED_USE_POINTER, ind, &r);
+  CeedElemRestrictionCreate(ceed, ne, P, ncomp, nnodes, ncomp*nnodes,
+                            CEED_MEM_HOST, CEED_USE_POINTER, ind, &r16);
+  CeedElemRestrictionSetIndexType(r16, CEED_INDEX_INT16);
+
+  CeedVectorCreate(ceed, ncomp*nnodes, &X);
+  for (CeedInt i=0; i<ncomp*nnodes; i++)
+    x[i] = 10 + i;
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedElemRestrictionCreateVector(r, &Y, &Ye);
+  CeedElemRestrictionCreateVector(r16, &Z, &Ze);
+
+  // L-vector to E-vector and back
+  CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, X, Ye, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(r16, CEED_NOTRANSPOSE, X, Ze,
+                           CEED_REQUEST_IMMEDIATE);
+  CompareVectors(Ye, Ze, "restriction");
+  CeedVectorSetValue(Y, 0.0);
+  CeedVectorSetValue(Z, 0.0);
+  CeedElemRestrictionApply(r, CEED_TRANSPOSE, Ye, Y, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(r16, CEED_TRANSPOSE, Ze, Z, CEED_REQUEST_IMMEDIATE);
+  CompareVectors(Y, Z, "transpose restriction");
+
+  // An element spanning more nodes than 16-bit offsets reach is rejected
+  CeedSetErrorHandler(ceed, CeedErrorReturn);
+  CeedElemRestrictionCreate(ceed, 1, 2, 1, 1, 70000, CEED_MEM_HOST,
+                            CEED_USE_POINTER, far, &rfar);
+  if (!CeedElemRestrictionSetIndexType(rfar, CEED_INDEX_INT16))
+    // LCOV_EXCL_START
+    printf("16-bit offsets accepted for a span of %d nodes\n", far[1]);
+  // LCOV_EXCL_STOP
+
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&Y);
+  CeedVectorDestroy(&Z);
+  CeedVectorDestroy(&Ye);
+  CeedVectorDestroy(&Ze);
+  CeedElemRestrictionDestroy(&r);
+  CeedElemRestrictionDestroy(&r16);
+  CeedElemRestrictionDestroy(&rfar);
+  CeedDestroy(&ceed);
+  return 0;
+}
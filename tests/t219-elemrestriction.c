@@ -0,0 +1,85 @@
+/// @file
+/// Test batch creation of element restrictions sharing one offsets array
+/// \test Test batch creation of element restrictions sharing one offsets array
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+static int CompareVectors(CeedVector x, CeedVector y, const char *name) {
+  CeedInt n;
+  const CeedScalar *a, *b;
+
+  CeedVectorGetLength(x, &n);
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &a);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(a[i] - b[i]) > 100*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error in %s: [%d] %f != %f\n", name, i, (double)a[i],
+             (double)b[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(x, &a);
+  CeedVectorRestoreArrayRead(y, &b);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  const CeedInt nrstr = 2, ne[2] = {3, 4}, P[2] = {2, 3}, ncomp = 2;
+  const CeedInt nnodes = 12;
+  CeedInt ind[3*2 + 4*3], start = 0;
+  CeedScalar x[ncomp*nnodes];
+  CeedVector X, Y, Z, Ye, Ze;
+  CeedElemRestriction r, rb[2];
+
+  CeedInit(argv[1], &ceed);
+
+  // Two restrictions with different element sizes in one offsets array
+  for (CeedInt k=0; k<nrstr; k++)
+    for (CeedInt e=0; e<ne[k]; e++)
+      for (CeedInt j=0; j<P[k]; j++)
+        ind[start++] = (k*5 + e*(P[k]-1) + j) % nnodes;
+  CeedElemRestrictionCreateBatch(ceed, nrstr, ne, P, ncomp, nnodes,
+                                 ncomp*nnodes, CEED_MEM_HOST,
+                                 CEED_COPY_VALUES, ind, rb);
+
+  CeedVectorCreate(ceed, ncomp*nnodes, &X);
+  for (CeedInt i=0; i<ncomp*nnodes; i++)
+    x[i] = 10 + i;
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+
+  // Each restriction of the batch matches one created on its own
+  start = 0;
+  for (CeedInt k=0; k<nrstr; k++) {
+    CeedElemRestrictionCreate(ceed, ne[k], P[k], ncomp, nnodes, ncomp*nnodes,
+                              CEED_MEM_HOST, CEED_USE_POINTER, &ind[start],
+                              &r);
+    start += ne[k]*P[k];
+    CeedElemRestrictionCreateVector(r, &Y, &Ye);
+    CeedElemRestrictionCreateVector(rb[k], &Z, &Ze);
+
+    CeedElemRestrictionApply(r, CEED_NOTRANSPOSE, X, Ye,
+                             CEED_REQUEST_IMMEDIATE);
+    CeedElemRestrictionApply(rb[k], CEED_NOTRANSPOSE, X, Ze,
+                             CEED_REQUEST_IMMEDIATE);
+    CompareVectors(Ye, Ze, "restriction");
+    CeedVectorSetValue(Y, 0.0);
+    CeedVectorSetValue(Z, 0.0);
+    CeedElemRestrictionApply(r, CEED_TRANSPOSE, Ye, Y, CEED_REQUEST_IMMEDIATE);
+    CeedElemRestrictionApply(rb[k], CEED_TRANSPOSE, Ze, Z,
+                             CEED_REQUEST_IMMEDIATE);
+    CompareVectors(Y, Z, "transpose restriction");
+
+    CeedVectorDestroy(&Y);
+    CeedVectorDestroy(&Z);
+    CeedVectorDestroy(&Ye);
+    CeedVectorDestroy(&Ze);
+    CeedElemRestrictionDestroy(&r);
+    // The shared offsets outlive the first restriction of the batch
+    CeedElemRestrictionDestroy(&rb[k]);
+  }
+
+  CeedVectorDestroy(&X);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,81 @@
+/// @file
+/// Test eigenpairs of Symmetric Schur Decomposition
+/// \test Test eigenpairs of Symmetric Schur Decomposition
+#include <ceed.h>
+#include <math.h>
+
+// Check A Q = Q diag(lambda) for the columns of Q
+static int CheckEigenpairs(const CeedScalar *A, const CeedScalar *Q,
+                           const CeedScalar *lambda, CeedInt n,
+                           const char *name) {
+  for (CeedInt k=0; k<n; k++)
+    for (CeedInt i=0; i<n; i++) {
+      CeedScalar AQ = 0;
+      for (CeedInt j=0; j<n; j++)
+        AQ += A[i*n+j]*Q[j*n+k];
+      if (fabs(AQ - lambda[k]*Q[i*n+k]) > 1e6*CEED_EPSILON)
+        // LCOV_EXCL_START
+        printf("%s: eigenpair %d, row %d: %f != %f\n", name, k, i, AQ,
+               lambda[k]*Q[i*n+k]);
+      // LCOV_EXCL_STOP
+    }
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  // Without symmetry in its entries, the last Householder reflection changes
+  //   the sign of the last sub diagonal entry of the tridiagonal reduction
+  const CeedScalar A[16] = {4.0, 1.0, 2.0, 0.5,
+                            1.0, 3.0, 0.0, 1.0,
+                            2.0, 0.0, 2.0, 1.0,
+                            0.5, 1.0, 1.0, 1.0
+                           };
+  // Lanczos coefficients of CeedOperatorEstimateEigenvalues for Poisson
+  //   operators without boundary conditions; the sub diagonal entries of their
+  //   tridiagonal matrices become negligible only relative to the diagonal,
+  //   and small nonzero bulges must still be chased
+  const CeedScalar alpha[2][10] = {
+    { 2.10062, 10.8599, 3.79747, 1.94364, 3.17996, 2.16664, 2.388, 6.26308,
+      3.89387, 3.41752
+    },
+    { 3.04789105, 7.34849350, 21.3401350, 7.98580846, 9.31880599, 13.5465735,
+      3.36792291, 9.25670490, 11.8037608, 16.8001742
+    }
+  };
+  const CeedScalar beta[2][10] = {
+    { 0.923305, 10.6019, 2.07443, 1.41633, 2.03348, 0.942703, 2.18092,
+      5.57501, 3.17162, 2.59482
+    },
+    { 2.27111332, 7.33773629, 19.3421838, 4.66825981, 8.21584115, 7.18430603,
+      2.09529277, 7.18071765, 10.3869063, 15.9734264
+    }
+  };
+  CeedScalar Q[100], T[100], lambda[10];
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<16; i++)
+    Q[i] = A[i];
+  CeedSymmetricSchurDecomposition(ceed, Q, lambda, 4);
+  CheckEigenpairs(A, Q, lambda, 4, "dense");
+
+  for (CeedInt k=0; k<2; k++) {
+    const CeedInt n = 10;
+    for (CeedInt i=0; i<n*n; i++)
+      T[i] = 0;
+    for (CeedInt i=0; i<n; i++) {
+      T[i*n+i] = 1. / alpha[k][i] +
+                 (i > 0 ? beta[k][i-1] / alpha[k][i-1] : 0);
+      if (i < n-1)
+        T[i*n+i+1] = T[(i+1)*n+i] = sqrt(beta[k][i]) / alpha[k][i];
+    }
+    for (CeedInt i=0; i<n*n; i++)
+      Q[i] = T[i];
+    CeedSymmetricSchurDecomposition(ceed, Q, lambda, n);
+    CheckEigenpairs(T, Q, lambda, n, "Lanczos");
+  }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
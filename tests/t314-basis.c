@@ -71,7 +71,7 @@ int main(int argc, char **argv) {
       sum2 += uq[i];
     CeedVectorRestoreArrayRead(Gtposeones, &gtposeones);
     CeedVectorRestoreArrayRead(Uq, &uq);
-    if (fabs(sum1 - sum2) > 1E-10)
+    if (fabs(sum1 - sum2) > 1e6*CEED_EPSILON)
       // LCOV_EXCL_START
       printf("[%d] %f != %f\n", dim, sum1, sum2);
     // LCOV_EXCL_STOP
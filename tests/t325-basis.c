@@ -45,7 +45,7 @@ int main(int argc, char **argv) {
   CeedVectorGetArrayRead(Out, CEED_MEM_HOST, &out);
   for (int p=0; p<P; p++)
     for (int n=0; n<ncomp; n++)
-      if (fabs(n*colsum[p] - out[p+n*P]) > 1E-14)
+      if (fabs(n*colsum[p] - out[p+n*P]) > 100*CEED_EPSILON)
         // LCOV_EXCL_START
         printf("[%d] %f != %f\n", p, out[p+n*P], n*colsum[p]);
   // LCOV_EXCL_STOP
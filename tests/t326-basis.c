@@ -0,0 +1,139 @@
+/// @file
+/// Test interpolation, gradient, and transposes of simplex H1 bases with collapsed coordinate structure
+/// \test Test interpolation, gradient, and transposes of simplex H1 bases with collapsed coordinate structure
+#include <ceed.h>
+#include <math.h>
+
+static CeedScalar Eval(CeedInt dim, const CeedScalar *x, CeedScalar *df) {
+  CeedScalar z = dim > 2 ? x[2] : 0;
+  df[0] = 1 - 2*x[1] + 3*x[0]*x[0];
+  df[1] = -2*x[0] + z*z;
+  if (dim > 2) df[2] = 2*x[1]*z;
+  return 1 + x[0] - 2*x[0]*x[1] + x[0]*x[0]*x[0] + x[1]*z*z;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  const CeedElemTopology topos[2] = {CEED_TRIANGLE, CEED_TET};
+  const CeedScalar volume[2] = {1./2, 1./6};
+  const CeedInt P = 6, Q = 6, ncomp = 2;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt t=0; t<2; t++) {
+    CeedBasis b;
+    CeedVector U, Uq, Gq, W, Uqt, Ut, Gt;
+    CeedInt dim = t + 2, nnodes, nqpts;
+    const CeedScalar *qref, *qweight, *uq, *gq, *ut, *gt;
+    CeedScalar *u, *w, sum = 0, dot1 = 0, dot2 = 0, dotg1 = 0, dotg2 = 0;
+
+    CeedBasisCreateH1Simplex(ceed, topos[t], ncomp, P, Q, &b);
+    CeedBasisGetNumNodes(b, &nnodes);
+    CeedBasisGetNumQuadraturePoints(b, &nqpts);
+    CeedBasisGetQRef(b, &qref);
+    CeedBasisGetQWeights(b, &qweight);
+
+    for (CeedInt q=0; q<nqpts; q++)
+      sum += qweight[q];
+    if (fabs(sum - volume[t]) > 100*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Topology %d: volume %f != %f\n", t, sum, volume[t]);
+    // LCOV_EXCL_STOP
+
+    // Nodal values on the equispaced lattice, last index fastest
+    CeedVectorCreate(ceed, ncomp*nnodes, &U);
+    CeedVectorGetArray(U, CEED_MEM_HOST, &u);
+    for (CeedInt i=0, n=0; i<P; i++)
+      for (CeedInt j=0; j<P-i; j++)
+        for (CeedInt k=0; k<(dim > 2 ? P-i-j : 1); k++, n++) {
+          CeedScalar x[3] = {(CeedScalar)i/(P-1), (CeedScalar)j/(P-1),
+                             (CeedScalar)k/(P-1)
+                            }, df[3];
+          for (CeedInt c=0; c<ncomp; c++)
+            u[c*nnodes+n] = (c+1)*Eval(dim, x, df);
+        }
+    CeedVectorRestoreArray(U, &u);
+
+    CeedVectorCreate(ceed, ncomp*nqpts, &Uq);
+    CeedVectorCreate(ceed, dim*ncomp*nqpts, &Gq);
+    CeedBasisApply(b, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, U, Uq);
+    CeedBasisApply(b, 1, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, U, Gq);
+
+    // Values and gradients at quadrature points
+    CeedVectorGetArrayRead(Uq, CEED_MEM_HOST, &uq);
+    CeedVectorGetArrayRead(Gq, CEED_MEM_HOST, &gq);
+    for (CeedInt q=0; q<nqpts; q++) {
+      CeedScalar x[3], df[3], f;
+      for (CeedInt d=0; d<dim; d++)
+        x[d] = qref[d*nqpts+q];
+      f = Eval(dim, x, df);
+      for (CeedInt c=0; c<ncomp; c++) {
+        if (fabs(uq[c*nqpts+q] - (c+1)*f) > 1e4*CEED_EPSILON)
+          // LCOV_EXCL_START
+          printf("Topology %d: interp [%d, %d] %f != %f\n", t, c, q,
+                 uq[c*nqpts+q], (c+1)*f);
+        // LCOV_EXCL_STOP
+        for (CeedInt d=0; d<dim; d++)
+          if (fabs(gq[(d*ncomp+c)*nqpts+q] - (c+1)*df[d]) > 1e5*CEED_EPSILON)
+            // LCOV_EXCL_START
+            printf("Topology %d: grad [%d, %d, %d] %f != %f\n", t, d, c, q,
+                   gq[(d*ncomp+c)*nqpts+q], (c+1)*df[d]);
+        // LCOV_EXCL_STOP
+      }
+    }
+
+    // Transposes satisfy (B u, w) = (u, B^T w)
+    CeedVectorCreate(ceed, dim*ncomp*nqpts, &W);
+    CeedVectorGetArray(W, CEED_MEM_HOST, &w);
+    for (CeedInt i=0; i<dim*ncomp*nqpts; i++)
+      w[i] = sin(i + 1.);
+    CeedVectorRestoreArray(W, &w);
+    CeedVectorCreate(ceed, ncomp*nnodes, &Ut);
+    CeedVectorCreate(ceed, ncomp*nnodes, &Gt);
+    CeedVectorCreate(ceed, ncomp*nqpts, &Uqt);
+    CeedVectorGetArrayRead(W, CEED_MEM_HOST, (const CeedScalar **)&w);
+    CeedVectorSetArray(Uqt, CEED_MEM_HOST, CEED_COPY_VALUES, w);
+    CeedVectorRestoreArrayRead(W, (const CeedScalar **)&w);
+    CeedBasisApply(b, 1, CEED_TRANSPOSE, CEED_EVAL_INTERP, Uqt, Ut);
+    CeedBasisApply(b, 1, CEED_TRANSPOSE, CEED_EVAL_GRAD, W, Gt);
+
+    CeedVectorGetArrayRead(U, CEED_MEM_HOST, (const CeedScalar **)&u);
+    CeedVectorGetArrayRead(W, CEED_MEM_HOST, (const CeedScalar **)&w);
+    CeedVectorGetArrayRead(Ut, CEED_MEM_HOST, &ut);
+    CeedVectorGetArrayRead(Gt, CEED_MEM_HOST, &gt);
+    for (CeedInt i=0; i<ncomp*nqpts; i++)
+      dot1 += uq[i]*w[i];
+    for (CeedInt i=0; i<dim*ncomp*nqpts; i++)
+      dotg1 += gq[i]*w[i];
+    for (CeedInt i=0; i<ncomp*nnodes; i++) {
+      dot2 += u[i]*ut[i];
+      dotg2 += u[i]*gt[i];
+    }
+    if (fabs(dot1 - dot2) > 1e5*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Topology %d: interp transpose %f != %f\n", t, dot2, dot1);
+    // LCOV_EXCL_STOP
+    if (fabs(dotg1 - dotg2) > 1e6*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Topology %d: grad transpose %f != %f\n", t, dotg2, dotg1);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(U, (const CeedScalar **)&u);
+    CeedVectorRestoreArrayRead(W, (const CeedScalar **)&w);
+    CeedVectorRestoreArrayRead(Ut, &ut);
+    CeedVectorRestoreArrayRead(Gt, &gt);
+    CeedVectorRestoreArrayRead(Uq, &uq);
+    CeedVectorRestoreArrayRead(Gq, &gq);
+
+    CeedVectorDestroy(&U);
+    CeedVectorDestroy(&Uq);
+    CeedVectorDestroy(&Gq);
+    CeedVectorDestroy(&W);
+    CeedVectorDestroy(&Uqt);
+    CeedVectorDestroy(&Ut);
+    CeedVectorDestroy(&Gt);
+    CeedBasisDestroy(&b);
+  }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,45 @@
+/// @file
+/// Test sharing of identical H1Lagrange bases
+/// \test Test sharing of identical H1Lagrange bases
+#include <ceed.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedBasis b[4];
+
+  CeedInit(argv[1], &ceed);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 2, 1, 3, 4, CEED_GAUSS, &b[0]);
+  CeedBasisCreateTensorH1Lagrange(ceed, 2, 1, 3, 4, CEED_GAUSS, &b[1]);
+  CeedBasisCreateTensorH1Lagrange(ceed, 2, 1, 3, 4, CEED_GAUSS_LOBATTO, &b[2]);
+  CeedBasisCreateTensorH1Lagrange(ceed, 2, 2, 3, 4, CEED_GAUSS, &b[3]);
+
+  if (b[0] != b[1])
+    // LCOV_EXCL_START
+    printf("Identical bases are not shared\n");
+  // LCOV_EXCL_STOP
+  if (b[2] == b[0] || b[3] == b[0])
+    // LCOV_EXCL_START
+    printf("Different bases are shared\n");
+  // LCOV_EXCL_STOP
+
+  // The shared basis stays valid until its last reference is destroyed
+  CeedBasisDestroy(&b[0]);
+  CeedInt Q;
+  CeedBasisGetNumQuadraturePoints(b[1], &Q);
+  if (Q != 16)
+    // LCOV_EXCL_START
+    printf("Shared basis has %d quadrature points != 16\n", Q);
+  // LCOV_EXCL_STOP
+  CeedBasisDestroy(&b[1]);
+
+  // A basis created after the last reference was released is new
+  CeedBasisCreateTensorH1Lagrange(ceed, 2, 1, 3, 4, CEED_GAUSS, &b[0]);
+  CeedBasisDestroy(&b[0]);
+
+  CeedBasisDestroy(&b[2]);
+  CeedBasisDestroy(&b[3]);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,118 @@
+/// @file
+/// Test setting registered fields of a qfunction context between applies
+/// \test Test setting registered fields of a qfunction context between applies
+#include <ceed.h>
+#include <stddef.h>
+#include <math.h>
+
+#include "t403-qfunction.h"
+
+static int CheckValues(CeedVector V, const CeedScalar *v, CeedScalar scale,
+                       CeedInt Q) {
+  const CeedScalar *vv;
+
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &vv);
+  for (CeedInt i=0; i<Q; i++)
+    if (fabs(scale * v[i] - vv[i]) > 1e4*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("[%d] v %f != vv %f\n", i, (double)(scale * v[i]),
+             (double)vv[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &vv);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector in[16], out[16];
+  CeedVector Qdata, W, U, V;
+  CeedQFunction qf_setup, qf_mass;
+  CeedQFunctionContext ctx;
+  CeedInt Q = 8;
+  CeedScalar w[Q], u[Q], v[Q];
+  MassContext ctxData = {.time = 1., .step = 0, .scale = {2., 3.}};
+
+  CeedInit(argv[1], &ceed);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "w", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddOutput(qf_setup, "qdata", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "qdata", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedQFunctionContextCreate(ceed, &ctx);
+  CeedQFunctionContextSetData(ctx, CEED_MEM_HOST, CEED_COPY_VALUES,
+                              sizeof(ctxData), &ctxData);
+  CeedQFunctionContextRegisterDouble(ctx, "time",
+                                     offsetof(MassContext, time), 1,
+                                     "current time");
+  CeedQFunctionContextRegisterInt32(ctx, "step",
+                                    offsetof(MassContext, step), 1,
+                                    "time step number");
+  CeedQFunctionContextRegisterDouble(ctx, "scale",
+                                     offsetof(MassContext, scale), 2, NULL);
+  CeedQFunctionSetContext(qf_mass, ctx);
+
+  for (CeedInt i=0; i<Q; i++) {
+    CeedScalar x = 2.*i/(Q-1) - 1;
+    w[i] = 1 - x*x;
+    u[i] = 2 + 3*x + 5*x*x;
+    v[i] = w[i] * u[i];
+  }
+
+  CeedVectorCreate(ceed, Q, &W);
+  CeedVectorSetArray(W, CEED_MEM_HOST, CEED_USE_POINTER, w);
+  CeedVectorCreate(ceed, Q, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedVectorCreate(ceed, Q, &V);
+  CeedVectorSetValue(V, 0);
+  CeedVectorCreate(ceed, Q, &Qdata);
+  CeedVectorSetValue(Qdata, 0);
+
+  in[0] = W;
+  out[0] = Qdata;
+  CeedQFunctionApply(qf_setup, Q, in, out);
+
+  in[0] = W;
+  in[1] = U;
+  out[0] = V;
+  CeedQFunctionApply(qf_mass, Q, in, out);
+  CheckValues(V, v, 6., Q);
+
+  // Update single fields between applies
+  const double time = 2.5, scale[2] = {1., 4.};
+  const int step = 3;
+  CeedQFunctionContextSetDouble(ctx, "time", &time);
+  CeedQFunctionContextSetInt32(ctx, "step", &step);
+  CeedQFunctionApply(qf_mass, Q, in, out);
+  CheckValues(V, v, 6.*5.5, Q);
+
+  CeedQFunctionContextSetDouble(ctx, "scale", scale);
+  CeedQFunctionApply(qf_mass, Q, in, out);
+  CheckValues(V, v, 4.*5.5, Q);
+
+  // Host data reflects the updates
+  const MassContext *data;
+  CeedQFunctionContextGetData(ctx, CEED_MEM_HOST, &data);
+  if (data->time != time || data->step != step || data->scale[0] != scale[0] ||
+      data->scale[1] != scale[1])
+    // LCOV_EXCL_START
+    printf("Context data not updated: %f %d %f %f\n", data->time, data->step,
+           data->scale[0], data->scale[1]);
+  // LCOV_EXCL_STOP
+  CeedQFunctionContextRestoreData(ctx, &data);
+  CeedQFunctionContextView(ctx, stdout);
+
+  CeedVectorDestroy(&W);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&Qdata);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedQFunctionContextDestroy(&ctx);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,45 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+typedef struct {
+  double time;
+  int step;
+  double scale[2];
+} MassContext;
+
+CEED_QFUNCTION(setup)(void *ctx, const CeedInt Q,
+                      const CeedScalar *const *in,
+                      CeedScalar *const *out) {
+  const CeedScalar *w = in[0];
+  CeedScalar *qdata = out[0];
+  for (CeedInt i=0; i<Q; i++) {
+    qdata[i] = w[i];
+  }
+  return 0;
+}
+
+CEED_QFUNCTION(mass)(void *ctx, const CeedInt Q, const CeedScalar *const *in,
+                     CeedScalar *const *out) {
+  MassContext *context = (MassContext *)ctx;
+  const CeedScalar *qdata = in[0], *u = in[1];
+  CeedScalar *v = out[0];
+  const CeedScalar scale = context->scale[0] * context->scale[1] *
+                           (context->time + context->step);
+  for (CeedInt i=0; i<Q; i++) {
+    v[i] = scale * qdata[i] * u[i];
+  }
+  return 0;
+}
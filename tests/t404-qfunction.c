@@ -0,0 +1,74 @@
+/// @file
+/// Test creation, evaluation, and destruction for qfunction with embedded source
+/// \test Test creation, evaluation, and destruction for qfunction with embedded source
+#include <ceed.h>
+
+// Compile the QFunction and keep its source as a string for JIT backends
+#define EMBED_QFUNCTION(...) \
+  __VA_ARGS__ static const char source_code[] = #__VA_ARGS__;
+
+EMBED_QFUNCTION(
+  CEED_QFUNCTION(scale)(void *ctx, const CeedInt Q,
+                        const CeedScalar *const *in, CeedScalar *const *out) {
+  const CeedScalar *w = in[0], *u = in[1];
+  CeedScalar *v = out[0];
+  for (CeedInt i=0; i<Q; i++) {
+    v[i] = w[i] * u[i];
+  }
+  return 0;
+}
+)
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector in[16], out[16];
+  CeedVector W, U, V;
+  CeedQFunction qf;
+  CeedInt Q = 8;
+  const CeedScalar *vv;
+  CeedScalar w[Q], u[Q], v[Q];
+
+  CeedInit(argv[1], &ceed);
+
+  CeedQFunctionCreateInteriorWithSource(ceed, 1, scale, scale_loc, source_code,
+                                        &qf);
+  CeedQFunctionAddInput(qf, "w", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf, "v", 1, CEED_EVAL_INTERP);
+
+  for (CeedInt i=0; i<Q; i++) {
+    CeedScalar x = 2.*i/(Q-1) - 1;
+    w[i] = 1 - x*x;
+    u[i] = 2 + 3*x + 5*x*x;
+    v[i] = w[i] * u[i];
+  }
+
+  CeedVectorCreate(ceed, Q, &W);
+  CeedVectorSetArray(W, CEED_MEM_HOST, CEED_USE_POINTER, w);
+  CeedVectorCreate(ceed, Q, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedVectorCreate(ceed, Q, &V);
+  CeedVectorSetValue(V, 0);
+
+  {
+    in[0] = W;
+    in[1] = U;
+    out[0] = V;
+    CeedQFunctionApply(qf, Q, in, out);
+  }
+
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &vv);
+  for (CeedInt i=0; i<Q; i++)
+    if (v[i] != vv[i])
+      // LCOV_EXCL_START
+      printf("[%d] v %f != vv %f\n",i, v[i], vv[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &vv);
+
+  CeedVectorDestroy(&W);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedQFunctionDestroy(&qf);
+  CeedDestroy(&ceed);
+  return 0;
+}
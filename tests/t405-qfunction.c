@@ -0,0 +1,57 @@
+/// @file
+/// Test evaluation of a qfunction defined by a chunk kernel
+/// \test Test evaluation of a qfunction defined by a chunk kernel
+#include <ceed.h>
+
+#include "t405-qfunction.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector in[16], out[16];
+  CeedVector W, U, V;
+  CeedQFunction qf;
+  // One full chunk and a partial one
+  CeedInt Q = CEED_CHUNK_WIDTH + 5;
+  const CeedScalar *vv;
+  CeedScalar w[Q], u[2*Q];
+
+  CeedInit(argv[1], &ceed);
+
+  CeedQFunctionCreateInterior(ceed, 1, scale, scale_loc, &qf);
+  CeedQFunctionAddInput(qf, "w", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf, "u", 2, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf, "v", 2, CEED_EVAL_INTERP);
+
+  for (CeedInt i=0; i<Q; i++) {
+    w[i] = 1 + i;
+    u[i] = 3 - i;
+    u[Q+i] = 2*i;
+  }
+  CeedVectorCreate(ceed, Q, &W);
+  CeedVectorSetArray(W, CEED_MEM_HOST, CEED_USE_POINTER, w);
+  CeedVectorCreate(ceed, 2*Q, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedVectorCreate(ceed, 2*Q, &V);
+  CeedVectorSetValue(V, 0);
+
+  in[0] = W;
+  in[1] = U;
+  out[0] = V;
+  CeedQFunctionApply(qf, Q, in, out);
+
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &vv);
+  for (CeedInt c=0; c<2; c++)
+    for (CeedInt i=0; i<Q; i++)
+      if (vv[c*Q+i] != w[i]*u[c*Q+i])
+        // LCOV_EXCL_START
+        printf("[%d, %d] v %f != %f\n", c, i, vv[c*Q+i], w[i]*u[c*Q+i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &vv);
+
+  CeedVectorDestroy(&W);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedQFunctionDestroy(&qf);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -33,7 +33,7 @@ int main(int argc, char **argv) {
 
   CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
   for (CeedInt i=0; i<Q; i++)
-    if (fabs(v[i] - u[i])>1e-14)
+    if (fabs(v[i] - u[i])>100*CEED_EPSILON)
       // LCOV_EXCL_START
       printf("[%d] v %f != u %f\n",i, v[i], u[i]);
   // LCOV_EXCL_STOP
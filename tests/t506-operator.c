@@ -135,8 +135,10 @@ int main(int argc, char **argv) {
     sum1 += hv[2*i];
     sum2 += hv[2*i+1];
   }
-  if (fabs(sum1-1.)>1e-10) printf("Computed Area: %f != True Area: 1.0\n", sum1);
-  if (fabs(sum2-2.)>1e-10) printf("Computed Area: %f != True Area: 2.0\n", sum2);
+  if (fabs(sum1-1.)>1e6*CEED_EPSILON)
+    printf("Computed Area: %f != True Area: 1.0\n", sum1);
+  if (fabs(sum2-2.)>1e6*CEED_EPSILON)
+    printf("Computed Area: %f != True Area: 2.0\n", sum2);
   CeedVectorRestoreArrayRead(V, &hv);
 
   // 'Large' operator
@@ -149,8 +151,10 @@ int main(int argc, char **argv) {
     sum1 += hv[2*i];
     sum2 += hv[2*i+1];
   }
-  if (fabs(sum1-1.)>1e-10) printf("Computed Area: %f != True Area: 1.0\n", sum1);
-  if (fabs(sum2-2.)>1e-10) printf("Computed Area: %f != True Area: 2.0\n", sum2);
+  if (fabs(sum1-1.)>1e6*CEED_EPSILON)
+    printf("Computed Area: %f != True Area: 1.0\n", sum1);
+  if (fabs(sum2-2.)>1e6*CEED_EPSILON)
+    printf("Computed Area: %f != True Area: 2.0\n", sum2);
   CeedVectorRestoreArrayRead(V, &hv);
 
   CeedQFunctionDestroy(&qf_setup);
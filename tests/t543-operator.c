@@ -0,0 +1,127 @@
+/// @file
+/// Test mass matrix operator application with reordered elements
+/// \test Test mass matrix operator application with reordered elements
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t500-operator.h"
+
+static int CompareVectors(CeedVector x, CeedVector y, const char *name) {
+  CeedInt n;
+  const CeedScalar *a, *b;
+
+  CeedVectorGetLength(x, &n);
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &a);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(a[i] - b[i]) > 100*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error in %s: [%d] %g != %g\n", name, i, a[i], b[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(x, &a);
+  CeedVectorRestoreArrayRead(y, &b);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup[2], op_mass[2];
+  CeedVector qdata[2], X, U, V[2];
+  CeedInt nelem = 15, P = 5, Q = 8;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P];
+  CeedScalar x[Nx];
+
+  CeedInit(argv[1], &ceed);
+
+  // Elements numbered out of mesh order
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    CeedInt e = (7*i) % nelem;
+    indx[2*i+0] = e;
+    indx[2*i+1] = e+1;
+    for (CeedInt j=0; j<P; j++)
+      indu[P*i+j] = e*(P-1) + j;
+  }
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+  CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, Nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, Nu, &U);
+  CeedVectorSetValue(U, 1.0);
+
+  // Natural and reverse Cuthill-McKee element orderings
+  for (CeedInt k=0; k<2; k++) {
+    CeedVectorCreate(ceed, nelem*Q, &qdata[k]);
+    CeedVectorCreate(ceed, Nu, &V[k]);
+
+    CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_setup[k]);
+    CeedOperatorSetField(op_setup[k], "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                         CEED_VECTOR_NONE);
+    CeedOperatorSetField(op_setup[k], "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_setup[k], "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                         CEED_VECTOR_ACTIVE);
+
+    CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_mass[k]);
+    CeedOperatorSetField(op_mass[k], "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                         qdata[k]);
+    CeedOperatorSetField(op_mass[k], "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_mass[k], "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+    if (k == 1) {
+      CeedOperatorSetElementOrdering(op_setup[k], CEED_ORDERING_RCM);
+      CeedOperatorSetElementOrdering(op_mass[k], CEED_ORDERING_RCM);
+    }
+
+    CeedOperatorApply(op_setup[k], X, qdata[k], CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApply(op_mass[k], U, V[k], CEED_REQUEST_IMMEDIATE);
+  }
+
+  // Quadrature data keeps its layout and the result is unchanged
+  CompareVectors(qdata[0], qdata[1], "quadrature data");
+  CompareVectors(V[0], V[1], "mass operator");
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  for (CeedInt k=0; k<2; k++) {
+    CeedOperatorDestroy(&op_setup[k]);
+    CeedOperatorDestroy(&op_mass[k]);
+    CeedVectorDestroy(&qdata[k]);
+    CeedVectorDestroy(&V[k]);
+  }
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,138 @@
+/// @file
+/// Test mass matrix operator with quadrature data built on demand
+/// \test Test mass matrix operator with quadrature data built on demand
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t500-operator.h"
+
+static int CheckSum(CeedVector v, CeedScalar expected, const char *name) {
+  CeedInt n;
+  const CeedScalar *hv;
+  CeedScalar sum = 0.;
+
+  CeedVectorGetLength(v, &n);
+  CeedVectorGetArrayRead(v, CEED_MEM_HOST, &hv);
+  for (CeedInt i=0; i<n; i++)
+    sum += hv[i];
+  if (fabs(sum - expected) > 1000*CEED_EPSILON)
+    // LCOV_EXCL_START
+    printf("Error in %s: computed area %f != %f\n", name, (double)sum,
+           (double)expected);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(v, &hv);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass;
+  CeedVector qdata, X, U, V;
+  CeedInt nelem = 15, P = 5, Q = 8;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P];
+  CeedScalar x[Nx], *hx;
+  uint64_t state, prevstate;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+    for (CeedInt j=0; j<P; j++)
+      indu[P*i+j] = i*(P-1) + j;
+  }
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+  CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, Nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+  CeedVectorCreate(ceed, Nu, &U);
+  CeedVectorSetValue(U, 1.0);
+  CeedVectorCreate(ceed, Nu, &V);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+  CeedOperatorSetField(op_mass, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_mass, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetFieldBuilder(op_mass, "rho", op_setup, X);
+
+  // First apply builds the quadrature data
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+  CheckSum(V, 1.0, "first apply");
+  CeedVectorGetState(qdata, &prevstate);
+
+  // Unchanged coordinates do not rebuild
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+  CheckSum(V, 1.0, "second apply");
+  CeedVectorGetState(qdata, &state);
+  if (state != prevstate)
+    // LCOV_EXCL_START
+    printf("Quadrature data rebuilt for unchanged coordinates\n");
+  // LCOV_EXCL_STOP
+
+  // Modified coordinates rebuild
+  CeedVectorGetArray(X, CEED_MEM_HOST, &hx);
+  for (CeedInt i=0; i<Nx; i++)
+    hx[i] *= 2;
+  CeedVectorRestoreArray(X, &hx);
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+  CheckSum(V, 2.0, "apply after coordinate update");
+  CeedVectorGetState(qdata, &state);
+  if (state == prevstate)
+    // LCOV_EXCL_START
+    printf("Quadrature data not rebuilt for modified coordinates\n");
+  // LCOV_EXCL_STOP
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&qdata);
+  CeedDestroy(&ceed);
+  return 0;
+}
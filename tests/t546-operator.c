@@ -0,0 +1,187 @@
+/// @file
+/// Test gallery 3D mass and diffusion operators with fused geometric factors
+/// \test Test gallery 3D mass and diffusion operators with fused geometric factors
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+static int CompareVectors(CeedVector x, CeedVector y, const char *name) {
+  CeedInt n;
+  const CeedScalar *a, *b;
+
+  CeedVectorGetLength(x, &n);
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &a);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(a[i] - b[i]) > 1e4*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error in %s: [%d] %f != %f\n", name, i, (double)a[i],
+             (double)b[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(x, &a);
+  CeedVectorRestoreArrayRead(y, &b);
+  return 0;
+}
+
+// Offsets for a structured mesh of hexahedra with P nodes in each direction
+static void BuildOffsets(CeedInt ne1d, CeedInt P, CeedInt *ind) {
+  const CeedInt N = ne1d*(P-1)+1;
+
+  for (CeedInt e=0; e<ne1d*ne1d*ne1d; e++) {
+    const CeedInt ex = e % ne1d, ey = (e / ne1d) % ne1d, ez = e / (ne1d*ne1d);
+    for (CeedInt k=0; k<P; k++)
+      for (CeedInt j=0; j<P; j++)
+        for (CeedInt i=0; i<P; i++)
+          ind[e*P*P*P + i + P*(j + P*k)] = (ex*(P-1) + i) +
+                                           N*((ey*(P-1) + j) + N*(ez*(P-1) + k));
+  }
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictqm, Erestrictqp;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup_mass, qf_mass, qf_mass_fused,
+                qf_setup_diff, qf_diff, qf_diff_fused;
+  CeedOperator op_setup_mass, op_mass, op_mass_fused,
+               op_setup_diff, op_diff, op_diff_fused;
+  CeedVector qdata_mass, qdata_diff, X, U, V, Vfused;
+  const CeedInt dim = 3, ne1d = 2, nelem = ne1d*ne1d*ne1d, P = 3, Q = 4;
+  const CeedInt Nx = ne1d+1, Nu = ne1d*(P-1)+1;
+  const CeedInt nx = Nx*Nx*Nx, nu = Nu*Nu*Nu, nq = nelem*Q*Q*Q;
+  CeedInt indx[nelem*8], indu[nelem*P*P*P];
+  CeedScalar x[dim*nx], u[nu];
+
+  CeedInit(argv[1], &ceed);
+
+  // Non-affine mesh coordinates
+  for (CeedInt k=0; k<Nx; k++)
+    for (CeedInt j=0; j<Nx; j++)
+      for (CeedInt i=0; i<Nx; i++) {
+        const CeedInt n = i + Nx*(j + Nx*k);
+        const CeedScalar X0 = (CeedScalar)i / ne1d, X1 = (CeedScalar)j / ne1d,
+                         X2 = (CeedScalar)k / ne1d;
+        x[n+0*nx] = X0 + 0.1*X1*X2;
+        x[n+1*nx] = X1 + 0.2*X0*X2;
+        x[n+2*nx] = X2 + 0.1*X0*X1;
+      }
+  for (CeedInt i=0; i<nu; i++)
+    u[i] = sin(i);
+  CeedVectorCreate(ceed, dim*nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nu, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedVectorCreate(ceed, nu, &V);
+  CeedVectorCreate(ceed, nu, &Vfused);
+  CeedVectorCreate(ceed, nq, &qdata_mass);
+  CeedVectorCreate(ceed, nq*dim*(dim+1)/2, &qdata_diff);
+
+  // Restrictions
+  BuildOffsets(ne1d, 2, indx);
+  CeedElemRestrictionCreate(ceed, nelem, 8, dim, nx, dim*nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+  BuildOffsets(ne1d, P, indu);
+  CeedElemRestrictionCreate(ceed, nelem, P*P*P, 1, 1, nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+  CeedInt stridesqm[3] = {1, Q*Q*Q, Q*Q*Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q*Q*Q, 1, nq, stridesqm,
+                                   &Erestrictqm);
+  CeedInt stridesqp[3] = {1, Q*Q*Q, Q*Q*Q*dim*(dim+1)/2};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q*Q*Q, dim*(dim+1)/2,
+                                   nq*dim*(dim+1)/2, stridesqp, &Erestrictqp);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, P, Q, CEED_GAUSS, &bu);
+
+  // Mass operator with stored quadrature data
+  CeedQFunctionCreateInteriorByName(ceed, "Mass3DBuild", &qf_setup_mass);
+  CeedQFunctionCreateInteriorByName(ceed, "MassApply", &qf_mass);
+  CeedOperatorCreate(ceed, qf_setup_mass, CEED_QFUNCTION_NONE,
+                     CEED_QFUNCTION_NONE, &op_setup_mass);
+  CeedOperatorSetField(op_setup_mass, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup_mass, "weights", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup_mass, "qdata", Erestrictqm,
+                       CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+  CeedOperatorSetField(op_mass, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "qdata", Erestrictqm, CEED_BASIS_COLLOCATED,
+                       qdata_mass);
+  CeedOperatorSetField(op_mass, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  // Mass operator with geometric factors computed from coordinates
+  CeedQFunctionCreateInteriorByName(ceed, "Mass3DFused", &qf_mass_fused);
+  CeedOperatorCreate(ceed, qf_mass_fused, CEED_QFUNCTION_NONE,
+                     CEED_QFUNCTION_NONE, &op_mass_fused);
+  CeedOperatorSetField(op_mass_fused, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_fused, "dx", Erestrictx, bx, X);
+  CeedOperatorSetField(op_mass_fused, "weights", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_mass_fused, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup_mass, X, qdata_mass, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_mass_fused, U, Vfused, CEED_REQUEST_IMMEDIATE);
+  CompareVectors(V, Vfused, "mass operator");
+
+  // Diffusion operator with stored quadrature data
+  CeedQFunctionCreateInteriorByName(ceed, "Poisson3DBuild", &qf_setup_diff);
+  CeedQFunctionCreateInteriorByName(ceed, "Poisson3DApply", &qf_diff);
+  CeedOperatorCreate(ceed, qf_setup_diff, CEED_QFUNCTION_NONE,
+                     CEED_QFUNCTION_NONE, &op_setup_diff);
+  CeedOperatorSetField(op_setup_diff, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup_diff, "weights", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup_diff, "qdata", Erestrictqp,
+                       CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+  CeedOperatorCreate(ceed, qf_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_diff);
+  CeedOperatorSetField(op_diff, "du", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_diff, "qdata", Erestrictqp, CEED_BASIS_COLLOCATED,
+                       qdata_diff);
+  CeedOperatorSetField(op_diff, "dv", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  // Diffusion operator with geometric factors computed from coordinates
+  CeedQFunctionCreateInteriorByName(ceed, "Poisson3DFused", &qf_diff_fused);
+  CeedOperatorCreate(ceed, qf_diff_fused, CEED_QFUNCTION_NONE,
+                     CEED_QFUNCTION_NONE, &op_diff_fused);
+  CeedOperatorSetField(op_diff_fused, "du", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_diff_fused, "dx", Erestrictx, bx, X);
+  CeedOperatorSetField(op_diff_fused, "weights", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_diff_fused, "dv", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup_diff, X, qdata_diff, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_diff, U, V, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_diff_fused, U, Vfused, CEED_REQUEST_IMMEDIATE);
+  CompareVectors(V, Vfused, "diffusion operator");
+
+  CeedQFunctionDestroy(&qf_setup_mass);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedQFunctionDestroy(&qf_mass_fused);
+  CeedQFunctionDestroy(&qf_setup_diff);
+  CeedQFunctionDestroy(&qf_diff);
+  CeedQFunctionDestroy(&qf_diff_fused);
+  CeedOperatorDestroy(&op_setup_mass);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_mass_fused);
+  CeedOperatorDestroy(&op_setup_diff);
+  CeedOperatorDestroy(&op_diff);
+  CeedOperatorDestroy(&op_diff_fused);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictqm);
+  CeedElemRestrictionDestroy(&Erestrictqp);
+  CeedBasisDestroy(&bx);
+  CeedBasisDestroy(&bu);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&Vfused);
+  CeedVectorDestroy(&qdata_mass);
+  CeedVectorDestroy(&qdata_diff);
+  CeedDestroy(&ceed);
+  return 0;
+}
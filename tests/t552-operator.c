@@ -124,7 +124,7 @@ int main(int argc, char **argv) {
   for (CeedInt i=0; i<ncomp*NuCoarse; i++) {
     sum += hv[i];
   }
-  if (fabs(sum-2.)>1e-10)
+  if (fabs(sum-2.)>1e6*CEED_EPSILON)
     // LCOV_EXCL_START
     printf("Computed Area Coarse Grid: %f != True Area: 1.0\n", sum);
   // LCOV_EXCL_STOP
@@ -144,7 +144,7 @@ int main(int argc, char **argv) {
   for (CeedInt i=0; i<ncomp*NuFine; i++) {
     sum += hv[i];
   }
-  if (fabs(sum-2.)>1e-10)
+  if (fabs(sum-2.)>1e6*CEED_EPSILON)
     // LCOV_EXCL_START
     printf("Computed Area Fine Grid: %f != True Area: 1.0\n", sum);
   // LCOV_EXCL_STOP
@@ -159,7 +159,7 @@ int main(int argc, char **argv) {
   for (CeedInt i=0; i<ncomp*NuCoarse; i++) {
     sum += hv[i];
   }
-  if (fabs(sum-2.)>1e-10)
+  if (fabs(sum-2.)>1e6*CEED_EPSILON)
     // LCOV_EXCL_START
     printf("Computed Area Coarse Grid: %f != True Area: 1.0\n", sum);
   // LCOV_EXCL_STOP
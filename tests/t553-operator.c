@@ -112,7 +112,7 @@ int main(int argc, char **argv) {
   for (CeedInt i=0; i<NuCoarse; i++) {
     sum += hv[i];
   }
-  if (fabs(sum-1.)>1e-10)
+  if (fabs(sum-1.)>1e6*CEED_EPSILON)
     // LCOV_EXCL_START
     printf("Computed Area Coarse Grid: %f != True Area: 1.0\n", sum);
   // LCOV_EXCL_STOP
@@ -132,7 +132,7 @@ int main(int argc, char **argv) {
   for (CeedInt i=0; i<NuFine; i++) {
     sum += hv[i];
   }
-  if (fabs(sum-1.)>1e-10)
+  if (fabs(sum-1.)>1e6*CEED_EPSILON)
     // LCOV_EXCL_START
     printf("Computed Area Fine Grid: %f != True Area: 1.0\n", sum);
   // LCOV_EXCL_STOP
@@ -147,7 +147,7 @@ int main(int argc, char **argv) {
   for (CeedInt i=0; i<NuCoarse; i++) {
     sum += hv[i];
   }
-  if (fabs(sum-1.)>1e-10)
+  if (fabs(sum-1.)>1e6*CEED_EPSILON)
     // LCOV_EXCL_START
     printf("Computed Area Coarse Grid: %f != True Area: 1.0\n", sum);
   // LCOV_EXCL_STOP
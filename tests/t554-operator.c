@@ -0,0 +1,135 @@
+/// @file
+/// Test mass matrix operator application over subsets of the elements
+/// \test Test mass matrix operator application over subsets of the elements
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass, op_even, op_odd, op_first, op_last;
+  CeedVector qdata, X, U, V, Vsub;
+  CeedInt nelem = 15, P = 5, Q = 8;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P], even[nelem], odd[nelem],
+          neven = 0, nodd = 0;
+  CeedScalar x[Nx], *u;
+  const CeedScalar *v, *vsub;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+    for (CeedInt j=0; j<P; j++)
+      indu[P*i+j] = i*(P-1) + j;
+    if (i % 2)
+      odd[nodd++] = i;
+    else
+      even[neven++] = i;
+  }
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+  CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, Nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_mass, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  // Subsets share the quadrature data of op_mass
+  CeedOperatorCreateSubset(op_mass, neven, even, &op_even);
+  CeedOperatorCreateSubset(op_mass, nodd, odd, &op_odd);
+  CeedOperatorCreateSubsetRange(op_mass, 0, 6, &op_first);
+  CeedOperatorCreateSubsetRange(op_mass, 6, nelem, &op_last);
+
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  CeedVectorCreate(ceed, Nu, &U);
+  CeedVectorGetArray(U, CEED_MEM_HOST, &u);
+  for (CeedInt i=0; i<Nu; i++)
+    u[i] = 1. + sin(i);
+  CeedVectorRestoreArray(U, &u);
+  CeedVectorCreate(ceed, Nu, &V);
+  CeedVectorCreate(ceed, Nu, &Vsub);
+
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+  for (CeedInt k=0; k<2; k++) {
+    CeedVectorSetValue(Vsub, 0.0);
+    CeedOperatorApplyAdd(k ? op_first : op_even, U, Vsub,
+                         CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApplyAdd(k ? op_last : op_odd, U, Vsub,
+                         CEED_REQUEST_IMMEDIATE);
+
+    // Check output
+    CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+    CeedVectorGetArrayRead(Vsub, CEED_MEM_HOST, &vsub);
+    for (CeedInt i=0; i<Nu; i++)
+      if (fabs(v[i] - vsub[i]) > 100*CEED_EPSILON)
+        // LCOV_EXCL_START
+        printf("Error in %s subsets: [%d] %g != %g\n", k ? "range" : "list",
+               i, vsub[i], v[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(V, &v);
+    CeedVectorRestoreArrayRead(Vsub, &vsub);
+  }
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_even);
+  CeedOperatorDestroy(&op_odd);
+  CeedOperatorDestroy(&op_first);
+  CeedOperatorDestroy(&op_last);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&Vsub);
+  CeedVectorDestroy(&qdata);
+  CeedDestroy(&ceed);
+  return 0;
+}
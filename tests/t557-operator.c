@@ -0,0 +1,258 @@
+/// @file
+/// Test gallery 3D Helmholtz, anisotropic diffusion, and vector diffusion operators
+/// \test Test gallery 3D Helmholtz, anisotropic diffusion, and vector diffusion operators
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+static int CompareVectors(CeedVector x, CeedInt offset, CeedVector y,
+                          CeedScalar scale, const char *name) {
+  CeedInt n;
+  const CeedScalar *a, *b;
+
+  CeedVectorGetLength(y, &n);
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &a);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(a[offset+i] - scale*b[i]) > 1e4*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error in %s: [%d] %f != %f\n", name, i, (double)a[offset+i],
+             (double)(scale*b[i]));
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(x, &a);
+  CeedVectorRestoreArrayRead(y, &b);
+  return 0;
+}
+
+// Offsets for a structured mesh of hexahedra with P nodes in each direction
+static void BuildOffsets(CeedInt ne1d, CeedInt P, CeedInt *ind) {
+  const CeedInt N = ne1d*(P-1)+1;
+
+  for (CeedInt e=0; e<ne1d*ne1d*ne1d; e++) {
+    const CeedInt ex = e % ne1d, ey = (e / ne1d) % ne1d, ez = e / (ne1d*ne1d);
+    for (CeedInt k=0; k<P; k++)
+      for (CeedInt j=0; j<P; j++)
+        for (CeedInt i=0; i<P; i++)
+          ind[e*P*P*P + i + P*(j + P*k)] = (ex*(P-1) + i) +
+                                           N*((ey*(P-1) + j) + N*(ez*(P-1) + k));
+  }
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictu3, Erestrictqm,
+                      Erestrictqp, Erestrictqh;
+  CeedBasis bx, bu, bu3;
+  CeedQFunction qf_setup_mass, qf_mass, qf_setup_diff, qf_diff,
+                qf_setup_helm, qf_helm, qf_setup_aniso, qf_diff3;
+  CeedQFunctionContext ctx;
+  CeedOperator op_setup_mass, op_mass, op_setup_diff, op_diff,
+               op_setup_helm, op_helm, op_setup_aniso, op_aniso, op_diff3;
+  CeedVector qdata_mass, qdata_diff, qdata_helm, qdata_aniso, X, U, U3, V, W,
+             W3;
+  const CeedInt dim = 3, ne1d = 2, nelem = ne1d*ne1d*ne1d, P = 3, Q = 4;
+  const CeedInt Nx = ne1d+1, Nu = ne1d*(P-1)+1;
+  const CeedInt nx = Nx*Nx*Nx, nu = Nu*Nu*Nu, nq = nelem*Q*Q*Q;
+  CeedInt indx[nelem*8], indu[nelem*P*P*P];
+  CeedScalar x[dim*nx], u[nu], u3[3*nu];
+  CeedScalar kappa[6] = {2., 2., 2., 0., 0., 0.};
+
+  CeedInit(argv[1], &ceed);
+
+  // Non-affine mesh coordinates
+  for (CeedInt k=0; k<Nx; k++)
+    for (CeedInt j=0; j<Nx; j++)
+      for (CeedInt i=0; i<Nx; i++) {
+        const CeedInt n = i + Nx*(j + Nx*k);
+        const CeedScalar X0 = (CeedScalar)i / ne1d, X1 = (CeedScalar)j / ne1d,
+                         X2 = (CeedScalar)k / ne1d;
+        x[n+0*nx] = X0 + 0.1*X1*X2;
+        x[n+1*nx] = X1 + 0.2*X0*X2;
+        x[n+2*nx] = X2 + 0.1*X0*X1;
+      }
+  for (CeedInt i=0; i<nu; i++)
+    u[i] = sin(i);
+  CeedVectorCreate(ceed, dim*nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nu, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  for (CeedInt c=0; c<3; c++)
+    for (CeedInt i=0; i<nu; i++)
+      u3[i+c*nu] = u[i];
+  CeedVectorCreate(ceed, 3*nu, &U3);
+  CeedVectorSetArray(U3, CEED_MEM_HOST, CEED_USE_POINTER, u3);
+  CeedVectorCreate(ceed, nu, &V);
+  CeedVectorCreate(ceed, nu, &W);
+  CeedVectorCreate(ceed, 3*nu, &W3);
+  CeedVectorCreate(ceed, nq, &qdata_mass);
+  CeedVectorCreate(ceed, nq*dim*(dim+1)/2, &qdata_diff);
+  CeedVectorCreate(ceed, nq*(dim*(dim+1)/2+1), &qdata_helm);
+  CeedVectorCreate(ceed, nq*dim*(dim+1)/2, &qdata_aniso);
+
+  // Restrictions
+  BuildOffsets(ne1d, 2, indx);
+  CeedElemRestrictionCreate(ceed, nelem, 8, dim, nx, dim*nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+  BuildOffsets(ne1d, P, indu);
+  CeedElemRestrictionCreate(ceed, nelem, P*P*P, 1, 1, nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+  CeedElemRestrictionCreate(ceed, nelem, P*P*P, 3, nu, 3*nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu3);
+  CeedInt stridesqm[3] = {1, Q*Q*Q, Q*Q*Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q*Q*Q, 1, nq, stridesqm,
+                                   &Erestrictqm);
+  CeedInt stridesqp[3] = {1, Q*Q*Q, Q*Q*Q*dim*(dim+1)/2};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q*Q*Q, dim*(dim+1)/2,
+                                   nq*dim*(dim+1)/2, stridesqp, &Erestrictqp);
+  CeedInt stridesqh[3] = {1, Q*Q*Q, Q*Q*Q*(dim*(dim+1)/2+1)};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q*Q*Q, dim*(dim+1)/2+1,
+                                   nq*(dim*(dim+1)/2+1), stridesqh,
+                                   &Erestrictqh);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, P, Q, CEED_GAUSS, &bu);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 3, P, Q, CEED_GAUSS, &bu3);
+
+  // Mass operator
+  CeedQFunctionCreateInteriorByName(ceed, "Mass3DBuild", &qf_setup_mass);
+  CeedQFunctionCreateInteriorByName(ceed, "MassApply", &qf_mass);
+  CeedOperatorCreate(ceed, qf_setup_mass, CEED_QFUNCTION_NONE,
+                     CEED_QFUNCTION_NONE, &op_setup_mass);
+  CeedOperatorSetField(op_setup_mass, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup_mass, "weights", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup_mass, "qdata", Erestrictqm,
+                       CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+  CeedOperatorSetField(op_mass, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "qdata", Erestrictqm, CEED_BASIS_COLLOCATED,
+                       qdata_mass);
+  CeedOperatorSetField(op_mass, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  // Diffusion operator
+  CeedQFunctionCreateInteriorByName(ceed, "Poisson3DBuild", &qf_setup_diff);
+  CeedQFunctionCreateInteriorByName(ceed, "Poisson3DApply", &qf_diff);
+  CeedOperatorCreate(ceed, qf_setup_diff, CEED_QFUNCTION_NONE,
+                     CEED_QFUNCTION_NONE, &op_setup_diff);
+  CeedOperatorSetField(op_setup_diff, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup_diff, "weights", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup_diff, "qdata", Erestrictqp,
+                       CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+  CeedOperatorCreate(ceed, qf_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_diff);
+  CeedOperatorSetField(op_diff, "du", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_diff, "qdata", Erestrictqp, CEED_BASIS_COLLOCATED,
+                       qdata_diff);
+  CeedOperatorSetField(op_diff, "dv", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup_mass, X, qdata_mass, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_setup_diff, X, qdata_diff, CEED_REQUEST_IMMEDIATE);
+
+  // Helmholtz operator, mass plus diffusion
+  CeedQFunctionCreateInteriorByName(ceed, "Helmholtz3DBuild", &qf_setup_helm);
+  CeedQFunctionCreateInteriorByName(ceed, "Helmholtz3DApply", &qf_helm);
+  CeedOperatorCreate(ceed, qf_setup_helm, CEED_QFUNCTION_NONE,
+                     CEED_QFUNCTION_NONE, &op_setup_helm);
+  CeedOperatorSetField(op_setup_helm, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup_helm, "weights", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup_helm, "qdata", Erestrictqh,
+                       CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+  CeedOperatorCreate(ceed, qf_helm, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_helm);
+  CeedOperatorSetField(op_helm, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_helm, "du", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_helm, "qdata", Erestrictqh, CEED_BASIS_COLLOCATED,
+                       qdata_helm);
+  CeedOperatorSetField(op_helm, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_helm, "dv", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup_helm, X, qdata_helm, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApplyAdd(op_diff, U, V, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_helm, U, W, CEED_REQUEST_IMMEDIATE);
+  CompareVectors(W, 0, V, 1., "Helmholtz operator");
+
+  // Anisotropic diffusion operator with twice the identity
+  CeedQFunctionCreateInteriorByName(ceed, "AnisotropicPoisson3DBuild",
+                                    &qf_setup_aniso);
+  CeedQFunctionContextCreate(ceed, &ctx);
+  CeedQFunctionContextSetData(ctx, CEED_MEM_HOST, CEED_USE_POINTER,
+                              sizeof(kappa), &kappa);
+  CeedQFunctionSetContext(qf_setup_aniso, ctx);
+  CeedOperatorCreate(ceed, qf_setup_aniso, CEED_QFUNCTION_NONE,
+                     CEED_QFUNCTION_NONE, &op_setup_aniso);
+  CeedOperatorSetField(op_setup_aniso, "dx", Erestrictx, bx,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup_aniso, "weights", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup_aniso, "qdata", Erestrictqp,
+                       CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+  CeedOperatorCreate(ceed, qf_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_aniso);
+  CeedOperatorSetField(op_aniso, "du", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_aniso, "qdata", Erestrictqp, CEED_BASIS_COLLOCATED,
+                       qdata_aniso);
+  CeedOperatorSetField(op_aniso, "dv", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup_aniso, X, qdata_aniso, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_diff, U, V, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_aniso, U, W, CEED_REQUEST_IMMEDIATE);
+  CompareVectors(W, 0, V, 2., "anisotropic diffusion operator");
+
+  // Vector diffusion operator, each component matches the scalar operator
+  CeedQFunctionCreateInteriorByName(ceed, "Vector3Poisson3DApply", &qf_diff3);
+  CeedOperatorCreate(ceed, qf_diff3, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_diff3);
+  CeedOperatorSetField(op_diff3, "du", Erestrictu3, bu3, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_diff3, "qdata", Erestrictqp, CEED_BASIS_COLLOCATED,
+                       qdata_diff);
+  CeedOperatorSetField(op_diff3, "dv", Erestrictu3, bu3, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_diff3, U3, W3, CEED_REQUEST_IMMEDIATE);
+  for (CeedInt c=0; c<3; c++)
+    CompareVectors(W3, c*nu, V, 1., "vector diffusion operator");
+
+  CeedQFunctionDestroy(&qf_setup_mass);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedQFunctionDestroy(&qf_setup_diff);
+  CeedQFunctionDestroy(&qf_diff);
+  CeedQFunctionDestroy(&qf_setup_helm);
+  CeedQFunctionDestroy(&qf_helm);
+  CeedQFunctionDestroy(&qf_setup_aniso);
+  CeedQFunctionDestroy(&qf_diff3);
+  CeedQFunctionContextDestroy(&ctx);
+  CeedOperatorDestroy(&op_setup_mass);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_setup_diff);
+  CeedOperatorDestroy(&op_diff);
+  CeedOperatorDestroy(&op_setup_helm);
+  CeedOperatorDestroy(&op_helm);
+  CeedOperatorDestroy(&op_setup_aniso);
+  CeedOperatorDestroy(&op_aniso);
+  CeedOperatorDestroy(&op_diff3);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictu3);
+  CeedElemRestrictionDestroy(&Erestrictqm);
+  CeedElemRestrictionDestroy(&Erestrictqp);
+  CeedElemRestrictionDestroy(&Erestrictqh);
+  CeedBasisDestroy(&bx);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bu3);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&U3);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&W);
+  CeedVectorDestroy(&W3);
+  CeedVectorDestroy(&qdata_mass);
+  CeedVectorDestroy(&qdata_diff);
+  CeedVectorDestroy(&qdata_helm);
+  CeedVectorDestroy(&qdata_aniso);
+  CeedDestroy(&ceed);
+  return 0;
+}
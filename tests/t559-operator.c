@@ -0,0 +1,159 @@
+/// @file
+/// Test Poisson operator applied with element matrices
+/// \test Test Poisson operator applied with element matrices
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+#include "t531-operator.h"
+
+static void CheckEqual(CeedVector v, CeedVector vemat, CeedInt ndofs) {
+  const CeedScalar *vv, *ve;
+  CeedVectorGetArrayRead(v, CEED_MEM_HOST, &vv);
+  CeedVectorGetArrayRead(vemat, CEED_MEM_HOST, &ve);
+  for (CeedInt i=0; i<ndofs; i++)
+    if (fabs(vv[i] - ve[i]) > 1e4*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error: Element matrix v[%d] = %f != %f\n", i, ve[i], vv[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(v, &vv);
+  CeedVectorRestoreArrayRead(vemat, &ve);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictqi;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_diff;
+  CeedOperator op_setup, op_diff, op_diff_emat;
+  CeedVector qdata, X, u, v, vemat;
+  CeedScalar *hu;
+  CeedInt nelem = 12, P = 2, Q = 3, dim = 2;
+  CeedInt nx = 4, ny = 3;
+  CeedInt ndofs = (nx+1)*(ny+1), nqpts = nelem*Q*Q;
+  CeedInt indx[nelem*P*P];
+  CeedScalar x[dim*ndofs];
+
+  CeedInit(argv[1], &ceed);
+
+  // DoF Coordinates, perturbed so elements differ
+  for (CeedInt i=0; i<nx+1; i++)
+    for (CeedInt j=0; j<ny+1; j++) {
+      x[i+j*(nx+1)+0*ndofs] = (i + 0.1*(j%2)) / nx;
+      x[i+j*(nx+1)+1*ndofs] = (j + 0.2*(i%2)) / ny;
+    }
+  CeedVectorCreate(ceed, dim*ndofs, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+
+  // Qdata Vector
+  CeedVectorCreate(ceed, nqpts*dim*(dim+1)/2, &qdata);
+
+  // Element Setup
+  for (CeedInt i=0; i<nelem; i++) {
+    CeedInt col, row, offset;
+    col = i % nx;
+    row = i / nx;
+    offset = col + row*(nx+1);
+    for (CeedInt j=0; j<P; j++)
+      for (CeedInt k=0; k<P; k++)
+        indx[P*(P*i+k)+j] = offset + k*(nx+1) + j;
+  }
+
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, nelem, P*P, dim, ndofs, dim*ndofs,
+                            CEED_MEM_HOST, CEED_USE_POINTER, indx, &Erestrictx);
+  CeedElemRestrictionCreate(ceed, nelem, P*P, 1, 1, ndofs, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictu);
+  CeedInt stridesqd[3] = {1, Q*Q, Q *Q *dim *(dim+1)/2};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q*Q, dim*(dim+1)/2,
+                                   dim*(dim+1)/2*nqpts, stridesqd,
+                                   &Erestrictqi);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, P, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, P, Q, CEED_GAUSS, &bu);
+
+  // QFunction - setup
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "dx", dim*dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddOutput(qf_setup, "qdata", dim*(dim+1)/2, CEED_EVAL_NONE);
+
+  // Operator - setup
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "qdata", Erestrictqi, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  // Apply Setup Operator
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  // QFunction - apply
+  CeedQFunctionCreateInterior(ceed, 1, diff, diff_loc, &qf_diff);
+  CeedQFunctionAddInput(qf_diff, "du", dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_diff, "qdata", dim*(dim+1)/2, CEED_EVAL_NONE);
+  CeedQFunctionAddOutput(qf_diff, "dv", dim, CEED_EVAL_GRAD);
+
+  // Operators - matrix-free and element matrices
+  CeedOperatorCreate(ceed, qf_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_diff);
+  CeedOperatorSetField(op_diff, "du", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_diff, "qdata", Erestrictqi, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_diff, "dv", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_diff_emat);
+  CeedOperatorSetField(op_diff_emat, "du", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_diff_emat, "qdata", Erestrictqi,
+                       CEED_BASIS_COLLOCATED, qdata);
+  CeedOperatorSetField(op_diff_emat, "dv", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetElementMatrixMode(op_diff_emat, CEED_ELEMMATRIX_ALWAYS);
+
+  // Apply both operators
+  CeedVectorCreate(ceed, ndofs, &u);
+  CeedVectorGetArray(u, CEED_MEM_HOST, &hu);
+  for (CeedInt i=0; i<ndofs; i++)
+    hu[i] = sin(i);
+  CeedVectorRestoreArray(u, &hu);
+  CeedVectorCreate(ceed, ndofs, &v);
+  CeedVectorCreate(ceed, ndofs, &vemat);
+  CeedOperatorApply(op_diff, u, v, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_diff_emat, u, vemat, CEED_REQUEST_IMMEDIATE);
+  CheckEqual(v, vemat, ndofs);
+
+  // Element matrices are reassembled when qdata changes
+  CeedVectorAXPY(qdata, 1.0, qdata);
+  CeedOperatorApply(op_diff, u, v, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApplyAdd(op_diff, u, v, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_diff_emat, u, vemat, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApplyAdd(op_diff_emat, u, vemat, CEED_REQUEST_IMMEDIATE);
+  CheckEqual(v, vemat, ndofs);
+
+  // Automatic selection gives the same result either way
+  CeedOperatorSetElementMatrixMode(op_diff_emat, CEED_ELEMMATRIX_AUTO);
+  CeedOperatorApply(op_diff_emat, u, vemat, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_diff, u, v, CEED_REQUEST_IMMEDIATE);
+  CheckEqual(v, vemat, ndofs);
+
+  // Cleanup
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_diff);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_diff);
+  CeedOperatorDestroy(&op_diff_emat);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictqi);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&qdata);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&vemat);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,134 @@
+/// @file
+/// Test Chebyshev smoother for mass matrix operator
+/// \test Test Chebyshev smoother for mass matrix operator
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass, op_smooth;
+  CeedVector qdata, X, B, U, R, D;
+  CeedScalar *hb;
+  CeedInt nelem = 20, P = 2, Q = 2;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P];
+  CeedScalar x[Nx], norm0, norm;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+  }
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+
+  for (CeedInt i=0; i<nelem; i++) {
+    for (CeedInt j=0; j<P; j++) {
+      indu[P*i+j] = i*(P-1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, Nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedOperatorSetField(op_mass, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_mass, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  // Smoother, the spectrum of D^-1 M for linear elements is in [0.5, 1.5]
+  CeedVectorCreate(ceed, Nu, &D);
+  CeedOperatorLinearAssembleDiagonal(op_mass, D, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorCreateChebyshevSmoother(op_mass, D, 0.4, 1.6, 4, &op_smooth);
+
+  // Right hand side
+  CeedVectorCreate(ceed, Nu, &B);
+  CeedVectorGetArray(B, CEED_MEM_HOST, &hb);
+  for (CeedInt i=0; i<Nu; i++)
+    hb[i] = 1.0 + i % 3;
+  CeedVectorRestoreArray(B, &hb);
+  CeedVectorNorm(B, CEED_NORM_2, &norm0);
+
+  // Smoothing iterations, x += S (b - M x)
+  CeedVectorCreate(ceed, Nu, &U);
+  CeedVectorCreate(ceed, Nu, &R);
+  CeedOperatorApply(op_smooth, B, U, CEED_REQUEST_IMMEDIATE);
+  for (CeedInt k=0; k<3; k++) {
+    CeedOperatorApply(op_mass, U, R, CEED_REQUEST_IMMEDIATE);
+    CeedVectorAXPBY(R, 1.0, -1.0, B);
+    CeedOperatorApplyAdd(op_smooth, R, U, CEED_REQUEST_IMMEDIATE);
+  }
+
+  // Check residual, each application reduces it by 1/T_4(5/3) < 0.025
+  CeedOperatorApply(op_mass, U, R, CEED_REQUEST_IMMEDIATE);
+  CeedVectorAXPY(R, -1.0, B);
+  CeedVectorNorm(R, CEED_NORM_2, &norm);
+  if (norm > 1e-4*norm0)
+    // LCOV_EXCL_START
+    printf("Residual norm %e not reduced from %e\n", norm, norm0);
+  // LCOV_EXCL_STOP
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_smooth);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&B);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&R);
+  CeedVectorDestroy(&D);
+  CeedVectorDestroy(&qdata);
+  CeedDestroy(&ceed);
+  return 0;
+}
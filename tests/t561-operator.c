@@ -0,0 +1,145 @@
+/// @file
+/// Test point block Jacobi operator for mass matrix operator
+/// \test Test point block Jacobi operator for mass matrix operator
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+#include "t537-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu,
+                      Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass, op_pbjacobi;
+  CeedVector qdata, X, A, U, V;
+  CeedInt nelem = 6, P = 3, Q = 4, dim = 2, ncomp = 2;
+  CeedInt nx = 3, ny = 2;
+  CeedInt ndofs = (nx*2+1)*(ny*2+1), nqpts = nelem*Q*Q;
+  CeedInt indx[nelem*P*P];
+  CeedScalar x[dim*ndofs];
+  CeedScalar *u;
+  const CeedScalar *a, *v;
+
+  CeedInit(argv[1], &ceed);
+
+  // DoF Coordinates
+  for (CeedInt i=0; i<nx*2+1; i++)
+    for (CeedInt j=0; j<ny*2+1; j++) {
+      x[i+j*(nx*2+1)+0*ndofs] = (CeedScalar) i / (2*nx);
+      x[i+j*(nx*2+1)+1*ndofs] = (CeedScalar) j / (2*ny);
+    }
+  CeedVectorCreate(ceed, dim*ndofs, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+
+  // Qdata Vector
+  CeedVectorCreate(ceed, nqpts, &qdata);
+
+  // Element Setup
+  for (CeedInt i=0; i<nelem; i++) {
+    CeedInt col, row, offset;
+    col = i % nx;
+    row = i / nx;
+    offset = col*(P-1) + row*(nx*2+1)*(P-1);
+    for (CeedInt j=0; j<P; j++)
+      for (CeedInt k=0; k<P; k++)
+        indx[P*(P*i+k)+j] = offset + k*(nx*2+1) + j;
+  }
+
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, nelem, P*P, dim, ndofs, dim*ndofs,
+                            CEED_MEM_HOST, CEED_USE_POINTER, indx, &Erestrictx);
+  CeedElemRestrictionCreate(ceed, nelem, P*P, ncomp, ndofs, ncomp*ndofs,
+                            CEED_MEM_HOST, CEED_USE_POINTER, indx, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q*Q, Q*Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q*Q, 1, nqpts, stridesu,
+                                   &Erestrictui);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, P, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, ncomp, P, Q, CEED_GAUSS, &bu);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", dim*dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", ncomp, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", ncomp, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+  CeedOperatorSetField(op_mass, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_mass, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  // Apply Setup Operator
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  // Assemble point block diagonal
+  CeedVectorCreate(ceed, ncomp*ncomp*ndofs, &A);
+  CeedOperatorLinearAssemblePointBlockDiagonal(op_mass, A,
+      CEED_REQUEST_IMMEDIATE);
+
+  // Point block Jacobi, the blocks have a zero diagonal
+  CeedOperatorCreatePointBlockJacobi(op_mass, &op_pbjacobi);
+
+  // Apply point block diagonal on host
+  CeedVectorCreate(ceed, ncomp*ndofs, &U);
+  CeedVectorCreate(ceed, ncomp*ndofs, &V);
+  CeedVectorGetArray(U, CEED_MEM_HOST, &u);
+  CeedVectorGetArrayRead(A, CEED_MEM_HOST, &a);
+  for (int i=0; i<ndofs; i++)
+    for (int k=0; k<ncomp; k++) {
+      u[i + k*ndofs] = 0.0;
+      for (int j=0; j<ncomp; j++)
+        u[i + k*ndofs] += a[i*ncomp*ncomp + k*ncomp + j] * (1.0 + i % 3 + j);
+    }
+  CeedVectorRestoreArrayRead(A, &a);
+  CeedVectorRestoreArray(U, &u);
+
+  // Check output, the inverse blocks recover the input
+  CeedOperatorApply(op_pbjacobi, U, V, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+  for (int i=0; i<ndofs; i++)
+    for (int j=0; j<ncomp; j++)
+      if (fabs(v[i + j*ndofs] - (1.0 + i % 3 + j)) > 1e4*CEED_EPSILON)
+        // LCOV_EXCL_START
+        printf("[%d, %d] Error in point block Jacobi: %f != %f\n", i, j,
+               v[i + j*ndofs], 1.0 + i % 3 + j);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &v);
+
+  // Cleanup
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_pbjacobi);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&A);
+  CeedVectorDestroy(&qdata);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedDestroy(&ceed);
+  return 0;
+}
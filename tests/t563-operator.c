@@ -0,0 +1,165 @@
+/// @file
+/// Test multigrid coarse mass matrix operator evaluated at coarse quadrature
+/// \test Test multigrid coarse mass matrix operator evaluated at coarse quadrature
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t502-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictui,
+                      ErestrictuCoarse, ErestrictuFine;
+  CeedBasis bx, bCoarse, bFine;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_massCoarse, op_massCoarseQ, op_massFine,
+               op_prolong, op_restrict;
+  CeedVector qdata, X, Ucoarse, Vcoarse, VcoarseQ, PMultFine;
+  const CeedScalar *hv, *hvq;
+  CeedScalar *hu;
+  CeedInt nelem = 15, Pcoarse = 3, Pfine = 5, Q = 8, ncomp = 2, numqpts;
+  CeedInt Nx = nelem+1, NuCoarse = nelem*(Pcoarse-1)+1,
+          NuFine = nelem*(Pfine-1)+1;
+  CeedInt induCoarse[nelem*Pcoarse], induFine[nelem*Pfine],
+          indx[nelem*2];
+  CeedScalar x[Nx];
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i*i / ((Nx - 1)*(Nx - 1));
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+  }
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+
+  for (CeedInt i=0; i<nelem; i++) {
+    for (CeedInt j=0; j<Pcoarse; j++) {
+      induCoarse[Pcoarse*i+j] = i*(Pcoarse-1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, nelem, Pcoarse, ncomp, NuCoarse,
+                            ncomp*NuCoarse, CEED_MEM_HOST, CEED_USE_POINTER,
+                            induCoarse, &ErestrictuCoarse);
+
+  for (CeedInt i=0; i<nelem; i++) {
+    for (CeedInt j=0; j<Pfine; j++) {
+      induFine[Pfine*i+j] = i*(Pfine-1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, nelem, Pfine, ncomp, NuFine,
+                            ncomp*NuFine, CEED_MEM_HOST, CEED_USE_POINTER,
+                            induFine, &ErestrictuFine);
+
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, ncomp, Pcoarse, Q, CEED_GAUSS,
+                                  &bCoarse);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, ncomp, Pfine, Q, CEED_GAUSS, &bFine);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weights", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1*1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "qdata", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "qdata", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", ncomp, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", ncomp, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_massFine);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+
+  CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "qdata", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedOperatorSetField(op_massFine, "qdata", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_massFine, "u", ErestrictuFine, bFine,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_massFine, "v", ErestrictuFine, bFine,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetFieldBuilder(op_massFine, "qdata", op_setup, X);
+
+  // Create multigrid level
+  CeedVectorCreate(ceed, ncomp*NuFine, &PMultFine);
+  CeedVectorSetValue(PMultFine, 1.0);
+  CeedOperatorMultigridLevelCreate(op_massFine, PMultFine, ErestrictuCoarse,
+                                   bCoarse, &op_massCoarse, &op_prolong, &op_restrict);
+
+  // Coarse operator at coarse quadrature, exact for the affine elements
+  CeedOperatorCreateAtQuadrature(op_massCoarse, Pcoarse, CEED_GAUSS,
+                                 &op_massCoarseQ);
+  CeedOperatorGetNumQuadraturePoints(op_massCoarseQ, &numqpts);
+  if (numqpts != Pcoarse)
+    // LCOV_EXCL_START
+    printf("Coarse quadrature has %d points != %d\n", numqpts, Pcoarse);
+  // LCOV_EXCL_STOP
+
+  // Coarse problem
+  CeedVectorCreate(ceed, ncomp*NuCoarse, &Ucoarse);
+  CeedVectorGetArray(Ucoarse, CEED_MEM_HOST, &hu);
+  for (CeedInt i=0; i<ncomp*NuCoarse; i++)
+    hu[i] = 1.0 + i % 5;
+  CeedVectorRestoreArray(Ucoarse, &hu);
+  CeedVectorCreate(ceed, ncomp*NuCoarse, &Vcoarse);
+  CeedVectorCreate(ceed, ncomp*NuCoarse, &VcoarseQ);
+  CeedOperatorApply(op_massCoarse, Ucoarse, Vcoarse, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_massCoarseQ, Ucoarse, VcoarseQ, CEED_REQUEST_IMMEDIATE);
+
+  // Check output
+  CeedVectorGetArrayRead(Vcoarse, CEED_MEM_HOST, &hv);
+  CeedVectorGetArrayRead(VcoarseQ, CEED_MEM_HOST, &hvq);
+  for (CeedInt i=0; i<ncomp*NuCoarse; i++)
+    if (fabs(hv[i] - hvq[i]) > 1000*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("[%d] Coarse quadrature: %f != %f\n", i, hvq[i], hv[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(Vcoarse, &hv);
+  CeedVectorRestoreArrayRead(VcoarseQ, &hvq);
+
+  // Cleanup
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_massCoarse);
+  CeedOperatorDestroy(&op_massCoarseQ);
+  CeedOperatorDestroy(&op_massFine);
+  CeedOperatorDestroy(&op_prolong);
+  CeedOperatorDestroy(&op_restrict);
+  CeedElemRestrictionDestroy(&ErestrictuCoarse);
+  CeedElemRestrictionDestroy(&ErestrictuFine);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bCoarse);
+  CeedBasisDestroy(&bFine);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&Ucoarse);
+  CeedVectorDestroy(&Vcoarse);
+  CeedVectorDestroy(&VcoarseQ);
+  CeedVectorDestroy(&PMultFine);
+  CeedVectorDestroy(&qdata);
+  CeedDestroy(&ceed);
+  return 0;
+}
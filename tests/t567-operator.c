@@ -0,0 +1,160 @@
+/// @file
+/// Test saving and loading the setup state of a mass matrix operator
+/// \test Test saving and loading the setup state of a mass matrix operator
+#include <ceed.h>
+#include <ceed-backend.h>
+#include <math.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictui, rstrA[2];
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass[2];
+  CeedVector qdata[2], X, U, V, A[2];
+  CeedInt nelem = 15, P = 5, Q = 8;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P];
+  CeedScalar x[Nx];
+  const CeedScalar *hv, *ha[2];
+  uint64_t state, prevstate;
+  char filename[64];
+
+  CeedInit(argv[1], &ceed);
+  snprintf(filename, sizeof filename, "t567-operator-%d.bin", (int)getpid());
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+    for (CeedInt j=0; j<P; j++)
+      indu[P*i+j] = i*(P-1) + j;
+  }
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+  CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, Nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, Nu, &U);
+  CeedVectorSetValue(U, 1.0);
+  CeedVectorCreate(ceed, Nu, &V);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  // The second operator stands for the operator of a restarted run
+  for (CeedInt k=0; k<2; k++) {
+    CeedVectorCreate(ceed, nelem*Q, &qdata[k]);
+    CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_mass[k]);
+    CeedOperatorSetField(op_mass[k], "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                         qdata[k]);
+    CeedOperatorSetField(op_mass[k], "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_mass[k], "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetFieldBuilder(op_mass[k], "rho", op_setup, X);
+  }
+
+  // Build the quadrature data and the assembled QFunction, and save them
+  CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op_mass[0], &A[0],
+      &rstrA[0], CEED_REQUEST_IMMEDIATE);
+  CeedOperatorSave(op_mass[0], filename);
+
+  // Loaded quadrature data is not rebuilt
+  CeedOperatorLoad(op_mass[1], filename);
+  CeedVectorGetState(qdata[1], &prevstate);
+  CeedOperatorApply(op_mass[1], U, V, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetState(qdata[1], &state);
+  if (state != prevstate)
+    // LCOV_EXCL_START
+    printf("Loaded quadrature data rebuilt\n");
+  // LCOV_EXCL_STOP
+  CeedScalar sum = 0.;
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &hv);
+  for (CeedInt i=0; i<Nu; i++)
+    sum += hv[i];
+  CeedVectorRestoreArrayRead(V, &hv);
+  if (fabs(sum - 1.) > 1000*CEED_EPSILON)
+    // LCOV_EXCL_START
+    printf("Computed area %f != 1.0\n", (double)sum);
+  // LCOV_EXCL_STOP
+
+  // Loaded assembled QFunction is not reassembled
+  CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op_mass[1], &A[1],
+      &rstrA[1], CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetState(A[1], &prevstate);
+  CeedVectorDestroy(&A[1]);
+  CeedElemRestrictionDestroy(&rstrA[1]);
+  CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op_mass[1], &A[1],
+      &rstrA[1], CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetState(A[1], &state);
+  if (state != prevstate)
+    // LCOV_EXCL_START
+    printf("Loaded assembled QFunction reassembled\n");
+  // LCOV_EXCL_STOP
+  CeedVectorGetArrayRead(A[0], CEED_MEM_HOST, &ha[0]);
+  CeedVectorGetArrayRead(A[1], CEED_MEM_HOST, &ha[1]);
+  for (CeedInt i=0; i<nelem*Q; i++)
+    if (ha[0][i] != ha[1][i])
+      // LCOV_EXCL_START
+      printf("Assembled QFunction [%d] %f != %f\n", i, (double)ha[1][i],
+             (double)ha[0][i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(A[0], &ha[0]);
+  CeedVectorRestoreArrayRead(A[1], &ha[1]);
+
+  // An operator with other passive inputs is rejected
+  CeedSetErrorHandler(ceed, CeedErrorReturn);
+  if (!CeedOperatorLoad(op_setup, filename))
+    // LCOV_EXCL_START
+    printf("File loaded into an operator without passive inputs\n");
+  // LCOV_EXCL_STOP
+  remove(filename);
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  for (CeedInt k=0; k<2; k++) {
+    CeedOperatorDestroy(&op_mass[k]);
+    CeedVectorDestroy(&qdata[k]);
+    CeedVectorDestroy(&A[k]);
+    CeedElemRestrictionDestroy(&rstrA[k]);
+  }
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedDestroy(&ceed);
+  return 0;
+}
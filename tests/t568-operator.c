@@ -0,0 +1,110 @@
+/// @file
+/// Test reduction of an operator output over quadrature points
+/// \test Test reduction of an operator output over quadrature points
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+#include "t568-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictui;
+  CeedBasis bx;
+  CeedQFunction qf_setup;
+  CeedOperator op_setup, op_reduce[3];
+  CeedVector qdata, X, R[3];
+  CeedInt nelem = 15, Q = 8;
+  CeedInt Nx = nelem+1;
+  CeedInt indx[nelem*2];
+  CeedScalar x[Nx];
+  const CeedScalar *hq, *hr;
+  const CeedReduceType rtypes[3] = {CEED_REDUCE_SUM, CEED_REDUCE_MAX,
+                                    CEED_REDUCE_MIN
+                                   };
+
+  CeedInit(argv[1], &ceed);
+
+  // Graded mesh, so the quadrature data varies
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i*i / ((Nx - 1)*(Nx - 1));
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+  }
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+
+  // Reference quadrature data
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+  CeedScalar expected[3] = {0., -INFINITY, INFINITY};
+  CeedVectorGetArrayRead(qdata, CEED_MEM_HOST, &hq);
+  for (CeedInt i=0; i<nelem*Q; i++) {
+    expected[0] += hq[i];
+    expected[1] = fmax(expected[1], hq[i]);
+    expected[2] = fmin(expected[2], hq[i]);
+  }
+  CeedVectorRestoreArrayRead(qdata, &hq);
+
+  // Reduced quadrature data, without an output L-vector
+  for (CeedInt k=0; k<3; k++) {
+    CeedVectorCreate(ceed, 1, &R[k]);
+    CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_reduce[k]);
+    CeedOperatorSetField(op_reduce[k], "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                         CEED_VECTOR_NONE);
+    CeedOperatorSetField(op_reduce[k], "dx", Erestrictx, bx,
+                         CEED_VECTOR_ACTIVE);
+    CeedOperatorSetFieldReduce(op_reduce[k], "rho", rtypes[k], R[k]);
+
+    // Applying twice overwrites the result, adding combines with it
+    CeedOperatorApply(op_reduce[k], X, CEED_VECTOR_NONE,
+                      CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApply(op_reduce[k], X, CEED_VECTOR_NONE,
+                      CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApplyAdd(op_reduce[k], X, CEED_VECTOR_NONE,
+                         CEED_REQUEST_IMMEDIATE);
+    const CeedScalar value = k ? expected[k] : 2*expected[k];
+    CeedVectorGetArrayRead(R[k], CEED_MEM_HOST, &hr);
+    if (fabs(hr[0] - value) > 1000*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Reduction %s: %f != %f\n", CeedReduceTypes[rtypes[k]],
+             (double)hr[0], (double)value);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(R[k], &hr);
+  }
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedOperatorDestroy(&op_setup);
+  for (CeedInt k=0; k<3; k++) {
+    CeedOperatorDestroy(&op_reduce[k]);
+    CeedVectorDestroy(&R[k]);
+  }
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&qdata);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,127 @@
+/// @file
+/// Test chained mass matrix operators
+/// \test Test chained mass matrix operators
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu[2], Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass, op_chain;
+  CeedVector qdata, X, U, V, W, Y;
+  CeedInt nelem = 10, P = 4, Q = 5;
+  CeedInt Nx = nelem+1, Nu[2] = {nelem*(P-1)+1, nelem*P};
+  CeedInt indx[nelem*2], indu[2][nelem*P];
+  CeedScalar x[Nx];
+  const CeedScalar *hw, *hy;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+    for (CeedInt j=0; j<P; j++) {
+      indu[0][P*i+j] = i*(P-1) + j;
+      indu[1][P*i+j] = i*P + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  // Continuous, then discontinuous fields; the chain keeps the intermediate
+  //   of the latter in element layout
+  for (CeedInt k=0; k<2; k++) {
+    CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, Nu[k], CEED_MEM_HOST,
+                              CEED_USE_POINTER, indu[k], &Erestrictu[k]);
+    CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_mass);
+    CeedOperatorSetField(op_mass, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                         qdata);
+    CeedOperatorSetField(op_mass, "u", Erestrictu[k], bu, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_mass, "v", Erestrictu[k], bu, CEED_VECTOR_ACTIVE);
+    CeedOperatorCreateChain(op_mass, op_mass, &op_chain);
+
+    CeedVectorCreate(ceed, Nu[k], &U);
+    CeedVectorCreate(ceed, Nu[k], &V);
+    CeedVectorCreate(ceed, Nu[k], &W);
+    CeedVectorCreate(ceed, Nu[k], &Y);
+    CeedScalar *hu;
+    CeedVectorGetArray(U, CEED_MEM_HOST, &hu);
+    for (CeedInt i=0; i<Nu[k]; i++)
+      hu[i] = 1 + sin(i);
+    CeedVectorRestoreArray(U, &hu);
+
+    // Two applications of the mass matrix, then the chain, applied and added
+    CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApply(op_mass, V, W, CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApply(op_chain, U, Y, CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApplyAdd(op_chain, U, Y, CEED_REQUEST_IMMEDIATE);
+
+    CeedVectorGetArrayRead(W, CEED_MEM_HOST, &hw);
+    CeedVectorGetArrayRead(Y, CEED_MEM_HOST, &hy);
+    for (CeedInt i=0; i<Nu[k]; i++)
+      if (fabs(hy[i] - 2*hw[i]) > 100*CEED_EPSILON)
+        // LCOV_EXCL_START
+        printf("Chain %d [%d]: %g != %g\n", k, i, (double)hy[i],
+               (double)(2*hw[i]));
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(W, &hw);
+    CeedVectorRestoreArrayRead(Y, &hy);
+
+    CeedOperatorDestroy(&op_mass);
+    CeedOperatorDestroy(&op_chain);
+    CeedElemRestrictionDestroy(&Erestrictu[k]);
+    CeedVectorDestroy(&U);
+    CeedVectorDestroy(&V);
+    CeedVectorDestroy(&W);
+    CeedVectorDestroy(&Y);
+  }
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&qdata);
+  CeedDestroy(&ceed);
+  return 0;
+}
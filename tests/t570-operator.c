@@ -0,0 +1,153 @@
+/// @file
+/// Test transpose of a non-square operator
+/// \test Test transpose of a non-square operator
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+#include "t570-operator.h"
+
+static CeedScalar Dot(CeedVector x, CeedVector y) {
+  CeedInt n;
+  const CeedScalar *a, *b;
+  CeedScalar sum = 0.;
+
+  CeedVectorGetLength(x, &n);
+  CeedVectorGetArrayRead(x, CEED_MEM_HOST, &a);
+  CeedVectorGetArrayRead(y, CEED_MEM_HOST, &b);
+  for (CeedInt i=0; i<n; i++)
+    sum += a[i] * b[i];
+  CeedVectorRestoreArrayRead(x, &a);
+  CeedVectorRestoreArrayRead(y, &b);
+  return sum;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictv, Erestrictui;
+  CeedBasis bx, bu, bv;
+  CeedQFunction qf_setup, qf_couple;
+  CeedOperator op_setup, op_couple, op_composite;
+  CeedVector qdata, X, U, V, AU, ATV;
+  CeedInt nelem = 6, P = 4, Pv = 3, Q = 5;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1, Nv = nelem*(Pv-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P], indv[nelem*Pv];
+  CeedScalar x[Nx], u[2*Nu], v[Nv];
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+    for (CeedInt j=0; j<P; j++)
+      indu[P*i+j] = i*(P-1) + j;
+    for (CeedInt j=0; j<Pv; j++)
+      indv[Pv*i+j] = i*(Pv-1) + j;
+  }
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+  CeedElemRestrictionCreate(ceed, nelem, P, 2, Nu, 2*Nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+  CeedElemRestrictionCreate(ceed, nelem, Pv, 1, 1, Nv, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indv, &Erestrictv);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 2, P, Q, CEED_GAUSS, &bu);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, Pv, Q, CEED_GAUSS, &bv);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, couple, couple_loc, &qf_couple);
+  CeedQFunctionAddInput(qf_couple, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_couple, "du", 2, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_couple, "v", 1, CEED_EVAL_INTERP);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  CeedOperatorCreate(ceed, qf_couple, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_couple);
+  CeedOperatorSetField(op_couple, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_couple, "du", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_couple, "v", Erestrictv, bv, CEED_VECTOR_ACTIVE);
+
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  CeedCompositeOperatorAddSub(op_composite, op_couple);
+  CeedCompositeOperatorAddSub(op_composite, op_couple);
+
+  for (CeedInt i=0; i<2*Nu; i++)
+    u[i] = sin(i + 1.0);
+  for (CeedInt i=0; i<Nv; i++)
+    v[i] = cos(3.0*i);
+  CeedVectorCreate(ceed, 2*Nu, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedVectorCreate(ceed, Nv, &V);
+  CeedVectorSetArray(V, CEED_MEM_HOST, CEED_USE_POINTER, v);
+  CeedVectorCreate(ceed, Nv, &AU);
+  CeedVectorCreate(ceed, 2*Nu, &ATV);
+
+  // <A u, v> = <u, A^T v>
+  for (CeedInt k=0; k<2; k++) {
+    CeedOperator op = k ? op_composite : op_couple;
+    CeedOperatorApply(op, U, AU, CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApplyTranspose(op, V, ATV, CEED_REQUEST_IMMEDIATE);
+    CeedScalar lhs = Dot(AU, V), rhs = Dot(U, ATV);
+    if (fabs(lhs - rhs) > 1e4*CEED_EPSILON * fabs(lhs) || fabs(lhs) < 1e-6)
+      // LCOV_EXCL_START
+      printf("Error in transpose %d: %f != %f\n", k, (double)rhs,
+             (double)lhs);
+    // LCOV_EXCL_STOP
+  }
+
+  // Updated quadrature data is picked up by the transpose
+  CeedOperatorApplyTranspose(op_couple, V, ATV, CEED_REQUEST_IMMEDIATE);
+  CeedScalar before = Dot(U, ATV);
+  CeedVectorAXPY(qdata, 1.0, qdata);
+  CeedOperatorApplyTranspose(op_couple, V, ATV, CEED_REQUEST_IMMEDIATE);
+  CeedScalar after = Dot(U, ATV);
+  if (fabs(after - 2.0 * before) > 1e4*CEED_EPSILON * fabs(after))
+    // LCOV_EXCL_START
+    printf("Error in updated transpose: %f != %f\n", (double)after,
+           (double)(2.0 * before));
+  // LCOV_EXCL_STOP
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_couple);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_couple);
+  CeedOperatorDestroy(&op_composite);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictv);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bx);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bv);
+  CeedVectorDestroy(&qdata);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&AU);
+  CeedVectorDestroy(&ATV);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,148 @@
+/// @file
+/// Test mass matrix operator split between Ceeds
+/// \test Test mass matrix operator split between Ceeds
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t500-operator.h"
+
+#define NELEM 15
+#define P 5
+#define Q 8
+
+// Mass operator over elements [first, last) of a mesh of NELEM elements
+static int CreateMassOperator(Ceed ceed, CeedInt first, CeedInt last,
+                              CeedOperator *op_mass) {
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup;
+  CeedVector qdata, X;
+  CeedInt nelem = last - first, Nx = NELEM+1, Nu = NELEM*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P];
+  CeedScalar x[Nx];
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = first+i;
+    indx[2*i+1] = first+i+1;
+    for (CeedInt j=0; j<P; j++)
+      indu[P*i+j] = (first+i)*(P-1) + j;
+  }
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_COPY_VALUES, indx, &Erestrictx);
+  CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, Nu, CEED_MEM_HOST,
+                            CEED_COPY_VALUES, indu, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     op_mass);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_COPY_VALUES, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(*op_mass, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(*op_mass, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(*op_mass, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  // The operator holds references to the objects it uses
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&qdata);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed, ceedsplit[2];
+  CeedOperator op_mass, op_full[2], op_split;
+  CeedVector U, V, Vsplit;
+  CeedInt Nu = NELEM*(P-1)+1;
+  CeedScalar *u;
+  const CeedScalar *v, *vsplit;
+
+  CeedInit(argv[1], &ceed);
+  CeedInit(argv[1], &ceedsplit[0]);
+  CeedInit("/cpu/self/ref/serial", &ceedsplit[1]);
+
+  CreateMassOperator(ceed, 0, NELEM, &op_mass);
+
+  // The whole operator on each Ceed, with its elements split between them
+  for (CeedInt s=0; s<2; s++) {
+    CeedSetCurrentDevice(ceedsplit[s]);
+    CreateMassOperator(ceedsplit[s], 0, NELEM, &op_full[s]);
+  }
+  CeedSetCurrentDevice(ceed);
+  CeedShardedOperatorCreateSplit(ceed, 2, op_full, &op_split);
+
+  CeedVectorCreate(ceed, Nu, &U);
+  CeedVectorGetArray(U, CEED_MEM_HOST, &u);
+  for (CeedInt i=0; i<Nu; i++)
+    u[i] = 1. + sin(i);
+  CeedVectorRestoreArray(U, &u);
+  CeedVectorCreate(ceed, Nu, &V);
+  CeedVectorCreate(ceed, Nu, &Vsplit);
+
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+
+  // Check output while the split is balanced and after
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+  for (CeedInt k=0; k<4; k++) {
+    CeedOperatorApply(op_split, U, Vsplit, CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(Vsplit, CEED_MEM_HOST, &vsplit);
+    for (CeedInt i=0; i<Nu; i++)
+      if (fabs(v[i] - vsplit[i]) > 1000*CEED_EPSILON)
+        // LCOV_EXCL_START
+        printf("Error in split operator, apply %d: [%d] %g != %g\n", k, i,
+               vsplit[i], v[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(Vsplit, &vsplit);
+  }
+  CeedVectorRestoreArrayRead(V, &v);
+
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_full[0]);
+  CeedOperatorDestroy(&op_full[1]);
+  CeedOperatorDestroy(&op_split);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&Vsplit);
+  CeedDestroy(&ceedsplit[0]);
+  CeedDestroy(&ceedsplit[1]);
+  CeedDestroy(&ceed);
+  return 0;
+}
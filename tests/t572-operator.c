@@ -0,0 +1,203 @@
+/// @file
+/// Test concurrent applies of distinct operators sharing one Ceed and objects
+/// \test Test concurrent applies of distinct operators sharing one Ceed and objects
+#include <ceed.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t500-operator.h"
+
+#define NELEM 15
+#define P 5
+#define Q 8
+
+// Mass operators over elements [first, last) of a mesh of NELEM elements,
+//   sharing their restrictions, bases, and QFunctions; the first two also
+//   share their passive quadrature data, later ones have their own copy
+static int CreateMassOperators(Ceed ceed, CeedInt first, CeedInt last,
+                               CeedInt nop, CeedOperator *op_mass) {
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup;
+  CeedVector qdata, X;
+  CeedInt nelem = last - first, Nx = NELEM+1, Nu = NELEM*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P];
+  CeedScalar x[Nx];
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = first+i;
+    indx[2*i+1] = first+i+1;
+    for (CeedInt j=0; j<P; j++)
+      indu[P*i+j] = (first+i)*(P-1) + j;
+  }
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_COPY_VALUES, indx, &Erestrictx);
+  CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, Nu, CEED_MEM_HOST,
+                            CEED_COPY_VALUES, indu, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_COPY_VALUES, x);
+
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  for (CeedInt k=0; k<nop; k++) {
+    // The second operator reuses the quadrature data of the first
+    if (k != 1) {
+      CeedVectorCreate(ceed, nelem*Q, &qdata);
+      CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+    }
+    CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_mass[k]);
+    CeedOperatorSetField(op_mass[k], "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                         qdata);
+    CeedOperatorSetField(op_mass[k], "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_mass[k], "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+    if (k != 0 || nop == 1)
+      CeedVectorDestroy(&qdata);
+  }
+
+  // The operators hold references to the objects they use
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  return 0;
+}
+
+#define NAPPLY 10
+
+typedef struct {
+  CeedOperator op;
+  CeedVector U, V;
+} ThreadData;
+
+// Apply an operator, then release it, and so any objects it shares
+static void *ApplyMany(void *arg) {
+  ThreadData *data = arg;
+  for (CeedInt k=0; k<NAPPLY; k++)
+    CeedOperatorApply(data->op, data->U, data->V, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorDestroy(&data->op);
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedOperator op_mass, op_shared[3];
+  CeedVector U, V;
+  CeedInt Nu = NELEM*(P-1)+1, first[3] = {0, NELEM/2, NELEM};
+  CeedScalar u[Nu];
+  const CeedScalar *v, *vt[3];
+  ThreadData data[3];
+  pthread_t threads[3];
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<Nu; i++)
+    u[i] = 1. + sin(i);
+  CreateMassOperators(ceed, 0, NELEM, 1, &op_mass);
+  CeedVectorCreate(ceed, Nu, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_COPY_VALUES, u);
+  CeedVectorCreate(ceed, Nu, &V);
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+
+  // Each thread applies the operator on half of the elements to its own
+  //   vectors
+  for (CeedInt t=0; t<2; t++) {
+    CreateMassOperators(ceed, first[t], first[t+1], 1, &data[t].op);
+    CeedVectorCreate(ceed, Nu, &data[t].U);
+    CeedVectorSetArray(data[t].U, CEED_MEM_HOST, CEED_COPY_VALUES, u);
+    CeedVectorCreate(ceed, Nu, &data[t].V);
+  }
+  for (CeedInt t=0; t<2; t++)
+    pthread_create(&threads[t], NULL, ApplyMany, &data[t]);
+  for (CeedInt t=0; t<2; t++)
+    pthread_join(threads[t], NULL);
+
+  // The halves sum to the whole operator
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+  CeedVectorGetArrayRead(data[0].V, CEED_MEM_HOST, &vt[0]);
+  CeedVectorGetArrayRead(data[1].V, CEED_MEM_HOST, &vt[1]);
+  for (CeedInt i=0; i<Nu; i++)
+    if (fabs(v[i] - (vt[0][i] + vt[1][i])) > 1000*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Error in concurrent applies: [%d] %g != %g\n", i,
+             vt[0][i] + vt[1][i], v[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &v);
+  CeedVectorRestoreArrayRead(data[0].V, &vt[0]);
+  CeedVectorRestoreArrayRead(data[1].V, &vt[1]);
+  for (CeedInt t=0; t<2; t++) {
+    CeedVectorDestroy(&data[t].U);
+    CeedVectorDestroy(&data[t].V);
+  }
+
+  // Each thread applies an operator on all elements to a scaled input; the
+  //   operators share their restrictions, and the first two share their
+  //   passive input
+  CreateMassOperators(ceed, 0, NELEM, 3, op_shared);
+  for (CeedInt t=0; t<3; t++) {
+    CeedScalar ut[Nu];
+    for (CeedInt i=0; i<Nu; i++)
+      ut[i] = (t+1)*u[i];
+    data[t].op = op_shared[t];
+    CeedVectorCreate(ceed, Nu, &data[t].U);
+    CeedVectorSetArray(data[t].U, CEED_MEM_HOST, CEED_COPY_VALUES, ut);
+    CeedVectorCreate(ceed, Nu, &data[t].V);
+  }
+  for (CeedInt t=0; t<3; t++)
+    pthread_create(&threads[t], NULL, ApplyMany, &data[t]);
+  for (CeedInt t=0; t<3; t++)
+    pthread_join(threads[t], NULL);
+
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+  for (CeedInt t=0; t<3; t++) {
+    CeedVectorGetArrayRead(data[t].V, CEED_MEM_HOST, &vt[t]);
+    for (CeedInt i=0; i<Nu; i++)
+      if (fabs((t+1)*v[i] - vt[t][i]) > 1000*CEED_EPSILON)
+        // LCOV_EXCL_START
+        printf("Error in concurrent shared applies: [%d][%d] %g != %g\n", t,
+               i, vt[t][i], (t+1)*v[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(data[t].V, &vt[t]);
+    CeedVectorDestroy(&data[t].U);
+    CeedVectorDestroy(&data[t].V);
+  }
+  CeedVectorRestoreArrayRead(V, &v);
+
+  CeedOperatorDestroy(&op_mass);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedDestroy(&ceed);
+  return 0;
+}
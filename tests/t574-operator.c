@@ -0,0 +1,156 @@
+/// @file
+/// Test applying mass matrix operators of two orders borrowing their work
+///   from the scratch arena of a Ceed
+/// \test Test applying mass matrix operators borrowing work from the arena
+#include <ceed.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t500-operator.h"
+
+#define NELEM 15
+
+typedef struct {
+  CeedElemRestriction Erestrictu;
+  CeedBasis bu;
+  CeedOperator op_setup, op_mass;
+  CeedVector qdata, U, V;
+  CeedInt Nu;
+} MassData;
+
+static void CreateMass(Ceed ceed, CeedInt P, CeedInt Q,
+                       CeedElemRestriction Erestrictx, CeedVector X,
+                       CeedQFunction qf_setup, CeedQFunction qf_mass,
+                       MassData *m) {
+  CeedElemRestriction Erestrictui;
+  CeedBasis bx;
+  CeedInt indu[NELEM*P];
+
+  m->Nu = NELEM*(P-1)+1;
+  for (CeedInt i=0; i<NELEM; i++)
+    for (CeedInt j=0; j<P; j++)
+      indu[P*i+j] = i*(P-1) + j;
+  CeedElemRestrictionCreate(ceed, NELEM, P, 1, 1, m->Nu, CEED_MEM_HOST,
+                            CEED_COPY_VALUES, indu, &m->Erestrictu);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, NELEM, Q, 1, Q*NELEM, stridesu,
+                                   &Erestrictui);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &m->bu);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &m->op_setup);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &m->op_mass);
+  CeedVectorCreate(ceed, NELEM*Q, &m->qdata);
+  CeedOperatorSetField(m->op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(m->op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(m->op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(m->op_mass, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       m->qdata);
+  CeedOperatorSetField(m->op_mass, "u", m->Erestrictu, m->bu,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(m->op_mass, "v", m->Erestrictu, m->bu,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorApply(m->op_setup, X, m->qdata, CEED_REQUEST_IMMEDIATE);
+
+  CeedVectorCreate(ceed, m->Nu, &m->U);
+  CeedVectorSetValue(m->U, 1.0);
+  CeedVectorCreate(ceed, m->Nu, &m->V);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bx);
+}
+
+static void DestroyMass(MassData *m) {
+  CeedOperatorDestroy(&m->op_setup);
+  CeedOperatorDestroy(&m->op_mass);
+  CeedElemRestrictionDestroy(&m->Erestrictu);
+  CeedBasisDestroy(&m->bu);
+  CeedVectorDestroy(&m->qdata);
+  CeedVectorDestroy(&m->U);
+  CeedVectorDestroy(&m->V);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx;
+  CeedQFunction qf_setup, qf_mass;
+  CeedVector X;
+  CeedInt Nx = NELEM+1, indx[NELEM*2];
+  CeedScalar x[Nx];
+  MassData m[2];
+
+  CeedInit(argv[1], &ceed);
+  CeedSetSharedWork(ceed, true);
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<NELEM; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+  }
+  CeedElemRestrictionCreate(ceed, NELEM, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CreateMass(ceed, 3, 4, Erestrictx, X, qf_setup, qf_mass, &m[0]);
+  CreateMass(ceed, 5, 8, Erestrictx, X, qf_setup, qf_mass, &m[1]);
+
+  // Operators applied in turn reuse the same arena arrays; the entries of
+  //   M 1 sum to the length of the domain
+  for (CeedInt k=0; k<4; k++) {
+    MassData *mk = &m[k % 2];
+    const CeedScalar *v;
+    CeedScalar sum = 0.;
+    CeedOperatorApply(mk->op_mass, mk->U, mk->V, CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(mk->V, CEED_MEM_HOST, &v);
+    for (CeedInt i=0; i<mk->Nu; i++)
+      sum += v[i];
+    CeedVectorRestoreArrayRead(mk->V, &v);
+    if (fabs(sum - 1.) > 1e6*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Application %d: computed area %f != 1\n", k, sum);
+    // LCOV_EXCL_STOP
+  }
+
+  // An application failing part way through, here on quadrature data held
+  //   for writing, returns its arena arrays for the next one to reuse
+  size_t highwater, highwaterafter;
+  CeedScalar *q;
+  CeedGetMemoryHighWater(ceed, CEED_MEMSPACE_HOST, &highwater);
+  CeedSetErrorHandler(ceed, CeedErrorStore);
+  CeedVectorGetArray(m[0].qdata, CEED_MEM_HOST, &q);
+  if (!CeedOperatorApply(m[0].op_mass, m[0].U, m[0].V, CEED_REQUEST_IMMEDIATE))
+    // LCOV_EXCL_START
+    printf("Application reading quadrature data held for writing succeeded\n");
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArray(m[0].qdata, &q);
+  CeedOperatorApply(m[0].op_mass, m[0].U, m[0].V, CEED_REQUEST_IMMEDIATE);
+  CeedGetMemoryHighWater(ceed, CEED_MEMSPACE_HOST, &highwaterafter);
+  if (highwaterafter != highwater)
+    // LCOV_EXCL_START
+    printf("Host memory high-water mark grew from %zu to %zu bytes\n",
+           highwater, highwaterafter);
+  // LCOV_EXCL_STOP
+
+  DestroyMass(&m[0]);
+  DestroyMass(&m[1]);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedVectorDestroy(&X);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,105 @@
+/// @file
+/// Test operators with an element-wise constant field through a Q_0 basis
+/// \test Test operators with an element-wise constant field
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictc, Erestrictqi;
+  CeedBasis bc, bw;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass;
+  CeedVector C, qdata, U, V;
+  const CeedInt nelem = 6, dim = 2, Q = 3, Qtot = Q*Q;
+  CeedScalar c[nelem];
+  const CeedScalar *a;
+
+  CeedInit(argv[1], &ceed);
+
+  // One value per element, broadcast to the quadrature points by a Q_0 basis
+  CeedInt stridesc[3] = {1, 1, 1};
+  CeedElemRestrictionCreateStrided(ceed, nelem, 1, 1, nelem, stridesc,
+                                   &Erestrictc);
+  CeedInt stridesq[3] = {1, Qtot, Qtot};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Qtot, 1, nelem*Qtot, stridesq,
+                                   &Erestrictqi);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, 1, Q, CEED_GAUSS, &bc);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, 2, Q, CEED_GAUSS, &bw);
+
+  // qdata = w c at the quadrature points
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "c", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  // v = B_0^T (qdata B_0 u) sums over the quadrature points of each element
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedVectorCreate(ceed, nelem, &C);
+  for (CeedInt e=0; e<nelem; e++)
+    c[e] = 1 + e;
+  CeedVectorSetArray(C, CEED_MEM_HOST, CEED_USE_POINTER, c);
+  CeedVectorCreate(ceed, nelem*Qtot, &qdata);
+  CeedVectorCreate(ceed, nelem, &U);
+  CeedVectorSetValue(U, 1.0);
+  CeedVectorCreate(ceed, nelem, &V);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bw,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "c", Erestrictc, bc, C);
+  CeedOperatorSetField(op_setup, "rho", Erestrictqi, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+  CeedOperatorSetField(op_mass, "rho", Erestrictqi, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_mass, "u", Erestrictc, bc, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", Erestrictc, bc, CEED_VECTOR_ACTIVE);
+
+  // The reference weights of each element sum to 2^dim
+  CeedOperatorApply(op_setup, CEED_VECTOR_NONE, qdata, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(qdata, CEED_MEM_HOST, &a);
+  for (CeedInt e=0; e<nelem; e++) {
+    CeedScalar sum = 0.;
+    for (CeedInt q=0; q<Qtot; q++)
+      sum += a[e*Qtot + q];
+    if (fabs(sum - 4*c[e]) > 1e4*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Element %d: sum of qdata %f != %f\n", e, sum, 4*c[e]);
+    // LCOV_EXCL_STOP
+  }
+  CeedVectorRestoreArrayRead(qdata, &a);
+
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &a);
+  for (CeedInt e=0; e<nelem; e++)
+    if (fabs(a[e] - 4*c[e]) > 1e4*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Element %d: v %f != %f\n", e, a[e], 4*c[e]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &a);
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedElemRestrictionDestroy(&Erestrictc);
+  CeedElemRestrictionDestroy(&Erestrictqi);
+  CeedBasisDestroy(&bc);
+  CeedBasisDestroy(&bw);
+  CeedVectorDestroy(&C);
+  CeedVectorDestroy(&qdata);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,153 @@
+/// @file
+/// Test applying a composite operator whose suboperators share fields
+/// \test Test applying a composite operator whose suboperators share fields
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass, qf_grad;
+  CeedOperator op_setup, op_mass, op_mass2, op_grad, op_composite;
+  CeedOperator ops[3];
+  CeedVector qdata, qdata2, X, U, V, W;
+  CeedInt nelem = 15, P = 5, Q = 8;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P];
+  CeedScalar x[Nx], u[Nu];
+  const CeedScalar *v, *w;
+
+  CeedInit(argv[1], &ceed);
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+  }
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+  for (CeedInt i=0; i<nelem; i++)
+    for (CeedInt j=0; j<P; j++)
+      indu[P*i+j] = i*(P-1) + j;
+  CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, Nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Same pointwise product on gradients gives a stiffness-like operator
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_grad);
+  CeedQFunctionAddInput(qf_grad, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_grad, "du", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_grad, "dv", 1, CEED_EVAL_GRAD);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+  CeedVectorCreate(ceed, nelem*Q, &qdata2);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+  CeedVectorSetValue(qdata2, 0.0);
+  CeedVectorAXPY(qdata2, 2.0, qdata);
+
+  // Suboperators share u and v, and the restriction and basis of du and dv
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+  CeedOperatorSetField(op_mass, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_mass, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass2);
+  CeedOperatorSetField(op_mass2, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata2);
+  CeedOperatorSetField(op_mass2, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass2, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorCreate(ceed, qf_grad, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_grad);
+  CeedOperatorSetField(op_grad, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_grad, "du", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_grad, "dv", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  ops[0] = op_mass; ops[1] = op_mass2; ops[2] = op_grad;
+
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  for (CeedInt k=0; k<3; k++)
+    CeedCompositeOperatorAddSub(op_composite, ops[k]);
+
+  for (CeedInt i=0; i<Nu; i++)
+    u[i] = sin(i + 1.0);
+  CeedVectorCreate(ceed, Nu, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedVectorCreate(ceed, Nu, &V);
+  CeedVectorCreate(ceed, Nu, &W);
+
+  // Composite matches the sum of its suboperators, also when added to
+  for (CeedInt pass=0; pass<2; pass++) {
+    if (pass == 0) {
+      CeedOperatorApply(op_composite, U, V, CEED_REQUEST_IMMEDIATE);
+      CeedVectorSetValue(W, 0.0);
+    } else {
+      CeedVectorSetValue(V, 1.0);
+      CeedOperatorApplyAdd(op_composite, U, V, CEED_REQUEST_IMMEDIATE);
+      CeedVectorSetValue(W, 1.0);
+    }
+    for (CeedInt k=0; k<3; k++)
+      CeedOperatorApplyAdd(ops[k], U, W, CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+    CeedVectorGetArrayRead(W, CEED_MEM_HOST, &w);
+    for (CeedInt i=0; i<Nu; i++)
+      if (fabs(v[i] - w[i]) > 1e4*CEED_EPSILON)
+        // LCOV_EXCL_START
+        printf("Pass %d: composite v[%d] %f != %f\n", pass, i, v[i], w[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(V, &v);
+    CeedVectorRestoreArrayRead(W, &w);
+  }
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedQFunctionDestroy(&qf_grad);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_mass2);
+  CeedOperatorDestroy(&op_grad);
+  CeedOperatorDestroy(&op_composite);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&W);
+  CeedVectorDestroy(&qdata);
+  CeedVectorDestroy(&qdata2);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,169 @@
+/// @file
+/// Test applying mass matrix operators with Dirichlet constrained entries
+/// \test Test applying mass matrix operators with Dirichlet constrained entries
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass, op_bc, op_composite;
+  CeedVector qdata, X, U, Ug, V, W, G;
+  CeedInt nelem = 15, P = 5, Q = 8;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P];
+  CeedInt bcind[3] = {0, Nu-1, 2*(P-1)};
+  CeedScalar x[Nx], u[Nu], g[3] = {1.0, -2.0, 0.5};
+  const CeedScalar *v, *w;
+
+  CeedInit(argv[1], &ceed);
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+  }
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+  for (CeedInt i=0; i<nelem; i++)
+    for (CeedInt j=0; j<P; j++)
+      indu[P*i+j] = i*(P-1) + j;
+  CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, Nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  // Unconstrained operator, constrained copy, and constrained composite
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+  CeedOperatorSetField(op_mass, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_mass, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_bc);
+  CeedOperatorSetField(op_bc, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_bc, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_bc, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  CeedCompositeOperatorAddSub(op_composite, op_mass);
+
+  CeedVectorCreate(ceed, 3, &G);
+  CeedVectorSetArray(G, CEED_MEM_HOST, CEED_USE_POINTER, g);
+  CeedOperatorSetDirichlet(op_bc, 3, bcind, G);
+  CeedOperatorSetDirichlet(op_composite, 3, bcind, G);
+
+  for (CeedInt i=0; i<Nu; i++)
+    u[i] = sin(i + 1.0);
+  CeedVectorCreate(ceed, Nu, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedVectorCreate(ceed, Nu, &Ug);
+  CeedVectorCreate(ceed, Nu, &V);
+  CeedVectorCreate(ceed, Nu, &W);
+
+  // Reference: unconstrained operator applied to the input with the values
+  //   inserted, with the constrained output entries zeroed or kept
+  for (CeedInt pass=0; pass<6; pass++) {
+    CeedOperator op = pass % 3 == 2 ? op_composite : op_bc;
+    bool add = pass % 3 == 1, homogeneous = pass >= 3;
+    CeedScalar *ug, *ww, dot = 0.;
+
+    if (pass == 3) {
+      CeedOperatorSetDirichlet(op_bc, 3, bcind, CEED_VECTOR_NONE);
+      CeedOperatorSetDirichlet(op_composite, 3, bcind, CEED_VECTOR_NONE);
+    }
+    CeedVectorSetValue(W, 1.0);
+    CeedVectorSetArray(Ug, CEED_MEM_HOST, CEED_COPY_VALUES, u);
+    CeedVectorGetArray(Ug, CEED_MEM_HOST, &ug);
+    for (CeedInt k=0; k<3; k++)
+      ug[bcind[k]] = homogeneous ? 0.0 : g[k];
+    CeedVectorRestoreArray(Ug, &ug);
+    if (add) {
+      CeedOperatorApplyAdd(op_mass, Ug, W, CEED_REQUEST_IMMEDIATE);
+    } else {
+      CeedOperatorApply(op_mass, Ug, W, CEED_REQUEST_IMMEDIATE);
+    }
+    CeedVectorGetArray(W, CEED_MEM_HOST, &ww);
+    for (CeedInt k=0; k<3; k++)
+      ww[bcind[k]] = add ? 1.0 : 0.0;
+    CeedVectorRestoreArray(W, &ww);
+
+    CeedVectorSetValue(V, 1.0);
+    if (add) {
+      CeedOperatorApplyAdd(op, U, V, CEED_REQUEST_IMMEDIATE);
+    } else {
+      CeedOperatorApplyDot(op, U, V, &dot, CEED_REQUEST_IMMEDIATE);
+    }
+
+    CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+    CeedVectorGetArrayRead(W, CEED_MEM_HOST, &w);
+    CeedScalar sum = 0.;
+    for (CeedInt i=0; i<Nu; i++) {
+      if (fabs(v[i] - w[i]) > 1e4*CEED_EPSILON)
+        // LCOV_EXCL_START
+        printf("Pass %d: v[%d] %f != %f\n", pass, i, v[i], w[i]);
+      // LCOV_EXCL_STOP
+      sum += u[i] * w[i];
+    }
+    if (!add && fabs(dot - sum) > 1e4*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("Pass %d: u^T v %f != %f\n", pass, dot, sum);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(V, &v);
+    CeedVectorRestoreArrayRead(W, &w);
+  }
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_bc);
+  CeedOperatorDestroy(&op_composite);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&qdata);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&Ug);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&W);
+  CeedVectorDestroy(&G);
+  CeedDestroy(&ceed);
+  return 0;
+}
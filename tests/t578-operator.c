@@ -0,0 +1,114 @@
+/// @file
+/// Test applying a face operator with a two-sided restriction
+/// \test Test applying a face operator with a two-sided restriction
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t578-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrict2, Erestrict0, Erestrict1;
+  CeedBasis bu, bu2;
+  CeedQFunction qf_jump, qf_sides;
+  CeedOperator op_jump, op_sides;
+  CeedVector U, V, W;
+  const CeedInt nx = 7, P = 3, Q = 4, nfaces = nx-1, Nu = nx*P*P;
+  CeedInt ind2[nfaces*2*P], ind0[nfaces*P], ind1[nfaces*P];
+  CeedScalar u[Nu];
+  const CeedScalar *v, *w;
+
+  CeedInit(argv[1], &ceed);
+
+  // Row of discontinuous quads; face f joins the right edge of element f to
+  //   the left edge of element f+1
+  for (CeedInt f=0; f<nfaces; f++)
+    for (CeedInt j=0; j<P; j++) {
+      ind0[f*P+j] = f*P*P + j*P + P-1;
+      ind1[f*P+j] = (f+1)*P*P + j*P;
+      ind2[(2*f+0)*P+j] = ind0[f*P+j];
+      ind2[(2*f+1)*P+j] = ind1[f*P+j];
+    }
+  CeedElemRestrictionCreateTwoSided(ceed, nfaces, P, 1, 1, Nu, CEED_MEM_HOST,
+                                    CEED_USE_POINTER, ind2, &Erestrict2);
+  CeedElemRestrictionCreate(ceed, nfaces, P, 1, 1, Nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind0, &Erestrict0);
+  CeedElemRestrictionCreate(ceed, nfaces, P, 1, 1, Nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, ind1, &Erestrict1);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 2, P, Q, CEED_GAUSS, &bu2);
+
+  CeedQFunctionCreateInterior(ceed, 1, jump, jump_loc, &qf_jump);
+  CeedQFunctionAddInput(qf_jump, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_jump, "u", 2, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_jump, "v", 2, CEED_EVAL_INTERP);
+
+  CeedQFunctionCreateInterior(ceed, 1, jump_sides, jump_sides_loc, &qf_sides);
+  CeedQFunctionAddInput(qf_sides, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_sides, "u0", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddInput(qf_sides, "u1", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_sides, "v0", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_sides, "v1", 1, CEED_EVAL_INTERP);
+
+  // One gather and one scatter for both sides
+  CeedOperatorCreate(ceed, qf_jump, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_jump);
+  CeedOperatorSetField(op_jump, "weight", CEED_ELEMRESTRICTION_NONE, bu,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_jump, "u", Erestrict2, bu2, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_jump, "v", Erestrict2, bu2, CEED_VECTOR_ACTIVE);
+
+  // Reference with one restriction per side
+  CeedOperatorCreate(ceed, qf_sides, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_sides);
+  CeedOperatorSetField(op_sides, "weight", CEED_ELEMRESTRICTION_NONE, bu,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_sides, "u0", Erestrict0, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_sides, "u1", Erestrict1, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_sides, "v0", Erestrict0, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_sides, "v1", Erestrict1, bu, CEED_VECTOR_ACTIVE);
+
+  for (CeedInt i=0; i<Nu; i++)
+    u[i] = sin(i + 1.0);
+  CeedVectorCreate(ceed, Nu, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedVectorCreate(ceed, Nu, &V);
+  CeedVectorCreate(ceed, Nu, &W);
+
+  // Apply, then add to the result
+  for (CeedInt pass=0; pass<2; pass++) {
+    if (pass == 0) {
+      CeedOperatorApply(op_jump, U, V, CEED_REQUEST_IMMEDIATE);
+      CeedOperatorApply(op_sides, U, W, CEED_REQUEST_IMMEDIATE);
+    } else {
+      CeedOperatorApplyAdd(op_jump, U, V, CEED_REQUEST_IMMEDIATE);
+      CeedOperatorApplyAdd(op_sides, U, W, CEED_REQUEST_IMMEDIATE);
+    }
+    CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+    CeedVectorGetArrayRead(W, CEED_MEM_HOST, &w);
+    for (CeedInt i=0; i<Nu; i++)
+      if (fabs(v[i] - w[i]) > 1e4*CEED_EPSILON)
+        // LCOV_EXCL_START
+        printf("Pass %d: v[%d] %f != %f\n", pass, i, v[i], w[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(V, &v);
+    CeedVectorRestoreArrayRead(W, &w);
+  }
+
+  CeedQFunctionDestroy(&qf_jump);
+  CeedQFunctionDestroy(&qf_sides);
+  CeedOperatorDestroy(&op_jump);
+  CeedOperatorDestroy(&op_sides);
+  CeedElemRestrictionDestroy(&Erestrict2);
+  CeedElemRestrictionDestroy(&Erestrict0);
+  CeedElemRestrictionDestroy(&Erestrict1);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bu2);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&W);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,41 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+// Face terms of both sides at once; component 0 of u and v is side 0 and
+//   component 1 is side 1
+CEED_QFUNCTION(jump)(void *ctx, const CeedInt Q, const CeedScalar *const *in,
+                     CeedScalar *const *out) {
+  const CeedScalar *weight = in[0], *u = in[1];
+  CeedScalar *v = out[0];
+  for (CeedInt i=0; i<Q; i++) {
+    v[i] = weight[i] * (u[i] - u[Q+i]);
+    v[Q+i] = weight[i] * (2.0 * u[Q+i] - u[i]);
+  }
+  return 0;
+}
+
+// Same face terms with one field per side
+CEED_QFUNCTION(jump_sides)(void *ctx, const CeedInt Q,
+                           const CeedScalar *const *in,
+                           CeedScalar *const *out) {
+  const CeedScalar *weight = in[0], *u0 = in[1], *u1 = in[2];
+  CeedScalar *v0 = out[0], *v1 = out[1];
+  for (CeedInt i=0; i<Q; i++) {
+    v0[i] = weight[i] * (u0[i] - u1[i]);
+    v1[i] = weight[i] * (2.0 * u1[i] - u0[i]);
+  }
+  return 0;
+}
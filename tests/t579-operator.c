@@ -0,0 +1,122 @@
+/// @file
+/// Test applying a p-adaptive mass matrix operator
+/// \test Test applying a p-adaptive mass matrix operator
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t500-operator.h"
+
+#define NELEM 10
+#define PMAX 5
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedBasis bx[PMAX+1] = {NULL}, bu[PMAX+1] = {NULL};
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass;
+  CeedVector qdata, X, U, V;
+  CeedInt elemorder[NELEM], sizex[PMAX+1], sizeu[PMAX+1], sizeq[PMAX+1];
+  CeedInt indx[NELEM*2], indu[NELEM*PMAX], Nx = NELEM+1, Nu = 1, Nq = 0;
+  CeedScalar x[Nx], u[NELEM*PMAX];
+  const CeedScalar *v;
+
+  CeedInit(argv[1], &ceed);
+
+  // Elements of 2, 3, and 5 nodes with Q = P + 1 quadrature points
+  for (CeedInt e=0, k=0; e<NELEM; e++) {
+    const CeedInt P = e % 3 == 0 ? 2 : e % 3 == 1 ? 3 : 5;
+    elemorder[e] = P;
+    indx[2*e+0] = e;
+    indx[2*e+1] = e+1;
+    for (CeedInt j=0; j<P; j++)
+      indu[k++] = Nu - 1 + j;
+    Nu += P - 1;
+    Nq += P + 1;
+  }
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt P=2; P<=PMAX; P++) {
+    sizex[P] = 2;
+    sizeu[P] = P;
+    sizeq[P] = P + 1;
+    CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, P+1, CEED_GAUSS, &bx[P]);
+    CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, P+1, CEED_GAUSS, &bu[P]);
+  }
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, Nq, &qdata);
+
+  CeedOperatorCreatePAdaptive(ceed, qf_setup, NELEM, elemorder, &op_setup);
+  CeedOperatorSetFieldPAdaptive(op_setup, "_weight", NULL, 1, 1, 0, NULL, bx,
+                                CEED_VECTOR_NONE);
+  CeedOperatorSetFieldPAdaptive(op_setup, "dx", sizex, 1, 1, Nx, indx, bx,
+                                CEED_VECTOR_ACTIVE);
+  CeedOperatorSetFieldPAdaptive(op_setup, "rho", sizeq, 1, 1, Nq, NULL, NULL,
+                                CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreatePAdaptive(ceed, qf_mass, NELEM, elemorder, &op_mass);
+  CeedOperatorSetFieldPAdaptive(op_mass, "rho", sizeq, 1, 1, Nq, NULL, NULL,
+                                qdata);
+  CeedOperatorSetFieldPAdaptive(op_mass, "u", sizeu, 1, 1, Nu, indu, bu,
+                                CEED_VECTOR_ACTIVE);
+  CeedOperatorSetFieldPAdaptive(op_mass, "v", sizeu, 1, 1, Nu, indu, bu,
+                                CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  // u = x at the Gauss-Lobatto nodes, so 1^T M u = 1/2 and u^T M u = 1/3
+  for (CeedInt e=0, k=0; e<NELEM; e++) {
+    const CeedInt P = elemorder[e];
+    CeedScalar xq[PMAX], wq[PMAX];
+    CeedLobattoQuadrature(P, xq, wq);
+    for (CeedInt j=0; j<P; j++, k++)
+      u[indu[k]] = x[e] + (x[e+1] - x[e]) * (xq[j] + 1) / 2;
+  }
+  CeedVectorCreate(ceed, Nu, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedVectorCreate(ceed, Nu, &V);
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+
+  CeedScalar sum = 0., usum = 0.;
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+  for (CeedInt i=0; i<Nu; i++) {
+    sum += v[i];
+    usum += u[i] * v[i];
+  }
+  CeedVectorRestoreArrayRead(V, &v);
+  if (fabs(sum - 1./2) > 1e4*CEED_EPSILON)
+    // LCOV_EXCL_START
+    printf("1^T M u %f != 1/2\n", sum);
+  // LCOV_EXCL_STOP
+  if (fabs(usum - 1./3) > 1e4*CEED_EPSILON)
+    // LCOV_EXCL_START
+    printf("u^T M u %f != 1/3\n", usum);
+  // LCOV_EXCL_STOP
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  for (CeedInt P=2; P<=PMAX; P++) {
+    CeedBasisDestroy(&bx[P]);
+    CeedBasisDestroy(&bu[P]);
+  }
+  CeedVectorDestroy(&qdata);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,116 @@
+/// @file
+/// Test FDM element inverses scaled by direction on anisotropic elements
+/// \test Test FDM element inverses scaled by direction
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+#include "t580-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictc, Erestrictui, Erestrictqi;
+  CeedBasis bc, bu;
+  CeedQFunction qf_setup, qf_apply;
+  CeedOperator op_setup, op_apply, op_inv;
+  CeedVector C, qdata, U, V, W;
+  const CeedInt nelem = 3, P = 4, Q = 5, dim = 2;
+  const CeedInt elemsize = P*P, Qtot = Q*Q, ndofs = nelem*elemsize;
+  CeedScalar c[3*nelem], u[ndofs];
+  const CeedScalar *w;
+
+  CeedInit(argv[1], &ceed);
+
+  // Mass and diffusion coefficients of stretched axis-aligned elements
+  for (CeedInt e=0; e<nelem; e++) {
+    c[3*e+0] = 1.0 + e;
+    c[3*e+1] = 0.01 * (e + 1);
+    c[3*e+2] = 100.0 / (e + 1);
+  }
+  CeedInt stridesc[3] = {1, 1, 3};
+  CeedElemRestrictionCreateStrided(ceed, nelem, 1, 3, 3*nelem, stridesc,
+                                   &Erestrictc);
+  CeedInt stridesu[3] = {1, elemsize, elemsize};
+  CeedElemRestrictionCreateStrided(ceed, nelem, elemsize, 1, ndofs, stridesu,
+                                   &Erestrictui);
+  CeedInt stridesq[3] = {1, Qtot, 3*Qtot};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Qtot, 3, 3*nelem*Qtot,
+                                   stridesq, &Erestrictqi);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 3, 1, Q, CEED_GAUSS, &bc);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, P, Q, CEED_GAUSS, &bu);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup_aniso, setup_aniso_loc,
+                              &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "c", 3, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_setup, "qdata", 3, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, aniso, aniso_loc, &qf_apply);
+  CeedQFunctionAddInput(qf_apply, "qdata", 3, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_apply, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddInput(qf_apply, "du", dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_apply, "v", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_apply, "dv", dim, CEED_EVAL_GRAD);
+
+  CeedVectorCreate(ceed, 3*nelem, &C);
+  CeedVectorSetArray(C, CEED_MEM_HOST, CEED_USE_POINTER, c);
+  CeedVectorCreate(ceed, 3*nelem*Qtot, &qdata);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bu,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "c", Erestrictc, bc, C);
+  CeedOperatorSetField(op_setup, "qdata", Erestrictqi, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+  CeedOperatorApply(op_setup, CEED_VECTOR_NONE, qdata, CEED_REQUEST_IMMEDIATE);
+
+  // Elements are decoupled, so the operator is block diagonal
+  CeedOperatorCreate(ceed, qf_apply, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_apply);
+  CeedOperatorSetField(op_apply, "qdata", Erestrictqi, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_apply, "u", Erestrictui, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "du", Erestrictui, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "v", Erestrictui, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "dv", Erestrictui, bu, CEED_VECTOR_ACTIVE);
+
+  // With directional scaling the FDM inverse of each element is exact
+  CeedOperatorSetFDMMode(op_apply, CEED_FDM_DIRECTIONAL);
+  CeedOperatorCreateFDMElementInverse(op_apply, &op_inv,
+                                      CEED_REQUEST_IMMEDIATE);
+
+  for (CeedInt i=0; i<ndofs; i++)
+    u[i] = sin(i + 1.0);
+  CeedVectorCreate(ceed, ndofs, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedVectorCreate(ceed, ndofs, &V);
+  CeedVectorCreate(ceed, ndofs, &W);
+  CeedOperatorApply(op_apply, U, V, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_inv, V, W, CEED_REQUEST_IMMEDIATE);
+
+  CeedVectorGetArrayRead(W, CEED_MEM_HOST, &w);
+  for (CeedInt i=0; i<ndofs; i++)
+    if (fabs(w[i] - u[i]) > 1e6*CEED_EPSILON)
+      // LCOV_EXCL_START
+      printf("[%d] Error in inverse: %f != %f\n", i, w[i], u[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(W, &w);
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_apply);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_apply);
+  CeedOperatorDestroy(&op_inv);
+  CeedElemRestrictionDestroy(&Erestrictc);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedElemRestrictionDestroy(&Erestrictqi);
+  CeedBasisDestroy(&bc);
+  CeedBasisDestroy(&bu);
+  CeedVectorDestroy(&C);
+  CeedVectorDestroy(&qdata);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&W);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,40 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+// Weighted element coefficients of the mass and of each direction
+CEED_QFUNCTION(setup_aniso)(void *ctx, const CeedInt Q,
+                            const CeedScalar *const *in,
+                            CeedScalar *const *out) {
+  const CeedScalar *weight = in[0], *c = in[1];
+  CeedScalar *qdata = out[0];
+  for (CeedInt i=0; i<Q; i++)
+    for (CeedInt k=0; k<3; k++)
+      qdata[k*Q+i] = weight[i] * c[k*Q+i];
+  return 0;
+}
+
+// Mass and anisotropic diffusion with diagonal coefficients
+CEED_QFUNCTION(aniso)(void *ctx, const CeedInt Q, const CeedScalar *const *in,
+                      CeedScalar *const *out) {
+  const CeedScalar *qdata = in[0], *u = in[1], *du = in[2];
+  CeedScalar *v = out[0], *dv = out[1];
+  for (CeedInt i=0; i<Q; i++) {
+    v[i] = qdata[i] * u[i];
+    dv[i] = qdata[Q+i] * du[i];
+    dv[Q+i] = qdata[2*Q+i] * du[Q+i];
+  }
+  return 0;
+}
@@ -0,0 +1,142 @@
+/// @file
+/// Test reduced precision copies of a mass matrix operator and a composite operator
+/// \test Test reduced precision copies of a mass matrix operator and a composite operator
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t500-operator.h"
+
+static int CheckClose(CeedVector v, CeedVector vreduced, CeedScalar tol,
+                      const char *name) {
+  CeedInt n;
+  const CeedScalar *hv, *hvreduced;
+  CeedScalar vmax = 0.;
+
+  CeedVectorGetLength(v, &n);
+  CeedVectorGetArrayRead(v, CEED_MEM_HOST, &hv);
+  CeedVectorGetArrayRead(vreduced, CEED_MEM_HOST, &hvreduced);
+  for (CeedInt i=0; i<n; i++)
+    vmax = fmax(vmax, fabs(hv[i]));
+  for (CeedInt i=0; i<n; i++)
+    if (fabs(hv[i] - hvreduced[i]) > tol*vmax)
+      // LCOV_EXCL_START
+      printf("Error in %s: [%d] reduced %f != %f\n", name, i,
+             (double)hvreduced[i], (double)hv[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(v, &hv);
+  CeedVectorRestoreArrayRead(vreduced, &hvreduced);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass, op_composite, op_reduced, op_compreduced;
+  CeedVector qdata, X, U, V, Vreduced;
+  CeedInt nelem = 15, P = 5, Q = 8;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P];
+  CeedScalar x[Nx], *hu;
+  const CeedStorageType storage[2] = {CEED_STORAGE_FP32, CEED_STORAGE_BF16};
+  const CeedScalar tol[2] = {1e-6, 1e-2};
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+    for (CeedInt j=0; j<P; j++)
+      indu[P*i+j] = i*(P-1) + j;
+  }
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+  CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, Nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+  CeedVectorCreate(ceed, Nu, &U);
+  CeedVectorGetArray(U, CEED_MEM_HOST, &hu);
+  for (CeedInt i=0; i<Nu; i++)
+    hu[i] = 1.0 + sin((CeedScalar)i);
+  CeedVectorRestoreArray(U, &hu);
+  CeedVectorCreate(ceed, Nu, &V);
+  CeedVectorCreate(ceed, Nu, &Vreduced);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+  CeedOperatorSetField(op_mass, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_mass, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  CeedCompositeOperatorAddSub(op_composite, op_mass);
+
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+
+  for (CeedInt k=0; k<2; k++) {
+    // Single operator
+    CeedOperatorCreateReducedPrecision(op_mass, storage[k], &op_reduced);
+    CeedOperatorApply(op_reduced, U, Vreduced, CEED_REQUEST_IMMEDIATE);
+    CheckClose(V, Vreduced, tol[k], CeedStorageTypes[storage[k]]);
+
+    // Composite operator
+    CeedOperatorCreateReducedPrecision(op_composite, storage[k],
+                                       &op_compreduced);
+    CeedOperatorApply(op_compreduced, U, Vreduced, CEED_REQUEST_IMMEDIATE);
+    CheckClose(V, Vreduced, tol[k], CeedStorageTypes[storage[k]]);
+
+    CeedOperatorDestroy(&op_reduced);
+    CeedOperatorDestroy(&op_compreduced);
+  }
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_composite);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&Vreduced);
+  CeedVectorDestroy(&qdata);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,215 @@
+/// @file
+/// Test ensemble of mass matrix operators with different meshes and contexts
+/// \test Test ensemble of mass matrix operators with different meshes and contexts
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t583-operator.h"
+
+#define NUMINST 3
+
+static int CheckEnsemble(CeedVector *v, CeedVector vensemble,
+                         const char *name) {
+  const CeedScalar *hv, *hvensemble;
+
+  CeedVectorGetArrayRead(vensemble, CEED_MEM_HOST, &hvensemble);
+  for (CeedInt k=0, start=0; k<NUMINST; k++) {
+    CeedInt n;
+    CeedVectorGetLength(v[k], &n);
+    CeedVectorGetArrayRead(v[k], CEED_MEM_HOST, &hv);
+    for (CeedInt i=0; i<n; i++)
+      if (fabs(hv[i] - hvensemble[start+i]) > 100*CEED_EPSILON)
+        // LCOV_EXCL_START
+        printf("Error in %s: instance %d [%d] %f != %f\n", name, k, i,
+               (double)hvensemble[start+i], (double)hv[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(v[k], &hv);
+    start += n;
+  }
+  CeedVectorRestoreArrayRead(vensemble, &hvensemble);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx[NUMINST], Erestrictu[NUMINST],
+                      Erestrictui[NUMINST];
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass[NUMINST];
+  CeedQFunctionContext ctx[NUMINST];
+  CeedOperator op_setup[NUMINST], op_mass[NUMINST], op_setupensemble,
+               op_massensemble;
+  CeedVector qdata[NUMINST], X[NUMINST], U[NUMINST], V[NUMINST],
+             Xensemble, Uensemble, Vensemble, qdataensemble;
+  CeedInt P = 4, Q = 5, Nxtotal = 0, Nutotal = 0, nqtotal = 0;
+  CeedScalar scale[NUMINST];
+  CeedMemType mtype;
+
+  CeedInit(argv[1], &ceed);
+
+  // Instances with different meshes and mass coefficients
+  for (CeedInt k=0; k<NUMINST; k++) {
+    CeedInt nelem = 3 + 2*k, Nx = nelem+1, Nu = nelem*(P-1)+1;
+    CeedInt indx[nelem*2], indu[nelem*P];
+    CeedScalar *hx, *hu;
+
+    for (CeedInt i=0; i<nelem; i++) {
+      indx[2*i+0] = i;
+      indx[2*i+1] = i+1;
+      for (CeedInt j=0; j<P; j++)
+        indu[P*i+j] = i*(P-1) + j;
+    }
+    CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                              CEED_COPY_VALUES, indx, &Erestrictx[k]);
+    CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, Nu, CEED_MEM_HOST,
+                              CEED_COPY_VALUES, indu, &Erestrictu[k]);
+    CeedInt stridesu[3] = {1, Q, Q};
+    CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                     &Erestrictui[k]);
+
+    CeedVectorCreate(ceed, Nx, &X[k]);
+    CeedVectorGetArray(X[k], CEED_MEM_HOST, &hx);
+    for (CeedInt i=0; i<Nx; i++)
+      hx[i] = (k + 1.0) * i / (Nx - 1) + (i % 2) * 0.1 / Nx;
+    CeedVectorRestoreArray(X[k], &hx);
+    CeedVectorCreate(ceed, nelem*Q, &qdata[k]);
+    CeedVectorCreate(ceed, Nu, &U[k]);
+    CeedVectorGetArray(U[k], CEED_MEM_HOST, &hu);
+    for (CeedInt i=0; i<Nu; i++)
+      hu[i] = 1.0 + sin((CeedScalar)(i + k));
+    CeedVectorRestoreArray(U[k], &hu);
+    CeedVectorCreate(ceed, Nu, &V[k]);
+    Nxtotal += Nx;
+    Nutotal += Nu;
+    nqtotal += nelem*Q;
+
+    scale[k] = 1.0 + k;
+    CeedQFunctionContextCreate(ceed, &ctx[k]);
+    CeedQFunctionContextSetData(ctx[k], CEED_MEM_HOST, CEED_USE_POINTER,
+                                sizeof(scale[k]), &scale[k]);
+  }
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  for (CeedInt k=0; k<NUMINST; k++) {
+    CeedQFunctionCreateInterior(ceed, 1, scaled_mass, scaled_mass_loc,
+                                &qf_mass[k]);
+    CeedQFunctionAddInput(qf_mass[k], "rho", 1, CEED_EVAL_NONE);
+    CeedQFunctionAddInput(qf_mass[k], "u", 1, CEED_EVAL_INTERP);
+    CeedQFunctionAddOutput(qf_mass[k], "v", 1, CEED_EVAL_INTERP);
+    CeedQFunctionSetContext(qf_mass[k], ctx[k]);
+
+    CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE,
+                       CEED_QFUNCTION_NONE, &op_setup[k]);
+    CeedOperatorSetField(op_setup[k], "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                         CEED_VECTOR_NONE);
+    CeedOperatorSetField(op_setup[k], "dx", Erestrictx[k], bx,
+                         CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_setup[k], "rho", Erestrictui[k],
+                         CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+    CeedOperatorApply(op_setup[k], X[k], qdata[k], CEED_REQUEST_IMMEDIATE);
+
+    CeedOperatorCreate(ceed, qf_mass[k], CEED_QFUNCTION_NONE,
+                       CEED_QFUNCTION_NONE, &op_mass[k]);
+    CeedOperatorSetField(op_mass[k], "rho", Erestrictui[k],
+                         CEED_BASIS_COLLOCATED, qdata[k]);
+    CeedOperatorSetField(op_mass[k], "u", Erestrictu[k], bu,
+                         CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_mass[k], "v", Erestrictu[k], bu,
+                         CEED_VECTOR_ACTIVE);
+  }
+
+  // Setup instances share the QFunction, applied on concatenated L-vectors
+  CeedOperatorCreateEnsemble(NUMINST, op_setup, &op_setupensemble);
+  CeedVectorCreate(ceed, Nxtotal, &Xensemble);
+  CeedVectorCreate(ceed, nqtotal, &qdataensemble);
+  {
+    CeedScalar *hxensemble;
+    const CeedScalar *hx;
+    CeedVectorGetArray(Xensemble, CEED_MEM_HOST, &hxensemble);
+    for (CeedInt k=0, start=0; k<NUMINST; k++) {
+      CeedInt n;
+      CeedVectorGetLength(X[k], &n);
+      CeedVectorGetArrayRead(X[k], CEED_MEM_HOST, &hx);
+      for (CeedInt i=0; i<n; i++)
+        hxensemble[start+i] = hx[i];
+      CeedVectorRestoreArrayRead(X[k], &hx);
+      start += n;
+    }
+    CeedVectorRestoreArray(Xensemble, &hxensemble);
+  }
+  CeedOperatorApply(op_setupensemble, Xensemble, qdataensemble,
+                    CEED_REQUEST_IMMEDIATE);
+  CheckEnsemble(qdata, qdataensemble, "setup");
+
+  // Mass instances with distinct contexts, on backends calling user functions
+  CeedGetPreferredMemType(ceed, &mtype);
+  if (mtype == CEED_MEM_HOST) {
+    CeedScalar *huensemble;
+    const CeedScalar *hu;
+
+    CeedOperatorCreateEnsemble(NUMINST, op_mass, &op_massensemble);
+    CeedVectorCreate(ceed, Nutotal, &Uensemble);
+    CeedVectorCreate(ceed, Nutotal, &Vensemble);
+    CeedVectorGetArray(Uensemble, CEED_MEM_HOST, &huensemble);
+    for (CeedInt k=0, start=0; k<NUMINST; k++) {
+      CeedInt n;
+      CeedVectorGetLength(U[k], &n);
+      CeedVectorGetArrayRead(U[k], CEED_MEM_HOST, &hu);
+      for (CeedInt i=0; i<n; i++)
+        huensemble[start+i] = hu[i];
+      CeedVectorRestoreArrayRead(U[k], &hu);
+      start += n;
+    }
+    CeedVectorRestoreArray(Uensemble, &huensemble);
+
+    for (CeedInt k=0; k<NUMINST; k++)
+      CeedOperatorApply(op_mass[k], U[k], V[k], CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApply(op_massensemble, Uensemble, Vensemble,
+                      CEED_REQUEST_IMMEDIATE);
+    CheckEnsemble(V, Vensemble, "mass");
+
+    // Changed coefficient of one instance
+    CeedScalar *hscale;
+    CeedQFunctionContextGetData(ctx[1], CEED_MEM_HOST, &hscale);
+    hscale[0] = -0.5;
+    CeedQFunctionContextRestoreData(ctx[1], &hscale);
+    CeedOperatorApply(op_mass[1], U[1], V[1], CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApply(op_massensemble, Uensemble, Vensemble,
+                      CEED_REQUEST_IMMEDIATE);
+    CheckEnsemble(V, Vensemble, "mass with changed context");
+
+    CeedOperatorDestroy(&op_massensemble);
+    CeedVectorDestroy(&Uensemble);
+    CeedVectorDestroy(&Vensemble);
+  }
+
+  for (CeedInt k=0; k<NUMINST; k++) {
+    CeedQFunctionDestroy(&qf_mass[k]);
+    CeedQFunctionContextDestroy(&ctx[k]);
+    CeedOperatorDestroy(&op_setup[k]);
+    CeedOperatorDestroy(&op_mass[k]);
+    CeedElemRestrictionDestroy(&Erestrictu[k]);
+    CeedElemRestrictionDestroy(&Erestrictx[k]);
+    CeedElemRestrictionDestroy(&Erestrictui[k]);
+    CeedVectorDestroy(&X[k]);
+    CeedVectorDestroy(&U[k]);
+    CeedVectorDestroy(&V[k]);
+    CeedVectorDestroy(&qdata[k]);
+  }
+  CeedQFunctionDestroy(&qf_setup);
+  CeedOperatorDestroy(&op_setupensemble);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&Xensemble);
+  CeedVectorDestroy(&qdataensemble);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -85,7 +85,7 @@ for ((i=0;i<${#backends[@]};++i)); do
     fi
 
     # Navier-Stokes test problem too large for most CUDA backends
-    if [[ "$backend" = *gpu* && "$backend" != /gpu/cuda/gen && \
+    if [[ "$backend" = *gpu* && "$backend" != /gpu/cuda/gen && "$backend" != /gpu/hip/gen && \
             ( "$1" = fluids-* ) ]]; then
         printf "ok $i0 # SKIP - test problem too large for $backend\n"
         printf "ok $i1 # SKIP - test problem too large for $backend stdout\n"
@@ -167,7 +167,10 @@ for ((i=0;i<${#backends[@]};++i)); do
     fi
 
     # stdout
-    if [ -f tests/output/$1.out ]; then
+    if [ -f tests/output/$1.out ] && [ "$SINGLE" = 1 ]; then
+    # Reference outputs are printed in double precision
+        printf "ok $i1 # SKIP - reference output not in single precision $1 $backend stdout\n"
+    elif [ -f tests/output/$1.out ]; then
         if diff -u tests/output/$1.out ${output}.out > ${output}.diff; then
             printf "ok $i1 $1 $backend stdout\n"
         else